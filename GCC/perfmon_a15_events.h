@@ -0,0 +1,80 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_A15 30
+
+static const char a15_arch_event_strings[] =
+    "SW_INCR\0"
+    "PMC\0"
+    "L1I_CACHE_REFILL\0"
+    "L1I_TLB_REFILL\0"
+    "L1D_CACHE_REFILL\0"
+    "L1D_CACHE\0"
+    "L1D_TLB_REFILL\0"
+    "LD_RETIRED\0"
+    "ST_RETIRED\0"
+    "INST_RETIRED\0"
+    "EXC_TAKEN\0"
+    "EXC_RETURN\0"
+    "CID_WRITE_RETIRED\0"
+    "PC_WRITE_RETIRED\0"
+    "BR_IMMED_RETIRED\0"
+    "BR_RETURN_RETIRED\0"
+    "UNALIGNED_LDST_RETIRED\0"
+    "BR_MIS_PRED\0"
+    "CPU_CYCLES\0"
+    "BR_PRED\0"
+    "MEM_ACCESS\0"
+    "L1I_CACHE\0"
+    "L1D_CACHE_WB\0"
+    "L2D_CACHE\0"
+    "L2D_CACHE_REFILL\0"
+    "L2D_CACHE_WB\0"
+    "BUS_ACCESS\0"
+    "MEMORY_ERROR\0"
+    "INST_SPEC\0"
+    "TTBR_WRITE_RETIRED\0"
+    "BUS_CYCLES\0";
+
+static const PerfmonEventOption a15_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry a15_arch_event_entries[NUM_ARCH_EVENTS_A15] = {
+ {0, 8, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12, 8, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 8, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44, 8, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 8, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 8, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 8, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {97, 8, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {108, 8, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 8, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {131, 8, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {142, 8, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {160, 8, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {177, 8, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {194, 8, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {212, 8, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {235, 8, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {247, 8, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {258, 8, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {266, 8, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {277, 8, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {287, 8, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {300, 8, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 8, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {327, 8, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {340, 8, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {351, 8, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {364, 8, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {374, 8, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {393, 8, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable a15_arch_events = {
+    NUM_ARCH_EVENTS_A15,
+    a15_arch_event_strings,
+    a15_arch_event_options,
+    a15_arch_event_entries
+};
@@ -0,0 +1,188 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_A57 84
+
+static const char a57_arch_event_strings[] =
+    "SW_INCR\0"
+    "PMC\0"
+    "L1I_CACHE_REFILL\0"
+    "L1I_TLB_REFILL\0"
+    "L1D_CACHE_REFILL\0"
+    "L1D_CACHE\0"
+    "L1D_TLB_REFILL\0"
+    "INST_RETIRED\0"
+    "EXC_TAKEN\0"
+    "EXC_RETURN\0"
+    "CID_WRITE_RETIRED\0"
+    "BR_MIS_PRED\0"
+    "CPU_CYCLES\0"
+    "BR_PRED\0"
+    "MEM_ACCESS\0"
+    "L1I_CACHE\0"
+    "L1D_CACHE_WB\0"
+    "L2D_CACHE\0"
+    "L2D_CACHE_REFILL\0"
+    "L2D_CACHE_WB\0"
+    "BUS_ACCESS\0"
+    "MEMORY_ERROR\0"
+    "INST_SPEC\0"
+    "TTBR_WRITE_RETIRED\0"
+    "BUS_CYCLES\0"
+    "CHAIN\0"
+    "L1D_CACHE_LD\0"
+    "L1D_CACHE_ST\0"
+    "L1D_CACHE_REFILL_LD\0"
+    "L1D_CACHE_REFILL_ST\0"
+    "L1D_CACHE_WB_VICTIM\0"
+    "L1D_CACHE_WB_CLEAN\0"
+    "L1D_CACHE_INVAL\0"
+    "L1D_TLB_REFILL_LD\0"
+    "L1D_TLB_REFILL_ST\0"
+    "L2D_CACHE_LD\0"
+    "L2D_CACHE_ST\0"
+    "L2D_CACHE_REFILL_LD\0"
+    "L2D_CACHE_REFILL_ST\0"
+    "L2D_CACHE_WB_VICTIM\0"
+    "L2D_CACHE_WB_CLEAN\0"
+    "L2D_CACHE_INVAL\0"
+    "BUS_ACCESS_LD\0"
+    "BUS_ACCESS_ST\0"
+    "BUS_ACCESS_SHARED\0"
+    "BUS_ACCESS_NOT_SHARED\0"
+    "BUS_ACCESS_NORMAL\0"
+    "BUS_ACCESS_PERIPH\0"
+    "MEM_ACCESS_LD\0"
+    "MEM_ACCESS_ST\0"
+    "UNALIGNED_LD_SPEC\0"
+    "UNALIGNED_ST_SPEC\0"
+    "UNALIGNED_LDST_SPEC\0"
+    "LDREX_SPEC\0"
+    "STREX_PASS_SPEC\0"
+    "STREX_FAIL_SPEC\0"
+    "LD_SPEC\0"
+    "ST_SPEC\0"
+    "LDST_SPEC\0"
+    "DP_SPEC\0"
+    "ASE_SPEC\0"
+    "VFP_SPEC\0"
+    "PC_WRITE_SPEC\0"
+    "CRYPTO_SPEC\0"
+    "BR_IMMED_SPEC\0"
+    "BR_RETURN_SPEC\0"
+    "BR_INDIRECT_SPEC\0"
+    "ISB_SPEC\0"
+    "DSB_SPEC\0"
+    "DMB_SPEC\0"
+    "EXC_UNDEF\0"
+    "EXC_SVC\0"
+    "EXC_PABORT\0"
+    "EXC_DABORT\0"
+    "EXC_IRQ\0"
+    "EXC_FIQ\0"
+    "EXC_SMC\0"
+    "EXC_HVC\0"
+    "EXC_TRAP_PABORT\0"
+    "EXC_TRAP_DABORT\0"
+    "EXC_TRAP_OTHER\0"
+    "EXC_TRAP_IRQ\0"
+    "EXC_TRAP_FIQ\0"
+    "RC_LD_SPEC\0"
+    "RC_ST_SPEC\0";
+
+static const PerfmonEventOption a57_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry a57_arch_event_entries[NUM_ARCH_EVENTS_A57] = {
+ {0, 8, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12, 8, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 8, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44, 8, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 8, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 8, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 8, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {99, 8, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {109, 8, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 8, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 8, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {150, 8, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {161, 8, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {169, 8, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {180, 8, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {190, 8, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {203, 8, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {213, 8, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {230, 8, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {243, 8, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {254, 8, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {267, 8, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {277, 8, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {296, 8, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {307, 8, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {313, 8, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {326, 8, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {339, 8, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {359, 8, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {379, 8, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {399, 8, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 8, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {434, 8, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {452, 8, 0, 0, 0x4D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {470, 8, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {483, 8, 0, 0, 0x51,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {496, 8, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {516, 8, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {536, 8, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {556, 8, 0, 0, 0x57,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {575, 8, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {591, 8, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {605, 8, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {619, 8, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {637, 8, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {659, 8, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {677, 8, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {695, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {709, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {723, 8, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {741, 8, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {759, 8, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {779, 8, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {790, 8, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {806, 8, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {822, 8, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {830, 8, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {838, 8, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {848, 8, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {856, 8, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {865, 8, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {874, 8, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {888, 8, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {900, 8, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {914, 8, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {929, 8, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {946, 8, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {955, 8, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {964, 8, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {973, 8, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {983, 8, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {991, 8, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1002, 8, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1013, 8, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1021, 8, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1029, 8, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1037, 8, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1045, 8, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1061, 8, 0, 0, 0x8C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1077, 8, 0, 0, 0x8D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1092, 8, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1105, 8, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1118, 8, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1129, 8, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable a57_arch_events = {
+    NUM_ARCH_EVENTS_A57,
+    a57_arch_event_strings,
+    a57_arch_event_options,
+    a57_arch_event_entries
+};
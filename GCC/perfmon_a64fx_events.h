@@ -0,0 +1,402 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_A64FX 191
+
+static const char a64fx_arch_event_strings[] =
+    "SW_INCR\0"
+    "PMC\0"
+    "L1I_CACHE_REFILL\0"
+    "L1I_TLB_REFILL\0"
+    "L1D_CACHE_REFILL\0"
+    "L1D_CACHE\0"
+    "L1D_TLB_REFILL\0"
+    "LD_RETIRED\0"
+    "ST_RETIRED\0"
+    "INST_RETIRED\0"
+    "EXC_TAKEN\0"
+    "EXC_RETURN\0"
+    "CID_WRITE_RETIRED\0"
+    "UNALIGNED_LDST_RETIRED\0"
+    "BR_MIS_PRED\0"
+    "CPU_CYCLES\0"
+    "BR_PRED\0"
+    "MEM_ACCESS\0"
+    "L1I_CACHE\0"
+    "L1D_CACHE_WB\0"
+    "L2D_CACHE\0"
+    "L2D_CACHE_REFILL\0"
+    "L2D_CACHE_WB\0"
+    "INST_SPEC\0"
+    "STALL_FRONTEND\0"
+    "STALL_BACKEND\0"
+    "L2D_TLB_REFILL\0"
+    "L2I_TLB_REFILL\0"
+    "L2D_TLB\0"
+    "L2I_TLB\0"
+    "L1D_CACHE_REFILL_PRF\0"
+    "L2D_CACHE_REFILL_PRF\0"
+    "MEM_ACCESS_RD\0"
+    "MEM_ACCESS_WR\0"
+    "UNALIGNED_LD_SPEC\0"
+    "UNALIGNED_ST_SPEC\0"
+    "UNALIGNED_LDST_SPEC\0"
+    "LDREX_SPEC\0"
+    "STREX_SPEC\0"
+    "LD_SPEC\0"
+    "ST_SPEC\0"
+    "LDST_SPEC\0"
+    "DP_SPEC\0"
+    "ASE_SPEC\0"
+    "VFP_SPEC\0"
+    "PC_WRITE_SPEC\0"
+    "CRYPTO_SPEC\0"
+    "BR_IMMED_SPEC\0"
+    "BR_RETURN_SPEC\0"
+    "BR_INDIRECT_SPEC\0"
+    "ISB_SPEC\0"
+    "DSB_SPEC\0"
+    "DMB_SPEC\0"
+    "EXC_UNDEF\0"
+    "EXC_SVC\0"
+    "EXC_PABORT\0"
+    "EXC_DABORT\0"
+    "EXC_IRQ\0"
+    "EXC_FIQ\0"
+    "EXC_SMC\0"
+    "EXC_HVC\0"
+    "DCZVA_SPEC\0"
+    "FP_MV_SPEC\0"
+    "PRD_SPEC\0"
+    "IEL_SPEC\0"
+    "IREG_SPEC\0"
+    "FP_LD_SPEC\0"
+    "FP_ST_SPEC\0"
+    "BC_LD_SPEC\0"
+    "EFFECTIVE_INST_SPEC\0"
+    "PRE_INDEX_SPEC\0"
+    "POST_INDEX_SPEC\0"
+    "UOP_SPLIT\0"
+    "LD_COMP_WAIT_L2_MISS\0"
+    "LD_COMP_WAIT_L2_MISS_EX\0"
+    "LD_COMP_WAIT_L1_MISS\0"
+    "LD_COMP_WAIT_L1_MISS_EX\0"
+    "LD_COMP_WAIT\0"
+    "LD_COMP_WAIT_EX\0"
+    "LD_COMP_WAIT_PFP\0"
+    "LD_COMP_WAIT_PFP_EX\0"
+    "LD_COMP_WAIT_PFP_SWPF\0"
+    "EU_COMP_WAIT\0"
+    "FL_COMP_WAIT\0"
+    "BR_COMP_WAIT\0"
+    "0INST_COMMIT\0"
+    "1INST_COMMIT\0"
+    "2INST_COMMIT\0"
+    "3INST_COMMIT\0"
+    "4INST_COMMIT\0"
+    "UOP_ONLY_COMMIT\0"
+    "SINGLE_MOVPRFX_COMMIT\0"
+    "EAGA_VAL\0"
+    "EAGB_VAL\0"
+    "EXA_VAL\0"
+    "EXB_VAL\0"
+    "FLA_VAL\0"
+    "FLB_VAL\0"
+    "PRX_VAL\0"
+    "FLA_VAL_PRD_CNT\0"
+    "FLB_VAL_PRD_CNT\0"
+    "EA_CORE\0"
+    "L1D_CACHE_REFILL_DM\0"
+    "L1D_CACHE_REFILL_HWPRF\0"
+    "L1_MISS_WAIT\0"
+    "L1D_MISS_WAIT\0"
+    "L1I_MISS_WAIT\0"
+    "L1HWPF_STREAM_PF\0"
+    "L1HWPF_INJ_ALLOC_PF\0"
+    "L1HWPF_INJ_NOALLOC_PF\0"
+    "L2HWPF_STREAM_PF\0"
+    "L2HWPF_INJ_ALLOC_PF\0"
+    "L2HWPF_INJ_NOALLOC_PF\0"
+    "L2HWPF_OTHER\0"
+    "L1_PIPE0_VAL\0"
+    "L1_PIPE1_VAL\0"
+    "L1_PIPE0_VAL_IU_TAG_ADRS_SCE\0"
+    "L1_PIPE0_VAL_IU_TAG_ADRS_PFE\0"
+    "L1_PIPE1_VAL_IU_TAG_ADRS_SCE\0"
+    "L1_PIPE1_VAL_IU_TAG_ADRS_PFE\0"
+    "L1_PIPE0_COMP\0"
+    "L1_PIPE1_COMP\0"
+    "L1I_PIPE_COMP\0"
+    "L1I_PIPE_VAL\0"
+    "L1_PIPE_ABORT_STLD_INTLK\0"
+    "L1_PIPE0_VAL_IU_NOT_SEC0\0"
+    "L1_PIPE1_VAL_IU_NOT_SEC0\0"
+    "L1_PIPE_COMP_GATHER_2FLOW\0"
+    "L1_PIPE_COMP_GATHER_1FLOW\0"
+    "L1_PIPE_COMP_GATHER_0FLOW\0"
+    "L1_PIPE_COMP_SCATTER_1FLOW\0"
+    "L1_PIPE0_COMP_PRD_CNT\0"
+    "L1_PIPE1_COMP_PRD_CNT\0"
+    "L2D_CACHE_REFILL_DM\0"
+    "L2D_CACHE_REFILL_HWPRF\0"
+    "L2_MISS_WAIT\0"
+    "L2_MISS_COUNT\0"
+    "BUS_READ_TOTAL_TOFU\0"
+    "BUS_READ_TOTAL_PCI\0"
+    "BUS_READ_TOTAL_MEM\0"
+    "BUS_WRITE_TOTAL_CMG0\0"
+    "BUS_WRITE_TOTAL_CMG1\0"
+    "BUS_WRITE_TOTAL_CMG2\0"
+    "BUS_WRITE_TOTAL_CMG3\0"
+    "BUS_WRITE_TOTAL_TOFU\0"
+    "BUS_WRITE_TOTAL_PCI\0"
+    "BUS_WRITE_TOTAL_MEM\0"
+    "L2D_SWAP_DM\0"
+    "L2D_CACHE_MIBMCH_PRF\0"
+    "L2_PIPE_VAL\0"
+    "L2_PIPE_COMP_ALL\0"
+    "L2_PIPE_COMP_PF_L2MIB_MCH\0"
+    "L2D_CACHE_SWAP_LOCAL\0"
+    "EA_L2\0"
+    "EA_MEMORY\0"
+    "SIMD_INST_RETIRED\0"
+    "SVE_INST_RETIRED\0"
+    "SVE_INST_SPEC\0"
+    "UOP_SPEC\0"
+    "SVE_MATH_SPEC\0"
+    "FP_SPEC\0"
+    "FP_FMA_SPEC\0"
+    "FP_RECPE_SPEC\0"
+    "FP_CVT_SPEC\0"
+    "ASE_SVE_INT_SPEC\0"
+    "SVE_PRED_SPEC\0"
+    "SVE_MOVPRFX_SPEC\0"
+    "SVE_MOVPRFX_U_SPEC\0"
+    "ASE_SVE_LD_SPEC\0"
+    "ASE_SVE_ST_SPEC\0"
+    "PRF_SPEC\0"
+    "BASE_LD_REG_SPEC\0"
+    "BASE_ST_REG_SPEC\0"
+    "SVE_LDR_REG_SPEC\0"
+    "SVE_STR_REG_SPEC\0"
+    "SVE_LDR_PREG_SPEC\0"
+    "SVE_STR_PREG_SPEC\0"
+    "SVE_PRF_CONTIG_SPEC\0"
+    "ASE_SVE_LD_MULTI_SPEC\0"
+    "ASE_SVE_ST_MULTI_SPEC\0"
+    "SVE_LD_GATHER_SPEC\0"
+    "SVE_ST_SCATTER_SPEC\0"
+    "SVE_PRF_GATHER_SPEC\0"
+    "SVE_LDFF_SPEC\0"
+    "FP_SCALE_OPS_SPEC\0"
+    "FP_FIXED_OPS_SPEC\0"
+    "FP_HP_SCALE_OPS_SPEC\0"
+    "FP_HP_FIXED_OPS_SPEC\0"
+    "FP_SP_SCALE_OPS_SPEC\0"
+    "FP_SP_FIXED_OPS_SPEC\0"
+    "FP_DP_SCALE_OPS_SPEC\0"
+    "FP_DP_FIXED_OPS_SPEC\0";
+
+static const PerfmonEventOption a64fx_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry a64fx_arch_event_entries[NUM_ARCH_EVENTS_A64FX] = {
+ {0, 8, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12, 8, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 8, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44, 8, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 8, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 8, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 8, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {97, 8, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {108, 8, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 8, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {131, 8, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {142, 8, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {160, 8, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {183, 8, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {195, 8, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {206, 8, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {214, 8, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {225, 8, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {235, 8, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {248, 8, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {258, 8, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {275, 8, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {288, 8, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {298, 8, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {313, 8, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {327, 8, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {342, 8, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {357, 8, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {365, 8, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {373, 8, 0, 0, 0x49,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {394, 8, 0, 0, 0x59,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {415, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {429, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {443, 8, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {461, 8, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {479, 8, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {499, 8, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {510, 8, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {521, 8, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {529, 8, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {537, 8, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {547, 8, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {555, 8, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {564, 8, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {573, 8, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {587, 8, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {599, 8, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {613, 8, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {628, 8, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {645, 8, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {654, 8, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {663, 8, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {672, 8, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {682, 8, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {690, 8, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {701, 8, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {712, 8, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {720, 8, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {728, 8, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {736, 8, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {744, 8, 0, 0, 0x9F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {755, 8, 0, 0, 0x105,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {766, 8, 0, 0, 0x108,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {775, 8, 0, 0, 0x109,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {784, 8, 0, 0, 0x10A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {794, 8, 0, 0, 0x112,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {805, 8, 0, 0, 0x113,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {816, 8, 0, 0, 0x11A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {827, 8, 0, 0, 0x121,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {847, 8, 0, 0, 0x123,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {862, 8, 0, 0, 0x124,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {878, 8, 0, 0, 0x139,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {888, 8, 0, 0, 0x180,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {909, 8, 0, 0, 0x181,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {933, 8, 0, 0, 0x182,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {954, 8, 0, 0, 0x183,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {978, 8, 0, 0, 0x184,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {991, 8, 0, 0, 0x185,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1007, 8, 0, 0, 0x186,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1024, 8, 0, 0, 0x187,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1044, 8, 0, 0, 0x188,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1066, 8, 0, 0, 0x189,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1079, 8, 0, 0, 0x18A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1092, 8, 0, 0, 0x18B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1105, 8, 0, 0, 0x190,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1118, 8, 0, 0, 0x191,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1131, 8, 0, 0, 0x192,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1144, 8, 0, 0, 0x193,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1157, 8, 0, 0, 0x194,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1170, 8, 0, 0, 0x198,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1186, 8, 0, 0, 0x199,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1208, 8, 0, 0, 0x1A0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1217, 8, 0, 0, 0x1A1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1226, 8, 0, 0, 0x1A2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1234, 8, 0, 0, 0x1A3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1242, 8, 0, 0, 0x1A4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1250, 8, 0, 0, 0x1A5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1258, 8, 0, 0, 0x1A6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1266, 8, 0, 0, 0x1B4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1282, 8, 0, 0, 0x1B5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1298, 8, 0, 0, 0x1E0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1306, 8, 0, 0, 0x200,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1326, 8, 0, 0, 0x202,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1349, 8, 0, 0, 0x208,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1362, 8, 0, 0, 0x208,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1376, 8, 0, 0, 0x209,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1390, 8, 0, 0, 0x230,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1407, 8, 0, 0, 0x231,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1427, 8, 0, 0, 0x232,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1449, 8, 0, 0, 0x233,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1466, 8, 0, 0, 0x234,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1486, 8, 0, 0, 0x235,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1508, 8, 0, 0, 0x236,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1521, 8, 0, 0, 0x240,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1534, 8, 0, 0, 0x241,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1547, 8, 0, 0, 0x250,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1576, 8, 0, 0, 0x251,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1605, 8, 0, 0, 0x252,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1634, 8, 0, 0, 0x253,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1663, 8, 0, 0, 0x260,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1677, 8, 0, 0, 0x261,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1691, 8, 0, 0, 0x268,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1705, 8, 0, 0, 0x269,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1718, 8, 0, 0, 0x274,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1743, 8, 0, 0, 0x2A0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1768, 8, 0, 0, 0x2A1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1793, 8, 0, 0, 0x2B0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1819, 8, 0, 0, 0x2B1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1845, 8, 0, 0, 0x2B2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1871, 8, 0, 0, 0x2B3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1898, 8, 0, 0, 0x2B8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1920, 8, 0, 0, 0x2B9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1942, 8, 0, 0, 0x300,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1962, 8, 0, 0, 0x302,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1985, 8, 0, 0, 0x308,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1998, 8, 0, 0, 0x309,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2012, 8, 0, 0, 0x314,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2032, 8, 0, 0, 0x315,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2051, 8, 0, 0, 0x316,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2070, 8, 0, 0, 0x318,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2091, 8, 0, 0, 0x319,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2112, 8, 0, 0, 0x31A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2133, 8, 0, 0, 0x31B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2154, 8, 0, 0, 0x31C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2175, 8, 0, 0, 0x31D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2195, 8, 0, 0, 0x31E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2215, 8, 0, 0, 0x325,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2227, 8, 0, 0, 0x326,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2248, 8, 0, 0, 0x330,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2260, 8, 0, 0, 0x350,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2277, 8, 0, 0, 0x370,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2303, 8, 0, 0, 0x396,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2324, 8, 0, 0, 0x3E0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2330, 8, 0, 0, 0x3E8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2340, 8, 0, 0, 0x8000,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2358, 8, 0, 0, 0x8002,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2375, 8, 0, 0, 0x8006,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2389, 8, 0, 0, 0x8008,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2398, 8, 0, 0, 0x800E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2412, 8, 0, 0, 0x8010,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2420, 8, 0, 0, 0x8028,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2432, 8, 0, 0, 0x8034,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2446, 8, 0, 0, 0x8038,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2458, 8, 0, 0, 0x8043,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2475, 8, 0, 0, 0x8074,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2489, 8, 0, 0, 0x807C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2506, 8, 0, 0, 0x807F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2525, 8, 0, 0, 0x8085,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2541, 8, 0, 0, 0x8086,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2557, 8, 0, 0, 0x8087,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2566, 8, 0, 0, 0x8089,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2583, 8, 0, 0, 0x808A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2600, 8, 0, 0, 0x8091,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2617, 8, 0, 0, 0x8092,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2634, 8, 0, 0, 0x8095,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2652, 8, 0, 0, 0x8096,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2670, 8, 0, 0, 0x809F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2690, 8, 0, 0, 0x80A5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2712, 8, 0, 0, 0x80A6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2734, 8, 0, 0, 0x80AD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2753, 8, 0, 0, 0x80AE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2773, 8, 0, 0, 0x80AF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2793, 8, 0, 0, 0x80BC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2807, 8, 0, 0, 0x80C0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2825, 8, 0, 0, 0x80C1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2843, 8, 0, 0, 0x80C2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2864, 8, 0, 0, 0x80C3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2885, 8, 0, 0, 0x80C4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2906, 8, 0, 0, 0x80C5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2927, 8, 0, 0, 0x80C6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2948, 8, 0, 0, 0x80C7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable a64fx_arch_events = {
+    NUM_ARCH_EVENTS_A64FX,
+    a64fx_arch_event_strings,
+    a64fx_arch_event_options,
+    a64fx_arch_event_entries
+};
@@ -0,0 +1,652 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ATOM 314
+
+static const char atom_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "BACLEARS_ANY\0"
+    "PMC\0"
+    "BOGUS_BR\0"
+    "BR_INST_RETIRED_ANY\0"
+    "BR_INST_RETIRED_PRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_PRED_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED_TAKEN\0"
+    "BR_INST_RETIRED_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED\0"
+    "BR_INST_DECODED\0"
+    "BUS_BNR_DRV_THIS_A\0"
+    "BUS_BNR_DRV_ALL_A\0"
+    "BUS_DATA_RCV_ALL_CORES\0"
+    "BUS_DATA_RCV_THIS_CORE\0"
+    "BUS_DRDY_CLOCKS_THIS_A\0"
+    "BUS_DRDY_CLOCKS_ALL_A\0"
+    "BUS_HIT_DRV_THIS_A\0"
+    "BUS_HIT_DRV_ALL_A\0"
+    "BUS_HITM_DRV_THIS_A\0"
+    "BUS_HITM_DRV_ALL_A\0"
+    "BUS_IO_WAIT_ALL_CORES\0"
+    "BUS_IO_WAIT_THIS_CORE\0"
+    "BUS_LOCK_CLOCKS_ALL_CORES_THIS_A\0"
+    "BUS_LOCK_CLOCKS_ALL_CORES_ALL_A\0"
+    "BUS_LOCK_CLOCKS_THIS_CORE_THIS_A\0"
+    "BUS_LOCK_CLOCKS_THIS_CORE_ALL_A\0"
+    "BUSQ_EMPTY_ALL_CORES\0"
+    "BUSQ_EMPTY_THIS_CORE\0"
+    "BUS_REQUEST_OUTSTANDING_ALL_CORES_THIS_A\0"
+    "BUS_REQUEST_OUTSTANDING_ALL_CORES_ALL_A\0"
+    "BUS_REQUEST_OUTSTANDING_THIS_CORE_THIS_A\0"
+    "BUS_REQUEST_OUTSTANDING_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_ANY_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_ANY_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_ANY_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_ANY_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_BRD_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_BRD_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_BRD_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_BRD_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_BURST_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_BURST_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_BURST_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_BURST_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_DEF_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_DEF_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_DEF_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_DEF_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_IFETCH_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_IFETCH_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_IFETCH_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_IFETCH_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_INVAL_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_INVAL_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_INVAL_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_INVAL_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_IO_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_IO_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_IO_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_IO_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_MEM_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_MEM_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_MEM_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_MEM_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_P_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_P_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_P_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_P_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_PWR_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_PWR_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_PWR_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_PWR_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_RFO_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_RFO_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_RFO_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_RFO_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_WB_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_WB_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_WB_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_WB_THIS_CORE_ALL_A\0"
+    "CPU_CLK_UNHALTED_CORE_P\0"
+    "CPU_CLK_UNHALTED_BUS\0"
+    "CPU_CLK_UNHALTED_NO_OTHER\0"
+    "CYCLES_DIV_BUSY\0"
+    "PMC0\0"
+    "CYCLES_INT_MASKED_CYCLES_INT_MASKED\0"
+    "CYCLES_INT_MASKED_CYCLES_INT_PENDING_AND_MASKED\0"
+    "DATA_TLB_MISSES_DTLB_MISS\0"
+    "DIV_AR\0"
+    "DIV_S\0"
+    "EIST_TRANS\0"
+    "EXT_SNOOP_ALL_CORES_MODIFIED\0"
+    "EXT_SNOOP_ALL_CORES_EXCLUSIVE\0"
+    "EXT_SNOOP_ALL_CORES_SHARED\0"
+    "EXT_SNOOP_ALL_CORES_INVALID\0"
+    "EXT_SNOOP_ALL_CORES_MESI\0"
+    "EXT_SNOOP_THIS_CORE_MODIFIED\0"
+    "EXT_SNOOP_THIS_CORE_EXCLUSIVE\0"
+    "EXT_SNOOP_THIS_CORE_SHARED\0"
+    "EXT_SNOOP_THIS_CORE_INVALID\0"
+    "EXT_SNOOP_THIS_CORE_MESI\0"
+    "FP_ASSIST\0"
+    "FP_ASSIST_AR\0"
+    "HW_INT_RCV\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_MISSES\0"
+    "INST_RETIRED_ANY_P\0"
+    "ITLB_MISSES\0"
+    "ITLB_FLUSH\0"
+    "L1D_CACHE_LD\0"
+    "L1D_CACHE_ST\0"
+    "L2_ADS_ALL_CORES\0"
+    "L2_ADS_THIS_CORE\0"
+    "L2_DBUS_BUSY_CORES_ALL\0"
+    "L2_DBUS_BUSY_THIS_CORE\0"
+    "L2_IFETCH_ALL_CORES_MODIFIED\0"
+    "L2_IFETCH_ALL_CORES_EXCLUSIVE\0"
+    "L2_IFETCH_ALL_CORES_SHARED\0"
+    "L2_IFETCH_ALL_CORES_INVALID\0"
+    "L2_IFETCH_ALL_CORES_MESI\0"
+    "L2_IFETCH_THIS_CORE_MODIFIED\0"
+    "L2_IFETCH_THIS_CORE_EXCLUSIVE\0"
+    "L2_IFETCH_THIS_CORE_SHARED\0"
+    "L2_IFETCH_THIS_CORE_INVALID\0"
+    "L2_IFETCH_THIS_CORE_MESI\0"
+    "L2_LD_ALL_CORES_ALL_MODIFIED\0"
+    "L2_LD_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_ALL_SHARED\0"
+    "L2_LD_ALL_CORES_ALL_INVALID\0"
+    "L2_LD_ALL_CORES_ALL_MESI\0"
+    "L2_LD_THIS_CORE_ALL_MODIFIED\0"
+    "L2_LD_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_ALL_SHARED\0"
+    "L2_LD_THIS_CORE_ALL_INVALID\0"
+    "L2_LD_THIS_CORE_ALL_MESI\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_INVALID\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_MESI\0"
+    "L2_LINES_IN_ALL_CORES_ALL\0"
+    "L2_LINES_IN_THIS_CORE_ALL\0"
+    "L2_LINES_IN_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_LINES_IN_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_LINES_IN_ALL_CORES_NO_PREFETCH\0"
+    "L2_LINES_IN_THIS_CORE_NO_PREFETCH\0"
+    "L2_LINES_OUT_ALL_CORES_ALL\0"
+    "L2_LINES_OUT_THIS_CORE_ALL\0"
+    "L2_LINES_OUT_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_LINES_OUT_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_LINES_OUT_ALL_CORES_NO_PREFETCH\0"
+    "L2_LINES_OUT_THIS_CORE_NO_PREFETCH\0"
+    "L2_LOCK_ALL_CORES_MODIFIED\0"
+    "L2_LOCK_ALL_CORES_EXCLUSIVE\0"
+    "L2_LOCK_ALL_CORES_SHARED\0"
+    "L2_LOCK_ALL_CORES_INVALID\0"
+    "L2_LOCK_ALL_CORES_MESI\0"
+    "L2_LOCK_THIS_CORE_MODIFIED\0"
+    "L2_LOCK_THIS_CORE_EXCLUSIVE\0"
+    "L2_LOCK_THIS_CORE_SHARED\0"
+    "L2_LOCK_THIS_CORE_INVALID\0"
+    "L2_LOCK_THIS_CORE_MESI\0"
+    "L2_M_LINES_IN_ALL_CORES\0"
+    "L2_M_LINES_IN_THIS_CORE\0"
+    "L2_M_LINES_OUT_ALL_CORES_ALL\0"
+    "L2_M_LINES_OUT_THIS_CORE_ALL\0"
+    "L2_M_LINES_OUT_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_M_LINES_OUT_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_M_LINES_OUT_ALL_CORES_NO_PREFETCH\0"
+    "L2_M_LINES_OUT_THIS_CORE_NO_PREFETCH\0"
+    "L2_NO_REQ_ALL_CORES\0"
+    "L2_NO_REQ_THIS_CORE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_MESI\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_MESI\0"
+    "L2_RQSTS_ALL_CORES_ALL_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_ALL_SHARED\0"
+    "L2_RQSTS_ALL_CORES_ALL_INVALID\0"
+    "L2_RQSTS_ALL_CORES_ALL_MESI\0"
+    "L2_RQSTS_THIS_CORE_ALL_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_ALL_SHARED\0"
+    "L2_RQSTS_THIS_CORE_ALL_INVALID\0"
+    "L2_RQSTS_THIS_CORE_ALL_MESI\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_RQSTS_SELF_I_STATE\0"
+    "L2_RQSTS_SELF_MESI\0"
+    "L2_ST_ALL_CORES_MODIFIED\0"
+    "L2_ST_ALL_CORES_EXCLUSIVE\0"
+    "L2_ST_ALL_CORES_SHARED\0"
+    "L2_ST_ALL_CORES_INVALID\0"
+    "L2_ST_ALL_CORES_MESI\0"
+    "L2_ST_THIS_CORE_MODIFIED\0"
+    "L2_ST_THIS_CORE_EXCLUSIVE\0"
+    "L2_ST_THIS_CORE_SHARED\0"
+    "L2_ST_THIS_CORE_INVALID\0"
+    "L2_ST_THIS_CORE_MESI\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACRO_INSTS_DECODED\0"
+    "MACRO_INSTS_CISC_DECODED\0"
+    "MEM_LOAD_RETIRED_L1D_MISS\0"
+    "MEM_LOAD_RETIRED_L1D_LINE_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L2_LINE_MISS\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "MUL\0"
+    "PMC1\0"
+    "MUL_S\0"
+    "MUL_AR\0"
+    "PAGE_WALKS_WALKS\0"
+    "PAGE_WALKS_CYCLES\0"
+    "PREFETCH_PREFETCHNTA\0"
+    "PREFETCH_PREFETCHT0\0"
+    "PREFETCH_SW_L2\0"
+    "SEGMENT_REG_LOADS_ANY\0"
+    "SIMD_ASSIST\0"
+    "SIMD_INSTR_RETIRED\0"
+    "SIMD_COMP_INST_RETIRED_PACKED_SINGLE\0"
+    "SIMD_COMP_INST_RETIRED_SCALAR_SINGLE\0"
+    "SIMD_COMP_INST_RETIRED_PACKED_DOUBLE\0"
+    "SIMD_COMP_INST_RETIRED_SCALAR_DOUBLE\0"
+    "SIMD_COMP_INST_RETIRED_ANY\0"
+    "SIMD_INST_RETIRED_PACKED_SINGLE\0"
+    "SIMD_INST_RETIRED_SCALAR_SINGLE\0"
+    "SIMD_INST_RETIRED_PACKED_DOUBLE\0"
+    "SIMD_INST_RETIRED_SCALAR_DOUBLE\0"
+    "SIMD_INST_RETIRED_VECTOR\0"
+    "SIMD_INST_RETIRED_ANY\0"
+    "SIMD_SAT_INSTR_RETIRED\0"
+    "SIMD_SAT_UOPS_EXEC_S\0"
+    "SIMD_SAT_UOP_EXEC_AR\0"
+    "SIMD_UOPS_EXEC_S\0"
+    "SIMD_UOPS_EXEC_AR\0"
+    "SIMD_UOP_TYPE_EXEC_ARITHMETIC_AR\0"
+    "SIMD_UOP_TYPE_EXEC_ARITHMETIC_S\0"
+    "SIMD_UOP_TYPE_EXEC_LOGICAL_AR\0"
+    "SIMD_UOP_TYPE_EXEC_LOGICAL_S\0"
+    "SIMD_UOP_TYPE_EXEC_MUL_AR\0"
+    "SIMD_UOP_TYPE_EXEC_MUL_S\0"
+    "SIMD_UOP_TYPE_EXEC_PACK_AR\0"
+    "SIMD_UOP_TYPE_EXEC_PACK_S\0"
+    "SIMD_UOP_TYPE_EXEC_SHIFT_AR\0"
+    "SIMD_UOP_TYPE_EXEC_SHIFT_SSIMD\0"
+    "SIMD_UOP_TYPE_EXEC_UNPACK_AR\0"
+    "SIMD_UOP_TYPE_EXEC_UNPACK_S\0"
+    "SNOOP_STALL_DRV_ALL_CORES_THIS_A\0"
+    "SNOOP_STALL_DRV_ALL_CORES_ALL_A\0"
+    "SNOOP_STALL_DRV_THIS_CORE_THIS_A\0"
+    "SNOOP_STALL_DRV_THIS_CORE_ALL_A\0"
+    "STORE_FORWARDS_GOOD\0"
+    "THERMAL_TRIP\0"
+    "UOPS_RETIRED_ANY\0"
+    "X87_COMP_OPS_EXE_ANY_S\0"
+    "X87_COMP_OPS_EXE_ANY_AR\0";
+
+static const PerfmonEventOption atom_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry atom_arch_event_entries[NUM_ARCH_EVENTS_ATOM] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 65, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {69, 65, 0, 0, 0xE4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78, 65, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {98, 65, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {129, 65, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 65, 0, 0, 0xC4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {190, 65, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {220, 65, 0, 0, 0xC4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {242, 65, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {266, 65, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {282, 65, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {301, 65, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {319, 65, 0, 0, 0x64,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {342, 65, 0, 0, 0x64,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {365, 65, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {388, 65, 0, 0, 0x62,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {410, 65, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {429, 65, 0, 0, 0x7A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {447, 65, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {467, 65, 0, 0, 0x7B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {486, 65, 0, 0, 0x7F,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {508, 65, 0, 0, 0x7F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {530, 65, 0, 0, 0x63,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {563, 65, 0, 0, 0x63,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {595, 65, 0, 0, 0x63,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {628, 65, 0, 0, 0x63,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {660, 65, 0, 0, 0x7D,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {681, 65, 0, 0, 0x7D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {702, 65, 0, 0, 0x60,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {743, 65, 0, 0, 0x60,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {783, 65, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {824, 65, 0, 0, 0x60,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {864, 65, 0, 0, 0x70,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {895, 65, 0, 0, 0x70,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {925, 65, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {956, 65, 0, 0, 0x70,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {986, 65, 0, 0, 0x65,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1017, 65, 0, 0, 0x65,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1047, 65, 0, 0, 0x65,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1078, 65, 0, 0, 0x65,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1108, 65, 0, 0, 0x6E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1141, 65, 0, 0, 0x6E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1173, 65, 0, 0, 0x6E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1206, 65, 0, 0, 0x6E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1238, 65, 0, 0, 0x6D,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1269, 65, 0, 0, 0x6D,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1299, 65, 0, 0, 0x6D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1330, 65, 0, 0, 0x6D,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1360, 65, 0, 0, 0x68,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1394, 65, 0, 0, 0x68,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1427, 65, 0, 0, 0x68,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1461, 65, 0, 0, 0x68,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1494, 65, 0, 0, 0x69,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1527, 65, 0, 0, 0x69,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1559, 65, 0, 0, 0x69,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1592, 65, 0, 0, 0x69,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1624, 65, 0, 0, 0x6C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1654, 65, 0, 0, 0x6C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1683, 65, 0, 0, 0x6C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1713, 65, 0, 0, 0x6C,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1742, 65, 0, 0, 0x6F,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1773, 65, 0, 0, 0x6F,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 65, 0, 0, 0x6F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1834, 65, 0, 0, 0x6F,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1864, 65, 0, 0, 0x6B,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1893, 65, 0, 0, 0x6B,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {1921, 65, 0, 0, 0x6B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1950, 65, 0, 0, 0x6B,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1978, 65, 0, 0, 0x6A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {2009, 65, 0, 0, 0x6A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 65, 0, 0, 0x6A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2070, 65, 0, 0, 0x6A,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2100, 65, 0, 0, 0x66,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {2131, 65, 0, 0, 0x66,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2161, 65, 0, 0, 0x66,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2192, 65, 0, 0, 0x66,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2222, 65, 0, 0, 0x67,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {2252, 65, 0, 0, 0x67,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2281, 65, 0, 0, 0x67,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2311, 65, 0, 0, 0x67,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2340, 65, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2364, 65, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2385, 65, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2411, 2427, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2432, 65, 0, 0, 0xC6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2468, 65, 0, 0, 0xC6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2516, 65, 0, 0, 0x08,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {2542, 65, 0, 0, 0x13,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {2549, 65, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2555, 65, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2566, 65, 0, 0, 0x77,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {2595, 65, 0, 0, 0x77,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {2625, 65, 0, 0, 0x77,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {2652, 65, 0, 0, 0x77,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {2680, 65, 0, 0, 0x77,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {2705, 65, 0, 0, 0x77,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2734, 65, 0, 0, 0x77,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {2764, 65, 0, 0, 0x77,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {2791, 65, 0, 0, 0x77,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2819, 65, 0, 0, 0x77,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2844, 65, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2854, 65, 0, 0, 0x11,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {2867, 65, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2878, 65, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2894, 65, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2908, 65, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2927, 65, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2939, 65, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2950, 65, 0, 0, 0x40,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {2963, 65, 0, 0, 0x40,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {2976, 65, 0, 0, 0x21,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {2993, 65, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3010, 65, 0, 0, 0x22,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {3033, 65, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3056, 65, 0, 0, 0x28,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {3085, 65, 0, 0, 0x28,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {3115, 65, 0, 0, 0x28,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {3142, 65, 0, 0, 0x28,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {3170, 65, 0, 0, 0x28,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {3195, 65, 0, 0, 0x28,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {3224, 65, 0, 0, 0x28,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {3254, 65, 0, 0, 0x28,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3281, 65, 0, 0, 0x28,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3309, 65, 0, 0, 0x28,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {3334, 65, 0, 0, 0x29,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {3363, 65, 0, 0, 0x29,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {3393, 65, 0, 0, 0x29,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {3420, 65, 0, 0, 0x29,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {3448, 65, 0, 0, 0x29,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {3473, 65, 0, 0, 0x29,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {3502, 65, 0, 0, 0x29,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {3532, 65, 0, 0, 0x29,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {3559, 65, 0, 0, 0x29,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {3587, 65, 0, 0, 0x29,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3612, 65, 0, 0, 0x29,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {3651, 65, 0, 0, 0x29,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {3691, 65, 0, 0, 0x29,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {3728, 65, 0, 0, 0x29,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {3766, 65, 0, 0, 0x29,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {3801, 65, 0, 0, 0x29,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {3840, 65, 0, 0, 0x29,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {3880, 65, 0, 0, 0x29,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {3917, 65, 0, 0, 0x29,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {3955, 65, 0, 0, 0x29,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {3990, 65, 0, 0, 0x29,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4027, 65, 0, 0, 0x29,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4065, 65, 0, 0, 0x29,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4100, 65, 0, 0, 0x29,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4136, 65, 0, 0, 0x29,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {4169, 65, 0, 0, 0x29,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4206, 65, 0, 0, 0x29,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4244, 65, 0, 0, 0x29,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4279, 65, 0, 0, 0x29,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4315, 65, 0, 0, 0x29,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {4348, 65, 0, 0, 0x24,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {4374, 65, 0, 0, 0x24,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {4400, 65, 0, 0, 0x24,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4436, 65, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4472, 65, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4506, 65, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4540, 65, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {4567, 65, 0, 0, 0x26,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {4594, 65, 0, 0, 0x26,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4631, 65, 0, 0, 0x26,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4668, 65, 0, 0, 0x26,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4703, 65, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4738, 65, 0, 0, 0x2B,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4765, 65, 0, 0, 0x2B,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4793, 65, 0, 0, 0x2B,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4818, 65, 0, 0, 0x2B,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4844, 65, 0, 0, 0x2B,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {4867, 65, 0, 0, 0x2B,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4894, 65, 0, 0, 0x2B,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4922, 65, 0, 0, 0x2B,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4947, 65, 0, 0, 0x2B,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4973, 65, 0, 0, 0x2B,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {4996, 65, 0, 0, 0x25,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5020, 65, 0, 0, 0x25,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5044, 65, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {5073, 65, 0, 0, 0x27,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {5102, 65, 0, 0, 0x27,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5141, 65, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {5180, 65, 0, 0, 0x27,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5217, 65, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5254, 65, 0, 0, 0x32,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5274, 65, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5294, 65, 0, 0, 0x30,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {5332, 65, 0, 0, 0x30,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {5371, 65, 0, 0, 0x30,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {5407, 65, 0, 0, 0x30,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {5444, 65, 0, 0, 0x30,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5478, 65, 0, 0, 0x30,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {5516, 65, 0, 0, 0x30,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {5555, 65, 0, 0, 0x30,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {5591, 65, 0, 0, 0x30,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {5628, 65, 0, 0, 0x30,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {5662, 65, 0, 0, 0x30,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5710, 65, 0, 0, 0x30,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {5759, 65, 0, 0, 0x30,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {5805, 65, 0, 0, 0x30,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {5852, 65, 0, 0, 0x30,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {5896, 65, 0, 0, 0x30,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {5944, 65, 0, 0, 0x30,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {5993, 65, 0, 0, 0x30,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {6039, 65, 0, 0, 0x30,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {6086, 65, 0, 0, 0x30,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {6130, 65, 0, 0, 0x30,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {6176, 65, 0, 0, 0x30,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {6223, 65, 0, 0, 0x30,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {6267, 65, 0, 0, 0x30,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {6312, 65, 0, 0, 0x30,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {6354, 65, 0, 0, 0x30,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {6400, 65, 0, 0, 0x30,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {6447, 65, 0, 0, 0x30,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {6491, 65, 0, 0, 0x30,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {6536, 65, 0, 0, 0x30,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {6578, 65, 0, 0, 0x2E,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6610, 65, 0, 0, 0x2E,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {6643, 65, 0, 0, 0x2E,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {6673, 65, 0, 0, 0x2E,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {6704, 65, 0, 0, 0x2E,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {6732, 65, 0, 0, 0x2E,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {6764, 65, 0, 0, 0x2E,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {6797, 65, 0, 0, 0x2E,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {6827, 65, 0, 0, 0x2E,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {6858, 65, 0, 0, 0x2E,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {6886, 65, 0, 0, 0x2E,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {6928, 65, 0, 0, 0x2E,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {6971, 65, 0, 0, 0x2E,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {7011, 65, 0, 0, 0x2E,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {7052, 65, 0, 0, 0x2E,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {7090, 65, 0, 0, 0x2E,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {7132, 65, 0, 0, 0x2E,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {7175, 65, 0, 0, 0x2E,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {7215, 65, 0, 0, 0x2E,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {7256, 65, 0, 0, 0x2E,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {7294, 65, 0, 0, 0x2E,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {7334, 65, 0, 0, 0x2E,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {7375, 65, 0, 0, 0x2E,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {7413, 65, 0, 0, 0x2E,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {7452, 65, 0, 0, 0x2E,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {7488, 65, 0, 0, 0x2E,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {7528, 65, 0, 0, 0x2E,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {7569, 65, 0, 0, 0x2E,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {7607, 65, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {7629, 65, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {7648, 65, 0, 0, 0x2A,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {7673, 65, 0, 0, 0x2A,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {7699, 65, 0, 0, 0x2A,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {7722, 65, 0, 0, 0x2A,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {7746, 65, 0, 0, 0x2A,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {7767, 65, 0, 0, 0x2A,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {7792, 65, 0, 0, 0x2A,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {7818, 65, 0, 0, 0x2A,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {7841, 65, 0, 0, 0x2A,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {7865, 65, 0, 0, 0x2A,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {7886, 65, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7905, 65, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7925, 65, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7950, 2427, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7976, 2427, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8007, 2427, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8032, 2427, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8062, 2427, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8089, 8093, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8098, 8093, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8104, 8093, 0, 0, 0x12,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8111, 65, 0, 0, 0x0C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8128, 65, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8146, 65, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8167, 65, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8187, 65, 0, 0, 0x07,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {8202, 65, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8224, 65, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8236, 65, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8255, 65, 0, 0, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8292, 65, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8329, 65, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8366, 65, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8403, 65, 0, 0, 0xCA,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8430, 65, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8462, 65, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8494, 65, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8526, 65, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8558, 65, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8583, 65, 0, 0, 0xC7,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8605, 65, 0, 0, 0xCF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8628, 65, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8649, 65, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8670, 65, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8687, 65, 0, 0, 0xB0,0xB0,0,0,EVENT_OPTION_NONE_MASK}
+, {8705, 65, 0, 0, 0xB3,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {8738, 65, 0, 0, 0xB3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8770, 65, 0, 0, 0xB3,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {8800, 65, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8829, 65, 0, 0, 0xB3,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8855, 65, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8880, 65, 0, 0, 0xB3,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {8907, 65, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8933, 65, 0, 0, 0xB3,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8961, 65, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8992, 65, 0, 0, 0xB3,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {9021, 65, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9049, 65, 0, 0, 0x7E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {9082, 65, 0, 0, 0x7E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {9114, 65, 0, 0, 0x7E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9147, 65, 0, 0, 0x7E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9179, 65, 0, 0, 0x02,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9199, 65, 0, 0, 0x3B,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {9212, 65, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9229, 65, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9252, 65, 0, 0, 0x10,0x81,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable atom_arch_events = {
+    NUM_ARCH_EVENTS_ATOM,
+    atom_arch_event_strings,
+    atom_arch_event_options,
+    atom_arch_event_entries
+};
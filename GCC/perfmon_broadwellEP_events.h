@@ -0,0 +1,3484 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_BROADWELLEP 1700
+
+static const char broadwellEP_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_RAT_STALL_CYCLES\0"
+    "INT_MISC_RAT_STALL_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_6_UOPS_EXEC\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_FPU_DIV_COUNT\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_L2_PF_HIT\0"
+    "L2_RQSTS_L2_PF_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DEMAND_RQST_WB_HIT\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC2\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_OCCURRENCES\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_STLB_HIT_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_M_EVICT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "CPL_CYCLES_RING0_TRANS\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_STLB_HIT_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ILD_STALL_LCP\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_ALL_CONDITIONAL\0"
+    "BR_INST_EXEC_ALL_DIRECT_JMP\0"
+    "BR_INST_EXEC_ALL_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_INST_EXEC_ALL_INDIRECT_NEAR_RETURN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_ALL_CONDITIONAL\0"
+    "BR_MISP_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOP_DISPATCHES_CANCELLED_SIMD_PRF\0"
+    "UOPS_EXECUTED_PORT_PORT_0\0"
+    "UOPS_EXECUTED_PORT_PORT_1\0"
+    "UOPS_EXECUTED_PORT_PORT_2\0"
+    "UOPS_EXECUTED_PORT_PORT_3\0"
+    "UOPS_EXECUTED_PORT_PORT_4\0"
+    "UOPS_EXECUTED_PORT_PORT_5\0"
+    "UOPS_EXECUTED_PORT_PORT_6\0"
+    "UOPS_EXECUTED_PORT_PORT_7\0"
+    "UOPS_EXECUTED_PORT_PORT_0_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_1_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_2_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_3_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_4_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_5_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_6_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_7_CORE\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "PAGE_WALKER_LOADS_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_DTLB_MEMORY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "PMC1\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "OTHER_ASSISTS_ANY_WB_ASSIST\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR\0"
+    "FP_ARITH_INST_RETIRED_PACKED\0"
+    "FP_ARITH_INST_RETIRED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SINGLE\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MISC1\0"
+    "HLE_RETIRED_ABORTED_MISC2\0"
+    "HLE_RETIRED_ABORTED_MISC3\0"
+    "HLE_RETIRED_ABORTED_MISC4\0"
+    "HLE_RETIRED_ABORTED_MISC5\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MISC1\0"
+    "RTM_RETIRED_ABORTED_MISC2\0"
+    "RTM_RETIRED_ABORTED_MISC3\0"
+    "RTM_RETIRED_ABORTED_MISC4\0"
+    "RTM_RETIRED_ABORTED_MISC5\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS_ALL\0"
+    "MEM_UOPS_RETIRED_STORES_ALL\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_FWD\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "UBOX\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_REQUESTS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "TXR_INSERTS_AD_CACHE\0"
+    "TXR_INSERTS_AK_CACHE\0"
+    "TXR_INSERTS_BL_CACHE\0"
+    "TXR_INSERTS_IV_CACHE\0"
+    "TXR_INSERTS_AD_CORE\0"
+    "TXR_INSERTS_AK_CORE\0"
+    "TXR_INSERTS_BL_CORE\0"
+    "TXR_ADS_USED_AD\0"
+    "TXR_ADS_USED_AK\0"
+    "TXR_ADS_USED_BL\0"
+    "RING_BOUNCES_AD\0"
+    "RING_BOUNCES_AK\0"
+    "RING_BOUNCES_BL\0"
+    "RING_BOUNCES_IV\0"
+    "RING_SRC_THRTL\0"
+    "FAST_ASSERTED\0"
+    "CBOX0C0|CBOX0C1|CBOX1C0|CBOX1C1|CBOX2C0|CBOX2C1|CBOX3C0|CBOX3C1|CBOX4C0|CBOX4C1|CBOX5C0|CBOX5C1|CBOX6C0|CBOX6C1|CBOX7C0|CBOX7C1|CBOX8C0|CBOX8C1|CBOX9C0|CBOX9C1|CBOX10C0|CBOX10C1|CBOX11C0|CBOX11C1|CBOX12C0|CBOX12C1|CBOX13C0|CBOX13C1|CBOX14C0|CBOX14C1|CBOX15C0|CBOX15C1|CBOX16C0|CBOX16C1|CBOX17C0|CBOX17C1|CBOX18C0|CBOX18C1|CBOX19C0|CBOX19C1|CBOX20C0|CBOX20C1|CBOX21C0|CBOX21C1|CBOX22C0|CBOX22C1|CBOX23C0|CBOX23C1\0"
+    "BOUNCE_CONTROL\0"
+    "RING_AD_USED_UP_EVEN\0"
+    "RING_AD_USED_UP_ODD\0"
+    "RING_AD_USED_UP\0"
+    "RING_AD_USED_DOWN_EVEN\0"
+    "RING_AD_USED_DOWN_ODD\0"
+    "RING_AD_USED_DOWN\0"
+    "RING_AD_USED_ANY\0"
+    "RING_AK_USED_UP_EVEN\0"
+    "RING_AK_USED_UP_ODD\0"
+    "RING_AK_USED_UP\0"
+    "RING_AK_USED_DOWN_EVEN\0"
+    "RING_AK_USED_DOWN_ODD\0"
+    "RING_AK_USED_DOWN\0"
+    "RING_AK_USED_ANY\0"
+    "RING_BL_USED_UP_EVEN\0"
+    "RING_BL_USED_UP_ODD\0"
+    "RING_BL_USED_UP\0"
+    "RING_BL_USED_DOWN_EVEN\0"
+    "RING_BL_USED_DOWN_ODD\0"
+    "RING_BL_USED_DOWN\0"
+    "RING_BL_USED_ANY\0"
+    "RING_IV_USED_UP\0"
+    "RING_IV_USED_DN\0"
+    "RING_IV_USED_ANY\0"
+    "RING_IV_USED_DOWN\0"
+    "COUNTER0_OCCUPANCY\0"
+    "COUNTER0_OCCUPANCY_COUNT\0"
+    "RXR_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0|CBOX18C0|CBOX19C0|CBOX20C0|CBOX21C0|CBOX22C0|CBOX23C0\0"
+    "RXR_OCCUPANCY_IRQ_REJ\0"
+    "RXR_OCCUPANCY_IPQ\0"
+    "RXR_OCCUPANCY_PRQ_REJ\0"
+    "RXR_EXT_STARVED_IRQ\0"
+    "RXR_EXT_STARVED_IPQ\0"
+    "RXR_EXT_STARVED_PRQ\0"
+    "RXR_EXT_STARVED_ISMQ_BIDS\0"
+    "RXR_INSERTS_IRQ\0"
+    "RXR_INSERTS_IRQ_REJ\0"
+    "RXR_INSERTS_IPQ\0"
+    "RXR_INSERTS_PRQ\0"
+    "RXR_INSERTS_PRQ_REJ\0"
+    "RXR_IPQ_RETRY_ANY\0"
+    "RXR_IPQ_RETRY_FULL\0"
+    "RXR_IPQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IPQ_RETRY_QPI_CREDITS\0"
+    "RXR_IPQ_RETRY2_AD_SBO\0"
+    "RXR_IPQ_RETRY2_TARGET\0"
+    "RXR_IRQ_RETRY_ANY\0"
+    "RXR_IRQ_RETRY_FULL\0"
+    "RXR_IRQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IRQ_RETRY_RTID\0"
+    "RXR_IRQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_IIO_CREDITS\0"
+    "RXR_IRQ_RETRY_NID\0"
+    "RXR_IRQ_RETRY2_AD_SBO\0"
+    "RXR_IRQ_RETRY2_BL_SBO\0"
+    "RXR_IRQ_RETRY2_TARGET\0"
+    "RXR_ISMQ_RETRY_ANY\0"
+    "RXR_ISMQ_RETRY_FULL\0"
+    "RXR_ISMQ_RETRY_RTID\0"
+    "RXR_ISMQ_RETRY_QPI_CREDITS\0"
+    "RXR_ISMQ_RETRY_IIO_CREDITS\0"
+    "RXR_ISMQ_RETRY_NID\0"
+    "RXR_ISMQ_RETRY_WB_CREDITS\0"
+    "RXR_ISMQ_RETRY2_AD_SBO\0"
+    "RXR_ISMQ_RETRY2_BL_SBO\0"
+    "RXR_ISMQ_RETRY2_TARGET\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_READ\0"
+    "LLC_LOOKUP_NID\0"
+    "LLC_VICTIMS_M\0"
+    "LLC_VICTIMS_E\0"
+    "LLC_VICTIMS_S\0"
+    "LLC_VICTIMS_F\0"
+    "LLC_VICTIMS_MISS\0"
+    "LLC_VICTIMS_NID\0"
+    "TOR_INSERTS_OPCODE\0"
+    "TOR_INSERTS_MISS_OPCODE\0"
+    "TOR_INSERTS_EVICTION\0"
+    "TOR_INSERTS_ALL\0"
+    "TOR_INSERTS_WB\0"
+    "TOR_INSERTS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_MISS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_LOCAL\0"
+    "TOR_INSERTS_MISS_LOCAL\0"
+    "TOR_INSERTS_NID_OPCODE\0"
+    "TOR_INSERTS_NID_MISS_OPCODE\0"
+    "TOR_INSERTS_NID_EVICION\0"
+    "TOR_INSERTS_NID_ALL\0"
+    "TOR_INSERTS_NID_MISS_ALL\0"
+    "TOR_INSERTS_NID_WB\0"
+    "TOR_INSERTS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_MISS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_REMOTE\0"
+    "TOR_INSERTS_MISS_REMOTE\0"
+    "TOR_OCCUPANCY_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_EVICTION\0"
+    "TOR_OCCUPANCY_ALL\0"
+    "TOR_OCCUPANCY_MISS_ALL\0"
+    "TOR_OCCUPANCY_WB\0"
+    "TOR_OCCUPANCY_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_LOCAL\0"
+    "TOR_OCCUPANCY_MISS_LOCAL\0"
+    "TOR_OCCUPANCY_NID_OPCODE\0"
+    "TOR_OCCUPANCY_NID_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_NID_EVICTION\0"
+    "TOR_OCCUPANCY_NID_ALL\0"
+    "TOR_OCCUPANCY_NID_MISS_ALL\0"
+    "TOR_OCCUPANCY_NID_WB\0"
+    "TOR_OCCUPANCY_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_REMOTE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_STARTED\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CVZERO_PREFETCH_VICTIM\0"
+    "MISC_CVZERO_PREFETCH_MISS\0"
+    "SBO_CREDITS_ACQUIRED_AD\0"
+    "SBO_CREDITS_ACQUIRED_BL\0"
+    "SBO_CREDITS_ACQUIRED_ANY\0"
+    "SBO_CREDIT_OCCUPANCY_AD\0"
+    "SBO_CREDIT_OCCUPANCY_BL\0"
+    "SBO_CREDIT_OCCUPANCY_ANY\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE0_TRANSITION_CYCLES\0"
+    "CORE1_TRANSITION_CYCLES\0"
+    "CORE2_TRANSITION_CYCLES\0"
+    "CORE3_TRANSITION_CYCLES\0"
+    "CORE4_TRANSITION_CYCLES\0"
+    "CORE5_TRANSITION_CYCLES\0"
+    "CORE6_TRANSITION_CYCLES\0"
+    "CORE7_TRANSITION_CYCLES\0"
+    "CORE8_TRANSITION_CYCLES\0"
+    "CORE9_TRANSITION_CYCLES\0"
+    "CORE10_TRANSITION_CYCLES\0"
+    "CORE11_TRANSITION_CYCLES\0"
+    "CORE12_TRANSITION_CYCLES\0"
+    "CORE13_TRANSITION_CYCLES\0"
+    "CORE14_TRANSITION_CYCLES\0"
+    "CORE15_TRANSITION_CYCLES\0"
+    "CORE16_TRANSITION_CYCLES\0"
+    "CORE17_TRANSITION_CYCLES\0"
+    "FIVR_PS_PS0_CYCLES\0"
+    "FIVR_PS_PS1_CYCLES\0"
+    "FIVR_PS_PS2_CYCLES\0"
+    "FIVR_PS_PS3_CYCLES\0"
+    "DEMOTIONS_CORE0\0"
+    "DEMOTIONS_CORE1\0"
+    "DEMOTIONS_CORE2\0"
+    "DEMOTIONS_CORE3\0"
+    "DEMOTIONS_CORE4\0"
+    "DEMOTIONS_CORE5\0"
+    "DEMOTIONS_CORE6\0"
+    "DEMOTIONS_CORE7\0"
+    "DEMOTIONS_CORE8\0"
+    "DEMOTIONS_CORE9\0"
+    "DEMOTIONS_CORE10\0"
+    "DEMOTIONS_CORE11\0"
+    "DEMOTIONS_CORE12\0"
+    "DEMOTIONS_CORE13\0"
+    "DEMOTIONS_CORE14\0"
+    "DEMOTIONS_CORE15\0"
+    "DEMOTIONS_CORE16\0"
+    "DEMOTIONS_CORE17\0"
+    "FREQ_BAND0_CYCLES\0"
+    "FREQ_BAND1_CYCLES\0"
+    "FREQ_BAND2_CYCLES\0"
+    "FREQ_BAND3_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_OS_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "P_FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VR_HOT_CYCLES\0"
+    "UFS_BANDWIDTH_MAX_RANGE\0"
+    "UFS_TRANSITIONS_DOWN\0"
+    "UFS_TRANSITIONS_IO_P_LIMIT\0"
+    "UFS_TRANSITIONS_RING_GV\0"
+    "UFS_TRANSITIONS_UP_RING\0"
+    "UFS_TRANSITIONS_UP_STALL\0"
+    "PKG_RESIDENCY_C0_CYCLES\0"
+    "PKG_RESIDENCY_C0_ENTRIES\0"
+    "PKG_RESIDENCY_C0_EXITS\0"
+    "PKG_RESIDENCY_C2E_CYCLES\0"
+    "PKG_RESIDENCY_C2E_ENTRIES\0"
+    "PKG_RESIDENCY_C2E_EXITS\0"
+    "PKG_RESIDENCY_C3_CYCLES\0"
+    "PKG_RESIDENCY_C3_ENTRIES\0"
+    "PKG_RESIDENCY_C3_EXITS\0"
+    "PKG_RESIDENCY_C6_CYCLES\0"
+    "PKG_RESIDENCY_C6_ENTRIES\0"
+    "PKG_RESIDENCY_C6_EXITS\0"
+    "PKG_RESIDENCY_C7_CYCLES\0"
+    "PKG_RESIDENCY_C7_ENTRIES\0"
+    "PKG_RESIDENCY_C7_EXITS\0"
+    "PKG_RESIDENCY_C1E_CYCLES\0"
+    "PKG_RESIDENCY_C1E_ENTRIES\0"
+    "PKG_RESIDENCY_C1E_EXITS\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "BBOX_CLOCKTICKS\0"
+    "BBOX\0"
+    "ADDR_OPC_MATCH_ADDR\0"
+    "ADDR_OPC_MATCH_OPC\0"
+    "ADDR_OPC_MATCH_FILT\0"
+    "ADDR_OPC_MATCH_AD\0"
+    "ADDR_OPC_MATCH_BL\0"
+    "ADDR_OPC_MATCH_AK\0"
+    "BT_CYCLES_NE\0"
+    "BT_OCCUPANCY\0"
+    "BYPASS_IMC_TAKEN\0"
+    "BYPASS_IMC_NOT_TAKEN\0"
+    "CONFLICT_CYCLES\0"
+    "BBOX0C1|BBOX1C1\0"
+    "DIRECT2CORE_COUNT\0"
+    "DIRECT2CORE_CYCLES_DISABLED\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECTORY_LAT_OPT\0"
+    "DIRECTORY_LOOKUP_SNP\0"
+    "DIRECTORY_LOOKUP_NO_SNP\0"
+    "DIRECTORY_UPDATE_SET\0"
+    "DIRECTORY_UPDATE_CLEAR\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "HITME_LOOKUP_READ_OR_INVITOE\0"
+    "HITME_LOOKUP_WBMTOI\0"
+    "HITME_LOOKUP_ACKCNFLTWBI\0"
+    "HITME_LOOKUP_WBMTOE_OR_S\0"
+    "HITME_LOOKUP_HOM\0"
+    "HITME_LOOKUP_RSPFWDI_REMOTE\0"
+    "HITME_LOOKUP_RSPFWDI_LOCAL\0"
+    "HITME_LOOKUP_INVALS\0"
+    "HITME_LOOKUP_RSPFWDS\0"
+    "HITME_LOOKUP_ALLOCS\0"
+    "HITME_LOOKUP_RSP\0"
+    "HITME_LOOKUP_ALL\0"
+    "HITME_HIT_READ_OR_INVITOE\0"
+    "HITME_HIT_WBMTOI\0"
+    "HITME_HIT_ACKCNFLTWBI\0"
+    "HITME_HIT_WBMTOE_OR_S\0"
+    "HITME_HIT_HOM\0"
+    "HITME_HIT_RSPFWDI_REMOTE\0"
+    "HITME_HIT_RSPFWDI_LOCAL\0"
+    "HITME_HIT_INVALS\0"
+    "HITME_HIT_RSPFWDS\0"
+    "HITME_HIT_EVICTS\0"
+    "HITME_HIT_ALLOCS\0"
+    "HITME_HIT_RSP\0"
+    "HITME_HIT_ALL\0"
+    "HITME_HIT_PV_BITS_SET_READ_OR_INVITOE\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOI\0"
+    "HITME_HIT_PV_BITS_SET_ACKCNFLTWBI\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOE_OR_S\0"
+    "HITME_HIT_PV_BITS_SET_HOM\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_REMOTE\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_LOCAL\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDS\0"
+    "HITME_HIT_PV_BITS_SET_RSP\0"
+    "HITME_HIT_PV_BITS_SET_ALL\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI2\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI2\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_RETRY\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "OSB_READS_LOCAL\0"
+    "OSB_INVITOE_LOCAL\0"
+    "OSB_REMOTE\0"
+    "OSB_CANCELLED\0"
+    "OSB_READS_LOCAL_USEFUL\0"
+    "OSB_REMOTE_USEFUL\0"
+    "OSB_EDR_ALL\0"
+    "OSB_EDR_READS_LOCAL_I\0"
+    "OSB_EDR_READS_REMOTE_I\0"
+    "OSB_EDR_READS_LOCAL_S\0"
+    "OSB_EDR_READS_REMOTE_S\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "REQUESTS_ALL_LOCAL\0"
+    "REQUESTS_ALL_REMOTE\0"
+    "REQUESTS_ALL\0"
+    "HA_RING_AD_USED_CW_EVEN\0"
+    "HA_RING_AD_USED_CW_ODD\0"
+    "HA_RING_AD_USED_CW\0"
+    "HA_RING_AD_USED_CCW_EVEN\0"
+    "HA_RING_AD_USED_CCW_ODD\0"
+    "HA_RING_AD_USED_CCW\0"
+    "HA_RING_AK_USED_CW_EVEN\0"
+    "HA_RING_AK_USED_CW_ODD\0"
+    "HA_RING_AK_USED_CW\0"
+    "HA_RING_AK_USED_CCW_EVEN\0"
+    "HA_RING_AK_USED_CCW_ODD\0"
+    "HA_RING_AK_USED_CCW\0"
+    "HA_RING_BL_USED_CW_EVEN\0"
+    "HA_RING_BL_USED_CW_ODD\0"
+    "HA_RING_BL_USED_CW\0"
+    "HA_RING_BL_USED_CCW_EVEN\0"
+    "HA_RING_BL_USED_CCW_ODD\0"
+    "HA_RING_BL_USED_CCW\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "SBO0_CREDITS_ACQUIRED_AD\0"
+    "SBO0_CREDITS_ACQUIRED_BL\0"
+    "SBO0_CREDIT_OCCUPANCY_AD\0"
+    "SBO0_CREDIT_OCCUPANCY_BL\0"
+    "SBO1_CREDITS_ACQUIRED_AD\0"
+    "SBO1_CREDITS_ACQUIRED_BL\0"
+    "SBO1_CREDIT_OCCUPANCY_AD\0"
+    "SBO1_CREDIT_OCCUPANCY_BL\0"
+    "SNOOPS_RSP_AFTER_DATA_LOCAL\0"
+    "SNOOPS_RSP_AFTER_DATA_REMOTE\0"
+    "SNOOP_CYCLES_NE_LOCAL\0"
+    "SNOOP_CYCLES_NE_REMOTE\0"
+    "SNOOP_CYCLES_NE_ALL\0"
+    "SNOOP_OCCUPANCY_LOCAL\0"
+    "SNOOP_OCCUPANCY_REMOTE\0"
+    "SNOOP_RESP_RSPI\0"
+    "SNOOP_RESP_RSPS\0"
+    "SNOOP_RESP_RSPIFWD\0"
+    "SNOOP_RESP_RSPSFWD\0"
+    "SNOOP_RESP_RSP_WB\0"
+    "SNOOP_RESP_RSP_FWD_WB\0"
+    "SNOOP_RESP_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_RSPI\0"
+    "SNP_RESP_RECV_LOCAL_RSPS\0"
+    "SNP_RESP_RECV_LOCAL_RSPIFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPSFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPXFWDXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_OTHER\0"
+    "STALL_NO_SBO_CREDIT_SBO0_AD\0"
+    "STALL_NO_SBO_CREDIT_SBO1_AD\0"
+    "STALL_NO_SBO_CREDIT_SBO0_BL\0"
+    "STALL_NO_SBO_CREDIT_SBO1_BL\0"
+    "TAD_REQUESTS_G0_REGION0\0"
+    "TAD_REQUESTS_G0_REGION1\0"
+    "TAD_REQUESTS_G0_REGION2\0"
+    "TAD_REQUESTS_G0_REGION3\0"
+    "TAD_REQUESTS_G0_REGION4\0"
+    "TAD_REQUESTS_G0_REGION5\0"
+    "TAD_REQUESTS_G0_REGION6\0"
+    "TAD_REQUESTS_G0_REGION7\0"
+    "TAD_REQUESTS_G1_REGION8\0"
+    "TAD_REQUESTS_G1_REGION9\0"
+    "TAD_REQUESTS_G1_REGION10\0"
+    "TAD_REQUESTS_G1_REGION11\0"
+    "TRACKER_CYCLES_FULL_GP\0"
+    "TRACKER_CYCLES_FULL_ALL\0"
+    "TRACKER_CYCLES_NE_LOCAL\0"
+    "TRACKER_CYCLES_NE_REMOTE\0"
+    "TRACKER_CYCLES_NE_ALL\0"
+    "TRACKER_OCCUPANCY_READS_LOCAL\0"
+    "TRACKER_OCCUPANCY_READS_REMOTE\0"
+    "TRACKER_OCCUPANCY_WRITES_LOCAL\0"
+    "TRACKER_OCCUPANCY_WRITES_REMOTE\0"
+    "TRACKER_OCCUPANCY_RW_LOCAL\0"
+    "TRACKER_OCCUPANCY_RW_REMOTE\0"
+    "TRACKER_OCCUPANCY_INVITOE_LOCAL\0"
+    "TRACKER_OCCUPANCY_INVITOE_REMOTE\0"
+    "TRACKER_OCCUPANCY_ALL_LOCAL\0"
+    "TRACKER_OCCUPANCY_ALL_REMOTE\0"
+    "TRACKER_PENDING_OCCUPANCY_LOCAL\0"
+    "TRACKER_PENDING_OCCUPANCY_REMOTE\0"
+    "TRACKER_PENDING_OCCUPANCY_ALL\0"
+    "TXR_AD_CYCLES_FULL_SCHED0\0"
+    "TXR_AD_CYCLES_FULL_SCHED1\0"
+    "TXR_AD_CYCLES_FULL_ALL\0"
+    "TXR_AK\0"
+    "TXR_AK_CYCLES_FULL_SCHED0\0"
+    "TXR_AK_CYCLES_FULL_SCHED1\0"
+    "TXR_AK_CYCLES_FULL_ALL\0"
+    "TXR_BL_DRS_CACHE\0"
+    "TXR_BL_DRS_CORE\0"
+    "TXR_BL_DRS_QPI\0"
+    "TXR_BL_CYCLES_FULL_SCHED0\0"
+    "TXR_BL_CYCLES_FULL_SCHED1\0"
+    "TXR_BL_CYCLES_FULL_ALL\0"
+    "TXR_BL_OCCUPANCY\0"
+    "TXR_STARVED_AK\0"
+    "TXR_STARVED_BL\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX\0"
+    "ACT_COUNT_RD\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "DRAM_PRE_ALL\0"
+    "DRAM_REFRESH_PANIC\0"
+    "DRAM_REFRESH_HIGH\0"
+    "ECC_CORRECTABLE_ERRORS\0"
+    "MAJOR_MODES_READ\0"
+    "MAJOR_MODES_WRITE\0"
+    "MAJOR_MODES_PARTIAL\0"
+    "MAJOR_MODES_ISOCH\0"
+    "POWER_CHANNEL_DLLOFF\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_CKE_CYCLES_RANK0\0"
+    "POWER_CKE_CYCLES_RANK1\0"
+    "POWER_CKE_CYCLES_RANK2\0"
+    "POWER_CKE_CYCLES_RANK3\0"
+    "POWER_CKE_CYCLES_RANK4\0"
+    "POWER_CKE_CYCLES_RANK5\0"
+    "POWER_CKE_CYCLES_RANK6\0"
+    "POWER_CKE_CYCLES_RANK7\0"
+    "POWER_CRITICAL_THROTTLE_CYCLES\0"
+    "POWER_PCU_THROTTLING\0"
+    "POWER_SELF_REFRESH\0"
+    "POWER_THROTTLE_CYCLES_RANK0\0"
+    "POWER_THROTTLE_CYCLES_RANK1\0"
+    "POWER_THROTTLE_CYCLES_RANK2\0"
+    "POWER_THROTTLE_CYCLES_RANK3\0"
+    "POWER_THROTTLE_CYCLES_RANK4\0"
+    "POWER_THROTTLE_CYCLES_RANK5\0"
+    "POWER_THROTTLE_CYCLES_RANK6\0"
+    "POWER_THROTTLE_CYCLES_RANK7\0"
+    "PREEMPTION_RD_PREEMPT_RD\0"
+    "PREEMPTION_RD_PREEMPT_WR\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_PAGE_CLOSE\0"
+    "PRE_COUNT_RD\0"
+    "PRE_COUNT_WR\0"
+    "PRE_COUNT_BYP\0"
+    "RD_CAS_PRIO_LOW\0"
+    "RD_CAS_PRIO_MED\0"
+    "RD_CAS_PRIO_HIGH\0"
+    "RD_CAS_PRIO_PANIC\0"
+    "RD_CAS_RANK0_BANK0\0"
+    "RD_CAS_RANK0_BANK1\0"
+    "RD_CAS_RANK0_BANK2\0"
+    "RD_CAS_RANK0_BANK3\0"
+    "RD_CAS_RANK0_BANK4\0"
+    "RD_CAS_RANK0_BANK5\0"
+    "RD_CAS_RANK0_BANK6\0"
+    "RD_CAS_RANK0_BANK7\0"
+    "RD_CAS_RANK0_BANK8\0"
+    "RD_CAS_RANK0_BANK9\0"
+    "RD_CAS_RANK0_BANK10\0"
+    "RD_CAS_RANK0_BANK11\0"
+    "RD_CAS_RANK0_BANK12\0"
+    "RD_CAS_RANK0_BANK13\0"
+    "RD_CAS_RANK0_BANK14\0"
+    "RD_CAS_RANK0_BANK15\0"
+    "RD_CAS_RANK0_ALLBANKS\0"
+    "RD_CAS_RANK0_BANKG0\0"
+    "RD_CAS_RANK0_BANKG1\0"
+    "RD_CAS_RANK0_BANKG2\0"
+    "RD_CAS_RANK0_BANKG3\0"
+    "RD_CAS_RANK1_BANK0\0"
+    "RD_CAS_RANK1_BANK1\0"
+    "RD_CAS_RANK1_BANK2\0"
+    "RD_CAS_RANK1_BANK3\0"
+    "RD_CAS_RANK1_BANK4\0"
+    "RD_CAS_RANK1_BANK5\0"
+    "RD_CAS_RANK1_BANK6\0"
+    "RD_CAS_RANK1_BANK7\0"
+    "RD_CAS_RANK1_BANK8\0"
+    "RD_CAS_RANK1_BANK9\0"
+    "RD_CAS_RANK1_BANK10\0"
+    "RD_CAS_RANK1_BANK11\0"
+    "RD_CAS_RANK1_BANK12\0"
+    "RD_CAS_RANK1_BANK13\0"
+    "RD_CAS_RANK1_BANK14\0"
+    "RD_CAS_RANK1_BANK15\0"
+    "RD_CAS_RANK1_ALLBANKS\0"
+    "RD_CAS_RANK1_BANKG0\0"
+    "RD_CAS_RANK1_BANKG1\0"
+    "RD_CAS_RANK1_BANKG2\0"
+    "RD_CAS_RANK1_BANKG3\0"
+    "RD_CAS_RANK2_BANK0\0"
+    "RD_CAS_RANK2_BANK1\0"
+    "RD_CAS_RANK2_BANK2\0"
+    "RD_CAS_RANK2_BANK3\0"
+    "RD_CAS_RANK2_BANK4\0"
+    "RD_CAS_RANK2_BANK5\0"
+    "RD_CAS_RANK2_BANK6\0"
+    "RD_CAS_RANK2_BANK7\0"
+    "RD_CAS_RANK2_BANK8\0"
+    "RD_CAS_RANK2_BANK9\0"
+    "RD_CAS_RANK2_BANK10\0"
+    "RD_CAS_RANK2_BANK11\0"
+    "RD_CAS_RANK2_BANK12\0"
+    "RD_CAS_RANK2_BANK13\0"
+    "RD_CAS_RANK2_BANK14\0"
+    "RD_CAS_RANK2_BANK15\0"
+    "RD_CAS_RANK2_ALLBANKS\0"
+    "RD_CAS_RANK2_BANKG0\0"
+    "RD_CAS_RANK2_BANKG1\0"
+    "RD_CAS_RANK2_BANKG2\0"
+    "RD_CAS_RANK2_BANKG3\0"
+    "RD_CAS_RANK3_BANK0\0"
+    "RD_CAS_RANK3_BANK1\0"
+    "RD_CAS_RANK3_BANK2\0"
+    "RD_CAS_RANK3_BANK3\0"
+    "RD_CAS_RANK3_BANK4\0"
+    "RD_CAS_RANK3_BANK5\0"
+    "RD_CAS_RANK3_BANK6\0"
+    "RD_CAS_RANK3_BANK7\0"
+    "RD_CAS_RANK3_BANK8\0"
+    "RD_CAS_RANK3_BANK9\0"
+    "RD_CAS_RANK3_BANK10\0"
+    "RD_CAS_RANK3_BANK11\0"
+    "RD_CAS_RANK3_BANK12\0"
+    "RD_CAS_RANK3_BANK13\0"
+    "RD_CAS_RANK3_BANK14\0"
+    "RD_CAS_RANK3_BANK15\0"
+    "RD_CAS_RANK3_ALLBANKS\0"
+    "RD_CAS_RANK3_BANKG0\0"
+    "RD_CAS_RANK3_BANKG1\0"
+    "RD_CAS_RANK3_BANKG2\0"
+    "RD_CAS_RANK3_BANKG3\0"
+    "RD_CAS_RANK4_BANK0\0"
+    "RD_CAS_RANK4_BANK1\0"
+    "RD_CAS_RANK4_BANK2\0"
+    "RD_CAS_RANK4_BANK3\0"
+    "RD_CAS_RANK4_BANK4\0"
+    "RD_CAS_RANK4_BANK5\0"
+    "RD_CAS_RANK4_BANK6\0"
+    "RD_CAS_RANK4_BANK7\0"
+    "RD_CAS_RANK4_BANK8\0"
+    "RD_CAS_RANK4_BANK9\0"
+    "RD_CAS_RANK4_BANK10\0"
+    "RD_CAS_RANK4_BANK11\0"
+    "RD_CAS_RANK4_BANK12\0"
+    "RD_CAS_RANK4_BANK13\0"
+    "RD_CAS_RANK4_BANK14\0"
+    "RD_CAS_RANK4_BANK15\0"
+    "RD_CAS_RANK4_ALLBANKS\0"
+    "RD_CAS_RANK4_BANKG0\0"
+    "RD_CAS_RANK4_BANKG1\0"
+    "RD_CAS_RANK4_BANKG2\0"
+    "RD_CAS_RANK4_BANKG3\0"
+    "RD_CAS_RANK5_BANK0\0"
+    "RD_CAS_RANK5_BANK1\0"
+    "RD_CAS_RANK5_BANK2\0"
+    "RD_CAS_RANK5_BANK3\0"
+    "RD_CAS_RANK5_BANK4\0"
+    "RD_CAS_RANK5_BANK5\0"
+    "RD_CAS_RANK5_BANK6\0"
+    "RD_CAS_RANK5_BANK7\0"
+    "RD_CAS_RANK5_BANK8\0"
+    "RD_CAS_RANK5_BANK9\0"
+    "RD_CAS_RANK5_BANK10\0"
+    "RD_CAS_RANK5_BANK11\0"
+    "RD_CAS_RANK5_BANK12\0"
+    "RD_CAS_RANK5_BANK13\0"
+    "RD_CAS_RANK5_BANK14\0"
+    "RD_CAS_RANK5_BANK15\0"
+    "RD_CAS_RANK5_ALLBANKS\0"
+    "RD_CAS_RANK5_BANKG0\0"
+    "RD_CAS_RANK5_BANKG1\0"
+    "RD_CAS_RANK5_BANKG2\0"
+    "RD_CAS_RANK5_BANKG3\0"
+    "RD_CAS_RANK6_BANK0\0"
+    "RD_CAS_RANK6_BANK1\0"
+    "RD_CAS_RANK6_BANK2\0"
+    "RD_CAS_RANK6_BANK3\0"
+    "RD_CAS_RANK6_BANK4\0"
+    "RD_CAS_RANK6_BANK5\0"
+    "RD_CAS_RANK6_BANK6\0"
+    "RD_CAS_RANK6_BANK7\0"
+    "RD_CAS_RANK6_BANK8\0"
+    "RD_CAS_RANK6_BANK9\0"
+    "RD_CAS_RANK6_BANK10\0"
+    "RD_CAS_RANK6_BANK11\0"
+    "RD_CAS_RANK6_BANK12\0"
+    "RD_CAS_RANK6_BANK13\0"
+    "RD_CAS_RANK6_BANK14\0"
+    "RD_CAS_RANK6_BANK15\0"
+    "RD_CAS_RANK6_ALLBANKS\0"
+    "RD_CAS_RANK6_BANKG0\0"
+    "RD_CAS_RANK6_BANKG1\0"
+    "RD_CAS_RANK6_BANKG2\0"
+    "RD_CAS_RANK6_BANKG3\0"
+    "RD_CAS_RANK7_BANK0\0"
+    "RD_CAS_RANK7_BANK1\0"
+    "RD_CAS_RANK7_BANK2\0"
+    "RD_CAS_RANK7_BANK3\0"
+    "RD_CAS_RANK7_BANK4\0"
+    "RD_CAS_RANK7_BANK5\0"
+    "RD_CAS_RANK7_BANK6\0"
+    "RD_CAS_RANK7_BANK7\0"
+    "RD_CAS_RANK7_BANK8\0"
+    "RD_CAS_RANK7_BANK9\0"
+    "RD_CAS_RANK7_BANK10\0"
+    "RD_CAS_RANK7_BANK11\0"
+    "RD_CAS_RANK7_BANK12\0"
+    "RD_CAS_RANK7_BANK13\0"
+    "RD_CAS_RANK7_BANK14\0"
+    "RD_CAS_RANK7_BANK15\0"
+    "RD_CAS_RANK7_ALLBANKS\0"
+    "RD_CAS_RANK7_BANKG0\0"
+    "RD_CAS_RANK7_BANKG1\0"
+    "RD_CAS_RANK7_BANKG2\0"
+    "RD_CAS_RANK7_BANKG3\0"
+    "RPQ_CYCLES_NE\0"
+    "RPQ_INSERTS\0"
+    "RPQ_CYCLES_FULL\0"
+    "VMSE_MXB_WR_OCCUPANCY\0"
+    "VMSE_WR_PUSH_WMM\0"
+    "VMSE_WR_PUSH_RMM\0"
+    "WMM_TO_RMM_LOW_THRESH\0"
+    "WMM_TO_RMM_STARVE\0"
+    "WMM_TO_RMM_VMSE_RETRY\0"
+    "WPQ_INSERTS\0"
+    "WPQ_CYCLES_FULL\0"
+    "WPQ_CYCLES_NE\0"
+    "WPQ_READ_HIT\0"
+    "WPQ_WRITE_HIT\0"
+    "WRONG_MM\0"
+    "WR_CAS_RANK0_BANK0\0"
+    "WR_CAS_RANK0_BANK1\0"
+    "WR_CAS_RANK0_BANK2\0"
+    "WR_CAS_RANK0_BANK3\0"
+    "WR_CAS_RANK0_BANK4\0"
+    "WR_CAS_RANK0_BANK5\0"
+    "WR_CAS_RANK0_BANK6\0"
+    "WR_CAS_RANK0_BANK7\0"
+    "WR_CAS_RANK0_BANK8\0"
+    "WR_CAS_RANK0_BANK9\0"
+    "WR_CAS_RANK0_BANK10\0"
+    "WR_CAS_RANK0_BANK11\0"
+    "WR_CAS_RANK0_BANK12\0"
+    "WR_CAS_RANK0_BANK13\0"
+    "WR_CAS_RANK0_BANK14\0"
+    "WR_CAS_RANK0_BANK15\0"
+    "WR_CAS_RANK0_ALLBANKS\0"
+    "WR_CAS_RANK0_BANKG0\0"
+    "WR_CAS_RANK0_BANKG1\0"
+    "WR_CAS_RANK0_BANKG2\0"
+    "WR_CAS_RANK0_BANKG3\0"
+    "WR_CAS_RANK1_BANK0\0"
+    "WR_CAS_RANK1_BANK1\0"
+    "WR_CAS_RANK1_BANK2\0"
+    "WR_CAS_RANK1_BANK3\0"
+    "WR_CAS_RANK1_BANK4\0"
+    "WR_CAS_RANK1_BANK5\0"
+    "WR_CAS_RANK1_BANK6\0"
+    "WR_CAS_RANK1_BANK7\0"
+    "WR_CAS_RANK1_BANK8\0"
+    "WR_CAS_RANK1_BANK9\0"
+    "WR_CAS_RANK1_BANK10\0"
+    "WR_CAS_RANK1_BANK11\0"
+    "WR_CAS_RANK1_BANK12\0"
+    "WR_CAS_RANK1_BANK13\0"
+    "WR_CAS_RANK1_BANK14\0"
+    "WR_CAS_RANK1_BANK15\0"
+    "WR_CAS_RANK1_ALLBANKS\0"
+    "WR_CAS_RANK1_BANKG0\0"
+    "WR_CAS_RANK1_BANKG1\0"
+    "WR_CAS_RANK1_BANKG2\0"
+    "WR_CAS_RANK1_BANKG3\0"
+    "WR_CAS_RANK2_BANK0\0"
+    "WR_CAS_RANK2_BANK1\0"
+    "WR_CAS_RANK2_BANK2\0"
+    "WR_CAS_RANK2_BANK3\0"
+    "WR_CAS_RANK2_BANK4\0"
+    "WR_CAS_RANK2_BANK5\0"
+    "WR_CAS_RANK2_BANK6\0"
+    "WR_CAS_RANK2_BANK7\0"
+    "WR_CAS_RANK2_BANK8\0"
+    "WR_CAS_RANK2_BANK9\0"
+    "WR_CAS_RANK2_BANK10\0"
+    "WR_CAS_RANK2_BANK11\0"
+    "WR_CAS_RANK2_BANK12\0"
+    "WR_CAS_RANK2_BANK13\0"
+    "WR_CAS_RANK2_BANK14\0"
+    "WR_CAS_RANK2_BANK15\0"
+    "WR_CAS_RANK2_ALLBANKS\0"
+    "WR_CAS_RANK2_BANKG0\0"
+    "WR_CAS_RANK2_BANKG1\0"
+    "WR_CAS_RANK2_BANKG2\0"
+    "WR_CAS_RANK2_BANKG3\0"
+    "WR_CAS_RANK3_BANK0\0"
+    "WR_CAS_RANK3_BANK1\0"
+    "WR_CAS_RANK3_BANK2\0"
+    "WR_CAS_RANK3_BANK3\0"
+    "WR_CAS_RANK3_BANK4\0"
+    "WR_CAS_RANK3_BANK5\0"
+    "WR_CAS_RANK3_BANK6\0"
+    "WR_CAS_RANK3_BANK7\0"
+    "WR_CAS_RANK3_BANK8\0"
+    "WR_CAS_RANK3_BANK9\0"
+    "WR_CAS_RANK3_BANK10\0"
+    "WR_CAS_RANK3_BANK11\0"
+    "WR_CAS_RANK3_BANK12\0"
+    "WR_CAS_RANK3_BANK13\0"
+    "WR_CAS_RANK3_BANK14\0"
+    "WR_CAS_RANK3_BANK15\0"
+    "WR_CAS_RANK3_ALLBANKS\0"
+    "WR_CAS_RANK3_BANKG0\0"
+    "WR_CAS_RANK3_BANKG1\0"
+    "WR_CAS_RANK3_BANKG2\0"
+    "WR_CAS_RANK3_BANKG3\0"
+    "WR_CAS_RANK4_BANK0\0"
+    "WR_CAS_RANK4_BANK1\0"
+    "WR_CAS_RANK4_BANK2\0"
+    "WR_CAS_RANK4_BANK3\0"
+    "WR_CAS_RANK4_BANK4\0"
+    "WR_CAS_RANK4_BANK5\0"
+    "WR_CAS_RANK4_BANK6\0"
+    "WR_CAS_RANK4_BANK7\0"
+    "WR_CAS_RANK4_BANK8\0"
+    "WR_CAS_RANK4_BANK9\0"
+    "WR_CAS_RANK4_BANK10\0"
+    "WR_CAS_RANK4_BANK11\0"
+    "WR_CAS_RANK4_BANK12\0"
+    "WR_CAS_RANK4_BANK13\0"
+    "WR_CAS_RANK4_BANK14\0"
+    "WR_CAS_RANK4_BANK15\0"
+    "WR_CAS_RANK4_ALLBANKS\0"
+    "WR_CAS_RANK4_BANKG0\0"
+    "WR_CAS_RANK4_BANKG1\0"
+    "WR_CAS_RANK4_BANKG2\0"
+    "WR_CAS_RANK4_BANKG3\0"
+    "WR_CAS_RANK5_BANK0\0"
+    "WR_CAS_RANK5_BANK1\0"
+    "WR_CAS_RANK5_BANK2\0"
+    "WR_CAS_RANK5_BANK3\0"
+    "WR_CAS_RANK5_BANK4\0"
+    "WR_CAS_RANK5_BANK5\0"
+    "WR_CAS_RANK5_BANK6\0"
+    "WR_CAS_RANK5_BANK7\0"
+    "WR_CAS_RANK5_BANK8\0"
+    "WR_CAS_RANK5_BANK9\0"
+    "WR_CAS_RANK5_BANK10\0"
+    "WR_CAS_RANK5_BANK11\0"
+    "WR_CAS_RANK5_BANK12\0"
+    "WR_CAS_RANK5_BANK13\0"
+    "WR_CAS_RANK5_BANK14\0"
+    "WR_CAS_RANK5_BANK15\0"
+    "WR_CAS_RANK5_ALLBANKS\0"
+    "WR_CAS_RANK5_BANKG0\0"
+    "WR_CAS_RANK5_BANKG1\0"
+    "WR_CAS_RANK5_BANKG2\0"
+    "WR_CAS_RANK5_BANKG3\0"
+    "WR_CAS_RANK6_BANK0\0"
+    "WR_CAS_RANK6_BANK1\0"
+    "WR_CAS_RANK6_BANK2\0"
+    "WR_CAS_RANK6_BANK3\0"
+    "WR_CAS_RANK6_BANK4\0"
+    "WR_CAS_RANK6_BANK5\0"
+    "WR_CAS_RANK6_BANK6\0"
+    "WR_CAS_RANK6_BANK7\0"
+    "WR_CAS_RANK6_BANK8\0"
+    "WR_CAS_RANK6_BANK9\0"
+    "WR_CAS_RANK6_BANK10\0"
+    "WR_CAS_RANK6_BANK11\0"
+    "WR_CAS_RANK6_BANK12\0"
+    "WR_CAS_RANK6_BANK13\0"
+    "WR_CAS_RANK6_BANK14\0"
+    "WR_CAS_RANK6_BANK15\0"
+    "WR_CAS_RANK6_ALLBANKS\0"
+    "WR_CAS_RANK6_BANKG0\0"
+    "WR_CAS_RANK6_BANKG1\0"
+    "WR_CAS_RANK6_BANKG2\0"
+    "WR_CAS_RANK6_BANKG3\0"
+    "WR_CAS_RANK7_BANK0\0"
+    "WR_CAS_RANK7_BANK1\0"
+    "WR_CAS_RANK7_BANK2\0"
+    "WR_CAS_RANK7_BANK3\0"
+    "WR_CAS_RANK7_BANK4\0"
+    "WR_CAS_RANK7_BANK5\0"
+    "WR_CAS_RANK7_BANK6\0"
+    "WR_CAS_RANK7_BANK7\0"
+    "WR_CAS_RANK7_BANK8\0"
+    "WR_CAS_RANK7_BANK9\0"
+    "WR_CAS_RANK7_BANK10\0"
+    "WR_CAS_RANK7_BANK11\0"
+    "WR_CAS_RANK7_BANK12\0"
+    "WR_CAS_RANK7_BANK13\0"
+    "WR_CAS_RANK7_BANK14\0"
+    "WR_CAS_RANK7_BANK15\0"
+    "WR_CAS_RANK7_ALLBANKS\0"
+    "WR_CAS_RANK7_BANKG0\0"
+    "WR_CAS_RANK7_BANKG1\0"
+    "WR_CAS_RANK7_BANKG2\0"
+    "WR_CAS_RANK7_BANKG3\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDIT_PRQ_QPI0\0"
+    "PBOX0|PBOX1\0"
+    "IIO_CREDIT_PRQ_QPI1\0"
+    "IIO_CREDIT_ISOCH_QPI0\0"
+    "IIO_CREDIT_ISOCH_QPI1\0"
+    "R2PCIE_RING_AD_USED_CW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CW_ODD\0"
+    "R2PCIE_RING_AD_USED_CW\0"
+    "R2PCIE_RING_AD_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CCW_ODD\0"
+    "R2PCIE_RING_AD_USED_CCW\0"
+    "RING_AK_BOUNCES_UP\0"
+    "RING_AK_BOUNCES_DN\0"
+    "R2PCIE_RING_AK_USED_CW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CW_ODD\0"
+    "R2PCIE_RING_AK_USED_CW\0"
+    "R2PCIE_RING_AK_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CCW_ODD\0"
+    "R2PCIE_RING_AK_USED_CCW\0"
+    "R2PCIE_RING_BL_USED_CW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CW_ODD\0"
+    "R2PCIE_RING_BL_USED_CW\0"
+    "R2PCIE_RING_BL_USED_CCW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CCW_ODD\0"
+    "R2PCIE_RING_BL_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_CW\0"
+    "R2PCIE_RING_IV_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_ANY\0"
+    "RXR_CYCLES_NE_NCB\0"
+    "PBOX0|PBOX1|RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "RXR_CYCLES_NE_NCS\0"
+    "RXR_INSERTS_NCB\0"
+    "RXR_INSERTS_NCS\0"
+    "RXR_OCCUPANCY_DRS\0"
+    "PBOX0\0"
+    "R2PCIE_TXR_CYCLES_FULL_AD\0"
+    "R2PCIE_TXR_CYCLES_FULL_AK\0"
+    "R2PCIE_TXR_CYCLES_FULL_BL\0"
+    "R2PCIE_TXR_CYCLES_NE_AD\0"
+    "R2PCIE_TXR_CYCLES_NE_AK\0"
+    "R2PCIE_TXR_CYCLES_NE_BL\0"
+    "TXR_NACK_DN_AD\0"
+    "PBOX|RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "TXR_NACK_DN_BL\0"
+    "TXR_NACK_DN_AK\0"
+    "TXR_NACK_UP_AD\0"
+    "TXR_NACK_UP_BL\0"
+    "TXR_NACK_UP_AK\0"
+    "TXR_NACK_AD\0"
+    "TXR_NACK_BL\0"
+    "TXR_NACK_AK\0"
+    "TXR_NACK_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "IBOX\0"
+    "CACHE_TOTAL_OCCUPANCY_SOURCE\0"
+    "COHERENT_OPS_PCIRDCUR\0"
+    "COHERENT_OPS_CRD\0"
+    "COHERENT_OPS_DRD\0"
+    "COHERENT_OPS_RFO\0"
+    "COHERENT_OPS_PCITOM\0"
+    "COHERENT_OPS_PCIDCAHINT\0"
+    "COHERENT_OPS_WBMTOI\0"
+    "COHERENT_OPS_CLFLUSH\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_2ND_RD_INSERT\0"
+    "MISC0_2ND_WR_INSERT\0"
+    "MISC0_2ND_ATOMIC_INSERT\0"
+    "MISC0_FAST_XFER\0"
+    "MISC0_PF_ACK_HINT\0"
+    "MISC0_PF_TIMEOUT\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_LOST_FWD\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "MISC1_DATA_THROTTLE\0"
+    "SNOOP_RESP_MISS\0"
+    "SNOOP_RESP_HIT_I\0"
+    "SNOOP_RESP_HIT_ES\0"
+    "SNOOP_RESP_HIT_M\0"
+    "SNOOP_RESP_SNPCODE\0"
+    "SNOOP_RESP_SNPDATA\0"
+    "SNOOP_RESP_SNPINV\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREF\0"
+    "TRANSACTIONS_WR_PREF\0"
+    "TRANSACTIONS_ALL_READS\0"
+    "TRANSACTIONS_ALL_WRITES\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "RXR_AK_INSERTS\0"
+    "RXR_BL_DRS_CYCLES_FULL\0"
+    "RXR_BL_DRS_INSERTS\0"
+    "RXR_BL_DRS_OCCUPANCY\0"
+    "RXR_BL_NCB_CYCLES_FULL\0"
+    "RXR_BL_NCB_INSERTS\0"
+    "RXR_BL_NCB_OCCUPANCY\0"
+    "RXR_BL_NCS_CYCLES_FULL\0"
+    "RXR_BL_NCS_INSERTS\0"
+    "RXR_BL_NCS_OCCUPANCY\0"
+    "TXR_AD_STALL_CREDIT_CYCLES\0"
+    "TXR_BL_STALL_CREDIT_CYCLES\0"
+    "TXR_DATA_INSERTS_NCB\0"
+    "TXR_DATA_INSERTS_NCS\0"
+    "TXR_REQUEST_OCCUPANCY\0"
+    "RBOX_CLOCKTICK\0"
+    "RBOX\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO8\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO9\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO10\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO11\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO12\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO13\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO14_16\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO15_17\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO0\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO1\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO2\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO3\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO4\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO5\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO6\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO7\0"
+    "HA_R2_BL_CREDITS_EMPTY_HA0\0"
+    "HA_R2_BL_CREDITS_EMPTY_HA1\0"
+    "HA_R2_BL_CREDITS_EMPTY_R2_NCB\0"
+    "HA_R2_BL_CREDITS_EMPTY_R2_NCS\0"
+    "QPI0_AD_CREDITS_EMPTY_VNA\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_AD_CREDITS_EMPTY_VNA\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI0_BL_CREDITS_EMPTY_VNA\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VNA\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "R3QPI_RING_AD_USED_CW_EVEN\0"
+    "R3QPI_RING_AD_USED_CW_ODD\0"
+    "R3QPI_RING_AD_USED_CW\0"
+    "R3QPI_RING_AD_USED_CCW_EVEN\0"
+    "R3QPI_RING_AD_USED_CCW_ODD\0"
+    "R3QPI_RING_AD_USED_CCW\0"
+    "R3QPI_RING_AK_USED_CW_EVEN\0"
+    "R3QPI_RING_AK_USED_CW_ODD\0"
+    "R3QPI_RING_AK_USED_CW\0"
+    "R3QPI_RING_AK_USED_CCW_EVEN\0"
+    "R3QPI_RING_AK_USED_CCW_ODD\0"
+    "R3QPI_RING_AK_USED_CCW\0"
+    "R3QPI_RING_BL_USED_CW_EVEN\0"
+    "R3QPI_RING_BL_USED_CW_ODD\0"
+    "R3QPI_RING_BL_USED_CW\0"
+    "R3QPI_RING_BL_USED_CCW_EVEN\0"
+    "R3QPI_RING_BL_USED_CCW_ODD\0"
+    "R3QPI_RING_BL_USED_CCW\0"
+    "R3QPI_RING_IV_USED_CW\0"
+    "R3QPI_RING_IV_USED_CCW\0"
+    "R3QPI_RING_IV_USED_ANY\0"
+    "RING_SINK_STARVED_AK\0"
+    "RXR_CYCLES_NE_HOM\0"
+    "RXR_CYCLES_NE_SNP\0"
+    "RXR_CYCLES_NE_NDR\0"
+    "RXR_CYCLES_NE_VN1_HOM\0"
+    "RXR_CYCLES_NE_VN1_SNP\0"
+    "RXR_CYCLES_NE_VN1_NDR\0"
+    "RXR_CYCLES_NE_VN1_DRS\0"
+    "RXR_CYCLES_NE_VN1_NCB\0"
+    "RXR_CYCLES_NE_VN1_NCS\0"
+    "RXR_INSERTS_HOM\0"
+    "RXR_INSERTS_SNP\0"
+    "RXR_INSERTS_NDR\0"
+    "RXR_INSERTS_DRS\0"
+    "RXR_INSERTS_VN1_HOM\0"
+    "RXR_INSERTS_VN1_SNP\0"
+    "RXR_INSERTS_VN1_NDR\0"
+    "RXR_INSERTS_VN1_DRS\0"
+    "RXR_INSERTS_VN1_NCB\0"
+    "RXR_INSERTS_VN1_NCS\0"
+    "RXR_OCCUPANCY_VN1_HOM\0"
+    "RBOX0C0|RBOX1C0\0"
+    "RXR_OCCUPANCY_VN1_SNP\0"
+    "RXR_OCCUPANCY_VN1_NDR\0"
+    "RXR_OCCUPANCY_VN1_DRS\0"
+    "RXR_OCCUPANCY_VN1_NCB\0"
+    "RXR_OCCUPANCY_VN1_NCS\0"
+    "R3QPI_TXR_CYCLES_FULL\0"
+    "R3QPI_TXR_CYCLES_NE\0"
+    "VN0_CREDITS_REJECT_HOM\0"
+    "VN0_CREDITS_REJECT_SNP\0"
+    "VN0_CREDITS_REJECT_NDR\0"
+    "VN0_CREDITS_REJECT_DRS\0"
+    "VN0_CREDITS_REJECT_NCB\0"
+    "VN0_CREDITS_REJECT_NCS\0"
+    "VN1_CREDITS_REJECT_HOM\0"
+    "VN1_CREDITS_REJECT_SNP\0"
+    "VN1_CREDITS_REJECT_NDR\0"
+    "VN1_CREDITS_REJECT_DRS\0"
+    "VN1_CREDITS_REJECT_NCB\0"
+    "VN1_CREDITS_REJECT_NCS\0"
+    "VNA_CREDITS_REJECT_HOM\0"
+    "VNA_CREDITS_REJECT_SNP\0"
+    "VNA_CREDITS_REJECT_NDR\0"
+    "VNA_CREDITS_REJECT_DRS\0"
+    "VNA_CREDITS_REJECT_NCB\0"
+    "VNA_CREDITS_REJECT_NCS\0"
+    "VN0_CREDITS_USED_HOM\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_NDR\0"
+    "VN0_CREDITS_USED_DRS\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN1_CREDITS_USED_HOM\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_NDR\0"
+    "VN1_CREDITS_USED_DRS\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VNA_CREDITS_ACQUIRED_AD\0"
+    "VNA_CREDITS_ACQUIRED_BL\0"
+    "SBOX\0"
+    "SBOX_CLOCKTICKS\0"
+    "R2R_RING_AD_USED_ANY\0"
+    "R2R_RING_AD_USED_UP_EVEN\0"
+    "R2R_RING_AD_USED_UP_ODD\0"
+    "R2R_RING_AD_USED_UP\0"
+    "R2R_RING_AD_USED_DOWN_EVEN\0"
+    "R2R_RING_AD_USED_DOWN_ODD\0"
+    "R2R_RING_AD_USED_DOWN\0"
+    "R2R_RING_AK_USED_ANY\0"
+    "R2R_RING_AK_USED_UP_EVEN\0"
+    "R2R_RING_AK_USED_UP_ODD\0"
+    "R2R_RING_AK_USED_UP\0"
+    "R2R_RING_AK_USED_DOWN_EVEN\0"
+    "R2R_RING_AK_USED_DOWN_ODD\0"
+    "R2R_RING_AK_USED_DOWN\0"
+    "R2R_RING_BL_USED_ANY\0"
+    "R2R_RING_BL_USED_UP_EVEN\0"
+    "R2R_RING_BL_USED_UP_ODD\0"
+    "R2R_RING_BL_USED_UP\0"
+    "R2R_RING_BL_USED_DOWN_EVEN\0"
+    "R2R_RING_BL_USED_DOWN_ODD\0"
+    "R2R_RING_BL_USED_DOWN\0"
+    "RING_BOUNCES_AD_CACHE\0"
+    "RING_BOUNCES_AK_CORE\0"
+    "RING_BOUNCES_BL_CORE\0"
+    "RING_BOUNCES_IV_CORE\0"
+    "QPI_RING_IV_USED_ANY\0"
+    "QPI_RING_IV_USED_UP\0"
+    "QPI_RING_IV_USED_DOWN\0"
+    "RXR_BYPASS_AD_CRD\0"
+    "RXR_BYPASS_AD_BNC\0"
+    "RXR_BYPASS_BL_CRD\0"
+    "RXR_BYPASS_BL_BNC\0"
+    "RXR_BYPASS_AK\0"
+    "RXR_BYPASS_IV\0"
+    "RXR_INSERTS_AD_CRD\0"
+    "RXR_INSERTS_AD_BNC\0"
+    "RXR_INSERTS_BL_CRD\0"
+    "RXR_INSERTS_BL_BNC\0"
+    "RXR_INSERTS_AK\0"
+    "RXR_INSERTS_IV\0"
+    "RXR_OCCUPANCY_AD_CRD\0"
+    "RXR_OCCUPANCY_AD_BNC\0"
+    "RXR_OCCUPANCY_BL_CRD\0"
+    "RXR_OCCUPANCY_BL_BNC\0"
+    "RXR_OCCUPANCY_AK\0"
+    "RXR_OCCUPANCY_IV\0"
+    "TXR_INSERTS_AD_CRD\0"
+    "TXR_INSERTS_AD_BNC\0"
+    "TXR_INSERTS_BL_CRD\0"
+    "TXR_INSERTS_BL_BNC\0"
+    "TXR_INSERTS_AK\0"
+    "TXR_INSERTS_IV\0"
+    "TXR_OCCUPANCY_AD_CRD\0"
+    "TXR_OCCUPANCY_AD_BNC\0"
+    "TXR_OCCUPANCY_BL_CRD\0"
+    "TXR_OCCUPANCY_BL_BNC\0"
+    "TXR_OCCUPANCY_AK\0"
+    "TXR_OCCUPANCY_IV\0"
+    "TXR_ORDERING_IV_SNOOPGO_UP\0"
+    "TXR_ORDERING_IV_SNOOPGO_DN\0"
+    "TXR_ORDERING_AK_U2C_UP_EVEN\0"
+    "TXR_ORDERING_AK_U2C_UP_ODD\0"
+    "TXR_ORDERING_AK_U2C_DN_EVEN\0"
+    "TXR_ORDERING_AK_U2C_DN_ODD\0"
+    "QBOX_CLOCKTICKS\0"
+    "QBOX\0"
+    "CTO_COUNT\0"
+    "DIRECT2CORE_SUCCESS_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS\0"
+    "DIRECT2CORE_FAILURE_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT\0"
+    "DIRECT2CORE_FAILURE_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_MISS\0"
+    "DIRECT2CORE_FAILURE_RBT_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT_MISS\0"
+    "L1_POWER_CYCLES\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_BYPASSED\0"
+    "RXL_CREDITS_CONSUMED_VN0_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN0_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN0_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN0_NDR\0"
+    "RXL_CREDITS_CONSUMED_VN1_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN1_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN1_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN1_NDR\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_CYCLES_NE\0"
+    "RXL_FLITS_G0_IDLE\0"
+    "RXL_FLITS_G0_DATA\0"
+    "RXL_FLITS_G0_NON_DATA\0"
+    "RXL_FLITS_G1_SNP\0"
+    "RXL_FLITS_G1_HOM_REQ\0"
+    "RXL_FLITS_G1_HOM_NONREQ\0"
+    "RXL_FLITS_G1_HOM\0"
+    "RXL_FLITS_G1_DRS_DATA\0"
+    "RXL_FLITS_G1_DRS_NONDATA\0"
+    "RXL_FLITS_G1_DRS\0"
+    "RXL_FLITS_G2_NDR_AD\0"
+    "RXL_FLITS_G2_NDR_AK\0"
+    "RXL_FLITS_G2_NCB_DATA\0"
+    "RXL_FLITS_G2_NCB_NONDATA\0"
+    "RXL_FLITS_G2_NCB\0"
+    "RXL_FLITS_G2_NCS\0"
+    "RXL_INSERTS\0"
+    "RXL_INSERTS_DRS_VN0\0"
+    "RXL_INSERTS_DRS_VN1\0"
+    "RXL_INSERTS_HOM_VN0\0"
+    "RXL_INSERTS_HOM_VN1\0"
+    "RXL_INSERTS_NCB_VN0\0"
+    "RXL_INSERTS_NCB_VN1\0"
+    "RXL_INSERTS_NCS_VN0\0"
+    "RXL_INSERTS_NCS_VN1\0"
+    "RXL_INSERTS_NDR_VN0\0"
+    "RXL_INSERTS_NDR_VN1\0"
+    "RXL_INSERTS_SNP_VN0\0"
+    "RXL_INSERTS_SNP_VN1\0"
+    "RXL_OCCUPANCY\0"
+    "RXL_OCCUPANCY_DRS_VN0\0"
+    "RXL_OCCUPANCY_DRS_VN1\0"
+    "RXL_OCCUPANCY_HOM_VN0\0"
+    "RXL_OCCUPANCY_HOM_VN1\0"
+    "RXL_OCCUPANCY_NCB_VN0\0"
+    "RXL_OCCUPANCY_NCB_VN1\0"
+    "RXL_OCCUPANCY_NCS_VN0\0"
+    "RXL_OCCUPANCY_NCS_VN1\0"
+    "RXL_OCCUPANCY_NDR_VN0\0"
+    "RXL_OCCUPANCY_NDR_VN1\0"
+    "RXL_OCCUPANCY_SNP_VN0\0"
+    "RXL_OCCUPANCY_SNP_VN1\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BYPASSED\0"
+    "TXL_CYCLES_NE\0"
+    "TXL_FLITS_G0_IDLE\0"
+    "TXL_FLITS_G0_DATA\0"
+    "TXL_FLITS_G0_NON_DATA\0"
+    "TXL_FLITS_G1_SNP\0"
+    "TXL_FLITS_G1_HOM_REQ\0"
+    "TXL_FLITS_G1_HOM_NONREQ\0"
+    "TXL_FLITS_G1_HOM\0"
+    "TXL_FLITS_G1_DRS_DATA\0"
+    "TXL_FLITS_G1_DRS_NONDATA\0"
+    "TXL_FLITS_G1_DRS\0"
+    "TXL_FLITS_G2_NDR_AD\0"
+    "TXL_FLITS_G2_NDR_AK\0"
+    "TXL_FLITS_G2_NCB_DATA\0"
+    "TXL_FLITS_G2_NCB_NONDATA\0"
+    "TXL_FLITS_G2_NCB\0"
+    "TXL_FLITS_G2_NCS\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY\0"
+    "TXR_AD_HOM_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_HOM_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_HOM_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_HOM_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AD_NDR_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_NDR_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_NDR_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_NDR_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AD_SNP_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_SNP_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_SNP_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_SNP_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AK_NDR_CREDIT_ACQUIRED\0"
+    "TXR_AK_NDR_CREDIT_OCCUPANCY\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN_SHR\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN_SHR\0"
+    "TXR_BL_NCB_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_NCB_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_NCB_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_NCB_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_BL_NCS_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_NCS_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_NCS_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_NCS_CREDIT_OCCUPANCY_VN1\0"
+    "VNA_CREDIT_RETURNS\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "QPI_RATE\0"
+    "QBOX0FIX0|QBOX1FIX0|QBOX2FIX0\0"
+    "QPI_RX_IDLE\0"
+    "QBOX0FIX1|QBOX1FIX1|QBOX2FIX1\0"
+    "QPI_RX_LLR\0"
+    "QBOX0FIX2|QBOX1FIX2|QBOX2FIX2\0";
+
+static const PerfmonEventOption broadwellEP_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x03}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x08}
+, {EVENT_OPTION_THRESHOLD,0x0C}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_STATE,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_INVERT,1}
+};
+
+static const PerfmonEventEntry broadwellEP_arch_event_entries[NUM_ARCH_EVENTS_BROADWELLEP] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 217, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {221, 217, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {237, 217, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {260, 217, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {284, 217, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 217, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {337, 217, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 217, 0, 0, 0x08,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {394, 217, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {426, 217, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {455, 217, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 217, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {521, 217, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {546, 217, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {570, 217, 3, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {599, 217, 5, 3, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {627, 217, 0, 1, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {653, 217, 1, 2, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {678, 217, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {694, 217, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {718, 217, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {739, 217, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {762, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {786, 217, 9, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {811, 217, 11, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {836, 217, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {865, 217, 15, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {895, 217, 18, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {925, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {959, 217, 21, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {993, 217, 22, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1027, 217, 23, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1061, 217, 24, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1095, 217, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1129, 217, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1150, 217, 26, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1170, 217, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1199, 217, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1227, 217, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1245, 217, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1262, 217, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 217, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1305, 217, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1324, 217, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1344, 217, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1372, 217, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1397, 217, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1414, 217, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1435, 217, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1466, 217, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 217, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1496, 217, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 217, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 217, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1566, 217, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1589, 217, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1617, 217, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1645, 217, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1682, 1704, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1709, 1704, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1738, 1704, 1, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1764, 217, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1796, 217, 0, 0, 0x49,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1823, 217, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1856, 217, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1886, 217, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1922, 217, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1954, 217, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1973, 217, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1989, 217, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2005, 217, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2017, 217, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 217, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2067, 217, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2105, 217, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2147, 217, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2188, 217, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2242, 217, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2273, 217, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2309, 217, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2346, 217, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2378, 217, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2411, 217, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2428, 217, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2447, 217, 28, 2, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2470, 217, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2484, 217, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2498, 217, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2512, 217, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2526, 217, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 217, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2563, 217, 0, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2607, 217, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2651, 217, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2691, 217, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2732, 217, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2772, 217, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2804, 217, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2814, 217, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2828, 217, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2841, 217, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2857, 217, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2874, 217, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2886, 217, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2903, 217, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2921, 217, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2934, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2950, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2973, 217, 21, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2996, 217, 22, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3019, 217, 23, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3042, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3057, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3079, 217, 21, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3101, 217, 22, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3123, 217, 23, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3145, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3163, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3188, 217, 21, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3213, 217, 22, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3238, 217, 23, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3263, 217, 30, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3280, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3299, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3325, 217, 21, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3351, 217, 22, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3377, 217, 23, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3403, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3417, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3438, 217, 21, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3459, 217, 22, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3480, 217, 23, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3501, 217, 30, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3517, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3545, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3571, 217, 21, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3597, 217, 22, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3623, 217, 23, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3649, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3678, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3705, 217, 21, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3732, 217, 22, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3759, 217, 23, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3786, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3810, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3832, 217, 21, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3854, 217, 22, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3876, 217, 23, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3898, 217, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3909, 217, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3923, 217, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3939, 217, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3965, 217, 0, 0, 0x85,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {3986, 217, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4013, 217, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4037, 217, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4067, 217, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4093, 217, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4107, 217, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4131, 217, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4159, 217, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {4189, 217, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4234, 217, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4265, 217, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4301, 217, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4339, 217, 0, 0, 0x88,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4368, 217, 0, 0, 0x88,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4396, 217, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4430, 217, 0, 0, 0x88,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4474, 217, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4512, 217, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4538, 217, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4562, 217, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4590, 217, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4635, 217, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4666, 217, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4702, 217, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4740, 217, 0, 0, 0x89,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4769, 217, 0, 0, 0x89,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4813, 217, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4839, 217, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4867, 217, 32, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4915, 217, 33, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4965, 217, 34, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5015, 217, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5065, 217, 35, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5105, 217, 0, 0, 0xA0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5139, 217, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5165, 217, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5191, 217, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5217, 217, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5243, 217, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5269, 217, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5295, 217, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5321, 217, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5347, 217, 37, 1, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5378, 217, 37, 1, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5409, 217, 37, 1, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5440, 217, 37, 1, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5471, 217, 37, 1, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5502, 217, 37, 1, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5533, 217, 37, 1, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5564, 217, 37, 1, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5595, 217, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5615, 217, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5634, 217, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5653, 217, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5673, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5704, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5738, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5768, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5801, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5831, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5865, 217, 32, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5898, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5929, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5963, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5993, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6026, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6056, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6090, 217, 23, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6118, 217, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6127, 217, 8, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6145, 217, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6163, 217, 22, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6181, 217, 23, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6199, 217, 0, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6222, 217, 9, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6247, 217, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6280, 217, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6296, 217, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6328, 217, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6360, 217, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6388, 217, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6417, 217, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6438, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6464, 217, 9, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6491, 217, 11, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6518, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6554, 217, 21, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6590, 217, 22, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6626, 217, 23, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6662, 217, 24, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6698, 217, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6734, 217, 42, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6770, 217, 43, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6806, 217, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6825, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6856, 217, 9, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6888, 217, 11, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6920, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6961, 217, 21, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7002, 217, 22, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7043, 217, 23, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7084, 217, 24, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7125, 217, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7166, 217, 42, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7207, 217, 43, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7248, 217, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7280, 217, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7306, 217, 0, 0, 0xBC,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7332, 217, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {7358, 217, 0, 0, 0xBC,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {7384, 217, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {7410, 217, 0, 0, 0xBC,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {7436, 217, 0, 0, 0xBC,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7466, 217, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7485, 217, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7502, 7525, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7530, 217, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7555, 217, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7580, 217, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7608, 217, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7625, 217, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7676, 217, 9, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7702, 217, 11, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7728, 217, 37, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7750, 217, 37, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7781, 217, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7811, 217, 15, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7842, 217, 18, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7873, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7908, 217, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7943, 217, 22, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7978, 217, 23, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8013, 217, 24, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8048, 217, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8083, 217, 42, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8118, 217, 43, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8153, 217, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {8174, 217, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8196, 217, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8227, 217, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8246, 217, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8269, 217, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8298, 217, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8326, 217, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8352, 217, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8380, 217, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8406, 217, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8433, 217, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8460, 217, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8489, 217, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8517, 217, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8544, 217, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8580, 217, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8616, 217, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8657, 217, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8698, 217, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8739, 217, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8780, 217, 0, 0, 0xC7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8809, 217, 0, 0, 0xC7,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {8838, 217, 0, 0, 0xC7,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {8867, 217, 0, 0, 0xC7,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {8896, 217, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8914, 217, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8933, 217, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8953, 217, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8979, 217, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9005, 217, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9031, 217, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9057, 217, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9083, 217, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9101, 217, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9120, 217, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9140, 217, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9166, 217, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9192, 217, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9218, 217, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9244, 217, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9270, 217, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9291, 217, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9311, 217, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9333, 217, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9354, 217, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {9368, 217, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9395, 217, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9422, 217, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9450, 217, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9478, 217, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {9511, 217, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9545, 217, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9574, 217, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9604, 217, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9633, 217, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9663, 217, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {9692, 217, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9721, 217, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9751, 217, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9780, 217, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9809, 217, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9839, 217, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9868, 217, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9898, 217, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9937, 217, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9975, 217, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10014, 217, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10053, 217, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10094, 217, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10136, 217, 0, 0, 0xD3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10178, 217, 0, 0, 0xD3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10219, 217, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10232, 217, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10256, 217, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10269, 217, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10286, 217, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10302, 217, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10318, 217, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10335, 217, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10350, 217, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10372, 217, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10386, 217, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10400, 217, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10414, 217, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10430, 217, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {10456, 217, 0, 0, 0xF2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {10482, 217, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10509, 217, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10545, 217, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10577, 217, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10613, 217, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10639, 217, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {10676, 217, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {10709, 217, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {10746, 217, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {10783, 217, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {10816, 217, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {10853, 217, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10895, 217, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10935, 217, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10964, 217, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10991, 217, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {11027, 217, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {11059, 217, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {11095, 217, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {11121, 217, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {11158, 217, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {11191, 217, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {11228, 217, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {11265, 217, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {11298, 217, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {11335, 217, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {11377, 217, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {11417, 217, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {11446, 11470, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11475, 11470, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11502, 11470, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11516, 11529, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11537, 11553, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11558, 11553, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11579, 11553, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11600, 11553, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11621, 11553, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11642, 11553, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11662, 11553, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11682, 11553, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11702, 11553, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11718, 11553, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11734, 11553, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11750, 11553, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11766, 11553, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11782, 11553, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11798, 11553, 0, 0, 0x05,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11814, 11553, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11829, 11843, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 11553, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12270, 11553, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12291, 11553, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12311, 11553, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12327, 11553, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12350, 11553, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12372, 11553, 0, 0, 0x1B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12390, 11553, 0, 0, 0x1B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12407, 11553, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12428, 11553, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12448, 11553, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12464, 11553, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12487, 11553, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12509, 11553, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12527, 11553, 0, 0, 0x1C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12544, 11553, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12565, 11553, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12585, 11553, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12601, 11553, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12624, 11553, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12646, 11553, 0, 0, 0x1D,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12664, 11553, 0, 0, 0x1D,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12681, 11553, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12697, 11553, 0, 0, 0x1E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12713, 11553, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12730, 11553, 0, 0, 0x1E,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {12748, 11553, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12767, 11553, 0, 1, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {12792, 12810, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13016, 12810, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13038, 12810, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13056, 12810, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13078, 11553, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13098, 11553, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13118, 11553, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13138, 11553, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13164, 11553, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13180, 11553, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13200, 11553, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13216, 11553, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13232, 11553, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13252, 11553, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13270, 11553, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13289, 11553, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13317, 11553, 0, 0, 0x31,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13343, 11553, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13365, 11553, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13387, 11553, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13405, 11553, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13424, 11553, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13452, 11553, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13471, 11553, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13497, 11553, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13523, 11553, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13541, 11553, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13563, 11553, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13585, 11553, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13607, 11553, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13626, 11553, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13646, 11553, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13666, 11553, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13693, 11553, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13720, 11553, 0, 0, 0x33,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13739, 11553, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NID_MASK}
+, {13765, 11553, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13788, 11553, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13811, 11553, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13834, 11553, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK}
+, {13855, 11553, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK}
+, {13872, 11553, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK}
+, {13896, 11553, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK}
+, {13911, 11553, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_STATE_MASK}
+, {13927, 11553, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_NID_MASK}
+, {13942, 11553, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13956, 11553, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13970, 11553, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13984, 11553, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13998, 11553, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14015, 11553, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_NID_MASK}
+, {14031, 11553, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14050, 11553, 0, 0, 0x35,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14074, 11553, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14095, 11553, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14111, 11553, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14126, 11553, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14151, 11553, 0, 0, 0x35,0x23,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14181, 11553, 0, 0, 0x35,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {14199, 11553, 0, 0, 0x35,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {14222, 11553, 0, 0, 0x35,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14245, 11553, 0, 0, 0x35,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14273, 11553, 0, 0, 0x35,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {14297, 11553, 44, 1, 0x35,0x48,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_STATE_MASK}
+, {14317, 11553, 0, 0, 0x35,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {14342, 11553, 0, 0, 0x35,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {14361, 11553, 0, 0, 0x35,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14387, 11553, 0, 0, 0x35,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14418, 11553, 0, 0, 0x35,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {14437, 11553, 0, 0, 0x35,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {14461, 12810, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14482, 12810, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14508, 12810, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14531, 12810, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14549, 12810, 0, 0, 0x36,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {14572, 12810, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14589, 12810, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {14616, 12810, 0, 0, 0x36,0x23,0,0,EVENT_OPTION_NONE_MASK}
+, {14648, 12810, 0, 0, 0x36,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {14668, 12810, 0, 0, 0x36,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {14693, 12810, 0, 0, 0x36,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14718, 12810, 0, 0, 0x36,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14748, 12810, 0, 0, 0x36,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {14775, 12810, 44, 1, 0x36,0x48,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_STATE_MASK}
+, {14797, 12810, 0, 0, 0x36,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {14824, 12810, 0, 0, 0x36,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {14845, 12810, 0, 0, 0x36,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14873, 12810, 0, 0, 0x36,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14906, 12810, 0, 0, 0x36,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {14927, 12810, 0, 0, 0x36,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {14953, 11553, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14971, 11553, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14988, 11553, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15001, 11553, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15016, 11553, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15044, 11553, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15070, 11553, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15094, 11553, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15118, 11553, 0, 0, 0x3D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15143, 11553, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15167, 11553, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15191, 11553, 0, 0, 0x3E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15216, 15232, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15237, 15232, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15261, 15232, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15285, 15232, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15309, 15232, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15333, 15232, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15357, 15232, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15381, 15232, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15405, 15232, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15429, 15232, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15453, 15232, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15477, 15232, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15502, 15232, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15527, 15232, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15552, 15232, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15577, 15232, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15602, 15232, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15627, 15232, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15652, 15232, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15677, 15232, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15696, 15232, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15715, 15232, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15734, 15232, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15753, 15232, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15769, 15232, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15785, 15232, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15801, 15232, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15817, 15232, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15833, 15232, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15849, 15232, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15865, 15232, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15881, 15232, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15897, 15232, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15913, 15232, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15930, 15232, 0, 0, 0x3B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15947, 15232, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15964, 15232, 0, 0, 0x3D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15981, 15232, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15998, 15232, 0, 0, 0x3F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16015, 15232, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16032, 15232, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16049, 15232, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {16067, 15232, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {16085, 15232, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {16103, 15232, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {16121, 15232, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16151, 15232, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16170, 15232, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16192, 15232, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16213, 15232, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16233, 15232, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16262, 15232, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16293, 15232, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16324, 15232, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {16355, 15232, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16379, 15232, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16403, 15232, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16427, 15232, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16441, 15232, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16465, 15232, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16486, 15232, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16513, 15232, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16537, 15232, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16561, 15232, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16586, 15232, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16610, 15232, 45, 1, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {16635, 15232, 46, 2, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {16658, 15232, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16683, 15232, 45, 1, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {16709, 15232, 46, 2, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {16733, 15232, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16757, 15232, 45, 1, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {16782, 15232, 46, 2, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {16805, 15232, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16829, 15232, 45, 1, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {16854, 15232, 46, 2, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {16877, 15232, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16901, 15232, 45, 1, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {16926, 15232, 46, 2, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {16949, 15232, 0, 0, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16974, 15232, 45, 1, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {17000, 15232, 46, 2, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {17024, 17036, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17045, 17057, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17066, 17082, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17087, 17082, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17107, 17082, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {17126, 17082, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17146, 17082, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {17164, 17082, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {17182, 17082, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {17200, 17082, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17213, 17082, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17226, 17082, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17243, 17082, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17264, 17280, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17296, 17082, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17314, 17082, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17342, 17082, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17367, 17082, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17385, 17082, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17406, 17082, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17430, 17082, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17451, 17082, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17474, 17082, 0, 0, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {17495, 17082, 0, 0, 0x70,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17524, 17082, 0, 0, 0x70,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17544, 17082, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17569, 17082, 0, 0, 0x70,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17594, 17082, 0, 0, 0x70,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {17611, 17082, 0, 0, 0x70,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17639, 17082, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17666, 17082, 0, 0, 0x70,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {17686, 17082, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17707, 17082, 0, 0, 0x70,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {17727, 17082, 0, 0, 0x70,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17744, 17082, 0, 0, 0x70,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {17761, 17082, 0, 0, 0x71,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17787, 17082, 0, 0, 0x71,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17804, 17082, 0, 0, 0x71,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17826, 17082, 0, 0, 0x71,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17848, 17082, 0, 0, 0x71,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {17862, 17082, 0, 0, 0x71,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17887, 17082, 0, 0, 0x71,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17911, 17082, 0, 0, 0x71,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {17928, 17082, 0, 0, 0x71,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17946, 17082, 0, 0, 0x71,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {17963, 17082, 0, 0, 0x71,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {17980, 17082, 0, 0, 0x71,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17994, 17082, 0, 0, 0x71,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {18008, 17082, 0, 0, 0x72,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18046, 17082, 0, 0, 0x72,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18075, 17082, 0, 0, 0x72,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18109, 17082, 0, 0, 0x72,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18143, 17082, 0, 0, 0x72,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18169, 17082, 0, 0, 0x72,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18206, 17082, 0, 0, 0x72,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18242, 17082, 0, 0, 0x72,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18272, 17082, 0, 0, 0x72,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18298, 17082, 0, 0, 0x72,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {18324, 17082, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18353, 17082, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18382, 17082, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18411, 17082, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18440, 17082, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18469, 17082, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18498, 17082, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18515, 17082, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18525, 17082, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18541, 17082, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18560, 17082, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18582, 17082, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18607, 17082, 0, 0, 0x1A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18622, 17082, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18638, 17082, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18656, 17082, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18667, 17082, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18681, 17082, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18704, 17082, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18722, 17082, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18734, 17082, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18756, 17082, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18779, 17082, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18801, 17082, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18824, 17082, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18845, 17082, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18867, 17082, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18882, 17082, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18904, 17082, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18927, 17082, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18943, 17082, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18966, 17082, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18990, 17082, 0, 0, 0x01,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {19009, 17082, 0, 0, 0x01,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {19029, 17082, 0, 0, 0x01,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {19042, 17082, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19066, 17082, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19089, 17082, 0, 0, 0x3E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19108, 17082, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19133, 17082, 0, 0, 0x3E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19157, 17082, 0, 0, 0x3E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {19177, 17082, 0, 0, 0x3F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19201, 17082, 0, 0, 0x3F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19224, 17082, 0, 0, 0x3F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19243, 17082, 0, 0, 0x3F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19268, 17082, 0, 0, 0x3F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19292, 17082, 0, 0, 0x3F,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {19312, 17082, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19336, 17082, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19359, 17082, 0, 0, 0x40,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19378, 17082, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19403, 17082, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19427, 17082, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {19447, 17082, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19478, 17082, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19509, 17082, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19540, 17082, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19571, 17082, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19603, 17082, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19635, 17082, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19667, 17082, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19699, 17082, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19730, 17082, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19761, 17082, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19792, 17082, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19823, 17082, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19855, 17082, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19887, 17082, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19919, 17082, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19951, 17082, 0, 0, 0x68,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19976, 17082, 0, 0, 0x68,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20001, 17082, 0, 0, 0x6A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20026, 17082, 0, 0, 0x6A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20051, 17082, 0, 0, 0x69,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20076, 17082, 0, 0, 0x69,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20101, 17082, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20126, 17082, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20151, 17082, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20179, 17082, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20208, 17082, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20230, 17082, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20253, 17082, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20273, 17082, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20295, 17082, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20318, 17082, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20334, 17082, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20350, 17082, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20369, 17082, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20388, 17082, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20406, 17082, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20428, 17082, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20449, 17082, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20474, 17082, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20499, 17082, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20527, 17082, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20555, 17082, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20582, 17082, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20613, 17082, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20643, 17082, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {20669, 17082, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20697, 17082, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20725, 17082, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20753, 17082, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20781, 17082, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20805, 17082, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20829, 17082, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20853, 17082, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20877, 17082, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20901, 17082, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20925, 17082, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20949, 17082, 0, 0, 0x1B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {20973, 17082, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20997, 17082, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21021, 17082, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21046, 17082, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21071, 17082, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21094, 17082, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21118, 17082, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21142, 17082, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21167, 17082, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21189, 17082, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21219, 17082, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21250, 17082, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21281, 17082, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21313, 17082, 0, 0, 0x04,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {21340, 17082, 0, 0, 0x04,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {21368, 17082, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21400, 17082, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {21433, 17082, 0, 0, 0x04,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {21461, 17082, 0, 0, 0x04,0xA8,0,0,EVENT_OPTION_NONE_MASK}
+, {21490, 17082, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21522, 17082, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21555, 17082, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21585, 17082, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21611, 17082, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21637, 17082, 0, 0, 0x2A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21660, 17082, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21667, 17082, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21693, 17082, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21719, 17082, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21742, 17082, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21759, 17082, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21775, 17082, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21790, 17082, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21816, 17082, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21842, 17082, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21865, 17082, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21882, 17082, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21897, 17082, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21912, 21928, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21933, 21928, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21946, 21928, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21959, 21928, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21973, 21928, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21986, 21928, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21999, 21928, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22012, 21928, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22029, 21928, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22052, 21928, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22065, 21928, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22082, 21928, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22099, 21928, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22116, 21928, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22133, 21928, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {22146, 21928, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {22160, 21928, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22173, 21928, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22192, 21928, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22210, 21928, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22233, 21928, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22250, 21928, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22268, 21928, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22288, 21928, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22306, 21928, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22327, 21928, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22345, 21928, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22368, 21928, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22391, 21928, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22414, 21928, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22437, 21928, 0, 0, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22460, 21928, 0, 0, 0x83,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22483, 21928, 0, 0, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22506, 21928, 0, 0, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22529, 21928, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22560, 21928, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22581, 21928, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22600, 21928, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22628, 21928, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22656, 21928, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22684, 21928, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22712, 21928, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22740, 21928, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22768, 21928, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22796, 21928, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22824, 21928, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22849, 21928, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22874, 21928, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22894, 21928, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22915, 21928, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22928, 21928, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22941, 21928, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22955, 21928, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22971, 21928, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22987, 21928, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23004, 21928, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23022, 21928, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23041, 21928, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23060, 21928, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23079, 21928, 0, 0, 0xB0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23098, 21928, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23117, 21928, 0, 0, 0xB0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {23136, 21928, 0, 0, 0xB0,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {23155, 21928, 0, 0, 0xB0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23174, 21928, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23193, 21928, 0, 0, 0xB0,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {23212, 21928, 0, 0, 0xB0,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {23232, 21928, 0, 0, 0xB0,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {23252, 21928, 0, 0, 0xB0,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23272, 21928, 0, 0, 0xB0,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {23292, 21928, 0, 0, 0xB0,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {23312, 21928, 0, 0, 0xB0,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23332, 21928, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23354, 21928, 0, 0, 0xB0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {23374, 21928, 0, 0, 0xB0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {23394, 21928, 0, 0, 0xB0,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {23414, 21928, 0, 0, 0xB0,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {23434, 21928, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23453, 21928, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23472, 21928, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23491, 21928, 0, 0, 0xB1,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23510, 21928, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23529, 21928, 0, 0, 0xB1,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {23548, 21928, 0, 0, 0xB1,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {23567, 21928, 0, 0, 0xB1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23586, 21928, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23605, 21928, 0, 0, 0xB1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {23624, 21928, 0, 0, 0xB1,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {23644, 21928, 0, 0, 0xB1,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {23664, 21928, 0, 0, 0xB1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23684, 21928, 0, 0, 0xB1,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {23704, 21928, 0, 0, 0xB1,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {23724, 21928, 0, 0, 0xB1,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23744, 21928, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23766, 21928, 0, 0, 0xB1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {23786, 21928, 0, 0, 0xB1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {23806, 21928, 0, 0, 0xB1,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {23826, 21928, 0, 0, 0xB1,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {23846, 21928, 0, 0, 0xB2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23865, 21928, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23884, 21928, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23903, 21928, 0, 0, 0xB2,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23922, 21928, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23941, 21928, 0, 0, 0xB2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {23960, 21928, 0, 0, 0xB2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {23979, 21928, 0, 0, 0xB2,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23998, 21928, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24017, 21928, 0, 0, 0xB2,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24036, 21928, 0, 0, 0xB2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24056, 21928, 0, 0, 0xB2,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24076, 21928, 0, 0, 0xB2,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24096, 21928, 0, 0, 0xB2,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24116, 21928, 0, 0, 0xB2,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24136, 21928, 0, 0, 0xB2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24156, 21928, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24178, 21928, 0, 0, 0xB2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24198, 21928, 0, 0, 0xB2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24218, 21928, 0, 0, 0xB2,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24238, 21928, 0, 0, 0xB2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24258, 21928, 0, 0, 0xB3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24277, 21928, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24296, 21928, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24315, 21928, 0, 0, 0xB3,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24334, 21928, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24353, 21928, 0, 0, 0xB3,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24372, 21928, 0, 0, 0xB3,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24391, 21928, 0, 0, 0xB3,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24410, 21928, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24429, 21928, 0, 0, 0xB3,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24448, 21928, 0, 0, 0xB3,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24468, 21928, 0, 0, 0xB3,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24488, 21928, 0, 0, 0xB3,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24508, 21928, 0, 0, 0xB3,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24528, 21928, 0, 0, 0xB3,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24548, 21928, 0, 0, 0xB3,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24568, 21928, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24590, 21928, 0, 0, 0xB3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24610, 21928, 0, 0, 0xB3,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24630, 21928, 0, 0, 0xB3,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24650, 21928, 0, 0, 0xB3,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24670, 21928, 0, 0, 0xB4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24689, 21928, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24708, 21928, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24727, 21928, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24746, 21928, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24765, 21928, 0, 0, 0xB4,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24784, 21928, 0, 0, 0xB4,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24803, 21928, 0, 0, 0xB4,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24822, 21928, 0, 0, 0xB4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24841, 21928, 0, 0, 0xB4,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24860, 21928, 0, 0, 0xB4,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24880, 21928, 0, 0, 0xB4,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24900, 21928, 0, 0, 0xB4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24920, 21928, 0, 0, 0xB4,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24940, 21928, 0, 0, 0xB4,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24960, 21928, 0, 0, 0xB4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24980, 21928, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25002, 21928, 0, 0, 0xB4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25022, 21928, 0, 0, 0xB4,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25042, 21928, 0, 0, 0xB4,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25062, 21928, 0, 0, 0xB4,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25082, 21928, 0, 0, 0xB5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25101, 21928, 0, 0, 0xB5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25120, 21928, 0, 0, 0xB5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25139, 21928, 0, 0, 0xB5,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25158, 21928, 0, 0, 0xB5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25177, 21928, 0, 0, 0xB5,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25196, 21928, 0, 0, 0xB5,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25215, 21928, 0, 0, 0xB5,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25234, 21928, 0, 0, 0xB5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25253, 21928, 0, 0, 0xB5,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25272, 21928, 0, 0, 0xB5,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25292, 21928, 0, 0, 0xB5,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25312, 21928, 0, 0, 0xB5,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25332, 21928, 0, 0, 0xB5,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25352, 21928, 0, 0, 0xB5,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25372, 21928, 0, 0, 0xB5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25392, 21928, 0, 0, 0xB5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25414, 21928, 0, 0, 0xB5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25434, 21928, 0, 0, 0xB5,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25454, 21928, 0, 0, 0xB5,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25474, 21928, 0, 0, 0xB5,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25494, 21928, 0, 0, 0xB6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25513, 21928, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25532, 21928, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25551, 21928, 0, 0, 0xB6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25570, 21928, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25589, 21928, 0, 0, 0xB6,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25608, 21928, 0, 0, 0xB6,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25627, 21928, 0, 0, 0xB6,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25646, 21928, 0, 0, 0xB6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25665, 21928, 0, 0, 0xB6,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25684, 21928, 0, 0, 0xB6,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25704, 21928, 0, 0, 0xB6,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25724, 21928, 0, 0, 0xB6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25744, 21928, 0, 0, 0xB6,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25764, 21928, 0, 0, 0xB6,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25784, 21928, 0, 0, 0xB6,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25804, 21928, 0, 0, 0xB6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25826, 21928, 0, 0, 0xB6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25846, 21928, 0, 0, 0xB6,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25866, 21928, 0, 0, 0xB6,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25886, 21928, 0, 0, 0xB6,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25906, 21928, 0, 0, 0xB7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25925, 21928, 0, 0, 0xB7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25944, 21928, 0, 0, 0xB7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25963, 21928, 0, 0, 0xB7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25982, 21928, 0, 0, 0xB7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26001, 21928, 0, 0, 0xB7,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26020, 21928, 0, 0, 0xB7,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26039, 21928, 0, 0, 0xB7,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26058, 21928, 0, 0, 0xB7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26077, 21928, 0, 0, 0xB7,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26096, 21928, 0, 0, 0xB7,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26116, 21928, 0, 0, 0xB7,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26136, 21928, 0, 0, 0xB7,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26156, 21928, 0, 0, 0xB7,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26176, 21928, 0, 0, 0xB7,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26196, 21928, 0, 0, 0xB7,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26216, 21928, 0, 0, 0xB7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26238, 21928, 0, 0, 0xB7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26258, 21928, 0, 0, 0xB7,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26278, 21928, 0, 0, 0xB7,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26298, 21928, 0, 0, 0xB7,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26318, 21928, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26332, 21928, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26344, 21928, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26360, 21928, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26382, 21928, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26399, 21928, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26416, 21928, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26438, 21928, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26456, 21928, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26478, 21928, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26490, 21928, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26506, 21928, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26520, 21928, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26533, 21928, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26547, 21928, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26556, 21928, 0, 0, 0xB8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26575, 21928, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26594, 21928, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26613, 21928, 0, 0, 0xB8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26632, 21928, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26651, 21928, 0, 0, 0xB8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26670, 21928, 0, 0, 0xB8,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26689, 21928, 0, 0, 0xB8,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26708, 21928, 0, 0, 0xB8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26727, 21928, 0, 0, 0xB8,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26746, 21928, 0, 0, 0xB8,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26766, 21928, 0, 0, 0xB8,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26786, 21928, 0, 0, 0xB8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26806, 21928, 0, 0, 0xB8,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26826, 21928, 0, 0, 0xB8,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26846, 21928, 0, 0, 0xB8,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26866, 21928, 0, 0, 0xB8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26888, 21928, 0, 0, 0xB8,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26908, 21928, 0, 0, 0xB8,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26928, 21928, 0, 0, 0xB8,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26948, 21928, 0, 0, 0xB8,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26968, 21928, 0, 0, 0xB9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26987, 21928, 0, 0, 0xB9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27006, 21928, 0, 0, 0xB9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27025, 21928, 0, 0, 0xB9,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27044, 21928, 0, 0, 0xB9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27063, 21928, 0, 0, 0xB9,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27082, 21928, 0, 0, 0xB9,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27101, 21928, 0, 0, 0xB9,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27120, 21928, 0, 0, 0xB9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27139, 21928, 0, 0, 0xB9,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27158, 21928, 0, 0, 0xB9,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27178, 21928, 0, 0, 0xB9,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27198, 21928, 0, 0, 0xB9,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27218, 21928, 0, 0, 0xB9,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27238, 21928, 0, 0, 0xB9,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27258, 21928, 0, 0, 0xB9,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27278, 21928, 0, 0, 0xB9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27300, 21928, 0, 0, 0xB9,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27320, 21928, 0, 0, 0xB9,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27340, 21928, 0, 0, 0xB9,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27360, 21928, 0, 0, 0xB9,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27380, 21928, 0, 0, 0xBA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27399, 21928, 0, 0, 0xBA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27418, 21928, 0, 0, 0xBA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27437, 21928, 0, 0, 0xBA,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27456, 21928, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27475, 21928, 0, 0, 0xBA,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27494, 21928, 0, 0, 0xBA,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27513, 21928, 0, 0, 0xBA,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27532, 21928, 0, 0, 0xBA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27551, 21928, 0, 0, 0xBA,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27570, 21928, 0, 0, 0xBA,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27590, 21928, 0, 0, 0xBA,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27610, 21928, 0, 0, 0xBA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27630, 21928, 0, 0, 0xBA,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27650, 21928, 0, 0, 0xBA,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27670, 21928, 0, 0, 0xBA,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27690, 21928, 0, 0, 0xBA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27712, 21928, 0, 0, 0xBA,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27732, 21928, 0, 0, 0xBA,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27752, 21928, 0, 0, 0xBA,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27772, 21928, 0, 0, 0xBA,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27792, 21928, 0, 0, 0xBB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27811, 21928, 0, 0, 0xBB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27830, 21928, 0, 0, 0xBB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27849, 21928, 0, 0, 0xBB,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27868, 21928, 0, 0, 0xBB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27887, 21928, 0, 0, 0xBB,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27906, 21928, 0, 0, 0xBB,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27925, 21928, 0, 0, 0xBB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27944, 21928, 0, 0, 0xBB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27963, 21928, 0, 0, 0xBB,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27982, 21928, 0, 0, 0xBB,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28002, 21928, 0, 0, 0xBB,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28022, 21928, 0, 0, 0xBB,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28042, 21928, 0, 0, 0xBB,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28062, 21928, 0, 0, 0xBB,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28082, 21928, 0, 0, 0xBB,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28102, 21928, 0, 0, 0xBB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28124, 21928, 0, 0, 0xBB,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28144, 21928, 0, 0, 0xBB,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28164, 21928, 0, 0, 0xBB,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28184, 21928, 0, 0, 0xBB,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28204, 21928, 0, 0, 0xBC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28223, 21928, 0, 0, 0xBC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28242, 21928, 0, 0, 0xBC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28261, 21928, 0, 0, 0xBC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28280, 21928, 0, 0, 0xBC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28299, 21928, 0, 0, 0xBC,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28318, 21928, 0, 0, 0xBC,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {28337, 21928, 0, 0, 0xBC,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {28356, 21928, 0, 0, 0xBC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28375, 21928, 0, 0, 0xBC,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {28394, 21928, 0, 0, 0xBC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28414, 21928, 0, 0, 0xBC,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28434, 21928, 0, 0, 0xBC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28454, 21928, 0, 0, 0xBC,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28474, 21928, 0, 0, 0xBC,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28494, 21928, 0, 0, 0xBC,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28514, 21928, 0, 0, 0xBC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28536, 21928, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28556, 21928, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28576, 21928, 0, 0, 0xBC,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28596, 21928, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28616, 21928, 0, 0, 0xBD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28635, 21928, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28654, 21928, 0, 0, 0xBD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28673, 21928, 0, 0, 0xBD,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28692, 21928, 0, 0, 0xBD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28711, 21928, 0, 0, 0xBD,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28730, 21928, 0, 0, 0xBD,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {28749, 21928, 0, 0, 0xBD,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {28768, 21928, 0, 0, 0xBD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28787, 21928, 0, 0, 0xBD,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {28806, 21928, 0, 0, 0xBD,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28826, 21928, 0, 0, 0xBD,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28846, 21928, 0, 0, 0xBD,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28866, 21928, 0, 0, 0xBD,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28886, 21928, 0, 0, 0xBD,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28906, 21928, 0, 0, 0xBD,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28926, 21928, 0, 0, 0xBD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28948, 21928, 0, 0, 0xBD,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28968, 21928, 0, 0, 0xBD,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28988, 21928, 0, 0, 0xBD,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {29008, 21928, 0, 0, 0xBD,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {29028, 21928, 0, 0, 0xBE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29047, 21928, 0, 0, 0xBE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29066, 21928, 0, 0, 0xBE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29085, 21928, 0, 0, 0xBE,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {29104, 21928, 0, 0, 0xBE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29123, 21928, 0, 0, 0xBE,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {29142, 21928, 0, 0, 0xBE,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {29161, 21928, 0, 0, 0xBE,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {29180, 21928, 0, 0, 0xBE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29199, 21928, 0, 0, 0xBE,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29218, 21928, 0, 0, 0xBE,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {29238, 21928, 0, 0, 0xBE,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {29258, 21928, 0, 0, 0xBE,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29278, 21928, 0, 0, 0xBE,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {29298, 21928, 0, 0, 0xBE,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {29318, 21928, 0, 0, 0xBE,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29338, 21928, 0, 0, 0xBE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29360, 21928, 0, 0, 0xBE,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {29380, 21928, 0, 0, 0xBE,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {29400, 21928, 0, 0, 0xBE,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {29420, 21928, 0, 0, 0xBE,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {29440, 21928, 0, 0, 0xBF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29459, 21928, 0, 0, 0xBF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29478, 21928, 0, 0, 0xBF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29497, 21928, 0, 0, 0xBF,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {29516, 21928, 0, 0, 0xBF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29535, 21928, 0, 0, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {29554, 21928, 0, 0, 0xBF,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {29573, 21928, 0, 0, 0xBF,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {29592, 21928, 0, 0, 0xBF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29611, 21928, 0, 0, 0xBF,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29630, 21928, 0, 0, 0xBF,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {29650, 21928, 0, 0, 0xBF,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {29670, 21928, 0, 0, 0xBF,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29690, 21928, 0, 0, 0xBF,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {29710, 21928, 0, 0, 0xBF,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {29730, 21928, 0, 0, 0xBF,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29750, 21928, 0, 0, 0xBF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29772, 21928, 0, 0, 0xBF,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {29792, 21928, 0, 0, 0xBF,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {29812, 21928, 0, 0, 0xBF,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {29832, 21928, 0, 0, 0xBF,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {29852, 29868, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29873, 29893, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29905, 29893, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29925, 29893, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29947, 29893, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29969, 29868, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29997, 29868, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30024, 29868, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30047, 29868, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30076, 29868, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30104, 29868, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30128, 29868, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30147, 29868, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30166, 29868, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30194, 29868, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30221, 29868, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30244, 29868, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30273, 29868, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30301, 29868, 0, 0, 0x08,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30325, 29868, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30353, 29868, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30380, 29868, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30403, 29868, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30432, 29868, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30460, 29868, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30484, 29868, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30507, 29868, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30531, 29868, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {30555, 30573, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30617, 30573, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30635, 30573, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30651, 30573, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30667, 30685, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30691, 30685, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30717, 30685, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30743, 30685, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30769, 30685, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30793, 30685, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30817, 30685, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30841, 30856, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30893, 30856, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30908, 30856, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30923, 30856, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30938, 30856, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30953, 30856, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30968, 30856, 0, 0, 0x26,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {30980, 30856, 0, 0, 0x26,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {30992, 30856, 0, 0, 0x26,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {31004, 30856, 0, 0, 0x26,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {19951, 29893, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19976, 29893, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20669, 29893, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20697, 29893, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20725, 29893, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20753, 29893, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31017, 31043, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31048, 31043, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31077, 31043, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31099, 31043, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31116, 31043, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31133, 31043, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31150, 31043, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31170, 31043, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31194, 31043, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31214, 31043, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31235, 31043, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31250, 31043, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31265, 31043, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31285, 31043, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31305, 31043, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31329, 31043, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31345, 31043, 0, 0, 0x14,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31363, 31043, 0, 0, 0x14,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31380, 31043, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31393, 31043, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31406, 31043, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31419, 31043, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31432, 31043, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31447, 31043, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31468, 31043, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31487, 31043, 0, 0, 0x15,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31507, 31043, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31523, 31043, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31540, 31043, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31558, 31043, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31575, 31043, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31594, 31043, 0, 0, 0x17,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31613, 31043, 0, 0, 0x17,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31631, 31043, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31650, 31043, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31670, 31043, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31691, 31043, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31712, 31043, 0, 0, 0x16,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {31735, 31043, 0, 0, 0x16,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {31759, 31043, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31779, 31043, 0, 0, 0x16,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31798, 31043, 0, 0, 0x16,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31821, 31043, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31836, 31043, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31859, 31043, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31878, 31043, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31899, 31043, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31922, 31043, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31941, 31043, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31962, 31043, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31985, 31043, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32004, 31043, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32025, 31043, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32052, 31043, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32079, 31043, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32100, 31043, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32121, 31043, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32143, 32158, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32163, 32190, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32222, 32190, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32249, 32190, 0, 0, 0x1F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32277, 32190, 0, 0, 0x1F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32305, 32190, 0, 0, 0x1F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32333, 32190, 0, 0, 0x1F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32361, 32190, 0, 0, 0x1F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32392, 32190, 0, 0, 0x1F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {32423, 32190, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32450, 32190, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32477, 32190, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32504, 32190, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32531, 32190, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32558, 32190, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32585, 32190, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32612, 32190, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {32639, 32190, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32666, 32190, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32693, 32190, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32723, 32190, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32753, 32190, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32779, 32190, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32809, 32190, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32839, 32190, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32869, 32190, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32899, 32190, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32929, 32190, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32959, 32190, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32985, 32190, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33015, 32190, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33045, 32190, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33075, 32190, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33101, 32190, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33131, 32190, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33161, 32190, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33191, 32190, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33217, 32190, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33247, 32190, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33277, 32190, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33307, 32190, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33337, 32190, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33367, 32190, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33397, 32158, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33424, 32158, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33450, 32158, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33472, 32158, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33500, 32158, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33527, 32158, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {33550, 32158, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33577, 32158, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33603, 32158, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33625, 32158, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33653, 32158, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33680, 32158, 0, 0, 0x08,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {33703, 32158, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33730, 32158, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33756, 32158, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33778, 32158, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33806, 32158, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33833, 32158, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {33856, 32158, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33878, 32158, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {33901, 32158, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {33924, 32158, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33945, 32190, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33963, 32190, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33981, 32190, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33999, 32190, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34021, 32190, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34043, 32190, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34065, 32190, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34087, 32190, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34109, 32190, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34131, 32190, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34147, 32190, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34163, 32190, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34179, 32190, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34195, 32190, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34215, 32190, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34235, 32190, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34255, 32190, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34275, 32190, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34295, 32190, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34315, 34337, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34353, 34337, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34375, 34337, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34397, 34337, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34419, 34337, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34441, 34337, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34463, 32190, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {34485, 32190, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19951, 32190, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19976, 32190, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20051, 32190, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20076, 32190, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20669, 32190, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20697, 32190, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20725, 32190, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20753, 32190, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34505, 32190, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34528, 32190, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34551, 32190, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34574, 32190, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34597, 32190, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34620, 32190, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34643, 32190, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34666, 32190, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34689, 32190, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34712, 32190, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34735, 32190, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34758, 32190, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34781, 32190, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34804, 32190, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34827, 32190, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34850, 32190, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34873, 32190, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34896, 32190, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34919, 32190, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34940, 32190, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34961, 32190, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34982, 32190, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35003, 32190, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35024, 32190, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35045, 32190, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35066, 32190, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35087, 32190, 0, 0, 0x38,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35108, 32190, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35129, 32190, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35150, 32190, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35171, 32190, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35195, 32190, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 35219, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35224, 35219, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11829, 35219, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35240, 35219, 0, 0, 0x1B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35261, 35219, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35286, 35219, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35310, 35219, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35330, 35219, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35357, 35219, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35383, 35219, 0, 0, 0x1B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35405, 35219, 0, 0, 0x1C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35426, 35219, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35451, 35219, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35475, 35219, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35495, 35219, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35522, 35219, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35548, 35219, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35570, 35219, 0, 0, 0x1D,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35591, 35219, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35616, 35219, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35640, 35219, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35660, 35219, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35687, 35219, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35713, 35219, 0, 0, 0x1D,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35735, 35219, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35757, 35219, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35778, 35219, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35799, 35219, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35820, 35219, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35841, 35219, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35861, 35219, 0, 0, 0x1E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35883, 35219, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35901, 35219, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35919, 35219, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35937, 35219, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35955, 35219, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35969, 35219, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35983, 35219, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36002, 35219, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36021, 35219, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36040, 35219, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36059, 35219, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36074, 35219, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36089, 35219, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36110, 35219, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36131, 35219, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36152, 35219, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36173, 35219, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36190, 35219, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11702, 35219, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11718, 35219, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11734, 35219, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36207, 35219, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36226, 35219, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36245, 35219, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36264, 35219, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36283, 35219, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36298, 35219, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36313, 35219, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36334, 35219, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36355, 35219, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36376, 35219, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36397, 35219, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36414, 35219, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36431, 35219, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36458, 35219, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36485, 35219, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36513, 35219, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36540, 35219, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36568, 35219, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36595, 36611, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36616, 36611, 0, 0, 0x38,0x00,0x01,0x00,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MASK2_MASK|EVENT_OPTION_MASK3_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH2_MASK|EVENT_OPTION_MATCH3_MASK}
+, {36626, 36611, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36654, 36611, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36682, 36611, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36710, 36611, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36742, 36611, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36767, 36611, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36800, 36611, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36829, 36611, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {36866, 36611, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36882, 36611, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36901, 36611, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36919, 36611, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36932, 36611, 0, 0, 0x1E,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36961, 36611, 0, 0, 0x1E,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36990, 36611, 0, 0, 0x1E,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37019, 36611, 0, 0, 0x1E,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37048, 36611, 0, 0, 0x1E,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37077, 36611, 0, 0, 0x1E,0x20,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37106, 36611, 0, 0, 0x39,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37135, 36611, 0, 0, 0x39,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37164, 36611, 0, 0, 0x39,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37193, 36611, 0, 0, 0x39,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37222, 36611, 0, 0, 0x39,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37251, 36611, 0, 0, 0x39,0x20,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37280, 36611, 0, 0, 0x1D,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37305, 36611, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37319, 36611, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37337, 36611, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37355, 36611, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37377, 36611, 0, 0, 0x02,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37394, 36611, 0, 0, 0x02,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37415, 36611, 0, 0, 0x02,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37439, 36611, 0, 0, 0x02,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37456, 36611, 0, 0, 0x02,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37478, 36611, 0, 0, 0x02,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37503, 36611, 0, 0, 0x02,0x18,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37520, 36611, 0, 0, 0x03,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37540, 36611, 0, 0, 0x03,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37560, 36611, 0, 0, 0x03,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37582, 36611, 0, 0, 0x03,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37607, 36611, 0, 0, 0x03,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37624, 36611, 0, 0, 0x03,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37641, 36611, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37653, 36611, 0, 0, 0x09,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37673, 36611, 0, 0, 0x09,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37693, 36611, 0, 0, 0x0C,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37713, 36611, 0, 0, 0x0C,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37733, 36611, 0, 0, 0x0A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37753, 36611, 0, 0, 0x0A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37773, 36611, 0, 0, 0x0B,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37793, 36611, 0, 0, 0x0B,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37813, 36611, 0, 0, 0x0E,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37833, 36611, 0, 0, 0x0E,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37853, 36611, 0, 0, 0x0D,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37873, 36611, 0, 0, 0x0D,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37893, 36611, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37907, 36611, 0, 0, 0x15,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37929, 36611, 0, 0, 0x15,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37951, 36611, 0, 0, 0x18,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37973, 36611, 0, 0, 0x18,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37995, 36611, 0, 0, 0x16,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38017, 36611, 0, 0, 0x16,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38039, 36611, 0, 0, 0x17,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38061, 36611, 0, 0, 0x17,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38083, 36611, 0, 0, 0x1A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38105, 36611, 0, 0, 0x1A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38127, 36611, 0, 0, 0x19,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38149, 36611, 0, 0, 0x19,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38171, 36611, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38190, 36611, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38208, 36611, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38221, 36611, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38235, 36611, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38253, 36611, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38271, 36611, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38293, 36611, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38310, 36611, 0, 0, 0x00,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38331, 36611, 0, 0, 0x00,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38355, 36611, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38372, 36611, 0, 0, 0x00,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38394, 36611, 0, 0, 0x00,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38419, 36611, 0, 0, 0x00,0x18,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38436, 36611, 0, 0, 0x01,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38456, 36611, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38476, 36611, 0, 0, 0x01,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38498, 36611, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38523, 36611, 0, 0, 0x01,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38540, 36611, 0, 0, 0x01,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38557, 36611, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38569, 36611, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38583, 36611, 0, 0, 0x26,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38614, 36611, 0, 0, 0x26,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38645, 36611, 0, 0, 0x22,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38677, 36611, 0, 0, 0x22,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38709, 36611, 0, 0, 0x28,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38740, 36611, 0, 0, 0x28,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38771, 36611, 0, 0, 0x24,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38803, 36611, 0, 0, 0x24,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38835, 36611, 0, 0, 0x27,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38866, 36611, 0, 0, 0x27,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38897, 36611, 0, 0, 0x23,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38929, 36611, 0, 0, 0x23,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38961, 36611, 0, 0, 0x29,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38988, 36611, 0, 0, 0x25,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39016, 36611, 0, 0, 0x2A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39047, 36611, 0, 0, 0x2A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39078, 36611, 0, 0, 0x2A,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39112, 36611, 0, 0, 0x1F,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39144, 36611, 0, 0, 0x1F,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39176, 36611, 0, 0, 0x1F,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39211, 36611, 0, 0, 0x2B,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39242, 36611, 0, 0, 0x2B,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39273, 36611, 0, 0, 0x20,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39305, 36611, 0, 0, 0x20,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39337, 36611, 0, 0, 0x2C,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39368, 36611, 0, 0, 0x2C,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39399, 36611, 0, 0, 0x21,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39431, 36611, 0, 0, 0x21,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39463, 36611, 0, 0, 0x1C,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39482, 36611, 0, 0, 0x1B,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39510, 39519, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39549, 39561, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39591, 39602, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable broadwellEP_arch_events = {
+    NUM_ARCH_EVENTS_BROADWELLEP,
+    broadwellEP_arch_event_strings,
+    broadwellEP_arch_event_options,
+    broadwellEP_arch_event_entries
+};
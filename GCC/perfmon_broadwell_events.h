@@ -0,0 +1,1007 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_BROADWELL 462
+
+static const char broadwell_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_RAT_STALL_CYCLES\0"
+    "INT_MISC_RAT_STALL_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_6_UOPS_EXEC\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_FPU_DIV_COUNT\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_L2_PF_HIT\0"
+    "L2_RQSTS_L2_PF_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DEMAND_RQST_WB_HIT\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC2\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_OCCURRENCES\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_STLB_HIT_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "CPL_CYCLES_RING0_TRANS\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_STLB_HIT_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ILD_STALL_LCP\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_ALL_CONDITIONAL\0"
+    "BR_INST_EXEC_ALL_DIRECT_JMP\0"
+    "BR_INST_EXEC_ALL_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_INST_EXEC_ALL_INDIRECT_NEAR_RETURN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_ALL_CONDITIONAL\0"
+    "BR_MISP_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOP_DISPATCHES_CANCELLED_SIMD_PRF\0"
+    "UOPS_EXECUTED_PORT_PORT_0\0"
+    "UOPS_EXECUTED_PORT_PORT_1\0"
+    "UOPS_EXECUTED_PORT_PORT_2\0"
+    "UOPS_EXECUTED_PORT_PORT_3\0"
+    "UOPS_EXECUTED_PORT_PORT_4\0"
+    "UOPS_EXECUTED_PORT_PORT_5\0"
+    "UOPS_EXECUTED_PORT_PORT_6\0"
+    "UOPS_EXECUTED_PORT_PORT_7\0"
+    "UOPS_EXECUTED_PORT_PORT_0_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_1_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_2_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_3_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_4_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_5_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_6_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_7_CORE\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "PAGE_WALKER_LOADS_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_DTLB_MEMORY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "PMC1\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "OTHER_ASSISTS_ANY_WB_ASSIST\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR\0"
+    "FP_ARITH_INST_RETIRED_PACKED\0"
+    "FP_ARITH_INST_RETIRED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SINGLE\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MISC1\0"
+    "HLE_RETIRED_ABORTED_MISC2\0"
+    "HLE_RETIRED_ABORTED_MISC3\0"
+    "HLE_RETIRED_ABORTED_MISC4\0"
+    "HLE_RETIRED_ABORTED_MISC5\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MISC1\0"
+    "RTM_RETIRED_ABORTED_MISC2\0"
+    "RTM_RETIRED_ABORTED_MISC3\0"
+    "RTM_RETIRED_ABORTED_MISC4\0"
+    "RTM_RETIRED_ABORTED_MISC5\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS_ALL\0"
+    "MEM_UOPS_RETIRED_STORES_ALL\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CACHE_LOOKUP_M\0"
+    "CBOX\0"
+    "CACHE_LOOKUP_E\0"
+    "CACHE_LOOKUP_S\0"
+    "CACHE_LOOKUP_I\0"
+    "CACHE_LOOKUP_READ_FILTER\0"
+    "CACHE_LOOKUP_WRITE_FILTER\0"
+    "CACHE_LOOKUP_EXTSNP_FILTER\0"
+    "CACHE_LOOKUP_ANY_REQUEST_FILTER\0"
+    "CACHE_LOOKUP_READ_M\0"
+    "CACHE_LOOKUP_WRITE_M\0"
+    "CACHE_LOOKUP_EXTSNP_M\0"
+    "CACHE_LOOKUP_ANY_M\0"
+    "CACHE_LOOKUP_READ_E\0"
+    "CACHE_LOOKUP_WRITE_E\0"
+    "CACHE_LOOKUP_EXTSNP_E\0"
+    "CACHE_LOOKUP_ANY_E\0"
+    "CACHE_LOOKUP_READ_S\0"
+    "CACHE_LOOKUP_WRITE_S\0"
+    "CACHE_LOOKUP_EXTSNP_S\0"
+    "CACHE_LOOKUP_ANY_S\0"
+    "CACHE_LOOKUP_READ_ES\0"
+    "CACHE_LOOKUP_WRITE_ES\0"
+    "CACHE_LOOKUP_EXTSNP_ES\0"
+    "CACHE_LOOKUP_ANY_ES\0"
+    "CACHE_LOOKUP_READ_I\0"
+    "CACHE_LOOKUP_WRITE_I\0"
+    "CACHE_LOOKUP_EXTSNP_I\0"
+    "CACHE_LOOKUP_ANY_I\0"
+    "CACHE_LOOKUP_READ_MESI\0"
+    "CACHE_LOOKUP_WRITE_MESI\0"
+    "CACHE_LOOKUP_EXTSNP_MESI\0"
+    "CACHE_LOOKUP_ANY_MESI\0"
+    "XSNP_RESPONSE_MISS_EXTERNAL\0"
+    "XSNP_RESPONSE_MISS_XCORE\0"
+    "XSNP_RESPONSE_MISS_EVICTION\0"
+    "XSNP_RESPONSE_HIT_EXTERNAL\0"
+    "XSNP_RESPONSE_HIT_XCORE\0"
+    "XSNP_RESPONSE_HIT_EVICTION\0"
+    "XSNP_RESPONSE_HITM_EXTERNAL\0"
+    "XSNP_RESPONSE_HITM_XCORE\0"
+    "XSNP_RESPONSE_HITM_EVICTION\0"
+    "TRK_OCCUPANCY_ALL\0"
+    "UBOX0\0"
+    "TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_WRITES\0"
+    "COH_TRK_OCCUPANCY\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0"
+    "PP0_TEMP\0"
+    "MBOX0TMP0\0"
+    "PP1_TEMP\0"
+    "MBOX0TMP1\0";
+
+static const PerfmonEventOption broadwell_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x03}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x08}
+, {EVENT_OPTION_THRESHOLD,0x0C}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+};
+
+static const PerfmonEventEntry broadwell_arch_event_entries[NUM_ARCH_EVENTS_BROADWELL] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 217, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {221, 217, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {237, 217, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {260, 217, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {284, 217, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 217, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {337, 217, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 217, 0, 0, 0x08,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {394, 217, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {426, 217, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {455, 217, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 217, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {521, 217, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {546, 217, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {570, 217, 3, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {599, 217, 5, 3, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {627, 217, 0, 1, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {653, 217, 1, 2, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {678, 217, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {694, 217, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {718, 217, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {739, 217, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {762, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {786, 217, 9, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {811, 217, 11, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {836, 217, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {865, 217, 15, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {895, 217, 18, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {925, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {959, 217, 21, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {993, 217, 22, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1027, 217, 23, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1061, 217, 24, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1095, 217, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1129, 217, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1150, 217, 26, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1170, 217, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1199, 217, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1227, 217, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1245, 217, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1262, 217, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 217, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1305, 217, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1324, 217, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1344, 217, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1372, 217, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1397, 217, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1414, 217, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1435, 217, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1466, 217, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 217, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1496, 217, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 217, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 217, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1566, 217, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1589, 217, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1617, 217, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1645, 217, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1682, 1704, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1709, 1704, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1738, 1704, 1, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1764, 217, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1796, 217, 0, 0, 0x49,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1823, 217, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1856, 217, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1886, 217, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1922, 217, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1954, 217, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1973, 217, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1989, 217, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2005, 217, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2027, 217, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2055, 217, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2093, 217, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2135, 217, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2176, 217, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2230, 217, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2261, 217, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2297, 217, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2334, 217, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2366, 217, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2399, 217, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2416, 217, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2435, 217, 28, 2, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2458, 217, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2472, 217, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2486, 217, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2500, 217, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2514, 217, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2528, 217, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2551, 217, 0, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2595, 217, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2639, 217, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2679, 217, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2720, 217, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2760, 217, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2792, 217, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2802, 217, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2816, 217, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2829, 217, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2845, 217, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2862, 217, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2874, 217, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2891, 217, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2909, 217, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2922, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2938, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2961, 217, 21, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2984, 217, 22, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3007, 217, 23, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3030, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3045, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3067, 217, 21, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3089, 217, 22, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3111, 217, 23, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3133, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3151, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3176, 217, 21, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3201, 217, 22, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3226, 217, 23, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3251, 217, 30, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3268, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3287, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3313, 217, 21, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3339, 217, 22, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3365, 217, 23, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3391, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3405, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3426, 217, 21, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3447, 217, 22, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3468, 217, 23, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3489, 217, 30, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3505, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3533, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3559, 217, 21, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3585, 217, 22, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3611, 217, 23, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3637, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3666, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3693, 217, 21, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3720, 217, 22, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3747, 217, 23, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3774, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3798, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3820, 217, 21, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3842, 217, 22, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3864, 217, 23, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3886, 217, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3897, 217, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3911, 217, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3927, 217, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3953, 217, 0, 0, 0x85,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {3974, 217, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4001, 217, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4025, 217, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4055, 217, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4081, 217, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4095, 217, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4119, 217, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4147, 217, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {4177, 217, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4222, 217, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4253, 217, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4289, 217, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4327, 217, 0, 0, 0x88,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4356, 217, 0, 0, 0x88,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4384, 217, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4418, 217, 0, 0, 0x88,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4462, 217, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4500, 217, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4526, 217, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4550, 217, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4578, 217, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4623, 217, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4654, 217, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4690, 217, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4728, 217, 0, 0, 0x89,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4757, 217, 0, 0, 0x89,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4801, 217, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4827, 217, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4855, 217, 32, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4903, 217, 33, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4953, 217, 34, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5003, 217, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5053, 217, 35, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5093, 217, 0, 0, 0xA0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5127, 217, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5153, 217, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5179, 217, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5205, 217, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5231, 217, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5257, 217, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5283, 217, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5309, 217, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5335, 217, 37, 1, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5366, 217, 37, 1, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5397, 217, 37, 1, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5428, 217, 37, 1, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5459, 217, 37, 1, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5490, 217, 37, 1, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5521, 217, 37, 1, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5552, 217, 37, 1, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5583, 217, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5603, 217, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5622, 217, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5641, 217, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5661, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5692, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5726, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5756, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5789, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5819, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5853, 217, 32, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5886, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5917, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5951, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5981, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6014, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6044, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6078, 217, 32, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6106, 217, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6115, 217, 8, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6133, 217, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6151, 217, 22, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6169, 217, 23, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6187, 217, 0, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6210, 217, 9, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6235, 217, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6268, 217, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6284, 217, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6316, 217, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6348, 217, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6376, 217, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6405, 217, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6426, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6452, 217, 9, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6479, 217, 11, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6506, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6542, 217, 21, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6578, 217, 22, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6614, 217, 23, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6650, 217, 24, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6686, 217, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6722, 217, 42, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6758, 217, 43, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6794, 217, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6813, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6844, 217, 9, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6876, 217, 11, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6908, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6949, 217, 21, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6990, 217, 22, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7031, 217, 23, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7072, 217, 24, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7113, 217, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7154, 217, 42, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7195, 217, 43, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7236, 217, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7268, 217, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7294, 217, 0, 0, 0xBC,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7320, 217, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {7346, 217, 0, 0, 0xBC,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {7372, 217, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {7398, 217, 0, 0, 0xBC,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {7424, 217, 0, 0, 0xBC,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7454, 217, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7473, 217, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7490, 7513, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7518, 217, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7543, 217, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7568, 217, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7596, 217, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7613, 217, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7639, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7664, 217, 9, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7690, 217, 11, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7716, 217, 37, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7738, 217, 37, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7769, 217, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7799, 217, 15, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7830, 217, 18, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7861, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7896, 217, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7931, 217, 22, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7966, 217, 23, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8001, 217, 24, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8036, 217, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8071, 217, 42, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8106, 217, 43, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8141, 217, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {8162, 217, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8184, 217, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8215, 217, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8234, 217, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8257, 217, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8286, 217, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8314, 217, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8340, 217, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8368, 217, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8394, 217, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8421, 217, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8448, 217, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8477, 217, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8505, 217, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8532, 217, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8568, 217, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8604, 217, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8645, 217, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8686, 217, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8727, 217, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8768, 217, 0, 0, 0xC7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8797, 217, 0, 0, 0xC7,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {8826, 217, 0, 0, 0xC7,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {8855, 217, 0, 0, 0xC7,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {8884, 217, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8902, 217, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8921, 217, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8941, 217, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8967, 217, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8993, 217, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9019, 217, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9045, 217, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9071, 217, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9089, 217, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9108, 217, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9128, 217, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9154, 217, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9180, 217, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9206, 217, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9232, 217, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9258, 217, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9279, 217, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9299, 217, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9321, 217, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9342, 217, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {9356, 217, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9383, 217, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9410, 217, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9438, 217, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9466, 217, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {9499, 217, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9533, 217, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9562, 217, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9592, 217, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9621, 217, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9651, 217, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {9680, 217, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9709, 217, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9739, 217, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9768, 217, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9797, 217, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9827, 217, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9856, 217, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9886, 217, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9925, 217, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9963, 217, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10002, 217, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10041, 217, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10082, 217, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10095, 217, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10119, 217, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10132, 217, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10149, 217, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10165, 217, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10181, 217, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10198, 217, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10213, 217, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10235, 217, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10249, 217, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10263, 217, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10277, 217, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10293, 217, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {10319, 217, 0, 0, 0xF2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {10345, 217, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10372, 217, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10408, 217, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10440, 217, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10476, 217, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10502, 217, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {10539, 217, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {10572, 217, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {10609, 217, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {10646, 217, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {10679, 217, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {10716, 217, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10758, 217, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10798, 217, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10827, 217, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10854, 217, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10890, 217, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10922, 217, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10958, 217, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10984, 217, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {11021, 217, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {11054, 217, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {11091, 217, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {11128, 217, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {11161, 217, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {11198, 217, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {11240, 217, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {11280, 217, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {11309, 11324, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11329, 11324, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11344, 11324, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11359, 11324, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11374, 11324, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11399, 11324, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11425, 11324, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11452, 11324, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11484, 11324, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {11504, 11324, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {11525, 11324, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {11547, 11324, 0, 0, 0x34,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {11566, 11324, 0, 0, 0x34,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {11586, 11324, 0, 0, 0x34,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {11607, 11324, 0, 0, 0x34,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {11629, 11324, 0, 0, 0x34,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {11648, 11324, 0, 0, 0x34,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {11668, 11324, 0, 0, 0x34,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11689, 11324, 0, 0, 0x34,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11711, 11324, 0, 0, 0x34,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11730, 11324, 0, 0, 0x34,0x16,0,0,EVENT_OPTION_NONE_MASK}
+, {11751, 11324, 0, 0, 0x34,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {11773, 11324, 0, 0, 0x34,0x46,0,0,EVENT_OPTION_NONE_MASK}
+, {11796, 11324, 0, 0, 0x34,0x86,0,0,EVENT_OPTION_NONE_MASK}
+, {11816, 11324, 0, 0, 0x34,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {11836, 11324, 0, 0, 0x34,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {11857, 11324, 0, 0, 0x34,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11879, 11324, 0, 0, 0x34,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11898, 11324, 0, 0, 0x34,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11921, 11324, 0, 0, 0x34,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {11945, 11324, 0, 0, 0x34,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {11970, 11324, 0, 0, 0x34,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {11992, 11324, 0, 0, 0x22,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12020, 11324, 0, 0, 0x22,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12045, 11324, 0, 0, 0x22,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12073, 11324, 0, 0, 0x22,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12100, 11324, 0, 0, 0x22,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12124, 11324, 0, 0, 0x22,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12151, 11324, 0, 0, 0x22,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {12179, 11324, 0, 0, 0x22,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {12204, 11324, 0, 0, 0x22,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {12232, 12250, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12256, 12273, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12278, 12273, 0, 0, 0x81,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12298, 12250, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12316, 12273, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12337, 12350, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12358, 12370, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12378, 12389, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12397, 12409, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12417, 12426, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12436, 12445, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable broadwell_arch_events = {
+    NUM_ARCH_EVENTS_BROADWELL,
+    broadwell_arch_event_strings,
+    broadwell_arch_event_options,
+    broadwell_arch_event_entries
+};
@@ -0,0 +1,2732 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_BROADWELLD 1320
+
+static const char broadwelld_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_RAT_STALL_CYCLES\0"
+    "INT_MISC_RAT_STALL_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_6_UOPS_EXEC\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_FPU_DIV_COUNT\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_L2_PF_HIT\0"
+    "L2_RQSTS_L2_PF_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DEMAND_RQST_WB_HIT\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC2\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_OCCURRENCES\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_STLB_HIT_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_M_EVICT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "CPL_CYCLES_RING0_TRANS\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_STLB_HIT_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ILD_STALL_LCP\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_ALL_CONDITIONAL\0"
+    "BR_INST_EXEC_ALL_DIRECT_JMP\0"
+    "BR_INST_EXEC_ALL_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_INST_EXEC_ALL_INDIRECT_NEAR_RETURN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_ALL_CONDITIONAL\0"
+    "BR_MISP_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOP_DISPATCHES_CANCELLED_SIMD_PRF\0"
+    "UOPS_EXECUTED_PORT_PORT_0\0"
+    "UOPS_EXECUTED_PORT_PORT_1\0"
+    "UOPS_EXECUTED_PORT_PORT_2\0"
+    "UOPS_EXECUTED_PORT_PORT_3\0"
+    "UOPS_EXECUTED_PORT_PORT_4\0"
+    "UOPS_EXECUTED_PORT_PORT_5\0"
+    "UOPS_EXECUTED_PORT_PORT_6\0"
+    "UOPS_EXECUTED_PORT_PORT_7\0"
+    "UOPS_EXECUTED_PORT_PORT_0_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_1_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_2_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_3_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_4_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_5_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_6_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_7_CORE\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "PAGE_WALKER_LOADS_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_DTLB_MEMORY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "PMC1\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "OTHER_ASSISTS_ANY_WB_ASSIST\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR\0"
+    "FP_ARITH_INST_RETIRED_PACKED\0"
+    "FP_ARITH_INST_RETIRED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SINGLE\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MISC1\0"
+    "HLE_RETIRED_ABORTED_MISC2\0"
+    "HLE_RETIRED_ABORTED_MISC3\0"
+    "HLE_RETIRED_ABORTED_MISC4\0"
+    "HLE_RETIRED_ABORTED_MISC5\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MISC1\0"
+    "RTM_RETIRED_ABORTED_MISC2\0"
+    "RTM_RETIRED_ABORTED_MISC3\0"
+    "RTM_RETIRED_ABORTED_MISC4\0"
+    "RTM_RETIRED_ABORTED_MISC5\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS_ALL\0"
+    "MEM_UOPS_RETIRED_STORES_ALL\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "UBOX\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_REQUESTS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "TXR_INSERTS_AD_CACHE\0"
+    "TXR_INSERTS_AK_CACHE\0"
+    "TXR_INSERTS_BL_CACHE\0"
+    "TXR_INSERTS_IV_CACHE\0"
+    "TXR_INSERTS_AD_CORE\0"
+    "TXR_INSERTS_AK_CORE\0"
+    "TXR_INSERTS_BL_CORE\0"
+    "TXR_ADS_USED_AD\0"
+    "TXR_ADS_USED_AK\0"
+    "TXR_ADS_USED_BL\0"
+    "RING_BOUNCES_AD\0"
+    "RING_BOUNCES_AK\0"
+    "RING_BOUNCES_BL\0"
+    "RING_BOUNCES_IV\0"
+    "RING_SRC_THRTL\0"
+    "FAST_ASSERTED\0"
+    "CBOX0C0|CBOX0C1|CBOX1C0|CBOX1C1|CBOX2C0|CBOX2C1|CBOX3C0|CBOX3C1|CBOX4C0|CBOX4C1|CBOX5C0|CBOX5C1|CBOX6C0|CBOX6C1|CBOX7C0|CBOX7C1|CBOX8C0|CBOX8C1|CBOX9C0|CBOX9C1|CBOX10C0|CBOX10C1|CBOX11C0|CBOX11C1|CBOX12C0|CBOX12C1|CBOX13C0|CBOX13C1|CBOX14C0|CBOX14C1|CBOX15C0|CBOX15C1\0"
+    "BOUNCE_CONTROL\0"
+    "RING_AD_USED_UP_EVEN\0"
+    "RING_AD_USED_UP_ODD\0"
+    "RING_AD_USED_UP\0"
+    "RING_AD_USED_DOWN_EVEN\0"
+    "RING_AD_USED_DOWN_ODD\0"
+    "RING_AD_USED_DOWN\0"
+    "RING_AD_USED_ANY\0"
+    "RING_AK_USED_UP_EVEN\0"
+    "RING_AK_USED_UP_ODD\0"
+    "RING_AK_USED_UP\0"
+    "RING_AK_USED_DOWN_EVEN\0"
+    "RING_AK_USED_DOWN_ODD\0"
+    "RING_AK_USED_DOWN\0"
+    "RING_AK_USED_ANY\0"
+    "RING_BL_USED_UP_EVEN\0"
+    "RING_BL_USED_UP_ODD\0"
+    "RING_BL_USED_UP\0"
+    "RING_BL_USED_DOWN_EVEN\0"
+    "RING_BL_USED_DOWN_ODD\0"
+    "RING_BL_USED_DOWN\0"
+    "RING_BL_USED_ANY\0"
+    "RING_IV_USED_UP\0"
+    "RING_IV_USED_DN\0"
+    "RING_IV_USED_ANY\0"
+    "COUNTER0_OCCUPANCY\0"
+    "RXR_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0\0"
+    "RXR_OCCUPANCY_IRQ_REJ\0"
+    "RXR_OCCUPANCY_IPQ\0"
+    "RXR_OCCUPANCY_PRQ_REJ\0"
+    "RXR_EXT_STARVED_IRQ\0"
+    "RXR_EXT_STARVED_IPQ\0"
+    "RXR_EXT_STARVED_PRQ\0"
+    "RXR_EXT_STARVED_ISMQ_BIDS\0"
+    "RXR_INSERTS_IRQ\0"
+    "RXR_INSERTS_IRQ_REJ\0"
+    "RXR_INSERTS_IPQ\0"
+    "RXR_INSERTS_PRQ\0"
+    "RXR_INSERTS_PRQ_REJ\0"
+    "RXR_IPQ_RETRY_ANY\0"
+    "RXR_IPQ_RETRY_FULL\0"
+    "RXR_IPQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IPQ_RETRY_QPI_CREDITS\0"
+    "RXR_IPQ_RETRY2_AD_SBO\0"
+    "RXR_IPQ_RETRY2_TARGET\0"
+    "RXR_IRQ_RETRY_ANY\0"
+    "RXR_IRQ_RETRY_FULL\0"
+    "RXR_IRQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IRQ_RETRY_RTID\0"
+    "RXR_IRQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_IIO_CREDITS\0"
+    "RXR_IRQ_RETRY_NID\0"
+    "RXR_IRQ_RETRY2_AD_SBO\0"
+    "RXR_IRQ_RETRY2_BL_SBO\0"
+    "RXR_IRQ_RETRY2_TARGET\0"
+    "RXR_ISMQ_RETRY_ANY\0"
+    "RXR_ISMQ_RETRY_FULL\0"
+    "RXR_ISMQ_RETRY_RTID\0"
+    "RXR_ISMQ_RETRY_QPI_CREDITS\0"
+    "RXR_ISMQ_RETRY_IIO_CREDITS\0"
+    "RXR_ISMQ_RETRY_NID\0"
+    "RXR_ISMQ_RETRY_WB_CREDITS\0"
+    "RXR_ISMQ_RETRY2_AD_SBO\0"
+    "RXR_ISMQ_RETRY2_BL_SBO\0"
+    "RXR_ISMQ_RETRY2_TARGET\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_READ\0"
+    "LLC_LOOKUP_NID\0"
+    "LLC_VICTIMS_M\0"
+    "LLC_VICTIMS_E\0"
+    "LLC_VICTIMS_S\0"
+    "LLC_VICTIMS_F\0"
+    "LLC_VICTIMS_MISS\0"
+    "LLC_VICTIMS_NID\0"
+    "TOR_INSERTS_OPCODE\0"
+    "TOR_INSERTS_MISS_OPCODE\0"
+    "TOR_INSERTS_EVICTION\0"
+    "TOR_INSERTS_ALL\0"
+    "TOR_INSERTS_WB\0"
+    "TOR_INSERTS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_MISS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_LOCAL\0"
+    "TOR_INSERTS_MISS_LOCAL\0"
+    "TOR_INSERTS_NID_OPCODE\0"
+    "TOR_INSERTS_NID_MISS_OPCODE\0"
+    "TOR_INSERTS_NID_EVICION\0"
+    "TOR_INSERTS_NID_ALL\0"
+    "TOR_INSERTS_NID_MISS_ALL\0"
+    "TOR_INSERTS_NID_WB\0"
+    "TOR_INSERTS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_MISS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_REMOTE\0"
+    "TOR_INSERTS_MISS_REMOTE\0"
+    "TOR_OCCUPANCY_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_EVICTION\0"
+    "TOR_OCCUPANCY_ALL\0"
+    "TOR_OCCUPANCY_MISS_ALL\0"
+    "TOR_OCCUPANCY_WB\0"
+    "TOR_OCCUPANCY_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_LOCAL\0"
+    "TOR_OCCUPANCY_MISS_LOCAL\0"
+    "TOR_OCCUPANCY_NID_OPCODE\0"
+    "TOR_OCCUPANCY_NID_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_NID_EVICTION\0"
+    "TOR_OCCUPANCY_NID_ALL\0"
+    "TOR_OCCUPANCY_NID_MISS_ALL\0"
+    "TOR_OCCUPANCY_NID_WB\0"
+    "TOR_OCCUPANCY_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_REMOTE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_STARTED\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CVZERO_PREFETCH_VICTIM\0"
+    "MISC_CVZERO_PREFETCH_MISS\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE0_TRANSITION_CYCLES\0"
+    "CORE1_TRANSITION_CYCLES\0"
+    "CORE2_TRANSITION_CYCLES\0"
+    "CORE3_TRANSITION_CYCLES\0"
+    "CORE4_TRANSITION_CYCLES\0"
+    "CORE5_TRANSITION_CYCLES\0"
+    "CORE6_TRANSITION_CYCLES\0"
+    "CORE7_TRANSITION_CYCLES\0"
+    "CORE8_TRANSITION_CYCLES\0"
+    "CORE9_TRANSITION_CYCLES\0"
+    "CORE10_TRANSITION_CYCLES\0"
+    "CORE11_TRANSITION_CYCLES\0"
+    "CORE12_TRANSITION_CYCLES\0"
+    "CORE13_TRANSITION_CYCLES\0"
+    "CORE14_TRANSITION_CYCLES\0"
+    "CORE15_TRANSITION_CYCLES\0"
+    "CORE16_TRANSITION_CYCLES\0"
+    "CORE17_TRANSITION_CYCLES\0"
+    "FIVR_PS_PS0_CYCLES\0"
+    "FIVR_PS_PS1_CYCLES\0"
+    "FIVR_PS_PS2_CYCLES\0"
+    "FIVR_PS_PS3_CYCLES\0"
+    "DEMOTIONS_CORE0\0"
+    "DEMOTIONS_CORE1\0"
+    "DEMOTIONS_CORE2\0"
+    "DEMOTIONS_CORE3\0"
+    "DEMOTIONS_CORE4\0"
+    "DEMOTIONS_CORE5\0"
+    "DEMOTIONS_CORE6\0"
+    "DEMOTIONS_CORE7\0"
+    "DEMOTIONS_CORE8\0"
+    "DEMOTIONS_CORE9\0"
+    "DEMOTIONS_CORE10\0"
+    "DEMOTIONS_CORE11\0"
+    "DEMOTIONS_CORE12\0"
+    "DEMOTIONS_CORE13\0"
+    "DEMOTIONS_CORE14\0"
+    "DEMOTIONS_CORE15\0"
+    "DEMOTIONS_CORE16\0"
+    "DEMOTIONS_CORE17\0"
+    "FREQ_BAND0_CYCLES\0"
+    "FREQ_BAND1_CYCLES\0"
+    "FREQ_BAND2_CYCLES\0"
+    "FREQ_BAND3_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_OS_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VR_HOT_CYCLES\0"
+    "UFS_BANDWIDTH_MAX_RANGE\0"
+    "UFS_TRANSITIONS_DOWN\0"
+    "UFS_TRANSITIONS_IO_P_LIMIT\0"
+    "UFS_TRANSITIONS_NO_CHANGE\0"
+    "UFS_TRANSITIONS_UP_RING\0"
+    "UFS_TRANSITIONS_UP_STALL\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "BBOX_CLOCKTICKS\0"
+    "BBOX\0"
+    "ADDR_OPC_MATCH_ADDR\0"
+    "ADDR_OPC_MATCH_OPC\0"
+    "ADDR_OPC_MATCH_FILT\0"
+    "ADDR_OPC_MATCH_AD\0"
+    "ADDR_OPC_MATCH_BL\0"
+    "ADDR_OPC_MATCH_AK\0"
+    "BT_CYCLES_NE\0"
+    "BT_OCCUPANCY\0"
+    "BYPASS_IMC_TAKEN\0"
+    "BYPASS_IMC_NOT_TAKEN\0"
+    "CONFLICT_CYCLES\0"
+    "BBOX0C1|BBOX1C1\0"
+    "DIRECT2CORE_COUNT\0"
+    "DIRECT2CORE_CYCLES_DISABLED\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECTORY_LAT_OPT\0"
+    "DIRECTORY_LOOKUP_SNP\0"
+    "DIRECTORY_LOOKUP_NO_SNP\0"
+    "DIRECTORY_UPDATE_SET\0"
+    "DIRECTORY_UPDATE_CLEAR\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "HITME_LOOKUP_READ_OR_INVITOE\0"
+    "HITME_LOOKUP_WBMTOI\0"
+    "HITME_LOOKUP_ACKCNFLTWBI\0"
+    "HITME_LOOKUP_WBMTOE_OR_S\0"
+    "HITME_LOOKUP_HOM\0"
+    "HITME_LOOKUP_RSPFWDI_REMOTE\0"
+    "HITME_LOOKUP_RSPFWDI_LOCAL\0"
+    "HITME_LOOKUP_INVALS\0"
+    "HITME_LOOKUP_RSPFWDS\0"
+    "HITME_LOOKUP_ALLOCS\0"
+    "HITME_LOOKUP_RSP\0"
+    "HITME_LOOKUP_ALL\0"
+    "HITME_HIT_READ_OR_INVITOE\0"
+    "HITME_HIT_WBMTOI\0"
+    "HITME_HIT_ACKCNFLTWBI\0"
+    "HITME_HIT_WBMTOE_OR_S\0"
+    "HITME_HIT_HOM\0"
+    "HITME_HIT_RSPFWDI_REMOTE\0"
+    "HITME_HIT_RSPFWDI_LOCAL\0"
+    "HITME_HIT_INVALS\0"
+    "HITME_HIT_RSPFWDS\0"
+    "HITME_HIT_EVICTS\0"
+    "HITME_HIT_ALLOCS\0"
+    "HITME_HIT_RSP\0"
+    "HITME_HIT_ALL\0"
+    "HITME_HIT_PV_BITS_SET_READ_OR_INVITOE\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOI\0"
+    "HITME_HIT_PV_BITS_SET_ACKCNFLTWBI\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOE_OR_S\0"
+    "HITME_HIT_PV_BITS_SET_HOM\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_REMOTE\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_LOCAL\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDS\0"
+    "HITME_HIT_PV_BITS_SET_RSP\0"
+    "HITME_HIT_PV_BITS_SET_ALL\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI2\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI2\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_RETRY\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "OSB_READS_LOCAL\0"
+    "OSB_INVITOE_LOCAL\0"
+    "OSB_REMOTE\0"
+    "OSB_CANCELLED\0"
+    "OSB_READS_LOCAL_USEFUL\0"
+    "OSB_REMOTE_USEFUL\0"
+    "OSB_EDR_ALL\0"
+    "OSB_EDR_READS_LOCAL_I\0"
+    "OSB_EDR_READS_REMOTE_I\0"
+    "OSB_EDR_READS_LOCAL_S\0"
+    "OSB_EDR_READS_REMOTE_S\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "HA_RING_AD_USED_CW_EVEN\0"
+    "HA_RING_AD_USED_CW_ODD\0"
+    "HA_RING_AD_USED_CW\0"
+    "HA_RING_AD_USED_CCW_EVEN\0"
+    "HA_RING_AD_USED_CCW_ODD\0"
+    "HA_RING_AD_USED_CCW\0"
+    "HA_RING_AK_USED_CW_EVEN\0"
+    "HA_RING_AK_USED_CW_ODD\0"
+    "HA_RING_AK_USED_CW\0"
+    "HA_RING_AK_USED_CCW_EVEN\0"
+    "HA_RING_AK_USED_CCW_ODD\0"
+    "HA_RING_AK_USED_CCW\0"
+    "HA_RING_BL_USED_CW_EVEN\0"
+    "HA_RING_BL_USED_CW_ODD\0"
+    "HA_RING_BL_USED_CW\0"
+    "HA_RING_BL_USED_CCW_EVEN\0"
+    "HA_RING_BL_USED_CCW_ODD\0"
+    "HA_RING_BL_USED_CCW\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "SNOOPS_RSP_AFTER_DATA_LOCAL\0"
+    "SNOOPS_RSP_AFTER_DATA_REMOTE\0"
+    "SNOOP_CYCLES_NE_LOCAL\0"
+    "SNOOP_CYCLES_NE_REMOTE\0"
+    "SNOOP_CYCLES_NE_ALL\0"
+    "SNOOP_OCCUPANCY_LOCAL\0"
+    "SNOOP_OCCUPANCY_REMOTE\0"
+    "SNOOP_RESP_RSPI\0"
+    "SNOOP_RESP_RSPS\0"
+    "SNOOP_RESP_RSPIFWD\0"
+    "SNOOP_RESP_RSPSFWD\0"
+    "SNOOP_RESP_RSP_WB\0"
+    "SNOOP_RESP_RSP_FWD_WB\0"
+    "SNOOP_RESP_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_RSPI\0"
+    "SNP_RESP_RECV_LOCAL_RSPS\0"
+    "SNP_RESP_RECV_LOCAL_RSPIFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPSFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPXFWDXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_OTHER\0"
+    "TAD_REQUESTS_G0_REGION0\0"
+    "TAD_REQUESTS_G0_REGION1\0"
+    "TAD_REQUESTS_G0_REGION2\0"
+    "TAD_REQUESTS_G0_REGION3\0"
+    "TAD_REQUESTS_G0_REGION4\0"
+    "TAD_REQUESTS_G0_REGION5\0"
+    "TAD_REQUESTS_G0_REGION6\0"
+    "TAD_REQUESTS_G0_REGION7\0"
+    "TAD_REQUESTS_G1_REGION8\0"
+    "TAD_REQUESTS_G1_REGION9\0"
+    "TAD_REQUESTS_G1_REGION10\0"
+    "TAD_REQUESTS_G1_REGION11\0"
+    "TRACKER_CYCLES_FULL_GP\0"
+    "TRACKER_CYCLES_FULL_ALL\0"
+    "TRACKER_CYCLES_NE_LOCAL\0"
+    "TRACKER_CYCLES_NE_REMOTE\0"
+    "TRACKER_CYCLES_NE_ALL\0"
+    "TRACKER_OCCUPANCY_READS_LOCAL\0"
+    "TRACKER_OCCUPANCY_READS_REMOTE\0"
+    "TRACKER_OCCUPANCY_WRITES_LOCAL\0"
+    "TRACKER_OCCUPANCY_WRITES_REMOTE\0"
+    "TRACKER_OCCUPANCY_INVITOE_LOCAL\0"
+    "TRACKER_OCCUPANCY_INVITOE_REMOTE\0"
+    "TRACKER_PENDING_OCCUPANCY_LOCAL\0"
+    "TRACKER_PENDING_OCCUPANCY_REMOTE\0"
+    "TXR_AD_CYCLES_FULL_SCHED0\0"
+    "TXR_AD_CYCLES_FULL_SCHED1\0"
+    "TXR_AD_CYCLES_FULL_ALL\0"
+    "TXR_AK\0"
+    "TXR_AK_CYCLES_FULL_SCHED0\0"
+    "TXR_AK_CYCLES_FULL_SCHED1\0"
+    "TXR_AK_CYCLES_FULL_ALL\0"
+    "TXR_BL_DRS_CACHE\0"
+    "TXR_BL_DRS_CORE\0"
+    "TXR_BL_DRS_QPI\0"
+    "TXR_BL_CYCLES_FULL_SCHED0\0"
+    "TXR_BL_CYCLES_FULL_SCHED1\0"
+    "TXR_BL_CYCLES_FULL_ALL\0"
+    "TXR_BL_OCCUPANCY\0"
+    "TXR_STARVED_AK\0"
+    "TXR_STARVED_BL\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX\0"
+    "ACT_COUNT_RD\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "DRAM_PRE_ALL\0"
+    "DRAM_REFRESH_PANIC\0"
+    "DRAM_REFRESH_HIGH\0"
+    "ECC_CORRECTABLE_ERRORS\0"
+    "MAJOR_MODES_READ\0"
+    "MAJOR_MODES_WRITE\0"
+    "MAJOR_MODES_PARTIAL\0"
+    "MAJOR_MODES_ISOCH\0"
+    "POWER_CHANNEL_DLLOFF\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_CKE_CYCLES_RANK0\0"
+    "POWER_CKE_CYCLES_RANK1\0"
+    "POWER_CKE_CYCLES_RANK2\0"
+    "POWER_CKE_CYCLES_RANK3\0"
+    "POWER_CKE_CYCLES_RANK4\0"
+    "POWER_CKE_CYCLES_RANK5\0"
+    "POWER_CKE_CYCLES_RANK6\0"
+    "POWER_CKE_CYCLES_RANK7\0"
+    "POWER_CRITICAL_THROTTLE_CYCLES\0"
+    "POWER_PCU_THROTTLING\0"
+    "POWER_SELF_REFRESH\0"
+    "POWER_THROTTLE_CYCLES_RANK0\0"
+    "POWER_THROTTLE_CYCLES_RANK1\0"
+    "POWER_THROTTLE_CYCLES_RANK2\0"
+    "POWER_THROTTLE_CYCLES_RANK3\0"
+    "POWER_THROTTLE_CYCLES_RANK4\0"
+    "POWER_THROTTLE_CYCLES_RANK5\0"
+    "POWER_THROTTLE_CYCLES_RANK6\0"
+    "POWER_THROTTLE_CYCLES_RANK7\0"
+    "PREEMPTION_RD_PREEMPT_RD\0"
+    "PREEMPTION_RD_PREEMPT_WR\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_PAGE_CLOSE\0"
+    "PRE_COUNT_RD\0"
+    "PRE_COUNT_WR\0"
+    "PRE_COUNT_BYP\0"
+    "RD_CAS_PRIO_LOW\0"
+    "RD_CAS_PRIO_MED\0"
+    "RD_CAS_PRIO_HIGH\0"
+    "RD_CAS_PRIO_PANIC\0"
+    "RD_CAS_RANK0_BANK0\0"
+    "RD_CAS_RANK0_BANK1\0"
+    "RD_CAS_RANK0_BANK2\0"
+    "RD_CAS_RANK0_BANK3\0"
+    "RD_CAS_RANK0_BANK4\0"
+    "RD_CAS_RANK0_BANK5\0"
+    "RD_CAS_RANK0_BANK6\0"
+    "RD_CAS_RANK0_BANK7\0"
+    "RD_CAS_RANK0_BANK8\0"
+    "RD_CAS_RANK0_BANK9\0"
+    "RD_CAS_RANK0_BANK10\0"
+    "RD_CAS_RANK0_BANK11\0"
+    "RD_CAS_RANK0_BANK12\0"
+    "RD_CAS_RANK0_BANK13\0"
+    "RD_CAS_RANK0_BANK14\0"
+    "RD_CAS_RANK0_BANK15\0"
+    "RD_CAS_RANK0_ALLBANKS\0"
+    "RD_CAS_RANK0_BANKG0\0"
+    "RD_CAS_RANK0_BANKG1\0"
+    "RD_CAS_RANK0_BANKG2\0"
+    "RD_CAS_RANK0_BANKG3\0"
+    "RD_CAS_RANK1_BANK0\0"
+    "RD_CAS_RANK1_BANK1\0"
+    "RD_CAS_RANK1_BANK2\0"
+    "RD_CAS_RANK1_BANK3\0"
+    "RD_CAS_RANK1_BANK4\0"
+    "RD_CAS_RANK1_BANK5\0"
+    "RD_CAS_RANK1_BANK6\0"
+    "RD_CAS_RANK1_BANK7\0"
+    "RD_CAS_RANK1_BANK8\0"
+    "RD_CAS_RANK1_BANK9\0"
+    "RD_CAS_RANK1_BANK10\0"
+    "RD_CAS_RANK1_BANK11\0"
+    "RD_CAS_RANK1_BANK12\0"
+    "RD_CAS_RANK1_BANK13\0"
+    "RD_CAS_RANK1_BANK14\0"
+    "RD_CAS_RANK1_BANK15\0"
+    "RD_CAS_RANK1_ALLBANKS\0"
+    "RD_CAS_RANK1_BANKG0\0"
+    "RD_CAS_RANK1_BANKG1\0"
+    "RD_CAS_RANK1_BANKG2\0"
+    "RD_CAS_RANK1_BANKG3\0"
+    "RD_CAS_RANK2_BANK0\0"
+    "RD_CAS_RANK2_BANK1\0"
+    "RD_CAS_RANK2_BANK2\0"
+    "RD_CAS_RANK2_BANK3\0"
+    "RD_CAS_RANK2_BANK4\0"
+    "RD_CAS_RANK2_BANK5\0"
+    "RD_CAS_RANK2_BANK6\0"
+    "RD_CAS_RANK2_BANK7\0"
+    "RD_CAS_RANK2_BANK8\0"
+    "RD_CAS_RANK2_BANK9\0"
+    "RD_CAS_RANK2_BANK10\0"
+    "RD_CAS_RANK2_BANK11\0"
+    "RD_CAS_RANK2_BANK12\0"
+    "RD_CAS_RANK2_BANK13\0"
+    "RD_CAS_RANK2_BANK14\0"
+    "RD_CAS_RANK2_BANK15\0"
+    "RD_CAS_RANK2_ALLBANKS\0"
+    "RD_CAS_RANK2_BANKG0\0"
+    "RD_CAS_RANK2_BANKG1\0"
+    "RD_CAS_RANK2_BANKG2\0"
+    "RD_CAS_RANK2_BANKG3\0"
+    "RD_CAS_RANK3_BANK0\0"
+    "RD_CAS_RANK3_BANK1\0"
+    "RD_CAS_RANK3_BANK2\0"
+    "RD_CAS_RANK3_BANK3\0"
+    "RD_CAS_RANK3_BANK4\0"
+    "RD_CAS_RANK3_BANK5\0"
+    "RD_CAS_RANK3_BANK6\0"
+    "RD_CAS_RANK3_BANK7\0"
+    "RD_CAS_RANK3_BANK8\0"
+    "RD_CAS_RANK3_BANK9\0"
+    "RD_CAS_RANK3_BANK10\0"
+    "RD_CAS_RANK3_BANK11\0"
+    "RD_CAS_RANK3_BANK12\0"
+    "RD_CAS_RANK3_BANK13\0"
+    "RD_CAS_RANK3_BANK14\0"
+    "RD_CAS_RANK3_BANK15\0"
+    "RD_CAS_RANK3_ALLBANKS\0"
+    "RD_CAS_RANK3_BANKG0\0"
+    "RD_CAS_RANK3_BANKG1\0"
+    "RD_CAS_RANK3_BANKG2\0"
+    "RD_CAS_RANK3_BANKG3\0"
+    "RD_CAS_RANK4_BANK0\0"
+    "RD_CAS_RANK4_BANK1\0"
+    "RD_CAS_RANK4_BANK2\0"
+    "RD_CAS_RANK4_BANK3\0"
+    "RD_CAS_RANK4_BANK4\0"
+    "RD_CAS_RANK4_BANK5\0"
+    "RD_CAS_RANK4_BANK6\0"
+    "RD_CAS_RANK4_BANK7\0"
+    "RD_CAS_RANK4_BANK8\0"
+    "RD_CAS_RANK4_BANK9\0"
+    "RD_CAS_RANK4_BANK10\0"
+    "RD_CAS_RANK4_BANK11\0"
+    "RD_CAS_RANK4_BANK12\0"
+    "RD_CAS_RANK4_BANK13\0"
+    "RD_CAS_RANK4_BANK14\0"
+    "RD_CAS_RANK4_BANK15\0"
+    "RD_CAS_RANK4_ALLBANKS\0"
+    "RD_CAS_RANK4_BANKG0\0"
+    "RD_CAS_RANK4_BANKG1\0"
+    "RD_CAS_RANK4_BANKG2\0"
+    "RD_CAS_RANK4_BANKG3\0"
+    "RD_CAS_RANK5_BANK0\0"
+    "RD_CAS_RANK5_BANK1\0"
+    "RD_CAS_RANK5_BANK2\0"
+    "RD_CAS_RANK5_BANK3\0"
+    "RD_CAS_RANK5_BANK4\0"
+    "RD_CAS_RANK5_BANK5\0"
+    "RD_CAS_RANK5_BANK6\0"
+    "RD_CAS_RANK5_BANK7\0"
+    "RD_CAS_RANK5_BANK8\0"
+    "RD_CAS_RANK5_BANK9\0"
+    "RD_CAS_RANK5_BANK10\0"
+    "RD_CAS_RANK5_BANK11\0"
+    "RD_CAS_RANK5_BANK12\0"
+    "RD_CAS_RANK5_BANK13\0"
+    "RD_CAS_RANK5_BANK14\0"
+    "RD_CAS_RANK5_BANK15\0"
+    "RD_CAS_RANK5_ALLBANKS\0"
+    "RD_CAS_RANK5_BANKG0\0"
+    "RD_CAS_RANK5_BANKG1\0"
+    "RD_CAS_RANK5_BANKG2\0"
+    "RD_CAS_RANK5_BANKG3\0"
+    "RD_CAS_RANK6_BANK0\0"
+    "RD_CAS_RANK6_BANK1\0"
+    "RD_CAS_RANK6_BANK2\0"
+    "RD_CAS_RANK6_BANK3\0"
+    "RD_CAS_RANK6_BANK4\0"
+    "RD_CAS_RANK6_BANK5\0"
+    "RD_CAS_RANK6_BANK6\0"
+    "RD_CAS_RANK6_BANK7\0"
+    "RD_CAS_RANK6_BANK8\0"
+    "RD_CAS_RANK6_BANK9\0"
+    "RD_CAS_RANK6_BANK10\0"
+    "RD_CAS_RANK6_BANK11\0"
+    "RD_CAS_RANK6_BANK12\0"
+    "RD_CAS_RANK6_BANK13\0"
+    "RD_CAS_RANK6_BANK14\0"
+    "RD_CAS_RANK6_BANK15\0"
+    "RD_CAS_RANK6_ALLBANKS\0"
+    "RD_CAS_RANK6_BANKG0\0"
+    "RD_CAS_RANK6_BANKG1\0"
+    "RD_CAS_RANK6_BANKG2\0"
+    "RD_CAS_RANK6_BANKG3\0"
+    "RD_CAS_RANK7_BANK0\0"
+    "RD_CAS_RANK7_BANK1\0"
+    "RD_CAS_RANK7_BANK2\0"
+    "RD_CAS_RANK7_BANK3\0"
+    "RD_CAS_RANK7_BANK4\0"
+    "RD_CAS_RANK7_BANK5\0"
+    "RD_CAS_RANK7_BANK6\0"
+    "RD_CAS_RANK7_BANK7\0"
+    "RD_CAS_RANK7_BANK8\0"
+    "RD_CAS_RANK7_BANK9\0"
+    "RD_CAS_RANK7_BANK10\0"
+    "RD_CAS_RANK7_BANK11\0"
+    "RD_CAS_RANK7_BANK12\0"
+    "RD_CAS_RANK7_BANK13\0"
+    "RD_CAS_RANK7_BANK14\0"
+    "RD_CAS_RANK7_BANK15\0"
+    "RD_CAS_RANK7_ALLBANKS\0"
+    "RD_CAS_RANK7_BANKG0\0"
+    "RD_CAS_RANK7_BANKG1\0"
+    "RD_CAS_RANK7_BANKG2\0"
+    "RD_CAS_RANK7_BANKG3\0"
+    "RPQ_CYCLES_NE\0"
+    "RPQ_INSERTS\0"
+    "VMSE_MXB_WR_OCCUPANCY\0"
+    "VMSE_WR_PUSH_WMM\0"
+    "VMSE_WR_PUSH_RMM\0"
+    "WMM_TO_RMM_LOW_THRESH\0"
+    "WMM_TO_RMM_STARVE\0"
+    "WMM_TO_RMM_VMSE_RETRY\0"
+    "WPQ_INSERTS\0"
+    "WPQ_CYCLES_FULL\0"
+    "WPQ_CYCLES_NE\0"
+    "WPQ_READ_HIT\0"
+    "WPQ_WRITE_HIT\0"
+    "WR_CAS_RANK0_BANK0\0"
+    "WR_CAS_RANK0_BANK1\0"
+    "WR_CAS_RANK0_BANK2\0"
+    "WR_CAS_RANK0_BANK3\0"
+    "WR_CAS_RANK0_BANK4\0"
+    "WR_CAS_RANK0_BANK5\0"
+    "WR_CAS_RANK0_BANK6\0"
+    "WR_CAS_RANK0_BANK7\0"
+    "WR_CAS_RANK0_BANK8\0"
+    "WR_CAS_RANK0_BANK9\0"
+    "WR_CAS_RANK0_BANK10\0"
+    "WR_CAS_RANK0_BANK11\0"
+    "WR_CAS_RANK0_BANK12\0"
+    "WR_CAS_RANK0_BANK13\0"
+    "WR_CAS_RANK0_BANK14\0"
+    "WR_CAS_RANK0_BANK15\0"
+    "WR_CAS_RANK0_ALLBANKS\0"
+    "WR_CAS_RANK0_BANKG0\0"
+    "WR_CAS_RANK0_BANKG1\0"
+    "WR_CAS_RANK0_BANKG2\0"
+    "WR_CAS_RANK0_BANKG3\0"
+    "WR_CAS_RANK1_BANK0\0"
+    "WR_CAS_RANK1_BANK1\0"
+    "WR_CAS_RANK1_BANK2\0"
+    "WR_CAS_RANK1_BANK3\0"
+    "WR_CAS_RANK1_BANK4\0"
+    "WR_CAS_RANK1_BANK5\0"
+    "WR_CAS_RANK1_BANK6\0"
+    "WR_CAS_RANK1_BANK7\0"
+    "WR_CAS_RANK1_BANK8\0"
+    "WR_CAS_RANK1_BANK9\0"
+    "WR_CAS_RANK1_BANK10\0"
+    "WR_CAS_RANK1_BANK11\0"
+    "WR_CAS_RANK1_BANK12\0"
+    "WR_CAS_RANK1_BANK13\0"
+    "WR_CAS_RANK1_BANK14\0"
+    "WR_CAS_RANK1_BANK15\0"
+    "WR_CAS_RANK1_ALLBANKS\0"
+    "WR_CAS_RANK1_BANKG0\0"
+    "WR_CAS_RANK1_BANKG1\0"
+    "WR_CAS_RANK1_BANKG2\0"
+    "WR_CAS_RANK1_BANKG3\0"
+    "WR_CAS_RANK2_BANK0\0"
+    "WR_CAS_RANK2_BANK1\0"
+    "WR_CAS_RANK2_BANK2\0"
+    "WR_CAS_RANK2_BANK3\0"
+    "WR_CAS_RANK2_BANK4\0"
+    "WR_CAS_RANK2_BANK5\0"
+    "WR_CAS_RANK2_BANK6\0"
+    "WR_CAS_RANK2_BANK7\0"
+    "WR_CAS_RANK2_BANK8\0"
+    "WR_CAS_RANK2_BANK9\0"
+    "WR_CAS_RANK2_BANK10\0"
+    "WR_CAS_RANK2_BANK11\0"
+    "WR_CAS_RANK2_BANK12\0"
+    "WR_CAS_RANK2_BANK13\0"
+    "WR_CAS_RANK2_BANK14\0"
+    "WR_CAS_RANK2_BANK15\0"
+    "WR_CAS_RANK2_ALLBANKS\0"
+    "WR_CAS_RANK2_BANKG0\0"
+    "WR_CAS_RANK2_BANKG1\0"
+    "WR_CAS_RANK2_BANKG2\0"
+    "WR_CAS_RANK2_BANKG3\0"
+    "WR_CAS_RANK3_BANK0\0"
+    "WR_CAS_RANK3_BANK1\0"
+    "WR_CAS_RANK3_BANK2\0"
+    "WR_CAS_RANK3_BANK3\0"
+    "WR_CAS_RANK3_BANK4\0"
+    "WR_CAS_RANK3_BANK5\0"
+    "WR_CAS_RANK3_BANK6\0"
+    "WR_CAS_RANK3_BANK7\0"
+    "WR_CAS_RANK3_BANK8\0"
+    "WR_CAS_RANK3_BANK9\0"
+    "WR_CAS_RANK3_BANK10\0"
+    "WR_CAS_RANK3_BANK11\0"
+    "WR_CAS_RANK3_BANK12\0"
+    "WR_CAS_RANK3_BANK13\0"
+    "WR_CAS_RANK3_BANK14\0"
+    "WR_CAS_RANK3_BANK15\0"
+    "WR_CAS_RANK3_ALLBANKS\0"
+    "WR_CAS_RANK3_BANKG0\0"
+    "WR_CAS_RANK3_BANKG1\0"
+    "WR_CAS_RANK3_BANKG2\0"
+    "WR_CAS_RANK3_BANKG3\0"
+    "WR_CAS_RANK4_BANK0\0"
+    "WR_CAS_RANK4_BANK1\0"
+    "WR_CAS_RANK4_BANK2\0"
+    "WR_CAS_RANK4_BANK3\0"
+    "WR_CAS_RANK4_BANK4\0"
+    "WR_CAS_RANK4_BANK5\0"
+    "WR_CAS_RANK4_BANK6\0"
+    "WR_CAS_RANK4_BANK7\0"
+    "WR_CAS_RANK4_BANK8\0"
+    "WR_CAS_RANK4_BANK9\0"
+    "WR_CAS_RANK4_BANK10\0"
+    "WR_CAS_RANK4_BANK11\0"
+    "WR_CAS_RANK4_BANK12\0"
+    "WR_CAS_RANK4_BANK13\0"
+    "WR_CAS_RANK4_BANK14\0"
+    "WR_CAS_RANK4_BANK15\0"
+    "WR_CAS_RANK4_ALLBANKS\0"
+    "WR_CAS_RANK4_BANKG0\0"
+    "WR_CAS_RANK4_BANKG1\0"
+    "WR_CAS_RANK4_BANKG2\0"
+    "WR_CAS_RANK4_BANKG3\0"
+    "WR_CAS_RANK5_BANK0\0"
+    "WR_CAS_RANK5_BANK1\0"
+    "WR_CAS_RANK5_BANK2\0"
+    "WR_CAS_RANK5_BANK3\0"
+    "WR_CAS_RANK5_BANK4\0"
+    "WR_CAS_RANK5_BANK5\0"
+    "WR_CAS_RANK5_BANK6\0"
+    "WR_CAS_RANK5_BANK7\0"
+    "WR_CAS_RANK5_BANK8\0"
+    "WR_CAS_RANK5_BANK9\0"
+    "WR_CAS_RANK5_BANK10\0"
+    "WR_CAS_RANK5_BANK11\0"
+    "WR_CAS_RANK5_BANK12\0"
+    "WR_CAS_RANK5_BANK13\0"
+    "WR_CAS_RANK5_BANK14\0"
+    "WR_CAS_RANK5_BANK15\0"
+    "WR_CAS_RANK5_ALLBANKS\0"
+    "WR_CAS_RANK5_BANKG0\0"
+    "WR_CAS_RANK5_BANKG1\0"
+    "WR_CAS_RANK5_BANKG2\0"
+    "WR_CAS_RANK5_BANKG3\0"
+    "WR_CAS_RANK6_BANK0\0"
+    "WR_CAS_RANK6_BANK1\0"
+    "WR_CAS_RANK6_BANK2\0"
+    "WR_CAS_RANK6_BANK3\0"
+    "WR_CAS_RANK6_BANK4\0"
+    "WR_CAS_RANK6_BANK5\0"
+    "WR_CAS_RANK6_BANK6\0"
+    "WR_CAS_RANK6_BANK7\0"
+    "WR_CAS_RANK6_BANK8\0"
+    "WR_CAS_RANK6_BANK9\0"
+    "WR_CAS_RANK6_BANK10\0"
+    "WR_CAS_RANK6_BANK11\0"
+    "WR_CAS_RANK6_BANK12\0"
+    "WR_CAS_RANK6_BANK13\0"
+    "WR_CAS_RANK6_BANK14\0"
+    "WR_CAS_RANK6_BANK15\0"
+    "WR_CAS_RANK6_ALLBANKS\0"
+    "WR_CAS_RANK6_BANKG0\0"
+    "WR_CAS_RANK6_BANKG1\0"
+    "WR_CAS_RANK6_BANKG2\0"
+    "WR_CAS_RANK6_BANKG3\0"
+    "WR_CAS_RANK7_BANK0\0"
+    "WR_CAS_RANK7_BANK1\0"
+    "WR_CAS_RANK7_BANK2\0"
+    "WR_CAS_RANK7_BANK3\0"
+    "WR_CAS_RANK7_BANK4\0"
+    "WR_CAS_RANK7_BANK5\0"
+    "WR_CAS_RANK7_BANK6\0"
+    "WR_CAS_RANK7_BANK7\0"
+    "WR_CAS_RANK7_BANK8\0"
+    "WR_CAS_RANK7_BANK9\0"
+    "WR_CAS_RANK7_BANK10\0"
+    "WR_CAS_RANK7_BANK11\0"
+    "WR_CAS_RANK7_BANK12\0"
+    "WR_CAS_RANK7_BANK13\0"
+    "WR_CAS_RANK7_BANK14\0"
+    "WR_CAS_RANK7_BANK15\0"
+    "WR_CAS_RANK7_ALLBANKS\0"
+    "WR_CAS_RANK7_BANKG0\0"
+    "WR_CAS_RANK7_BANKG1\0"
+    "WR_CAS_RANK7_BANKG2\0"
+    "WR_CAS_RANK7_BANKG3\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDIT_PRQ_QPI0\0"
+    "PBOX0|PBOX1\0"
+    "IIO_CREDIT_PRQ_QPI1\0"
+    "IIO_CREDIT_ISOCH_QPI0\0"
+    "IIO_CREDIT_ISOCH_QPI1\0"
+    "R2PCIE_RING_AD_USED_CW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CW_ODD\0"
+    "R2PCIE_RING_AD_USED_CW\0"
+    "R2PCIE_RING_AD_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CCW_ODD\0"
+    "R2PCIE_RING_AD_USED_CCW\0"
+    "RING_AK_BOUNCES_UP\0"
+    "RING_AK_BOUNCES_DN\0"
+    "R2PCIE_RING_AK_USED_CW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CW_ODD\0"
+    "R2PCIE_RING_AK_USED_CW\0"
+    "R2PCIE_RING_AK_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CCW_ODD\0"
+    "R2PCIE_RING_AK_USED_CCW\0"
+    "R2PCIE_RING_BL_USED_CW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CW_ODD\0"
+    "R2PCIE_RING_BL_USED_CW\0"
+    "R2PCIE_RING_BL_USED_CCW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CCW_ODD\0"
+    "R2PCIE_RING_BL_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_CW\0"
+    "R2PCIE_RING_IV_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_ANY\0"
+    "RXR_CYCLES_NE_NCB\0"
+    "PBOX0|PBOX1|RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "RXR_CYCLES_NE_NCS\0"
+    "RXR_INSERTS_NCB\0"
+    "RXR_INSERTS_NCS\0"
+    "RXR_OCCUPANCY_DRS\0"
+    "PBOX0\0"
+    "R2PCIE_TXR_CYCLES_FULL_AD\0"
+    "R2PCIE_TXR_CYCLES_FULL_AK\0"
+    "R2PCIE_TXR_CYCLES_FULL_BL\0"
+    "R2PCIE_TXR_CYCLES_NE_AD\0"
+    "R2PCIE_TXR_CYCLES_NE_AK\0"
+    "R2PCIE_TXR_CYCLES_NE_BL\0"
+    "TXR_NACK_DN_AD\0"
+    "PBOX|RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "TXR_NACK_DN_BL\0"
+    "TXR_NACK_DN_AK\0"
+    "TXR_NACK_UP_AD\0"
+    "TXR_NACK_UP_BL\0"
+    "TXR_NACK_UP_AK\0"
+    "TXR_NACK_AD\0"
+    "TXR_NACK_BL\0"
+    "TXR_NACK_AK\0"
+    "TXR_NACK_ANY\0"
+    "IBOX_CLOCKTICKS\0"
+    "IBOX\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_SOURCE\0"
+    "COHERENT_OPS_PCIRDCUR\0"
+    "COHERENT_OPS_CRD\0"
+    "COHERENT_OPS_DRD\0"
+    "COHERENT_OPS_RFO\0"
+    "COHERENT_OPS_PCITOM\0"
+    "COHERENT_OPS_PCIDCAHINT\0"
+    "COHERENT_OPS_WBMTOI\0"
+    "COHERENT_OPS_CLFLUSH\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_2ND_RD_INSERT\0"
+    "MISC0_2ND_WR_INSERT\0"
+    "MISC0_2ND_ATOMIC_INSERT\0"
+    "MISC0_INSERTS\0"
+    "MISC0_FAST_XFER\0"
+    "MISC0_PF_ACK_HINT\0"
+    "MISC0_PF_TIMEOUT\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_SLOW\0"
+    "MISC1_LOST_FWD\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "MISC1_DATA_THROTTLE\0"
+    "SNOOP_RESP_MISS\0"
+    "SNOOP_RESP_HIT_I\0"
+    "SNOOP_RESP_HIT_ES\0"
+    "SNOOP_RESP_HIT_M\0"
+    "SNOOP_RESP_HIT\0"
+    "SNOOP_RESP_SNPCODE\0"
+    "SNOOP_RESP_SNPDATA\0"
+    "SNOOP_RESP_SNPINV\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREF\0"
+    "TRANSACTIONS_WR_PREF\0"
+    "TRANSACTIONS_ALL_READS\0"
+    "TRANSACTIONS_ALL_WRITES\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "RXR_AK_INSERTS\0"
+    "RXR_BL_DRS_CYCLES_FULL\0"
+    "RXR_BL_DRS_INSERTS\0"
+    "RXR_BL_DRS_OCCUPANCY\0"
+    "RXR_BL_NCB_CYCLES_FULL\0"
+    "RXR_BL_NCB_INSERTS\0"
+    "RXR_BL_NCB_OCCUPANCY\0"
+    "RXR_BL_NCS_CYCLES_FULL\0"
+    "RXR_BL_NCS_INSERTS\0"
+    "RXR_BL_NCS_OCCUPANCY\0"
+    "TXR_AD_STALL_CREDIT_CYCLES\0"
+    "TXR_BL_STALL_CREDIT_CYCLES\0"
+    "TXR_DATA_INSERTS_NCB\0"
+    "TXR_DATA_INSERTS_NCS\0"
+    "TXR_REQUEST_OCCUPANCY\0";
+
+static const PerfmonEventOption broadwelld_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x03}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x08}
+, {EVENT_OPTION_THRESHOLD,0x0C}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_STATE,0x01}
+};
+
+static const PerfmonEventEntry broadwelld_arch_event_entries[NUM_ARCH_EVENTS_BROADWELLD] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 217, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {221, 217, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {237, 217, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {260, 217, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {284, 217, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 217, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {337, 217, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 217, 0, 0, 0x08,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {394, 217, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {426, 217, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {455, 217, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 217, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {521, 217, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {546, 217, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {570, 217, 3, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {599, 217, 5, 3, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {627, 217, 0, 1, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {653, 217, 1, 2, 0x0D,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {678, 217, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {694, 217, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {718, 217, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {739, 217, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {762, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {786, 217, 9, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {811, 217, 11, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {836, 217, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {865, 217, 15, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {895, 217, 18, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {925, 217, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {959, 217, 21, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {993, 217, 22, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1027, 217, 23, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1061, 217, 24, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1095, 217, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1129, 217, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1150, 217, 26, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1170, 217, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1199, 217, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1227, 217, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1245, 217, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1262, 217, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 217, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1305, 217, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1324, 217, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1344, 217, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1372, 217, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1397, 217, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1414, 217, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1435, 217, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1466, 217, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 217, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1496, 217, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 217, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 217, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1566, 217, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1589, 217, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1617, 217, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1645, 217, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1682, 1704, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1709, 1704, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1738, 1704, 1, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1764, 217, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1796, 217, 0, 0, 0x49,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {1823, 217, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1856, 217, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1886, 217, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1922, 217, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1954, 217, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1973, 217, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1989, 217, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2005, 217, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2017, 217, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 217, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2067, 217, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2105, 217, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2147, 217, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2188, 217, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2242, 217, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2273, 217, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2309, 217, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2346, 217, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2378, 217, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2411, 217, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2428, 217, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2447, 217, 28, 2, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2470, 217, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2484, 217, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2498, 217, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2512, 217, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2526, 217, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 217, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2563, 217, 0, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2607, 217, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2651, 217, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2691, 217, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2732, 217, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2772, 217, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2804, 217, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2814, 217, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2828, 217, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2841, 217, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2857, 217, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2874, 217, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2886, 217, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2903, 217, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2921, 217, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2934, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2950, 217, 8, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2973, 217, 21, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2996, 217, 22, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3019, 217, 23, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3042, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3057, 217, 8, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3079, 217, 21, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3101, 217, 22, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3123, 217, 23, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3145, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3163, 217, 8, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3188, 217, 21, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3213, 217, 22, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3238, 217, 23, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3263, 217, 30, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3280, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3299, 217, 8, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3325, 217, 21, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3351, 217, 22, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3377, 217, 23, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3403, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3417, 217, 8, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3438, 217, 21, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3459, 217, 22, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3480, 217, 23, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3501, 217, 30, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3517, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3545, 217, 8, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3571, 217, 21, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3597, 217, 22, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3623, 217, 23, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3649, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3678, 217, 8, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3705, 217, 21, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3732, 217, 22, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3759, 217, 23, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3786, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3810, 217, 8, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3832, 217, 21, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3854, 217, 22, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3876, 217, 23, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3898, 217, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3909, 217, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3923, 217, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3939, 217, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3965, 217, 0, 0, 0x85,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {3986, 217, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4013, 217, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4037, 217, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4067, 217, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4093, 217, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4107, 217, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4131, 217, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4159, 217, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {4189, 217, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4234, 217, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4265, 217, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4301, 217, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4339, 217, 0, 0, 0x88,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4368, 217, 0, 0, 0x88,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4396, 217, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4430, 217, 0, 0, 0x88,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4474, 217, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4512, 217, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4538, 217, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4562, 217, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4590, 217, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4635, 217, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4666, 217, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4702, 217, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4740, 217, 0, 0, 0x89,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4769, 217, 0, 0, 0x89,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {4813, 217, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4839, 217, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4867, 217, 32, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4915, 217, 33, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4965, 217, 34, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5015, 217, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5065, 217, 35, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5105, 217, 0, 0, 0xA0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5139, 217, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5165, 217, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5191, 217, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5217, 217, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5243, 217, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5269, 217, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5295, 217, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5321, 217, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5347, 217, 37, 1, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5378, 217, 37, 1, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5409, 217, 37, 1, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5440, 217, 37, 1, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5471, 217, 37, 1, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5502, 217, 37, 1, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5533, 217, 37, 1, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5564, 217, 37, 1, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5595, 217, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5615, 217, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5634, 217, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5653, 217, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5673, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5704, 1704, 38, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5738, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5768, 217, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5801, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5831, 217, 34, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5865, 217, 32, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5898, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5929, 1704, 39, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5963, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5993, 217, 40, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6026, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6056, 217, 41, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6090, 217, 32, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6118, 217, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6127, 217, 8, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6145, 217, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6163, 217, 22, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6181, 217, 23, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6199, 217, 0, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6222, 217, 9, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6247, 217, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6280, 217, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6296, 217, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6328, 217, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6360, 217, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6388, 217, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6417, 217, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6438, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6464, 217, 9, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6491, 217, 11, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6518, 217, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6554, 217, 21, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6590, 217, 22, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6626, 217, 23, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6662, 217, 24, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6698, 217, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6734, 217, 42, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6770, 217, 43, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6806, 217, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6825, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6856, 217, 9, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6888, 217, 11, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6920, 217, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6961, 217, 21, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7002, 217, 22, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7043, 217, 23, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7084, 217, 24, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7125, 217, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7166, 217, 42, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7207, 217, 43, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7248, 217, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7280, 217, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7306, 217, 0, 0, 0xBC,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7332, 217, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {7358, 217, 0, 0, 0xBC,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {7384, 217, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {7410, 217, 0, 0, 0xBC,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {7436, 217, 0, 0, 0xBC,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7466, 217, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7485, 217, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7502, 7525, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7530, 217, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7555, 217, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7580, 217, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7608, 217, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7625, 217, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7676, 217, 9, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7702, 217, 11, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7728, 217, 37, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7750, 217, 37, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7781, 217, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7811, 217, 15, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7842, 217, 18, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7873, 217, 8, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7908, 217, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7943, 217, 22, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7978, 217, 23, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8013, 217, 24, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8048, 217, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8083, 217, 42, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8118, 217, 43, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8153, 217, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {8174, 217, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8196, 217, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8227, 217, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8246, 217, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8269, 217, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8298, 217, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8326, 217, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8352, 217, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8380, 217, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8406, 217, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8433, 217, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8460, 217, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8489, 217, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8517, 217, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8544, 217, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8580, 217, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8616, 217, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8657, 217, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8698, 217, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8739, 217, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8780, 217, 0, 0, 0xC7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8809, 217, 0, 0, 0xC7,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {8838, 217, 0, 0, 0xC7,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {8867, 217, 0, 0, 0xC7,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {8896, 217, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8914, 217, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8933, 217, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8953, 217, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8979, 217, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9005, 217, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9031, 217, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9057, 217, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9083, 217, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9101, 217, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9120, 217, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9140, 217, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9166, 217, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9192, 217, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9218, 217, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9244, 217, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9270, 217, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9291, 217, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9311, 217, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9333, 217, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9354, 217, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {9368, 217, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9395, 217, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9422, 217, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9450, 217, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9478, 217, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {9511, 217, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9545, 217, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9574, 217, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9604, 217, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9633, 217, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9663, 217, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {9692, 217, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9721, 217, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9751, 217, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9780, 217, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9809, 217, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9839, 217, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9868, 217, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9898, 217, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9937, 217, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9975, 217, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10014, 217, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10053, 217, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10094, 217, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10107, 217, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10131, 217, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10144, 217, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10161, 217, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10177, 217, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10193, 217, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10210, 217, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10225, 217, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10247, 217, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10261, 217, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10275, 217, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10289, 217, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10305, 217, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {10331, 217, 0, 0, 0xF2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {10357, 217, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10384, 217, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10420, 217, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10452, 217, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10488, 217, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10514, 217, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {10551, 217, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {10584, 217, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {10621, 217, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {10658, 217, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {10691, 217, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {10728, 217, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10770, 217, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10810, 217, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10839, 217, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10866, 217, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10902, 217, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10934, 217, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10970, 217, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10996, 217, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {11033, 217, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {11066, 217, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {11103, 217, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {11140, 217, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {11173, 217, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {11210, 217, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {11252, 217, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {11292, 217, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {11321, 11345, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11350, 11345, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11377, 11345, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11391, 11404, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11412, 11428, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11433, 11428, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11454, 11428, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11475, 11428, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11496, 11428, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11517, 11428, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11537, 11428, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11557, 11428, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11577, 11428, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11593, 11428, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11609, 11428, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11625, 11428, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11641, 11428, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11657, 11428, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11673, 11428, 0, 0, 0x05,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11689, 11428, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11704, 11718, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11986, 11428, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12001, 11428, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12022, 11428, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12042, 11428, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12058, 11428, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12081, 11428, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12103, 11428, 0, 0, 0x1B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12121, 11428, 0, 0, 0x1B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12138, 11428, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12159, 11428, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12179, 11428, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12195, 11428, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12218, 11428, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12240, 11428, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12258, 11428, 0, 0, 0x1C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12275, 11428, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12296, 11428, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12316, 11428, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12332, 11428, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12355, 11428, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12377, 11428, 0, 0, 0x1D,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12395, 11428, 0, 0, 0x1D,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12412, 11428, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12428, 11428, 0, 0, 0x1E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12444, 11428, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12461, 11428, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12480, 12498, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12632, 12498, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12654, 12498, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12672, 12498, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12694, 11428, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12714, 11428, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12734, 11428, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12754, 11428, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12780, 11428, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12796, 11428, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12816, 11428, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12832, 11428, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12848, 11428, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12868, 11428, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12886, 11428, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12905, 11428, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12933, 11428, 0, 0, 0x31,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12959, 11428, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12981, 11428, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13003, 11428, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13021, 11428, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13040, 11428, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13068, 11428, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13087, 11428, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13113, 11428, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13139, 11428, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13157, 11428, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13179, 11428, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13201, 11428, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13223, 11428, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13242, 11428, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13262, 11428, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13282, 11428, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13309, 11428, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13336, 11428, 0, 0, 0x33,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13355, 11428, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NID_MASK}
+, {13381, 11428, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13404, 11428, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13427, 11428, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {13450, 11428, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK}
+, {13471, 11428, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK}
+, {13488, 11428, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK}
+, {13512, 11428, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK}
+, {13527, 11428, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_STATE_MASK}
+, {13543, 11428, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_NID_MASK}
+, {13558, 11428, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13572, 11428, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13586, 11428, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13600, 11428, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13614, 11428, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13631, 11428, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_NID_MASK}
+, {13647, 11428, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {13666, 11428, 0, 0, 0x35,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {13690, 11428, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13711, 11428, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13727, 11428, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13742, 11428, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {13767, 11428, 0, 0, 0x35,0x23,0,0,EVENT_OPTION_OPCODE_MASK}
+, {13797, 11428, 0, 0, 0x35,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13815, 11428, 0, 0, 0x35,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {13838, 11428, 0, 0, 0x35,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {13861, 11428, 0, 0, 0x35,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {13889, 11428, 0, 0, 0x35,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {13913, 11428, 44, 1, 0x35,0x48,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_STATE_MASK}
+, {13933, 11428, 0, 0, 0x35,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {13958, 11428, 0, 0, 0x35,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {13977, 11428, 0, 0, 0x35,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14003, 11428, 0, 0, 0x35,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14034, 11428, 0, 0, 0x35,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {14053, 11428, 0, 0, 0x35,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {14077, 12498, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14098, 12498, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14124, 12498, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14147, 12498, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14165, 12498, 0, 0, 0x36,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {14188, 12498, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14205, 12498, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {14232, 12498, 0, 0, 0x36,0x23,0,0,EVENT_OPTION_NONE_MASK}
+, {14264, 12498, 0, 0, 0x36,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {14284, 12498, 0, 0, 0x36,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {14309, 12498, 0, 0, 0x36,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14334, 12498, 0, 0, 0x36,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {14364, 12498, 0, 0, 0x36,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {14391, 12498, 0, 0, 0x36,0x48,0,0,EVENT_OPTION_NID_MASK}
+, {14413, 12498, 0, 0, 0x36,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {14440, 12498, 0, 0, 0x36,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {14461, 12498, 0, 0, 0x36,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14489, 12498, 0, 0, 0x36,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {14522, 12498, 0, 0, 0x36,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {14543, 12498, 0, 0, 0x36,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {14569, 11428, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14587, 11428, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14604, 11428, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14617, 11428, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14632, 11428, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14660, 11428, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14686, 14702, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14707, 14702, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14731, 14702, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14755, 14702, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14779, 14702, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14803, 14702, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14827, 14702, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14851, 14702, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14875, 14702, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14899, 14702, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14923, 14702, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14947, 14702, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14972, 14702, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14997, 14702, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15022, 14702, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15047, 14702, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15072, 14702, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15097, 14702, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15122, 14702, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15147, 14702, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15166, 14702, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15185, 14702, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15204, 14702, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15223, 14702, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15239, 14702, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15255, 14702, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15271, 14702, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15287, 14702, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15303, 14702, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15319, 14702, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15335, 14702, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15351, 14702, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15367, 14702, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15383, 14702, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15400, 14702, 0, 0, 0x3B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15417, 14702, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15434, 14702, 0, 0, 0x3D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15451, 14702, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15468, 14702, 0, 0, 0x3F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15485, 14702, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15502, 14702, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15519, 14702, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15537, 14702, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15555, 14702, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15573, 14702, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15591, 14702, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15621, 14702, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15640, 14702, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15662, 14702, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15683, 14702, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15701, 14702, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15730, 14702, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15761, 14702, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15792, 14702, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {15823, 14702, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15847, 14702, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15871, 14702, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15895, 14702, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15909, 14702, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15933, 14702, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15954, 14702, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15981, 14702, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16007, 14702, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16031, 14702, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16056, 16068, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16077, 16089, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16098, 16114, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16119, 16114, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {16139, 16114, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {16158, 16114, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {16178, 16114, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {16196, 16114, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {16214, 16114, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {16232, 16114, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16245, 16114, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16258, 16114, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16275, 16114, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16296, 16312, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16328, 16114, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16346, 16114, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16374, 16114, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16399, 16114, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16417, 16114, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16438, 16114, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16462, 16114, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16483, 16114, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16506, 16114, 0, 0, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16527, 16114, 0, 0, 0x70,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16556, 16114, 0, 0, 0x70,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16576, 16114, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16601, 16114, 0, 0, 0x70,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16626, 16114, 0, 0, 0x70,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {16643, 16114, 0, 0, 0x70,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16671, 16114, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16698, 16114, 0, 0, 0x70,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {16718, 16114, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16739, 16114, 0, 0, 0x70,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {16759, 16114, 0, 0, 0x70,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16776, 16114, 0, 0, 0x70,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {16793, 16114, 0, 0, 0x71,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16819, 16114, 0, 0, 0x71,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16836, 16114, 0, 0, 0x71,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16858, 16114, 0, 0, 0x71,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16880, 16114, 0, 0, 0x71,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {16894, 16114, 0, 0, 0x71,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16919, 16114, 0, 0, 0x71,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16943, 16114, 0, 0, 0x71,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {16960, 16114, 0, 0, 0x71,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16978, 16114, 0, 0, 0x71,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {16995, 16114, 0, 0, 0x71,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {17012, 16114, 0, 0, 0x71,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17026, 16114, 0, 0, 0x71,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {17040, 16114, 0, 0, 0x72,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17078, 16114, 0, 0, 0x72,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17107, 16114, 0, 0, 0x72,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17141, 16114, 0, 0, 0x72,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17175, 16114, 0, 0, 0x72,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {17201, 16114, 0, 0, 0x72,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17238, 16114, 0, 0, 0x72,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17274, 16114, 0, 0, 0x72,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17304, 16114, 0, 0, 0x72,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17330, 16114, 0, 0, 0x72,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {17356, 16114, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17385, 16114, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17414, 16114, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17443, 16114, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17472, 16114, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17501, 16114, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17530, 16114, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17547, 16114, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17557, 16114, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17573, 16114, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17592, 16114, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17614, 16114, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17639, 16114, 0, 0, 0x1A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {17654, 16114, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17670, 16114, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17688, 16114, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17699, 16114, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17713, 16114, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17736, 16114, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17754, 16114, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17766, 16114, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17788, 16114, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17811, 16114, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17833, 16114, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17856, 16114, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17877, 16114, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17899, 16114, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {17914, 16114, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17936, 16114, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17959, 16114, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {17975, 16114, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17998, 16114, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18022, 16114, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18046, 16114, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18069, 16114, 0, 0, 0x3E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18088, 16114, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18113, 16114, 0, 0, 0x3E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18137, 16114, 0, 0, 0x3E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18157, 16114, 0, 0, 0x3F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18181, 16114, 0, 0, 0x3F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18204, 16114, 0, 0, 0x3F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18223, 16114, 0, 0, 0x3F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18248, 16114, 0, 0, 0x3F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18272, 16114, 0, 0, 0x3F,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18292, 16114, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18316, 16114, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18339, 16114, 0, 0, 0x40,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18358, 16114, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18383, 16114, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18407, 16114, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18427, 16114, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18458, 16114, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18489, 16114, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18520, 16114, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18551, 16114, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18583, 16114, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18615, 16114, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18647, 16114, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18679, 16114, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18710, 16114, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18741, 16114, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18772, 16114, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18803, 16114, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18835, 16114, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18867, 16114, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18899, 16114, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18931, 16114, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18959, 16114, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18988, 16114, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19010, 16114, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19033, 16114, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19053, 16114, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19075, 16114, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19098, 16114, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19114, 16114, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19130, 16114, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19149, 16114, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19168, 16114, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19186, 16114, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19208, 16114, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19229, 16114, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19254, 16114, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19279, 16114, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19307, 16114, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19335, 16114, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19362, 16114, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19393, 16114, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19423, 16114, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19449, 16114, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19473, 16114, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19497, 16114, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19521, 16114, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19545, 16114, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19569, 16114, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19593, 16114, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19617, 16114, 0, 0, 0x1B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19641, 16114, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19665, 16114, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19689, 16114, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19714, 16114, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19739, 16114, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19762, 16114, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19786, 16114, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19810, 16114, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19835, 16114, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19857, 16114, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19887, 16114, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19918, 16114, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19949, 16114, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19981, 16114, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20013, 16114, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {20046, 16114, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20078, 16114, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20111, 16114, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20137, 16114, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20163, 16114, 0, 0, 0x2A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20186, 16114, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20193, 16114, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20219, 16114, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20245, 16114, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20268, 16114, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20285, 16114, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20301, 16114, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20316, 16114, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20342, 16114, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20368, 16114, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20391, 16114, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20408, 16114, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20423, 16114, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20438, 20454, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20459, 20454, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20472, 20454, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20485, 20454, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20499, 20454, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20512, 20454, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20525, 20454, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20538, 20454, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20555, 20454, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20578, 20454, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20591, 20454, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20608, 20454, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20625, 20454, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20642, 20454, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20659, 20454, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20672, 20454, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {20686, 20454, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20699, 20454, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20718, 20454, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20736, 20454, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20759, 20454, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20776, 20454, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20794, 20454, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20814, 20454, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20832, 20454, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20853, 20454, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20871, 20454, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20894, 20454, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20917, 20454, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20940, 20454, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20963, 20454, 0, 0, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20986, 20454, 0, 0, 0x83,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21009, 20454, 0, 0, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21032, 20454, 0, 0, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {21055, 20454, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21086, 20454, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21107, 20454, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21126, 20454, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21154, 20454, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21182, 20454, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21210, 20454, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21238, 20454, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21266, 20454, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21294, 20454, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21322, 20454, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {21350, 20454, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21375, 20454, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21400, 20454, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21420, 20454, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21441, 20454, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21454, 20454, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21467, 20454, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21481, 20454, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21497, 20454, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21513, 20454, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21530, 20454, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21548, 20454, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21567, 20454, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21586, 20454, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21605, 20454, 0, 0, 0xB0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21624, 20454, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21643, 20454, 0, 0, 0xB0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {21662, 20454, 0, 0, 0xB0,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {21681, 20454, 0, 0, 0xB0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {21700, 20454, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21719, 20454, 0, 0, 0xB0,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {21738, 20454, 0, 0, 0xB0,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {21758, 20454, 0, 0, 0xB0,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {21778, 20454, 0, 0, 0xB0,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {21798, 20454, 0, 0, 0xB0,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {21818, 20454, 0, 0, 0xB0,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {21838, 20454, 0, 0, 0xB0,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {21858, 20454, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21880, 20454, 0, 0, 0xB0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {21900, 20454, 0, 0, 0xB0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {21920, 20454, 0, 0, 0xB0,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {21940, 20454, 0, 0, 0xB0,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {21960, 20454, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21979, 20454, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21998, 20454, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22017, 20454, 0, 0, 0xB1,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22036, 20454, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22055, 20454, 0, 0, 0xB1,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {22074, 20454, 0, 0, 0xB1,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {22093, 20454, 0, 0, 0xB1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {22112, 20454, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22131, 20454, 0, 0, 0xB1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {22150, 20454, 0, 0, 0xB1,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {22170, 20454, 0, 0, 0xB1,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {22190, 20454, 0, 0, 0xB1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {22210, 20454, 0, 0, 0xB1,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {22230, 20454, 0, 0, 0xB1,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {22250, 20454, 0, 0, 0xB1,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {22270, 20454, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22292, 20454, 0, 0, 0xB1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {22312, 20454, 0, 0, 0xB1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {22332, 20454, 0, 0, 0xB1,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {22352, 20454, 0, 0, 0xB1,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {22372, 20454, 0, 0, 0xB2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22391, 20454, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22410, 20454, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22429, 20454, 0, 0, 0xB2,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22448, 20454, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22467, 20454, 0, 0, 0xB2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {22486, 20454, 0, 0, 0xB2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {22505, 20454, 0, 0, 0xB2,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {22524, 20454, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22543, 20454, 0, 0, 0xB2,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {22562, 20454, 0, 0, 0xB2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {22582, 20454, 0, 0, 0xB2,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {22602, 20454, 0, 0, 0xB2,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {22622, 20454, 0, 0, 0xB2,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {22642, 20454, 0, 0, 0xB2,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {22662, 20454, 0, 0, 0xB2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {22682, 20454, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22704, 20454, 0, 0, 0xB2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {22724, 20454, 0, 0, 0xB2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {22744, 20454, 0, 0, 0xB2,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {22764, 20454, 0, 0, 0xB2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {22784, 20454, 0, 0, 0xB3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22803, 20454, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22822, 20454, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22841, 20454, 0, 0, 0xB3,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22860, 20454, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22879, 20454, 0, 0, 0xB3,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {22898, 20454, 0, 0, 0xB3,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {22917, 20454, 0, 0, 0xB3,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {22936, 20454, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22955, 20454, 0, 0, 0xB3,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {22974, 20454, 0, 0, 0xB3,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {22994, 20454, 0, 0, 0xB3,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {23014, 20454, 0, 0, 0xB3,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23034, 20454, 0, 0, 0xB3,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {23054, 20454, 0, 0, 0xB3,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {23074, 20454, 0, 0, 0xB3,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23094, 20454, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23116, 20454, 0, 0, 0xB3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {23136, 20454, 0, 0, 0xB3,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {23156, 20454, 0, 0, 0xB3,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {23176, 20454, 0, 0, 0xB3,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {23196, 20454, 0, 0, 0xB4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23215, 20454, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23234, 20454, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23253, 20454, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23272, 20454, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23291, 20454, 0, 0, 0xB4,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {23310, 20454, 0, 0, 0xB4,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {23329, 20454, 0, 0, 0xB4,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23348, 20454, 0, 0, 0xB4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23367, 20454, 0, 0, 0xB4,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {23386, 20454, 0, 0, 0xB4,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {23406, 20454, 0, 0, 0xB4,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {23426, 20454, 0, 0, 0xB4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23446, 20454, 0, 0, 0xB4,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {23466, 20454, 0, 0, 0xB4,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {23486, 20454, 0, 0, 0xB4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23506, 20454, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23528, 20454, 0, 0, 0xB4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {23548, 20454, 0, 0, 0xB4,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {23568, 20454, 0, 0, 0xB4,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {23588, 20454, 0, 0, 0xB4,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {23608, 20454, 0, 0, 0xB5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23627, 20454, 0, 0, 0xB5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23646, 20454, 0, 0, 0xB5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23665, 20454, 0, 0, 0xB5,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23684, 20454, 0, 0, 0xB5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23703, 20454, 0, 0, 0xB5,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {23722, 20454, 0, 0, 0xB5,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {23741, 20454, 0, 0, 0xB5,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23760, 20454, 0, 0, 0xB5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23779, 20454, 0, 0, 0xB5,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {23798, 20454, 0, 0, 0xB5,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {23818, 20454, 0, 0, 0xB5,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {23838, 20454, 0, 0, 0xB5,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23858, 20454, 0, 0, 0xB5,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {23878, 20454, 0, 0, 0xB5,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {23898, 20454, 0, 0, 0xB5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23918, 20454, 0, 0, 0xB5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23940, 20454, 0, 0, 0xB5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {23960, 20454, 0, 0, 0xB5,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {23980, 20454, 0, 0, 0xB5,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24000, 20454, 0, 0, 0xB5,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24020, 20454, 0, 0, 0xB6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24039, 20454, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24058, 20454, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24077, 20454, 0, 0, 0xB6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24096, 20454, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24115, 20454, 0, 0, 0xB6,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24134, 20454, 0, 0, 0xB6,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24153, 20454, 0, 0, 0xB6,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24172, 20454, 0, 0, 0xB6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24191, 20454, 0, 0, 0xB6,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24210, 20454, 0, 0, 0xB6,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24230, 20454, 0, 0, 0xB6,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24250, 20454, 0, 0, 0xB6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24270, 20454, 0, 0, 0xB6,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24290, 20454, 0, 0, 0xB6,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24310, 20454, 0, 0, 0xB6,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24330, 20454, 0, 0, 0xB6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24352, 20454, 0, 0, 0xB6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24372, 20454, 0, 0, 0xB6,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24392, 20454, 0, 0, 0xB6,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24412, 20454, 0, 0, 0xB6,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24432, 20454, 0, 0, 0xB7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24451, 20454, 0, 0, 0xB7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24470, 20454, 0, 0, 0xB7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24489, 20454, 0, 0, 0xB7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24508, 20454, 0, 0, 0xB7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24527, 20454, 0, 0, 0xB7,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24546, 20454, 0, 0, 0xB7,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24565, 20454, 0, 0, 0xB7,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24584, 20454, 0, 0, 0xB7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24603, 20454, 0, 0, 0xB7,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24622, 20454, 0, 0, 0xB7,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24642, 20454, 0, 0, 0xB7,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24662, 20454, 0, 0, 0xB7,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24682, 20454, 0, 0, 0xB7,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24702, 20454, 0, 0, 0xB7,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24722, 20454, 0, 0, 0xB7,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24742, 20454, 0, 0, 0xB7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24764, 20454, 0, 0, 0xB7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24784, 20454, 0, 0, 0xB7,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24804, 20454, 0, 0, 0xB7,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24824, 20454, 0, 0, 0xB7,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24844, 20454, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24858, 20454, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24870, 20454, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24892, 20454, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24909, 20454, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24926, 20454, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24948, 20454, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24966, 20454, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24988, 20454, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25000, 20454, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25016, 20454, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25030, 20454, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25043, 20454, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25057, 20454, 0, 0, 0xB8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25076, 20454, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25095, 20454, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25114, 20454, 0, 0, 0xB8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25133, 20454, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25152, 20454, 0, 0, 0xB8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25171, 20454, 0, 0, 0xB8,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25190, 20454, 0, 0, 0xB8,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25209, 20454, 0, 0, 0xB8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25228, 20454, 0, 0, 0xB8,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25247, 20454, 0, 0, 0xB8,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25267, 20454, 0, 0, 0xB8,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25287, 20454, 0, 0, 0xB8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25307, 20454, 0, 0, 0xB8,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25327, 20454, 0, 0, 0xB8,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25347, 20454, 0, 0, 0xB8,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25367, 20454, 0, 0, 0xB8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25389, 20454, 0, 0, 0xB8,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25409, 20454, 0, 0, 0xB8,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25429, 20454, 0, 0, 0xB8,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25449, 20454, 0, 0, 0xB8,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25469, 20454, 0, 0, 0xB9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25488, 20454, 0, 0, 0xB9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25507, 20454, 0, 0, 0xB9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25526, 20454, 0, 0, 0xB9,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25545, 20454, 0, 0, 0xB9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25564, 20454, 0, 0, 0xB9,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25583, 20454, 0, 0, 0xB9,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25602, 20454, 0, 0, 0xB9,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25621, 20454, 0, 0, 0xB9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25640, 20454, 0, 0, 0xB9,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25659, 20454, 0, 0, 0xB9,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25679, 20454, 0, 0, 0xB9,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25699, 20454, 0, 0, 0xB9,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25719, 20454, 0, 0, 0xB9,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25739, 20454, 0, 0, 0xB9,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25759, 20454, 0, 0, 0xB9,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25779, 20454, 0, 0, 0xB9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25801, 20454, 0, 0, 0xB9,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25821, 20454, 0, 0, 0xB9,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25841, 20454, 0, 0, 0xB9,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25861, 20454, 0, 0, 0xB9,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25881, 20454, 0, 0, 0xBA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25900, 20454, 0, 0, 0xBA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25919, 20454, 0, 0, 0xBA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25938, 20454, 0, 0, 0xBA,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25957, 20454, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25976, 20454, 0, 0, 0xBA,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25995, 20454, 0, 0, 0xBA,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26014, 20454, 0, 0, 0xBA,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26033, 20454, 0, 0, 0xBA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26052, 20454, 0, 0, 0xBA,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26071, 20454, 0, 0, 0xBA,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26091, 20454, 0, 0, 0xBA,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26111, 20454, 0, 0, 0xBA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26131, 20454, 0, 0, 0xBA,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26151, 20454, 0, 0, 0xBA,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26171, 20454, 0, 0, 0xBA,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26191, 20454, 0, 0, 0xBA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26213, 20454, 0, 0, 0xBA,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26233, 20454, 0, 0, 0xBA,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26253, 20454, 0, 0, 0xBA,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26273, 20454, 0, 0, 0xBA,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26293, 20454, 0, 0, 0xBB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26312, 20454, 0, 0, 0xBB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26331, 20454, 0, 0, 0xBB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26350, 20454, 0, 0, 0xBB,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26369, 20454, 0, 0, 0xBB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26388, 20454, 0, 0, 0xBB,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26407, 20454, 0, 0, 0xBB,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26426, 20454, 0, 0, 0xBB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26445, 20454, 0, 0, 0xBB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26464, 20454, 0, 0, 0xBB,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26483, 20454, 0, 0, 0xBB,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26503, 20454, 0, 0, 0xBB,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26523, 20454, 0, 0, 0xBB,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26543, 20454, 0, 0, 0xBB,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26563, 20454, 0, 0, 0xBB,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26583, 20454, 0, 0, 0xBB,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26603, 20454, 0, 0, 0xBB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26625, 20454, 0, 0, 0xBB,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26645, 20454, 0, 0, 0xBB,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26665, 20454, 0, 0, 0xBB,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26685, 20454, 0, 0, 0xBB,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26705, 20454, 0, 0, 0xBC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26724, 20454, 0, 0, 0xBC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26743, 20454, 0, 0, 0xBC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26762, 20454, 0, 0, 0xBC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26781, 20454, 0, 0, 0xBC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26800, 20454, 0, 0, 0xBC,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26819, 20454, 0, 0, 0xBC,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26838, 20454, 0, 0, 0xBC,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26857, 20454, 0, 0, 0xBC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26876, 20454, 0, 0, 0xBC,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26895, 20454, 0, 0, 0xBC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26915, 20454, 0, 0, 0xBC,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26935, 20454, 0, 0, 0xBC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26955, 20454, 0, 0, 0xBC,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26975, 20454, 0, 0, 0xBC,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26995, 20454, 0, 0, 0xBC,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27015, 20454, 0, 0, 0xBC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27037, 20454, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27057, 20454, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27077, 20454, 0, 0, 0xBC,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27097, 20454, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27117, 20454, 0, 0, 0xBD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27136, 20454, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27155, 20454, 0, 0, 0xBD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27174, 20454, 0, 0, 0xBD,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27193, 20454, 0, 0, 0xBD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27212, 20454, 0, 0, 0xBD,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27231, 20454, 0, 0, 0xBD,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27250, 20454, 0, 0, 0xBD,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27269, 20454, 0, 0, 0xBD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27288, 20454, 0, 0, 0xBD,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27307, 20454, 0, 0, 0xBD,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27327, 20454, 0, 0, 0xBD,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27347, 20454, 0, 0, 0xBD,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27367, 20454, 0, 0, 0xBD,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27387, 20454, 0, 0, 0xBD,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27407, 20454, 0, 0, 0xBD,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27427, 20454, 0, 0, 0xBD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27449, 20454, 0, 0, 0xBD,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27469, 20454, 0, 0, 0xBD,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27489, 20454, 0, 0, 0xBD,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27509, 20454, 0, 0, 0xBD,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27529, 20454, 0, 0, 0xBE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27548, 20454, 0, 0, 0xBE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27567, 20454, 0, 0, 0xBE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27586, 20454, 0, 0, 0xBE,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27605, 20454, 0, 0, 0xBE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27624, 20454, 0, 0, 0xBE,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27643, 20454, 0, 0, 0xBE,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27662, 20454, 0, 0, 0xBE,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27681, 20454, 0, 0, 0xBE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27700, 20454, 0, 0, 0xBE,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27719, 20454, 0, 0, 0xBE,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27739, 20454, 0, 0, 0xBE,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27759, 20454, 0, 0, 0xBE,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27779, 20454, 0, 0, 0xBE,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27799, 20454, 0, 0, 0xBE,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27819, 20454, 0, 0, 0xBE,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27839, 20454, 0, 0, 0xBE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27861, 20454, 0, 0, 0xBE,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27881, 20454, 0, 0, 0xBE,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27901, 20454, 0, 0, 0xBE,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27921, 20454, 0, 0, 0xBE,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27941, 20454, 0, 0, 0xBF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27960, 20454, 0, 0, 0xBF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27979, 20454, 0, 0, 0xBF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27998, 20454, 0, 0, 0xBF,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28017, 20454, 0, 0, 0xBF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28036, 20454, 0, 0, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28055, 20454, 0, 0, 0xBF,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {28074, 20454, 0, 0, 0xBF,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {28093, 20454, 0, 0, 0xBF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28112, 20454, 0, 0, 0xBF,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {28131, 20454, 0, 0, 0xBF,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28151, 20454, 0, 0, 0xBF,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28171, 20454, 0, 0, 0xBF,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28191, 20454, 0, 0, 0xBF,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28211, 20454, 0, 0, 0xBF,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28231, 20454, 0, 0, 0xBF,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28251, 20454, 0, 0, 0xBF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28273, 20454, 0, 0, 0xBF,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28293, 20454, 0, 0, 0xBF,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28313, 20454, 0, 0, 0xBF,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28333, 20454, 0, 0, 0xBF,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28353, 28369, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28374, 28394, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28406, 28394, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28426, 28394, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28448, 28394, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28470, 28369, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28498, 28369, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28525, 28369, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28548, 28369, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28577, 28369, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28605, 28369, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28629, 28369, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28648, 28369, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28667, 28369, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28695, 28369, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28722, 28369, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28745, 28369, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28774, 28369, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28802, 28369, 0, 0, 0x08,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28826, 28369, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28854, 28369, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28881, 28369, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28904, 28369, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28933, 28369, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28961, 28369, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28985, 28369, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {29008, 28369, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29032, 28369, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29056, 29074, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29118, 29074, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29136, 29074, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29152, 29074, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29168, 29186, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29192, 29186, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29218, 29186, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29244, 29186, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29270, 29186, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29294, 29186, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29318, 29186, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29342, 29357, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29394, 29357, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29409, 29357, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29424, 29357, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29439, 29357, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29454, 29357, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29469, 29357, 0, 0, 0x26,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29481, 29357, 0, 0, 0x26,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {29493, 29357, 0, 0, 0x26,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {29505, 29357, 0, 0, 0x26,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {29518, 29534, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29539, 29534, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29565, 29534, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29594, 29534, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29616, 29534, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29633, 29534, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29650, 29534, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29667, 29534, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29687, 29534, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29711, 29534, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29731, 29534, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29752, 29534, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29767, 29534, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29782, 29534, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29802, 29534, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29822, 29534, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29846, 29534, 0, 0, 0x14,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {29860, 29534, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29876, 29534, 0, 0, 0x14,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29894, 29534, 0, 0, 0x14,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29911, 29534, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29924, 29534, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29937, 29534, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29950, 29534, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29963, 29534, 0, 0, 0x15,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29974, 29534, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29989, 29534, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30010, 29534, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30029, 29534, 0, 0, 0x15,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30049, 29534, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30065, 29534, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30082, 29534, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30100, 29534, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30117, 29534, 0, 0, 0x17,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {30132, 29534, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30151, 29534, 0, 0, 0x17,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30170, 29534, 0, 0, 0x17,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30188, 29534, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30207, 29534, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30227, 29534, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30248, 29534, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30269, 29534, 0, 0, 0x16,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {30292, 29534, 0, 0, 0x16,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {30316, 29534, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30336, 29534, 0, 0, 0x16,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30355, 29534, 0, 0, 0x16,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30378, 29534, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30393, 29534, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30416, 29534, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30435, 29534, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30456, 29534, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30479, 29534, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30498, 29534, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30519, 29534, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30542, 29534, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30561, 29534, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30582, 29534, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30609, 29534, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30636, 29534, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30657, 29534, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30678, 29534, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable broadwelld_arch_events = {
+    NUM_ARCH_EVENTS_BROADWELLD,
+    broadwelld_arch_event_strings,
+    broadwelld_arch_event_options,
+    broadwelld_arch_event_entries
+};
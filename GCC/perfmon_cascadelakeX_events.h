@@ -0,0 +1,4293 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_CASCADELAKEX 2089
+
+static const char cascadelakeX_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "PMC\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_ALL\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "BACLEARS_ANY\0"
+    "ITLB_FLUSH\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_CLEAR_RESTEER_CYCLES\0"
+    "INT_MISC_CLEAR_RESTEER_COUNT\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_SB\0"
+    "PARTIAL_RAT_STALLS_SCOREBOARD\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_VECTOR_WIDTH_MISMATCH\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MEM\0"
+    "HLE_RETIRED_ABORTED_TIMER\0"
+    "HLE_RETIRED_ABORTED_UNFRIENDLY\0"
+    "HLE_RETIRED_ABORTED_MEMTYPE\0"
+    "HLE_RETIRED_ABORTED_EVENTS\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "INST_RETIRED_ANY\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SINGLE\0"
+    "FP_ASSIST_ANY\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_RETIRED_LOCAL_PMM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_ALL\0"
+    "MEM_LOAD_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_FWD\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_ALL\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_PMM\0"
+    "MEM_LOAD_MISC_RETIRED_UC\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_4\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_8\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_16\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_32\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_64\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_128\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_256\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_512\0"
+    "FRONTEND_RETIRED_DSB_MISS\0"
+    "FRONTEND_RETIRED_L1I_MISS\0"
+    "FRONTEND_RETIRED_L2_MISS\0"
+    "FRONTEND_RETIRED_ITLB_MISS\0"
+    "FRONTEND_RETIRED_STLB_MISS\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_4\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_X87\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L3_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "EPT_WALK_PENDING\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_COMPLETED_1G\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_M_EVICT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_PENDING_CYCLES_ANY\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MITE_CYCLES_6_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES_5_UOPS\0"
+    "IDQ_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_5_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_6_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES_5_UOPS\0"
+    "IDQ_MS_CYCLES_6_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_5_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_6_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_5_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_6_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_5_UOPS\0"
+    "IDQ_ALL_CYCLES_6_UOPS\0"
+    "ROB_MISC_EVENTS_LBR_INSERTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "L2_LINES_OUT_USELESS_PREF\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "OTHER_ASSISTS_ANY\0"
+    "FRONTEND_RETIRED_LATENCY_GE_8\0"
+    "FRONTEND_RETIRED_LATENCY_GE_16\0"
+    "FRONTEND_RETIRED_LATENCY_GE_32\0"
+    "FRONTEND_RETIRED_LATENCY_GE_64\0"
+    "FRONTEND_RETIRED_LATENCY_GE_128\0"
+    "FRONTEND_RETIRED_LATENCY_GE_256\0"
+    "FRONTEND_RETIRED_LATENCY_GE_512\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_1\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_3\0"
+    "CORE_POWER_LVL0_TURBO_LICENSE\0"
+    "CORE_POWER_LVL1_TURBO_LICENSE\0"
+    "CORE_POWER_LVL2_TURBO_LICENSE\0"
+    "MEMORY_DISAMBIGUATION_HISTORY_RESET\0"
+    "IDI_MISC_WB_UPGRADE\0"
+    "IDI_MISC_WB_DOWNGRADE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "EVENT_MSG_VLW_RCVD\0"
+    "UBOX\0"
+    "EVENT_MSG_MSI_RCVD\0"
+    "EVENT_MSG_IPI_RCVD\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "EVENT_MSG_INT_PRIO\0"
+    "LOCK_CYCLES\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_DRNG_RDRAND\0"
+    "RACU_DRNG_RDSEED\0"
+    "RACU_DRNG_PFTCH_BUF_EMPTY\0"
+    "RACU_REQUESTS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "2LM_NM_SETCONFLICTS_SF\0"
+    "CBOX\0"
+    "2LM_NM_SETCONFLICTS_LLC\0"
+    "2LM_NM_SETCONFLICTS_TOR\0"
+    "2LM_NM_SETCONFLICTS_TOR_REJECT\0"
+    "2LM_NM_SETCONFLICTS_IODC\0"
+    "SF_EVICTION_M\0"
+    "SF_EVICTION_E\0"
+    "SF_EVICTION_S\0"
+    "SF_EVICTION_ANY\0"
+    "BYPASS_CHA_IMC_TAKEN\0"
+    "BYPASS_CHA_IMC_INTERMEDIATE\0"
+    "BYPASS_CHA_IMC_NOT_TAKEN\0"
+    "CBOX_CLOCKTICKS\0"
+    "CORE_PMA_C1_STATE\0"
+    "CORE_PMA_C1_TRANSITION\0"
+    "CORE_PMA_C6_STATE\0"
+    "CORE_PMA_C6_TRANSITION\0"
+    "CORE_PMA_GV\0"
+    "CORE_SNP_EXT_ONE\0"
+    "CORE_SNP_EXT_GTONE\0"
+    "CORE_SNP_EXT_REMOTE\0"
+    "CORE_SNP_CORE_ONE\0"
+    "CORE_SNP_CORE_GTONE\0"
+    "CORE_SNP_CORE_REMOTE\0"
+    "CORE_SNP_EVICT_ONE\0"
+    "CORE_SNP_EVICT_GTONE\0"
+    "CORE_SNP_EVICT_REMOTE\0"
+    "CORE_SNP_ANY_ONE\0"
+    "CORE_SNP_ANY_GTONE\0"
+    "CORE_SNP_ANY_REMOTE\0"
+    "COUNTER0_OCCUPANCY\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0|CBOX18C0|CBOX19C0|CBOX20C0|CBOX21C0|CBOX22C0|CBOX23C0|CBOX24C0|CBOX25C0|CBOX26C0|CBOX27C0\0"
+    "COUNTER0_OCCUPANCY_COUNT\0"
+    "DIR_LOOKUP_SNP\0"
+    "DIR_LOOKUP_NO_SNP\0"
+    "DIR_UPDATE_HA\0"
+    "DIR_UPDATE_TOR\0"
+    "HITME_HIT_EX_RDS\0"
+    "HITME_HIT_SHARED_OWNREQ\0"
+    "HITME_HIT_WBMTOE\0"
+    "HITME_HIT_WBMTOI_OR_S\0"
+    "HITME_LOOKUP_READ\0"
+    "HITME_LOOKUP_WRITE\0"
+    "HITME_MISS_SHARED_RDINVOWN\0"
+    "HITME_MISS_NOTSHARED_RDINVOWN\0"
+    "HITME_MISS_READ_OR_INV\0"
+    "HITME_UPDATE_DEALLOCATE_RSPFWDI_LOC\0"
+    "HITME_UPDATE_RSPFWDI_REM\0"
+    "HITME_UPDATE_SHARED\0"
+    "HITME_UPDATE_RDINVOWN\0"
+    "HITME_UPDATE_DEALLOCATE\0"
+    "IMC_READS_COUNT_NORMAL\0"
+    "IMC_READS_COUNT_PRIORITY\0"
+    "IMC_READS_COUNT_ANY\0"
+    "IMC_WRITES_COUNT_FULL\0"
+    "IMC_WRITES_COUNT_PARTIAL\0"
+    "IMC_WRITES_COUNT_FULL_PRIORITY\0"
+    "IMC_WRITES_COUNT_PARTIAL_PRIORITY\0"
+    "IMC_WRITES_COUNT_FULL_MIG\0"
+    "IMC_WRITES_COUNT_PARTIAL_MIG\0"
+    "IMC_WRITES_COUNT_ANY\0"
+    "IODC_ALLOC_INVITOM\0"
+    "IODC_ALLOC_IODCFULL\0"
+    "IODC_ALLOC_OSBGATED\0"
+    "IODC_DEALLOC_WBMTOE\0"
+    "IODC_DEALLOC_WBMTOI\0"
+    "IODC_DEALLOC_WBPUSHMTOI\0"
+    "IODC_DEALLOC_SNPOUT\0"
+    "IODC_DEALLOC_ALL\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_LOCAL\0"
+    "LLC_LOOKUP_REMOTE\0"
+    "LLC_VICTIMS_M_STATE\0"
+    "LLC_VICTIMS_E_STATE\0"
+    "LLC_VICTIMS_S_STATE\0"
+    "LLC_VICTIMS_F_STATE\0"
+    "LLC_VICTIMS_ANY_STATE\0"
+    "LLC_VICTIMS_LOCAL\0"
+    "LLC_VICTIMS_REMOTE\0"
+    "LLC_VICTIMS_M_LOCAL\0"
+    "LLC_VICTIMS_E_LOCAL\0"
+    "LLC_VICTIMS_S_LOCAL\0"
+    "LLC_VICTIMS_F_LOCAL\0"
+    "LLC_VICTIMS_ANY_LOCAL\0"
+    "LLC_VICTIMS_M_REMOTE\0"
+    "LLC_VICTIMS_E_REMOTE\0"
+    "LLC_VICTIMS_S_REMOTE\0"
+    "LLC_VICTIMS_F_REMOTE\0"
+    "LLC_VICTIMS_ANY_REMOTE\0"
+    "LLC_VICTIMS_M_ANY\0"
+    "LLC_VICTIMS_E_ANY\0"
+    "LLC_VICTIMS_S_ANY\0"
+    "LLC_VICTIMS_F_ANY\0"
+    "LLC_VICTIMS_ANY_ANY\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CVZERO_PREFETCH_VICTIM\0"
+    "MISC_CVZERO_PREFETCH_MISS\0"
+    "OSB_EDR\0"
+    "READ_NO_CREDITS_MC0_SMI0\0"
+    "READ_NO_CREDITS_MC1_SMI1\0"
+    "READ_NO_CREDITS_MC_ALL\0"
+    "READ_NO_CREDITS_EDC0_SMI2\0"
+    "READ_NO_CREDITS_EDC1_SMI3\0"
+    "READ_NO_CREDITS_EDC2_SMI4\0"
+    "READ_NO_CREDITS_EDC3_SMI5\0"
+    "READ_NO_CREDITS_EDC_ALL\0"
+    "WRITE_NO_CREDITS_MC0_SMI0\0"
+    "WRITE_NO_CREDITS_MC1_SMI1\0"
+    "WRITE_NO_CREDITS_MC_ALL\0"
+    "WRITE_NO_CREDITS_EDC0_SMI2\0"
+    "WRITE_NO_CREDITS_EDC1_SMI3\0"
+    "WRITE_NO_CREDITS_EDC2_SMI4\0"
+    "WRITE_NO_CREDITS_EDC3_SMI5\0"
+    "WRITE_NO_CREDITS_EDC_ALL\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "REQUESTS_INVITOE\0"
+    "RXC_INSERTS_IRQ\0"
+    "RXC_INSERTS_IRQ_REJ\0"
+    "RXC_INSERTS_IPQ\0"
+    "RXC_INSERTS_PRQ\0"
+    "RXC_INSERTS_PRQ_REJ\0"
+    "RXC_INSERTS_RRQ\0"
+    "RXC_INSERTS_WBQ\0"
+    "RXC_IPQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IPQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IPQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IPQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IPQ1_REJECT_ANY0\0"
+    "RXC_IPQ1_REJECT_HA\0"
+    "RXC_IPQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IPQ1_REJECT_SF_VICTIM\0"
+    "RXC_IPQ1_REJECT_VICTIM\0"
+    "RXC_IPQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IPQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IPQ1_REJECT_PA_MATCH\0"
+    "RXC_IRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IRQ1_REJECT_ANY0\0"
+    "RXC_IRQ1_REJECT_HA\0"
+    "RXC_IRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IRQ1_REJECT_SF_VICTIM\0"
+    "RXC_IRQ1_REJECT_VICTIM\0"
+    "RXC_IRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IRQ1_REJECT_PA_MATCH\0"
+    "RXC_ISMQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_ISMQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_WB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_ISMQ0_REJECT_AK_NON_UPI\0"
+    "RXC_ISMQ0_REJECT_IV_NON_UPI\0"
+    "RXC_ISMQ1_REJECT_ANY0\0"
+    "RXC_ISMQ1_REJECT_HA\0"
+    "RXC_ISMQ0_RETRY_AD_REQ_VN0\0"
+    "RXC_ISMQ0_RETRY_AD_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_WB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCS_VN0\0"
+    "RXC_ISMQ0_RETRY_AK_NON_UPI\0"
+    "RXC_ISMQ0_RETRY_IV_NON_UPI\0"
+    "RXC_ISMQ1_RETRY_ANY0\0"
+    "RXC_ISMQ1_RETRY_HA\0"
+    "RXC_OCCUPANCY_IRQ\0"
+    "RXC_OCCUPANCY_IPQ\0"
+    "RXC_OCCUPANCY_RRQ\0"
+    "RXC_OCCUPANCY_WBQ\0"
+    "RXC_OTHER0_RETRY_AD_REQ_VN0\0"
+    "RXC_OTHER0_RETRY_AD_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_WB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCS_VN0\0"
+    "RXC_OTHER0_RETRY_AK_NON_UPI\0"
+    "RXC_OTHER0_RETRY_IV_NON_UPI\0"
+    "RXC_OTHER1_REJECT_ANY0\0"
+    "RXC_OTHER1_REJECT_HA\0"
+    "RXC_OTHER1_REJECT_LLC_VICTIM\0"
+    "RXC_OTHER1_REJECT_SF_VICTIM\0"
+    "RXC_OTHER1_REJECT_VICTIM\0"
+    "RXC_OTHER1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_OTHER1_REJECT_ALLOW_SNP\0"
+    "RXC_OTHER1_REJECT_PA_MATCH\0"
+    "RXC_PRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_PRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_PRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_PRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_PRQ1_REJECT_ANY0\0"
+    "RXC_PRQ1_REJECT_HA\0"
+    "RXC_PRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_PRQ1_REJECT_SF_VICTIM\0"
+    "RXC_PRQ1_REJECT_VICTIM\0"
+    "RXC_PRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_PRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_PRQ1_REJECT_PA_MATCH\0"
+    "RXC_REQ_Q0_RETRY_AD_REQ_VN0\0"
+    "RXC_REQ_Q0_RETRY_AD_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_WB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCS_VN0\0"
+    "RXC_REQ_Q0_RETRY_AK_NON_UPI\0"
+    "RXC_REQ_Q0_RETRY_IV_NON_UPI\0"
+    "RXC_REQ_Q1_RETRY_ANY0\0"
+    "RXC_REQ_Q1_RETRY_HA\0"
+    "RXC_REQ_Q1_RETRY_LLC_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_SF_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_LLC_OR_SF_WAY\0"
+    "RXC_REQ_Q1_RETRY_ALLOW_SNP\0"
+    "RXC_REQ_Q1_RETRY_PA_MATCH\0"
+    "RXC_RRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_RRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_RRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_RRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_RRQ1_REJECT_ANY0\0"
+    "RXC_RRQ1_REJECT_HA\0"
+    "RXC_RRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_RRQ1_REJECT_SF_VICTIM\0"
+    "RXC_RRQ1_REJECT_VICTIM\0"
+    "RXC_RRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_RRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_RRQ1_REJECT_PA_MATCH\0"
+    "RXC_WBQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_WBQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_WB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_WBQ0_REJECT_AK_NON_UPI\0"
+    "RXC_WBQ0_REJECT_IV_NON_UPI\0"
+    "RXC_WBQ1_REJECT_ANY0\0"
+    "RXC_WBQ1_REJECT_HA\0"
+    "RXC_WBQ1_REJECT_LLC_VICTIM\0"
+    "RXC_WBQ1_REJECT_SF_VICTIM\0"
+    "RXC_WBQ1_REJECT_VICTIM\0"
+    "RXC_WBQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_WBQ1_REJECT_ALLOW_SNP\0"
+    "RXC_WBQ1_REJECT_PA_MATCH\0"
+    "SNOOPS_SENT_ALL\0"
+    "SNOOPS_SENT_LOCAL\0"
+    "SNOOPS_SENT_REMOTE\0"
+    "SNOOPS_SENT_BCST_LOCAL\0"
+    "SNOOPS_SENT_BCST_REMOTE\0"
+    "SNOOPS_SENT_DIRECT_LOCAL\0"
+    "SNOOPS_SENT_DIRECT_REMOTE\0"
+    "SNOOPS_RESP_RSPI\0"
+    "SNOOPS_RESP_RSPS\0"
+    "SNOOPS_RESP_RSPIFWD\0"
+    "SNOOPS_RESP_RSPSFWD\0"
+    "SNOOPS_RESP_RSP_WBWB\0"
+    "SNOOPS_RESP_RSP_FWD_WB\0"
+    "SNOOPS_RESP_RSPCNFLCTS\0"
+    "SNOOPS_RESP_RSPFWD\0"
+    "SNOOPS_RESP_LOCAL_RSPI\0"
+    "SNOOPS_RESP_LOCAL_RSPS\0"
+    "SNOOPS_RESP_LOCAL_RSPIFWD\0"
+    "SNOOPS_RESP_LOCAL_RSPSFWD\0"
+    "SNOOPS_RESP_LOCAL_RSP_WBWB\0"
+    "SNOOPS_RESP_LOCAL_RSP_FWD_WB\0"
+    "SNOOPS_RESP_LOCAL_RSPCNFLCTS\0"
+    "SNOOPS_RESP_LOCAL_RSPFWD\0"
+    "TOR_INSERTS_IRQ\0"
+    "TOR_INSERTS_EVICT\0"
+    "TOR_INSERTS_PRQ\0"
+    "TOR_INSERTS_IPQ\0"
+    "TOR_INSERTS_HIT\0"
+    "TOR_INSERTS_IA_HIT\0"
+    "TOR_INSERTS_IO_HIT\0"
+    "TOR_INSERTS_ALL_HIT\0"
+    "TOR_INSERTS_MISS\0"
+    "TOR_INSERTS_IA_MISS\0"
+    "TOR_INSERTS_IO_MISS\0"
+    "TOR_INSERTS_ALL_MISS\0"
+    "TOR_INSERTS_IA\0"
+    "TOR_INSERTS_IO\0"
+    "TOR_INSERTS_ALL_IO_IA\0"
+    "TOR_OCCUPANCY_IRQ\0"
+    "TOR_OCCUPANCY_EVICT\0"
+    "TOR_OCCUPANCY_PRQ\0"
+    "TOR_OCCUPANCY_IPQ\0"
+    "TOR_OCCUPANCY_HIT\0"
+    "TOR_OCCUPANCY_IA_HIT\0"
+    "TOR_OCCUPANCY_IO_HIT\0"
+    "TOR_OCCUPANCY_ALL_HIT\0"
+    "TOR_OCCUPANCY_MISS\0"
+    "TOR_OCCUPANCY_IA_MISS\0"
+    "TOR_OCCUPANCY_IO_MISS\0"
+    "TOR_OCCUPANCY_ALL_MISS\0"
+    "TOR_OCCUPANCY_IA\0"
+    "TOR_OCCUPANCY_IO\0"
+    "WB_PUSH_MTOI_LLC\0"
+    "WB_PUSH_MTOI_MEM\0"
+    "XSNP_RESP_EXT_RSP_HITFSE\0"
+    "XSNP_RESP_EXT_RSPS_FWDFE\0"
+    "XSNP_RESP_EXT_RSPI_FWDFE\0"
+    "XSNP_RESP_EXT_RSPS_FWDM\0"
+    "XSNP_RESP_EXT_RSPI_FWDM\0"
+    "XSNP_RESP_CORE_RSP_HITFSE\0"
+    "XSNP_RESP_CORE_RSPS_FWDFE\0"
+    "XSNP_RESP_CORE_RSPI_FWDFE\0"
+    "XSNP_RESP_CORE_RSPS_FWDM\0"
+    "XSNP_RESP_CORE_RSPI_FWDM\0"
+    "XSNP_RESP_EVICT_RSP_HITFSE\0"
+    "XSNP_RESP_EVICT_RSPS_FWDFE\0"
+    "XSNP_RESP_EVICT_RSPI_FWDFE\0"
+    "XSNP_RESP_EVICT_RSPS_FWDM\0"
+    "XSNP_RESP_EVICT_RSPI_FWDM\0"
+    "XSNP_RESP_ANY_RSP_HITFSE\0"
+    "XSNP_RESP_ANY_RSPS_FWDFE\0"
+    "XSNP_RESP_ANY_RSPI_FWDFE\0"
+    "XSNP_RESP_ANY_RSPS_FWDM\0"
+    "ACT_COUNT_RD\0"
+    "MBOX\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "CAS_COUNT_RD_ISOCH\0"
+    "CAS_COUNT_WR_ISOCH\0"
+    "PMM_RPQ_OCCUPANCY_ALL\0"
+    "PMM_RPQ_INSERTS\0"
+    "PMM_CMD1_ALL\0"
+    "PMM_CMD1_RD\0"
+    "PMM_CMD1_WR\0"
+    "PMM_CMD1_UFILL_RD\0"
+    "PMM_WPQ_OCCUPANCY_ALL\0"
+    "PMM_WPQ_INSERTS\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_SELF_REFRESH\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_RD\0"
+    "RPQ_INSERTS\0"
+    "RPQ_OCCUPANCY\0"
+    "M_TAGCHK_HIT\0"
+    "M_TAGCHK_MISS_CLEAN\0"
+    "M_TAGCHK_MISS_DIRTY\0"
+    "WPQ_INSERTS\0"
+    "WPQ_OCCUPANCY\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX3FIX|MBOX4FIX|MBOX5FIX\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE_TRANSITION_CYCLES\0"
+    "CTS_EVENT0\0"
+    "CTS_EVENT1\0"
+    "DEMOTIONS\0"
+    "FIVR_PS_PS0_CYCLES\0"
+    "FIVR_PS_PS1_CYCLES\0"
+    "FIVR_PS_PS2_CYCLES\0"
+    "FIVR_PS_PS3_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MCP_PROCHOT_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "PKG_RESIDENCY_C0_CYCLES\0"
+    "PKG_RESIDENCY_C2E_CYCLES\0"
+    "PKG_RESIDENCY_C3_CYCLES\0"
+    "PKG_RESIDENCY_C6_CYCLES\0"
+    "PMAX_THROTTLED_CYCLES\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VR_HOT_CYCLES\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "CORES_IN_P3\0"
+    "WBOX2FIX\0"
+    "CORES_IN_P6\0"
+    "WBOX3FIX\0"
+    "M2M_CLOCKTICKS\0"
+    "M2M\0"
+    "BYPASS_M2M_EGRESS_TAKEN\0"
+    "BYPASS_M2M_EGRESS_NOT_TAKEN\0"
+    "BYPASS_M2M_INGRESS_TAKEN\0"
+    "BYPASS_M2M_INGRESS_NOT_TAKEN\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "DIRECT2CORE_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2CORE_TAKEN\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECT2UPI_NOT_TAKEN_CREDITS\0"
+    "DIRECT2UPI_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2UPI_TAKEN\0"
+    "DIRECT2UPI_TXN_OVERRIDE\0"
+    "DIRECTORY_HIT_DIRTY_I\0"
+    "DIRECTORY_HIT_DIRTY_S\0"
+    "DIRECTORY_HIT_DIRTY_P\0"
+    "DIRECTORY_HIT_DIRTY_A\0"
+    "DIRECTORY_HIT_CLEAN_I\0"
+    "DIRECTORY_HIT_CLEAN_S\0"
+    "DIRECTORY_HIT_CLEAN_P\0"
+    "DIRECTORY_HIT_CLEAN_A\0"
+    "DIRECTORY_LOOKUP_ANY\0"
+    "DIRECTORY_LOOKUP_STATE_I\0"
+    "DIRECTORY_LOOKUP_STATE_S\0"
+    "DIRECTORY_LOOKUP_STATE_A\0"
+    "DIRECTORY_MISS_DIRTY_I\0"
+    "DIRECTORY_MISS_DIRTY_S\0"
+    "DIRECTORY_MISS_DIRTY_P\0"
+    "DIRECTORY_MISS_DIRTY_A\0"
+    "DIRECTORY_MISS_CLEAN_I\0"
+    "DIRECTORY_MISS_CLEAN_S\0"
+    "DIRECTORY_MISS_CLEAN_P\0"
+    "DIRECTORY_MISS_CLEAN_A\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "DIRECTORY_UPDATE_I2S\0"
+    "DIRECTORY_UPDATE_I2A\0"
+    "DIRECTORY_UPDATE_S2I\0"
+    "DIRECTORY_UPDATE_S2A\0"
+    "DIRECTORY_UPDATE_A2I\0"
+    "DIRECTORY_UPDATE_A2S\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_READS_ISOCH\0"
+    "IMC_READS_ALL\0"
+    "IMC_READS_TO_DDRT\0"
+    "IMC_READS_TO_PMM\0"
+    "IMC_READS_FROM_TRANSGRESS\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "IMC_WRITES_TO_DDRT\0"
+    "IMC_WRITES_TO_PMM\0"
+    "IMC_WRITES_FROM_TRANSGRESS\0"
+    "IMC_WRITES_NI\0"
+    "PCOMMITS\0"
+    "PCOMMIT_COALESCED\0"
+    "PKT_MATCH_MESH\0"
+    "PKT_MATCH_MC\0"
+    "PREFCAM_CYCLES_FULL\0"
+    "PREFCAM_CYCLES_NE\0"
+    "PREFCAM_DEMAND_PROMOTIONS\0"
+    "PREFCAM_INSERTS\0"
+    "PREFCAM_OCCUPANCY\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN0\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN1\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN2\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN0\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN1\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN2\0"
+    "RXC_AD_CYCLES_FULL\0"
+    "RXC_AD_CYCLES_NE\0"
+    "RXC_AD_INSERTS\0"
+    "RXC_AD_OCCUPANCY\0"
+    "RXC_BL_CYCLES_FULL\0"
+    "RXC_BL_CYCLES_NE\0"
+    "RXC_BL_INSERTS\0"
+    "RXC_BL_OCCUPANCY\0"
+    "SCOREBOARD_AD_RETRY_ACCEPTS\0"
+    "SCOREBOARD_AD_RETRY_REJECTS\0"
+    "SCOREBOARD_BL_RETRY_ACCEPTS\0"
+    "SCOREBOARD_BL_RETRY_REJECTS\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN0\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN1\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN2\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "SCOREBOARD_RD_RETRY_ACCEPTS\0"
+    "SCOREBOARD_RD_RETRY_REJECTS\0"
+    "SCOREBOARD_WR_RETRY_ACCEPTS\0"
+    "SCOREBOARD_WR_RETRY_REJECTS\0"
+    "TAG_HIT_NM_DRD_HIT_CLEAN\0"
+    "TAG_HIT_NM_DRD_HIT_DIRTY\0"
+    "TAG_HIT_NM_UFILL_HIT_CLEAN\0"
+    "TAG_HIT_NM_UFILL_HIT_DIRTY\0"
+    "TGR_AD_CREDITS\0"
+    "TGR_BL_CREDITS\0"
+    "TRACKER_CYCLES_FULL_CHN0\0"
+    "TRACKER_CYCLES_FULL_CHN1\0"
+    "TRACKER_CYCLES_FULL_CHN2\0"
+    "TRACKER_CYCLES_FULL_ALL\0"
+    "TRACKER_CYCLES_NE_CHN0\0"
+    "TRACKER_CYCLES_NE_CHN1\0"
+    "TRACKER_CYCLES_NE_CHN2\0"
+    "TRACKER_CYCLES_NE_ALL\0"
+    "TRACKER_CYCLES_INSERTS_CHN0\0"
+    "TRACKER_CYCLES_INSERTS_CHN1\0"
+    "TRACKER_CYCLES_INSERTS_CHN2\0"
+    "TRACKER_CYCLES_INSERTS_ALL\0"
+    "TRACKER_PENDING_OCCUPANCY\0"
+    "TXC_AD_CREDITS_ACQUIRED\0"
+    "TXC_AD_CREDITS_OCCUPANCY\0"
+    "TXC_AD_CYCLES_FULL\0"
+    "TXC_AD_CYCLES_NE\0"
+    "TXC_AD_INSERTS\0"
+    "TXC_AD_NO_CREDIT_CYCLES\0"
+    "TXC_AD_NO_CREDIT_STALLED\0"
+    "TXC_AD_OCCUPANCY\0"
+    "TXC_AK_NDR\0"
+    "TXC_AK_CRD_CBO\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_AK_CREDITS_ACQUIRED_ALL\0"
+    "TXC_AK_CREDITS_OCCUPANCY_CMS0\0"
+    "TXC_AK_CREDITS_OCCUPANCY_CMS1\0"
+    "TXC_AK_CREDITS_OCCUPANCY_ALL\0"
+    "TXC_AK_CYCLES_FULL_CMS0\0"
+    "TXC_AK_CYCLES_FULL_CMS1\0"
+    "TXC_AK_CYCLES_FULL_ALL\0"
+    "TXC_AK_CYCLES_FULL_PCOMMIT\0"
+    "TXC_AK_CYCLES_FULL_RDCRD0\0"
+    "TXC_AK_CYCLES_FULL_WRCRD0\0"
+    "TXC_AK_CYCLES_FULL_WRCMP0\0"
+    "TXC_AK_CYCLES_FULL_RDCRD1\0"
+    "TXC_AK_CYCLES_FULL_WRCRD1\0"
+    "TXC_AK_CYCLES_FULL_WRCMP1\0"
+    "TXC_AK_CYCLES_NE_CMS0\0"
+    "TXC_AK_CYCLES_NE_CMS1\0"
+    "TXC_AK_CYCLES_NE_ALL\0"
+    "TXC_AK_CYCLES_NE_PCOMMIT\0"
+    "TXC_AK_CYCLES_NE_RDCRD\0"
+    "TXC_AK_CYCLES_NE_WRCRD\0"
+    "TXC_AK_CYCLES_NE_WRCMP\0"
+    "TXC_AK_INSERTS_CMS0\0"
+    "TXC_AK_INSERTS_CMS1\0"
+    "TXC_AK_INSERTS_ALL\0"
+    "TXC_AK_INSERTS_WRCRD\0"
+    "TXC_AK_INSERTS_RDCRD\0"
+    "TXC_AK_INSERTS_WRCMP\0"
+    "TXC_AK_INSERTS_PREF_RD_CAM_HIT\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_AK_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_AK_NO_CREDIT_STALLED_ALL\0"
+    "TXC_AK_OCCUPANCY_CMS0\0"
+    "TXC_AK_OCCUPANCY_CMS1\0"
+    "TXC_AK_OCCUPANCY_ALL\0"
+    "TXC_AK_OCCUPANCY_PCOMMIT\0"
+    "TXC_AK_OCCUPANCY_RDCRD\0"
+    "TXC_AK_OCCUPANCY_WRCRD\0"
+    "TXC_AK_OCCUPANCY_WRCMP\0"
+    "TXC_AK_SIDEBAND_RD\0"
+    "TXC_AK_SIDEBAND_WR\0"
+    "TXC_BL_DRS_CACHE\0"
+    "TXC_BL_DRS_CORE\0"
+    "TXC_BL_DRS_UPI\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_BL_CREDITS_ACQUIRED_ALL\0"
+    "TXC_BL_CREDITS_OCCUPANCY_CMS0\0"
+    "TXC_BL_CREDITS_OCCUPANCY_CMS1\0"
+    "TXC_BL_CREDITS_OCCUPANCY_ALL\0"
+    "TXC_BL_CYCLES_FULL_CMS0\0"
+    "TXC_BL_CYCLES_FULL_CMS1\0"
+    "TXC_BL_CYCLES_FULL_ALL\0"
+    "TXC_BL_CYCLES_NE_CMS0\0"
+    "TXC_BL_CYCLES_NE_CMS1\0"
+    "TXC_BL_CYCLES_NE_ALL\0"
+    "TXC_BL_INSERTS_CMS0\0"
+    "TXC_BL_INSERTS_CMS1\0"
+    "TXC_BL_INSERTS_ALL\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_BL_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_BL_NO_CREDIT_STALLED_ALL\0"
+    "TXC_BL_OCCUPANCY_CMS0\0"
+    "TXC_BL_OCCUPANCY_CMS1\0"
+    "TXC_BL_OCCUPANCY_ALL\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_REG_CREDITS_ALL\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_ALL\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN0\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN1\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN2\0"
+    "WPQ_CYCLES_SPEC_CREDITS_ALL\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN0\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN1\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN2\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_ALL\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH0\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH1\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH2\0"
+    "WRITE_TRACKER_CYCLES_FULL_ALL\0"
+    "WRITE_TRACKER_CYCLES_NE_CH0\0"
+    "WRITE_TRACKER_CYCLES_NE_CH1\0"
+    "WRITE_TRACKER_CYCLES_NE_CH2\0"
+    "WRITE_TRACKER_CYCLES_NE_ALL\0"
+    "WRITE_TRACKER_INSERTS_CH0\0"
+    "WRITE_TRACKER_INSERTS_CH1\0"
+    "WRITE_TRACKER_INSERTS_CH2\0"
+    "WRITE_TRACKER_INSERTS_ALL\0"
+    "WRITE_TRACKER_OCCUPANCY_CH0\0"
+    "WRITE_TRACKER_OCCUPANCY_CH1\0"
+    "WRITE_TRACKER_OCCUPANCY_CH2\0"
+    "WRITE_TRACKER_OCCUPANCY_ALL\0"
+    "SBOX_CLOCKTICKS\0"
+    "SBOX\0"
+    "DIRECT_ATTEMPTS_D2C\0"
+    "DIRECT_ATTEMPTS_D2K\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ0\0"
+    "SBOX|CBOX|PBOX\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_BL_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ3\0"
+    "L1_POWER_CYCLES\0"
+    "M3_BYP_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_BYP_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_BYP_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_BYP_BLOCKED_BGF_CRD\0"
+    "M3_BYP_BLOCKED_GV_BLOCK\0"
+    "M3_CRD_RETURN_BLOCKED\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_BTW_2_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_BTW_0_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_RXQ_BLOCKED_BGF_CRD\0"
+    "M3_RXQ_BLOCKED_GV_BLOCK\0"
+    "PHY_INIT_CYCLES\0"
+    "POWER_L1_NACK\0"
+    "POWER_L1_REQ\0"
+    "REQ_SLOT2_FROM_M3_VNA\0"
+    "REQ_SLOT2_FROM_M3_VN0\0"
+    "REQ_SLOT2_FROM_M3_VN1\0"
+    "REQ_SLOT2_FROM_M3_ACK\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0P_POWER_TRANSITION_COUNT\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_BASIC_HDR_MATCH_REQ\0"
+    "RXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "RXL_BASIC_HDR_MATCH_SNP\0"
+    "RXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_WB\0"
+    "RXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCB\0"
+    "RXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCS\0"
+    "RXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "RXL_BYPASSED_SLOT0\0"
+    "RXL_BYPASSED_SLOT1\0"
+    "RXL_BYPASSED_SLOT2\0"
+    "RXL_CREDITS_CONSUMED_VN0\0"
+    "RXL_CREDITS_CONSUMED_VN1\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_FLITS_SLOT0\0"
+    "RXL_FLITS_SLOT1\0"
+    "RXL_FLITS_SLOT2\0"
+    "RXL_FLITS_DATA\0"
+    "RXL_FLITS_ALL_DATA\0"
+    "RXL_FLITS_LLCRD\0"
+    "RXL_FLITS_NULL\0"
+    "RXL_FLITS_LLCTRL\0"
+    "RXL_FLITS_IDLE\0"
+    "RXL_FLITS_PROTHDR\0"
+    "RXL_FLITS_NON_DATA\0"
+    "RXL_INSERTS\0"
+    "RXL_OCCUPANCY_SLOT0\0"
+    "RXL_OCCUPANCY_SLOT1\0"
+    "RXL_OCCUPANCY_SLOT2\0"
+    "RXL_SLOT_BYPASS_S0_RXQ1\0"
+    "RXL_SLOT_BYPASS_S0_RXQ2\0"
+    "RXL_SLOT_BYPASS_S1_RXQ0\0"
+    "RXL_SLOT_BYPASS_S1_RXQ2\0"
+    "RXL_SLOT_BYPASS_S2_RXQ0\0"
+    "RXL_SLOT_BYPASS_S2_RXQ1\0"
+    "TXL0P_CLK_ACTIVE_CFG_CTL\0"
+    "TXL0P_CLK_ACTIVE_RXQ\0"
+    "TXL0P_CLK_ACTIVE_RXQ_BYPASS\0"
+    "TXL0P_CLK_ACTIVE_RXQ_CRED\0"
+    "TXL0P_CLK_ACTIVE_TXQ\0"
+    "TXL0P_CLK_ACTIVE_RETRY\0"
+    "TXL0P_CLK_ACTIVE_DFX\0"
+    "TXL0P_CLK_ACTIVE_SPARE\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0P_POWER_TRANSITION_COUNT\0"
+    "TXL0P_POWER_CYCLES_LL_ENTER\0"
+    "TXL0P_POWER_CYCLES_M3_EXIT\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BASIC_HDR_MATCH_REQ\0"
+    "TXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "TXL_BASIC_HDR_MATCH_SNP\0"
+    "TXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_WB\0"
+    "TXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCB\0"
+    "TXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCS\0"
+    "TXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "TXL_BYPASSED\0"
+    "TXL_FLITS_SLOT0\0"
+    "TXL_FLITS_SLOT1\0"
+    "TXL_FLITS_SLOT2\0"
+    "TXL_FLITS_DATA\0"
+    "TXL_FLITS_ALL_DATA\0"
+    "TXL_FLITS_LLCRD\0"
+    "TXL_FLITS_NULL\0"
+    "TXL_FLITS_LLCTRL\0"
+    "TXL_FLITS_IDLE\0"
+    "TXL_FLITS_PROTHDR\0"
+    "TXL_FLITS_NON_DATA\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY_SLOT0\0"
+    "TXL_OCCUPANCY_SLOT1\0"
+    "TXL_OCCUPANCY_SLOT2\0"
+    "VNA_CREDIT_RETURN_BLOCKED_VN01\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDITS_ACQUIRED_DRS_0\0"
+    "IIO_CREDITS_ACQUIRED_DRS_1\0"
+    "IIO_CREDITS_ACQUIRED_NCB_0\0"
+    "IIO_CREDITS_ACQUIRED_NCB_1\0"
+    "IIO_CREDITS_ACQUIRED_NCS_0\0"
+    "IIO_CREDITS_ACQUIRED_NCS_1\0"
+    "IIO_CREDITS_REJECT_DRS\0"
+    "IIO_CREDITS_REJECT_NCB\0"
+    "IIO_CREDITS_REJECT_NCS\0"
+    "IIO_CREDITS_USED_DRS_0\0"
+    "IIO_CREDITS_USED_DRS_1\0"
+    "IIO_CREDITS_USED_NCB_0\0"
+    "IIO_CREDITS_USED_NCB_1\0"
+    "IIO_CREDITS_USED_NCS_0\0"
+    "IIO_CREDITS_USED_NCS_1\0"
+    "RXC_CYCLES_NE_CBO_IDI\0"
+    "RXC_CYCLES_NE_CBO_NCB\0"
+    "RXC_CYCLES_NE_CBO_NCS\0"
+    "RXC_CYCLES_NE_QPI_INCS\0"
+    "RXC_CYCLES_NE_IIO_INCB\0"
+    "RXC_CYCLES_NE_IIO_INCS\0"
+    "RXC_CYCLES_NE_ALL\0"
+    "RXC_INSERTS_CBO_IDI\0"
+    "RXC_INSERTS_CBO_NCB\0"
+    "RXC_INSERTS_CBO_NCS\0"
+    "RXC_INSERTS_QPI_INCS\0"
+    "RXC_INSERTS_IIO_INCB\0"
+    "RXC_INSERTS_IIO_INCS\0"
+    "RXC_INSERTS_ALL\0"
+    "RXC_OCCUPANCY_CBO_IDI\0"
+    "PBOX0C0|PBOX1C0|PBOX2C0|PBOX3C0\0"
+    "RXC_OCCUPANCY_CBO_NCB\0"
+    "RXC_OCCUPANCY_CBO_NCS\0"
+    "RXC_OCCUPANCY_QPI_INCS\0"
+    "RXC_OCCUPANCY_IIO_INCB\0"
+    "RXC_OCCUPANCY_IIO_INCS\0"
+    "RXC_OCCUPANCY_ALL\0"
+    "TXC_CREDITS_PRQ_0\0"
+    "PBOX0C0|PBOX1C0|PBOX2C0|PBOX3C0|PBOX0C1|PBOX1C1|PBOX2C1|PBOX3C1\0"
+    "TXC_CREDITS_PRQ_1\0"
+    "TXC_CREDITS_ISOCH_0\0"
+    "TXC_CREDITS_ISOCH_1\0"
+    "TXC_CYCLES_FULL_AD_0\0"
+    "TXC_CYCLES_FULL_AK_0\0"
+    "TXC_CYCLES_FULL_BL_0\0"
+    "TXC_CYCLES_FULL_AD_1\0"
+    "TXC_CYCLES_FULL_AK_1\0"
+    "TXC_CYCLES_FULL_BL_1\0"
+    "TXC_CYCLES_NE_AD_0\0"
+    "TXC_CYCLES_NE_AK_0\0"
+    "TXC_CYCLES_NE_BL_0\0"
+    "TXC_CYCLES_NE_AD_1\0"
+    "TXC_CYCLES_NE_AK_1\0"
+    "TXC_CYCLES_NE_BL_1\0"
+    "TXC_INSERTS_AD_0\0"
+    "TXC_INSERTS_AK_0\0"
+    "TXC_INSERTS_BL_0\0"
+    "TXC_INSERTS_AK_CRD_0\0"
+    "TXC_INSERTS_AD_1\0"
+    "TXC_INSERTS_AK_1\0"
+    "TXC_INSERTS_BL_1\0"
+    "TXC_INSERTS_AK_CRD_1\0"
+    "TXC_OCCUPANCY_AD_0\0"
+    "TXC_OCCUPANCY_AK_0\0"
+    "TXC_OCCUPANCY_BL_0\0"
+    "TXC_OCCUPANCY_AD_1\0"
+    "TXC_OCCUPANCY_AK_1\0"
+    "TXC_OCCUPANCY_BL_1\0"
+    "RBOX_CLOCKTICKS\0"
+    "RBOX\0"
+    "CHA_AD_CREDITS_EMPTY_VNA\0"
+    "CHA_AD_CREDITS_EMPTY_WB\0"
+    "CHA_AD_CREDITS_EMPTY_REQ\0"
+    "CHA_AD_CREDITS_EMPTY_SNP\0"
+    "D2C_SENT\0"
+    "D2U_SENT\0"
+    "M2_BL_CREDITS_EMPTY_IIO0_IIO1_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO2_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO3_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO4_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO5_NCB\0"
+    "M2_BL_CREDITS_EMPTY_NCS\0"
+    "M2_BL_CREDITS_EMPTY_NCS_SEL\0"
+    "MULTI_SLOT_RCVD_AD_SLOT0\0"
+    "MULTI_SLOT_RCVD_AD_SLOT1\0"
+    "MULTI_SLOT_RCVD_AD_SLOT2\0"
+    "MULTI_SLOT_RCVD_BL_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT2\0"
+    "RXC_ARB_LOST_VN0_AD_REQ\0"
+    "RXC_ARB_LOST_VN0_AD_SNP\0"
+    "RXC_ARB_LOST_VN0_AD_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_WB\0"
+    "RXC_ARB_LOST_VN0_BL_NCB\0"
+    "RXC_ARB_LOST_VN0_BL_NCS\0"
+    "RXC_ARB_LOST_VN1_AD_REQ\0"
+    "RXC_ARB_LOST_VN1_AD_SNP\0"
+    "RXC_ARB_LOST_VN1_AD_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_WB\0"
+    "RXC_ARB_LOST_VN1_BL_NCB\0"
+    "RXC_ARB_LOST_VN1_BL_NCS\0"
+    "RXC_ARB_MISC_PAR_BIAS_VN0\0"
+    "RXC_ARB_MISC_PAR_BIAS_VN1\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN1\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN1\0"
+    "RXC_ARB_MISC_ADBL_PARALLEL_WIN\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_REQ\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_SNP\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_WB\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_NCB\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_NCS\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_REQ\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_SNP\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_WB\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_NCB\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_NCS\0"
+    "RXC_ARB_NOCRED_VN0_AD_REQ\0"
+    "RXC_ARB_NOCRED_VN0_AD_SNP\0"
+    "RXC_ARB_NOCRED_VN0_AD_RSP\0"
+    "RXC_ARB_NOCRED_VN0_BL_RSP\0"
+    "RXC_ARB_NOCRED_VN0_BL_WB\0"
+    "RXC_ARB_NOCRED_VN0_BL_NCB\0"
+    "RXC_ARB_NOCRED_VN0_BL_NCS\0"
+    "RXC_ARB_NOCRED_VN1_AD_REQ\0"
+    "RXC_ARB_NOCRED_VN1_AD_SNP\0"
+    "RXC_ARB_NOCRED_VN1_AD_RSP\0"
+    "RXC_ARB_NOCRED_VN1_BL_RSP\0"
+    "RXC_ARB_NOCRED_VN1_BL_WB\0"
+    "RXC_ARB_NOCRED_VN1_BL_NCB\0"
+    "RXC_ARB_NOCRED_VN1_BL_NCS\0"
+    "RXC_BYPASSED_AD_S0_IDLE\0"
+    "RXC_BYPASSED_AD_S0_BL_ARB\0"
+    "RXC_BYPASSED_AD_S1_BL_SLOT\0"
+    "RXC_BYPASSED_AD_S2_BL_SLOT\0"
+    "RXC_COLLISION_VN0_AD_REQ\0"
+    "RXC_COLLISION_VN0_AD_SNP\0"
+    "RXC_COLLISION_VN0_AD_RSP\0"
+    "RXC_COLLISION_VN0_BL_RSP\0"
+    "RXC_COLLISION_VN0_BL_WB\0"
+    "RXC_COLLISION_VN0_BL_NCB\0"
+    "RXC_COLLISION_VN0_BL_NCS\0"
+    "RXC_COLLISION_VN1_AD_REQ\0"
+    "RXC_COLLISION_VN1_AD_SNP\0"
+    "RXC_COLLISION_VN1_AD_RSP\0"
+    "RXC_COLLISION_VN1_BL_RSP\0"
+    "RXC_COLLISION_VN1_BL_WB\0"
+    "RXC_COLLISION_VN1_BL_NCB\0"
+    "RXC_COLLISION_VN1_BL_NCS\0"
+    "RXC_CRD_MISC_ANY_BGF_FIFO\0"
+    "RXC_CRD_MISC_ANY_BGF_PATH\0"
+    "RXC_CRD_MISC_NO_D2K_FOR_ARB\0"
+    "RXC_CRD_OCC_VNA_IN_USE\0"
+    "RXC_CRD_OCC_FLITS_IN_FIFO\0"
+    "RXC_CRD_OCC_FLITS_IN_PATH\0"
+    "RXC_CRD_OCC_TXQ_CRD\0"
+    "RXC_CRD_OCC_D2K_CRD\0"
+    "RXC_CRD_OCC_P1P_TOTAL\0"
+    "RXC_CRD_OCC_P1P_FIFO\0"
+    "RXC_CYCLES_NE_VN0_AD_REQ\0"
+    "RXC_CYCLES_NE_VN0_AD_SNP\0"
+    "RXC_CYCLES_NE_VN0_AD_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_WB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCS\0"
+    "RXC_CYCLES_NE_VN1_AD_REQ\0"
+    "RXC_CYCLES_NE_VN1_AD_SNP\0"
+    "RXC_CYCLES_NE_VN1_AD_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_WB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCS\0"
+    "RXC_FLITS_DATA_NOT_SENT_ALL\0"
+    "RXC_FLITS_DATA_NOT_SENT_NO_BGF\0"
+    "RXC_FLITS_DATA_NOT_SENT_NO_TXQ\0"
+    "RXC_FLITS_GEN_BL_P0_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1P_TO_LIMBO\0"
+    "RXC_FLITS_GEN_BL_P1P_BUSY\0"
+    "RXC_FLITS_GEN_BL_P1P_AT_LIMIT\0"
+    "RXC_FLITS_GEN_BL_P1P_HOLD_P0\0"
+    "RXC_FLITS_GEN_BL_P1P_FIFO_FULL\0"
+    "RXC_FLITS_MISC\0"
+    "RXC_FLITS_SENT_1_MSG\0"
+    "RXC_FLITS_SENT_2_MSGS\0"
+    "RXC_FLITS_SENT_3_MSGS\0"
+    "RXC_FLITS_SENT_1_MSG_VNX\0"
+    "RXC_FLITS_SENT_SLOTS_1\0"
+    "RXC_FLITS_SENT_SLOTS_2\0"
+    "RXC_FLITS_SENT_SLOTS_3\0"
+    "RXC_FLITS_SLOT_BL_ALL\0"
+    "RXC_FLITS_SLOT_BL_NEED_DATA\0"
+    "RXC_FLITS_SLOT_BL_P0_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_BUT_BUBBLE\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_NOT_AVAIL\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_READ\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_WASTED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_BLOCKED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG\0"
+    "RXC_FLIT_GEN_HDR1_PAR\0"
+    "RXC_FLIT_GEN_HDR1_PAR_MSG\0"
+    "RXC_FLIT_GEN_HDR1_PAR_FLIT\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL_NOMSG\0"
+    "RXC_FLIT_NOT_SENT_ALL\0"
+    "RXC_FLIT_NOT_SENT_NO_BGF_CRD\0"
+    "RXC_FLIT_NOT_SENT_NO_TXQ_CRD\0"
+    "RXC_FLIT_NOT_SENT_NO_BGF_NO_MSG\0"
+    "RXC_FLIT_NOT_SENT_NO_TXQ_NO_MSG\0"
+    "RXC_FLIT_NOT_SENT_ONE_TAKEN\0"
+    "RXC_FLIT_NOT_SENT_TWO_TAKEN\0"
+    "RXC_FLIT_NOT_SENT_THREE_TAKEN\0"
+    "RXC_HELD_VN0\0"
+    "RXC_HELD_VN1\0"
+    "RXC_HELD_PARALLEL_ATTEMPT\0"
+    "RXC_HELD_PARALLEL_SUCCESS\0"
+    "RXC_HELD_PARALLEL_AD_LOST\0"
+    "RXC_HELD_PARALLEL_BL_LOST\0"
+    "RXC_HELD_CANT_SLOT_AD\0"
+    "RXC_HELD_CANT_SLOT_BL\0"
+    "RXC_INSERTS_VN0_AD_REQ\0"
+    "RXC_INSERTS_VN0_AD_SNP\0"
+    "RXC_INSERTS_VN0_AD_RSP\0"
+    "RXC_INSERTS_VN0_BL_RSP\0"
+    "RXC_INSERTS_VN0_BL_WB\0"
+    "RXC_INSERTS_VN0_BL_NCB\0"
+    "RXC_INSERTS_VN0_BL_NCS\0"
+    "RXC_INSERTS_VN1_AD_REQ\0"
+    "RXC_INSERTS_VN1_AD_SNP\0"
+    "RXC_INSERTS_VN1_AD_RSP\0"
+    "RXC_INSERTS_VN1_BL_RSP\0"
+    "RXC_INSERTS_VN1_BL_WB\0"
+    "RXC_INSERTS_VN1_BL_NCB\0"
+    "RXC_INSERTS_VN1_BL_NCS\0"
+    "RXC_OCCUPANCY_VN0_AD_REQ\0"
+    "RXC_OCCUPANCY_VN0_AD_SNP\0"
+    "RXC_OCCUPANCY_VN0_AD_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_WB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCS\0"
+    "RXC_OCCUPANCY_VN1_AD_REQ\0"
+    "RXC_OCCUPANCY_VN1_AD_SNP\0"
+    "RXC_OCCUPANCY_VN1_AD_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_WB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCS\0"
+    "RXC_PACKING_MISS_VN0_AD_REQ\0"
+    "RXC_PACKING_MISS_VN0_AD_SNP\0"
+    "RXC_PACKING_MISS_VN0_AD_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_WB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCS\0"
+    "RXC_PACKING_MISS_VN1_AD_REQ\0"
+    "RXC_PACKING_MISS_VN1_AD_SNP\0"
+    "RXC_PACKING_MISS_VN1_AD_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_WB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCS\0"
+    "RXC_SMI3_PFTCH_ARRIVED\0"
+    "RXC_SMI3_PFTCH_ARB_LOST\0"
+    "RXC_SMI3_PFTCH_SLOTTED\0"
+    "RXC_SMI3_PFTCH_DROP_OLD\0"
+    "RXC_SMI3_PFTCH_DROP_WRAP\0"
+    "RXC_VNA_CRD_USED\0"
+    "RXC_VNA_CRD_CORRECTED\0"
+    "RXC_VNA_CRD_LT1\0"
+    "RXC_VNA_CRD_LT4\0"
+    "RXC_VNA_CRD_LT5\0"
+    "RXC_VNA_CRD_ANY_IN_USE\0"
+    "TXC_AD_ARB_FAIL_VN0_REQ\0"
+    "TXC_AD_ARB_FAIL_VN0_SNP\0"
+    "TXC_AD_ARB_FAIL_VN0_RSP\0"
+    "TXC_AD_ARB_FAIL_VN0_WB\0"
+    "TXC_AD_ARB_FAIL_VN1_REQ\0"
+    "TXC_AD_ARB_FAIL_VN1_SNP\0"
+    "TXC_AD_ARB_FAIL_VN1_RSP\0"
+    "TXC_AD_ARB_FAIL_VN1_WB\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT0\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT1\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT2\0"
+    "TXC_AD_FLQ_BYPASS_BL_EARLY_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN0_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN0_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN1_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN1_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_REQ\0"
+    "RBOX0C0|RBOX1C0|RBOX2C0|RBOX3C0\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_REQ\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_PEER_UPI0\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_PEER_UPI1\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_CHA\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_PEER_UPI0\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_PEER_UPI1\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_CHA\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_NON_IDLE\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_NON_IDLE\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN0_SNPFP_NONSNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN1_SNPFP_NONSNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN0_SNPFP_VN2SNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN1_SNPFP_VN2SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_WB\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_WB\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_RSP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_RSP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_WB\0"
+    "TXC_AK_FLQ_INSERTS\0"
+    "TXC_AK_FLQ_OCCUPANCY\0"
+    "TXC_BL_ARB_FAIL_VN0_RSP\0"
+    "TXC_BL_ARB_FAIL_VN0_WB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCS\0"
+    "TXC_BL_ARB_FAIL_VN1_RSP\0"
+    "TXC_BL_ARB_FAIL_VN1_WB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCS\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN0_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCS\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCS\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_WB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_NCB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_NCS\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_WB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_NCB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_NCS\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_RSP\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_WB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_NCB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_NCS\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_RSP\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_WB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_NCB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_NCS\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_WB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_WB\0"
+    "UPI_PREFETCH_SPAWN\0"
+    "VN0_CREDITS_USED_REQ\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_RSP\0"
+    "VN0_CREDITS_USED_WB\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN1_CREDITS_USED_REQ\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_RSP\0"
+    "VN1_CREDITS_USED_WB\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VN0_NO_CREDITS_REQ\0"
+    "VN0_NO_CREDITS_SNP\0"
+    "VN0_NO_CREDITS_RSP\0"
+    "VN0_NO_CREDITS_WB\0"
+    "VN0_NO_CREDITS_NCB\0"
+    "VN0_NO_CREDITS_NCS\0"
+    "VN1_NO_CREDITS_REQ\0"
+    "VN1_NO_CREDITS_SNP\0"
+    "VN1_NO_CREDITS_RSP\0"
+    "VN1_NO_CREDITS_WB\0"
+    "VN1_NO_CREDITS_NCB\0"
+    "VN1_NO_CREDITS_NCS\0"
+    "IBOX_CLOCKTICKS\0"
+    "IBOX\0"
+    "COMP_BUF_INSERTS_PORT0\0"
+    "COMP_BUF_INSERTS_PORT1\0"
+    "COMP_BUF_INSERTS_PORT2\0"
+    "COMP_BUF_INSERTS_PORT3\0"
+    "COMP_BUF_OCCUPANCY\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART0\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART1\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART2\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART3\0"
+    "DATA_REQ_BY_CPU_MEM_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_MEM_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART0\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART2\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART3\0"
+    "DATA_REQ_BY_CPU_IO_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_IO_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART0\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART1\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART2\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART3\0"
+    "DATA_REQ_OF_CPU_MEM_READ_VTD0\0"
+    "DATA_REQ_OF_CPU_MEM_READ_VTD1\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART0\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART1\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART2\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART3\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_VTD0\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_READ_VTD0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_VTD1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_VTD0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART2\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART3\0"
+    "DATA_REQ_OF_CPU_ATOMIC_VTD0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_VTD1\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART0\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART1\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART2\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART3\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_VTD0\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_VTD1\0"
+    "DATA_REQ_OF_CPU_MSG_PART0\0"
+    "DATA_REQ_OF_CPU_MSG_PART1\0"
+    "DATA_REQ_OF_CPU_MSG_PART2\0"
+    "DATA_REQ_OF_CPU_MSG_PART3\0"
+    "DATA_REQ_OF_CPU_MSG_VTD0\0"
+    "DATA_REQ_OF_CPU_MSG_VTD1\0"
+    "LINK_NUM_CORR_ERR\0"
+    "LINK_NUM_RETRIES\0"
+    "MASK_MATCH\0"
+    "MASK_MATCH_AND_BUS0\0"
+    "MASK_MATCH_AND_BUS1\0"
+    "MASK_MATCH_AND_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_AND_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0\0"
+    "MASK_MATCH_OR_BUS1\0"
+    "MASK_MATCH_OR_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_NOT_BUS1\0"
+    "NOTHING\0"
+    "SYMBOL_TIMES\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART0\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART1\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART2\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART3\0"
+    "TXN_REQ_BY_CPU_MEM_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_MEM_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART0\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART2\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART3\0"
+    "TXN_REQ_BY_CPU_IO_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_IO_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART0\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART1\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART2\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART3\0"
+    "TXN_REQ_OF_CPU_MEM_READ_VTD0\0"
+    "TXN_REQ_OF_CPU_MEM_READ_VTD1\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART0\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART1\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART2\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART3\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_VTD0\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_READ_VTD0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_VTD1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_VTD0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART2\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART3\0"
+    "TXN_REQ_OF_CPU_ATOMIC_VTD0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_VTD1\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART0\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART1\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART2\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART3\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_VTD0\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_VTD1\0"
+    "TXN_REQ_OF_CPU_MSG_PART0\0"
+    "TXN_REQ_OF_CPU_MSG_PART1\0"
+    "TXN_REQ_OF_CPU_MSG_PART2\0"
+    "TXN_REQ_OF_CPU_MSG_PART3\0"
+    "TXN_REQ_OF_CPU_MSG_VTD0\0"
+    "TXN_REQ_OF_CPU_MSG_VTD1\0"
+    "VTD_ACCESS_L4_PAGE_HIT\0"
+    "VTD_ACCESS_CTXT_MISS\0"
+    "VTD_ACCESS_L1_MISS\0"
+    "VTD_ACCESS_L2_MISS\0"
+    "VTD_ACCESS_L3_MISS\0"
+    "VTD_ACCESS_TLB_MISS\0"
+    "VTD_ACCESS_TLB_FULL\0"
+    "VTD_ACCESS_TLB1_MISS\0"
+    "VTD_OCCUPANCY\0"
+    "BANDWIDTH_PORT0_IN\0"
+    "IBAND0PI0|IBAND1PI0|IBAND2PI0|IBAND3PI0|IBAND4PI0|IBAND5PI0\0"
+    "BANDWIDTH_PORT1_IN\0"
+    "IBAND0PI1|IBAND1PI1|IBAND2PI1|IBAND3PI1|IBAND4PI1|IBAND5PI1\0"
+    "BANDWIDTH_PORT2_IN\0"
+    "IBAND0PI2|IBAND1PI2|IBAND2PI2|IBAND3PI2|IBAND4PI2|IBAND5PI2\0"
+    "BANDWIDTH_PORT3_IN\0"
+    "IBAND0PI3|IBAND1PI3|IBAND2PI3|IBAND3PI3|IBAND4PI3|IBAND5PI3\0"
+    "BANDWIDTH_PORT0_OUT\0"
+    "IBAND0PO0|IBAND1PO0|IBAND2PO0|IBAND3PO0|IBAND4PO0|IBAND5PO0\0"
+    "BANDWIDTH_PORT1_OUT\0"
+    "IBAND0PO1|IBAND1PO1|IBAND2PO1|IBAND3PO1|IBAND4PO1|IBAND5PO1\0"
+    "BANDWIDTH_PORT2_OUT\0"
+    "IBAND0PO2|IBAND1PO2|IBAND2PO2|IBAND3PO2|IBAND4PO2|IBAND5PO2\0"
+    "BANDWIDTH_PORT3_OUT\0"
+    "IBAND0PO3|IBAND1PO3|IBAND2PO3|IBAND3PO3|IBAND4PO3|IBAND5PO3\0"
+    "IUNIT_CLOCKTICKS\0"
+    "IBOX0CLK|IBOX1CLK|IBOX2CLK|IBOX3CLK|IBOX4CLK|IBOX5CLK\0"
+    "UTLILIZATION_PORT0_IN\0"
+    "IUTIL0PI0|IUTIL1PI0|IUTIL2PI0|IUTIL3PI0|IUTIL4PI0|IUTIL5PI0\0"
+    "UTLILIZATION_PORT1_IN\0"
+    "IUTIL0PI1|IUTIL1PI1|IUTIL2PI1|IUTIL3PI1|IUTIL4PI1|IUTIL5PI1\0"
+    "UTLILIZATION_PORT2_IN\0"
+    "IUTIL0PI2|IUTIL1PI2|IUTIL2PI2|IUTIL3PI2|IUTIL4PI2|IUTIL5PI2\0"
+    "UTLILIZATION_PORT3_IN\0"
+    "IUTIL0PI3|IUTIL1PI3|IUTIL2PI3|IUTIL3PI3|IUTIL4PI3|IUTIL5PI3\0"
+    "UTLILIZATION_PORT0_OUT\0"
+    "IUTIL0PO0|IUTIL1PO0|IUTIL2PO0|IUTIL3PO0|IUTIL4PO0|IUTIL5PO0\0"
+    "UTLILIZATION_PORT1_OUT\0"
+    "IUTIL0PO1|IUTIL1PO1|IUTIL2PO1|IUTIL3PO1|IUTIL4PO1|IUTIL5PO1\0"
+    "UTLILIZATION_PORT2_OUT\0"
+    "IUTIL0PO2|IUTIL1PO2|IUTIL2PO2|IUTIL3PO2|IUTIL4PO2|IUTIL5PO2\0"
+    "UTLILIZATION_PORT3_OUT\0"
+    "IUTIL0PO3|IUTIL1PO3|IUTIL2PO3|IUTIL3PO3|IUTIL4PO3|IUTIL5PO3\0"
+    "IRP_CLOCKTICKS\0"
+    "IRP\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_IV_Q\0"
+    "CACHE_TOTAL_OCCUPANCY_MEM\0"
+    "COHERENT_OPS_PCIRDCUR\0"
+    "COHERENT_OPS_CRD\0"
+    "COHERENT_OPS_DRD\0"
+    "COHERENT_OPS_RFO\0"
+    "COHERENT_OPS_PCITOM\0"
+    "COHERENT_OPS_PCIDCAHINT\0"
+    "COHERENT_OPS_WBMTOI\0"
+    "COHERENT_OPS_CLFLUSH\0"
+    "FAF_FULL\0"
+    "FAF_INSERTS\0"
+    "FAF_OCCUPANCY\0"
+    "FAF_TRANSACTIONS\0"
+    "IRP_ALL_INBOUND_INSERTS\0"
+    "IRP_ALL_OUTBOUND_INSERTS\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_FAST_2ND_RD_INSERT\0"
+    "MISC0_FAST_2ND_WR_INSERT\0"
+    "MISC0_FAST_2ND_ATOMIC_INSERT\0"
+    "MISC0_FAST_FAST_XFER\0"
+    "MISC0_FAST_PF_ACK_HINT\0"
+    "MISC0_FAST_UNKNOWN\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_LOST_FWD\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "P2P_INSERTS\0"
+    "P2P_OCCUPANCY\0"
+    "P2P_TRANSACTIONS_RD\0"
+    "P2P_TRANSACTIONS_WR\0"
+    "P2P_TRANSACTIONS_MSG\0"
+    "P2P_TRANSACTIONS_CMPL\0"
+    "P2P_TRANSACTIONS_REM\0"
+    "P2P_TRANSACTIONS_REM_AND_TGT_MATCH\0"
+    "P2P_TRANSACTIONS_LOC\0"
+    "P2P_TRANSACTIONS_LOC_AND_TGT_MATCH\0"
+    "SNOOP_RESP_MISS_SNPCODE\0"
+    "SNOOP_RESP_MISS_SNPDATA\0"
+    "SNOOP_RESP_MISS_SNPINV\0"
+    "SNOOP_RESP_MISS_SNPALL\0"
+    "SNOOP_RESP_HIT_I_SNPCODE\0"
+    "SNOOP_RESP_HIT_I_SNPDATA\0"
+    "SNOOP_RESP_HIT_I_SNPINV\0"
+    "SNOOP_RESP_HIT_I_SNPALL\0"
+    "SNOOP_RESP_HIT_ES_SNPCODE\0"
+    "SNOOP_RESP_HIT_ES_SNPDATA\0"
+    "SNOOP_RESP_HIT_ES_SNPINV\0"
+    "SNOOP_RESP_HIT_ES_SNPALL\0"
+    "SNOOP_RESP_HIT_M_SNPCODE\0"
+    "SNOOP_RESP_HIT_M_SNPDATA\0"
+    "SNOOP_RESP_HIT_M_SNPINV\0"
+    "SNOOP_RESP_HIT_M_SNPALL\0"
+    "SNOOP_RESP_HIT_ESM_SNPCODE\0"
+    "SNOOP_RESP_HIT_ESM_SNPDATA\0"
+    "SNOOP_RESP_HIT_ESM_SNPINV\0"
+    "SNOOP_RESP_HIT_ESM_SNPALL\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREF\0"
+    "TRANSACTIONS_WR_PREF\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "TXC_AK_INSERTS\0"
+    "TXC_BL_DRS_CYCLES_FULL\0"
+    "TXC_BL_DRS_INSERTS\0"
+    "TXC_BL_DRS_OCCUPANCY\0"
+    "TXC_BL_NCB_CYCLES_FULL\0"
+    "TXC_BL_NCB_INSERTS\0"
+    "TXC_BL_NCB_OCCUPANCY\0"
+    "TXC_BL_NCS_CYCLES_FULL\0"
+    "TXC_BL_NCS_INSERTS\0"
+    "TXC_BL_NCS_OCCUPANCY\0"
+    "TXR2_AD_STALL_CREDIT_CYCLES\0"
+    "TXR2_BL_STALL_CREDIT_CYCLES\0"
+    "TXS_DATA_INSERTS_NCB\0"
+    "TXS_DATA_INSERTS_NCS\0"
+    "TXS_REQUEST_OCCUPANCY\0"
+    "AG0_AD_CRD_ACQUIRED_TGR0\0"
+    "CBOX|M2M|RBOX|PBOX\0"
+    "AG0_AD_CRD_ACQUIRED_TGR1\0"
+    "AG0_AD_CRD_ACQUIRED_TGR2\0"
+    "AG0_AD_CRD_ACQUIRED_TGR3\0"
+    "AG0_AD_CRD_ACQUIRED_TGR4\0"
+    "AG0_AD_CRD_ACQUIRED_TGR5\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG1_AD_CRD_ACQUIRED_TGR0\0"
+    "AG1_AD_CRD_ACQUIRED_TGR1\0"
+    "AG1_AD_CRD_ACQUIRED_TGR2\0"
+    "AG1_AD_CRD_ACQUIRED_TGR3\0"
+    "AG1_AD_CRD_ACQUIRED_TGR4\0"
+    "AG1_AD_CRD_ACQUIRED_TGR5\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG0_BL_CRD_ACQUIRED_TGR0\0"
+    "AG0_BL_CRD_ACQUIRED_TGR1\0"
+    "AG0_BL_CRD_ACQUIRED_TGR2\0"
+    "AG0_BL_CRD_ACQUIRED_TGR3\0"
+    "AG0_BL_CRD_ACQUIRED_TGR4\0"
+    "AG0_BL_CRD_ACQUIRED_TGR5\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR5\0"
+    "AG1_BL_CRD_ACQUIRED_TGR0\0"
+    "AG1_BL_CRD_ACQUIRED_TGR1\0"
+    "AG1_BL_CRD_ACQUIRED_TGR2\0"
+    "AG1_BL_CRD_ACQUIRED_TGR3\0"
+    "AG1_BL_CRD_ACQUIRED_TGR4\0"
+    "AG1_BL_CRD_ACQUIRED_TGR5\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR5\0"
+    "CMS_CLOCKTICKS\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_UP\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_DN\0"
+    "FAST_ASSERTED_VERT\0"
+    "FAST_ASSERTED_HORZ\0"
+    "HORZ_RING_AD_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AK_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_BL_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_IV_IN_USE_LEFT\0"
+    "HORZ_RING_IV_IN_USE_RIGHT\0"
+    "RING_BOUNCES_HORZ_AD\0"
+    "RING_BOUNCES_HORZ_AK\0"
+    "RING_BOUNCES_HORZ_BL\0"
+    "RING_BOUNCES_HORZ_IV\0"
+    "RING_BOUNCES_VERT_AD\0"
+    "RING_BOUNCES_VERT_AK\0"
+    "RING_BOUNCES_VERT_BL\0"
+    "RING_BOUNCES_VERT_IV\0"
+    "RING_SINK_STARVED_HORZ_AD\0"
+    "RING_SINK_STARVED_HORZ_AK\0"
+    "RING_SINK_STARVED_HORZ_BL\0"
+    "RING_SINK_STARVED_HORZ_IV\0"
+    "RING_SINK_STARVED_HORZ_AK_AG1\0"
+    "RING_SINK_STARVED_VERT_AD\0"
+    "RING_SINK_STARVED_VERT_AK\0"
+    "RING_SINK_STARVED_VERT_BL\0"
+    "RING_SINK_STARVED_VERT_IV\0"
+    "RING_SRC_THRTL\0"
+    "RXR_BUSY_STARVED_AD_BNC\0"
+    "RXR_BUSY_STARVED_BL_BNC\0"
+    "RXR_BUSY_STARVED_AD_CRD\0"
+    "RXR_BUSY_STARVED_BL_CRD\0"
+    "RXR_BUSY_STARVED_AD\0"
+    "RXR_BUSY_STARVED_BL\0"
+    "RXR_BYPASS_AD_BNC\0"
+    "RXR_BYPASS_AK_BNC\0"
+    "RXR_BYPASS_BL_BNC\0"
+    "RXR_BYPASS_IV_BNC\0"
+    "RXR_BYPASS_AD_CRD\0"
+    "RXR_BYPASS_BL_CRD\0"
+    "RXR_BYPASS_AD\0"
+    "RXR_BYPASS_BL\0"
+    "RXR_CRD_STARVED_AD_BNC\0"
+    "RXR_CRD_STARVED_AK_BNC\0"
+    "RXR_CRD_STARVED_BL_BNC\0"
+    "RXR_CRD_STARVED_IV_BNC\0"
+    "RXR_CRD_STARVED_AD_CRD\0"
+    "RXR_CRD_STARVED_BL_CRD\0"
+    "RXR_CRD_STARVED_IFV\0"
+    "RXR_CRD_STARVED_AD\0"
+    "RXR_CRD_STARVED_BL\0"
+    "RXR_INSERTS_AD_BNC\0"
+    "RXR_INSERTS_AK_BNC\0"
+    "RXR_INSERTS_BL_BNC\0"
+    "RXR_INSERTS_IV_BNC\0"
+    "RXR_INSERTS_AD_CRD\0"
+    "RXR_INSERTS_BL_CRD\0"
+    "RXR_INSERTS_AD\0"
+    "RXR_INSERTS_BL\0"
+    "RXR_OCCUPANCY_AD_BNC\0"
+    "RXR_OCCUPANCY_AK_BNC\0"
+    "RXR_OCCUPANCY_BL_BNC\0"
+    "RXR_OCCUPANCY_IV_BNC\0"
+    "RXR_OCCUPANCY_AD_CRD\0"
+    "RXR_OCCUPANCY_BL_CRD\0"
+    "RXR_OCCUPANCY_AD\0"
+    "RXR_OCCUPANCY_BL\0"
+    "VERT_RING_AD_IN_USE_UP_EVEN\0"
+    "VERT_RING_AD_IN_USE_UP_ODD\0"
+    "VERT_RING_AD_IN_USE_DN_EVEN\0"
+    "VERT_RING_AD_IN_USE_DN_ODD\0"
+    "VERT_RING_AK_IN_USE_UP_EVEN\0"
+    "VERT_RING_AK_IN_USE_UP_ODD\0"
+    "VERT_RING_AK_IN_USE_DN_EVEN\0"
+    "VERT_RING_AK_IN_USE_DN_ODD\0"
+    "VERT_RING_BL_IN_USE_UP_EVEN\0"
+    "VERT_RING_BL_IN_USE_UP_ODD\0"
+    "VERT_RING_BL_IN_USE_DN_EVEN\0"
+    "VERT_RING_BL_IN_USE_DN_ODD\0"
+    "VERT_RING_IV_IN_USE_UP\0"
+    "VERT_RING_IV_IN_USE_DN\0";
+
+static const PerfmonEventOption cascadelakeX_arch_event_options[] = {
+ {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,0x01}
+};
+
+static const PerfmonEventEntry cascadelakeX_arch_event_entries[NUM_ARCH_EVENTS_CASCADELAKEX] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 134, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 157, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 185, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 212, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 242, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {246, 242, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {267, 242, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {289, 242, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 242, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 242, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {361, 242, 0, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {393, 242, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {421, 242, 0, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {453, 242, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 242, 1, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {522, 242, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {535, 242, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {546, 242, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {560, 242, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {588, 242, 3, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {636, 242, 4, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {686, 242, 5, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {736, 242, 6, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {786, 242, 7, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {826, 242, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {859, 242, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {884, 242, 9, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {908, 242, 10, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {937, 242, 11, 2, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {965, 242, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {995, 242, 9, 1, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1024, 242, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1044, 242, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1063, 242, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 242, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1109, 242, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1143, 242, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1164, 242, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1188, 242, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1213, 242, 15, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1238, 242, 17, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1267, 242, 19, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1297, 242, 22, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1327, 242, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1361, 242, 5, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1395, 242, 4, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1429, 242, 3, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1463, 242, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1497, 242, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1511, 242, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1525, 242, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1539, 242, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1553, 242, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1567, 242, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1590, 242, 26, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {1610, 242, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1628, 242, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1647, 242, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1667, 242, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1691, 242, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1717, 242, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1748, 242, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1776, 242, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 242, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1821, 242, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1840, 242, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1860, 242, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1884, 242, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1910, 242, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1941, 242, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1969, 242, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1996, 242, 29, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2017, 242, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2048, 242, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2067, 242, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2090, 242, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2107, 242, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2124, 242, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2146, 242, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2172, 242, 0, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2203, 242, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2228, 242, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2254, 242, 15, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2280, 242, 17, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2310, 242, 19, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2341, 242, 22, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2372, 242, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2407, 242, 5, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2442, 242, 4, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2477, 242, 3, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2512, 242, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2547, 242, 31, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2582, 242, 32, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2617, 242, 33, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2652, 242, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2681, 242, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2709, 242, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2735, 242, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2763, 242, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2789, 242, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2816, 242, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2843, 242, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2872, 242, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2900, 242, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2927, 242, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2963, 242, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2999, 242, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3040, 242, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3081, 242, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3122, 242, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3163, 242, 0, 0, 0xC7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3204, 242, 0, 0, 0xC7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3245, 242, 0, 0, 0xC7,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {3274, 242, 0, 0, 0xC7,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {3303, 242, 6, 1, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3317, 242, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {3350, 242, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3384, 242, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {3412, 242, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3441, 242, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3471, 242, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3498, 242, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3526, 242, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {3547, 242, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3571, 242, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3595, 242, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3619, 242, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3644, 242, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3669, 242, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3694, 242, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3718, 242, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {3742, 242, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3766, 242, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {3790, 242, 0, 0, 0xD1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3817, 242, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3851, 242, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3884, 242, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3918, 242, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3952, 242, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3985, 242, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4021, 242, 0, 0, 0xD3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4058, 242, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4095, 242, 0, 0, 0xD3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4131, 242, 0, 0, 0xD3,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4167, 242, 0, 0, 0xD3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4203, 242, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4228, 242, 0, 0, 0xCD,0x01,0x0,0x04,EVENT_OPTION_NONE_MASK}
+, {4264, 242, 0, 0, 0xCD,0x01,0x0,0x08,EVENT_OPTION_NONE_MASK}
+, {4300, 242, 0, 0, 0xCD,0x01,0x0,0x10,EVENT_OPTION_NONE_MASK}
+, {4337, 242, 0, 0, 0xCD,0x01,0x0,0x20,EVENT_OPTION_NONE_MASK}
+, {4374, 242, 0, 0, 0xCD,0x01,0x0,0x40,EVENT_OPTION_NONE_MASK}
+, {4411, 242, 0, 0, 0xCD,0x01,0x0,0x80,EVENT_OPTION_NONE_MASK}
+, {4449, 242, 0, 0, 0xCD,0x01,0x0,0x100,EVENT_OPTION_NONE_MASK}
+, {4487, 242, 0, 0, 0xCD,0x01,0x0,0x200,EVENT_OPTION_NONE_MASK}
+, {4525, 242, 0, 0, 0xC6,0x01,0x00,0x11,EVENT_OPTION_NONE_MASK}
+, {4551, 242, 0, 0, 0xC6,0x01,0x00,0x12,EVENT_OPTION_NONE_MASK}
+, {4577, 242, 0, 0, 0xC6,0x01,0x00,0x13,EVENT_OPTION_NONE_MASK}
+, {4602, 242, 0, 0, 0xC6,0x01,0x00,0x14,EVENT_OPTION_NONE_MASK}
+, {4629, 242, 0, 0, 0xC6,0x01,0x00,0x15,EVENT_OPTION_NONE_MASK}
+, {4656, 242, 0, 0, 0xC6,0x01,0x00,0x400206,EVENT_OPTION_NONE_MASK}
+, {4686, 242, 0, 0, 0xC6,0x01,0x00,0x200206,EVENT_OPTION_NONE_MASK}
+, {4729, 242, 0, 0, 0xC6,0x01,0x00,0x400406,EVENT_OPTION_NONE_MASK}
+, {4759, 242, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4780, 242, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4806, 242, 13, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4833, 242, 15, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4860, 242, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4896, 242, 5, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4932, 242, 4, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4968, 242, 3, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5004, 242, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5040, 242, 31, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5076, 242, 32, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5112, 242, 33, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5148, 242, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5167, 242, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5198, 242, 13, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5230, 242, 15, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5262, 242, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5303, 242, 5, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5344, 242, 4, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5385, 242, 3, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5426, 242, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5467, 242, 31, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5508, 242, 32, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5549, 242, 33, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5590, 242, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5608, 242, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5639, 242, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5665, 242, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5691, 242, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5717, 242, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5743, 242, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5772, 242, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5800, 242, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5828, 242, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5856, 242, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5884, 242, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5912, 242, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5940, 242, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5968, 242, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5996, 242, 0, 0, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK}
+, {6029, 242, 0, 1, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6067, 242, 0, 1, 0xA1,0x9C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6099, 242, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6127, 242, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6160, 242, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6190, 242, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6220, 242, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6253, 242, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6286, 242, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6316, 242, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6346, 242, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6379, 242, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6412, 242, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6442, 242, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6472, 242, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6506, 242, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6540, 242, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6571, 242, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6602, 242, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6636, 242, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6670, 242, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6687, 242, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6713, 242, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6738, 242, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6759, 242, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6786, 242, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6816, 242, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6849, 242, 0, 0, 0x85,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6879, 242, 6, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6903, 242, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6934, 242, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6964, 242, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6990, 242, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {7022, 242, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7057, 242, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7095, 242, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7130, 242, 6, 1, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7159, 242, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7191, 242, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7222, 242, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7249, 242, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {7282, 242, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7318, 242, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7357, 242, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7393, 242, 6, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7423, 242, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7445, 242, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7464, 242, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7480, 242, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7492, 242, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7514, 242, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7536, 242, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7574, 242, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7616, 242, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7657, 242, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7711, 242, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7742, 242, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7764, 242, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7786, 242, 6, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7815, 242, 37, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7848, 242, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7867, 242, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7899, 242, 9, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {7928, 242, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7952, 242, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7968, 242, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8000, 242, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8032, 242, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8064, 242, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8092, 242, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8121, 242, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8161, 242, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8191, 242, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8235, 242, 31, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8284, 242, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8328, 242, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8368, 242, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8409, 242, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8461, 242, 6, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8517, 242, 6, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8566, 242, 6, 1, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8622, 242, 6, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8674, 242, 6, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8738, 242, 31, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8795, 242, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8827, 242, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8851, 242, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8864, 242, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8881, 242, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8897, 242, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8913, 242, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8930, 242, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8945, 242, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8967, 242, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8990, 242, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {9018, 242, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9047, 242, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9075, 242, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {9103, 242, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {9120, 242, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {9141, 242, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {9157, 242, 0, 0, 0x24,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {9174, 242, 0, 0, 0x24,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {9190, 242, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9207, 242, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {9225, 242, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {9246, 242, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9268, 242, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {9293, 242, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {9324, 242, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {9338, 242, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {9358, 242, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9372, 242, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9385, 242, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9401, 242, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9418, 242, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {9430, 242, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9446, 242, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9469, 242, 5, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9492, 242, 4, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9515, 242, 3, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9538, 242, 25, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9561, 242, 31, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9584, 242, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9599, 242, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9621, 242, 5, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9643, 242, 4, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9665, 242, 3, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9687, 242, 25, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9709, 242, 31, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9731, 242, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9749, 242, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9774, 242, 5, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9799, 242, 4, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9824, 242, 3, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9849, 242, 25, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9874, 242, 31, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9899, 242, 39, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9916, 242, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9935, 242, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9961, 242, 5, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9987, 242, 4, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10013, 242, 3, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10039, 242, 25, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10065, 242, 31, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10091, 242, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10105, 242, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10126, 242, 5, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10147, 242, 4, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10168, 242, 3, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10189, 242, 25, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10210, 242, 31, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10231, 242, 39, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {10247, 242, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10275, 242, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10301, 242, 5, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10327, 242, 4, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10353, 242, 3, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10379, 242, 25, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10405, 242, 31, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10431, 242, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10460, 242, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10487, 242, 5, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10514, 242, 4, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10541, 242, 3, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10568, 242, 25, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10595, 242, 31, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10622, 242, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10646, 242, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10668, 242, 5, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10690, 242, 4, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10712, 242, 3, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10734, 242, 25, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10756, 242, 31, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10778, 242, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10806, 242, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10820, 242, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10834, 242, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10848, 242, 0, 0, 0xF1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10864, 242, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10884, 242, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10908, 242, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10934, 242, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10953, 242, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10974, 242, 41, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10994, 242, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11003, 242, 6, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11021, 242, 5, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11039, 242, 4, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11057, 242, 3, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11075, 242, 43, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11098, 242, 13, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {11123, 242, 0, 0, 0xC1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {11141, 242, 0, 0, 0xC6,0x01,0x00,0x400806,EVENT_OPTION_NONE_MASK}
+, {11171, 242, 0, 0, 0xC6,0x01,0x00,0x401006,EVENT_OPTION_NONE_MASK}
+, {11202, 242, 0, 0, 0xC6,0x01,0x00,0x402006,EVENT_OPTION_NONE_MASK}
+, {11233, 242, 0, 0, 0xC6,0x01,0x00,0x404006,EVENT_OPTION_NONE_MASK}
+, {11264, 242, 0, 0, 0xC6,0x01,0x00,0x408006,EVENT_OPTION_NONE_MASK}
+, {11296, 242, 0, 0, 0xC6,0x01,0x00,0x410006,EVENT_OPTION_NONE_MASK}
+, {11328, 242, 0, 0, 0xC6,0x01,0x00,0x420006,EVENT_OPTION_NONE_MASK}
+, {11360, 242, 0, 0, 0xC6,0x01,0x00,0x100206,EVENT_OPTION_NONE_MASK}
+, {11403, 242, 0, 0, 0xC6,0x01,0x00,0x300206,EVENT_OPTION_NONE_MASK}
+, {11446, 242, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11476, 242, 0, 0, 0x28,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {11506, 242, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11536, 242, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11572, 242, 0, 0, 0xFE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11592, 242, 0, 0, 0xFE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11614, 242, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11641, 242, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11668, 11687, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11692, 11687, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11711, 11687, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11730, 11687, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11754, 11687, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11773, 11687, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11785, 11687, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11812, 11687, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11829, 11687, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11846, 11687, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11872, 11687, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11886, 11899, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11907, 11930, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11935, 11930, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11959, 11930, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11983, 11930, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12014, 11930, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12039, 11930, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12053, 11930, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12067, 11930, 0, 0, 0x3D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12081, 11930, 0, 0, 0x3D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {12097, 11930, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12118, 11930, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12146, 11930, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12171, 11930, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12187, 11930, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12205, 11930, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12228, 11930, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12246, 11930, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12269, 11930, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12281, 11930, 0, 0, 0x33,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12298, 11930, 0, 0, 0x33,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12317, 11930, 0, 0, 0x33,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12337, 11930, 0, 0, 0x33,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12355, 11930, 0, 0, 0x33,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {12375, 11930, 0, 0, 0x33,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12396, 11930, 0, 0, 0x33,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12415, 11930, 0, 0, 0x33,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {12436, 11930, 0, 0, 0x33,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12458, 11930, 0, 0, 0x33,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {12475, 11930, 0, 0, 0x33,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {12494, 11930, 0, 0, 0x33,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {12514, 12533, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12775, 12533, 43, 1, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {12800, 11930, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12815, 11930, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12833, 11930, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12847, 11930, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12862, 11930, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12879, 11930, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12903, 11930, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12920, 11930, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12942, 11930, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12960, 11930, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12979, 11930, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13006, 11930, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13036, 11930, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13059, 11930, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13095, 11930, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13120, 11930, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13140, 11930, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13162, 11930, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13186, 11930, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13209, 11930, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13234, 11930, 0, 0, 0x59,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13254, 11930, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13276, 11930, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13301, 11930, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13332, 11930, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13366, 11930, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13392, 11930, 0, 0, 0x5B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13421, 11930, 0, 0, 0x5B,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {13442, 11930, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13461, 11930, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13481, 11930, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13501, 11930, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13521, 11930, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13541, 11930, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13565, 11930, 0, 0, 0x63,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13585, 11930, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13602, 11930, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK}
+, {13623, 11930, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK}
+, {13640, 11930, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK}
+, {13664, 11930, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK}
+, {13679, 11930, 0, 0, 0x34,0x31,0,0,EVENT_OPTION_STATE_MASK}
+, {13696, 11930, 0, 0, 0x34,0x91,0,0,EVENT_OPTION_STATE_MASK}
+, {13714, 11930, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13734, 11930, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13754, 11930, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13774, 11930, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13794, 11930, 0, 0, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13816, 11930, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13834, 11930, 0, 0, 0x37,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13853, 11930, 0, 0, 0x37,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13873, 11930, 0, 0, 0x37,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13893, 11930, 0, 0, 0x37,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13913, 11930, 0, 0, 0x37,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13933, 11930, 0, 0, 0x37,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {13955, 11930, 0, 0, 0x37,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13976, 11930, 0, 0, 0x37,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {13997, 11930, 0, 0, 0x37,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {14018, 11930, 0, 0, 0x37,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {14039, 11930, 0, 0, 0x37,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {14062, 11930, 0, 0, 0x37,0xA1,0,0,EVENT_OPTION_NONE_MASK}
+, {14080, 11930, 0, 0, 0x37,0xA2,0,0,EVENT_OPTION_NONE_MASK}
+, {14098, 11930, 0, 0, 0x37,0xA4,0,0,EVENT_OPTION_NONE_MASK}
+, {14116, 11930, 0, 0, 0x37,0xA8,0,0,EVENT_OPTION_NONE_MASK}
+, {14134, 11930, 0, 0, 0x37,0xAF,0,0,EVENT_OPTION_NONE_MASK}
+, {14154, 11930, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14172, 11930, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14189, 11930, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14204, 11930, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14232, 11930, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14258, 11930, 0, 0, 0x55,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14266, 11930, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14291, 11930, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14316, 11930, 0, 0, 0x58,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14339, 11930, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14365, 11930, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14391, 11930, 0, 0, 0x58,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14417, 11930, 0, 0, 0x58,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14443, 11930, 0, 0, 0x58,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {14467, 11930, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14493, 11930, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14519, 11930, 0, 0, 0x5A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14543, 11930, 0, 0, 0x5A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14570, 11930, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14597, 11930, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14624, 11930, 0, 0, 0x5A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14651, 11930, 0, 0, 0x5A,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {14676, 11930, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14697, 11930, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14719, 11930, 0, 0, 0x50,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14734, 11930, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14756, 11930, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14779, 11930, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14795, 11930, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14818, 11930, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14842, 11930, 0, 0, 0x50,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {14859, 11930, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14875, 11930, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14895, 11930, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14911, 11930, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14927, 11930, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14947, 11930, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14963, 11930, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14979, 11930, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15006, 11930, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15033, 11930, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15060, 11930, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15086, 11930, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15113, 11930, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15140, 11930, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15167, 11930, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15194, 11930, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15215, 11930, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15234, 11930, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15261, 11930, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15287, 11930, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15310, 11930, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15340, 11930, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15366, 11930, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15391, 11930, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15418, 11930, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15445, 11930, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15472, 11930, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15498, 11930, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15525, 11930, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15552, 11930, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15579, 11930, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15606, 11930, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15627, 11930, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15646, 11930, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15673, 11930, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15699, 11930, 0, 0, 0x19,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15722, 11930, 0, 0, 0x19,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15752, 11930, 0, 0, 0x19,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15778, 11930, 0, 0, 0x19,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15803, 11930, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15831, 11930, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15859, 11930, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15887, 11930, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15914, 11930, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15942, 11930, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15970, 11930, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15998, 11930, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16026, 11930, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16048, 11930, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16068, 11930, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16095, 11930, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16122, 11930, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16149, 11930, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16175, 11930, 0, 0, 0x2C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16202, 11930, 0, 0, 0x2C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16229, 11930, 0, 0, 0x2C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16256, 11930, 0, 0, 0x2C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16283, 11930, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16304, 11930, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16323, 12533, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16341, 12533, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16359, 12533, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16377, 12533, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16395, 11930, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16423, 11930, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16451, 11930, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16479, 11930, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16506, 11930, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16534, 11930, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16562, 11930, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16590, 11930, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16618, 11930, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16641, 11930, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16662, 11930, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16691, 11930, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16719, 11930, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16744, 11930, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16776, 11930, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16804, 11930, 0, 0, 0x2F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16831, 11930, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16858, 11930, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16885, 11930, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16912, 11930, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16938, 11930, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16965, 11930, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16992, 11930, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17019, 11930, 0, 0, 0x20,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17046, 11930, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17067, 11930, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17086, 11930, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17113, 11930, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17139, 11930, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17162, 11930, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17192, 11930, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17218, 11930, 0, 0, 0x21,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17243, 11930, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17271, 11930, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17299, 11930, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17327, 11930, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17354, 11930, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17382, 11930, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17410, 11930, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17438, 11930, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17466, 11930, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17488, 11930, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17508, 11930, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17536, 11930, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17563, 11930, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17587, 11930, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17618, 11930, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17645, 11930, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17671, 11930, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17698, 11930, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17725, 11930, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17752, 11930, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17778, 11930, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17805, 11930, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17832, 11930, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17859, 11930, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17886, 11930, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17907, 11930, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17926, 11930, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17953, 11930, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17979, 11930, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18002, 11930, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18032, 11930, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18058, 11930, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18083, 11930, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18110, 11930, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18137, 11930, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18164, 11930, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18190, 11930, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18217, 11930, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18244, 11930, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18271, 11930, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18298, 11930, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18319, 11930, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18338, 11930, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18365, 11930, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18391, 11930, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18414, 11930, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18444, 11930, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18470, 11930, 0, 0, 0x29,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18495, 11930, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18511, 11930, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18529, 11930, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18548, 11930, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18571, 11930, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18595, 11930, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18620, 11930, 0, 0, 0x51,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18646, 11930, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18663, 11930, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18680, 11930, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18700, 11930, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18720, 11930, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18741, 11930, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18764, 11930, 0, 0, 0x5C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18787, 11930, 0, 0, 0x5C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18806, 11930, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18829, 11930, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18852, 11930, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18878, 11930, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18904, 11930, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18931, 11930, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18960, 11930, 0, 0, 0x5D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18989, 11930, 0, 0, 0x5D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19014, 11930, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19030, 11930, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19048, 11930, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19064, 11930, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19080, 11930, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19096, 11930, 0, 0, 0x35,0x11,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19115, 11930, 0, 0, 0x35,0x14,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19134, 11930, 0, 0, 0x35,0x15,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19154, 11930, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19171, 11930, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19191, 11930, 0, 0, 0x35,0x24,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19211, 11930, 0, 0, 0x35,0x25,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19232, 11930, 0, 0, 0x35,0x31,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19247, 11930, 0, 0, 0x35,0x34,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19262, 11930, 0, 0, 0x35,0x35,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19284, 12533, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19302, 12533, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19322, 12533, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19340, 12533, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19358, 12533, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19376, 12533, 0, 0, 0x36,0x11,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19397, 12533, 0, 0, 0x36,0x14,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19418, 12533, 0, 0, 0x36,0x17,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19440, 12533, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19459, 12533, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19481, 12533, 0, 0, 0x36,0x24,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19503, 12533, 0, 0, 0x36,0x27,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19526, 12533, 0, 0, 0x36,0x31,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19543, 12533, 0, 0, 0x36,0x34,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19560, 11930, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19577, 11930, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19594, 11930, 0, 0, 0x32,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {19619, 11930, 0, 0, 0x32,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {19644, 11930, 0, 0, 0x32,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {19669, 11930, 0, 0, 0x32,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {19693, 11930, 0, 0, 0x32,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {19717, 11930, 0, 0, 0x32,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {19743, 11930, 0, 0, 0x32,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {19769, 11930, 0, 0, 0x32,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {19795, 11930, 0, 0, 0x32,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {19820, 11930, 0, 0, 0x32,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {19845, 11930, 0, 0, 0x32,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {19872, 11930, 0, 0, 0x32,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {19899, 11930, 0, 0, 0x32,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {19926, 11930, 0, 0, 0x32,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {19952, 11930, 0, 0, 0x32,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {19978, 11930, 0, 0, 0x32,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {20003, 11930, 0, 0, 0x32,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {20028, 11930, 0, 0, 0x32,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {20053, 11930, 0, 0, 0x32,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {20077, 20090, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20095, 20090, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20108, 20090, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20122, 20090, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20135, 20090, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20148, 20090, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20161, 20090, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20178, 20090, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20201, 20090, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20214, 20090, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20231, 20090, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20248, 20090, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20261, 20090, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20278, 20090, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20295, 20090, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20314, 20090, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {20333, 20090, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20355, 20090, 0, 0, 0xE3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20371, 20090, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20384, 20090, 0, 0, 0xEA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20396, 20090, 0, 0, 0xEA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20408, 20090, 0, 0, 0xEA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20426, 20090, 0, 0, 0xE4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20448, 20090, 0, 0, 0xE7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20464, 20090, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20482, 20090, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20501, 20090, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20521, 20090, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20534, 20090, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20546, 20090, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20560, 20090, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20573, 20090, 0, 0, 0xD3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20593, 20090, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20613, 20090, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20625, 20090, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20639, 20655, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20709, 20725, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20730, 20725, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20753, 20725, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20764, 20725, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20775, 20725, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20785, 20725, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20804, 20725, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20823, 20725, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20842, 20725, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20861, 20725, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20891, 20725, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20913, 20725, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20934, 20725, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20952, 20725, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20971, 20725, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21000, 20725, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21024, 20725, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21049, 20725, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21073, 20725, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21097, 20725, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21119, 20725, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21143, 20725, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21167, 20725, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21191, 20725, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21205, 21217, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21226, 21238, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21247, 21259, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21268, 21280, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21289, 21304, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21308, 21304, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21332, 21304, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21360, 21304, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21385, 21304, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21414, 21304, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21447, 21304, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21480, 21304, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21513, 21304, 44, 2, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21549, 21304, 44, 2, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21585, 21304, 44, 2, 0x4F,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21621, 21304, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21654, 21304, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21687, 21304, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21720, 21304, 44, 2, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21756, 21304, 44, 2, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21792, 21304, 44, 2, 0x51,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21828, 21304, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21859, 21304, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21877, 21304, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21902, 21304, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21931, 21304, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21961, 21304, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21978, 21304, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22002, 21304, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22024, 21304, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22046, 21304, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22068, 21304, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22090, 21304, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22112, 21304, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22134, 21304, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22156, 21304, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22178, 21304, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22199, 21304, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22224, 21304, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22249, 21304, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22274, 21304, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22297, 21304, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22320, 21304, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22343, 21304, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22366, 21304, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22389, 21304, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22412, 21304, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22435, 21304, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22458, 21304, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22479, 21304, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22500, 21304, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22521, 21304, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22542, 21304, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22563, 21304, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22584, 21304, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22605, 21304, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22622, 21304, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22638, 21304, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22652, 21304, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22670, 21304, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22687, 21304, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22713, 21304, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22729, 21304, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22748, 21304, 0, 0, 0x38,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22770, 21304, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22795, 21304, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22810, 21304, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22829, 21304, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22847, 21304, 0, 0, 0x38,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22874, 21304, 0, 0, 0x38,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22888, 21304, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22897, 21304, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22915, 21304, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22930, 21304, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22943, 21304, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22963, 21304, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22981, 21304, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23007, 21304, 0, 0, 0x57,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23023, 21304, 0, 0, 0x55,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23041, 21304, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23069, 21304, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23097, 21304, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23125, 21304, 44, 2, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23156, 21304, 44, 2, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23187, 21304, 44, 2, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23218, 21304, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23247, 21304, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23276, 21304, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23305, 21304, 44, 2, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23337, 21304, 44, 2, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23369, 21304, 44, 2, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23401, 21304, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23420, 21304, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23437, 21304, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23452, 21304, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23469, 21304, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23488, 21304, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23505, 21304, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23520, 21304, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23537, 21304, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23565, 21304, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23593, 21304, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23621, 21304, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23649, 21304, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23684, 21304, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23719, 21304, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23754, 21304, 44, 2, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23792, 21304, 44, 2, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23830, 21304, 44, 2, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23868, 21304, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23896, 21304, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23924, 21304, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23952, 21304, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23980, 21304, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24005, 21304, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24030, 21304, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24057, 21304, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24084, 21304, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24099, 21304, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24114, 21304, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24139, 21304, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24164, 21304, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24189, 21304, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24213, 21304, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24236, 21304, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24259, 21304, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24282, 21304, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24304, 21304, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24332, 21304, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24360, 21304, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24388, 21304, 0, 0, 0x47,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24415, 21304, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24441, 21304, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24465, 21304, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24490, 21304, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24509, 21304, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24526, 21304, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24541, 21304, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24565, 21304, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24590, 21304, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24607, 21304, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24618, 21304, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24633, 21304, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24662, 21304, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24691, 21304, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24719, 21304, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24749, 21304, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24779, 21304, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24808, 21304, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24832, 21304, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24856, 21304, 0, 0, 0x14,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24879, 21304, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24906, 21304, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24932, 21304, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24958, 21304, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24984, 21304, 0, 0, 0x14,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {25010, 21304, 0, 0, 0x14,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {25036, 21304, 0, 0, 0x14,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {25062, 21304, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25084, 21304, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25106, 21304, 0, 0, 0x13,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25127, 21304, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25152, 21304, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25175, 21304, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25198, 21304, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25221, 21304, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25241, 21304, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25261, 21304, 0, 0, 0x11,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25280, 21304, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25301, 21304, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25322, 21304, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25343, 21304, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25374, 21304, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25403, 21304, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25432, 21304, 0, 0, 0x1F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25460, 21304, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25490, 21304, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25520, 21304, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25549, 21304, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25571, 21304, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25593, 21304, 0, 0, 0x12,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25614, 21304, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25639, 21304, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25662, 21304, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25685, 21304, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25708, 21304, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25727, 21304, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25746, 21304, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25763, 21304, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25779, 21304, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25794, 21304, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25823, 21304, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25852, 21304, 0, 0, 0x19,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25880, 21304, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25910, 21304, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25940, 21304, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25969, 21304, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25993, 21304, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26017, 21304, 0, 0, 0x18,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26040, 21304, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26062, 21304, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26084, 21304, 0, 0, 0x17,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26105, 21304, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26125, 21304, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26145, 21304, 0, 0, 0x15,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26164, 21304, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26193, 21304, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26222, 21304, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26250, 21304, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26280, 21304, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26310, 21304, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26339, 21304, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26361, 21304, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26383, 21304, 0, 0, 0x16,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26404, 21304, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26432, 21304, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26460, 21304, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26488, 21304, 0, 0, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26515, 21304, 44, 2, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26546, 21304, 44, 2, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26577, 21304, 44, 2, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26608, 21304, 44, 2, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26638, 21304, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26667, 21304, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26696, 21304, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26725, 21304, 0, 0, 0x4E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26753, 21304, 44, 2, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26785, 21304, 44, 2, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26817, 21304, 44, 2, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26849, 21304, 44, 2, 0x4E,0x07,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26880, 21304, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26910, 21304, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26940, 21304, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26970, 21304, 0, 0, 0x4A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27000, 21304, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27028, 21304, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27056, 21304, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27084, 21304, 0, 0, 0x4B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27112, 21304, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27138, 21304, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27164, 21304, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27190, 21304, 0, 0, 0x61,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27216, 21304, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27244, 21304, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27272, 21304, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27300, 21304, 0, 0, 0x60,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27328, 27344, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27349, 27344, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27369, 27344, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27389, 27417, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27432, 27417, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27460, 27417, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27488, 27417, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27516, 27417, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27544, 27417, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27572, 27417, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27600, 27417, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27628, 27344, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27644, 27344, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27676, 27344, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27708, 27344, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27740, 27344, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27763, 27344, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27787, 27344, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27809, 27344, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27841, 27344, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27882, 27344, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27914, 27344, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27955, 27344, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27987, 27344, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28010, 27344, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28034, 27344, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28050, 27344, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28064, 27344, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28077, 27344, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28099, 27344, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28121, 27344, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28143, 27344, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28165, 27344, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28184, 27344, 46, 1, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {28213, 27344, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28231, 27344, 0, 0, 0x05,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28255, 27344, 0, 0, 0x05,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28283, 27344, 0, 0, 0x05,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28307, 27344, 0, 0, 0x05,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28335, 27344, 0, 0, 0x05,0x0A,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28366, 27344, 0, 0, 0x05,0x0A,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28401, 27344, 0, 0, 0x05,0x0C,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28430, 27344, 0, 0, 0x05,0x0C,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28463, 27344, 0, 0, 0x05,0x0D,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28486, 27344, 0, 0, 0x05,0x0D,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28513, 27344, 0, 0, 0x05,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28537, 27344, 0, 0, 0x05,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28565, 27344, 0, 0, 0x05,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28589, 27344, 0, 0, 0x05,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28617, 27344, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28636, 27344, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28655, 27344, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28674, 27344, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28699, 27344, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28724, 27344, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28749, 27344, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28765, 27344, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28781, 27344, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28797, 27344, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28812, 27344, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28831, 27344, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28847, 27344, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28862, 27344, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28879, 27344, 0, 0, 0x03,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {28894, 27344, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28912, 27344, 0, 0, 0x03,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {28931, 27344, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28943, 27344, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28963, 27344, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28983, 27344, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29003, 27344, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29027, 27344, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29051, 27344, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29075, 27344, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29099, 27344, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29123, 27344, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29147, 27344, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29172, 27344, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29193, 27344, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29221, 27344, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29247, 27344, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29268, 27344, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29291, 27344, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29312, 27344, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29335, 27344, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29354, 27344, 46, 1, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {29383, 27344, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29411, 27344, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29438, 27344, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29456, 27344, 0, 0, 0x04,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29480, 27344, 0, 0, 0x04,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29508, 27344, 0, 0, 0x04,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29532, 27344, 0, 0, 0x04,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29560, 27344, 0, 0, 0x04,0x0A,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29591, 27344, 0, 0, 0x04,0x0A,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29626, 27344, 0, 0, 0x04,0x0C,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29655, 27344, 0, 0, 0x04,0x0C,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29688, 27344, 0, 0, 0x04,0x0D,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29711, 27344, 0, 0, 0x04,0x0D,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29738, 27344, 0, 0, 0x04,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29762, 27344, 0, 0, 0x04,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29790, 27344, 0, 0, 0x04,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29814, 27344, 0, 0, 0x04,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29842, 27344, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29855, 27344, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29871, 27344, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29887, 27344, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29903, 27344, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29918, 27344, 0, 0, 0x02,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29937, 27344, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29953, 27344, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29968, 27344, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29985, 27344, 0, 0, 0x02,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {30000, 27344, 0, 0, 0x02,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30018, 27344, 0, 0, 0x02,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {30037, 27344, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30049, 27344, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30069, 27344, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30089, 27344, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30109, 27344, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30140, 27344, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30168, 30184, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30189, 30184, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30216, 30184, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30243, 30184, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30270, 30184, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30297, 30184, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30324, 30184, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30351, 30184, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30374, 30184, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30397, 30184, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30420, 30184, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30443, 30184, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30466, 30184, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30489, 30184, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30512, 30184, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30535, 30184, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30558, 30184, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30580, 30184, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30602, 30184, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30624, 30184, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30647, 30184, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30670, 30184, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30693, 30184, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30711, 30184, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30731, 30184, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30751, 30184, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30771, 30184, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30792, 30184, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30813, 30184, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30834, 30184, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30850, 30872, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30904, 30872, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30926, 30872, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30948, 30872, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30971, 30872, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30994, 30872, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31017, 30872, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31035, 31053, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31117, 31053, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31135, 31053, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31155, 31053, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31175, 30184, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31196, 30184, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31217, 30184, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31238, 30184, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31259, 30184, 0, 0, 0x25,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31280, 30184, 0, 0, 0x25,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31301, 30184, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31320, 30184, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31339, 30184, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31358, 30184, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31377, 30184, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31396, 30184, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31415, 30184, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31432, 30184, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31449, 30184, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31466, 30184, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31487, 30184, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31504, 30184, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31521, 30184, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31538, 30184, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31559, 30872, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31578, 30872, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31597, 30872, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31616, 30872, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31635, 30872, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31654, 30872, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31673, 31689, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31694, 31689, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31719, 31689, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31743, 31689, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31768, 31689, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31793, 31689, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31802, 31689, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31811, 31689, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31845, 31689, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31874, 31689, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31903, 31689, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31932, 31689, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31961, 31689, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31985, 31689, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32013, 31689, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32038, 31689, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32063, 31689, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32088, 31689, 0, 0, 0x3E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32113, 31689, 0, 0, 0x3E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32138, 31689, 0, 0, 0x3E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32163, 31689, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32187, 31689, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32211, 31689, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32235, 31689, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32259, 31689, 0, 0, 0x4B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32282, 31689, 0, 0, 0x4B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32306, 31689, 0, 0, 0x4B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32330, 31689, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32354, 31689, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32378, 31689, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32402, 31689, 0, 0, 0x4C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32426, 31689, 0, 0, 0x4C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32449, 31689, 0, 0, 0x4C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32473, 31689, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32497, 31689, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32523, 31689, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32549, 31689, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32577, 31689, 0, 0, 0x4D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32605, 31689, 0, 0, 0x4D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32633, 31689, 0, 0, 0x4D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32661, 31689, 0, 0, 0x4D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32692, 31689, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32720, 31689, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32748, 31689, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32776, 31689, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32804, 31689, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32831, 31689, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32859, 31689, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32887, 31689, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32915, 31689, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32943, 31689, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32971, 31689, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32999, 31689, 0, 0, 0x4A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33026, 31689, 0, 0, 0x4A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33054, 31689, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33082, 31689, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33108, 31689, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33134, 31689, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33160, 31689, 0, 0, 0x47,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33186, 31689, 0, 0, 0x47,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33211, 31689, 0, 0, 0x47,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33237, 31689, 0, 0, 0x47,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33263, 31689, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33289, 31689, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33315, 31689, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33341, 31689, 0, 0, 0x48,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33367, 31689, 0, 0, 0x48,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33392, 31689, 0, 0, 0x48,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33418, 31689, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33444, 31689, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33468, 31689, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33494, 31689, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33521, 31689, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33548, 31689, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33573, 31689, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33598, 31689, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33623, 31689, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33648, 31689, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33672, 31689, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33697, 31689, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33722, 31689, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33747, 31689, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33772, 31689, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33797, 31689, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33822, 31689, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33846, 31689, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33871, 31689, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33896, 31689, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33922, 31689, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33948, 31689, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33976, 31689, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33999, 31689, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34025, 31689, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34051, 31689, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34071, 31689, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34091, 31689, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34113, 31689, 0, 0, 0x61,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34134, 31689, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34159, 31689, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34184, 31689, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34209, 31689, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34234, 31689, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34258, 31689, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34283, 31689, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34308, 31689, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34333, 31689, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34358, 31689, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34383, 31689, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34408, 31689, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34432, 31689, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34457, 31689, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34482, 31689, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34510, 31689, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34541, 31689, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34572, 31689, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34597, 31689, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34622, 31689, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34652, 31689, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34678, 31689, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34708, 31689, 0, 0, 0x59,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34737, 31689, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34768, 31689, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {34783, 31689, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34804, 31689, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34826, 31689, 0, 0, 0x56,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34848, 31689, 0, 0, 0x56,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34873, 31689, 0, 0, 0x56,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34896, 31689, 0, 0, 0x56,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34919, 31689, 0, 0, 0x56,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34942, 31689, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34964, 31689, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34992, 31689, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35018, 31689, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35044, 31689, 0, 0, 0x58,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35073, 31689, 0, 0, 0x58,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35113, 31689, 0, 0, 0x58,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35152, 31689, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35176, 31689, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35205, 31689, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35236, 31689, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35268, 31689, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35296, 31689, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35318, 31689, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35344, 31689, 0, 0, 0x53,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35371, 31689, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35397, 31689, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35429, 31689, 0, 0, 0x55,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35451, 31689, 0, 0, 0x55,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35480, 31689, 0, 0, 0x55,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35509, 31689, 0, 0, 0x55,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35541, 31689, 0, 0, 0x55,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35573, 31689, 0, 0, 0x55,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35601, 31689, 0, 0, 0x55,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35629, 31689, 0, 0, 0x55,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35659, 31689, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35672, 31689, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35685, 31689, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35711, 31689, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35737, 31689, 0, 0, 0x52,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35763, 31689, 0, 0, 0x52,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35789, 31689, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35811, 31689, 0, 0, 0x52,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35833, 31689, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35856, 31689, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35879, 31689, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35902, 31689, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35925, 31689, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35947, 31689, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35970, 31689, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35993, 31689, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36016, 31689, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36039, 31689, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36062, 31689, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36085, 31689, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36107, 31689, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36130, 31689, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36153, 31689, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36178, 31689, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36203, 31689, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36228, 31689, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36253, 31689, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36277, 31689, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36302, 31689, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36327, 31689, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36352, 31689, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36377, 31689, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36402, 31689, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36427, 31689, 0, 0, 0x46,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36451, 31689, 0, 0, 0x46,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36476, 31689, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36501, 31689, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36529, 31689, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36557, 31689, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36585, 31689, 0, 0, 0x4E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36613, 31689, 0, 0, 0x4E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36640, 31689, 0, 0, 0x4E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36668, 31689, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36696, 31689, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36724, 31689, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36752, 31689, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36780, 31689, 0, 0, 0x4F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36808, 31689, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36835, 31689, 0, 0, 0x4F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36863, 31689, 0, 0, 0x4F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36891, 31689, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36914, 31689, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36938, 31689, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36961, 31689, 0, 0, 0x62,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36985, 31689, 0, 0, 0x62,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37010, 31689, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37027, 31689, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37049, 31689, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37065, 31689, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37081, 31689, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37097, 31689, 0, 0, 0x5B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37120, 31689, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37144, 31689, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37168, 31689, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37192, 31689, 0, 0, 0x30,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37215, 31689, 0, 0, 0x30,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37239, 31689, 0, 0, 0x30,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37263, 31689, 0, 0, 0x30,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37287, 31689, 0, 0, 0x30,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37310, 31689, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37337, 31689, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37364, 31689, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37391, 31689, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37422, 31689, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37451, 31689, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37480, 31689, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37509, 31689, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37537, 31689, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37566, 31689, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37595, 31689, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37624, 31689, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37652, 31689, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37679, 31689, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37706, 31689, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37733, 31689, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37759, 31689, 0, 0, 0x2D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37786, 31689, 0, 0, 0x2D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37813, 31689, 0, 0, 0x2D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37840, 31689, 0, 0, 0x2D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37866, 37895, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37927, 37895, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37956, 37895, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37985, 37895, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38013, 37895, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38042, 37895, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38071, 37895, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38100, 37895, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38128, 37895, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38163, 37895, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38198, 37895, 0, 0, 0x3C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38227, 37895, 0, 0, 0x3C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38262, 37895, 0, 0, 0x3C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38297, 37895, 0, 0, 0x3C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38326, 37895, 0, 0, 0x3C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38360, 37895, 0, 0, 0x3C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38394, 31689, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38432, 31689, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38470, 31689, 0, 0, 0x3D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38508, 31689, 0, 0, 0x3D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38546, 31689, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38580, 31689, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38614, 31689, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38647, 31689, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38681, 31689, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38715, 31689, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38748, 31689, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38780, 31689, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38812, 31689, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38843, 31689, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38875, 31689, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38907, 31689, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38938, 31689, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38976, 31689, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39014, 31689, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39052, 31689, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39089, 31689, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39127, 31689, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39165, 31689, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39203, 31689, 0, 0, 0x32,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39240, 31689, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39259, 37895, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39280, 31689, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39304, 31689, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39327, 31689, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39351, 31689, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39375, 31689, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39399, 31689, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39422, 31689, 0, 0, 0x35,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39446, 31689, 0, 0, 0x35,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39470, 31689, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39499, 31689, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39528, 31689, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39557, 31689, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39585, 31689, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39614, 31689, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39643, 31689, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39672, 31689, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39700, 31689, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39727, 31689, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39754, 31689, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39780, 31689, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39807, 31689, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39834, 31689, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39861, 31689, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39887, 31689, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39914, 37895, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39943, 37895, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39971, 37895, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40000, 37895, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40029, 37895, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40058, 37895, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40086, 37895, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40115, 37895, 0, 0, 0x1D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {40144, 31689, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40175, 31689, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40207, 31689, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40239, 31689, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40270, 31689, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40302, 31689, 0, 0, 0x38,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {40334, 31689, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40372, 31689, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40409, 31689, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40447, 31689, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40485, 31689, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40523, 31689, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40560, 31689, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40598, 31689, 0, 0, 0x37,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {40636, 31689, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40666, 31689, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40700, 31689, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40734, 31689, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40768, 31689, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40802, 31689, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40836, 31689, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40870, 31689, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40900, 31689, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40934, 31689, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40972, 31689, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41005, 31689, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41039, 31689, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41077, 31689, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {41110, 31689, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41129, 31689, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41150, 31689, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41171, 31689, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41192, 31689, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41212, 31689, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41233, 31689, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41254, 31689, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41275, 31689, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41296, 31689, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41317, 31689, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41337, 31689, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41358, 31689, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41379, 31689, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41398, 31689, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41417, 31689, 0, 0, 0x5E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41436, 31689, 0, 0, 0x5E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41454, 31689, 0, 0, 0x5E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41473, 31689, 0, 0, 0x5E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41492, 31689, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41511, 31689, 0, 0, 0x5F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41530, 31689, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41549, 31689, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41567, 31689, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41586, 31689, 0, 0, 0x5F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41605, 41621, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41626, 41621, 0, 0, 0xC2,0x04,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {41649, 41621, 0, 0, 0xC2,0x04,0x07,0x02,EVENT_OPTION_NONE_MASK}
+, {41672, 41621, 0, 0, 0xC2,0x04,0x07,0x04,EVENT_OPTION_NONE_MASK}
+, {41695, 41621, 0, 0, 0xC2,0x04,0x07,0x08,EVENT_OPTION_NONE_MASK}
+, {41718, 41621, 0, 0, 0xD5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41737, 41621, 0, 0, 0xC0,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41768, 41621, 0, 0, 0xC0,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41799, 41621, 0, 0, 0xC0,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {41830, 41621, 0, 0, 0xC0,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {41861, 41621, 0, 0, 0xC0,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {41891, 41621, 0, 0, 0xC0,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {41921, 41621, 0, 0, 0xC0,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41953, 41621, 0, 0, 0xC0,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41985, 41621, 0, 0, 0xC0,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42017, 41621, 0, 0, 0xC0,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42049, 41621, 0, 0, 0xC0,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42080, 41621, 0, 0, 0xC0,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42111, 41621, 0, 0, 0xC0,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42143, 41621, 0, 0, 0xC0,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42175, 41621, 0, 0, 0xC0,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42207, 41621, 0, 0, 0xC0,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42239, 41621, 0, 0, 0xC0,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42270, 41621, 0, 0, 0xC0,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42301, 41621, 0, 0, 0xC0,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42334, 41621, 0, 0, 0xC0,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42367, 41621, 0, 0, 0xC0,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42400, 41621, 0, 0, 0xC0,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42433, 41621, 0, 0, 0xC0,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42465, 41621, 0, 0, 0xC0,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42497, 41621, 0, 0, 0xC0,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42528, 41621, 0, 0, 0xC0,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42559, 41621, 0, 0, 0xC0,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42590, 41621, 0, 0, 0xC0,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42621, 41621, 0, 0, 0xC0,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42651, 41621, 0, 0, 0xC0,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42681, 41621, 0, 0, 0xC0,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42713, 41621, 0, 0, 0xC0,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42745, 41621, 0, 0, 0xC0,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42777, 41621, 0, 0, 0xC0,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42809, 41621, 0, 0, 0xC0,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42840, 41621, 0, 0, 0xC0,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42871, 41621, 0, 0, 0xC0,0x80,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42901, 41621, 0, 0, 0xC0,0x80,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42931, 41621, 0, 0, 0xC0,0x80,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42961, 41621, 0, 0, 0xC0,0x80,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42991, 41621, 0, 0, 0xC0,0x80,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43020, 41621, 0, 0, 0xC0,0x80,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43049, 41621, 0, 0, 0xC0,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43080, 41621, 0, 0, 0xC0,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43111, 41621, 0, 0, 0xC0,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43142, 41621, 0, 0, 0xC0,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43173, 41621, 0, 0, 0xC0,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43203, 41621, 0, 0, 0xC0,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43233, 41621, 0, 0, 0x83,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43264, 41621, 0, 0, 0x83,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43295, 41621, 0, 0, 0x83,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43326, 41621, 0, 0, 0x83,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43357, 41621, 0, 0, 0x83,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43387, 41621, 0, 0, 0x83,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43417, 41621, 0, 0, 0x83,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43449, 41621, 0, 0, 0x83,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43481, 41621, 0, 0, 0x83,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43513, 41621, 0, 0, 0x83,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43545, 41621, 0, 0, 0x83,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43576, 41621, 0, 0, 0x83,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43607, 41621, 0, 0, 0x83,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43639, 41621, 0, 0, 0x83,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43671, 41621, 0, 0, 0x83,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43703, 41621, 0, 0, 0x83,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43735, 41621, 0, 0, 0x83,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43766, 41621, 0, 0, 0x83,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43797, 41621, 0, 0, 0x83,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43830, 41621, 0, 0, 0x83,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43863, 41621, 0, 0, 0x83,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43896, 41621, 0, 0, 0x83,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43929, 41621, 0, 0, 0x83,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43961, 41621, 0, 0, 0x83,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43993, 41621, 0, 0, 0x83,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44022, 41621, 0, 0, 0x83,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44051, 41621, 0, 0, 0x83,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44080, 41621, 0, 0, 0x83,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44109, 41621, 0, 0, 0x83,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44137, 41621, 0, 0, 0x83,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44165, 41621, 0, 0, 0x83,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44197, 41621, 0, 0, 0x83,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44229, 41621, 0, 0, 0x83,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44261, 41621, 0, 0, 0x83,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44293, 41621, 0, 0, 0x83,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44324, 41621, 0, 0, 0x83,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44355, 41621, 0, 0, 0x83,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44381, 41621, 0, 0, 0x83,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44407, 41621, 0, 0, 0x83,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44433, 41621, 0, 0, 0x83,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44459, 41621, 0, 0, 0x83,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44484, 41621, 0, 0, 0x83,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44509, 41621, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44527, 41621, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44544, 41621, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44555, 41621, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44575, 41621, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44595, 41621, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44624, 41621, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {44649, 41621, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {44678, 41621, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {44711, 41621, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44730, 41621, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44749, 41621, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44777, 41621, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {44801, 41621, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {44829, 41621, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {44861, 41621, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44869, 41621, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44882, 41621, 0, 0, 0xC1,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44912, 41621, 0, 0, 0xC1,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44942, 41621, 0, 0, 0xC1,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44972, 41621, 0, 0, 0xC1,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45002, 41621, 0, 0, 0xC1,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45031, 41621, 0, 0, 0xC1,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45060, 41621, 0, 0, 0xC1,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45091, 41621, 0, 0, 0xC1,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45122, 41621, 0, 0, 0xC1,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45153, 41621, 0, 0, 0xC1,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45184, 41621, 0, 0, 0xC1,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45214, 41621, 0, 0, 0xC1,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45244, 41621, 0, 0, 0xC1,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45275, 41621, 0, 0, 0xC1,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45306, 41621, 0, 0, 0xC1,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45337, 41621, 0, 0, 0xC1,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45368, 41621, 0, 0, 0xC1,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45398, 41621, 0, 0, 0xC1,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45428, 41621, 0, 0, 0xC1,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45460, 41621, 0, 0, 0xC1,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45492, 41621, 0, 0, 0xC1,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45524, 41621, 0, 0, 0xC1,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45556, 41621, 0, 0, 0xC1,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45587, 41621, 0, 0, 0xC1,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45618, 41621, 0, 0, 0xC1,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45648, 41621, 0, 0, 0xC1,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45678, 41621, 0, 0, 0xC1,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45708, 41621, 0, 0, 0xC1,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45738, 41621, 0, 0, 0xC1,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45767, 41621, 0, 0, 0xC1,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45796, 41621, 0, 0, 0xC1,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45827, 41621, 0, 0, 0xC1,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45858, 41621, 0, 0, 0xC1,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45889, 41621, 0, 0, 0xC1,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45920, 41621, 0, 0, 0xC1,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45950, 41621, 0, 0, 0xC1,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45980, 41621, 0, 0, 0xC1,0x80,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46009, 41621, 0, 0, 0xC1,0x80,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46038, 41621, 0, 0, 0xC1,0x80,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46067, 41621, 0, 0, 0xC1,0x80,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46096, 41621, 0, 0, 0xC1,0x80,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46124, 41621, 0, 0, 0xC1,0x80,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46152, 41621, 0, 0, 0xC1,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46182, 41621, 0, 0, 0xC1,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46212, 41621, 0, 0, 0xC1,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46242, 41621, 0, 0, 0xC1,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46272, 41621, 0, 0, 0xC1,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46301, 41621, 0, 0, 0xC1,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46330, 41621, 0, 0, 0x84,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46360, 41621, 0, 0, 0x84,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46390, 41621, 0, 0, 0x84,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46420, 41621, 0, 0, 0x84,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46450, 41621, 0, 0, 0x84,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46479, 41621, 0, 0, 0x84,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46508, 41621, 0, 0, 0x84,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46539, 41621, 0, 0, 0x84,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46570, 41621, 0, 0, 0x84,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46601, 41621, 0, 0, 0x84,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46632, 41621, 0, 0, 0x84,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46662, 41621, 0, 0, 0x84,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46692, 41621, 0, 0, 0x84,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46723, 41621, 0, 0, 0x84,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46754, 41621, 0, 0, 0x84,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46785, 41621, 0, 0, 0x84,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46816, 41621, 0, 0, 0x84,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46846, 41621, 0, 0, 0x84,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46876, 41621, 0, 0, 0x84,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46908, 41621, 0, 0, 0x84,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46940, 41621, 0, 0, 0x84,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46972, 41621, 0, 0, 0x84,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {47004, 41621, 0, 0, 0x84,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {47035, 41621, 0, 0, 0x84,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {47066, 41621, 0, 0, 0x84,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {47094, 41621, 0, 0, 0x84,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {47122, 41621, 0, 0, 0x84,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {47150, 41621, 0, 0, 0x84,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {47178, 41621, 0, 0, 0x84,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {47205, 41621, 0, 0, 0x84,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {47232, 41621, 0, 0, 0x84,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {47263, 41621, 0, 0, 0x84,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {47294, 41621, 0, 0, 0x84,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {47325, 41621, 0, 0, 0x84,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {47356, 41621, 0, 0, 0x84,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {47386, 41621, 0, 0, 0x84,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {47416, 41621, 0, 0, 0x84,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {47441, 41621, 0, 0, 0x84,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {47466, 41621, 0, 0, 0x84,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {47491, 41621, 0, 0, 0x84,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {47516, 41621, 0, 0, 0x84,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {47540, 41621, 0, 0, 0x84,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {47564, 41621, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47587, 41621, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47608, 41621, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {47627, 41621, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {47646, 41621, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {47665, 41621, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {47685, 41621, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {47705, 41621, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {47726, 41621, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47740, 47759, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47819, 47838, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47898, 47917, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47977, 47996, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48056, 48076, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48136, 48156, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48216, 48236, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48296, 48316, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48376, 48393, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48447, 48469, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48529, 48551, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48611, 48633, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48693, 48715, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48775, 48798, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48858, 48881, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48941, 48964, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49024, 49047, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49107, 49122, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49126, 49122, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49152, 49122, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49179, 49122, 0, 0, 0x0F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49205, 49122, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49227, 49122, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49244, 49122, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49261, 49122, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49278, 49122, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49298, 49122, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49322, 49122, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49342, 49122, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {49363, 49122, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49372, 49122, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49384, 49122, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49398, 49122, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49415, 49122, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49439, 49122, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49464, 49122, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49479, 49122, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49494, 49122, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49519, 49122, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49544, 49122, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49573, 49122, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49594, 49122, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49617, 49122, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {49636, 49122, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49649, 49122, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49662, 49122, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49675, 49122, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49688, 49122, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49703, 49122, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49724, 49122, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49743, 49122, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49755, 49122, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49769, 49122, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49789, 49122, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49809, 49122, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49830, 49122, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49852, 49122, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49873, 49122, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49908, 49122, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49929, 49122, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {49964, 49122, 0, 0, 0x12,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {49988, 49122, 0, 0, 0x12,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {50012, 49122, 0, 0, 0x12,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {50035, 49122, 0, 0, 0x12,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {50058, 49122, 0, 0, 0x12,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {50083, 49122, 0, 0, 0x12,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {50108, 49122, 0, 0, 0x12,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {50132, 49122, 0, 0, 0x12,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {50156, 49122, 0, 0, 0x12,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {50182, 49122, 0, 0, 0x12,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {50208, 49122, 0, 0, 0x12,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {50233, 49122, 0, 0, 0x12,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {50258, 49122, 0, 0, 0x12,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {50283, 49122, 0, 0, 0x12,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {50308, 49122, 0, 0, 0x12,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {50332, 49122, 0, 0, 0x12,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {50356, 49122, 0, 0, 0x12,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {50383, 49122, 0, 0, 0x12,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {50410, 49122, 0, 0, 0x12,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {50436, 49122, 0, 0, 0x12,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {50462, 49122, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50481, 49122, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50501, 49122, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50522, 49122, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50543, 49122, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50563, 49122, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50582, 49122, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50605, 49122, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50620, 49122, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50643, 49122, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50662, 49122, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50683, 49122, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50706, 49122, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50725, 49122, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50746, 49122, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50769, 49122, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50788, 49122, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50809, 49122, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50837, 49122, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50865, 49122, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50886, 49122, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50907, 49122, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50929, 50954, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50973, 50954, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50998, 50954, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51023, 50954, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51048, 50954, 0, 0, 0x80,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51073, 50954, 0, 0, 0x80,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51098, 50954, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51124, 50954, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51150, 50954, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51176, 50954, 0, 0, 0x82,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51202, 50954, 0, 0, 0x82,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51228, 50954, 0, 0, 0x82,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51254, 50954, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51279, 50954, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51304, 50954, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51329, 50954, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51354, 50954, 0, 0, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51379, 50954, 0, 0, 0x84,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51404, 50954, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51430, 50954, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51456, 50954, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51482, 50954, 0, 0, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51508, 50954, 0, 0, 0x86,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51534, 50954, 0, 0, 0x86,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51560, 50954, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51585, 50954, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51610, 50954, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51635, 50954, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51660, 50954, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51685, 50954, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51710, 50954, 0, 0, 0x8A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51736, 50954, 0, 0, 0x8A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51762, 50954, 0, 0, 0x8A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51788, 50954, 0, 0, 0x8A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51814, 50954, 0, 0, 0x8A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51840, 50954, 0, 0, 0x8A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51866, 50954, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51891, 50954, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51916, 50954, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51941, 50954, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51966, 50954, 0, 0, 0x8C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51991, 50954, 0, 0, 0x8C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52016, 50954, 0, 0, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52042, 50954, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52068, 50954, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52094, 50954, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52120, 50954, 0, 0, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52146, 50954, 0, 0, 0x8E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52172, 50954, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52187, 50954, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52217, 50954, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52247, 50954, 0, 0, 0xA5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52266, 50954, 0, 0, 0xA5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52285, 50954, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52315, 50954, 0, 0, 0xA7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52344, 50954, 0, 0, 0xA7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52375, 50954, 0, 0, 0xA7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52405, 50954, 0, 0, 0xA9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52435, 50954, 0, 0, 0xA9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52464, 50954, 0, 0, 0xA9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52495, 50954, 0, 0, 0xA9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52525, 50954, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52555, 50954, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52584, 50954, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52615, 50954, 0, 0, 0xAB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52645, 50954, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52670, 50954, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52696, 50954, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52717, 50954, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52738, 50954, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52759, 50954, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52780, 50954, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52801, 50954, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52822, 50954, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52843, 50954, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52864, 50954, 0, 0, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52890, 50954, 0, 0, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52916, 50954, 0, 0, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52942, 50954, 0, 0, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52968, 50954, 0, 0, 0xA3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52998, 50954, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53024, 50954, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53050, 50954, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53076, 50954, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53102, 50954, 0, 0, 0xA4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {53117, 50954, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53141, 50954, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53165, 50954, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53189, 50954, 0, 0, 0xB4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53213, 50954, 0, 0, 0xB4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53233, 50954, 0, 0, 0xB4,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53253, 50954, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53271, 50954, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53289, 50954, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53307, 50954, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53325, 50954, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53343, 50954, 0, 0, 0xB2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53361, 50954, 0, 0, 0xB2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53375, 50954, 0, 0, 0xB2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53389, 50954, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53412, 50954, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53435, 50954, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53458, 50954, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53481, 50954, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53504, 50954, 0, 0, 0xB3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53527, 50954, 0, 0, 0xB3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {53547, 50954, 0, 0, 0xB3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53566, 50954, 0, 0, 0xB3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53585, 50954, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53604, 50954, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53623, 50954, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53642, 50954, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53661, 50954, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53680, 50954, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53699, 50954, 0, 0, 0xB1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53714, 50954, 0, 0, 0xB1,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53729, 50954, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53750, 50954, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53771, 50954, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53792, 50954, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53813, 50954, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53834, 50954, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53855, 50954, 0, 0, 0xB0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53872, 50954, 0, 0, 0xB0,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53889, 50954, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53917, 50954, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53944, 50954, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53972, 50954, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53999, 50954, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54027, 50954, 0, 0, 0xA8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54054, 50954, 0, 0, 0xA8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54082, 50954, 0, 0, 0xA8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54109, 50954, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54137, 50954, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54164, 50954, 0, 0, 0xAA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54192, 50954, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54219, 50954, 0, 0, 0xAC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54242, 50954, 0, 0, 0xAC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable cascadelakeX_arch_events = {
+    NUM_ARCH_EVENTS_CASCADELAKEX,
+    cascadelakeX_arch_event_strings,
+    cascadelakeX_arch_event_options,
+    cascadelakeX_arch_event_entries
+};
@@ -0,0 +1,423 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_CAVTX2 200
+
+static const char cavtx2_arch_event_strings[] =
+    "SW_INCR\0"
+    "PMC\0"
+    "L1I_CACHE_REFILL\0"
+    "L1I_TLB_REFILL\0"
+    "L1D_CACHE_REFILL\0"
+    "L1D_CACHE\0"
+    "L1D_TLB_REFILL\0"
+    "LD_RETIRED\0"
+    "ST_RETIRED\0"
+    "INST_RETIRED\0"
+    "EXC_TAKEN\0"
+    "EXC_RETURN\0"
+    "CID_WRITE_RETIRED\0"
+    "BR_IMMED_RETIRED\0"
+    "BR_RETURN_RETIRED\0"
+    "UNALIGNED_LDST_RETIRED\0"
+    "BR_MIS_PRED\0"
+    "CPU_CYCLES\0"
+    "BR_PRED\0"
+    "MEM_ACCESS\0"
+    "L1I_CACHE\0"
+    "L1D_CACHE_WB\0"
+    "L2D_CACHE\0"
+    "L2D_CACHE_REFILL\0"
+    "L2D_CACHE_WB\0"
+    "BUS_ACCESS\0"
+    "MEMORY_ERROR\0"
+    "INST_SPEC\0"
+    "TTBR_WRITE_RETIRED\0"
+    "BUS_CYCLES\0"
+    "CHAIN\0"
+    "L1D_CACHE_ALLOCATE\0"
+    "L2D_CACHE_ALLOCATE\0"
+    "BR_RETIRED\0"
+    "BR_MIS_PRED_RETIRED\0"
+    "STALL_FRONTEND\0"
+    "STALL_BACKEND\0"
+    "L1D_TLB\0"
+    "L1I_TLB\0"
+    "L2D_TLB_REFILL\0"
+    "L2I_TLB_REFILL\0"
+    "L2D_TLB\0"
+    "L2I_TLB\0"
+    "L1D_CACHE_LD\0"
+    "L1D_CACHE_RD\0"
+    "L1D_CACHE_ST\0"
+    "L1D_CACHE_WR\0"
+    "L1D_CACHE_REFILL_LD\0"
+    "L1D_CACHE_REFILL_RD\0"
+    "L1D_CACHE_REFILL_ST\0"
+    "L1D_CACHE_REFILL_WR\0"
+    "L1D_CACHE_REFILL_INNER\0"
+    "L1D_CACHE_REFILL_OUTER\0"
+    "L1D_CACHE_WB_VICTIM\0"
+    "L1D_CACHE_WB_CLEAN\0"
+    "L1D_CACHE_INVAL\0"
+    "L1D_TLB_REFILL_LD\0"
+    "L1D_TLB_REFILL_RD\0"
+    "L1D_TLB_REFILL_ST\0"
+    "L1D_TLB_REFILL_WR\0"
+    "L1D_TLB_LD\0"
+    "L1D_TLB_RD\0"
+    "L1D_TLB_ST\0"
+    "L1D_TLB_WR\0"
+    "L2D_CACHE_LD\0"
+    "L2D_CACHE_RD\0"
+    "L2D_CACHE_ST\0"
+    "L2D_CACHE_WR\0"
+    "L2D_CACHE_REFILL_LD\0"
+    "L2D_CACHE_REFILL_RD\0"
+    "L2D_CACHE_REFILL_ST\0"
+    "L2D_CACHE_REFILL_WR\0"
+    "L2D_CACHE_WB_VICTIM\0"
+    "L2D_CACHE_WB_CLEAN\0"
+    "L2D_CACHE_INVAL\0"
+    "L2D_TLB_REFILL_LD\0"
+    "L2D_TLB_REFILL_RD\0"
+    "L2D_TLB_REFILL_ST\0"
+    "L2D_TLB_REFILL_WR\0"
+    "L2D_TLB_LD\0"
+    "L2D_TLB_RD\0"
+    "L2D_TLB_ST\0"
+    "L2D_TLB_WR\0"
+    "BUS_ACCESS_LD\0"
+    "BUS_ACCESS_RD\0"
+    "BUS_ACCESS_ST\0"
+    "BUS_ACCESS_WR\0"
+    "BUS_ACCESS_SHARED\0"
+    "BUS_ACCESS_NOT_SHARED\0"
+    "BUS_ACCESS_NORMAL\0"
+    "BUS_ACCESS_PERIPH\0"
+    "MEM_ACCESS_LD\0"
+    "MEM_ACCESS_RD\0"
+    "MEM_ACCESS_ST\0"
+    "MEM_ACCESS_WR\0"
+    "UNALIGNED_LD_SPEC\0"
+    "UNALIGNED_ST_SPEC\0"
+    "UNALIGNED_LDST_SPEC\0"
+    "LDREX_SPEC\0"
+    "STREX_PASS_SPEC\0"
+    "STREX_FAIL_SPEC\0"
+    "STREX_SPEC\0"
+    "LD_SPEC\0"
+    "ST_SPEC\0"
+    "LDST_SPEC\0"
+    "DP_SPEC\0"
+    "ASE_SPEC\0"
+    "VFP_SPEC\0"
+    "PC_WRITE_SPEC\0"
+    "CRYPTO_SPEC\0"
+    "BR_IMMED_SPEC\0"
+    "BR_RETURN_SPEC\0"
+    "BR_INDIRECT_SPEC\0"
+    "ISB_SPEC\0"
+    "DSB_SPEC\0"
+    "DMB_SPEC\0"
+    "EXC_UNDEF\0"
+    "EXC_SVC\0"
+    "EXC_PABORT\0"
+    "EXC_DABORT\0"
+    "EXC_IRQ\0"
+    "EXC_FIQ\0"
+    "EXC_SMC\0"
+    "EXC_HVC\0"
+    "EXC_TRAP_PABORT\0"
+    "EXC_TRAP_DABORT\0"
+    "EXC_TRAP_OTHER\0"
+    "EXC_TRAP_IRQ\0"
+    "EXC_TRAP_FIQ\0"
+    "RC_LD_SPEC\0"
+    "RC_ST_SPEC\0"
+    "L1D_LHS_VANOTP\0"
+    "L1D_LHS_OVRLAP\0"
+    "L1D_LHS_VANOSD\0"
+    "L1D_LHS_FWD\0"
+    "L1D_BNKCFL\0"
+    "L1D_LSMQ_FULL\0"
+    "L1D_LSMQ_HIT\0"
+    "L1D_EXPB_MISS\0"
+    "L1D_L2EV_MISS\0"
+    "L1D_EXPB_HITM\0"
+    "L1D_L2EV_HITM\0"
+    "L1D_EXPB_HIT\0"
+    "L1D_L2EV_HIT\0"
+    "L1D_EXPB_RETRY\0"
+    "L1D_L2EV_RETRY\0"
+    "L1D_ST_RMW\0"
+    "L1D_LSMQ00_LDREQ\0"
+    "L1D_LSMQ00_LDVLD\0"
+    "L1D_LSMQ15_STREQ\0"
+    "L1D_LSMQ15_STVLD\0"
+    "L1D_PB_FLUSH\0"
+    "BR_COND_MIS_PRED_RETIRED\0"
+    "BR_IND_MIS_PRED_RETIRED\0"
+    "BR_RETURN_MIS_PREDRETIRED\0"
+    "OP_RETIRED\0"
+    "LD_OP_RETIRED\0"
+    "ST_OP_RETIRED\0"
+    "FUSED_OP_RETIRED\0"
+    "IRQ_MASK\0"
+    "FIQ_MASK\0"
+    "SERROR_MASK\0"
+    "WFIWFE_SLEEP\0"
+    "L2TLB_4K_PAGE_MISS\0"
+    "L2TLB_64K_PAGE_MISS\0"
+    "L2TLB_2M_PAGE_MISS\0"
+    "L2TLB_512M_PAGE_MISS\0"
+    "ISB_EMPTY\0"
+    "ISB_FULL\0"
+    "STALL_NOTSELECTED\0"
+    "ROB_RECYCLE\0"
+    "ISSQ_RECYCLE\0"
+    "GPR_RECYCLE\0"
+    "FPR_RECYCLE\0"
+    "LRQ_RECYCLE\0"
+    "SRQ_RECYCLE\0"
+    "BSR_RECYCLE\0"
+    "UOPSFUSED\0"
+    "L2D_TLBI_INT\0"
+    "L2D_TLBI_EXT\0"
+    "L2D_HWPF_DMD_HIT\0"
+    "L2D_HWPF_REQ_VAL\0"
+    "L2D_HWPF_REQ_LD\0"
+    "L2D_HWPF_REQ_MISS\0"
+    "L2D_HWPF_NEXT_LINE\0"
+    "EVICT_REQUESTS\0"
+    "CBOX\0"
+    "INV_HIT\0"
+    "INV_NWRITE_HIT\0"
+    "INV_NWRITE_REQUESTS\0"
+    "INV_REQUESTS\0"
+    "READ_HIT\0"
+    "READ_REQUESTS\0"
+    "WRITEBACK_REQUESTS\0"
+    "MBOX_CLOCKTICKS\0"
+    "MBOX\0"
+    "MEM_DATA_TRANSFERS\0"
+    "MEMORY_READS\0"
+    "MEMORY_WRITES\0"
+    "REQ_PKT_SENT\0"
+    "SBOX\0"
+    "SNOOP_PKT_SENT\0"
+    "DATA_PKT_SENT\0"
+    "GIC_PKT_SENT\0";
+
+static const PerfmonEventOption cavtx2_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry cavtx2_arch_event_entries[NUM_ARCH_EVENTS_CAVTX2] = {
+ {0, 8, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12, 8, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 8, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44, 8, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 8, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 8, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 8, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {97, 8, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {108, 8, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 8, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {131, 8, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {142, 8, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {160, 8, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {177, 8, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {195, 8, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 8, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {230, 8, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {241, 8, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {249, 8, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {260, 8, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {270, 8, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {283, 8, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {293, 8, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 8, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {323, 8, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {334, 8, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {347, 8, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {357, 8, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {376, 8, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {387, 8, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {393, 8, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {412, 8, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {431, 8, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {442, 8, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 8, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {477, 8, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {491, 8, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {499, 8, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {507, 8, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {522, 8, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {537, 8, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {545, 8, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 8, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {566, 8, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {579, 8, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {592, 8, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {605, 8, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {625, 8, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {645, 8, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {665, 8, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {685, 8, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {708, 8, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {731, 8, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {751, 8, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {770, 8, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {786, 8, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {804, 8, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {822, 8, 0, 0, 0x4D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {840, 8, 0, 0, 0x4D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {858, 8, 0, 0, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {869, 8, 0, 0, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {880, 8, 0, 0, 0x4F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {891, 8, 0, 0, 0x4F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {902, 8, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {915, 8, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {928, 8, 0, 0, 0x51,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {941, 8, 0, 0, 0x51,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {954, 8, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {974, 8, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {994, 8, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1014, 8, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1034, 8, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1054, 8, 0, 0, 0x57,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1073, 8, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1089, 8, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1107, 8, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1125, 8, 0, 0, 0x5D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1143, 8, 0, 0, 0x5D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1161, 8, 0, 0, 0x5E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1172, 8, 0, 0, 0x5E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1183, 8, 0, 0, 0x5F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1194, 8, 0, 0, 0x5F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1205, 8, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1219, 8, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1233, 8, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1247, 8, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1261, 8, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1279, 8, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1301, 8, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1319, 8, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1337, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1351, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1365, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1379, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1393, 8, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1411, 8, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1429, 8, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1449, 8, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1460, 8, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1476, 8, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1492, 8, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1503, 8, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1511, 8, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1519, 8, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1529, 8, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1537, 8, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1546, 8, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1555, 8, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1569, 8, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1581, 8, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1595, 8, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1610, 8, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1627, 8, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1636, 8, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1645, 8, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1654, 8, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1664, 8, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1672, 8, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1683, 8, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1694, 8, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1702, 8, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1710, 8, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1718, 8, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1726, 8, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1742, 8, 0, 0, 0x8C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1758, 8, 0, 0, 0x8D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1773, 8, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1786, 8, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1799, 8, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1810, 8, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1821, 8, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1836, 8, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1851, 8, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1866, 8, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1878, 8, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1889, 8, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1903, 8, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1916, 8, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1930, 8, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1944, 8, 0, 0, 0xCB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1958, 8, 0, 0, 0xCC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1972, 8, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1985, 8, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1998, 8, 0, 0, 0xCF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2013, 8, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2028, 8, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 8, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2056, 8, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2073, 8, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2090, 8, 0, 0, 0xD5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2107, 8, 0, 0, 0xD6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2120, 8, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2145, 8, 0, 0, 0xE1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2169, 8, 0, 0, 0xE2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2195, 8, 0, 0, 0xE8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2206, 8, 0, 0, 0xE9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2220, 8, 0, 0, 0xEA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2234, 8, 0, 0, 0xEB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2251, 8, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2260, 8, 0, 0, 0xF9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2269, 8, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2281, 8, 0, 0, 0x108,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2294, 8, 0, 0, 0x127,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2313, 8, 0, 0, 0x128,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2333, 8, 0, 0, 0x129,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2352, 8, 0, 0, 0x12A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2373, 8, 0, 0, 0x150,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2383, 8, 0, 0, 0x151,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2392, 8, 0, 0, 0x152,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 8, 0, 0, 0x153,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2422, 8, 0, 0, 0x154,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2435, 8, 0, 0, 0x155,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2447, 8, 0, 0, 0x156,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2459, 8, 0, 0, 0x158,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2471, 8, 0, 0, 0x159,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2483, 8, 0, 0, 0x15B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2495, 8, 0, 0, 0x164,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2505, 8, 0, 0, 0x20B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2518, 8, 0, 0, 0x20C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2531, 8, 0, 0, 0x218,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2548, 8, 0, 0, 0x219,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2565, 8, 0, 0, 0x21A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2581, 8, 0, 0, 0x21B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2599, 8, 0, 0, 0x21C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2618, 2633, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2638, 2633, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2646, 2633, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2661, 2633, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2681, 2633, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2694, 2633, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2703, 2633, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2717, 2633, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2736, 2752, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2757, 2752, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2776, 2752, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2789, 2752, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2803, 2816, 0, 0, 0x3D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2821, 2816, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2836, 2816, 0, 0, 0x105,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2850, 2816, 0, 0, 0x12D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable cavtx2_arch_events = {
+    NUM_ARCH_EVENTS_CAVTX2,
+    cavtx2_arch_event_strings,
+    cavtx2_arch_event_options,
+    cavtx2_arch_event_entries
+};
@@ -0,0 +1,881 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_CORE2 423
+
+static const char core2_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LOAD_BLOCK_STA\0"
+    "PMC\0"
+    "LOAD_BLOCK_STD\0"
+    "LOAD_BLOCK_OVERLAP_STORE\0"
+    "LOAD_BLOCK_UNTIL_RETIRE\0"
+    "LOAD_BLOCK_L1D\0"
+    "SB_DRAIN_CYCLES\0"
+    "STORE_BLOCK_ORDER\0"
+    "STORE_BLOCK_SNOOP\0"
+    "MISALIGN_MEM_REF\0"
+    "SEGMENT_REG_LOADS\0"
+    "SSE_PRE_NTA\0"
+    "SSE_PRE_L1\0"
+    "SSE_PRE_L2\0"
+    "SSE_PRE_STORES\0"
+    "DTLB_MISSES_ANY\0"
+    "DTLB_MISSES_MISS_LD\0"
+    "DTLB_MISSES_L0_MISS_LD\0"
+    "DTLB_MISSES_MISS_ST\0"
+    "MEMORY_DISAMBIGUATION_RESET\0"
+    "MEMORY_DISAMBIGUATION_SUCCESS\0"
+    "PAGE_WALK_COUNT\0"
+    "PAGE_WALK_CYCLES\0"
+    "FP_COMP_OPS_EXE\0"
+    "PMC0\0"
+    "FP_ASSIST\0"
+    "PMC1\0"
+    "MUL\0"
+    "DIV\0"
+    "CYCLES_DIV_BUSY\0"
+    "IDLE_DURING_DIV\0"
+    "DELAYED_BYPASS_FP\0"
+    "DELAYED_BYPASS_SIMD\0"
+    "DELAYED_BYPASS_LOAD\0"
+    "L2_ADS_ALL_CORES\0"
+    "L2_ADS_THIS_CORE\0"
+    "L2_DBUS_BUSY_ALL_CORES\0"
+    "L2_DBUS_BUSY_THIS_CORE\0"
+    "L2_DBUS_BUSY_RD_ALL_CORES\0"
+    "L2_DBUS_BUSY_RD_THIS_CORE\0"
+    "L2_LINES_IN_ALL_CORES_ALL\0"
+    "L2_LINES_IN_THIS_CORE_ALL\0"
+    "L2_LINES_IN_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_LINES_IN_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_LINES_IN_ALL_CORES_NO_PREFETCH\0"
+    "L2_LINES_IN_THIS_CORE_NO_PREFETCH\0"
+    "L2_M_LINES_IN_ALL_CORES\0"
+    "L2_M_LINES_IN_THIS_CORE\0"
+    "L2_LINES_OUT_ALL_CORES_ALL\0"
+    "L2_LINES_OUT_THIS_CORE_ALL\0"
+    "L2_LINES_OUT_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_LINES_OUT_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_LINES_OUT_ALL_CORES_NO_PREFETCH\0"
+    "L2_LINES_OUT_THIS_CORE_NO_PREFETCH\0"
+    "L2_M_LINES_OUT_ALL_CORES_ALL\0"
+    "L2_M_LINES_OUT_THIS_CORE_ALL\0"
+    "L2_M_LINES_OUT_ALL_CORES_PREFETCH_ONLY\0"
+    "L2_M_LINES_OUT_THIS_CORE_PREFETCH_ONLY\0"
+    "L2_M_LINES_OUT_ALL_CORES_NO_PREFETCH\0"
+    "L2_M_LINES_OUT_THIS_CORE_NO_PREFETCH\0"
+    "L2_IFETCH_ALL_CORES_MODIFIED\0"
+    "L2_IFETCH_ALL_CORES_EXCLUSIVE\0"
+    "L2_IFETCH_ALL_CORES_SHARED\0"
+    "L2_IFETCH_ALL_CORES_INVALID\0"
+    "L2_IFETCH_ALL_CORES_MESI\0"
+    "L2_IFETCH_THIS_CORE_MODIFIED\0"
+    "L2_IFETCH_THIS_CORE_EXCLUSIVE\0"
+    "L2_IFETCH_THIS_CORE_SHARED\0"
+    "L2_IFETCH_THIS_CORE_INVALID\0"
+    "L2_IFETCH_THIS_CORE_MESI\0"
+    "L2_LD_ALL_CORES_ALL_MODIFIED\0"
+    "L2_LD_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_ALL_SHARED\0"
+    "L2_LD_ALL_CORES_ALL_INVALID\0"
+    "L2_LD_ALL_CORES_ALL_MESI\0"
+    "L2_LD_THIS_CORE_ALL_MODIFIED\0"
+    "L2_LD_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_ALL_SHARED\0"
+    "L2_LD_THIS_CORE_ALL_INVALID\0"
+    "L2_LD_THIS_CORE_ALL_MESI\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_LD_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_LD_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_LD_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_INVALID\0"
+    "L2_LD_THIS_CORE_NO_PREFETCH_MESI\0"
+    "L2_ST_ALL_CORES_MODIFIED\0"
+    "L2_ST_ALL_CORES_EXCLUSIVE\0"
+    "L2_ST_ALL_CORES_SHARED\0"
+    "L2_ST_ALL_CORES_INVALID\0"
+    "L2_ST_ALL_CORES_MESI\0"
+    "L2_ST_THIS_CORE_MODIFIED\0"
+    "L2_ST_THIS_CORE_EXCLUSIVE\0"
+    "L2_ST_THIS_CORE_SHARED\0"
+    "L2_ST_THIS_CORE_INVALID\0"
+    "L2_ST_THIS_CORE_MESI\0"
+    "L2_LOCK_ALL_CORES_MODIFIED\0"
+    "L2_LOCK_ALL_CORES_EXCLUSIVE\0"
+    "L2_LOCK_ALL_CORES_SHARED\0"
+    "L2_LOCK_ALL_CORES_INVALID\0"
+    "L2_LOCK_ALL_CORES_MESI\0"
+    "L2_LOCK_THIS_CORE_MODIFIED\0"
+    "L2_LOCK_THIS_CORE_EXCLUSIVE\0"
+    "L2_LOCK_THIS_CORE_SHARED\0"
+    "L2_LOCK_THIS_CORE_INVALID\0"
+    "L2_LOCK_THIS_CORE_MESI\0"
+    "L2_RQSTS_ALL_CORES_ALL_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_ALL_SHARED\0"
+    "L2_RQSTS_ALL_CORES_ALL_INVALID\0"
+    "L2_RQSTS_ALL_CORES_ALL_MESI\0"
+    "L2_RQSTS_THIS_CORE_ALL_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_ALL_SHARED\0"
+    "L2_RQSTS_THIS_CORE_ALL_INVALID\0"
+    "L2_RQSTS_THIS_CORE_ALL_MESI\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_RQSTS_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_RQSTS_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_RQSTS_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_RQSTS_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_RQSTS_SELF_I_STATE\0"
+    "L2_RQSTS_SELF_MESI\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_ALL_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_ALL_MESI\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_PREFETCH_ONLY_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_PREFETCH_ONLY_MESI\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_MODIFIED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_SHARED\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_INVALID\0"
+    "L2_REJECT_BUSQ_ALL_CORES_NO_PREFETCH_MESI\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_MODIFIED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_EXCLUSIVE\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_SHARED\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_INVALID\0"
+    "L2_REJECT_BUSQ_THIS_CORE_NO_PREFETCH_MESI\0"
+    "L2_NO_REQ_ALL_CORES\0"
+    "L2_NO_REQ_THIS_CORE\0"
+    "EIST_TRANS_ANY\0"
+    "EIST_TRANS_FREQ\0"
+    "THERMAL_TRIP\0"
+    "CPU_CLK_UNHALTED_CORE_P\0"
+    "CPU_CLK_UNHALTED_BUS\0"
+    "CPU_CLK_UNHALTED_NO_OTHER\0"
+    "CPU_CLK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_CACHE_LD_MODIFIED\0"
+    "L1D_CACHE_LD_EXCLUSIVE\0"
+    "L1D_CACHE_LD_SHARED\0"
+    "L1D_CACHE_LD_INVALID\0"
+    "L1D_CACHE_LD_MESI\0"
+    "L1D_CACHE_ST_MODIFIED\0"
+    "L1D_CACHE_ST_EXCLUSIVE\0"
+    "L1D_CACHE_ST_SHARED\0"
+    "L1D_CACHE_ST_INVALID\0"
+    "L1D_CACHE_ST_MESI\0"
+    "L1D_CACHE_LOCK_MODIFIED\0"
+    "L1D_CACHE_LOCK_EXCLUSIVE\0"
+    "L1D_CACHE_LOCK_SHARED\0"
+    "L1D_CACHE_LOCK_INVALID\0"
+    "L1D_CACHE_LOCK_MESI\0"
+    "L1D_CACHE_LOCK_DURATION\0"
+    "L1D_ALL_REF\0"
+    "L1D_CACHE_REF\0"
+    "L1D_REPL\0"
+    "L1D_M_REPL\0"
+    "L1D_M_EVICT\0"
+    "L1D_PEND_MISS\0"
+    "L1D_SPLIT_LOADS\0"
+    "L1D_SPLIT_STORES\0"
+    "SSE_PRE_MISS_NTA\0"
+    "SSE_PRE_MISS_L1\0"
+    "SSE_PRE_MISS_L2\0"
+    "SSE_PRE_MISS_ALL_CACHES\0"
+    "LOAD_HIT_PRE\0"
+    "L1D_PREFETCH_REQUESTS\0"
+    "L1D_PREFETCH_DCU_MISSES\0"
+    "BUS_REQUEST_OUTSTANDING_ALL_CORES_THIS_A\0"
+    "BUS_REQUEST_OUTSTANDING_ALL_CORES_ALL_A\0"
+    "BUS_REQUEST_OUTSTANDING_THIS_CORE_THIS_A\0"
+    "BUS_REQUEST_OUTSTANDING_THIS_CORE_ALL_A\0"
+    "BUS_BNR_DRV_THIS_A\0"
+    "BUS_BNR_DRV_ALL_A\0"
+    "BUS_DRDY_CLOCKS_THIS_A\0"
+    "BUS_DRDY_CLOCKS_ALL_A\0"
+    "BUS_LOCK_CLOCKS_ALL_CORES_THIS_A\0"
+    "BUS_LOCK_CLOCKS_ALL_CORES_ALL_A\0"
+    "BUS_LOCK_CLOCKS_THIS_CORE_THIS_A\0"
+    "BUS_LOCK_CLOCKS_THIS_CORE_ALL_A\0"
+    "BUS_DATA_RCV_ALL_CORES\0"
+    "BUS_DATA_RCV_THIS_CORE\0"
+    "BUS_TRANS_BRD_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_BRD_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_BRD_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_BRD_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_RFO_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_RFO_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_RFO_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_RFO_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_WB_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_WB_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_WB_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_WB_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_IFETCH_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_IFETCH_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_IFETCH_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_IFETCH_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_INVAL_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_INVAL_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_INVAL_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_INVAL_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_PWR_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_PWR_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_PWR_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_PWR_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_P_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_P_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_P_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_P_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_IO_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_IO_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_IO_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_IO_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_DEF_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_DEF_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_DEF_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_DEF_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_BURST_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_BURST_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_BURST_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_BURST_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_MEM_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_MEM_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_MEM_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_MEM_THIS_CORE_ALL_A\0"
+    "BUS_TRANS_ANY_ALL_CORES_THIS_A\0"
+    "BUS_TRANS_ANY_ALL_CORES_ALL_A\0"
+    "BUS_TRANS_ANY_THIS_CORE_THIS_A\0"
+    "BUS_TRANS_ANY_THIS_CORE_ALL_A\0"
+    "EXT_SNOOP_ALL_CORES_CLEAN\0"
+    "EXT_SNOOP_ALL_CORES_HIT\0"
+    "EXT_SNOOP_ALL_CORES_HITM\0"
+    "EXT_SNOOP_THIS_CORE_CLEAN\0"
+    "EXT_SNOOP_THIS_CORE_HIT\0"
+    "EXT_SNOOP_THIS_CORE_HITM\0"
+    "CMP_SNOOP_ALL_CORES_CMP2I\0"
+    "CMP_SNOOP_ALL_CORES_CMP2S\0"
+    "CMP_SNOOP_THIS_CORE_CMP2I\0"
+    "CMP_SNOOP_THIS_CORE_CMP2S\0"
+    "BUS_HIT_DRV_THIS_AGENT\0"
+    "BUS_HIT_DRV_ALL_AGENTS\0"
+    "BUS_HITM_DRV_THIS_AGENT\0"
+    "BUS_HITM_DRV_ALL_AGENTS\0"
+    "BUSQ_EMPTY_ALL_CORES\0"
+    "BUSQ_EMPTY_THIS_CORE\0"
+    "BUS_SNOOP_STALLED_ALL_CORES_THIS_AGENT\0"
+    "BUS_SNOOP_STALLED_ALL_CORES_ALL_AGENTS\0"
+    "BUS_SNOOP_STALLED_THIS_CORE_THIS_AGENT\0"
+    "BUS_SNOOP_STALLED_THIS_CORE_ALL_AGENTS\0"
+    "BUS_IO_WAIT_ALL_CORES\0"
+    "BUS_IO_WAIT_THIS_CORE\0"
+    "L1I_READS\0"
+    "L1I_MISSES\0"
+    "ITLB_SMALL_MISS\0"
+    "ITLB_LARGE_MISS\0"
+    "ITLB_FLUSH\0"
+    "ITLB_MISSES\0"
+    "INST_QUEUE_FULL\0"
+    "CYCLES_L1I_MEM_STALLED\0"
+    "ILD_STALL\0"
+    "BR_INST_EXEC\0"
+    "BR_MISSP_EXEC\0"
+    "BR_BAC_MISSP_EXEC\0"
+    "BR_CND_EXEC\0"
+    "BR_CND_MISSP_EXEC\0"
+    "BR_IND_EXEC\0"
+    "BR_IND_MISSP_EXEC\0"
+    "BR_RET_EXEC\0"
+    "BR_RET_BAC_MISSP_EXEC\0"
+    "BR_CALL_EXEC\0"
+    "BR_CALL_MISSP_EXEC\0"
+    "BR_IND_CALL_EXEC\0"
+    "BR_TKN_BUBBLE_1\0"
+    "BR_TKN_BUBBLE_2\0"
+    "RS_UOPS_DISPATCHED_ALL\0"
+    "RS_UOPS_DISPATCHED_PORT0\0"
+    "RS_UOPS_DISPATCHED_PORT1\0"
+    "RS_UOPS_DISPATCHED_PORT2\0"
+    "RS_UOPS_DISPATCHED_PORT3\0"
+    "RS_UOPS_DISPATCHED_PORT4\0"
+    "RS_UOPS_DISPATCHED_PORT5\0"
+    "RS_UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "RS_UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "MACRO_INSTS_DECODED\0"
+    "MACRO_INSTS_CISC_DECODED\0"
+    "ESP_SYNCH\0"
+    "ESP_ADDITIONS\0"
+    "SIMD_UOPS_EXEC\0"
+    "SIMD_SAT_UOPS_EXEC\0"
+    "SIMD_UOP_TYPE_EXEC_MUL\0"
+    "SIMD_UOP_TYPE_EXEC_SHIFT\0"
+    "SIMD_UOP_TYPE_EXEC_PACK\0"
+    "SIMD_UOP_TYPE_EXEC_UNPACK\0"
+    "SIMD_UOP_TYPE_EXEC_LOGICAL\0"
+    "SIMD_UOP_TYPE_EXEC_ARITHMETIC\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_LOADS\0"
+    "INST_RETIRED_STORES\0"
+    "INST_RETIRED_OTHER\0"
+    "X87_OPS_RETIRED_FXCH\0"
+    "X87_OPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_LD_IND_BR\0"
+    "UOPS_RETIRED_STD_STA\0"
+    "UOPS_RETIRED_MACRO_FUSION\0"
+    "UOPS_RETIRED_FUSED\0"
+    "UOPS_RETIRED_NON_FUSED\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_STALL_COUNT\0"
+    "MACHINE_NUKES_SMC\0"
+    "MACHINE_NUKES_MEM_ORDER\0"
+    "BR_INST_RETIRED_ANY\0"
+    "BR_INST_RETIRED_PRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_PRED_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED_TAKEN\0"
+    "BR_INST_RETIRED_TAKEN\0"
+    "BR_INST_RETIRED_MISPRED\0"
+    "CYCLES_INT_MASKED\0"
+    "CYCLES_INT_PENDING_MASKED\0"
+    "SIMD_INST_RETIRED_PACKED_SINGLE\0"
+    "SIMD_INST_RETIRED_SCALAR_SINGLE\0"
+    "SIMD_INST_RETIRED_PACKED_DOUBLE\0"
+    "SIMD_INST_RETIRED_SCALAR_DOUBLE\0"
+    "SIMD_INST_RETIRED_VECTOR\0"
+    "SIMD_INST_RETIRED_ANY\0"
+    "HW_INT_RCV\0"
+    "ITLB_MISS_RETIRED\0"
+    "SIMD_COMP_INST_RETIRED_PACKED_SINGLE\0"
+    "SIMD_COMP_INST_RETIRED_SCALAR_SINGLE\0"
+    "SIMD_COMP_INST_RETIRED_PACKED_DOUBLE\0"
+    "SIMD_COMP_INST_RETIRED_SCALAR_DOUBLE\0"
+    "MEM_LOAD_RETIRED_L1D_MISS\0"
+    "MEM_LOAD_RETIRED_L1D_LINE_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L2_LINE_MISS\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "FP_MMX_TRANS_TO_MMX\0"
+    "FP_MMX_TRANS_TO_FP\0"
+    "SIMD_ASSIST\0"
+    "SIMD_INSTR_RETIRED\0"
+    "SIMD_SAT_INSTR_RETIRED\0"
+    "RAT_STALLS_ROB_READ_PORT\0"
+    "RAT_STALLS_PARTIAL_CYCLES\0"
+    "RAT_STALLS_FLAGS\0"
+    "RAT_STALLS_FPSW\0"
+    "RAT_STALLS_ANY\0"
+    "SEG_RENAME_STALLS_ES\0"
+    "SEG_RENAME_STALLS_DS\0"
+    "SEG_RENAME_STALLS_FS\0"
+    "SEG_RENAME_STALLS_GS\0"
+    "SEG_RENAME_STALLS_ANY\0"
+    "SEG_REG_RENAMES_STALLS_ES\0"
+    "SEG_REG_RENAMES_STALLS_DS\0"
+    "SEG_REG_RENAMES_STALLS_FS\0"
+    "SEG_REG_RENAMES_STALLS_GS\0"
+    "SEG_REG_RENAMES_STALLS_ANY\0"
+    "RESOURCE_STALLS_ROB_FULL\0"
+    "RESOURCE_STALLS_RS_FULL\0"
+    "RESOURCE_STALLS_LD_ST\0"
+    "RESOURCE_STALLS_FPCW\0"
+    "RESOURCE_STALLS_BR_MISS_CLEAR\0"
+    "RESOURCE_STALLS_ANY\0"
+    "BR_INST_DECODED\0"
+    "BOGUS_BR\0"
+    "BACLEARS\0"
+    "PREF_RQSTS_UP\0"
+    "PREF_RQSTS_DN\0";
+
+static const PerfmonEventOption core2_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x9}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+};
+
+static const PerfmonEventEntry core2_arch_event_entries[NUM_ARCH_EVENTS_CORE2] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 73, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79, 94, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {98, 94, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {113, 94, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 94, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {162, 94, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {177, 94, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 94, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {211, 94, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {229, 94, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {246, 94, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {264, 94, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {276, 94, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {287, 94, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {298, 94, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {313, 94, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {329, 94, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {349, 94, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {372, 94, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {392, 94, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {420, 94, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {450, 94, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {466, 94, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {483, 499, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {504, 514, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {519, 514, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {523, 514, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {527, 499, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {543, 499, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {559, 514, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {577, 514, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {597, 514, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {617, 94, 0, 0, 0x21,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {634, 94, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {651, 94, 0, 0, 0x22,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {674, 94, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {697, 94, 0, 0, 0x23,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {723, 94, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {749, 94, 0, 0, 0x24,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {775, 94, 0, 0, 0x24,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {801, 94, 0, 0, 0x24,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {837, 94, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {873, 94, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {907, 94, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {941, 94, 0, 0, 0x25,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {965, 94, 0, 0, 0x25,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {989, 94, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1016, 94, 0, 0, 0x26,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {1043, 94, 0, 0, 0x26,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {1080, 94, 0, 0, 0x26,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1117, 94, 0, 0, 0x26,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1152, 94, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1187, 94, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1216, 94, 0, 0, 0x27,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {1245, 94, 0, 0, 0x27,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 94, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1323, 94, 0, 0, 0x27,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1360, 94, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1397, 94, 0, 0, 0x28,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {1426, 94, 0, 0, 0x28,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {1456, 94, 0, 0, 0x28,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {1483, 94, 0, 0, 0x28,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {1511, 94, 0, 0, 0x28,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {1536, 94, 0, 0, 0x28,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1565, 94, 0, 0, 0x28,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1595, 94, 0, 0, 0x28,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1622, 94, 0, 0, 0x28,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1650, 94, 0, 0, 0x28,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1675, 94, 0, 0, 0x29,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1704, 94, 0, 0, 0x29,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {1734, 94, 0, 0, 0x29,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {1761, 94, 0, 0, 0x29,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {1789, 94, 0, 0, 0x29,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1814, 94, 0, 0, 0x29,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {1843, 94, 0, 0, 0x29,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {1873, 94, 0, 0, 0x29,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {1900, 94, 0, 0, 0x29,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {1928, 94, 0, 0, 0x29,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {1953, 94, 0, 0, 0x29,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {1992, 94, 0, 0, 0x29,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {2032, 94, 0, 0, 0x29,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {2069, 94, 0, 0, 0x29,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {2107, 94, 0, 0, 0x29,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {2142, 94, 0, 0, 0x29,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2181, 94, 0, 0, 0x29,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {2221, 94, 0, 0, 0x29,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {2258, 94, 0, 0, 0x29,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {2296, 94, 0, 0, 0x29,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {2331, 94, 0, 0, 0x29,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {2368, 94, 0, 0, 0x29,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {2406, 94, 0, 0, 0x29,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {2441, 94, 0, 0, 0x29,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {2477, 94, 0, 0, 0x29,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {2510, 94, 0, 0, 0x29,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2547, 94, 0, 0, 0x29,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {2585, 94, 0, 0, 0x29,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {2620, 94, 0, 0, 0x29,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2656, 94, 0, 0, 0x29,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2689, 94, 0, 0, 0x2A,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {2714, 94, 0, 0, 0x2A,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {2740, 94, 0, 0, 0x2A,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {2763, 94, 0, 0, 0x2A,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {2787, 94, 0, 0, 0x2A,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {2808, 94, 0, 0, 0x2A,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2833, 94, 0, 0, 0x2A,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {2859, 94, 0, 0, 0x2A,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {2882, 94, 0, 0, 0x2A,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2906, 94, 0, 0, 0x2A,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2927, 94, 0, 0, 0x2B,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {2954, 94, 0, 0, 0x2B,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {2982, 94, 0, 0, 0x2B,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {3007, 94, 0, 0, 0x2B,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {3033, 94, 0, 0, 0x2B,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {3056, 94, 0, 0, 0x2B,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {3083, 94, 0, 0, 0x2B,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {3111, 94, 0, 0, 0x2B,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3136, 94, 0, 0, 0x2B,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3162, 94, 0, 0, 0x2B,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {3185, 94, 0, 0, 0x2E,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {3217, 94, 0, 0, 0x2E,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {3250, 94, 0, 0, 0x2E,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {3280, 94, 0, 0, 0x2E,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {3311, 94, 0, 0, 0x2E,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {3339, 94, 0, 0, 0x2E,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {3371, 94, 0, 0, 0x2E,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {3404, 94, 0, 0, 0x2E,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {3434, 94, 0, 0, 0x2E,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {3465, 94, 0, 0, 0x2E,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3493, 94, 0, 0, 0x2E,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {3535, 94, 0, 0, 0x2E,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {3578, 94, 0, 0, 0x2E,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {3618, 94, 0, 0, 0x2E,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {3659, 94, 0, 0, 0x2E,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {3697, 94, 0, 0, 0x2E,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {3739, 94, 0, 0, 0x2E,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {3782, 94, 0, 0, 0x2E,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {3822, 94, 0, 0, 0x2E,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {3863, 94, 0, 0, 0x2E,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {3901, 94, 0, 0, 0x2E,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {3941, 94, 0, 0, 0x2E,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {3982, 94, 0, 0, 0x2E,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {4020, 94, 0, 0, 0x2E,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {4059, 94, 0, 0, 0x2E,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {4095, 94, 0, 0, 0x2E,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4135, 94, 0, 0, 0x2E,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4176, 94, 0, 0, 0x2E,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4214, 94, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4236, 94, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {4255, 94, 0, 0, 0x30,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {4293, 94, 0, 0, 0x30,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {4332, 94, 0, 0, 0x30,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {4368, 94, 0, 0, 0x30,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {4405, 94, 0, 0, 0x30,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4439, 94, 0, 0, 0x30,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {4477, 94, 0, 0, 0x30,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {4516, 94, 0, 0, 0x30,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {4552, 94, 0, 0, 0x30,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {4589, 94, 0, 0, 0x30,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {4623, 94, 0, 0, 0x30,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {4671, 94, 0, 0, 0x30,0xD4,0,0,EVENT_OPTION_NONE_MASK}
+, {4720, 94, 0, 0, 0x30,0xD2,0,0,EVENT_OPTION_NONE_MASK}
+, {4766, 94, 0, 0, 0x30,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {4813, 94, 0, 0, 0x30,0xDF,0,0,EVENT_OPTION_NONE_MASK}
+, {4857, 94, 0, 0, 0x30,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {4905, 94, 0, 0, 0x30,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {4954, 94, 0, 0, 0x30,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {5000, 94, 0, 0, 0x30,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {5047, 94, 0, 0, 0x30,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {5091, 94, 0, 0, 0x30,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5137, 94, 0, 0, 0x30,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {5184, 94, 0, 0, 0x30,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {5228, 94, 0, 0, 0x30,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {5273, 94, 0, 0, 0x30,0xCF,0,0,EVENT_OPTION_NONE_MASK}
+, {5315, 94, 0, 0, 0x30,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {5361, 94, 0, 0, 0x30,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5408, 94, 0, 0, 0x30,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {5452, 94, 0, 0, 0x30,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5497, 94, 0, 0, 0x30,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {5539, 94, 0, 0, 0x32,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5559, 94, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5579, 94, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5594, 94, 0, 0, 0x3A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5610, 94, 0, 0, 0x3B,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5623, 94, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5647, 94, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5668, 94, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5694, 94, 0, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5724, 94, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5746, 94, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5769, 94, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5789, 94, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5810, 94, 0, 0, 0x40,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {5828, 94, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5850, 94, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5873, 94, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5893, 94, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5914, 94, 0, 0, 0x41,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {5932, 94, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5956, 94, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5981, 94, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6003, 94, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6026, 94, 0, 0, 0x42,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6046, 94, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6070, 94, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6082, 94, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6096, 94, 0, 0, 0x45,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6105, 94, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6116, 94, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6128, 94, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6142, 94, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6158, 94, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6175, 94, 0, 0, 0x4B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6192, 94, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6208, 94, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6224, 94, 0, 0, 0x4B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {6248, 94, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6261, 94, 0, 0, 0x4E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6283, 94, 0, 0, 0x4F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6307, 94, 0, 0, 0x60,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6348, 94, 0, 0, 0x60,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {6388, 94, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6429, 94, 0, 0, 0x60,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {6469, 94, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6488, 94, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6506, 94, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6529, 94, 0, 0, 0x62,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6551, 94, 0, 0, 0x63,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6584, 94, 0, 0, 0x63,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {6616, 94, 0, 0, 0x63,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6649, 94, 0, 0, 0x63,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {6681, 94, 0, 0, 0x64,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6704, 94, 0, 0, 0x64,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6727, 94, 0, 0, 0x65,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6758, 94, 0, 0, 0x65,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {6788, 94, 0, 0, 0x65,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6819, 94, 0, 0, 0x65,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {6849, 94, 0, 0, 0x66,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6880, 94, 0, 0, 0x66,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {6910, 94, 0, 0, 0x66,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6941, 94, 0, 0, 0x66,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {6971, 94, 0, 0, 0x67,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7001, 94, 0, 0, 0x67,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7030, 94, 0, 0, 0x67,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7060, 94, 0, 0, 0x67,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7089, 94, 0, 0, 0x68,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7123, 94, 0, 0, 0x68,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7156, 94, 0, 0, 0x68,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7190, 94, 0, 0, 0x68,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7223, 94, 0, 0, 0x69,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7256, 94, 0, 0, 0x69,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7288, 94, 0, 0, 0x69,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7321, 94, 0, 0, 0x69,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7353, 94, 0, 0, 0x6A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7384, 94, 0, 0, 0x6A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7414, 94, 0, 0, 0x6A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7445, 94, 0, 0, 0x6A,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7475, 94, 0, 0, 0x6B,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7504, 94, 0, 0, 0x6B,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7532, 94, 0, 0, 0x6B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7561, 94, 0, 0, 0x6B,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7589, 94, 0, 0, 0x6C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7619, 94, 0, 0, 0x6C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7648, 94, 0, 0, 0x6C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7678, 94, 0, 0, 0x6C,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7707, 94, 0, 0, 0x6D,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7738, 94, 0, 0, 0x6D,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7768, 94, 0, 0, 0x6D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7799, 94, 0, 0, 0x6D,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7829, 94, 0, 0, 0x6E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7862, 94, 0, 0, 0x6E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7894, 94, 0, 0, 0x6E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7927, 94, 0, 0, 0x6E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7959, 94, 0, 0, 0x6F,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7990, 94, 0, 0, 0x6F,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8020, 94, 0, 0, 0x6F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8051, 94, 0, 0, 0x6F,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {8081, 94, 0, 0, 0x70,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8112, 94, 0, 0, 0x70,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8142, 94, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8173, 94, 0, 0, 0x70,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {8203, 94, 0, 0, 0x77,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {8229, 94, 0, 0, 0x77,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {8253, 94, 0, 0, 0x77,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {8278, 94, 0, 0, 0x77,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8304, 94, 0, 0, 0x77,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8328, 94, 0, 0, 0x77,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {8353, 94, 0, 0, 0x78,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {8379, 94, 0, 0, 0x78,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {8405, 94, 0, 0, 0x78,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8431, 94, 0, 0, 0x78,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8457, 94, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8480, 94, 0, 0, 0x7A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8503, 94, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8527, 94, 0, 0, 0x7B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8551, 94, 0, 0, 0x7D,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8572, 94, 0, 0, 0x7D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8593, 94, 0, 0, 0x7E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8632, 94, 0, 0, 0x7E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8671, 94, 0, 0, 0x7E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8710, 94, 0, 0, 0x7E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {8749, 94, 0, 0, 0x7F,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8771, 94, 0, 0, 0x7F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8793, 94, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8803, 94, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8814, 94, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8830, 94, 0, 0, 0x82,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8846, 94, 0, 0, 0x82,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8857, 94, 0, 0, 0x82,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8869, 94, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8885, 94, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8908, 94, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8918, 94, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8931, 94, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8945, 94, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8963, 94, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8975, 94, 0, 0, 0x8C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8993, 94, 0, 0, 0x8D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9005, 94, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9023, 94, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9035, 94, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9057, 94, 0, 0, 0x92,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9070, 94, 0, 0, 0x93,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9089, 94, 0, 0, 0x94,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9106, 94, 0, 0, 0x97,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9122, 94, 0, 0, 0x98,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9138, 94, 0, 0, 0xA0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9161, 499, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9186, 499, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9211, 499, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9236, 499, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9261, 499, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9286, 499, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9311, 499, 2, 1, 0xA1,0x23,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {9352, 499, 0, 0, 0xA1,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {9387, 94, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9407, 94, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9432, 94, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9442, 94, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9456, 94, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9471, 94, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9490, 94, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9513, 94, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9538, 94, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9562, 94, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9588, 94, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9615, 94, 0, 0, 0xB3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9645, 94, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9664, 94, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9683, 94, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9703, 94, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9722, 94, 0, 0, 0xC1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9743, 94, 0, 0, 0xC1,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {9763, 94, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9786, 94, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9807, 94, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9833, 94, 0, 0, 0xC2,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9852, 94, 0, 0, 0xC2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9875, 94, 0, 0, 0xC2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {9892, 94, 3, 1, 0xC2,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9917, 94, 4, 2, 0xC2,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9943, 94, 6, 2, 0xC2,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9969, 94, 8, 3, 0xC2,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {9994, 94, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10012, 94, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10036, 94, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10056, 94, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10087, 94, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10121, 94, 0, 0, 0xC4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10148, 94, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10178, 94, 0, 0, 0xC4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {10200, 94, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10224, 94, 0, 0, 0xC6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10242, 94, 0, 0, 0xC6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10268, 94, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10300, 94, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10332, 94, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10364, 94, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10396, 94, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10421, 94, 0, 0, 0xC7,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10443, 94, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10454, 94, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10472, 94, 0, 0, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10509, 94, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10546, 94, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10583, 94, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10620, 499, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10646, 499, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10677, 499, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10702, 499, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10732, 499, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10759, 94, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10779, 94, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10798, 94, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10810, 94, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10829, 94, 0, 0, 0xCF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10852, 94, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10877, 94, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10903, 94, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10920, 94, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10936, 94, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {10951, 94, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10972, 94, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10993, 94, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11014, 94, 0, 0, 0xD4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11035, 94, 0, 0, 0xD4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11057, 94, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11083, 94, 0, 0, 0xD5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11109, 94, 0, 0, 0xD5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11135, 94, 0, 0, 0xD5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11161, 94, 0, 0, 0xD5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11188, 94, 0, 0, 0xDC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11213, 94, 0, 0, 0xDC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11237, 94, 0, 0, 0xDC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11259, 94, 0, 0, 0xDC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11280, 94, 0, 0, 0xDC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11310, 94, 0, 0, 0xDC,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11330, 94, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11346, 94, 0, 0, 0xE4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11355, 94, 0, 0, 0xE6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11364, 94, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11378, 94, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable core2_arch_events = {
+    NUM_ARCH_EVENTS_CORE2,
+    core2_arch_event_strings,
+    core2_arch_event_options,
+    core2_arch_event_entries
+};
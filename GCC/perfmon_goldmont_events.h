@@ -0,0 +1,233 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_GOLDMONT 98
+
+static const char goldmont_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_DATA_UNKNOWN\0"
+    "PMC\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "LD_BLOCKS_4K_ALIAS\0"
+    "LD_BLOCKS_UTLB_MISS\0"
+    "LD_BLOCKS_ALL_BLOCK\0"
+    "PAGE_WALKS_D_SIDE_CYCLES\0"
+    "PAGE_WALKS_D_SIDE_COUNT\0"
+    "PAGE_WALKS_I_SIDE_CYCLES\0"
+    "PAGE_WALKS_I_SIDE_COUNT\0"
+    "PAGE_WALKS_CYCLES\0"
+    "PAGE_WALKS_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "MISALIGN_MEM_REF_LOAD_PAGE_SPLIT\0"
+    "MISALIGN_MEM_REF_STORE_PAGE_SPLIT\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_REJECT_XQ_ALL\0"
+    "CORE_REJECT_L2Q_ALL\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "DL1_DIRTY_EVICTION\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ITLB_MISS\0"
+    "FETCH_STALL_ICACHE_FILL_PENDING_CYCLES\0"
+    "FETCH_STALL_ICACHE_FILL_PENDING_COUNT\0"
+    "UOPS_NOT_DELIVERED_ANY\0"
+    "INST_RETIRED_ANY\0"
+    "INST_RETIRED_MS\0"
+    "MACHINE_CLEARS_ALL\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_FP_ASSIST\0"
+    "MACHINE_CLEARS_DISAMBIGUATION\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_JCC\0"
+    "BR_INST_RETIRED_TAKEN_JCC\0"
+    "BR_INST_RETIRED_CALL\0"
+    "BR_INST_RETIRED_REL_CALL\0"
+    "BR_INST_RETIRED_IND_CALL\0"
+    "BR_INST_RETIRED_RETURN\0"
+    "BR_INST_RETIRED_NON_RETURN_IND\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_JCC\0"
+    "BR_MISP_RETIRED_TAKEN_JCC\0"
+    "BR_MISP_RETIRED_IND_CALL\0"
+    "BR_MISP_RETIRED_RETURN\0"
+    "BR_MISP_RETIRED_NON_RETURN_IND\0"
+    "ISSUE_SLOTS_NOT_CONSUMED_ANY\0"
+    "ISSUE_SLOTS_NOT_CONSUMED_RESOURCE_FULL\0"
+    "ISSUE_SLOTS_NOT_CONSUMED_RECOVERY\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "HW_INTERRUPTS_PENDING_AND_MASKED\0"
+    "HW_INTERRUPTS_PENDING_AND_MASKED_COUNT\0"
+    "CYCLES_DIV_BUSY_ALL\0"
+    "CYCLES_DIV_BUSY_IDIV\0"
+    "CYCLES_DIV_BUSY_FPDIV\0"
+    "CYCLES_DIV_BUSY_ALL_COUNT\0"
+    "CYCLES_DIV_BUSY_IDIV_COUNT\0"
+    "CYCLES_DIV_BUSY_FPDIV_COUNT\0"
+    "MEM_UOPS_RETIRED_ALL_LOADS\0"
+    "MEM_UOPS_RETIRED_ALL_STORES\0"
+    "MEM_UOPS_RETIRED_ALL\0"
+    "MEM_UOPS_RETIRED_DTLB_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_DTLB_MISS_STORES\0"
+    "MEM_UOPS_RETIRED_DTLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOCK_LOADS\0"
+    "MEM_UOPS_RETIRED_SPLIT_LOADS\0"
+    "MEM_UOPS_RETIRED_SPLIT_STORES\0"
+    "MEM_UOPS_RETIRED_SPLIT_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_HITM\0"
+    "MEM_LOAD_UOPS_RETIRED_WCB_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_DRAM_HIT\0"
+    "BACLEARS_ALL\0"
+    "BACLEARS_RETURN\0"
+    "BACLEARS_COND\0"
+    "MS_DECODED_MS_ENTRY\0"
+    "DECODE_RESTRICTION_PREDECODE_WRONG\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0";
+
+static const PerfmonEventOption goldmont_arch_event_options[] = {
+ {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+};
+
+static const PerfmonEventEntry goldmont_arch_event_entries[NUM_ARCH_EVENTS_GOLDMONT] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 114, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 142, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 169, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {175, 198, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {202, 198, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {226, 198, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {245, 198, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {265, 198, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {285, 198, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 198, 0, 1, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {334, 198, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {359, 198, 0, 1, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {383, 198, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {401, 198, 0, 1, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {418, 198, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {434, 198, 1, 1, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {458, 198, 2, 2, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {483, 198, 4, 2, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {508, 198, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {541, 198, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {575, 198, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {598, 198, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {626, 198, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {643, 198, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {663, 198, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {691, 198, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {714, 198, 6, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {746, 198, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {765, 198, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {776, 198, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {790, 198, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {806, 198, 0, 0, 0x81,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {816, 198, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {855, 198, 0, 1, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {893, 198, 0, 0, 0x9C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {916, 198, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {933, 198, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {949, 198, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {968, 198, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {987, 198, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1018, 198, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1043, 198, 0, 0, 0xC3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1073, 198, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1102, 198, 0, 0, 0xC4,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1122, 198, 0, 0, 0xC4,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1148, 198, 0, 0, 0xC4,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {1169, 198, 0, 0, 0xC4,0xFD,0,0,EVENT_OPTION_NONE_MASK}
+, {1194, 198, 0, 0, 0xC4,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1219, 198, 0, 0, 0xC4,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1242, 198, 0, 0, 0xC4,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1273, 198, 0, 0, 0xC4,0xBF,0,0,EVENT_OPTION_NONE_MASK}
+, {1300, 198, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1329, 198, 0, 0, 0xC5,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1349, 198, 0, 0, 0xC5,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1375, 198, 0, 0, 0xC5,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1400, 198, 0, 0, 0xC5,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1423, 198, 0, 0, 0xC5,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1454, 198, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1483, 198, 0, 0, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1522, 198, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1556, 198, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1579, 198, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1612, 198, 0, 1, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1651, 198, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1671, 198, 0, 0, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1692, 198, 0, 0, 0xCD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1714, 198, 8, 2, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1740, 198, 8, 2, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1767, 198, 8, 2, 0xCD,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1795, 198, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {1822, 198, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {1850, 198, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {1871, 198, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {1904, 198, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {1938, 198, 0, 0, 0xD0,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {1965, 198, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1993, 198, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2022, 198, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {2052, 198, 0, 0, 0xD0,0x43,0,0,EVENT_OPTION_NONE_MASK}
+, {2079, 198, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2108, 198, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2138, 198, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2167, 198, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2197, 198, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2224, 198, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2254, 198, 0, 0, 0xD1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2285, 198, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2298, 198, 0, 0, 0xE6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2314, 198, 0, 0, 0xE6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2328, 198, 0, 0, 0xE7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2348, 198, 0, 0, 0xE9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2383, 198, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {2410, 198, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+};
+
+static const PerfmonEventTable goldmont_arch_events = {
+    NUM_ARCH_EVENTS_GOLDMONT,
+    goldmont_arch_event_strings,
+    goldmont_arch_event_options,
+    goldmont_arch_event_entries
+};
@@ -0,0 +1,3484 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_HASWELLEP 1713
+
+static const char haswellEP_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_ANY\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_LARGE\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_4K\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_2M\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_CACHE_MISS\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_6_UOPS_EXEC\0"
+    "ARITH_DIVIDER_CYCLES\0"
+    "ARITH_DIVIDER_UOPS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_L2_PF_HIT\0"
+    "L2_RQSTS_L2_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DEMAND_RQST_WB_HIT\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC2\0"
+    "L1D_PEND_MISS_PENDING_CYCLES_ANY\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_FB_FULL_REQUEST\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_LARGE\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT_4K\0"
+    "DTLB_STORE_MISSES_STLB_HIT_2M\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_PDE_CACHE_MISS\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "CPL_CYCLES_RING0_TRANS\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD_C6\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_COUNT\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_LARGE\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT_4K\0"
+    "ITLB_MISSES_STLB_HIT_2M\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_CONDITIONAL\0"
+    "BR_INST_EXEC_ALL_DIRECT_JMP\0"
+    "BR_INST_EXEC_ALL_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_INST_EXEC_ALL_INDIRECT_NEAR_RETURN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_CONDITIONAL\0"
+    "BR_MISP_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_EXECUTED_PORT_PORT_0\0"
+    "UOPS_EXECUTED_PORT_PORT_1\0"
+    "UOPS_EXECUTED_PORT_PORT_2\0"
+    "UOPS_EXECUTED_PORT_PORT_3\0"
+    "UOPS_EXECUTED_PORT_PORT_4\0"
+    "UOPS_EXECUTED_PORT_PORT_5\0"
+    "UOPS_EXECUTED_PORT_PORT_6\0"
+    "UOPS_EXECUTED_PORT_PORT_7\0"
+    "UOPS_EXECUTED_PORT_PORT_0_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_1_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_2_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_3_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_4_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_5_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_6_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_7_CORE\0"
+    "UOPS_EXECUTED_PORT_ARITH_PORTS\0"
+    "UOPS_EXECUTED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_EXECUTED_PORT_DATA_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "PAGE_WALKER_LOADS_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_DTLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_ITLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_MEMORY\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "PMC1\0"
+    "INST_RETIRED_ANY_P\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "OTHER_ASSISTS_ANY_WB_ASSIST\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "AVX_INSTS_LOADS\0"
+    "AVX_INSTS_STORES\0"
+    "AVX_INSTS_CALC\0"
+    "AVX_INSTS_ALL\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MISC1\0"
+    "HLE_RETIRED_ABORTED_MISC2\0"
+    "HLE_RETIRED_ABORTED_MISC3\0"
+    "HLE_RETIRED_ABORTED_MISC4\0"
+    "HLE_RETIRED_ABORTED_MISC5\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MISC1\0"
+    "RTM_RETIRED_ABORTED_MISC2\0"
+    "RTM_RETIRED_ABORTED_MISC3\0"
+    "RTM_RETIRED_ABORTED_MISC4\0"
+    "RTM_RETIRED_ABORTED_MISC5\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_ALL\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_ALL\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_REMOTE_FWD\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_0_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_1_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "TXR_INSERTS_AD_CACHE\0"
+    "TXR_INSERTS_AK_CACHE\0"
+    "TXR_INSERTS_BL_CACHE\0"
+    "TXR_INSERTS_IV_CACHE\0"
+    "TXR_INSERTS_AD_CORE\0"
+    "TXR_INSERTS_AK_CORE\0"
+    "TXR_INSERTS_BL_CORE\0"
+    "TXR_ADS_USED_AD\0"
+    "TXR_ADS_USED_AK\0"
+    "TXR_ADS_USED_BL\0"
+    "RING_BOUNCES_AD\0"
+    "RING_BOUNCES_AK\0"
+    "RING_BOUNCES_BL\0"
+    "RING_BOUNCES_IV\0"
+    "RING_SRC_THRTL\0"
+    "FAST_ASSERTED\0"
+    "CBOX0C0|CBOX0C1|CBOX1C0|CBOX1C1|CBOX2C0|CBOX2C1|CBOX3C0|CBOX3C1|CBOX4C0|CBOX4C1|CBOX5C0|CBOX5C1|CBOX6C0|CBOX6C1|CBOX7C0|CBOX7C1|CBOX8C0|CBOX8C1|CBOX9C0|CBOX9C1|CBOX10C0|CBOX10C1|CBOX11C0|CBOX11C1|CBOX12C0|CBOX12C1|CBOX13C0|CBOX13C1|CBOX14C0|CBOX14C1|CBOX15C0|CBOX15C1|CBOX16C0|CBOX16C1|CBOX17C0|CBOX17C1\0"
+    "BOUNCE_CONTROL\0"
+    "RXR_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0\0"
+    "RXR_OCCUPANCY_IRQ_REJ\0"
+    "RXR_OCCUPANCY_IPQ\0"
+    "RXR_OCCUPANCY_PRQ_REJ\0"
+    "RXR_OCCUPANCY_IRQ_IPQ\0"
+    "RXR_OCCUPANCY_IRQ_PRQ_REJ\0"
+    "RXR_OCCUPANCY_IPQ_PRQ_REJ\0"
+    "RXR_EXT_STARVED_IRQ\0"
+    "RXR_EXT_STARVED_IPQ\0"
+    "RXR_EXT_STARVED_PRQ\0"
+    "RXR_EXT_STARVED_ISMQ_BIDS\0"
+    "RXR_INSERTS_IRQ\0"
+    "RXR_INSERTS_IRQ_REJ\0"
+    "RXR_INSERTS_IPQ\0"
+    "RXR_INSERTS_PRQ\0"
+    "RXR_INSERTS_PRQ_REJ\0"
+    "RING_AD_USED_UP_EVEN\0"
+    "RING_AD_USED_UP_ODD\0"
+    "RING_AD_USED_UP\0"
+    "RING_AD_USED_DOWN_EVEN\0"
+    "RING_AD_USED_DOWN_ODD\0"
+    "RING_AD_USED_DOWN\0"
+    "RING_AD_USED_ANY\0"
+    "RING_AK_USED_UP_EVEN\0"
+    "RING_AK_USED_UP_ODD\0"
+    "RING_AK_USED_UP\0"
+    "RING_AK_USED_DOWN_EVEN\0"
+    "RING_AK_USED_DOWN_ODD\0"
+    "RING_AK_USED_DOWN\0"
+    "RING_AK_USED_ANY\0"
+    "RING_BL_USED_UP_EVEN\0"
+    "RING_BL_USED_UP_ODD\0"
+    "RING_BL_USED_UP\0"
+    "RING_BL_USED_DOWN_EVEN\0"
+    "RING_BL_USED_DOWN_ODD\0"
+    "RING_BL_USED_DOWN\0"
+    "RING_BL_USED_ANY\0"
+    "RING_IV_USED_UP\0"
+    "RING_IV_USED_DN\0"
+    "RING_IV_USED_ANY\0"
+    "COUNTER0_OCCUPANCY\0"
+    "RXR_IPQ_RETRY2_AD_SBO\0"
+    "RXR_IPQ_RETRY2_TARGET\0"
+    "RXR_IRQ_RETRY2_AD_SBO\0"
+    "RXR_IRQ_RETRY2_BL_SBO\0"
+    "RXR_IRQ_RETRY2_TARGET\0"
+    "RXR_ISMQ_RETRY2_AD_SBO\0"
+    "RXR_ISMQ_RETRY2_BL_SBO\0"
+    "RXR_ISMQ_RETRY2_TARGET\0"
+    "RXR_IPQ_RETRY_ANY\0"
+    "RXR_IPQ_RETRY_FULL\0"
+    "RXR_IPQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IPQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_ANY\0"
+    "RXR_IRQ_RETRY_FULL\0"
+    "RXR_IRQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IRQ_RETRY_RTID\0"
+    "RXR_IRQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_IIO_CREDITS\0"
+    "RXR_IRQ_RETRY_NID\0"
+    "RXR_ISMQ_RETRY_ANY\0"
+    "RXR_ISMQ_RETRY_FULL\0"
+    "RXR_ISMQ_RETRY_RTID\0"
+    "RXR_ISMQ_RETRY_QPI_CREDITS\0"
+    "RXR_ISMQ_RETRY_IIO_CREDITS\0"
+    "RXR_ISMQ_RETRY_NID\0"
+    "RXR_ISMQ_RETRY_WB_CREDITS\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_READ\0"
+    "LLC_LOOKUP_NID\0"
+    "TOR_INSERTS_ALL\0"
+    "TOR_INSERTS_WB\0"
+    "TOR_INSERTS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_MISS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_LOCAL\0"
+    "TOR_INSERTS_MISS_LOCAL\0"
+    "TOR_INSERTS_NID_OPCODE\0"
+    "TOR_INSERTS_NID_MISS_OPCODE\0"
+    "TOR_INSERTS_NID_EVICION\0"
+    "TOR_INSERTS_NID_ALL\0"
+    "TOR_INSERTS_NID_MISS_ALL\0"
+    "TOR_INSERTS_NID_WB\0"
+    "TOR_INSERTS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_MISS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_REMOTE\0"
+    "TOR_INSERTS_MISS_REMOTE\0"
+    "TOR_OCCUPANCY_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_EVICTION\0"
+    "TOR_OCCUPANCY_ALL\0"
+    "TOR_OCCUPANCY_MISS_ALL\0"
+    "TOR_OCCUPANCY_WB\0"
+    "TOR_OCCUPANCY_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_LOCAL\0"
+    "TOR_OCCUPANCY_MISS_LOCAL\0"
+    "TOR_OCCUPANCY_NID_OPCODE\0"
+    "TOR_OCCUPANCY_NID_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_NID_EVICTION\0"
+    "TOR_OCCUPANCY_NID_ALL\0"
+    "TOR_OCCUPANCY_NID_MISS_ALL\0"
+    "TOR_OCCUPANCY_NID_WB\0"
+    "TOR_OCCUPANCY_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_REMOTE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE\0"
+    "LLC_VICTIMS_M\0"
+    "LLC_VICTIMS_E\0"
+    "LLC_VICTIMS_I\0"
+    "LLC_VICTIMS_F\0"
+    "LLC_VICTIMS_MEIF\0"
+    "LLC_VICTIMS_MISS\0"
+    "LLC_VICTIMS_NID\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_STARTED\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CVZERO_PREFETCH_VICTIM\0"
+    "MISC_CVZERO_PREFETCH_MISS\0"
+    "SBO_CREDITS_ACQUIRED_AD\0"
+    "SBO_CREDITS_ACQUIRED_BL\0"
+    "SBO_CREDIT_OCCUPANCY_AD\0"
+    "SBO_CREDIT_OCCUPANCY_BL\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "UBOX\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_REQUESTS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "SBOX_CLOCKTICKS\0"
+    "SBOX\0"
+    "TXR_OCCUPANCY_AD_CRD\0"
+    "TXR_OCCUPANCY_AD_BNC\0"
+    "TXR_OCCUPANCY_BL_CRD\0"
+    "TXR_OCCUPANCY_BL_BNC\0"
+    "TXR_OCCUPANCY_AK\0"
+    "TXR_OCCUPANCY_IV\0"
+    "TXR_INSERTS_AD_CRD\0"
+    "TXR_INSERTS_AD_BNC\0"
+    "TXR_INSERTS_BL_CRD\0"
+    "TXR_INSERTS_BL_BNC\0"
+    "TXR_INSERTS_AK\0"
+    "TXR_INSERTS_IV\0"
+    "RING_BOUNCES_AD_CACHE\0"
+    "RING_BOUNCES_AK_CORE\0"
+    "RING_BOUNCES_BL_CORE\0"
+    "RING_BOUNCES_IV_CORE\0"
+    "RXR_OCCUPANCY_AD_CRD\0"
+    "RXR_OCCUPANCY_AD_BNC\0"
+    "RXR_OCCUPANCY_BL_CRD\0"
+    "RXR_OCCUPANCY_BL_BNC\0"
+    "RXR_OCCUPANCY_AK\0"
+    "RXR_OCCUPANCY_IV\0"
+    "RXR_BYPASS_AD_CRD\0"
+    "RXR_BYPASS_AD_BNC\0"
+    "RXR_BYPASS_BL_CRD\0"
+    "RXR_BYPASS_BL_BNC\0"
+    "RXR_BYPASS_AK\0"
+    "RXR_BYPASS_IV\0"
+    "RXR_INSERTS_AD_CRD\0"
+    "RXR_INSERTS_AD_BNC\0"
+    "RXR_INSERTS_BL_CRD\0"
+    "RXR_INSERTS_BL_BNC\0"
+    "RXR_INSERTS_AK\0"
+    "RXR_INSERTS_IV\0"
+    "RING_IV_USED_DOWN\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE0_TRANSITION_CYCLES\0"
+    "CORE1_TRANSITION_CYCLES\0"
+    "CORE2_TRANSITION_CYCLES\0"
+    "CORE3_TRANSITION_CYCLES\0"
+    "CORE4_TRANSITION_CYCLES\0"
+    "CORE5_TRANSITION_CYCLES\0"
+    "CORE6_TRANSITION_CYCLES\0"
+    "CORE7_TRANSITION_CYCLES\0"
+    "CORE8_TRANSITION_CYCLES\0"
+    "CORE9_TRANSITION_CYCLES\0"
+    "CORE10_TRANSITION_CYCLES\0"
+    "CORE11_TRANSITION_CYCLES\0"
+    "CORE12_TRANSITION_CYCLES\0"
+    "CORE13_TRANSITION_CYCLES\0"
+    "CORE14_TRANSITION_CYCLES\0"
+    "CORE15_TRANSITION_CYCLES\0"
+    "CORE16_TRANSITION_CYCLES\0"
+    "CORE17_TRANSITION_CYCLES\0"
+    "DEMOTIONS_CORE0\0"
+    "DEMOTIONS_CORE1\0"
+    "DEMOTIONS_CORE2\0"
+    "DEMOTIONS_CORE3\0"
+    "DEMOTIONS_CORE4\0"
+    "DEMOTIONS_CORE5\0"
+    "DEMOTIONS_CORE6\0"
+    "DEMOTIONS_CORE7\0"
+    "DEMOTIONS_CORE8\0"
+    "DEMOTIONS_CORE9\0"
+    "DEMOTIONS_CORE10\0"
+    "DEMOTIONS_CORE11\0"
+    "DEMOTIONS_CORE12\0"
+    "DEMOTIONS_CORE13\0"
+    "DEMOTIONS_CORE14\0"
+    "DEMOTIONS_CORE15\0"
+    "DEMOTIONS_CORE16\0"
+    "DEMOTIONS_CORE17\0"
+    "FREQ_BAND0_CYCLES\0"
+    "FREQ_BAND1_CYCLES\0"
+    "FREQ_BAND2_CYCLES\0"
+    "FREQ_BAND3_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_OS_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "PKG_RESIDENCY_C0_CYCLES\0"
+    "PKG_RESIDENCY_C1E_CYCLES\0"
+    "PKG_RESIDENCY_C2E_CYCLES\0"
+    "PKG_RESIDENCY_C3_CYCLES\0"
+    "PKG_RESIDENCY_C6_CYCLES\0"
+    "PKG_RESIDENCY_C7_CYCLES\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "UFS_TRANSITIONS_RING_GV\0"
+    "VR_HOT_CYCLES\0"
+    "CORE_CORE_C6_RESIDENCY\0"
+    "WBOX0FIX\0"
+    "CORE_CORE_C3_RESIDENCY\0"
+    "WBOX1FIX\0"
+    "CORE_PKG_C2_RESIDENCY\0"
+    "WBOX2FIX\0"
+    "CORE_PKG_C3_RESIDENCY\0"
+    "WBOX3FIX\0"
+    "BBOX_CLOCKTICKS\0"
+    "BBOX\0"
+    "ADDR_OPC_MATCH_ADDR\0"
+    "ADDR_OPC_MATCH_OPC\0"
+    "ADDR_OPC_MATCH_FILT\0"
+    "ADDR_OPC_MATCH_AD\0"
+    "ADDR_OPC_MATCH_BL\0"
+    "ADDR_OPC_MATCH_AK\0"
+    "BT_CYCLES_NE\0"
+    "BT_OCCUPANCY\0"
+    "BYPASS_IMC_TAKEN\0"
+    "BYPASS_IMC_NOT_TAKEN\0"
+    "CONFLICT_CYCLES\0"
+    "BBOX0C1|BBOX1C1\0"
+    "DIRECT2CORE_COUNT\0"
+    "DIRECT2CORE_CYCLES_DISABLED\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECTORY_LAT_OPT\0"
+    "DIRECTORY_LOOKUP_SNP\0"
+    "DIRECTORY_LOOKUP_NO_SNP\0"
+    "DIRECTORY_UPDATE_SET\0"
+    "DIRECTORY_UPDATE_CLEAR\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "HITME_LOOKUP_READ_OR_INVITOE\0"
+    "HITME_LOOKUP_WBMTOI\0"
+    "HITME_LOOKUP_ACKCNFLTWBI\0"
+    "HITME_LOOKUP_WBMTOE_OR_S\0"
+    "HITME_LOOKUP_HOM\0"
+    "HITME_LOOKUP_RSPFWDI_REMOTE\0"
+    "HITME_LOOKUP_RSPFWDI_LOCAL\0"
+    "HITME_LOOKUP_INVALS\0"
+    "HITME_LOOKUP_RSPFWDS\0"
+    "HITME_LOOKUP_EVICTS\0"
+    "HITME_LOOKUP_ALLOCS\0"
+    "HITME_LOOKUP_RSP\0"
+    "HITME_LOOKUP_ALL\0"
+    "HITME_HIT_READ_OR_INVITOE\0"
+    "HITME_HIT_WBMTOI\0"
+    "HITME_HIT_ACKCNFLTWBI\0"
+    "HITME_HIT_WBMTOE_OR_S\0"
+    "HITME_HIT_HOM\0"
+    "HITME_HIT_RSPFWDI_REMOTE\0"
+    "HITME_HIT_RSPFWDI_LOCAL\0"
+    "HITME_HIT_INVALS\0"
+    "HITME_HIT_RSPFWDS\0"
+    "HITME_HIT_EVICTS\0"
+    "HITME_HIT_ALLOCS\0"
+    "HITME_HIT_RSP\0"
+    "HITME_HIT_ALL\0"
+    "HITME_HIT_PV_BITS_SET_READ_OR_INVITOE\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOI\0"
+    "HITME_HIT_PV_BITS_SET_ACKCNFLTWBI\0"
+    "HITME_HIT_PV_BITS_SET_WBMTOE_OR_S\0"
+    "HITME_HIT_PV_BITS_SET_HOM\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_REMOTE\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDI_LOCAL\0"
+    "HITME_HIT_PV_BITS_SET_RSPFWDS\0"
+    "HITME_HIT_PV_BITS_SET_RSP\0"
+    "HITME_HIT_PV_BITS_SET_ALL\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI2\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI2\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_RETRY\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "OSB_READS_LOCAL\0"
+    "OSB_INVITOE_LOCAL\0"
+    "OSB_REMOTE\0"
+    "OSB_CANCELLED\0"
+    "OSB_READS_LOCAL_USEFUL\0"
+    "OSB_REMOTE_USEFUL\0"
+    "OSB_EDR_ALL\0"
+    "OSB_EDR_READS_LOCAL_I\0"
+    "OSB_EDR_READS_REMOTE_I\0"
+    "OSB_EDR_READS_LOCAL_S\0"
+    "OSB_EDR_READS_REMOTE_S\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "RING_AD_USED_CW_EVEN\0"
+    "RING_AD_USED_CW_ODD\0"
+    "RING_AD_USED_CW\0"
+    "RING_AD_USED_CCW_EVEN\0"
+    "RING_AD_USED_CCW_ODD\0"
+    "RING_AD_USED_CCW\0"
+    "RING_AK_USED_CW_EVEN\0"
+    "RING_AK_USED_CW_ODD\0"
+    "RING_AK_USED_CW\0"
+    "RING_AK_USED_CCW_EVEN\0"
+    "RING_AK_USED_CCW_ODD\0"
+    "RING_AK_USED_CCW\0"
+    "RING_BL_USED_CW_EVEN\0"
+    "RING_BL_USED_CW_ODD\0"
+    "RING_BL_USED_CW\0"
+    "RING_BL_USED_CCW_EVEN\0"
+    "RING_BL_USED_CCW_ODD\0"
+    "RING_BL_USED_CCW\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_SPEC_CREDITS_CHN3\0"
+    "SBO0_CREDITS_ACQUIRED_AD\0"
+    "SBO0_CREDITS_ACQUIRED_BL\0"
+    "SBO1_CREDITS_ACQUIRED_AD\0"
+    "SBO1_CREDITS_ACQUIRED_BL\0"
+    "SBO0_CREDITS_OCCUPANCY_AD\0"
+    "SBO0_CREDITS_OCCUPANCY_BL\0"
+    "SBO1_CREDITS_OCCUPANCY_AD\0"
+    "SBO1_CREDITS_OCCUPANCY_BL\0"
+    "SNOOPS_RSP_AFTER_DATA_LOCAL\0"
+    "SNOOPS_RSP_AFTER_DATA_REMOTE\0"
+    "SNOOP_CYCLES_NE_LOCAL\0"
+    "SNOOP_CYCLES_NE_REMOTE\0"
+    "SNOOP_CYCLES_NE_ALL\0"
+    "SNOOP_OCCUPANCY_LOCAL\0"
+    "SNOOP_OCCUPANCY_REMOTE\0"
+    "SNOOP_RESP_RSPI\0"
+    "SNOOP_RESP_RSPS\0"
+    "SNOOP_RESP_RSPIFWD\0"
+    "SNOOP_RESP_RSPSFWD\0"
+    "SNOOP_RESP_RSP_WB\0"
+    "SNOOP_RESP_RSP_FWD_WB\0"
+    "SNOOP_RESP_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_RSPI\0"
+    "SNP_RESP_RECV_LOCAL_RSPS\0"
+    "SNP_RESP_RECV_LOCAL_RSPIFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPSFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPXFWDXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_OTHER\0"
+    "STALL_NO_SBO_CREDIT_SBO0_AD\0"
+    "STALL_NO_SBO_CREDIT_SBO1_AD\0"
+    "STALL_NO_SBO_CREDIT_SBO0_BL\0"
+    "STALL_NO_SBO_CREDIT_SBO1_BL\0"
+    "TAD_REQUESTS_G0_REGION0\0"
+    "TAD_REQUESTS_G0_REGION1\0"
+    "TAD_REQUESTS_G0_REGION2\0"
+    "TAD_REQUESTS_G0_REGION3\0"
+    "TAD_REQUESTS_G0_REGION4\0"
+    "TAD_REQUESTS_G0_REGION5\0"
+    "TAD_REQUESTS_G0_REGION6\0"
+    "TAD_REQUESTS_G0_REGION7\0"
+    "TAD_REQUESTS_G1_REGION8\0"
+    "TAD_REQUESTS_G1_REGION9\0"
+    "TAD_REQUESTS_G1_REGION10\0"
+    "TAD_REQUESTS_G1_REGION11\0"
+    "TRACKER_CYCLES_FULL_GP\0"
+    "TRACKER_CYCLES_FULL_ALL\0"
+    "TRACKER_CYCLES_NE_LOCAL\0"
+    "TRACKER_CYCLES_NE_REMOTE\0"
+    "TRACKER_CYCLES_NE_ALL\0"
+    "TRACKER_OCCUPANCY_READS_LOCAL\0"
+    "TRACKER_OCCUPANCY_READS_REMOTE\0"
+    "TRACKER_OCCUPANCY_WRITES_LOCAL\0"
+    "TRACKER_OCCUPANCY_WRITES_REMOTE\0"
+    "TRACKER_OCCUPANCY_INVITOE_LOCAL\0"
+    "TRACKER_OCCUPANCY_INVITOE_REMOTE\0"
+    "TRACKER_PENDING_OCCUPANCY_LOCAL\0"
+    "TRACKER_PENDING_OCCUPANCY_REMOTE\0"
+    "TXR_AD_CYCLES_FULL_SCHED0\0"
+    "TXR_AD_CYCLES_FULL_SCHED1\0"
+    "TXR_AD_CYCLES_FULL_ALL\0"
+    "TXR_AK\0"
+    "TXR_AK_CYCLES_FULL_SCHED0\0"
+    "TXR_AK_CYCLES_FULL_SCHED1\0"
+    "TXR_AK_CYCLES_FULL_ALL\0"
+    "TXR_BL_DRS_CACHE\0"
+    "TXR_BL_DRS_CORE\0"
+    "TXR_BL_DRS_QPI\0"
+    "TXR_BL_CYCLES_FULL_SCHED0\0"
+    "TXR_BL_CYCLES_FULL_SCHED1\0"
+    "TXR_BL_CYCLES_FULL_ALL\0"
+    "TXR_BL_OCCUPANCY\0"
+    "TXR_STARVED_AK\0"
+    "TXR_STARVED_BL\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX\0"
+    "ACT_COUNT_RD\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "DRAM_PRE_ALL\0"
+    "DRAM_REFRESH_PANIC\0"
+    "DRAM_REFRESH_HIGH\0"
+    "ECC_CORRECTABLE_ERRORS\0"
+    "MAJOR_MODES_READ\0"
+    "MAJOR_MODES_WRITE\0"
+    "MAJOR_MODES_PARTIAL\0"
+    "MAJOR_MODES_ISOCH\0"
+    "POWER_CHANNEL_DLLOFF\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_CKE_CYCLES_RANK0\0"
+    "POWER_CKE_CYCLES_RANK1\0"
+    "POWER_CKE_CYCLES_RANK2\0"
+    "POWER_CKE_CYCLES_RANK3\0"
+    "POWER_CKE_CYCLES_RANK4\0"
+    "POWER_CKE_CYCLES_RANK5\0"
+    "POWER_CKE_CYCLES_RANK6\0"
+    "POWER_CKE_CYCLES_RANK7\0"
+    "POWER_CRITICAL_THROTTLE_CYCLES\0"
+    "POWER_PCU_THROTTLING\0"
+    "POWER_SELF_REFRESH\0"
+    "POWER_THROTTLE_CYCLES_RANK0\0"
+    "POWER_THROTTLE_CYCLES_RANK1\0"
+    "POWER_THROTTLE_CYCLES_RANK2\0"
+    "POWER_THROTTLE_CYCLES_RANK3\0"
+    "POWER_THROTTLE_CYCLES_RANK4\0"
+    "POWER_THROTTLE_CYCLES_RANK5\0"
+    "POWER_THROTTLE_CYCLES_RANK6\0"
+    "POWER_THROTTLE_CYCLES_RANK7\0"
+    "PREEMPTION_RD_PREEMPT_RD\0"
+    "PREEMPTION_RD_PREEMPT_WR\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_PAGE_CLOSE\0"
+    "PRE_COUNT_RD\0"
+    "PRE_COUNT_WR\0"
+    "PRE_COUNT_BYP\0"
+    "RD_CAS_PRIO_LOW\0"
+    "RD_CAS_PRIO_MED\0"
+    "RD_CAS_PRIO_HIGH\0"
+    "RD_CAS_PRIO_PANIC\0"
+    "RD_CAS_RANK0_BANK0\0"
+    "RD_CAS_RANK0_BANK1\0"
+    "RD_CAS_RANK0_BANK2\0"
+    "RD_CAS_RANK0_BANK3\0"
+    "RD_CAS_RANK0_BANK4\0"
+    "RD_CAS_RANK0_BANK5\0"
+    "RD_CAS_RANK0_BANK6\0"
+    "RD_CAS_RANK0_BANK7\0"
+    "RD_CAS_RANK0_BANK8\0"
+    "RD_CAS_RANK0_BANK9\0"
+    "RD_CAS_RANK0_BANK10\0"
+    "RD_CAS_RANK0_BANK11\0"
+    "RD_CAS_RANK0_BANK12\0"
+    "RD_CAS_RANK0_BANK13\0"
+    "RD_CAS_RANK0_BANK14\0"
+    "RD_CAS_RANK0_BANK15\0"
+    "RD_CAS_RANK0_ALLBANKS\0"
+    "RD_CAS_RANK0_BANKG0\0"
+    "RD_CAS_RANK0_BANKG1\0"
+    "RD_CAS_RANK0_BANKG2\0"
+    "RD_CAS_RANK0_BANKG3\0"
+    "RD_CAS_RANK1_BANK0\0"
+    "RD_CAS_RANK1_BANK1\0"
+    "RD_CAS_RANK1_BANK2\0"
+    "RD_CAS_RANK1_BANK3\0"
+    "RD_CAS_RANK1_BANK4\0"
+    "RD_CAS_RANK1_BANK5\0"
+    "RD_CAS_RANK1_BANK6\0"
+    "RD_CAS_RANK1_BANK7\0"
+    "RD_CAS_RANK1_BANK8\0"
+    "RD_CAS_RANK1_BANK9\0"
+    "RD_CAS_RANK1_BANK10\0"
+    "RD_CAS_RANK1_BANK11\0"
+    "RD_CAS_RANK1_BANK12\0"
+    "RD_CAS_RANK1_BANK13\0"
+    "RD_CAS_RANK1_BANK14\0"
+    "RD_CAS_RANK1_BANK15\0"
+    "RD_CAS_RANK1_ALLBANKS\0"
+    "RD_CAS_RANK1_BANKG0\0"
+    "RD_CAS_RANK1_BANKG1\0"
+    "RD_CAS_RANK1_BANKG2\0"
+    "RD_CAS_RANK1_BANKG3\0"
+    "RD_CAS_RANK2_BANK0\0"
+    "RD_CAS_RANK2_BANK1\0"
+    "RD_CAS_RANK2_BANK2\0"
+    "RD_CAS_RANK2_BANK3\0"
+    "RD_CAS_RANK2_BANK4\0"
+    "RD_CAS_RANK2_BANK5\0"
+    "RD_CAS_RANK2_BANK6\0"
+    "RD_CAS_RANK2_BANK7\0"
+    "RD_CAS_RANK2_BANK8\0"
+    "RD_CAS_RANK2_BANK9\0"
+    "RD_CAS_RANK2_BANK10\0"
+    "RD_CAS_RANK2_BANK11\0"
+    "RD_CAS_RANK2_BANK12\0"
+    "RD_CAS_RANK2_BANK13\0"
+    "RD_CAS_RANK2_BANK14\0"
+    "RD_CAS_RANK2_BANK15\0"
+    "RD_CAS_RANK2_ALLBANKS\0"
+    "RD_CAS_RANK2_BANKG0\0"
+    "RD_CAS_RANK2_BANKG1\0"
+    "RD_CAS_RANK2_BANKG2\0"
+    "RD_CAS_RANK2_BANKG3\0"
+    "RD_CAS_RANK3_BANK0\0"
+    "RD_CAS_RANK3_BANK1\0"
+    "RD_CAS_RANK3_BANK2\0"
+    "RD_CAS_RANK3_BANK3\0"
+    "RD_CAS_RANK3_BANK4\0"
+    "RD_CAS_RANK3_BANK5\0"
+    "RD_CAS_RANK3_BANK6\0"
+    "RD_CAS_RANK3_BANK7\0"
+    "RD_CAS_RANK3_BANK8\0"
+    "RD_CAS_RANK3_BANK9\0"
+    "RD_CAS_RANK3_BANK10\0"
+    "RD_CAS_RANK3_BANK11\0"
+    "RD_CAS_RANK3_BANK12\0"
+    "RD_CAS_RANK3_BANK13\0"
+    "RD_CAS_RANK3_BANK14\0"
+    "RD_CAS_RANK3_BANK15\0"
+    "RD_CAS_RANK3_ALLBANKS\0"
+    "RD_CAS_RANK3_BANKG0\0"
+    "RD_CAS_RANK3_BANKG1\0"
+    "RD_CAS_RANK3_BANKG2\0"
+    "RD_CAS_RANK3_BANKG3\0"
+    "RD_CAS_RANK4_BANK0\0"
+    "RD_CAS_RANK4_BANK1\0"
+    "RD_CAS_RANK4_BANK2\0"
+    "RD_CAS_RANK4_BANK3\0"
+    "RD_CAS_RANK4_BANK4\0"
+    "RD_CAS_RANK4_BANK5\0"
+    "RD_CAS_RANK4_BANK6\0"
+    "RD_CAS_RANK4_BANK7\0"
+    "RD_CAS_RANK4_BANK8\0"
+    "RD_CAS_RANK4_BANK9\0"
+    "RD_CAS_RANK4_BANK10\0"
+    "RD_CAS_RANK4_BANK11\0"
+    "RD_CAS_RANK4_BANK12\0"
+    "RD_CAS_RANK4_BANK13\0"
+    "RD_CAS_RANK4_BANK14\0"
+    "RD_CAS_RANK4_BANK15\0"
+    "RD_CAS_RANK4_ALLBANKS\0"
+    "RD_CAS_RANK4_BANKG0\0"
+    "RD_CAS_RANK4_BANKG1\0"
+    "RD_CAS_RANK4_BANKG2\0"
+    "RD_CAS_RANK4_BANKG3\0"
+    "RD_CAS_RANK5_BANK0\0"
+    "RD_CAS_RANK5_BANK1\0"
+    "RD_CAS_RANK5_BANK2\0"
+    "RD_CAS_RANK5_BANK3\0"
+    "RD_CAS_RANK5_BANK4\0"
+    "RD_CAS_RANK5_BANK5\0"
+    "RD_CAS_RANK5_BANK6\0"
+    "RD_CAS_RANK5_BANK7\0"
+    "RD_CAS_RANK5_BANK8\0"
+    "RD_CAS_RANK5_BANK9\0"
+    "RD_CAS_RANK5_BANK10\0"
+    "RD_CAS_RANK5_BANK11\0"
+    "RD_CAS_RANK5_BANK12\0"
+    "RD_CAS_RANK5_BANK13\0"
+    "RD_CAS_RANK5_BANK14\0"
+    "RD_CAS_RANK5_BANK15\0"
+    "RD_CAS_RANK5_ALLBANKS\0"
+    "RD_CAS_RANK5_BANKG0\0"
+    "RD_CAS_RANK5_BANKG1\0"
+    "RD_CAS_RANK5_BANKG2\0"
+    "RD_CAS_RANK5_BANKG3\0"
+    "RD_CAS_RANK6_BANK0\0"
+    "RD_CAS_RANK6_BANK1\0"
+    "RD_CAS_RANK6_BANK2\0"
+    "RD_CAS_RANK6_BANK3\0"
+    "RD_CAS_RANK6_BANK4\0"
+    "RD_CAS_RANK6_BANK5\0"
+    "RD_CAS_RANK6_BANK6\0"
+    "RD_CAS_RANK6_BANK7\0"
+    "RD_CAS_RANK6_BANK8\0"
+    "RD_CAS_RANK6_BANK9\0"
+    "RD_CAS_RANK6_BANK10\0"
+    "RD_CAS_RANK6_BANK11\0"
+    "RD_CAS_RANK6_BANK12\0"
+    "RD_CAS_RANK6_BANK13\0"
+    "RD_CAS_RANK6_BANK14\0"
+    "RD_CAS_RANK6_BANK15\0"
+    "RD_CAS_RANK6_ALLBANKS\0"
+    "RD_CAS_RANK6_BANKG0\0"
+    "RD_CAS_RANK6_BANKG1\0"
+    "RD_CAS_RANK6_BANKG2\0"
+    "RD_CAS_RANK6_BANKG3\0"
+    "RD_CAS_RANK7_BANK0\0"
+    "RD_CAS_RANK7_BANK1\0"
+    "RD_CAS_RANK7_BANK2\0"
+    "RD_CAS_RANK7_BANK3\0"
+    "RD_CAS_RANK7_BANK4\0"
+    "RD_CAS_RANK7_BANK5\0"
+    "RD_CAS_RANK7_BANK6\0"
+    "RD_CAS_RANK7_BANK7\0"
+    "RD_CAS_RANK7_BANK8\0"
+    "RD_CAS_RANK7_BANK9\0"
+    "RD_CAS_RANK7_BANK10\0"
+    "RD_CAS_RANK7_BANK11\0"
+    "RD_CAS_RANK7_BANK12\0"
+    "RD_CAS_RANK7_BANK13\0"
+    "RD_CAS_RANK7_BANK14\0"
+    "RD_CAS_RANK7_BANK15\0"
+    "RD_CAS_RANK7_ALLBANKS\0"
+    "RD_CAS_RANK7_BANKG0\0"
+    "RD_CAS_RANK7_BANKG1\0"
+    "RD_CAS_RANK7_BANKG2\0"
+    "RD_CAS_RANK7_BANKG3\0"
+    "RPQ_CYCLES_NE\0"
+    "RPQ_INSERTS\0"
+    "VMSE_MXB_WR_OCCUPANCY\0"
+    "VMSE_WR_PUSH_WMM\0"
+    "VMSE_WR_PUSH_RMM\0"
+    "WMM_TO_RMM_LOW_THRESH\0"
+    "WMM_TO_RMM_STARVE\0"
+    "WMM_TO_RMM_VMSE_RETRY\0"
+    "WPQ_INSERTS\0"
+    "WPQ_CYCLES_FULL\0"
+    "WPQ_CYCLES_NE\0"
+    "WPQ_READ_HIT\0"
+    "WPQ_WRITE_HIT\0"
+    "WRONG_MM\0"
+    "WR_CAS_RANK0_BANK0\0"
+    "WR_CAS_RANK0_BANK1\0"
+    "WR_CAS_RANK0_BANK2\0"
+    "WR_CAS_RANK0_BANK3\0"
+    "WR_CAS_RANK0_BANK4\0"
+    "WR_CAS_RANK0_BANK5\0"
+    "WR_CAS_RANK0_BANK6\0"
+    "WR_CAS_RANK0_BANK7\0"
+    "WR_CAS_RANK0_BANK8\0"
+    "WR_CAS_RANK0_BANK9\0"
+    "WR_CAS_RANK0_BANK10\0"
+    "WR_CAS_RANK0_BANK11\0"
+    "WR_CAS_RANK0_BANK12\0"
+    "WR_CAS_RANK0_BANK13\0"
+    "WR_CAS_RANK0_BANK14\0"
+    "WR_CAS_RANK0_BANK15\0"
+    "WR_CAS_RANK0_ALLBANKS\0"
+    "WR_CAS_RANK0_BANKG0\0"
+    "WR_CAS_RANK0_BANKG1\0"
+    "WR_CAS_RANK0_BANKG2\0"
+    "WR_CAS_RANK0_BANKG3\0"
+    "WR_CAS_RANK1_BANK0\0"
+    "WR_CAS_RANK1_BANK1\0"
+    "WR_CAS_RANK1_BANK2\0"
+    "WR_CAS_RANK1_BANK3\0"
+    "WR_CAS_RANK1_BANK4\0"
+    "WR_CAS_RANK1_BANK5\0"
+    "WR_CAS_RANK1_BANK6\0"
+    "WR_CAS_RANK1_BANK7\0"
+    "WR_CAS_RANK1_BANK8\0"
+    "WR_CAS_RANK1_BANK9\0"
+    "WR_CAS_RANK1_BANK10\0"
+    "WR_CAS_RANK1_BANK11\0"
+    "WR_CAS_RANK1_BANK12\0"
+    "WR_CAS_RANK1_BANK13\0"
+    "WR_CAS_RANK1_BANK14\0"
+    "WR_CAS_RANK1_BANK15\0"
+    "WR_CAS_RANK1_ALLBANKS\0"
+    "WR_CAS_RANK1_BANKG0\0"
+    "WR_CAS_RANK1_BANKG1\0"
+    "WR_CAS_RANK1_BANKG2\0"
+    "WR_CAS_RANK1_BANKG3\0"
+    "WR_CAS_RANK2_BANK0\0"
+    "WR_CAS_RANK2_BANK1\0"
+    "WR_CAS_RANK2_BANK2\0"
+    "WR_CAS_RANK2_BANK3\0"
+    "WR_CAS_RANK2_BANK4\0"
+    "WR_CAS_RANK2_BANK5\0"
+    "WR_CAS_RANK2_BANK6\0"
+    "WR_CAS_RANK2_BANK7\0"
+    "WR_CAS_RANK2_BANK8\0"
+    "WR_CAS_RANK2_BANK9\0"
+    "WR_CAS_RANK2_BANK10\0"
+    "WR_CAS_RANK2_BANK11\0"
+    "WR_CAS_RANK2_BANK12\0"
+    "WR_CAS_RANK2_BANK13\0"
+    "WR_CAS_RANK2_BANK14\0"
+    "WR_CAS_RANK2_BANK15\0"
+    "WR_CAS_RANK2_ALLBANKS\0"
+    "WR_CAS_RANK2_BANKG0\0"
+    "WR_CAS_RANK2_BANKG1\0"
+    "WR_CAS_RANK2_BANKG2\0"
+    "WR_CAS_RANK2_BANKG3\0"
+    "WR_CAS_RANK3_BANK0\0"
+    "WR_CAS_RANK3_BANK1\0"
+    "WR_CAS_RANK3_BANK2\0"
+    "WR_CAS_RANK3_BANK3\0"
+    "WR_CAS_RANK3_BANK4\0"
+    "WR_CAS_RANK3_BANK5\0"
+    "WR_CAS_RANK3_BANK6\0"
+    "WR_CAS_RANK3_BANK7\0"
+    "WR_CAS_RANK3_BANK8\0"
+    "WR_CAS_RANK3_BANK9\0"
+    "WR_CAS_RANK3_BANK10\0"
+    "WR_CAS_RANK3_BANK11\0"
+    "WR_CAS_RANK3_BANK12\0"
+    "WR_CAS_RANK3_BANK13\0"
+    "WR_CAS_RANK3_BANK14\0"
+    "WR_CAS_RANK3_BANK15\0"
+    "WR_CAS_RANK3_ALLBANKS\0"
+    "WR_CAS_RANK3_BANKG0\0"
+    "WR_CAS_RANK3_BANKG1\0"
+    "WR_CAS_RANK3_BANKG2\0"
+    "WR_CAS_RANK3_BANKG3\0"
+    "WR_CAS_RANK4_BANK0\0"
+    "WR_CAS_RANK4_BANK1\0"
+    "WR_CAS_RANK4_BANK2\0"
+    "WR_CAS_RANK4_BANK3\0"
+    "WR_CAS_RANK4_BANK4\0"
+    "WR_CAS_RANK4_BANK5\0"
+    "WR_CAS_RANK4_BANK6\0"
+    "WR_CAS_RANK4_BANK7\0"
+    "WR_CAS_RANK4_BANK8\0"
+    "WR_CAS_RANK4_BANK9\0"
+    "WR_CAS_RANK4_BANK10\0"
+    "WR_CAS_RANK4_BANK11\0"
+    "WR_CAS_RANK4_BANK12\0"
+    "WR_CAS_RANK4_BANK13\0"
+    "WR_CAS_RANK4_BANK14\0"
+    "WR_CAS_RANK4_BANK15\0"
+    "WR_CAS_RANK4_ALLBANKS\0"
+    "WR_CAS_RANK4_BANKG0\0"
+    "WR_CAS_RANK4_BANKG1\0"
+    "WR_CAS_RANK4_BANKG2\0"
+    "WR_CAS_RANK4_BANKG3\0"
+    "WR_CAS_RANK5_BANK0\0"
+    "WR_CAS_RANK5_BANK1\0"
+    "WR_CAS_RANK5_BANK2\0"
+    "WR_CAS_RANK5_BANK3\0"
+    "WR_CAS_RANK5_BANK4\0"
+    "WR_CAS_RANK5_BANK5\0"
+    "WR_CAS_RANK5_BANK6\0"
+    "WR_CAS_RANK5_BANK7\0"
+    "WR_CAS_RANK5_BANK8\0"
+    "WR_CAS_RANK5_BANK9\0"
+    "WR_CAS_RANK5_BANK10\0"
+    "WR_CAS_RANK5_BANK11\0"
+    "WR_CAS_RANK5_BANK12\0"
+    "WR_CAS_RANK5_BANK13\0"
+    "WR_CAS_RANK5_BANK14\0"
+    "WR_CAS_RANK5_BANK15\0"
+    "WR_CAS_RANK5_ALLBANKS\0"
+    "WR_CAS_RANK5_BANKG0\0"
+    "WR_CAS_RANK5_BANKG1\0"
+    "WR_CAS_RANK5_BANKG2\0"
+    "WR_CAS_RANK5_BANKG3\0"
+    "WR_CAS_RANK6_BANK0\0"
+    "WR_CAS_RANK6_BANK1\0"
+    "WR_CAS_RANK6_BANK2\0"
+    "WR_CAS_RANK6_BANK3\0"
+    "WR_CAS_RANK6_BANK4\0"
+    "WR_CAS_RANK6_BANK5\0"
+    "WR_CAS_RANK6_BANK6\0"
+    "WR_CAS_RANK6_BANK7\0"
+    "WR_CAS_RANK6_BANK8\0"
+    "WR_CAS_RANK6_BANK9\0"
+    "WR_CAS_RANK6_BANK10\0"
+    "WR_CAS_RANK6_BANK11\0"
+    "WR_CAS_RANK6_BANK12\0"
+    "WR_CAS_RANK6_BANK13\0"
+    "WR_CAS_RANK6_BANK14\0"
+    "WR_CAS_RANK6_BANK15\0"
+    "WR_CAS_RANK6_ALLBANKS\0"
+    "WR_CAS_RANK6_BANKG0\0"
+    "WR_CAS_RANK6_BANKG1\0"
+    "WR_CAS_RANK6_BANKG2\0"
+    "WR_CAS_RANK6_BANKG3\0"
+    "WR_CAS_RANK7_BANK0\0"
+    "WR_CAS_RANK7_BANK1\0"
+    "WR_CAS_RANK7_BANK2\0"
+    "WR_CAS_RANK7_BANK3\0"
+    "WR_CAS_RANK7_BANK4\0"
+    "WR_CAS_RANK7_BANK5\0"
+    "WR_CAS_RANK7_BANK6\0"
+    "WR_CAS_RANK7_BANK7\0"
+    "WR_CAS_RANK7_BANK8\0"
+    "WR_CAS_RANK7_BANK9\0"
+    "WR_CAS_RANK7_BANK10\0"
+    "WR_CAS_RANK7_BANK11\0"
+    "WR_CAS_RANK7_BANK12\0"
+    "WR_CAS_RANK7_BANK13\0"
+    "WR_CAS_RANK7_BANK14\0"
+    "WR_CAS_RANK7_BANK15\0"
+    "WR_CAS_RANK7_ALLBANKS\0"
+    "WR_CAS_RANK7_BANKG0\0"
+    "WR_CAS_RANK7_BANKG1\0"
+    "WR_CAS_RANK7_BANKG2\0"
+    "WR_CAS_RANK7_BANKG3\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDIT_PRQ_QPI0\0"
+    "IIO_CREDIT_PRQ_QPI1\0"
+    "IIO_CREDIT_ISOCH_QPI0\0"
+    "IIO_CREDIT_ISOCH_QPI1\0"
+    "R2PCIE_RING_AD_USED_CW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CW_ODD\0"
+    "R2PCIE_RING_AD_USED_CW\0"
+    "R2PCIE_RING_AD_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AD_USED_CCW_ODD\0"
+    "R2PCIE_RING_AD_USED_CCW\0"
+    "R2PCIE_RING_AD_USED_ANY\0"
+    "RING_AK_BOUNCES_UP\0"
+    "RING_AK_BOUNCES_DN\0"
+    "R2PCIE_RING_AK_USED_CW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CW_ODD\0"
+    "R2PCIE_RING_AK_USED_CW\0"
+    "R2PCIE_RING_AK_USED_CCW_EVEN\0"
+    "R2PCIE_RING_AK_USED_CCW_ODD\0"
+    "R2PCIE_RING_AK_USED_CCW\0"
+    "R2PCIE_RING_AK_USED_ANY\0"
+    "R2PCIE_RING_BL_USED_CW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CW_ODD\0"
+    "R2PCIE_RING_BL_USED_CW\0"
+    "R2PCIE_RING_BL_USED_CCW_EVEN\0"
+    "R2PCIE_RING_BL_USED_CCW_ODD\0"
+    "R2PCIE_RING_BL_USED_CCW\0"
+    "R2PCIE_RING_BL_USED_ANY\0"
+    "R2PCIE_RING_IV_USED_CW\0"
+    "R2PCIE_RING_IV_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_ANY\0"
+    "RXR_CYCLES_NE_NCB\0"
+    "PBOX|RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "RXR_CYCLES_NE_NCS\0"
+    "RXR_INSERTS_NCB\0"
+    "RXR_INSERTS_NCS\0"
+    "RXR_OCCUPANCY_DRS\0"
+    "TXR_NACK_DN_AD\0"
+    "TXR_NACK_DN_BL\0"
+    "TXR_NACK_DN_AK\0"
+    "TXR_NACK_UP_AD\0"
+    "TXR_NACK_UP_BL\0"
+    "TXR_NACK_UP_AK\0"
+    "TXR_NACK_AD\0"
+    "TXR_NACK_BL\0"
+    "TXR_NACK_AK\0"
+    "TXR_NACK_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "IBOX\0"
+    "CACHE_TOTAL_OCCUPANCY_SOURCE\0"
+    "COHERENT_OPS_PCIRDCUR\0"
+    "COHERENT_OPS_CRD\0"
+    "COHERENT_OPS_DRD\0"
+    "COHERENT_OPS_RFO\0"
+    "COHERENT_OPS_PCITOM\0"
+    "COHERENT_OPS_PCIDCAHINT\0"
+    "COHERENT_OPS_WBMTOI\0"
+    "COHERENT_OPS_CLFLUSH\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_2ND_RD_INSERT\0"
+    "MISC0_2ND_WR_INSERT\0"
+    "MISC0_2ND_ATOMIC_INSERT\0"
+    "MISC0_FAST_XFER\0"
+    "MISC0_PF_ACK_HINT\0"
+    "MISC0_PF_TIMEOUT\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_LOST_FWD\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "MISC1_DATA_THROTTLE\0"
+    "SNOOP_RESP_MISS\0"
+    "SNOOP_RESP_HIT_I\0"
+    "SNOOP_RESP_HIT_ES\0"
+    "SNOOP_RESP_HIT_M\0"
+    "SNOOP_RESP_SNPCODE\0"
+    "SNOOP_RESP_SNPDATA\0"
+    "SNOOP_RESP_SNPINV\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREF\0"
+    "TRANSACTIONS_WR_PREF\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "RXR_AK_INSERTS\0"
+    "RXR_BL_DRS_CYCLES_FULL\0"
+    "RXR_BL_DRS_INSERTS\0"
+    "RXR_BL_DRS_OCCUPANCY\0"
+    "RXR_BL_NCB_CYCLES_FULL\0"
+    "RXR_BL_NCB_INSERTS\0"
+    "RXR_BL_NCB_OCCUPANCY\0"
+    "RXR_BL_NCS_CYCLES_FULL\0"
+    "RXR_BL_NCS_INSERTS\0"
+    "RXR_BL_NCS_OCCUPANCY\0"
+    "TXR_AD_STALL_CREDIT_CYCLES\0"
+    "TXR_BL_STALL_CREDIT_CYCLES\0"
+    "TXR_DATA_INSERTS_NCB\0"
+    "TXR_DATA_INSERTS_NCS\0"
+    "TXR_REQUEST_OCCUPANCY\0"
+    "RBOX_CLOCKTICKS\0"
+    "RBOX\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO0\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO1\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO2\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO3\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO4\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO5\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO6\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO7\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO8\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO9\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO10\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO11\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO12\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO13\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO14_16\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO15_17\0"
+    "HA_R2_BL_CREDITS_EMPTY_LO_HA0\0"
+    "RBOX0C0|RBOX1C0\0"
+    "HA_R2_BL_CREDITS_EMPTY_LO_HA1\0"
+    "HA_R2_BL_CREDITS_EMPTY_LO_R2_NCB\0"
+    "HA_R2_BL_CREDITS_EMPTY_LO_R2_NCS\0"
+    "HA_R2_BL_CREDITS_EMPTY_HI_HA0\0"
+    "RBOX0C1|RBOX1C1\0"
+    "HA_R2_BL_CREDITS_EMPTY_HI_HA1\0"
+    "HA_R2_BL_CREDITS_EMPTY_HI_R2_NCB\0"
+    "HA_R2_BL_CREDITS_EMPTY_HI_R2_NCS\0"
+    "QPI0_AD_CREDITS_EMPTY_VNA\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_AD_CREDITS_EMPTY_VNA\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI0_BL_CREDITS_EMPTY_VNA\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VNA\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "R3QPI_RING_AD_USED_CW_EVEN\0"
+    "R3QPI_RING_AD_USED_CW_ODD\0"
+    "R3QPI_RING_AD_USED_CW\0"
+    "R3QPI_RING_AD_USED_CCW_EVEN\0"
+    "R3QPI_RING_AD_USED_CCW_ODD\0"
+    "R3QPI_RING_AD_USED_CCW\0"
+    "R3QPI_RING_AD_USED_ANY\0"
+    "R3QPI_RING_AK_USED_CW_EVEN\0"
+    "R3QPI_RING_AK_USED_CW_ODD\0"
+    "R3QPI_RING_AK_USED_CW\0"
+    "R3QPI_RING_AK_USED_CCW_EVEN\0"
+    "R3QPI_RING_AK_USED_CCW_ODD\0"
+    "R3QPI_RING_AK_USED_CCW\0"
+    "R3QPI_RING_AK_USED_ANY\0"
+    "R3QPI_RING_BL_USED_CW_EVEN\0"
+    "R3QPI_RING_BL_USED_CW_ODD\0"
+    "R3QPI_RING_BL_USED_CW\0"
+    "R3QPI_RING_BL_USED_CCW_EVEN\0"
+    "R3QPI_RING_BL_USED_CCW_ODD\0"
+    "R3QPI_RING_BL_USED_CCW\0"
+    "R3QPI_RING_BL_USED_ANY\0"
+    "R3QPI_RING_IV_USED_CW\0"
+    "R3QPI_RING_IV_USED_CCW\0"
+    "R3QPI_RING_IV_USED_ANY\0"
+    "RING_SINK_STARVED_AK\0"
+    "RXR_CYCLES_NE_HOM\0"
+    "RXR_CYCLES_NE_SNP\0"
+    "RXR_CYCLES_NE_NDR\0"
+    "RXR_CYCLES_NE_VN1_HOM\0"
+    "RXR_CYCLES_NE_VN1_SNP\0"
+    "RXR_CYCLES_NE_VN1_NDR\0"
+    "RXR_CYCLES_NE_VN1_DRS\0"
+    "RXR_CYCLES_NE_VN1_NCB\0"
+    "RXR_CYCLES_NE_VN1_NCS\0"
+    "RXR_INSERTS_HOM\0"
+    "RXR_INSERTS_SNP\0"
+    "RXR_INSERTS_NDR\0"
+    "RXR_INSERTS_DRS\0"
+    "RXR_INSERTS_VN1_HOM\0"
+    "RXR_INSERTS_VN1_SNP\0"
+    "RXR_INSERTS_VN1_NDR\0"
+    "RXR_INSERTS_VN1_DRS\0"
+    "RXR_INSERTS_VN1_NCB\0"
+    "RXR_INSERTS_VN1_NCS\0"
+    "RXR_OCCUPANCY_VN1_HOM\0"
+    "RXR_OCCUPANCY_VN1_SNP\0"
+    "RXR_OCCUPANCY_VN1_NDR\0"
+    "RXR_OCCUPANCY_VN1_DRS\0"
+    "RXR_OCCUPANCY_VN1_NCB\0"
+    "RXR_OCCUPANCY_VN1_NCS\0"
+    "VN0_CREDITS_USED_HOM\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_NDR\0"
+    "VN0_CREDITS_USED_DRS\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN0_CREDITS_REJECT_HOM\0"
+    "VN0_CREDITS_REJECT_SNP\0"
+    "VN0_CREDITS_REJECT_NDR\0"
+    "VN0_CREDITS_REJECT_DRS\0"
+    "VN0_CREDITS_REJECT_NCB\0"
+    "VN0_CREDITS_REJECT_NCS\0"
+    "VN1_CREDITS_USED_HOM\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_NDR\0"
+    "VN1_CREDITS_USED_DRS\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VN1_CREDITS_REJECT_HOM\0"
+    "VN1_CREDITS_REJECT_SNP\0"
+    "VN1_CREDITS_REJECT_NDR\0"
+    "VN1_CREDITS_REJECT_DRS\0"
+    "VN1_CREDITS_REJECT_NCB\0"
+    "VN1_CREDITS_REJECT_NCS\0"
+    "VNA_CREDITS_ACQUIRED_AD\0"
+    "VNA_CREDITS_ACQUIRED_BL\0"
+    "VNA_CREDITS_REJECT_HOM\0"
+    "VNA_CREDITS_REJECT_SNP\0"
+    "VNA_CREDITS_REJECT_NDR\0"
+    "VNA_CREDITS_REJECT_DRS\0"
+    "VNA_CREDITS_REJECT_NCB\0"
+    "VNA_CREDITS_REJECT_NCS\0"
+    "QBOX_CLOCKTICKS\0"
+    "QBOX\0"
+    "CTO_COUNT\0"
+    "DIRECT2CORE_SUCCESS_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS\0"
+    "DIRECT2CORE_FAILURE_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT\0"
+    "DIRECT2CORE_FAILURE_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_MISS\0"
+    "DIRECT2CORE_FAILURE_RBT_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT_MISS\0"
+    "L1_POWER_CYCLES\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0_POWER_CYCLES\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0_POWER_CYCLES\0"
+    "RXL_BYPASSED\0"
+    "TXL_BYPASSED\0"
+    "RXL_CREDITS_CONSUMED_VN0_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN0_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN0_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN0_NDR\0"
+    "RXL_CREDITS_CONSUMED_VN1_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN1_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN1_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN1_NDR\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_CYCLES_NE\0"
+    "TXL_CYCLES_NE\0"
+    "RXL_FLITS_G1_SNP\0"
+    "RXL_FLITS_G1_HOM_REQ\0"
+    "RXL_FLITS_G1_HOM_NONREQ\0"
+    "RXL_FLITS_G1_HOM\0"
+    "RXL_FLITS_G1_DRS_DATA\0"
+    "RXL_FLITS_G1_DRS_NONDATA\0"
+    "RXL_FLITS_G1_DRS\0"
+    "RXL_FLITS_G2_NDR_AD\0"
+    "RXL_FLITS_G2_NDR_AK\0"
+    "RXL_FLITS_G2_NCB_DATA\0"
+    "RXL_FLITS_G2_NCB_NONDATA\0"
+    "RXL_FLITS_G2_NCB\0"
+    "RXL_FLITS_G2_NCS\0"
+    "RXL_FLITS_G0_IDLE\0"
+    "RXL_FLITS_G0_DATA\0"
+    "RXL_FLITS_G0_NON_DATA\0"
+    "TXL_FLITS_G0_IDLE\0"
+    "TXL_FLITS_G0_DATA\0"
+    "TXL_FLITS_G0_NON_DATA\0"
+    "TXL_FLITS_G1_SNP\0"
+    "TXL_FLITS_G1_HOM_REQ\0"
+    "TXL_FLITS_G1_HOM_NONREQ\0"
+    "TXL_FLITS_G1_HOM\0"
+    "TXL_FLITS_G1_DRS_DATA\0"
+    "TXL_FLITS_G1_DRS_NONDATA\0"
+    "TXL_FLITS_G1_DRS\0"
+    "TXL_FLITS_G2_NDR_AD\0"
+    "TXL_FLITS_G2_NDR_AK\0"
+    "TXL_FLITS_G2_NCB_DATA\0"
+    "TXL_FLITS_G2_NCB_NONDATA\0"
+    "TXL_FLITS_G2_NCB\0"
+    "TXL_FLITS_G2_NCS\0"
+    "RXL_INSERTS\0"
+    "TXL_INSERTS\0"
+    "RXL_INSERTS_DRS_VN0\0"
+    "RXL_INSERTS_DRS_VN1\0"
+    "RXL_INSERTS_HOM_VN0\0"
+    "RXL_INSERTS_HOM_VN1\0"
+    "RXL_INSERTS_NCB_VN0\0"
+    "RXL_INSERTS_NCB_VN1\0"
+    "RXL_INSERTS_NCS_VN0\0"
+    "RXL_INSERTS_NCS_VN1\0"
+    "RXL_INSERTS_NDR_VN0\0"
+    "RXL_INSERTS_NDR_VN1\0"
+    "RXL_INSERTS_SNP_VN0\0"
+    "RXL_INSERTS_SNP_VN1\0"
+    "RXL_OCCUPANCY\0"
+    "TXL_OCCUPANCY\0"
+    "RXL_OCCUPANCY_DRS_VN0\0"
+    "RXL_OCCUPANCY_DRS_VN1\0"
+    "RXL_OCCUPANCY_HOM_VN0\0"
+    "RXL_OCCUPANCY_HOM_VN1\0"
+    "RXL_OCCUPANCY_NCB_VN0\0"
+    "RXL_OCCUPANCY_NCB_VN1\0"
+    "RXL_OCCUPANCY_NCS_VN0\0"
+    "RXL_OCCUPANCY_NCS_VN1\0"
+    "RXL_OCCUPANCY_NDR_VN0\0"
+    "RXL_OCCUPANCY_NDR_VN1\0"
+    "RXL_OCCUPANCY_SNP_VN0\0"
+    "RXL_OCCUPANCY_SNP_VN1\0"
+    "TXR_AD_HOM_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_HOM_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_HOM_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_HOM_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AD_NDR_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_NDR_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_NDR_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_NDR_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AD_SNP_CREDIT_ACQUIRED_VN0\0"
+    "TXR_AD_SNP_CREDIT_ACQUIRED_VN1\0"
+    "TXR_AD_SNP_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_AD_SNP_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_AK_NDR_CREDIT_ACQUIRED\0"
+    "TXR_AK_NDR_CREDIT_OCCUPANCY\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_DRS_CREDIT_ACQUIRED_VN_SHR\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_BL_DRS_CREDIT_OCCUPANCY_VN_SHR\0"
+    "TXR_BL_NCB_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_NCB_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_NCB_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_NCB_CREDIT_OCCUPANCY_VN1\0"
+    "TXR_BL_NCS_CREDIT_ACQUIRED_VN0\0"
+    "TXR_BL_NCS_CREDIT_ACQUIRED_VN1\0"
+    "TXR_BL_NCS_CREDIT_OCCUPANCY_VN0\0"
+    "TXR_BL_NCS_CREDIT_OCCUPANCY_VN1\0"
+    "VNA_CREDIT_RETURNS\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "QPI_RATE\0"
+    "QBOX0FIX0|QBOX1FIX0\0"
+    "QPI_RX_IDLE\0"
+    "QBOX0FIX1|QBOX1FIX1\0"
+    "QPI_RX_LLR\0"
+    "QBOX0FIX2|QBOX1FIX2\0";
+
+static const PerfmonEventOption haswellEP_arch_event_options[] = {
+ {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_MATCH0,0x8FFF}
+, {EVENT_OPTION_MATCH1,0x60040}
+, {EVENT_OPTION_MATCH0,0x8FFF}
+, {EVENT_OPTION_MATCH1,0x67F80}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x60040}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x67F80}
+};
+
+static const PerfmonEventEntry haswellEP_arch_event_entries[NUM_ARCH_EVENTS_HASWELLEP] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 160, 0, 1, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {187, 208, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {214, 238, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {242, 238, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {258, 238, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {281, 238, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 238, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {326, 238, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {358, 238, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {389, 238, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {424, 238, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 238, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {494, 238, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {525, 238, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {554, 238, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {583, 238, 0, 0, 0x08,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {609, 238, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {641, 238, 1, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {666, 238, 2, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {690, 238, 4, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {719, 238, 6, 3, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {747, 238, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {763, 238, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {787, 238, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {808, 238, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {831, 238, 1, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {855, 238, 9, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {880, 238, 11, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {905, 238, 4, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {934, 238, 13, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {964, 238, 16, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {994, 238, 1, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1028, 238, 19, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1062, 238, 20, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1096, 238, 21, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1130, 238, 22, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1164, 238, 23, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1198, 238, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1219, 238, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1238, 238, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1271, 238, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1303, 238, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1331, 238, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1348, 238, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1366, 238, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1383, 238, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1404, 238, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1426, 238, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1451, 238, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 238, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1503, 238, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1522, 238, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1542, 238, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1558, 238, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1572, 238, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1592, 238, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1614, 238, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1642, 238, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1665, 238, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1693, 238, 0, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1725, 238, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1753, 238, 0, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1785, 238, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1822, 238, 24, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1854, 1876, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1881, 1876, 26, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1914, 1876, 1, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1943, 238, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1973, 238, 1, 1, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1995, 238, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2027, 238, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2063, 238, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2102, 238, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2135, 238, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2167, 238, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2197, 238, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2227, 238, 0, 0, 0x49,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2254, 238, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2287, 238, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 238, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2325, 238, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2341, 238, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2357, 238, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2376, 238, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2388, 238, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 238, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2432, 238, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2460, 238, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2498, 238, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 238, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2581, 238, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2635, 238, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2666, 238, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2702, 238, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2739, 238, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2771, 238, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2804, 238, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2821, 238, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2840, 238, 28, 2, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2863, 238, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2877, 238, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2891, 238, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2905, 238, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2919, 238, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2933, 238, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2956, 238, 30, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {2976, 238, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3020, 238, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3064, 238, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3104, 238, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3145, 238, 1, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3201, 238, 1, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3250, 238, 23, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3297, 238, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3337, 238, 33, 1, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3374, 238, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3406, 238, 33, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3435, 238, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3445, 238, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3459, 238, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3472, 238, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3488, 238, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3505, 238, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3517, 238, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {3534, 238, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {3552, 238, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {3565, 238, 1, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3581, 238, 1, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3604, 238, 19, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3627, 238, 20, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3650, 238, 21, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3673, 238, 1, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3688, 238, 1, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3710, 238, 19, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3732, 238, 20, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3754, 238, 21, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3776, 238, 1, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3794, 238, 1, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3819, 238, 19, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3844, 238, 20, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3869, 238, 21, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3894, 238, 28, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3911, 238, 1, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3930, 238, 1, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3956, 238, 19, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3982, 238, 20, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4008, 238, 21, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4034, 238, 1, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4048, 238, 1, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4069, 238, 19, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4090, 238, 20, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4111, 238, 21, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4132, 238, 28, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4148, 238, 1, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4176, 238, 1, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4202, 238, 19, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4228, 238, 20, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4254, 238, 21, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4280, 238, 1, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4309, 238, 1, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4336, 238, 19, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4363, 238, 20, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4390, 238, 21, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4417, 238, 1, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4441, 238, 1, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4463, 238, 19, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4485, 238, 20, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4507, 238, 21, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4529, 238, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4540, 238, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4554, 238, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4570, 238, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4590, 238, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4616, 238, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4646, 238, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4679, 238, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4706, 238, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4732, 238, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4756, 238, 0, 0, 0x85,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4780, 238, 0, 0, 0x85,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4801, 238, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4815, 238, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4833, 238, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4857, 238, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4885, 238, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {4915, 238, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4949, 238, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4994, 238, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5043, 238, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {5074, 238, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {5109, 238, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {5145, 238, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {5185, 238, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {5223, 238, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {5265, 238, 0, 0, 0x88,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {5294, 238, 0, 0, 0x88,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {5322, 238, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5356, 238, 0, 0, 0x88,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {5400, 238, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5438, 238, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5464, 238, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {5488, 238, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5516, 238, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {5561, 238, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5610, 238, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {5641, 238, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {5676, 238, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {5712, 238, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {5752, 238, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {5790, 238, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {5832, 238, 0, 0, 0x89,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {5861, 238, 0, 0, 0x89,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {5905, 238, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5931, 238, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5959, 238, 21, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6007, 238, 20, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6057, 238, 19, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6107, 238, 1, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6157, 238, 9, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6197, 238, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6223, 238, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6249, 238, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6275, 238, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6301, 238, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6327, 238, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6353, 238, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6379, 238, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6405, 238, 0, 1, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6436, 238, 0, 1, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6467, 238, 0, 1, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6498, 238, 0, 1, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6529, 238, 0, 1, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6560, 238, 0, 1, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6591, 238, 0, 1, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6622, 238, 0, 1, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6653, 238, 0, 0, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK}
+, {6684, 238, 0, 1, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6720, 238, 0, 1, 0xA1,0x9C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6750, 238, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6770, 238, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6789, 238, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6808, 238, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6828, 238, 1, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6861, 238, 19, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6891, 238, 19, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6925, 238, 21, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6958, 238, 21, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6986, 238, 22, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7019, 238, 23, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7049, 238, 23, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7083, 1876, 34, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7117, 1876, 35, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7151, 238, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7160, 238, 1, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7178, 238, 19, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7196, 238, 20, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7214, 238, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7232, 238, 1, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7255, 238, 9, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7280, 238, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7304, 238, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7337, 238, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7353, 238, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7385, 238, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7417, 238, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7445, 238, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7474, 238, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7495, 238, 1, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7521, 238, 9, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7548, 238, 11, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7575, 238, 1, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7611, 238, 19, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7647, 238, 20, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7683, 238, 21, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7719, 238, 22, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7755, 238, 23, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7791, 238, 36, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7827, 238, 34, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7863, 238, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7882, 238, 1, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7913, 238, 9, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7945, 238, 11, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7977, 238, 1, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8018, 238, 19, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8059, 238, 20, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8100, 238, 21, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8141, 238, 22, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8182, 238, 23, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8223, 238, 36, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8264, 238, 34, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8305, 238, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8337, 238, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {8363, 238, 0, 0, 0xBC,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8389, 238, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8415, 238, 0, 0, 0xBC,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8441, 238, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {8467, 238, 0, 0, 0xBC,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8493, 238, 0, 0, 0xBC,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {8523, 238, 0, 0, 0xBC,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {8553, 238, 0, 0, 0xBC,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8583, 238, 0, 0, 0xBC,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8613, 238, 0, 0, 0xBC,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8643, 238, 0, 0, 0xBC,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8673, 238, 0, 0, 0xBC,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {8703, 238, 0, 0, 0xBC,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {8733, 238, 0, 0, 0xBC,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {8767, 238, 0, 0, 0xBC,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {8801, 238, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8823, 238, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8842, 8865, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8870, 238, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8889, 238, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8914, 238, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8939, 238, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8967, 238, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8984, 238, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9006, 238, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9032, 238, 0, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9063, 238, 1, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9088, 238, 9, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9114, 238, 11, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9140, 238, 4, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9170, 238, 13, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9201, 238, 16, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9232, 238, 1, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9267, 238, 19, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9302, 238, 20, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9337, 238, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9372, 238, 22, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9407, 238, 23, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9442, 238, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9464, 238, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9485, 238, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9516, 238, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9535, 238, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9558, 238, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9587, 238, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9615, 238, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9641, 238, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9669, 238, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9695, 238, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9722, 238, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9749, 238, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9778, 238, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9806, 238, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9837, 238, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9864, 238, 0, 0, 0xC6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9880, 238, 0, 0, 0xC6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9897, 238, 0, 0, 0xC6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9912, 238, 0, 0, 0xC6,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9926, 238, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9944, 238, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9963, 238, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9983, 238, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10009, 238, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10035, 238, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10061, 238, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10087, 238, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10113, 238, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10131, 238, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10150, 238, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10170, 238, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10196, 238, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10222, 238, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10248, 238, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10274, 238, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10300, 238, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10321, 238, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10341, 238, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10363, 238, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10384, 238, 1, 1, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10398, 238, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10425, 238, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10448, 238, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10472, 238, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {10493, 238, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10526, 238, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10560, 238, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10588, 238, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10617, 238, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10646, 238, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10676, 238, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10705, 238, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10735, 238, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {10764, 238, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10793, 238, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10823, 238, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10852, 238, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10881, 238, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10911, 238, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10940, 238, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10970, 238, 0, 0, 0xD1,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {11001, 238, 0, 0, 0xD1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11031, 238, 0, 0, 0xD1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {11061, 238, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11100, 238, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11138, 238, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11177, 238, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11216, 238, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11257, 238, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11299, 238, 0, 0, 0xD3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11341, 238, 0, 0, 0xD3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11382, 238, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11395, 238, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11419, 238, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11432, 238, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11449, 238, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11465, 238, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11481, 238, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11498, 238, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11513, 238, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11535, 238, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11549, 238, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11563, 238, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11577, 238, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11593, 238, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {11619, 238, 0, 0, 0xF2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {11645, 238, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11672, 238, 37, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11702, 238, 39, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11733, 238, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {11769, 238, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {11801, 238, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {11837, 238, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {11863, 238, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {11900, 238, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {11933, 238, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {11970, 238, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {12007, 238, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {12040, 238, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {12077, 238, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {12119, 238, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {12159, 238, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {12188, 238, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {12215, 238, 41, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {12245, 238, 43, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {12276, 238, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {12312, 238, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {12344, 238, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {12380, 238, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {12406, 238, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {12443, 238, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {12476, 238, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {12513, 238, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {12550, 238, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {12583, 238, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {12620, 238, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {12662, 238, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {12702, 238, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {12731, 12747, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12752, 12747, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12773, 12747, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12794, 12747, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12815, 12747, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12836, 12747, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12856, 12747, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12876, 12747, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12896, 12747, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12912, 12747, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12928, 12747, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12944, 12747, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12960, 12747, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12976, 12747, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12992, 12747, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13008, 12747, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13023, 13037, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13341, 12747, 0, 0, 0xA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13356, 13374, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13526, 13374, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13548, 13374, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13566, 13374, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13588, 13374, 0, 0, 0x11,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {13610, 13374, 0, 0, 0x11,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13636, 13374, 0, 0, 0x11,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13662, 12747, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13682, 12747, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13702, 12747, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13722, 12747, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13748, 12747, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13764, 12747, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13784, 12747, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13800, 12747, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13816, 12747, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13836, 12747, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13857, 12747, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13877, 12747, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13893, 12747, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13916, 12747, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13938, 12747, 0, 0, 0x1B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13956, 12747, 0, 0, 0x1B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13973, 12747, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13994, 12747, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14014, 12747, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14030, 12747, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14053, 12747, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14075, 12747, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14093, 12747, 0, 0, 0x1C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14110, 12747, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14131, 12747, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14151, 12747, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14167, 12747, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14190, 12747, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14212, 12747, 0, 0, 0x1D,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14230, 12747, 0, 0, 0x1D,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14247, 12747, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14263, 12747, 0, 0, 0x1E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14279, 12747, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14296, 12747, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14315, 12747, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14337, 12747, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {14359, 12747, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14381, 12747, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14403, 12747, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {14425, 12747, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14448, 12747, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14471, 12747, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {14494, 12747, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14512, 12747, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14531, 12747, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14559, 12747, 0, 0, 0x31,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14585, 12747, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14603, 12747, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14622, 12747, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14650, 12747, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14669, 12747, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14695, 12747, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14721, 12747, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NID_MASK}
+, {14739, 12747, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14758, 12747, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14778, 12747, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14798, 12747, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14825, 12747, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14852, 12747, 0, 0, 0x33,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {14871, 12747, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NID_MASK}
+, {14897, 12747, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK}
+, {14918, 12747, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK}
+, {14935, 12747, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK}
+, {14959, 12747, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK}
+, {14974, 12747, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_STATE_MASK}
+, {14990, 12747, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {15005, 12747, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15021, 12747, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15036, 12747, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15061, 12747, 0, 0, 0x35,0x23,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15091, 12747, 0, 0, 0x35,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {15109, 12747, 0, 0, 0x35,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {15132, 12747, 0, 0, 0x35,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {15155, 12747, 0, 0, 0x35,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {15183, 12747, 0, 0, 0x35,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {15207, 12747, 0, 0, 0x35,0x48,0,0,EVENT_OPTION_NID_MASK}
+, {15227, 12747, 0, 0, 0x35,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {15252, 12747, 0, 0, 0x35,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {15271, 12747, 0, 0, 0x35,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15297, 12747, 0, 0, 0x35,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15328, 12747, 0, 0, 0x35,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {15347, 12747, 0, 0, 0x35,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {15371, 13374, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15392, 13374, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15418, 13374, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15441, 13374, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15459, 13374, 0, 0, 0x36,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {15482, 13374, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15499, 13374, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {15526, 13374, 0, 0, 0x36,0x23,0,0,EVENT_OPTION_NONE_MASK}
+, {15558, 13374, 0, 0, 0x36,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {15578, 13374, 0, 0, 0x36,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {15603, 13374, 0, 0, 0x36,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {15628, 13374, 0, 0, 0x36,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {15658, 13374, 0, 0, 0x36,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {15685, 13374, 0, 0, 0x36,0x48,0,0,EVENT_OPTION_NID_MASK}
+, {15707, 13374, 0, 0, 0x36,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {15734, 13374, 0, 0, 0x36,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {15755, 13374, 0, 0, 0x36,0x81,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15783, 13374, 0, 0, 0x36,0x83,0,0,EVENT_OPTION_OPCODE_MASK}
+, {15816, 13374, 0, 0, 0x36,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {15837, 13374, 0, 0, 0x36,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {15863, 12747, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15877, 12747, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15891, 12747, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15905, 12747, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15919, 12747, 0, 0, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {15936, 12747, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15953, 12747, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {15969, 12747, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15987, 12747, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16004, 12747, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16017, 12747, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16032, 12747, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16060, 12747, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16086, 12747, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16110, 12747, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16134, 13374, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16158, 13374, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16182, 16206, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16211, 16206, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16238, 16206, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16252, 16265, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16273, 16289, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16294, 16289, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16315, 16289, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16336, 16289, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16357, 16289, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16378, 16289, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16395, 16289, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16412, 16289, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16431, 16289, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16450, 16289, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16469, 16289, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16488, 16289, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16503, 16289, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12896, 16289, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12912, 16289, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12928, 16289, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16518, 16289, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16540, 16289, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16561, 16289, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16582, 16289, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13023, 16289, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13341, 16289, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16603, 16289, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16624, 16289, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16645, 16289, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16666, 16289, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16687, 16289, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16704, 16289, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16721, 16289, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16739, 16289, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16757, 16289, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16775, 16289, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16793, 16289, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16807, 16289, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16821, 16289, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16840, 16289, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16859, 16289, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16878, 16289, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16897, 16289, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16912, 16289, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13956, 16289, 0, 0, 0x1B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13836, 16289, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13857, 16289, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13877, 16289, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13893, 16289, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13916, 16289, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13938, 16289, 0, 0, 0x1B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14093, 16289, 0, 0, 0x1C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13973, 16289, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13994, 16289, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14014, 16289, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14030, 16289, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14053, 16289, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14075, 16289, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14230, 16289, 0, 0, 0x1D,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14110, 16289, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14131, 16289, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14151, 16289, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14167, 16289, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14190, 16289, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14212, 16289, 0, 0, 0x1D,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14279, 16289, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14247, 16289, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16927, 16289, 0, 0, 0x1E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16945, 16961, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16966, 16961, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16990, 16961, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17014, 16961, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17038, 16961, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17062, 16961, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17086, 16961, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17110, 16961, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17134, 16961, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17158, 16961, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17182, 16961, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17206, 16961, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17231, 16961, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17256, 16961, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17281, 16961, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17306, 16961, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17331, 16961, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17356, 16961, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17381, 16961, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17406, 16961, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17422, 16961, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17438, 16961, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17454, 16961, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17470, 16961, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17486, 16961, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17502, 16961, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17518, 16961, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17534, 16961, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17550, 16961, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17566, 16961, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17583, 16961, 0, 0, 0x3B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17600, 16961, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17617, 16961, 0, 0, 0x3D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17634, 16961, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17651, 16961, 0, 0, 0x3F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17668, 16961, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17685, 16961, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17702, 16961, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {17720, 16961, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {17738, 16961, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {17756, 16961, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {17774, 16961, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17804, 16961, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17823, 16961, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17845, 16961, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17866, 16961, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17884, 16961, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17913, 16961, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17937, 16961, 0, 0, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17962, 16961, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17987, 16961, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18011, 16961, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18035, 16961, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18059, 16961, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18090, 16961, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18121, 16961, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {18152, 16961, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18176, 16961, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18200, 16961, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18224, 16961, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18248, 16961, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18262, 18285, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18294, 18317, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18326, 18348, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18357, 18379, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18388, 18404, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18409, 18404, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {18429, 18404, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18448, 18404, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {18468, 18404, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18486, 18404, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18504, 18404, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18522, 18404, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18535, 18404, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18548, 18404, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18565, 18404, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18586, 18602, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18618, 18404, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18636, 18404, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18664, 18404, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18689, 18404, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18707, 18404, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18728, 18404, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18752, 18404, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18773, 18404, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18796, 18404, 0, 0, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18817, 18404, 0, 0, 0x70,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18846, 18404, 0, 0, 0x70,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18866, 18404, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18891, 18404, 0, 0, 0x70,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18916, 18404, 0, 0, 0x70,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18933, 18404, 0, 0, 0x70,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18961, 18404, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18988, 18404, 0, 0, 0x70,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {19008, 18404, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19029, 18404, 0, 0, 0x70,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {19049, 18404, 0, 0, 0x70,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {19069, 18404, 0, 0, 0x70,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19086, 18404, 0, 0, 0x70,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {19103, 18404, 0, 0, 0x71,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19129, 18404, 0, 0, 0x71,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19146, 18404, 0, 0, 0x71,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19168, 18404, 0, 0, 0x71,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19190, 18404, 0, 0, 0x71,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {19204, 18404, 0, 0, 0x71,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19229, 18404, 0, 0, 0x71,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19253, 18404, 0, 0, 0x71,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {19270, 18404, 0, 0, 0x71,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19288, 18404, 0, 0, 0x71,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {19305, 18404, 0, 0, 0x71,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {19322, 18404, 0, 0, 0x71,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19336, 18404, 0, 0, 0x71,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {19350, 18404, 0, 0, 0x72,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19388, 18404, 0, 0, 0x72,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19417, 18404, 0, 0, 0x72,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19451, 18404, 0, 0, 0x72,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19485, 18404, 0, 0, 0x72,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {19511, 18404, 0, 0, 0x72,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19548, 18404, 0, 0, 0x72,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19584, 18404, 0, 0, 0x72,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19614, 18404, 0, 0, 0x72,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {19640, 18404, 0, 0, 0x72,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {19666, 18404, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19695, 18404, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19724, 18404, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19753, 18404, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19782, 18404, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19811, 18404, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19840, 18404, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19857, 18404, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19867, 18404, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19883, 18404, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19902, 18404, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19924, 18404, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19949, 18404, 0, 0, 0x1A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {19964, 18404, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19980, 18404, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19998, 18404, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20009, 18404, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20023, 18404, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20046, 18404, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20064, 18404, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20076, 18404, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20098, 18404, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20121, 18404, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20143, 18404, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20166, 18404, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20187, 18404, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20209, 18404, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20224, 18404, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20246, 18404, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20269, 18404, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20285, 18404, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20308, 18404, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20332, 18404, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20353, 18404, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20373, 18404, 0, 0, 0x3E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20389, 18404, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20411, 18404, 0, 0, 0x3E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20432, 18404, 0, 0, 0x3E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20449, 18404, 0, 0, 0x3F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20470, 18404, 0, 0, 0x3F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20490, 18404, 0, 0, 0x3F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20506, 18404, 0, 0, 0x3F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20528, 18404, 0, 0, 0x3F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20549, 18404, 0, 0, 0x3F,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20566, 18404, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20587, 18404, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20607, 18404, 0, 0, 0x40,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20623, 18404, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20645, 18404, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20666, 18404, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20683, 18404, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20714, 18404, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20745, 18404, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20776, 18404, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20807, 18404, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20839, 18404, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20871, 18404, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20903, 18404, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20935, 18404, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20966, 18404, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20997, 18404, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21028, 18404, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21059, 18404, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21091, 18404, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21123, 18404, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21155, 18404, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21187, 18404, 0, 0, 0x68,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21212, 18404, 0, 0, 0x68,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21237, 18404, 0, 0, 0x69,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21262, 18404, 0, 0, 0x69,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21287, 18404, 0, 0, 0x6A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21313, 18404, 0, 0, 0x6A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21339, 18404, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21365, 18404, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21391, 18404, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21419, 18404, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21448, 18404, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21470, 18404, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21493, 18404, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21513, 18404, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21535, 18404, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21558, 18404, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21574, 18404, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21590, 18404, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21609, 18404, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21628, 18404, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21646, 18404, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21668, 18404, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21689, 18404, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21714, 18404, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21739, 18404, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21767, 18404, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21795, 18404, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21822, 18404, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21853, 18404, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21883, 18404, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {21909, 18404, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21937, 18404, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21965, 18404, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21993, 18404, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22021, 18404, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22045, 18404, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22069, 18404, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22093, 18404, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22117, 18404, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22141, 18404, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22165, 18404, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22189, 18404, 0, 0, 0x1B,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {22213, 18404, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22237, 18404, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22261, 18404, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22286, 18404, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22311, 18404, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22334, 18404, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22358, 18404, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22382, 18404, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22407, 18404, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22429, 18404, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22459, 18404, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22490, 18404, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22521, 18404, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22553, 18404, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22585, 18404, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22618, 18404, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22650, 18404, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22683, 18404, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22709, 18404, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22735, 18404, 0, 0, 0x2A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22758, 18404, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22765, 18404, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22791, 18404, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22817, 18404, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22840, 18404, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22857, 18404, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22873, 18404, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22888, 18404, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22914, 18404, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22940, 18404, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {22963, 18404, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22980, 18404, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22995, 18404, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23010, 23026, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23031, 23026, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23044, 23026, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23057, 23026, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23071, 23026, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23084, 23026, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23097, 23026, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23110, 23026, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23127, 23026, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23150, 23026, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23163, 23026, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23180, 23026, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23197, 23026, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23214, 23026, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23231, 23026, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {23244, 23026, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {23258, 23026, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23271, 23026, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23290, 23026, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23308, 23026, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23331, 23026, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23348, 23026, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23366, 23026, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23386, 23026, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23404, 23026, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23425, 23026, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23443, 23026, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23466, 23026, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23489, 23026, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23512, 23026, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23535, 23026, 0, 0, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23558, 23026, 0, 0, 0x83,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23581, 23026, 0, 0, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23604, 23026, 0, 0, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {23627, 23026, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23658, 23026, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23679, 23026, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23698, 23026, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23726, 23026, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23754, 23026, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23782, 23026, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23810, 23026, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23838, 23026, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23866, 23026, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23894, 23026, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {23922, 23026, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23947, 23026, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23972, 23026, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23992, 23026, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24013, 23026, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24026, 23026, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24039, 23026, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24053, 23026, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24069, 23026, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24085, 23026, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24102, 23026, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24120, 23026, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24139, 23026, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24158, 23026, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24177, 23026, 0, 0, 0xB0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24196, 23026, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24215, 23026, 0, 0, 0xB0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24234, 23026, 0, 0, 0xB0,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24253, 23026, 0, 0, 0xB0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24272, 23026, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24291, 23026, 0, 0, 0xB0,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24310, 23026, 0, 0, 0xB0,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24330, 23026, 0, 0, 0xB0,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24350, 23026, 0, 0, 0xB0,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24370, 23026, 0, 0, 0xB0,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24390, 23026, 0, 0, 0xB0,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24410, 23026, 0, 0, 0xB0,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24430, 23026, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24452, 23026, 0, 0, 0xB0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24472, 23026, 0, 0, 0xB0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24492, 23026, 0, 0, 0xB0,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24512, 23026, 0, 0, 0xB0,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24532, 23026, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24551, 23026, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24570, 23026, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24589, 23026, 0, 0, 0xB1,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24608, 23026, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24627, 23026, 0, 0, 0xB1,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {24646, 23026, 0, 0, 0xB1,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {24665, 23026, 0, 0, 0xB1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {24684, 23026, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24703, 23026, 0, 0, 0xB1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {24722, 23026, 0, 0, 0xB1,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {24742, 23026, 0, 0, 0xB1,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {24762, 23026, 0, 0, 0xB1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {24782, 23026, 0, 0, 0xB1,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {24802, 23026, 0, 0, 0xB1,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {24822, 23026, 0, 0, 0xB1,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {24842, 23026, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24864, 23026, 0, 0, 0xB1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {24884, 23026, 0, 0, 0xB1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {24904, 23026, 0, 0, 0xB1,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {24924, 23026, 0, 0, 0xB1,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {24944, 23026, 0, 0, 0xB2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24963, 23026, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24982, 23026, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25001, 23026, 0, 0, 0xB2,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25020, 23026, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25039, 23026, 0, 0, 0xB2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25058, 23026, 0, 0, 0xB2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25077, 23026, 0, 0, 0xB2,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25096, 23026, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25115, 23026, 0, 0, 0xB2,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25134, 23026, 0, 0, 0xB2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25154, 23026, 0, 0, 0xB2,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25174, 23026, 0, 0, 0xB2,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25194, 23026, 0, 0, 0xB2,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25214, 23026, 0, 0, 0xB2,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25234, 23026, 0, 0, 0xB2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25254, 23026, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25276, 23026, 0, 0, 0xB2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25296, 23026, 0, 0, 0xB2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25316, 23026, 0, 0, 0xB2,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25336, 23026, 0, 0, 0xB2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25356, 23026, 0, 0, 0xB3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25375, 23026, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25394, 23026, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25413, 23026, 0, 0, 0xB3,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25432, 23026, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25451, 23026, 0, 0, 0xB3,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25470, 23026, 0, 0, 0xB3,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25489, 23026, 0, 0, 0xB3,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25508, 23026, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25527, 23026, 0, 0, 0xB3,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25546, 23026, 0, 0, 0xB3,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25566, 23026, 0, 0, 0xB3,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25586, 23026, 0, 0, 0xB3,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {25606, 23026, 0, 0, 0xB3,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {25626, 23026, 0, 0, 0xB3,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {25646, 23026, 0, 0, 0xB3,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {25666, 23026, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25688, 23026, 0, 0, 0xB3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {25708, 23026, 0, 0, 0xB3,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {25728, 23026, 0, 0, 0xB3,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {25748, 23026, 0, 0, 0xB3,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {25768, 23026, 0, 0, 0xB4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25787, 23026, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25806, 23026, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25825, 23026, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25844, 23026, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25863, 23026, 0, 0, 0xB4,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {25882, 23026, 0, 0, 0xB4,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {25901, 23026, 0, 0, 0xB4,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {25920, 23026, 0, 0, 0xB4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25939, 23026, 0, 0, 0xB4,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {25958, 23026, 0, 0, 0xB4,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {25978, 23026, 0, 0, 0xB4,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {25998, 23026, 0, 0, 0xB4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26018, 23026, 0, 0, 0xB4,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26038, 23026, 0, 0, 0xB4,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26058, 23026, 0, 0, 0xB4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26078, 23026, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26100, 23026, 0, 0, 0xB4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26120, 23026, 0, 0, 0xB4,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26140, 23026, 0, 0, 0xB4,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26160, 23026, 0, 0, 0xB4,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26180, 23026, 0, 0, 0xB5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26199, 23026, 0, 0, 0xB5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26218, 23026, 0, 0, 0xB5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26237, 23026, 0, 0, 0xB5,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26256, 23026, 0, 0, 0xB5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26275, 23026, 0, 0, 0xB5,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26294, 23026, 0, 0, 0xB5,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26313, 23026, 0, 0, 0xB5,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26332, 23026, 0, 0, 0xB5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26351, 23026, 0, 0, 0xB5,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26370, 23026, 0, 0, 0xB5,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26390, 23026, 0, 0, 0xB5,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26410, 23026, 0, 0, 0xB5,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26430, 23026, 0, 0, 0xB5,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26450, 23026, 0, 0, 0xB5,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26470, 23026, 0, 0, 0xB5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26490, 23026, 0, 0, 0xB5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26512, 23026, 0, 0, 0xB5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26532, 23026, 0, 0, 0xB5,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26552, 23026, 0, 0, 0xB5,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26572, 23026, 0, 0, 0xB5,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {26592, 23026, 0, 0, 0xB6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26611, 23026, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26630, 23026, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26649, 23026, 0, 0, 0xB6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {26668, 23026, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26687, 23026, 0, 0, 0xB6,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {26706, 23026, 0, 0, 0xB6,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {26725, 23026, 0, 0, 0xB6,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26744, 23026, 0, 0, 0xB6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26763, 23026, 0, 0, 0xB6,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {26782, 23026, 0, 0, 0xB6,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {26802, 23026, 0, 0, 0xB6,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {26822, 23026, 0, 0, 0xB6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {26842, 23026, 0, 0, 0xB6,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {26862, 23026, 0, 0, 0xB6,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {26882, 23026, 0, 0, 0xB6,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {26902, 23026, 0, 0, 0xB6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26924, 23026, 0, 0, 0xB6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {26944, 23026, 0, 0, 0xB6,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {26964, 23026, 0, 0, 0xB6,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {26984, 23026, 0, 0, 0xB6,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27004, 23026, 0, 0, 0xB7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27023, 23026, 0, 0, 0xB7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27042, 23026, 0, 0, 0xB7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27061, 23026, 0, 0, 0xB7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27080, 23026, 0, 0, 0xB7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27099, 23026, 0, 0, 0xB7,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27118, 23026, 0, 0, 0xB7,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27137, 23026, 0, 0, 0xB7,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27156, 23026, 0, 0, 0xB7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27175, 23026, 0, 0, 0xB7,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27194, 23026, 0, 0, 0xB7,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27214, 23026, 0, 0, 0xB7,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27234, 23026, 0, 0, 0xB7,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27254, 23026, 0, 0, 0xB7,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27274, 23026, 0, 0, 0xB7,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27294, 23026, 0, 0, 0xB7,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27314, 23026, 0, 0, 0xB7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27336, 23026, 0, 0, 0xB7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27356, 23026, 0, 0, 0xB7,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {27376, 23026, 0, 0, 0xB7,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {27396, 23026, 0, 0, 0xB7,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {27416, 23026, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27430, 23026, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27442, 23026, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27464, 23026, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27481, 23026, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27498, 23026, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27520, 23026, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27538, 23026, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27560, 23026, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27572, 23026, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27588, 23026, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27602, 23026, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27615, 23026, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27629, 23026, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27638, 23026, 0, 0, 0xB8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27657, 23026, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27676, 23026, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27695, 23026, 0, 0, 0xB8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {27714, 23026, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27733, 23026, 0, 0, 0xB8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {27752, 23026, 0, 0, 0xB8,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {27771, 23026, 0, 0, 0xB8,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {27790, 23026, 0, 0, 0xB8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27809, 23026, 0, 0, 0xB8,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {27828, 23026, 0, 0, 0xB8,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {27848, 23026, 0, 0, 0xB8,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {27868, 23026, 0, 0, 0xB8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {27888, 23026, 0, 0, 0xB8,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {27908, 23026, 0, 0, 0xB8,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {27928, 23026, 0, 0, 0xB8,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {27948, 23026, 0, 0, 0xB8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27970, 23026, 0, 0, 0xB8,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27990, 23026, 0, 0, 0xB8,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28010, 23026, 0, 0, 0xB8,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28030, 23026, 0, 0, 0xB8,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28050, 23026, 0, 0, 0xB9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28069, 23026, 0, 0, 0xB9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28088, 23026, 0, 0, 0xB9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28107, 23026, 0, 0, 0xB9,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28126, 23026, 0, 0, 0xB9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28145, 23026, 0, 0, 0xB9,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28164, 23026, 0, 0, 0xB9,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {28183, 23026, 0, 0, 0xB9,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {28202, 23026, 0, 0, 0xB9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28221, 23026, 0, 0, 0xB9,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {28240, 23026, 0, 0, 0xB9,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28260, 23026, 0, 0, 0xB9,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28280, 23026, 0, 0, 0xB9,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28300, 23026, 0, 0, 0xB9,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28320, 23026, 0, 0, 0xB9,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28340, 23026, 0, 0, 0xB9,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28360, 23026, 0, 0, 0xB9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28382, 23026, 0, 0, 0xB9,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28402, 23026, 0, 0, 0xB9,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28422, 23026, 0, 0, 0xB9,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28442, 23026, 0, 0, 0xB9,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28462, 23026, 0, 0, 0xBA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28481, 23026, 0, 0, 0xBA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28500, 23026, 0, 0, 0xBA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28519, 23026, 0, 0, 0xBA,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28538, 23026, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28557, 23026, 0, 0, 0xBA,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28576, 23026, 0, 0, 0xBA,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {28595, 23026, 0, 0, 0xBA,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {28614, 23026, 0, 0, 0xBA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28633, 23026, 0, 0, 0xBA,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {28652, 23026, 0, 0, 0xBA,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {28672, 23026, 0, 0, 0xBA,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {28692, 23026, 0, 0, 0xBA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {28712, 23026, 0, 0, 0xBA,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {28732, 23026, 0, 0, 0xBA,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {28752, 23026, 0, 0, 0xBA,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28772, 23026, 0, 0, 0xBA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28794, 23026, 0, 0, 0xBA,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28814, 23026, 0, 0, 0xBA,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {28834, 23026, 0, 0, 0xBA,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {28854, 23026, 0, 0, 0xBA,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {28874, 23026, 0, 0, 0xBB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28893, 23026, 0, 0, 0xBB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28912, 23026, 0, 0, 0xBB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28931, 23026, 0, 0, 0xBB,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {28950, 23026, 0, 0, 0xBB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28969, 23026, 0, 0, 0xBB,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {28988, 23026, 0, 0, 0xBB,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {29007, 23026, 0, 0, 0xBB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {29026, 23026, 0, 0, 0xBB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29045, 23026, 0, 0, 0xBB,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29064, 23026, 0, 0, 0xBB,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {29084, 23026, 0, 0, 0xBB,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {29104, 23026, 0, 0, 0xBB,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29124, 23026, 0, 0, 0xBB,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {29144, 23026, 0, 0, 0xBB,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {29164, 23026, 0, 0, 0xBB,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29184, 23026, 0, 0, 0xBB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29206, 23026, 0, 0, 0xBB,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {29226, 23026, 0, 0, 0xBB,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {29246, 23026, 0, 0, 0xBB,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {29266, 23026, 0, 0, 0xBB,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {29286, 23026, 0, 0, 0xBC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29305, 23026, 0, 0, 0xBC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29324, 23026, 0, 0, 0xBC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29343, 23026, 0, 0, 0xBC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {29362, 23026, 0, 0, 0xBC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29381, 23026, 0, 0, 0xBC,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {29400, 23026, 0, 0, 0xBC,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {29419, 23026, 0, 0, 0xBC,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {29438, 23026, 0, 0, 0xBC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29457, 23026, 0, 0, 0xBC,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29476, 23026, 0, 0, 0xBC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {29496, 23026, 0, 0, 0xBC,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {29516, 23026, 0, 0, 0xBC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29536, 23026, 0, 0, 0xBC,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {29556, 23026, 0, 0, 0xBC,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {29576, 23026, 0, 0, 0xBC,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29596, 23026, 0, 0, 0xBC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29618, 23026, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {29638, 23026, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {29658, 23026, 0, 0, 0xBC,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {29678, 23026, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {29698, 23026, 0, 0, 0xBD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29717, 23026, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29736, 23026, 0, 0, 0xBD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29755, 23026, 0, 0, 0xBD,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {29774, 23026, 0, 0, 0xBD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29793, 23026, 0, 0, 0xBD,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {29812, 23026, 0, 0, 0xBD,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {29831, 23026, 0, 0, 0xBD,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {29850, 23026, 0, 0, 0xBD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29869, 23026, 0, 0, 0xBD,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {29888, 23026, 0, 0, 0xBD,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {29908, 23026, 0, 0, 0xBD,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {29928, 23026, 0, 0, 0xBD,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {29948, 23026, 0, 0, 0xBD,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {29968, 23026, 0, 0, 0xBD,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {29988, 23026, 0, 0, 0xBD,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {30008, 23026, 0, 0, 0xBD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30030, 23026, 0, 0, 0xBD,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30050, 23026, 0, 0, 0xBD,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {30070, 23026, 0, 0, 0xBD,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {30090, 23026, 0, 0, 0xBD,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {30110, 23026, 0, 0, 0xBE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30129, 23026, 0, 0, 0xBE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30148, 23026, 0, 0, 0xBE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30167, 23026, 0, 0, 0xBE,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30186, 23026, 0, 0, 0xBE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30205, 23026, 0, 0, 0xBE,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {30224, 23026, 0, 0, 0xBE,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {30243, 23026, 0, 0, 0xBE,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {30262, 23026, 0, 0, 0xBE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30281, 23026, 0, 0, 0xBE,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {30300, 23026, 0, 0, 0xBE,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {30320, 23026, 0, 0, 0xBE,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {30340, 23026, 0, 0, 0xBE,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30360, 23026, 0, 0, 0xBE,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {30380, 23026, 0, 0, 0xBE,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {30400, 23026, 0, 0, 0xBE,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {30420, 23026, 0, 0, 0xBE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30442, 23026, 0, 0, 0xBE,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30462, 23026, 0, 0, 0xBE,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {30482, 23026, 0, 0, 0xBE,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {30502, 23026, 0, 0, 0xBE,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {30522, 23026, 0, 0, 0xBF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30541, 23026, 0, 0, 0xBF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30560, 23026, 0, 0, 0xBF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30579, 23026, 0, 0, 0xBF,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {30598, 23026, 0, 0, 0xBF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30617, 23026, 0, 0, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {30636, 23026, 0, 0, 0xBF,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {30655, 23026, 0, 0, 0xBF,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {30674, 23026, 0, 0, 0xBF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30693, 23026, 0, 0, 0xBF,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {30712, 23026, 0, 0, 0xBF,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {30732, 23026, 0, 0, 0xBF,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {30752, 23026, 0, 0, 0xBF,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {30772, 23026, 0, 0, 0xBF,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {30792, 23026, 0, 0, 0xBF,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {30812, 23026, 0, 0, 0xBF,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {30832, 23026, 0, 0, 0xBF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30854, 23026, 0, 0, 0xBF,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30874, 23026, 0, 0, 0xBF,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {30894, 23026, 0, 0, 0xBF,0x13,0,0,EVENT_OPTION_NONE_MASK}
+, {30914, 23026, 0, 0, 0xBF,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {30934, 30950, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30955, 30950, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30975, 30950, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30995, 30950, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31017, 30950, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31039, 30950, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31067, 30950, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31094, 30950, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {31117, 30950, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31146, 30950, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31174, 30950, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {31198, 30950, 0, 0, 0x07,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {31222, 30950, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31241, 30950, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31260, 30950, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31288, 30950, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31315, 30950, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {31338, 30950, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31367, 30950, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31395, 30950, 0, 0, 0x08,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {31419, 30950, 0, 0, 0x08,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {31443, 30950, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31471, 30950, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31498, 30950, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {31521, 30950, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31550, 30950, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31578, 30950, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {31602, 30950, 0, 0, 0x09,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {31626, 30950, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {31649, 30950, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {31673, 30950, 0, 0, 0x09,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {31697, 31715, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31752, 31715, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31770, 31715, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31786, 31715, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31802, 30950, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21187, 30950, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21212, 30950, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21909, 30950, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21937, 30950, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21965, 30950, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21993, 30950, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31820, 31715, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31835, 31715, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31850, 31715, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31865, 31715, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31880, 31715, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31895, 31715, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31910, 31715, 0, 0, 0x26,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {31922, 31715, 0, 0, 0x26,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {31934, 31715, 0, 0, 0x26,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {31946, 31715, 0, 0, 0x26,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {31959, 31985, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31990, 31985, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32019, 31985, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32041, 31985, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32058, 31985, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32075, 31985, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32092, 31985, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32112, 31985, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32136, 31985, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32156, 31985, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {32177, 31985, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32192, 31985, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32207, 31985, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32227, 31985, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32247, 31985, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32271, 31985, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32287, 31985, 0, 0, 0x14,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32305, 31985, 0, 0, 0x14,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {32322, 31985, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32335, 31985, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32348, 31985, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32361, 31985, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32374, 31985, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32389, 31985, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32410, 31985, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32429, 31985, 0, 0, 0x15,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {32449, 31985, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32465, 31985, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32482, 31985, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32500, 31985, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32517, 31985, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32536, 31985, 0, 0, 0x17,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32555, 31985, 0, 0, 0x17,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32573, 31985, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32592, 31985, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32612, 31985, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32633, 31985, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32654, 31985, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32674, 31985, 0, 0, 0x16,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32693, 31985, 0, 0, 0x16,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32716, 31985, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32731, 31985, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32754, 31985, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32773, 31985, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32794, 31985, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32817, 31985, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32836, 31985, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32857, 31985, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32880, 31985, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32899, 31985, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32920, 31985, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32947, 31985, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32974, 31985, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {32995, 31985, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {33016, 31985, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {33038, 33054, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {33059, 33086, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33118, 33086, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33145, 33086, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33172, 33086, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33199, 33086, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33226, 33086, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33253, 33086, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33280, 33086, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {33307, 33086, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33334, 33086, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33361, 33086, 0, 0, 0x1F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33389, 33086, 0, 0, 0x1F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33417, 33086, 0, 0, 0x1F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33445, 33086, 0, 0, 0x1F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33473, 33086, 0, 0, 0x1F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33504, 33086, 0, 0, 0x1F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {33535, 33565, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33581, 33565, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33611, 33565, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33644, 33565, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33677, 33707, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33723, 33707, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33753, 33707, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33786, 33707, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33819, 33086, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33845, 33086, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33875, 33086, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33905, 33086, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33935, 33086, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33965, 33086, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33995, 33086, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34025, 33086, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34051, 33086, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34081, 33086, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34111, 33086, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34141, 33086, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34171, 33086, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34201, 33086, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34231, 33086, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34257, 33086, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34287, 33086, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34317, 33086, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34347, 33086, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34377, 33086, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34407, 33086, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34437, 33086, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34463, 33086, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34493, 33086, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34523, 33086, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34553, 33086, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34583, 33086, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34613, 33086, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34643, 33054, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34670, 33054, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34696, 33054, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {34718, 33054, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34746, 33054, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34773, 33054, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {34796, 33054, 0, 0, 0x07,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {34819, 33054, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34846, 33054, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34872, 33054, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {34894, 33054, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34922, 33054, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34949, 33054, 0, 0, 0x08,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {34972, 33054, 0, 0, 0x08,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {34995, 33054, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35022, 33054, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35048, 33054, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35070, 33054, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35098, 33054, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35125, 33054, 0, 0, 0x09,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35148, 33054, 0, 0, 0x09,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35171, 33054, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35193, 33054, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35216, 33054, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35239, 33054, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35260, 33086, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35278, 33086, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35296, 33086, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35314, 33086, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35336, 33086, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35358, 33086, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35380, 33086, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35402, 33086, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35424, 33086, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35446, 33086, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35462, 33086, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35478, 33086, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35494, 33086, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35510, 33086, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35530, 33086, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35550, 33086, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35570, 33086, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35590, 33086, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35610, 33086, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35630, 33565, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35652, 33565, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35674, 33565, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35696, 33565, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35718, 33565, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35740, 33565, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21187, 33086, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21212, 33086, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21237, 33086, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21262, 33086, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21909, 33086, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21937, 33086, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21965, 33086, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21993, 33086, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35762, 33086, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35783, 33086, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35804, 33086, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35825, 33086, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35846, 33086, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35867, 33086, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35888, 33086, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35911, 33086, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35934, 33086, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35957, 33086, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35980, 33086, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36003, 33086, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36026, 33086, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36047, 33086, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36068, 33086, 0, 0, 0x38,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36089, 33086, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36110, 33086, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36131, 33086, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36152, 33086, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36175, 33086, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36198, 33086, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36221, 33086, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36244, 33086, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36267, 33086, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36290, 33086, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36314, 33086, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36338, 33086, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36361, 33086, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36384, 33086, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36407, 33086, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36430, 33086, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36453, 33086, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36476, 36492, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36497, 36492, 0, 0, 0x38,0x00,0x01,0x00,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MASK2_MASK|EVENT_OPTION_MASK3_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH2_MASK|EVENT_OPTION_MATCH3_MASK}
+, {36507, 36492, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36535, 36492, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36563, 36492, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36591, 36492, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36623, 36492, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36648, 36492, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36681, 36492, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36710, 36492, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {36747, 36492, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36763, 36492, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36782, 36492, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36800, 36492, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36819, 36492, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36837, 36492, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36850, 36492, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36863, 36492, 0, 0, 0x1E,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36892, 36492, 0, 0, 0x1E,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36921, 36492, 0, 0, 0x1E,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36950, 36492, 0, 0, 0x1E,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36979, 36492, 0, 0, 0x1E,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37008, 36492, 0, 0, 0x1E,0x20,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37037, 36492, 0, 0, 0x39,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37066, 36492, 0, 0, 0x39,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37095, 36492, 0, 0, 0x39,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37124, 36492, 0, 0, 0x39,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37153, 36492, 0, 0, 0x39,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37182, 36492, 0, 0, 0x39,0x20,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37211, 36492, 0, 0, 0x1D,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37236, 36492, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37250, 36492, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37264, 36492, 0, 0, 0x02,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37281, 36492, 0, 0, 0x02,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37302, 36492, 0, 0, 0x02,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37326, 36492, 0, 0, 0x02,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37343, 36492, 0, 0, 0x02,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37365, 36492, 0, 0, 0x02,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37390, 36492, 0, 0, 0x02,0x18,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37407, 36492, 0, 0, 0x03,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37427, 36492, 0, 0, 0x03,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37447, 36492, 0, 0, 0x03,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37469, 36492, 0, 0, 0x03,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37494, 36492, 0, 0, 0x03,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37511, 36492, 0, 0, 0x03,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37528, 36492, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37546, 36492, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37564, 36492, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37586, 36492, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37604, 36492, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37622, 36492, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37644, 36492, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37661, 36492, 0, 0, 0x00,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37682, 36492, 0, 0, 0x00,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37706, 36492, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37723, 36492, 0, 0, 0x00,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37745, 36492, 0, 0, 0x00,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37770, 36492, 0, 0, 0x00,0x18,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37787, 36492, 0, 0, 0x01,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37807, 36492, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37827, 36492, 0, 0, 0x01,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37849, 36492, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37874, 36492, 0, 0, 0x01,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37891, 36492, 0, 0, 0x01,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37908, 36492, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37920, 36492, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37932, 36492, 0, 0, 0x09,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37952, 36492, 0, 0, 0x09,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37972, 36492, 0, 0, 0x0C,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37992, 36492, 0, 0, 0x0C,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38012, 36492, 0, 0, 0x0A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38032, 36492, 0, 0, 0x0A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38052, 36492, 0, 0, 0x0B,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38072, 36492, 0, 0, 0x0B,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38092, 36492, 0, 0, 0x0E,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38112, 36492, 0, 0, 0x0E,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38132, 36492, 0, 0, 0x0D,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38152, 36492, 0, 0, 0x0D,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38172, 36492, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38186, 36492, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38200, 36492, 0, 0, 0x15,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38222, 36492, 0, 0, 0x15,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38244, 36492, 0, 0, 0x18,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38266, 36492, 0, 0, 0x18,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38288, 36492, 0, 0, 0x16,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38310, 36492, 0, 0, 0x16,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38332, 36492, 0, 0, 0x17,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38354, 36492, 0, 0, 0x17,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38376, 36492, 0, 0, 0x1A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38398, 36492, 0, 0, 0x1A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38420, 36492, 0, 0, 0x19,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38442, 36492, 0, 0, 0x19,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38464, 36492, 0, 0, 0x26,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38495, 36492, 0, 0, 0x26,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38526, 36492, 0, 0, 0x22,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38558, 36492, 0, 0, 0x22,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38590, 36492, 0, 0, 0x28,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38621, 36492, 0, 0, 0x28,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38652, 36492, 0, 0, 0x24,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38684, 36492, 0, 0, 0x24,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38716, 36492, 0, 0, 0x27,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38747, 36492, 0, 0, 0x27,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38778, 36492, 0, 0, 0x23,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38810, 36492, 0, 0, 0x23,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38842, 36492, 0, 0, 0x29,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38869, 36492, 0, 0, 0x25,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38897, 36492, 0, 0, 0x2A,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38928, 36492, 0, 0, 0x2A,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38959, 36492, 0, 0, 0x2A,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38993, 36492, 0, 0, 0x1F,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39025, 36492, 0, 0, 0x1F,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39057, 36492, 0, 0, 0x1F,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39092, 36492, 0, 0, 0x2B,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39123, 36492, 0, 0, 0x2B,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39154, 36492, 0, 0, 0x20,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39186, 36492, 0, 0, 0x20,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39218, 36492, 0, 0, 0x2C,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39249, 36492, 0, 0, 0x2C,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39280, 36492, 0, 0, 0x21,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39312, 36492, 0, 0, 0x21,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39344, 36492, 0, 0, 0x1C,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39363, 36492, 0, 0, 0x1B,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39391, 39400, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39420, 39432, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39452, 39463, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable haswellEP_arch_events = {
+    NUM_ARCH_EVENTS_HASWELLEP,
+    haswellEP_arch_event_strings,
+    haswellEP_arch_event_options,
+    haswellEP_arch_event_entries
+};
@@ -0,0 +1,1080 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_HASWELL 502
+
+static const char haswell_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_ANY\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_LARGE\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_4K\0"
+    "DTLB_LOAD_MISSES_STLB_HIT_2M\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_CACHE_MISS\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_6_UOPS_EXEC\0"
+    "ARITH_DIVIDER_CYCLES\0"
+    "ARITH_DIVIDER_UOPS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_L2_PF_HIT\0"
+    "L2_RQSTS_L2_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DEMAND_RQST_WB_HIT\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC2\0"
+    "L1D_PEND_MISS_PENDING_CYCLES_ANY\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_FB_FULL_REQUEST\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_LARGE\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT_4K\0"
+    "DTLB_STORE_MISSES_STLB_HIT_2M\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_PDE_CACHE_MISS\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "CPL_CYCLES_RING0_TRANS\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD_C6\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_COUNT\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HIT\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_LARGE\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT_4K\0"
+    "ITLB_MISSES_STLB_HIT_2M\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_CONDITIONAL\0"
+    "BR_INST_EXEC_ALL_DIRECT_JMP\0"
+    "BR_INST_EXEC_ALL_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_INST_EXEC_ALL_INDIRECT_NEAR_RETURN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_CONDITIONAL\0"
+    "BR_MISP_EXEC_ALL_INDIRECT_JUMP_NON_CALL_RET\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_EXECUTED_PORT_PORT_0\0"
+    "UOPS_EXECUTED_PORT_PORT_1\0"
+    "UOPS_EXECUTED_PORT_PORT_2\0"
+    "UOPS_EXECUTED_PORT_PORT_3\0"
+    "UOPS_EXECUTED_PORT_PORT_4\0"
+    "UOPS_EXECUTED_PORT_PORT_5\0"
+    "UOPS_EXECUTED_PORT_PORT_6\0"
+    "UOPS_EXECUTED_PORT_PORT_7\0"
+    "UOPS_EXECUTED_PORT_PORT_0_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_1_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_2_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_3_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_4_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_5_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_6_CORE\0"
+    "UOPS_EXECUTED_PORT_PORT_7_CORE\0"
+    "UOPS_EXECUTED_PORT_ARITH_PORTS\0"
+    "UOPS_EXECUTED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_EXECUTED_PORT_DATA_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "PAGE_WALKER_LOADS_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_DTLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_ITLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L1\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L1\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L2\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L2\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_L3\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_L3\0"
+    "PAGE_WALKER_LOADS_EPT_DTLB_MEMORY\0"
+    "PAGE_WALKER_LOADS_EPT_ITLB_MEMORY\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "PMC1\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "OTHER_ASSISTS_ANY_WB_ASSIST\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "AVX_INSTS_LOADS\0"
+    "AVX_INSTS_STORES\0"
+    "AVX_INSTS_CALC\0"
+    "AVX_INSTS_ALL\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MISC1\0"
+    "HLE_RETIRED_ABORTED_MISC2\0"
+    "HLE_RETIRED_ABORTED_MISC3\0"
+    "HLE_RETIRED_ABORTED_MISC4\0"
+    "HLE_RETIRED_ABORTED_MISC5\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MISC1\0"
+    "RTM_RETIRED_ABORTED_MISC2\0"
+    "RTM_RETIRED_ABORTED_MISC3\0"
+    "RTM_RETIRED_ABORTED_MISC4\0"
+    "RTM_RETIRED_ABORTED_MISC5\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_ALL\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL_ALL\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CACHE_LOOKUP_M\0"
+    "CBOX\0"
+    "CACHE_LOOKUP_E\0"
+    "CACHE_LOOKUP_S\0"
+    "CACHE_LOOKUP_I\0"
+    "CACHE_LOOKUP_READ_FILTER\0"
+    "CACHE_LOOKUP_WRITE_FILTER\0"
+    "CACHE_LOOKUP_EXTSNP_FILTER\0"
+    "CACHE_LOOKUP_ANY_REQUEST_FILTER\0"
+    "CACHE_LOOKUP_READ_M\0"
+    "CACHE_LOOKUP_WRITE_M\0"
+    "CACHE_LOOKUP_EXTSNP_M\0"
+    "CACHE_LOOKUP_ANY_M\0"
+    "CACHE_LOOKUP_READ_E\0"
+    "CACHE_LOOKUP_WRITE_E\0"
+    "CACHE_LOOKUP_EXTSNP_E\0"
+    "CACHE_LOOKUP_ANY_E\0"
+    "CACHE_LOOKUP_READ_S\0"
+    "CACHE_LOOKUP_WRITE_S\0"
+    "CACHE_LOOKUP_EXTSNP_S\0"
+    "CACHE_LOOKUP_ANY_S\0"
+    "CACHE_LOOKUP_READ_ES\0"
+    "CACHE_LOOKUP_WRITE_ES\0"
+    "CACHE_LOOKUP_EXTSNP_ES\0"
+    "CACHE_LOOKUP_ANY_ES\0"
+    "CACHE_LOOKUP_READ_I\0"
+    "CACHE_LOOKUP_WRITE_I\0"
+    "CACHE_LOOKUP_EXTSNP_I\0"
+    "CACHE_LOOKUP_ANY_I\0"
+    "CACHE_LOOKUP_READ_MESI\0"
+    "CACHE_LOOKUP_WRITE_MESI\0"
+    "CACHE_LOOKUP_EXTSNP_MESI\0"
+    "CACHE_LOOKUP_ANY_MESI\0"
+    "XSNP_RESPONSE_MISS_EXTERNAL\0"
+    "XSNP_RESPONSE_MISS_XCORE\0"
+    "XSNP_RESPONSE_MISS_EVICTION\0"
+    "XSNP_RESPONSE_HIT_EXTERNAL\0"
+    "XSNP_RESPONSE_HIT_XCORE\0"
+    "XSNP_RESPONSE_HIT_EVICTION\0"
+    "XSNP_RESPONSE_HITM_EXTERNAL\0"
+    "XSNP_RESPONSE_HITM_XCORE\0"
+    "XSNP_RESPONSE_HITM_EVICTION\0"
+    "TRK_OCCUPANCY_ALL\0"
+    "UBOX0\0"
+    "TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_WRITES\0"
+    "COH_TRK_OCCUPANCY\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0"
+    "PP0_TEMP\0"
+    "MBOX0TMP0\0"
+    "PP1_TEMP\0"
+    "MBOX0TMP1\0";
+
+static const PerfmonEventOption haswell_arch_event_options[] = {
+ {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x7}
+};
+
+static const PerfmonEventEntry haswell_arch_event_entries[NUM_ARCH_EVENTS_HASWELL] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 160, 0, 1, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {187, 208, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {214, 238, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {242, 238, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {258, 238, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {281, 238, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 238, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {326, 238, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {358, 238, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {389, 238, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {424, 238, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 238, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {494, 238, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {525, 238, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {554, 238, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {583, 238, 0, 0, 0x08,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {609, 238, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {641, 238, 1, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {666, 238, 2, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {690, 238, 4, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {719, 238, 6, 3, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {747, 238, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {763, 238, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {787, 238, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {808, 238, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {831, 238, 1, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {855, 238, 9, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {880, 238, 11, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {905, 238, 4, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {934, 238, 13, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {964, 238, 16, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {994, 238, 1, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1028, 238, 19, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1062, 238, 20, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1096, 238, 21, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1130, 238, 22, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1164, 238, 23, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1198, 238, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1219, 238, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1238, 238, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1271, 238, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1303, 238, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1331, 238, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {1348, 238, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1366, 238, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1383, 238, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {1404, 238, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1426, 238, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1451, 238, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 238, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1503, 238, 0, 0, 0x24,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1522, 238, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1542, 238, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {1558, 238, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1572, 238, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1592, 238, 0, 0, 0x27,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1614, 238, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1642, 238, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1665, 238, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1693, 238, 0, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1725, 238, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1753, 238, 0, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1785, 238, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1822, 238, 24, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1854, 1876, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1881, 1876, 26, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1914, 1876, 1, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1943, 238, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1965, 238, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1995, 238, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2027, 238, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2063, 238, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2102, 238, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2135, 238, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2167, 238, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2197, 238, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2227, 238, 0, 0, 0x49,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2254, 238, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2287, 238, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 238, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2325, 238, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2341, 238, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2357, 238, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2376, 238, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2388, 238, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 238, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2432, 238, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2460, 238, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2498, 238, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 238, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2581, 238, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2635, 238, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2666, 238, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2702, 238, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2739, 238, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2771, 238, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2804, 238, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2821, 238, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2840, 238, 28, 2, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2863, 238, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2877, 238, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2891, 238, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2905, 238, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2919, 238, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2933, 238, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2956, 238, 30, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {2976, 238, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3020, 238, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3064, 238, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3104, 238, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3145, 238, 1, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3201, 238, 1, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3250, 238, 23, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3297, 238, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3337, 238, 33, 1, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3374, 238, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3406, 238, 33, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3435, 238, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3445, 238, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3459, 238, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3472, 238, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3488, 238, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3505, 238, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3517, 238, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {3534, 238, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {3552, 238, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {3565, 238, 1, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3581, 238, 1, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3604, 238, 19, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3627, 238, 20, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3650, 238, 21, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3673, 238, 1, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3688, 238, 1, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3710, 238, 19, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3732, 238, 20, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3754, 238, 21, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3776, 238, 1, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3794, 238, 1, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3819, 238, 19, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3844, 238, 20, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3869, 238, 21, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3894, 238, 28, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3911, 238, 1, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3930, 238, 1, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3956, 238, 19, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3982, 238, 20, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4008, 238, 21, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4034, 238, 1, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4048, 238, 1, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4069, 238, 19, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4090, 238, 20, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4111, 238, 21, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4132, 238, 28, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4148, 238, 1, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4176, 238, 1, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4202, 238, 19, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4228, 238, 20, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4254, 238, 21, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4280, 238, 1, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4309, 238, 1, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4336, 238, 19, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4363, 238, 20, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4390, 238, 21, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4417, 238, 1, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4441, 238, 1, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4463, 238, 19, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4485, 238, 20, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4507, 238, 21, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4529, 238, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4540, 238, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4554, 238, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4570, 238, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4590, 238, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4616, 238, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4646, 238, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4679, 238, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4706, 238, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4732, 238, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4756, 238, 0, 0, 0x85,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4780, 238, 0, 0, 0x85,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4801, 238, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4815, 238, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4833, 238, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4857, 238, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4885, 238, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {4915, 238, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4949, 238, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4994, 238, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5043, 238, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {5074, 238, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {5109, 238, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {5145, 238, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {5185, 238, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {5223, 238, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {5265, 238, 0, 0, 0x88,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {5294, 238, 0, 0, 0x88,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {5322, 238, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5356, 238, 0, 0, 0x88,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {5400, 238, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5438, 238, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5464, 238, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {5488, 238, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5516, 238, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {5561, 238, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5610, 238, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {5641, 238, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {5676, 238, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {5712, 238, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {5752, 238, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {5790, 238, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {5832, 238, 0, 0, 0x89,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {5861, 238, 0, 0, 0x89,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {5905, 238, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5931, 238, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5959, 238, 21, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6007, 238, 20, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6057, 238, 19, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6107, 238, 1, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6157, 238, 9, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6197, 238, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6223, 238, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6249, 238, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6275, 238, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6301, 238, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6327, 238, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6353, 238, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6379, 238, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6405, 238, 0, 1, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6436, 238, 0, 1, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6467, 238, 0, 1, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6498, 238, 0, 1, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6529, 238, 0, 1, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6560, 238, 0, 1, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6591, 238, 0, 1, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6622, 238, 0, 1, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6653, 238, 0, 0, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK}
+, {6684, 238, 0, 1, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6720, 238, 0, 1, 0xA1,0x9C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6750, 238, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6770, 238, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6789, 238, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6808, 238, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6828, 238, 1, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6861, 238, 19, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6891, 238, 19, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6925, 238, 21, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6958, 238, 21, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6986, 238, 22, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7019, 238, 23, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7049, 238, 23, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7083, 1876, 34, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7117, 1876, 35, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7151, 238, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7160, 238, 1, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7178, 238, 19, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7196, 238, 20, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7214, 238, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7232, 238, 1, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7255, 238, 9, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7280, 238, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7304, 238, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7337, 238, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7353, 238, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7385, 238, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7417, 238, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7445, 238, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7474, 238, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7495, 238, 1, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7521, 238, 9, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7548, 238, 11, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7575, 238, 1, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7611, 238, 19, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7647, 238, 20, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7683, 238, 21, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7719, 238, 22, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7755, 238, 23, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7791, 238, 36, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7827, 238, 34, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7863, 238, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7882, 238, 1, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7913, 238, 9, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7945, 238, 11, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7977, 238, 1, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8018, 238, 19, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8059, 238, 20, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8100, 238, 21, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8141, 238, 22, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8182, 238, 23, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8223, 238, 36, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8264, 238, 34, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8305, 238, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8337, 238, 0, 0, 0xBC,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {8363, 238, 0, 0, 0xBC,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8389, 238, 0, 0, 0xBC,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8415, 238, 0, 0, 0xBC,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8441, 238, 0, 0, 0xBC,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {8467, 238, 0, 0, 0xBC,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8493, 238, 0, 0, 0xBC,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {8523, 238, 0, 0, 0xBC,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {8553, 238, 0, 0, 0xBC,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8583, 238, 0, 0, 0xBC,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8613, 238, 0, 0, 0xBC,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8643, 238, 0, 0, 0xBC,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8673, 238, 0, 0, 0xBC,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {8703, 238, 0, 0, 0xBC,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {8733, 238, 0, 0, 0xBC,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {8767, 238, 0, 0, 0xBC,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {8801, 238, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8823, 238, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8842, 238, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8861, 8884, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8889, 238, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8914, 238, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8939, 238, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8967, 238, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8984, 238, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9006, 238, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9032, 238, 0, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9063, 238, 1, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9088, 238, 9, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9114, 238, 11, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {9140, 238, 4, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9170, 238, 13, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9201, 238, 16, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {9232, 238, 1, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9267, 238, 19, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9302, 238, 20, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9337, 238, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9372, 238, 22, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9407, 238, 23, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9442, 238, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9464, 238, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9485, 238, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9516, 238, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9535, 238, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9558, 238, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9587, 238, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9615, 238, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9641, 238, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9669, 238, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9695, 238, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9722, 238, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9749, 238, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9778, 238, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9806, 238, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9837, 238, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9864, 238, 0, 0, 0xC6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9880, 238, 0, 0, 0xC6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9897, 238, 0, 0, 0xC6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9912, 238, 0, 0, 0xC6,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9926, 238, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9944, 238, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9963, 238, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9983, 238, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10009, 238, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10035, 238, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10061, 238, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10087, 238, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10113, 238, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10131, 238, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10150, 238, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10170, 238, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10196, 238, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10222, 238, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10248, 238, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10274, 238, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10300, 238, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10321, 238, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10341, 238, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10363, 238, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10384, 238, 1, 1, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10398, 238, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10425, 238, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10448, 238, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10472, 238, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {10493, 238, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10526, 238, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10560, 238, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10588, 238, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10617, 238, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10646, 238, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10676, 238, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10705, 238, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10735, 238, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {10764, 238, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10793, 238, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10823, 238, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10852, 238, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10881, 238, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10911, 238, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10940, 238, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10970, 238, 0, 0, 0xD1,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {11001, 238, 0, 0, 0xD1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11031, 238, 0, 0, 0xD1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {11061, 238, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11100, 238, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11138, 238, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11177, 238, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11216, 238, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11257, 238, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11270, 238, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11294, 238, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11307, 238, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11324, 238, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11340, 238, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11356, 238, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11373, 238, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11388, 238, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11410, 238, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11424, 238, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11438, 238, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11452, 238, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11468, 238, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {11494, 238, 0, 0, 0xF2,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {11520, 238, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11547, 238, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {11583, 238, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {11615, 238, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {11651, 238, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {11677, 238, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {11714, 238, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {11747, 238, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {11784, 238, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {11821, 238, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {11854, 238, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {11891, 238, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {11933, 238, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {11973, 238, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {12002, 238, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {12029, 238, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {12065, 238, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {12097, 238, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {12133, 238, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {12159, 238, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {12196, 238, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {12229, 238, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {12266, 238, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {12303, 238, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {12336, 238, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {12373, 238, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {12415, 238, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {12455, 238, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {12484, 12499, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12504, 12499, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12519, 12499, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12534, 12499, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12549, 12499, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12574, 12499, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12600, 12499, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12627, 12499, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12659, 12499, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12679, 12499, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12700, 12499, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12722, 12499, 0, 0, 0x34,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12741, 12499, 0, 0, 0x34,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {12761, 12499, 0, 0, 0x34,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12782, 12499, 0, 0, 0x34,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {12804, 12499, 0, 0, 0x34,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {12823, 12499, 0, 0, 0x34,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {12843, 12499, 0, 0, 0x34,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12864, 12499, 0, 0, 0x34,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12886, 12499, 0, 0, 0x34,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12905, 12499, 0, 0, 0x34,0x16,0,0,EVENT_OPTION_NONE_MASK}
+, {12926, 12499, 0, 0, 0x34,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {12948, 12499, 0, 0, 0x34,0x46,0,0,EVENT_OPTION_NONE_MASK}
+, {12971, 12499, 0, 0, 0x34,0x86,0,0,EVENT_OPTION_NONE_MASK}
+, {12991, 12499, 0, 0, 0x34,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {13011, 12499, 0, 0, 0x34,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13032, 12499, 0, 0, 0x34,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {13054, 12499, 0, 0, 0x34,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13073, 12499, 0, 0, 0x34,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {13096, 12499, 0, 0, 0x34,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {13120, 12499, 0, 0, 0x34,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {13145, 12499, 0, 0, 0x34,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {13167, 12499, 0, 0, 0x22,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13195, 12499, 0, 0, 0x22,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {13220, 12499, 0, 0, 0x22,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13248, 12499, 0, 0, 0x22,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13275, 12499, 0, 0, 0x22,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13299, 12499, 0, 0, 0x22,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {13326, 12499, 0, 0, 0x22,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13354, 12499, 0, 0, 0x22,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {13379, 12499, 0, 0, 0x22,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13407, 13425, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13431, 13448, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13453, 13448, 0, 0, 0x81,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13473, 13425, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13491, 13448, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13512, 13525, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13533, 13545, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13553, 13564, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13572, 13584, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13592, 13601, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13611, 13620, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable haswell_arch_events = {
+    NUM_ARCH_EVENTS_HASWELL,
+    haswell_arch_event_strings,
+    haswell_arch_event_options,
+    haswell_arch_event_entries
+};
@@ -0,0 +1,6326 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ICELAKEX 3033
+
+static const char icelakeX_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "TOPDOWN_SLOTS\0"
+    "FIXC3\0"
+    "RETIRING\0"
+    "TMA0\0"
+    "BAD_SPECULATION\0"
+    "TMA1\0"
+    "FRONTEND_BOUND\0"
+    "TMA2\0"
+    "BACKEND_BOUND\0"
+    "TMA3\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_ALL_RECOVERY_CYCLES\0"
+    "INT_MISC_UOP_DROPPING\0"
+    "INT_MISC_CLEAR_RESTEER_CYCLES\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_VECTOR_WIDTH_MISMATCH\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_SWPF_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_SWPF_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "CORE_POWER_LVL0_TURBO_LICENSE\0"
+    "CORE_POWER_LVL1_TURBO_LICENSE\0"
+    "CORE_POWER_LVL2_TURBO_LICENSE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "SW_PREFETCH_ACCESS_NTA\0"
+    "SW_PREFETCH_ACCESS_T0\0"
+    "SW_PREFETCH_ACCESS_T1_T2\0"
+    "SW_PREFETCH_ACCESS_PREFETCHW\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_REF_DISTRIBUTED\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_FB_FULL_PERIODS\0"
+    "L1D_PEND_MISS_L2_STALL\0"
+    "LOAD_HIT_PREFETCH_SWPF\0"
+    "L1D_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_CAPACITY_READ\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_FULL\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_L3_MISS_DEMAND_DATA_RD\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_MITE_CYCLES_OK\0"
+    "IDQ_MITE_CYCLES_ANY\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_DSB_CYCLES_OK\0"
+    "IDQ_DSB_CYCLES_ANY\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_MS_CYCLES_ANY\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_ALL\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4_9\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7_8\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_SCOREBOARD\0"
+    "RESOURCE_STALLS_SB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "TOPDOWN_SLOTS_P\0"
+    "TOPDOWN_BACKEND_BOUND_SLOTS\0"
+    "TOPDOWN_BR_MISPREDICT_SLOTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB2MITE_SWITCHES_PENALTY_COUNT\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_X87\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_STALL_CYCLES\0"
+    "INST_RETIRED_NOP\0"
+    "ASSISTS_FP\0"
+    "ASSISTS_ANY\0"
+    "UOPS_RETIRED_SLOTS\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_COND_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_COND_NTAKEN\0"
+    "BR_INST_RETIRED_COND\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_INST_RETIRED_INDIRECT\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_COND_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT_CALL\0"
+    "BR_MISP_RETIRED_COND_NTAKEN\0"
+    "BR_MISP_RETIRED_COND\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_SINGLE\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MEM\0"
+    "HLE_RETIRED_ABORTED_UNFRIENDLY\0"
+    "HLE_RETIRED_ABORTED_EVENTS\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MISC_RETIRED_LBR_INSERTS\0"
+    "MISC_RETIRED_PAUSE_INST\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_LOCAL_PMM\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NO_FWD\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_FWD\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_FWD\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_PMM\0"
+    "BACLEARS_ANY\0"
+    "CPU_CLOCK_UNHALTED_DISTRIBUTED\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "L2_LINES_OUT_USELESS_HWPF\0"
+    "SQ_MISC\0"
+    "IDI_MISC_WB_UPGRADE\0"
+    "IDI_MISC_WB_DOWNGRADE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "DIR_LOOKUP_SNP\0"
+    "DIR_LOOKUP_NO_SNP\0"
+    "DIR_UPDATE_HA\0"
+    "DIR_UPDATE_TOR\0"
+    "HITME_HIT_EX_RDS\0"
+    "HITME_HIT_SHARED_OWNREQ\0"
+    "HITME_HIT_WBMTOE\0"
+    "HITME_HIT_WBMTOI_OR_S\0"
+    "HITME_LOOKUP_READ\0"
+    "HITME_LOOKUP_WRITE\0"
+    "HITME_MISS_SHARED_RDINVOWN\0"
+    "HITME_MISS_NOTSHARED_RDINVOWN\0"
+    "HITME_MISS_READ_OR_INV\0"
+    "HITME_UPDATE_DEALLOCATE_RSPFWDI_LOC\0"
+    "HITME_UPDATE_RSPFWDI_REM\0"
+    "HITME_UPDATE_SHARED\0"
+    "HITME_UPDATE_RDINVOWN\0"
+    "HITME_UPDATE_DEALLOCATE\0"
+    "LLC_VICTIMS_M_STATE\0"
+    "LLC_VICTIMS_E_STATE\0"
+    "LLC_VICTIMS_S_STATE\0"
+    "LLC_VICTIMS_F_STATE\0"
+    "LLC_VICTIMS_ALL\0"
+    "LLC_VICTIMS_LOCAL_ALL\0"
+    "LLC_VICTIMS_REMOTE_ALL\0"
+    "LLC_VICTIMS_LOCAL_M\0"
+    "LLC_VICTIMS_LOCAL_E\0"
+    "LLC_VICTIMS_LOCAL_S\0"
+    "LLC_VICTIMS_LOCAL_F\0"
+    "LLC_VICTIMS_REMOTE_M\0"
+    "LLC_VICTIMS_REMOTE_E\0"
+    "LLC_VICTIMS_REMOTE_S\0"
+    "LLC_VICTIMS_REMOTE_F\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE\0"
+    "COUNTER0_OCCUPANCY\0"
+    "CBOX0C1|CBOX1C1|CBOX2C1|CBOX3C1|CBOX4C1|CBOX5C1|CBOX6C1|CBOX7C1|CBOX8C1|CBOX9C1|CBOX10C1|CBOX11C1|CBOX12C1|CBOX13C1|CBOX14C1|CBOX15C1|CBOX16C1|CBOX17C1|CBOX18C1|CBOX19C1|CBOX20C1|CBOX21C1|CBOX22C1|CBOX23C1|CBOX24C1|CBOX25C1|CBOX26C1|CBOX27C1|CBOX28C1|CBOX29C1|CBOX30C1|CBOX31C1|CBOX32C1|CBOX33C1|CBOX34C1|CBOX35C1|CBOX36C1|CBOX37C1|CBOX38C1|CBOX39C1|CBOX0C2|CBOX1C2|CBOX2C2|CBOX3C2|CBOX4C2|CBOX5C2|CBOX6C2|CBOX7C2|CBOX8C2|CBOX9C2|CBOX10C2|CBOX11C2|CBOX12C2|CBOX13C2|CBOX14C2|CBOX15C2|CBOX16C2|CBOX17C2|CBOX18C2|CBOX19C2|CBOX20C2|CBOX21C2|CBOX22C2|CBOX23C2|CBOX24C2|CBOX25C2|CBOX26C2|CBOX27C2|CBOX28C2|CBOX29C2|CBOX30C2|CBOX31C2|CBOX32C2|CBOX33C2|CBOX34C2|CBOX35C2|CBOX36C2|CBOX37C2|CBOX38C2|CBOX39C2|CBOX0C3|CBOX1C3|CBOX2C3|CBOX3C3|CBOX4C3|CBOX5C3|CBOX6C3|CBOX7C3|CBOX8C3|CBOX9C3|CBOX10C3|CBOX11C3|CBOX12C3|CBOX13C3|CBOX14C3|CBOX15C3|CBOX16C3|CBOX17C3|CBOX18C3|CBOX19C3|CBOX20C3|CBOX21C3|CBOX22C3|CBOX23C3|CBOX24C3|CBOX25C3|CBOX26C3|CBOX27C3|CBOX28C3|CBOX29C3|CBOX30C3|CBOX31C3|CBOX32C3|CBOX33C3|CBOX34C3|CBOX35C3|CBOX36C3|CBOX37C3|CBOX38C3|CBOX39C3\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_CV0_PREF_VIC\0"
+    "MISC_CV0_PREF_MISS\0"
+    "MISC_DRNG_HIT\0"
+    "MISC_DRNG_MISS\0"
+    "MISC2_GOTRK_INSERT\0"
+    "MISC2_GOTRCK_IN\0"
+    "MISC2_RMW_LATE_SF_INSERT\0"
+    "MISC2_RMW_SF_LATE_CV\0"
+    "MISC2_RMW_LLC_LATE_CV\0"
+    "MISC2_GT_ONE_AKC_CRD\0"
+    "SNOOP_RESP_RSPI\0"
+    "SNOOP_RESP_RSPS\0"
+    "SNOOP_RESP_RSPIFWD\0"
+    "SNOOP_RESP_RSPSFWD\0"
+    "PMM_MEMMODE_NM_INVITOX_LOCAL\0"
+    "PMM_MEMMODE_NM_INVITOX_REMOTE\0"
+    "PMM_MEMMODE_NM_INVITOX_SETCONFLICT\0"
+    "PMM_MEMMODE_NM_SETCONFLICTS_SF\0"
+    "PMM_MEMMODE_NM_SETCONFLICTS_LLC\0"
+    "PMM_MEMMODE_NM_SETCONFLICTS_TOR\0"
+    "PMM_MEMMODE_NM_SETCONFLICTS2_MEMWR\0"
+    "PMM_MEMMODE_NM_SETCONFLICTS2_MEMWRNI\0"
+    "BYPASS_CHA_IMC_TAKEN\0"
+    "BYPASS_CHA_IMC_INTERMEDIATE\0"
+    "BYPASS_CHA_IMC_NOT_TAKEN\0"
+    "CORE_SNP_REMOTE_ONE\0"
+    "CORE_SNP_EXT_ONE\0"
+    "CORE_SNP_CORE_ONE\0"
+    "CORE_SNP_EVICT_ONE\0"
+    "CORE_SNP_ANY_ONE\0"
+    "CORE_SNP_REMOTE_GTONE\0"
+    "CORE_SNP_EXT_GTONE\0"
+    "CORE_SNP_CORE_GTONE\0"
+    "CORE_SNP_EVICT_GTONE\0"
+    "CORE_SNP_ANY_GTONE\0"
+    "DIRECT_GO_HA_TOR_DEALLOC\0"
+    "DIRECT_GO_HA_SUPPRESS_NO_D2C\0"
+    "DIRECT_GO_HA_SUPPRESS_DRD\0"
+    "DIRECT_GO_OPC_EXTCMP\0"
+    "DIRECT_GO_OPC_PULL\0"
+    "DIRECT_GO_OPC_GO\0"
+    "DIRECT_GO_OPC_GO_PULL\0"
+    "DIRECT_GO_OPC_FAST_GO\0"
+    "DIRECT_GO_OPC_FAST_GO_PULL\0"
+    "DIRECT_GO_OPC_NOP\0"
+    "DIRECT_GO_OPC_IDLE_DUE_SUPPRESS\0"
+    "IMC_READS_COUNT_PRIORITY\0"
+    "IMC_WRITES_COUNT_PARTIAL\0"
+    "IMC_WRITES_COUNT_FULL_PRIORITY\0"
+    "IMC_WRITES_COUNT_PARTIAL_PRIORITY\0"
+    "LLC_REPAIR_BITCAM\0"
+    "LLC_REPAIR_COLCAM\0"
+    "LLC_REPAIR_ROWCAM\0"
+    "OSB_LOCAL_INVITOE\0"
+    "OSB_LOCAL_READ\0"
+    "OSB_REMOTE_READ\0"
+    "OSB_REMOTE_READINVITOE\0"
+    "OSB_RFO_HITS_SNP_BCAST\0"
+    "OSB_OFF_PWRHEURISTIC\0"
+    "READ_NO_CREDITS_MC0\0"
+    "READ_NO_CREDITS_MC1\0"
+    "READ_NO_CREDITS_MC2\0"
+    "READ_NO_CREDITS_MC3\0"
+    "READ_NO_CREDITS_MC4\0"
+    "READ_NO_CREDITS_MC5\0"
+    "READ_NO_CREDITS_MC6\0"
+    "READ_NO_CREDITS_MC7\0"
+    "READ_NO_CREDITS_MC8\0"
+    "READ_NO_CREDITS_MC9\0"
+    "READ_NO_CREDITS_MC10\0"
+    "READ_NO_CREDITS_MC11\0"
+    "READ_NO_CREDITS_MC12\0"
+    "READ_NO_CREDITS_MC13\0"
+    "READ_NO_CREDITS_ANY\0"
+    "WRITE_NO_CREDITS_MC0\0"
+    "WRITE_NO_CREDITS_MC1\0"
+    "WRITE_NO_CREDITS_MC2\0"
+    "WRITE_NO_CREDITS_MC3\0"
+    "WRITE_NO_CREDITS_MC4\0"
+    "WRITE_NO_CREDITS_MC5\0"
+    "WRITE_NO_CREDITS_MC6\0"
+    "WRITE_NO_CREDITS_MC7\0"
+    "WRITE_NO_CREDITS_MC8\0"
+    "WRITE_NO_CREDITS_MC9\0"
+    "WRITE_NO_CREDITS_MC10\0"
+    "WRITE_NO_CREDITS_MC11\0"
+    "WRITE_NO_CREDITS_MC12\0"
+    "WRITE_NO_CREDITS_MC13\0"
+    "WRITE_NO_CREDITS_ANY\0"
+    "RXC_INSERTS_IRQ\0"
+    "RXC_INSERTS_IRQ_REJ\0"
+    "RXC_INSERTS_IPQ\0"
+    "RXC_INSERTS_PRQ\0"
+    "RXC_INSERTS_PRQ_REJ\0"
+    "RXC_INSERTS_RRQ\0"
+    "RXC_INSERTS_WBQ\0"
+    "RXC_IPQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IPQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IPQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IPQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IPQ1_REJECT_ANY0\0"
+    "RXC_IPQ1_REJECT_HA\0"
+    "RXC_IPQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IPQ1_REJECT_SF_VICTIM\0"
+    "RXC_IPQ1_REJECT_VICTIM\0"
+    "RXC_IPQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IPQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IPQ1_REJECT_PA_MATCH\0"
+    "RXC_IRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IRQ1_REJECT_ANY0\0"
+    "RXC_IRQ1_REJECT_HA\0"
+    "RXC_IRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IRQ1_REJECT_SF_VICTIM\0"
+    "RXC_IRQ1_REJECT_VICTIM\0"
+    "RXC_IRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IRQ1_REJECT_PA_MATCH\0"
+    "RXC_ISMQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_ISMQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_WB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_ISMQ0_REJECT_AK_NON_UPI\0"
+    "RXC_ISMQ0_REJECT_IV_NON_UPI\0"
+    "RXC_ISMQ1_REJECT_ANY0\0"
+    "RXC_ISMQ1_REJECT_HA\0"
+    "RXC_ISMQ0_RETRY_AD_REQ_VN0\0"
+    "RXC_ISMQ0_RETRY_AD_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_WB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCS_VN0\0"
+    "RXC_ISMQ0_RETRY_AK_NON_UPI\0"
+    "RXC_ISMQ0_RETRY_IV_NON_UPI\0"
+    "RXC_ISMQ1_RETRY_ANY0\0"
+    "RXC_ISMQ1_RETRY_HA\0"
+    "RXC_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0|CBOX18C0|CBOX19C0|CBOX20C0|CBOX21C0|CBOX22C0|CBOX23C0|CBOX24C0|CBOX25C0|CBOX26C0|CBOX27C0|CBOX28C0|CBOX29C0|CBOX30C0|CBOX31C0|CBOX32C0|CBOX33C0|CBOX34C0|CBOX35C0|CBOX36C0|CBOX37C0|CBOX38C0|CBOX39C0\0"
+    "RXC_OCCUPANCY_IPQ\0"
+    "RXC_OCCUPANCY_RRQ\0"
+    "RXC_OCCUPANCY_WBQ\0"
+    "RXC_OTHER0_RETRY_AD_REQ_VN0\0"
+    "RXC_OTHER0_RETRY_AD_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_WB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCS_VN0\0"
+    "RXC_OTHER0_RETRY_AK_NON_UPI\0"
+    "RXC_OTHER0_RETRY_IV_NON_UPI\0"
+    "RXC_OTHER1_REJECT_ANY0\0"
+    "RXC_OTHER1_REJECT_HA\0"
+    "RXC_OTHER1_REJECT_LLC_VICTIM\0"
+    "RXC_OTHER1_REJECT_SF_VICTIM\0"
+    "RXC_OTHER1_REJECT_VICTIM\0"
+    "RXC_OTHER1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_OTHER1_REJECT_ALLOW_SNP\0"
+    "RXC_OTHER1_REJECT_PA_MATCH\0"
+    "RXC_PRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_PRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_PRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_PRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_PRQ1_REJECT_ANY0\0"
+    "RXC_PRQ1_REJECT_HA\0"
+    "RXC_PRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_PRQ1_REJECT_SF_VICTIM\0"
+    "RXC_PRQ1_REJECT_VICTIM\0"
+    "RXC_PRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_PRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_PRQ1_REJECT_PA_MATCH\0"
+    "RXC_REQ_Q0_RETRY_AD_REQ_VN0\0"
+    "RXC_REQ_Q0_RETRY_AD_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_WB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCS_VN0\0"
+    "RXC_REQ_Q0_RETRY_AK_NON_UPI\0"
+    "RXC_REQ_Q0_RETRY_IV_NON_UPI\0"
+    "RXC_REQ_Q1_RETRY_ANY0\0"
+    "RXC_REQ_Q1_RETRY_HA\0"
+    "RXC_REQ_Q1_RETRY_LLC_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_SF_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_LLC_OR_SF_WAY\0"
+    "RXC_REQ_Q1_RETRY_ALLOW_SNP\0"
+    "RXC_REQ_Q1_RETRY_PA_MATCH\0"
+    "RXC_RRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_RRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_RRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_RRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_RRQ1_REJECT_ANY0\0"
+    "RXC_RRQ1_REJECT_HA\0"
+    "RXC_RRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_RRQ1_REJECT_SF_VICTIM\0"
+    "RXC_RRQ1_REJECT_VICTIM\0"
+    "RXC_RRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_RRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_RRQ1_REJECT_PA_MATCH\0"
+    "RXC_WBQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_WBQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_WB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_WBQ0_REJECT_AK_NON_UPI\0"
+    "RXC_WBQ0_REJECT_IV_NON_UPI\0"
+    "RXC_WBQ1_REJECT_ANY0\0"
+    "RXC_WBQ1_REJECT_HA\0"
+    "RXC_WBQ1_REJECT_LLC_VICTIM\0"
+    "RXC_WBQ1_REJECT_SF_VICTIM\0"
+    "RXC_WBQ1_REJECT_VICTIM\0"
+    "RXC_WBQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_WBQ1_REJECT_ALLOW_SNP\0"
+    "RXC_WBQ1_REJECT_PA_MATCH\0"
+    "SNOOPS_SENT_ALL\0"
+    "SNOOPS_SENT_LOCAL\0"
+    "SNOOPS_SENT_REMOTE\0"
+    "SNOOPS_SENT_BCST_LOCAL\0"
+    "SNOOPS_SENT_BCST_REMOTE\0"
+    "SNOOPS_SENT_DIRECT_LOCAL\0"
+    "SNOOPS_SENT_DIRECT_REMOTE\0"
+    "SNOOP_RESP_RSP_WB\0"
+    "SNOOP_RESP_RSP_FWD_WB\0"
+    "SNOOP_RESP_RSP_CNFLCTS\0"
+    "SNOOP_RESP_RSP_FWD\0"
+    "SNOOP_RESP_LOCAL_RSPI\0"
+    "SNOOP_RESP_LOCAL_RSPS\0"
+    "SNOOP_RESP_LOCAL_RSPI_FWD\0"
+    "SNOOP_RESP_LOCAL_RSPS_FWD\0"
+    "SNOOP_RESP_LOCAL_RSP_WB\0"
+    "SNOOP_RESP_LOCAL_RSP_FWD_WB\0"
+    "SNOOP_RESP_LOCAL_RSP_CNFLCTS\0"
+    "SNOOP_RESP_LOCAL_RSP_FWD\0"
+    "SNOOP_RSP_MISC_MTOI_RSPIFWDM\0"
+    "SNOOP_RSP_MISC_MTOI_RSPDATAM\0"
+    "SNOOP_RSP_MISC_RSPIFWDMPTL_HITSF\0"
+    "SNOOP_RSP_MISC_RSPIFWDMPTL_HITLLC\0"
+    "SNOOP_RSP_MISC_PULLDATAPTL_HITSF\0"
+    "SNOOP_RSP_MISC_PULLDATAPTL_HITLLC\0"
+    "WB_PUSH_MTOI_LLC\0"
+    "WB_PUSH_MTOI_MEM\0"
+    "XPT_PREF_SENT0\0"
+    "XPT_PREF_DROP0_NOCRD\0"
+    "XPT_PREF_DROP0_CONFLICT\0"
+    "XPT_PREF_SENT1\0"
+    "XPT_PREF_DROP1_NOCRD\0"
+    "XPT_PREF_DROP1_CONFLICT\0"
+    "LLC_LOOKUP_I\0"
+    "LLC_LOOKUP_SF_S\0"
+    "LLC_LOOKUP_SF_E\0"
+    "LLC_LOOKUP_SF_H\0"
+    "LLC_LOOKUP_S\0"
+    "LLC_LOOKUP_E\0"
+    "LLC_LOOKUP_M\0"
+    "LLC_LOOKUP_F\0"
+    "LLC_LOOKUP_ALL\0"
+    "LLC_LOOKUP_ALL_REMOTE\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_DATA_READ_LOCAL\0"
+    "LLC_LOOKUP_DATA_READ_REMOTE\0"
+    "LLC_LOOKUP_CODE_READ\0"
+    "LLC_LOOKUP_CODE_READ_LOCAL\0"
+    "LLC_LOOKUP_CODE_READ_REMOTE\0"
+    "LLC_LOOKUP_RFO\0"
+    "LLC_LOOKUP_RFO_LOCAL\0"
+    "LLC_LOOKUP_RFO_REMOTE\0"
+    "LLC_LOOKUP_FLUSH_INV\0"
+    "LLC_LOOKUP_FLUSH_INV_LOCAL\0"
+    "LLC_LOOKUP_FLUSH_INV_REMOTE\0"
+    "LLC_LOOKUP_LOC_HOM\0"
+    "LLC_LOOKUP_REM_HOM\0"
+    "LLC_LOOKUP_REMOTE_SNP\0"
+    "LLC_LOOKUP_LLC_PF_LOCAL\0"
+    "LLC_LOOKUP_LLCPREF_LOCAL\0"
+    "LLC_LOOKUP_DATA_READ_ALL\0"
+    "LLC_LOOKUP_DATA_READ_MISS\0"
+    "LLC_LOOKUP_WRITE_REMOTE\0"
+    "LLC_LOOKUP_MISS_ALL\0"
+    "LLC_LOOKUP_CODE_READ_MISS\0"
+    "LLC_LOOKUP_RFO_MISS\0"
+    "LLC_LOOKUP_READ\0"
+    "LLC_LOOKUP_READ_MISS\0"
+    "LLC_LOOKUP_READ_MISS_LOC_HOM\0"
+    "LLC_LOOKUP_READ_MISS_REM_HOM\0"
+    "LLC_LOOKUP_READ_LOCAL_LOC_HOM\0"
+    "LLC_LOOKUP_READ_REMOTE_LOC_HOM\0"
+    "LLC_LOOKUP_READ_LOCAL_REM_HOM\0"
+    "LLC_LOOKUP_READ_SF_HIT\0"
+    "LLC_LOOKUP_READ_OR_SNOOP_REMOTE_MISS_REM_HOM\0"
+    "LLC_LOOKUP_WRITES_AND_OTHER\0"
+    "TOR_INSERTS_IRQ_IA\0"
+    "TOR_INSERTS_EVICT\0"
+    "TOR_INSERTS_PRQ_IOSF\0"
+    "TOR_INSERTS_IPQ\0"
+    "TOR_INSERTS_IRQ_NON_IA\0"
+    "TOR_INSERTS_PRQ_NON_IOSF\0"
+    "TOR_INSERTS_RRQ\0"
+    "TOR_INSERTS_WBQ\0"
+    "TOR_INSERTS_ALL\0"
+    "TOR_INSERTS_IO_MISS_RFO\0"
+    "TOR_INSERTS_LOC_IO\0"
+    "TOR_INSERTS_LOC_IA\0"
+    "TOR_INSERTS_LOC_ALL\0"
+    "TOR_INSERTS_IA_HIT_DRD_OPT\0"
+    "TOR_INSERTS_IA_HIT_DRD_OPT_PREF\0"
+    "TOR_INSERTS_IA_MISS_DRD_OPT\0"
+    "TOR_INSERTS_IA_MISS_DRD_OPT_PREF\0"
+    "TOR_INSERTS_IO_HIT_RFO\0"
+    "TOR_INSERTS_IO_RFO\0"
+    "TOR_INSERTS_IA_DRD\0"
+    "TOR_INSERTS_IA_DRD_OPT\0"
+    "TOR_INSERTS_IA_DRD_OPT_PREF\0"
+    "TOR_INSERTS_IA_CRD_PREF\0"
+    "TOR_INSERTS_IA_CLFLUSHOPT\0"
+    "TOR_INSERTS_IA_ITOM\0"
+    "TOR_INSERTS_IO_WBMTOI\0"
+    "TOR_INSERTS_IO_CLFLUSH\0"
+    "TOR_INSERTS_IA_WBMTOI\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_PMM\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_LOCAL_PMM\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_REMOTE_PMM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_DRAM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_LOCAL_DRAM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_REMOTE_DRAM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_DDR\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_LOCAL_DDR\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_REMOTE_DDR\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_PMM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_LOCAL_PMM\0"
+    "TOR_INSERTS_IA_MISS_FULL_STREAMING_WR_REMOTE_PMM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_DDR\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_DDR\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_DDR\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_DRAM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_DRAM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_DRAM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_PMM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_PMM\0"
+    "TOR_INSERTS_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_PMM\0"
+    "TOR_INSERTS_IA_MISS_WCIL\0"
+    "TOR_INSERTS_IA_WCILF\0"
+    "TOR_INSERTS_IA_WCIL\0"
+    "TOR_INSERTS_IA_MISS_WIL\0"
+    "TOR_INSERTS_IA_MISS_CRD_LOCAL\0"
+    "TOR_INSERTS_IA_MISS_CRD_REMOTE\0"
+    "TOR_INSERTS_IA_MISS_CRD_PREF_LOCAL\0"
+    "TOR_INSERTS_IA_MISS_CRD_PREF_REMOTE\0"
+    "TOR_INSERTS_IA_ITOMCACHENEAR\0"
+    "TOR_INSERTS_IA_HIT_ITOM\0"
+    "TOR_INSERTS_IA_MISS_ITOM\0"
+    "TOR_INSERTS_IA_MISS_UCRDF\0"
+    "TOR_INSERTS_IA_LLCPREFCODE\0"
+    "TOR_INSERTS_IA_HIT_LLCPREFCODE\0"
+    "TOR_INSERTS_IA_HIT_LLCPREFDATA\0"
+    "TOR_INSERTS_IA_MISS_LLCPREFCODE\0"
+    "TOR_INSERTS_IA_MISS_WCILF_PMM\0"
+    "TOR_INSERTS_IA_MISS_LOCAL_WCILF_PMM\0"
+    "TOR_INSERTS_IA_MISS_REMOTE_WCILF_PMM\0"
+    "TOR_INSERTS_IA_MISS_WCIL_PMM\0"
+    "TOR_INSERTS_IA_MISS_LOCAL_WCIL_PMM\0"
+    "TOR_INSERTS_IA_MISS_REMOTE_WCIL_PMM\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_DDR\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_LOCAL_DDR\0"
+    "TOR_INSERTS_IA_MISS_DRD_PREF_REMOTE_DDR\0"
+    "TOR_INSERTS_IA_MISS_WCILF_DDR\0"
+    "TOR_INSERTS_IA_MISS_LOCAL_WCILF_DDR\0"
+    "TOR_INSERTS_IA_MISS_REMOTE_WCILF_DDR\0"
+    "TOR_INSERTS_IA_MISS_WCIL_DDR\0"
+    "TOR_INSERTS_IA_MISS_LOCAL_WCIL_DDR\0"
+    "TOR_INSERTS_IA_MISS_REMOTE_WCIL_DDR\0"
+    "TOR_INSERTS_IA_MISS_WCILF\0"
+    "TOR_INSERTS_IA_WBEFTOE\0"
+    "TOR_INSERTS_IA_MISS_SPECITOM\0"
+    "TOR_INSERTS_IA_MISS_DRDPTE\0"
+    "TOR_INSERTS_IA_HIT_DRDPTE\0"
+    "TOR_INSERTS_IA_DRDPTE\0"
+    "TOR_INSERTS_IA_HIT_SPECITOM\0"
+    "TOR_INSERTS_IA_WBSTOI\0"
+    "TOR_INSERTS_IA_WBEFTOI\0"
+    "TOR_INSERTS_IA_WBMTOE\0"
+    "TOR_OCCUPANCY_IRQ_IA\0"
+    "TOR_OCCUPANCY_EVICT\0"
+    "TOR_OCCUPANCY_PRQ\0"
+    "TOR_OCCUPANCY_IPQ\0"
+    "TOR_OCCUPANCY_IRQ_NON_IA\0"
+    "TOR_OCCUPANCY_PRQ_NON_IOSF\0"
+    "TOR_OCCUPANCY_LOC_IO\0"
+    "TOR_OCCUPANCY_LOC_IA\0"
+    "TOR_OCCUPANCY_LOC_ALL\0"
+    "TOR_OCCUPANCY_IA_HIT_CRD\0"
+    "TOR_OCCUPANCY_IA_HIT_DRD\0"
+    "TOR_OCCUPANCY_IA_HIT_LLCPREFRFO\0"
+    "TOR_OCCUPANCY_IA_HIT_RFO\0"
+    "TOR_OCCUPANCY_IA_MISS_LLCPREFRFO\0"
+    "TOR_OCCUPANCY_IO_MISS_RFO\0"
+    "TOR_OCCUPANCY_IO_MISS_ITOM\0"
+    "TOR_OCCUPANCY_IA_HIT_CRD_PREF\0"
+    "TOR_OCCUPANCY_IA_HIT_DRD_PREF\0"
+    "TOR_OCCUPANCY_IA_HIT_DRD_OPT\0"
+    "TOR_OCCUPANCY_IA_HIT_DRD_OPT_PREF\0"
+    "TOR_OCCUPANCY_IA_HIT_RFO_PREF\0"
+    "TOR_OCCUPANCY_IA_MISS_CRD_PREF\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_OPT\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_OPT_PREF\0"
+    "TOR_OCCUPANCY_IA_MISS_RFO_PREF\0"
+    "TOR_OCCUPANCY_IO_HIT_ITOM\0"
+    "TOR_OCCUPANCY_IO_HIT_RFO\0"
+    "TOR_OCCUPANCY_IO_RFO\0"
+    "TOR_OCCUPANCY_IO_ITOM\0"
+    "TOR_OCCUPANCY_IA_RFO_PREF\0"
+    "TOR_OCCUPANCY_IA_LLCPREFRFO\0"
+    "TOR_OCCUPANCY_IA_DRD_OPT\0"
+    "TOR_OCCUPANCY_IA_DRD_OPT_PREF\0"
+    "TOR_OCCUPANCY_IA_CRD_PREF\0"
+    "TOR_OCCUPANCY_IA_DRD_PREF\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_LOCAL\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_REMOTE\0"
+    "TOR_OCCUPANCY_IA_MISS_RFO_LOCAL\0"
+    "TOR_OCCUPANCY_IA_MISS_RFO_REMOTE\0"
+    "TOR_OCCUPANCY_IA_MISS_RFO_PREF_LOCAL\0"
+    "TOR_OCCUPANCY_IA_MISS_RFO_PREF_REMOTE\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_LOCAL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_REMOTE_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_LOCAL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_REMOTE_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_LOCAL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_REMOTE_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_LOCAL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_DRD_PREF_REMOTE_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_LOCAL_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_REMOTE_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_LOCAL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_REMOTE_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_LOCAL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_FULL_STREAMING_WR_REMOTE_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_DRAM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_LOCAL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_PARTIAL_STREAMING_WR_REMOTE_PMM\0"
+    "TOR_OCCUPANCY_IA_HIT_LLCPREFCODE\0"
+    "TOR_OCCUPANCY_IA_HIT_LLCPREFDATA\0"
+    "TOR_OCCUPANCY_IA_MISS_LLCPREFCODE\0"
+    "TOR_OCCUPANCY_IA_MISS_LLCPREFDATA\0"
+    "TOR_OCCUPANCY_IA_MISS_WCILF_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_LOCAL_WCILF_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_REMOTE_WCILF_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_WCILF_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_LOCAL_WCILF_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_REMOTE_WCILF_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_WCIL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_LOCAL_WCIL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_REMOTE_WCIL_DDR\0"
+    "TOR_OCCUPANCY_IA_MISS_WCIL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_LOCAL_WCIL_PMM\0"
+    "TOR_OCCUPANCY_IA_MISS_REMOTE_WCIL_PMM\0"
+    "TOR_OCCUPANCY_IO_HIT_PCIRDCUR\0"
+    "TOR_OCCUPANCY_IA_LLCPREFDATA\0"
+    "TOR_OCCUPANCY_IA_MISS_WCILF\0"
+    "TOR_OCCUPANCY_IA_MISS_WCIL\0"
+    "TOR_OCCUPANCY_IA_MISS_CRD_LOCAL\0"
+    "TOR_OCCUPANCY_IA_MISS_CRD_REMOTE\0"
+    "TOR_OCCUPANCY_IA_MISS_CRD_PREF_LOCAL\0"
+    "TOR_OCCUPANCY_IA_MISS_CRD_PREF_REMOTE\0"
+    "TOR_OCCUPANCY_IA_CLFLUSH\0"
+    "TOR_OCCUPANCY_IA_CLFLUSHOPT\0"
+    "TOR_OCCUPANCY_IA_ITOMCACHENEAR\0"
+    "TOR_OCCUPANCY_IA_SPECITOM\0"
+    "TOR_OCCUPANCY_IA_WBMTOI\0"
+    "TOR_OCCUPANCY_IA_ITOM\0"
+    "TOR_OCCUPANCY_IA_HIT_ITOM\0"
+    "TOR_OCCUPANCY_IA_MISS_ITOM\0"
+    "TOR_OCCUPANCY_IA_MISS_UCRDF\0"
+    "TOR_OCCUPANCY_IA_MISS_WIL\0"
+    "TOR_OCCUPANCY_IA_WCILF\0"
+    "TOR_OCCUPANCY_IA_WCIL\0"
+    "TOR_OCCUPANCY_IA_LLCPREFCODE\0"
+    "TOR_OCCUPANCY_IO_WBMTOI\0"
+    "TOR_OCCUPANCY_IO_CLFLUSH\0"
+    "TOR_OCCUPANCY_IO_ITOMCACHENEAR\0"
+    "TOR_OCCUPANCY_IO_HIT_ITOMCACHENEAR\0"
+    "TOR_OCCUPANCY_IO_MISS_ITOMCACHENEAR\0"
+    "TOR_OCCUPANCY_IA_MISS_SPECITOM\0"
+    "TOR_OCCUPANCY_IA_DRDPTE\0"
+    "TOR_OCCUPANCY_IA_HIT_DRDPTE\0"
+    "TOR_OCCUPANCY_IA_MISS_DRDPTE\0"
+    "CMS_CLOCKTICKS\0"
+    "CBOX|M2M|PBOX|SBOX\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR0\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR1\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR2\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR3\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR4\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR5\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR6\0"
+    "AG0_AD_CRD_ACQUIRED0_TGR7\0"
+    "AG0_AD_CRD_ACQUIRED1_TGR8\0"
+    "AG0_AD_CRD_ACQUIRED1_TGR9\0"
+    "AG0_AD_CRD_ACQUIRED1_TGR10\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR0\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR1\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR2\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR3\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR4\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR5\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR6\0"
+    "AG0_AD_CRD_OCCUPANCY0_TGR7\0"
+    "AG0_AD_CRD_OCCUPANCY1_TGR8\0"
+    "AG0_AD_CRD_OCCUPANCY1_TGR9\0"
+    "AG0_AD_CRD_OCCUPANCY1_TGR10\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR0\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR1\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR2\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR3\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR4\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR5\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR6\0"
+    "AG0_BL_CRD_ACQUIRED0_TGR7\0"
+    "AG0_BL_CRD_ACQUIRED1_TGR8\0"
+    "AG0_BL_CRD_ACQUIRED1_TGR9\0"
+    "AG0_BL_CRD_ACQUIRED1_TGR10\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR0\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR1\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR2\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR3\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR4\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR5\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR6\0"
+    "AG0_BL_CRD_OCCUPANCY0_TGR7\0"
+    "AG0_BL_CRD_OCCUPANCY1_TGR8\0"
+    "AG0_BL_CRD_OCCUPANCY1_TGR9\0"
+    "AG0_BL_CRD_OCCUPANCY1_TGR10\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR0\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR1\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR2\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR3\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR4\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR5\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR6\0"
+    "AG1_AD_CRD_ACQUIRED0_TGR7\0"
+    "AG1_AD_CRD_ACQUIRED1_TGR8\0"
+    "AG1_AD_CRD_ACQUIRED1_TGR9\0"
+    "AG1_AD_CRD_ACQUIRED1_TGR10\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR0\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR1\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR2\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR3\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR4\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR5\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR6\0"
+    "AG1_AD_CRD_OCCUPANCY0_TGR7\0"
+    "AG1_AD_CRD_OCCUPANCY1_TGR8\0"
+    "AG1_AD_CRD_OCCUPANCY1_TGR9\0"
+    "AG1_AD_CRD_OCCUPANCY1_TGR10\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR0\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR1\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR2\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR3\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR4\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR5\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR6\0"
+    "AG1_BL_CRD_ACQUIRED0_TGR7\0"
+    "AG1_BL_CRD_ACQUIRED1_TGR8\0"
+    "AG1_BL_CRD_ACQUIRED1_TGR9\0"
+    "AG1_BL_CRD_ACQUIRED1_TGR10\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR0\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR1\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR2\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR3\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR4\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR5\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR6\0"
+    "AG1_BL_CRD_OCCUPANCY0_TGR7\0"
+    "AG1_BL_CRD_OCCUPANCY1_TGR8\0"
+    "AG1_BL_CRD_OCCUPANCY1_TGR9\0"
+    "AG1_BL_CRD_OCCUPANCY1_TGR10\0"
+    "DISTRESS_ASSERTED_VERT\0"
+    "DISTRESS_ASSERTED_HORZ\0"
+    "DISTRESS_ASSERTED_DPT_LOCAL\0"
+    "DISTRESS_ASSERTED_DPT_NONLOCAL\0"
+    "DISTRESS_ASSERTED_DPT_STALL_IV\0"
+    "DISTRESS_ASSERTED_DPT_STALL_NOCRD\0"
+    "DISTRESS_ASSERTED_PMM_LOCAL\0"
+    "DISTRESS_ASSERTED_PMM_NONLOCAL\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_UP\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_DN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AKC_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AKC_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AKC_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AKC_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AK_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_BL_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_IV_IN_USE_LEFT\0"
+    "HORZ_RING_IV_IN_USE_RIGHT\0"
+    "MISC_EXTERNAL_MBE_INST0\0"
+    "MISC_EXTERNAL_MBE_INST1\0"
+    "RING_BOUNCES_HORZ_AD\0"
+    "RING_BOUNCES_HORZ_AK\0"
+    "RING_BOUNCES_HORZ_BL\0"
+    "RING_BOUNCES_HORZ_IV\0"
+    "RING_BOUNCES_VERT_AD\0"
+    "RING_BOUNCES_VERT_AK\0"
+    "RING_BOUNCES_VERT_BL\0"
+    "RING_BOUNCES_VERT_IV\0"
+    "RING_BOUNCES_VERT_AKC\0"
+    "RING_SINK_STARVED_HORZ_AD\0"
+    "RING_SINK_STARVED_HORZ_AK\0"
+    "RING_SINK_STARVED_HORZ_BL\0"
+    "RING_SINK_STARVED_HORZ_IV\0"
+    "RING_SINK_STARVED_HORZ_AK_AG1\0"
+    "RING_SINK_STARVED_VERT_AD\0"
+    "RING_SINK_STARVED_VERT_AK\0"
+    "RING_SINK_STARVED_VERT_BL\0"
+    "RING_SINK_STARVED_VERT_IV\0"
+    "RING_SINK_STARVED_VERT_AKC\0"
+    "RXR_BUSY_STARVED_AD_UNCRD\0"
+    "RXR_BUSY_STARVED_BL_UNCRD\0"
+    "RXR_BUSY_STARVED_AD_CRD\0"
+    "RXR_BUSY_STARVED_BL_CRD\0"
+    "RXR_BUSY_STARVED_AD_ALL\0"
+    "RXR_BUSY_STARVED_BL_ALL\0"
+    "RXR_BYPASS_AD_UNCRD\0"
+    "RXR_BYPASS_AK\0"
+    "RXR_BYPASS_BL_UNCRD\0"
+    "RXR_BYPASS_IV\0"
+    "RXR_BYPASS_AD_CRD\0"
+    "RXR_BYPASS_BL_CRD\0"
+    "RXR_BYPASS_AKC_UNCRD\0"
+    "RXR_BYPASS_AD_ALL\0"
+    "RXR_BYPASS_BL_ALL\0"
+    "RXR_CRD_STARVED_AD_UNCRD\0"
+    "RXR_CRD_STARVED_AK\0"
+    "RXR_CRD_STARVED_BL_UNCRD\0"
+    "RXR_CRD_STARVED_IV\0"
+    "RXR_CRD_STARVED_AD_CRD\0"
+    "RXR_CRD_STARVED_BL_CRD\0"
+    "RXR_CRD_STARVED_IFV\0"
+    "RXR_CRD_STARVED_AD_ALL\0"
+    "RXR_CRD_STARVED_BL_ALL\0"
+    "RXR_CRD_STARVED_1\0"
+    "RXR_INSERTS_AD_UNCRD\0"
+    "RXR_INSERTS_AK\0"
+    "RXR_INSERTS_BL_UNCRD\0"
+    "RXR_INSERTS_IV\0"
+    "RXR_INSERTS_AD_CRD\0"
+    "RXR_INSERTS_BL_CRD\0"
+    "RXR_INSERTS_AKC_UNCRD\0"
+    "RXR_INSERTS_AD_ALL\0"
+    "RXR_INSERTS_BL_ALL\0"
+    "RXR_OCCUPANCY_AD_UNCRD\0"
+    "RXR_OCCUPANCY_AK\0"
+    "RXR_OCCUPANCY_BL_UNCRD\0"
+    "RXR_OCCUPANCY_IV\0"
+    "RXR_OCCUPANCY_AD_CRD\0"
+    "RXR_OCCUPANCY_BL_CRD\0"
+    "RXR_OCCUPANCY_AKC_UNCRD\0"
+    "RXR_OCCUPANCY_AD_ALL\0"
+    "RXR_OCCUPANCY_BL_ALL\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR0\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR1\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR2\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR3\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR4\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR5\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR6\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG0_TGR7\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG0_TGR8\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG0_TGR9\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG0_TGR10\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR0\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR1\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR2\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR3\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR4\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR5\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR6\0"
+    "STALL0_NO_TXR_HORZ_CRD_AD_AG1_TGR7\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG1_1_TGR8\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG1_1_TGR9\0"
+    "STALL1_NO_TXR_HORZ_CRD_AD_AG1_1_TGR10\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR0\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR1\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR2\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR3\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR4\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR5\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR6\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_TGR7\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_1_TGR8\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_1_TGR9\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG0_1_TGR10\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR0\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR1\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR2\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR3\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR4\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR5\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR6\0"
+    "STALL0_NO_TXR_HORZ_CRD_BL_AG1_TGR7\0"
+    "STALL1_NO_TXR_HORZ_CRD_BL_AG1_1_TGR8\0"
+    "STALL1_NO_TXR_HORZ_CRD_BL_AG1_1_TGR9\0"
+    "STALL1_NO_TXR_HORZ_CRD_BL_AG1_1_TGR10\0"
+    "TXR_HORZ_ADS_USED_AD_UNCRD\0"
+    "TXR_HORZ_ADS_USED_BL_UNCRD\0"
+    "TXR_HORZ_ADS_USED_AD_CRD\0"
+    "TXR_HORZ_ADS_USED_BL_CRD\0"
+    "TXR_HORZ_ADS_USED_AD_ALL\0"
+    "TXR_HORZ_ADS_USED_BL_ALL\0"
+    "TXR_HORZ_BYPASS_AD_UNCRD\0"
+    "TXR_HORZ_BYPASS_AK\0"
+    "TXR_HORZ_BYPASS_BL_UNCRD\0"
+    "TXR_HORZ_BYPASS_IV\0"
+    "TXR_HORZ_BYPASS_AD_CRD\0"
+    "TXR_HORZ_BYPASS_BL_CRD\0"
+    "TXR_HORZ_BYPASS_AKC_UNCRD\0"
+    "TXR_HORZ_BYPASS_AD_ALL\0"
+    "TXR_HORZ_BYPASS_BL_ALL\0"
+    "TXR_HORZ_CYCLES_FULL_AD_UNCRD\0"
+    "TXR_HORZ_CYCLES_FULL_AK\0"
+    "TXR_HORZ_CYCLES_FULL_BL_UNCRD\0"
+    "TXR_HORZ_CYCLES_FULL_IV\0"
+    "TXR_HORZ_CYCLES_FULL_AD_CRD\0"
+    "TXR_HORZ_CYCLES_FULL_BL_CRD\0"
+    "TXR_HORZ_CYCLES_FULL_AKC_UNCRD\0"
+    "TXR_HORZ_CYCLES_FULL_AD_ALL\0"
+    "TXR_HORZ_CYCLES_FULL_BL_ALL\0"
+    "TXR_HORZ_CYCLES_NE_AD_UNCRD\0"
+    "TXR_HORZ_CYCLES_NE_AK\0"
+    "TXR_HORZ_CYCLES_NE_BL_UNCRD\0"
+    "TXR_HORZ_CYCLES_NE_IV\0"
+    "TXR_HORZ_CYCLES_NE_AD_CRD\0"
+    "TXR_HORZ_CYCLES_NE_BL_CRD\0"
+    "TXR_HORZ_CYCLES_NE_AKC_UNCRD\0"
+    "TXR_HORZ_CYCLES_NE_AD_ALL\0"
+    "TXR_HORZ_CYCLES_NE_BL_ALL\0"
+    "TXR_HORZ_INSERTS_AD_UNCRD\0"
+    "TXR_HORZ_INSERTS_AK\0"
+    "TXR_HORZ_INSERTS_BL_UNCRD\0"
+    "TXR_HORZ_INSERTS_IV\0"
+    "TXR_HORZ_INSERTS_AD_CRD\0"
+    "TXR_HORZ_INSERTS_BL_CRD\0"
+    "TXR_HORZ_INSERTS_AKC_UNCRD\0"
+    "TXR_HORZ_INSERTS_AD_ALL\0"
+    "TXR_HORZ_INSERTS_BL_ALL\0"
+    "TXR_HORZ_NACK_AD_UNCRD\0"
+    "TXR_HORZ_NACK_AK\0"
+    "TXR_HORZ_NACK_BL_UNCRD\0"
+    "TXR_HORZ_NACK_IV\0"
+    "TXR_HORZ_NACK_AD_CRD\0"
+    "TXR_HORZ_NACK_BL_CRD\0"
+    "TXR_HORZ_NACK_AKC_UNCRD\0"
+    "TXR_HORZ_NACK_AD_ALL\0"
+    "TXR_HORZ_NACK_BL_ALL\0"
+    "TXR_HORZ_OCCUPANCY_AD_UNCRD\0"
+    "TXR_HORZ_OCCUPANCY_AK\0"
+    "TXR_HORZ_OCCUPANCY_BL_UNCRD\0"
+    "TXR_HORZ_OCCUPANCY_IV\0"
+    "TXR_HORZ_OCCUPANCY_AD_CRD\0"
+    "TXR_HORZ_OCCUPANCY_BL_CRD\0"
+    "TXR_HORZ_OCCUPANCY_AKC_UNCRD\0"
+    "TXR_HORZ_OCCUPANCY_AD_ALL\0"
+    "TXR_HORZ_OCCUPANCY_BL_ALL\0"
+    "TXR_HORZ_STARVED_AD_UNCRD\0"
+    "TXR_HORZ_STARVED_AK\0"
+    "TXR_HORZ_STARVED_BL_UNCRD\0"
+    "TXR_HORZ_STARVED_IV\0"
+    "TXR_HORZ_STARVED_AKC_UNCRD\0"
+    "TXR_HORZ_STARVED_AD_ALL\0"
+    "TXR_HORZ_STARVED_BL_ALL\0"
+    "TXR_VERT_ADS_USED_AD_AG0\0"
+    "TXR_VERT_ADS_USED_BL_AG0\0"
+    "TXR_VERT_ADS_USED_AD_AG1\0"
+    "TXR_VERT_ADS_USED_BL_AG1\0"
+    "TXR_VERT_ADS_USED_AD_ALL\0"
+    "TXR_VERT_ADS_USED_BL_ALL\0"
+    "TXR_VERT_BYPASS0_AD_AG0\0"
+    "TXR_VERT_BYPASS0_AK_AG0\0"
+    "TXR_VERT_BYPASS0_BL_AG0\0"
+    "TXR_VERT_BYPASS0_IV_AG1\0"
+    "TXR_VERT_BYPASS0_AD_AG1\0"
+    "TXR_VERT_BYPASS0_AK_AG1\0"
+    "TXR_VERT_BYPASS0_BL_AG1\0"
+    "TXR_VERT_BYPASS0_AD_ALL\0"
+    "TXR_VERT_BYPASS0_AK_ALL\0"
+    "TXR_VERT_BYPASS0_BL_ALL\0"
+    "TXR_VERT_BYPASS1_AKC_AG0\0"
+    "TXR_VERT_BYPASS1_AKC_AG1\0"
+    "TXR_VERT_BYPASS1_AKC_ALL\0"
+    "TXR_VERT_CYCLES_FULL0_AD_AG0\0"
+    "TXR_VERT_CYCLES_FULL0_AK_AG0\0"
+    "TXR_VERT_CYCLES_FULL0_BL_AG0\0"
+    "TXR_VERT_CYCLES_FULL0_IV_AG0\0"
+    "TXR_VERT_CYCLES_FULL0_AD_AG1\0"
+    "TXR_VERT_CYCLES_FULL0_AK_AG1\0"
+    "TXR_VERT_CYCLES_FULL0_BL_AG1\0"
+    "TXR_VERT_CYCLES_FULL0_AD_ALL\0"
+    "TXR_VERT_CYCLES_FULL0_AK_ALL\0"
+    "TXR_VERT_CYCLES_FULL0_BL_ALL\0"
+    "TXR_VERT_CYCLES_FULL1_AKC_AG0\0"
+    "TXR_VERT_CYCLES_FULL1_AKC_AG1\0"
+    "TXR_VERT_CYCLES_FULL1_AKC_ALL\0"
+    "TXR_VERT_CYCLES_NE0_AD_AG0\0"
+    "TXR_VERT_CYCLES_NE0_AK_AG0\0"
+    "TXR_VERT_CYCLES_NE0_BL_AG0\0"
+    "TXR_VERT_CYCLES_NE0_IV_AG0\0"
+    "TXR_VERT_CYCLES_NE0_AD_AG1\0"
+    "TXR_VERT_CYCLES_NE0_AK_AG1\0"
+    "TXR_VERT_CYCLES_NE0_BL_AG1\0"
+    "TXR_VERT_CYCLES_NE0_AD_ALL\0"
+    "TXR_VERT_CYCLES_NE0_AK_ALL\0"
+    "TXR_VERT_CYCLES_NE0_BL_ALL\0"
+    "TXR_VERT_CYCLES_NE1_AKC_AG0\0"
+    "TXR_VERT_CYCLES_NE1_AKC_AG1\0"
+    "TXR_VERT_CYCLES_NE1_AKC_ALL\0"
+    "TXR_VERT_INSERTS0_AD_AG0\0"
+    "TXR_VERT_INSERTS0_AK_AG0\0"
+    "TXR_VERT_INSERTS0_BL_AG0\0"
+    "TXR_VERT_INSERTS0_IV_AG0\0"
+    "TXR_VERT_INSERTS0_AD_AG1\0"
+    "TXR_VERT_INSERTS0_AK_AG1\0"
+    "TXR_VERT_INSERTS0_BL_AG1\0"
+    "TXR_VERT_INSERTS0_AD_ALL\0"
+    "TXR_VERT_INSERTS0_AK_ALL\0"
+    "TXR_VERT_INSERTS0_BL_ALL\0"
+    "TXR_VERT_INSERTS1_AKC_AG0\0"
+    "TXR_VERT_INSERTS1_AKC_AG1\0"
+    "TXR_VERT_INSERTS1_AKC_ALL\0"
+    "TXR_VERT_NACK0_AD_AG0\0"
+    "TXR_VERT_NACK0_AK_AG0\0"
+    "TXR_VERT_NACK0_BL_AG0\0"
+    "TXR_VERT_NACK0_IV_AG0\0"
+    "TXR_VERT_NACK0_AD_AG1\0"
+    "TXR_VERT_NACK0_AK_AG1\0"
+    "TXR_VERT_NACK0_BL_AG1\0"
+    "TXR_VERT_NACK0_AD_ALL\0"
+    "TXR_VERT_NACK0_AK_ALL\0"
+    "TXR_VERT_NACK0_BL_ALL\0"
+    "TXR_VERT_NACK1_AKC_AG0\0"
+    "TXR_VERT_NACK1_AKC_AG1\0"
+    "TXR_VERT_NACK1_AKC_ALL\0"
+    "TXR_VERT_OCCUPANCY0_AD_AG0\0"
+    "TXR_VERT_OCCUPANCY0_AK_AG0\0"
+    "TXR_VERT_OCCUPANCY0_BL_AG0\0"
+    "TXR_VERT_OCCUPANCY0_IV_AG0\0"
+    "TXR_VERT_OCCUPANCY0_AD_AG1\0"
+    "TXR_VERT_OCCUPANCY0_AK_AG1\0"
+    "TXR_VERT_OCCUPANCY0_BL_AG1\0"
+    "TXR_VERT_OCCUPANCY0_AD_ALL\0"
+    "TXR_VERT_OCCUPANCY0_AK_ALL\0"
+    "TXR_VERT_OCCUPANCY0_BL_ALL\0"
+    "TXR_VERT_OCCUPANCY1_AKC_AG0\0"
+    "TXR_VERT_OCCUPANCY1_AKC_AG1\0"
+    "TXR_VERT_OCCUPANCY1_AKC_ALL\0"
+    "TXR_VERT_STARVED0_AD_AG0\0"
+    "TXR_VERT_STARVED0_AK_AG0\0"
+    "TXR_VERT_STARVED0_BL_AG0\0"
+    "TXR_VERT_STARVED0_IV_AG0\0"
+    "TXR_VERT_STARVED0_AD_AG1\0"
+    "TXR_VERT_STARVED0_AK_AG1\0"
+    "TXR_VERT_STARVED0_BL_AG1\0"
+    "TXR_VERT_STARVED0_AD_ALL\0"
+    "TXR_VERT_STARVED0_AK_ALL\0"
+    "TXR_VERT_STARVED0_BL_ALL\0"
+    "TXR_VERT_STARVED1_AKC_AG0\0"
+    "TXR_VERT_STARVED1_AKC_AG1\0"
+    "TXR_VERT_STARVED1_TGC\0"
+    "TXR_VERT_STARVED1_AKC_ALL\0"
+    "VERT_RING_AD_IN_USE_UP_EVEN\0"
+    "VERT_RING_AD_IN_USE_UP_ODD\0"
+    "VERT_RING_AD_IN_USE_DN_EVEN\0"
+    "VERT_RING_AD_IN_USE_DN_ODD\0"
+    "VERT_RING_AKC_IN_USE_UP_EVEN\0"
+    "VERT_RING_AKC_IN_USE_UP_ODD\0"
+    "VERT_RING_AKC_IN_USE_DN_EVEN\0"
+    "VERT_RING_AKC_IN_USE_DN_ODD\0"
+    "VERT_RING_AK_IN_USE_UP_EVEN\0"
+    "VERT_RING_AK_IN_USE_UP_ODD\0"
+    "VERT_RING_AK_IN_USE_DN_EVEN\0"
+    "VERT_RING_AK_IN_USE_DN_ODD\0"
+    "VERT_RING_BL_IN_USE_UP_EVEN\0"
+    "VERT_RING_BL_IN_USE_UP_ODD\0"
+    "VERT_RING_BL_IN_USE_DN_EVEN\0"
+    "VERT_RING_BL_IN_USE_DN_ODD\0"
+    "VERT_RING_IV_IN_USE_UP\0"
+    "VERT_RING_IV_IN_USE_DN\0"
+    "VERT_RING_TGC_IN_USE_UP_EVEN\0"
+    "VERT_RING_TGC_IN_USE_UP_ODD\0"
+    "VERT_RING_TGC_IN_USE_DN_EVEN\0"
+    "VERT_RING_TGC_IN_USE_DN_ODD\0"
+    "RING_SRC_THRTL\0"
+    "PMM_QOS_SLOW_INSERT\0"
+    "PMM_QOS_DDR4_FAST_INSERT\0"
+    "PMM_QOS_THROTTLE\0"
+    "PMM_QOS_REJ_IRQ\0"
+    "PMM_QOS_THROTTLE_PRQ\0"
+    "PMM_QOS_THROTTLE_IRQ\0"
+    "PMM_QOS_SLOWTORQ_SKIP\0"
+    "PMM_QOS_OCCUPANCY_DDR_SLOW_FIFO\0"
+    "PMM_QOS_OCCUPANCY_DDR_FAST_FIFO\0"
+    "MEM_CLOCKTICKS\0"
+    "MBOX\0"
+    "PMM_CMD1_ALL\0"
+    "PMM_CMD1_RD\0"
+    "PMM_CMD1_WR\0"
+    "PMM_CMD1_UFILL_RD\0"
+    "PMM_CMD1_RPQ_GNTS\0"
+    "PMM_CMD1_WPQ_GNTS\0"
+    "PMM_CMD1_MISC_GNT\0"
+    "PMM_CMD1_MISC\0"
+    "PMM_CMD2_OPP_RD\0"
+    "PMM_CMD2_NODATA_EXP\0"
+    "PMM_CMD2_NODATA_UNEXP\0"
+    "PMM_CMD2_REQS_SLOT0\0"
+    "PMM_CMD2_REQS_SLOT1\0"
+    "PMM_CMD2_PMM_ECC_ERROR\0"
+    "PMM_CMD2_PMM_ERID_ERROR\0"
+    "PMM_CMD2_PMM_ERID_STARVED\0"
+    "SB_ACCESSES_RD_ACCEPTS\0"
+    "SB_ACCESSES_RD_REJECTS\0"
+    "SB_ACCESSES_WR_ACCEPTS\0"
+    "SB_ACCESSES_WR_REJECTS\0"
+    "SB_ACCESSES_NM_RD_CMPS\0"
+    "SB_ACCESSES_NM_WR_CMPS\0"
+    "SB_ACCESSES_FM_RD_CMPS\0"
+    "SB_ACCESSES_FM_WR_CMPS\0"
+    "SB_ACCESSES_ACCEPTS\0"
+    "SB_ACCESSES_REJECTS\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_PRE_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD_PRE_UNDERFILL\0"
+    "CAS_COUNT_WR_NONPRE\0"
+    "CAS_COUNT_WR_PRE\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "ACT_COUNT_BYP\0"
+    "ACT_PRIO_RD_NORMAL\0"
+    "ACT_PRIO_RD_CRITICAL\0"
+    "ACT_PRIO_RD_STARVED\0"
+    "ACT_PRIO_WR_NORMAL\0"
+    "ACT_PRIO_WR_CRITICAL\0"
+    "ACT_PRIO_WR_STARVED\0"
+    "ACT_PRIO_RD_ANY\0"
+    "ACT_PRIO_WR_ANY\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "CAS_MM_RD_RMM\0"
+    "CAS_MM_RD_WMM\0"
+    "CAS_MM_WR_RMM\0"
+    "CAS_MM_WR_WMM\0"
+    "CRIT_MINOR_CAS_RD_PCH0\0"
+    "CRIT_MINOR_CAS_RD_PCH1\0"
+    "CRIT_MINOR_CAS_WR_PCH0\0"
+    "CRIT_MINOR_CAS_WR_PCH1\0"
+    "CRIT_MINOR_CAS_RD_ANY\0"
+    "CRIT_MINOR_CAS_WR_ANY\0"
+    "PMM_RPQ_OCCUPANCY_NO_GNT\0"
+    "PMM_RPQ_OCCUPANCY_GNT_WAIT\0"
+    "PMM_RPQ_CYCLES_FULL\0"
+    "PMM_RPQ_CYCLES_NE\0"
+    "PMM_WPQ_OCCUPANCY_CAS\0"
+    "PMM_WPQ_OCCUPANCY_PWR\0"
+    "PMM_WPQ_CYCLES_FULL\0"
+    "PMM_WPQ_CYCLES_NE\0"
+    "PMM_WPQ_FLUSH\0"
+    "PMM_WPQ_FLUSH_CYC\0"
+    "PMM_MAJMODE1_RMM_CYC\0"
+    "PMM_MAJMODE1_WMM_CYC\0"
+    "PMM_MAJMODE1_PWMM_CYC\0"
+    "PMM_MAJMODE1_WMM_ENTER\0"
+    "PMM_MAJMODE1_WMM_EXIT\0"
+    "PMM_MAJMODE1_PWMM_ENTER\0"
+    "PMM_MAJMODE1_PWMM_EXIT\0"
+    "PMM_MAJMODE2_PMM_CYC\0"
+    "PMM_MAJMODE2_DDR_CYC\0"
+    "PMM_MAJMODE2_PMM_ENTER\0"
+    "PMM_MAJMODE2_DDR_ENTER\0"
+    "MAJOR_MODES_PREF_RD\0"
+    "MAJOR_MODES_STARVED_RD\0"
+    "MAJOR_MODES_PREF_WR\0"
+    "MAJOR_MODES_STARVED_WR\0"
+    "MAJOR_MODES_ANY_RD\0"
+    "MAJOR_MODES_ANY_WR\0"
+    "MAJOR_MODE_CHANGE_PCH0_PR_TO_SW\0"
+    "MAJOR_MODE_CHANGE_PCH0_PR_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH0_SW_TO_PR\0"
+    "MAJOR_MODE_CHANGE_PCH0_SW_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH0_SR_TO_PR\0"
+    "MAJOR_MODE_CHANGE_PCH0_SR_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH0_PW_TO_SR\0"
+    "MAJOR_MODE_CHANGE_PCH0_PW_TO_PR\0"
+    "MAJOR_MODE_CHANGE_PCH1_PR_TO_SW\0"
+    "MAJOR_MODE_CHANGE_PCH1_PR_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH1_SW_TO_PR\0"
+    "MAJOR_MODE_CHANGE_PCH1_SW_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH1_SR_TO_PR\0"
+    "MAJOR_MODE_CHANGE_PCH1_SR_TO_PW\0"
+    "MAJOR_MODE_CHANGE_PCH1_PW_TO_SR\0"
+    "MAJOR_MODE_CHANGE_PCH1_PW_TO_PR\0"
+    "MAJOR_MODE_VOTE_MISMATCH_PCH0\0"
+    "MAJOR_MODE_VOTE_MISMATCH_PCH1\0"
+    "MAJOR_MODE_VOTE_MISMATCH_ANY\0"
+    "POWER_CKE_CYCLES_LOW_0\0"
+    "POWER_CKE_CYCLES_LOW_1\0"
+    "POWER_CKE_CYCLES_LOW_2\0"
+    "POWER_CKE_CYCLES_LOW_3\0"
+    "POWER_CRIT_THROTTLE_CYCLES_SLOT0\0"
+    "POWER_CRIT_THROTTLE_CYCLES_SLOT1\0"
+    "POWER_CRIT_THROTTLE_CYCLES_ANY\0"
+    "POWER_THROTTLE_CYCLES_SLOT0\0"
+    "POWER_THROTTLE_CYCLES_SLOT1\0"
+    "POWER_THROTTLE_CYCLES_ANY\0"
+    "PREEMPTION_RD_PCH0\0"
+    "PREEMPTION_WR_PCH0\0"
+    "PREEMPTION_RD_PCH1\0"
+    "PREEMPTION_WR_PCH1\0"
+    "PREEMPTION_RD_ANY\0"
+    "PREEMPTION_WR_ANY\0"
+    "PREEMPTION_AS_PCH0\0"
+    "PREEMPTION_AS_PCH1\0"
+    "PREEMPTION_AS_ANY\0"
+    "PREEMPTION_MM_SWITCH_WMM_PCH0\0"
+    "PREEMPTION_MM_SWITCH_RMM_PCH0\0"
+    "PREEMPTION_MM_SWITCH_WMM_PCH1\0"
+    "PREEMPTION_MM_SWITCH_RMM_PCH1\0"
+    "PREEMPTION_MM_SWITCH_WMM_ANY\0"
+    "PREEMPTION_MM_SWITCH_RMM_ANY\0"
+    "RD_CAS_PRIO_NORMAL\0"
+    "RD_CAS_PRIO_CRITICAL\0"
+    "RD_CAS_PRIO_STARVED\0"
+    "WR_CAS_PRIO_NORMAL\0"
+    "WR_CAS_PRIO_CRITICAL\0"
+    "WR_CAS_PRIO_STARVED\0"
+    "RPQ_CYCLES_NE_PCH0\0"
+    "RPQ_CYCLES_NE_PCH1\0"
+    "RPQ_CYCLES_NE_ANY\0"
+    "RPQ_CYCLES_FULL_PCH0\0"
+    "RPQ_CYCLES_FULL_PCH1\0"
+    "RPQ_PRIO_PCH0_LOW\0"
+    "RPQ_PRIO_PCH0_MED\0"
+    "RPQ_PRIO_PCH0_HIGH\0"
+    "RPQ_PRIO_PCH0_CRIT\0"
+    "RPQ_PRIO_PCH1_LOW\0"
+    "RPQ_PRIO_PCH1_MED\0"
+    "RPQ_PRIO_PCH1_HIGH\0"
+    "RPQ_PRIO_PCH1_CRIT\0"
+    "RPQ_PRIO_ANY_LOW\0"
+    "RPQ_PRIO_ANY_MED\0"
+    "RPQ_PRIO_ANY_HIGH\0"
+    "RPQ_PRIO_ANY_CRIT\0"
+    "RPQ_PRIO_PCH0_ANY\0"
+    "RPQ_PRIO_PCH1_ANY\0"
+    "WPQ_CYCLES_NE_PCH0\0"
+    "WPQ_CYCLES_NE_PCH1\0"
+    "WPQ_CYCLES_NE_ANY\0"
+    "WPQ_CYCLES_FULL_PCH0\0"
+    "WPQ_CYCLES_FULL_PCH1\0"
+    "WPQ_PRIO_PCH0_LOW\0"
+    "WPQ_PRIO_PCH0_MED\0"
+    "WPQ_PRIO_PCH0_HIGH\0"
+    "WPQ_PRIO_PCH0_CRIT\0"
+    "WPQ_PRIO_PCH1_LOW\0"
+    "WPQ_PRIO_PCH1_MED\0"
+    "WPQ_PRIO_PCH1_HIGH\0"
+    "WPQ_PRIO_PCH1_CRIT\0"
+    "WPQ_PRIO_ANY_LOW\0"
+    "WPQ_PRIO_ANY_MED\0"
+    "WPQ_PRIO_ANY_HIGH\0"
+    "WPQ_PRIO_ANY_CRIT\0"
+    "WPQ_PRIO_PCH0_ANY\0"
+    "WPQ_PRIO_PCH1_ANY\0"
+    "WPQ_READ_HIT_PCH0\0"
+    "WPQ_READ_HIT_PCH1\0"
+    "WPQ_READ_HIT_ANY\0"
+    "WPQ_WRITE_HIT_PCH0\0"
+    "WPQ_WRITE_HIT_PCH1\0"
+    "WPQ_WRITE_HIT_ANY\0"
+    "SB_CYCLES_FULL\0"
+    "SB_CYCLES_NE\0"
+    "SB_CANARY_ALLOC\0"
+    "SB_CANARY_DEALLOC\0"
+    "SB_CANARY_VLD\0"
+    "SB_CANARY_NM_RD_STARVED\0"
+    "SB_CANARY_NM_WR_STARVED\0"
+    "SB_CANARY_FM_RD_STARVED\0"
+    "SB_CANARY_FM_WR_STARVED\0"
+    "SB_CANARY_FM_TGR_WR_STARVED\0"
+    "SB_INSERTS_RDS\0"
+    "SB_INSERTS_WRS\0"
+    "SB_INSERTS_PMM_RDS\0"
+    "SB_INSERTS_PMM_WRS\0"
+    "SB_INSERTS_BLOCK_RDS\0"
+    "SB_INSERTS_BLOCK_WRS\0"
+    "SB_INSERTS_ANY_RDS\0"
+    "SB_INSERTS_ANY_WRS\0"
+    "SB_OCCUPANCY_RDS\0"
+    "SB_OCCUPANCY_PMM_RDS\0"
+    "SB_OCCUPANCY_PMM_WRS\0"
+    "SB_OCCUPANCY_BLOCK_RDS\0"
+    "SB_OCCUPANCY_BLOCK_WRS\0"
+    "SB_OCCUPANCY_ANY_RDS\0"
+    "SB_OCCUPANCY_ANY_WRS\0"
+    "SB_REJECT_NM_SET_CNFLT\0"
+    "SB_REJECT_FM_ADDR_CNFLT\0"
+    "SB_REJECT_PATROL_SET_CNFLT\0"
+    "SB_REJECT_CANARY\0"
+    "SB_REJECT_DDR_EARLY_CMP\0"
+    "SB_STRV_ALLOC_NM_RD\0"
+    "SB_STRV_ALLOC_FM_RD\0"
+    "SB_STRV_ALLOC_NM_WR\0"
+    "SB_STRV_ALLOC_FM_WR\0"
+    "SB_STRV_ALLOC_FM_TGR\0"
+    "SB_STRV_DEALLOC_NM_RD\0"
+    "SB_STRV_DEALLOC_FM_RD\0"
+    "SB_STRV_DEALLOC_NM_WR\0"
+    "SB_STRV_DEALLOC_FM_WR\0"
+    "SB_STRV_DEALLOC_FM_TGR\0"
+    "SB_STRV_OCC_NM_RD\0"
+    "SB_STRV_OCC_FM_RD\0"
+    "SB_STRV_OCC_NM_WR\0"
+    "SB_STRV_OCC_FM_WR\0"
+    "SB_STRV_OCC_FM_TGR\0"
+    "SB_TAGGED_NEW\0"
+    "SB_TAGGED_RD_HIT\0"
+    "SB_TAGGED_RD_MISS\0"
+    "SB_TAGGED_DDR4_CMP\0"
+    "SB_TAGGED_PMM0_CMP\0"
+    "SB_TAGGED_PMM1_CMP\0"
+    "SB_TAGGED_PMM2_CMP\0"
+    "SB_TAGGED_OCC\0"
+    "SB_PREF_INSERTS_ALL\0"
+    "SB_PREF_INSERTS_DDR\0"
+    "SB_PREF_INSERTS_PMM\0"
+    "SB_PREF_OCCUPANCY_ALL\0"
+    "SB_PREF_OCCUPANCY_DDR\0"
+    "SB_PREF_OCCUPANCY_PMM\0"
+    "OTHER_CTR_CTR0\0"
+    "OTHER_CTR_CTR1\0"
+    "OTHER_CTR_CTR2\0"
+    "OTHER_CTR_CTR3\0"
+    "OTHER_CTR_CTR4\0"
+    "PCLS_RD\0"
+    "PCLS_WR\0"
+    "PCLS_TOTAL\0"
+    "DRAM_PRE_ALL\0"
+    "PARITY_ERRORS\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_SELF_REFRESH\0"
+    "MBOX_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX3FIX|MBOX4FIX|MBOX5FIX|MBOX6FIX|MBOX7FIX\0"
+    "DDR_READ_BYTES\0"
+    "MDEV0C0|MDEV1C0|MDEV2C0|MDEV3C0\0"
+    "DDR_WRITE_BYTES\0"
+    "MDEV0C1|MDEV1C1|MDEV2C1|MDEV3C1\0"
+    "PMM_READ_BYTES\0"
+    "MDEV0C2|MDEV1C2|MDEV2C2|MDEV3C2\0"
+    "PMM_WRITE_BYTES\0"
+    "MDEV0C3|MDEV1C3|MDEV2C3|MDEV3C3\0"
+    "IMC_DEV_CLOCKTICKS\0"
+    "MDEV0C4|MDEV1C4|MDEV2C4|MDEV3C4\0"
+    "DIRECT2UPI_NOT_TAKEN_CREDITS\0"
+    "M2M\0"
+    "DIRECT2UPI_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2UPI_TXN_OVERRIDE\0"
+    "DIRECT2CORE_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECT2CORE_NOT_TAKEN_NOTFORKED\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_READS_ISOCH\0"
+    "IMC_READS_ALL\0"
+    "IMC_READS_TO_DDR_AS_MEM\0"
+    "IMC_READS_TO_DDR_AS_CACHE\0"
+    "IMC_READS_TO_PMM\0"
+    "IMC_READS_FROM_TGR\0"
+    "IMC_READS_CH0_NORMAL\0"
+    "IMC_READS_CH0_ISOCH\0"
+    "IMC_READS_CH0_ALL\0"
+    "IMC_READS_CH0_TO_DDR_AS_MEM\0"
+    "IMC_READS_CH0_TO_DDR_AS_CACHE\0"
+    "IMC_READS_CH0_TO_PMM\0"
+    "IMC_READS_CH0_FROM_TGR\0"
+    "IMC_READS_CH1_NORMAL\0"
+    "IMC_READS_CH1_ISOCH\0"
+    "IMC_READS_CH1_ALL\0"
+    "IMC_READS_CH1_TO_DDR_AS_MEM\0"
+    "IMC_READS_CH1_TO_DDR_AS_CACHE\0"
+    "IMC_READS_CH1_TO_PMM\0"
+    "IMC_READS_CH1_FROM_TGR\0"
+    "IMC_READS_CH2_FROM_TGR\0"
+    "IMC_WRITES_NI\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "IMC_WRITES_TO_DDR_AS_MEM\0"
+    "IMC_WRITES_TO_DDR_AS_CACHE\0"
+    "IMC_WRITES_FROM_TGR\0"
+    "IMC_WRITES_NI_MISS\0"
+    "IMC_WRITES_CH0_FULL\0"
+    "IMC_WRITES_CH0_PARTIAL\0"
+    "IMC_WRITES_CH0_FULL_ISOCH\0"
+    "IMC_WRITES_CH0_PARTIAL_ISOCH\0"
+    "IMC_WRITES_CH0_ALL\0"
+    "IMC_WRITES_CH0_TO_DDR_AS_MEM\0"
+    "IMC_WRITES_CH0_TO_DDR_AS_CACHE\0"
+    "IMC_WRITES_CH0_TO_PMM\0"
+    "IMC_WRITES_CH0_FROM_TGR\0"
+    "IMC_WRITES_CH0_NI\0"
+    "IMC_WRITES_CH0_NI_MISS\0"
+    "IMC_WRITES_CH1_FULL\0"
+    "IMC_WRITES_CH1_PARTIAL\0"
+    "IMC_WRITES_CH1_FULL_ISOCH\0"
+    "IMC_WRITES_CH1_PARTIAL_ISOCH\0"
+    "IMC_WRITES_CH1_ALL\0"
+    "IMC_WRITES_CH1_TO_DDR_AS_MEM\0"
+    "IMC_WRITES_CH1_TO_DDR_AS_CACHE\0"
+    "IMC_WRITES_CH1_TO_PMM\0"
+    "IMC_WRITES_CH1_FROM_TGR\0"
+    "IMC_WRITES_CH1_NI\0"
+    "IMC_WRITES_CH1_NI_MISS\0"
+    "TAG_HIT_NM_UFILL_HIT_CLEAN\0"
+    "TAG_HIT_NM_UFILL_HIT_DIRTY\0"
+    "TAG_MISS\0"
+    "BYPASS_M2M_INGRESS_TAKEN\0"
+    "BYPASS_M2M_INGRESS_NOT_TAKEN\0"
+    "BYPASS_M2M_EGRESS_TAKEN\0"
+    "BYPASS_M2M_EGRESS_NOT_TAKEN\0"
+    "RXC_AD_INSERTS\0"
+    "RXC_AD_OCCUPANCY\0"
+    "RXC_BL_INSERTS\0"
+    "RXC_BL_OCCUPANCY\0"
+    "RXC_AD_CYCLES_FULL\0"
+    "RXC_AD_CYCLES_NE\0"
+    "RXC_AD_PREF_OCCUPANCY\0"
+    "RXC_AK_WR_CMP\0"
+    "RXC_BL_CH0_WPQ_PROXY_CYCLES_NE\0"
+    "RXC_BL_CH0_WPQ_PROXY_OCCUPANCY\0"
+    "RXC_BL_CYCLES_FULL\0"
+    "RXC_BL_CYCLES_NE\0"
+    "TXC_AD_INSERTS\0"
+    "TXC_AD_OCCUPANCY\0"
+    "TXC_AD_CREDITS_ACQUIRED\0"
+    "TXC_AD_CREDIT_OCCUPANCY\0"
+    "TXC_AD_CYCLES_FULL\0"
+    "TXC_AD_CYCLES_NE\0"
+    "TXC_AD_NO_CREDIT_CYCLES\0"
+    "TXC_AD_NO_CREDIT_STALLED\0"
+    "TXC_AKC_CREDITS\0"
+    "TXC_AK_NDR\0"
+    "TXC_AK_CRD_CBO\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_AK_CYCLES_FULL_CMS0\0"
+    "TXC_AK_CYCLES_FULL_CMS1\0"
+    "TXC_AK_CYCLES_ALL\0"
+    "TXC_AK_CYCLES_RDCRD0\0"
+    "TXC_AK_CYCLES_WRCRD0\0"
+    "TXC_AK_CYCLES_WRCMP0\0"
+    "TXC_AK_CYCLES_RDCRD1\0"
+    "TXC_AK_CYCLES_WRCRD1\0"
+    "TXC_AK_CYCLES_WRCMP1\0"
+    "TXC_AK_CYCLES_NE_CMS0\0"
+    "TXC_AK_CYCLES_NE_CMS1\0"
+    "TXC_AK_CYCLES_NE_ALL\0"
+    "TXC_AK_CYCLES_NE_RDCRD\0"
+    "TXC_AK_CYCLES_NE_WRCRD\0"
+    "TXC_AK_CYCLES_NE_WRCMP\0"
+    "TXC_AK_INSERTS_CMS0\0"
+    "TXC_AK_INSERTS_CMS1\0"
+    "TXC_AK_INSERTS_ALL\0"
+    "TXC_AK_INSERTS_RDCRD\0"
+    "TXC_AK_INSERTS_WRCRD\0"
+    "TXC_AK_INSERTS_WRCMP\0"
+    "TXC_AK_INSERTS_PREF_RD_CAM_HIT\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_AK_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_AK_NO_CREDIT_STALLED_ALL\0"
+    "TXC_AK_OCCUPANCY_CMS0\0"
+    "MEM\0"
+    "TXC_AK_OCCUPANCY_CMS1\0"
+    "TXC_AK_OCCUPANCY_ALL\0"
+    "TXC_AK_OCCUPANCY_RDCRD\0"
+    "TXC_AK_OCCUPANCY_WRCRD\0"
+    "TXC_AK_OCCUPANCY_WRCMP\0"
+    "TXC_BL_DRS_CACHE\0"
+    "TXC_BL_DRS_CORE\0"
+    "TXC_BL_DRS_UPI\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_BL_CREDITS_ACQUIRED_ALL\0"
+    "TXC_BL_CYCLES_FULL_CMS0\0"
+    "TXC_BL_CYCLES_FULL_CMS1\0"
+    "TXC_BL_CYCLES_FULL_ALL\0"
+    "TXC_BL_CYCLES_NE_CMS0\0"
+    "TXC_BL_CYCLES_NE_CMS1\0"
+    "TXC_BL_CYCLES_NE_ALL\0"
+    "TXC_BL_INSERTS_CMS0\0"
+    "TXC_BL_INSERTS_CMS1\0"
+    "TXC_BL_INSERTS_ALL\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_BL_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_BL_NO_CREDIT_STALLED_ALL\0"
+    "DIRECTORY_HIT_DIRTY_I\0"
+    "DIRECTORY_HIT_DIRTY_S\0"
+    "DIRECTORY_HIT_DIRTY_P\0"
+    "DIRECTORY_HIT_DIRTY_A\0"
+    "DIRECTORY_HIT_CLEAN_I\0"
+    "DIRECTORY_HIT_CLEAN_S\0"
+    "DIRECTORY_HIT_CLEAN_P\0"
+    "DIRECTORY_HIT_CLEAN_A\0"
+    "DIRECTORY_HIT_DIRTY_ANY\0"
+    "DIRECTORY_HIT_CLEAN_ANY\0"
+    "DIRECTORY_MISS_DIRTY_I\0"
+    "DIRECTORY_MISS_DIRTY_S\0"
+    "DIRECTORY_MISS_DIRTY_P\0"
+    "DIRECTORY_MISS_DIRTY_A\0"
+    "DIRECTORY_MISS_CLEAN_I\0"
+    "DIRECTORY_MISS_CLEAN_S\0"
+    "DIRECTORY_MISS_CLEAN_P\0"
+    "DIRECTORY_MISS_CLEAN_A\0"
+    "DIRECTORY_MISS_DIRTY_ANY\0"
+    "DIRECTORY_MISS_CLEAN_ANY\0"
+    "PKT_MATCH_MESH\0"
+    "PKT_MATCH_MC\0"
+    "RPQ_NO_REG_CRD_CH0\0"
+    "RPQ_NO_REG_CRD_CH1\0"
+    "RPQ_NO_REG_CRD_CH2\0"
+    "RPQ_NO_REG_CRD_ALLCH\0"
+    "RPQ_NO_REG_CRD_MEE_CHN0\0"
+    "RPQ_NO_REG_CRD_MEE_CHN1\0"
+    "RPQ_NO_REG_CRD_MEE_CHN2\0"
+    "RPQ_NO_REG_CRD_MEE_ALLCH\0"
+    "RPQ_NO_SPEC_CRD_CH0\0"
+    "RPQ_NO_SPEC_CRD_CH1\0"
+    "RPQ_NO_SPEC_CRD_CH2\0"
+    "RPQ_NO_SPEC_CRD_ALLCH\0"
+    "RPQ_NO_REG_CRD_PMM_CHN0\0"
+    "RPQ_NO_REG_CRD_PMM_CHN1\0"
+    "RPQ_NO_REG_CRD_PMM_CHN2\0"
+    "RPQ_NO_REG_CRD_PMM_ALLCH\0"
+    "WPQ_FLUSH_CH0\0"
+    "WPQ_FLUSH_CH1\0"
+    "WPQ_FLUSH_CH2\0"
+    "WPQ_FLUSH_ALLCH\0"
+    "WPQ_NO_REG_CRD_CHN0\0"
+    "WPQ_NO_REG_CRD_CHN1\0"
+    "WPQ_NO_REG_CRD_CHN2\0"
+    "WPQ_NO_REG_CRD_ALLCH\0"
+    "WPQ_NO_REG_CRD_MEE_CHN0\0"
+    "WPQ_NO_REG_CRD_MEE_CHN1\0"
+    "WPQ_NO_REG_CRD_MEE_CHN2\0"
+    "WPQ_NO_REG_CRD_MEE_ALLCH\0"
+    "WPQ_NO_SPEC_CRD_CHN0\0"
+    "WPQ_NO_SPEC_CRD_CHN1\0"
+    "WPQ_NO_SPEC_CRD_CHN2\0"
+    "WPQ_NO_SPEC_CRD_ALLCH\0"
+    "WPQ_NO_REG_CRD_PMM_CHN0\0"
+    "WPQ_NO_REG_CRD_PMM_CHN1\0"
+    "WPQ_NO_REG_CRD_PMM_CHN2\0"
+    "WPQ_NO_REG_CRD_PMM_ALLCH\0"
+    "TRACKER_FULL_CH0\0"
+    "TRACKER_FULL_CH1\0"
+    "TRACKER_FULL_CH2\0"
+    "TRACKER_FULL_ALLCH\0"
+    "TRACKER_NE_CH0\0"
+    "TRACKER_NE_CH1\0"
+    "TRACKER_NE_CH2\0"
+    "TRACKER_NE_ALLCH\0"
+    "TRACKER_OCCUPANCY_CH0\0"
+    "TRACKER_OCCUPANCY_CH1\0"
+    "TRACKER_OCCUPANCY_CH2\0"
+    "TRACKER_OCCUPANCY_ALLCH\0"
+    "TRACKER_INSERTS_CH0\0"
+    "TRACKER_INSERTS_CH1\0"
+    "TRACKER_INSERTS_CH2\0"
+    "TRACKER_INSERTS_ALLCH\0"
+    "WR_TRACKER_FULL_CH0\0"
+    "WR_TRACKER_FULL_CH1\0"
+    "WR_TRACKER_FULL_CH2\0"
+    "WR_TRACKER_FULL_MIRR\0"
+    "WR_TRACKER_FULL_ALLCH\0"
+    "WR_TRACKER_INSERTS_CH0\0"
+    "WR_TRACKER_INSERTS_CH1\0"
+    "WR_TRACKER_INSERTS_CH2\0"
+    "WR_TRACKER_INSERTS_ALLCH\0"
+    "WR_TRACKER_NE_CH0\0"
+    "WR_TRACKER_NE_CH1\0"
+    "WR_TRACKER_NE_CH2\0"
+    "WR_TRACKER_NE_MIRR\0"
+    "WR_TRACKER_NE_MIRR_NONTGR\0"
+    "WR_TRACKER_NE_MIRR_PWR\0"
+    "WR_TRACKER_NE_ALLCH\0"
+    "WR_TRACKER_OCCUPANCY_CH0\0"
+    "WR_TRACKER_OCCUPANCY_CH1\0"
+    "WR_TRACKER_OCCUPANCY_CH2\0"
+    "WR_TRACKER_OCCUPANCY_MIRR\0"
+    "WR_TRACKER_OCCUPANCY_MIRR_NONTGR\0"
+    "WR_TRACKER_OCCUPANCY_MIRR_PWR\0"
+    "WR_TRACKER_OCCUPANCY_ALLCH\0"
+    "WR_TRACKER_NONPOSTED_INSERTS_CH0\0"
+    "WR_TRACKER_NONPOSTED_INSERTS_CH1\0"
+    "WR_TRACKER_NONPOSTED_INSERTS_CH2\0"
+    "WR_TRACKER_NONPOSTED_INSERTS_ALLCH\0"
+    "WR_TRACKER_NONPOSTED_OCCUPANCY_CH0\0"
+    "WR_TRACKER_NONPOSTED_OCCUPANCY_CH1\0"
+    "WR_TRACKER_NONPOSTED_OCCUPANCY_CH2\0"
+    "WR_TRACKER_NONPOSTED_OCCUPANCY_ALLCH\0"
+    "WR_TRACKER_POSTED_INSERTS_CH0\0"
+    "WR_TRACKER_POSTED_INSERTS_CH1\0"
+    "WR_TRACKER_POSTED_INSERTS_CH2\0"
+    "WR_TRACKER_POSTED_INSERTS_ALLCH\0"
+    "WR_TRACKER_POSTED_OCCUPANCY_CH0\0"
+    "WR_TRACKER_POSTED_OCCUPANCY_CH1\0"
+    "WR_TRACKER_POSTED_OCCUPANCY_CH2\0"
+    "WR_TRACKER_POSTED_OCCUPANCY_ALLCH\0"
+    "PREFCAM_CYCLES_FULL_CH0\0"
+    "PREFCAM_CYCLES_FULL_CH1\0"
+    "PREFCAM_CYCLES_FULL_CH2\0"
+    "PREFCAM_CYCLES_FULL_ALLCH\0"
+    "PREFCAM_CYCLES_NE_CH0\0"
+    "PREFCAM_CYCLES_NE_CH1\0"
+    "PREFCAM_CYCLES_NE_CH2\0"
+    "PREFCAM_CYCLES_NE_ALLCH\0"
+    "PREFCAM_OCCUPANCY_CH0\0"
+    "PREFCAM_OCCUPANCY_CH1\0"
+    "PREFCAM_OCCUPANCY_CH2\0"
+    "PREFCAM_OCCUPANCY_ALLCH\0"
+    "PREFCAM_RESP_MISS_CH0\0"
+    "PREFCAM_RESP_MISS_CH1\0"
+    "PREFCAM_RESP_MISS_CH2\0"
+    "PREFCAM_RESP_MISS_ALLCH\0"
+    "PREFCAM_DEALLOCS_CH0_HITA0_INVAL\0"
+    "PREFCAM_DEALLOCS_CH0_HITA1_INVAL\0"
+    "PREFCAM_DEALLOCS_CH0_MISS_INVAL\0"
+    "PREFCAM_DEALLOCS_CH0_RSP_PDRESET\0"
+    "PREFCAM_DEALLOCS_CH1_HITA0_INVAL\0"
+    "PREFCAM_DEALLOCS_CH1_HITA1_INVAL\0"
+    "PREFCAM_DEALLOCS_CH1_MISS_INVAL\0"
+    "PREFCAM_DEALLOCS_CH1_RSP_PDRESET\0"
+    "PREFCAM_DEALLOCS_CH2_HITA0_INVAL\0"
+    "PREFCAM_DEALLOCS_CH2_HITA1_INVAL\0"
+    "PREFCAM_DEALLOCS_CH2_MISS_INVAL\0"
+    "PREFCAM_DEALLOCS_CH2_RSP_PDRESET\0"
+    "PREFCAM_DEALLOCS_HITA0_INVAL_ALLCH\0"
+    "PREFCAM_DEALLOCS_HITA1_INVAL_ALLCH\0"
+    "PREFCAM_DEALLOCS_MISS_INVAL_ALLCH\0"
+    "PREFCAM_DEALLOCS_RSP_PDRESET_ALLCH\0"
+    "PREFCAM_DEMAND_DROPS_CH0_XPT\0"
+    "PREFCAM_DEMAND_DROPS_CH0_UPI\0"
+    "PREFCAM_DEMAND_DROPS_CH1_XPT\0"
+    "PREFCAM_DEMAND_DROPS_CH1_UPI\0"
+    "PREFCAM_DEMAND_DROPS_CH2_XPT\0"
+    "PREFCAM_DEMAND_DROPS_CH2_UPI\0"
+    "PREFCAM_DEMAND_DROPS_XPT_ALLCH\0"
+    "PREFCAM_DEMAND_DROPS_UPI_ALLCH\0"
+    "PREFCAM_DEMAND_MERGE_CH0_XPT\0"
+    "PREFCAM_DEMAND_MERGE_CH0_UPI\0"
+    "PREFCAM_DEMAND_MERGE_CH1_XPT\0"
+    "PREFCAM_DEMAND_MERGE_CH1_UPI\0"
+    "PREFCAM_DEMAND_MERGE_CH2_XPT\0"
+    "PREFCAM_DEMAND_MERGE_CH2_UPI\0"
+    "PREFCAM_DEMAND_MERGE_XPT_ALLCH\0"
+    "PREFCAM_DEMAND_MERGE_UPI_ALLCH\0"
+    "PREFCAM_DROP_REASONS_CH0_PF_SECURE_DROP\0"
+    "PREFCAM_DROP_REASONS_CH0_NOT_PF_SAD_REGION\0"
+    "PREFCAM_DROP_REASONS_CH0_PF_CAM_HIT\0"
+    "PREFCAM_DROP_REASONS_CH0_STOP_B2B\0"
+    "PREFCAM_DROP_REASONS_CH0_ERRORBLK_RXC\0"
+    "PREFCAM_DROP_REASONS_CH0_PF_AD_CRD\0"
+    "PREFCAM_DROP_REASONS_CH0_PF_CAM_FULL\0"
+    "PREFCAM_DROP_REASONS_CH0_WPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH0_RPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH0_XPT_THRESH\0"
+    "PREFCAM_DROP_REASONS_CH0_UPI_THRESH\0"
+    "PREFCAM_DROP_REASONS_CH1_PF_SECURE_DROP\0"
+    "PREFCAM_DROP_REASONS_CH1_NOT_PF_SAD_REGION\0"
+    "PREFCAM_DROP_REASONS_CH1_PF_CAM_HIT\0"
+    "PREFCAM_DROP_REASONS_CH1_STOP_B2B\0"
+    "PREFCAM_DROP_REASONS_CH1_ERRORBLK_RXC\0"
+    "PREFCAM_DROP_REASONS_CH1_PF_AD_CRD\0"
+    "PREFCAM_DROP_REASONS_CH1_PF_CAM_FULL\0"
+    "PREFCAM_DROP_REASONS_CH1_WPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH1_RPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH1_XPT_THRESH\0"
+    "PREFCAM_DROP_REASONS_CH1_UPI_THRESH\0"
+    "PREFCAM_DROP_REASONS_CH2_PF_SECURE_DROP\0"
+    "PREFCAM_DROP_REASONS_CH2_NOT_PF_SAD_REGION\0"
+    "PREFCAM_DROP_REASONS_CH2_PF_CAM_HIT\0"
+    "PREFCAM_DROP_REASONS_CH2_STOP_B2B\0"
+    "PREFCAM_DROP_REASONS_CH2_ERRORBLK_RXC\0"
+    "PREFCAM_DROP_REASONS_CH2_PF_AD_CRD\0"
+    "PREFCAM_DROP_REASONS_CH2_PF_CAM_FULL\0"
+    "PREFCAM_DROP_REASONS_CH2_WPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH2_RPQ_PROXY\0"
+    "PREFCAM_DROP_REASONS_CH2_XPT_THRESH\0"
+    "PREFCAM_DROP_REASONS_CH2_UPI_THRESH\0"
+    "PREFCAM_INSERTS_CH0_XPT\0"
+    "PREFCAM_INSERTS_CH0_UPI\0"
+    "PREFCAM_INSERTS_CH1_XPT\0"
+    "PREFCAM_INSERTS_CH1_UPI\0"
+    "PREFCAM_INSERTS_CH2_XPT\0"
+    "PREFCAM_INSERTS_CH2_UPI\0"
+    "PREFCAM_INSERTS_XPT_ALLCH\0"
+    "PREFCAM_INSERTS_UPI_ALLCH\0"
+    "PREFCAM_RXC_DEALLOCS_SQUASHED\0"
+    "PREFCAM_RXC_DEALLOCS_1LM_POSTED\0"
+    "PREFCAM_RXC_DEALLOCS_PMM_MEMMODE_ACCEPT\0"
+    "PREFCAM_RXC_DEALLOCS_CIS\0"
+    "PREFCAM_CIS_DROPS\0"
+    "PREFCAM_RXC_CYCLES_NE\0"
+    "PREFCAM_RXC_INSERTS\0"
+    "PREFCAM_RXC_OCCUPANCY\0"
+    "CMI_CH0_RPQ_PROXY_CYCLES_NE\0"
+    "CMI_CH0_RPQ_PROXY_OCCUPANCY\0"
+    "CMI_CH0_WPQ_PROXY_CYCLES_NE\0"
+    "CMI_CH0_WPQ_PROXY_OCCUPANCY\0"
+    "MIRR_WRQ_INSERTS\0"
+    "MIRR_WRQ_OCCUPANCY\0"
+    "SCOREBOARD_AD_RETRY_ACCEPTS\0"
+    "SCOREBOARD_AD_RETRY_REJECTS\0"
+    "SCOREBOARD_BL_RETRY_ACCEPTS\0"
+    "SCOREBOARD_BL_RETRY_REJECTS\0"
+    "SCOREBOARD_RD_ACCEPTS\0"
+    "SCOREBOARD_RD_REJECTS\0"
+    "SCOREBOARD_WR_ACCEPTS\0"
+    "SCOREBOARD_WR_REJECTS\0"
+    "TGR_AD_CREDITS\0"
+    "TGR_BL_CREDITS\0"
+    "M2M_CLOCKTICKS\0"
+    "PCI_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDITS_ACQUIRED_DRS_0\0"
+    "IIO_CREDITS_ACQUIRED_DRS_1\0"
+    "IIO_CREDITS_ACQUIRED_NCB_0\0"
+    "IIO_CREDITS_ACQUIRED_NCB_1\0"
+    "IIO_CREDITS_ACQUIRED_NCS_0\0"
+    "IIO_CREDITS_ACQUIRED_NCS_1\0"
+    "IIO_CREDITS_ACQUIRED_DRS_ANY\0"
+    "IIO_CREDITS_ACQUIRED_NCB_ANY\0"
+    "IIO_CREDITS_ACQUIRED_NCS_ANY\0"
+    "IIO_CREDITS_REJECT_DRS\0"
+    "IIO_CREDITS_REJECT_NCB\0"
+    "IIO_CREDITS_REJECT_NCS\0"
+    "IIO_CREDITS_USED_DRS_0\0"
+    "IIO_CREDITS_USED_DRS_1\0"
+    "IIO_CREDITS_USED_NCB_0\0"
+    "IIO_CREDITS_USED_NCB_1\0"
+    "IIO_CREDITS_USED_NCS_0\0"
+    "IIO_CREDITS_USED_NCS_1\0"
+    "IIO_CREDITS_USED_DRS_ANY\0"
+    "IIO_CREDITS_USED_NCB_ANY\0"
+    "IIO_CREDITS_USED_NCS_ANY\0"
+    "RXC_CYCLES_NE_UPI_NCS\0"
+    "RXC_CYCLES_NE_UPI_NCB\0"
+    "RXC_CYCLES_NE_IIO_NCB\0"
+    "RXC_CYCLES_NE_IIO_NCS\0"
+    "RXC_CYCLES_NE_ALL\0"
+    "RXC_INSERTS_UPI_NCB\0"
+    "RXC_INSERTS_UPI_NCS\0"
+    "RXC_INSERTS_IIO_NCB\0"
+    "RXC_INSERTS_IIO_NCS\0"
+    "RXC_INSERTS_ALL\0"
+    "TXC_CYCLES_FULL_AD_0\0"
+    "TXC_CYCLES_FULL_AK_0\0"
+    "TXC_CYCLES_FULL_BL_0\0"
+    "TXC_CYCLES_FULL_PMM_BLOCK_1\0"
+    "TXC_CYCLES_FULL_AD_1\0"
+    "TXC_CYCLES_FULL_AK_1\0"
+    "TXC_CYCLES_FULL_BL_1\0"
+    "TXC_CYCLES_FULL_PMM_BLOCK_0\0"
+    "TXC_CYCLES_FULL_AD_ANY\0"
+    "TXC_CYCLES_FULL_AK_ANY\0"
+    "TXC_CYCLES_FULL_BL_ANY\0"
+    "TXC_CYCLES_FULL_PMM_ANY\0"
+    "TXC_CYCLES_NE_AD_0\0"
+    "TXC_CYCLES_NE_AK_0\0"
+    "TXC_CYCLES_NE_BL_0\0"
+    "TXC_CYCLES_NE_PMM_DISTRESS_1\0"
+    "TXC_CYCLES_NE_AD_1\0"
+    "TXC_CYCLES_NE_AK_1\0"
+    "TXC_CYCLES_NE_BL_1\0"
+    "TXC_CYCLES_NE_PMM_DISTRESS_0\0"
+    "TXC_CYCLES_NE_AD_ANY\0"
+    "TXC_CYCLES_NE_AK_ANY\0"
+    "TXC_CYCLES_NE_BL_ANY\0"
+    "TXC_CYCLES_NE_PMM_DISTRESS_ANY\0"
+    "TXC_INSERTS_AD_0\0"
+    "TXC_INSERTS_BL_0\0"
+    "TXC_INSERTS_AK_CRD_0\0"
+    "TXC_INSERTS_AD_1\0"
+    "TXC_INSERTS_BL_1\0"
+    "TXC_INSERTS_AK_CRD_1\0"
+    "TXC_INSERTS_AD_ANY\0"
+    "TXC_INSERTS_BL_ANY\0"
+    "TXC_INSERTS_AK_CRD_ANY\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF0_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF0_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF1_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF1_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF2_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF2_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF3_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_M2IOSF3_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_ANY_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_0_ANY_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_M2IOSF4_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_M2IOSF4_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_M2IOSF5_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_M2IOSF5_NCS\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_ANY_NCB\0"
+    "LOCAL_DED_P2P_CRD_TAKEN_1_ANY_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF0_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF0_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF1_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF1_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF2_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF2_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF3_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_0_MS2IOSF3_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_0_ANY_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_0_ANY_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_1_MS2IOSF4_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_1_MS2IOSF4_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_1_MS2IOSF5_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_1_MS2IOSF5_NCS\0"
+    "LOCAL_P2P_DED_RETURNED_1_ANY_NCB\0"
+    "LOCAL_P2P_DED_RETURNED_1_ANY_NCS\0"
+    "LOCAL_P2P_SHAR_RETURNED_AGENT_0\0"
+    "LOCAL_P2P_SHAR_RETURNED_AGENT_1\0"
+    "LOCAL_P2P_SHAR_RETURNED_AGENT_2\0"
+    "LOCAL_P2P_SHAR_RETURNED_ANY\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_0\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_1\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_2\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_3\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_4\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_AGENT_5\0"
+    "LOCAL_SHAR_P2P_CRD_RETURNED_ANY\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF0_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF0_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF1_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF1_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF2_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF2_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF3_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_M2IOSF3_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_ANY_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_0_ANY_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_M2IOSF4_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_M2IOSF4_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_M2IOSF5_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_M2IOSF5_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_ANY_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_TAKEN_1_ANY_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF0_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF0_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF1_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF1_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF2_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF2_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF3_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_M2IOSF3_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_ANY_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_0_ANY_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_M2IOSF4_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_M2IOSF4_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_M2IOSF5_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_M2IOSF5_NCS\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_ANY_NCB\0"
+    "LOCAL_SHAR_P2P_CRD_WAIT_1_ANY_NCS\0"
+    "P2P_CRD_OCCUPANCY_LOCAL_NCB\0"
+    "PBOX0C0|PBOX0C1|PBOX1C0|PBOX1C1\0"
+    "P2P_CRD_OCCUPANCY_LOCAL_NCS\0"
+    "P2P_CRD_OCCUPANCY_REMOTE_NCB\0"
+    "P2P_CRD_OCCUPANCY_REMOTE_NCS\0"
+    "P2P_CRD_OCCUPANCY_ALL\0"
+    "P2P_DED_RECEIVED_LOCAL_NCB\0"
+    "P2P_DED_RECEIVED_LOCAL_NCS\0"
+    "P2P_DED_RECEIVED_REMOTE_NCB\0"
+    "P2P_DED_RECEIVED_REMOTE_NCS\0"
+    "P2P_DED_RECEIVED_ALL\0"
+    "P2P_SHAR_RECEIVED_LOCAL_NCB\0"
+    "P2P_SHAR_RECEIVED_LOCAL_NCS\0"
+    "P2P_SHAR_RECEIVED_REMOTE_NCB\0"
+    "P2P_SHAR_RECEIVED_REMOTE_NCS\0"
+    "P2P_SHAR_RECEIVED_ALL\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI0_DRS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI0_NCB\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI0_NCS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI1_DRS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI1_NCB\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_UPI1_NCS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_ANY_DRS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_ANY_NCB\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_0_ANY_NCS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_1_UPI2_DRS\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_1_UPI2_NCB\0"
+    "REMOTE_DED_P2P_CRD_TAKEN_1_UPI2_NCS\0"
+    "REMOTE_P2P_DED_RETURNED_UPI0_NCB\0"
+    "REMOTE_P2P_DED_RETURNED_UPI0_NCS\0"
+    "REMOTE_P2P_DED_RETURNED_UPI1_NCB\0"
+    "REMOTE_P2P_DED_RETURNED_UPI1_NCS\0"
+    "REMOTE_P2P_DED_RETURNED_UPI2_NCB\0"
+    "REMOTE_P2P_DED_RETURNED_UPI2_NCS\0"
+    "REMOTE_P2P_DED_RETURNED_ANY_NCB\0"
+    "REMOTE_P2P_DED_RETURNED_ANY_NCS\0"
+    "REMOTE_P2P_SHAR_RETURNED_AGENT_0\0"
+    "REMOTE_P2P_SHAR_RETURNED_AGENT_1\0"
+    "REMOTE_P2P_SHAR_RETURNED_AGENT_2\0"
+    "REMOTE_P2P_SHAR_RETURNED_ANY\0"
+    "REMOTE_SHAR_P2P_CRD_RETURNED_AGENT_0\0"
+    "REMOTE_SHAR_P2P_CRD_RETURNED_AGENT_1\0"
+    "REMOTE_SHAR_P2P_CRD_RETURNED_AGENT_2\0"
+    "REMOTE_SHAR_P2P_CRD_RETURNED_ANY\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI0_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI0_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI0_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI1_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI1_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_UPI1_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_ANY_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_ANY_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_0_ANY_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_1_UPI2_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_1_UPI2_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_TAKEN_1_UPI2_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI0_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI0_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI0_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI1_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI1_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_UPI1_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_ANY_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_ANY_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_0_ANY_NCS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_1_UPI2_DRS\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_1_UPI2_NCB\0"
+    "REMOTE_SHAR_P2P_CRD_WAIT_1_UPI2_NCS\0"
+    "RXC_CYCLES_NE_CHA_IDI\0"
+    "RXC_CYCLES_NE_CHA_NCB\0"
+    "RXC_CYCLES_NE_CHA_NCS\0"
+    "RXC_INSERTS_CHA_IDI\0"
+    "RXC_INSERTS_CHA_NCB\0"
+    "RXC_INSERTS_CHA_NCS\0"
+    "TXC_CREDITS_PRQ\0"
+    "TXC_CREDITS_PMM\0"
+    "AD_CREDITS_EMPTY_VNA\0"
+    "SBOX\0"
+    "AD_CREDITS_EMPTY_WB\0"
+    "AD_CREDITS_EMPTY_REQ\0"
+    "AD_CREDITS_EMPTY_SNP\0"
+    "BL_CREDITS_EMPTY_IIO1_NCB\0"
+    "BL_CREDITS_EMPTY_IIO2_NCB\0"
+    "BL_CREDITS_EMPTY_IIO3_NCB\0"
+    "BL_CREDITS_EMPTY_IIO4_NCB\0"
+    "BL_CREDITS_EMPTY_IIO5_NCB\0"
+    "BL_CREDITS_EMPTY_UBOX_NCB\0"
+    "BL_CREDITS_EMPTY_NCS\0"
+    "BL_CREDITS_EMPTY_NCS_SEL\0"
+    "BL_CREDITS_EMPTY_ANY_NCB\0"
+    "MULTI_SLOT_RCVD_AD_SLOT0\0"
+    "MULTI_SLOT_RCVD_AD_SLOT1\0"
+    "MULTI_SLOT_RCVD_AD_SLOT2\0"
+    "MULTI_SLOT_RCVD_BL_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT2\0"
+    "MULTI_SLOT_RCVD_AD_ANY\0"
+    "MULTI_SLOT_RCVD_AK_ANY\0"
+    "RXC_ARB_LOST_VN0_AD_REQ\0"
+    "RXC_ARB_LOST_VN0_AD_SNP\0"
+    "RXC_ARB_LOST_VN0_AD_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_WB\0"
+    "RXC_ARB_LOST_VN0_BL_NCB\0"
+    "RXC_ARB_LOST_VN0_BL_NCS\0"
+    "RXC_ARB_LOST_VN1_AD_REQ\0"
+    "RXC_ARB_LOST_VN1_AD_SNP\0"
+    "RXC_ARB_LOST_VN1_AD_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_WB\0"
+    "RXC_ARB_LOST_VN1_BL_NCB\0"
+    "RXC_ARB_LOST_VN1_BL_NCS\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN1\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN1\0"
+    "RXC_ARB_MISC_ADBL_PARALLEL_WIN_VN0\0"
+    "RXC_ARB_MISC_ADBL_PARALLEL_WIN_VN1\0"
+    "RXC_ARB_MISC_VN01_PARALLEL_WIN\0"
+    "RXC_ARB_MISC_ALL_PARALLEL_WIN\0"
+    "RXC_ARB_NOCRD_VN0_AD_REQ\0"
+    "RXC_ARB_NOCRD_VN0_AD_SNP\0"
+    "RXC_ARB_NOCRD_VN0_AD_RSP\0"
+    "RXC_ARB_NOCRD_VN0_BL_RSP\0"
+    "RXC_ARB_NOCRD_VN0_BL_WB\0"
+    "RXC_ARB_NOCRD_VN0_BL_NCB\0"
+    "RXC_ARB_NOCRD_VN0_BL_NCS\0"
+    "RXC_ARB_NOCRD_VN1_AD_REQ\0"
+    "RXC_ARB_NOCRD_VN1_AD_SNP\0"
+    "RXC_ARB_NOCRD_VN1_AD_RSP\0"
+    "RXC_ARB_NOCRD_VN1_BL_RSP\0"
+    "RXC_ARB_NOCRD_VN1_BL_WB\0"
+    "RXC_ARB_NOCRD_VN1_BL_NCB\0"
+    "RXC_ARB_NOCRD_VN1_BL_NCS\0"
+    "RXC_ARB_NOREQ_VN0_AD_REQ\0"
+    "RXC_ARB_NOREQ_VN0_AD_SNP\0"
+    "RXC_ARB_NOREQ_VN0_AD_RSP\0"
+    "RXC_ARB_NOREQ_VN0_BL_RSP\0"
+    "RXC_ARB_NOREQ_VN0_BL_WB\0"
+    "RXC_ARB_NOREQ_VN0_BL_NCB\0"
+    "RXC_ARB_NOREQ_VN0_BL_NCS\0"
+    "RXC_ARB_NOREQ_VN1_AD_REQ\0"
+    "RXC_ARB_NOREQ_VN1_AD_SNP\0"
+    "RXC_ARB_NOREQ_VN1_AD_RSP\0"
+    "RXC_ARB_NOREQ_VN1_BL_RSP\0"
+    "RXC_ARB_NOREQ_VN1_BL_WB\0"
+    "RXC_ARB_NOREQ_VN1_BL_NCB\0"
+    "RXC_ARB_NOREQ_VN1_BL_NCS\0"
+    "RXC_BYPASSED_AD_S0_IDLE\0"
+    "SBOX0C0|SBOX0C1|SBOX0C2|SBOX1C0|SBOX1C1|SBOX1C2|SBOX2C0|SBOX2C1|SBOX2C2\0"
+    "RXC_BYPASSED_AD_S0_BL_ARB\0"
+    "RXC_BYPASSED_AD_S1_BL_SLOT\0"
+    "RXC_BYPASSED_AD_S2_BL_SLOT\0"
+    "RXC_CRD_MISC_ANY_BGF_FIFO\0"
+    "RXC_CRD_MISC_ANY_BGF_PATH\0"
+    "RXC_CRD_MISC_VN0_NO_D2K_FOR_ARB\0"
+    "RXC_CRD_MISC_VN1_NO_D2K_FOR_ARB\0"
+    "RXC_CRD_MISC_LT1_FOR_D2K\0"
+    "RXC_CRD_MISC_LT2_FOR_D2K\0"
+    "RXC_CRD_OCC_VNA_IN_USE\0"
+    "RXC_CRD_OCC_FLITS_IN_FIFO\0"
+    "RXC_CRD_OCC_FLITS_IN_PATH\0"
+    "RXC_CRD_OCC_D2K_CRD\0"
+    "RXC_CRD_OCC_P1P_TOTAL\0"
+    "RXC_CRD_OCC_P1P_FIFO\0"
+    "RXC_CRD_OCC_CONSUMED\0"
+    "RXC_CYCLES_NE_VN0_AD_REQ\0"
+    "RXC_CYCLES_NE_VN0_AD_SNP\0"
+    "RXC_CYCLES_NE_VN0_AD_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_WB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCS\0"
+    "RXC_CYCLES_NE_VN1_AD_REQ\0"
+    "RXC_CYCLES_NE_VN1_AD_SNP\0"
+    "RXC_CYCLES_NE_VN1_AD_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_WB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCS\0"
+    "RXC_DATA_FLITS_NOT_SENT_ALL\0"
+    "RXC_DATA_FLITS_NOT_SENT_TSV_HI\0"
+    "RXC_DATA_FLITS_NOT_SENT_VALID_FOR_FLIT\0"
+    "RXC_DATA_FLITS_NOT_SENT_NO_BGF\0"
+    "RXC_DATA_FLITS_NOT_SENT_NO_TXQ\0"
+    "RXC_FLITS_GEN_BL_P0_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1P_TO_LIMBO\0"
+    "RXC_FLITS_GEN_BL_P1P_BUSY\0"
+    "RXC_FLITS_GEN_BL_P1P_AT_LIMIT\0"
+    "RXC_FLITS_GEN_BL_P1P_HOLD_P0\0"
+    "RXC_FLITS_GEN_BL_P1P_FIFO_FULL\0"
+    "RXC_FLITS_MISC_S2REQ_RECEIVED\0"
+    "RXC_FLITS_MISC_S2REQ_WITHDRAWN\0"
+    "RXC_FLITS_MISC_S2REQ_IN_HOLDOFF\0"
+    "RXC_FLITS_MISC_S2REQ_IN_SERVICE\0"
+    "RXC_FLITS_SLOT_BL_ALL\0"
+    "RXC_FLITS_SLOT_BL_NEED_DATA\0"
+    "RXC_FLITS_SLOT_BL_P0_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_BUT_BUBBLE\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_NOT_AVAIL\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_READ\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_WASTED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_BLOCKED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG1_DURING\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG2_AFTER\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG2_SENT\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG1_AFTER\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL_NOMSG\0"
+    "RXC_FLIT_GEN_HDR2_PAR\0"
+    "RXC_FLIT_GEN_HDR2_PAR_MSG\0"
+    "RXC_FLIT_GEN_HDR2_PAR_FLIT\0"
+    "RXC_HDR_FLITS_SENT_1_MSG\0"
+    "RXC_HDR_FLITS_SENT_2_MSGS\0"
+    "RXC_HDR_FLITS_SENT_3_MSGS\0"
+    "RXC_HDR_FLITS_SENT_1_MSG_VNX\0"
+    "RXC_HDR_FLITS_SENT_SLOTS_1\0"
+    "RXC_HDR_FLITS_SENT_SLOTS_2\0"
+    "RXC_HDR_FLITS_SENT_SLOTS_3\0"
+    "RXC_HDR_FLIT_NOT_SENT_ALL\0"
+    "RXC_HDR_FLIT_NOT_SENT_TSV_HI\0"
+    "RXC_HDR_FLIT_NOT_SENT_VALID_FOR_FLIT\0"
+    "RXC_HDR_FLIT_NOT_SENT_NO_BGF_CRD\0"
+    "RXC_HDR_FLIT_NOT_SENT_NO_TXQ_CRD\0"
+    "RXC_HDR_FLIT_NOT_SENT_NO_BGF_NO_MSG\0"
+    "RXC_HDR_FLIT_NOT_SENT_NO_TXQ_NO_MSG\0"
+    "RXC_HELD_VN0\0"
+    "RXC_HELD_VN1\0"
+    "RXC_HELD_PARALLEL_ATTEMPT\0"
+    "RXC_HELD_PARALLEL_SUCCESS\0"
+    "RXC_HELD_CANT_SLOT_AD\0"
+    "RXC_HELD_CANT_SLOT_BL\0"
+    "RXC_INSERTS_VN0_AD_REQ\0"
+    "RXC_INSERTS_VN0_AD_SNP\0"
+    "RXC_INSERTS_VN0_AD_RSP\0"
+    "RXC_INSERTS_VN0_BL_RSP\0"
+    "RXC_INSERTS_VN0_BL_WB\0"
+    "RXC_INSERTS_VN0_BL_NCB\0"
+    "RXC_INSERTS_VN0_BL_NCS\0"
+    "RXC_INSERTS_VN1_AD_REQ\0"
+    "RXC_INSERTS_VN1_AD_SNP\0"
+    "RXC_INSERTS_VN1_AD_RSP\0"
+    "RXC_INSERTS_VN1_BL_RSP\0"
+    "RXC_INSERTS_VN1_BL_WB\0"
+    "RXC_INSERTS_VN1_BL_NCB\0"
+    "RXC_INSERTS_VN1_BL_NCS\0"
+    "RXC_OCCUPANCY_VN0_AD_REQ\0"
+    "RXC_OCCUPANCY_VN0_AD_SNP\0"
+    "RXC_OCCUPANCY_VN0_AD_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_WB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCS\0"
+    "RXC_OCCUPANCY_VN1_AD_REQ\0"
+    "RXC_OCCUPANCY_VN1_AD_SNP\0"
+    "RXC_OCCUPANCY_VN1_AD_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_WB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCS\0"
+    "RXC_PACKING_MISS_VN0_AD_REQ\0"
+    "RXC_PACKING_MISS_VN0_AD_SNP\0"
+    "RXC_PACKING_MISS_VN0_AD_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_WB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCS\0"
+    "RXC_PACKING_MISS_VN1_AD_REQ\0"
+    "RXC_PACKING_MISS_VN1_AD_SNP\0"
+    "RXC_PACKING_MISS_VN1_AD_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_WB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCS\0"
+    "RXC_VNA_CRD_CORRECTED\0"
+    "RXC_VNA_CRD_LT1\0"
+    "RXC_VNA_CRD_LT4\0"
+    "RXC_VNA_CRD_LT5\0"
+    "RXC_VNA_CRD_LT10\0"
+    "RXC_VNA_CRD_ANY_IN_USE\0"
+    "RXC_VNA_CRD_MISC_REQ_VN01_ALLOC_LT10\0"
+    "RXC_VNA_CRD_MISC_REQ_ADBL_ALLOC_L5\0"
+    "RXC_VNA_CRD_MISC_VN0_ONLY\0"
+    "RXC_VNA_CRD_MISC_VN1_ONLY\0"
+    "RXC_VNA_CRD_MISC_VN0_JUST_AD\0"
+    "RXC_VNA_CRD_MISC_VN0_JUST_BL\0"
+    "RXC_VNA_CRD_MISC_VN1_JUST_AD\0"
+    "RXC_VNA_CRD_MISC_VN1_JUST_BL\0"
+    "TXC_AD_ARB_FAIL_VN0_REQ\0"
+    "TXC_AD_ARB_FAIL_VN0_SNP\0"
+    "TXC_AD_ARB_FAIL_VN0_RSP\0"
+    "TXC_AD_ARB_FAIL_VN0_WB\0"
+    "TXC_AD_ARB_FAIL_VN1_REQ\0"
+    "TXC_AD_ARB_FAIL_VN1_SNP\0"
+    "TXC_AD_ARB_FAIL_VN1_RSP\0"
+    "TXC_AD_ARB_FAIL_VN1_WB\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT0\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT1\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT2\0"
+    "TXC_AD_FLQ_BYPASS_BL_EARLY_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN0_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN0_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN1_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN1_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_REQ\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_REQ\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_BL_ARB_FAIL_VN0_RSP\0"
+    "TXC_BL_ARB_FAIL_VN0_WB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCS\0"
+    "TXC_BL_ARB_FAIL_VN1_RSP\0"
+    "TXC_BL_ARB_FAIL_VN1_WB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCS\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN0_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_RSP\0"
+    "SBOX0C0|SBOX1C0|SBOX2C0\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCS\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCS\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN0_LOCAL\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN0_THROUGH\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN0_WRPULL\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN1_LOCAL\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN1_THROUGH\0"
+    "TXC_BL_WB_FLQ_OCCUPANCY_VN1_WRPULL\0"
+    "TXC_AK_FLQ_INSERTS\0"
+    "TXC_AK_FLQ_OCCUPANCY\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_WB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_WB\0"
+    "VN0_CREDITS_USED_REQ\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_RSP\0"
+    "VN0_CREDITS_USED_WB\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN0_NO_CREDITS_REQ\0"
+    "VN0_NO_CREDITS_SNP\0"
+    "VN0_NO_CREDITS_RSP\0"
+    "VN0_NO_CREDITS_WB\0"
+    "VN0_NO_CREDITS_NCB\0"
+    "VN0_NO_CREDITS_NCS\0"
+    "VN1_CREDITS_USED_REQ\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_RSP\0"
+    "VN1_CREDITS_USED_WB\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VN1_NO_CREDITS_REQ\0"
+    "VN1_NO_CREDITS_SNP\0"
+    "VN1_NO_CREDITS_RSP\0"
+    "VN1_NO_CREDITS_WB\0"
+    "VN1_NO_CREDITS_NCB\0"
+    "VN1_NO_CREDITS_NCS\0"
+    "WB_OCC_COMPARE_RT_GT_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_RT_EQ_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_RT_LT_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_RT_GT_LOCALDEST_VN1\0"
+    "WB_OCC_COMPARE_RT_EQ_LOCALDEST_VN1\0"
+    "WB_OCC_COMPARE_RT_LT_LOCALDEST_VN1\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_GT_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_EQ_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_LT_LOCALDEST_VN0\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_GT_LOCALDEST_VN1\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_EQ_LOCALDEST_VN1\0"
+    "WB_OCC_COMPARE_BOTHNONZERO_RT_LT_LOCALDEST_VN1\0"
+    "WB_PENDING_LOCALDEST_VN0\0"
+    "WB_PENDING_ROUTETHRU_VN0\0"
+    "WB_PENDING_LOCAL_AND_RT_VN0\0"
+    "WB_PENDING_WAITING4PULL_VN0\0"
+    "WB_PENDING_LOCALDEST_VN1\0"
+    "WB_PENDING_ROUTETHRU_VN1\0"
+    "WB_PENDING_LOCAL_AND_RT_VN1\0"
+    "WB_PENDING_WAITING4PULL_VN1\0"
+    "XPT_PFTCH_ARRIVED\0"
+    "XPT_PFTCH_BYPASS\0"
+    "XPT_PFTCH_ARB\0"
+    "XPT_PFTCH_LOST_ARB\0"
+    "XPT_PFTCH_FLITTED\0"
+    "XPT_PFTCH_LOST_OLD\0"
+    "XPT_PFTCH_LOST_QFULL\0"
+    "D2C_SENT\0"
+    "D2U_SENT\0"
+    "UPI_PREFETCH_SPAWN\0"
+    "UNCORE_CLOCKTICKS\0"
+    "UBOXFIX\0"
+    "EVENT_MSG_VLW_RCVD\0"
+    "UBOX\0"
+    "EVENT_MSG_MSI_RCVD\0"
+    "EVENT_MSG_IPI_RCVD\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "EVENT_MSG_INT_PRIO\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_DRNG_RDRAND\0"
+    "RACU_DRNG_RDSEED\0"
+    "RACU_DRNG_PFTCH_BUF_EMPTY\0"
+    "M2U_MISC1_RXC_CYCLES_NE_CBO_NCB\0"
+    "M2U_MISC1_RXC_CYCLES_NE_CBO_NCS\0"
+    "M2U_MISC1_RXC_CYCLES_NE_UPI_NCB\0"
+    "M2U_MISC1_RXC_CYCLES_NE_UPI_NCS\0"
+    "M2U_MISC1_TXC_CYCLES_CRD_OVF_CBO_NCB\0"
+    "M2U_MISC1_TXC_CYCLES_CRD_OVF_CBO_NCS\0"
+    "M2U_MISC1_TXC_CYCLES_CRD_OVF_UPI_NCB\0"
+    "M2U_MISC1_TXC_CYCLES_CRD_OVF_UPI_NCS\0"
+    "M2U_MISC2_RXC_CYCLES_FULL_BL\0"
+    "M2U_MISC2_RXC_CYCLES_EMPTY_BL\0"
+    "M2U_MISC2_TXC_CYCLES_CRD_OVF_VN0_NCB\0"
+    "M2U_MISC2_TXC_CYCLES_CRD_OVF_VN0_NCS\0"
+    "M2U_MISC2_TXC_CYCLES_EMPTY_BL\0"
+    "M2U_MISC2_TXC_CYCLES_EMPTY_AK\0"
+    "M2U_MISC2_TXC_CYCLES_EMPTY_AKC\0"
+    "M2U_MISC2_TXC_CYCLES_FULL_BL\0"
+    "M2U_MISC3_TXC_CYCLES_FULL_AK\0"
+    "M2U_MISC3_TXC_CYCLES_FULL_AKC\0"
+    "LOCK_CYCLES\0"
+    "RACU_REQUESTS\0"
+    "UPI_CLOCKTICKS\0"
+    "QBOX\0"
+    "DIRECT_ATTEMPTS_D2C\0"
+    "DIRECT_ATTEMPTS_D2K\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_BL_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ3\0"
+    "M3_BYP_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_BYP_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_BYP_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_BYP_BLOCKED_BGF_CRD\0"
+    "M3_BYP_BLOCKED_GV_BLOCK\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_BTW_2_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_BTW_0_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_RXQ_BLOCKED_BGF_CRD\0"
+    "M3_RXQ_BLOCKED_GV_BLOCK\0"
+    "M3_CRD_RETURN_BLOCKED\0"
+    "REQ_SLOT2_FROM_M3_VNA\0"
+    "REQ_SLOT2_FROM_M3_VN0\0"
+    "REQ_SLOT2_FROM_M3_VN1\0"
+    "REQ_SLOT2_FROM_M3_ACK\0"
+    "RXL_BASIC_HDR_MATCH_REQ\0"
+    "RXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "RXL_BASIC_HDR_MATCH_SNP\0"
+    "RXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_WB\0"
+    "RXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCB\0"
+    "RXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCS\0"
+    "RXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSPCNFLT\0"
+    "RXL_BASIC_HDR_MATCH_RSPI\0"
+    "RXL_BYPASSED_SLOT0\0"
+    "RXL_BYPASSED_SLOT1\0"
+    "RXL_BYPASSED_SLOT2\0"
+    "RXL_FLITS_SLOT0\0"
+    "RXL_FLITS_SLOT1\0"
+    "RXL_FLITS_SLOT2\0"
+    "RXL_FLITS_DATA\0"
+    "RXL_FLITS_LLCRD\0"
+    "RXL_FLITS_NULL\0"
+    "RXL_FLITS_IDLE\0"
+    "RXL_FLITS_PROTHDR\0"
+    "RXL_FLITS_SLOT0_DATA\0"
+    "RXL_FLITS_SLOT1_DATA\0"
+    "RXL_FLITS_SLOT2_DATA\0"
+    "RXL_FLITS_ALL_DATA\0"
+    "RXL_FLITS_SLOT0_LLCRD\0"
+    "RXL_FLITS_SLOT1_LLCRD\0"
+    "RXL_FLITS_SLOT2_LLCRD\0"
+    "RXL_FLITS_ALL_LLCRD\0"
+    "RXL_FLITS_SLOT0_NULL\0"
+    "RXL_FLITS_SLOT1_NULL\0"
+    "RXL_FLITS_SLOT2_NULL\0"
+    "RXL_FLITS_ALL_NULL\0"
+    "RXL_FLITS_SLOT0_IDLE\0"
+    "RXL_FLITS_SLOT1_IDLE\0"
+    "RXL_FLITS_SLOT2_IDLE\0"
+    "RXL_FLITS_ALL_IDLE\0"
+    "RXL_FLITS_SLOT0_PROTHDR\0"
+    "RXL_FLITS_SLOT1_PROTHDR\0"
+    "RXL_FLITS_SLOT2_PROTHDR\0"
+    "RXL_FLITS_ALL_PROTHDR\0"
+    "RXL_FLITS_NON_DATA\0"
+    "RXL_INSERTS_SLOT0\0"
+    "RXL_INSERTS_SLOT1\0"
+    "RXL_INSERTS_SLOT2\0"
+    "RXL_OCCUPANCY_SLOT0\0"
+    "RXL_OCCUPANCY_SLOT1\0"
+    "RXL_OCCUPANCY_SLOT2\0"
+    "RXL_SLOT_BYPASS_S0_RXQ1\0"
+    "RXL_SLOT_BYPASS_S0_RXQ2\0"
+    "RXL_SLOT_BYPASS_S1_RXQ0\0"
+    "RXL_SLOT_BYPASS_S1_RXQ2\0"
+    "RXL_SLOT_BYPASS_S2_RXQ0\0"
+    "RXL_SLOT_BYPASS_S2_RXQ1\0"
+    "TXL0P_CLK_ACTIVE_CFG_CTL\0"
+    "TXL0P_CLK_ACTIVE_RXQ\0"
+    "TXL0P_CLK_ACTIVE_RXQ_BYPASS\0"
+    "TXL0P_CLK_ACTIVE_RXQ_CRED\0"
+    "TXL0P_CLK_ACTIVE_TXQ\0"
+    "TXL0P_CLK_ACTIVE_RETRY\0"
+    "TXL0P_CLK_ACTIVE_DFX\0"
+    "TXL0P_CLK_ACTIVE_SPARE\0"
+    "TXL_FLITS_SLOT0\0"
+    "TXL_FLITS_SLOT1\0"
+    "TXL_FLITS_SLOT2\0"
+    "TXL_FLITS_DATA\0"
+    "TXL_FLITS_LLCRD\0"
+    "TXL_FLITS_NULL\0"
+    "TXL_FLITS_LLCTRL\0"
+    "TXL_FLITS_PROTHDR\0"
+    "TXL_FLITS_SLOT0_DATA\0"
+    "TXL_FLITS_SLOT1_DATA\0"
+    "TXL_FLITS_SLOT2_DATA\0"
+    "TXL_FLITS_ALL_DATA\0"
+    "TXL_FLITS_SLOT0_LLCRD\0"
+    "TXL_FLITS_SLOT1_LLCRD\0"
+    "TXL_FLITS_SLOT2_LLCRD\0"
+    "TXL_FLITS_ALL_LLCRD\0"
+    "TXL_FLITS_SLOT0_NULL\0"
+    "TXL_FLITS_SLOT1_NULL\0"
+    "TXL_FLITS_SLOT2_NULL\0"
+    "TXL_FLITS_ALL_NULL\0"
+    "TXL_FLITS_SLOT0_IDLE\0"
+    "TXL_FLITS_SLOT1_IDLE\0"
+    "TXL_FLITS_SLOT2_IDLE\0"
+    "TXL_FLITS_ALL_IDLE\0"
+    "TXL_FLITS_SLOT0_PROTHDR\0"
+    "TXL_FLITS_SLOT1_PROTHDR\0"
+    "TXL_FLITS_SLOT2_PROTHDR\0"
+    "TXL_FLITS_ALL_PROTHDR\0"
+    "TXL_FLITS_NON_DATA\0"
+    "TXL_BASIC_HDR_MATCH_REQ\0"
+    "TXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "TXL_BASIC_HDR_MATCH_SNP\0"
+    "TXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_WB\0"
+    "TXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCB\0"
+    "TXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCS\0"
+    "TXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSPCNFLT\0"
+    "TXL_BASIC_HDR_MATCH_RSPI\0"
+    "PHY_INIT_CYCLES\0"
+    "POWER_L1_NACK\0"
+    "POWER_L1_REQ\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_CRC_ERRORS\0"
+    "RXL_CRC_LLR_REQ_TRANSMIT\0"
+    "RXL_CREDITS_CONSUMED_VN0\0"
+    "RXL_CREDITS_CONSUMED_VN1\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "TXL0P_POWER_CYCLES_LL_ENTER\0"
+    "TXL0P_POWER_CYCLES_M3_EXIT\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BYPASSED\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY\0"
+    "VNA_CREDIT_RETURN_BLOCKED_VN01\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "CORE_TRANSITION_CYCLES\0"
+    "WBOX\0"
+    "DEMOTIONS\0"
+    "FIVR_PS_PS0_CYCLES\0"
+    "FIVR_PS_PS1_CYCLES\0"
+    "FIVR_PS_PS2_CYCLES\0"
+    "FIVR_PS_PS3_CYCLES\0"
+    "FREQ_CLIP_AVX256\0"
+    "FREQ_CLIP_AVX512\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "PKG_RESIDENCY_C0_CYCLES\0"
+    "PKG_RESIDENCY_C2E_CYCLES\0"
+    "PKG_RESIDENCY_C3_CYCLES\0"
+    "PKG_RESIDENCY_C6_CYCLES\0"
+    "PMAX_THROTTLED_CYCLES\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VR_HOT_CYCLES\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "CORES_IN_P3\0"
+    "WBOX2FIX\0"
+    "CORES_IN_P6\0"
+    "WBOX3FIX\0"
+    "IRP_CLOCKTICKS\0"
+    "IBOX\0"
+    "SNOOP_RESP_MISS\0"
+    "SNOOP_RESP_HIT_I\0"
+    "SNOOP_RESP_HIT_ES\0"
+    "SNOOP_RESP_HIT_M\0"
+    "SNOOP_RESP_SNPCODE\0"
+    "SNOOP_RESP_SNPDATA\0"
+    "SNOOP_RESP_SNPINV\0"
+    "SNOOP_RESP_ALL_MISS\0"
+    "SNOOP_RESP_ALL_HIT\0"
+    "SNOOP_RESP_ALL_HIT_ES\0"
+    "SNOOP_RESP_ALL_HIT_I\0"
+    "I_COHERENT_OPS_RFO\0"
+    "I_COHERENT_OPS_CLFLUSH\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_IV_Q\0"
+    "IRP_ALL_OUTBOUND_INSERTS\0"
+    "IRP_ALL_EVICTS\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_2ND_RD_INSERT\0"
+    "MISC0_2ND_WR_INSERT\0"
+    "MISC0_2ND_ATOMIC_INSERT\0"
+    "MISC0_FAST_XFER\0"
+    "MISC0_PF_ACK_HINT\0"
+    "MISC0_SLOWPATH_FWPF_NO_PRF\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "P2P_TRANSACTIONS_RD\0"
+    "P2P_TRANSACTIONS_WR\0"
+    "P2P_TRANSACTIONS_MSG\0"
+    "P2P_TRANSACTIONS_CMPL\0"
+    "P2P_TRANSACTIONS_REM\0"
+    "P2P_TRANSACTIONS_REM_AND_TGT_MATCH\0"
+    "P2P_TRANSACTIONS_LOC\0"
+    "P2P_TRANSACTIONS_LOC_AND_TGT_MATCH\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "P2P_INSERTS\0"
+    "P2P_OCCUPANCY\0"
+    "IIO_BANDWIDTH_IN_PORT0\0"
+    "IBOX0PORT0|IBOX1PORT0|IBOX2PORT0|IBOX3PORT0|IBOX4PORT0|IBOX5PORT0\0"
+    "IIO_BANDWIDTH_IN_PORT1\0"
+    "IBOX0PORT1|IBOX1PORT1|IBOX2PORT1|IBOX3PORT1|IBOX4PORT1|IBOX5PORT1\0"
+    "IIO_BANDWIDTH_IN_PORT2\0"
+    "IBOX0PORT2|IBOX1PORT2|IBOX2PORT2|IBOX3PORT2|IBOX4PORT2|IBOX5PORT2\0"
+    "IIO_BANDWIDTH_IN_PORT3\0"
+    "IBOX0PORT3|IBOX1PORT3|IBOX2PORT3|IBOX3PORT3|IBOX4PORT3|IBOX5PORT3\0"
+    "IIO_BANDWIDTH_IN_PORT4\0"
+    "IBOX0PORT4|IBOX1PORT4|IBOX2PORT4|IBOX3PORT4|IBOX4PORT4|IBOX5PORT4\0"
+    "IIO_BANDWIDTH_IN_PORT5\0"
+    "IBOX0PORT5|IBOX1PORT5|IBOX2PORT5|IBOX3PORT5|IBOX4PORT5|IBOX5PORT5\0"
+    "IIO_BANDWIDTH_IN_PORT6\0"
+    "IBOX0PORT6|IBOX1PORT6|IBOX2PORT6|IBOX3PORT6|IBOX4PORT6|IBOX5PORT6\0"
+    "IIO_BANDWIDTH_IN_PORT7\0"
+    "IBOX0PORT7|IBOX1PORT7|IBOX2PORT7|IBOX3PORT7|IBOX4PORT7|IBOX5PORT7\0"
+    "IIO_CLOCKTICKS\0"
+    "TCBOX0|TCBOX1|TCBOX2|TCBOX3|TCBOX4|TCBOX5|TCBOXFIX\0"
+    "IOMMU0_FIRST_LOOKUPS\0"
+    "TCBOX\0"
+    "IOMMU0_ALL_LOOKUPS\0"
+    "IOMMU0_4K_HITS\0"
+    "IOMMU0_2M_HITS\0"
+    "IOMMU0_1G_HITS\0"
+    "IOMMU0_MISSES\0"
+    "IOMMU0_CTXT_CACHE_LOOKUPS\0"
+    "IOMMU0_CTXT_CACHE_HITS\0"
+    "IOMMU1_PWT_CACHE_LOOKUPS\0"
+    "IOMMU1_PWC_4K_HITS\0"
+    "IOMMU1_PWC_2M_HITS\0"
+    "IOMMU1_PWC_1G_HITS\0"
+    "IOMMU1_PWC_512G_HITS\0"
+    "IOMMU1_PWC_CACHE_FILLS\0"
+    "IOMMU1_NUM_MEM_ACCESSES\0"
+    "IOMMU1_CYC_PWT_FULL\0"
+    "IOMMU3_NUM_INVAL_GBL\0"
+    "IOMMU3_NUM_INVAL_DOMAIN\0"
+    "IOMMU3_NUM_INVAL_PAGE\0"
+    "IOMMU3_NUM_CTXT_CACHE_INVAL_GBL\0"
+    "IOMMU3_NUM_CTXT_CACHE_INVAL_DOMAIN\0"
+    "IOMMU3_NUM_CTXT_CACHE_INVAL_DEVICE\0"
+    "IOMMU3_INT_CACHE_LOOKUPS\0"
+    "IOMMU3_INT_CACHE_HITS\0"
+    "MASK_MATCH_AND_BUS0\0"
+    "TCBOX0C0|TCBOX0C1|TCBOX1C0|TCBOX1C1|TCBOX2C0|TCBOX2C1|TCBOX3C0|TCBOX3C1|TCBOX4C0|TCBOX4C1|TCBOX5C0|TCBOX5C1\0"
+    "MASK_MATCH_AND_BUS1\0"
+    "MASK_MATCH_AND_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_AND_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0\0"
+    "MASK_MATCH_OR_BUS1\0"
+    "MASK_MATCH_OR_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_NOT_BUS1\0"
+    "NUM_REQ_OF_CPU_ALL_DROP\0"
+    "NOTHING\0"
+    "PWT_OCCUPANCY\0"
+    "SYMBOL_TIMES\0"
+    "NUM_REQ_OF_CPU_BY_TGT_MSGB\0"
+    "NUM_REQ_OF_CPU_BY_TGT_MCAST\0"
+    "NUM_REQ_OF_CPU_BY_TGT_UBOX\0"
+    "NUM_REQ_OF_CPU_BY_TGT_MEM\0"
+    "NUM_REQ_OF_CPU_BY_TGT_REM_P2P\0"
+    "NUM_REQ_OF_CPU_BY_TGT_LOC_P2P\0"
+    "NUM_REQ_OF_CPU_BY_TGT_CONFINED_P2P\0"
+    "NUM_REQ_OF_CPU_BY_TGT_ABORT\0"
+    "NUM_TGT_MATCHED_REQ_OF_CPU\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_IOMMU_REQ\0"
+    "TCBOX0C2|TCBOX0C2|TCBOX1C2|TCBOX1C3|TCBOX2C2|TCBOX2C3|TCBOX3C2|TCBOX3C3|TCBOX4C2|TCBOX4C3|TCBOX5C2|TCBOX5C3\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_IOMMU_HIT\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_REQ_OWN\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_FINAL_RD_WR\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_WR\0"
+    "NUM_OUTSTANDING_REQ_OF_CPU_DATA\0"
+    "NUM_OUSTANDING_REQ_FROM_CPU_TO_IO\0"
+    "REQ_FROM_PCIE_CL_CMPL_REQ_OWN\0"
+    "REQ_FROM_PCIE_CL_CMPL_FINAL_RD_WR\0"
+    "REQ_FROM_PCIE_CL_CMPL_WR\0"
+    "REQ_FROM_PCIE_CL_CMPL_DATA\0"
+    "REQ_FROM_PCIE_CMPL_IOMMU_REQ\0"
+    "REQ_FROM_PCIE_CMPL_IOMMU_HIT\0"
+    "REQ_FROM_PCIE_CMPL_REQ_OWN\0"
+    "REQ_FROM_PCIE_CMPL_FINAL_RD_WR\0"
+    "REQ_FROM_PCIE_CMPL_WR\0"
+    "REQ_FROM_PCIE_CMPL_DATA\0"
+    "REQ_FROM_PCIE_PASS_CMPL_REQ_OWN\0"
+    "REQ_FROM_PCIE_PASS_CMPL_FINAL_RD_WR\0"
+    "REQ_FROM_PCIE_PASS_CMPL_WR\0"
+    "REQ_FROM_PCIE_PASS_CMPL_DATA\0"
+    "INBOUND_ARB_REQ_IOMMU_REQ\0"
+    "INBOUND_ARB_REQ_IOMMU_HIT\0"
+    "INBOUND_ARB_REQ_REQ_OWN\0"
+    "INBOUND_ARB_REQ_FINAL_RD_WR\0"
+    "INBOUND_ARB_REQ_WR\0"
+    "INBOUND_ARB_REQ_DATA\0"
+    "INBOUND_ARB_WON_IOMMU_REQ\0"
+    "INBOUND_ARB_WON_IOMMU_HIT\0"
+    "INBOUND_ARB_WON_REQ_OWN\0"
+    "INBOUND_ARB_WON_FINAL_RD_WR\0"
+    "INBOUND_ARB_WON_WR\0"
+    "INBOUND_ARB_WON_DATA\0"
+    "OUTBOUND_CL_REQS_ISSUED_TO_IO\0"
+    "OUTBOUND_TLP_REQS_ISSUED_TO_IO\0"
+    "NUM_REQ_FROM_CPU_IRP\0"
+    "NUM_REQ_FROM_CPU_ITC\0"
+    "NUM_REQ_FROM_CPU_PREALLOC\0"
+    "COMP_BUF_INSERTS_CMPD_ALL\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART4\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART5\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART6\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART7\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_IOMMU0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART4\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART5\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART6\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART7\0"
+    "TXN_REQ_BY_CPU_PEER_READ_IOMMU0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_IOMMU1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART4\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART5\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART6\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART7\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_IOMMU0\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_IOMMU1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART4\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART5\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART6\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART7\0"
+    "TXN_REQ_BY_CPU_CFG_READ_IOMMU0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_IOMMU1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART4\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART5\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART6\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART7\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_IOMMU0\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_IOMMU1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART0\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART2\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART3\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART4\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART5\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART6\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART7\0"
+    "TXN_REQ_BY_CPU_IO_READ_IOMMU0\0"
+    "TXN_REQ_BY_CPU_IO_READ_IOMMU1\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_IOMMU0\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_IOMMU1\0"
+    "TXN_REQ_BY_CPU_MEM_READ_IOMMU0\0"
+    "TXN_REQ_BY_CPU_MEM_READ_IOMMU1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART4\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART5\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART6\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART7\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_IOMMU0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_IOMMU1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART4\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART5\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART6\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART7\0"
+    "TXN_REQ_OF_CPU_PEER_READ_IOMMU0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_IOMMU1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART2\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART3\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART4\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART5\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART6\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART7\0"
+    "TXN_REQ_OF_CPU_ATOMIC_IOMMU0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_IOMMU1\0"
+    "TXN_REQ_OF_CPU_MSG_PART0\0"
+    "TXN_REQ_OF_CPU_MSG_PART1\0"
+    "TXN_REQ_OF_CPU_MSG_PART2\0"
+    "TXN_REQ_OF_CPU_MSG_PART3\0"
+    "TXN_REQ_OF_CPU_MSG_PART4\0"
+    "TXN_REQ_OF_CPU_MSG_PART5\0"
+    "TXN_REQ_OF_CPU_MSG_PART6\0"
+    "TXN_REQ_OF_CPU_MSG_PART7\0"
+    "TXN_REQ_OF_CPU_MSG_IOMMU0\0"
+    "TXN_REQ_OF_CPU_MSG_IOMMU1\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_IOMMU0\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_IOMMU1\0"
+    "TXN_REQ_OF_CPU_MEM_READ_IOMMU0\0"
+    "TXN_REQ_OF_CPU_MEM_READ_IOMMU1\0"
+    "TXN_REQ_OF_CPU_CPMD_IOMMU0\0"
+    "TXN_REQ_OF_CPU_CPMD_IOMMU1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART4\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART5\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART6\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART7\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_IOMMU0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_IOMMU1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART4\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART5\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART6\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART7\0"
+    "DATA_REQ_OF_CPU_PEER_READ_IOMMU0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_IOMMU1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART2\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART3\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART4\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART5\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART6\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART7\0"
+    "DATA_REQ_OF_CPU_ATOMIC_IOMMU0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_IOMMU1\0"
+    "DATA_REQ_OF_CPU_MSG_PART0\0"
+    "DATA_REQ_OF_CPU_MSG_PART1\0"
+    "DATA_REQ_OF_CPU_MSG_PART2\0"
+    "DATA_REQ_OF_CPU_MSG_PART3\0"
+    "DATA_REQ_OF_CPU_MSG_PART4\0"
+    "DATA_REQ_OF_CPU_MSG_PART5\0"
+    "DATA_REQ_OF_CPU_MSG_PART6\0"
+    "DATA_REQ_OF_CPU_MSG_PART7\0"
+    "DATA_REQ_OF_CPU_MSG_IOMMU0\0"
+    "DATA_REQ_OF_CPU_MSG_IOMMU1\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_IOMMU0\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_IOMMU1\0"
+    "DATA_REQ_OF_CPU_MEM_READ_IOMMU0\0"
+    "DATA_REQ_OF_CPU_MEM_READ_IOMMU1\0"
+    "DATA_REQ_OF_CPU_CPMD_IOMMU0\0"
+    "DATA_REQ_OF_CPU_CPMD_IOMMU1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART4\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART5\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART6\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART7\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_IOMMU0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_IOMMU1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART4\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART5\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART6\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART7\0"
+    "DATA_REQ_BY_CPU_PEER_READ_IOMMU0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_IOMMU1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART4\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART5\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART6\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART7\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_IOMMU0\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_IOMMU1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART4\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART5\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART6\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART7\0"
+    "DATA_REQ_BY_CPU_CFG_READ_IOMMU0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_IOMMU1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART4\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART5\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART6\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART7\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_IOMMU0\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_IOMMU1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART0\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART2\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART3\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART4\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART5\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART6\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART7\0"
+    "DATA_REQ_BY_CPU_IO_READ_IOMMU0\0"
+    "DATA_REQ_BY_CPU_IO_READ_IOMMU1\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_IOMMU0\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_IOMMU1\0"
+    "DATA_REQ_BY_CPU_MEM_READ_IOMMU0\0"
+    "DATA_REQ_BY_CPU_MEM_READ_IOMMU1\0";
+
+static const PerfmonEventOption icelakeX_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_MATCH0,0x20}
+, {EVENT_OPTION_MATCH0,0x80}
+, {EVENT_OPTION_MATCH0,0x01}
+, {EVENT_OPTION_MATCH0,0x02}
+, {EVENT_OPTION_MATCH0,0x04}
+, {EVENT_OPTION_MATCH0,0x08}
+, {EVENT_OPTION_MATCH0,0x10}
+, {EVENT_OPTION_MATCH0,0x3F}
+, {EVENT_OPTION_MATCH0,0x1FFF}
+, {EVENT_OPTION_MATCH0,0x1E20}
+, {EVENT_OPTION_MATCH0,0x1BC1}
+, {EVENT_OPTION_MATCH0,0x19C1}
+, {EVENT_OPTION_MATCH0,0x1A01}
+, {EVENT_OPTION_MATCH0,0x1BD0}
+, {EVENT_OPTION_MATCH0,0x19D0}
+, {EVENT_OPTION_MATCH0,0x1A10}
+, {EVENT_OPTION_MATCH0,0x1BC8}
+, {EVENT_OPTION_MATCH0,0x19C8}
+, {EVENT_OPTION_MATCH0,0x1A08}
+, {EVENT_OPTION_MATCH0,0x1844}
+, {EVENT_OPTION_MATCH0,0x1A04}
+, {EVENT_OPTION_MATCH0,0x0BDF}
+, {EVENT_OPTION_MATCH0,0x15DF}
+, {EVENT_OPTION_MATCH0,0x1C19}
+, {EVENT_OPTION_MATCH0,0x189D}
+, {EVENT_OPTION_MATCH0,0x1FC1}
+, {EVENT_OPTION_MATCH0,0x17C2}
+, {EVENT_OPTION_MATCH0,0x1FE0}
+, {EVENT_OPTION_MATCH0,0x1BD9}
+, {EVENT_OPTION_MATCH0,0x0BD9}
+, {EVENT_OPTION_MATCH0,0x13D9}
+, {EVENT_OPTION_MATCH0,0x09D9}
+, {EVENT_OPTION_MATCH0,0x0A19}
+, {EVENT_OPTION_MATCH0,0x11D9}
+, {EVENT_OPTION_MATCH0,0x1619}
+, {EVENT_OPTION_MATCH0,0x1A42}
+, {EVENT_OPTION_MATCH0,0xC001FF}
+, {EVENT_OPTION_MATCH0,0xC803FE}
+, {EVENT_OPTION_MATCH0,0xC000FF}
+, {EVENT_OPTION_MATCH0,0xC827FD}
+, {EVENT_OPTION_MATCH0,0xC8A7FD}
+, {EVENT_OPTION_MATCH0,0xC827FE}
+, {EVENT_OPTION_MATCH0,0xC8A7FE}
+, {EVENT_OPTION_MATCH0,0xC803FD}
+, {EVENT_OPTION_MATCH0,0xC803FF}
+, {EVENT_OPTION_MATCH0,0xC817FF}
+, {EVENT_OPTION_MATCH0,0xC827FF}
+, {EVENT_OPTION_MATCH0,0xC8A7FF}
+, {EVENT_OPTION_MATCH0,0xC88FFF}
+, {EVENT_OPTION_MATCH0,0xC8D7FF}
+, {EVENT_OPTION_MATCH0,0xCC47FF}
+, {EVENT_OPTION_MATCH0,0xCC23FF}
+, {EVENT_OPTION_MATCH0,0xC8C3FF}
+, {EVENT_OPTION_MATCH0,0xCC27FF}
+, {EVENT_OPTION_MATCH0,0xC8978A}
+, {EVENT_OPTION_MATCH0,0xC8968A}
+, {EVENT_OPTION_MATCH0,0xC8970A}
+, {EVENT_OPTION_MATCH0,0xC86786}
+, {EVENT_OPTION_MATCH0,0xC86686}
+, {EVENT_OPTION_MATCH0,0xC86706}
+, {EVENT_OPTION_MATCH0,0xC8678A}
+, {EVENT_OPTION_MATCH0,0xC8668A}
+, {EVENT_OPTION_MATCH0,0xC8670A}
+, {EVENT_OPTION_MATCH0,0xC86F86}
+, {EVENT_OPTION_MATCH0,0xC86E86}
+, {EVENT_OPTION_MATCH0,0xC86F06}
+, {EVENT_OPTION_MATCH0,0xC86F8A}
+, {EVENT_OPTION_MATCH0,0xC86E8A}
+, {EVENT_OPTION_MATCH0,0xC86F0A}
+, {EVENT_OPTION_MATCH0,0xC86FFE}
+, {EVENT_OPTION_MATCH0,0xC867FF}
+, {EVENT_OPTION_MATCH0,0xC86FFF}
+, {EVENT_OPTION_MATCH0,0xC87FDE}
+, {EVENT_OPTION_MATCH0,0xC80EFE}
+, {EVENT_OPTION_MATCH0,0xC80F7E}
+, {EVENT_OPTION_MATCH0,0xC88EFE}
+, {EVENT_OPTION_MATCH0,0xC88F7E}
+, {EVENT_OPTION_MATCH0,0xCD47FF}
+, {EVENT_OPTION_MATCH0,0xCC47FD}
+, {EVENT_OPTION_MATCH0,0xCC47FE}
+, {EVENT_OPTION_MATCH0,0xC877DE}
+, {EVENT_OPTION_MATCH0,0xCCCFFF}
+, {EVENT_OPTION_MATCH0,0xCCCFFD}
+, {EVENT_OPTION_MATCH0,0xCCD7FD}
+, {EVENT_OPTION_MATCH0,0xCCCFFE}
+, {EVENT_OPTION_MATCH0,0xC89786}
+, {EVENT_OPTION_MATCH0,0xC89686}
+, {EVENT_OPTION_MATCH0,0xC89706}
+, {EVENT_OPTION_MATCH0,0xC867FE}
+, {EVENT_OPTION_MATCH0,0xCC3FFF}
+, {EVENT_OPTION_MATCH0,0xCC57FE}
+, {EVENT_OPTION_MATCH0,0xC837FE}
+, {EVENT_OPTION_MATCH0,0xC837FD}
+, {EVENT_OPTION_MATCH0,0xC837FF}
+, {EVENT_OPTION_MATCH0,0xCC57FD}
+, {EVENT_OPTION_MATCH0,0xCC67FF}
+, {EVENT_OPTION_MATCH0,0xCC37FF}
+, {EVENT_OPTION_MATCH0,0xCC2FFF}
+, {EVENT_OPTION_MATCH0,0xC80FFD}
+, {EVENT_OPTION_MATCH0,0xC817FD}
+, {EVENT_OPTION_MATCH0,0xCCC7FD}
+, {EVENT_OPTION_MATCH0,0xC807FD}
+, {EVENT_OPTION_MATCH0,0xCCC7FE}
+, {EVENT_OPTION_MATCH0,0xCC43FE}
+, {EVENT_OPTION_MATCH0,0xC88FFD}
+, {EVENT_OPTION_MATCH0,0xC897FD}
+, {EVENT_OPTION_MATCH0,0xC887FD}
+, {EVENT_OPTION_MATCH0,0xC88FFE}
+, {EVENT_OPTION_MATCH0,0xC897FE}
+, {EVENT_OPTION_MATCH0,0xC887FE}
+, {EVENT_OPTION_MATCH0,0xCC43FD}
+, {EVENT_OPTION_MATCH0,0xCC43FF}
+, {EVENT_OPTION_MATCH0,0xC887FF}
+, {EVENT_OPTION_MATCH0,0xCCC7FF}
+, {EVENT_OPTION_MATCH0,0xC897FF}
+, {EVENT_OPTION_MATCH0,0xC896FE}
+, {EVENT_OPTION_MATCH0,0xC8977E}
+, {EVENT_OPTION_MATCH0,0xC806FE}
+, {EVENT_OPTION_MATCH0,0xC8077E}
+, {EVENT_OPTION_MATCH0,0xC886FE}
+, {EVENT_OPTION_MATCH0,0xC8877E}
+, {EVENT_OPTION_MATCH0,0xC81686}
+, {EVENT_OPTION_MATCH0,0xC81706}
+, {EVENT_OPTION_MATCH0,0xC8168A}
+, {EVENT_OPTION_MATCH0,0xC8170A}
+, {EVENT_OPTION_MATCH0,0xCCD7FE}
+, {EVENT_OPTION_MATCH0,0xCCD7FF}
+, {EVENT_OPTION_MATCH0,0xC8C7FF}
+, {EVENT_OPTION_MATCH0,0xCC57FF}
+, {EVENT_OPTION_MATCH0,0xCD43FF}
+, {EVENT_OPTION_MATCH0,0xCD43FD}
+, {EVENT_OPTION_MATCH0,0xCD43FE}
+, {EVENT_OPTION_OPCODE,0x0}
+, {EVENT_OPTION_MASK0,0xFF}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0xFF}
+, {EVENT_OPTION_MASK1,0x04}
+, {EVENT_OPTION_MASK0,0x01}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x02}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x04}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x08}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x10}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x20}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x40}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x80}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x200}
+, {EVENT_OPTION_MASK1,0x07}
+, {EVENT_OPTION_MASK0,0x100}
+, {EVENT_OPTION_MASK1,0x07}
+};
+
+static const PerfmonEventEntry icelakeX_arch_event_entries[NUM_ARCH_EVENTS_ICELAKEX] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 134, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 157, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 185, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 212, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 232, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {238, 247, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {252, 268, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {273, 288, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {293, 307, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {312, 336, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {340, 336, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {356, 336, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {388, 336, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {419, 336, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {449, 336, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {475, 336, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {507, 336, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {542, 336, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {580, 336, 0, 1, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {609, 336, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {641, 336, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {672, 336, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {699, 336, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {732, 336, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {768, 336, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {807, 336, 0, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {837, 336, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {862, 336, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {891, 336, 0, 0, 0x0D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {913, 336, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {943, 336, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {959, 336, 1, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {984, 336, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1018, 336, 0, 1, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1039, 336, 3, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1059, 336, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {1088, 336, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1106, 336, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1128, 336, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1153, 336, 0, 0, 0x24,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {1172, 336, 0, 0, 0x24,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {1200, 336, 0, 0, 0x24,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {1217, 336, 0, 0, 0x24,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {1238, 336, 0, 0, 0x24,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {1256, 336, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 336, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1301, 336, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1322, 336, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1353, 336, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1367, 336, 0, 0, 0x24,0xEF,0,0,EVENT_OPTION_NONE_MASK}
+, {1387, 336, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1417, 336, 0, 0, 0x28,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {1447, 336, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1477, 336, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1500, 336, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1523, 336, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1545, 336, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1570, 336, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1599, 336, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1627, 336, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1655, 336, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1692, 336, 0, 0, 0x3C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1727, 336, 5, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1759, 336, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1781, 336, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 336, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1832, 336, 7, 2, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1862, 336, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1885, 336, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1908, 336, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1924, 336, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1946, 336, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1974, 336, 0, 0, 0x54,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2001, 336, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 336, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2081, 336, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2122, 336, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2176, 336, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2213, 336, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2227, 336, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2241, 336, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2264, 336, 9, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {2284, 336, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2328, 336, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2368, 336, 0, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2420, 336, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2461, 336, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2510, 336, 0, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2574, 336, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2588, 336, 12, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2607, 336, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2627, 336, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2640, 336, 12, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2658, 336, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2677, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2689, 336, 7, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2705, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2723, 336, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2747, 336, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2768, 336, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2790, 336, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2811, 336, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2834, 336, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2860, 336, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2885, 336, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2906, 336, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2933, 336, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2963, 336, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2996, 336, 0, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3020, 336, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3034, 336, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3062, 336, 12, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3110, 336, 13, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {3150, 336, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3178, 336, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3206, 336, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3236, 336, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3266, 336, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3294, 336, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3322, 336, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3352, 336, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3372, 336, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3399, 336, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3418, 336, 15, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3449, 336, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3479, 336, 16, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3509, 336, 17, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3539, 336, 18, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3572, 336, 19, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3600, 336, 20, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3631, 336, 12, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3661, 336, 21, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3691, 336, 22, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3721, 336, 0, 0, 0xA4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3737, 336, 0, 0, 0xA4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3765, 336, 0, 0, 0xA4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3793, 336, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3819, 336, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3845, 336, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3871, 336, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3897, 336, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3926, 336, 0, 0, 0xA6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3957, 336, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3966, 336, 23, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3989, 336, 24, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4008, 336, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4041, 336, 25, 2, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4073, 336, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4105, 336, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4133, 336, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4162, 336, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4202, 336, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4232, 336, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4253, 336, 1, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4280, 336, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4306, 336, 16, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4332, 336, 27, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4358, 336, 19, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4384, 336, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4403, 336, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4434, 336, 16, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4465, 336, 27, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4496, 336, 19, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4527, 336, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4545, 336, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4567, 336, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4586, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4603, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4622, 336, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4648, 336, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4665, 336, 0, 0, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4676, 336, 0, 0, 0xC1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4688, 336, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4707, 336, 1, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4733, 336, 5, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4759, 336, 28, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4780, 336, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4811, 336, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4830, 336, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4859, 336, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4886, 336, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4912, 336, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4940, 336, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4968, 336, 0, 0, 0xC4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {4989, 336, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5016, 336, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5043, 336, 0, 0, 0xC4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5068, 336, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5097, 336, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5124, 336, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5154, 336, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5182, 336, 0, 0, 0xC5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5203, 336, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5230, 336, 0, 0, 0xC5,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5255, 336, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5291, 336, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5327, 336, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5368, 336, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5409, 336, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5450, 336, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5491, 336, 0, 0, 0xC7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5532, 336, 0, 0, 0xC7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5573, 336, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5591, 336, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5610, 336, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5630, 336, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5654, 336, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5685, 336, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5712, 336, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5730, 336, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5749, 336, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5769, 336, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5793, 336, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5819, 336, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5850, 336, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5878, 336, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5905, 336, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5930, 336, 0, 0, 0xCC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5954, 336, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5987, 336, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6021, 336, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {6049, 336, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {6078, 336, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {6108, 336, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {6135, 336, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {6163, 336, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {6184, 336, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6208, 336, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6232, 336, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6256, 336, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6281, 336, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6306, 336, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6331, 336, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6355, 336, 0, 0, 0xD1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6382, 336, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {6406, 336, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6430, 336, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {6454, 336, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6488, 336, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6521, 336, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6557, 336, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6591, 336, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6624, 336, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6658, 336, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6694, 336, 0, 0, 0xD3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6731, 336, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6768, 336, 0, 0, 0xD3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6804, 336, 0, 0, 0xD3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6840, 336, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6853, 336, 0, 0, 0xEC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6884, 336, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6908, 336, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6921, 336, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6938, 336, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6954, 336, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6970, 336, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6987, 336, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7002, 336, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7024, 336, 0, 0, 0xF1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {7040, 336, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7060, 336, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7084, 336, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7110, 336, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7118, 336, 0, 0, 0xFE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7138, 336, 0, 0, 0xFE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7160, 336, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7187, 336, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7214, 7230, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7235, 7230, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7250, 7230, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7268, 7230, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7282, 7230, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7297, 7230, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7314, 7230, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7338, 7230, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7355, 7230, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7377, 7230, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7395, 7230, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7414, 7230, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7441, 7230, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7471, 7230, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7494, 7230, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7530, 7230, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7555, 7230, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7575, 7230, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7597, 7230, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7621, 7230, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7641, 7230, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7661, 7230, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7681, 7230, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7701, 7230, 0, 0, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {7717, 7230, 30, 1, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7739, 7230, 31, 1, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7762, 7230, 30, 1, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7782, 7230, 30, 1, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7802, 7230, 30, 1, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7822, 7230, 30, 1, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7842, 7230, 31, 1, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7863, 7230, 31, 1, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7884, 7230, 31, 1, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7905, 7230, 31, 1, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {7926, 7230, 0, 0, 0x50,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {7941, 7230, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {7957, 7230, 0, 0, 0x50,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {7974, 7993, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9043, 7230, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9058, 7230, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9076, 7230, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9093, 7230, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9111, 7230, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9130, 7230, 0, 0, 0x39,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9144, 7230, 0, 0, 0x39,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9159, 7230, 0, 0, 0x6A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9178, 7230, 0, 0, 0x6A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9194, 7230, 0, 0, 0x6A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9219, 7230, 0, 0, 0x6A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9240, 7230, 0, 0, 0x6A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9262, 7230, 0, 0, 0x6A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9283, 7230, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9299, 7230, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9315, 7230, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9334, 7230, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9353, 7230, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9382, 7230, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9412, 7230, 0, 0, 0x65,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9447, 7230, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9478, 7230, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9510, 7230, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9542, 7230, 0, 0, 0x70,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9577, 7230, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9614, 7230, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9635, 7230, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9663, 7230, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9688, 7230, 0, 0, 0x33,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {9708, 7230, 0, 0, 0x33,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9725, 7230, 0, 0, 0x33,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9743, 7230, 0, 0, 0x33,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9762, 7230, 0, 0, 0x33,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {9779, 7230, 0, 0, 0x33,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9801, 7230, 0, 0, 0x33,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {9820, 7230, 0, 0, 0x33,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9840, 7230, 0, 0, 0x33,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9861, 7230, 0, 0, 0x33,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {9880, 7230, 0, 0, 0x6E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9905, 7230, 0, 0, 0x6E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9934, 7230, 0, 0, 0x6E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9960, 7230, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9981, 7230, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10000, 7230, 0, 0, 0x6D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10017, 7230, 0, 0, 0x6D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10039, 7230, 0, 0, 0x6D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10061, 7230, 0, 0, 0x6D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10088, 7230, 0, 0, 0x6D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10106, 7230, 0, 0, 0x6D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10138, 7230, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10163, 7230, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10188, 7230, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10219, 7230, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10253, 7230, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10271, 7230, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10289, 7230, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10307, 7230, 0, 0, 0x55,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10325, 7230, 0, 0, 0x55,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10340, 7230, 0, 0, 0x55,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10356, 7230, 0, 0, 0x55,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10379, 7230, 0, 0, 0x55,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10402, 7230, 0, 0, 0x55,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10423, 7230, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10443, 7230, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10463, 7230, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10483, 7230, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10503, 7230, 0, 0, 0x58,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10523, 7230, 0, 0, 0x58,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10543, 7230, 0, 0, 0x58,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10563, 7230, 0, 0, 0x58,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10583, 7230, 32, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10603, 7230, 33, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10623, 7230, 34, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10644, 7230, 35, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10665, 7230, 36, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10686, 7230, 30, 1, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10707, 7230, 37, 1, 0x58,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10727, 7230, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10748, 7230, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10769, 7230, 0, 0, 0x5A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10790, 7230, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10811, 7230, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10832, 7230, 0, 0, 0x5A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10853, 7230, 0, 0, 0x5A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10874, 7230, 0, 0, 0x5A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10895, 7230, 32, 1, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10916, 7230, 33, 1, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10937, 7230, 34, 1, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10959, 7230, 35, 1, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {10981, 7230, 36, 1, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {11003, 7230, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11025, 7230, 37, 1, 0x5A,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {11046, 7230, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11062, 7230, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11082, 7230, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11098, 7230, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11114, 7230, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11134, 7230, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11150, 7230, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11166, 7230, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11193, 7230, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11220, 7230, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11247, 7230, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11273, 7230, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11300, 7230, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11327, 7230, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11354, 7230, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11381, 7230, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11402, 7230, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11421, 7230, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11448, 7230, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11474, 7230, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11497, 7230, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11527, 7230, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11553, 7230, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11578, 7230, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11605, 7230, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11632, 7230, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11659, 7230, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11685, 7230, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11712, 7230, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11739, 7230, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11766, 7230, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11793, 7230, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11814, 7230, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11833, 7230, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11860, 7230, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11886, 7230, 0, 0, 0x19,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11909, 7230, 0, 0, 0x19,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11939, 7230, 0, 0, 0x19,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11965, 7230, 0, 0, 0x19,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11990, 7230, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12018, 7230, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12046, 7230, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12074, 7230, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12101, 7230, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12129, 7230, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12157, 7230, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12185, 7230, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12213, 7230, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12235, 7230, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 7230, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12282, 7230, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12309, 7230, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12336, 7230, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12362, 7230, 0, 0, 0x2C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12389, 7230, 0, 0, 0x2C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12416, 7230, 0, 0, 0x2C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12443, 7230, 0, 0, 0x2C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12470, 7230, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12491, 7230, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12510, 12528, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12878, 12528, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12896, 12528, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12914, 12528, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12932, 7230, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12960, 7230, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12988, 7230, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13016, 7230, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13043, 7230, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13071, 7230, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13099, 7230, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13127, 7230, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13155, 7230, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13178, 7230, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13199, 7230, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13228, 7230, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13256, 7230, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13281, 7230, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13313, 7230, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13341, 7230, 0, 0, 0x2F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13368, 7230, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13395, 7230, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13422, 7230, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13449, 7230, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13475, 7230, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13502, 7230, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13529, 7230, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13556, 7230, 0, 0, 0x20,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13583, 7230, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13604, 7230, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13623, 7230, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13650, 7230, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13676, 7230, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13699, 7230, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13729, 7230, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13755, 7230, 0, 0, 0x21,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13780, 7230, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13808, 7230, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13836, 7230, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13864, 7230, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13891, 7230, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13919, 7230, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13947, 7230, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13975, 7230, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14003, 7230, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14025, 7230, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14045, 7230, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14073, 7230, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14100, 7230, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14124, 7230, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14155, 7230, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14182, 7230, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14208, 7230, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14235, 7230, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14262, 7230, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14289, 7230, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14315, 7230, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14342, 7230, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14369, 7230, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14396, 7230, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14423, 7230, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14444, 7230, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14463, 7230, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14490, 7230, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14516, 7230, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14539, 7230, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14569, 7230, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14595, 7230, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14620, 7230, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14647, 7230, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14674, 7230, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14701, 7230, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14727, 7230, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14754, 7230, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14781, 7230, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14808, 7230, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14835, 7230, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14856, 7230, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14875, 7230, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14902, 7230, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14928, 7230, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14951, 7230, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14981, 7230, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15007, 7230, 0, 0, 0x29,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15032, 7230, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15048, 7230, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15066, 7230, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15085, 7230, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15108, 7230, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15132, 7230, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15157, 7230, 0, 0, 0x51,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15183, 7230, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15201, 7230, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15223, 7230, 0, 0, 0x5C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15246, 7230, 0, 0, 0x5C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15265, 7230, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15287, 7230, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15309, 7230, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15335, 7230, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15361, 7230, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15385, 7230, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15413, 7230, 0, 0, 0x5D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15442, 7230, 0, 0, 0x5D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15467, 7230, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15496, 7230, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15525, 7230, 0, 0, 0x6B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15558, 7230, 0, 0, 0x6B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15592, 7230, 0, 0, 0x6B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15625, 7230, 0, 0, 0x6B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15659, 7230, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15676, 7230, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15693, 7230, 0, 0, 0x6F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15708, 7230, 0, 0, 0x6F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15729, 7230, 0, 0, 0x6F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15753, 7230, 0, 0, 0x6F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15768, 7230, 0, 0, 0x6F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15789, 7230, 0, 0, 0x6F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15813, 7230, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15826, 7230, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15842, 7230, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15858, 7230, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15874, 7230, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15887, 7230, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15900, 7230, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15913, 7230, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15926, 7230, 38, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {15941, 7230, 39, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {15963, 7230, 40, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {15984, 7230, 41, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16011, 7230, 42, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16039, 7230, 43, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16060, 7230, 44, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16087, 7230, 45, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16115, 7230, 46, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16130, 7230, 47, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16151, 7230, 48, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16173, 7230, 40, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16194, 7230, 49, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16221, 7230, 50, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16249, 7230, 51, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16268, 7230, 52, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16287, 7230, 53, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16309, 7230, 54, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16333, 7230, 54, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16358, 7230, 55, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16383, 7230, 40, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16409, 7230, 56, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16433, 7230, 57, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16453, 7230, 43, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16479, 7230, 46, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16499, 7230, 58, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16515, 7230, 58, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16536, 7230, 59, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16565, 7230, 60, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16594, 7230, 61, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16624, 7230, 62, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16655, 7230, 63, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16685, 7230, 58, 1, 0x34,0x0E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16708, 7230, 64, 1, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16753, 7230, 65, 1, 0x34,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16781, 7230, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16800, 7230, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16818, 7230, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16839, 7230, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16855, 7230, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16878, 7230, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16903, 7230, 0, 0, 0x35,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16919, 7230, 0, 0, 0x35,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16935, 7230, 66, 1, 0x35,0xFF,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16951, 7230, 67, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16975, 7230, 68, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {16994, 7230, 68, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17013, 7230, 68, 1, 0x35,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17033, 7230, 69, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17060, 7230, 70, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17092, 7230, 71, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17120, 7230, 72, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17153, 7230, 73, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17176, 7230, 74, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17195, 7230, 75, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17214, 7230, 76, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17237, 7230, 77, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17265, 7230, 78, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17289, 7230, 79, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17315, 7230, 80, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17335, 7230, 81, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17357, 7230, 82, 1, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17380, 7230, 83, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17402, 7230, 84, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17435, 7230, 85, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17474, 7230, 86, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17514, 7230, 87, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17557, 7230, 88, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17606, 7230, 89, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17656, 7230, 87, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17698, 7230, 88, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17746, 7230, 89, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17795, 7230, 90, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17837, 7230, 91, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17885, 7230, 92, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17934, 7230, 93, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {17979, 7230, 94, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18030, 7230, 95, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18082, 7230, 93, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18128, 7230, 94, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18180, 7230, 95, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18233, 7230, 96, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18278, 7230, 97, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18329, 7230, 98, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18381, 7230, 99, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18406, 7230, 100, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18427, 7230, 101, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18447, 7230, 102, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18471, 7230, 103, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18501, 7230, 104, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18532, 7230, 105, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18567, 7230, 106, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18603, 7230, 107, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18632, 7230, 108, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18656, 7230, 109, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18681, 7230, 110, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18707, 7230, 111, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18734, 7230, 112, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18765, 7230, 113, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18796, 7230, 114, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18828, 7230, 90, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18858, 7230, 91, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18894, 7230, 92, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18931, 7230, 96, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18960, 7230, 97, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {18995, 7230, 98, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19031, 7230, 115, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19064, 7230, 116, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19103, 7230, 117, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19143, 7230, 87, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19173, 7230, 88, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19209, 7230, 89, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19246, 7230, 93, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19275, 7230, 94, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19310, 7230, 95, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19346, 7230, 118, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19372, 7230, 119, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19395, 7230, 120, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19424, 7230, 121, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19451, 7230, 122, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19477, 7230, 123, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19499, 7230, 124, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19527, 7230, 125, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19549, 7230, 126, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19572, 7230, 127, 1, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19594, 12528, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19615, 12528, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19635, 12528, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19653, 12528, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19671, 12528, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19696, 12528, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19723, 12528, 68, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19744, 12528, 68, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19765, 12528, 68, 1, 0x36,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19787, 12528, 128, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19812, 12528, 129, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19837, 12528, 130, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19869, 12528, 131, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19894, 12528, 132, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19927, 12528, 67, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19953, 12528, 133, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {19980, 12528, 134, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20010, 12528, 135, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20040, 12528, 69, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20069, 12528, 70, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20103, 12528, 136, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20133, 12528, 137, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20164, 12528, 138, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20195, 12528, 71, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20225, 12528, 72, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20260, 12528, 139, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20291, 12528, 140, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20317, 12528, 73, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20342, 12528, 74, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20363, 12528, 141, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20385, 12528, 142, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20411, 12528, 143, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20439, 12528, 76, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20464, 12528, 77, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20494, 12528, 78, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20520, 12528, 144, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20546, 12528, 145, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20583, 12528, 146, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20621, 12528, 147, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20653, 12528, 148, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20686, 12528, 149, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20723, 12528, 150, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20761, 12528, 151, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20797, 12528, 152, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20834, 12528, 153, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20870, 12528, 154, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20907, 12528, 115, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20942, 12528, 116, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {20983, 12528, 117, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21025, 12528, 84, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21060, 12528, 85, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21101, 12528, 86, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21143, 12528, 118, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21183, 12528, 87, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21228, 12528, 88, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21279, 12528, 89, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21331, 12528, 87, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21375, 12528, 88, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21425, 12528, 89, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21476, 12528, 90, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21520, 12528, 91, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21570, 12528, 92, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21621, 12528, 93, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21669, 12528, 94, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21723, 12528, 95, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21778, 12528, 93, 1, 0x36,0x01,0xC86F86,0x00,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21825, 12528, 94, 1, 0x36,0x01,0xC86E86,0x00,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21878, 12528, 95, 1, 0x36,0x01,0xC86F06,0x00,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21932, 12528, 99, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {21975, 12528, 96, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22022, 12528, 97, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22075, 12528, 98, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22129, 12528, 112, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22162, 12528, 113, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22195, 12528, 114, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22229, 12528, 155, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22263, 12528, 87, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22295, 12528, 88, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22333, 12528, 89, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22372, 12528, 90, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22404, 12528, 91, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22442, 12528, 92, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22481, 12528, 93, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22512, 12528, 94, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22549, 12528, 95, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22587, 12528, 96, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22618, 12528, 97, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22655, 12528, 98, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22693, 12528, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22723, 12528, 156, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22752, 12528, 118, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22780, 12528, 99, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22807, 12528, 103, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22839, 12528, 104, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22872, 12528, 105, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22909, 12528, 106, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22947, 12528, 157, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {22972, 12528, 79, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23000, 12528, 107, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23031, 12528, 158, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23057, 12528, 83, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23081, 12528, 80, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23103, 12528, 108, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23129, 12528, 109, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23156, 12528, 110, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23184, 12528, 102, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23210, 12528, 100, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23233, 12528, 101, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23255, 12528, 111, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23284, 12528, 81, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23308, 12528, 82, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23333, 12528, 159, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23364, 12528, 160, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23399, 12528, 161, 1, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23435, 12528, 120, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23466, 12528, 123, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23490, 12528, 122, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23518, 12528, 121, 1, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MATCH0_MASK}
+, {23547, 23562, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23581, 23562, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23607, 23562, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23633, 23562, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23659, 23562, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23685, 23562, 0, 0, 0x80,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23711, 23562, 0, 0, 0x80,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23737, 23562, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23763, 23562, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {23789, 23562, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23815, 23562, 0, 0, 0x81,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23841, 23562, 0, 0, 0x81,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23868, 23562, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23895, 23562, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23922, 23562, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23949, 23562, 0, 0, 0x82,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23976, 23562, 0, 0, 0x82,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24003, 23562, 0, 0, 0x82,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24030, 23562, 0, 0, 0x82,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {24057, 23562, 0, 0, 0x82,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {24084, 23562, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24111, 23562, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24138, 23562, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24166, 23562, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24192, 23562, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24218, 23562, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24244, 23562, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24270, 23562, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24296, 23562, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24322, 23562, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {24348, 23562, 0, 0, 0x88,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {24374, 23562, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24400, 23562, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24426, 23562, 0, 0, 0x89,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24453, 23562, 0, 0, 0x8A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24480, 23562, 0, 0, 0x8A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24507, 23562, 0, 0, 0x8A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24534, 23562, 0, 0, 0x8A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24561, 23562, 0, 0, 0x8A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24588, 23562, 0, 0, 0x8A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24615, 23562, 0, 0, 0x8A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {24642, 23562, 0, 0, 0x8A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {24669, 23562, 0, 0, 0x8B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24696, 23562, 0, 0, 0x8B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24723, 23562, 0, 0, 0x8B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24751, 23562, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24777, 23562, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24803, 23562, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24829, 23562, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24855, 23562, 0, 0, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24881, 23562, 0, 0, 0x84,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24907, 23562, 0, 0, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {24933, 23562, 0, 0, 0x84,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {24959, 23562, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24985, 23562, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25011, 23562, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25038, 23562, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25065, 23562, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25092, 23562, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25119, 23562, 0, 0, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25146, 23562, 0, 0, 0x86,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25173, 23562, 0, 0, 0x86,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25200, 23562, 0, 0, 0x86,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {25227, 23562, 0, 0, 0x86,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {25254, 23562, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25281, 23562, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25308, 23562, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25336, 23562, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25362, 23562, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25388, 23562, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25414, 23562, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25440, 23562, 0, 0, 0x8C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25466, 23562, 0, 0, 0x8C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25492, 23562, 0, 0, 0x8C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {25518, 23562, 0, 0, 0x8C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {25544, 23562, 0, 0, 0x8D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25570, 23562, 0, 0, 0x8D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25596, 23562, 0, 0, 0x8D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25623, 23562, 0, 0, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25650, 23562, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25677, 23562, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25704, 23562, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25731, 23562, 0, 0, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25758, 23562, 0, 0, 0x8E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25785, 23562, 0, 0, 0x8E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {25812, 23562, 0, 0, 0x8E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {25839, 23562, 0, 0, 0x8F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25866, 23562, 0, 0, 0x8F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25893, 23562, 0, 0, 0x8F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25921, 23562, 0, 0, 0xAF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25944, 23562, 0, 0, 0xAF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25967, 23562, 0, 0, 0xAF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25995, 23562, 0, 0, 0xAF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26026, 23562, 0, 0, 0xAF,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {26057, 23562, 0, 0, 0xAF,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {26091, 23562, 0, 0, 0xAF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26119, 23562, 0, 0, 0xAF,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {26150, 23562, 0, 0, 0xBA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26180, 23562, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26210, 23562, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26240, 23562, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26269, 23562, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26300, 23562, 0, 0, 0xB6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26330, 23562, 0, 0, 0xBB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26361, 23562, 0, 0, 0xBB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26391, 23562, 0, 0, 0xBB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26423, 23562, 0, 0, 0xBB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26454, 23562, 0, 0, 0xB7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26484, 23562, 0, 0, 0xB7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26513, 23562, 0, 0, 0xB7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26544, 23562, 0, 0, 0xB7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26574, 23562, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26604, 23562, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26633, 23562, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26664, 23562, 0, 0, 0xB8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26694, 23562, 0, 0, 0xB9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26719, 23562, 0, 0, 0xB9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26745, 23562, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26769, 23562, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26793, 23562, 0, 0, 0xAC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26814, 23562, 0, 0, 0xAC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26835, 23562, 0, 0, 0xAC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26856, 23562, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26877, 23562, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26898, 23562, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26919, 23562, 0, 0, 0xAA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26940, 23562, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26961, 23562, 0, 0, 0xAA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26983, 23562, 0, 0, 0xAD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27009, 23562, 0, 0, 0xAD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27035, 23562, 0, 0, 0xAD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27061, 23562, 0, 0, 0xAD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27087, 23562, 0, 0, 0xAD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27117, 23562, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27143, 23562, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27169, 23562, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27195, 23562, 0, 0, 0xAB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27221, 23562, 0, 0, 0xAB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27248, 23562, 0, 0, 0xE5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27274, 23562, 0, 0, 0xE5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27300, 23562, 0, 0, 0xE5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27324, 23562, 0, 0, 0xE5,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27348, 23562, 0, 0, 0xE5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27372, 23562, 0, 0, 0xE5,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {27396, 23562, 0, 0, 0xE2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27416, 23562, 0, 0, 0xE2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27430, 23562, 0, 0, 0xE2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27450, 23562, 0, 0, 0xE2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27464, 23562, 0, 0, 0xE2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27482, 23562, 0, 0, 0xE2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27500, 23562, 0, 0, 0xE2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27521, 23562, 0, 0, 0xE2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27539, 23562, 0, 0, 0xE2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {27557, 23562, 0, 0, 0xE3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27582, 23562, 0, 0, 0xE3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27601, 23562, 0, 0, 0xE3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27626, 23562, 0, 0, 0xE3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27645, 23562, 0, 0, 0xE3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27668, 23562, 0, 0, 0xE3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27691, 23562, 0, 0, 0xE3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27711, 23562, 0, 0, 0xE3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27734, 23562, 0, 0, 0xE3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {27757, 23562, 0, 0, 0xE4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27775, 23562, 0, 0, 0xE1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27796, 23562, 0, 0, 0xE1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27811, 23562, 0, 0, 0xE1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27832, 23562, 0, 0, 0xE1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27847, 23562, 0, 0, 0xE1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27866, 23562, 0, 0, 0xE1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27885, 23562, 0, 0, 0xE1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27907, 23562, 0, 0, 0xE1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {27926, 23562, 0, 0, 0xE1,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {27945, 23562, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27968, 23562, 0, 0, 0xE0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27985, 23562, 0, 0, 0xE0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28008, 23562, 0, 0, 0xE0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28025, 23562, 0, 0, 0xE0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28046, 23562, 0, 0, 0xE0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28067, 23562, 0, 0, 0xE0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28091, 23562, 0, 0, 0xE0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {28112, 23562, 0, 0, 0xE0,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {28133, 23562, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28168, 23562, 0, 0, 0xD0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28203, 23562, 0, 0, 0xD0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28238, 23562, 0, 0, 0xD0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28273, 23562, 0, 0, 0xD0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28308, 23562, 0, 0, 0xD0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28343, 23562, 0, 0, 0xD0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28378, 23562, 0, 0, 0xD0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28413, 23562, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28448, 23562, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28483, 23562, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28519, 23562, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28554, 23562, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28589, 23562, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28624, 23562, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28659, 23562, 0, 0, 0xD2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28694, 23562, 0, 0, 0xD2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28729, 23562, 0, 0, 0xD2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28764, 23562, 0, 0, 0xD2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28799, 23562, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28836, 23562, 0, 0, 0xD3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28873, 23562, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28911, 23562, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28946, 23562, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28981, 23562, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29016, 23562, 0, 0, 0xD4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29051, 23562, 0, 0, 0xD4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29086, 23562, 0, 0, 0xD4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29121, 23562, 0, 0, 0xD4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29156, 23562, 0, 0, 0xD4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29191, 23562, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29228, 23562, 0, 0, 0xD5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29265, 23562, 0, 0, 0xD5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29303, 23562, 0, 0, 0xD6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29338, 23562, 0, 0, 0xD6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29373, 23562, 0, 0, 0xD6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29408, 23562, 0, 0, 0xD6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29443, 23562, 0, 0, 0xD6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29478, 23562, 0, 0, 0xD6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29513, 23562, 0, 0, 0xD6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29548, 23562, 0, 0, 0xD6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29583, 23562, 0, 0, 0xD7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29620, 23562, 0, 0, 0xD7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29657, 23562, 0, 0, 0xD7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29695, 23562, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29722, 23562, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29749, 23562, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29774, 23562, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29799, 23562, 0, 0, 0xA6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {29824, 23562, 0, 0, 0xA6,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {29849, 23562, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29874, 23562, 0, 0, 0xA7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29893, 23562, 0, 0, 0xA7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29918, 23562, 0, 0, 0xA7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29937, 23562, 0, 0, 0xA7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29960, 23562, 0, 0, 0xA7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29983, 23562, 0, 0, 0xA7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30009, 23562, 0, 0, 0xA7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30032, 23562, 0, 0, 0xA7,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {30055, 23562, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30085, 23562, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30109, 23562, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30139, 23562, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30163, 23562, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30191, 23562, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30219, 23562, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30250, 23562, 0, 0, 0xA2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30278, 23562, 0, 0, 0xA2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {30306, 23562, 0, 0, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30334, 23562, 0, 0, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30356, 23562, 0, 0, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30384, 23562, 0, 0, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30406, 23562, 0, 0, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30432, 23562, 0, 0, 0xA3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30458, 23562, 0, 0, 0xA3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30487, 23562, 0, 0, 0xA3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30513, 23562, 0, 0, 0xA3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {30539, 23562, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30565, 23562, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30585, 23562, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30611, 23562, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30631, 23562, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30655, 23562, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30679, 23562, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30706, 23562, 0, 0, 0xA1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30730, 23562, 0, 0, 0xA1,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {30754, 23562, 0, 0, 0xA4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30777, 23562, 0, 0, 0xA4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30794, 23562, 0, 0, 0xA4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30817, 23562, 0, 0, 0xA4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30834, 23562, 0, 0, 0xA4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30855, 23562, 0, 0, 0xA4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30876, 23562, 0, 0, 0xA4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30900, 23562, 0, 0, 0xA4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {30921, 23562, 0, 0, 0xA4,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {30942, 23562, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30970, 23562, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30992, 23562, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31020, 23562, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31042, 23562, 0, 0, 0xA0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31068, 23562, 0, 0, 0xA0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31094, 23562, 0, 0, 0xA0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31123, 23562, 0, 0, 0xA0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {31149, 23562, 0, 0, 0xA0,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {31175, 23562, 0, 0, 0xA5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31201, 23562, 0, 0, 0xA5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31221, 23562, 0, 0, 0xA5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31247, 23562, 0, 0, 0xA5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31267, 23562, 0, 0, 0xA5,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31294, 23562, 0, 0, 0xA5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31318, 23562, 0, 0, 0xA5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31342, 23562, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31367, 23562, 0, 0, 0x9C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31392, 23562, 0, 0, 0x9C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31417, 23562, 0, 0, 0x9C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31442, 23562, 0, 0, 0x9C,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {31467, 23562, 0, 0, 0x9C,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {31492, 23562, 0, 0, 0x9D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31516, 23562, 0, 0, 0x9D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31540, 23562, 0, 0, 0x9D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31564, 23562, 0, 0, 0x9D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31588, 23562, 0, 0, 0x9D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31612, 23562, 0, 0, 0x9D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31636, 23562, 0, 0, 0x9D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31660, 23562, 0, 0, 0x9D,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {31684, 23562, 0, 0, 0x9D,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {31708, 23562, 0, 0, 0x9D,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {31732, 23562, 0, 0, 0x9E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31757, 23562, 0, 0, 0x9E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31782, 23562, 0, 0, 0x9E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {31807, 23562, 0, 0, 0x94,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31836, 23562, 0, 0, 0x94,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31865, 23562, 0, 0, 0x94,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31894, 23562, 0, 0, 0x94,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31923, 23562, 0, 0, 0x94,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31952, 23562, 0, 0, 0x94,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31981, 23562, 0, 0, 0x94,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32010, 23562, 0, 0, 0x94,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {32039, 23562, 0, 0, 0x94,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {32068, 23562, 0, 0, 0x94,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {32097, 23562, 0, 0, 0x95,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32127, 23562, 0, 0, 0x95,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32157, 23562, 0, 0, 0x95,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {32187, 23562, 0, 0, 0x96,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32214, 23562, 0, 0, 0x96,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32241, 23562, 0, 0, 0x96,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32268, 23562, 0, 0, 0x96,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32295, 23562, 0, 0, 0x96,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32322, 23562, 0, 0, 0x96,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32349, 23562, 0, 0, 0x96,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32376, 23562, 0, 0, 0x96,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {32403, 23562, 0, 0, 0x96,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {32430, 23562, 0, 0, 0x96,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {32457, 23562, 0, 0, 0x97,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32485, 23562, 0, 0, 0x97,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32513, 23562, 0, 0, 0x97,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {32541, 23562, 0, 0, 0x92,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32566, 23562, 0, 0, 0x92,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32591, 23562, 0, 0, 0x92,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32616, 23562, 0, 0, 0x92,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32641, 23562, 0, 0, 0x92,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32666, 23562, 0, 0, 0x92,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32691, 23562, 0, 0, 0x92,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32716, 23562, 0, 0, 0x92,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {32741, 23562, 0, 0, 0x92,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {32766, 23562, 0, 0, 0x92,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {32791, 23562, 0, 0, 0x93,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32817, 23562, 0, 0, 0x93,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32843, 23562, 0, 0, 0x93,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {32869, 23562, 0, 0, 0x98,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32891, 23562, 0, 0, 0x98,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32913, 23562, 0, 0, 0x98,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32935, 23562, 0, 0, 0x98,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32957, 23562, 0, 0, 0x98,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32979, 23562, 0, 0, 0x98,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33001, 23562, 0, 0, 0x98,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33023, 23562, 0, 0, 0x98,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {33045, 23562, 0, 0, 0x98,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {33067, 23562, 0, 0, 0x98,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {33089, 23562, 0, 0, 0x99,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33112, 23562, 0, 0, 0x99,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33135, 23562, 0, 0, 0x99,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33158, 23562, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33185, 23562, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33212, 23562, 0, 0, 0x90,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33239, 23562, 0, 0, 0x90,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33266, 23562, 0, 0, 0x90,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33293, 23562, 0, 0, 0x90,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33320, 23562, 0, 0, 0x90,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33347, 23562, 0, 0, 0x90,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {33374, 23562, 0, 0, 0x90,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {33401, 23562, 0, 0, 0x90,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {33428, 23562, 0, 0, 0x91,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33456, 23562, 0, 0, 0x91,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33484, 23562, 0, 0, 0x91,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33512, 23562, 0, 0, 0x9A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33537, 23562, 0, 0, 0x9A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33562, 23562, 0, 0, 0x9A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33587, 23562, 0, 0, 0x9A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33612, 23562, 0, 0, 0x9A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33637, 23562, 0, 0, 0x9A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33662, 23562, 0, 0, 0x9A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33687, 23562, 0, 0, 0x9A,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {33712, 23562, 0, 0, 0x9A,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {33737, 23562, 0, 0, 0x9A,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {33762, 23562, 0, 0, 0x9B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33788, 23562, 0, 0, 0x9B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33814, 23562, 0, 0, 0x9B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33836, 23562, 0, 0, 0x9B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {33862, 23562, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33890, 23562, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33917, 23562, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33945, 23562, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33972, 23562, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34001, 23562, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34029, 23562, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34058, 23562, 0, 0, 0xB4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34086, 23562, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34114, 23562, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34141, 23562, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34169, 23562, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34196, 23562, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34224, 23562, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34251, 23562, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34279, 23562, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34306, 23562, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34329, 23562, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34352, 23562, 0, 0, 0xB5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34381, 23562, 0, 0, 0xB5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34409, 23562, 0, 0, 0xB5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34438, 23562, 0, 0, 0xB5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34466, 23562, 0, 0, 0xAE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {34481, 7230, 0, 0, 0x66,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34501, 7230, 0, 0, 0x66,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34526, 7230, 0, 0, 0x66,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34543, 7230, 0, 0, 0x66,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34559, 7230, 0, 0, 0x66,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34580, 7230, 0, 0, 0x66,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34601, 7230, 0, 0, 0x66,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34623, 7230, 0, 0, 0x67,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34655, 7230, 0, 0, 0x67,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34687, 34702, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {34707, 34702, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34720, 34702, 0, 0, 0xEA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34732, 34702, 0, 0, 0xEA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34744, 34702, 0, 0, 0xEA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34762, 34702, 0, 0, 0xEA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34780, 34702, 0, 0, 0xEA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34798, 34702, 0, 0, 0xEA,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34816, 34702, 0, 0, 0xEA,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {34830, 34702, 0, 0, 0xEB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34846, 34702, 0, 0, 0xEB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34866, 34702, 0, 0, 0xEB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34888, 34702, 0, 0, 0xEB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34908, 34702, 0, 0, 0xEB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34928, 34702, 0, 0, 0xEB,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34951, 34702, 0, 0, 0xEB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34975, 34702, 0, 0, 0xEB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35001, 34702, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35024, 34702, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35047, 34702, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35070, 34702, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35093, 34702, 0, 0, 0xD2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35116, 34702, 0, 0, 0xD2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35139, 34702, 0, 0, 0xD2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35162, 34702, 0, 0, 0xD2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35185, 34702, 0, 0, 0xD2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {35205, 34702, 0, 0, 0xD2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {35225, 34702, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35242, 34702, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35263, 34702, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35286, 34702, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35313, 34702, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35333, 34702, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35350, 34702, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {35363, 34702, 0, 0, 0x04,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {35376, 34702, 0, 0, 0x04,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {35390, 34702, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35404, 34702, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35423, 34702, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35444, 34702, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35464, 34702, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35483, 34702, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35504, 34702, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35524, 34702, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {35540, 34702, 0, 0, 0x28,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {35556, 34702, 0, 0, 0x02,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35576, 34702, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35590, 34702, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35604, 34702, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35618, 34702, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35632, 34702, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35655, 34702, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35678, 34702, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35701, 34702, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35724, 34702, 0, 0, 0x2B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {35746, 34702, 0, 0, 0x2B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {35768, 34702, 0, 0, 0xE0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35793, 34702, 0, 0, 0xE0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35820, 34702, 0, 0, 0xE2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35840, 34702, 0, 0, 0xE1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35858, 34702, 0, 0, 0xE4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35880, 34702, 0, 0, 0xE4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35902, 34702, 0, 0, 0xE6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35922, 34702, 0, 0, 0xE5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35940, 34702, 0, 0, 0xE8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35954, 34702, 0, 0, 0xE9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35972, 34702, 0, 0, 0xEC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35993, 34702, 0, 0, 0xEC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36014, 34702, 0, 0, 0xEC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36036, 34702, 0, 0, 0xEC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36059, 34702, 0, 0, 0xEC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36081, 34702, 0, 0, 0xEC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36105, 34702, 0, 0, 0xEC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36128, 34702, 0, 0, 0xED,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36149, 34702, 0, 0, 0xED,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36170, 34702, 0, 0, 0xED,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36193, 34702, 0, 0, 0xED,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36216, 34702, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36236, 34702, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36259, 34702, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36279, 34702, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36302, 34702, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {36321, 34702, 0, 0, 0x07,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {36340, 34702, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36372, 34702, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36404, 34702, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36436, 34702, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36468, 34702, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36500, 34702, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36532, 34702, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36564, 34702, 0, 0, 0x50,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {36596, 34702, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36628, 34702, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36660, 34702, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36692, 34702, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36724, 34702, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36756, 34702, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36788, 34702, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36820, 34702, 0, 0, 0x51,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {36852, 34702, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36882, 34702, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36912, 34702, 0, 0, 0x52,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {36941, 34702, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36964, 34702, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36987, 34702, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37010, 34702, 0, 0, 0x47,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37033, 34702, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37066, 34702, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37099, 34702, 0, 0, 0x86,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {37130, 34702, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37158, 34702, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37186, 34702, 0, 0, 0x46,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {37212, 34702, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37231, 34702, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37250, 34702, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37269, 34702, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37288, 34702, 0, 0, 0x08,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {37306, 34702, 0, 0, 0x08,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {37324, 34702, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37343, 34702, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37362, 34702, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {37380, 34702, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37410, 34702, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37440, 34702, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37470, 34702, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37500, 34702, 0, 0, 0x1C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {37529, 34702, 0, 0, 0x1C,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {37558, 34702, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37577, 34702, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37598, 34702, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37618, 34702, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37637, 34702, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37658, 34702, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37678, 34702, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37697, 34702, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37716, 34702, 0, 0, 0x11,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {37734, 34702, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37755, 34702, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {37776, 34702, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37794, 34702, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37812, 34702, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37831, 34702, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37850, 34702, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37868, 34702, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37886, 34702, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37905, 34702, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37924, 34702, 0, 0, 0x13,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {37941, 34702, 0, 0, 0x13,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {37958, 34702, 0, 0, 0x13,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {37976, 34702, 0, 0, 0x13,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {37994, 34702, 0, 0, 0x13,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {38012, 34702, 0, 0, 0x13,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {38030, 34702, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38049, 34702, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38068, 34702, 0, 0, 0x21,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {38086, 34702, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38107, 34702, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38128, 34702, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38146, 34702, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38164, 34702, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38183, 34702, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38202, 34702, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38220, 34702, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38238, 34702, 0, 0, 0x14,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38257, 34702, 0, 0, 0x14,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38276, 34702, 0, 0, 0x14,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {38293, 34702, 0, 0, 0x14,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {38310, 34702, 0, 0, 0x14,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {38328, 34702, 0, 0, 0x14,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {38346, 34702, 0, 0, 0x14,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {38364, 34702, 0, 0, 0x14,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {38382, 34702, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38400, 34702, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38418, 34702, 0, 0, 0x23,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {38435, 34702, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38454, 34702, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38473, 34702, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {38491, 34702, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38506, 34702, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38519, 34702, 0, 0, 0xD9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38535, 34702, 0, 0, 0xD9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38553, 34702, 0, 0, 0xD9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38567, 34702, 0, 0, 0xD9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38591, 34702, 0, 0, 0xD9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38615, 34702, 0, 0, 0xD9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38639, 34702, 0, 0, 0xD9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38663, 34702, 0, 0, 0xD9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38691, 34702, 0, 0, 0xD6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38706, 34702, 0, 0, 0xD6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38721, 34702, 0, 0, 0xD6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38740, 34702, 0, 0, 0xD6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38759, 34702, 0, 0, 0xD6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38780, 34702, 0, 0, 0xD6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38801, 34702, 0, 0, 0xD6,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {38820, 34702, 0, 0, 0xD6,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {38839, 34702, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38856, 34702, 0, 0, 0xD5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38877, 34702, 0, 0, 0xD5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38898, 34702, 0, 0, 0xD5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38921, 34702, 0, 0, 0xD5,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38944, 34702, 0, 0, 0xD5,0x25,0,0,EVENT_OPTION_NONE_MASK}
+, {38965, 34702, 0, 0, 0xD5,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {38986, 34702, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39009, 34702, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39033, 34702, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39060, 34702, 0, 0, 0xD4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39077, 34702, 0, 0, 0xD4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39101, 34702, 0, 0, 0xD7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39121, 34702, 0, 0, 0xD7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39141, 34702, 0, 0, 0xD7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39161, 34702, 0, 0, 0xD7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39181, 34702, 0, 0, 0xD7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39202, 34702, 0, 0, 0xDE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39224, 34702, 0, 0, 0xDE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39246, 34702, 0, 0, 0xDE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39268, 34702, 0, 0, 0xDE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39290, 34702, 0, 0, 0xDE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39313, 34702, 0, 0, 0xD8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39331, 34702, 0, 0, 0xD8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39349, 34702, 0, 0, 0xD8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39367, 34702, 0, 0, 0xD8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39385, 34702, 0, 0, 0xD8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39404, 34702, 0, 0, 0xDD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39418, 34702, 0, 0, 0xDD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39435, 34702, 0, 0, 0xDD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39453, 34702, 0, 0, 0xDD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39472, 34702, 0, 0, 0xDD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39491, 34702, 0, 0, 0xDD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39510, 34702, 0, 0, 0xDD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39529, 34702, 0, 0, 0xDD,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39543, 34702, 0, 0, 0xDA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39563, 34702, 0, 0, 0xDA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39583, 34702, 0, 0, 0xDA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39603, 34702, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39625, 34702, 0, 0, 0xDB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39647, 34702, 0, 0, 0xDB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39669, 34702, 0, 0, 0x3B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39684, 34702, 0, 0, 0x3B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39699, 34702, 0, 0, 0x3B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39714, 34702, 0, 0, 0x3B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39729, 34702, 0, 0, 0x3B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39744, 34702, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39752, 34702, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39760, 34702, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39771, 34702, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39784, 34702, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39798, 34702, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39816, 34702, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39835, 39851, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39923, 39938, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {39970, 39986, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40018, 40033, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40065, 40081, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40113, 40132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40164, 40193, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40197, 40193, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40227, 40193, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40251, 40193, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40282, 40193, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40307, 40193, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40339, 40193, 0, 0, 0x37,0x01,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40356, 40193, 0, 0, 0x37,0x02,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40372, 40193, 0, 0, 0x37,0x04,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40386, 40193, 0, 0, 0x37,0x08,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40410, 40193, 0, 0, 0x37,0x10,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40436, 40193, 0, 0, 0x37,0x20,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40453, 40193, 0, 0, 0x37,0x40,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {40472, 40193, 0, 0, 0x37,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40493, 40193, 0, 0, 0x37,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40513, 40193, 0, 0, 0x37,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40531, 40193, 0, 0, 0x37,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40559, 40193, 0, 0, 0x37,0x10,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40589, 40193, 0, 0, 0x37,0x20,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40610, 40193, 0, 0, 0x37,0x40,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40633, 40193, 0, 0, 0x37,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40654, 40193, 0, 0, 0x37,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40674, 40193, 0, 0, 0x37,0x04,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40692, 40193, 0, 0, 0x37,0x08,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40720, 40193, 0, 0, 0x37,0x10,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40750, 40193, 0, 0, 0x37,0x20,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40771, 40193, 0, 0, 0x37,0x40,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40794, 40193, 0, 0, 0x37,0x40,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {40817, 40193, 0, 0, 0x38,0x00,0x1E,0x00,EVENT_OPTION_NONE_MASK}
+, {40831, 40193, 0, 0, 0x38,0x01,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40847, 40193, 0, 0, 0x38,0x02,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40866, 40193, 0, 0, 0x38,0x04,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40888, 40193, 0, 0, 0x38,0x08,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40913, 40193, 0, 0, 0x38,0x10,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40928, 40193, 0, 0, 0x38,0x20,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40953, 40193, 0, 0, 0x38,0x40,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {40980, 40193, 0, 0, 0x38,0x00,0x1D,0x00,EVENT_OPTION_NONE_MASK}
+, {41000, 40193, 0, 0, 0x38,0x00,0x1C,0x00,EVENT_OPTION_NONE_MASK}
+, {41019, 40193, 0, 0, 0x38,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41039, 40193, 0, 0, 0x38,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41062, 40193, 0, 0, 0x38,0x04,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41088, 40193, 0, 0, 0x38,0x08,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41117, 40193, 0, 0, 0x38,0x10,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41136, 40193, 0, 0, 0x38,0x20,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41165, 40193, 0, 0, 0x38,0x40,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41196, 40193, 0, 0, 0x38,0x80,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41218, 40193, 0, 0, 0x38,0x00,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {41242, 40193, 0, 0, 0x38,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {41260, 40193, 0, 0, 0x38,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {41283, 40193, 0, 0, 0x38,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41303, 40193, 0, 0, 0x38,0x02,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41326, 40193, 0, 0, 0x38,0x04,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41352, 40193, 0, 0, 0x38,0x08,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41381, 40193, 0, 0, 0x38,0x10,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41400, 40193, 0, 0, 0x38,0x20,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41429, 40193, 0, 0, 0x38,0x40,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41460, 40193, 0, 0, 0x38,0x80,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41482, 40193, 0, 0, 0x38,0x00,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {41506, 40193, 0, 0, 0x38,0x00,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {41524, 40193, 0, 0, 0x38,0x00,0x0C,0x00,EVENT_OPTION_NONE_MASK}
+, {41547, 40193, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41574, 40193, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41601, 40193, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41610, 40193, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41635, 40193, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41664, 40193, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41688, 40193, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41716, 40193, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41731, 40193, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41748, 40193, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41763, 40193, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41780, 40193, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41799, 40193, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41816, 40193, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41838, 40193, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41852, 40193, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41883, 40193, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41914, 40193, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41933, 40193, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41950, 40193, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41965, 40193, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41982, 40193, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42006, 40193, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42030, 40193, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42049, 40193, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42066, 40193, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42090, 40193, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42115, 40193, 0, 0, 0x5F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {42131, 40193, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42142, 40193, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42157, 40193, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42186, 40193, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42215, 40193, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42239, 40193, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42263, 40193, 0, 0, 0x14,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42281, 40193, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {42302, 40193, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {42323, 40193, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {42344, 40193, 0, 0, 0x14,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {42365, 40193, 0, 0, 0x14,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {42386, 40193, 0, 0, 0x14,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {42407, 40193, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42429, 40193, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42451, 40193, 0, 0, 0x13,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42472, 40193, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {42495, 40193, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {42518, 40193, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {42541, 40193, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42561, 40193, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42581, 40193, 0, 0, 0x11,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42600, 40193, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {42621, 40193, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {42642, 40193, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {42663, 40193, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {42694, 40193, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42723, 40193, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42752, 40193, 0, 0, 0x1F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42780, 40193, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42810, 40193, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42840, 40193, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42869, 42891, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {42895, 42891, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {42917, 42891, 0, 0, 0x12,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {42938, 42891, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {42961, 42891, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {42984, 42891, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {43007, 40193, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43024, 40193, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43040, 40193, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {43055, 40193, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43084, 40193, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43113, 40193, 0, 0, 0x19,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43141, 40193, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43165, 40193, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43189, 40193, 0, 0, 0x18,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43212, 40193, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43234, 40193, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43256, 40193, 0, 0, 0x17,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43277, 40193, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43297, 40193, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43317, 40193, 0, 0, 0x15,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43336, 40193, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43365, 40193, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43394, 40193, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43422, 40193, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43452, 40193, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43482, 40193, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {43511, 40193, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43533, 40193, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43555, 40193, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {43577, 40193, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {43599, 40193, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {43621, 40193, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {43643, 40193, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {43665, 40193, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {43687, 40193, 0, 0, 0x2A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {43711, 40193, 0, 0, 0x2A,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {43735, 40193, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43758, 40193, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43781, 40193, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {43804, 40193, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {43827, 40193, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {43850, 40193, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {43873, 40193, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {43896, 40193, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {43919, 40193, 0, 0, 0x2B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {43944, 40193, 0, 0, 0x2B,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {43969, 40193, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {43984, 40193, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {43997, 40193, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44016, 40193, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44035, 40193, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44054, 40193, 0, 0, 0x43,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44075, 40193, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44099, 40193, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44123, 40193, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44147, 40193, 0, 0, 0x50,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44172, 40193, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44192, 40193, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44212, 40193, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44232, 40193, 0, 0, 0x44,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44254, 40193, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44278, 40193, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44302, 40193, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44326, 40193, 0, 0, 0x4F,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44351, 40193, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44365, 40193, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44379, 40193, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44393, 40193, 0, 0, 0x58,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44409, 40193, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44429, 40193, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44449, 40193, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44469, 40193, 0, 0, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44490, 40193, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44514, 40193, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44538, 40193, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44562, 40193, 0, 0, 0x52,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44587, 40193, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44608, 40193, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44629, 40193, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44650, 40193, 0, 0, 0x4E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44672, 40193, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44696, 40193, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44720, 40193, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44744, 40193, 0, 0, 0x51,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44769, 40193, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44786, 40193, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44803, 40193, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44820, 40193, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44839, 40193, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44854, 40193, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44869, 40193, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44884, 40193, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44901, 40193, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44923, 40193, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44945, 40193, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44967, 40193, 0, 0, 0x47,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {44991, 40193, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45011, 40193, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45031, 40193, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45051, 40193, 0, 0, 0x49,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45073, 40193, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45093, 40193, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45113, 40193, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45133, 40193, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {45154, 40193, 0, 0, 0x4A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45176, 40193, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45199, 40193, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45222, 40193, 0, 0, 0x56,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45245, 40193, 0, 0, 0x56,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45270, 40193, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45288, 40193, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45306, 40193, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45324, 40193, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {45343, 40193, 0, 0, 0x4B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {45369, 40193, 0, 0, 0x4B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {45392, 40193, 0, 0, 0x4B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45412, 40193, 0, 0, 0x55,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45437, 40193, 0, 0, 0x55,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45462, 40193, 0, 0, 0x55,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45487, 40193, 0, 0, 0x55,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {45513, 40193, 0, 0, 0x55,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {45546, 40193, 0, 0, 0x55,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {45576, 40193, 0, 0, 0x55,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45603, 40193, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45636, 40193, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45669, 40193, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45702, 40193, 0, 0, 0x63,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45737, 40193, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45772, 40193, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45807, 40193, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45842, 40193, 0, 0, 0x62,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {45879, 40193, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {45909, 40193, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {45939, 40193, 0, 0, 0x5E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {45969, 40193, 0, 0, 0x5E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46001, 40193, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46033, 40193, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46065, 40193, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {46097, 40193, 0, 0, 0x5D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46131, 40193, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46155, 40193, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46179, 40193, 0, 0, 0x6B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {46203, 40193, 0, 0, 0x6B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46229, 40193, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46251, 40193, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46273, 40193, 0, 0, 0x6C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {46295, 40193, 0, 0, 0x6C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46319, 40193, 0, 0, 0x6A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46341, 40193, 0, 0, 0x6A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46363, 40193, 0, 0, 0x6A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {46385, 40193, 0, 0, 0x6A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46409, 40193, 0, 0, 0x76,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46431, 40193, 0, 0, 0x76,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46453, 40193, 0, 0, 0x76,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {46475, 40193, 0, 0, 0x76,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {46499, 40193, 0, 0, 0x6E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {46532, 40193, 0, 0, 0x6E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {46565, 40193, 0, 0, 0x6E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {46597, 40193, 0, 0, 0x6E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {46630, 40193, 0, 0, 0x6E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {46663, 40193, 0, 0, 0x6E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {46696, 40193, 0, 0, 0x6E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {46728, 40193, 0, 0, 0x6E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {46761, 40193, 0, 0, 0x6E,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {46794, 40193, 0, 0, 0x6E,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {46827, 40193, 0, 0, 0x6E,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {46859, 40193, 0, 0, 0x6E,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {46892, 40193, 0, 0, 0x6E,0x11,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {46927, 40193, 0, 0, 0x6E,0x22,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {46962, 40193, 0, 0, 0x6E,0x44,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {46996, 40193, 0, 0, 0x6E,0x88,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {47031, 40193, 0, 0, 0x6F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47060, 40193, 0, 0, 0x6F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47089, 40193, 0, 0, 0x6F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {47118, 40193, 0, 0, 0x6F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {47147, 40193, 0, 0, 0x6F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {47176, 40193, 0, 0, 0x6F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {47205, 40193, 0, 0, 0x6F,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {47236, 40193, 0, 0, 0x6F,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {47267, 40193, 0, 0, 0x74,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47296, 40193, 0, 0, 0x74,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47325, 40193, 0, 0, 0x74,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {47354, 40193, 0, 0, 0x74,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {47383, 40193, 0, 0, 0x74,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {47412, 40193, 0, 0, 0x74,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {47441, 40193, 0, 0, 0x74,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {47472, 40193, 0, 0, 0x74,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {47503, 40193, 0, 0, 0x70,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47543, 40193, 0, 0, 0x70,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47586, 40193, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {47622, 40193, 0, 0, 0x70,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {47656, 40193, 0, 0, 0x70,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {47694, 40193, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {47729, 40193, 0, 0, 0x70,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {47766, 40193, 0, 0, 0x70,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {47801, 40193, 0, 0, 0x70,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {47836, 40193, 0, 0, 0x70,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {47872, 40193, 0, 0, 0x70,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {47908, 40193, 0, 0, 0x71,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47948, 40193, 0, 0, 0x71,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47991, 40193, 0, 0, 0x71,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48027, 40193, 0, 0, 0x71,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {48061, 40193, 0, 0, 0x71,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {48099, 40193, 0, 0, 0x71,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {48134, 40193, 0, 0, 0x71,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {48171, 40193, 0, 0, 0x71,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {48206, 40193, 0, 0, 0x71,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {48241, 40193, 0, 0, 0x71,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {48277, 40193, 0, 0, 0x71,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {48313, 40193, 0, 0, 0x72,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48353, 40193, 0, 0, 0x72,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48396, 40193, 0, 0, 0x72,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48432, 40193, 0, 0, 0x72,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {48466, 40193, 0, 0, 0x72,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {48504, 40193, 0, 0, 0x72,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {48539, 40193, 0, 0, 0x72,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {48576, 40193, 0, 0, 0x72,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {48611, 40193, 0, 0, 0x72,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {48646, 40193, 0, 0, 0x72,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {48682, 40193, 0, 0, 0x72,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {48718, 40193, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48742, 40193, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48766, 40193, 0, 0, 0x6D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48790, 40193, 0, 0, 0x6D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {48814, 40193, 0, 0, 0x6D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {48838, 40193, 0, 0, 0x6D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {48862, 40193, 0, 0, 0x6D,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {48888, 40193, 0, 0, 0x6D,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {48914, 40193, 0, 0, 0x7A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48944, 40193, 0, 0, 0x7A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48976, 40193, 0, 0, 0x7A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49016, 40193, 0, 0, 0x7A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49041, 40193, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49059, 40193, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49081, 40193, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49101, 40193, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49123, 40193, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49151, 40193, 0, 0, 0x7F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49179, 40193, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49207, 40193, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49235, 40193, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49252, 40193, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49271, 40193, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49299, 40193, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49327, 40193, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49355, 40193, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49383, 40193, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49405, 40193, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49427, 40193, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49449, 40193, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49471, 40193, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49486, 40193, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49501, 40193, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49516, 49531, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49536, 49531, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49563, 49531, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49590, 49531, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49617, 49531, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49644, 49531, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49671, 49531, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49698, 49531, 0, 0, 0x33,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {49727, 49531, 0, 0, 0x33,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {49756, 49531, 0, 0, 0x33,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {49785, 49531, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49808, 49531, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49831, 49531, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49854, 49531, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49877, 49531, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49900, 49531, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49923, 49531, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49946, 49531, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49969, 49531, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49992, 49531, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {50017, 49531, 0, 0, 0x32,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {50042, 49531, 0, 0, 0x32,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {50067, 49531, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50089, 49531, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50111, 49531, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50133, 49531, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50155, 49531, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {50173, 49531, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50193, 49531, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50213, 49531, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50233, 49531, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50253, 49531, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {50269, 49531, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50290, 49531, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50311, 49531, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50332, 49531, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50360, 49531, 0, 0, 0x25,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50381, 49531, 0, 0, 0x25,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50402, 49531, 0, 0, 0x25,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50423, 49531, 0, 0, 0x25,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {50451, 49531, 0, 0, 0x25,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {50474, 49531, 0, 0, 0x25,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {50497, 49531, 0, 0, 0x25,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {50520, 49531, 0, 0, 0x25,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {50544, 49531, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50563, 49531, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50582, 49531, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50601, 49531, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50630, 49531, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50649, 49531, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50668, 49531, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50687, 49531, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {50716, 49531, 0, 0, 0x23,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {50737, 49531, 0, 0, 0x23,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {50758, 49531, 0, 0, 0x23,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {50779, 49531, 0, 0, 0x23,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {50810, 49531, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50827, 49531, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50844, 49531, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50865, 49531, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50882, 49531, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50899, 49531, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {50920, 49531, 0, 0, 0x24,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {50939, 49531, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {50958, 49531, 0, 0, 0x24,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {50981, 49531, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51019, 49531, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51057, 49531, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51095, 49531, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51133, 49531, 0, 0, 0x46,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51171, 49531, 0, 0, 0x46,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51209, 49531, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {51247, 49531, 0, 0, 0x46,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {51285, 49531, 0, 0, 0x46,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {51319, 49531, 0, 0, 0x46,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {51353, 49531, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51391, 49531, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51429, 49531, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51467, 49531, 0, 0, 0x47,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51505, 49531, 0, 0, 0x47,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {51539, 49531, 0, 0, 0x47,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {51573, 49531, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51611, 49531, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51649, 49531, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51687, 49531, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51725, 49531, 0, 0, 0x19,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51763, 49531, 0, 0, 0x19,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51801, 49531, 0, 0, 0x19,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {51839, 49531, 0, 0, 0x19,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {51877, 49531, 0, 0, 0x19,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {51910, 49531, 0, 0, 0x19,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {51943, 49531, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51981, 49531, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52019, 49531, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52057, 49531, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52095, 49531, 0, 0, 0x1A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {52128, 49531, 0, 0, 0x1A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {52161, 49531, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52193, 49531, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52225, 49531, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52257, 49531, 0, 0, 0x17,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {52285, 49531, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52321, 49531, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52357, 49531, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52393, 49531, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52429, 49531, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52465, 49531, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52501, 49531, 0, 0, 0x44,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {52533, 49531, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52572, 49531, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52611, 49531, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52650, 49531, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52689, 49531, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52728, 49531, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52767, 49531, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {52806, 49531, 0, 0, 0x40,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {52845, 49531, 0, 0, 0x40,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {52880, 49531, 0, 0, 0x40,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {52915, 49531, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52954, 49531, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52993, 49531, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53032, 49531, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53071, 49531, 0, 0, 0x41,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {53106, 49531, 0, 0, 0x41,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {53141, 49531, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53179, 49531, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53217, 49531, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53255, 49531, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53293, 49531, 0, 0, 0x4A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53331, 49531, 0, 0, 0x4A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {53369, 49531, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53407, 49531, 0, 0, 0x4A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {53445, 49531, 0, 0, 0x4A,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {53479, 49531, 0, 0, 0x4A,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {53513, 49531, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53551, 49531, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53589, 49531, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53627, 49531, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53665, 49531, 0, 0, 0x4B,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {53699, 49531, 0, 0, 0x4B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {53733, 53761, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53793, 53761, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53821, 53761, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53850, 53761, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53879, 53761, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53901, 49531, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53928, 49531, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53955, 49531, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53983, 49531, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54011, 49531, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {54032, 49531, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54060, 49531, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54088, 49531, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54117, 49531, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54146, 49531, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {54168, 49531, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54204, 49531, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54240, 49531, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54276, 49531, 0, 0, 0x48,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54312, 49531, 0, 0, 0x48,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {54348, 49531, 0, 0, 0x48,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {54384, 49531, 0, 0, 0x48,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {54419, 49531, 0, 0, 0x48,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {54454, 49531, 0, 0, 0x48,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {54489, 49531, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54525, 49531, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54561, 49531, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54597, 49531, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54630, 49531, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54663, 49531, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54696, 49531, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {54729, 49531, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {54762, 49531, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {54795, 49531, 0, 0, 0x1B,0x15,0,0,EVENT_OPTION_NONE_MASK}
+, {54827, 49531, 0, 0, 0x1B,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {54859, 49531, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {54892, 49531, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {54925, 49531, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {54958, 49531, 0, 0, 0x18,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {54987, 49531, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {55024, 49531, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {55061, 49531, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {55098, 49531, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {55131, 49531, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {55168, 49531, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {55205, 49531, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {55242, 49531, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {55279, 49531, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {55316, 49531, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {55353, 49531, 0, 0, 0x42,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {55389, 49531, 0, 0, 0x42,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {55425, 49531, 0, 0, 0x42,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {55461, 49531, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {55498, 49531, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {55535, 49531, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {55572, 49531, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {55608, 49531, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {55644, 49531, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {55680, 49531, 0, 0, 0x4C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {55716, 49531, 0, 0, 0x4C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {55752, 49531, 0, 0, 0x4C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {55788, 49531, 0, 0, 0x4C,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {55823, 49531, 0, 0, 0x4C,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {55858, 49531, 0, 0, 0x4C,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {55893, 49531, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {55929, 49531, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {55965, 49531, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56001, 49531, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56023, 49531, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56045, 49531, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56067, 49531, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56087, 49531, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56107, 49531, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56127, 53761, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56143, 53761, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56159, 56180, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56185, 56180, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56205, 56180, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56226, 56180, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {56247, 56180, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56273, 56180, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56299, 56180, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56325, 56180, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {56351, 56180, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {56377, 56180, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {56403, 56180, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {56424, 56180, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {56449, 56180, 0, 0, 0x23,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {56474, 56180, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56499, 56180, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56524, 56180, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56549, 56180, 0, 0, 0x3E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {56574, 56180, 0, 0, 0x3E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {56599, 56180, 0, 0, 0x3E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {56624, 56180, 0, 0, 0x3E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {56647, 56180, 0, 0, 0x3E,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {56670, 56180, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56694, 56180, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56718, 56180, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56742, 56180, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {56766, 56180, 0, 0, 0x4B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {56789, 56180, 0, 0, 0x4B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {56813, 56180, 0, 0, 0x4B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {56837, 56180, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {56861, 56180, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {56885, 56180, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {56909, 56180, 0, 0, 0x4C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {56933, 56180, 0, 0, 0x4C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {56956, 56180, 0, 0, 0x4C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {56980, 56180, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57004, 56180, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {57032, 56180, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {57060, 56180, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {57088, 56180, 0, 0, 0x4D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {57116, 56180, 0, 0, 0x4D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {57151, 56180, 0, 0, 0x4D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {57186, 56180, 0, 0, 0x4D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57217, 56180, 0, 0, 0x4D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {57247, 56180, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {57272, 56180, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {57297, 56180, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {57322, 56180, 0, 0, 0x47,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {57347, 56180, 0, 0, 0x47,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {57371, 56180, 0, 0, 0x47,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {57396, 56180, 0, 0, 0x47,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57421, 56180, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {57446, 56180, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {57471, 56180, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {57496, 56180, 0, 0, 0x48,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {57521, 56180, 0, 0, 0x48,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {57545, 56180, 0, 0, 0x48,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {57570, 56180, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57595, 56180, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {57620, 56180, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {57645, 56180, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {57670, 56180, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {57695, 56180, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {57719, 56180, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {57744, 56180, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57769, 56180, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {57794, 56180, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {57819, 56180, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {57844, 56180, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {57869, 56180, 0, 0, 0x4A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {57893, 56180, 0, 0, 0x4A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {57918, 56180, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {57943, 57967, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58039, 57967, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58065, 57967, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58092, 57967, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {58119, 56180, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58145, 56180, 0, 0, 0x5F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58171, 56180, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58203, 56180, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {58235, 56180, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {58260, 56180, 0, 0, 0x5F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {58285, 56180, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58308, 56180, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58334, 56180, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58360, 56180, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {58380, 56180, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {58402, 56180, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {58423, 56180, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {58444, 56180, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58469, 56180, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58494, 56180, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58519, 56180, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {58544, 56180, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {58568, 56180, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {58593, 56180, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {58618, 56180, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58643, 56180, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58668, 56180, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58693, 56180, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {58718, 56180, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {58742, 56180, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {58767, 56180, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {58792, 56180, 0, 0, 0x55,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58820, 56180, 0, 0, 0x55,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58851, 56180, 0, 0, 0x55,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {58890, 56180, 0, 0, 0x55,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {58921, 56180, 0, 0, 0x55,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {58952, 56180, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {58977, 56180, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59002, 56180, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59032, 56180, 0, 0, 0x57,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59058, 56180, 0, 0, 0x57,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {59088, 56180, 0, 0, 0x57,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {59117, 56180, 0, 0, 0x57,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {59148, 56180, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {59178, 56180, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59209, 56180, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59241, 56180, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59273, 56180, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {59295, 56180, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59323, 56180, 0, 0, 0x56,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59349, 56180, 0, 0, 0x56,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59375, 56180, 0, 0, 0x56,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {59404, 56180, 0, 0, 0x56,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {59444, 56180, 0, 0, 0x56,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {59483, 56180, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {59507, 56180, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59536, 56180, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59567, 56180, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59599, 56180, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {59635, 56180, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {59670, 56180, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {59704, 56180, 0, 0, 0x51,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {59739, 56180, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {59765, 56180, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59797, 56180, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59819, 56180, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59845, 56180, 0, 0, 0x52,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {59872, 56180, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {59897, 56180, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59923, 56180, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {59949, 56180, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {59978, 56180, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60005, 56180, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60032, 56180, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {60059, 56180, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60085, 56180, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60114, 56180, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60151, 56180, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {60184, 56180, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60217, 56180, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60253, 56180, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {60289, 56180, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60302, 56180, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60315, 56180, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60341, 56180, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {60367, 56180, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60389, 56180, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60411, 56180, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60434, 56180, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60457, 56180, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60480, 56180, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {60503, 56180, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60525, 56180, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60548, 56180, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {60571, 56180, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60594, 56180, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60617, 56180, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60640, 56180, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {60663, 56180, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60685, 56180, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60708, 56180, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {60731, 56180, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60756, 56180, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60781, 56180, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60806, 56180, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {60831, 56180, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {60855, 56180, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {60880, 56180, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {60905, 56180, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {60930, 56180, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {60955, 56180, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {60980, 56180, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61005, 56180, 0, 0, 0x46,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61029, 56180, 0, 0, 0x46,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61054, 56180, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {61079, 56180, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {61107, 56180, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61135, 56180, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {61163, 56180, 0, 0, 0x4E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61191, 56180, 0, 0, 0x4E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61218, 56180, 0, 0, 0x4E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61246, 56180, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {61274, 56180, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {61302, 56180, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61330, 56180, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {61358, 56180, 0, 0, 0x4F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61386, 56180, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61413, 56180, 0, 0, 0x4F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61441, 56180, 0, 0, 0x4F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {61469, 56180, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {61491, 56180, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61507, 56180, 0, 0, 0x5A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {61523, 56180, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61539, 56180, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61556, 56180, 0, 0, 0x5A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61579, 56180, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {61616, 56180, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61651, 56180, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {61677, 56180, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61703, 56180, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61732, 56180, 0, 0, 0x59,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61761, 56180, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {61790, 56180, 0, 0, 0x59,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {61819, 56180, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {61843, 56180, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61867, 56180, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {61891, 56180, 0, 0, 0x30,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {61914, 56180, 0, 0, 0x30,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {61938, 56180, 0, 0, 0x30,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {61962, 56180, 0, 0, 0x30,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {61986, 56180, 0, 0, 0x30,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {62009, 56180, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {62036, 56180, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {62063, 56180, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {62090, 56180, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {62121, 56180, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {62150, 56180, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {62179, 56180, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {62208, 56180, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {62236, 56180, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {62265, 56180, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {62294, 56180, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {62323, 56180, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {62351, 56180, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {62378, 56180, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {62405, 56180, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {62432, 56180, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {62458, 56180, 0, 0, 0x2D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {62485, 56180, 0, 0, 0x2D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {62512, 56180, 0, 0, 0x2D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {62539, 56180, 0, 0, 0x2D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {62565, 56180, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {62594, 56180, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {62623, 56180, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {62652, 56180, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {62680, 56180, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {62709, 56180, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {62738, 56180, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {62767, 56180, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {62795, 56180, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {62819, 56180, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {62842, 56180, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {62866, 56180, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {62890, 56180, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {62914, 56180, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {62937, 56180, 0, 0, 0x35,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {62961, 56180, 0, 0, 0x35,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {62985, 56180, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {63014, 56180, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {63043, 56180, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {63072, 56180, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {63100, 56180, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {63129, 56180, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {63158, 56180, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {63187, 56180, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {63215, 56180, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {63242, 56180, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {63269, 56180, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {63295, 56180, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {63322, 56180, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {63349, 56180, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {63376, 56180, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {63402, 56180, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {63429, 63458, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {63482, 63458, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {63510, 63458, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {63539, 63458, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {63568, 63458, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {63597, 63458, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {63625, 63458, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {63654, 63458, 0, 0, 0x1D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {63683, 63458, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {63717, 63458, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {63753, 63458, 0, 0, 0x1F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {63788, 63458, 0, 0, 0x1F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {63822, 63458, 0, 0, 0x1F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {63858, 63458, 0, 0, 0x1F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {63893, 56180, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {63912, 63458, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {63933, 56180, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {63963, 56180, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {63997, 56180, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64031, 56180, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64065, 56180, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64099, 56180, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64133, 56180, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {64167, 56180, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64197, 56180, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64231, 56180, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64269, 56180, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64302, 56180, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64336, 56180, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64374, 56180, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {64407, 56180, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64428, 56180, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64449, 56180, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64470, 56180, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64490, 56180, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64511, 56180, 0, 0, 0x5B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64532, 56180, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64551, 56180, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64570, 56180, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64589, 56180, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64607, 56180, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64626, 56180, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64645, 56180, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64666, 56180, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64687, 56180, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64708, 56180, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64728, 56180, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64749, 56180, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64770, 56180, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64789, 56180, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64808, 56180, 0, 0, 0x5E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64827, 56180, 0, 0, 0x5E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {64845, 56180, 0, 0, 0x5E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {64864, 56180, 0, 0, 0x5E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {64883, 56180, 0, 0, 0x7E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {64918, 56180, 0, 0, 0x7E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {64953, 56180, 0, 0, 0x7E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {64988, 56180, 0, 0, 0x7E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {65023, 56180, 0, 0, 0x7E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {65058, 56180, 0, 0, 0x7E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {65093, 56180, 0, 0, 0x7E,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {65140, 56180, 0, 0, 0x7E,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {65187, 56180, 0, 0, 0x7E,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {65234, 56180, 0, 0, 0x7E,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {65281, 56180, 0, 0, 0x7E,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {65328, 56180, 0, 0, 0x7E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {65375, 56180, 0, 0, 0x7D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {65400, 56180, 0, 0, 0x7D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {65425, 56180, 0, 0, 0x7D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {65453, 56180, 0, 0, 0x7D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {65481, 56180, 0, 0, 0x7D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {65506, 56180, 0, 0, 0x7D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {65531, 56180, 0, 0, 0x7D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {65559, 56180, 0, 0, 0x7D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {65587, 56180, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {65605, 56180, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {65622, 56180, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {65636, 56180, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {65655, 56180, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {65673, 56180, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {65692, 56180, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {65713, 56180, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65722, 56180, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65731, 56180, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65750, 65768, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65776, 65795, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {65800, 65795, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {65819, 65795, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {65838, 65795, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {65862, 65795, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {65881, 65795, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {65908, 65795, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {65925, 65795, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {65942, 65795, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {65968, 65795, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66000, 65795, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66032, 65795, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {66064, 65795, 0, 0, 0x4D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {66096, 65795, 0, 0, 0x4D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {66133, 65795, 0, 0, 0x4D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {66170, 65795, 0, 0, 0x4D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {66207, 65795, 0, 0, 0x4D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {66244, 65795, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66273, 65795, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66303, 65795, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {66340, 65795, 0, 0, 0x4E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {66377, 65795, 0, 0, 0x4E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {66407, 65795, 0, 0, 0x4E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {66437, 65795, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {66468, 65795, 0, 0, 0x4E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {66497, 65795, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66526, 65795, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66556, 65795, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {66568, 65795, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {66582, 66597, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {66602, 66597, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66622, 66597, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66642, 66597, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66670, 66597, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66698, 66597, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {66726, 66597, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {66754, 66597, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {66782, 66597, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {66810, 66597, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {66838, 66597, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {66866, 66597, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {66898, 66597, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {66930, 66597, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {66962, 66597, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {66985, 66597, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {67009, 66597, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {67041, 66597, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {67082, 66597, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {67114, 66597, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {67155, 66597, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {67187, 66597, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {67210, 66597, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {67234, 66597, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {67256, 66597, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {67278, 66597, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {67300, 66597, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {67322, 66597, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {67344, 66597, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67368, 66597, 162, 1, 0x05,0x08,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67396, 66597, 0, 0, 0x05,0x09,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67420, 66597, 162, 1, 0x05,0x09,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67448, 66597, 0, 0, 0x05,0x0A,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67479, 66597, 162, 1, 0x05,0x0A,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67514, 66597, 0, 0, 0x05,0x0C,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67543, 66597, 162, 1, 0x05,0x0C,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67576, 66597, 0, 0, 0x05,0x0D,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67599, 66597, 162, 1, 0x05,0x0D,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67626, 66597, 0, 0, 0x05,0x0E,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67650, 66597, 162, 1, 0x05,0x0E,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67678, 66597, 0, 0, 0x05,0x0F,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67702, 66597, 162, 1, 0x05,0x0F,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67730, 66597, 162, 1, 0x05,0xAA,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67759, 66597, 162, 1, 0x05,0x2A,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {67784, 66597, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {67803, 66597, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {67822, 66597, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {67841, 66597, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {67857, 66597, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {67873, 66597, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {67889, 66597, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {67904, 66597, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {67920, 66597, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {67935, 66597, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {67950, 66597, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {67968, 66597, 0, 0, 0x03,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {67989, 66597, 0, 0, 0x03,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {68010, 66597, 0, 0, 0x03,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {68031, 66597, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {68050, 66597, 0, 0, 0x03,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {68072, 66597, 0, 0, 0x03,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {68094, 66597, 0, 0, 0x03,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {68116, 66597, 0, 0, 0x03,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {68136, 66597, 0, 0, 0x03,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {68157, 66597, 0, 0, 0x03,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {68178, 66597, 0, 0, 0x03,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {68199, 66597, 0, 0, 0x03,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {68218, 66597, 0, 0, 0x03,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {68239, 66597, 0, 0, 0x03,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {68260, 66597, 0, 0, 0x03,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {68281, 66597, 0, 0, 0x03,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {68300, 66597, 0, 0, 0x03,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {68324, 66597, 0, 0, 0x03,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {68348, 66597, 0, 0, 0x03,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {68372, 66597, 0, 0, 0x03,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {68394, 66597, 0, 0, 0x03,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {68413, 66597, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {68431, 66597, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {68449, 66597, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {68467, 66597, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {68487, 66597, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {68507, 66597, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {68527, 66597, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {68551, 66597, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {68575, 66597, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {68599, 66597, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {68623, 66597, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {68647, 66597, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {68671, 66597, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {68696, 66597, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {68717, 66597, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {68745, 66597, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {68771, 66597, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {68792, 66597, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {68815, 66597, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {68836, 66597, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {68859, 66597, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {68875, 66597, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {68891, 66597, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {68907, 66597, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {68922, 66597, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {68938, 66597, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {68953, 66597, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {68970, 66597, 0, 0, 0x02,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {68988, 66597, 0, 0, 0x02,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {69009, 66597, 0, 0, 0x02,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {69030, 66597, 0, 0, 0x02,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {69051, 66597, 0, 0, 0x02,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {69070, 66597, 0, 0, 0x02,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {69092, 66597, 0, 0, 0x02,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {69114, 66597, 0, 0, 0x02,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {69136, 66597, 0, 0, 0x02,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {69156, 66597, 0, 0, 0x02,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {69177, 66597, 0, 0, 0x02,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {69198, 66597, 0, 0, 0x02,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {69219, 66597, 0, 0, 0x02,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {69238, 66597, 0, 0, 0x02,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {69259, 66597, 0, 0, 0x02,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {69280, 66597, 0, 0, 0x02,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {69301, 66597, 0, 0, 0x02,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {69320, 66597, 0, 0, 0x02,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {69344, 66597, 0, 0, 0x02,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {69368, 66597, 0, 0, 0x02,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {69392, 66597, 0, 0, 0x02,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {69414, 66597, 0, 0, 0x02,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {69433, 66597, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69457, 66597, 162, 1, 0x04,0x08,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69485, 66597, 0, 0, 0x04,0x09,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69509, 66597, 162, 1, 0x04,0x09,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69537, 66597, 0, 0, 0x04,0x0A,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69568, 66597, 162, 1, 0x04,0x0A,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69603, 66597, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69632, 66597, 162, 1, 0x04,0x0C,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69665, 66597, 0, 0, 0x04,0x0D,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69688, 66597, 162, 1, 0x04,0x0D,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69715, 66597, 0, 0, 0x04,0x0E,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69739, 66597, 162, 1, 0x04,0x0E,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69767, 66597, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69791, 66597, 162, 1, 0x04,0x0F,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69819, 66597, 162, 1, 0x04,0xAA,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69848, 66597, 162, 1, 0x04,0x2A,0x01,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK|EVENT_OPTION_OPCODE_MASK}
+, {69873, 66597, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69889, 66597, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69903, 66597, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69916, 66597, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69935, 66597, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69953, 66597, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69968, 66597, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {69993, 66597, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70018, 66597, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70043, 66597, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70068, 66597, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70096, 66597, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70123, 66597, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70141, 66597, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70154, 66597, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70166, 66597, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70180, 66597, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70211, 66597, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70239, 70262, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70267, 70262, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70277, 70262, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70296, 70262, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70315, 70262, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70334, 70262, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70353, 70262, 0, 0, 0x49,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70370, 70262, 0, 0, 0x4A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70387, 70262, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70417, 70262, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70439, 70262, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70460, 70262, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70478, 70262, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70507, 70262, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70531, 70262, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70556, 70262, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70580, 70262, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70604, 70262, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70626, 70262, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70650, 70262, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70674, 70262, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70698, 70262, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70712, 70262, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {70743, 70262, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {70774, 70262, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {70805, 70817, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70826, 70838, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70847, 70859, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70868, 70880, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70889, 70904, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {70909, 70904, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70925, 70904, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70942, 70904, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70960, 70904, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {70977, 70904, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {70996, 70904, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71015, 70904, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71033, 70904, 0, 0, 0x12,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {71053, 70904, 0, 0, 0x12,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {71072, 70904, 0, 0, 0x12,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {71094, 70904, 0, 0, 0x12,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {71115, 70904, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71134, 70904, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {71157, 70904, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71183, 70904, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71210, 70904, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71235, 70904, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71250, 70904, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71265, 70904, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71280, 70904, 0, 0, 0x1E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71300, 70904, 0, 0, 0x1E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71320, 70904, 0, 0, 0x1E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71344, 70904, 0, 0, 0x1E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71360, 70904, 0, 0, 0x1E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71378, 70904, 0, 0, 0x1E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {71405, 70904, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71418, 70904, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71431, 70904, 0, 0, 0x1F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71444, 70904, 0, 0, 0x1F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71457, 70904, 0, 0, 0x1F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71478, 70904, 0, 0, 0x1F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71497, 70904, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71517, 70904, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71537, 70904, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71558, 70904, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71580, 70904, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71601, 70904, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71636, 70904, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71657, 70904, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {71692, 70904, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71712, 70904, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71732, 70904, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71751, 70904, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71774, 70904, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71786, 70904, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71800, 71823, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71889, 71912, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71978, 72001, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72067, 72090, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72156, 72179, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72245, 72268, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72334, 72357, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72423, 72446, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72512, 72527, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72578, 72599, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72605, 72599, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72624, 72599, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72639, 72599, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72654, 72599, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72669, 72599, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72683, 72599, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72709, 72599, 0, 0, 0x40,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {72732, 72599, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72757, 72599, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72776, 72599, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72795, 72599, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72814, 72599, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72835, 72599, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72858, 72599, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72882, 72599, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {72902, 72599, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72923, 72599, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72947, 72599, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72969, 72599, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73001, 72599, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73036, 72599, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73071, 72599, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {73096, 72599, 0, 0, 0x43,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {73118, 73138, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73246, 73138, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73266, 73138, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73295, 73138, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73320, 73138, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73349, 73138, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73382, 73138, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73401, 73138, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73420, 73138, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73448, 73138, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73472, 73138, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73500, 73138, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73532, 72599, 163, 2, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73556, 72599, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73564, 72599, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73578, 72599, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73591, 72599, 163, 2, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73618, 72599, 163, 2, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73646, 72599, 163, 2, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73673, 72599, 163, 2, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73699, 72599, 163, 2, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73729, 72599, 163, 2, 0x8E,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73759, 72599, 163, 2, 0x8E,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73794, 72599, 163, 2, 0x8E,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {73822, 72599, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73849, 73886, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73994, 73886, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74031, 73886, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74066, 73886, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74105, 73886, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {74135, 73886, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {74167, 73886, 163, 2, 0xC5,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74201, 72599, 163, 2, 0x91,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74231, 72599, 163, 2, 0x91,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74265, 72599, 163, 2, 0x91,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74290, 72599, 163, 2, 0x91,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74317, 72599, 163, 2, 0x92,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74346, 72599, 163, 2, 0x92,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74375, 72599, 163, 2, 0x92,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74402, 72599, 163, 2, 0x92,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74433, 72599, 163, 2, 0x92,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74455, 72599, 163, 2, 0x92,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74479, 72599, 163, 2, 0x90,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74511, 72599, 163, 2, 0x90,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74547, 72599, 163, 2, 0x90,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74574, 72599, 163, 2, 0x90,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74603, 72599, 163, 2, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74629, 72599, 163, 2, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74655, 72599, 163, 2, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74679, 72599, 163, 2, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74707, 72599, 163, 2, 0x86,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74726, 72599, 163, 2, 0x86,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74747, 72599, 163, 2, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74773, 72599, 163, 2, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74799, 72599, 163, 2, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74823, 72599, 163, 2, 0x87,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74851, 72599, 163, 2, 0x87,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74870, 72599, 163, 2, 0x87,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74891, 72599, 163, 2, 0xD0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74921, 72599, 163, 2, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74952, 72599, 163, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74973, 72599, 163, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {74994, 72599, 163, 2, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75020, 72599, 165, 2, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75046, 72599, 167, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75078, 72599, 169, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75110, 72599, 171, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75142, 72599, 173, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75174, 72599, 175, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75206, 72599, 177, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75238, 72599, 179, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75270, 72599, 181, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75302, 72599, 183, 2, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75335, 72599, 167, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75366, 72599, 169, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75397, 72599, 171, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75428, 72599, 173, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75459, 72599, 175, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75490, 72599, 177, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75521, 72599, 179, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75552, 72599, 181, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75583, 72599, 185, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75615, 72599, 183, 2, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75647, 72599, 167, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75678, 72599, 169, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75709, 72599, 171, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75740, 72599, 173, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75771, 72599, 175, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75802, 72599, 177, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75833, 72599, 179, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75864, 72599, 181, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75895, 72599, 185, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75927, 72599, 183, 2, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75959, 72599, 167, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {75989, 72599, 169, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76019, 72599, 171, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76049, 72599, 173, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76079, 72599, 175, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76109, 72599, 177, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76139, 72599, 179, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76169, 72599, 181, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76199, 72599, 185, 2, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76230, 72599, 0, 0, 0xC1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {76261, 72599, 167, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76291, 72599, 169, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76321, 72599, 171, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76351, 72599, 173, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76381, 72599, 175, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76411, 72599, 177, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76441, 72599, 179, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76471, 72599, 181, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76501, 72599, 185, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76532, 72599, 183, 2, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76563, 72599, 167, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76592, 72599, 169, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76621, 72599, 171, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76650, 72599, 173, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76679, 72599, 175, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76708, 72599, 177, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76737, 72599, 179, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76766, 72599, 181, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76795, 72599, 185, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76825, 72599, 183, 2, 0xC1,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76855, 72599, 185, 2, 0xC1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76887, 72599, 183, 2, 0xC1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76919, 72599, 185, 2, 0xC1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76950, 72599, 183, 2, 0xC1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {76981, 72599, 167, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77013, 72599, 169, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77045, 72599, 171, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77077, 72599, 173, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77109, 72599, 175, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77141, 72599, 177, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77173, 72599, 179, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77205, 72599, 181, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77237, 72599, 185, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77270, 72599, 183, 2, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77303, 72599, 167, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77334, 72599, 169, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77365, 72599, 171, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77396, 72599, 173, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77427, 72599, 175, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77458, 72599, 177, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77489, 72599, 179, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77520, 72599, 181, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77551, 72599, 185, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77583, 72599, 183, 2, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77615, 72599, 167, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77643, 72599, 169, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77671, 72599, 171, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77699, 72599, 173, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77727, 72599, 175, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77755, 72599, 177, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77783, 72599, 179, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77811, 72599, 181, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77839, 72599, 185, 2, 0x84,0x1,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77868, 72599, 183, 2, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77897, 72599, 167, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77922, 72599, 169, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77947, 72599, 171, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77972, 72599, 173, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {77997, 72599, 175, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78022, 72599, 177, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78047, 72599, 179, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78072, 72599, 181, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78097, 72599, 185, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78123, 72599, 183, 2, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78149, 72599, 185, 2, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78181, 72599, 183, 2, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78213, 72599, 185, 2, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78244, 72599, 183, 2, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78275, 72599, 185, 2, 0x84,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78302, 72599, 183, 2, 0x84,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78329, 73138, 167, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78362, 73138, 169, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78395, 73138, 171, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78428, 73138, 173, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78461, 73138, 175, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78494, 73138, 177, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78527, 73138, 179, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78560, 73138, 181, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78593, 73138, 185, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78627, 73138, 183, 2, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78661, 73138, 167, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78693, 73138, 169, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78725, 73138, 171, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78757, 73138, 173, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78789, 73138, 175, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78821, 73138, 177, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78853, 73138, 179, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78885, 73138, 181, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78917, 73138, 185, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78950, 73138, 183, 2, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {78983, 73138, 167, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79012, 73138, 169, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79041, 73138, 171, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79070, 73138, 173, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79099, 73138, 175, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79128, 73138, 177, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79157, 73138, 179, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79186, 73138, 181, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79215, 73138, 185, 2, 0x83,0x1,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79245, 73138, 183, 2, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79275, 73138, 167, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79301, 73138, 169, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79327, 73138, 171, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79353, 73138, 173, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79379, 73138, 175, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79405, 73138, 177, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79431, 73138, 179, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79457, 73138, 181, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79483, 73138, 185, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79510, 73138, 183, 2, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79537, 73138, 185, 2, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79570, 73138, 183, 2, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79603, 73138, 185, 2, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79635, 73138, 183, 2, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79667, 73138, 185, 2, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79695, 73138, 183, 2, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79723, 73886, 167, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79756, 73886, 169, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79789, 73886, 171, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79822, 73886, 173, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79855, 73886, 175, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79888, 73886, 177, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79921, 73886, 179, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79954, 73886, 181, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {79987, 73886, 185, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80021, 73886, 183, 2, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80055, 73886, 167, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80087, 73886, 169, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80119, 73886, 171, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80151, 73886, 173, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80183, 73886, 175, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80215, 73886, 177, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80247, 73886, 179, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80279, 73886, 181, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80311, 73886, 185, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80344, 73886, 183, 2, 0xC0,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80377, 73886, 167, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80409, 73886, 169, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80441, 73886, 171, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80473, 73886, 173, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80505, 73886, 175, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80537, 73886, 177, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80569, 73886, 179, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80601, 73886, 181, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80633, 73886, 185, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80666, 73886, 183, 2, 0xC0,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80699, 73886, 167, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80730, 73886, 169, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80761, 73886, 171, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80792, 73886, 173, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80823, 73886, 175, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80854, 73886, 177, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80885, 73886, 179, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80916, 73886, 181, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80947, 73886, 185, 2, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {80979, 73886, 0, 0, 0xC0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {81011, 73886, 167, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81042, 73886, 169, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81073, 73886, 171, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81104, 73886, 173, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81135, 73886, 175, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81166, 73886, 177, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81197, 73886, 179, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81228, 73886, 181, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81259, 73886, 185, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81291, 73886, 183, 2, 0xC0,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81323, 73886, 167, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81353, 73886, 169, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81383, 73886, 171, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81413, 73886, 173, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81443, 73886, 175, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81473, 73886, 177, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81503, 73886, 179, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81533, 73886, 181, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81563, 73886, 185, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81594, 73886, 183, 2, 0xC0,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81625, 73886, 185, 2, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81658, 73886, 183, 2, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81691, 73886, 185, 2, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+, {81723, 73886, 183, 2, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK}
+};
+
+static const PerfmonEventTable icelakeX_arch_events = {
+    NUM_ARCH_EVENTS_ICELAKEX,
+    icelakeX_arch_event_strings,
+    icelakeX_arch_event_options,
+    icelakeX_arch_event_entries
+};
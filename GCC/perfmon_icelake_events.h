@@ -0,0 +1,598 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ICELAKE 264
+
+static const char icelake_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "TOPDOWN_SLOTS\0"
+    "FIXC3\0"
+    "RETIRING\0"
+    "TMA0\0"
+    "BAD_SPECULATION\0"
+    "TMA1\0"
+    "FRONTEND_BOUND\0"
+    "TMA2\0"
+    "BACKEND_BOUND\0"
+    "TMA3\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_ALL_RECOVERY_CYCLES\0"
+    "INT_UOP_DROPPING\0"
+    "INT_CLEAR_RESTEER_CYCLES\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_SWPF_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_SWPF_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "CORE_POWER_LVL0_TURBO_LICENSE\0"
+    "CORE_POWER_LVL1_TURBO_LICENSE\0"
+    "CORE_POWER_LVL2_TURBO_LICENSE\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "SW_PREFETCH_ACCESS_NTA\0"
+    "SW_PREFETCH_ACCESS_T0\0"
+    "SW_PREFETCH_ACCESS_T1_T2\0"
+    "SW_PREFETCH_ACCESS_PREFETCHW\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_REF_DISTRIBUTED\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_FB_FULL_PERIODS\0"
+    "L1D_PEND_MISS_L2_STALL\0"
+    "LOAD_HIT_PREFETCH_SWPF\0"
+    "L1D_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_MEM_ABORT_CAPACITY_READ\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_L3_MISS_DEMAND_DATA_RD\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_MITE_CYCLES_OK\0"
+    "IDQ_MITE_CYCLES_ANY\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_DSB_CYCLES_OK\0"
+    "IDQ_DSB_CYCLES_ANY\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_MS_CYCLES_ANY\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_ALL\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4_9\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7_8\0"
+    "RESOURCE_STALLS_SCOREBOARD\0"
+    "RESOURCE_STALLS_SB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "TOPDOWN_SLOTS_P\0"
+    "TOPDOWN_BACKEND_BOUND_SLOTS\0"
+    "TOPDOWN_BR_MISPREDICT_SLOTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB2MITE_SWITCHES_PENALTY_COUNT\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_X87\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_STALL_CYCLES\0"
+    "INST_RETIRED_NOP\0"
+    "ASSISTS_FP\0"
+    "ASSISTS_ANY\0"
+    "UOPS_RETIRED_SLOTS\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_COND_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_COND_NTAKEN\0"
+    "BR_INST_RETIRED_COND\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_INST_RETIRED_INDIRECT\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_COND_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT_CALL\0"
+    "BR_MISP_RETIRED_COND_NTAKEN\0"
+    "BR_MISP_RETIRED_COND\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_SINGLE\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MEM\0"
+    "HLE_RETIRED_ABORTED_UNFRIENDLY\0"
+    "HLE_RETIRED_ABORTED_EVENTS\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MISC_RETIRED_LBR_INSERTS\0"
+    "MISC_RETIRED_PAUSE_INST\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "BACLEARS_ANY\0"
+    "CPU_CLOCK_UNHALTED_DISTRIBUTED\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "L2_LINES_OUT_USELESS_HWPF\0"
+    "SQ_MISC\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_ALL\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0"
+    "PP0_TEMP\0"
+    "MBOX0TMP0\0"
+    "PP1_TEMP\0"
+    "MBOX0TMP1\0";
+
+static const PerfmonEventOption icelake_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+};
+
+static const PerfmonEventEntry icelake_arch_event_entries[NUM_ARCH_EVENTS_ICELAKE] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 134, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 157, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 185, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 212, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 232, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {238, 247, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {252, 268, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {273, 288, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {293, 307, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {312, 336, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {340, 336, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {356, 336, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {388, 336, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 336, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {444, 336, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {476, 336, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {511, 336, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {549, 336, 0, 1, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {578, 336, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {609, 336, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {636, 336, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {669, 336, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {705, 336, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {744, 336, 0, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {774, 336, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {799, 336, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {828, 336, 0, 0, 0x0D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {845, 336, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {870, 336, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {886, 336, 1, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {911, 336, 0, 1, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {932, 336, 3, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {952, 336, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {981, 336, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {999, 336, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1021, 336, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {1046, 336, 0, 0, 0x24,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {1065, 336, 0, 0, 0x24,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 336, 0, 0, 0x24,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {1110, 336, 0, 0, 0x24,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {1131, 336, 0, 0, 0x24,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {1149, 336, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {1177, 336, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1194, 336, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1215, 336, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {1246, 336, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1260, 336, 0, 0, 0x24,0xEF,0,0,EVENT_OPTION_NONE_MASK}
+, {1280, 336, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1310, 336, 0, 0, 0x28,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {1340, 336, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1370, 336, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1393, 336, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1416, 336, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1438, 336, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1463, 336, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1492, 336, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1520, 336, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1548, 336, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1585, 336, 0, 0, 0x3C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1620, 336, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1642, 336, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1664, 336, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1693, 336, 5, 2, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1723, 336, 0, 0, 0x48,0x4,0,0,EVENT_OPTION_NONE_MASK}
+, {1746, 336, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1769, 336, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1785, 336, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1807, 336, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1835, 336, 0, 0, 0x54,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1862, 336, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1900, 336, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1942, 336, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1983, 336, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2037, 336, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2068, 336, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2082, 336, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2096, 336, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2119, 336, 7, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {2139, 336, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2183, 336, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2223, 336, 0, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2275, 336, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2316, 336, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2365, 336, 0, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2429, 336, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2443, 336, 10, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2462, 336, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2482, 336, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2495, 336, 10, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2513, 336, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2532, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2544, 336, 5, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2560, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2578, 336, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2602, 336, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2623, 336, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2645, 336, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2666, 336, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2689, 336, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2714, 336, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2735, 336, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2762, 336, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2792, 336, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2825, 336, 0, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2849, 336, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2863, 336, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2891, 336, 10, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2939, 336, 11, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2979, 336, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3007, 336, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3035, 336, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3065, 336, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3095, 336, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3123, 336, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3151, 336, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3181, 336, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3208, 336, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3227, 336, 13, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3258, 336, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3288, 336, 14, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3318, 336, 15, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3348, 336, 16, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3376, 336, 17, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3407, 336, 10, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3437, 336, 18, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3467, 336, 19, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3497, 336, 0, 0, 0xA4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3513, 336, 0, 0, 0xA4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3541, 336, 0, 0, 0xA4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3569, 336, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3595, 336, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3621, 336, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3647, 336, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3673, 336, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3702, 336, 0, 0, 0xA6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3733, 336, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3742, 336, 20, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3765, 336, 21, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3784, 336, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3817, 336, 22, 2, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3849, 336, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3881, 336, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3909, 336, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3938, 336, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3978, 336, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4008, 336, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4029, 336, 1, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4056, 336, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4082, 336, 14, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4108, 336, 24, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4134, 336, 16, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4160, 336, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4179, 336, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4210, 336, 14, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4241, 336, 24, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4272, 336, 16, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4303, 336, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4321, 336, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4343, 336, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4362, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4379, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4398, 336, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4424, 336, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4441, 336, 0, 0, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4452, 336, 0, 0, 0xC1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4464, 336, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4483, 336, 1, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4509, 336, 25, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4535, 336, 27, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4556, 336, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4587, 336, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4606, 336, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4635, 336, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4662, 336, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4688, 336, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4716, 336, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4744, 336, 0, 0, 0xC4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {4765, 336, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4792, 336, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4819, 336, 0, 0, 0xC4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4844, 336, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4873, 336, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4900, 336, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4930, 336, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4958, 336, 0, 0, 0xC5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {4979, 336, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5006, 336, 0, 0, 0xC5,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5031, 336, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5067, 336, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5103, 336, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5144, 336, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5185, 336, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5226, 336, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5267, 336, 0, 0, 0xC7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5308, 336, 0, 0, 0xC7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5349, 336, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5367, 336, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5386, 336, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5406, 336, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5430, 336, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5461, 336, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5488, 336, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5506, 336, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5525, 336, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5545, 336, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5569, 336, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5595, 336, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5626, 336, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5654, 336, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5681, 336, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5706, 336, 0, 0, 0xCC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5730, 336, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5763, 336, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {5797, 336, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {5825, 336, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5854, 336, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {5884, 336, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {5911, 336, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {5939, 336, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {5960, 336, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5984, 336, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6008, 336, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6032, 336, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6057, 336, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6082, 336, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6107, 336, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6131, 336, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {6155, 336, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6179, 336, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {6203, 336, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6237, 336, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6270, 336, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6304, 336, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6338, 336, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6351, 336, 0, 0, 0xEC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6382, 336, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6406, 336, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6419, 336, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6436, 336, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6452, 336, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6468, 336, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6485, 336, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6500, 336, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6522, 336, 0, 0, 0xF1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {6538, 336, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6558, 336, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6582, 336, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6608, 336, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6616, 336, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6643, 336, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6670, 6683, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6691, 6712, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6717, 6712, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6734, 6746, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6754, 6765, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6773, 6785, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6793, 6802, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6812, 6821, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable icelake_arch_events = {
+    NUM_ARCH_EVENTS_ICELAKE,
+    icelake_arch_event_strings,
+    icelake_arch_event_options,
+    icelake_arch_event_entries
+};
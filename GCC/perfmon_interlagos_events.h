@@ -0,0 +1,1234 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_INTERLAGOS 605
+
+static const char interlagos_arch_event_strings[] =
+    "FPU_PIPE_ASSIGNMENT_PIPE_0\0"
+    "PMC3\0"
+    "FPU_PIPE_ASSIGNMENT_PIPE_1\0"
+    "FPU_PIPE_ASSIGNMENT_PIPE_2\0"
+    "FPU_PIPE_ASSIGNMENT_PIPE_3\0"
+    "FPU_PIPE_ASSIGNMENT_DUAL_PIPE_0\0"
+    "FPU_PIPE_ASSIGNMENT_DUAL_PIPE_1\0"
+    "FPU_PIPE_ASSIGNMENT_DUAL_PIPE_2\0"
+    "FPU_PIPE_ASSIGNMENT_DUAL_PIPE_3\0"
+    "FP_SCHEDULER_EMPTY\0"
+    "PMC\0"
+    "RETIRED_FLOPS_DOUBLE_MULTADD\0"
+    "RETIRED_FLOPS_DOUBLE_DIV\0"
+    "RETIRED_FLOPS_DOUBLE_MUL\0"
+    "RETIRED_FLOPS_DOUBLE_ADD\0"
+    "RETIRED_FLOPS_DOUBLE_ALL\0"
+    "RETIRED_FLOPS_SINGLE_MULTADD\0"
+    "RETIRED_FLOPS_SINGLE_DIV\0"
+    "RETIRED_FLOPS_SINGLE_MUL\0"
+    "RETIRED_FLOPS_SINGLE_ADD\0"
+    "RETIRED_FLOPS_SINGLE_ALL\0"
+    "MOV_SCALAR_OPT_SSE_MOV\0"
+    "MOV_SCALAR_OPT_SSE_MOV_ELIM\0"
+    "MOV_SCALAR_OPT_OPS_OPT\0"
+    "MOV_SCALAR_OPT_SCALAR_OPS\0"
+    "RETIRED_SERIALIZING_OPS_SSE_BOTTOM\0"
+    "PMC3|PMC4|PMC5\0"
+    "RETIRED_SERIALIZING_OPS_SSE_CONTROL_MISPRED\0"
+    "RETIRED_SERIALIZING_OPS_X87_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_X87_CONTROL_MISPRED\0"
+    "CYCLES_BOTTOM_OP\0"
+    "SEGMENT_REGISTER_LOADS_ES\0"
+    "SEGMENT_REGISTER_LOADS_CS\0"
+    "SEGMENT_REGISTER_LOADS_SS\0"
+    "SEGMENT_REGISTER_LOADS_DS\0"
+    "SEGMENT_REGISTER_LOADS_FS\0"
+    "SEGMENT_REGISTER_LOADS_GS\0"
+    "SEGMENT_REGISTER_LOADS_HS\0"
+    "PIPELINE_RESTART_SELFMOD_CODE\0"
+    "PIPELINE_RESTART_PROBE_HIT\0"
+    "LOAD_STORE_QUEUE_FULL_LOAD\0"
+    "PMC0|PMC1|PMC2\0"
+    "LOAD_STORE_QUEUE_FULL_STORE\0"
+    "LOCKED_OPERATION_CYCLES_NON_SPEC_CACHE_MISS\0"
+    "LOCKED_OPERATION_CYCLES_NON_SPEC\0"
+    "LOCKED_OPERATION_LOCKED_INSTR\0"
+    "CLFLUSH_RETIRED\0"
+    "CPUID_RETIRED\0"
+    "LS_DISPATCH_LOADS\0"
+    "LS_DISPATCH_STORES\0"
+    "LS_DISPATCH_LOAD_OP_STORES\0"
+    "CANCELED_STORE_FORWARD\0"
+    "SMI_RECEIVED\0"
+    "CLFLUSH_EXECUTED\0"
+    "DATA_CACHE_ACCESSES\0"
+    "DATA_CACHE_MISSES_STREAMING\0"
+    "DATA_CACHE_MISSES_ALL\0"
+    "DATA_CACHE_REFILLS_VALID\0"
+    "DATA_CACHE_REFILLS_INVALID\0"
+    "DATA_CACHE_REFILLS_ERROR\0"
+    "DATA_CACHE_REFILLS_ALL\0"
+    "DATA_CACHE_REFILLS_SYSTEM\0"
+    "UNIFIED_TLB_HIT_4KB_DATA\0"
+    "UNIFIED_TLB_HIT_2MB_DATA\0"
+    "UNIFIED_TLB_HIT_1GB_DATA\0"
+    "UNIFIED_TLB_HIT_ANY_DATA\0"
+    "UNIFIED_TLB_HIT_4KB_INSTR\0"
+    "UNIFIED_TLB_HIT_2MB_INSTR\0"
+    "UNIFIED_TLB_HIT_1GB_INSTR\0"
+    "UNIFIED_TLB_HIT_ANY_INSTR\0"
+    "UNIFIED_TLB_HIT_ANY\0"
+    "UNIFIED_TLB_MISS_4KB_DATA\0"
+    "UNIFIED_TLB_MISS_2MB_DATA\0"
+    "UNIFIED_TLB_MISS_1GB_DATA\0"
+    "UNIFIED_TLB_MISS_ANY_DATA\0"
+    "UNIFIED_TLB_MISS_4KB_INSTR\0"
+    "UNIFIED_TLB_MISS_2MB_INSTR\0"
+    "UNIFIED_TLB_MISS_1GB_INSTR\0"
+    "UNIFIED_TLB_MISS_ANY_INSTR\0"
+    "UNIFIED_TLB_MISS_ANY\0"
+    "MISALIGNED_ACCESS\0"
+    "PREFETCH_INSTR_DISPATCHED_LOAD\0"
+    "PREFETCH_INSTR_DISPATCHED_STORE\0"
+    "PREFETCH_INSTR_DISPATCHED_NTA\0"
+    "INEFFECTIVE_PREFETCHES_HIT_L1\0"
+    "INEFFECTIVE_PREFETCHES_HIT_L2\0"
+    "MEMORY_REQUESTS_UC\0"
+    "MEMORY_REQUESTS_WC\0"
+    "MEMORY_REQUESTS_WCSS\0"
+    "DATA_PREFETCHER\0"
+    "RESPONSE_ON_CACHE_REFILLS_EXCLUSIVE\0"
+    "RESPONSE_ON_CACHE_REFILLS_MODIFIED\0"
+    "RESPONSE_ON_CACHE_REFILLS_SHARED\0"
+    "RESPONSE_ON_CACHE_REFILLS_OWNED\0"
+    "RESPONSE_ON_CACHE_REFILLS_ERROR\0"
+    "RESPONSE_ON_CACHE_REFILLS_MODIFIED_UNWRITTEN\0"
+    "OCTWORDS_WRITTEN\0"
+    "CACHE_CROSS_INVALIDATES_DC_IC\0"
+    "CACHE_CROSS_INVALIDATES_DC_DC\0"
+    "CACHE_CROSS_INVALIDATES_IC_IC\0"
+    "CACHE_CROSS_INVALIDATES_IC_DC\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "REQUESTS_TO_L2_IC_FILL\0"
+    "REQUESTS_TO_L2_DC_FILL\0"
+    "REQUESTS_TO_L2_TLB_FILL\0"
+    "REQUESTS_TO_L2_NB_PROBE\0"
+    "REQUESTS_TO_L2_CANCELED\0"
+    "REQUESTS_TO_L2_PREFETCH_REQ\0"
+    "L2_CACHE_MISS_IC_FILL\0"
+    "L2_CACHE_MISS_DC_FILL\0"
+    "L2_CACHE_MISS_TLB_WALK\0"
+    "L2_CACHE_MISS_PREFETCH_REQ\0"
+    "L2_FILL_WB_FILL\0"
+    "L2_FILL_WB_WB\0"
+    "L2_FILL_WB_WB_CLEAN\0"
+    "PAGE_SPLINTERING_GUEST\0"
+    "PAGE_SPLINTERING_OTHER\0"
+    "PAGE_SPLINTERING_HOST\0"
+    "L2_PREFETCHER_TRIGGER_LOAD\0"
+    "L2_PREFETCHER_TRIGGER_STORE\0"
+    "INSTRUCTION_CACHE_FETCHES\0"
+    "INSTRUCTION_CACHE_MISSES\0"
+    "INSTRUCTION_CACHE_L2_REFILLS\0"
+    "INSTRUCTION_CACHE_SYSTEM_REFILLS\0"
+    "ITLB_L1_MISS_L2_HIT\0"
+    "ITLB_L1_MISS_L2_MISS_4KB\0"
+    "ITLB_L1_MISS_L2_MISS_2MB\0"
+    "ITLB_L1_MISS_L2_MISS_1GB\0"
+    "ITLB_L1_MISS_L2_MISS_ANY\0"
+    "PIPELINE_RESTART_DUE_TO_ISB\0"
+    "INSTRUCTION_FETCH_STALL\0"
+    "RETURN_STACK_HITS\0"
+    "RETURN_STACK_OVERFLOWS\0"
+    "INSTRUCTION_CACHE_VICTIMS\0"
+    "INSTRUCTION_CACHE_LINES_INVALIDATED_NON_SMC_MISSED\0"
+    "INSTRUCTION_CACHE_LINES_INVALIDATED_NON_SMC_HIT\0"
+    "INSTRUCTION_CACHE_LINES_INVALIDATED_SMC_MISSED\0"
+    "INSTRUCTION_CACHE_LINES_INVALIDATED_SMC_HIT\0"
+    "ITLB_RELOADS\0"
+    "ITLB_RELOADS_ABORTED\0"
+    "RETIRED_INSTRUCTIONS\0"
+    "RETIRED_UOPS\0"
+    "RETIRED_BRANCH_INSTR\0"
+    "RETIRED_MISPREDICTED_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_MISPREDICTED_BRANCH_INSTR\0"
+    "RETIRED_FAR_CONTROL_TRANSFERS\0"
+    "RETIRED_BRANCH_RESYNCS\0"
+    "RETIRED_NEAR_RETURNS\0"
+    "RETIRED_NEAR_RETURNS_MISPRED\0"
+    "RETIRED_INDIRECT_BRANCHES_MISPRED\0"
+    "RETIRED_FP_INSTRUCTIONS_X87\0"
+    "RETIRED_FP_INSTRUCTIONS_MMX\0"
+    "RETIRED_FP_INSTRUCTIONS_SSE\0"
+    "RETIRED_FP_INSTRUCTIONS_ALL\0"
+    "INTERRUPTS_MASKED_CYCLES\0"
+    "INTERRUPTS_TAKEN\0"
+    "DECODER_EMPTY\0"
+    "DISPATCH_STALLS\0"
+    "MICROSEQ_STALL_SERIALIZATION\0"
+    "DISPATCH_STALL_INSTRUCTION_RETIRED_Q_FULL\0"
+    "DISPATCH_STALL_INTEGER_SCHED_Q_FULL\0"
+    "DISPATCH_STALL_FP_SCHED_Q_FULL\0"
+    "DISPATCH_STALL_LDQ_FULL\0"
+    "MICROSEQ_STALL_WAITING_ALL_QUIT\0"
+    "FPU_EXCEPTION_TOTAL_MICROFAULTS\0"
+    "FPU_EXCEPTION_TOTAL_MICROTRAPS\0"
+    "FPU_EXCEPTION_INT2EXT_FAULTS\0"
+    "FPU_EXCEPTION_EXT2INT_FAULTS\0"
+    "FPU_EXCEPTION_BYPASS_FAULTS\0"
+    "FPU_EXCEPTION_ALL\0"
+    "DISPATCH_STALL_STQ_FULL\0"
+    "UNC_DRAM_ACCESSES_DCT0_PAGE_HIT\0"
+    "UPMC\0"
+    "UNC_DRAM_ACCESSES_DCT0_PAGE_MISS\0"
+    "UNC_DRAM_ACCESSES_DCT0_PAGE_CONFLICT\0"
+    "UNC_DRAM_ACCESSES_DCT0_ALL\0"
+    "UNC_DRAM_ACCESSES_DCT1_PAGE_HIT\0"
+    "UNC_DRAM_ACCESSES_DCT1_PAGE_MISS\0"
+    "UNC_DRAM_ACCESSES_DCT1_PAGE_CONFLICT\0"
+    "UNC_DRAM_ACCESSES_DCT1_ALL\0"
+    "UNC_DRAM_ACCESSES_ALL\0"
+    "UNC_DRAM_CONTROLLER_PAGETABLE_OVERFLOW_DCT0\0"
+    "UNC_DRAM_CONTROLLER_PAGETABLE_OVERFLOW_DCT1\0"
+    "UNC_MEMORY_CONTROLLER_DRAM_SLOTS_MISSING_DCT0\0"
+    "UNC_MEMORY_CONTROLLER_DRAM_SLOTS_MISSING_DCT1\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT0_DIMM\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT0_READ_TO_WRITE\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT0_WRITE_TO_READ\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT1_DIMM\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT1_READ_TO_WRITE\0"
+    "UNC_MEMORY_CONTROLLER_TURNAROUNDS_DCT1_WRITE_TO_READ\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_MEM_HIGH\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_MEM_MED\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCT0_DCQ\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCT1_DCQ\0"
+    "UNC_THERMAL_STATUS_HTC_TRIP_POINT_CROSSED\0"
+    "UNC_THERMAL_STATUS_HTCP_INACTIVE\0"
+    "UNC_THERMAL_STATUS_HTCP_ACTIVE\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_CPU_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_IO_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_CPU_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_IO_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_REMOTE_LOCAL_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_REMOTE_LOCAL_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_ANY_CPU_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_ANY_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_ANY_IO_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_ANY_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_ANY_LOCAL_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_ANY_LOCAL_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_ANY_ANY_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_ANY_ANY_IO_IO\0"
+    "UNC_CACHE_BLOCK_COMMANDS_VICTIM_BLOCK\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK_SHARED\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK_MODIFIED\0"
+    "UNC_CACHE_BLOCK_COMMANDS_CHANGE_TO_DIRTY\0"
+    "UNC_SIZED_COMMANDS_NP_WR_BYTE\0"
+    "UNC_SIZED_COMMANDS_NP_WR_DW\0"
+    "UNC_SIZED_COMMANDS_P_WR_BYTE\0"
+    "UNC_SIZED_COMMANDS_P_WR_DW\0"
+    "UNC_SIZED_COMMANDS_RE_BYTE\0"
+    "UNC_SIZED_COMMANDS_RE_DW\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_MISS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_CLEAN\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_DIRTY_WITHOUT_CANCEL\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_DIRTY_WITH_CANCEL\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_DISPLAY_READS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_NON_DISPLAY_READS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_ISOC_WRITED\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_NON_ISOC_WRITES\0"
+    "UNC_GART_EVENTS_APERTURE_HIT_CPU\0"
+    "UNC_GART_EVENTS_APERTURE_HIT_IO\0"
+    "UNC_GART_EVENTS_MISS\0"
+    "UNC_GART_EVENTS_REQUEST_WALK\0"
+    "UNC_GART_EVENTS_MULTIPLE_WALK\0"
+    "UNC_LINK_TRANSMIT_BW_L0_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L0_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L0_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L0_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L0_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L0_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L0_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S0_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L0_S1_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L1_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L1_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L1_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L1_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L1_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L1_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L1_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S0_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L1_S1_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L2_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L2_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L2_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L2_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L2_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L2_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L2_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S0_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L2_S1_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L3_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L3_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L3_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L3_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L3_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L3_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L3_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S0_CRC\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_USE\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_NOP\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_CMDS\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_DATA\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_BUF_REL\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_ADDR\0"
+    "UNC_LINK_TRANSMIT_BW_L3_S1_CRC\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_0\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_1\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_2\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_3\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_4\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_5\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_6\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_7\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_ALL\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_0\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_1\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_2\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_3\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_4\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_5\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_6\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_7\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_ALL\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_7\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_WRITE_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_READ_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_PREFETCH_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_32_SIZED_WRITES\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_64_SIZED_WRITES\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_32_SIZED_READS\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_64_SIZED_READS\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_READ_WHILE_WRITE\0"
+    "UNC_READ_REQ_TO_L3_CORE_0\0"
+    "UNC_READ_REQ_TO_L3_CORE_1\0"
+    "UNC_READ_REQ_TO_L3_CORE_2\0"
+    "UNC_READ_REQ_TO_L3_CORE_3\0"
+    "UNC_READ_REQ_TO_L3_CORE_4\0"
+    "UNC_READ_REQ_TO_L3_CORE_5\0"
+    "UNC_READ_REQ_TO_L3_CORE_6\0"
+    "UNC_READ_REQ_TO_L3_CORE_7\0"
+    "UNC_READ_REQ_TO_L3_ALL\0"
+    "UNC_READ_REQ_TO_L3_CORE_0_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_1_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_2_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_3_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_4_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_5_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_6_PREF\0"
+    "UNC_READ_REQ_TO_L3_CORE_7_PREF\0"
+    "UNC_READ_REQ_TO_L3_ALL_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_0\0"
+    "UNC_L3_CACHE_MISS_CORE_1\0"
+    "UNC_L3_CACHE_MISS_CORE_2\0"
+    "UNC_L3_CACHE_MISS_CORE_3\0"
+    "UNC_L3_CACHE_MISS_CORE_4\0"
+    "UNC_L3_CACHE_MISS_CORE_5\0"
+    "UNC_L3_CACHE_MISS_CORE_6\0"
+    "UNC_L3_CACHE_MISS_CORE_7\0"
+    "UNC_L3_CACHE_MISS_ALL\0"
+    "UNC_L3_CACHE_MISS_CORE_0_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_1_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_2_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_3_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_4_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_5_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_6_PREF\0"
+    "UNC_L3_CACHE_MISS_CORE_7_PREF\0"
+    "UNC_L3_CACHE_MISS_ALL_PREF\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_0_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_1_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_2_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_3_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_4_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_5_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_6_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_7_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_ALL_M\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_0_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_1_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_2_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_3_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_4_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_5_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_6_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_7_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_ALL_O\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_0_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_1_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_2_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_3_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_4_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_5_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_6_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_7_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_ALL_E\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_0_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_1_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_2_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_3_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_4_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_5_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_6_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_7_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_ALL_S\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_0_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_1_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_2_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_3_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_4_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_5_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_6_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_CORE_7_MOES\0"
+    "UNC_L3_FILLS_BY_L2_EVICTS_ALL_MOES\0"
+    "UNC_L3_EVICTS_M\0"
+    "UNC_L3_EVICTS_O\0"
+    "UNC_L3_EVICTS_E\0"
+    "UNC_L3_EVICTS_S\0"
+    "UNC_L3_EVICTS_MOES\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_0\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_1\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_2\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_3\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_4\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_5\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_6\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_CORE_7\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLK_ALL\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_0\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_1\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_2\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_3\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_4\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_5\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_6\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_CORE_7\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKS_ALL\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_0\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_1\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_2\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_3\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_4\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_5\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_6\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_CORE_7\0"
+    "UNC_L3_NON_CANCEL_READ_REQUESTS_RDBLKM_ALL\0"
+    "UNC_L3_LATENCY_CYCLE_COUNT\0"
+    "UNC_L3_LATENCY_REQUEST_COUNT\0";
+
+static const PerfmonEventOption interlagos_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry interlagos_arch_event_entries[NUM_ARCH_EVENTS_INTERLAGOS] = {
+ {0, 27, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32, 27, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {59, 27, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 27, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {113, 27, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {145, 27, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {177, 27, 0, 0, 0x00,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {209, 27, 0, 0, 0x00,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {241, 260, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {264, 27, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {293, 27, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {318, 27, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {343, 27, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 27, 0, 0, 0x03,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {393, 27, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {422, 27, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {447, 27, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {472, 27, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {497, 27, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {522, 27, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {545, 27, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {573, 27, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {596, 27, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {622, 657, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {672, 657, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {716, 657, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {751, 657, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {795, 657, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {812, 260, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {838, 260, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {864, 260, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {890, 260, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {916, 260, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {942, 260, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {968, 260, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {994, 260, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1024, 260, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1051, 1078, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 1078, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1121, 260, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1165, 260, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1198, 260, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1228, 260, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1244, 260, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1258, 260, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1276, 260, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1295, 260, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1322, 260, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1345, 260, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1358, 260, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1375, 260, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1395, 260, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1423, 260, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1445, 260, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1470, 260, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1497, 260, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1522, 260, 0, 0, 0x42,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1545, 1078, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1571, 1078, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1596, 1078, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1621, 1078, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1646, 1078, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1671, 1078, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1697, 1078, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1723, 1078, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1749, 1078, 0, 0, 0x45,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {1775, 1078, 0, 0, 0x45,0x77,0,0,EVENT_OPTION_NONE_MASK}
+, {1795, 1078, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1821, 1078, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1847, 1078, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1873, 1078, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1899, 1078, 0, 0, 0x46,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1926, 1078, 0, 0, 0x46,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1953, 1078, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1980, 1078, 0, 0, 0x46,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {2007, 1078, 0, 0, 0x46,0x77,0,0,EVENT_OPTION_NONE_MASK}
+, {2028, 260, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2046, 260, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2077, 260, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2109, 260, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2139, 260, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2169, 260, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2199, 1078, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2218, 1078, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2237, 1078, 0, 0, 0x65,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2258, 1078, 0, 0, 0x67,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2274, 1078, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2310, 1078, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2345, 1078, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2378, 1078, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 1078, 0, 0, 0x6C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2442, 1078, 0, 0, 0x6C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2487, 1078, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2504, 1078, 0, 0, 0x75,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2534, 1078, 0, 0, 0x75,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2564, 1078, 0, 0, 0x75,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2594, 1078, 0, 0, 0x75,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2624, 1078, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2644, 1078, 0, 0, 0x7D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2667, 1078, 0, 0, 0x7D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2690, 1078, 0, 0, 0x7D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2714, 1078, 0, 0, 0x7D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2738, 1078, 0, 0, 0x7D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2762, 1078, 0, 0, 0x7D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2790, 1078, 0, 0, 0x7E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2812, 1078, 0, 0, 0x7E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2834, 1078, 0, 0, 0x7E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2857, 1078, 0, 0, 0x7E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2884, 1078, 0, 0, 0x7F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2900, 1078, 0, 0, 0x7F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2914, 1078, 0, 0, 0x7F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2934, 1078, 0, 0, 0x165,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2957, 1078, 0, 0, 0x165,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2980, 1078, 0, 0, 0x165,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3002, 1078, 0, 0, 0x16C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3029, 1078, 0, 0, 0x16C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3057, 1078, 0, 0, 0x080,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3083, 1078, 0, 0, 0x081,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3108, 1078, 0, 0, 0x082,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3137, 1078, 0, 0, 0x083,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3170, 1078, 0, 0, 0x084,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3190, 1078, 0, 0, 0x085,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3215, 1078, 0, 0, 0x085,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3240, 1078, 0, 0, 0x085,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3265, 1078, 0, 0, 0x085,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3290, 1078, 0, 0, 0x086,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3318, 1078, 0, 0, 0x087,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3342, 1078, 0, 0, 0x088,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3360, 1078, 0, 0, 0x089,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3383, 1078, 0, 0, 0x08B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3409, 1078, 0, 0, 0x08C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3460, 1078, 0, 0, 0x08C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3508, 1078, 0, 0, 0x08C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3555, 1078, 0, 0, 0x08C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3599, 1078, 0, 0, 0x099,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3612, 1078, 0, 0, 0x09A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3633, 260, 0, 0, 0x0C0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3654, 260, 0, 0, 0x0C1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3667, 260, 0, 0, 0x0C2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3688, 260, 0, 0, 0x0C3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3722, 260, 0, 0, 0x0C4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3749, 260, 0, 0, 0x0C5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3789, 260, 0, 0, 0x0C6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3819, 260, 0, 0, 0x0C7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3842, 260, 0, 0, 0x0C8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3863, 260, 0, 0, 0x0C9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3892, 260, 0, 0, 0x0CA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3926, 260, 0, 0, 0x0CB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3954, 260, 0, 0, 0x0CB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3982, 260, 0, 0, 0x0CB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4010, 260, 0, 0, 0x0CB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4038, 260, 0, 0, 0x0CD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4063, 260, 0, 0, 0x0CF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4080, 1078, 0, 0, 0x0D0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4094, 1078, 0, 0, 0x0D1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4110, 1078, 0, 0, 0x0D3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4139, 1078, 0, 0, 0x0D5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4181, 1078, 0, 0, 0x0D6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4217, 1078, 0, 0, 0x0D7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4248, 1078, 0, 0, 0x0D8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4272, 1078, 0, 0, 0x0D9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4304, 260, 0, 0, 0x0DB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4336, 260, 0, 0, 0x0DB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4367, 260, 0, 0, 0x0DB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4396, 260, 0, 0, 0x0DB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4425, 260, 0, 0, 0x0DB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4453, 260, 0, 0, 0x0DB,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {4471, 260, 0, 0, 0x0D8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4495, 4527, 0, 0, 0x0E0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4532, 4527, 0, 0, 0x0E0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4565, 4527, 0, 0, 0x0E0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4602, 4527, 0, 0, 0x0E0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4629, 4527, 0, 0, 0x0E0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4661, 4527, 0, 0, 0x0E0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4694, 4527, 0, 0, 0x0E0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {4731, 4527, 0, 0, 0x0E0,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {4758, 4527, 0, 0, 0x0E0,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {4780, 4527, 0, 0, 0x0E1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4824, 4527, 0, 0, 0x0E1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4868, 4527, 0, 0, 0x0E2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4914, 4527, 0, 0, 0x0E2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4960, 4527, 0, 0, 0x0E3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5004, 4527, 0, 0, 0x0E3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5057, 4527, 0, 0, 0x0E3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5110, 4527, 0, 0, 0x0E3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5154, 4527, 0, 0, 0x0E3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5207, 4527, 0, 0, 0x0E3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5260, 4527, 0, 0, 0x0E4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5317, 4527, 0, 0, 0x0E4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5373, 4527, 0, 0, 0x0E4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5430, 4527, 0, 0, 0x0E4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5487, 4527, 0, 0, 0x0E8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5529, 4527, 0, 0, 0x0E8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5562, 4527, 0, 0, 0x0E8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5593, 4527, 0, 0, 0x0E9,0xA8,0,0,EVENT_OPTION_NONE_MASK}
+, {5639, 4527, 0, 0, 0x0E9,0xA4,0,0,EVENT_OPTION_NONE_MASK}
+, {5684, 4527, 0, 0, 0x0E9,0xA2,0,0,EVENT_OPTION_NONE_MASK}
+, {5729, 4527, 0, 0, 0x0E9,0xA1,0,0,EVENT_OPTION_NONE_MASK}
+, {5773, 4527, 0, 0, 0x0E9,0x98,0,0,EVENT_OPTION_NONE_MASK}
+, {5820, 4527, 0, 0, 0x0E9,0x94,0,0,EVENT_OPTION_NONE_MASK}
+, {5866, 4527, 0, 0, 0x0E9,0x92,0,0,EVENT_OPTION_NONE_MASK}
+, {5912, 4527, 0, 0, 0x0E9,0x91,0,0,EVENT_OPTION_NONE_MASK}
+, {5957, 4527, 0, 0, 0x0E9,0x64,0,0,EVENT_OPTION_NONE_MASK}
+, {6003, 4527, 0, 0, 0x0E9,0x61,0,0,EVENT_OPTION_NONE_MASK}
+, {6048, 4527, 0, 0, 0x0E9,0xB8,0,0,EVENT_OPTION_NONE_MASK}
+, {6092, 4527, 0, 0, 0x0E9,0xB4,0,0,EVENT_OPTION_NONE_MASK}
+, {6135, 4527, 0, 0, 0x0E9,0xB2,0,0,EVENT_OPTION_NONE_MASK}
+, {6178, 4527, 0, 0, 0x0E9,0xA1,0,0,EVENT_OPTION_NONE_MASK}
+, {6220, 4527, 0, 0, 0x0E9,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {6263, 4527, 0, 0, 0x0E9,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {6305, 4527, 0, 0, 0x0E9,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {6346, 4527, 0, 0, 0x0E9,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {6386, 4527, 0, 0, 0x0EA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6424, 4527, 0, 0, 0x0EA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6460, 4527, 0, 0, 0x0EA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6503, 4527, 0, 0, 0x0EA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6548, 4527, 0, 0, 0x0EA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6589, 4527, 0, 0, 0x0EB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6619, 4527, 0, 0, 0x0EB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6647, 4527, 0, 0, 0x0EB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6676, 4527, 0, 0, 0x0EB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6703, 4527, 0, 0, 0x0EB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6730, 4527, 0, 0, 0x0EB,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6755, 4527, 0, 0, 0x0EC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6804, 4527, 0, 0, 0x0EC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6858, 4527, 0, 0, 0x0EC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6927, 4527, 0, 0, 0x0EC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6993, 4527, 0, 0, 0x0EC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7054, 4527, 0, 0, 0x0EC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7119, 4527, 0, 0, 0x0EC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7178, 4527, 0, 0, 0x0EC,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7241, 4527, 0, 0, 0x0EE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7274, 4527, 0, 0, 0x0EE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7306, 4527, 0, 0, 0x0EE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7327, 4527, 0, 0, 0x0EE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7356, 4527, 0, 0, 0x0EE,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7386, 4527, 0, 0, 0x0F6,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {7414, 4527, 0, 0, 0x0F6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7442, 4527, 0, 0, 0x0F6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7471, 4527, 0, 0, 0x0F6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7500, 4527, 0, 0, 0x0F6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7532, 4527, 0, 0, 0x0F6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7561, 4527, 0, 0, 0x0F6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7589, 4527, 0, 0, 0x0F6,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {7620, 4527, 0, 0, 0x0F6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 4527, 0, 0, 0x0F6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7683, 4527, 0, 0, 0x0F6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7715, 4527, 0, 0, 0x0F6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7750, 4527, 0, 0, 0x0F6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7782, 4527, 0, 0, 0x0F6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7813, 4527, 0, 0, 0x0F6,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {7844, 4527, 0, 0, 0x0F6,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {7875, 4527, 0, 0, 0x0F6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7907, 4527, 0, 0, 0x0F6,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {7939, 4527, 0, 0, 0x0F6,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {7974, 4527, 0, 0, 0x0F6,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {8006, 4527, 0, 0, 0x0F6,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {8037, 4527, 0, 0, 0x0F7,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8065, 4527, 0, 0, 0x0F7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8093, 4527, 0, 0, 0x0F7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8122, 4527, 0, 0, 0x0F7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8151, 4527, 0, 0, 0x0F7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8183, 4527, 0, 0, 0x0F7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8212, 4527, 0, 0, 0x0F7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8240, 4527, 0, 0, 0x0F7,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8271, 4527, 0, 0, 0x0F7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8302, 4527, 0, 0, 0x0F7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8334, 4527, 0, 0, 0x0F7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8366, 4527, 0, 0, 0x0F7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8401, 4527, 0, 0, 0x0F7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8433, 4527, 0, 0, 0x0F7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8464, 4527, 0, 0, 0x0F7,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {8495, 4527, 0, 0, 0x0F7,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {8526, 4527, 0, 0, 0x0F7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8558, 4527, 0, 0, 0x0F7,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8590, 4527, 0, 0, 0x0F7,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8625, 4527, 0, 0, 0x0F7,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {8657, 4527, 0, 0, 0x0F7,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {8688, 4527, 0, 0, 0x0F8,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8716, 4527, 0, 0, 0x0F8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8744, 4527, 0, 0, 0x0F8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8773, 4527, 0, 0, 0x0F8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8802, 4527, 0, 0, 0x0F8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8834, 4527, 0, 0, 0x0F8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8863, 4527, 0, 0, 0x0F8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8891, 4527, 0, 0, 0x0F8,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8922, 4527, 0, 0, 0x0F8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8953, 4527, 0, 0, 0x0F8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8985, 4527, 0, 0, 0x0F8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9017, 4527, 0, 0, 0x0F8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9052, 4527, 0, 0, 0x0F8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9084, 4527, 0, 0, 0x0F8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9115, 4527, 0, 0, 0x0F8,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {9146, 4527, 0, 0, 0x0F8,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {9177, 4527, 0, 0, 0x0F8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9209, 4527, 0, 0, 0x0F8,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9241, 4527, 0, 0, 0x0F8,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9276, 4527, 0, 0, 0x0F8,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {9308, 4527, 0, 0, 0x0F8,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {9339, 4527, 0, 0, 0x1F9,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {9367, 4527, 0, 0, 0x1F9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9395, 4527, 0, 0, 0x1F9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9424, 4527, 0, 0, 0x1F9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9453, 4527, 0, 0, 0x1F9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9485, 4527, 0, 0, 0x1F9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9514, 4527, 0, 0, 0x1F9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9542, 4527, 0, 0, 0x1F9,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {9573, 4527, 0, 0, 0x1F9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9604, 4527, 0, 0, 0x1F9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9636, 4527, 0, 0, 0x1F9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9668, 4527, 0, 0, 0x1F9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9703, 4527, 0, 0, 0x1F9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9735, 4527, 0, 0, 0x1F9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9766, 4527, 0, 0, 0x1F9,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {9797, 4527, 0, 0, 0x1F9,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {9828, 4527, 0, 0, 0x1F9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9860, 4527, 0, 0, 0x1F9,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9892, 4527, 0, 0, 0x1F9,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9927, 4527, 0, 0, 0x1F9,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {9959, 4527, 0, 0, 0x1F9,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {9990, 4527, 0, 0, 0x1E0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10017, 4527, 0, 0, 0x1E0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10044, 4527, 0, 0, 0x1E0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10071, 4527, 0, 0, 0x1E0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10098, 4527, 0, 0, 0x1E0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10125, 4527, 0, 0, 0x1E0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10152, 4527, 0, 0, 0x1E0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10179, 4527, 0, 0, 0x1E0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10206, 4527, 0, 0, 0x1E0,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {10235, 4527, 0, 0, 0x1E1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10261, 4527, 0, 0, 0x1E1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10287, 4527, 0, 0, 0x1E1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10313, 4527, 0, 0, 0x1E1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10339, 4527, 0, 0, 0x1E1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10365, 4527, 0, 0, 0x1E1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10391, 4527, 0, 0, 0x1E1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10417, 4527, 0, 0, 0x1E1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10443, 4527, 0, 0, 0x1E1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {10471, 4527, 0, 0, 0x1E2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10508, 4527, 0, 0, 0x1E2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10549, 4527, 0, 0, 0x1E2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {10593, 4527, 0, 0, 0x1E2,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {10631, 4527, 0, 0, 0x1E2,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10667, 4527, 0, 0, 0x1E2,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10704, 4527, 0, 0, 0x1E2,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10745, 4527, 0, 0, 0x1E2,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10789, 4527, 0, 0, 0x1E2,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {10827, 4527, 0, 0, 0x1E2,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {10863, 4527, 0, 0, 0x1E2,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10900, 4527, 0, 0, 0x1E2,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10941, 4527, 0, 0, 0x1E2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10985, 4527, 0, 0, 0x1E2,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11023, 4527, 0, 0, 0x1E2,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {11059, 4527, 0, 0, 0x1E2,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {11096, 4527, 0, 0, 0x1E2,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {11137, 4527, 0, 0, 0x1E2,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11181, 4527, 0, 0, 0x1E2,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11219, 4527, 0, 0, 0x1E2,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {11255, 4527, 0, 0, 0x1E3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {11293, 4527, 0, 0, 0x1E3,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {11335, 4527, 0, 0, 0x1E3,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {11380, 4527, 0, 0, 0x1E3,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {11419, 4527, 0, 0, 0x1E3,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11456, 4527, 0, 0, 0x1E3,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {11494, 4527, 0, 0, 0x1E3,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {11536, 4527, 0, 0, 0x1E3,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11581, 4527, 0, 0, 0x1E3,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {11620, 4527, 0, 0, 0x1E3,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {11657, 4527, 0, 0, 0x1E3,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {11695, 4527, 0, 0, 0x1E3,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {11737, 4527, 0, 0, 0x1E3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11782, 4527, 0, 0, 0x1E3,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11821, 4527, 0, 0, 0x1E3,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {11858, 4527, 0, 0, 0x1E3,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {11896, 4527, 0, 0, 0x1E3,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {11938, 4527, 0, 0, 0x1E3,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11983, 4527, 0, 0, 0x1E3,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {12022, 4527, 0, 0, 0x1E3,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {12059, 4527, 0, 0, 0x1E4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12096, 4527, 0, 0, 0x1E4,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {12137, 4527, 0, 0, 0x1E4,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {12181, 4527, 0, 0, 0x1E4,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {12219, 4527, 0, 0, 0x1E4,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 4527, 0, 0, 0x1E4,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12292, 4527, 0, 0, 0x1E4,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12333, 4527, 0, 0, 0x1E4,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12377, 4527, 0, 0, 0x1E4,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {12415, 4527, 0, 0, 0x1E4,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {12451, 4527, 0, 0, 0x1E4,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12488, 4527, 0, 0, 0x1E4,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {12529, 4527, 0, 0, 0x1E4,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12573, 4527, 0, 0, 0x1E4,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {12611, 4527, 0, 0, 0x1E4,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {12647, 4527, 0, 0, 0x1E4,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12684, 4527, 0, 0, 0x1E4,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {12725, 4527, 0, 0, 0x1E4,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12769, 4527, 0, 0, 0x1E4,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {12807, 4527, 0, 0, 0x1E4,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {12843, 4527, 0, 0, 0x1E5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12881, 4527, 0, 0, 0x1E5,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {12923, 4527, 0, 0, 0x1E5,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {12968, 4527, 0, 0, 0x1E5,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {13007, 4527, 0, 0, 0x1E5,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {13044, 4527, 0, 0, 0x1E5,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13082, 4527, 0, 0, 0x1E5,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13124, 4527, 0, 0, 0x1E5,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13169, 4527, 0, 0, 0x1E5,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13208, 4527, 0, 0, 0x1E5,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {13245, 4527, 0, 0, 0x1E5,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {13283, 4527, 0, 0, 0x1E5,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {13325, 4527, 0, 0, 0x1E5,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13370, 4527, 0, 0, 0x1E5,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {13409, 4527, 0, 0, 0x1E5,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {13446, 4527, 0, 0, 0x1E5,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13484, 4527, 0, 0, 0x1E5,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {13526, 4527, 0, 0, 0x1E5,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {13571, 4527, 0, 0, 0x1E5,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13610, 4527, 0, 0, 0x1E5,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {13647, 4527, 0, 0, 0x1E6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {13677, 4527, 0, 0, 0x1E6,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {13708, 4527, 0, 0, 0x1E6,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {13740, 4527, 0, 0, 0x1E6,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {13769, 4527, 0, 0, 0x1E6,0x19,0,0,EVENT_OPTION_NONE_MASK}
+, {13799, 4527, 0, 0, 0x1E6,0x1A,0,0,EVENT_OPTION_NONE_MASK}
+, {13830, 4527, 0, 0, 0x1E6,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {13862, 4527, 0, 0, 0x1E6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {13891, 4527, 0, 0, 0x1E6,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13921, 4527, 0, 0, 0x1E6,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13952, 4527, 0, 0, 0x1E6,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13984, 4527, 0, 0, 0x1E6,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {14013, 4527, 0, 0, 0x1E6,0x29,0,0,EVENT_OPTION_NONE_MASK}
+, {14043, 4527, 0, 0, 0x1E6,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {14074, 4527, 0, 0, 0x1E6,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {14106, 4527, 0, 0, 0x1E6,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {14135, 4527, 0, 0, 0x1E6,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {14165, 4527, 0, 0, 0x1E6,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {14196, 4527, 0, 0, 0x1E6,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {14228, 4527, 0, 0, 0x1E6,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {14257, 4527, 0, 0, 0x1E6,0x49,0,0,EVENT_OPTION_NONE_MASK}
+, {14287, 4527, 0, 0, 0x1E6,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {14318, 4527, 0, 0, 0x1E6,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {14350, 4527, 0, 0, 0x1E6,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {14379, 4527, 0, 0, 0x1E6,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {14409, 4527, 0, 0, 0x1E6,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {14440, 4527, 0, 0, 0x1E6,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {14472, 4527, 0, 0, 0x1E6,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {14501, 4527, 0, 0, 0x1E6,0x89,0,0,EVENT_OPTION_NONE_MASK}
+, {14531, 4527, 0, 0, 0x1E6,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {14562, 4527, 0, 0, 0x1E6,0x8C,0,0,EVENT_OPTION_NONE_MASK}
+, {14594, 4527, 0, 0, 0x1E6,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {14623, 4527, 0, 0, 0x1E7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {14654, 4527, 0, 0, 0x1E7,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {14686, 4527, 0, 0, 0x1E7,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {14719, 4527, 0, 0, 0x1E7,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {14749, 4527, 0, 0, 0x1E7,0x19,0,0,EVENT_OPTION_NONE_MASK}
+, {14780, 4527, 0, 0, 0x1E7,0x1A,0,0,EVENT_OPTION_NONE_MASK}
+, {14812, 4527, 0, 0, 0x1E7,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {14845, 4527, 0, 0, 0x1E7,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {14875, 4527, 0, 0, 0x1E7,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {14906, 4527, 0, 0, 0x1E7,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {14938, 4527, 0, 0, 0x1E7,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {14971, 4527, 0, 0, 0x1E7,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {15001, 4527, 0, 0, 0x1E7,0x29,0,0,EVENT_OPTION_NONE_MASK}
+, {15032, 4527, 0, 0, 0x1E7,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {15064, 4527, 0, 0, 0x1E7,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {15097, 4527, 0, 0, 0x1E7,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {15127, 4527, 0, 0, 0x1E7,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {15158, 4527, 0, 0, 0x1E7,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {15190, 4527, 0, 0, 0x1E7,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {15223, 4527, 0, 0, 0x1E7,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {15253, 4527, 0, 0, 0x1E7,0x49,0,0,EVENT_OPTION_NONE_MASK}
+, {15284, 4527, 0, 0, 0x1E7,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {15316, 4527, 0, 0, 0x1E7,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {15349, 4527, 0, 0, 0x1E7,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {15379, 4527, 0, 0, 0x1E7,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {15410, 4527, 0, 0, 0x1E7,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {15442, 4527, 0, 0, 0x1E7,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {15475, 4527, 0, 0, 0x1E7,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {15505, 4527, 0, 0, 0x1E7,0x89,0,0,EVENT_OPTION_NONE_MASK}
+, {15536, 4527, 0, 0, 0x1E7,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {15568, 4527, 0, 0, 0x1E7,0x8C,0,0,EVENT_OPTION_NONE_MASK}
+, {15601, 4527, 0, 0, 0x1E7,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {15631, 4527, 0, 0, 0x1F0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15676, 4527, 0, 0, 0x1F0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15720, 4527, 0, 0, 0x1F0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15768, 4527, 0, 0, 0x1F0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15815, 4527, 0, 0, 0x1F0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15862, 4527, 0, 0, 0x1F0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15908, 4527, 0, 0, 0x1F0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15954, 4527, 0, 0, 0x1F0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16002, 4527, 0, 0, 0x4E0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {16028, 4527, 0, 0, 0x4E0,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {16054, 4527, 0, 0, 0x4E0,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {16080, 4527, 0, 0, 0x4E0,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {16106, 4527, 0, 0, 0x4E0,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {16132, 4527, 0, 0, 0x4E0,0x57,0,0,EVENT_OPTION_NONE_MASK}
+, {16158, 4527, 0, 0, 0x4E0,0x67,0,0,EVENT_OPTION_NONE_MASK}
+, {16184, 4527, 0, 0, 0x4E0,0x77,0,0,EVENT_OPTION_NONE_MASK}
+, {16210, 4527, 0, 0, 0x4E0,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {16233, 4527, 0, 0, 0x4E0,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {16264, 4527, 0, 0, 0x4E0,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {16295, 4527, 0, 0, 0x4E0,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {16326, 4527, 0, 0, 0x4E0,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {16357, 4527, 0, 0, 0x4E0,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {16388, 4527, 0, 0, 0x4E0,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {16419, 4527, 0, 0, 0x4E0,0x6F,0,0,EVENT_OPTION_NONE_MASK}
+, {16450, 4527, 0, 0, 0x4E0,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {16481, 4527, 0, 0, 0x4E0,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {16509, 4527, 0, 0, 0x4E1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {16534, 4527, 0, 0, 0x4E1,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {16559, 4527, 0, 0, 0x4E1,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {16584, 4527, 0, 0, 0x4E1,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {16609, 4527, 0, 0, 0x4E1,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {16634, 4527, 0, 0, 0x4E1,0x57,0,0,EVENT_OPTION_NONE_MASK}
+, {16659, 4527, 0, 0, 0x4E1,0x67,0,0,EVENT_OPTION_NONE_MASK}
+, {16684, 4527, 0, 0, 0x4E1,0x77,0,0,EVENT_OPTION_NONE_MASK}
+, {16709, 4527, 0, 0, 0x4E1,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {16731, 4527, 0, 0, 0x4E1,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {16761, 4527, 0, 0, 0x4E1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {16791, 4527, 0, 0, 0x4E1,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {16821, 4527, 0, 0, 0x4E1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {16851, 4527, 0, 0, 0x4E1,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {16881, 4527, 0, 0, 0x4E1,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {16911, 4527, 0, 0, 0x4E1,0x6F,0,0,EVENT_OPTION_NONE_MASK}
+, {16941, 4527, 0, 0, 0x4E1,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {16971, 4527, 0, 0, 0x4E1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {16998, 4527, 0, 0, 0x4E2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17033, 4527, 0, 0, 0x4E2,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {17068, 4527, 0, 0, 0x4E2,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {17103, 4527, 0, 0, 0x4E2,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {17138, 4527, 0, 0, 0x4E2,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {17173, 4527, 0, 0, 0x4E2,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {17208, 4527, 0, 0, 0x4E2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {17243, 4527, 0, 0, 0x4E2,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {17278, 4527, 0, 0, 0x4E2,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {17310, 4527, 0, 0, 0x4E2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17345, 4527, 0, 0, 0x4E2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {17380, 4527, 0, 0, 0x4E2,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {17415, 4527, 0, 0, 0x4E2,0x34,0,0,EVENT_OPTION_NONE_MASK}
+, {17450, 4527, 0, 0, 0x4E2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {17485, 4527, 0, 0, 0x4E2,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {17520, 4527, 0, 0, 0x4E2,0x64,0,0,EVENT_OPTION_NONE_MASK}
+, {17555, 4527, 0, 0, 0x4E2,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {17590, 4527, 0, 0, 0x4E2,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {17622, 4527, 0, 0, 0x4E2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17657, 4527, 0, 0, 0x4E2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {17692, 4527, 0, 0, 0x4E2,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {17727, 4527, 0, 0, 0x4E2,0x32,0,0,EVENT_OPTION_NONE_MASK}
+, {17762, 4527, 0, 0, 0x4E2,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {17797, 4527, 0, 0, 0x4E2,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {17832, 4527, 0, 0, 0x4E2,0x62,0,0,EVENT_OPTION_NONE_MASK}
+, {17867, 4527, 0, 0, 0x4E2,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {17902, 4527, 0, 0, 0x4E2,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {17934, 4527, 0, 0, 0x4E2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17969, 4527, 0, 0, 0x4E2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {18004, 4527, 0, 0, 0x4E2,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {18039, 4527, 0, 0, 0x4E2,0x31,0,0,EVENT_OPTION_NONE_MASK}
+, {18074, 4527, 0, 0, 0x4E2,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {18109, 4527, 0, 0, 0x4E2,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {18144, 4527, 0, 0, 0x4E2,0x61,0,0,EVENT_OPTION_NONE_MASK}
+, {18179, 4527, 0, 0, 0x4E2,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {18214, 4527, 0, 0, 0x4E2,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {18246, 4527, 0, 0, 0x4E2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18284, 4527, 0, 0, 0x4E2,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {18322, 4527, 0, 0, 0x4E2,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {18360, 4527, 0, 0, 0x4E2,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {18398, 4527, 0, 0, 0x4E2,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {18436, 4527, 0, 0, 0x4E2,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {18474, 4527, 0, 0, 0x4E2,0x6F,0,0,EVENT_OPTION_NONE_MASK}
+, {18512, 4527, 0, 0, 0x4E2,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {18550, 4527, 0, 0, 0x4E2,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {18585, 4527, 0, 0, 0x4E3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18601, 4527, 0, 0, 0x4E3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18617, 4527, 0, 0, 0x4E3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18633, 4527, 0, 0, 0x4E3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18649, 4527, 0, 0, 0x4E3,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18668, 4527, 0, 0, 0x4ED,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18713, 4527, 0, 0, 0x4ED,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {18758, 4527, 0, 0, 0x4ED,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {18803, 4527, 0, 0, 0x4ED,0x31,0,0,EVENT_OPTION_NONE_MASK}
+, {18848, 4527, 0, 0, 0x4ED,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {18893, 4527, 0, 0, 0x4ED,0x51,0,0,EVENT_OPTION_NONE_MASK}
+, {18938, 4527, 0, 0, 0x4ED,0x61,0,0,EVENT_OPTION_NONE_MASK}
+, {18983, 4527, 0, 0, 0x4ED,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {19028, 4527, 0, 0, 0x4ED,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {19070, 4527, 0, 0, 0x4ED,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19116, 4527, 0, 0, 0x4ED,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {19162, 4527, 0, 0, 0x4ED,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {19208, 4527, 0, 0, 0x4ED,0x32,0,0,EVENT_OPTION_NONE_MASK}
+, {19254, 4527, 0, 0, 0x4ED,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {19300, 4527, 0, 0, 0x4ED,0x52,0,0,EVENT_OPTION_NONE_MASK}
+, {19346, 4527, 0, 0, 0x4ED,0x62,0,0,EVENT_OPTION_NONE_MASK}
+, {19392, 4527, 0, 0, 0x4ED,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {19438, 4527, 0, 0, 0x4ED,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {19481, 4527, 0, 0, 0x4ED,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19527, 4527, 0, 0, 0x4ED,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {19573, 4527, 0, 0, 0x4ED,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {19619, 4527, 0, 0, 0x4ED,0x34,0,0,EVENT_OPTION_NONE_MASK}
+, {19665, 4527, 0, 0, 0x4ED,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {19711, 4527, 0, 0, 0x4ED,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {19757, 4527, 0, 0, 0x4ED,0x64,0,0,EVENT_OPTION_NONE_MASK}
+, {19803, 4527, 0, 0, 0x4ED,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {19849, 4527, 0, 0, 0x4ED,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {19892, 4527, 0, 0, 0x4EF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19919, 4527, 0, 0, 0x4EF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable interlagos_arch_events = {
+    NUM_ARCH_EVENTS_INTERLAGOS,
+    interlagos_arch_event_strings,
+    interlagos_arch_event_options,
+    interlagos_arch_event_entries
+};
@@ -0,0 +1,2598 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_IVYBRIDGEEP 1253
+
+static const char ivybridgeEP_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_DOUBLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_DOUBLE\0"
+    "SIMD_FP_256_PACKED_SINGLE\0"
+    "SIMD_FP_256_PACKED_DOUBLE\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_NUM_DIV\0"
+    "L2_RQSTS_ALL_DEM_AND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEM_AND_DATA_RD\0"
+    "L2_RQSTS_RFO_HITS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_ANY\0"
+    "L2_RQSTS_CODE_RD_HITS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_CODE_CODE_RD\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_HIT_M\0"
+    "L2_STORE_LOCK_RQSTS_ALL\0"
+    "L1D_WB_RQST_HIT_E\0"
+    "L1D_WB_RQST_HIT_M\0"
+    "L1D_WB_RQST_ALL\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC1\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_COUNT\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ALL_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "PMC2\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB_FILL_EXCEED_DSB_LINES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_ALL\0"
+    "OTHER_ASSISTS_AVX_STORE\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "BR_MISP_RETIRED_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_TAKEN\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_MISC_RETIRED_LLC_MISS\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PREF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PF_CLEAN\0"
+    "L2_LINES_OUT_PF_DIRTY\0"
+    "L2_LINES_OUT_DIRTY_ALL\0"
+    "L2_LINES_OUT_CLEAN_ALL\0"
+    "L2_LINES_OUT_ALL\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_REMOTE_FWD\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_0_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_1_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "COUNTER0_OCCUPANCY\0"
+    "CBOX0C1|CBOX1C1|CBOX2C1|CBOX3C1|CBOX4C1|CBOX5C1|CBOX6C1|CBOX7C1|CBOX8C1|CBOX9C1|CBOX10C1|CBOX11C1|CBOX12C1|CBOX13C1|CBOX14C1|CBOX0C2|CBOX1C2|CBOX2C2|CBOX3C2|CBOX4C2|CBOX5C2|CBOX6C2|CBOX7C2|CBOX8C2|CBOX9C2|CBOX10C2|CBOX11C2|CBOX12C2|CBOX13C2|CBOX14C2|CBOX0C3|CBOX1C3|CBOX2C3|CBOX3C3|CBOX4C3|CBOX5C3|CBOX6C3|CBOX7C3|CBOX8C3|CBOX9C3|CBOX10C3|CBOX11C3|CBOX12C3|CBOX13C3|CBOX14C3\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX0C1|CBOX1C1|CBOX2C1|CBOX3C1|CBOX4C1|CBOX5C1|CBOX6C1|CBOX7C1|CBOX8C1|CBOX9C1|CBOX10C1|CBOX11C1|CBOX12C1|CBOX13C1|CBOX14C1\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_NID\0"
+    "LLC_VICTIMS_M_STATE\0"
+    "LLC_VICTIMS_E_STATE\0"
+    "LLC_VICTIMS_S_STATE\0"
+    "LLC_VICTIMS_ANY\0"
+    "LLC_VICTIMS_MISS\0"
+    "LLC_VICTIMS_NID\0"
+    "CBO_MISC_RSPI_WAS_FSE\0"
+    "CBO_MISC_WC_ALIASING\0"
+    "CBO_MISC_STARTED\0"
+    "CBO_MISC_RFO_HIT_S\0"
+    "RING_AD_USED_0_UP_EVEN\0"
+    "CBOX0C2|CBOX1C2|CBOX2C2|CBOX3C2|CBOX4C2|CBOX5C2|CBOX6C2|CBOX7C2|CBOX8C2|CBOX9C2|CBOX10C2|CBOX11C2|CBOX12C2|CBOX13C2|CBOX14C2|CBOX0C3|CBOX1C3|CBOX2C3|CBOX3C3|CBOX4C3|CBOX5C3|CBOX6C3|CBOX7C3|CBOX8C3|CBOX9C3|CBOX10C3|CBOX11C3|CBOX12C3|CBOX13C3|CBOX14C3\0"
+    "RING_AD_USED_0_UP_ODD\0"
+    "RING_AD_USED_0_DOWN_EVEN\0"
+    "RING_AD_USED_0_DOWN_ODD\0"
+    "RING_AD_USED_1_UP_EVEN\0"
+    "RING_AD_USED_1_UP_ODD\0"
+    "RING_AD_USED_1_DOWN_EVEN\0"
+    "RING_AD_USED_1_DOWN_ODD\0"
+    "RING_AD_USED_DOWN\0"
+    "RING_AD_USED_UP\0"
+    "RING_AD_USED_ANY\0"
+    "RING_AK_USED_0_UP_EVEN\0"
+    "RING_AK_USED_0_UP_ODD\0"
+    "RING_AK_USED_0_DOWN_EVEN\0"
+    "RING_AK_USED_0_DOWN_ODD\0"
+    "RING_AK_USED_1_UP_EVEN\0"
+    "RING_AK_USED_1_UP_ODD\0"
+    "RING_AK_USED_1_DOWN_EVEN\0"
+    "RING_AK_USED_1_DOWN_ODD\0"
+    "RING_AK_USED_DOWN\0"
+    "RING_AK_USED_UP\0"
+    "RING_AK_USED_ANY\0"
+    "RING_BL_USED_0_UP_EVEN\0"
+    "RING_BL_USED_0_UP_ODD\0"
+    "RING_BL_USED_0_DOWN_EVEN\0"
+    "RING_BL_USED_0_DOWN_ODD\0"
+    "RING_BL_USED_1_UP_EVEN\0"
+    "RING_BL_USED_1_UP_ODD\0"
+    "RING_BL_USED_1_DOWN_EVEN\0"
+    "RING_BL_USED_1_DOWN_ODD\0"
+    "RING_BL_USED_DOWN\0"
+    "RING_BL_USED_UP\0"
+    "RING_BL_USED_ANY\0"
+    "RING_BOUNCES_AK_IRQ\0"
+    "RING_BOUNCES_AK_CORE\0"
+    "RING_BOUNCES_BL_CORE\0"
+    "RING_BOUNCES_IV_CORE\0"
+    "RING_IV_USED_ANY\0"
+    "RING_IV_USED_UP\0"
+    "RING_IV_USED_DOWN\0"
+    "RING_SRC_THRTL\0"
+    "RXR_EXT_STARVED_IRQ\0"
+    "RXR_EXT_STARVED_IPQ\0"
+    "RXR_EXT_STARVED_PRQ\0"
+    "RXR_EXT_STARVED_ISMQ_BIDS\0"
+    "RXR_INSERTS_IRQ\0"
+    "RXR_INSERTS_IRQ_REJECTED\0"
+    "RXR_INSERTS_IPQ\0"
+    "RXR_INSERTS_VFIFO\0"
+    "RXR_IPQ_RETRY_ANY\0"
+    "RXR_IPQ_RETRY_FULL\0"
+    "RXR_IPQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IPQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_ANY\0"
+    "RXR_IRQ_RETRY_FULL\0"
+    "RXR_IRQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IRQ_RETRY_RTID\0"
+    "RXR_IRQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_HO_CREDITS\0"
+    "RXR_ISMQ_RETRY_ANY\0"
+    "RXR_ISMQ_RETRY_FULL\0"
+    "RXR_ISMQ_RETRY_RTID\0"
+    "RXR_ISMQ_RETRY_QPI_CREDITS\0"
+    "RXR_ISMQ_RETRY_HO_CREDITS\0"
+    "RXR_ISMQ_RETRY_WB_CREDITS\0"
+    "RXR_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0\0"
+    "RXR_OCCUPANCY_IRQ_REJECTED\0"
+    "RXR_OCCUPANCY_IPQ\0"
+    "RXR_OCCUPANCY_VIFO\0"
+    "TOR_INSERTS_OPCODE\0"
+    "TOR_INSERTS_MISS_OPCODE\0"
+    "TOR_INSERTS_EVICTION\0"
+    "TOR_INSERTS_ALL\0"
+    "TOR_INSERTS_WB\0"
+    "TOR_INSERTS_MISS_ALL\0"
+    "TOR_INSERTS_MISS_LOCAL\0"
+    "TOR_INSERTS_MISS_LOCAL_OPCODE\0"
+    "TOR_INSERTS_NID_OPCODE\0"
+    "TOR_INSERTS_NID_EVICTION\0"
+    "TOR_INSERTS_NID_ALL\0"
+    "TOR_INSERTS_NID_WB\0"
+    "TOR_INSERTS_NID_MISS_OPCODE\0"
+    "TOR_INSERTS_NID_MISS_ALL\0"
+    "TOR_INSERTS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_MISS_REMOTE_OPCODE\0"
+    "TOR_INSERTS_REMOTE\0"
+    "TOR_INSERTS_MISS_REMOTE\0"
+    "TOR_OCCUPANCY_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_EVICTION\0"
+    "TOR_OCCUPANCY_ALL\0"
+    "TOR_OCCUPANCY_MISS_ALL\0"
+    "TOR_OCCUPANCY_WB\0"
+    "TOR_OCCUPANCY_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_LOCAL_OPCODE\0"
+    "TOR_OCCUPANCY_LOCAL\0"
+    "TOR_OCCUPANCY_MISS_LOCAL\0"
+    "TOR_OCCUPANCY_NID_OPCODE\0"
+    "TOR_OCCUPANCY_NID_EVICTION\0"
+    "TOR_OCCUPANCY_NID_ALL\0"
+    "TOR_OCCUPANCY_NID_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_NID_MISS_ALL\0"
+    "TOR_OCCUPANCY_NID_WB\0"
+    "TOR_OCCUPANCY_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE_OPCODE\0"
+    "TOR_OCCUPANCY_REMOTE\0"
+    "TOR_OCCUPANCY_MISS_REMOTE\0"
+    "TXR_ADS_USED_AD\0"
+    "TXR_ADS_USED_AK\0"
+    "TXR_ADS_USED_BL\0"
+    "TXR_INSERTS_AD_CACHE\0"
+    "TXR_INSERTS_AK_CACHE\0"
+    "TXR_INSERTS_BL_CACHE\0"
+    "TXR_INSERTS_IV_CACHE\0"
+    "TXR_INSERTS_AD_CORE\0"
+    "TXR_INSERTS_AK_CORE\0"
+    "TXR_INSERTS_BL_CORE\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX3FIX\0"
+    "ACT_COUNT_RD\0"
+    "MBOX\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "DRAM_PRE_ALL\0"
+    "DRAM_REFRESH_PANIC\0"
+    "DRAM_REFRESH_HIGH\0"
+    "ECC_CORRECTABLE_ERRORS\0"
+    "MAJOR_MODES_READ\0"
+    "MAJOR_MODES_WRITE\0"
+    "MAJOR_MODES_PARTIAL\0"
+    "MAJOR_MODES_ISOCH\0"
+    "POWER_CHANNEL_DLLOFF\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_CKE_CYCLES_RANK0\0"
+    "POWER_CKE_CYCLES_RANK1\0"
+    "POWER_CKE_CYCLES_RANK2\0"
+    "POWER_CKE_CYCLES_RANK3\0"
+    "POWER_CKE_CYCLES_RANK4\0"
+    "POWER_CKE_CYCLES_RANK5\0"
+    "POWER_CKE_CYCLES_RANK6\0"
+    "POWER_CKE_CYCLES_RANK7\0"
+    "POWER_CRITICAL_THROTTLE_CYCLES\0"
+    "POWER_PCU_THROTTLING\0"
+    "POWER_SELF_REFRESH\0"
+    "POWER_THROTTLE_CYCLES_RANK0\0"
+    "POWER_THROTTLE_CYCLES_RANK1\0"
+    "POWER_THROTTLE_CYCLES_RANK2\0"
+    "POWER_THROTTLE_CYCLES_RANK3\0"
+    "POWER_THROTTLE_CYCLES_RANK4\0"
+    "POWER_THROTTLE_CYCLES_RANK5\0"
+    "POWER_THROTTLE_CYCLES_RANK6\0"
+    "POWER_THROTTLE_CYCLES_RANK7\0"
+    "PREEMPTION_RD_PREEMPT_RD\0"
+    "PREEMPTION_RD_PREEMPT_WR\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_PAGE_CLOSE\0"
+    "RD_CAS_PRIO_LOW\0"
+    "RD_CAS_PRIO_MED\0"
+    "RD_CAS_PRIO_HIGH\0"
+    "RD_CAS_PRIO_PANIC\0"
+    "RD_CAS_RANK0_BANK0\0"
+    "RD_CAS_RANK0_BANK1\0"
+    "RD_CAS_RANK0_BANK2\0"
+    "RD_CAS_RANK0_BANK3\0"
+    "RD_CAS_RANK0_BANK4\0"
+    "RD_CAS_RANK0_BANK5\0"
+    "RD_CAS_RANK0_BANK6\0"
+    "RD_CAS_RANK0_BANK7\0"
+    "RD_CAS_RANK1_BANK0\0"
+    "RD_CAS_RANK1_BANK1\0"
+    "RD_CAS_RANK1_BANK2\0"
+    "RD_CAS_RANK1_BANK3\0"
+    "RD_CAS_RANK1_BANK4\0"
+    "RD_CAS_RANK1_BANK5\0"
+    "RD_CAS_RANK1_BANK6\0"
+    "RD_CAS_RANK1_BANK7\0"
+    "RD_CAS_RANK2_BANK0\0"
+    "RD_CAS_RANK2_BANK1\0"
+    "RD_CAS_RANK2_BANK2\0"
+    "RD_CAS_RANK2_BANK3\0"
+    "RD_CAS_RANK2_BANK4\0"
+    "RD_CAS_RANK2_BANK5\0"
+    "RD_CAS_RANK2_BANK6\0"
+    "RD_CAS_RANK2_BANK7\0"
+    "RD_CAS_RANK3_BANK0\0"
+    "RD_CAS_RANK3_BANK1\0"
+    "RD_CAS_RANK3_BANK2\0"
+    "RD_CAS_RANK3_BANK3\0"
+    "RD_CAS_RANK3_BANK4\0"
+    "RD_CAS_RANK3_BANK5\0"
+    "RD_CAS_RANK3_BANK6\0"
+    "RD_CAS_RANK3_BANK7\0"
+    "RD_CAS_RANK4_BANK0\0"
+    "RD_CAS_RANK4_BANK1\0"
+    "RD_CAS_RANK4_BANK2\0"
+    "RD_CAS_RANK4_BANK3\0"
+    "RD_CAS_RANK4_BANK4\0"
+    "RD_CAS_RANK4_BANK5\0"
+    "RD_CAS_RANK4_BANK6\0"
+    "RD_CAS_RANK4_BANK7\0"
+    "RD_CAS_RANK5_BANK0\0"
+    "RD_CAS_RANK5_BANK1\0"
+    "RD_CAS_RANK5_BANK2\0"
+    "RD_CAS_RANK5_BANK3\0"
+    "RD_CAS_RANK5_BANK4\0"
+    "RD_CAS_RANK5_BANK5\0"
+    "RD_CAS_RANK5_BANK6\0"
+    "RD_CAS_RANK5_BANK7\0"
+    "RD_CAS_RANK6_BANK0\0"
+    "RD_CAS_RANK6_BANK1\0"
+    "RD_CAS_RANK6_BANK2\0"
+    "RD_CAS_RANK6_BANK3\0"
+    "RD_CAS_RANK6_BANK4\0"
+    "RD_CAS_RANK6_BANK5\0"
+    "RD_CAS_RANK6_BANK6\0"
+    "RD_CAS_RANK6_BANK7\0"
+    "RD_CAS_RANK7_BANK0\0"
+    "RD_CAS_RANK7_BANK1\0"
+    "RD_CAS_RANK7_BANK2\0"
+    "RD_CAS_RANK7_BANK3\0"
+    "RD_CAS_RANK7_BANK4\0"
+    "RD_CAS_RANK7_BANK5\0"
+    "RD_CAS_RANK7_BANK6\0"
+    "RD_CAS_RANK7_BANK7\0"
+    "RPQ_CYCLES_NE\0"
+    "RPQ_INSERTS\0"
+    "VMSE_MXB_WR_OCCUPANCY\0"
+    "VMSE_WR_PUSH\0"
+    "WMM_TO_RMM\0"
+    "WPQ_CYCLES_FULL\0"
+    "WPQ_CYCLES_NE\0"
+    "WPQ_INSERTS\0"
+    "WPQ_READ_HIT\0"
+    "WPQ_WRITE_HIT\0"
+    "WRONG_MM\0"
+    "WR_CAS_RANK0_BANK0\0"
+    "WR_CAS_RANK0_BANK1\0"
+    "WR_CAS_RANK0_BANK2\0"
+    "WR_CAS_RANK0_BANK3\0"
+    "WR_CAS_RANK0_BANK4\0"
+    "WR_CAS_RANK0_BANK5\0"
+    "WR_CAS_RANK0_BANK6\0"
+    "WR_CAS_RANK0_BANK7\0"
+    "WR_CAS_RANK1_BANK0\0"
+    "WR_CAS_RANK1_BANK1\0"
+    "WR_CAS_RANK1_BANK2\0"
+    "WR_CAS_RANK1_BANK3\0"
+    "WR_CAS_RANK1_BANK4\0"
+    "WR_CAS_RANK1_BANK5\0"
+    "WR_CAS_RANK1_BANK6\0"
+    "WR_CAS_RANK1_BANK7\0"
+    "WR_CAS_RANK2_BANK0\0"
+    "WR_CAS_RANK2_BANK1\0"
+    "WR_CAS_RANK2_BANK2\0"
+    "WR_CAS_RANK2_BANK3\0"
+    "WR_CAS_RANK2_BANK4\0"
+    "WR_CAS_RANK2_BANK5\0"
+    "WR_CAS_RANK2_BANK6\0"
+    "WR_CAS_RANK2_BANK7\0"
+    "WR_CAS_RANK3_BANK0\0"
+    "WR_CAS_RANK3_BANK1\0"
+    "WR_CAS_RANK3_BANK2\0"
+    "WR_CAS_RANK3_BANK3\0"
+    "WR_CAS_RANK3_BANK4\0"
+    "WR_CAS_RANK3_BANK5\0"
+    "WR_CAS_RANK3_BANK6\0"
+    "WR_CAS_RANK3_BANK7\0"
+    "WR_CAS_RANK4_BANK0\0"
+    "WR_CAS_RANK4_BANK1\0"
+    "WR_CAS_RANK4_BANK2\0"
+    "WR_CAS_RANK4_BANK3\0"
+    "WR_CAS_RANK4_BANK4\0"
+    "WR_CAS_RANK4_BANK5\0"
+    "WR_CAS_RANK4_BANK6\0"
+    "WR_CAS_RANK4_BANK7\0"
+    "WR_CAS_RANK5_BANK0\0"
+    "WR_CAS_RANK5_BANK1\0"
+    "WR_CAS_RANK5_BANK2\0"
+    "WR_CAS_RANK5_BANK3\0"
+    "WR_CAS_RANK5_BANK4\0"
+    "WR_CAS_RANK5_BANK5\0"
+    "WR_CAS_RANK5_BANK6\0"
+    "WR_CAS_RANK5_BANK7\0"
+    "WR_CAS_RANK6_BANK0\0"
+    "WR_CAS_RANK6_BANK1\0"
+    "WR_CAS_RANK6_BANK2\0"
+    "WR_CAS_RANK6_BANK3\0"
+    "WR_CAS_RANK6_BANK4\0"
+    "WR_CAS_RANK6_BANK5\0"
+    "WR_CAS_RANK6_BANK6\0"
+    "WR_CAS_RANK6_BANK7\0"
+    "WR_CAS_RANK7_BANK0\0"
+    "WR_CAS_RANK7_BANK1\0"
+    "WR_CAS_RANK7_BANK2\0"
+    "WR_CAS_RANK7_BANK3\0"
+    "WR_CAS_RANK7_BANK4\0"
+    "WR_CAS_RANK7_BANK5\0"
+    "WR_CAS_RANK7_BANK6\0"
+    "WR_CAS_RANK7_BANK7\0"
+    "QPI_RATE\0"
+    "SBOX0FIX|SBOX1FIX|SBOX2FIX\0"
+    "QPI_SLOW_MODE\0"
+    "SBOX_CLOCKTICKS\0"
+    "SBOX0|SBOX1|SBOX2\0"
+    "CTO_COUNT\0"
+    "DIRECT2CORE_SUCCESS_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS\0"
+    "DIRECT2CORE_FAILURE_RBT_HIT\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT\0"
+    "DIRECT2CORE_FAILURE_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_MISS\0"
+    "DIRECT2CORE_FAILURE_RBT_MISS\0"
+    "DIRECT2CORE_FAILURE_CREDITS_RBT_MISS\0"
+    "L1_POWER_CYCLES\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_BYPASSED\0"
+    "RXL_CREDITS_CONSUMED_VN0_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN0_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN0_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN0_NDR\0"
+    "RXL_CREDITS_CONSUMED_VN1_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN1_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN1_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN1_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN1_NDR\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_CYCLES_NE\0"
+    "RXL_FLITS_G0_IDLE\0"
+    "RXL_FLITS_G0_DATA\0"
+    "RXL_FLITS_G0_NON_DATA\0"
+    "RXL_FLITS_G1_SNP\0"
+    "RXL_FLITS_G1_HOM_REQ\0"
+    "RXL_FLITS_G1_HOM_NONREQ\0"
+    "RXL_FLITS_G1_HOM\0"
+    "RXL_FLITS_G1_DRS_DATA\0"
+    "RXL_FLITS_G1_DRS_NONDATA\0"
+    "RXL_FLITS_G1_DRS\0"
+    "RXL_FLITS_G2_NDR_AD\0"
+    "RXL_FLITS_G2_NDR_AK\0"
+    "RXL_FLITS_G2_NCB_DATA\0"
+    "RXL_FLITS_G2_NCB_NONDATA\0"
+    "RXL_FLITS_G2_NCB\0"
+    "RXL_FLITS_G2_NCS\0"
+    "RXL_INSERTS\0"
+    "RXL_INSERTS_DRS_VN0\0"
+    "RXL_INSERTS_DRS_VN1\0"
+    "RXL_INSERTS_HOM_VN0\0"
+    "RXL_INSERTS_HOM_VN1\0"
+    "RXL_INSERTS_NCB_VN0\0"
+    "RXL_INSERTS_NCB_VN1\0"
+    "RXL_INSERTS_NCS_VN0\0"
+    "RXL_INSERTS_NCS_VN1\0"
+    "RXL_INSERTS_NDR_VN0\0"
+    "RXL_INSERTS_NDR_VN1\0"
+    "RXL_INSERTS_SNP_VN0\0"
+    "RXL_INSERTS_SNP_VN1\0"
+    "RXL_OCCUPANCY\0"
+    "RXL_OCCUPANCY_DRS_VN0\0"
+    "RXL_OCCUPANCY_DRS_VN1\0"
+    "RXL_OCCUPANCY_HOM_VN0\0"
+    "RXL_OCCUPANCY_HOM_VN1\0"
+    "RXL_OCCUPANCY_NCB_VN0\0"
+    "RXL_OCCUPANCY_NCB_VN1\0"
+    "RXL_OCCUPANCY_NCS_VN0\0"
+    "RXL_OCCUPANCY_NCS_VN1\0"
+    "RXL_OCCUPANCY_NDR_VN0\0"
+    "RXL_OCCUPANCY_NDR_VN1\0"
+    "RXL_OCCUPANCY_SNP_VN0\0"
+    "RXL_OCCUPANCY_SNP_VN1\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BYPASSED\0"
+    "TXL_CYCLES_NE\0"
+    "TXL_FLITS_G0_DATA\0"
+    "TXL_FLITS_G0_NON_DATA\0"
+    "TXL_FLITS_G1_SNP\0"
+    "TXL_FLITS_G1_HOM_REQ\0"
+    "TXL_FLITS_G1_HOM_NONREQ\0"
+    "TXL_FLITS_G1_HOM\0"
+    "TXL_FLITS_G1_DRS_DATA\0"
+    "TXL_FLITS_G1_DRS_NONDATA\0"
+    "TXL_FLITS_G1_DRS\0"
+    "TXL_FLITS_G2_NDR_AD\0"
+    "TXL_FLITS_G2_NDR_AK\0"
+    "TXL_FLITS_G2_NCB_DATA\0"
+    "TXL_FLITS_G2_NCB_NONDATA\0"
+    "TXL_FLITS_G2_NCB\0"
+    "TXL_FLITS_G2_NCS\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY\0"
+    "TXL_AD_HOM_CREDIT_ACQUIRED_VN0\0"
+    "TXL_AD_HOM_CREDIT_ACQUIRED_VN1\0"
+    "TXL_AD_HOM_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_AD_HOM_CREDIT_OCCUPANCY_VN1\0"
+    "TXL_AD_NDR_CREDIT_ACQUIRED_VN0\0"
+    "TXL_AD_NDR_CREDIT_ACQUIRED_VN1\0"
+    "TXL_AD_NDR_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_AD_NDR_CREDIT_OCCUPANCY_VN1\0"
+    "TXL_AD_SNP_CREDIT_ACQUIRED_VN0\0"
+    "TXL_AD_SNP_CREDIT_ACQUIRED_VN1\0"
+    "TXL_AD_SNP_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_AD_SNP_CREDIT_OCCUPANCY_VN1\0"
+    "TXL_AK_NDR_CREDIT_ACQUIRED\0"
+    "TXL_AK_NDR_CREDIT_OCCUPANCY\0"
+    "TXL_BL_DRS_CREDIT_ACQUIRED_VN0\0"
+    "TXL_BL_DRS_CREDIT_ACQUIRED_VN1\0"
+    "TXL_BL_DRS_CREDIT_ACQUIRED_VN_SHR\0"
+    "TXL_BL_DRS_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_BL_DRS_CREDIT_OCCUPANCY_VN1\0"
+    "TXL_BL_DRS_CREDIT_OCCUPANCY_VN_SHR\0"
+    "TXL_BL_NCB_CREDIT_ACQUIRED_VN0\0"
+    "TXL_BL_NCB_CREDIT_ACQUIRED_VN1\0"
+    "TXL_BL_NCB_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_BL_NCB_CREDIT_OCCUPANCY_VN1\0"
+    "TXL_BL_NCS_CREDIT_ACQUIRED_VN0\0"
+    "TXL_BL_NCS_CREDIT_ACQUIRED_VN1\0"
+    "TXL_BL_NCS_CREDIT_OCCUPANCY_VN0\0"
+    "TXL_BL_NCS_CREDIT_OCCUPANCY_VN1\0"
+    "VNA_CREDIT_RETURNS\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "EVENT_MSG_VLW_RCVD\0"
+    "UBOX\0"
+    "EVENT_MSG_MSI_RCVD\0"
+    "EVENT_MSG_IPI_RCVD\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "EVENT_MSG_INT_PRIO\0"
+    "LOCK_CYCLES\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_REQUESTS\0"
+    "BBOX_CLOCKTICKS\0"
+    "BBOX0|BBOX1\0"
+    "ADDR_OPC_MATCH_ADDR\0"
+    "ADDR_OPC_MATCH_OPC\0"
+    "ADDR_OPC_MATCH_FILT\0"
+    "ADDR_OPC_MATCH_AD\0"
+    "ADDR_OPC_MATCH_BL\0"
+    "ADDR_OPC_MATCH_AK\0"
+    "BT_BYPASS\0"
+    "BT_CYCLES_NE\0"
+    "BT_OCCUPANCY_LOCAL\0"
+    "BT_OCCUPANCY_REMOTE\0"
+    "BT_OCCUPANCY_READS_LOCAL\0"
+    "BT_OCCUPANCY_READS_REMOTE\0"
+    "BT_OCCUPANCY_WRITES_LOCAL\0"
+    "BT_OCCUPANCY_WRITES_REMOTE\0"
+    "BYPASS_IMC_TAKEN\0"
+    "BYPASS_IMC_NOT_TAKEN\0"
+    "CONFLICT_CYCLES_CONFLICT\0"
+    "CONFLICT_CYCLES_LAST\0"
+    "CONFLICT_CYCLES_ACKCNFLTS\0"
+    "CONFLICT_CYCLES_CMP_FWDS\0"
+    "DIRECT2CORE_COUNT\0"
+    "DIRECT2CORE_CYCLES_DISABLED\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECTORY_LAT_OPT\0"
+    "DIRECTORY_LOOKUP_SNP\0"
+    "DIRECTORY_LOOKUP_NO_SNP\0"
+    "DIRECTORY_UPDATE_SET\0"
+    "DIRECTORY_UPDATE_CLEAR\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "IGR_CREDITS_AD_QPI2\0"
+    "IGR_CREDITS_BL_QPI2\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI1\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_RETRY\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "IODC_CONFLICTS_ANY\0"
+    "IODC_CONFLICTS_LAST\0"
+    "IODC_INSERTS\0"
+    "IODC_OLEN_WBMTOI\0"
+    "OSB_READS_LOCAL\0"
+    "OSB_INVITOE_LOCAL\0"
+    "OSB_REMOTE\0"
+    "OSB_EDR_ALL\0"
+    "OSB_EDR_READS_LOCAL_I\0"
+    "OSB_EDR_READS_REMOTE_I\0"
+    "OSB_EDR_READS_LOCAL_S\0"
+    "OSB_EDR_READS_REMOTE_S\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "REQUESTS_INVITOE\0"
+    "HA_RING_AD_USED_CW_VR0_EVEN\0"
+    "BBOX\0"
+    "HA_RING_AD_USED_CW_VR0_ODD\0"
+    "HA_RING_AD_USED_CCW_VR0_EVEN\0"
+    "HA_RING_AD_USED_CCW_VR0_ODD\0"
+    "HA_RING_AD_USED_CW_VR1_EVEN\0"
+    "HA_RING_AD_USED_CW_VR1_ODD\0"
+    "HA_RING_AD_USED_CCW_VR1_EVEN\0"
+    "HA_RING_AD_USED_CCW_VR1_ODD\0"
+    "HA_RING_AD_USED_CW\0"
+    "HA_RING_AD_USED_CCW\0"
+    "HA_RING_AD_USED_ANY\0"
+    "HA_RING_AK_USED_CW_VR0_EVEN\0"
+    "HA_RING_AK_USED_CW_VR0_ODD\0"
+    "HA_RING_AK_USED_CCW_VR0_EVEN\0"
+    "HA_RING_AK_USED_CCW_VR0_ODD\0"
+    "HA_RING_AK_USED_CW_VR1_EVEN\0"
+    "HA_RING_AK_USED_CW_VR1_ODD\0"
+    "HA_RING_AK_USED_CCW_VR1_EVEN\0"
+    "HA_RING_AK_USED_CCW_VR1_ODD\0"
+    "HA_RING_AK_USED_CW\0"
+    "HA_RING_AK_USED_CCW\0"
+    "HA_RING_AK_USED_ANY\0"
+    "HA_RING_BL_USED_CW_VR0_EVEN\0"
+    "HA_RING_BL_USED_CW_VR0_ODD\0"
+    "HA_RING_BL_USED_CCW_VR0_EVEN\0"
+    "HA_RING_BL_USED_CCW_VR0_ODD\0"
+    "HA_RING_BL_USED_CW_VR1_EVEN\0"
+    "HA_RING_BL_USED_CW_VR1_ODD\0"
+    "HA_RING_BL_USED_CCW_VR1_EVEN\0"
+    "HA_RING_BL_USED_CCW_VR1_ODD\0"
+    "HA_RING_BL_USED_CW\0"
+    "HA_RING_BL_USED_CCW\0"
+    "HA_RING_BL_USED_ANY\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "SNOOP_RESP_RSPI\0"
+    "SNOOP_RESP_RSPS\0"
+    "SNOOP_RESP_RSPIFWD\0"
+    "SNOOP_RESP_RSPSFWD\0"
+    "SNOOP_RESP_RSP_WB\0"
+    "SNOOP_RESP_RSP_FWD_WB\0"
+    "SNOOP_RESP_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_RSPI\0"
+    "SNP_RESP_RECV_LOCAL_RSPS\0"
+    "SNP_RESP_RECV_LOCAL_RSPIFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPSFWD\0"
+    "SNP_RESP_RECV_LOCAL_RSPXWB\0"
+    "SNP_RESP_RECV_LOCAL_RSPCNFLCT\0"
+    "SNP_RESP_RECV_LOCAL_OTHER\0"
+    "TAD_REQUESTS_G0_REGION0\0"
+    "TAD_REQUESTS_G0_REGION1\0"
+    "TAD_REQUESTS_G0_REGION2\0"
+    "TAD_REQUESTS_G0_REGION3\0"
+    "TAD_REQUESTS_G0_REGION4\0"
+    "TAD_REQUESTS_G0_REGION5\0"
+    "TAD_REQUESTS_G0_REGION6\0"
+    "TAD_REQUESTS_G0_REGION7\0"
+    "TAD_REQUESTS_G1_REGION8\0"
+    "TAD_REQUESTS_G1_REGION9\0"
+    "TAD_REQUESTS_G1_REGION10\0"
+    "TAD_REQUESTS_G1_REGION11\0"
+    "TXR_AD_CYCLES_FULL_SCHED0\0"
+    "TXR_AD_CYCLES_FULL_SCHED1\0"
+    "TXR_AD_CYCLES_FULL_ALL\0"
+    "TXR_AK\0"
+    "TXR_AK_CYCLES_FULL_SCHED0\0"
+    "TXR_AK_CYCLES_FULL_SCHED1\0"
+    "TXR_AK_CYCLES_FULL_ALL\0"
+    "TXR_BL_DRS_CACHE\0"
+    "TXR_BL_DRS_CORE\0"
+    "TXR_BL_DRS_QPI\0"
+    "TXR_BL_CYCLES_FULL_SCHED0\0"
+    "TXR_BL_CYCLES_FULL_SCHED1\0"
+    "TXR_BL_CYCLES_FULL_ALL\0"
+    "TXR_BL_OCCUPANCY_SCHED0\0"
+    "TXR_BL_OCCUPANCY_SCHED1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE0_TRANSITION_CYCLES\0"
+    "CORE1_TRANSITION_CYCLES\0"
+    "CORE2_TRANSITION_CYCLES\0"
+    "CORE3_TRANSITION_CYCLES\0"
+    "CORE4_TRANSITION_CYCLES\0"
+    "CORE5_TRANSITION_CYCLES\0"
+    "CORE6_TRANSITION_CYCLES\0"
+    "CORE7_TRANSITION_CYCLES\0"
+    "CORE8_TRANSITION_CYCLES\0"
+    "CORE9_TRANSITION_CYCLES\0"
+    "CORE10_TRANSITION_CYCLES\0"
+    "CORE11_TRANSITION_CYCLES\0"
+    "CORE12_TRANSITION_CYCLES\0"
+    "CORE13_TRANSITION_CYCLES\0"
+    "CORE14_TRANSITION_CYCLES\0"
+    "DELAYED_C_STATE_ABORT_CORE0\0"
+    "DELAYED_C_STATE_ABORT_CORE1\0"
+    "DELAYED_C_STATE_ABORT_CORE2\0"
+    "DELAYED_C_STATE_ABORT_CORE3\0"
+    "DELAYED_C_STATE_ABORT_CORE4\0"
+    "DELAYED_C_STATE_ABORT_CORE5\0"
+    "DELAYED_C_STATE_ABORT_CORE6\0"
+    "DELAYED_C_STATE_ABORT_CORE7\0"
+    "DELAYED_C_STATE_ABORT_CORE8\0"
+    "DELAYED_C_STATE_ABORT_CORE9\0"
+    "DELAYED_C_STATE_ABORT_CORE10\0"
+    "DELAYED_C_STATE_ABORT_CORE11\0"
+    "DELAYED_C_STATE_ABORT_CORE12\0"
+    "DELAYED_C_STATE_ABORT_CORE13\0"
+    "DELAYED_C_STATE_ABORT_CORE14\0"
+    "DEMOTIONS_CORE0\0"
+    "DEMOTIONS_CORE1\0"
+    "DEMOTIONS_CORE2\0"
+    "DEMOTIONS_CORE3\0"
+    "DEMOTIONS_CORE4\0"
+    "DEMOTIONS_CORE5\0"
+    "DEMOTIONS_CORE6\0"
+    "DEMOTIONS_CORE7\0"
+    "DEMOTIONS_CORE8\0"
+    "DEMOTIONS_CORE9\0"
+    "DEMOTIONS_CORE10\0"
+    "DEMOTIONS_CORE11\0"
+    "DEMOTIONS_CORE12\0"
+    "DEMOTIONS_CORE13\0"
+    "DEMOTIONS_CORE14\0"
+    "FREQ_BAND0_CYCLES\0"
+    "FREQ_BAND1_CYCLES\0"
+    "FREQ_BAND2_CYCLES\0"
+    "FREQ_BAND3_CYCLES\0"
+    "FREQ_MAX_CURRENT_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_OS_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_MIN_PERF_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "PKG_C_EXIT_LATENCY\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VOLT_TRANS_CYCLES_CHANGE\0"
+    "VOLT_TRANS_CYCLES_DECREASE\0"
+    "VOLT_TRANS_CYCLES_INCREASE\0"
+    "VR_HOT_CYCLES\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "R2PCIE_RING_AD_USED_CW_VR0_EVEN\0"
+    "R2PCIE_RING_AD_USED_CW_VR0_ODD\0"
+    "R2PCIE_RING_AD_USED_CCW_VR0_EVEN\0"
+    "R2PCIE_RING_AD_USED_CCW_VR0_ODD\0"
+    "R2PCIE_RING_AD_USED_CW_VR1_EVEN\0"
+    "R2PCIE_RING_AD_USED_CW_VR1_ODD\0"
+    "R2PCIE_RING_AD_USED_CCW_VR1_EVEN\0"
+    "R2PCIE_RING_AD_USED_CCW_VR1_ODD\0"
+    "R2PCIE_RING_AD_USED_CW\0"
+    "R2PCIE_RING_AD_USED_CCW\0"
+    "R2PCIE_RING_AD_USED_ANY\0"
+    "R2PCIE_RING_AK_USED_CW_VR0_EVEN\0"
+    "R2PCIE_RING_AK_USED_CW_VR0_ODD\0"
+    "R2PCIE_RING_AK_USED_CCW_VR0_EVEN\0"
+    "R2PCIE_RING_AK_USED_CCW_VR0_ODD\0"
+    "R2PCIE_RING_AK_USED_CW_VR1_EVEN\0"
+    "R2PCIE_RING_AK_USED_CW_VR1_ODD\0"
+    "R2PCIE_RING_AK_USED_CCW_VR1_EVEN\0"
+    "R2PCIE_RING_AK_USED_CCW_VR1_ODD\0"
+    "R2PCIE_RING_AK_USED_CW\0"
+    "R2PCIE_RING_AK_USED_CCW\0"
+    "R2PCIE_RING_AK_USED_ANY\0"
+    "R2PCIE_RING_BL_USED_CW_VR0_EVEN\0"
+    "R2PCIE_RING_BL_USED_CW_VR0_ODD\0"
+    "R2PCIE_RING_BL_USED_CCW_VR0_EVEN\0"
+    "R2PCIE_RING_BL_USED_CCW_VR0_ODD\0"
+    "R2PCIE_RING_BL_USED_CW_VR1_EVEN\0"
+    "R2PCIE_RING_BL_USED_CW_VR1_ODD\0"
+    "R2PCIE_RING_BL_USED_CCW_VR1_EVEN\0"
+    "R2PCIE_RING_BL_USED_CCW_VR1_ODD\0"
+    "R2PCIE_RING_BL_USED_CW\0"
+    "R2PCIE_RING_BL_USED_CCW\0"
+    "R2PCIE_RING_BL_USED_ANY\0"
+    "R2PCIE_RING_IV_USED_CW\0"
+    "R2PCIE_RING_IV_USED_CCW\0"
+    "R2PCIE_RING_IV_USED_ANY\0"
+    "RXR_AK_BOUNCES_CW\0"
+    "RXR_AK_BOUNCES_CCW\0"
+    "RXR_CYCLES_NE_NCB\0"
+    "RXR_CYCLES_NE_NCS\0"
+    "RXR_INSERTS_NCB\0"
+    "PBOX|RBOX0C0|RBOX0C1|RBOX1C0|RBOX0C1\0"
+    "RXR_INSERTS_NCS\0"
+    "RXR_OCCUPANCY_DRS\0"
+    "PBOX|RBOX0C0|RBOX1C0\0"
+    "R2PCIE_TXR_CYCLES_FULL_AD\0"
+    "R2PCIE_TXR_CYCLES_FULL_AK\0"
+    "R2PCIE_TXR_CYCLES_FULL_BL\0"
+    "R2PCIE_TXR_CYCLES_NE_AD\0"
+    "R2PCIE_TXR_CYCLES_NE_AK\0"
+    "R2PCIE_TXR_CYCLES_NE_BL\0"
+    "RBOX_CLOCKTICKS\0"
+    "RBOX\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO0\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX0C1\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO1\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO2\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO3\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO4\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO5\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO6\0"
+    "C_LO_AD_CREDITS_EMPTY_CBO7\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO8\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO9\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO10\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO11\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO12\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO13\0"
+    "C_HI_AD_CREDITS_EMPTY_CBO14\0"
+    "HA_R2_BL_CREDITS_EMPTY_HA0\0"
+    "HA_R2_BL_CREDITS_EMPTY_HA1\0"
+    "HA_R2_BL_CREDITS_EMPTY_R2_NCB\0"
+    "HA_R2_BL_CREDITS_EMPTY_R2_NCS\0"
+    "QPI0_AD_CREDITS_EMPTY_VNA\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI0_BL_CREDITS_EMPTY_VNA\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI0_BL_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI0_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_AD_CREDITS_EMPTY_VNA\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI1_AD_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_AD_CREDITS_EMPTY_VN1_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VNA\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN0_NDR\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_HOM\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_SNP\0"
+    "QPI1_BL_CREDITS_EMPTY_VN1_NDR\0"
+    "R3QPI_RING_AD_USED_CW_VR0_EVEN\0"
+    "R3QPI_RING_AD_USED_CW_VR0_ODD\0"
+    "R3QPI_RING_AD_USED_CCW_VR0_EVEN\0"
+    "R3QPI_RING_AD_USED_CCW_VR0_ODD\0"
+    "R3QPI_RING_AD_USED_CW\0"
+    "R3QPI_RING_AD_USED_CCW\0"
+    "R3QPI_RING_AD_USED_ANY\0"
+    "R3QPI_RING_AK_USED_CW_VR0_EVEN\0"
+    "R3QPI_RING_AK_USED_CW_VR0_ODD\0"
+    "R3QPI_RING_AK_USED_CCW_VR0_EVEN\0"
+    "R3QPI_RING_AK_USED_CCW_VR0_ODD\0"
+    "R3QPI_RING_AK_USED_CW\0"
+    "R3QPI_RING_AK_USED_CCW\0"
+    "R3QPI_RING_AK_USED_ANY\0"
+    "R3QPI_RING_BL_USED_CW_VR0_EVEN\0"
+    "R3QPI_RING_BL_USED_CW_VR0_ODD\0"
+    "R3QPI_RING_BL_USED_CCW_VR0_EVEN\0"
+    "R3QPI_RING_BL_USED_CCW_VR0_ODD\0"
+    "R3QPI_RING_BL_USED_CW\0"
+    "R3QPI_RING_BL_USED_CCW\0"
+    "R3QPI_RING_BL_USED_ANY\0"
+    "R3QPI_RING_IV_USED_CW\0"
+    "R3QPI_RING_IV_USED_CCW\0"
+    "R3QPI_RING_IV_USED_ANY\0"
+    "RXR_AD_BYPASSED\0"
+    "RXR_CYCLES_NE_HOM\0"
+    "RXR_CYCLES_NE_SNP\0"
+    "RXR_CYCLES_NE_NDR\0"
+    "RXR_INSERTS_HOM\0"
+    "RXR_INSERTS_SNP\0"
+    "RXR_INSERTS_NDR\0"
+    "RXR_INSERTS_DRS\0"
+    "RXR_OCCUPANCY_HOM\0"
+    "RBOX0C0|RBOX1C0\0"
+    "RXR_OCCUPANCY_SNP\0"
+    "RXR_OCCUPANCY_NDR\0"
+    "RXR_OCCUPANCY_NCB\0"
+    "RXR_OCCUPANCY_NCS\0"
+    "R3QPI_TXR_CYCLES_FULL\0"
+    "R3QPI_TXR_CYCLES_NE\0"
+    "TXR_NACK_CW_AD\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX0C1|PBOX\0"
+    "TXR_NACK_CW_AK\0"
+    "TXR_NACK_CW_BL\0"
+    "TXR_NACK_CCW_AD\0"
+    "TXR_NACK_CCW_AK\0"
+    "TXR_NACK_CCW_BL\0"
+    "VN0_CREDITS_REJECT_HOM\0"
+    "VN0_CREDITS_REJECT_SNP\0"
+    "VN0_CREDITS_REJECT_NDR\0"
+    "VN0_CREDITS_REJECT_DRS\0"
+    "VN0_CREDITS_REJECT_NCB\0"
+    "VN0_CREDITS_REJECT_NCS\0"
+    "VN0_CREDITS_USED_HOM\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_NDR\0"
+    "VN0_CREDITS_USED_DRS\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN1_CREDITS_REJECT_HOM\0"
+    "VN1_CREDITS_REJECT_SNP\0"
+    "VN1_CREDITS_REJECT_NDR\0"
+    "VN1_CREDITS_REJECT_DRS\0"
+    "VN1_CREDITS_REJECT_NCB\0"
+    "VN1_CREDITS_REJECT_NCS\0"
+    "VN1_CREDITS_USED_HOM\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_NDR\0"
+    "VN1_CREDITS_USED_DRS\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VNA_CREDITS_ACQUIRED_AD\0"
+    "VNA_CREDITS_ACQUIRED_BL\0"
+    "VNA_CREDITS_REJECT_HOM\0"
+    "VNA_CREDITS_REJECT_SNP\0"
+    "VNA_CREDITS_REJECT_NDR\0"
+    "VNA_CREDITS_REJECT_DRS\0"
+    "VNA_CREDITS_REJECT_NCB\0"
+    "VNA_CREDITS_REJECT_NCS\0"
+    "VNA_CREDIT_CYCLES_OUT\0"
+    "VNA_CREDIT_CYCLES_USED\0"
+    "IBOX_CLOCKTICKS\0"
+    "IBOX\0"
+    "ADDRESS_MATCH_STALL_COUNT\0"
+    "ADDRESS_MATCH_MERGE_COUNT\0"
+    "CACHE_ACK_PENDING_OCCUPANCY_ANY\0"
+    "CACHE_ACK_PENDING_OCCUPANCY_SOURCE\0"
+    "CACHE_OWN_OCCUPANCY_ANY\0"
+    "CACHE_OWN_OCCUPANCY_SOURCE\0"
+    "CACHE_READ_OCCUPANCY_ANY\0"
+    "CACHE_READ_OCCUPANCY_SOURCE\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_SOURCE\0"
+    "CACHE_WRITE_OCCUPANCY_ANY\0"
+    "CACHE_WRITE_OCCUPANCY_SOURCE\0"
+    "RXR_AK_CYCLES_FULL\0"
+    "RXR_AK_INSERTS\0"
+    "RXR_AK_OCCUPANCY\0"
+    "RXR_BL_DRS_CYCLES_FULL\0"
+    "RXR_BL_DRS_INSERTS\0"
+    "RXR_BL_DRS_OCCUPANCY\0"
+    "RXR_BL_NCB_CYCLES_FULL\0"
+    "RXR_BL_NCB_INSERTS\0"
+    "RXR_BL_NCB_OCCUPANCY\0"
+    "RXR_BL_NCS_CYCLES_FULL\0"
+    "RXR_BL_NCS_INSERTS\0"
+    "RXR_BL_NCS_OCCUPANCY\0"
+    "TICKLES_LOST_OWNERSHIP\0"
+    "TICKLES_TOP_OF_QUEUE\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREFETCHES\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "TXR_AD_STALL_CREDIT_CYCLES\0"
+    "TXR_BL_STALL_CREDIT_CYCLES\0"
+    "TXR_DATA_INSERTS_NCB\0"
+    "TXR_DATA_INSERTS_NCS\0"
+    "TXR_REQUEST_OCCUPANCY\0"
+    "WRITE_ORDERING_STALL_CYCLES\0";
+
+static const PerfmonEventOption ivybridgeEP_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x08}
+, {EVENT_OPTION_THRESHOLD,0x0C}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x78040}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x7FF80}
+, {EVENT_OPTION_STATE,0x1F}
+};
+
+static const PerfmonEventEntry ivybridgeEP_arch_event_entries[NUM_ARCH_EVENTS_IVYBRIDGEEP] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 71, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {76, 91, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 114, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 142, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 169, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {175, 199, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {203, 199, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {219, 199, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {242, 199, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {266, 199, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {287, 199, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {319, 199, 0, 0, 0x08,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {350, 199, 0, 0, 0x08,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {382, 199, 0, 0, 0x08,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {413, 199, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {438, 199, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {462, 199, 3, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {491, 199, 4, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {519, 199, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {535, 199, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {559, 199, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {580, 199, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {603, 199, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {627, 199, 6, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {652, 199, 8, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {677, 199, 10, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {706, 199, 12, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {736, 199, 15, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {766, 199, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {800, 199, 18, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {834, 199, 19, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {868, 199, 20, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {902, 199, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {922, 199, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {959, 199, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {996, 199, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1033, 199, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1070, 199, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1096, 199, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1122, 199, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1143, 199, 1, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1157, 199, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1190, 199, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1219, 199, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1237, 199, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1255, 199, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1272, 199, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1294, 199, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1316, 199, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1342, 199, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1358, 199, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1375, 199, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1391, 199, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1405, 199, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1430, 199, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1456, 199, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1480, 199, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1498, 199, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 199, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1532, 199, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1555, 199, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1573, 199, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1601, 199, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1626, 199, 21, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1658, 1680, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1685, 199, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1717, 199, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1750, 199, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1782, 199, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1809, 199, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1828, 199, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1847, 199, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1863, 199, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1882, 199, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1894, 199, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1916, 199, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1952, 199, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1989, 199, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2021, 199, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2054, 199, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2071, 199, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2090, 199, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2113, 199, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2157, 199, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2201, 199, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2241, 199, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2282, 199, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2328, 199, 23, 1, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2371, 199, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2409, 199, 23, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2444, 199, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2454, 199, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2468, 199, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2481, 199, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2497, 199, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2514, 199, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2526, 199, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2543, 199, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2561, 199, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2574, 199, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2590, 199, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2613, 199, 18, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2636, 199, 19, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2659, 199, 20, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2682, 199, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2697, 199, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2719, 199, 18, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2741, 199, 19, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2763, 199, 20, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2785, 199, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2803, 199, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2828, 199, 18, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2853, 199, 19, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2878, 199, 20, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2903, 199, 1, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2920, 199, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2939, 199, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2965, 199, 18, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2991, 199, 19, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3017, 199, 20, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3043, 199, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3057, 199, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3078, 199, 18, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3099, 199, 19, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3120, 199, 20, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3141, 199, 1, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3157, 199, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3185, 199, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3211, 199, 18, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3237, 199, 19, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3263, 199, 20, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3289, 199, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3318, 199, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3345, 199, 18, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3372, 199, 19, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3399, 199, 20, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3426, 199, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3450, 199, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3472, 199, 18, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3494, 199, 19, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3516, 199, 20, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3538, 199, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3550, 199, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3564, 199, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3580, 199, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3600, 199, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3626, 199, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3653, 199, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3679, 199, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3700, 199, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3714, 199, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3732, 199, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3756, 199, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3784, 199, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3814, 199, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3848, 199, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {3893, 199, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {3942, 199, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {3973, 199, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4008, 199, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4044, 199, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4084, 199, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4122, 199, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4164, 199, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4190, 199, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4214, 199, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4242, 199, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4287, 199, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4336, 199, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4367, 199, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4402, 199, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4438, 199, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4478, 199, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4516, 199, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4558, 199, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4584, 199, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4612, 199, 20, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4660, 199, 19, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4710, 199, 18, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4760, 199, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4810, 199, 6, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4850, 199, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4878, 199, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4906, 199, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4937, 199, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4969, 199, 0, 0, 0xA1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {4997, 199, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5028, 199, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5060, 199, 0, 0, 0xA1,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {5088, 199, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5116, 199, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5144, 199, 24, 1, 0xA1,0x83,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5182, 199, 0, 0, 0xA1,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {5214, 199, 0, 0, 0xA1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5245, 199, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5265, 199, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5284, 199, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5303, 199, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5323, 199, 25, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5356, 199, 26, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5390, 199, 27, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5423, 199, 20, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5451, 199, 28, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5484, 199, 29, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5518, 5552, 30, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5557, 5552, 31, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5591, 199, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5615, 199, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5648, 199, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5674, 199, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5690, 199, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5722, 199, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5754, 199, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5782, 199, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5811, 199, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5832, 199, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5858, 199, 6, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5885, 199, 8, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5912, 199, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5948, 199, 18, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5984, 199, 19, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6020, 199, 20, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6056, 199, 32, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6092, 199, 33, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6128, 199, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6147, 199, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6178, 199, 6, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6210, 199, 8, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6242, 199, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6283, 199, 18, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6324, 199, 19, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6365, 199, 20, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6406, 199, 32, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6447, 199, 33, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6488, 199, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6520, 199, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6542, 199, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6561, 1680, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6580, 1680, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6597, 199, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6621, 199, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6646, 199, 0, 0, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6671, 199, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6688, 199, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6714, 199, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6739, 199, 6, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6765, 199, 8, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6791, 199, 24, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6813, 199, 24, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6844, 199, 10, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6874, 199, 12, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6905, 199, 15, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6936, 199, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6971, 199, 18, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7006, 199, 19, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7041, 199, 20, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7076, 199, 32, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7111, 199, 33, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7146, 199, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7168, 199, 1, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {7189, 199, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7220, 199, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7239, 199, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7262, 199, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7291, 199, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7319, 199, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7345, 199, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7373, 199, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7399, 199, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7426, 199, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7453, 199, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7482, 199, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7510, 199, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7536, 199, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7562, 199, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7584, 199, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7605, 199, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7625, 199, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7647, 199, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7668, 199, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {7682, 199, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7709, 199, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {7732, 199, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {7756, 199, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7789, 199, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {7823, 199, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7851, 199, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {7880, 199, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {7909, 199, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {7939, 199, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7968, 199, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7998, 199, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8027, 199, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8056, 199, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8086, 199, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8115, 199, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8144, 199, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8174, 199, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8203, 199, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8233, 199, 0, 0, 0xD1,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {8259, 199, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8299, 199, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8338, 199, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8378, 199, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8418, 199, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8454, 199, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8467, 199, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8491, 199, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8504, 199, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8521, 199, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8539, 199, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8555, 199, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8572, 199, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8587, 199, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8609, 199, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8623, 199, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8637, 199, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8651, 199, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {8667, 199, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8693, 199, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8719, 199, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8741, 199, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8763, 199, 0, 0, 0xF2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {8786, 199, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {8809, 199, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {8826, 199, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8868, 199, 0, 0, 0xD3,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {8911, 199, 0, 0, 0xD3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8954, 199, 0, 0, 0xD3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8996, 199, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9023, 199, 34, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9053, 199, 36, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9084, 199, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9120, 199, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9152, 199, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9188, 199, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9214, 199, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9251, 199, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9284, 199, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9321, 199, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9358, 199, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9391, 199, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9428, 199, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {9470, 199, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {9510, 199, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {9539, 199, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9566, 199, 34, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9596, 199, 36, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9627, 199, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9663, 199, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9695, 199, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9731, 199, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9757, 199, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9794, 199, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9827, 199, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9864, 199, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9901, 199, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9934, 199, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9971, 199, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10013, 199, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10053, 199, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10082, 10098, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10103, 10122, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10497, 10518, 38, 1, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_STATE_MASK}
+, {10768, 10518, 38, 1, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_STATE_MASK}
+, {10785, 10518, 38, 1, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_STATE_MASK}
+, {10809, 10518, 38, 1, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK|EVENT_OPTION_STATE_MASK}
+, {10824, 10518, 38, 1, 0x34,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_STATE_MASK|EVENT_OPTION_STATE_MASK}
+, {10839, 10518, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10859, 10518, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10879, 10518, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10899, 10518, 0, 0, 0x37,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10915, 10518, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10932, 10518, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {10948, 10518, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10970, 10518, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10991, 10518, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11008, 10518, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11027, 11050, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11300, 11050, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11322, 11050, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11347, 11050, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11371, 11050, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11394, 11050, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11416, 11050, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11441, 11050, 0, 0, 0x1B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11465, 11050, 0, 0, 0x1B,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {11483, 11050, 0, 0, 0x1B,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {11499, 11050, 0, 0, 0x1B,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {11516, 11050, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11539, 11050, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11561, 11050, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11586, 11050, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11610, 11050, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11633, 11050, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11655, 11050, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11680, 11050, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11704, 11050, 0, 0, 0x1C,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {11722, 11050, 0, 0, 0x1C,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {11738, 11050, 0, 0, 0x1C,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {11755, 11050, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11778, 11050, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11800, 11050, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11825, 11050, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11849, 11050, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11872, 11050, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11894, 11050, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11919, 11050, 0, 0, 0x1D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11943, 11050, 0, 0, 0x1D,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {11961, 11050, 0, 0, 0x1D,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {11977, 11050, 0, 0, 0x1D,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {11994, 10518, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12014, 10518, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12035, 10518, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12056, 10518, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12077, 11050, 0, 0, 0x1E,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {12094, 11050, 0, 0, 0x1E,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {12110, 11050, 0, 0, 0x1E,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {12128, 10518, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12143, 10518, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12163, 10518, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12183, 10518, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12203, 10518, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12229, 10518, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12245, 10518, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12270, 10518, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12286, 10518, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12304, 10518, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12322, 10518, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12341, 10518, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12369, 10518, 0, 0, 0x31,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12395, 10518, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12413, 10518, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12432, 10518, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12460, 10518, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12479, 10518, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12505, 10518, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12530, 10518, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12549, 10518, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12569, 10518, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12589, 10518, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12616, 10518, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12642, 10518, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12668, 12686, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12811, 12686, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12838, 12686, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12856, 12686, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12875, 10518, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12894, 10518, 0, 0, 0x35,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12918, 10518, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12939, 10518, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12955, 10518, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12970, 10518, 0, 0, 0x35,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {12991, 10518, 0, 0, 0x35,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {13014, 10518, 0, 0, 0x35,0x23,0,0,EVENT_OPTION_NONE_MASK}
+, {13044, 10518, 0, 0, 0x35,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {13067, 10518, 0, 0, 0x35,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13092, 10518, 0, 0, 0x35,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {13112, 10518, 0, 0, 0x35,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {13131, 10518, 0, 0, 0x35,0x43,0,0,EVENT_OPTION_NONE_MASK}
+, {13159, 10518, 0, 0, 0x35,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {13184, 10518, 0, 0, 0x35,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13210, 10518, 0, 0, 0x35,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {13241, 10518, 0, 0, 0x35,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13260, 10518, 0, 0, 0x35,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {13284, 12686, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13305, 12686, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13331, 12686, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13354, 12686, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13372, 12686, 0, 0, 0x36,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {13395, 12686, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13412, 12686, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13439, 12686, 0, 0, 0x36,0x23,0,0,EVENT_OPTION_NONE_MASK}
+, {13471, 12686, 0, 0, 0x36,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13491, 12686, 0, 0, 0x36,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {13516, 12686, 0, 0, 0x36,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {13541, 12686, 0, 0, 0x36,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13568, 12686, 0, 0, 0x36,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {13590, 12686, 0, 0, 0x36,0x43,0,0,EVENT_OPTION_NONE_MASK}
+, {13620, 12686, 0, 0, 0x36,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {13647, 12686, 0, 0, 0x36,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {13668, 12686, 0, 0, 0x36,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13696, 12686, 0, 0, 0x36,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {13729, 12686, 0, 0, 0x36,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13750, 12686, 0, 0, 0x36,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {13776, 10518, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13792, 10518, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13808, 10518, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13824, 10518, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13845, 10518, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13866, 10518, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13887, 10518, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13908, 10518, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13928, 10518, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13948, 10518, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13968, 13984, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14020, 14033, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14038, 14033, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14051, 14033, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14065, 14033, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14078, 14033, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14091, 14033, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14104, 14033, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14121, 14033, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14144, 14033, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14157, 14033, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14174, 14033, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14191, 14033, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14204, 14033, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14218, 14033, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14235, 14033, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14252, 14033, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14265, 14033, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14284, 14033, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14302, 14033, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14325, 14033, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14342, 14033, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14360, 14033, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14380, 14033, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14398, 14033, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14419, 14033, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14437, 14033, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14460, 14033, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14483, 14033, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14506, 14033, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14529, 14033, 0, 0, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14552, 14033, 0, 0, 0x83,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14575, 14033, 0, 0, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14598, 14033, 0, 0, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14621, 14033, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14652, 14033, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14673, 14033, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14692, 14033, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14720, 14033, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14748, 14033, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14776, 14033, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14804, 14033, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14832, 14033, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14860, 14033, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14888, 14033, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14916, 14033, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14941, 14033, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14966, 14033, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14986, 14033, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15007, 14033, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15023, 14033, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15039, 14033, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15056, 14033, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15074, 14033, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15093, 14033, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15112, 14033, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15131, 14033, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15150, 14033, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15169, 14033, 0, 0, 0xB0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15188, 14033, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15207, 14033, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15226, 14033, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15245, 14033, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15264, 14033, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15283, 14033, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15302, 14033, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15321, 14033, 0, 0, 0xB1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15340, 14033, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15359, 14033, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15378, 14033, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15397, 14033, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15416, 14033, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15435, 14033, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15454, 14033, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15473, 14033, 0, 0, 0xB2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15492, 14033, 0, 0, 0xB2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15511, 14033, 0, 0, 0xB2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15530, 14033, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15549, 14033, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15568, 14033, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15587, 14033, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15606, 14033, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15625, 14033, 0, 0, 0xB3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15644, 14033, 0, 0, 0xB3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15663, 14033, 0, 0, 0xB3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15682, 14033, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15701, 14033, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15720, 14033, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15739, 14033, 0, 0, 0xB4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15758, 14033, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15777, 14033, 0, 0, 0xB4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15796, 14033, 0, 0, 0xB4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15815, 14033, 0, 0, 0xB4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15834, 14033, 0, 0, 0xB5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15853, 14033, 0, 0, 0xB5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15872, 14033, 0, 0, 0xB5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15891, 14033, 0, 0, 0xB5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15910, 14033, 0, 0, 0xB5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15929, 14033, 0, 0, 0xB5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15948, 14033, 0, 0, 0xB5,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15967, 14033, 0, 0, 0xB5,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15986, 14033, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16005, 14033, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16024, 14033, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16043, 14033, 0, 0, 0xB6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16062, 14033, 0, 0, 0xB6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16081, 14033, 0, 0, 0xB6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16100, 14033, 0, 0, 0xB6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16119, 14033, 0, 0, 0xB6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16138, 14033, 0, 0, 0xB7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16157, 14033, 0, 0, 0xB7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16176, 14033, 0, 0, 0xB7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16195, 14033, 0, 0, 0xB7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16214, 14033, 0, 0, 0xB7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16233, 14033, 0, 0, 0xB7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16252, 14033, 0, 0, 0xB7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16271, 14033, 0, 0, 0xB7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16290, 14033, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16304, 14033, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16316, 14033, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16338, 14033, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16351, 14033, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16362, 14033, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16378, 14033, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16392, 14033, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16404, 14033, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16417, 14033, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16431, 14033, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16440, 14033, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16459, 14033, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16478, 14033, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16497, 14033, 0, 0, 0xB8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16516, 14033, 0, 0, 0xB8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16535, 14033, 0, 0, 0xB8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16554, 14033, 0, 0, 0xB8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16573, 14033, 0, 0, 0xB8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16592, 14033, 0, 0, 0xB9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16611, 14033, 0, 0, 0xB9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16630, 14033, 0, 0, 0xB9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16649, 14033, 0, 0, 0xB9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16668, 14033, 0, 0, 0xB9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16687, 14033, 0, 0, 0xB9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16706, 14033, 0, 0, 0xB9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16725, 14033, 0, 0, 0xB9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16744, 14033, 0, 0, 0xBA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16763, 14033, 0, 0, 0xBA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16782, 14033, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16801, 14033, 0, 0, 0xBA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16820, 14033, 0, 0, 0xBA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16839, 14033, 0, 0, 0xBA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16858, 14033, 0, 0, 0xBA,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16877, 14033, 0, 0, 0xBA,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16896, 14033, 0, 0, 0xBB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16915, 14033, 0, 0, 0xBB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16934, 14033, 0, 0, 0xBB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16953, 14033, 0, 0, 0xBB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16972, 14033, 0, 0, 0xBB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16991, 14033, 0, 0, 0xBB,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17010, 14033, 0, 0, 0xBB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17029, 14033, 0, 0, 0xBB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17048, 14033, 0, 0, 0xBC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17067, 14033, 0, 0, 0xBC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17086, 14033, 0, 0, 0xBC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17105, 14033, 0, 0, 0xBC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17124, 14033, 0, 0, 0xBC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17143, 14033, 0, 0, 0xBC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17162, 14033, 0, 0, 0xBC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17181, 14033, 0, 0, 0xBC,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17200, 14033, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17219, 14033, 0, 0, 0xBD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17238, 14033, 0, 0, 0xBD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17257, 14033, 0, 0, 0xBD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17276, 14033, 0, 0, 0xBD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17295, 14033, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17314, 14033, 0, 0, 0xBD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17333, 14033, 0, 0, 0xBD,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17352, 14033, 0, 0, 0xBE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17371, 14033, 0, 0, 0xBE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17390, 14033, 0, 0, 0xBE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17409, 14033, 0, 0, 0xBE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17428, 14033, 0, 0, 0xBE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17447, 14033, 0, 0, 0xBE,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17466, 14033, 0, 0, 0xBE,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17485, 14033, 0, 0, 0xBE,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17504, 14033, 0, 0, 0xBF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17523, 14033, 0, 0, 0xBF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17542, 14033, 0, 0, 0xBF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17561, 14033, 0, 0, 0xBF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17580, 14033, 0, 0, 0xBF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17599, 14033, 0, 0, 0xBF,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17618, 14033, 0, 0, 0xBF,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17637, 14033, 0, 0, 0xBF,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17656, 17665, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17692, 17665, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17706, 17722, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17740, 17722, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17750, 17722, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17778, 17722, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17806, 17722, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17834, 17722, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17866, 17722, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17891, 17722, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17924, 17722, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17953, 17722, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MASK1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {17990, 17722, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18006, 17722, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18025, 17722, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18043, 17722, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18056, 17722, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18085, 17722, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18114, 17722, 0, 0, 0x1E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18143, 17722, 0, 0, 0x1E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18172, 17722, 0, 0, 0x1E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18201, 17722, 0, 0, 0x1E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18230, 17722, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18259, 17722, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18288, 17722, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18317, 17722, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18346, 17722, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18375, 17722, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18404, 17722, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18429, 17722, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18443, 17722, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18461, 17722, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18479, 17722, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18501, 17722, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18518, 17722, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18539, 17722, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18563, 17722, 0, 0, 0x02,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18580, 17722, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18602, 17722, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18627, 17722, 0, 0, 0x02,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {18644, 17722, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18664, 17722, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18684, 17722, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18706, 17722, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18731, 17722, 0, 0, 0x03,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18748, 17722, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18765, 17722, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18777, 17722, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18797, 17722, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18817, 17722, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18837, 17722, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18857, 17722, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18877, 17722, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18897, 17722, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18917, 17722, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18937, 17722, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18957, 17722, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18977, 17722, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18997, 17722, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19017, 17722, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19031, 17722, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19053, 17722, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19075, 17722, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19097, 17722, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19119, 17722, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19141, 17722, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19163, 17722, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19185, 17722, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19207, 17722, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19229, 17722, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19251, 17722, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19273, 17722, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19295, 17722, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19314, 17722, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19332, 17722, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19345, 17722, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19359, 17722, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19377, 17722, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19399, 17722, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19416, 17722, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19437, 17722, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19461, 17722, 0, 0, 0x00,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {19478, 17722, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19500, 17722, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19525, 17722, 0, 0, 0x00,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {19542, 17722, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19562, 17722, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19582, 17722, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19604, 17722, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19629, 17722, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {19646, 17722, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19663, 17722, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19675, 17722, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19689, 17722, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19720, 17722, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19751, 17722, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19783, 17722, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19815, 17722, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19846, 17722, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19877, 17722, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19909, 17722, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19941, 17722, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19972, 17722, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20003, 17722, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20035, 17722, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20067, 17722, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20094, 17722, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20122, 17722, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20153, 17722, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20184, 17722, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20218, 17722, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20250, 17722, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20282, 17722, 0, 0, 0x1F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20317, 17722, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20348, 17722, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20379, 17722, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20411, 17722, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20443, 17722, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20474, 17722, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20505, 17722, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20537, 17722, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20569, 17722, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20588, 17722, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20616, 20629, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20637, 20656, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20661, 20656, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20680, 20656, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20699, 20656, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20723, 20656, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20742, 20656, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20754, 20656, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20781, 20656, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20795, 20811, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20823, 20811, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {20843, 20811, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {20862, 20811, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_OPCODE_MASK}
+, {20882, 20811, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {20900, 20811, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {20918, 20811, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {20936, 20811, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20946, 20811, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20959, 20811, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20978, 20811, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20998, 20811, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21023, 20811, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21049, 20811, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21075, 20811, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21102, 20811, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21119, 20811, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21140, 20811, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21165, 20811, 0, 0, 0x0B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21186, 20811, 0, 0, 0x0B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21212, 20811, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21237, 20811, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21255, 20811, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21283, 20811, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21308, 20811, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21326, 20811, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21347, 20811, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21371, 20811, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21392, 20811, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21415, 20811, 0, 0, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21436, 20811, 0, 0, 0x59,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21456, 20811, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21476, 20811, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21505, 20811, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21534, 20811, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21563, 20811, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21592, 20811, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21609, 20811, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21619, 20811, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21635, 20811, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21654, 20811, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21676, 20811, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21701, 20811, 0, 0, 0x1A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {21716, 20811, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21735, 20811, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21755, 20811, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21768, 20811, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21785, 20811, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21801, 20811, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21819, 20811, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21830, 20811, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21842, 20811, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21864, 20811, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21887, 20811, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21909, 20811, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21932, 20811, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21953, 20811, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21975, 20811, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {21990, 20811, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22012, 20811, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22035, 20811, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {22051, 20811, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22074, 20811, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22098, 20811, 0, 0, 0x01,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {22115, 22143, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22148, 22143, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22175, 22143, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22204, 22143, 0, 0, 0x3E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22232, 22143, 0, 0, 0x3E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22260, 22143, 0, 0, 0x3E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22287, 22143, 0, 0, 0x3E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22316, 22143, 0, 0, 0x3E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22344, 22143, 0, 0, 0x3E,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {22363, 22143, 0, 0, 0x3E,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {22383, 22143, 0, 0, 0x3E,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {22403, 22143, 0, 0, 0x3F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22431, 22143, 0, 0, 0x3F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22458, 22143, 0, 0, 0x3F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22487, 22143, 0, 0, 0x3F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22515, 22143, 0, 0, 0x3F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22543, 22143, 0, 0, 0x3F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22570, 22143, 0, 0, 0x3F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22599, 22143, 0, 0, 0x3F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22627, 22143, 0, 0, 0x3F,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {22646, 22143, 0, 0, 0x3F,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {22666, 22143, 0, 0, 0x3F,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {22686, 22143, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22714, 22143, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22741, 22143, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22770, 22143, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22798, 22143, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22826, 22143, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22853, 22143, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22882, 22143, 0, 0, 0x40,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22910, 22143, 0, 0, 0x40,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {22929, 22143, 0, 0, 0x40,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {22949, 22143, 0, 0, 0x40,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {22969, 20811, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23000, 20811, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23031, 20811, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23062, 20811, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23093, 20811, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23109, 20811, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23125, 20811, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23144, 20811, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23163, 20811, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23181, 20811, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23203, 20811, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23224, 20811, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23249, 20811, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23274, 20811, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23302, 20811, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23330, 20811, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23357, 20811, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23387, 20811, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {23413, 20811, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23437, 20811, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23461, 20811, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23485, 20811, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23509, 20811, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {23533, 20811, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {23557, 20811, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {23581, 20811, 0, 0, 0x1B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {23605, 20811, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23629, 20811, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23653, 20811, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23678, 20811, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23703, 20811, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23729, 20811, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23755, 20811, 0, 0, 0x2A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23778, 20811, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23785, 20811, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23811, 20811, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23837, 20811, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23860, 20811, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23877, 20811, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23893, 20811, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23908, 20811, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23934, 20811, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23960, 20811, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {23983, 20811, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24007, 20811, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24031, 20811, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24062, 20811, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24093, 20811, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24124, 20811, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24155, 24167, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24176, 24188, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24197, 24213, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24218, 24213, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24242, 24213, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24266, 24213, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24290, 24213, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24314, 24213, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24338, 24213, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24362, 24213, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24386, 24213, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24410, 24213, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24434, 24213, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24458, 24213, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24483, 24213, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24508, 24213, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24533, 24213, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24558, 24213, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24583, 24213, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24611, 24213, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24639, 24213, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24667, 24213, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24695, 24213, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24723, 24213, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24751, 24213, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24779, 24213, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24807, 24213, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24835, 24213, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24863, 24213, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24892, 24213, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24921, 24213, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24950, 24213, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24979, 24213, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25008, 24213, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25024, 24213, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25040, 24213, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25056, 24213, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25072, 24213, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25088, 24213, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25104, 24213, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25120, 24213, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25136, 24213, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25152, 24213, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25168, 24213, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25185, 24213, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25202, 24213, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25219, 24213, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25236, 24213, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25253, 24213, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25271, 24213, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25289, 24213, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25307, 24213, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_MATCH0_MASK}
+, {25325, 24213, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25349, 24213, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25379, 24213, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25398, 24213, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25420, 24213, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25441, 24213, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25464, 24213, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25482, 24213, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25511, 24213, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25530, 24213, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {25561, 24213, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {25592, 24213, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {25623, 24213, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25647, 24213, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25671, 24213, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25695, 24213, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25720, 24213, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25747, 24213, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25774, 24213, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25788, 25804, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25809, 25804, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25841, 25804, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25872, 25804, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25905, 25804, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25937, 25804, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25969, 25804, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {26000, 25804, 0, 0, 0x07,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {26033, 25804, 0, 0, 0x07,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {26065, 25804, 0, 0, 0x07,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {26088, 25804, 0, 0, 0x07,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {26112, 25804, 0, 0, 0x07,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {26136, 25804, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26168, 25804, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26199, 25804, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26232, 25804, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26264, 25804, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26296, 25804, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {26327, 25804, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {26360, 25804, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {26392, 25804, 0, 0, 0x08,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {26415, 25804, 0, 0, 0x08,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {26439, 25804, 0, 0, 0x08,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {26463, 25804, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26495, 25804, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26526, 25804, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26559, 25804, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {26591, 25804, 0, 0, 0x09,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26623, 25804, 0, 0, 0x09,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {26654, 25804, 0, 0, 0x09,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {26687, 25804, 0, 0, 0x09,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {26719, 25804, 0, 0, 0x09,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {26742, 25804, 0, 0, 0x09,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {26766, 25804, 0, 0, 0x09,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {26790, 25804, 0, 0, 0x09,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {26813, 25804, 0, 0, 0x09,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {26837, 25804, 0, 0, 0x09,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {26861, 25804, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26879, 25804, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26898, 25804, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26916, 25804, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {26934, 26950, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {26987, 26950, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27003, 27021, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27042, 25804, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27068, 25804, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27094, 25804, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27120, 25804, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27144, 25804, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27168, 25804, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27192, 27208, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27213, 27240, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27272, 27240, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27299, 27240, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27326, 27240, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27353, 27240, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27380, 27240, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27407, 27240, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27434, 27240, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27461, 27240, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27488, 27240, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27515, 27240, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27543, 27240, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27571, 27240, 0, 0, 0x2C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27599, 27240, 0, 0, 0x2C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27627, 27240, 0, 0, 0x2C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27655, 27240, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27682, 27240, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27709, 27240, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27739, 27240, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27769, 27240, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27795, 27240, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27825, 27240, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27855, 27240, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27885, 27240, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27915, 27240, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27945, 27240, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27975, 27240, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28001, 27240, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28031, 27240, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28061, 27240, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28091, 27240, 0, 0, 0x2D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28121, 27240, 0, 0, 0x2D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28151, 27240, 0, 0, 0x2D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28181, 27240, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28207, 27240, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28237, 27240, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28267, 27240, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28297, 27240, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28327, 27240, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28357, 27240, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28387, 27240, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28413, 27240, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28443, 27240, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28473, 27240, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28503, 27240, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28533, 27240, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28563, 27240, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28593, 27208, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28624, 27208, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28654, 27208, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28686, 27208, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28717, 27208, 0, 0, 0x07,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {28739, 27208, 0, 0, 0x07,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {28762, 27208, 0, 0, 0x07,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {28785, 27208, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28816, 27208, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28846, 27208, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28878, 27208, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28909, 27208, 0, 0, 0x08,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {28931, 27208, 0, 0, 0x08,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {28954, 27208, 0, 0, 0x08,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {28977, 27208, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29008, 27208, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29038, 27208, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29070, 27208, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29101, 27208, 0, 0, 0x09,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {29123, 27208, 0, 0, 0x09,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {29146, 27208, 0, 0, 0x09,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {29169, 27208, 0, 0, 0x0A,0x33,0,0,EVENT_OPTION_NONE_MASK}
+, {29191, 27208, 0, 0, 0x0A,0xCC,0,0,EVENT_OPTION_NONE_MASK}
+, {29214, 27208, 0, 0, 0x0A,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {29237, 27240, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29253, 27240, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29271, 27240, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29289, 27240, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29307, 27240, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29323, 27240, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29339, 27240, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29355, 27240, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29371, 29389, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29405, 29389, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29423, 29389, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29441, 29389, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29459, 29389, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29477, 27240, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29499, 27240, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29519, 29534, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29571, 29534, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29586, 29534, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29601, 29534, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29617, 29534, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29633, 29534, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29649, 27240, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29672, 27240, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29695, 27240, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29718, 27240, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29741, 27240, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29764, 27240, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29787, 27240, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29808, 27240, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29829, 27240, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29850, 27240, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29871, 27240, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29892, 27240, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29913, 27240, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29936, 27240, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29959, 27240, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29982, 27240, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30005, 27240, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30028, 27240, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30051, 27240, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30072, 27240, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30093, 27240, 0, 0, 0x38,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30114, 27240, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30135, 27240, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30156, 27240, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30177, 27240, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30201, 27240, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30225, 27240, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30248, 27240, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30271, 27240, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30294, 27240, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30317, 27240, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30340, 27240, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30363, 27240, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30385, 27240, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30408, 30424, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30429, 30424, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30455, 30424, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30481, 30424, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30513, 30424, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30548, 30424, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30572, 30424, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30599, 30424, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30624, 30424, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30652, 30424, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30678, 30424, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30707, 30424, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30733, 30424, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30762, 30424, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30781, 30424, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30796, 30424, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30813, 30424, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30836, 30424, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30855, 30424, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30876, 30424, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30899, 30424, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30918, 30424, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30939, 30424, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30962, 30424, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {30981, 30424, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31002, 30424, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31025, 30424, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31046, 30424, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31065, 30424, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31085, 30424, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31112, 30424, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31135, 30424, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31162, 30424, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31189, 30424, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31210, 30424, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31231, 30424, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31253, 30424, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable ivybridgeEP_arch_events = {
+    NUM_ARCH_EVENTS_IVYBRIDGEEP,
+    ivybridgeEP_arch_event_strings,
+    ivybridgeEP_arch_event_options,
+    ivybridgeEP_arch_event_entries
+};
@@ -0,0 +1,916 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_IVYBRIDGE 422
+
+static const char ivybridge_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "MISALIGN_MEM_REF_LOADS\0"
+    "MISALIGN_MEM_REF_STORES\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FLAGS_MERGE\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_SINGLE_MUL\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_DOUBLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_DOUBLE\0"
+    "SIMD_FP_256_PACKED_SINGLE\0"
+    "SIMD_FP_256_PACKED_DOUBLE\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_NUM_DIV\0"
+    "L2_RQSTS_ALL_DEM_AND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEM_AND_DATA_RD\0"
+    "L2_RQSTS_RFO_HITS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_ANY\0"
+    "L2_RQSTS_CODE_RD_HITS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_CODE_CODE_RD\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_HIT_M\0"
+    "L2_STORE_LOCK_RQSTS_ALL\0"
+    "L1D_WB_RQST_HIT_E\0"
+    "L1D_WB_RQST_HIT_M\0"
+    "L1D_WB_RQST_ALL\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC1\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "MOVE_ELIMINATION_INT_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_NOT_ELIMINATED\0"
+    "MOVE_ELIMINATION_INT_ELIMINATED\0"
+    "MOVE_ELIMINATION_SIMD_ELIMINATED\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_COUNT\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ALL_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "PMC2\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB_FILL_EXCEED_DSB_LINES\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_ALL\0"
+    "OTHER_ASSISTS_AVX_STORE\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "BR_MISP_RETIRED_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_TAKEN\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_MISC_RETIRED_LLC_MISS\0"
+    "BACLEARS_ANY\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PREF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PF_CLEAN\0"
+    "L2_LINES_OUT_PF_DIRTY\0"
+    "L2_LINES_OUT_DIRTY_ALL\0"
+    "L2_LINES_OUT_CLEAN_ALL\0"
+    "L2_LINES_OUT_ALL\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CACHE_LOOKUP_M\0"
+    "CBOX\0"
+    "CACHE_LOOKUP_E\0"
+    "CACHE_LOOKUP_S\0"
+    "CACHE_LOOKUP_I\0"
+    "CACHE_LOOKUP_READ_FILTER\0"
+    "CACHE_LOOKUP_WRITE_FILTER\0"
+    "CACHE_LOOKUP_EXTSNP_FILTER\0"
+    "CACHE_LOOKUP_ANY_REQUEST_FILTER\0"
+    "CACHE_LOOKUP_READ_M\0"
+    "CACHE_LOOKUP_WRITE_M\0"
+    "CACHE_LOOKUP_EXTSNP_M\0"
+    "CACHE_LOOKUP_ANY_M\0"
+    "CACHE_LOOKUP_READ_E\0"
+    "CACHE_LOOKUP_WRITE_E\0"
+    "CACHE_LOOKUP_EXTSNP_E\0"
+    "CACHE_LOOKUP_ANY_E\0"
+    "CACHE_LOOKUP_READ_S\0"
+    "CACHE_LOOKUP_WRITE_S\0"
+    "CACHE_LOOKUP_EXTSNP_S\0"
+    "CACHE_LOOKUP_ANY_S\0"
+    "CACHE_LOOKUP_READ_ES\0"
+    "CACHE_LOOKUP_WRITE_ES\0"
+    "CACHE_LOOKUP_EXTSNP_ES\0"
+    "CACHE_LOOKUP_ANY_ES\0"
+    "CACHE_LOOKUP_READ_I\0"
+    "CACHE_LOOKUP_WRITE_I\0"
+    "CACHE_LOOKUP_EXTSNP_I\0"
+    "CACHE_LOOKUP_ANY_I\0"
+    "CACHE_LOOKUP_READ_MESI\0"
+    "CACHE_LOOKUP_WRITE_MESI\0"
+    "CACHE_LOOKUP_EXTSNP_MESI\0"
+    "CACHE_LOOKUP_ANY_MESI\0"
+    "XSNP_RESPONSE_MISS\0"
+    "XSNP_RESPONSE_INVAL\0"
+    "XSNP_RESPONSE_HIT\0"
+    "XSNP_RESPONSE_HITM\0"
+    "XSNP_RESPONSE_INVAL_M\0"
+    "XSNP_RESPONSE_EXTERNAL_FILTER\0"
+    "XSNP_RESPONSE_XCORE_FILTER\0"
+    "XSNP_RESPONSE_EVICTION_FILTER\0"
+    "XSNP_RESPONSE_MISS_EXTERNAL\0"
+    "XSNP_RESPONSE_MISS_XCORE\0"
+    "XSNP_RESPONSE_MISS_EVICTION\0"
+    "XSNP_RESPONSE_INVAL_EXTERNAL\0"
+    "XSNP_RESPONSE_INVAL_XCORE\0"
+    "XSNP_RESPONSE_INVAL_EVICTION\0"
+    "XSNP_RESPONSE_HIT_EXTERNAL\0"
+    "XSNP_RESPONSE_HIT_XCORE\0"
+    "XSNP_RESPONSE_HIT_EVICTION\0"
+    "XSNP_RESPONSE_HITM_EXTERNAL\0"
+    "XSNP_RESPONSE_HITM_XCORE\0"
+    "XSNP_RESPONSE_HITM_EVICTION\0"
+    "TRK_OCCUPANCY_ALL\0"
+    "UBOX0\0"
+    "TRK_OCCUPANCY_CYCLES_WITH_ANY_REQUEST\0"
+    "TRK_OCCUPANCY_CYCLES_OVER_HALF_FULL\0"
+    "TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_WRITES\0"
+    "TRK_REQUESTS_EVICTIONS\0"
+    "COH_TRK_OCCUPANCY\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0";
+
+static const PerfmonEventOption ivybridge_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x08}
+, {EVENT_OPTION_THRESHOLD,0x0C}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0xA}
+};
+
+static const PerfmonEventEntry ivybridge_arch_event_entries[NUM_ARCH_EVENTS_IVYBRIDGE] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 217, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {221, 217, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {237, 217, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {260, 217, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {284, 217, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 217, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {337, 217, 0, 0, 0x08,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 217, 0, 0, 0x08,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {400, 217, 0, 0, 0x08,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {431, 217, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {456, 217, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {480, 217, 3, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {509, 217, 4, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {537, 217, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 217, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {577, 217, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {598, 217, 0, 0, 0x0E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {621, 217, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {645, 217, 6, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {670, 217, 8, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {695, 217, 10, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {724, 217, 12, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {754, 217, 15, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {784, 217, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {818, 217, 18, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {852, 217, 19, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {886, 217, 20, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {920, 217, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {940, 217, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {977, 217, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1014, 217, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1051, 217, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1088, 217, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1114, 217, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1140, 217, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1161, 217, 1, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1175, 217, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1208, 217, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1237, 217, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1255, 217, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1273, 217, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1290, 217, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1312, 217, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1334, 217, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1360, 217, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1376, 217, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1393, 217, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1409, 217, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1423, 217, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1448, 217, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1474, 217, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1498, 217, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 217, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1534, 217, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1550, 217, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1573, 217, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1591, 217, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1619, 217, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1644, 217, 21, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1676, 1698, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1703, 217, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1735, 217, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1768, 217, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1800, 217, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1827, 217, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1846, 217, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1865, 217, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1881, 217, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1900, 217, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1912, 217, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1934, 217, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1970, 217, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2007, 217, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2039, 217, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2072, 217, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2089, 217, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2108, 217, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2131, 217, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2175, 217, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2219, 217, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2259, 217, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2300, 217, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2346, 217, 23, 1, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2389, 217, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2427, 217, 23, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2462, 217, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2472, 217, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2486, 217, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2499, 217, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2515, 217, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2532, 217, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2544, 217, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2561, 217, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2579, 217, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2592, 217, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2608, 217, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2631, 217, 18, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2654, 217, 19, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2677, 217, 20, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2700, 217, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2715, 217, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2737, 217, 18, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2759, 217, 19, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2781, 217, 20, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2803, 217, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2821, 217, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2846, 217, 18, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2871, 217, 19, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2896, 217, 20, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2921, 217, 1, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2938, 217, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2957, 217, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2983, 217, 18, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3009, 217, 19, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3035, 217, 20, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3061, 217, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3075, 217, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3096, 217, 18, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3117, 217, 19, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3138, 217, 20, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3159, 217, 1, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3175, 217, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3203, 217, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3229, 217, 18, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3255, 217, 19, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3281, 217, 20, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3307, 217, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3336, 217, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3363, 217, 18, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3390, 217, 19, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3417, 217, 20, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3444, 217, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3468, 217, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3490, 217, 18, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3512, 217, 19, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3534, 217, 20, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3556, 217, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3568, 217, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3582, 217, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3598, 217, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3618, 217, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3644, 217, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3671, 217, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3697, 217, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3718, 217, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3732, 217, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3750, 217, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3774, 217, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3802, 217, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3832, 217, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3866, 217, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {3911, 217, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {3960, 217, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {3991, 217, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4026, 217, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4062, 217, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4102, 217, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4140, 217, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4182, 217, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4208, 217, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4232, 217, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4260, 217, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4305, 217, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4354, 217, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4385, 217, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4420, 217, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4456, 217, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4496, 217, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4534, 217, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4576, 217, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4602, 217, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4630, 217, 20, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4678, 217, 19, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4728, 217, 18, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4778, 217, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4828, 217, 6, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4868, 217, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4896, 217, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4924, 217, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4955, 217, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4987, 217, 0, 0, 0xA1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5015, 217, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5046, 217, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5078, 217, 0, 0, 0xA1,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {5106, 217, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5134, 217, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5162, 217, 24, 1, 0xA1,0x83,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5200, 217, 0, 0, 0xA1,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {5232, 217, 0, 0, 0xA1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5263, 217, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5283, 217, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5302, 217, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5321, 217, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5341, 217, 25, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5374, 217, 26, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5408, 217, 27, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5441, 217, 20, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5469, 217, 28, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5502, 217, 29, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5536, 5570, 30, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5575, 5570, 31, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5609, 217, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5633, 217, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5666, 217, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5692, 217, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5708, 217, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5740, 217, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5772, 217, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5800, 217, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5829, 217, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5850, 217, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5876, 217, 6, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5903, 217, 8, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5930, 217, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5966, 217, 18, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6002, 217, 19, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6038, 217, 20, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6074, 217, 32, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6110, 217, 33, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6146, 217, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6165, 217, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6196, 217, 6, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6228, 217, 8, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6260, 217, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6301, 217, 18, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6342, 217, 19, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6383, 217, 20, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6424, 217, 32, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6465, 217, 33, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6506, 217, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6538, 217, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6560, 217, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6579, 1698, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6598, 1698, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6615, 217, 0, 0, 0xC1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6639, 217, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6664, 217, 0, 0, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6689, 217, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6706, 217, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6732, 217, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6757, 217, 6, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6783, 217, 8, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6809, 217, 24, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6831, 217, 24, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6862, 217, 10, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6892, 217, 12, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6923, 217, 15, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6954, 217, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6989, 217, 18, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7024, 217, 19, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7059, 217, 20, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7094, 217, 32, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7129, 217, 33, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7164, 217, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7186, 217, 1, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {7207, 217, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7238, 217, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7257, 217, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7280, 217, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7309, 217, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7337, 217, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7363, 217, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7391, 217, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7417, 217, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7444, 217, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7471, 217, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7500, 217, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7528, 217, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7554, 217, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7580, 217, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7602, 217, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7623, 217, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7643, 217, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7665, 217, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7686, 217, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {7700, 217, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7727, 217, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {7750, 217, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {7774, 217, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7807, 217, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {7841, 217, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7869, 217, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {7898, 217, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {7927, 217, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {7957, 217, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7986, 217, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8016, 217, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8045, 217, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8074, 217, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8104, 217, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8133, 217, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8162, 217, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8192, 217, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8221, 217, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8251, 217, 0, 0, 0xD1,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {8277, 217, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8317, 217, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8356, 217, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8396, 217, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8436, 217, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8472, 217, 0, 0, 0xE6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8485, 217, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8509, 217, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8522, 217, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8539, 217, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8557, 217, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8573, 217, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8590, 217, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8605, 217, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8627, 217, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8641, 217, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8655, 217, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8669, 217, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {8685, 217, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8711, 217, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8737, 217, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8759, 217, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8781, 217, 0, 0, 0xF2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {8804, 217, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {8827, 217, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {8844, 217, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8886, 217, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {8913, 217, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {8949, 217, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {8981, 217, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9017, 217, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9043, 217, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9080, 217, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9113, 217, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9150, 217, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9187, 217, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9220, 217, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9257, 217, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {9299, 217, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {9339, 217, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {9368, 217, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9395, 217, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9431, 217, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9463, 217, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9499, 217, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9525, 217, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9562, 217, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9595, 217, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9632, 217, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9669, 217, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9702, 217, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9739, 217, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {9781, 217, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {9821, 217, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {9850, 9865, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9870, 9865, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9885, 9865, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9900, 9865, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9915, 9865, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9940, 9865, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9966, 9865, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9993, 9865, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10025, 9865, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10045, 9865, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10066, 9865, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10088, 9865, 0, 0, 0x34,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10107, 9865, 0, 0, 0x34,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10127, 9865, 0, 0, 0x34,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10148, 9865, 0, 0, 0x34,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10170, 9865, 0, 0, 0x34,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10189, 9865, 0, 0, 0x34,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {10209, 9865, 0, 0, 0x34,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10230, 9865, 0, 0, 0x34,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10252, 9865, 0, 0, 0x34,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {10271, 9865, 0, 0, 0x34,0x16,0,0,EVENT_OPTION_NONE_MASK}
+, {10292, 9865, 0, 0, 0x34,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {10314, 9865, 0, 0, 0x34,0x46,0,0,EVENT_OPTION_NONE_MASK}
+, {10337, 9865, 0, 0, 0x34,0x86,0,0,EVENT_OPTION_NONE_MASK}
+, {10357, 9865, 0, 0, 0x34,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {10377, 9865, 0, 0, 0x34,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {10398, 9865, 0, 0, 0x34,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {10420, 9865, 0, 0, 0x34,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {10439, 9865, 0, 0, 0x34,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10462, 9865, 0, 0, 0x34,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {10486, 9865, 0, 0, 0x34,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {10511, 9865, 0, 0, 0x34,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {10533, 9865, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10552, 9865, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10572, 9865, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10590, 9865, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10609, 9865, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10631, 9865, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10661, 9865, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10688, 9865, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10718, 9865, 0, 0, 0x22,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10746, 9865, 0, 0, 0x22,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10771, 9865, 0, 0, 0x22,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10799, 9865, 0, 0, 0x22,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10828, 9865, 0, 0, 0x22,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10854, 9865, 0, 0, 0x22,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10883, 9865, 0, 0, 0x22,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10910, 9865, 0, 0, 0x22,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10934, 9865, 0, 0, 0x22,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {10961, 9865, 0, 0, 0x22,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {10989, 9865, 0, 0, 0x22,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11014, 9865, 0, 0, 0x22,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11042, 11060, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11066, 11060, 0, 1, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11104, 11060, 34, 1, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11140, 11157, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11162, 11157, 0, 0, 0x81,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11182, 11157, 0, 0, 0x81,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11205, 11060, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11223, 11157, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11244, 11257, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11265, 11277, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11285, 11296, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11304, 11316, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable ivybridge_arch_events = {
+    NUM_ARCH_EVENTS_IVYBRIDGE,
+    ivybridge_arch_event_strings,
+    ivybridge_arch_event_options,
+    ivybridge_arch_event_entries
+};
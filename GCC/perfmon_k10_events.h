@@ -0,0 +1,680 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_K10 330
+
+static const char k10_arch_event_strings[] =
+    "DISPATCHED_FP_OP_ADD_PIPE\0"
+    "PMC\0"
+    "DISPATCHED_FP_OP_MULTIPLY_PIPE\0"
+    "DISPATCHED_FP_OP_STORE_PIPE\0"
+    "DISPATCHED_FP_OP_ADD_PIPE_LOAD\0"
+    "DISPATCHED_FP_OP_MULTIPLY_PIPE_LOAD\0"
+    "DISPATCHED_FP_OP_STORE_PIPE_LOAD\0"
+    "FPU_EMPTY\0"
+    "DISPATCHED_FAST_FPU\0"
+    "SSE_RETIRED_ADD_SINGLE_UOPS\0"
+    "SSE_RETIRED_MULT_SINGLE_UOPS\0"
+    "SSE_RETIRED_DIV_SINGLE_UOPS\0"
+    "SSE_RETIRED_ADD_DOUBLE_UOPS\0"
+    "SSE_RETIRED_MULT_DOUBLE_UOPS\0"
+    "SSE_RETIRED_DIV_DOUBLE_UOPS\0"
+    "SSE_RETIRED_ADD_SINGLE_FLOPS\0"
+    "SSE_RETIRED_MULT_SINGLE_FLOPS\0"
+    "SSE_RETIRED_DIV_SINGLE_FLOPS\0"
+    "SSE_RETIRED_ADD_DOUBLE_FLOPS\0"
+    "SSE_RETIRED_MULT_DOUBLE_FLOPS\0"
+    "SSE_RETIRED_DIV_DOUBLE_FLOPS\0"
+    "MOVE_RETIRED_LOW_MERGE\0"
+    "MOVE_RETIRED_HIGH_MERGE\0"
+    "MOVE_RETIRED_MERGE\0"
+    "MOVE_RETIRED_ALL\0"
+    "SERIAL_RETIRED_SSE_BOTTOM_EXE\0"
+    "SERIAL_RETIRED_SSE_BOTTOM_SERIAL\0"
+    "SERIAL_RETIRED_X87_BOTTOM_EXE\0"
+    "SERIAL_RETIRED_X87_BOTTOM_SERIAL\0"
+    "SERIAL_CYCLES_FP_EXE\0"
+    "SERIAL_CYCLES_FP_SERIAL\0"
+    "PIPELINE_RESTART_SELF_MOD\0"
+    "PIPELINE_RESTART_PROBE_HIT\0"
+    "LS_BUFFER_FULL\0"
+    "LOCKED_OPERATION_INSTRUCTIONS\0"
+    "LOCKED_OPERATION_SPECULATIVE_CYC\0"
+    "LOCKED_OPERATION_NON_SPECULATIVE_CYC\0"
+    "LOCKED_OPERATION_WAIT_CACHE_HIT_CYC\0"
+    "RETIRED_CLFLUSH\0"
+    "RETIRED_CPUID\0"
+    "STORE_TO_LOAD_FORWARD_CANCEL_ADDRESS_MISMATCH\0"
+    "STORE_TO_LOAD_FORWARD_CANCEL_SIZE_MISMATCH\0"
+    "STORE_TO_LOAD_FORWARD_CANCEL_MISALIGNED\0"
+    "NUM_SMI\0"
+    "DATA_CACHE_ACCESSES\0"
+    "DATA_CACHE_MISSES\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE\0"
+    "DATA_CACHE_REFILLS_L2_SHARED\0"
+    "DATA_CACHE_REFILLS_L2_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_L2_OWNED\0"
+    "DATA_CACHE_REFILLS_L2_MODIFIED\0"
+    "DATA_CACHE_REFILLS_L2_ALL\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_INVALID\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_SHARED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_OWNED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_MODIFIED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_ALL\0"
+    "DATA_CACHE_EVICTED_INVALID\0"
+    "DATA_CACHE_EVICTED_SHARED\0"
+    "DATA_CACHE_EVICTED_EXCLUSIVE\0"
+    "DATA_CACHE_EVICTED_OWNED\0"
+    "DATA_CACHE_EVICTED_MODIFIED\0"
+    "DATA_CACHE_EVICTED_PREFETCH_NTA\0"
+    "DATA_CACHE_EVICTED_NOT_PREFETCH_NTA\0"
+    "DATA_CACHE_EVICTED_ALL\0"
+    "DTLB_L2_HIT_4KB\0"
+    "DTLB_L2_HIT_2MB\0"
+    "DTLB_L2_HIT_1GB\0"
+    "DTLB_L2_HIT_ALL\0"
+    "DTLB_L2_MISS_4KB\0"
+    "DTLB_L2_MISS_2MB\0"
+    "DTLB_L2_MISS_1GB\0"
+    "DTLB_L2_MISS_ALL\0"
+    "MISALIGNED_ACCESS\0"
+    "LATE_CANCEL_ACCESS\0"
+    "EARLY_CANCEL_ACCESS\0"
+    "SINGLE_BIT_ERRORS_SCRUBBER\0"
+    "SINGLE_BIT_ERRORS_PIGGYBACK\0"
+    "SINGLE_BIT_ERRORS_LOAD_PIPE\0"
+    "SINGLE_BIT_ERRORS_STORE_PIPE\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_LOAD\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_STORE\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_NTA\0"
+    "DCACHE_LOCK_MISS\0"
+    "DTLB_L1_HIT_4KB\0"
+    "DTLB_L1_HIT_2MB\0"
+    "DTLB_L1_HIT_1GB\0"
+    "DTLB_L1_HIT_ANY\0"
+    "SW_PREFETCH_HIT_L1\0"
+    "SW_PREFETCH_HIT_L2\0"
+    "GLOBAL_TLB_FLUSH\0"
+    "MEMORY_REQUEST_NON_CACHEABLE\0"
+    "MEMORY_REQUEST_WRITE_COMBINED\0"
+    "MEMORY_REQUEST_STREAMING_STORE\0"
+    "DATA_PREFETCHER_CANCELED\0"
+    "DATA_PREFETCHER_ATTEMPTS\0"
+    "NORTHBRIDGE_READ_RESPONSE_EXCLUSIVE\0"
+    "NORTHBRIDGE_READ_RESPONSE_MODIFIED\0"
+    "NORTHBRIDGE_READ_RESPONSE_SHARED\0"
+    "NORTHBRIDGE_READ_RESPONSE_ALL\0"
+    "NORTHBRIDGE_READ_RESPONSE_OWNED\0"
+    "NORTHBRIDGE_READ_RESPONSE_DATA_ERROR\0"
+    "OCTWORDS_WRITE_TRANSFERS\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "L2_REQUESTS_ICACHE_FILL\0"
+    "L2_REQUESTS_DCACHE_FILL\0"
+    "L2_REQUESTS_TLBCACHE_FILL\0"
+    "L2_REQUESTS_ALL\0"
+    "L2_REQUESTS_TAG_SNOOP_REQUEST\0"
+    "L2_REQUESTS_CANCELLED_REQUEST\0"
+    "L2_REQUESTS_HARDWARE_PREFETCH\0"
+    "L2_MISSES_ICACHE_FILL\0"
+    "L2_MISSES_DCACHE_FILL\0"
+    "L2_MISSES_TLB_WALK\0"
+    "L2_MISSES_ALL\0"
+    "L2_MISSES_HARDWARE_PREFETCH\0"
+    "L2_FILL_VICTIMS\0"
+    "L2_FILL_WRITEBACKS\0"
+    "L2_FILL_ALL\0"
+    "ICACHE_FETCHES\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_REFILLS_L2\0"
+    "ICACHE_REFILLS_MEM\0"
+    "ITLB_L2_HIT\0"
+    "ITLB_L2_MISS_4KB\0"
+    "ITLB_L2_MISS_2MB\0"
+    "ITLB_L2_MISS_ANY\0"
+    "PIPELINE_RESTART_STREAM_PROBE\0"
+    "INSTRUCTION_FETCH_STALL\0"
+    "RETURN_STACK_HITS\0"
+    "RETURN_STACK_OVERFLOW\0"
+    "ICACHE_VICTIMS\0"
+    "ICACHE_LINES_INVALIDATED_NOHIT\0"
+    "ICACHE_LINES_INVALIDATED_HIT\0"
+    "ITLB_RELOADS\0"
+    "ITLB_RELOADS_ABORTED\0"
+    "INSTRUCTIONS_RETIRED\0"
+    "UOPS_RETIRED\0"
+    "BRANCH_RETIRED\0"
+    "BRANCH_MISPREDICT_RETIRED\0"
+    "BRANCH_TAKEN_RETIRED\0"
+    "BRANCH_TAKEN_MISPREDICTED_RETIRED\0"
+    "TRANSFER_FAR_CONTROL_RETIRED\0"
+    "BRANCH_RESYNCS_RETIRED\0"
+    "NEAR_RETURNS_RETIRED\0"
+    "NEAR_RETURNS_MISPREDICTED_RETIRED\0"
+    "BRANCH_INDIRECT_MISPREDICT_RETIRED\0"
+    "FP_INSTRUCTIONS_RETIRED_X87\0"
+    "FP_INSTRUCTIONS_RETIRED_MMX\0"
+    "FP_INSTRUCTIONS_RETIRED_SSE\0"
+    "FP_INSTRUCTIONS_RETIRED_ALL\0"
+    "FASTPATH_RETIRED_0\0"
+    "FASTPATH_RETIRED_1\0"
+    "FASTPATH_RETIRED_2\0"
+    "INTERRUPTS_MASKED_CYCLES\0"
+    "INTERRUPTS_TAKEN\0"
+    "DECODER_EMPTY_CYCLES\0"
+    "DISPATCH_STALLS\0"
+    "DISPATCH_STALLS_BRANCH\0"
+    "DISPATCH_STALLS_SERIAL\0"
+    "DISPATCH_STALLS_SEGMENT_LOAD\0"
+    "DISPATCH_STALLS_ROB_FULL\0"
+    "DISPATCH_STALLS_RES_FULL\0"
+    "DISPATCH_STALLS_FPU_FULL\0"
+    "DISPATCH_STALLS_LS_FULL\0"
+    "DISPATCH_STALLS_ALL_QUIT\0"
+    "DISPATCH_STALLS_DRAIN\0"
+    "FPU_EXCEPTIONS_X87_RECLASS\0"
+    "FPU_EXCEPTIONS_SSE_RETYPE\0"
+    "FPU_EXCEPTIONS_SSE_RECLASS\0"
+    "FPU_EXCEPTIONS_MICROTRAPS\0"
+    "FPU_EXCEPTIONS_ALL\0"
+    "X87_FLOPS_RETIRED_ADD\0"
+    "X87_FLOPS_RETIRED_MULT\0"
+    "X87_FLOPS_RETIRED_DIV\0"
+    "LFENCE_RETIRED\0"
+    "SFENCE_RETIRED\0"
+    "MFENCE_RETIRED\0"
+    "DRAM_ACCESSES_DCT0_HIT\0"
+    "DRAM_ACCESSES_DCTO_MISS\0"
+    "DRAM_ACCESSES_DCTO_CONFLICT\0"
+    "DRAM_ACCESSES_DCTO_ALL\0"
+    "DRAM_ACCESSES_DCT1_HIT\0"
+    "DRAM_ACCESSES_DCT1_MISS\0"
+    "DRAM_ACCESSES_DCT1_CONFLICT\0"
+    "DRAM_ACCESSES_DCT1_ALL\0"
+    "DRAM_PAGE_TABLE_OVERFLOW_ALL\0"
+    "DRAM_PAGE_TABLE_OVERFLOW_DCT0\0"
+    "DRAM_PAGE_TABLE_OVERFLOW_DCT1\0"
+    "DRAM_COMMAND_SLOTS_MISSED_ALL\0"
+    "DRAM_COMMAND_SLOTS_MISSED_DCT0\0"
+    "DRAM_COMMAND_SLOTS_MISSED_DCT1\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT0_CHIP_SELECT\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT0_READ_TO_WRITE\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT0_WRITE_TO_READ\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT1_CHIP_SELECT\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT1_READ_TO_WRITE\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_DCT1_WRITE_TO_READ\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_HIGH\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_MEDIUM\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_DCT0\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_DCT1\0"
+    "CACHE_BLOCK_COMMANDS_VICTIM\0"
+    "CACHE_BLOCK_COMMANDS_READ\0"
+    "CACHE_BLOCK_COMMANDS_READ_SHARED\0"
+    "CACHE_BLOCK_COMMANDS_READ_MODIFIED\0"
+    "CACHE_BLOCK_COMMANDS_DIRTY\0"
+    "MEMORY_REQUESTS_WRITE\0"
+    "MEMORY_REQUESTS_READ\0"
+    "MEMORY_REQUESTS_PREFETCH\0"
+    "MEMORY_REQUESTS_WRITE_32\0"
+    "MEMORY_REQUESTS_WRITE_64\0"
+    "MEMORY_REQUESTS_READ_32\0"
+    "MEMORY_REQUESTS_READ_64\0"
+    "MEMORY_REQUESTS_READ_WHILE_WRITE\0"
+    "L3_READ_REQUESTS_D_EXCLUSIVE_CORE_0\0"
+    "L3_READ_REQUESTS_I_SHARED_CORE_0\0"
+    "L3_READ_REQUESTS_MODIFY_CORE_0\0"
+    "L3_READ_REQUESTS_D_EXCLUSIVE_CORE_1\0"
+    "L3_READ_REQUESTS_I_SHARED_CORE_1\0"
+    "L3_READ_REQUESTS_MODIFY_CORE_1\0"
+    "L3_READ_REQUESTS_D_EXCLUSIVE_CORE_2\0"
+    "L3_READ_REQUESTS_I_SHARED_CORE_2\0"
+    "L3_READ_REQUESTS_MODIFY_CORE_2\0"
+    "L3_READ_REQUESTS_D_EXCLUSIVE_CORE_3\0"
+    "L3_READ_REQUESTS_I_SHARED_CORE_3\0"
+    "L3_READ_REQUESTS_MODIFY_CORE_3\0"
+    "L3_READ_REQUESTS_ALL_CORE_0\0"
+    "L3_READ_REQUESTS_ALL_CORE_1\0"
+    "L3_READ_REQUESTS_ALL_CORE_2\0"
+    "L3_READ_REQUESTS_ALL_CORE_3\0"
+    "L3_READ_REQUESTS_ALL_ALL_CORES\0"
+    "L3_MISSES_D_EXCLUSIVE_CORE_0\0"
+    "L3_MISSES_I_SHARED_CORE_0\0"
+    "L3_MISSES_MODIFY_CORE_0\0"
+    "L3_MISSES_D_EXCLUSIVE_CORE_1\0"
+    "L3_MISSES_I_SHARED_CORE_1\0"
+    "L3_MISSES_MODIFY_CORE_1\0"
+    "L3_MISSES_D_EXCLUSIVE_CORE_2\0"
+    "L3_MISSES_I_SHARED_CORE_2\0"
+    "L3_MISSES_MODIFY_CORE_2\0"
+    "L3_MISSES_D_EXCLUSIVE_CORE_3\0"
+    "L3_MISSES_I_SHARED_CORE_3\0"
+    "L3_MISSES_MODIFY_CORE_3\0"
+    "L3_MISSES_ALL_CORE_0\0"
+    "L3_MISSES_ALL_CORE_1\0"
+    "L3_MISSES_ALL_CORE_2\0"
+    "L3_MISSES_ALL_CORE_3\0"
+    "L3_MISSES_ALL_ALL_CORES\0"
+    "L3_FILLS_SHARED_CORE_0\0"
+    "L3_FILLS_EXCLUSIVE_CORE_0\0"
+    "L3_FILLS_OWNED_CORE_0\0"
+    "L3_FILLS_MODIFY_CORE_0\0"
+    "L3_FILLS_SHARED_CORE_1\0"
+    "L3_FILLS_EXCLUSIVE_CORE_1\0"
+    "L3_FILLS_OWNED_CORE_1\0"
+    "L3_FILLS_MODIFY_CORE_1\0"
+    "L3_FILLS_SHARED_CORE_2\0"
+    "L3_FILLS_EXCLUSIVE_CORE_2\0"
+    "L3_FILLS_OWNED_CORE_2\0"
+    "L3_FILLS_MODIFY_CORE_2\0"
+    "L3_FILLS_SHARED_CORE_3\0"
+    "L3_FILLS_EXCLUSIVE_CORE_3\0"
+    "L3_FILLS_OWNED_CORE_3\0"
+    "L3_FILLS_MODIFY_CORE_3\0"
+    "L3_FILLS_SHARED_ALL_CORES\0"
+    "L3_FILLS_EXCLUSIVE_ALL_CORES\0"
+    "L3_FILLS_OWNED_ALL_CORES\0"
+    "L3_FILLS_MODIFY_ALL_CORES\0"
+    "L3_FILLS_ALL_ALL_CORES\0"
+    "L3_EVICTS_SHARED\0"
+    "L3_EVICTS_EXCLUSIVE\0"
+    "L3_EVICTS_OWNED\0"
+    "L3_EVICTS_MODIFY\0"
+    "CPU_TO_DRAM_LOCAL_TO_0\0"
+    "CPU_TO_DRAM_LOCAL_TO_1\0"
+    "CPU_TO_DRAM_LOCAL_TO_2\0"
+    "CPU_TO_DRAM_LOCAL_TO_3\0"
+    "CPU_TO_DRAM_LOCAL_TO_4\0"
+    "CPU_TO_DRAM_LOCAL_TO_5\0"
+    "CPU_TO_DRAM_LOCAL_TO_6\0"
+    "CPU_TO_DRAM_LOCAL_TO_7\0"
+    "IO_TO_DRAM_LOCAL_TO_0\0"
+    "IO_TO_DRAM_LOCAL_TO_1\0"
+    "IO_TO_DRAM_LOCAL_TO_2\0"
+    "IO_TO_DRAM_LOCAL_TO_3\0"
+    "IO_TO_DRAM_LOCAL_TO_4\0"
+    "IO_TO_DRAM_LOCAL_TO_5\0"
+    "IO_TO_DRAM_LOCAL_TO_6\0"
+    "IO_TO_DRAM_LOCAL_TO_7\0"
+    "CPU_READ_COMMAND_LATENCY_READ_BLOCK\0"
+    "CPU_READ_COMMAND_LATENCY_READ_BLOCK_SHARED\0"
+    "CPU_READ_COMMAND_LATENCY_READ_BLOCK_MODIFIED\0"
+    "CPU_READ_COMMAND_LATENCY_CHANGE_TO_DIRTY\0"
+    "CPU_READ_COMMAND_LATENCY_LOCAL_TO_0\0"
+    "CPU_READ_COMMAND_LATENCY_LOCAL_TO_1\0"
+    "CPU_READ_COMMAND_LATENCY_LOCAL_TO_2\0"
+    "CPU_READ_COMMAND_LATENCY_LOCAL_TO_3\0"
+    "HYPERTRANSPORT_LINK0_COMMAND_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_BUFFER_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_NOP_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_ADDRESS_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_PER_PACKET_CRC_SENT\0"
+    "HYPERTRANSPORT_LINK0_SUBLINK_MASK\0"
+    "HYPERTRANSPORT_LINK0_ALL_SENT\0"
+    "HYPERTRANSPORT_LINK1_COMMAND_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_BUFFER_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_NOP_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_ADDRESS_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_PER_PACKET_CRC_SENT\0"
+    "HYPERTRANSPORT_LINK1_SUBLINK_MASK\0"
+    "HYPERTRANSPORT_LINK1_ALL_SENT\0"
+    "HYPERTRANSPORT_LINK2_COMMAND_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_BUFFER_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_NOP_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_ADDRESS_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_PER_PACKET_CRC_SENT\0"
+    "HYPERTRANSPORT_LINK2_SUBLINK_MASK\0"
+    "HYPERTRANSPORT_LINK2_ALL_SENT\0"
+    "HYPERTRANSPORT_LINK3_COMMAND_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK3_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK3_BUFFER_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK3_NOP_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK3_ADDRESS_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK3_PER_PACKET_CRC_SENT\0"
+    "HYPERTRANSPORT_LINK3_SUBLINK_MASK\0"
+    "HYPERTRANSPORT_LINK3_ALL_SENT\0";
+
+static const PerfmonEventOption k10_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry k10_arch_event_entries[NUM_ARCH_EVENTS_K10] = {
+ {0, 26, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30, 26, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 26, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {89, 26, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 26, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {156, 26, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {189, 26, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {199, 26, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {219, 26, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {247, 26, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {276, 26, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {304, 26, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {332, 26, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {361, 26, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {389, 26, 0, 0, 0x03,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 26, 0, 0, 0x03,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {448, 26, 0, 0, 0x03,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {477, 26, 0, 0, 0x03,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {506, 26, 0, 0, 0x03,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {536, 26, 0, 0, 0x03,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {565, 26, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {588, 26, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {612, 26, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {631, 26, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {648, 26, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {678, 26, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {711, 26, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {741, 26, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {774, 26, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {795, 26, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {819, 26, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {845, 26, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {872, 26, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {887, 26, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {917, 26, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {950, 26, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {987, 26, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1023, 26, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1039, 26, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1053, 26, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1099, 26, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1142, 26, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1182, 26, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1190, 26, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1210, 26, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1228, 26, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1259, 26, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1288, 26, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1320, 26, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1348, 26, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1379, 26, 0, 0, 0x42,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {1405, 26, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1444, 26, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1482, 26, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1523, 26, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1560, 26, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1600, 26, 0, 0, 0x43,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {1635, 26, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1662, 26, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1688, 26, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1717, 26, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1742, 26, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1770, 26, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1802, 26, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1838, 26, 0, 0, 0x44,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1861, 26, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1877, 26, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1893, 26, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1909, 26, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1925, 26, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1942, 26, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1959, 26, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1976, 26, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1993, 26, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2011, 26, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2030, 26, 0, 0, 0x49,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2050, 26, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2077, 26, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2105, 26, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2133, 26, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2162, 26, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2199, 26, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2237, 26, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2273, 26, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2290, 26, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 26, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2322, 26, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2338, 26, 0, 0, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {2354, 26, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2373, 26, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2392, 26, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2409, 26, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2438, 26, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2468, 26, 0, 0, 0x65,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2499, 26, 0, 0, 0x67,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2524, 26, 0, 0, 0x67,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2549, 26, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2585, 26, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2620, 26, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2653, 26, 0, 0, 0x6C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {2683, 26, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2715, 26, 0, 0, 0x6C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2752, 26, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2777, 26, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2797, 26, 0, 0, 0x7D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2821, 26, 0, 0, 0x7D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2845, 26, 0, 0, 0x7D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2871, 26, 0, 0, 0x7D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {2887, 26, 0, 0, 0x7D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2917, 26, 0, 0, 0x7D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2947, 26, 0, 0, 0x7D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2977, 26, 0, 0, 0x7E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2999, 26, 0, 0, 0x7E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3021, 26, 0, 0, 0x7E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3040, 26, 0, 0, 0x7E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3054, 26, 0, 0, 0x7E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3082, 26, 0, 0, 0x7F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3098, 26, 0, 0, 0x7F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3117, 26, 0, 0, 0x7F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3129, 26, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3144, 26, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3158, 26, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3176, 26, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3195, 26, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3207, 26, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3224, 26, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3241, 26, 0, 0, 0x85,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3258, 26, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3288, 26, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3312, 26, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3330, 26, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3352, 26, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3367, 26, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3398, 26, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3427, 26, 0, 0, 0x99,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3440, 26, 0, 0, 0x9A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3461, 26, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3482, 26, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3495, 26, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3510, 26, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3536, 26, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3557, 26, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3591, 26, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3620, 26, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3643, 26, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3664, 26, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3698, 26, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3733, 26, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3761, 26, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3789, 26, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3817, 26, 0, 0, 0xCB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3845, 26, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3864, 26, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3883, 26, 0, 0, 0xCC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3902, 26, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3927, 26, 0, 0, 0xCF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3944, 26, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3965, 26, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3981, 26, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4004, 26, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4027, 26, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4056, 26, 0, 0, 0xD5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4081, 26, 0, 0, 0xD6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4106, 26, 0, 0, 0xD7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4131, 26, 0, 0, 0xD8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4155, 26, 0, 0, 0xD9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4180, 26, 0, 0, 0xDA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4202, 26, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4229, 26, 0, 0, 0xDB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4255, 26, 0, 0, 0xDB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4282, 26, 0, 0, 0xDB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4308, 26, 0, 0, 0xDB,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {4327, 26, 0, 0, 0x1C0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4349, 26, 0, 0, 0x1C0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4372, 26, 0, 0, 0x1C0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4394, 26, 0, 0, 0x1D3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4409, 26, 0, 0, 0x1D4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4424, 26, 0, 0, 0x1D5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4439, 26, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4462, 26, 0, 0, 0xE0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4486, 26, 0, 0, 0xE0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4514, 26, 0, 0, 0xE0,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4537, 26, 0, 0, 0xE0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4560, 26, 0, 0, 0xE0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4584, 26, 0, 0, 0xE0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4612, 26, 0, 0, 0xE0,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {4635, 26, 0, 0, 0xE1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4664, 26, 0, 0, 0xE1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4694, 26, 0, 0, 0xE1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4724, 26, 0, 0, 0xE2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4754, 26, 0, 0, 0xE2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4785, 26, 0, 0, 0xE2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4816, 26, 0, 0, 0xE3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4861, 26, 0, 0, 0xE3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4908, 26, 0, 0, 0xE3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4955, 26, 0, 0, 0xE3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5000, 26, 0, 0, 0xE3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5047, 26, 0, 0, 0xE3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5094, 26, 0, 0, 0xE4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5133, 26, 0, 0, 0xE4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5174, 26, 0, 0, 0xE4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5213, 26, 0, 0, 0xE4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5252, 26, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5280, 26, 0, 0, 0xEA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5306, 26, 0, 0, 0xEA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5339, 26, 0, 0, 0xEA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5374, 26, 0, 0, 0xEA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5401, 26, 0, 0, 0x1F0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5423, 26, 0, 0, 0x1F0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5444, 26, 0, 0, 0x1F0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5469, 26, 0, 0, 0x1F0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5494, 26, 0, 0, 0x1F0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5519, 26, 0, 0, 0x1F0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5543, 26, 0, 0, 0x1F0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5567, 26, 0, 0, 0x1F0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5600, 26, 0, 0, 0x4E0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5636, 26, 0, 0, 0x4E0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {5669, 26, 0, 0, 0x4E0,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {5700, 26, 0, 0, 0x4E0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {5736, 26, 0, 0, 0x4E0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {5769, 26, 0, 0, 0x4E0,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {5800, 26, 0, 0, 0x4E0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5836, 26, 0, 0, 0x4E0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {5869, 26, 0, 0, 0x4E0,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {5900, 26, 0, 0, 0x4E0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {5936, 26, 0, 0, 0x4E0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {5969, 26, 0, 0, 0x4E0,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {6000, 26, 0, 0, 0x4E0,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {6028, 26, 0, 0, 0x4E0,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {6056, 26, 0, 0, 0x4E0,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {6084, 26, 0, 0, 0x4E0,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {6112, 26, 0, 0, 0x4E0,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {6143, 26, 0, 0, 0x4E1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {6172, 26, 0, 0, 0x4E1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6198, 26, 0, 0, 0x4E1,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {6222, 26, 0, 0, 0x4E1,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {6251, 26, 0, 0, 0x4E1,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {6277, 26, 0, 0, 0x4E1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {6301, 26, 0, 0, 0x4E1,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {6330, 26, 0, 0, 0x4E1,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {6356, 26, 0, 0, 0x4E1,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {6380, 26, 0, 0, 0x4E1,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {6409, 26, 0, 0, 0x4E1,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {6435, 26, 0, 0, 0x4E1,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {6459, 26, 0, 0, 0x4E1,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {6480, 26, 0, 0, 0x4E1,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {6501, 26, 0, 0, 0x4E1,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {6522, 26, 0, 0, 0x4E1,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {6543, 26, 0, 0, 0x4E1,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {6567, 26, 0, 0, 0x4E2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {6590, 26, 0, 0, 0x4E2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6616, 26, 0, 0, 0x4E2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {6638, 26, 0, 0, 0x4E2,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {6661, 26, 0, 0, 0x4E2,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {6684, 26, 0, 0, 0x4E2,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {6710, 26, 0, 0, 0x4E2,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {6732, 26, 0, 0, 0x4E2,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {6755, 26, 0, 0, 0x4E2,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {6778, 26, 0, 0, 0x4E2,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {6804, 26, 0, 0, 0x4E2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {6826, 26, 0, 0, 0x4E2,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {6849, 26, 0, 0, 0x4E2,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {6872, 26, 0, 0, 0x4E2,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {6898, 26, 0, 0, 0x4E2,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {6920, 26, 0, 0, 0x4E2,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {6943, 26, 0, 0, 0x4E2,0xF1,0,0,EVENT_OPTION_NONE_MASK}
+, {6969, 26, 0, 0, 0x4E2,0xF2,0,0,EVENT_OPTION_NONE_MASK}
+, {6998, 26, 0, 0, 0x4E2,0xF4,0,0,EVENT_OPTION_NONE_MASK}
+, {7023, 26, 0, 0, 0x4E2,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {7049, 26, 0, 0, 0x4E2,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7072, 26, 0, 0, 0x4E3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7089, 26, 0, 0, 0x4E3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7109, 26, 0, 0, 0x4E3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7125, 26, 0, 0, 0x4E3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7142, 26, 0, 0, 0x1E0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7165, 26, 0, 0, 0x1E0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7188, 26, 0, 0, 0x1E0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7211, 26, 0, 0, 0x1E0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7234, 26, 0, 0, 0x1E0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7257, 26, 0, 0, 0x1E0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7280, 26, 0, 0, 0x1E0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7303, 26, 0, 0, 0x1E0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7326, 26, 0, 0, 0x1E1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7348, 26, 0, 0, 0x1E1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7370, 26, 0, 0, 0x1E1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7392, 26, 0, 0, 0x1E1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7414, 26, 0, 0, 0x1E1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7436, 26, 0, 0, 0x1E1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7458, 26, 0, 0, 0x1E1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7480, 26, 0, 0, 0x1E1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7502, 26, 0, 0, 0x1E2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7538, 26, 0, 0, 0x1E2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7581, 26, 0, 0, 0x1E2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7626, 26, 0, 0, 0x1E2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7667, 26, 0, 0, 0x1E2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7703, 26, 0, 0, 0x1E2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7739, 26, 0, 0, 0x1E2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7775, 26, 0, 0, 0x1E2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7811, 26, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7851, 26, 0, 0, 0xF6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7888, 26, 0, 0, 0xF6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7927, 26, 0, 0, 0xF6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7963, 26, 0, 0, 0xF6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8003, 26, 0, 0, 0xF6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8044, 26, 0, 0, 0xF6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8078, 26, 0, 0, 0xF6,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8108, 26, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8148, 26, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8185, 26, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8224, 26, 0, 0, 0xF7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8260, 26, 0, 0, 0xF7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8300, 26, 0, 0, 0xF7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8341, 26, 0, 0, 0xF7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8375, 26, 0, 0, 0xF7,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8405, 26, 0, 0, 0xF8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8445, 26, 0, 0, 0xF8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8482, 26, 0, 0, 0xF8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8521, 26, 0, 0, 0xF8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8557, 26, 0, 0, 0xF8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8597, 26, 0, 0, 0xF8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8638, 26, 0, 0, 0xF8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8672, 26, 0, 0, 0xF8,0x37,0,0,EVENT_OPTION_NONE_MASK}
+, {8702, 26, 0, 0, 0x1F9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8742, 26, 0, 0, 0x1F9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8779, 26, 0, 0, 0x1F9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8818, 26, 0, 0, 0x1F9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8854, 26, 0, 0, 0x1F9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8894, 26, 0, 0, 0x1F9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8935, 26, 0, 0, 0x1F9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8969, 26, 0, 0, 0x1F9,0x37,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable k10_arch_events = {
+    NUM_ARCH_EVENTS_K10,
+    k10_arch_event_strings,
+    k10_arch_event_options,
+    k10_arch_event_entries
+};
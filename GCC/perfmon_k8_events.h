@@ -0,0 +1,346 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_K8 163
+
+static const char k8_arch_event_strings[] =
+    "DISPATCHED_FP_OP_ADD_PIPE\0"
+    "PMC\0"
+    "DISPATCHED_FP_OP_MULTIPLY_PIPE\0"
+    "DISPATCHED_FP_OP_STORE_PIPE\0"
+    "DISPATCHED_FP_OP_ADD_PIPE_LOAD\0"
+    "DISPATCHED_FP_OP_MULTIPLY_PIPE_LOAD\0"
+    "DISPATCHED_FP_OP_STORE_PIPE_LOAD\0"
+    "FPU_EMPTY\0"
+    "DISPATCHED_FAST_FPU\0"
+    "SEGMENT_REGISTER_LOAD_ES\0"
+    "SEGMENT_REGISTER_LOAD_CS\0"
+    "SEGMENT_REGISTER_LOAD_SS\0"
+    "SEGMENT_REGISTER_LOAD_DS\0"
+    "SEGMENT_REGISTER_LOAD_FS\0"
+    "SEGMENT_REGISTER_LOAD_GS\0"
+    "SEGMENT_REGISTER_LOAD_HS\0"
+    "PIPELINE_RESTART_SELF_MOD\0"
+    "PIPELINE_RESTART_PROBE_HIT\0"
+    "LS_BUFFER_FULL\0"
+    "LOCKED_OPERATION_INSTRUCTIONS\0"
+    "LOCKED_OPERATION_SPECULATIVE_CYC\0"
+    "LOCKED_OPERATION_NON_SPECULATIVE_CYC\0"
+    "DATA_CACHE_ACCESSES\0"
+    "DATA_CACHE_MISSES\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE\0"
+    "DATA_CACHE_REFILLS_L2_SHARED\0"
+    "DATA_CACHE_REFILLS_L2_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_L2_OWNED\0"
+    "DATA_CACHE_REFILLS_L2_MODIFIED\0"
+    "DATA_CACHE_REFILLS_L2_ALL\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_INVALID\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_SHARED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_OWNED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_MODIFIED\0"
+    "DATA_CACHE_REFILLS_NORTHBRIDGE_ALL\0"
+    "DATA_CACHE_EVICTED_INVALID\0"
+    "DATA_CACHE_EVICTED_SHARED\0"
+    "DATA_CACHE_EVICTED_EXCLUSIVE\0"
+    "DATA_CACHE_EVICTED_OWNED\0"
+    "DATA_CACHE_EVICTED_MODIFIED\0"
+    "DATA_CACHE_EVICTED_PREFETCH_NTA\0"
+    "DATA_CACHE_EVICTED_NOT_PREFETCH_NTA\0"
+    "DATA_CACHE_EVICTED_ALL\0"
+    "DTLB_L2_HIT_4KB\0"
+    "DTLB_L2_HIT_2MB\0"
+    "DTLB_L2_HIT_1GB\0"
+    "DTLB_L2_HIT_ANY\0"
+    "DTLB_L2_MISS_4KB\0"
+    "DTLB_L2_MISS_2MB\0"
+    "DTLB_L2_MISS_1GB\0"
+    "DTLB_L2_MISS_ANY\0"
+    "MISALIGNED_ACCESS\0"
+    "LATE_CANCEL_ACCESS\0"
+    "EARLY_CANCEL_ACCESS\0"
+    "SINGLE_BIT_ERRORS_SCRUBBER\0"
+    "SINGLE_BIT_ERRORS_PIGGYBACK\0"
+    "SINGLE_BIT_ERRORS_LOAD_PIPE\0"
+    "SINGLE_BIT_ERRORS_STORE_PIPE\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_LOAD\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_STORE\0"
+    "PREFETCH_INSTRUCTION_DISPATCHED_NTA\0"
+    "DCACHE_LOCK_MISS\0"
+    "MEMORY_REQUEST_NON_CACHEABLE\0"
+    "MEMORY_REQUEST_WRITE_COMBINED\0"
+    "MEMORY_REQUEST_STREAMING_STORE\0"
+    "DATA_PREFETCHER_CANCELED\0"
+    "DATA_PREFETCHER_ATTEMPTS\0"
+    "NORTHBRIDGE_READ_RESPONSE_EXCLUSIVE\0"
+    "NORTHBRIDGE_READ_RESPONSE_MODIFIED\0"
+    "NORTHBRIDGE_READ_RESPONSE_SHARED\0"
+    "QUADWORDS_WRITE_TRANSFERS\0"
+    "L2_REQUESTS_ICACHE_FILL\0"
+    "L2_REQUESTS_DCACHE_FILL\0"
+    "L2_REQUESTS_TLBCACHE_FILL\0"
+    "L2_REQUESTS_TAG_SNOOP_REQUEST\0"
+    "L2_REQUESTS_CANCELLED_REQUEST\0"
+    "L2_MISSES_ICACHE_FILL\0"
+    "L2_MISSES_DCACHE_FILL\0"
+    "L2_MISSES_TLB_WALK\0"
+    "L2_FILL_VICTIMS\0"
+    "L2_FILL_WRITEBACKS\0"
+    "ICACHE_FETCHES\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_REFILLS_L2\0"
+    "ICACHE_REFILLS_MEM\0"
+    "ITLB_L2_HIT\0"
+    "ITLB_L2_MISS_4KB\0"
+    "ITLB_L2_MISS_2MB\0"
+    "ITLB_L2_MISS_ANY\0"
+    "PIPELINE_RESTART_STREAM_PROBE\0"
+    "INSTRUCTION_FETCH_STALL\0"
+    "RETURN_STACK_HITS\0"
+    "RETURN_STACK_OVERFLOW\0"
+    "RETIRED_CLFLUSH\0"
+    "RETIRED_CPUID\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "INSTRUCTIONS_RETIRED\0"
+    "UOPS_RETIRED\0"
+    "BRANCH_RETIRED\0"
+    "BRANCH_MISPREDICT_RETIRED\0"
+    "BRANCH_TAKEN_RETIRED\0"
+    "BRANCH_TAKEN_MISPREDICTED_RETIRED\0"
+    "TRANSFER_FAR_CONTROL_RETIRED\0"
+    "BRANCH_RESYNCS_RETIRED\0"
+    "NEAR_RETURNS_RETIRED\0"
+    "NEAR_RETURNS_MISPREDICTED_RETIRED\0"
+    "BRANCH_INDIRECT_MISPREDICT_RETIRED\0"
+    "INSTRUCTIONS_RETIRED_X87\0"
+    "INSTRUCTIONS_RETIRED_MMX\0"
+    "INSTRUCTIONS_RETIRED_SSE\0"
+    "FASTPATH_RETIRED_0\0"
+    "FASTPATH_RETIRED_1\0"
+    "FASTPATH_RETIRED_2\0"
+    "INTERRUPTS_MASKED_CYCLES\0"
+    "INTERRUPTS_TAKEN\0"
+    "DECODER_EMPTY_CYCLES\0"
+    "DISPATCH_STALLS\0"
+    "DISPATCH_STALLS_BRANCH\0"
+    "DISPATCH_STALLS_SERIAL\0"
+    "DISPATCH_STALLS_SEGMENT_LOAD\0"
+    "DISPATCH_STALLS_ROB_FULL\0"
+    "DISPATCH_STALLS_RES_FULL\0"
+    "DISPATCH_STALLS_FPU_FULL\0"
+    "DISPATCH_STALLS_LS_FULL\0"
+    "DISPATCH_STALLS_ALL_QUIT\0"
+    "DISPATCH_STALLS_DRAIN\0"
+    "FPU_EXCEPTIONS_X87_RECLASS\0"
+    "FPU_EXCEPTIONS_SSE_RETYPE\0"
+    "FPU_EXCEPTIONS_SSE_RECLASS\0"
+    "FPU_EXCEPTIONS_MICROTRAPS\0"
+    "DRAM_ACCESSES_ALL\0"
+    "DRAM_ACCESSES_PAGE_HIT\0"
+    "DRAM_ACCESSES_PAGE_MISS\0"
+    "DRAM_ACCESSES_PAGE_CONFLICT\0"
+    "DRAM_PAGE_TABLE_OVERFLOW_ALL\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_CHIP_SELECT\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_READ_TO_WRITE\0"
+    "DRAM_CONTROLLER_TURNAROUNDS_WRITE_TO_READ\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_HIGH\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_MEDIUM\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_DRAM_INTERFACE\0"
+    "DRAM_CONTROLLER_BYPASS_SATURATION_DRAM_QUEUE\0"
+    "DRAM_SIZED_BLOCKS_WRITES_32\0"
+    "DRAM_SIZED_BLOCKS_WRITES_64\0"
+    "DRAM_SIZED_BLOCKS_READS_32\0"
+    "DRAM_SIZED_BLOCKS_READS_64\0"
+    "CACHE_BLOCK_COMMANDS_VICTIM\0"
+    "CACHE_BLOCK_COMMANDS_READ\0"
+    "CACHE_BLOCK_COMMANDS_READ_SHARED\0"
+    "CACHE_BLOCK_COMMANDS_READ_MODIFIED\0"
+    "CACHE_BLOCK_COMMANDS_DIRTY\0"
+    "HYPERTRANSPORT_LINK0_CMD_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_BUFFER_RELEASE_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK0_IDLE\0"
+    "HYPERTRANSPORT_LINK1_CMD_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_BUFFER_RELEASE_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK1_IDLE\0"
+    "HYPERTRANSPORT_LINK2_CMD_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_DATA_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_BUFFER_RELEASE_DWORD_SENT\0"
+    "HYPERTRANSPORT_LINK2_IDLE\0";
+
+static const PerfmonEventOption k8_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry k8_arch_event_entries[NUM_ARCH_EVENTS_K8] = {
+ {0, 26, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30, 26, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 26, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {89, 26, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 26, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {156, 26, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {189, 26, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {199, 26, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {219, 26, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {244, 26, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {269, 26, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {294, 26, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {319, 26, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {344, 26, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {369, 26, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {394, 26, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {420, 26, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {447, 26, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 26, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {492, 26, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {525, 26, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {562, 26, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {582, 26, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {600, 26, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {631, 26, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {660, 26, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {692, 26, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {720, 26, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {751, 26, 0, 0, 0x42,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {777, 26, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {816, 26, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {854, 26, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {895, 26, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {932, 26, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {972, 26, 0, 0, 0x43,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {1007, 26, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1034, 26, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1060, 26, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1089, 26, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1114, 26, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1142, 26, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1174, 26, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1210, 26, 0, 0, 0x44,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1233, 26, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1249, 26, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1265, 26, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1281, 26, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1297, 26, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1314, 26, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1331, 26, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1348, 26, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1365, 26, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1383, 26, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1402, 26, 0, 0, 0x49,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1422, 26, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1449, 26, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1477, 26, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1505, 26, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1534, 26, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1571, 26, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1609, 26, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1645, 26, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1662, 26, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1691, 26, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1721, 26, 0, 0, 0x65,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1752, 26, 0, 0, 0x67,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1777, 26, 0, 0, 0x67,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1802, 26, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1838, 26, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1873, 26, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1906, 26, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1932, 26, 0, 0, 0x7D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1956, 26, 0, 0, 0x7D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1980, 26, 0, 0, 0x7D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2006, 26, 0, 0, 0x7D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2036, 26, 0, 0, 0x7D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2066, 26, 0, 0, 0x7E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2088, 26, 0, 0, 0x7E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2110, 26, 0, 0, 0x7E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2129, 26, 0, 0, 0x7F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2145, 26, 0, 0, 0x7F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2164, 26, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2179, 26, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2193, 26, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2211, 26, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2230, 26, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2242, 26, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2259, 26, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2276, 26, 0, 0, 0x85,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2293, 26, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2323, 26, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2347, 26, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2365, 26, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2387, 26, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2403, 26, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2417, 26, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2437, 26, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2458, 26, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2471, 26, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2486, 26, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2512, 26, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2533, 26, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2567, 26, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2596, 26, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2619, 26, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2640, 26, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2674, 26, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2709, 26, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2734, 26, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2759, 26, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2784, 26, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2803, 26, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2822, 26, 0, 0, 0xCC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2841, 26, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2866, 26, 0, 0, 0xCF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2883, 26, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2904, 26, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2920, 26, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2943, 26, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2966, 26, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2995, 26, 0, 0, 0xD5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3020, 26, 0, 0, 0xD6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3045, 26, 0, 0, 0xD7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3070, 26, 0, 0, 0xD8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3094, 26, 0, 0, 0xD9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3119, 26, 0, 0, 0xDA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3141, 26, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3168, 26, 0, 0, 0xDB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3194, 26, 0, 0, 0xDB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3221, 26, 0, 0, 0xDB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3247, 26, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3265, 26, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3288, 26, 0, 0, 0xE0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3312, 26, 0, 0, 0xE0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3340, 26, 0, 0, 0xE1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3369, 26, 0, 0, 0xE3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3409, 26, 0, 0, 0xE3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3451, 26, 0, 0, 0xE3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3493, 26, 0, 0, 0xE4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3532, 26, 0, 0, 0xE4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3573, 26, 0, 0, 0xE4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3622, 26, 0, 0, 0xE4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3667, 26, 0, 0, 0xE5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3695, 26, 0, 0, 0xE5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3723, 26, 0, 0, 0xE5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3750, 26, 0, 0, 0xE5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3777, 26, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3805, 26, 0, 0, 0xEA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3831, 26, 0, 0, 0xEA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3864, 26, 0, 0, 0xEA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3899, 26, 0, 0, 0xEA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3926, 26, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3962, 26, 0, 0, 0xF6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3999, 26, 0, 0, 0xF6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4046, 26, 0, 0, 0xF6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4072, 26, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4108, 26, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4145, 26, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4192, 26, 0, 0, 0xF7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4218, 26, 0, 0, 0xF8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4254, 26, 0, 0, 0xF8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4291, 26, 0, 0, 0xF8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4338, 26, 0, 0, 0xF8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable k8_arch_events = {
+    NUM_ARCH_EVENTS_K8,
+    k8_arch_event_strings,
+    k8_arch_event_options,
+    k8_arch_event_entries
+};
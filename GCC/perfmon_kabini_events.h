@@ -0,0 +1,878 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_KABINI 428
+
+static const char kabini_arch_event_strings[] =
+    "FPU_PIPE_ASSIGNMENT_PIPE_0\0"
+    "PMC\0"
+    "FPU_PIPE_ASSIGNMENT_PIPE_1\0"
+    "FP_SCHEDULER_EMPTY\0"
+    "DISPATCHED_FAST_FPU\0"
+    "RETIRED_FLOPS_DOUBLE_DIV\0"
+    "RETIRED_FLOPS_DOUBLE_MUL\0"
+    "RETIRED_FLOPS_DOUBLE_ADD\0"
+    "RETIRED_FLOPS_DOUBLE_ALL\0"
+    "RETIRED_FLOPS_SINGLE_DIV\0"
+    "RETIRED_FLOPS_SINGLE_MUL\0"
+    "RETIRED_FLOPS_SINGLE_ADD\0"
+    "RETIRED_FLOPS_SINGLE_ALL\0"
+    "RETIRED_SERIALIZING_OPS_SSE_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_SSE_CONTROL\0"
+    "RETIRED_SERIALIZING_OPS_X87_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_X87_CONTROL\0"
+    "RETIRED_X87_FLOPS_ADD\0"
+    "RETIRED_X87_FLOPS_MUL\0"
+    "RETIRED_X87_FLOPS_DIV\0"
+    "SEGMENT_REGISTER_LOADS_ES\0"
+    "SEGMENT_REGISTER_LOADS_CS\0"
+    "SEGMENT_REGISTER_LOADS_SS\0"
+    "SEGMENT_REGISTER_LOADS_DS\0"
+    "SEGMENT_REGISTER_LOADS_FS\0"
+    "SEGMENT_REGISTER_LOADS_GS\0"
+    "SEGMENT_REGISTER_LOADS_HS\0"
+    "PIPELINE_RESTART_SELFMOD_CODE\0"
+    "PIPELINE_RESTART_PROBE_HIT_INV\0"
+    "PIPELINE_RESTART_PROBE_HIT_FILLS\0"
+    "LOCKED_OPERATION_CYCLES_TO_UNLCOK\0"
+    "LOCKED_OPERATION_CYCLES_TO_BUS_LOCK\0"
+    "LOCKED_OPERATION_LOCKED_INSTR\0"
+    "CLFLUSH_RETIRED\0"
+    "CPUID_RETIRED\0"
+    "LS_DISPATCH_LOADS\0"
+    "LS_DISPATCH_STORES\0"
+    "LS_DISPATCH_LOAD_OP_STORES\0"
+    "CANCELED_STORE_FORWARD_ADDR_MISMATCH\0"
+    "CANCELED_STORE_FORWARD_SMALL_STORES\0"
+    "CANCELED_STORE_FORWARD_MISALIGNED_STORES\0"
+    "DATA_CACHE_ACCESSES\0"
+    "DATA_CACHE_MISSES\0"
+    "DATA_CACHE_REFILLS_NONCACHED\0"
+    "DATA_CACHE_REFILLS_SHARED\0"
+    "DATA_CACHE_REFILLS_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_OWNED\0"
+    "DATA_CACHE_REFILLS_MODIFIED\0"
+    "DATA_CACHE_REFILLS_ALL\0"
+    "DATA_CACHE_REFILLS_NB_NONCACHED\0"
+    "DATA_CACHE_REFILLS_NB_SHARED\0"
+    "DATA_CACHE_REFILLS_NB_EXCLUSIVE\0"
+    "DATA_CACHE_REFILLS_NB_OWNED\0"
+    "DATA_CACHE_REFILLS_NB_MODIFIED\0"
+    "DATA_CACHE_REFILLS_NB_ALL\0"
+    "DATA_CACHE_EVICTED_INVALID\0"
+    "DATA_CACHE_EVICTED_SHARED\0"
+    "DATA_CACHE_EVICTED_EXCLUSIVE\0"
+    "DATA_CACHE_EVICTED_OWNED\0"
+    "DATA_CACHE_EVICTED_MODIFIED\0"
+    "DATA_CACHE_EVICTED_ALL\0"
+    "L2_DTLB_HIT\0"
+    "L2_DTLB_HIT_ALL\0"
+    "DTLB_MISS_STORE_L1\0"
+    "DTLB_MISS_LOAD_L1\0"
+    "DTLB_MISS_STORE_L2\0"
+    "DTLB_MISS_LOAD_L2\0"
+    "DTLB_MISS_ALL\0"
+    "PREFETCH_INSTR_DISPATCHED_LOAD\0"
+    "PREFETCH_INSTR_DISPATCHED_STORE\0"
+    "PREFETCH_INSTR_DISPATCHED_NTA\0"
+    "DCACHE_LOCK_MISS\0"
+    "DTLB_L1_HIT_4KB\0"
+    "DTLB_L1_HIT_2MB\0"
+    "DTLB_L1_HIT_ANY\0"
+    "INEFFECTIVE_PREFETCHES_DATA_CACHE\0"
+    "INEFFECTIVE_PREFETCHES_PENDING_FILL\0"
+    "INEFFECTIVE_PREFETCHES_NO_MAB\0"
+    "INEFFECTIVE_PREFETCHES_L2_HIT\0"
+    "GLOBAL_TLB_FLUSH\0"
+    "GLOBAL_READ_BLOCK_OPS_READ\0"
+    "GLOBAL_READ_BLOCK_OPS_RDBLK_MOD\0"
+    "GLOBAL_READ_BLOCK_OPS_RDBLK_SHARED\0"
+    "GLOBAL_READ_BLOCK_OPS_RDBLKSPEC\0"
+    "GLOBAL_READ_BLOCK_OPS_RDBLKSPEC_MOD\0"
+    "GLOBAL_READ_BLOCK_OPS_SPEC_SHARED\0"
+    "MEMORY_REQUESTS_UC\0"
+    "MEMORY_REQUESTS_WC\0"
+    "MEMORY_REQUESTS_SS\0"
+    "DATA_PREFETCHER_ATTEMPTS\0"
+    "DATA_PREFETCHER_HIT_MAB\0"
+    "MAB_REQ\0"
+    "MAB_WAIT\0"
+    "RESPONSE_ON_CACHE_REFILLS_EXCLUSIVE\0"
+    "RESPONSE_ON_CACHE_REFILLS_MODIFIED\0"
+    "RESPONSE_ON_CACHE_REFILLS_SHARED\0"
+    "RESPONSE_ON_CACHE_REFILLS_OWNED\0"
+    "RESPONSE_ON_CACHE_REFILLS_DATA_ERROR\0"
+    "RESPONSE_ON_CACHE_REFILLS_CHANGE_TO_DIRTY\0"
+    "RESPONSE_ON_CACHE_REFILLS_UNCACHEABLE\0"
+    "DATA_WRITTEN_LINE_EVICTION\0"
+    "DATA_WRITTEN_INSN_ATTR__EVICTION\0"
+    "DATA_WRITTEN_BYTE_ENABLE_UNCACHEABLE_IO_STORE\0"
+    "DATA_WRITTEN_UNCACHEABLE_IO_STORE\0"
+    "DATA_WRITTEN_BYTE_ENABLE_WRITE_COMBINE_FLUSH\0"
+    "DATA_WRITTEN_WRITE_COMBINE_FLUSH\0"
+    "CACHE_CROSS_INVALIDATES_DC_IC\0"
+    "CACHE_CROSS_INVALIDATES_DC_DC\0"
+    "CACHE_CROSS_INVALIDATES_IC_IC\0"
+    "CACHE_CROSS_INVALIDATES_IC_DC\0"
+    "CACHE_CROSS_INVALIDATES_IC_HITS_DC\0"
+    "CACHE_CROSS_INVALIDATES_DC_PROBE_REJ_EARLY\0"
+    "CACHE_CROSS_INVALIDATES_DC_PROBE_REJ_LATE\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "PDC_MISS_HOST_PDE\0"
+    "PDC_MISS_HOST_PDPE\0"
+    "PDC_MISS_HOST_PML4E\0"
+    "PDC_MISS_GUEST_PDE\0"
+    "PDC_MISS_GUEST_PDPE\0"
+    "PDC_MISS_GUEST_PML4E\0"
+    "INSTRUCTION_CACHE_FETCHES\0"
+    "INSTRUCTION_CACHE_MISSES\0"
+    "INSTRUCTION_CACHE_L2_REFILLS\0"
+    "INSTRUCTION_CACHE_SYSTEM_REFILLS\0"
+    "ITLB_L1_MISS_L2_HIT\0"
+    "ITLB_L1_MISS_L2_MISS_4KB\0"
+    "ITLB_L1_MISS_L2_MISS_2MB\0"
+    "ITLB_L1_MISS_L2_MISS_ANY\0"
+    "INSTRUCTION_FETCH_STALL\0"
+    "RETURN_STACK_HITS\0"
+    "RETURN_STACK_OVERFLOWS\0"
+    "INSTRUCTION_CACHE_VICTIMS\0"
+    "ICACHE_LINES_INVALIDATED_LS_PROBE\0"
+    "ICACHE_LINES_INVALIDATED_BU_PROBE\0"
+    "ITLB_RELOADS\0"
+    "ITLB_RELOADS_ABORTED\0"
+    "RETIRED_INDIR_BRANCH\0"
+    "RETIRED_INDIR_MISPRED_BRANCH\0"
+    "RETIRED_INSTRUCTIONS\0"
+    "RETIRED_UOPS\0"
+    "RETIRED_BRANCH_INSTR\0"
+    "RETIRED_MISPREDICTED_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_MISPREDICTED_BRANCH_INSTR\0"
+    "RETIRED_FAR_CONTROL_TRANSFERS\0"
+    "RETIRED_BRANCH_RESYNCS\0"
+    "RETIRED_NEAR_RETURNS\0"
+    "RETIRED_NEAR_RETURNS_MISPRED\0"
+    "RETIRED_INDIRECT_BRANCHES_MISPRED\0"
+    "RETIRED_FP_INSTRUCTIONS_X87_MMX\0"
+    "RETIRED_FP_INSTRUCTIONS_SSE\0"
+    "RETIRED_FP_INSTRUCTIONS_ALL\0"
+    "INTERRUPTS_MASKED_CYCLES\0"
+    "INTERRUPTS_MASKED_CYCLES_INTERRUPTS_PENDING\0"
+    "INTERRUPTS_TAKEN\0"
+    "FPU_EXCEPTION_X87_MICROFAULTS\0"
+    "FPU_EXCEPTION_SSE_RETYPE__MICROFAULTS\0"
+    "FPU_EXCEPTION_SSE_RECLASS_MICROFAULTS\0"
+    "FPU_EXCEPTION_SSE_X87_MICROTRAPS\0"
+    "FPU_EXCEPTION_ALL\0"
+    "IBS_OPS\0"
+    "IBS_RETIRED_OPS\0"
+    "CMD_RELATED_TO_VICTIM_BUFFERS_WR_VIC_BLK_RINSING\0"
+    "CPMC\0"
+    "CMD_RELATED_TO_VICTIM_BUFFERS_WR_VIC_BLK_NON_RINSING\0"
+    "CMD_RELATED_TO_VICTIM_BUFFERS_CLEAN_VIC_CMD\0"
+    "CMD_RELATED_TO_VICTIM_BUFFERS_LOCK\0"
+    "CMD_RELATED_TO_MASKED_OPS_READ_BYTE\0"
+    "CMD_RELATED_TO_MASKED_OPS_READ_DBL_WORD\0"
+    "CMD_RELATED_TO_MASKED_OPS_WRITE_BYTE\0"
+    "CMD_RELATED_TO_MASKED_OPS_WRITE_DBL_WORD\0"
+    "CMD_RELATED_TO_READ_BLOCK_OPS_READ_BLOCK\0"
+    "CMD_RELATED_TO_READ_BLOCK_OPS_READ_BLOCK_M\0"
+    "CMD_RELATED_TO_READ_BLOCK_OPS_READ_BLOCK_S\0"
+    "CMD_RELATED_TO_CHANGE_TO_DIRTY_OPS\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_EXCLUSIVE\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_MODIFIED\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_SHARED\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_OWNED\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_DATA_ERROR\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_CHG_TO_DIRTY_SUCCESS\0"
+    "RESP_FROM_SYS_ON_CACHE_REFILLS_UNCACHEABLE\0"
+    "REQ_TO_L2_CACHE_ICACHE_FILL\0"
+    "REQ_TO_L2_CACHE_DATA_FILL\0"
+    "REQ_TO_L2_CACHE_NB_PROBE_REQ\0"
+    "REQ_TO_L2_CACHE_PREF_REQ\0"
+    "L2_CACHE_MISSES_ICACHE_FILL\0"
+    "L2_CACHE_MISSES_DATA_FILL\0"
+    "L2_CACHE_MISSES_PREF_REQ\0"
+    "L2_FILLS_WRITEBACK_L2_FILLS\0"
+    "L2_FILLS_WRITEBACK_L2_WRITEBACKS\0"
+    "L2_FILLS_WRITEBACK_L2_CLEAN_WRITEBACKS\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_MEM_HIGH\0"
+    "UPMC\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_MEM_MED\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT0\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT1\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT2\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT3\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT4\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT5\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT6\0"
+    "UNC_MEMORY_CONTROLLER_BYPASS_COUNTER_SATURATION_DCQ_SATURATED_DCT7\0"
+    "UNC_THERMAL_STATUS_HTC_TRIP_POINT_CROSSED\0"
+    "UNC_THERMAL_STATUS_HTCP_INACTIVE\0"
+    "UNC_THERMAL_STATUS_HTCP_ACTIVE\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_CPU_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_IO_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_LOCAL_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_CPU_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_IO_MEM\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_LOCAL_REMOTE_IO_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_REMOTE_LOCAL_CPU_IO\0"
+    "UNC_CPU_REQUEST_TO_MEMORY_REMOTE_LOCAL_IO_IO\0"
+    "UNC_CACHE_BLOCK_COMMANDS_VICTIM_BLOCK\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK_SHARED\0"
+    "UNC_CACHE_BLOCK_COMMANDS_READ_BLOCK_MODIFIED\0"
+    "UNC_CACHE_BLOCK_COMMANDS_CHANGE_TO_DIRTY\0"
+    "UNC_SIZED_COMMANDS_NP_WR_BYTE\0"
+    "UNC_SIZED_COMMANDS_NP_WR_DW\0"
+    "UNC_SIZED_COMMANDS_P_WR_BYTE\0"
+    "UNC_SIZED_COMMANDS_P_WR_DW\0"
+    "UNC_SIZED_COMMANDS_RE_BYTE\0"
+    "UNC_SIZED_COMMANDS_RE_DW\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_MISS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_CLEAN\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_DIRTY_WITHOUT_CANCEL\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_PROBE_HIT_DIRTY_WITH_CANCEL\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_DISPLAY_READS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_NON_DISPLAY_READS\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_ISOC_WRITED\0"
+    "UNC_PROBE_RESPONSES_UPSTREAM_REQUESTS_UPSTREAM_NON_ISOC_WRITES\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_0\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_1\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_2\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_3\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_4\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_5\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_6\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_7\0"
+    "UNC_CPU_TO_DRAM_LOCAL_TO_ALL\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_0\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_1\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_2\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_3\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_4\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_5\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_6\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_7\0"
+    "UNC_IO_TO_DRAM_LOCAL_TO_ALL\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_0\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_1\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_2\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_MOD_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_READ_SHARED_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_DIRTY_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_A_ALL_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_0\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_1\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_2\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_MOD_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_READ_SHARED_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_DIRTY_TO_3\0"
+    "UNC_CPU_READ_CMD_REQUESTS_A_ALL_TO_3\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_4\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_5\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_6\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_MOD_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_READ_SHARED_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_DIRTY_TO_7\0"
+    "UNC_CPU_READ_CMD_LATENCY_B_ALL_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_4\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_5\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_6\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_MOD_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_READ_SHARED_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_DIRTY_TO_7\0"
+    "UNC_CPU_READ_CMD_REQUESTS_B_ALL_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_0\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_4\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_1\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_5\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_2\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_6\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_3\0"
+    "UNC_CPU_CMD_LATENCY_READ_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_WRITE_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_VICTIM_TO_7\0"
+    "UNC_CPU_CMD_LATENCY_ALL_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_0\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_4\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_1\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_5\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_2\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_6\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_3\0"
+    "UNC_CPU_CMD_REQUESTS_READ_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_WRITE_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_VICTIM_TO_7\0"
+    "UNC_CPU_CMD_REQUESTS_ALL_TO_7\0"
+    "REQ_CACHE_STATUS_HIT_S\0"
+    "REQ_CACHE_STATUS_HIT_E\0"
+    "REQ_CACHE_STATUS_HIT_MUW_O\0"
+    "REQ_CACHE_STATUS_HIT_M\0"
+    "REQ_CACHE_STATUS_HIT_MISS\0"
+    "REQ_CACHE_STATUS_HIT_DIRECT_PROBE\0"
+    "REQ_CACHE_STATUS_HIT_TRACK_CHGTODIRTY\0"
+    "REQ_CACHE_STATUS_HIT_TRACK_RDBLKM\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_WRITE_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_READ_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_PREFETCH_REQ_DCT\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_32_SIZED_WRITES\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_64_SIZED_WRITES\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_32_SIZED_READS\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_64_SIZED_READS\0"
+    "UNC_MEMORY_CONTROLLER_REQUESTS_READ_WHILE_WRITE\0"
+    "UNC_DRAM_ACCESS_DCT0_PAGE_HIT\0"
+    "UNC_DRAM_ACCESS_DCT0_PAGE_MISS\0"
+    "UNC_DRAM_ACCESS_DCT0_PAGE_CONFLICT\0"
+    "UNC_DRAM_ACCESSES_DCT0_ALL\0"
+    "UNC_DRAM_ACCESS_DCT1_PAGE_HIT\0"
+    "UNC_DRAM_ACCESS_DCT2_PAGE_MISS\0"
+    "UNC_DRAM_ACCESS_DCT3_PAGE_CONFLICT\0"
+    "UNC_DRAM_ACCESSES_DCT1_ALL\0"
+    "UNC_DRAM_CONTROLLER_PAGE_TABLE_OVERFLOW_DCT0\0"
+    "UNC_DRAM_CONTROLLER_PAGE_TABLE_OVERFLOW_DCT1\0"
+    "MEMORY_CONTROLLER_DRAM_CMD_SLOTS_MISSED_DCT0\0"
+    "MEMORY_CONTROLLER_DRAM_CMD_SLOTS_MISSED_DCT1\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT0_DIMM\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT0_READ_TO_WRITE\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT0_WRITE_TO_READ\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT1_DIMM\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT1_READ_TO_WRITE\0"
+    "MEMORY_CONTROLLER_TURNAROUNDS_DCT1_WRITE_TO_READ\0";
+
+static const PerfmonEventOption kabini_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry kabini_arch_event_entries[NUM_ARCH_EVENTS_KABINI] = {
+ {0, 27, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31, 27, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {58, 27, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77, 27, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {97, 27, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {122, 27, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {147, 27, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {172, 27, 0, 0, 0x03,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {197, 27, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {222, 27, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {247, 27, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {272, 27, 0, 0, 0x03,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {297, 27, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {332, 27, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {368, 27, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {403, 27, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {439, 27, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {461, 27, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {483, 27, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {505, 27, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {531, 27, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {557, 27, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {583, 27, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {609, 27, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {635, 27, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {661, 27, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {687, 27, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {717, 27, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {748, 27, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {781, 27, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {815, 27, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {851, 27, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {881, 27, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {897, 27, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {911, 27, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {929, 27, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {948, 27, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {975, 27, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1012, 27, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1048, 27, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1089, 27, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1109, 27, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1127, 27, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1156, 27, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1182, 27, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1211, 27, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1236, 27, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1264, 27, 0, 0, 0x42,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {1287, 27, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1319, 27, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1348, 27, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1380, 27, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1408, 27, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1439, 27, 0, 0, 0x43,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {1465, 27, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1492, 27, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1518, 27, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1547, 27, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1572, 27, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1600, 27, 0, 0, 0x44,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1623, 27, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1635, 27, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1651, 27, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1670, 27, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1688, 27, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1707, 27, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1725, 27, 0, 0, 0x46,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1739, 27, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1770, 27, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1802, 27, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1832, 27, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1849, 27, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1865, 27, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1881, 27, 0, 0, 0x4D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1897, 27, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1931, 27, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1967, 27, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1997, 27, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2027, 27, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2044, 27, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2071, 27, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2103, 27, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2138, 27, 0, 0, 0x62,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2170, 27, 0, 0, 0x62,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2206, 27, 0, 0, 0x62,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2240, 27, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2259, 27, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2278, 27, 0, 0, 0x65,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2297, 27, 0, 0, 0x67,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2322, 27, 0, 0, 0x67,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2346, 27, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2354, 27, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2363, 27, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2399, 27, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2434, 27, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2467, 27, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2499, 27, 0, 0, 0x6C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2536, 27, 0, 0, 0x6C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2578, 27, 0, 0, 0x6C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2616, 27, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2643, 27, 0, 0, 0x6D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2676, 27, 0, 0, 0x6D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2722, 27, 0, 0, 0x6D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2756, 27, 0, 0, 0x6D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2801, 27, 0, 0, 0x6D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2834, 27, 0, 0, 0x75,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2864, 27, 0, 0, 0x75,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2894, 27, 0, 0, 0x75,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2924, 27, 0, 0, 0x75,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2954, 27, 0, 0, 0x75,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2989, 27, 0, 0, 0x75,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3032, 27, 0, 0, 0x75,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3074, 27, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3094, 27, 0, 0, 0x162,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3112, 27, 0, 0, 0x162,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3131, 27, 0, 0, 0x162,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3151, 27, 0, 0, 0x162,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3170, 27, 0, 0, 0x162,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3190, 27, 0, 0, 0x162,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3211, 27, 0, 0, 0x080,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3237, 27, 0, 0, 0x081,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3262, 27, 0, 0, 0x082,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3291, 27, 0, 0, 0x083,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3324, 27, 0, 0, 0x084,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3344, 27, 0, 0, 0x085,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3369, 27, 0, 0, 0x085,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3394, 27, 0, 0, 0x085,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3419, 27, 0, 0, 0x087,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3443, 27, 0, 0, 0x088,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3461, 27, 0, 0, 0x089,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3484, 27, 0, 0, 0x08B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3510, 27, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3544, 27, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3578, 27, 0, 0, 0x099,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3591, 27, 0, 0, 0x09A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3612, 27, 0, 0, 0x19A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3633, 27, 0, 0, 0x19A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3662, 27, 0, 0, 0x0C0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3683, 27, 0, 0, 0x0C1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3696, 27, 0, 0, 0x0C2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3717, 27, 0, 0, 0x0C3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3751, 27, 0, 0, 0x0C4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3778, 27, 0, 0, 0x0C5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3818, 27, 0, 0, 0x0C6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3848, 27, 0, 0, 0x0C7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3871, 27, 0, 0, 0x0C8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3892, 27, 0, 0, 0x0C9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3921, 27, 0, 0, 0x0CA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3955, 27, 0, 0, 0x0CB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3987, 27, 0, 0, 0x0CB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4015, 27, 0, 0, 0x0CB,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4043, 27, 0, 0, 0x0CD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4068, 27, 0, 0, 0x0CE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4112, 27, 0, 0, 0x0CF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4129, 27, 0, 0, 0x0DB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4159, 27, 0, 0, 0x0DB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4197, 27, 0, 0, 0x0DB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4235, 27, 0, 0, 0x0DB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4268, 27, 0, 0, 0x0DB,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {4286, 27, 0, 0, 0x1CF,0x0,0,0,EVENT_OPTION_NONE_MASK}
+, {4294, 27, 0, 0, 0x1D0,0x0,0,0,EVENT_OPTION_NONE_MASK}
+, {4310, 4359, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4364, 4359, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4417, 4359, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4461, 4359, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4496, 4359, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4532, 4359, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4572, 4359, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4609, 4359, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4650, 4359, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4691, 4359, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4734, 4359, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4777, 4359, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4812, 4359, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4853, 4359, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4893, 4359, 0, 0, 0x6C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4931, 4359, 0, 0, 0x6C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4968, 4359, 0, 0, 0x6C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5010, 4359, 0, 0, 0x6C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5062, 4359, 0, 0, 0x6C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5105, 4359, 0, 0, 0x7D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5133, 4359, 0, 0, 0x7D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5159, 4359, 0, 0, 0x7D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5188, 4359, 0, 0, 0x7D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5213, 4359, 0, 0, 0x7E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5241, 4359, 0, 0, 0x7E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5267, 4359, 0, 0, 0x7E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5292, 4359, 0, 0, 0x7F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5320, 4359, 0, 0, 0x7F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5353, 4359, 0, 0, 0x7F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5392, 5449, 0, 0, 0x0E4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5454, 5449, 0, 0, 0x0E4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5510, 5449, 0, 0, 0x0E4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5577, 5449, 0, 0, 0x0E4,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {5644, 5449, 0, 0, 0x0E4,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {5711, 5449, 0, 0, 0x0E4,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {5778, 5449, 0, 0, 0x0E4,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {5845, 5449, 0, 0, 0x0E4,0x34,0,0,EVENT_OPTION_NONE_MASK}
+, {5912, 5449, 0, 0, 0x0E4,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {5979, 5449, 0, 0, 0x0E4,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {6046, 5449, 0, 0, 0x0E8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6088, 5449, 0, 0, 0x0E8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6121, 5449, 0, 0, 0x0E8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6152, 5449, 0, 0, 0x0E9,0xA8,0,0,EVENT_OPTION_NONE_MASK}
+, {6198, 5449, 0, 0, 0x0E9,0xA4,0,0,EVENT_OPTION_NONE_MASK}
+, {6243, 5449, 0, 0, 0x0E9,0xA2,0,0,EVENT_OPTION_NONE_MASK}
+, {6288, 5449, 0, 0, 0x0E9,0xA1,0,0,EVENT_OPTION_NONE_MASK}
+, {6332, 5449, 0, 0, 0x0E9,0x98,0,0,EVENT_OPTION_NONE_MASK}
+, {6379, 5449, 0, 0, 0x0E9,0x94,0,0,EVENT_OPTION_NONE_MASK}
+, {6425, 5449, 0, 0, 0x0E9,0x92,0,0,EVENT_OPTION_NONE_MASK}
+, {6471, 5449, 0, 0, 0x0E9,0x91,0,0,EVENT_OPTION_NONE_MASK}
+, {6516, 5449, 0, 0, 0x0E9,0x64,0,0,EVENT_OPTION_NONE_MASK}
+, {6562, 5449, 0, 0, 0x0E9,0x61,0,0,EVENT_OPTION_NONE_MASK}
+, {6607, 5449, 0, 0, 0x0EA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6645, 5449, 0, 0, 0x0EA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6681, 5449, 0, 0, 0x0EA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6724, 5449, 0, 0, 0x0EA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6769, 5449, 0, 0, 0x0EA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6810, 5449, 0, 0, 0x0EB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6840, 5449, 0, 0, 0x0EB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6868, 5449, 0, 0, 0x0EB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6897, 5449, 0, 0, 0x0EB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6924, 5449, 0, 0, 0x0EB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6951, 5449, 0, 0, 0x0EB,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6976, 5449, 0, 0, 0x0EC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7025, 5449, 0, 0, 0x0EC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7079, 5449, 0, 0, 0x0EC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7148, 5449, 0, 0, 0x0EC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7214, 5449, 0, 0, 0x0EC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7275, 5449, 0, 0, 0x0EC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7340, 5449, 0, 0, 0x0EC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7399, 5449, 0, 0, 0x0EC,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7462, 5449, 0, 0, 0x1E0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7489, 5449, 0, 0, 0x1E0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7516, 5449, 0, 0, 0x1E0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7543, 5449, 0, 0, 0x1E0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7570, 5449, 0, 0, 0x1E0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7597, 5449, 0, 0, 0x1E0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7624, 5449, 0, 0, 0x1E0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 5449, 0, 0, 0x1E0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7678, 5449, 0, 0, 0x1E0,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7707, 5449, 0, 0, 0x1E1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7733, 5449, 0, 0, 0x1E1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7759, 5449, 0, 0, 0x1E1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7785, 5449, 0, 0, 0x1E1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7811, 5449, 0, 0, 0x1E1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7837, 5449, 0, 0, 0x1E1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7863, 5449, 0, 0, 0x1E1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7889, 5449, 0, 0, 0x1E1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7915, 5449, 0, 0, 0x1E1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7943, 5449, 0, 0, 0x1E2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7980, 5449, 0, 0, 0x1E2,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8021, 5449, 0, 0, 0x1E2,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {8065, 5449, 0, 0, 0x1E2,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {8103, 5449, 0, 0, 0x1E2,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8139, 5449, 0, 0, 0x1E2,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8176, 5449, 0, 0, 0x1E2,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8217, 5449, 0, 0, 0x1E2,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8261, 5449, 0, 0, 0x1E2,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {8299, 5449, 0, 0, 0x1E2,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {8335, 5449, 0, 0, 0x1E2,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8372, 5449, 0, 0, 0x1E2,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8413, 5449, 0, 0, 0x1E2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {8457, 5449, 0, 0, 0x1E2,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {8495, 5449, 0, 0, 0x1E2,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {8531, 5449, 0, 0, 0x1E2,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8568, 5449, 0, 0, 0x1E2,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8609, 5449, 0, 0, 0x1E2,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {8653, 5449, 0, 0, 0x1E2,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {8691, 5449, 0, 0, 0x1E2,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {8727, 5449, 0, 0, 0x1E3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {8765, 5449, 0, 0, 0x1E3,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8807, 5449, 0, 0, 0x1E3,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {8852, 5449, 0, 0, 0x1E3,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {8891, 5449, 0, 0, 0x1E3,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8928, 5449, 0, 0, 0x1E3,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8966, 5449, 0, 0, 0x1E3,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {9008, 5449, 0, 0, 0x1E3,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9053, 5449, 0, 0, 0x1E3,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {9092, 5449, 0, 0, 0x1E3,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {9129, 5449, 0, 0, 0x1E3,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9167, 5449, 0, 0, 0x1E3,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9209, 5449, 0, 0, 0x1E3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {9254, 5449, 0, 0, 0x1E3,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {9293, 5449, 0, 0, 0x1E3,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {9330, 5449, 0, 0, 0x1E3,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {9368, 5449, 0, 0, 0x1E3,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {9410, 5449, 0, 0, 0x1E3,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {9455, 5449, 0, 0, 0x1E3,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {9494, 5449, 0, 0, 0x1E3,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {9531, 5449, 0, 0, 0x1E4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {9568, 5449, 0, 0, 0x1E4,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {9609, 5449, 0, 0, 0x1E4,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {9653, 5449, 0, 0, 0x1E4,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {9691, 5449, 0, 0, 0x1E4,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {9727, 5449, 0, 0, 0x1E4,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {9764, 5449, 0, 0, 0x1E4,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {9805, 5449, 0, 0, 0x1E4,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9849, 5449, 0, 0, 0x1E4,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {9887, 5449, 0, 0, 0x1E4,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {9923, 5449, 0, 0, 0x1E4,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9960, 5449, 0, 0, 0x1E4,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10001, 5449, 0, 0, 0x1E4,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10045, 5449, 0, 0, 0x1E4,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {10083, 5449, 0, 0, 0x1E4,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {10119, 5449, 0, 0, 0x1E4,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10156, 5449, 0, 0, 0x1E4,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10197, 5449, 0, 0, 0x1E4,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {10241, 5449, 0, 0, 0x1E4,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {10279, 5449, 0, 0, 0x1E4,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {10315, 5449, 0, 0, 0x1E5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10353, 5449, 0, 0, 0x1E5,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10395, 5449, 0, 0, 0x1E5,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {10440, 5449, 0, 0, 0x1E5,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {10479, 5449, 0, 0, 0x1E5,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10516, 5449, 0, 0, 0x1E5,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10554, 5449, 0, 0, 0x1E5,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10596, 5449, 0, 0, 0x1E5,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10641, 5449, 0, 0, 0x1E5,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {10680, 5449, 0, 0, 0x1E5,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {10717, 5449, 0, 0, 0x1E5,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10755, 5449, 0, 0, 0x1E5,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10797, 5449, 0, 0, 0x1E5,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10842, 5449, 0, 0, 0x1E5,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {10881, 5449, 0, 0, 0x1E5,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {10918, 5449, 0, 0, 0x1E5,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10956, 5449, 0, 0, 0x1E5,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10998, 5449, 0, 0, 0x1E5,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11043, 5449, 0, 0, 0x1E5,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11082, 5449, 0, 0, 0x1E5,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {11119, 5449, 0, 0, 0x1E6,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {11149, 5449, 0, 0, 0x1E6,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {11180, 5449, 0, 0, 0x1E6,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {11212, 5449, 0, 0, 0x1E6,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {11241, 5449, 0, 0, 0x1E6,0x19,0,0,EVENT_OPTION_NONE_MASK}
+, {11271, 5449, 0, 0, 0x1E6,0x1A,0,0,EVENT_OPTION_NONE_MASK}
+, {11302, 5449, 0, 0, 0x1E6,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {11334, 5449, 0, 0, 0x1E6,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11363, 5449, 0, 0, 0x1E6,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {11393, 5449, 0, 0, 0x1E6,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {11424, 5449, 0, 0, 0x1E6,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11456, 5449, 0, 0, 0x1E6,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {11485, 5449, 0, 0, 0x1E6,0x29,0,0,EVENT_OPTION_NONE_MASK}
+, {11515, 5449, 0, 0, 0x1E6,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {11546, 5449, 0, 0, 0x1E6,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {11578, 5449, 0, 0, 0x1E6,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {11607, 5449, 0, 0, 0x1E6,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {11637, 5449, 0, 0, 0x1E6,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {11668, 5449, 0, 0, 0x1E6,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11700, 5449, 0, 0, 0x1E6,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {11729, 5449, 0, 0, 0x1E6,0x49,0,0,EVENT_OPTION_NONE_MASK}
+, {11759, 5449, 0, 0, 0x1E6,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {11790, 5449, 0, 0, 0x1E6,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {11822, 5449, 0, 0, 0x1E6,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {11851, 5449, 0, 0, 0x1E6,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {11881, 5449, 0, 0, 0x1E6,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {11912, 5449, 0, 0, 0x1E6,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11944, 5449, 0, 0, 0x1E6,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {11973, 5449, 0, 0, 0x1E6,0x89,0,0,EVENT_OPTION_NONE_MASK}
+, {12003, 5449, 0, 0, 0x1E6,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {12034, 5449, 0, 0, 0x1E6,0x8C,0,0,EVENT_OPTION_NONE_MASK}
+, {12066, 5449, 0, 0, 0x1E6,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {12095, 5449, 0, 0, 0x1E7,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12126, 5449, 0, 0, 0x1E7,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {12158, 5449, 0, 0, 0x1E7,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {12191, 5449, 0, 0, 0x1E7,0x17,0,0,EVENT_OPTION_NONE_MASK}
+, {12221, 5449, 0, 0, 0x1E7,0x19,0,0,EVENT_OPTION_NONE_MASK}
+, {12252, 5449, 0, 0, 0x1E7,0x1A,0,0,EVENT_OPTION_NONE_MASK}
+, {12284, 5449, 0, 0, 0x1E7,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {12317, 5449, 0, 0, 0x1E7,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {12347, 5449, 0, 0, 0x1E7,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12378, 5449, 0, 0, 0x1E7,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12410, 5449, 0, 0, 0x1E7,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12443, 5449, 0, 0, 0x1E7,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {12473, 5449, 0, 0, 0x1E7,0x29,0,0,EVENT_OPTION_NONE_MASK}
+, {12504, 5449, 0, 0, 0x1E7,0x2A,0,0,EVENT_OPTION_NONE_MASK}
+, {12536, 5449, 0, 0, 0x1E7,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {12569, 5449, 0, 0, 0x1E7,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {12599, 5449, 0, 0, 0x1E7,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12630, 5449, 0, 0, 0x1E7,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {12662, 5449, 0, 0, 0x1E7,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12695, 5449, 0, 0, 0x1E7,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {12725, 5449, 0, 0, 0x1E7,0x49,0,0,EVENT_OPTION_NONE_MASK}
+, {12756, 5449, 0, 0, 0x1E7,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {12788, 5449, 0, 0, 0x1E7,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {12821, 5449, 0, 0, 0x1E7,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {12851, 5449, 0, 0, 0x1E7,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12882, 5449, 0, 0, 0x1E7,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {12914, 5449, 0, 0, 0x1E7,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12947, 5449, 0, 0, 0x1E7,0x87,0,0,EVENT_OPTION_NONE_MASK}
+, {12977, 5449, 0, 0, 0x1E7,0x89,0,0,EVENT_OPTION_NONE_MASK}
+, {13008, 5449, 0, 0, 0x1E7,0x8A,0,0,EVENT_OPTION_NONE_MASK}
+, {13040, 5449, 0, 0, 0x1E7,0x8C,0,0,EVENT_OPTION_NONE_MASK}
+, {13073, 5449, 0, 0, 0x1E7,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {13103, 5449, 0, 0, 0x1EB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13126, 5449, 0, 0, 0x1EB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13149, 5449, 0, 0, 0x1EB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13176, 5449, 0, 0, 0x1EB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13199, 5449, 0, 0, 0x1EB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13225, 5449, 0, 0, 0x1EB,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13259, 5449, 0, 0, 0x1EB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13297, 5449, 0, 0, 0x1EB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13331, 5449, 0, 0, 0x1F0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13376, 5449, 0, 0, 0x1F0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13420, 5449, 0, 0, 0x1F0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13468, 5449, 0, 0, 0x1F0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13515, 5449, 0, 0, 0x1F0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13562, 5449, 0, 0, 0x1F0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13608, 5449, 0, 0, 0x1F0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13654, 5449, 0, 0, 0x1F0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13702, 5449, 0, 0, 0x3EC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13732, 5449, 0, 0, 0x3EC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13763, 5449, 0, 0, 0x3EC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13798, 5449, 0, 0, 0x3EC,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {13825, 5449, 0, 0, 0x3EC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13855, 5449, 0, 0, 0x3EC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13886, 5449, 0, 0, 0x3EC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13921, 5449, 0, 0, 0x3EC,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {13948, 5449, 0, 0, 0x3ED,0x1,0,0,EVENT_OPTION_NONE_MASK}
+, {13993, 5449, 0, 0, 0x3ED,0x2,0,0,EVENT_OPTION_NONE_MASK}
+, {14038, 5449, 0, 0, 0x3EE,0x1,0,0,EVENT_OPTION_NONE_MASK}
+, {14083, 5449, 0, 0, 0x3EE,0x2,0,0,EVENT_OPTION_NONE_MASK}
+, {14128, 5449, 0, 0, 0x3EF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14168, 5449, 0, 0, 0x3EF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14217, 5449, 0, 0, 0x3EF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14266, 5449, 0, 0, 0x3EF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14306, 5449, 0, 0, 0x3EF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14355, 5449, 0, 0, 0x3EF,0x20,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable kabini_arch_events = {
+    NUM_ARCH_EVENTS_KABINI,
+    kabini_arch_event_strings,
+    kabini_arch_event_options,
+    kabini_arch_event_entries
+};
@@ -0,0 +1,1405 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_KNL 678
+
+static const char knl_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "INST_RETIRED_ANY\0"
+    "PMC\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_MS\0"
+    "UOPS_RETIRED_X87\0"
+    "UOPS_RETIRED_MUL\0"
+    "UOPS_RETIRED_DIV\0"
+    "UOPS_RETIRED_STALLED_CYCLES\0"
+    "UOPS_RETIRED_STALLS\0"
+    "UOPS_RETIRED_SCALAR_SIMD\0"
+    "UOPS_RETIRED_PACKED_SIMD\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_MS_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_MS_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_MUL_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_MUL_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_SCALAR_SIMD_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_SCALAR_SIMD_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_PACKED_SIMD_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_PACKED_SIMD_CYCLES_GE_2_UOPS_EXEC\0"
+    "MEM_UOPS_RETIRED_L1_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_L2_HIT_LOADS\0"
+    "MEM_UOPS_RETIRED_L2_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_L2_LOADS_ANY\0"
+    "MEM_UOPS_RETIRED_DTLB_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_UTLB_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_HITM\0"
+    "MEM_UOPS_RETIRED_ALL_LOADS\0"
+    "MEM_UOPS_RETIRED_ALL_STORES\0"
+    "RECYCLEQ_LD_BLOCK_ST_FORWARD\0"
+    "RECYCLEQ_LD_BLOCK_STD_NOTREADY\0"
+    "RECYCLEQ_ST_SPLITS\0"
+    "RECYCLEQ_LD_SPLITS\0"
+    "RECYCLEQ_LOCK\0"
+    "RECYCLEQ_STA_FULL\0"
+    "RECYCLEQ_ANY_LD\0"
+    "RECYCLEQ_ANY_ST\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_JCC\0"
+    "BR_INST_RETIRED_TAKEN_JCC\0"
+    "BR_INST_RETIRED_NON_RETURN_IND\0"
+    "BR_INST_RETIRED_RETURN\0"
+    "BR_INST_RETIRED_IND_CALL\0"
+    "BR_INST_RETIRED_CALL\0"
+    "BR_INST_RETIRED_REL_CALL\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_JCC\0"
+    "BR_MISP_RETIRED_TAKEN_JCC\0"
+    "BR_MISP_RETIRED_NON_RETURN_IND\0"
+    "BR_MISP_RETIRED_RETURN\0"
+    "BR_MISP_RETIRED_IND_CALL\0"
+    "BR_MISP_RETIRED_CALL\0"
+    "BR_MISP_RETIRED_REL_CALL\0"
+    "BR_MISP_RETIRED_FAR_BRANCH\0"
+    "NO_ALLOC_CYCLES_ROB_FULL\0"
+    "NO_ALLOC_CYCLES_ROB_FULL_COUNT\0"
+    "NO_ALLOC_CYCLES_MISPREDICTS\0"
+    "NO_ALLOC_CYCLES_MISPREDICTS_COUNT\0"
+    "NO_ALLOC_CYCLES_RAT_STALL\0"
+    "NO_ALLOC_CYCLES_RAT_STALL_COUNT\0"
+    "NO_ALLOC_CYCLES_ALL\0"
+    "NO_ALLOC_CYCLES_ALL_COUNT\0"
+    "NO_ALLOC_CYCLES_NOT_DELIVERED\0"
+    "NO_ALLOC_CYCLES_NOT_DELIVERED_COUNT\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "L2_REQUESTS_REJECT_ALL\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_REQUESTS_MISS\0"
+    "L2_REQUESTS_REFERENCE\0"
+    "CPU_CLK_UNHALTED_THREAD_P\0"
+    "BACLEARS_ALL\0"
+    "BACLEARS_RETURN\0"
+    "BACLEARS_COND\0"
+    "PAGE_WALKS_DTLB_COUNT\0"
+    "PAGE_WALKS_DTLB_CYCLES\0"
+    "PAGE_WALKS_ITLB_COUNT\0"
+    "PAGE_WALKS_ITLB_CYCLES\0"
+    "PAGE_WALKS_COUNT\0"
+    "PAGE_WALKS_CYCLES\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_FP_ASSIST\0"
+    "MACHINE_CLEARS_ALL\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "RS_FULL_STALL_MEC\0"
+    "RS_FULL_STALL_MEC_COUNT\0"
+    "RS_FULL_STALL_ALL\0"
+    "RS_FULL_STALL_ALL_COUNT\0"
+    "CYCLES_DIV_BUSY\0"
+    "CYCLES_DIV_BUSY_COUNT\0"
+    "CORE_REJECT_L2Q_ALL\0"
+    "FETCH_STALL_ICACHE_FILL_PENDING_CYCLES\0"
+    "FETCH_STALL_ICACHE_FILL_PENDING_COUNT\0"
+    "MS_DECODED_MS_ENTRY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WRITEBACK_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_READ_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_WRITE_ANY\0"
+    "OFFCORE_RESPONSE_0_UC_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_0_FULL_STRM_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_SW_PREFETCH_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L1_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_STRM_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_ANY_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WRITEBACK_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_READ_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_WRITE_ANY\0"
+    "OFFCORE_RESPONSE_1_UC_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_1_FULL_STRM_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_SW_PREFETCH_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L1_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_STRM_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_ANY_ANY\0"
+    "MCDRAM_CLOCKTICKS\0"
+    "EDBOX0FIX|EDBOX1FIX|EDBOX2FIX|EDBOX3FIX|EDBOX4FIX|EDBOX5FIX|EDBOX6FIX|EDBOX7FIX\0"
+    "EDC_CLOCKTICKS\0"
+    "EUBOX0FIX|EUBOX1FIX|EUBOX2FIX|EUBOX3FIX|EUBOX4FIX|EUBOX5FIX|EUBOX6FIX|EUBOX7FIX\0"
+    "EDC_UCLK\0"
+    "EUBOX0|EUBOX1|EUBOX2|EUBOX3|EUBOX4|EUBOX5|EUBOX6|EUBOX7\0"
+    "EDC_HIT_CLEAN\0"
+    "EDC_HIT_DIRTY\0"
+    "EDC_MISS_CLEAN\0"
+    "EDC_MISS_DIRTY\0"
+    "EDC_MISS_INVALID\0"
+    "EDC_ECLK\0"
+    "EDBOX0|EDBOX1|EDBOX2|EDBOX3|EDBOX4|EDBOX5|EDBOX6|EDBOX7\0"
+    "EDC_RPQ_INSERTS\0"
+    "EDC_WPQ_INSERTS\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX4FIX|MBOX5FIX|MBOX6FIX\0"
+    "IMC_CLOCKTICKS\0"
+    "MBOX3FIX|MBOX7FIX\0"
+    "MC_UCLK\0"
+    "MBOX3|MBOX7\0"
+    "MC_DCLK\0"
+    "MBOX0|MBOX1|MBOX2|MBOX4|MBOX5|MBOX6\0"
+    "MC_CAS_READS\0"
+    "MC_CAS_WRITES\0"
+    "MC_CAS_ALL\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "INGRESS_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0|CBOX18C0|CBOX19C0|CBOX20C0|CBOX21C0|CBOX22C0|CBOX23C0|CBOX24C0|CBOX25C0|CBOX26C0|CBOX27C0|CBOX28C0|CBOX29C0|CBOX30C0|CBOX31C0|CBOX32C0|CBOX33C0|CBOX34C0|CBOX35C0|CBOX36C0|CBOX37C0\0"
+    "INGRESS_OCCUPANCY_IRQ_REJ\0"
+    "INGRESS_OCCUPANCY_IPQ\0"
+    "INGRESS_OCCUPANCY_PRQ\0"
+    "INGRESS_OCCUPANCY_PRQ_REJ\0"
+    "INGRESS_INSERTS_IRQ\0"
+    "INGRESS_INSERTS_IRQ_REJ\0"
+    "INGRESS_INSERTS_IPQ\0"
+    "INGRESS_INSERTS_PRQ\0"
+    "INGRESS_INSERTS_PRQ_REJ\0"
+    "INGRESS_INT_STARVED_IRQ\0"
+    "INGRESS_INT_STARVED_IPQ\0"
+    "INGRESS_INT_STARVED_ISMQ\0"
+    "INGRESS_INT_STARVED_PRQ\0"
+    "INGRESS_IRQ0_REJECT_AD_REQ_VN0\0"
+    "INGRESS_IRQ0_REJECT_BL_NCS_VN0\0"
+    "INGRESS_IRQ0_REJECT_AK_NON_UPI\0"
+    "INGRESS_IRQ0_REJECT_IV_NON_UPI\0"
+    "INGRESS_IRQ1_REJECT_ANY_REJECT_IRQ0\0"
+    "INGRESS_IRQ1_REJECT_SF_VICTIM\0"
+    "INGRESS_IRQ1_REJECT_SF_WAY\0"
+    "INGRESS_IRQ1_REJECT_PA_MATCH\0"
+    "INGRESS_PRQ0_REJECT_AD_REQ_VN0\0"
+    "INGRESS_PRQ0_REJECT_AK_NON_UPI\0"
+    "INGRESS_PRQ0_REJECT_IV_NON_UPI\0"
+    "INGRESS_PRQ1_REJECT_ANY_REJECT_IRQ0\0"
+    "INGRESS_PRQ1_REJECT_SF_VICTIM\0"
+    "INGRESS_PRQ1_REJECT_SF_WAY\0"
+    "INGRESS_PRQ1_REJECT_PA_MATCH\0"
+    "INGRESS_IPQ0_REJECT_AD_REQ_VN0\0"
+    "INGRESS_IPQ0_REJECT_AD_RSP_VN0\0"
+    "INGRESS_IPQ0_REJECT_BL_RSP_VN0\0"
+    "INGRESS_IPQ0_REJECT_BL_WB_VN0\0"
+    "INGRESS_IPQ0_REJECT_BL_NCB_VN0\0"
+    "INGRESS_IPQ0_REJECT_BL_NCS_VN0\0"
+    "INGRESS_IPQ0_REJECT_AK_NON_UPI\0"
+    "INGRESS_IPQ1_REJECT_ANY_REJECT_IPQ0\0"
+    "INGRESS_IPQ1_REJECT_SF_VICTIM\0"
+    "INGRESS_IPQ1_REJECT_SF_WAY\0"
+    "INGRESS_IPQ1_REJECT_ALLOW_SNP\0"
+    "INGRESS_IPQ1_REJECT_PA_MATCH\0"
+    "INGRESS_ISMQ0_REJECT_AD_REQ_VN0\0"
+    "INGRESS_ISMQ0_REJECT_AD_RSP_VN0\0"
+    "INGRESS_ISMQ0_REJECT_BL_RSP_VN0\0"
+    "INGRESS_ISMQ0_REJECT_BL_WB_VN0\0"
+    "INGRESS_ISMQ0_REJECT_BL_NCB_VN0\0"
+    "INGRESS_ISMQ0_REJECT_BL_NCS_VN0\0"
+    "INGRESS_ISMQ0_REJECT_AK_NON_UPI\0"
+    "INGRESS_ISMQ0_REJECT_IV_NON_UPI\0"
+    "INGRESS_REQ_Q0_RETRY_AD_REQ_VN0\0"
+    "INGRESS_REQ_Q0_RETRY_AD_RSP_VN0\0"
+    "INGRESS_REQ_Q0_RETRY_BL_NCS_VN0\0"
+    "INGRESS_REQ_Q0_RETRY_AK_NON_UPI\0"
+    "INGRESS_REQ_Q0_RETRY_IV_NON_UPI\0"
+    "INGRESS_Q1_REJECT_ANY_REJECT_IPQ0\0"
+    "INGRESS_Q1_REJECT_SF_VICTIM\0"
+    "INGRESS_Q1_REJECT_SF_WAY\0"
+    "INGRESS_Q1_REJECT_ALLOW_SNP\0"
+    "INGRESS_Q1_REJECT_PA_MATCH\0"
+    "INGRESS_ISMQ0_RETRY_AD_REQ_VN0\0"
+    "INGRESS_ISMQ0_RETRY_AD_RSP_VN0\0"
+    "INGRESS_ISMQ0_RETRY_BL_RSP_VN0\0"
+    "INGRESS_ISMQ0_RETRY_BL_WB_VN0\0"
+    "INGRESS_ISMQ0_RETRY_BL_NCB_VN0\0"
+    "INGRESS_ISMQ0_RETRY_BL_NCS_VN0\0"
+    "INGRESS_ISMQ0_RETRY_AK_NON_UPI\0"
+    "INGRESS_ISMQ0_RETRY_IV_NON_UPI\0"
+    "INGRESS_OTHER0_RETRY_AD_REQ_VN0\0"
+    "INGRESS_OTHER0_RETRY_AD_RSP_VN0\0"
+    "INGRESS_OTHER0_RETRY_BL_RSP_VN0\0"
+    "INGRESS_OTHER0_RETRY_BL_WB_VN0\0"
+    "INGRESS_OTHER0_RETRY_BL_NCB_VN0\0"
+    "INGRESS_OTHER0_RETRY_BL_NCS_VN0\0"
+    "INGRESS_OTHER0_RETRY_AK_NON_UPI\0"
+    "INGRESS_OTHER0_RETRY_IV_NON_UPI\0"
+    "INGRESS_OTHER1_RETRY_ANY_REJECT_IPQ0\0"
+    "INGRESS_OTHER1_RETRY_SF_VICTIM\0"
+    "INGRESS_OTHER1_RETRY_SF_WAY\0"
+    "INGRESS_OTHER1_RETRY_ALLOW_SNP\0"
+    "INGRESS_OTHER1_RETRY_PA_MATCH\0"
+    "SF_LOOKUP_DATA_READ\0"
+    "SF_LOOKUP_WRITE\0"
+    "SF_LOOKUP_REMOTE_SNOOP\0"
+    "SF_LOOKUP_ANY\0"
+    "COUNTER0_OCCUPANCY\0"
+    "TOR_INSERTS_IRQ\0"
+    "TOR_INSERTS_IRQ_HIT\0"
+    "TOR_INSERTS_IRQ_MISS\0"
+    "TOR_INSERTS_EVICT\0"
+    "TOR_INSERTS_PRQ\0"
+    "TOR_INSERTS_PRQ_HIT\0"
+    "TOR_INSERTS_PRQ_MISS\0"
+    "TOR_INSERTS_IPQ\0"
+    "TOR_INSERTS_IPQ_HIT\0"
+    "TOR_INSERTS_IPQ_MISS\0"
+    "TOR_INSERTS_HIT\0"
+    "TOR_INSERTS_MISS\0"
+    "TOR_OCCUPANCY_IRQ\0"
+    "TOR_OCCUPANCY_IRQ_HIT\0"
+    "TOR_OCCUPANCY_IRQ_MISS\0"
+    "TOR_OCCUPANCY_EVICT\0"
+    "TOR_OCCUPANCY_PRQ\0"
+    "TOR_OCCUPANCY_PRQ_HIT\0"
+    "TOR_OCCUPANCY_PRQ_MISS\0"
+    "TOR_OCCUPANCY_IPQ\0"
+    "TOR_OCCUPANCY_IPQ_HIT\0"
+    "TOR_OCCUPANCY_IPQ_MISS\0"
+    "TOR_OCCUPANCY_HIT\0"
+    "TOR_OCCUPANCY_MISS\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CV0_PREF_VIC\0"
+    "MISC_CV0_PREF_MISS\0"
+    "UCLK\0"
+    "AG0_AD_CRD_ACQUIRED_TGR0\0"
+    "AG0_AD_CRD_ACQUIRED_TGR1\0"
+    "AG0_AD_CRD_ACQUIRED_TGR2\0"
+    "AG0_AD_CRD_ACQUIRED_TGR3\0"
+    "AG0_AD_CRD_ACQUIRED_TGR4\0"
+    "AG0_AD_CRD_ACQUIRED_TGR5\0"
+    "AG0_AD_CRD_ACQUIRED_TGR6\0"
+    "AG0_AD_CRD_ACQUIRED_TGR7\0"
+    "AG0_AD_CRD_ACQUIRED_EXT_TGR8\0"
+    "AG0_AD_CRD_ACQUIRED_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_AD_CRD_ACQUIRED_EXT_ANY\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR6\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR7\0"
+    "AG0_AD_CRD_OCCUPANCY_EXT_TGR8\0"
+    "AG0_AD_CRD_OCCUPANCY_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_AD_CRD_OCCUPANCY_EXT_ANY\0"
+    "AG1_AD_CRD_ACQUIRED_TGR0\0"
+    "AG1_AD_CRD_ACQUIRED_TGR1\0"
+    "AG1_AD_CRD_ACQUIRED_TGR2\0"
+    "AG1_AD_CRD_ACQUIRED_TGR3\0"
+    "AG1_AD_CRD_ACQUIRED_TGR4\0"
+    "AG1_AD_CRD_ACQUIRED_TGR5\0"
+    "AG1_AD_CRD_ACQUIRED_TGR6\0"
+    "AG1_AD_CRD_ACQUIRED_TGR7\0"
+    "AG1_AD_CRD_ACQUIRED_EXT_TGR8\0"
+    "AG1_AD_CRD_ACQUIRED_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_AD_CRD_ACQUIRED_EXT_ANY\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR6\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR7\0"
+    "AG1_AD_CRD_OCCUPANCY_EXT_TGR8\0"
+    "AG1_AD_CRD_OCCUPANCY_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_AD_CRD_OCCUPANCY_EXT_ANY\0"
+    "AG0_BL_CRD_ACQUIRED_TGR0\0"
+    "AG0_BL_CRD_ACQUIRED_TGR1\0"
+    "AG0_BL_CRD_ACQUIRED_TGR2\0"
+    "AG0_BL_CRD_ACQUIRED_TGR3\0"
+    "AG0_BL_CRD_ACQUIRED_TGR4\0"
+    "AG0_BL_CRD_ACQUIRED_TGR5\0"
+    "AG0_BL_CRD_ACQUIRED_TGR6\0"
+    "AG0_BL_CRD_ACQUIRED_TGR7\0"
+    "AG0_BL_CRD_ACQUIRED_EXT_TGR8\0"
+    "AG0_BL_CRD_ACQUIRED_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_BL_CRD_ACQUIRED_EXT_ANY\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR5\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR6\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR7\0"
+    "AG0_BL_CRD_OCCUPANCY_EXT_TGR8\0"
+    "AG0_BL_CRD_OCCUPANCY_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_BL_CRD_OCCUPANCY_EXT_ANY\0"
+    "AG1_BL_CRD_ACQUIRED_TGR0\0"
+    "AG1_BL_CRD_ACQUIRED_TGR1\0"
+    "AG1_BL_CRD_ACQUIRED_TGR2\0"
+    "AG1_BL_CRD_ACQUIRED_TGR3\0"
+    "AG1_BL_CRD_ACQUIRED_TGR4\0"
+    "AG1_BL_CRD_ACQUIRED_TGR5\0"
+    "AG1_BL_CRD_ACQUIRED_TGR6\0"
+    "AG1_BL_CRD_ACQUIRED_TGR7\0"
+    "AG1_BL_CRD_ACQUIRED_EXT_TGR8\0"
+    "AG1_BL_CRD_ACQUIRED_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_BL_CRD_ACQUIRED_EXT_ANY\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR5\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR6\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR7\0"
+    "AG1_BL_CRD_OCCUPANCY_EXT_TGR8\0"
+    "AG1_BL_CRD_OCCUPANCY_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_BL_CRD_OCCUPANCY_EXT_ANY\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR0\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR1\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR2\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR3\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR4\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR5\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR6\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_TGR7\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_TGR8\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_ANY\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR0\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR1\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR2\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR3\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR4\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR5\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR6\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_TGR7\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_TGR8\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_AD_EXT_ANY\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR0\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR1\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR2\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR3\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR4\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR5\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR6\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_TGR7\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_TGR8\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG0_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_ANY\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR0\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR1\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR2\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR3\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR4\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR5\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR6\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_TGR7\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_TGR8\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_ANY_OF_TGR0_THRU_TGR7\0"
+    "AG1_STALL_NO_CRD_EGRESS_HORZ_BL_EXT_ANY\0"
+    "EGRESS_VERT_OCCUPANCY_AD_AG0\0"
+    "EGRESS_VERT_OCCUPANCY_AK_AG0\0"
+    "EGRESS_VERT_OCCUPANCY_BL_AG0\0"
+    "EGRESS_VERT_OCCUPANCY_IV_AG0\0"
+    "EGRESS_VERT_OCCUPANCY_AD_AG1\0"
+    "EGRESS_VERT_OCCUPANCY_AK_AG1\0"
+    "EGRESS_VERT_OCCUPANCY_BL_AG1\0"
+    "EGRESS_VERT_OCCUPANCY_AD\0"
+    "EGRESS_VERT_OCCUPANCY_AK\0"
+    "EGRESS_VERT_OCCUPANCY_BL\0"
+    "EGRESS_VERT_INSERTS_AD_AG0\0"
+    "EGRESS_VERT_INSERTS_AK_AG0\0"
+    "EGRESS_VERT_INSERTS_BL_AG0\0"
+    "EGRESS_VERT_INSERTS_IV_AG0\0"
+    "EGRESS_VERT_INSERTS_AD_AG1\0"
+    "EGRESS_VERT_INSERTS_AK_AG1\0"
+    "EGRESS_VERT_INSERTS_BL_AG1\0"
+    "EGRESS_VERT_INSERTS_AD\0"
+    "EGRESS_VERT_INSERTS_AK\0"
+    "EGRESS_VERT_INSERTS_BL\0"
+    "EGRESS_VERT_CYCLES_FULL_AD_AG0\0"
+    "EGRESS_VERT_CYCLES_FULL_AK_AG0\0"
+    "EGRESS_VERT_CYCLES_FULL_BL_AG0\0"
+    "EGRESS_VERT_CYCLES_FULL_IV_AG0\0"
+    "EGRESS_VERT_CYCLES_FULL_AD_AG1\0"
+    "EGRESS_VERT_CYCLES_FULL_AK_AG1\0"
+    "EGRESS_VERT_CYCLES_FULL_BL_AG1\0"
+    "EGRESS_VERT_CYCLES_FULL_AD\0"
+    "EGRESS_VERT_CYCLES_FULL_AK\0"
+    "EGRESS_VERT_CYCLES_FULL_BL\0"
+    "EGRESS_VERT_CYCLES_NE_AD_AG0\0"
+    "EGRESS_VERT_CYCLES_NE_AK_AG0\0"
+    "EGRESS_VERT_CYCLES_NE_BL_AG0\0"
+    "EGRESS_VERT_CYCLES_NE_IV_AG0\0"
+    "EGRESS_VERT_CYCLES_NE_AD_AG1\0"
+    "EGRESS_VERT_CYCLES_NE_AK_AG1\0"
+    "EGRESS_VERT_CYCLES_NE_BL_AG1\0"
+    "EGRESS_VERT_CYCLES_NE_AD\0"
+    "EGRESS_VERT_CYCLES_NE_AK\0"
+    "EGRESS_VERT_CYCLES_NE_BL\0"
+    "EGRESS_VERT_NACK_AD_AG0\0"
+    "EGRESS_VERT_NACK_AK_AG0\0"
+    "EGRESS_VERT_NACK_BL_AG0\0"
+    "EGRESS_VERT_NACK_IV_AG0\0"
+    "EGRESS_VERT_NACK_AD_AG1\0"
+    "EGRESS_VERT_NACK_AK_AG1\0"
+    "EGRESS_VERT_NACK_BL_AG1\0"
+    "EGRESS_VERT_NACK_AD\0"
+    "EGRESS_VERT_NACK_AK\0"
+    "EGRESS_VERT_NACK_BL\0"
+    "EGRESS_VERT_STARVED_AD_AG0\0"
+    "EGRESS_VERT_STARVED_AK_AG0\0"
+    "EGRESS_VERT_STARVED_BL_AG0\0"
+    "EGRESS_VERT_STARVED_IV_AG0\0"
+    "EGRESS_VERT_STARVED_AD_AG1\0"
+    "EGRESS_VERT_STARVED_AK_AG1\0"
+    "EGRESS_VERT_STARVED_BL_AG1\0"
+    "EGRESS_VERT_STARVED_AD\0"
+    "EGRESS_VERT_STARVED_AK\0"
+    "EGRESS_VERT_STARVED_BL\0"
+    "EGRESS_VERT_ADS_USED_AD_AG0\0"
+    "EGRESS_VERT_ADS_USED_AK_AG0\0"
+    "EGRESS_VERT_ADS_USED_BL_AG0\0"
+    "EGRESS_VERT_ADS_USED_AD_AG1\0"
+    "EGRESS_VERT_ADS_USED_AK_AG1\0"
+    "EGRESS_VERT_ADS_USED_BL_AG1\0"
+    "EGRESS_VERT_ADS_USED_AD\0"
+    "EGRESS_VERT_ADS_USED_AK\0"
+    "EGRESS_VERT_ADS_USED_BL\0"
+    "EGRESS_VERT_BYPASS_AD_AG0\0"
+    "EGRESS_VERT_BYPASS_AK_AG0\0"
+    "EGRESS_VERT_BYPASS_BL_AG0\0"
+    "EGRESS_VERT_BYPASS_IV_AG0\0"
+    "EGRESS_VERT_BYPASS_AD_AG1\0"
+    "EGRESS_VERT_BYPASS_AK_AG1\0"
+    "EGRESS_VERT_BYPASS_BL_AG1\0"
+    "EGRESS_VERT_BYPASS_AD\0"
+    "EGRESS_VERT_BYPASS_AK\0"
+    "EGRESS_VERT_BYPASS_BL\0"
+    "EGRESS_HORZ_OCCUPANCY_AD\0"
+    "EGRESS_HORZ_OCCUPANCY_AK\0"
+    "EGRESS_HORZ_OCCUPANCY_BL\0"
+    "EGRESS_HORZ_OCCUPANCY_IV\0"
+    "EGRESS_HORZ_INSERTS_AD\0"
+    "EGRESS_HORZ_INSERTS_AK\0"
+    "EGRESS_HORZ_INSERTS_BL\0"
+    "EGRESS_HORZ_INSERTS_IV\0"
+    "EGRESS_HORZ_CYCLES_FULL_AD\0"
+    "EGRESS_HORZ_CYCLES_FULL_AK\0"
+    "EGRESS_HORZ_CYCLES_FULL_BL\0"
+    "EGRESS_HORZ_CYCLES_FULL_IV\0"
+    "EGRESS_HORZ_CYCLES_NE_AD\0"
+    "EGRESS_HORZ_CYCLES_NE_AK\0"
+    "EGRESS_HORZ_CYCLES_NE_BL\0"
+    "EGRESS_HORZ_CYCLES_NE_IV\0"
+    "EGRESS_HORZ_NACK_AD\0"
+    "EGRESS_HORZ_NACK_AK\0"
+    "EGRESS_HORZ_NACK_BL\0"
+    "EGRESS_HORZ_NACK_IV\0"
+    "EGRESS_HORZ_STARVED_AD\0"
+    "EGRESS_HORZ_STARVED_AK\0"
+    "EGRESS_HORZ_STARVED_BL\0"
+    "EGRESS_HORZ_STARVED_IV\0"
+    "EGRESS_HORZ_ADS_USED_AD\0"
+    "EGRESS_HORZ_ADS_USED_AK\0"
+    "EGRESS_HORZ_ADS_USED_BL\0"
+    "EGRESS_HORZ_BYPASS_AD\0"
+    "EGRESS_HORZ_BYPASS_AK\0"
+    "EGRESS_HORZ_BYPASS_BL\0"
+    "EGRESS_HORZ_BYPASS_IV\0"
+    "RING_BOUNCES_VERT_AD\0"
+    "RING_BOUNCES_VERT_AK\0"
+    "RING_BOUNCES_VERT_BL\0"
+    "RING_BOUNCES_VERT_IV\0"
+    "RING_BOUNCES_HORZ_AD\0"
+    "RING_BOUNCES_HORZ_AK\0"
+    "RING_BOUNCES_HORZ_BL\0"
+    "RING_BOUNCES_HORZ_IV\0"
+    "RING_SINK_STARVED_VERT_AD\0"
+    "RING_SINK_STARVED_VERT_AK\0"
+    "RING_SINK_STARVED_VERT_BL\0"
+    "RING_SINK_STARVED_VERT_IV\0"
+    "RING_SINK_STARVED_HORZ_AD\0"
+    "RING_SINK_STARVED_HORZ_AK\0"
+    "RING_SINK_STARVED_HORZ_BL\0"
+    "RING_SINK_STARVED_HORZ_IV\0"
+    "RING_SRC_THRTL\0"
+    "FAST_ASSERTED_VERT\0"
+    "FAST_ASSERTED_HORZ\0"
+    "VERT_RING_AD_IN_USE_UP_EVEN\0"
+    "VERT_RING_AD_IN_USE_UP_ODD\0"
+    "VERT_RING_AD_IN_USE_UP\0"
+    "VERT_RING_AD_IN_USE_DN_EVEN\0"
+    "VERT_RING_AD_IN_USE_DN_ODD\0"
+    "VERT_RING_AD_IN_USE_DN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AD_IN_USE_LEFT\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AD_IN_USE_RIGHT\0"
+    "VERT_RING_AK_IN_USE_UP_EVEN\0"
+    "VERT_RING_AK_IN_USE_UP_ODD\0"
+    "VERT_RING_AK_IN_USE_UP\0"
+    "VERT_RING_AK_IN_USE_DN_EVEN\0"
+    "VERT_RING_AK_IN_USE_DN_ODD\0"
+    "VERT_RING_AK_IN_USE_DN\0"
+    "HORZ_RING_AK_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AK_IN_USE_LEFT\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AK_IN_USE_RIGHT\0"
+    "VERT_RING_BL_IN_USE_UP_EVEN\0"
+    "VERT_RING_BL_IN_USE_UP_ODD\0"
+    "VERT_RING_BL_IN_USE_UP\0"
+    "VERT_RING_BL_IN_USE_DN_EVEN\0"
+    "VERT_RING_BL_IN_USE_DN_ODD\0"
+    "VERT_RING_BL_IN_USE_DN\0"
+    "HORZ_RING_BL_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_BL_IN_USE_LEFT\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_BL_IN_USE_RIGHT\0"
+    "VERT_RING_IV_IN_USE_UP_EVEN\0"
+    "VERT_RING_IV_IN_USE_UP_ODD\0"
+    "VERT_RING_IV_IN_USE_UP\0"
+    "VERT_RING_IV_IN_USE_DN_EVEN\0"
+    "VERT_RING_IV_IN_USE_DN_ODD\0"
+    "VERT_RING_IV_IN_USE_DN\0"
+    "HORZ_RING_IV_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_IV_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_IV_IN_USE_LEFT\0"
+    "HORZ_RING_IV_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_IV_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_IV_IN_USE_RIGHT\0"
+    "EGRESS_ORDERING_IV_SNP_GO_UP\0"
+    "EGRESS_ORDERING_IV_SNP_GO_DN\0"
+    "TG_INGRESS_OCCUPANCY_AD_BNC\0"
+    "TG_INGRESS_OCCUPANCY_AK_BNC\0"
+    "TG_INGRESS_OCCUPANCY_BL_BNC\0"
+    "TG_INGRESS_OCCUPANCY_IV_BNC\0"
+    "TG_INGRESS_OCCUPANCY_AD_CRD\0"
+    "TG_INGRESS_OCCUPANCY_BL_CRD\0"
+    "TG_INGRESS_INSERTS_AD_BNC\0"
+    "TG_INGRESS_INSERTS_AK_BNC\0"
+    "TG_INGRESS_INSERTS_BL_BNC\0"
+    "TG_INGRESS_INSERTS_IV_BNC\0"
+    "TG_INGRESS_INSERTS_AD_CRD\0"
+    "TG_INGRESS_INSERTS_BL_CRD\0"
+    "TG_INGRESS_BYPASS_AD_BNC\0"
+    "TG_INGRESS_BYPASS_AK_BNC\0"
+    "TG_INGRESS_BYPASS_BL_BNC\0"
+    "TG_INGRESS_BYPASS_IV_BNC\0"
+    "TG_INGRESS_BYPASS_AD_CRD\0"
+    "TG_INGRESS_BYPASS_BL_CRD\0"
+    "TG_INGRESS_CRD_STARVED_AD_BNC\0"
+    "TG_INGRESS_CRD_STARVED_AK_BNC\0"
+    "TG_INGRESS_CRD_STARVED_BL_BNC\0"
+    "TG_INGRESS_CRD_STARVED_IV_BNC\0"
+    "TG_INGRESS_CRD_STARVED_AD_CRD\0"
+    "TG_INGRESS_CRD_STARVED_BL_CRD\0"
+    "TG_INGRESS_CRD_STARVED_IFV\0"
+    "TG_INGRESS_BUSY_STARVED_AD_BNC\0"
+    "TG_INGRESS_BUSY_STARVED_BL_BNC\0"
+    "TG_INGRESS_BUSY_STARVED_AD_CRD\0"
+    "TG_INGRESS_BUSY_STARVED_BL_CRD\0"
+    "RXR_CYCLES_NE_CBO_IDI\0"
+    "PBOX\0"
+    "RXR_CYCLES_NE_CBO_NCB\0"
+    "RXR_CYCLES_NE_CBO_NCS\0"
+    "RXR_CYCLES_NE_ALL\0"
+    "TXC_CYCLES_NE_AD_0\0"
+    "PBOX0|PBOX1\0"
+    "TXC_CYCLES_NE_AK_0\0"
+    "TXC_CYCLES_NE_BL_0\0"
+    "TXC_CYCLES_NE_AD_1\0"
+    "TXC_CYCLES_NE_AK_1\0"
+    "TXC_CYCLES_NE_BL_1\0"
+    "TXC_INSERTS_AD_0\0"
+    "TXC_INSERTS_AK_0\0"
+    "TXC_INSERTS_BL_0\0"
+    "TXC_INSERTS_AK_CRD_0\0"
+    "TXC_INSERTS_AD_1\0"
+    "TXC_INSERTS_AK_1\0"
+    "TXC_INSERTS_BL_1\0"
+    "TXC_INSERTS_AK_CRD_1\0"
+    "TXC_CYCLES_FULL_AD_0\0"
+    "TXC_CYCLES_FULL_AK_0\0"
+    "TXC_CYCLES_FULL_BL_0\0"
+    "TXC_CYCLES_FULL_AD_1\0"
+    "TXC_CYCLES_FULL_AK_1\0"
+    "TXC_CYCLES_FULL_BL_1\0"
+    "IO_CLKS_COUNT_ESEL\0"
+    "IBOX\0"
+    "BL_INGRESS_ALLOCATIONS_DRS_ESEL\0"
+    "BL_INGRESS_ALLOCATIONS_NCB_ESEL\0"
+    "BL_INGRESS_ALLOCATIONS_NCS_ESEL\0"
+    "BL_INGRESS_FULL_DRS_ESEL\0"
+    "BL_INGRESS_FULL_NCB_ESEL\0"
+    "BL_INGRESS_FULL_NCS_ESEL\0"
+    "BL_INGRESS_OCCUPANCY_DRS_ESEL\0"
+    "BL_INGRESS_OCCUPANCY_NCB_ESEL\0"
+    "BL_INGRESS_OCCUPANCY_NCS_ESEL\0"
+    "AK_INGRESS_ALLOCATIONS_ESEL\0"
+    "OUTBOUND_REQUESTS_REQUEST_Q_OCCUPANCY_ESEL\0"
+    "OUTBOUND_REQUESTS_REQUEST_Q_ALLOCATIONS_NCB_ESEL\0"
+    "OUTBOUND_REQUESTS_REQUEST_Q_ALLOCATIONS_NCS_ESEL\0"
+    "WRITE_CACHE_TOTAL_ESEL_ANY\0"
+    "WRITE_CACHE_TOTAL_ESEL_IV_Q\0"
+    "COHERENT_OP_ESEL_RDCUR\0"
+    "COHERENT_OP_ESEL_RFO\0"
+    "COHERENT_OP_ESEL_I2M\0"
+    "COHERENT_OP_ESEL_WBMTOI\0"
+    "COHERENT_OP_ESEL_CLFLUSH\0"
+    "TRANSACTIONS_COUNT_ESEL_READ_FETCH\0"
+    "TRANSACTIONS_COUNT_ESEL_WRITE_FETCH\0"
+    "TRANSACTIONS_COUNT_ESEL_WRITE_PREFETCH\0"
+    "TRANSACTIONS_COUNT_ESEL_ATOMIC\0"
+    "TRANSACTIONS_COUNT_ESEL_OTHER\0"
+    "TRANSACTIONS_COUNT_ESEL_SOURCE\0"
+    "SNOOP_RESPONSES_ESEL_IRPMISS\0"
+    "SNOOP_RESPONSES_ESEL_IRPHITI\0"
+    "SNOOP_RESPONSES_ESEL_IRPHITES\0"
+    "SNOOP_RESPONSES_ESEL_IRPHITM\0"
+    "SNOOP_RESPONSES_ESEL_SNPCODE\0"
+    "SNOOP_RESPONSES_ESEL_SNPDATA\0"
+    "SNOOP_RESPONSES_ESEL_SNPINV\0"
+    "STALL_CYCLES_AD_EGRESS_CREDITS_ESEL\0"
+    "STALL_CYCLES_BL_EGRESS_CREDITS_ESEL\0";
+
+static const PerfmonEventOption knl_arch_event_options[] = {
+ {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+};
+
+static const PerfmonEventEntry knl_arch_event_entries[NUM_ARCH_EVENTS_KNL] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 114, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 142, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 169, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {175, 192, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {196, 192, 0, 0, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {213, 192, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {229, 192, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {246, 192, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {263, 192, 0, 0, 0xC2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {280, 192, 0, 2, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {308, 192, 2, 3, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {328, 192, 0, 0, 0xC2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {353, 192, 0, 0, 0xC2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {378, 192, 5, 1, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {413, 192, 6, 1, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {448, 192, 5, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {486, 192, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {524, 192, 5, 1, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {563, 192, 6, 1, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {602, 192, 5, 1, 0xC2,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {649, 192, 6, 1, 0xC2,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {696, 192, 5, 1, 0xC2,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {743, 192, 6, 1, 0xC2,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {790, 192, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {821, 192, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {851, 192, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {882, 192, 0, 0, 0x04,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {912, 192, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {945, 192, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {978, 192, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1000, 192, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1027, 192, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1055, 192, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1084, 192, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1115, 192, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1134, 192, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1153, 192, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1167, 192, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1185, 192, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1201, 192, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1217, 192, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1246, 192, 0, 0, 0xC4,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1266, 192, 0, 0, 0xC4,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1292, 192, 0, 0, 0xC4,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1323, 192, 0, 0, 0xC4,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1346, 192, 0, 0, 0xC4,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1371, 192, 0, 0, 0xC4,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {1392, 192, 0, 0, 0xC4,0xFD,0,0,EVENT_OPTION_NONE_MASK}
+, {1417, 192, 0, 0, 0xC4,0xBF,0,0,EVENT_OPTION_NONE_MASK}
+, {1444, 192, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1473, 192, 0, 0, 0xC5,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1493, 192, 0, 0, 0xC5,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1519, 192, 0, 0, 0xC5,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1550, 192, 0, 0, 0xC5,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1573, 192, 0, 0, 0xC5,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1598, 192, 0, 0, 0xC5,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {1619, 192, 0, 0, 0xC5,0xFD,0,0,EVENT_OPTION_NONE_MASK}
+, {1644, 192, 0, 0, 0xC5,0xBF,0,0,EVENT_OPTION_NONE_MASK}
+, {1671, 192, 0, 0, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1696, 192, 7, 1, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1727, 192, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1755, 192, 7, 1, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1789, 192, 0, 0, 0xCA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1815, 192, 7, 1, 0xCA,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1847, 192, 0, 0, 0xCA,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {1867, 192, 7, 1, 0xCA,0x7F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1893, 192, 0, 0, 0xCA,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {1923, 192, 7, 1, 0xCA,0x90,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1959, 192, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1971, 192, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1985, 192, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2001, 192, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2024, 192, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2047, 192, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2075, 192, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2092, 192, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2114, 192, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 192, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2140, 192, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2153, 192, 0, 0, 0xE6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2169, 192, 0, 0, 0xE6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2183, 192, 8, 2, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2205, 192, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2228, 192, 8, 2, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2250, 192, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2273, 192, 8, 2, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2290, 192, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2308, 192, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2327, 192, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2358, 192, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2383, 192, 0, 0, 0xC3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2402, 192, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2434, 192, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2462, 192, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2494, 192, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2523, 192, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2541, 192, 7, 1, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2565, 192, 0, 0, 0xCB,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {2583, 192, 7, 1, 0xCB,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2607, 192, 0, 0, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2623, 192, 8, 2, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2645, 192, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2665, 192, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2704, 192, 8, 2, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2742, 192, 0, 0, 0xE7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2762, 192, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {2789, 192, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {2825, 192, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {2857, 192, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {2893, 192, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {2926, 192, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {2960, 192, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {2993, 192, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {3030, 192, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {3066, 192, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {3103, 192, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {3137, 192, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {3170, 192, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {3210, 192, 0, 0, 0xB7,0x01,0x0C,0x10,EVENT_OPTION_NONE_MASK}
+, {3245, 192, 0, 0, 0xB7,0x01,0x0D,0x10,EVENT_OPTION_NONE_MASK}
+, {3282, 192, 0, 0, 0xB7,0x01,0x0E,0x10,EVENT_OPTION_NONE_MASK}
+, {3325, 192, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {3352, 192, 0, 0, 0xB7,0x02,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {3379, 192, 0, 0, 0xB7,0x02,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {3415, 192, 0, 0, 0xB7,0x02,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {3447, 192, 0, 0, 0xB7,0x02,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {3483, 192, 0, 0, 0xB7,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {3516, 192, 0, 0, 0xB7,0x02,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {3550, 192, 0, 0, 0xB7,0x02,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {3583, 192, 0, 0, 0xB7,0x02,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {3620, 192, 0, 0, 0xB7,0x02,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {3656, 192, 0, 0, 0xB7,0x02,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {3693, 192, 0, 0, 0xB7,0x02,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {3727, 192, 0, 0, 0xB7,0x02,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {3760, 192, 0, 0, 0xB7,0x02,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {3800, 192, 0, 0, 0xB7,0x02,0x0C,0x10,EVENT_OPTION_NONE_MASK}
+, {3835, 192, 0, 0, 0xB7,0x02,0x0D,0x10,EVENT_OPTION_NONE_MASK}
+, {3872, 192, 0, 0, 0xB7,0x02,0x0E,0x10,EVENT_OPTION_NONE_MASK}
+, {3915, 192, 0, 0, 0xB7,0x02,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {3942, 3960, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4040, 4055, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4135, 4144, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4200, 4144, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4214, 4144, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4228, 4144, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4243, 4144, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4258, 4144, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4275, 4284, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4340, 4284, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4356, 4284, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4372, 4388, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4442, 4457, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4475, 4483, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4495, 4503, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4539, 4503, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4552, 4503, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4566, 4503, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4577, 4593, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4598, 4620, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4952, 4620, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4978, 4620, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5000, 4620, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5022, 4620, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5048, 4593, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5068, 4593, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5092, 4593, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5112, 4593, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5132, 4593, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5156, 4593, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5180, 4593, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5204, 4593, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5229, 4593, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5253, 4593, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5284, 4593, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5315, 4593, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5346, 4593, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5377, 4593, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5413, 4593, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5443, 4593, 0, 0, 0x19,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5470, 4593, 0, 0, 0x19,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5499, 4593, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5530, 4593, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5561, 4593, 0, 0, 0x20,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5592, 4593, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5628, 4593, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5658, 4593, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5685, 4593, 0, 0, 0x21,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5714, 4593, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5745, 4593, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5776, 4593, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5807, 4593, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5837, 4593, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5868, 4593, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5899, 4593, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5930, 4593, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5966, 4593, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5996, 4593, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6023, 4593, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6053, 4593, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6082, 4593, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6114, 4593, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6146, 4593, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6178, 4593, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6209, 4593, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6241, 4593, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6273, 4593, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6305, 4593, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6337, 4593, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6369, 4593, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6401, 4593, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6433, 4593, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6465, 4593, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6497, 4593, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6531, 4593, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6559, 4593, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6584, 4593, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6612, 4593, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6639, 4593, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6670, 4593, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6701, 4593, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6732, 4593, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6762, 4593, 0, 0, 0x2C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6793, 4593, 0, 0, 0x2C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6824, 4593, 0, 0, 0x2C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6855, 4593, 0, 0, 0x2C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6886, 4593, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6918, 4593, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6950, 4593, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6982, 4593, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7013, 4593, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7045, 4593, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7077, 4593, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7109, 4593, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7141, 4593, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7178, 4593, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7209, 4593, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7237, 4593, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7268, 4593, 0, 0, 0x2F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7298, 4593, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {7318, 4593, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {7334, 4593, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {7357, 4593, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7371, 4620, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7390, 4593, 0, 0, 0x35,0x31,0,0,EVENT_OPTION_NONE_MASK}
+, {7406, 4593, 0, 0, 0x35,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7426, 4593, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7447, 4593, 0, 0, 0x35,0x32,0,0,EVENT_OPTION_NONE_MASK}
+, {7465, 4593, 0, 0, 0x35,0x34,0,0,EVENT_OPTION_NONE_MASK}
+, {7481, 4593, 0, 0, 0x35,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {7501, 4593, 0, 0, 0x35,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {7522, 4593, 0, 0, 0x35,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {7538, 4593, 0, 0, 0x35,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7558, 4593, 0, 0, 0x35,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {7579, 4593, 0, 0, 0x35,0x1D,0,0,EVENT_OPTION_NONE_MASK}
+, {7595, 4593, 0, 0, 0x35,0x2D,0,0,EVENT_OPTION_NONE_MASK}
+, {7612, 4620, 0, 0, 0x36,0x31,0,0,EVENT_OPTION_NONE_MASK}
+, {7630, 4620, 0, 0, 0x36,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {7652, 4620, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {7675, 4620, 0, 0, 0x36,0x32,0,0,EVENT_OPTION_NONE_MASK}
+, {7695, 4620, 0, 0, 0x36,0x34,0,0,EVENT_OPTION_NONE_MASK}
+, {7713, 4620, 0, 0, 0x36,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {7735, 4620, 0, 0, 0x36,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {7758, 4620, 0, 0, 0x36,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {7776, 4620, 0, 0, 0x36,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7798, 4620, 0, 0, 0x36,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {7821, 4620, 0, 0, 0x36,0x1D,0,0,EVENT_OPTION_NONE_MASK}
+, {7839, 4620, 0, 0, 0x36,0x2D,0,0,EVENT_OPTION_NONE_MASK}
+, {7858, 4593, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7876, 4593, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7893, 4593, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7908, 4593, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7926, 4593, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7945, 4593, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7950, 4593, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7975, 4593, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8000, 4593, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8025, 4593, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8050, 4593, 0, 0, 0x80,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8075, 4593, 0, 0, 0x80,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8100, 4593, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8125, 4593, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8150, 4593, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8179, 4593, 0, 0, 0x81,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8225, 4593, 0, 0, 0x81,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8253, 4593, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8279, 4593, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8305, 4593, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8331, 4593, 0, 0, 0x82,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8357, 4593, 0, 0, 0x82,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8383, 4593, 0, 0, 0x82,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8409, 4593, 0, 0, 0x82,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8435, 4593, 0, 0, 0x82,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8461, 4593, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8491, 4593, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8538, 4593, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8567, 4593, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8592, 4593, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8617, 4593, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8642, 4593, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8667, 4593, 0, 0, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8692, 4593, 0, 0, 0x84,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8717, 4593, 0, 0, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8742, 4593, 0, 0, 0x84,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8767, 4593, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8796, 4593, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8842, 4593, 0, 0, 0x85,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8870, 4593, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8896, 4593, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8922, 4593, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8948, 4593, 0, 0, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8974, 4593, 0, 0, 0x86,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9000, 4593, 0, 0, 0x86,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9026, 4593, 0, 0, 0x86,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9052, 4593, 0, 0, 0x86,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9078, 4593, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9108, 4593, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9155, 4593, 0, 0, 0x87,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9184, 4593, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9209, 4593, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9234, 4593, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9259, 4593, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9284, 4593, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9309, 4593, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9334, 4593, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9359, 4593, 0, 0, 0x88,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9384, 4593, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9413, 4593, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9459, 4593, 0, 0, 0x89,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9487, 4593, 0, 0, 0x8A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9513, 4593, 0, 0, 0x8A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9539, 4593, 0, 0, 0x8A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9565, 4593, 0, 0, 0x8A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9591, 4593, 0, 0, 0x8A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9617, 4593, 0, 0, 0x8A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9643, 4593, 0, 0, 0x8A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9669, 4593, 0, 0, 0x8A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9695, 4593, 0, 0, 0x8B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9725, 4593, 0, 0, 0x8B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9772, 4593, 0, 0, 0x8B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9801, 4593, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9826, 4593, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9851, 4593, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9876, 4593, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9901, 4593, 0, 0, 0x8C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9926, 4593, 0, 0, 0x8C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9951, 4593, 0, 0, 0x8C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9976, 4593, 0, 0, 0x8C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10001, 4593, 0, 0, 0x8D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10030, 4593, 0, 0, 0x8D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10076, 4593, 0, 0, 0x8D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {10104, 4593, 0, 0, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10130, 4593, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10156, 4593, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10182, 4593, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10208, 4593, 0, 0, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10234, 4593, 0, 0, 0x8E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10260, 4593, 0, 0, 0x8E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10286, 4593, 0, 0, 0x8E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10312, 4593, 0, 0, 0x8F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10342, 4593, 0, 0, 0x8F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10389, 4593, 0, 0, 0x8F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {10418, 4593, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10455, 4593, 0, 0, 0xD0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10492, 4593, 0, 0, 0xD0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10529, 4593, 0, 0, 0xD0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10566, 4593, 0, 0, 0xD0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10603, 4593, 0, 0, 0xD0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10640, 4593, 0, 0, 0xD0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10677, 4593, 0, 0, 0xD0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10714, 4593, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10755, 4593, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10813, 4593, 0, 0, 0xD1,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {10853, 4593, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10890, 4593, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10927, 4593, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10964, 4593, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11001, 4593, 0, 0, 0xD2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11038, 4593, 0, 0, 0xD2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11075, 4593, 0, 0, 0xD2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11112, 4593, 0, 0, 0xD2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11149, 4593, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11190, 4593, 0, 0, 0xD3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11248, 4593, 0, 0, 0xD3,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {11288, 4593, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11325, 4593, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11362, 4593, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11399, 4593, 0, 0, 0xD4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11436, 4593, 0, 0, 0xD4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11473, 4593, 0, 0, 0xD4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11510, 4593, 0, 0, 0xD4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11547, 4593, 0, 0, 0xD4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {11584, 4593, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11625, 4593, 0, 0, 0xD5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11683, 4593, 0, 0, 0xD5,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {11723, 4593, 0, 0, 0xD6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11760, 4593, 0, 0, 0xD6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11797, 4593, 0, 0, 0xD6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11834, 4593, 0, 0, 0xD6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11871, 4593, 0, 0, 0xD6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11908, 4593, 0, 0, 0xD6,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11945, 4593, 0, 0, 0xD6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {11982, 4593, 0, 0, 0xD6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12019, 4593, 0, 0, 0xD7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12060, 4593, 0, 0, 0xD7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12118, 4593, 0, 0, 0xD7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {12158, 4593, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12187, 4593, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12216, 4593, 0, 0, 0x90,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12245, 4593, 0, 0, 0x90,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12274, 4593, 0, 0, 0x90,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12303, 4593, 0, 0, 0x90,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12332, 4593, 0, 0, 0x90,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12361, 4593, 0, 0, 0x90,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12386, 4593, 0, 0, 0x90,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12411, 4593, 0, 0, 0x90,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12436, 4593, 0, 0, 0x91,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12463, 4593, 0, 0, 0x91,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12490, 4593, 0, 0, 0x91,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12517, 4593, 0, 0, 0x91,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12544, 4593, 0, 0, 0x91,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12571, 4593, 0, 0, 0x91,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12598, 4593, 0, 0, 0x91,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12625, 4593, 0, 0, 0x91,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12648, 4593, 0, 0, 0x91,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12671, 4593, 0, 0, 0x91,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12694, 4593, 0, 0, 0x92,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12725, 4593, 0, 0, 0x92,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12756, 4593, 0, 0, 0x92,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12787, 4593, 0, 0, 0x92,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12818, 4593, 0, 0, 0x92,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12849, 4593, 0, 0, 0x92,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12880, 4593, 0, 0, 0x92,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12911, 4593, 0, 0, 0x92,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {12938, 4593, 0, 0, 0x92,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12965, 4593, 0, 0, 0x92,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12992, 4593, 0, 0, 0x93,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13021, 4593, 0, 0, 0x93,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13050, 4593, 0, 0, 0x93,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13079, 4593, 0, 0, 0x93,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13108, 4593, 0, 0, 0x93,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13137, 4593, 0, 0, 0x93,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13166, 4593, 0, 0, 0x93,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13195, 4593, 0, 0, 0x93,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {13220, 4593, 0, 0, 0x93,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13245, 4593, 0, 0, 0x93,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13270, 4593, 0, 0, 0x98,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13294, 4593, 0, 0, 0x98,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13318, 4593, 0, 0, 0x98,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13342, 4593, 0, 0, 0x98,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13366, 4593, 0, 0, 0x98,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13390, 4593, 0, 0, 0x98,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13414, 4593, 0, 0, 0x98,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13438, 4593, 0, 0, 0x98,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {13458, 4593, 0, 0, 0x98,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13478, 4593, 0, 0, 0x98,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13498, 4593, 0, 0, 0x9A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13525, 4593, 0, 0, 0x9A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13552, 4593, 0, 0, 0x9A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13579, 4593, 0, 0, 0x9A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13606, 4593, 0, 0, 0x9A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13633, 4593, 0, 0, 0x9A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13660, 4593, 0, 0, 0x9A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13687, 4593, 0, 0, 0x9A,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {13710, 4593, 0, 0, 0x9A,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13733, 4593, 0, 0, 0x9A,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13756, 4593, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13784, 4593, 0, 0, 0x9C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13812, 4593, 0, 0, 0x9C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13840, 4593, 0, 0, 0x9C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13868, 4593, 0, 0, 0x9C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13896, 4593, 0, 0, 0x9C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13924, 4593, 0, 0, 0x9C,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {13948, 4593, 0, 0, 0x9C,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13972, 4593, 0, 0, 0x9C,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {13996, 4593, 0, 0, 0x9E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14022, 4593, 0, 0, 0x9E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14048, 4593, 0, 0, 0x9E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14074, 4593, 0, 0, 0x9E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14100, 4593, 0, 0, 0x9E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14126, 4593, 0, 0, 0x9E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14152, 4593, 0, 0, 0x9E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14178, 4593, 0, 0, 0x9E,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {14200, 4593, 0, 0, 0x9E,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {14222, 4593, 0, 0, 0x9E,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {14244, 4593, 0, 0, 0x94,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14269, 4593, 0, 0, 0x94,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14294, 4593, 0, 0, 0x94,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14319, 4593, 0, 0, 0x94,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14344, 4593, 0, 0, 0x95,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14367, 4593, 0, 0, 0x95,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14390, 4593, 0, 0, 0x95,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14413, 4593, 0, 0, 0x95,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14436, 4593, 0, 0, 0x96,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14463, 4593, 0, 0, 0x96,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14490, 4593, 0, 0, 0x96,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14517, 4593, 0, 0, 0x96,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14544, 4593, 0, 0, 0x97,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14569, 4593, 0, 0, 0x97,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14594, 4593, 0, 0, 0x97,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14619, 4593, 0, 0, 0x97,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14644, 4593, 0, 0, 0x99,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14664, 4593, 0, 0, 0x99,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14684, 4593, 0, 0, 0x99,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14704, 4593, 0, 0, 0x99,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14724, 4593, 0, 0, 0x9B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14747, 4593, 0, 0, 0x9B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14770, 4593, 0, 0, 0x9B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14793, 4593, 0, 0, 0x9B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14816, 4593, 0, 0, 0x9D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14840, 4593, 0, 0, 0x9D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14864, 4593, 0, 0, 0x9D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14888, 4593, 0, 0, 0x9F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14910, 4593, 0, 0, 0x9F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14932, 4593, 0, 0, 0x9F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14954, 4593, 0, 0, 0x9F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14976, 4593, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14997, 4593, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15018, 4593, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15039, 4593, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15060, 4593, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15081, 4593, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15102, 4593, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15123, 4593, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15144, 4593, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15170, 4593, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15196, 4593, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15222, 4593, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15248, 4593, 0, 0, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15274, 4593, 0, 0, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15300, 4593, 0, 0, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15326, 4593, 0, 0, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15352, 4593, 0, 0, 0xA4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15367, 4593, 0, 0, 0xA5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15386, 4593, 0, 0, 0xA5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15405, 4593, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15433, 4593, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15460, 4593, 0, 0, 0xA6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15483, 4593, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15511, 4593, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15538, 4593, 0, 0, 0xA6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {15561, 4593, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15591, 4593, 0, 0, 0xA7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15620, 4593, 0, 0, 0xA7,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15645, 4593, 0, 0, 0xA7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15676, 4593, 0, 0, 0xA7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15706, 4593, 0, 0, 0xA7,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {15732, 4593, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15760, 4593, 0, 0, 0xA8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15787, 4593, 0, 0, 0xA8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15810, 4593, 0, 0, 0xA8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15838, 4593, 0, 0, 0xA8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15865, 4593, 0, 0, 0xA8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {15888, 4593, 0, 0, 0xA9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15918, 4593, 0, 0, 0xA9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15947, 4593, 0, 0, 0xA9,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {15972, 4593, 0, 0, 0xA9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16003, 4593, 0, 0, 0xA9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16033, 4593, 0, 0, 0xA9,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16059, 4593, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16087, 4593, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16114, 4593, 0, 0, 0xAA,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16137, 4593, 0, 0, 0xAA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16165, 4593, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16192, 4593, 0, 0, 0xAA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16215, 4593, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16245, 4593, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16274, 4593, 0, 0, 0xAB,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16299, 4593, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16330, 4593, 0, 0, 0xAB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16360, 4593, 0, 0, 0xAB,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16386, 4593, 0, 0, 0xAC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16414, 4593, 0, 0, 0xAC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16441, 4593, 0, 0, 0xAC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16464, 4593, 0, 0, 0xAC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16492, 4593, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16519, 4593, 0, 0, 0xAC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16542, 4593, 0, 0, 0xAD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16572, 4593, 0, 0, 0xAD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16601, 4593, 0, 0, 0xAD,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {16626, 4593, 0, 0, 0xAD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16657, 4593, 0, 0, 0xAD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16687, 4593, 0, 0, 0xAD,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {16713, 4593, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16742, 4593, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16771, 4593, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16799, 4593, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16827, 4593, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16855, 4593, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16883, 4593, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16911, 4593, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16939, 4593, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16965, 4593, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16991, 4593, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17017, 4593, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17043, 4593, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17069, 4593, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17095, 4593, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17120, 4593, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17145, 4593, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17170, 4593, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17195, 4593, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17220, 4593, 0, 0, 0xB2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17245, 4593, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17275, 4593, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17305, 4593, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17335, 4593, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17365, 4593, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17395, 4593, 0, 0, 0xB3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17425, 4593, 0, 0, 0xB3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17452, 4593, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17483, 4593, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17514, 4593, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17545, 4593, 0, 0, 0xB4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17576, 17598, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17603, 17598, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17625, 17598, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17647, 17598, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17665, 17684, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17696, 17684, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17715, 17684, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17734, 17684, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17753, 17684, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17772, 17684, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17791, 17598, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17808, 17598, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17825, 17598, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17842, 17598, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17863, 17598, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17880, 17598, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17897, 17598, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17914, 17598, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17935, 17598, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17956, 17598, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17977, 17598, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17998, 17598, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18019, 17598, 0, 0, 0x25,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18040, 17598, 0, 0, 0x25,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18061, 18080, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18085, 18080, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18117, 18080, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18149, 18080, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18181, 18080, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18206, 18080, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18231, 18080, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18256, 18080, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18286, 18080, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18316, 18080, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18346, 18080, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18374, 18080, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18417, 18080, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18466, 18080, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18515, 18080, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18542, 18080, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18570, 18080, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18593, 18080, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18614, 18080, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18635, 18080, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18659, 18080, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18684, 18080, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18719, 18080, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18755, 18080, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18794, 18080, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18825, 18080, 0, 0, 0x16,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18855, 18080, 0, 0, 0x16,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18886, 18080, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18915, 18080, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18944, 18080, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18974, 18080, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19003, 18080, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19032, 18080, 0, 0, 0x17,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19061, 18080, 0, 0, 0x17,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {19089, 18080, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19125, 18080, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable knl_arch_events = {
+    NUM_ARCH_EVENTS_KNL,
+    knl_arch_event_strings,
+    knl_arch_event_options,
+    knl_arch_event_entries
+};
@@ -0,0 +1,5283 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_NEHALEMEX 2623
+
+static const char nehalemEX_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "SB_FORWARD_ANY\0"
+    "PMC\0"
+    "LOAD_BLOCK_STD\0"
+    "LOAD_BLOCK_ADDRESS_OFFSET\0"
+    "SB_DRAIN_ANY\0"
+    "MISALIGN_MEM_REF_LOAD\0"
+    "MISALIGN_MEM_REF_STORE\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "STORE_BLOCK_NOT_STA\0"
+    "STORE_BLOCK_STA\0"
+    "STORE_BLOCK_AT_RET\0"
+    "STORE_BLOCK_L1D_BLOCK\0"
+    "STORE_BLOCK_ANY\0"
+    "PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_ANY\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_MISS\0"
+    "DTLB_LOAD_MISSES_PDP_MISS\0"
+    "DTLB_LOAD_MISSES_LARGE_WALK_COMPLETED\0"
+    "MEM_INST_RETIRED_LOADS\0"
+    "MEM_INST_RETIRED_STORES\0"
+    "MEM_INST_RETIRED_LATENCY_ABOVE_THRESHOLD\0"
+    "MEM_STORE_RETIRED_DTLB_MISS\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FUSED\0"
+    "MEM_UNCORE_RETIRED_OTHER_CORE_L2_HITM\0"
+    "MEM_UNCORE_RETIRED_REMOTE_CACHE_LOCAL_HOME_HIT\0"
+    "MEM_UNCORE_RETIRED_REMOTE_DRAM\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_MMX\0"
+    "FP_COMP_OPS_EXE_SSE_FP\0"
+    "FP_COMP_OPS_EXE_SSE2_INTEGER\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR\0"
+    "FP_COMP_OPS_EXE_SSE_SINGLE_PRECISION\0"
+    "FP_COMP_OPS_EXE_SSE_DOUBLE_PRECISION\0"
+    "SIMD_INT_128_PACKED_MPY\0"
+    "SIMD_INT_128_PACKED_SHIFT\0"
+    "SIMD_INT_128_PACK\0"
+    "SIMD_INT_128_UNPACK\0"
+    "SIMD_INT_128_PACKED_LOGICAL\0"
+    "SIMD_INT_128_PACKED_ARITH\0"
+    "SIMD_INT_128_SHUFFLE_MOVE\0"
+    "LOAD_DISPATCH_RS\0"
+    "LOAD_DISPATCH_RS_DELAYED\0"
+    "LOAD_DISPATCH_MOB\0"
+    "LOAD_DISPATCH_ANY\0"
+    "ARITH_CYCLES_DIV_BUSY\0"
+    "ARITH_NUM_DIV\0"
+    "ARITH_MUL\0"
+    "INST_QUEUE_WRITES\0"
+    "INST_DECODED_DECO\0"
+    "TWO_UPOS_INST_DECODED\0"
+    "HW_INT_RCV\0"
+    "HW_CYCLES_MASKED\0"
+    "HW_CYCLES_PENDING_AND_MASKED\0"
+    "INST_QUEUE_WRITE_CYCLES\0"
+    "LSD_OVERFLOW\0"
+    "L2_RQSTS_LD_HIT\0"
+    "L2_RQSTS_LD_MISS\0"
+    "L2_RQSTS_LOADS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFOS\0"
+    "L2_RQSTS_IFETCH_HIT\0"
+    "L2_RQSTS_IFETCH_MISS\0"
+    "L2_RQSTS_IFETCHES\0"
+    "L2_RQSTS_PREFETCH_HIT\0"
+    "L2_RQSTS_PREFETCH_MISS\0"
+    "L2_RQSTS_PREFETCHES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DATA_RQSTS_DEMAND_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_MESI\0"
+    "L2_DATA_RQSTS_ANY\0"
+    "L2_WRITE_RFO_I_STATE\0"
+    "L2_WRITE_RFO_S_STATE\0"
+    "L2_WRITE_RFO_E_STATE\0"
+    "L2_WRITE_RFO_M_STATE\0"
+    "L2_WRITE_RFO_HIT\0"
+    "L2_WRITE_RFO_MESI\0"
+    "L2_WRITE_LOCK_I_STATE\0"
+    "L2_WRITE_LOCK_S_STATE\0"
+    "L2_WRITE_LOCK_E_STATE\0"
+    "L2_WRITE_LOCK_M_STATE\0"
+    "L2_WRITE_LOCK_HIT\0"
+    "L2_WRITE_LOCK_MESI\0"
+    "L1D_WB_L2_I_STATE\0"
+    "L1D_WB_L2_S_STATE\0"
+    "L1D_WB_L2_E_STATE\0"
+    "L1D_WB_L2_M_STATE\0"
+    "L1D_WB_L2_MESI\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "UOPS_DECODED_DEC0\0"
+    "L1D_CACHE_LD_I_STATE\0"
+    "PMC0|PMC1\0"
+    "L1D_CACHE_LD_S_STATE\0"
+    "L1D_CACHE_LD_E_STATE\0"
+    "L1D_CACHE_LD_M_STATE\0"
+    "L1D_CACHE_LD_MESI\0"
+    "L1D_CACHE_ST_I_STATE\0"
+    "L1D_CACHE_ST_S_STATE\0"
+    "L1D_CACHE_ST_E_STATE\0"
+    "L1D_CACHE_ST_M_STATE\0"
+    "L1D_CACHE_ST_MESI\0"
+    "L1D_CACHE_LOCK_HIT\0"
+    "L1D_CACHE_LOCK_S_STATE\0"
+    "L1D_CACHE_LOCK_E_STATE\0"
+    "L1D_CACHE_LOCK_M_STATE\0"
+    "L1D_ALL_REF_ANY\0"
+    "L1D_ALL_REF_CACHEABLE\0"
+    "L1D_PEND_MISS_LOAD_BUFFERS_FULL\0"
+    "DTLB_MISSES_ANY\0"
+    "DTLB_MISSES_WALK_COMPLETED\0"
+    "DTLB_MISSES_STLB_HIT\0"
+    "DTLB_MISSES_PDE_MISS\0"
+    "DTLB_MISSES_PDP_MISS\0"
+    "DTLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "SSE_MEM_EXEC_NTA\0"
+    "SSE_MEM_EXEC_STREAMING_STORES\0"
+    "LOAD_HIT_PRE\0"
+    "SFENCE_CYCLES\0"
+    "L1D_PREFETCH_REQUESTS\0"
+    "L1D_PREFETCH_MISS\0"
+    "L1D_PREFETCH_TRIGGERS\0"
+    "EPT_EPDE_MISS\0"
+    "EPT_EPDPE_HIT\0"
+    "EPT_EPDPE_MISS\0"
+    "L1D_REPL\0"
+    "L1D_M_REPL\0"
+    "L1D_M_EVICT\0"
+    "L1D_M_SNOOP_EVICT\0"
+    "L1D_CACHE_PREFETCH_LOCK_FB_HIT\0"
+    "L1D_CACHE_LOCK_FB_HIT\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_DATA\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_CODE\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_EVENTS_OUTSTANDING_ANY_READ\0"
+    "CACHE_LOCK_CYCLES_L1D_L2\0"
+    "CACHE_LOCK_CYCLES_L1D\0"
+    "IO_TRANSACTIONS\0"
+    "L1I_HITS\0"
+    "L1I_MISSES\0"
+    "L1I_READS\0"
+    "L1I_CYCLES_STALLED\0"
+    "IFU_IVC_FULL\0"
+    "IFU_IVC_L1I_EVICTION\0"
+    "LARGE_ITLB_HIT\0"
+    "L1I_OPPORTUNISTIC_HITS\0"
+    "ITLB_MISSES_ANY\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_STALL_LCP\0"
+    "ITLB_STALL_MRU\0"
+    "ITLB_STALL_IQ_FULL\0"
+    "ITLB_STALL_REGEN\0"
+    "ITLB_STALL_ANY\0"
+    "BR_INST_EXEC_COND\0"
+    "BR_INST_EXEC_DIRECT\0"
+    "BR_INST_EXEC_INDIRECT_NON_CALL\0"
+    "BR_INST_EXEC_NON_CALLS\0"
+    "BR_INST_EXEC_RETURN_NEAR\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_NEAR_CALLS\0"
+    "BR_INST_EXEC_TAKEN\0"
+    "BR_INST_EXEC_ANY\0"
+    "BR_MISP_EXEC_COND\0"
+    "BR_MISP_EXEC_DIRECT\0"
+    "BR_MISP_EXEC_INDIRECT_NON_CALL\0"
+    "BR_MISP_EXEC_NON_CALLS\0"
+    "BR_MISP_EXEC_RETURN_NEAR\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_NEAR_CALLS\0"
+    "BR_MISP_EXEC_TAKEN\0"
+    "BR_MISP_EXEC_ANY\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LOAD\0"
+    "RESOURCE_STALLS_RS_FULL\0"
+    "RESOURCE_STALLS_STORE\0"
+    "RESOURCE_STALLS_ROB_FULL\0"
+    "RESOURCE_STALLS_FPCW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "MACRO_INSTS_FUSIONS_DECODED\0"
+    "BACLEAR_FORCE_IQ\0"
+    "LSD_UOPS\0"
+    "ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_L1D_WRITEBACK\0"
+    "UOPS_EXECUTED_PORT0\0"
+    "UOPS_EXECUTED_PORT1\0"
+    "UOPS_EXECUTED_PORT2_CORE\0"
+    "UOPS_EXECUTED_PORT3_CORE\0"
+    "UOPS_EXECUTED_PORT4_CORE\0"
+    "UOPS_EXECUTED_PORT5\0"
+    "UOPS_EXECUTED_PORT015\0"
+    "UOPS_EXECUTED_PORT234\0"
+    "OFFCORE_REQUESTS_SQ_FULL\0"
+    "SNOOP_RESPONSE_HIT\0"
+    "SNOOP_RESPONSE_HITE\0"
+    "SNOOP_RESPONSE_HITM\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_MMX\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_MACRO_FUSED\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEM_ORDER\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "SSEX_UOPS_RETIRED_PACKED_SINGLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_SINGLE\0"
+    "SSEX_UOPS_RETIRED_PACKED_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_VECTOR_INTEGER\0"
+    "ITLB_MISS_RETIRED\0"
+    "MEM_LOAD_RETIRED_L1D_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_UNSHARED_HIT\0"
+    "MEM_LOAD_RETIRED_OTHER_CORE_L2_HIT_HITM\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "FP_MMX_TRANS_TO_FP\0"
+    "FP_MMX_TRANS_TO_MMX\0"
+    "FP_MMX_TRANS_TO_ANY\0"
+    "MACRO_INSTS_DECODED\0"
+    "UOPS_DECODED_MS\0"
+    "UOPS_DECODED_ESP_FOLDING\0"
+    "UOPS_DECODED_ESP_SYNC\0"
+    "RAT_STALLS_FLAGS\0"
+    "RAT_STALLS_REGISTERS\0"
+    "RAT_STALLS_ROB_READ_PORT\0"
+    "RAT_STALLS_SCOREBOARD\0"
+    "RAT_STALLS_ANY\0"
+    "SEG_RENAME_STALLS\0"
+    "ES_SEG_RENAMES\0"
+    "UOP_UNFUSION\0"
+    "BR_INST_DECODED\0"
+    "BPU_MISSED_CALL_RET\0"
+    "BACLEAR_CLEAR\0"
+    "BACLEAR_BAD_TARGET\0"
+    "BPU_CLEARS_EARLY\0"
+    "BPU_CLEARS_LATE\0"
+    "BPU_CLEARS_ANY\0"
+    "L2_TRANSACTIONS_LOAD\0"
+    "L2_TRANSACTIONS_RFO\0"
+    "L2_TRANSACTIONS_IFETCH\0"
+    "L2_TRANSACTIONS_PREFETCH\0"
+    "L2_TRANSACTIONS_L1D_WB\0"
+    "L2_TRANSACTIONS_FILL\0"
+    "L2_TRANSACTIONS_WB\0"
+    "L2_TRANSACTIONS_ANY\0"
+    "L2_LINES_IN_S_STATE\0"
+    "L2_LINES_IN_E_STATE\0"
+    "L2_LINES_IN_ANY\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PREFETCH_CLEAN\0"
+    "L2_LINES_OUT_PREFETCH_DIRTY\0"
+    "L2_LINES_OUT_ANY\0"
+    "L2_HW_PREFETCH_HIT\0"
+    "L2_HW_PREFETCH_ALLOC\0"
+    "L2_HW_PREFETCH_DATA_TRIGGER\0"
+    "L2_HW_PREFETCH_CODE_TRIGGER\0"
+    "L2_HW_PREFETCH_DCA_TRIGGER\0"
+    "L2_HW_PREFETCH_KICK_START\0"
+    "SQ_MISC_PROMOTION\0"
+    "SQ_MISC_PROMOTION_POST_GO\0"
+    "SQ_MISC_LRU_HINTS\0"
+    "SQ_MISC_FILL_DROPPED\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "SQ_FULL_STALL_CYCLES\0"
+    "FP_ASSIST_ALL\0"
+    "FP_ASSIST_OUTPUT\0"
+    "FP_ASSIST_INPUT\0"
+    "SIMD_INT_64_PACKED_MPY\0"
+    "SIMD_INT_64_PACKED_SHIFT\0"
+    "SIMD_INT_64_PACK\0"
+    "SIMD_INT_64_UNPACK\0"
+    "SIMD_INT_64_PACKED_LOGICAL\0"
+    "SIMD_INT_64_PACKED_ARITH\0"
+    "SIMD_INT_64_SHUFFLE_MOVE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "UNCORE_CLOCK\0"
+    "WBOXFIX\0"
+    "C_CYCLES_TURBO_C0\0"
+    "WBOX\0"
+    "C_CYCLES_TURBO_C1\0"
+    "C_CYCLES_TURBO_C2\0"
+    "C_CYCLES_TURBO_C3\0"
+    "C_CYCLES_TURBO_C4\0"
+    "C_CYCLES_TURBO_C5\0"
+    "C_CYCLES_TURBO_C6\0"
+    "C_CYCLES_TURBO_C7\0"
+    "C_CYCLES_TURBO_C_ALL\0"
+    "C_C0_THROTTLE_DIE_C0\0"
+    "C_C0_THROTTLE_DIE_C1\0"
+    "C_C0_THROTTLE_DIE_C2\0"
+    "C_C0_THROTTLE_DIE_C3\0"
+    "C_C0_THROTTLE_DIE_C4\0"
+    "C_C0_THROTTLE_DIE_C5\0"
+    "C_C0_THROTTLE_DIE_C6\0"
+    "C_C0_THROTTLE_DIE_C7\0"
+    "C_C0_THROTTLE_DIE_C_ALL\0"
+    "C_C0_THROTTLE_PROCHOT_C0\0"
+    "C_C0_THROTTLE_PROCHOT_C1\0"
+    "C_C0_THROTTLE_PROCHOT_C2\0"
+    "C_C0_THROTTLE_PROCHOT_C3\0"
+    "C_C0_THROTTLE_PROCHOT_C4\0"
+    "C_C0_THROTTLE_PROCHOT_C5\0"
+    "C_C0_THROTTLE_PROCHOT_C6\0"
+    "C_C0_THROTTLE_PROCHOT_C7\0"
+    "C_C0_THROTTLE_PROCHOT_C_ALL\0"
+    "C_C0_THROTTLE_TMP_C0\0"
+    "C_C0_THROTTLE_TMP_C1\0"
+    "C_C0_THROTTLE_TMP_C2\0"
+    "C_C0_THROTTLE_TMP_C3\0"
+    "C_C0_THROTTLE_TMP_C4\0"
+    "C_C0_THROTTLE_TMP_C5\0"
+    "C_C0_THROTTLE_TMP_C6\0"
+    "C_C0_THROTTLE_TMP_C7\0"
+    "C_C0_THROTTLE_TMP_C_ALL\0"
+    "PROCHOT\0"
+    "RATIO_CHANGE_ABORT_C0\0"
+    "RATIO_CHANGE_ABORT_C1\0"
+    "RATIO_CHANGE_ABORT_C2\0"
+    "RATIO_CHANGE_ABORT_C3\0"
+    "RATIO_CHANGE_ABORT_C4\0"
+    "RATIO_CHANGE_ABORT_C5\0"
+    "RATIO_CHANGE_ABORT_C6\0"
+    "RATIO_CHANGE_ABORT_C7\0"
+    "RATIO_CHANGE_ABORT_C_ALL\0"
+    "TM1_ON_C0\0"
+    "TM1_ON_C1\0"
+    "TM1_ON_C2\0"
+    "TM1_ON_C3\0"
+    "TM1_ON_C4\0"
+    "TM1_ON_C5\0"
+    "TM1_ON_C6\0"
+    "TM1_ON_C7\0"
+    "TM1_ON_C_ALL\0"
+    "BBOX_CMDS_ALL\0"
+    "MBOX\0"
+    "REFRESH\0"
+    "MBOX_CLOCKTICKS\0"
+    "CYCLES_DSP_FILL_RDQ_FULL\0"
+    "CYCLES_DSP_FILL_WRQ_FULL\0"
+    "CYCLES_DSP_FILL_RDQ_EMPTY\0"
+    "CYCLES_DSP_FILL_WRQ_EMPTY\0"
+    "CYCLES_MFULL\0"
+    "CYCLES_PGT_STATE_CLOSED\0"
+    "CYCLES_PGT_STATE_OPEN\0"
+    "CYCLES_RETRYQ_STARVED\0"
+    "CYCLES_RETRYQ_MFULL\0"
+    "CYCLES_SCHED_MODE_TRADEOFF\0"
+    "CYCLES_SCHED_MODE_RDPRIO\0"
+    "CYCLES_SCHED_MODE_WRPRIO\0"
+    "CYCLES_SCHED_MODE_ADAPTIVE\0"
+    "DRAM_CMD_ALL\0"
+    "DRAM_CMD_ILLEGAL\0"
+    "DRAM_CMD_PREALL\0"
+    "DRAM_CMD_PREALL_TRDOFF\0"
+    "DRAM_CMD_PREALL_RDPRIO\0"
+    "DRAM_CMD_PREALL_WRPRIO\0"
+    "DRAM_CMD_PREALL_ADAPTIVE\0"
+    "DRAM_CMD_RAS\0"
+    "DRAM_CMD_RAS_TRDOFF\0"
+    "DRAM_CMD_RAS_RDPRIO\0"
+    "DRAM_CMD_RAS_WRPRIO\0"
+    "DRAM_CMD_RAS_ADAPTIVE\0"
+    "DRAM_CMD_CAS_RD_OPN\0"
+    "DRAM_CMD_CAS_WR_OPN\0"
+    "DRAM_CMD_CAS_WR_OPN_TRDOFF\0"
+    "DRAM_CMD_CAS_WR_OPN_RDPRIO\0"
+    "DRAM_CMD_CAS_WR_OPN_WRPRIO\0"
+    "DRAM_CMD_CAS_WR_OPN_ADAPTIVE\0"
+    "DRAM_CMD_CAS_RD_CLS\0"
+    "DRAM_CMD_CAS_RD_CLS_TRDOFF\0"
+    "DRAM_CMD_CAS_RD_CLS_RDPRIO\0"
+    "DRAM_CMD_CAS_RD_CLS_WRPRIO\0"
+    "DRAM_CMD_CAS_RD_CLS_ADAPTIVE\0"
+    "DRAM_CMD_CAS_WR_CLS\0"
+    "DRAM_CMD_CAS_WR_CLS_TRDOFF\0"
+    "DRAM_CMD_CAS_WR_CLS_RDPRIO\0"
+    "DRAM_CMD_CAS_WR_CLS_WRPRIO\0"
+    "DRAM_CMD_CAS_WR_CLS_ADAPTIVE\0"
+    "DRAM_CMD_MRS\0"
+    "DRAM_CMD_RFR\0"
+    "DRAM_CMD_ENSR\0"
+    "DRAM_CMD_EXSR\0"
+    "DRAM_CMD_NOP\0"
+    "DRAM_CMD_TRKL\0"
+    "DRAM_CMD_PRE\0"
+    "DRAM_CMD_SYNC\0"
+    "DRAM_CMD_CKE_HI\0"
+    "DRAM_CMD_CKE_LO\0"
+    "DRAM_CMD_SOFT_RST\0"
+    "DRAM_CMD_WR_CFG\0"
+    "DRAM_CMD_RD_CFG\0"
+    "DRAM_CMD_ZQCAL\0"
+    "DRAM_CMD_ALL_TRDOFF\0"
+    "DRAM_CMD_ALL_RDPRIO\0"
+    "DRAM_CMD_ALL_WRPRIO\0"
+    "DRAM_CMD_ALL_ADAPTIVE\0"
+    "DSP_FILL_RDQ_FULL\0"
+    "DSP_FILL_WRQ_FULL\0"
+    "DSP_FILL_RDQ_EMPTY\0"
+    "DSP_FILL_WRQ_EMPTY\0"
+    "BCMD_SCHEDQ_OCCUPANCY_READS\0"
+    "BCMD_SCHEDQ_OCCUPANCY_WRITES\0"
+    "BCMD_SCHEDQ_OCCUPANCY_MERGE\0"
+    "BCMD_SCHEDQ_OCCUPANCY_V2F\0"
+    "BCMD_SCHEDQ_OCCUPANCY_V2V\0"
+    "BCMD_SCHEDQ_OCCUPANCY_F2V\0"
+    "BCMD_SCHEDQ_OCCUPANCY_F2B\0"
+    "BCMD_SCHEDQ_OCCUPANCY_SPRWR\0"
+    "BCMD_SCHEDQ_OCCUPANCY_ALL\0"
+    "FRM_TYPE_3CMD\0"
+    "FRM_TYPE_WDAT\0"
+    "FRM_TYPE_SYNC\0"
+    "FRM_TYPE_CHNL\0"
+    "FRM_TYPE_NOP\0"
+    "FRM_TYPE_1CMD\0"
+    "FVC_EV0_SMI_CRC_ERR\0"
+    "FVC_EV0_MEM_ECC_ERR\0"
+    "FVC_EV0_POISON_TXN\0"
+    "FVC_EV0_ALERT_FRAMES\0"
+    "FVC_EV0_FAST_RESET\0"
+    "FVC_EV0_BBOX_CMDS_READS\0"
+    "FVC_EV0_BBOX_CMDS_WRITES\0"
+    "FVC_EV0_BBOX_RSP_ACK\0"
+    "FVC_EV0_BBOX_RSP_RETRY\0"
+    "FVC_EV0_BBOX_RSP_COR\0"
+    "FVC_EV0_BBOX_RSP_UNCOR\0"
+    "FVC_EV0_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV0_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV0_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV0_SMI_NB_TRIG\0"
+    "FVC_EV1_SMI_CRC_ERR\0"
+    "FVC_EV1_MEM_ECC_ERR\0"
+    "FVC_EV1_POISON_TXN\0"
+    "FVC_EV1_ALERT_FRAMES\0"
+    "FVC_EV1_FAST_RESET\0"
+    "FVC_EV1_BBOX_CMDS_READS\0"
+    "FVC_EV1_BBOX_CMDS_WRITES\0"
+    "FVC_EV1_BBOX_RSP_ACK\0"
+    "FVC_EV1_BBOX_RSP_RETRY\0"
+    "FVC_EV1_BBOX_RSP_COR\0"
+    "FVC_EV1_BBOX_RSP_UNCOR\0"
+    "FVC_EV1_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV1_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV1_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV1_SMI_NB_TRIG\0"
+    "FVC_EV2_SMI_CRC_ERR\0"
+    "FVC_EV2_MEM_ECC_ERR\0"
+    "FVC_EV2_POISON_TXN\0"
+    "FVC_EV2_ALERT_FRAMES\0"
+    "FVC_EV2_FAST_RESET\0"
+    "FVC_EV2_BBOX_CMDS_READS\0"
+    "FVC_EV2_BBOX_CMDS_WRITES\0"
+    "FVC_EV2_BBOX_RSP_ACK\0"
+    "FVC_EV2_BBOX_RSP_RETRY\0"
+    "FVC_EV2_BBOX_RSP_COR\0"
+    "FVC_EV2_BBOX_RSP_UNCOR\0"
+    "FVC_EV2_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV2_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV2_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV2_SMI_NB_TRIG\0"
+    "FVC_EV3_SMI_CRC_ERR\0"
+    "FVC_EV3_MEM_ECC_ERR\0"
+    "FVC_EV3_POISON_TXN\0"
+    "FVC_EV3_ALERT_FRAMES\0"
+    "FVC_EV3_FAST_RESET\0"
+    "FVC_EV3_BBOX_CMDS_READS\0"
+    "FVC_EV3_BBOX_CMDS_WRITES\0"
+    "FVC_EV3_BBOX_RSP_ACK\0"
+    "FVC_EV3_BBOX_RSP_RETRY\0"
+    "FVC_EV3_BBOX_RSP_COR\0"
+    "FVC_EV3_BBOX_RSP_UNCOR\0"
+    "FVC_EV3_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV3_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV3_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV3_SMI_NB_TRIG\0"
+    "FVID_RACE\0"
+    "INFLIGHT_CMDS\0"
+    "SCHED_MODE_CHANGES\0"
+    "MA_PAR_ERR\0"
+    "MULTICAS\0"
+    "PAGE_EMPTY\0"
+    "PAGE_HIT\0"
+    "PAGE_MISS\0"
+    "PATROL_TXNS\0"
+    "PGT_PAGE_EV_OPN2CLS\0"
+    "PGT_PAGE_EV_CLS2OPN\0"
+    "RETRIES_ALL\0"
+    "REFRESH_CONFLICT\0"
+    "RETRY_MFULL\0"
+    "RETRY_STARVE\0"
+    "SCHED_INFLIGHT_CMDS\0"
+    "THERM_TRP_DN_ALL_GT_MID_RISE\0"
+    "THERM_TRP_DN_ALL_GT_MID_FALL\0"
+    "THERM_TRP_DN_ALL_GT_LO\0"
+    "THERM_TRP_DN_ALL_LT_LO\0"
+    "THERM_TRP_DN_DIMM0_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM1_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM2_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM3_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM0_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM1_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM2_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM3_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM0_GT_LO\0"
+    "THERM_TRP_DN_DIMM1_GT_LO\0"
+    "THERM_TRP_DN_DIMM2_GT_LO\0"
+    "THERM_TRP_DN_DIMM3_GT_LO\0"
+    "THERM_TRP_DN_DIMM0_LT_LO\0"
+    "THERM_TRP_DN_DIMM1_LT_LO\0"
+    "THERM_TRP_DN_DIMM2_LT_LO\0"
+    "THERM_TRP_DN_DIMM3_LT_LO\0"
+    "THERM_TRP_UP_ALL_GT_MID_RISE\0"
+    "THERM_TRP_UP_ALL_GT_MID_FALL\0"
+    "THERM_TRP_UP_ALL_GT_LO\0"
+    "THERM_TRP_UP_ALL_LT_LO\0"
+    "THERM_TRP_UP_DIMM0_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM1_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM2_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM3_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM0_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM1_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM2_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM3_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM0_GT_LO\0"
+    "THERM_TRP_UP_DIMM1_GT_LO\0"
+    "THERM_TRP_UP_DIMM2_GT_LO\0"
+    "THERM_TRP_UP_DIMM3_GT_LO\0"
+    "THERM_TRP_UP_DIMM0_LT_LO\0"
+    "THERM_TRP_UP_DIMM1_LT_LO\0"
+    "THERM_TRP_UP_DIMM2_LT_LO\0"
+    "THERM_TRP_UP_DIMM3_LT_LO\0"
+    "TRANS_CMDS\0"
+    "TT_CMD_CONFLICT\0"
+    "ACK_BEFORE_LAST_SNP\0"
+    "BBOX0C3|BBOX1C3\0"
+    "ADDR_IN_MATCH\0"
+    "BBOX0C2|BBOX1C2\0"
+    "CONFLICTS\0"
+    "COHQ_BYPASS\0"
+    "COHQ_IMT_ALLOC_WAIT\0"
+    "DIRQ_INSERTS\0"
+    "BBOX0C1|BBOX1C1\0"
+    "DIRQ_OCCUPANCY\0"
+    "BBOX0C0|BBOX1C0\0"
+    "DEMAND_FETCH\0"
+    "DRSQ_INSERTS\0"
+    "DRSQ_OCCUPANCY\0"
+    "EARLY_ACK\0"
+    "IMPLICIT_WBS\0"
+    "IMT_FULL\0"
+    "IMT_INSERTS_ALL\0"
+    "IMT_INSERTS_INVITOE\0"
+    "IMT_INSERTS_IOH\0"
+    "IMT_INSERTS_IOH_INVITOE\0"
+    "IMT_INSERTS_IOH_WR\0"
+    "IMT_INSERTS_NON_IOH\0"
+    "IMT_INSERTS_NON_IOH_INVITOE\0"
+    "IMT_INSERTS_NON_IOH_RD\0"
+    "IMT_INSERTS_NON_IOH_WR\0"
+    "IMT_INSERTS_RD\0"
+    "IMT_INSERTS_WR\0"
+    "IMT_NE_CYCLES\0"
+    "IMT_PREALLOC\0"
+    "IMT_VALID_OCCUPANCY\0"
+    "MSG_ADDR_IN_MATCH\0"
+    "MSGS_B_TO_S\0"
+    "MSGS_S_TO_B\0"
+    "MSG_IN_MATCH\0"
+    "MSGS_IN_NON_SNP\0"
+    "MSG_OPCODE_ADDR_IN_MATCH\0"
+    "MSG_OPCODE_IN_MATCH\0"
+    "MSG_OPCODE_OUT_MATCH\0"
+    "MSG_OUT_MATCH\0"
+    "OPCODE_ADDR_IN_MATCH\0"
+    "OPCODE_IN_MATCH\0"
+    "OPCODE_OUT_MATCH\0"
+    "RBOX_VNA_UNAVAIL\0"
+    "SBOX_VN0_UNAVAIL\0"
+    "SNPOQ_INSERTS\0"
+    "SNPOQ_OCCUPANCY\0"
+    "TF_ALL\0"
+    "TF_INVITOE\0"
+    "TF_IOH\0"
+    "TF_IOH_INVITOE\0"
+    "TF_IOH_NON_INVITOE_RD\0"
+    "TF_IOH_WR\0"
+    "TF_WR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NCB\0"
+    "RBOX0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NCB\0"
+    "RBOX1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_ALL\0"
+    "EOT_INSERTS_PORT0_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT0_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT0_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT0_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT0_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT0_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT0_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT0_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT0_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT1_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT1_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT1_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT1_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT1_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT1_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT1_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT1_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT2_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT2_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT2_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT2_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT2_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT2_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT2_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT2_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT3_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT3_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT3_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT3_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT3_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT3_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT3_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT3_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT4_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT4_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT4_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT4_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT4_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT4_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT4_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT4_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT5_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT5_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT5_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT5_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT5_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT5_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT5_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT5_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT6_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT6_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT6_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT6_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT6_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT6_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT6_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT6_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT7_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT7_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT7_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT7_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT7_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT7_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT7_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT7_IPERF1_DRS_VN1\0"
+    "EOT_NE_CYCLES_PORT0_IPERF0\0"
+    "EOT_NE_CYCLES_PORT0_IPERF1\0"
+    "EOT_NE_CYCLES_PORT1_IPERF0\0"
+    "EOT_NE_CYCLES_PORT1_IPERF1\0"
+    "EOT_NE_CYCLES_PORT2_IPERF0\0"
+    "EOT_NE_CYCLES_PORT2_IPERF1\0"
+    "EOT_NE_CYCLES_PORT3_IPERF0\0"
+    "EOT_NE_CYCLES_PORT3_IPERF1\0"
+    "EOT_NE_CYCLES_PORT4_IPERF0\0"
+    "EOT_NE_CYCLES_PORT4_IPERF1\0"
+    "EOT_NE_CYCLES_PORT5_IPERF0\0"
+    "EOT_NE_CYCLES_PORT5_IPERF1\0"
+    "EOT_NE_CYCLES_PORT6_IPERF0\0"
+    "EOT_NE_CYCLES_PORT6_IPERF1\0"
+    "EOT_NE_CYCLES_PORT7_IPERF0\0"
+    "EOT_NE_CYCLES_PORT7_IPERF1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_DRS_VN1\0"
+    "FLITS_RECV_ERR_PORT0_IPERF0\0"
+    "FLITS_RECV_ERR_PORT0_IPERF1\0"
+    "FLITS_RECV_ERR_PORT1_IPERF0\0"
+    "FLITS_RECV_ERR_PORT1_IPERF1\0"
+    "FLITS_RECV_ERR_PORT2_IPERF0\0"
+    "FLITS_RECV_ERR_PORT2_IPERF1\0"
+    "FLITS_RECV_ERR_PORT3_IPERF0\0"
+    "FLITS_RECV_ERR_PORT3_IPERF1\0"
+    "FLITS_RECV_ERR_PORT4_IPERF0\0"
+    "FLITS_RECV_ERR_PORT4_IPERF1\0"
+    "FLITS_RECV_ERR_PORT5_IPERF0\0"
+    "FLITS_RECV_ERR_PORT5_IPERF1\0"
+    "FLITS_RECV_ERR_PORT6_IPERF0\0"
+    "FLITS_RECV_ERR_PORT6_IPERF1\0"
+    "FLITS_RECV_ERR_PORT7_IPERF0\0"
+    "FLITS_RECV_ERR_PORT7_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT0_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT0_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT1_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT1_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT2_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT2_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT3_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT3_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT4_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT4_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT5_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT5_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT6_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT6_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT7_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT7_IPERF1\0"
+    "FLITS_SENT_PORT0_IPERF0\0"
+    "FLITS_SENT_PORT0_IPERF1\0"
+    "FLITS_SENT_PORT1_IPERF0\0"
+    "FLITS_SENT_PORT1_IPERF1\0"
+    "FLITS_SENT_PORT2_IPERF0\0"
+    "FLITS_SENT_PORT2_IPERF1\0"
+    "FLITS_SENT_PORT3_IPERF0\0"
+    "FLITS_SENT_PORT3_IPERF1\0"
+    "FLITS_SENT_PORT4_IPERF0\0"
+    "FLITS_SENT_PORT4_IPERF1\0"
+    "FLITS_SENT_PORT5_IPERF0\0"
+    "FLITS_SENT_PORT5_IPERF1\0"
+    "FLITS_SENT_PORT6_IPERF0\0"
+    "FLITS_SENT_PORT6_IPERF1\0"
+    "FLITS_SENT_PORT7_IPERF0\0"
+    "FLITS_SENT_PORT7_IPERF1\0"
+    "GLOBAL_ARB_BID_PORT0_QLX0\0"
+    "GLOBAL_ARB_BID_PORT0_QLX1\0"
+    "GLOBAL_ARB_BID_PORT1_QLX0\0"
+    "GLOBAL_ARB_BID_PORT1_QLX1\0"
+    "GLOBAL_ARB_BID_PORT2_QLX0\0"
+    "GLOBAL_ARB_BID_PORT2_QLX1\0"
+    "GLOBAL_ARB_BID_PORT3_QLX0\0"
+    "GLOBAL_ARB_BID_PORT3_QLX1\0"
+    "GLOBAL_ARB_BID_PORT4_QLX0\0"
+    "GLOBAL_ARB_BID_PORT4_QLX1\0"
+    "GLOBAL_ARB_BID_PORT5_QLX0\0"
+    "GLOBAL_ARB_BID_PORT5_QLX1\0"
+    "GLOBAL_ARB_BID_PORT6_QLX0\0"
+    "GLOBAL_ARB_BID_PORT6_QLX1\0"
+    "GLOBAL_ARB_BID_PORT7_QLX0\0"
+    "GLOBAL_ARB_BID_PORT7_QLX1\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NCB\0"
+    "INQUE_READ_WIN_PORT0_IPERF0\0"
+    "INQUE_READ_WIN_PORT0_IPERF1\0"
+    "INQUE_READ_WIN_PORT1_IPERF0\0"
+    "INQUE_READ_WIN_PORT1_IPERF1\0"
+    "INQUE_READ_WIN_PORT2_IPERF0\0"
+    "INQUE_READ_WIN_PORT2_IPERF1\0"
+    "INQUE_READ_WIN_PORT3_IPERF0\0"
+    "INQUE_READ_WIN_PORT3_IPERF1\0"
+    "INQUE_READ_WIN_PORT4_IPERF0\0"
+    "INQUE_READ_WIN_PORT4_IPERF1\0"
+    "INQUE_READ_WIN_PORT5_IPERF0\0"
+    "INQUE_READ_WIN_PORT5_IPERF1\0"
+    "INQUE_READ_WIN_PORT6_IPERF0\0"
+    "INQUE_READ_WIN_PORT6_IPERF1\0"
+    "INQUE_READ_WIN_PORT7_IPERF0\0"
+    "INQUE_READ_WIN_PORT7_IPERF1\0"
+    "LOCAL_ARB_BID_PORT0_QLX0\0"
+    "LOCAL_ARB_BID_PORT0_QLX1\0"
+    "LOCAL_ARB_BID_PORT1_QLX0\0"
+    "LOCAL_ARB_BID_PORT1_QLX1\0"
+    "LOCAL_ARB_BID_PORT2_QLX0\0"
+    "LOCAL_ARB_BID_PORT2_QLX1\0"
+    "LOCAL_ARB_BID_PORT3_QLX0\0"
+    "LOCAL_ARB_BID_PORT3_QLX1\0"
+    "LOCAL_ARB_BID_PORT4_QLX0\0"
+    "LOCAL_ARB_BID_PORT4_QLX1\0"
+    "LOCAL_ARB_BID_PORT5_QLX0\0"
+    "LOCAL_ARB_BID_PORT5_QLX1\0"
+    "LOCAL_ARB_BID_PORT6_QLX0\0"
+    "LOCAL_ARB_BID_PORT6_QLX1\0"
+    "LOCAL_ARB_BID_PORT7_QLX0\0"
+    "LOCAL_ARB_BID_PORT7_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT0_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT0_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT1_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT1_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT2_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT2_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT3_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT3_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT4_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT4_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT5_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT5_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT6_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT6_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT7_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT7_QLX1\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_ALL\0"
+    "NULL_IDLE_PORT0_IPERF0\0"
+    "NULL_IDLE_PORT0_IPERF1\0"
+    "NULL_IDLE_PORT1_IPERF0\0"
+    "NULL_IDLE_PORT1_IPERF1\0"
+    "NULL_IDLE_PORT2_IPERF0\0"
+    "NULL_IDLE_PORT2_IPERF1\0"
+    "NULL_IDLE_PORT3_IPERF0\0"
+    "NULL_IDLE_PORT3_IPERF1\0"
+    "NULL_IDLE_PORT4_IPERF0\0"
+    "NULL_IDLE_PORT4_IPERF1\0"
+    "NULL_IDLE_PORT5_IPERF0\0"
+    "NULL_IDLE_PORT5_IPERF1\0"
+    "NULL_IDLE_PORT6_IPERF0\0"
+    "NULL_IDLE_PORT6_IPERF1\0"
+    "NULL_IDLE_PORT7_IPERF0\0"
+    "NULL_IDLE_PORT7_IPERF1\0"
+    "OUTPUTQ_NE_PORT0_IPERF0\0"
+    "OUTPUTQ_NE_PORT0_IPERF1\0"
+    "OUTPUTQ_NE_PORT1_IPERF0\0"
+    "OUTPUTQ_NE_PORT1_IPERF1\0"
+    "OUTPUTQ_NE_PORT2_IPERF0\0"
+    "OUTPUTQ_NE_PORT2_IPERF1\0"
+    "OUTPUTQ_NE_PORT3_IPERF0\0"
+    "OUTPUTQ_NE_PORT3_IPERF1\0"
+    "OUTPUTQ_NE_PORT4_IPERF0\0"
+    "OUTPUTQ_NE_PORT4_IPERF1\0"
+    "OUTPUTQ_NE_PORT5_IPERF0\0"
+    "OUTPUTQ_NE_PORT5_IPERF1\0"
+    "OUTPUTQ_NE_PORT6_IPERF0\0"
+    "OUTPUTQ_NE_PORT6_IPERF1\0"
+    "OUTPUTQ_NE_PORT7_IPERF0\0"
+    "OUTPUTQ_NE_PORT7_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT0_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT0_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT1_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT1_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT2_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT2_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT3_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT3_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT4_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT4_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT5_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT5_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT6_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT6_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT7_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT7_IPERF1\0"
+    "QUE_ARB_BID_PORT0_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT0_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT0_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT0_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT0_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT0_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT0_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT0_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT0_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT0_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT0_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT0_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT1_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT1_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT1_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT1_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT1_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT1_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT1_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT1_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT1_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT1_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT1_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT1_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT2_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT2_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT2_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT2_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT2_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT2_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT2_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT2_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT2_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT2_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT2_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT2_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT3_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT3_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT3_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT3_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT3_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT3_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT3_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT3_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT3_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT3_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT3_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT3_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT4_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT4_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT4_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT4_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT4_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT4_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT4_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT4_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT4_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT4_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT4_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT4_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT5_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT5_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT5_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT5_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT5_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT5_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT5_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT5_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT5_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT5_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT5_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT5_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT6_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT6_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT6_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT6_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT6_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT6_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT6_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT6_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT6_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT6_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT6_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT6_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT7_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT7_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT7_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT7_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT7_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT7_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT7_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT7_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT7_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT7_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT7_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT7_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NCB\0"
+    "RETRYQ_NE_PORT0_IPERF0\0"
+    "RETRYQ_NE_PORT0_IPERF1\0"
+    "RETRYQ_NE_PORT1_IPERF0\0"
+    "RETRYQ_NE_PORT1_IPERF1\0"
+    "RETRYQ_NE_PORT2_IPERF0\0"
+    "RETRYQ_NE_PORT2_IPERF1\0"
+    "RETRYQ_NE_PORT3_IPERF0\0"
+    "RETRYQ_NE_PORT3_IPERF1\0"
+    "RETRYQ_NE_PORT4_IPERF0\0"
+    "RETRYQ_NE_PORT4_IPERF1\0"
+    "RETRYQ_NE_PORT5_IPERF0\0"
+    "RETRYQ_NE_PORT5_IPERF1\0"
+    "RETRYQ_NE_PORT6_IPERF0\0"
+    "RETRYQ_NE_PORT6_IPERF1\0"
+    "RETRYQ_NE_PORT7_IPERF0\0"
+    "RETRYQ_NE_PORT7_IPERF1\0"
+    "RETRYQ_OV_PORT0_IPERF0\0"
+    "RETRYQ_OV_PORT0_IPERF1\0"
+    "RETRYQ_OV_PORT1_IPERF0\0"
+    "RETRYQ_OV_PORT1_IPERF1\0"
+    "RETRYQ_OV_PORT2_IPERF0\0"
+    "RETRYQ_OV_PORT2_IPERF1\0"
+    "RETRYQ_OV_PORT3_IPERF0\0"
+    "RETRYQ_OV_PORT3_IPERF1\0"
+    "RETRYQ_OV_PORT4_IPERF0\0"
+    "RETRYQ_OV_PORT4_IPERF1\0"
+    "RETRYQ_OV_PORT5_IPERF0\0"
+    "RETRYQ_OV_PORT5_IPERF1\0"
+    "RETRYQ_OV_PORT6_IPERF0\0"
+    "RETRYQ_OV_PORT6_IPERF1\0"
+    "RETRYQ_OV_PORT7_IPERF0\0"
+    "RETRYQ_OV_PORT7_IPERF1\0"
+    "STARVING_PORT0_QLX0\0"
+    "STARVING_PORT0_QLX1\0"
+    "STARVING_PORT1_QLX0\0"
+    "STARVING_PORT1_QLX1\0"
+    "STARVING_PORT2_QLX0\0"
+    "STARVING_PORT2_QLX1\0"
+    "STARVING_PORT3_QLX0\0"
+    "STARVING_PORT3_QLX1\0"
+    "STARVING_PORT4_QLX0\0"
+    "STARVING_PORT4_QLX1\0"
+    "STARVING_PORT5_QLX0\0"
+    "STARVING_PORT5_QLX1\0"
+    "STARVING_PORT6_QLX0\0"
+    "STARVING_PORT6_QLX1\0"
+    "STARVING_PORT7_QLX0\0"
+    "STARVING_PORT7_QLX1\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_VLG\0"
+    "LLC_MISSES_SHARED\0"
+    "CBOX\0"
+    "LLC_MISSES_FORWARD\0"
+    "LLC_MISSES_INVALID\0"
+    "LLC_MISSES_ALL\0"
+    "LLC_HITS_MODIFIED\0"
+    "LLC_HITS_EXCLUSIVE\0"
+    "LLC_HITS_SHARED\0"
+    "LLC_HITS_FORWARD\0"
+    "LLC_HITS_ALL\0"
+    "LLC_S_FILLS_MODIFIED\0"
+    "LLC_S_FILLS_EXCLUSIVE\0"
+    "LLC_S_FILLS_SHARED\0"
+    "LLC_S_FILLS_FORWARD\0"
+    "LLC_S_FILLS_ALL\0"
+    "LLC_VICTIMS_MODIFIED\0"
+    "LLC_VICTIMS_EXCLUSIVE\0"
+    "LLC_VICTIMS_SHARED\0"
+    "LLC_VICTIMS_FORWARD\0"
+    "LLC_VICTIMS_ALL\0"
+    "LLC_VICTIMS_FILL_WITHOUT_VICTIMS\0"
+    "ARB_LOSSES_AD_SB\0"
+    "ARB_LOSSES_AD_NSB\0"
+    "ARB_LOSSES_AD_ALL\0"
+    "ARB_LOSSES_AK_SB\0"
+    "ARB_LOSSES_AK_NSB\0"
+    "ARB_LOSSES_AK_ALL\0"
+    "ARB_LOSSES_BL_SB\0"
+    "ARB_LOSSES_BL_NSB\0"
+    "ARB_LOSSES_BL_ALL\0"
+    "ARB_LOSSES_IV\0"
+    "ARB_LOSSES_ALL\0"
+    "ARB_WINS_AD_SB\0"
+    "ARB_WINS_AD_NSB\0"
+    "ARB_WINS_AD_ALL\0"
+    "ARB_WINS_AK_SB\0"
+    "ARB_WINS_AK_NSB\0"
+    "ARB_WINS_AK_ALL\0"
+    "ARB_WINS_BL_SB\0"
+    "ARB_WINS_BL_NSB\0"
+    "ARB_WINS_BL_ALL\0"
+    "ARB_WINS_IV\0"
+    "ARB_WINS_ALL\0"
+    "BOUNCES_C2P_AK_SB\0"
+    "BOUNCES_C2P_AK_NSB\0"
+    "BOUNCES_C2P_AK_ALL\0"
+    "BOUNCES_C2P_BL_SB\0"
+    "BOUNCES_C2P_BL_NSB\0"
+    "BOUNCES_C2P_BL_ALL\0"
+    "BOUNCES_C2P_IV\0"
+    "BOUNCES_P2C_AD_SB\0"
+    "BOUNCES_P2C_AD_NSB\0"
+    "BOUNCES_P2C_AD_ALL\0"
+    "EGRESS_BYPASS_WINS_AD_BYP0\0"
+    "EGRESS_BYPASS_WINS_AD_BYP1\0"
+    "EGRESS_BYPASS_WINS_AK_BYP0\0"
+    "EGRESS_BYPASS_WINS_AK_BYP1\0"
+    "EGRESS_BYPASS_WINS_BL_BYP0\0"
+    "EGRESS_BYPASS_WINS_BL_BYP1\0"
+    "EGRESS_BYPASS_WINS_IV_BYP0\0"
+    "EGRESS_BYPASS_WINS_IV_BYP1\0"
+    "INGRESS_BYPASS_WINS_AD_IRQ_BYP0\0"
+    "INGRESS_BYPASS_WINS_AD_IRQ_BYP1\0"
+    "INGRESS_BYPASS_WINS_AD_IPQ_BYP0\0"
+    "INGRESS_BYPASS_WINS_AD_IPQ_BYP1\0"
+    "MAF_ACK\0"
+    "MAF_NACK1_GO_PENDING\0"
+    "MAF_NACK1_VIC_PENDING\0"
+    "MAF_NACK1_SNP_PENDING\0"
+    "MAF_NACK1_AC_PENDING\0"
+    "MAF_NACK1_IDX_BLOCK\0"
+    "MAF_NACK1_PA_BLOCK\0"
+    "MAF_NACK1_IDLE_QPI\0"
+    "MAF_NACK1_ALL_MAF_NACK1\0"
+    "MAF_NACK1_TOTAL_MAF_NACKS\0"
+    "MAF_NACK2_MAF_FULL\0"
+    "MAF_NACK2_EGRESS_FULL\0"
+    "MAF_NACK2_VIQ_FULL\0"
+    "MAF_NACK2_NO_TRACKER_CREDITS\0"
+    "MAF_NACK2_NO_S_FIFO_CREDITS\0"
+    "MAF_NACK2_NO_S_REQTBL_ENTRIES\0"
+    "MAF_NACK2_WB_PENDING\0"
+    "MAF_NACK2_NACK2_ELSE\0"
+    "OCCUPANCY_IPQ\0"
+    "OCCUPANCY_IRQ\0"
+    "OCCUPANCY_MAF\0"
+    "OCCUPANCY_RSPF\0"
+    "OCCUPANCY_RWRF\0"
+    "OCCUPANCY_VIQ\0"
+    "SINKS_C2P_IV\0"
+    "SINKS_C2P_AK\0"
+    "SINKS_C2P_BL\0"
+    "SINKS_P2C_IV\0"
+    "SINKS_P2C_AK\0"
+    "SINKS_P2C_BL\0"
+    "SINKS_S2C_AD\0"
+    "SINKS_S2C_AK\0"
+    "SINKS_S2C_BL\0"
+    "SINKS_S2P_BL\0"
+    "SNP_HITS_REMOTE_RD_HITM\0"
+    "SNP_HITS_REMOTE_RD_HITE\0"
+    "SNP_HITS_REMOTE_RD_HITS\0"
+    "SNP_HITS_REMOTE_RD_HITF\0"
+    "SNP_HITS_REMOTE_RFO_HITM\0"
+    "SNP_HITS_REMOTE_RFO_HITE\0"
+    "SNP_HITS_REMOTE_RFO_HITS\0"
+    "SNP_HITS_REMOTE_RFO_HITF\0"
+    "SNP_HITS_REMOTE_HITM\0"
+    "SNP_HITS_REMOTE_HITE\0"
+    "SNP_HITS_REMOTE_HITS\0"
+    "SNP_HITS_REMOTE_HITF\0"
+    "SNP_HITS_REMOTE_ANY\0"
+    "SNPS_REMOTE_RD\0"
+    "SNPS_REMOTE_RFO\0"
+    "SNPS_REMOTE_ANY\0"
+    "STARVED_EGRESS_P2C_AD_SB\0"
+    "STARVED_EGRESS_C2P_AD_SB\0"
+    "STARVED_EGRESS_AD_SB\0"
+    "STARVED_EGRESS_AD_NSB\0"
+    "STARVED_EGRESS_AD\0"
+    "STARVED_EGRESS_AK_SB\0"
+    "STARVED_EGRESS_AK_NSB\0"
+    "STARVED_EGRESS_AK\0"
+    "STARVED_EGRESS_BL_SB\0"
+    "STARVED_EGRESS_BL_NSB\0"
+    "STARVED_EGRESS_BL\0"
+    "STARVED_EGRESS_IV\0"
+    "TRANS_IPQ\0"
+    "TRANS_IRQ\0"
+    "TRANS_MAF\0"
+    "TRANS_RSPF\0"
+    "TRANS_RWRF\0"
+    "TRANS_VIQ\0"
+    "BUF_VALID_LOCAL_INT\0"
+    "UBOX\0"
+    "BUF_VALID_REMOTE_INT\0"
+    "BUF_VALID_LOCK\0"
+    "BUF_VALID_STST\0"
+    "BUF_VALID_SPC_CYCLES\0"
+    "CORRECTED_ERR\0"
+    "FATAL_ERR\0"
+    "IPIS_SENT\0"
+    "RECOV\0"
+    "U2R_REQUESTS\0"
+    "U2R_REQUEST_CYCLES\0"
+    "WOKEN\0"
+    "B2S_DRS_BYPASS\0"
+    "SBOX\0"
+    "BBOX_CREDITS\0"
+    "BBOX_CREDIT_RETURNS\0"
+    "BBOX_HOM_BYPASS\0"
+    "EGRESS_BYPASS_AD_CW\0"
+    "EGRESS_BYPASS_AD_CCW\0"
+    "EGRESS_BYPASS_AD\0"
+    "EGRESS_BYPASS_AK_CW\0"
+    "EGRESS_BYPASS_AK_CCW\0"
+    "EGRESS_BYPASS_AK\0"
+    "EGRESS_BYPASS_BL_CW\0"
+    "EGRESS_BYPASS_BL_CCW\0"
+    "EGRESS_BYPASS_BL\0"
+    "EGRESS_ARB_WINS_AD_CW\0"
+    "EGRESS_ARB_WINS_AD_CCW\0"
+    "EGRESS_ARB_WINS_AD\0"
+    "EGRESS_ARB_WINS_AK_CW\0"
+    "EGRESS_ARB_WINS_AK_CCW\0"
+    "EGRESS_ARB_WINS_AK\0"
+    "EGRESS_ARB_WINS_BL_CW\0"
+    "EGRESS_ARB_WINS_BL_CCW\0"
+    "EGRESS_ARB_WINS_BL\0"
+    "EGRESS_ARB_LOSSES_AD_CW\0"
+    "EGRESS_ARB_LOSSES_AD_CCW\0"
+    "EGRESS_ARB_LOSSES_AD\0"
+    "EGRESS_ARB_LOSSES_AK_CW\0"
+    "EGRESS_ARB_LOSSES_AK_CCW\0"
+    "EGRESS_ARB_LOSSES_AK\0"
+    "EGRESS_ARB_LOSSES_BL_CW\0"
+    "EGRESS_ARB_LOSSES_BL_CCW\0"
+    "EGRESS_ARB_LOSSES_BL\0"
+    "EGRESS_STARVED_AD_CW\0"
+    "EGRESS_STARVED_AD_CCW\0"
+    "EGRESS_STARVED_AD\0"
+    "EGRESS_STARVED_AK_CW\0"
+    "EGRESS_STARVED_AK_CCW\0"
+    "EGRESS_STARVED_AK\0"
+    "EGRESS_STARVED_BL_CW\0"
+    "EGRESS_STARVED_BL_CCW\0"
+    "EGRESS_STARVED_BL\0"
+    "FLITS_SENT_DRS\0"
+    "FLITS_SENT_NCB\0"
+    "FLITS_SENT_NCS\0"
+    "HALFLINE_BYPASS\0"
+    "NO_CREDIT_AD\0"
+    "NO_CREDIT_AK\0"
+    "NO_CREDIT_BL\0"
+    "NO_CREDIT_HOM\0"
+    "NO_CREDIT_SNP\0"
+    "NO_CREDIT_DRS\0"
+    "NO_CREDIT_NCS\0"
+    "NO_CREDIT_NCB\0"
+    "NO_CREDIT_NDR\0"
+    "NO_CREDIT_IPQ\0"
+    "NO_CREDIT_VNA_RBOX\0"
+    "NO_CREDIT_VNA_BBOX\0"
+    "NO_CREDIT_VNA_ALL\0"
+    "PKTS_RCVD_DRS_FROM_R\0"
+    "PKTS_RCVD_DRS_FROM_B\0"
+    "PKTS_RCVD_NCB\0"
+    "PKTS_RCVD_NCS\0"
+    "PKTS_RCVD_NDR\0"
+    "PKTS_RCVD_SNP\0"
+    "PKTS_SENT_DRS_CBOX0_4\0"
+    "PKTS_SENT_DRS_CBOX1_5\0"
+    "PKTS_SENT_DRS_CBOX2_6\0"
+    "PKTS_SENT_DRS_CBOX3_7\0"
+    "PKTS_SENT_DRS_ALL\0"
+    "PKTS_SENT_HOM_RBOX\0"
+    "PKTS_SENT_HOM_BBOX\0"
+    "PKTS_SENT_HOM_ALL\0"
+    "PKTS_SENT_NCB_CBOX0_4\0"
+    "PKTS_SENT_NCB_CBOX1_5\0"
+    "PKTS_SENT_NCB_CBOX2_6\0"
+    "PKTS_SENT_NCB_CBOX3_7\0"
+    "PKTS_SENT_NCB_ALL\0"
+    "PKTS_SENT_NCS_CBOX0_4\0"
+    "PKTS_SENT_NCS_CBOX1_5\0"
+    "PKTS_SENT_NCS_CBOX2_6\0"
+    "PKTS_SENT_NCS_CBOX3_7\0"
+    "PKTS_SENT_NCS_ALL\0"
+    "PKTS_SENT_NDR\0"
+    "PKTS_SENT_SNP\0"
+    "RBOX_CREDIT_RETURNS\0"
+    "RBOX_CREDIT_CARRIERS\0"
+    "RBOX_HOM_BYPASS\0"
+    "RBOX_SNP_BYPASS_SNP\0"
+    "RBOX_SNP_BYPASS_BIG_SNP\0"
+    "RBOX_SNP_BYPASS_ALL\0"
+    "REQ_TBL_OCCUPANCY_LOCAL\0"
+    "REQ_TBL_OCCUPANCY_REMOTE\0"
+    "REQ_TBL_OCCUPANCY_ALL\0"
+    "S2B_HOM_BYPASS\0"
+    "TO_RING_B2S_MSGQ_CYCLES_FULL\0"
+    "TO_RING_B2S_MSGQ_CYCLES_NE\0"
+    "TO_RING_B2S_MSGQ_OCCUPANCY\0"
+    "TO_RING_MSGQ_OCCUPANCY_SNP\0"
+    "TO_RING_MSGQ_OCCUPANCY_NCS\0"
+    "TO_RING_MSGQ_OCCUPANCY_NCB\0"
+    "TO_RING_MSGQ_OCCUPANCY_ALL\0"
+    "TO_RING_NCB_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NCB_MSGQ_CYCLES_NE\0"
+    "TO_RING_NCS_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NDR_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NDR_MSGQ_CYCLES_NE\0"
+    "TO_RING_NDR_MSGQ_OCCUPANCY\0"
+    "TO_RING_R2S_MSGQ_CYCLES_FULL\0"
+    "TO_RING_R2S_MSGQ_CYCLES_NE\0"
+    "TO_RING_R2S_MSGQ_OCCUPANCY\0"
+    "TO_RING_SNP_MSGQ_CYCLES_FULL\0"
+    "TO_RING_SNP_MSGQ_CYCLES_NE\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX0_4\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX1_5\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX2_6\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX3_7\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX0_4\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX1_5\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX2_6\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX3_7\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX0_4\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX1_5\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX2_6\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX3_7\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_RBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_BBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_RBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_BBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_RBOX\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_BBOX\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX0_4\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX1_5\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX2_6\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX3_7\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX0_4\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX1_5\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX2_6\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX3_7\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX0_4\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX1_5\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX2_6\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX3_7\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX0_4\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX1_5\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX2_6\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX3_7\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX0_4\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX1_5\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX2_6\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX3_7\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX0_4\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX1_5\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX2_6\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX3_7\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_NDR_MSGQ_CYCLES_FULL\0"
+    "TO_R_NDR_MSGQ_CYCLES_NE\0"
+    "TO_R_NDR_MSGQ_OCCUPANCY\0"
+    "TO_R_PROG_EV\0"
+    "TO_R_B_REQUESTS_LOCAL\0"
+    "TO_R_B_REQUESTS_REMOTE\0"
+    "TO_R_B_REQUESTS_ALL\0"
+    "TO_R_SNP_MSGQ_CYCLES_FULL\0"
+    "TO_R_SNP_MSGQ_CYCLES_NE\0"
+    "TO_R_SNP_MSGQ_OCCUPANCY\0";
+
+static const PerfmonEventOption nehalemEX_arch_event_options[] = {
+ {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+};
+
+static const PerfmonEventEntry nehalemEX_arch_event_entries[NUM_ARCH_EVENTS_NEHALEMEX] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 73, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79, 94, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {98, 94, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {113, 94, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 94, 0, 0, 0x04,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {152, 94, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {174, 94, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {197, 94, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 94, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {238, 94, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {254, 94, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {273, 94, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {295, 94, 0, 0, 0x06,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {311, 94, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 94, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {354, 94, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {386, 94, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {412, 94, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {438, 94, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {464, 94, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {502, 94, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {525, 94, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {549, 94, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {590, 94, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {618, 94, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {634, 94, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {652, 94, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {690, 94, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {737, 94, 0, 0, 0x0F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {768, 94, 0, 0, 0x0F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {798, 94, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {818, 94, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {838, 94, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {861, 94, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {890, 94, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {920, 94, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {950, 94, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {987, 94, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1024, 94, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1048, 94, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1074, 94, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1092, 94, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1112, 94, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1140, 94, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1166, 94, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1192, 94, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1209, 94, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1234, 94, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1252, 94, 0, 0, 0x13,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1270, 94, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1292, 94, 0, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1306, 94, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1316, 94, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1334, 94, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1352, 94, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1374, 94, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1385, 94, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1402, 94, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1431, 94, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1455, 94, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1468, 94, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1484, 94, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1501, 94, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 94, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1533, 94, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1551, 94, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1565, 94, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1585, 94, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1606, 94, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1624, 94, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1646, 94, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1669, 94, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1689, 94, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1703, 94, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1723, 94, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1752, 94, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1781, 94, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1810, 94, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1839, 94, 0, 0, 0x26,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1865, 94, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1903, 94, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1941, 94, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1979, 94, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2017, 94, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2052, 94, 0, 0, 0x26,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {2070, 94, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2091, 94, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2112, 94, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2133, 94, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2154, 94, 0, 0, 0x27,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2171, 94, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2189, 94, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2211, 94, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2233, 94, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2255, 94, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2277, 94, 0, 0, 0x27,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2295, 94, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2314, 94, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2332, 94, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2350, 94, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2368, 94, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2386, 94, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2401, 94, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2424, 94, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2442, 94, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2470, 94, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2495, 94, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2513, 2534, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2544, 2534, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2565, 2534, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2586, 2534, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2607, 2534, 0, 0, 0x40,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2625, 2534, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2646, 2534, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2667, 2534, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2688, 2534, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2709, 2534, 0, 0, 0x41,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2727, 2534, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2746, 2534, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2769, 2534, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2792, 2534, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2815, 2534, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2831, 2534, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2853, 2534, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2885, 94, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2901, 94, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2928, 94, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2949, 94, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2970, 94, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2991, 94, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3024, 94, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3041, 94, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3071, 94, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3084, 94, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3098, 94, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3120, 94, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3138, 94, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3160, 94, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3174, 94, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3188, 94, 0, 0, 0x4F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3203, 2534, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3212, 2534, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3223, 2534, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3235, 2534, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3253, 94, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3284, 2534, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3306, 94, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3350, 94, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3394, 94, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3432, 94, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3468, 94, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3493, 94, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3515, 94, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3531, 94, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3540, 94, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3551, 94, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3561, 94, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3580, 94, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3593, 94, 0, 0, 0x81,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3614, 94, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3629, 94, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3652, 94, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3668, 94, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3695, 94, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3710, 94, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3725, 94, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3744, 94, 0, 0, 0x87,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3761, 94, 0, 0, 0x87,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3776, 94, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3794, 94, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3814, 94, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3845, 94, 0, 0, 0x88,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3868, 94, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3893, 94, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3923, 94, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3955, 94, 0, 0, 0x88,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3979, 94, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3998, 94, 0, 0, 0x88,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {4015, 94, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4033, 94, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4053, 94, 0, 0, 0x89,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4084, 94, 0, 0, 0x89,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4107, 94, 0, 0, 0x89,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4132, 94, 0, 0, 0x89,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4162, 94, 0, 0, 0x89,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4194, 94, 0, 0, 0x89,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {4218, 94, 0, 0, 0x89,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4237, 94, 0, 0, 0x89,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {4254, 94, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4274, 94, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4295, 94, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4319, 94, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4341, 94, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4366, 94, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4387, 94, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4409, 94, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4431, 94, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4459, 94, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4476, 94, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4485, 94, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4496, 94, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4527, 94, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4547, 94, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4567, 94, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4592, 94, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4617, 94, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4642, 94, 0, 0, 0xB1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4662, 94, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4684, 94, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4706, 94, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4731, 94, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4750, 94, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4770, 94, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4790, 94, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4809, 94, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4826, 94, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4843, 94, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4860, 94, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4886, 94, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4911, 94, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4933, 94, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4958, 94, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4977, 94, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5006, 94, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5034, 94, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5060, 94, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5089, 94, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5115, 94, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5147, 94, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5179, 94, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5211, 94, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5243, 94, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5276, 94, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5294, 94, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5319, 94, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5343, 94, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5376, 94, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5416, 94, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5441, 94, 0, 0, 0xCB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5466, 94, 0, 0, 0xCB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5493, 94, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5512, 94, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5532, 94, 0, 0, 0xCC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5552, 94, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5572, 94, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5588, 94, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5613, 94, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5635, 94, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5652, 94, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5673, 94, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5698, 94, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5720, 94, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {5735, 94, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5753, 94, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5768, 94, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5781, 94, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5797, 94, 0, 0, 0xE5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5817, 94, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5831, 94, 0, 0, 0xE6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5850, 94, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5867, 94, 0, 0, 0xE8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5883, 94, 0, 0, 0xE8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5898, 94, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5919, 94, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5939, 94, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5962, 94, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5987, 94, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6010, 94, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6031, 94, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6050, 94, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6070, 94, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6090, 94, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6110, 94, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {6126, 94, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6152, 94, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6178, 94, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6206, 94, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6234, 94, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6251, 94, 0, 0, 0xF3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6270, 94, 0, 0, 0xF3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6291, 94, 0, 0, 0xF3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6319, 94, 0, 0, 0xF3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6347, 94, 0, 0, 0xF3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6374, 94, 0, 0, 0xF3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6400, 94, 0, 0, 0xF4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6418, 94, 0, 0, 0xF4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6444, 94, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6462, 94, 0, 0, 0xF4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6483, 94, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6502, 94, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6523, 94, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6537, 94, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6554, 94, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6570, 94, 0, 0, 0xFD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6593, 94, 0, 0, 0xFD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6618, 94, 0, 0, 0xFD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6635, 94, 0, 0, 0xFD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6654, 94, 0, 0, 0xFD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6681, 94, 0, 0, 0xFD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6706, 94, 0, 0, 0xFD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6731, 94, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6758, 6771, 0, 0, 0xFF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6779, 6797, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6802, 6797, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6820, 6797, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6838, 6797, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6856, 6797, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6874, 6797, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6892, 6797, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6910, 6797, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6928, 6797, 0, 0, 0x04,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {6949, 6797, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6970, 6797, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6991, 6797, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7012, 6797, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7033, 6797, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7054, 6797, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7075, 6797, 0, 0, 0x01,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7096, 6797, 0, 0, 0x01,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7117, 6797, 0, 0, 0x01,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7141, 6797, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7166, 6797, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7191, 6797, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7216, 6797, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7241, 6797, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7266, 6797, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7291, 6797, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7316, 6797, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7341, 6797, 0, 0, 0x03,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7369, 6797, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7390, 6797, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7411, 6797, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7432, 6797, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7453, 6797, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7474, 6797, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7495, 6797, 0, 0, 0x00,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7516, 6797, 0, 0, 0x00,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7537, 6797, 0, 0, 0x00,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7561, 6797, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7569, 6797, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7591, 6797, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7613, 6797, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7635, 6797, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7657, 6797, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7679, 6797, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7701, 6797, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7723, 6797, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7745, 6797, 0, 0, 0x08,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7770, 6797, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7780, 6797, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7790, 6797, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7800, 6797, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7810, 6797, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7820, 6797, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7830, 6797, 0, 0, 0x07,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7840, 6797, 0, 0, 0x07,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7850, 6797, 0, 0, 0x07,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7863, 7877, 0, 0, 0x1A,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {7882, 7877, 0, 0, 0x06,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {7890, 7877, 0, 0, 0x1B,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {7906, 7877, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {7931, 7877, 0, 0, 0x00,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {7956, 7877, 0, 0, 0x00,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {7982, 7877, 0, 0, 0x00,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8008, 7877, 0, 0, 0x01,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {8021, 7877, 0, 0, 0x05,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8045, 7877, 0, 0, 0x05,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8067, 7877, 0, 0, 0x04,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8089, 7877, 0, 0, 0x03,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8109, 7877, 0, 0, 0x01,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8136, 7877, 0, 0, 0x01,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8161, 7877, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8186, 7877, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8213, 7877, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8226, 7877, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8243, 7877, 0, 0, 0x0A,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8259, 7877, 0, 0, 0x0A,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {8282, 7877, 0, 0, 0x0A,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {8305, 7877, 0, 0, 0x0A,0x01,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {8328, 7877, 0, 0, 0x0A,0x01,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {8353, 7877, 0, 0, 0x0A,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8366, 7877, 0, 0, 0x0A,0x02,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {8386, 7877, 0, 0, 0x0A,0x02,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {8406, 7877, 0, 0, 0x0A,0x02,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {8426, 7877, 0, 0, 0x0A,0x02,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {8448, 7877, 0, 0, 0x0A,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8468, 7877, 0, 0, 0x0A,0x04,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8488, 7877, 0, 0, 0x0A,0x04,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {8515, 7877, 0, 0, 0x0A,0x04,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {8542, 7877, 0, 0, 0x0A,0x04,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {8569, 7877, 0, 0, 0x0A,0x04,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {8598, 7877, 0, 0, 0x0A,0x05,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8618, 7877, 0, 0, 0x0A,0x05,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {8645, 7877, 0, 0, 0x0A,0x05,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {8672, 7877, 0, 0, 0x0A,0x05,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {8699, 7877, 0, 0, 0x0A,0x05,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {8728, 7877, 0, 0, 0x0A,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8748, 7877, 0, 0, 0x0A,0x06,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {8775, 7877, 0, 0, 0x0A,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {8802, 7877, 0, 0, 0x0A,0x06,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {8829, 7877, 0, 0, 0x0A,0x06,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {8858, 7877, 0, 0, 0x0A,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8871, 7877, 0, 0, 0x0A,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8884, 7877, 0, 0, 0x0A,0x0A,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8898, 7877, 0, 0, 0x0A,0x0B,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8912, 7877, 0, 0, 0x0A,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8925, 7877, 0, 0, 0x0A,0x10,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8939, 7877, 0, 0, 0x0A,0x11,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8952, 7877, 0, 0, 0x0A,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8966, 7877, 0, 0, 0x0A,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8982, 7877, 0, 0, 0x0A,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {8998, 7877, 0, 0, 0x0A,0x17,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9016, 7877, 0, 0, 0x0A,0x1C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9032, 7877, 0, 0, 0x0A,0x1D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9048, 7877, 0, 0, 0x0A,0x1E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9063, 7877, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9083, 7877, 0, 0, 0x0A,0x00,0x02,0x01,EVENT_OPTION_NONE_MASK}
+, {9103, 7877, 0, 0, 0x0A,0x00,0x02,0x02,EVENT_OPTION_NONE_MASK}
+, {9123, 7877, 0, 0, 0x0A,0x00,0x02,0x03,EVENT_OPTION_NONE_MASK}
+, {9145, 7877, 0, 0, 0x00,0x01,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {9163, 7877, 0, 0, 0x00,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {9181, 7877, 0, 0, 0x00,0x04,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {9200, 7877, 0, 0, 0x00,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {9219, 7877, 0, 0, 0x06,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9247, 7877, 0, 0, 0x06,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9276, 7877, 0, 0, 0x06,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9304, 7877, 0, 0, 0x06,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9330, 7877, 0, 0, 0x06,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9356, 7877, 0, 0, 0x06,0x05,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9382, 7877, 0, 0, 0x06,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9408, 7877, 0, 0, 0x06,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9436, 7877, 0, 0, 0x06,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9462, 7877, 0, 0, 0x09,0x00,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9476, 7877, 0, 0, 0x09,0x01,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9490, 7877, 0, 0, 0x09,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9504, 7877, 0, 0, 0x09,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9518, 7877, 0, 0, 0x09,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9531, 7877, 0, 0, 0x09,0x0C,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {9545, 7877, 0, 0, 0x0D,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9565, 7877, 0, 0, 0x0D,0x01,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9585, 7877, 0, 0, 0x0D,0x02,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9604, 7877, 0, 0, 0x0D,0x03,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9625, 7877, 0, 0, 0x0D,0x04,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9644, 7877, 0, 0, 0x0D,0x05,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9668, 7877, 0, 0, 0x0D,0x05,0x06,0x01,EVENT_OPTION_NONE_MASK}
+, {9693, 7877, 0, 0, 0x0D,0x06,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9714, 7877, 0, 0, 0x0D,0x06,0x06,0x01,EVENT_OPTION_NONE_MASK}
+, {9737, 7877, 0, 0, 0x0D,0x06,0x06,0x02,EVENT_OPTION_NONE_MASK}
+, {9758, 7877, 0, 0, 0x0D,0x06,0x06,0x03,EVENT_OPTION_NONE_MASK}
+, {9781, 7877, 0, 0, 0x0D,0x06,0x06,0x04,EVENT_OPTION_NONE_MASK}
+, {9807, 7877, 0, 0, 0x0D,0x06,0x06,0x05,EVENT_OPTION_NONE_MASK}
+, {9832, 7877, 0, 0, 0x0D,0x06,0x06,0x07,EVENT_OPTION_NONE_MASK}
+, {9860, 7877, 0, 0, 0x0D,0x07,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {9880, 7877, 0, 0, 0x0E,0x00,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9900, 7877, 0, 0, 0x0E,0x01,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9920, 7877, 0, 0, 0x0E,0x02,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9939, 7877, 0, 0, 0x0E,0x03,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9960, 7877, 0, 0, 0x0E,0x04,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9979, 7877, 0, 0, 0x0E,0x05,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {10003, 7877, 0, 0, 0x0E,0x05,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {10028, 7877, 0, 0, 0x0E,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {10049, 7877, 0, 0, 0x0E,0x06,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {10072, 7877, 0, 0, 0x0E,0x06,0x07,0x02,EVENT_OPTION_NONE_MASK}
+, {10093, 7877, 0, 0, 0x0E,0x06,0x07,0x03,EVENT_OPTION_NONE_MASK}
+, {10116, 7877, 0, 0, 0x0E,0x06,0x07,0x04,EVENT_OPTION_NONE_MASK}
+, {10142, 7877, 0, 0, 0x0E,0x06,0x07,0x05,EVENT_OPTION_NONE_MASK}
+, {10167, 7877, 0, 0, 0x0E,0x06,0x07,0x07,EVENT_OPTION_NONE_MASK}
+, {10195, 7877, 0, 0, 0x0E,0x07,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {10215, 7877, 0, 0, 0x0F,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10235, 7877, 0, 0, 0x0F,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10255, 7877, 0, 0, 0x0F,0x02,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10274, 7877, 0, 0, 0x0F,0x03,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10295, 7877, 0, 0, 0x0F,0x04,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10314, 7877, 0, 0, 0x0F,0x05,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10338, 7877, 0, 0, 0x0F,0x05,0x08,0x01,EVENT_OPTION_NONE_MASK}
+, {10363, 7877, 0, 0, 0x0F,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10384, 7877, 0, 0, 0x0F,0x06,0x08,0x01,EVENT_OPTION_NONE_MASK}
+, {10407, 7877, 0, 0, 0x0F,0x06,0x08,0x02,EVENT_OPTION_NONE_MASK}
+, {10428, 7877, 0, 0, 0x0F,0x06,0x08,0x03,EVENT_OPTION_NONE_MASK}
+, {10451, 7877, 0, 0, 0x0F,0x06,0x08,0x04,EVENT_OPTION_NONE_MASK}
+, {10477, 7877, 0, 0, 0x0F,0x06,0x08,0x05,EVENT_OPTION_NONE_MASK}
+, {10502, 7877, 0, 0, 0x0F,0x06,0x08,0x07,EVENT_OPTION_NONE_MASK}
+, {10530, 7877, 0, 0, 0x0F,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10550, 7877, 0, 0, 0x10,0x00,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10570, 7877, 0, 0, 0x10,0x01,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10590, 7877, 0, 0, 0x10,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10609, 7877, 0, 0, 0x10,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10630, 7877, 0, 0, 0x10,0x04,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10649, 7877, 0, 0, 0x10,0x05,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10673, 7877, 0, 0, 0x10,0x05,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {10698, 7877, 0, 0, 0x10,0x06,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10719, 7877, 0, 0, 0x10,0x06,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {10742, 7877, 0, 0, 0x10,0x06,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {10763, 7877, 0, 0, 0x10,0x06,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {10786, 7877, 0, 0, 0x10,0x06,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {10812, 7877, 0, 0, 0x10,0x06,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {10837, 7877, 0, 0, 0x10,0x06,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {10865, 7877, 0, 0, 0x10,0x07,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {10885, 7877, 0, 0, 0x18,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10895, 7877, 0, 0, 0x1D,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10909, 7877, 0, 0, 0x08,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10928, 7877, 0, 0, 0x0C,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10939, 7877, 0, 0, 0x17,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10948, 7877, 0, 0, 0x15,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10959, 7877, 0, 0, 0x14,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10968, 7877, 0, 0, 0x13,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10978, 7877, 0, 0, 0x11,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {10990, 7877, 0, 0, 0x16,0x00,0x0B,0x00,EVENT_OPTION_NONE_MASK}
+, {11010, 7877, 0, 0, 0x16,0x01,0x0B,0x00,EVENT_OPTION_NONE_MASK}
+, {11030, 7877, 0, 0, 0x0B,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {11042, 7877, 0, 0, 0x07,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {11059, 7877, 0, 0, 0x02,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {11071, 7877, 0, 0, 0x03,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {11084, 7877, 0, 0, 0x1C,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {11104, 7877, 0, 0, 0x05,0x03,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {11133, 7877, 0, 0, 0x05,0x02,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {11162, 7877, 0, 0, 0x05,0x01,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {11185, 7877, 0, 0, 0x05,0x00,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {11208, 7877, 0, 0, 0x05,0x03,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {11239, 7877, 0, 0, 0x05,0x03,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {11270, 7877, 0, 0, 0x05,0x03,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {11301, 7877, 0, 0, 0x05,0x03,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {11332, 7877, 0, 0, 0x05,0x02,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {11363, 7877, 0, 0, 0x05,0x02,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {11394, 7877, 0, 0, 0x05,0x02,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {11425, 7877, 0, 0, 0x05,0x02,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {11456, 7877, 0, 0, 0x05,0x01,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {11481, 7877, 0, 0, 0x05,0x01,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {11506, 7877, 0, 0, 0x05,0x01,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {11531, 7877, 0, 0, 0x05,0x01,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {11556, 7877, 0, 0, 0x05,0x00,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {11581, 7877, 0, 0, 0x05,0x00,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {11606, 7877, 0, 0, 0x05,0x00,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {11631, 7877, 0, 0, 0x05,0x00,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {11656, 7877, 0, 0, 0x04,0x03,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {11685, 7877, 0, 0, 0x04,0x02,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {11714, 7877, 0, 0, 0x04,0x01,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {11737, 7877, 0, 0, 0x04,0x00,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {11760, 7877, 0, 0, 0x04,0x03,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {11791, 7877, 0, 0, 0x04,0x03,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {11822, 7877, 0, 0, 0x04,0x03,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {11853, 7877, 0, 0, 0x04,0x03,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {11884, 7877, 0, 0, 0x04,0x02,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {11915, 7877, 0, 0, 0x04,0x02,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {11946, 7877, 0, 0, 0x04,0x02,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {11977, 7877, 0, 0, 0x04,0x02,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {12008, 7877, 0, 0, 0x04,0x01,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {12033, 7877, 0, 0, 0x04,0x01,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {12058, 7877, 0, 0, 0x04,0x01,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {12083, 7877, 0, 0, 0x04,0x01,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {12108, 7877, 0, 0, 0x04,0x00,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {12133, 7877, 0, 0, 0x04,0x00,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {12158, 7877, 0, 0, 0x04,0x00,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {12183, 7877, 0, 0, 0x04,0x00,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {12208, 7877, 0, 0, 0x12,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12219, 7877, 0, 0, 0x19,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12235, 12255, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12271, 12285, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12301, 12255, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12311, 12255, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12323, 12255, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12343, 12356, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12372, 12387, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12403, 12255, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12416, 12356, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12429, 12387, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12444, 12255, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12454, 12255, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12467, 12255, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12476, 12356, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12492, 12356, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12512, 12356, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12528, 12356, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12552, 12356, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12571, 12356, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12591, 12356, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12619, 12356, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12642, 12356, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12665, 12356, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12680, 12356, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12695, 12285, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12709, 12255, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12722, 12387, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12742, 12387, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12760, 12285, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12772, 12285, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12784, 12356, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12797, 12285, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12813, 12387, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12838, 12356, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12858, 12356, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12879, 12356, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12893, 12387, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12914, 12356, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12930, 12356, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {12947, 12255, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12964, 12255, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12981, 12356, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12995, 12387, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13011, 12387, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13018, 12387, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13029, 12387, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13036, 12387, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13051, 12387, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13073, 12387, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13083, 12387, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13089, 13119, 0, 0, 0x00,0x00,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {13125, 13119, 0, 0, 0x00,0x00,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {13155, 13119, 0, 0, 0x00,0x00,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {13190, 13119, 0, 0, 0x00,0x00,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {13220, 13119, 0, 0, 0x00,0x00,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {13250, 13119, 0, 0, 0x00,0x00,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {13284, 13119, 0, 0, 0x00,0x00,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {13318, 13119, 0, 0, 0x00,0x00,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {13348, 13119, 0, 0, 0x00,0x01,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {13378, 13119, 0, 0, 0x00,0x01,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {13408, 13119, 0, 0, 0x00,0x01,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {13443, 13119, 0, 0, 0x00,0x01,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {13473, 13119, 0, 0, 0x00,0x01,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {13503, 13119, 0, 0, 0x00,0x01,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {13537, 13119, 0, 0, 0x00,0x01,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {13571, 13119, 0, 0, 0x00,0x01,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {13601, 13119, 0, 0, 0x00,0x06,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {13631, 13119, 0, 0, 0x00,0x06,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {13661, 13119, 0, 0, 0x00,0x06,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {13696, 13119, 0, 0, 0x00,0x06,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {13726, 13119, 0, 0, 0x00,0x06,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {13756, 13119, 0, 0, 0x00,0x06,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {13790, 13119, 0, 0, 0x00,0x06,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {13824, 13119, 0, 0, 0x00,0x06,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {13854, 13119, 0, 0, 0x00,0x07,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {13884, 13119, 0, 0, 0x00,0x07,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {13914, 13119, 0, 0, 0x00,0x07,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {13949, 13119, 0, 0, 0x00,0x07,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {13979, 13119, 0, 0, 0x00,0x07,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {14009, 13119, 0, 0, 0x00,0x07,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {14043, 13119, 0, 0, 0x00,0x07,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {14077, 13119, 0, 0, 0x00,0x07,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {14107, 13119, 0, 0, 0x00,0x0C,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14137, 13119, 0, 0, 0x00,0x0C,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14167, 13119, 0, 0, 0x00,0x0C,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {14202, 13119, 0, 0, 0x00,0x0C,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {14232, 13119, 0, 0, 0x00,0x0C,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {14262, 13119, 0, 0, 0x00,0x0C,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {14296, 13119, 0, 0, 0x00,0x0C,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {14330, 13119, 0, 0, 0x00,0x0C,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {14360, 13119, 0, 0, 0x00,0x0D,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14390, 13119, 0, 0, 0x00,0x0D,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14420, 13119, 0, 0, 0x00,0x0D,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {14455, 13119, 0, 0, 0x00,0x0D,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {14485, 13119, 0, 0, 0x00,0x0D,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {14515, 13119, 0, 0, 0x00,0x0D,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {14549, 13119, 0, 0, 0x00,0x0D,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {14583, 13119, 0, 0, 0x00,0x0D,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {14613, 13119, 0, 0, 0x00,0x12,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14643, 13119, 0, 0, 0x00,0x12,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14673, 13119, 0, 0, 0x00,0x12,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {14708, 13119, 0, 0, 0x00,0x12,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {14738, 13119, 0, 0, 0x00,0x12,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {14768, 13119, 0, 0, 0x00,0x12,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {14802, 13119, 0, 0, 0x00,0x12,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {14836, 13119, 0, 0, 0x00,0x12,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {14866, 13119, 0, 0, 0x00,0x13,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14896, 13119, 0, 0, 0x00,0x13,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14926, 13119, 0, 0, 0x00,0x13,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {14961, 13119, 0, 0, 0x00,0x13,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {14991, 13119, 0, 0, 0x00,0x13,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15021, 13119, 0, 0, 0x00,0x13,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15055, 13119, 0, 0, 0x00,0x13,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15089, 13119, 0, 0, 0x00,0x13,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {15119, 15149, 0, 0, 0x00,0x00,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15155, 15149, 0, 0, 0x00,0x00,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15185, 15149, 0, 0, 0x00,0x00,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15220, 15149, 0, 0, 0x00,0x00,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15250, 15149, 0, 0, 0x00,0x00,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15280, 15149, 0, 0, 0x00,0x00,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15314, 15149, 0, 0, 0x00,0x00,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15348, 15149, 0, 0, 0x00,0x00,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {15378, 15149, 0, 0, 0x00,0x01,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15408, 15149, 0, 0, 0x00,0x01,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15438, 15149, 0, 0, 0x00,0x01,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15473, 15149, 0, 0, 0x00,0x01,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15503, 15149, 0, 0, 0x00,0x01,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15533, 15149, 0, 0, 0x00,0x01,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15567, 15149, 0, 0, 0x00,0x01,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15601, 15149, 0, 0, 0x00,0x01,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {15631, 15149, 0, 0, 0x00,0x06,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15661, 15149, 0, 0, 0x00,0x06,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15691, 15149, 0, 0, 0x00,0x06,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15726, 15149, 0, 0, 0x00,0x06,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15756, 15149, 0, 0, 0x00,0x06,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15786, 15149, 0, 0, 0x00,0x06,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15820, 15149, 0, 0, 0x00,0x06,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15854, 15149, 0, 0, 0x00,0x06,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {15884, 15149, 0, 0, 0x00,0x07,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15914, 15149, 0, 0, 0x00,0x07,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15944, 15149, 0, 0, 0x00,0x07,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15979, 15149, 0, 0, 0x00,0x07,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16009, 15149, 0, 0, 0x00,0x07,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16039, 15149, 0, 0, 0x00,0x07,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16073, 15149, 0, 0, 0x00,0x07,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16107, 15149, 0, 0, 0x00,0x07,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {16137, 15149, 0, 0, 0x00,0x0C,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16167, 15149, 0, 0, 0x00,0x0C,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16197, 15149, 0, 0, 0x00,0x0C,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16232, 15149, 0, 0, 0x00,0x0C,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16262, 15149, 0, 0, 0x00,0x0C,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16292, 15149, 0, 0, 0x00,0x0C,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16326, 15149, 0, 0, 0x00,0x0C,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16360, 15149, 0, 0, 0x00,0x0C,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {16390, 15149, 0, 0, 0x00,0x0D,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16420, 15149, 0, 0, 0x00,0x0D,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16450, 15149, 0, 0, 0x00,0x0D,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16485, 15149, 0, 0, 0x00,0x0D,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16515, 15149, 0, 0, 0x00,0x0D,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16545, 15149, 0, 0, 0x00,0x0D,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16579, 15149, 0, 0, 0x00,0x0D,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16613, 15149, 0, 0, 0x00,0x0D,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {16643, 15149, 0, 0, 0x00,0x12,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16673, 15149, 0, 0, 0x00,0x12,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16703, 15149, 0, 0, 0x00,0x12,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16738, 15149, 0, 0, 0x00,0x12,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16768, 15149, 0, 0, 0x00,0x12,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16798, 15149, 0, 0, 0x00,0x12,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16832, 15149, 0, 0, 0x00,0x12,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16866, 15149, 0, 0, 0x00,0x12,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {16896, 15149, 0, 0, 0x00,0x13,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16926, 15149, 0, 0, 0x00,0x13,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16956, 15149, 0, 0, 0x00,0x13,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16991, 15149, 0, 0, 0x00,0x13,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {17021, 15149, 0, 0, 0x00,0x13,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {17051, 15149, 0, 0, 0x00,0x13,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {17085, 15149, 0, 0, 0x00,0x13,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {17119, 15149, 0, 0, 0x00,0x13,0x7F,0x09,EVENT_OPTION_NONE_MASK}
+, {17149, 13119, 0, 0, 0x00,0x00,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {17182, 13119, 0, 0, 0x00,0x00,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {17215, 13119, 0, 0, 0x00,0x00,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {17244, 13119, 0, 0, 0x00,0x00,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {17277, 13119, 0, 0, 0x00,0x00,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {17306, 13119, 0, 0, 0x00,0x00,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {17335, 13119, 0, 0, 0x00,0x00,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {17364, 13119, 0, 0, 0x00,0x00,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {17397, 13119, 0, 0, 0x00,0x01,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {17430, 13119, 0, 0, 0x00,0x01,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {17463, 13119, 0, 0, 0x00,0x01,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {17492, 13119, 0, 0, 0x00,0x01,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {17525, 13119, 0, 0, 0x00,0x01,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {17554, 13119, 0, 0, 0x00,0x01,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {17583, 13119, 0, 0, 0x00,0x01,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {17612, 13119, 0, 0, 0x00,0x01,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {17645, 13119, 0, 0, 0x00,0x06,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {17678, 13119, 0, 0, 0x00,0x06,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {17711, 13119, 0, 0, 0x00,0x06,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {17740, 13119, 0, 0, 0x00,0x06,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {17773, 13119, 0, 0, 0x00,0x06,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {17802, 13119, 0, 0, 0x00,0x06,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {17831, 13119, 0, 0, 0x00,0x06,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {17860, 13119, 0, 0, 0x00,0x06,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {17893, 13119, 0, 0, 0x00,0x07,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {17926, 13119, 0, 0, 0x00,0x07,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {17959, 13119, 0, 0, 0x00,0x07,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {17988, 13119, 0, 0, 0x00,0x07,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {18021, 13119, 0, 0, 0x00,0x07,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {18050, 13119, 0, 0, 0x00,0x07,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {18079, 13119, 0, 0, 0x00,0x07,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {18108, 13119, 0, 0, 0x00,0x07,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {18141, 13119, 0, 0, 0x00,0x0C,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18174, 13119, 0, 0, 0x00,0x0C,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {18207, 13119, 0, 0, 0x00,0x0C,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {18236, 13119, 0, 0, 0x00,0x0C,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {18269, 13119, 0, 0, 0x00,0x0C,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {18298, 13119, 0, 0, 0x00,0x0C,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {18327, 13119, 0, 0, 0x00,0x0C,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {18356, 13119, 0, 0, 0x00,0x0C,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {18389, 13119, 0, 0, 0x00,0x0D,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18422, 13119, 0, 0, 0x00,0x0D,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {18455, 13119, 0, 0, 0x00,0x0D,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {18484, 13119, 0, 0, 0x00,0x0D,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {18517, 13119, 0, 0, 0x00,0x0D,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {18546, 13119, 0, 0, 0x00,0x0D,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {18575, 13119, 0, 0, 0x00,0x0D,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {18604, 13119, 0, 0, 0x00,0x0D,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {18637, 13119, 0, 0, 0x00,0x12,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18670, 13119, 0, 0, 0x00,0x12,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {18703, 13119, 0, 0, 0x00,0x12,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {18732, 13119, 0, 0, 0x00,0x12,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {18765, 13119, 0, 0, 0x00,0x12,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {18794, 13119, 0, 0, 0x00,0x12,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {18823, 13119, 0, 0, 0x00,0x12,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {18852, 13119, 0, 0, 0x00,0x12,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {18885, 13119, 0, 0, 0x00,0x13,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18918, 13119, 0, 0, 0x00,0x13,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {18951, 13119, 0, 0, 0x00,0x13,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {18980, 13119, 0, 0, 0x00,0x13,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19013, 13119, 0, 0, 0x00,0x13,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19042, 13119, 0, 0, 0x00,0x13,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19071, 13119, 0, 0, 0x00,0x13,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19100, 13119, 0, 0, 0x00,0x13,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19133, 15149, 0, 0, 0x00,0x00,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19166, 15149, 0, 0, 0x00,0x00,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19199, 15149, 0, 0, 0x00,0x00,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19228, 15149, 0, 0, 0x00,0x00,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19261, 15149, 0, 0, 0x00,0x00,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19290, 15149, 0, 0, 0x00,0x00,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19319, 15149, 0, 0, 0x00,0x00,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19348, 15149, 0, 0, 0x00,0x00,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19381, 15149, 0, 0, 0x00,0x01,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19414, 15149, 0, 0, 0x00,0x01,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19447, 15149, 0, 0, 0x00,0x01,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19476, 15149, 0, 0, 0x00,0x01,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19509, 15149, 0, 0, 0x00,0x01,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19538, 15149, 0, 0, 0x00,0x01,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19567, 15149, 0, 0, 0x00,0x01,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19596, 15149, 0, 0, 0x00,0x01,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19629, 15149, 0, 0, 0x00,0x06,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19662, 15149, 0, 0, 0x00,0x06,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19695, 15149, 0, 0, 0x00,0x06,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19724, 15149, 0, 0, 0x00,0x06,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19757, 15149, 0, 0, 0x00,0x06,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19786, 15149, 0, 0, 0x00,0x06,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19815, 15149, 0, 0, 0x00,0x06,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19844, 15149, 0, 0, 0x00,0x06,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19877, 15149, 0, 0, 0x00,0x07,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19910, 15149, 0, 0, 0x00,0x07,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19943, 15149, 0, 0, 0x00,0x07,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19972, 15149, 0, 0, 0x00,0x07,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20005, 15149, 0, 0, 0x00,0x07,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20034, 15149, 0, 0, 0x00,0x07,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20063, 15149, 0, 0, 0x00,0x07,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20092, 15149, 0, 0, 0x00,0x07,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20125, 15149, 0, 0, 0x00,0x0C,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20158, 15149, 0, 0, 0x00,0x0C,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20191, 15149, 0, 0, 0x00,0x0C,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20220, 15149, 0, 0, 0x00,0x0C,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20253, 15149, 0, 0, 0x00,0x0C,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20282, 15149, 0, 0, 0x00,0x0C,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20311, 15149, 0, 0, 0x00,0x0C,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20340, 15149, 0, 0, 0x00,0x0C,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20373, 15149, 0, 0, 0x00,0x0D,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20406, 15149, 0, 0, 0x00,0x0D,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20439, 15149, 0, 0, 0x00,0x0D,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20468, 15149, 0, 0, 0x00,0x0D,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20501, 15149, 0, 0, 0x00,0x0D,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20530, 15149, 0, 0, 0x00,0x0D,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20559, 15149, 0, 0, 0x00,0x0D,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20588, 15149, 0, 0, 0x00,0x0D,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20621, 15149, 0, 0, 0x00,0x12,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20654, 15149, 0, 0, 0x00,0x12,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20687, 15149, 0, 0, 0x00,0x12,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20716, 15149, 0, 0, 0x00,0x12,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20749, 15149, 0, 0, 0x00,0x12,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20778, 15149, 0, 0, 0x00,0x12,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20807, 15149, 0, 0, 0x00,0x12,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20836, 15149, 0, 0, 0x00,0x12,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20869, 15149, 0, 0, 0x00,0x13,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20902, 15149, 0, 0, 0x00,0x13,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20935, 15149, 0, 0, 0x00,0x13,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20964, 15149, 0, 0, 0x00,0x13,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20997, 15149, 0, 0, 0x00,0x13,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {21026, 15149, 0, 0, 0x00,0x13,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {21055, 15149, 0, 0, 0x00,0x13,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {21084, 15149, 0, 0, 0x00,0x13,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {21117, 13119, 0, 0, 0x00,0x00,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21144, 13119, 0, 0, 0x00,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21171, 13119, 0, 0, 0x00,0x06,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21198, 13119, 0, 0, 0x00,0x07,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21225, 13119, 0, 0, 0x00,0x0C,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21252, 13119, 0, 0, 0x00,0x0D,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21279, 13119, 0, 0, 0x00,0x12,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21306, 13119, 0, 0, 0x00,0x13,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21333, 15149, 0, 0, 0x00,0x00,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21360, 15149, 0, 0, 0x00,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21387, 15149, 0, 0, 0x00,0x06,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21414, 15149, 0, 0, 0x00,0x07,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21441, 15149, 0, 0, 0x00,0x0C,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21468, 15149, 0, 0, 0x00,0x0D,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21495, 15149, 0, 0, 0x00,0x12,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21522, 15149, 0, 0, 0x00,0x13,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {21549, 13119, 0, 0, 0x00,0x00,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {21584, 13119, 0, 0, 0x00,0x00,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {21619, 13119, 0, 0, 0x00,0x00,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {21650, 13119, 0, 0, 0x00,0x00,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {21685, 13119, 0, 0, 0x00,0x00,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {21716, 13119, 0, 0, 0x00,0x00,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {21747, 13119, 0, 0, 0x00,0x00,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {21778, 13119, 0, 0, 0x00,0x00,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {21813, 13119, 0, 0, 0x00,0x01,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {21848, 13119, 0, 0, 0x00,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {21883, 13119, 0, 0, 0x00,0x01,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {21914, 13119, 0, 0, 0x00,0x01,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {21949, 13119, 0, 0, 0x00,0x01,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {21980, 13119, 0, 0, 0x00,0x01,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {22011, 13119, 0, 0, 0x00,0x01,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {22042, 13119, 0, 0, 0x00,0x01,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {22077, 13119, 0, 0, 0x00,0x06,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {22112, 13119, 0, 0, 0x00,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {22147, 13119, 0, 0, 0x00,0x06,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {22178, 13119, 0, 0, 0x00,0x06,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {22213, 13119, 0, 0, 0x00,0x06,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {22244, 13119, 0, 0, 0x00,0x06,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {22275, 13119, 0, 0, 0x00,0x06,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {22306, 13119, 0, 0, 0x00,0x06,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {22341, 13119, 0, 0, 0x00,0x07,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {22376, 13119, 0, 0, 0x00,0x07,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {22411, 13119, 0, 0, 0x00,0x07,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {22442, 13119, 0, 0, 0x00,0x07,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {22477, 13119, 0, 0, 0x00,0x07,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {22508, 13119, 0, 0, 0x00,0x07,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {22539, 13119, 0, 0, 0x00,0x07,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {22570, 13119, 0, 0, 0x00,0x07,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {22605, 13119, 0, 0, 0x00,0x0C,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {22640, 13119, 0, 0, 0x00,0x0C,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {22675, 13119, 0, 0, 0x00,0x0C,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {22706, 13119, 0, 0, 0x00,0x0C,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {22741, 13119, 0, 0, 0x00,0x0C,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {22772, 13119, 0, 0, 0x00,0x0C,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {22803, 13119, 0, 0, 0x00,0x0C,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {22834, 13119, 0, 0, 0x00,0x0C,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {22869, 13119, 0, 0, 0x00,0x0D,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {22904, 13119, 0, 0, 0x00,0x0D,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {22939, 13119, 0, 0, 0x00,0x0D,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {22970, 13119, 0, 0, 0x00,0x0D,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23005, 13119, 0, 0, 0x00,0x0D,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23036, 13119, 0, 0, 0x00,0x0D,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23067, 13119, 0, 0, 0x00,0x0D,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23098, 13119, 0, 0, 0x00,0x0D,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23133, 13119, 0, 0, 0x00,0x12,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23168, 13119, 0, 0, 0x00,0x12,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23203, 13119, 0, 0, 0x00,0x12,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23234, 13119, 0, 0, 0x00,0x12,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23269, 13119, 0, 0, 0x00,0x12,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23300, 13119, 0, 0, 0x00,0x12,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23331, 13119, 0, 0, 0x00,0x12,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23362, 13119, 0, 0, 0x00,0x12,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23397, 13119, 0, 0, 0x00,0x13,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23432, 13119, 0, 0, 0x00,0x13,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23467, 13119, 0, 0, 0x00,0x13,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23498, 13119, 0, 0, 0x00,0x13,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23533, 13119, 0, 0, 0x00,0x13,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23564, 13119, 0, 0, 0x00,0x13,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23595, 13119, 0, 0, 0x00,0x13,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23626, 13119, 0, 0, 0x00,0x13,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23661, 15149, 0, 0, 0x00,0x00,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23696, 15149, 0, 0, 0x00,0x00,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23731, 15149, 0, 0, 0x00,0x00,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23762, 15149, 0, 0, 0x00,0x00,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23797, 15149, 0, 0, 0x00,0x00,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23828, 15149, 0, 0, 0x00,0x00,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23859, 15149, 0, 0, 0x00,0x00,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23890, 15149, 0, 0, 0x00,0x00,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23925, 15149, 0, 0, 0x00,0x01,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23960, 15149, 0, 0, 0x00,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23995, 15149, 0, 0, 0x00,0x01,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24026, 15149, 0, 0, 0x00,0x01,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24061, 15149, 0, 0, 0x00,0x01,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24092, 15149, 0, 0, 0x00,0x01,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24123, 15149, 0, 0, 0x00,0x01,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24154, 15149, 0, 0, 0x00,0x01,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24189, 15149, 0, 0, 0x00,0x06,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24224, 15149, 0, 0, 0x00,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24259, 15149, 0, 0, 0x00,0x06,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24290, 15149, 0, 0, 0x00,0x06,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24325, 15149, 0, 0, 0x00,0x06,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24356, 15149, 0, 0, 0x00,0x06,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24387, 15149, 0, 0, 0x00,0x06,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24418, 15149, 0, 0, 0x00,0x06,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24453, 15149, 0, 0, 0x00,0x07,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24488, 15149, 0, 0, 0x00,0x07,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24523, 15149, 0, 0, 0x00,0x07,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24554, 15149, 0, 0, 0x00,0x07,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24589, 15149, 0, 0, 0x00,0x07,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24620, 15149, 0, 0, 0x00,0x07,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24651, 15149, 0, 0, 0x00,0x07,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24682, 15149, 0, 0, 0x00,0x07,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24717, 15149, 0, 0, 0x00,0x0C,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24752, 15149, 0, 0, 0x00,0x0C,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24787, 15149, 0, 0, 0x00,0x0C,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24818, 15149, 0, 0, 0x00,0x0C,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24853, 15149, 0, 0, 0x00,0x0C,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24884, 15149, 0, 0, 0x00,0x0C,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24915, 15149, 0, 0, 0x00,0x0C,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24946, 15149, 0, 0, 0x00,0x0C,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24981, 15149, 0, 0, 0x00,0x0D,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25016, 15149, 0, 0, 0x00,0x0D,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25051, 15149, 0, 0, 0x00,0x0D,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25082, 15149, 0, 0, 0x00,0x0D,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25117, 15149, 0, 0, 0x00,0x0D,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25148, 15149, 0, 0, 0x00,0x0D,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25179, 15149, 0, 0, 0x00,0x0D,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25210, 15149, 0, 0, 0x00,0x0D,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25245, 15149, 0, 0, 0x00,0x12,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25280, 15149, 0, 0, 0x00,0x12,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25315, 15149, 0, 0, 0x00,0x12,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25346, 15149, 0, 0, 0x00,0x12,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25381, 15149, 0, 0, 0x00,0x12,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25412, 15149, 0, 0, 0x00,0x12,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25443, 15149, 0, 0, 0x00,0x12,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25474, 15149, 0, 0, 0x00,0x12,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25509, 15149, 0, 0, 0x00,0x13,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25544, 15149, 0, 0, 0x00,0x13,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25579, 15149, 0, 0, 0x00,0x13,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25610, 15149, 0, 0, 0x00,0x13,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25645, 15149, 0, 0, 0x00,0x13,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25676, 15149, 0, 0, 0x00,0x13,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25707, 15149, 0, 0, 0x00,0x13,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25738, 15149, 0, 0, 0x00,0x13,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25773, 13119, 0, 0, 0x00,0x00,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25801, 13119, 0, 0, 0x00,0x01,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25829, 13119, 0, 0, 0x00,0x06,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25857, 13119, 0, 0, 0x00,0x07,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25885, 13119, 0, 0, 0x00,0x0C,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25913, 13119, 0, 0, 0x00,0x0D,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25941, 13119, 0, 0, 0x00,0x12,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25969, 13119, 0, 0, 0x00,0x13,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {25997, 15149, 0, 0, 0x00,0x00,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26025, 15149, 0, 0, 0x00,0x01,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26053, 15149, 0, 0, 0x00,0x06,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26081, 15149, 0, 0, 0x00,0x07,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26109, 15149, 0, 0, 0x00,0x0C,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26137, 15149, 0, 0, 0x00,0x0D,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26165, 15149, 0, 0, 0x00,0x12,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26193, 15149, 0, 0, 0x00,0x13,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {26221, 13119, 0, 0, 0x00,0x00,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26250, 13119, 0, 0, 0x00,0x01,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26279, 13119, 0, 0, 0x00,0x06,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26308, 13119, 0, 0, 0x00,0x07,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26337, 13119, 0, 0, 0x00,0x0C,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26366, 13119, 0, 0, 0x00,0x0D,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26395, 13119, 0, 0, 0x00,0x12,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26424, 13119, 0, 0, 0x00,0x13,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26453, 15149, 0, 0, 0x00,0x00,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26482, 15149, 0, 0, 0x00,0x01,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26511, 15149, 0, 0, 0x00,0x06,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26540, 15149, 0, 0, 0x00,0x07,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26569, 15149, 0, 0, 0x00,0x0C,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26598, 15149, 0, 0, 0x00,0x0D,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26627, 15149, 0, 0, 0x00,0x12,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26656, 15149, 0, 0, 0x00,0x13,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {26685, 13119, 0, 0, 0x00,0x00,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26709, 13119, 0, 0, 0x00,0x01,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26733, 13119, 0, 0, 0x00,0x06,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26757, 13119, 0, 0, 0x00,0x07,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26781, 13119, 0, 0, 0x00,0x0C,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26805, 13119, 0, 0, 0x00,0x0D,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26829, 13119, 0, 0, 0x00,0x12,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26853, 13119, 0, 0, 0x00,0x13,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26877, 15149, 0, 0, 0x00,0x00,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26901, 15149, 0, 0, 0x00,0x01,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26925, 15149, 0, 0, 0x00,0x06,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26949, 15149, 0, 0, 0x00,0x07,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26973, 15149, 0, 0, 0x00,0x0C,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {26997, 15149, 0, 0, 0x00,0x0D,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {27021, 15149, 0, 0, 0x00,0x12,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {27045, 15149, 0, 0, 0x00,0x13,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {27069, 13119, 0, 0, 0x01,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27095, 13119, 0, 0, 0x01,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27121, 13119, 0, 0, 0x01,0x08,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27147, 13119, 0, 0, 0x01,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27173, 13119, 0, 0, 0x01,0x0E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27199, 13119, 0, 0, 0x01,0x0F,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27225, 13119, 0, 0, 0x01,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27251, 13119, 0, 0, 0x01,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27277, 15149, 0, 0, 0x01,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27303, 15149, 0, 0, 0x01,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27329, 15149, 0, 0, 0x01,0x08,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27355, 15149, 0, 0, 0x01,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27381, 15149, 0, 0, 0x01,0x0E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27407, 15149, 0, 0, 0x01,0x0F,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27433, 15149, 0, 0, 0x01,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27459, 15149, 0, 0, 0x01,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {27485, 13119, 0, 0, 0x01,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {27524, 13119, 0, 0, 0x01,0x02,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {27563, 13119, 0, 0, 0x01,0x02,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {27602, 13119, 0, 0, 0x01,0x02,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {27641, 13119, 0, 0, 0x01,0x02,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {27680, 13119, 0, 0, 0x01,0x02,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {27719, 13119, 0, 0, 0x01,0x02,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {27758, 13119, 0, 0, 0x01,0x02,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {27797, 13119, 0, 0, 0x01,0x02,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {27836, 13119, 0, 0, 0x01,0x02,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {27875, 13119, 0, 0, 0x01,0x02,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {27914, 13119, 0, 0, 0x01,0x02,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {27953, 13119, 0, 0, 0x01,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {27992, 13119, 0, 0, 0x01,0x03,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {28031, 13119, 0, 0, 0x01,0x03,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {28070, 13119, 0, 0, 0x01,0x03,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {28109, 13119, 0, 0, 0x01,0x03,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {28148, 13119, 0, 0, 0x01,0x03,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {28187, 13119, 0, 0, 0x01,0x03,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {28226, 13119, 0, 0, 0x01,0x03,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {28265, 13119, 0, 0, 0x01,0x03,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {28304, 13119, 0, 0, 0x01,0x03,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {28343, 13119, 0, 0, 0x01,0x03,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {28382, 13119, 0, 0, 0x01,0x03,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {28421, 13119, 0, 0, 0x01,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {28460, 13119, 0, 0, 0x01,0x08,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {28499, 13119, 0, 0, 0x01,0x08,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {28538, 13119, 0, 0, 0x01,0x08,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {28577, 13119, 0, 0, 0x01,0x08,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {28616, 13119, 0, 0, 0x01,0x08,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {28655, 13119, 0, 0, 0x01,0x08,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {28694, 13119, 0, 0, 0x01,0x08,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {28733, 13119, 0, 0, 0x01,0x08,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {28772, 13119, 0, 0, 0x01,0x08,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {28811, 13119, 0, 0, 0x01,0x08,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {28850, 13119, 0, 0, 0x01,0x08,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {28889, 13119, 0, 0, 0x01,0x09,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {28928, 13119, 0, 0, 0x01,0x09,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {28967, 13119, 0, 0, 0x01,0x09,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {29006, 13119, 0, 0, 0x01,0x09,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {29045, 13119, 0, 0, 0x01,0x09,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {29084, 13119, 0, 0, 0x01,0x09,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {29123, 13119, 0, 0, 0x01,0x09,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {29162, 13119, 0, 0, 0x01,0x09,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {29201, 13119, 0, 0, 0x01,0x09,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {29240, 13119, 0, 0, 0x01,0x09,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {29279, 13119, 0, 0, 0x01,0x09,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {29318, 13119, 0, 0, 0x01,0x09,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {29357, 13119, 0, 0, 0x01,0x0E,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {29396, 13119, 0, 0, 0x01,0x0E,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {29435, 13119, 0, 0, 0x01,0x0E,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {29474, 13119, 0, 0, 0x01,0x0E,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {29513, 13119, 0, 0, 0x01,0x0E,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {29552, 13119, 0, 0, 0x01,0x0E,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {29591, 13119, 0, 0, 0x01,0x0E,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {29630, 13119, 0, 0, 0x01,0x0E,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {29669, 13119, 0, 0, 0x01,0x0E,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {29708, 13119, 0, 0, 0x01,0x0E,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {29747, 13119, 0, 0, 0x01,0x0E,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {29786, 13119, 0, 0, 0x01,0x0E,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {29825, 13119, 0, 0, 0x01,0x0F,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {29864, 13119, 0, 0, 0x01,0x0F,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {29903, 13119, 0, 0, 0x01,0x0F,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {29942, 13119, 0, 0, 0x01,0x0F,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {29981, 13119, 0, 0, 0x01,0x0F,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {30020, 13119, 0, 0, 0x01,0x0F,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {30059, 13119, 0, 0, 0x01,0x0F,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {30098, 13119, 0, 0, 0x01,0x0F,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {30137, 13119, 0, 0, 0x01,0x0F,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {30176, 13119, 0, 0, 0x01,0x0F,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {30215, 13119, 0, 0, 0x01,0x0F,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {30254, 13119, 0, 0, 0x01,0x0F,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {30293, 13119, 0, 0, 0x01,0x14,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {30332, 13119, 0, 0, 0x01,0x14,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {30371, 13119, 0, 0, 0x01,0x14,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {30410, 13119, 0, 0, 0x01,0x14,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {30449, 13119, 0, 0, 0x01,0x14,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {30488, 13119, 0, 0, 0x01,0x14,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {30527, 13119, 0, 0, 0x01,0x14,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {30566, 13119, 0, 0, 0x01,0x14,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {30605, 13119, 0, 0, 0x01,0x14,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {30644, 13119, 0, 0, 0x01,0x14,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {30683, 13119, 0, 0, 0x01,0x14,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {30722, 13119, 0, 0, 0x01,0x14,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {30761, 13119, 0, 0, 0x01,0x15,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {30800, 13119, 0, 0, 0x01,0x15,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {30839, 13119, 0, 0, 0x01,0x15,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {30878, 13119, 0, 0, 0x01,0x15,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {30917, 13119, 0, 0, 0x01,0x15,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {30956, 13119, 0, 0, 0x01,0x15,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {30995, 13119, 0, 0, 0x01,0x15,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {31034, 13119, 0, 0, 0x01,0x15,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {31073, 13119, 0, 0, 0x01,0x15,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {31112, 13119, 0, 0, 0x01,0x15,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {31151, 13119, 0, 0, 0x01,0x15,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {31190, 13119, 0, 0, 0x01,0x15,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {31229, 15149, 0, 0, 0x01,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {31268, 15149, 0, 0, 0x01,0x02,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {31307, 15149, 0, 0, 0x01,0x02,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {31346, 15149, 0, 0, 0x01,0x02,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {31385, 15149, 0, 0, 0x01,0x02,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {31424, 15149, 0, 0, 0x01,0x02,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {31463, 15149, 0, 0, 0x01,0x02,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {31502, 15149, 0, 0, 0x01,0x02,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {31541, 15149, 0, 0, 0x01,0x02,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {31580, 15149, 0, 0, 0x01,0x02,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {31619, 15149, 0, 0, 0x01,0x02,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {31658, 15149, 0, 0, 0x01,0x02,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {31697, 15149, 0, 0, 0x01,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {31736, 15149, 0, 0, 0x01,0x03,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {31775, 15149, 0, 0, 0x01,0x03,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {31814, 15149, 0, 0, 0x01,0x03,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {31853, 15149, 0, 0, 0x01,0x03,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {31892, 15149, 0, 0, 0x01,0x03,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {31931, 15149, 0, 0, 0x01,0x03,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {31970, 15149, 0, 0, 0x01,0x03,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {32009, 15149, 0, 0, 0x01,0x03,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {32048, 15149, 0, 0, 0x01,0x03,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {32087, 15149, 0, 0, 0x01,0x03,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {32126, 15149, 0, 0, 0x01,0x03,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {32165, 15149, 0, 0, 0x01,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {32204, 15149, 0, 0, 0x01,0x08,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {32243, 15149, 0, 0, 0x01,0x08,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {32282, 15149, 0, 0, 0x01,0x08,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {32321, 15149, 0, 0, 0x01,0x08,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {32360, 15149, 0, 0, 0x01,0x08,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {32399, 15149, 0, 0, 0x01,0x08,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {32438, 15149, 0, 0, 0x01,0x08,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {32477, 15149, 0, 0, 0x01,0x08,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {32516, 15149, 0, 0, 0x01,0x08,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {32555, 15149, 0, 0, 0x01,0x08,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {32594, 15149, 0, 0, 0x01,0x08,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {32633, 15149, 0, 0, 0x01,0x09,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {32672, 15149, 0, 0, 0x01,0x09,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {32711, 15149, 0, 0, 0x01,0x09,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {32750, 15149, 0, 0, 0x01,0x09,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {32789, 15149, 0, 0, 0x01,0x09,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {32828, 15149, 0, 0, 0x01,0x09,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {32867, 15149, 0, 0, 0x01,0x09,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {32906, 15149, 0, 0, 0x01,0x09,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {32945, 15149, 0, 0, 0x01,0x09,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {32984, 15149, 0, 0, 0x01,0x09,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {33023, 15149, 0, 0, 0x01,0x09,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {33062, 15149, 0, 0, 0x01,0x09,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {33101, 15149, 0, 0, 0x01,0x0E,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {33140, 15149, 0, 0, 0x01,0x0E,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {33179, 15149, 0, 0, 0x01,0x0E,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {33218, 15149, 0, 0, 0x01,0x0E,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {33257, 15149, 0, 0, 0x01,0x0E,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {33296, 15149, 0, 0, 0x01,0x0E,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {33335, 15149, 0, 0, 0x01,0x0E,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {33374, 15149, 0, 0, 0x01,0x0E,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {33413, 15149, 0, 0, 0x01,0x0E,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {33452, 15149, 0, 0, 0x01,0x0E,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {33491, 15149, 0, 0, 0x01,0x0E,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {33530, 15149, 0, 0, 0x01,0x0E,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {33569, 15149, 0, 0, 0x01,0x0F,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {33608, 15149, 0, 0, 0x01,0x0F,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {33647, 15149, 0, 0, 0x01,0x0F,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {33686, 15149, 0, 0, 0x01,0x0F,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {33725, 15149, 0, 0, 0x01,0x0F,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {33764, 15149, 0, 0, 0x01,0x0F,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {33803, 15149, 0, 0, 0x01,0x0F,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {33842, 15149, 0, 0, 0x01,0x0F,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {33881, 15149, 0, 0, 0x01,0x0F,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {33920, 15149, 0, 0, 0x01,0x0F,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {33959, 15149, 0, 0, 0x01,0x0F,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {33998, 15149, 0, 0, 0x01,0x0F,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {34037, 15149, 0, 0, 0x01,0x14,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {34076, 15149, 0, 0, 0x01,0x14,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {34115, 15149, 0, 0, 0x01,0x14,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {34154, 15149, 0, 0, 0x01,0x14,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {34193, 15149, 0, 0, 0x01,0x14,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {34232, 15149, 0, 0, 0x01,0x14,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {34271, 15149, 0, 0, 0x01,0x14,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {34310, 15149, 0, 0, 0x01,0x14,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {34349, 15149, 0, 0, 0x01,0x14,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {34388, 15149, 0, 0, 0x01,0x14,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {34427, 15149, 0, 0, 0x01,0x14,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {34466, 15149, 0, 0, 0x01,0x14,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {34505, 15149, 0, 0, 0x01,0x15,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {34544, 15149, 0, 0, 0x01,0x15,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {34583, 15149, 0, 0, 0x01,0x15,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {34622, 15149, 0, 0, 0x01,0x15,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {34661, 15149, 0, 0, 0x01,0x15,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {34700, 15149, 0, 0, 0x01,0x15,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {34739, 15149, 0, 0, 0x01,0x15,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {34778, 15149, 0, 0, 0x01,0x15,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {34817, 15149, 0, 0, 0x01,0x15,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {34856, 15149, 0, 0, 0x01,0x15,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {34895, 15149, 0, 0, 0x01,0x15,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {34934, 15149, 0, 0, 0x01,0x15,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {34973, 13119, 0, 0, 0x00,0x00,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35001, 13119, 0, 0, 0x00,0x01,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35029, 13119, 0, 0, 0x00,0x06,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35057, 13119, 0, 0, 0x00,0x07,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35085, 13119, 0, 0, 0x00,0x0C,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35113, 13119, 0, 0, 0x00,0x0D,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35141, 13119, 0, 0, 0x00,0x12,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35169, 13119, 0, 0, 0x00,0x13,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35197, 15149, 0, 0, 0x00,0x00,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35225, 15149, 0, 0, 0x00,0x01,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35253, 15149, 0, 0, 0x00,0x06,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35281, 15149, 0, 0, 0x00,0x07,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35309, 15149, 0, 0, 0x00,0x0C,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35337, 15149, 0, 0, 0x00,0x0D,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35365, 15149, 0, 0, 0x00,0x12,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35393, 15149, 0, 0, 0x00,0x13,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {35421, 13119, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35446, 13119, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35471, 13119, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35496, 13119, 0, 0, 0x01,0x09,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35521, 13119, 0, 0, 0x01,0x0E,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35546, 13119, 0, 0, 0x01,0x0F,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35571, 13119, 0, 0, 0x01,0x14,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35596, 13119, 0, 0, 0x01,0x15,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35621, 15149, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35646, 15149, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35671, 15149, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35696, 15149, 0, 0, 0x01,0x09,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35721, 15149, 0, 0, 0x01,0x0E,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35746, 15149, 0, 0, 0x01,0x0F,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35771, 15149, 0, 0, 0x01,0x14,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35796, 15149, 0, 0, 0x01,0x15,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {35821, 13119, 0, 0, 0x01,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {35851, 13119, 0, 0, 0x01,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {35881, 13119, 0, 0, 0x01,0x08,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {35911, 13119, 0, 0, 0x01,0x09,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {35941, 13119, 0, 0, 0x01,0x0E,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {35971, 13119, 0, 0, 0x01,0x0F,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36001, 13119, 0, 0, 0x01,0x14,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36031, 13119, 0, 0, 0x01,0x15,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36061, 15149, 0, 0, 0x01,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36091, 15149, 0, 0, 0x01,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36121, 15149, 0, 0, 0x01,0x08,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36151, 15149, 0, 0, 0x01,0x09,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36181, 15149, 0, 0, 0x01,0x0E,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36211, 15149, 0, 0, 0x01,0x0F,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36241, 15149, 0, 0, 0x01,0x14,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36271, 15149, 0, 0, 0x01,0x15,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36301, 13119, 0, 0, 0x00,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {36339, 13119, 0, 0, 0x00,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {36377, 13119, 0, 0, 0x00,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {36415, 13119, 0, 0, 0x00,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {36453, 13119, 0, 0, 0x00,0x00,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {36491, 13119, 0, 0, 0x00,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {36529, 13119, 0, 0, 0x00,0x00,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {36567, 13119, 0, 0, 0x00,0x00,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {36605, 13119, 0, 0, 0x00,0x00,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {36643, 13119, 0, 0, 0x00,0x00,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {36681, 13119, 0, 0, 0x00,0x00,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {36719, 13119, 0, 0, 0x00,0x00,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {36757, 13119, 0, 0, 0x00,0x00,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {36795, 13119, 0, 0, 0x00,0x00,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {36833, 13119, 0, 0, 0x00,0x00,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {36871, 13119, 0, 0, 0x00,0x00,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {36909, 13119, 0, 0, 0x00,0x00,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {36947, 13119, 0, 0, 0x00,0x00,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {36985, 13119, 0, 0, 0x00,0x00,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {37023, 13119, 0, 0, 0x00,0x00,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {37061, 13119, 0, 0, 0x00,0x00,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {37099, 13119, 0, 0, 0x00,0x00,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {37137, 13119, 0, 0, 0x00,0x00,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {37175, 13119, 0, 0, 0x00,0x00,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {37213, 13119, 0, 0, 0x00,0x00,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {37251, 13119, 0, 0, 0x00,0x00,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {37289, 13119, 0, 0, 0x00,0x00,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {37327, 13119, 0, 0, 0x00,0x00,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {37365, 13119, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37403, 13119, 0, 0, 0x00,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {37441, 13119, 0, 0, 0x00,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37479, 13119, 0, 0, 0x00,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {37517, 13119, 0, 0, 0x00,0x01,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {37555, 13119, 0, 0, 0x00,0x01,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {37593, 13119, 0, 0, 0x00,0x01,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {37631, 13119, 0, 0, 0x00,0x01,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {37669, 13119, 0, 0, 0x00,0x01,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {37707, 13119, 0, 0, 0x00,0x01,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {37745, 13119, 0, 0, 0x00,0x01,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {37783, 13119, 0, 0, 0x00,0x01,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {37821, 13119, 0, 0, 0x00,0x01,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {37859, 13119, 0, 0, 0x00,0x01,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {37897, 13119, 0, 0, 0x00,0x01,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {37935, 13119, 0, 0, 0x00,0x01,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {37973, 13119, 0, 0, 0x00,0x01,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {38011, 13119, 0, 0, 0x00,0x01,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {38049, 13119, 0, 0, 0x00,0x01,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {38087, 13119, 0, 0, 0x00,0x01,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {38125, 13119, 0, 0, 0x00,0x01,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {38163, 13119, 0, 0, 0x00,0x01,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {38201, 13119, 0, 0, 0x00,0x01,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {38239, 13119, 0, 0, 0x00,0x01,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {38277, 13119, 0, 0, 0x00,0x01,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {38315, 13119, 0, 0, 0x00,0x01,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {38353, 13119, 0, 0, 0x00,0x01,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {38391, 13119, 0, 0, 0x00,0x01,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {38429, 13119, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38467, 13119, 0, 0, 0x00,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {38505, 13119, 0, 0, 0x00,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {38543, 13119, 0, 0, 0x00,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {38581, 13119, 0, 0, 0x00,0x06,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {38619, 13119, 0, 0, 0x00,0x06,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {38657, 13119, 0, 0, 0x00,0x06,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {38695, 13119, 0, 0, 0x00,0x06,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {38733, 13119, 0, 0, 0x00,0x06,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {38771, 13119, 0, 0, 0x00,0x06,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {38809, 13119, 0, 0, 0x00,0x06,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {38847, 13119, 0, 0, 0x00,0x06,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {38885, 13119, 0, 0, 0x00,0x06,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {38923, 13119, 0, 0, 0x00,0x06,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {38961, 13119, 0, 0, 0x00,0x06,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {38999, 13119, 0, 0, 0x00,0x06,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {39037, 13119, 0, 0, 0x00,0x06,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {39075, 13119, 0, 0, 0x00,0x06,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {39113, 13119, 0, 0, 0x00,0x06,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {39151, 13119, 0, 0, 0x00,0x06,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {39189, 13119, 0, 0, 0x00,0x06,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {39227, 13119, 0, 0, 0x00,0x06,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {39265, 13119, 0, 0, 0x00,0x06,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {39303, 13119, 0, 0, 0x00,0x06,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {39341, 13119, 0, 0, 0x00,0x06,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {39379, 13119, 0, 0, 0x00,0x06,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {39417, 13119, 0, 0, 0x00,0x06,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {39455, 13119, 0, 0, 0x00,0x06,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {39493, 13119, 0, 0, 0x00,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {39531, 13119, 0, 0, 0x00,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {39569, 13119, 0, 0, 0x00,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {39607, 13119, 0, 0, 0x00,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {39645, 13119, 0, 0, 0x00,0x07,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {39683, 13119, 0, 0, 0x00,0x07,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {39721, 13119, 0, 0, 0x00,0x07,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {39759, 13119, 0, 0, 0x00,0x07,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {39797, 13119, 0, 0, 0x00,0x07,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {39835, 13119, 0, 0, 0x00,0x07,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {39873, 13119, 0, 0, 0x00,0x07,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {39911, 13119, 0, 0, 0x00,0x07,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {39949, 13119, 0, 0, 0x00,0x07,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {39987, 13119, 0, 0, 0x00,0x07,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {40025, 13119, 0, 0, 0x00,0x07,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {40063, 13119, 0, 0, 0x00,0x07,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {40101, 13119, 0, 0, 0x00,0x07,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {40139, 13119, 0, 0, 0x00,0x07,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {40177, 13119, 0, 0, 0x00,0x07,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {40215, 13119, 0, 0, 0x00,0x07,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {40253, 13119, 0, 0, 0x00,0x07,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {40291, 13119, 0, 0, 0x00,0x07,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {40329, 13119, 0, 0, 0x00,0x07,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {40367, 13119, 0, 0, 0x00,0x07,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {40405, 13119, 0, 0, 0x00,0x07,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {40443, 13119, 0, 0, 0x00,0x07,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {40481, 13119, 0, 0, 0x00,0x07,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {40519, 13119, 0, 0, 0x00,0x07,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {40557, 13119, 0, 0, 0x00,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40595, 13119, 0, 0, 0x00,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40633, 13119, 0, 0, 0x00,0x0C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {40671, 13119, 0, 0, 0x00,0x0C,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {40709, 13119, 0, 0, 0x00,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {40747, 13119, 0, 0, 0x00,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {40785, 13119, 0, 0, 0x00,0x0C,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {40823, 13119, 0, 0, 0x00,0x0C,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {40861, 13119, 0, 0, 0x00,0x0C,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {40899, 13119, 0, 0, 0x00,0x0C,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {40937, 13119, 0, 0, 0x00,0x0C,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {40975, 13119, 0, 0, 0x00,0x0C,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {41013, 13119, 0, 0, 0x00,0x0C,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {41051, 13119, 0, 0, 0x00,0x0C,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {41089, 13119, 0, 0, 0x00,0x0C,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {41127, 13119, 0, 0, 0x00,0x0C,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {41165, 13119, 0, 0, 0x00,0x0C,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {41203, 13119, 0, 0, 0x00,0x0C,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {41241, 13119, 0, 0, 0x00,0x0C,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {41279, 13119, 0, 0, 0x00,0x0C,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {41317, 13119, 0, 0, 0x00,0x0C,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {41355, 13119, 0, 0, 0x00,0x0C,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {41393, 13119, 0, 0, 0x00,0x0C,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {41431, 13119, 0, 0, 0x00,0x0C,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {41469, 13119, 0, 0, 0x00,0x0C,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {41507, 13119, 0, 0, 0x00,0x0C,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {41545, 13119, 0, 0, 0x00,0x0C,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {41583, 13119, 0, 0, 0x00,0x0C,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {41621, 13119, 0, 0, 0x00,0x0D,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {41659, 13119, 0, 0, 0x00,0x0D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {41697, 13119, 0, 0, 0x00,0x0D,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41735, 13119, 0, 0, 0x00,0x0D,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41773, 13119, 0, 0, 0x00,0x0D,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {41811, 13119, 0, 0, 0x00,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {41849, 13119, 0, 0, 0x00,0x0D,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {41887, 13119, 0, 0, 0x00,0x0D,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {41925, 13119, 0, 0, 0x00,0x0D,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {41963, 13119, 0, 0, 0x00,0x0D,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {42001, 13119, 0, 0, 0x00,0x0D,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {42039, 13119, 0, 0, 0x00,0x0D,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {42077, 13119, 0, 0, 0x00,0x0D,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {42115, 13119, 0, 0, 0x00,0x0D,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {42153, 13119, 0, 0, 0x00,0x0D,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {42191, 13119, 0, 0, 0x00,0x0D,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {42229, 13119, 0, 0, 0x00,0x0D,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {42267, 13119, 0, 0, 0x00,0x0D,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {42305, 13119, 0, 0, 0x00,0x0D,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {42343, 13119, 0, 0, 0x00,0x0D,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {42381, 13119, 0, 0, 0x00,0x0D,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {42419, 13119, 0, 0, 0x00,0x0D,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {42457, 13119, 0, 0, 0x00,0x0D,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {42495, 13119, 0, 0, 0x00,0x0D,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {42533, 13119, 0, 0, 0x00,0x0D,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {42571, 13119, 0, 0, 0x00,0x0D,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {42609, 13119, 0, 0, 0x00,0x0D,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {42647, 13119, 0, 0, 0x00,0x0D,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {42685, 13119, 0, 0, 0x00,0x12,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {42723, 13119, 0, 0, 0x00,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {42761, 13119, 0, 0, 0x00,0x12,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {42799, 13119, 0, 0, 0x00,0x12,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {42837, 13119, 0, 0, 0x00,0x12,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {42875, 13119, 0, 0, 0x00,0x12,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {42913, 13119, 0, 0, 0x00,0x12,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {42951, 13119, 0, 0, 0x00,0x12,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {42989, 13119, 0, 0, 0x00,0x12,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {43027, 13119, 0, 0, 0x00,0x12,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {43065, 13119, 0, 0, 0x00,0x12,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {43103, 13119, 0, 0, 0x00,0x12,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {43141, 13119, 0, 0, 0x00,0x12,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {43179, 13119, 0, 0, 0x00,0x12,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {43217, 13119, 0, 0, 0x00,0x12,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {43255, 13119, 0, 0, 0x00,0x12,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {43293, 13119, 0, 0, 0x00,0x12,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {43331, 13119, 0, 0, 0x00,0x12,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {43369, 13119, 0, 0, 0x00,0x12,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {43407, 13119, 0, 0, 0x00,0x12,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {43445, 13119, 0, 0, 0x00,0x12,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {43483, 13119, 0, 0, 0x00,0x12,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {43521, 13119, 0, 0, 0x00,0x12,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {43559, 13119, 0, 0, 0x00,0x12,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {43597, 13119, 0, 0, 0x00,0x12,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {43635, 13119, 0, 0, 0x00,0x12,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {43673, 13119, 0, 0, 0x00,0x12,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {43711, 13119, 0, 0, 0x00,0x12,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {43749, 13119, 0, 0, 0x00,0x13,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {43787, 13119, 0, 0, 0x00,0x13,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {43825, 13119, 0, 0, 0x00,0x13,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {43863, 13119, 0, 0, 0x00,0x13,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {43901, 13119, 0, 0, 0x00,0x13,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {43939, 13119, 0, 0, 0x00,0x13,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {43977, 13119, 0, 0, 0x00,0x13,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {44015, 13119, 0, 0, 0x00,0x13,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {44053, 13119, 0, 0, 0x00,0x13,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {44091, 13119, 0, 0, 0x00,0x13,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {44129, 13119, 0, 0, 0x00,0x13,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {44167, 13119, 0, 0, 0x00,0x13,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {44205, 13119, 0, 0, 0x00,0x13,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {44243, 13119, 0, 0, 0x00,0x13,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {44281, 13119, 0, 0, 0x00,0x13,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {44319, 13119, 0, 0, 0x00,0x13,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {44357, 13119, 0, 0, 0x00,0x13,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {44395, 13119, 0, 0, 0x00,0x13,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {44433, 13119, 0, 0, 0x00,0x13,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {44471, 13119, 0, 0, 0x00,0x13,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {44509, 13119, 0, 0, 0x00,0x13,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {44547, 13119, 0, 0, 0x00,0x13,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {44585, 13119, 0, 0, 0x00,0x13,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {44623, 13119, 0, 0, 0x00,0x13,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {44661, 13119, 0, 0, 0x00,0x13,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {44699, 13119, 0, 0, 0x00,0x13,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {44737, 13119, 0, 0, 0x00,0x13,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {44775, 13119, 0, 0, 0x00,0x13,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {44813, 15149, 0, 0, 0x00,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {44851, 15149, 0, 0, 0x00,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {44889, 15149, 0, 0, 0x00,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {44927, 15149, 0, 0, 0x00,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {44965, 15149, 0, 0, 0x00,0x00,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {45003, 15149, 0, 0, 0x00,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {45041, 15149, 0, 0, 0x00,0x00,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {45079, 15149, 0, 0, 0x00,0x00,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {45117, 15149, 0, 0, 0x00,0x00,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {45155, 15149, 0, 0, 0x00,0x00,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {45193, 15149, 0, 0, 0x00,0x00,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {45231, 15149, 0, 0, 0x00,0x00,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {45269, 15149, 0, 0, 0x00,0x00,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {45307, 15149, 0, 0, 0x00,0x00,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {45345, 15149, 0, 0, 0x00,0x00,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {45383, 15149, 0, 0, 0x00,0x00,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {45421, 15149, 0, 0, 0x00,0x00,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {45459, 15149, 0, 0, 0x00,0x00,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {45497, 15149, 0, 0, 0x00,0x00,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {45535, 15149, 0, 0, 0x00,0x00,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {45573, 15149, 0, 0, 0x00,0x00,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {45611, 15149, 0, 0, 0x00,0x00,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {45649, 15149, 0, 0, 0x00,0x00,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {45687, 15149, 0, 0, 0x00,0x00,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {45725, 15149, 0, 0, 0x00,0x00,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {45763, 15149, 0, 0, 0x00,0x00,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {45801, 15149, 0, 0, 0x00,0x00,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {45839, 15149, 0, 0, 0x00,0x00,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {45877, 15149, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {45915, 15149, 0, 0, 0x00,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {45953, 15149, 0, 0, 0x00,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {45991, 15149, 0, 0, 0x00,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {46029, 15149, 0, 0, 0x00,0x01,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {46067, 15149, 0, 0, 0x00,0x01,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {46105, 15149, 0, 0, 0x00,0x01,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {46143, 15149, 0, 0, 0x00,0x01,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {46181, 15149, 0, 0, 0x00,0x01,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {46219, 15149, 0, 0, 0x00,0x01,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {46257, 15149, 0, 0, 0x00,0x01,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {46295, 15149, 0, 0, 0x00,0x01,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {46333, 15149, 0, 0, 0x00,0x01,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {46371, 15149, 0, 0, 0x00,0x01,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {46409, 15149, 0, 0, 0x00,0x01,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {46447, 15149, 0, 0, 0x00,0x01,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {46485, 15149, 0, 0, 0x00,0x01,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {46523, 15149, 0, 0, 0x00,0x01,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {46561, 15149, 0, 0, 0x00,0x01,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {46599, 15149, 0, 0, 0x00,0x01,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {46637, 15149, 0, 0, 0x00,0x01,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {46675, 15149, 0, 0, 0x00,0x01,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {46713, 15149, 0, 0, 0x00,0x01,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {46751, 15149, 0, 0, 0x00,0x01,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {46789, 15149, 0, 0, 0x00,0x01,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {46827, 15149, 0, 0, 0x00,0x01,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {46865, 15149, 0, 0, 0x00,0x01,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {46903, 15149, 0, 0, 0x00,0x01,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {46941, 15149, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {46979, 15149, 0, 0, 0x00,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {47017, 15149, 0, 0, 0x00,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {47055, 15149, 0, 0, 0x00,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {47093, 15149, 0, 0, 0x00,0x06,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {47131, 15149, 0, 0, 0x00,0x06,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {47169, 15149, 0, 0, 0x00,0x06,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {47207, 15149, 0, 0, 0x00,0x06,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {47245, 15149, 0, 0, 0x00,0x06,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {47283, 15149, 0, 0, 0x00,0x06,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {47321, 15149, 0, 0, 0x00,0x06,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {47359, 15149, 0, 0, 0x00,0x06,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {47397, 15149, 0, 0, 0x00,0x06,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {47435, 15149, 0, 0, 0x00,0x06,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {47473, 15149, 0, 0, 0x00,0x06,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {47511, 15149, 0, 0, 0x00,0x06,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {47549, 15149, 0, 0, 0x00,0x06,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {47587, 15149, 0, 0, 0x00,0x06,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {47625, 15149, 0, 0, 0x00,0x06,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {47663, 15149, 0, 0, 0x00,0x06,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {47701, 15149, 0, 0, 0x00,0x06,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {47739, 15149, 0, 0, 0x00,0x06,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {47777, 15149, 0, 0, 0x00,0x06,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {47815, 15149, 0, 0, 0x00,0x06,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {47853, 15149, 0, 0, 0x00,0x06,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {47891, 15149, 0, 0, 0x00,0x06,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {47929, 15149, 0, 0, 0x00,0x06,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {47967, 15149, 0, 0, 0x00,0x06,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {48005, 15149, 0, 0, 0x00,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {48043, 15149, 0, 0, 0x00,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {48081, 15149, 0, 0, 0x00,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {48119, 15149, 0, 0, 0x00,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {48157, 15149, 0, 0, 0x00,0x07,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {48195, 15149, 0, 0, 0x00,0x07,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {48233, 15149, 0, 0, 0x00,0x07,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {48271, 15149, 0, 0, 0x00,0x07,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {48309, 15149, 0, 0, 0x00,0x07,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {48347, 15149, 0, 0, 0x00,0x07,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {48385, 15149, 0, 0, 0x00,0x07,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {48423, 15149, 0, 0, 0x00,0x07,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {48461, 15149, 0, 0, 0x00,0x07,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {48499, 15149, 0, 0, 0x00,0x07,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {48537, 15149, 0, 0, 0x00,0x07,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {48575, 15149, 0, 0, 0x00,0x07,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {48613, 15149, 0, 0, 0x00,0x07,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {48651, 15149, 0, 0, 0x00,0x07,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {48689, 15149, 0, 0, 0x00,0x07,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {48727, 15149, 0, 0, 0x00,0x07,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {48765, 15149, 0, 0, 0x00,0x07,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {48803, 15149, 0, 0, 0x00,0x07,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {48841, 15149, 0, 0, 0x00,0x07,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {48879, 15149, 0, 0, 0x00,0x07,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {48917, 15149, 0, 0, 0x00,0x07,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {48955, 15149, 0, 0, 0x00,0x07,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {48993, 15149, 0, 0, 0x00,0x07,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {49031, 15149, 0, 0, 0x00,0x07,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {49069, 15149, 0, 0, 0x00,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {49107, 15149, 0, 0, 0x00,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {49145, 15149, 0, 0, 0x00,0x0C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {49183, 15149, 0, 0, 0x00,0x0C,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {49221, 15149, 0, 0, 0x00,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {49259, 15149, 0, 0, 0x00,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {49297, 15149, 0, 0, 0x00,0x0C,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {49335, 15149, 0, 0, 0x00,0x0C,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {49373, 15149, 0, 0, 0x00,0x0C,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {49411, 15149, 0, 0, 0x00,0x0C,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {49449, 15149, 0, 0, 0x00,0x0C,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {49487, 15149, 0, 0, 0x00,0x0C,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {49525, 15149, 0, 0, 0x00,0x0C,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {49563, 15149, 0, 0, 0x00,0x0C,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {49601, 15149, 0, 0, 0x00,0x0C,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {49639, 15149, 0, 0, 0x00,0x0C,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {49677, 15149, 0, 0, 0x00,0x0C,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {49715, 15149, 0, 0, 0x00,0x0C,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {49753, 15149, 0, 0, 0x00,0x0C,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {49791, 15149, 0, 0, 0x00,0x0C,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {49829, 15149, 0, 0, 0x00,0x0C,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {49867, 15149, 0, 0, 0x00,0x0C,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {49905, 15149, 0, 0, 0x00,0x0C,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {49943, 15149, 0, 0, 0x00,0x0C,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {49981, 15149, 0, 0, 0x00,0x0C,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {50019, 15149, 0, 0, 0x00,0x0C,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {50057, 15149, 0, 0, 0x00,0x0C,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {50095, 15149, 0, 0, 0x00,0x0C,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {50133, 15149, 0, 0, 0x00,0x0D,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {50171, 15149, 0, 0, 0x00,0x0D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {50209, 15149, 0, 0, 0x00,0x0D,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {50247, 15149, 0, 0, 0x00,0x0D,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {50285, 15149, 0, 0, 0x00,0x0D,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {50323, 15149, 0, 0, 0x00,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {50361, 15149, 0, 0, 0x00,0x0D,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {50399, 15149, 0, 0, 0x00,0x0D,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {50437, 15149, 0, 0, 0x00,0x0D,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {50475, 15149, 0, 0, 0x00,0x0D,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {50513, 15149, 0, 0, 0x00,0x0D,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {50551, 15149, 0, 0, 0x00,0x0D,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {50589, 15149, 0, 0, 0x00,0x0D,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {50627, 15149, 0, 0, 0x00,0x0D,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {50665, 15149, 0, 0, 0x00,0x0D,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {50703, 15149, 0, 0, 0x00,0x0D,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {50741, 15149, 0, 0, 0x00,0x0D,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {50779, 15149, 0, 0, 0x00,0x0D,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {50817, 15149, 0, 0, 0x00,0x0D,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {50855, 15149, 0, 0, 0x00,0x0D,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {50893, 15149, 0, 0, 0x00,0x0D,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {50931, 15149, 0, 0, 0x00,0x0D,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {50969, 15149, 0, 0, 0x00,0x0D,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {51007, 15149, 0, 0, 0x00,0x0D,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {51045, 15149, 0, 0, 0x00,0x0D,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {51083, 15149, 0, 0, 0x00,0x0D,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {51121, 15149, 0, 0, 0x00,0x0D,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {51159, 15149, 0, 0, 0x00,0x0D,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {51197, 15149, 0, 0, 0x00,0x12,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {51235, 15149, 0, 0, 0x00,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {51273, 15149, 0, 0, 0x00,0x12,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {51311, 15149, 0, 0, 0x00,0x12,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {51349, 15149, 0, 0, 0x00,0x12,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {51387, 15149, 0, 0, 0x00,0x12,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {51425, 15149, 0, 0, 0x00,0x12,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {51463, 15149, 0, 0, 0x00,0x12,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {51501, 15149, 0, 0, 0x00,0x12,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {51539, 15149, 0, 0, 0x00,0x12,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {51577, 15149, 0, 0, 0x00,0x12,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {51615, 15149, 0, 0, 0x00,0x12,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {51653, 15149, 0, 0, 0x00,0x12,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {51691, 15149, 0, 0, 0x00,0x12,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {51729, 15149, 0, 0, 0x00,0x12,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {51767, 15149, 0, 0, 0x00,0x12,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {51805, 15149, 0, 0, 0x00,0x12,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {51843, 15149, 0, 0, 0x00,0x12,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {51881, 15149, 0, 0, 0x00,0x12,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {51919, 15149, 0, 0, 0x00,0x12,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {51957, 15149, 0, 0, 0x00,0x12,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {51995, 15149, 0, 0, 0x00,0x12,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {52033, 15149, 0, 0, 0x00,0x12,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {52071, 15149, 0, 0, 0x00,0x12,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {52109, 15149, 0, 0, 0x00,0x12,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {52147, 15149, 0, 0, 0x00,0x12,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {52185, 15149, 0, 0, 0x00,0x12,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {52223, 15149, 0, 0, 0x00,0x12,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {52261, 15149, 0, 0, 0x00,0x13,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {52299, 15149, 0, 0, 0x00,0x13,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {52337, 15149, 0, 0, 0x00,0x13,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {52375, 15149, 0, 0, 0x00,0x13,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {52413, 15149, 0, 0, 0x00,0x13,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {52451, 15149, 0, 0, 0x00,0x13,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {52489, 15149, 0, 0, 0x00,0x13,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {52527, 15149, 0, 0, 0x00,0x13,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {52565, 15149, 0, 0, 0x00,0x13,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {52603, 15149, 0, 0, 0x00,0x13,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {52641, 15149, 0, 0, 0x00,0x13,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {52679, 15149, 0, 0, 0x00,0x13,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {52717, 15149, 0, 0, 0x00,0x13,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {52755, 15149, 0, 0, 0x00,0x13,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {52793, 15149, 0, 0, 0x00,0x13,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {52831, 15149, 0, 0, 0x00,0x13,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {52869, 15149, 0, 0, 0x00,0x13,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {52907, 15149, 0, 0, 0x00,0x13,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {52945, 15149, 0, 0, 0x00,0x13,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {52983, 15149, 0, 0, 0x00,0x13,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {53021, 15149, 0, 0, 0x00,0x13,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {53059, 15149, 0, 0, 0x00,0x13,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {53097, 15149, 0, 0, 0x00,0x13,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {53135, 15149, 0, 0, 0x00,0x13,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {53173, 15149, 0, 0, 0x00,0x13,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {53211, 15149, 0, 0, 0x00,0x13,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {53249, 15149, 0, 0, 0x00,0x13,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {53287, 15149, 0, 0, 0x00,0x13,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {53325, 13119, 0, 0, 0x00,0x00,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53348, 13119, 0, 0, 0x00,0x01,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53371, 13119, 0, 0, 0x00,0x06,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53394, 13119, 0, 0, 0x00,0x07,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53417, 13119, 0, 0, 0x00,0x0C,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53440, 13119, 0, 0, 0x00,0x0D,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53463, 13119, 0, 0, 0x00,0x12,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53486, 13119, 0, 0, 0x00,0x13,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53509, 15149, 0, 0, 0x00,0x00,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53532, 15149, 0, 0, 0x00,0x01,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53555, 15149, 0, 0, 0x00,0x06,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53578, 15149, 0, 0, 0x00,0x07,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53601, 15149, 0, 0, 0x00,0x0C,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53624, 15149, 0, 0, 0x00,0x0D,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53647, 15149, 0, 0, 0x00,0x12,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53670, 15149, 0, 0, 0x00,0x13,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {53693, 13119, 0, 0, 0x00,0x00,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53717, 13119, 0, 0, 0x00,0x01,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53741, 13119, 0, 0, 0x00,0x06,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53765, 13119, 0, 0, 0x00,0x07,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53789, 13119, 0, 0, 0x00,0x0C,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53813, 13119, 0, 0, 0x00,0x0D,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53837, 13119, 0, 0, 0x00,0x12,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53861, 13119, 0, 0, 0x00,0x13,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53885, 15149, 0, 0, 0x00,0x00,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53909, 15149, 0, 0, 0x00,0x01,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53933, 15149, 0, 0, 0x00,0x06,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53957, 15149, 0, 0, 0x00,0x07,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {53981, 15149, 0, 0, 0x00,0x0C,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {54005, 15149, 0, 0, 0x00,0x0D,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {54029, 15149, 0, 0, 0x00,0x12,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {54053, 15149, 0, 0, 0x00,0x13,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {54077, 13119, 0, 0, 0x00,0x00,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54103, 13119, 0, 0, 0x00,0x01,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54129, 13119, 0, 0, 0x00,0x06,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54155, 13119, 0, 0, 0x00,0x07,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54181, 13119, 0, 0, 0x00,0x0C,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54207, 13119, 0, 0, 0x00,0x0D,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54233, 13119, 0, 0, 0x00,0x12,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54259, 13119, 0, 0, 0x00,0x13,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54285, 15149, 0, 0, 0x00,0x00,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54311, 15149, 0, 0, 0x00,0x01,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54337, 15149, 0, 0, 0x00,0x06,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54363, 15149, 0, 0, 0x00,0x07,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54389, 15149, 0, 0, 0x00,0x0C,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54415, 15149, 0, 0, 0x00,0x0D,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54441, 15149, 0, 0, 0x00,0x12,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54467, 15149, 0, 0, 0x00,0x13,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {54493, 13119, 0, 0, 0x01,0x02,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {54520, 13119, 0, 0, 0x01,0x02,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {54547, 13119, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {54574, 13119, 0, 0, 0x01,0x02,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {54601, 13119, 0, 0, 0x01,0x02,0x00,0x04,EVENT_OPTION_NONE_MASK}
+, {54628, 13119, 0, 0, 0x01,0x02,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {54655, 13119, 0, 0, 0x01,0x03,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {54682, 13119, 0, 0, 0x01,0x03,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {54709, 13119, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {54736, 13119, 0, 0, 0x01,0x03,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {54763, 13119, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {54790, 13119, 0, 0, 0x01,0x03,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {54817, 13119, 0, 0, 0x01,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {54844, 13119, 0, 0, 0x01,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {54871, 13119, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {54898, 13119, 0, 0, 0x01,0x08,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {54925, 13119, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {54952, 13119, 0, 0, 0x01,0x08,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {54979, 13119, 0, 0, 0x01,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55006, 13119, 0, 0, 0x01,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55033, 13119, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55060, 13119, 0, 0, 0x01,0x09,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55087, 13119, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55114, 13119, 0, 0, 0x01,0x09,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55141, 13119, 0, 0, 0x01,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55168, 13119, 0, 0, 0x01,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55195, 13119, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55222, 13119, 0, 0, 0x01,0x0E,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55249, 13119, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55276, 13119, 0, 0, 0x01,0x0E,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55303, 13119, 0, 0, 0x01,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55330, 13119, 0, 0, 0x01,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55357, 13119, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55384, 13119, 0, 0, 0x01,0x0F,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55411, 13119, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55438, 13119, 0, 0, 0x01,0x0F,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55465, 13119, 0, 0, 0x01,0x14,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55492, 13119, 0, 0, 0x01,0x14,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55519, 13119, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55546, 13119, 0, 0, 0x01,0x14,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55573, 13119, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55600, 13119, 0, 0, 0x01,0x14,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55627, 13119, 0, 0, 0x01,0x15,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55654, 13119, 0, 0, 0x01,0x15,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55681, 13119, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55708, 13119, 0, 0, 0x01,0x15,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55735, 13119, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55762, 13119, 0, 0, 0x01,0x15,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55789, 15149, 0, 0, 0x01,0x02,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55816, 15149, 0, 0, 0x01,0x02,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {55843, 15149, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55870, 15149, 0, 0, 0x01,0x02,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {55897, 15149, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {55924, 15149, 0, 0, 0x01,0x02,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {55951, 15149, 0, 0, 0x01,0x03,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {55978, 15149, 0, 0, 0x01,0x03,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56005, 15149, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56032, 15149, 0, 0, 0x01,0x03,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56059, 15149, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56086, 15149, 0, 0, 0x01,0x03,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56113, 15149, 0, 0, 0x01,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56140, 15149, 0, 0, 0x01,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56167, 15149, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56194, 15149, 0, 0, 0x01,0x08,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56221, 15149, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56248, 15149, 0, 0, 0x01,0x08,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56275, 15149, 0, 0, 0x01,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56302, 15149, 0, 0, 0x01,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56329, 15149, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56356, 15149, 0, 0, 0x01,0x09,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56383, 15149, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56410, 15149, 0, 0, 0x01,0x09,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56437, 15149, 0, 0, 0x01,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56464, 15149, 0, 0, 0x01,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56491, 15149, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56518, 15149, 0, 0, 0x01,0x0E,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56545, 15149, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56572, 15149, 0, 0, 0x01,0x0E,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56599, 15149, 0, 0, 0x01,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56626, 15149, 0, 0, 0x01,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56653, 15149, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56680, 15149, 0, 0, 0x01,0x0F,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56707, 15149, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56734, 15149, 0, 0, 0x01,0x0F,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56761, 15149, 0, 0, 0x01,0x14,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56788, 15149, 0, 0, 0x01,0x14,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56815, 15149, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56842, 15149, 0, 0, 0x01,0x14,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56869, 15149, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56896, 15149, 0, 0, 0x01,0x14,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56923, 15149, 0, 0, 0x01,0x15,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56950, 15149, 0, 0, 0x01,0x15,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56977, 15149, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57004, 15149, 0, 0, 0x01,0x15,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57031, 15149, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57058, 15149, 0, 0, 0x01,0x15,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57085, 13119, 0, 0, 0x01,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {57117, 13119, 0, 0, 0x01,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {57149, 13119, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57181, 13119, 0, 0, 0x01,0x02,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {57213, 13119, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57245, 13119, 0, 0, 0x01,0x02,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {57277, 13119, 0, 0, 0x01,0x03,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {57309, 13119, 0, 0, 0x01,0x03,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {57341, 13119, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57373, 13119, 0, 0, 0x01,0x03,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {57405, 13119, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57437, 13119, 0, 0, 0x01,0x03,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {57469, 13119, 0, 0, 0x01,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {57501, 13119, 0, 0, 0x01,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {57533, 13119, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57565, 13119, 0, 0, 0x01,0x08,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {57597, 13119, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57629, 13119, 0, 0, 0x01,0x08,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {57661, 13119, 0, 0, 0x01,0x09,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {57693, 13119, 0, 0, 0x01,0x09,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {57725, 13119, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57757, 13119, 0, 0, 0x01,0x09,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {57789, 13119, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57821, 13119, 0, 0, 0x01,0x09,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {57853, 13119, 0, 0, 0x01,0x0E,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {57885, 13119, 0, 0, 0x01,0x0E,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {57917, 13119, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {57949, 13119, 0, 0, 0x01,0x0E,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {57981, 13119, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58013, 13119, 0, 0, 0x01,0x0E,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58045, 13119, 0, 0, 0x01,0x0F,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58077, 13119, 0, 0, 0x01,0x0F,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58109, 13119, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58141, 13119, 0, 0, 0x01,0x0F,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58173, 13119, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58205, 13119, 0, 0, 0x01,0x0F,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58237, 13119, 0, 0, 0x01,0x14,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58269, 13119, 0, 0, 0x01,0x14,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58301, 13119, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58333, 13119, 0, 0, 0x01,0x14,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58365, 13119, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58397, 13119, 0, 0, 0x01,0x14,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58429, 13119, 0, 0, 0x01,0x15,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58461, 13119, 0, 0, 0x01,0x15,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58493, 13119, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58525, 13119, 0, 0, 0x01,0x15,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58557, 13119, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58589, 13119, 0, 0, 0x01,0x15,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58621, 15149, 0, 0, 0x01,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58653, 15149, 0, 0, 0x01,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58685, 15149, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58717, 15149, 0, 0, 0x01,0x02,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58749, 15149, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58781, 15149, 0, 0, 0x01,0x02,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58813, 15149, 0, 0, 0x01,0x03,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58845, 15149, 0, 0, 0x01,0x03,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58877, 15149, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58909, 15149, 0, 0, 0x01,0x03,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58941, 15149, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58973, 15149, 0, 0, 0x01,0x03,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59005, 15149, 0, 0, 0x01,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59037, 15149, 0, 0, 0x01,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59069, 15149, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59101, 15149, 0, 0, 0x01,0x08,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59133, 15149, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59165, 15149, 0, 0, 0x01,0x08,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59197, 15149, 0, 0, 0x01,0x09,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59229, 15149, 0, 0, 0x01,0x09,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59261, 15149, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59293, 15149, 0, 0, 0x01,0x09,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59325, 15149, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59357, 15149, 0, 0, 0x01,0x09,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59389, 15149, 0, 0, 0x01,0x0E,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59421, 15149, 0, 0, 0x01,0x0E,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59453, 15149, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59485, 15149, 0, 0, 0x01,0x0E,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59517, 15149, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59549, 15149, 0, 0, 0x01,0x0E,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59581, 15149, 0, 0, 0x01,0x0F,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59613, 15149, 0, 0, 0x01,0x0F,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59645, 15149, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59677, 15149, 0, 0, 0x01,0x0F,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59709, 15149, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59741, 15149, 0, 0, 0x01,0x0F,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59773, 15149, 0, 0, 0x01,0x14,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59805, 15149, 0, 0, 0x01,0x14,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59837, 15149, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59869, 15149, 0, 0, 0x01,0x14,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59901, 15149, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59933, 15149, 0, 0, 0x01,0x14,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59965, 15149, 0, 0, 0x01,0x15,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59997, 15149, 0, 0, 0x01,0x15,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60029, 15149, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60061, 15149, 0, 0, 0x01,0x15,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60093, 15149, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60125, 15149, 0, 0, 0x01,0x15,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60157, 13119, 0, 0, 0x00,0x00,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60180, 13119, 0, 0, 0x00,0x01,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60203, 13119, 0, 0, 0x00,0x06,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60226, 13119, 0, 0, 0x00,0x07,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60249, 13119, 0, 0, 0x00,0x0C,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60272, 13119, 0, 0, 0x00,0x0D,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60295, 13119, 0, 0, 0x00,0x12,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60318, 13119, 0, 0, 0x00,0x13,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60341, 15149, 0, 0, 0x00,0x00,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60364, 15149, 0, 0, 0x00,0x01,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60387, 15149, 0, 0, 0x00,0x06,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60410, 15149, 0, 0, 0x00,0x07,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60433, 15149, 0, 0, 0x00,0x0C,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60456, 15149, 0, 0, 0x00,0x0D,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60479, 15149, 0, 0, 0x00,0x12,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60502, 15149, 0, 0, 0x00,0x13,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {60525, 13119, 0, 0, 0x00,0x00,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60548, 13119, 0, 0, 0x00,0x01,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60571, 13119, 0, 0, 0x00,0x06,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60594, 13119, 0, 0, 0x00,0x07,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60617, 13119, 0, 0, 0x00,0x0C,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60640, 13119, 0, 0, 0x00,0x0D,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60663, 13119, 0, 0, 0x00,0x12,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60686, 13119, 0, 0, 0x00,0x13,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60709, 15149, 0, 0, 0x00,0x00,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60732, 15149, 0, 0, 0x00,0x01,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60755, 15149, 0, 0, 0x00,0x06,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60778, 15149, 0, 0, 0x00,0x07,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60801, 15149, 0, 0, 0x00,0x0C,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60824, 15149, 0, 0, 0x00,0x0D,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60847, 15149, 0, 0, 0x00,0x12,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60870, 15149, 0, 0, 0x00,0x13,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {60893, 13119, 0, 0, 0x01,0x02,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {60913, 13119, 0, 0, 0x01,0x03,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {60933, 13119, 0, 0, 0x01,0x08,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {60953, 13119, 0, 0, 0x01,0x09,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {60973, 13119, 0, 0, 0x01,0x0E,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {60993, 13119, 0, 0, 0x01,0x0F,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61013, 13119, 0, 0, 0x01,0x14,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61033, 13119, 0, 0, 0x01,0x15,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61053, 15149, 0, 0, 0x01,0x02,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61073, 15149, 0, 0, 0x01,0x03,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61093, 15149, 0, 0, 0x01,0x08,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61113, 15149, 0, 0, 0x01,0x09,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61133, 15149, 0, 0, 0x01,0x0E,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61153, 15149, 0, 0, 0x01,0x0F,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61173, 15149, 0, 0, 0x01,0x14,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61193, 15149, 0, 0, 0x01,0x15,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {61213, 13119, 0, 0, 0x01,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {61249, 13119, 0, 0, 0x01,0x02,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {61285, 13119, 0, 0, 0x01,0x02,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {61321, 13119, 0, 0, 0x01,0x02,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {61357, 13119, 0, 0, 0x01,0x02,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {61393, 13119, 0, 0, 0x01,0x02,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {61429, 13119, 0, 0, 0x01,0x02,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {61465, 13119, 0, 0, 0x01,0x02,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {61501, 13119, 0, 0, 0x01,0x02,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {61537, 13119, 0, 0, 0x01,0x02,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {61573, 13119, 0, 0, 0x01,0x02,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {61609, 13119, 0, 0, 0x01,0x02,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {61645, 13119, 0, 0, 0x01,0x02,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {61681, 13119, 0, 0, 0x01,0x02,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {61717, 13119, 0, 0, 0x01,0x02,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {61753, 13119, 0, 0, 0x01,0x02,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {61789, 13119, 0, 0, 0x01,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {61825, 13119, 0, 0, 0x01,0x03,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {61861, 13119, 0, 0, 0x01,0x03,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {61897, 13119, 0, 0, 0x01,0x03,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {61933, 13119, 0, 0, 0x01,0x03,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {61969, 13119, 0, 0, 0x01,0x03,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {62005, 13119, 0, 0, 0x01,0x03,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {62041, 13119, 0, 0, 0x01,0x03,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {62077, 13119, 0, 0, 0x01,0x03,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {62113, 13119, 0, 0, 0x01,0x03,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {62149, 13119, 0, 0, 0x01,0x03,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {62185, 13119, 0, 0, 0x01,0x03,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {62221, 13119, 0, 0, 0x01,0x03,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {62257, 13119, 0, 0, 0x01,0x03,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {62293, 13119, 0, 0, 0x01,0x03,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {62329, 13119, 0, 0, 0x01,0x03,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {62365, 13119, 0, 0, 0x01,0x08,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {62401, 13119, 0, 0, 0x01,0x08,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {62437, 13119, 0, 0, 0x01,0x08,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {62473, 13119, 0, 0, 0x01,0x08,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {62509, 13119, 0, 0, 0x01,0x08,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {62545, 13119, 0, 0, 0x01,0x08,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {62581, 13119, 0, 0, 0x01,0x08,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {62617, 13119, 0, 0, 0x01,0x08,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {62653, 13119, 0, 0, 0x01,0x08,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {62689, 13119, 0, 0, 0x01,0x08,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {62725, 13119, 0, 0, 0x01,0x08,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {62761, 13119, 0, 0, 0x01,0x08,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {62797, 13119, 0, 0, 0x01,0x08,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {62833, 13119, 0, 0, 0x01,0x08,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {62869, 13119, 0, 0, 0x01,0x08,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {62905, 13119, 0, 0, 0x01,0x08,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {62941, 13119, 0, 0, 0x01,0x09,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {62977, 13119, 0, 0, 0x01,0x09,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {63013, 13119, 0, 0, 0x01,0x09,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {63049, 13119, 0, 0, 0x01,0x09,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {63085, 13119, 0, 0, 0x01,0x09,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {63121, 13119, 0, 0, 0x01,0x09,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {63157, 13119, 0, 0, 0x01,0x09,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {63193, 13119, 0, 0, 0x01,0x09,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {63229, 13119, 0, 0, 0x01,0x09,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {63265, 13119, 0, 0, 0x01,0x09,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {63301, 13119, 0, 0, 0x01,0x09,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {63337, 13119, 0, 0, 0x01,0x09,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {63373, 13119, 0, 0, 0x01,0x09,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {63409, 13119, 0, 0, 0x01,0x09,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {63445, 13119, 0, 0, 0x01,0x09,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {63481, 13119, 0, 0, 0x01,0x09,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {63517, 13119, 0, 0, 0x01,0x0E,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {63553, 13119, 0, 0, 0x01,0x0E,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {63589, 13119, 0, 0, 0x01,0x0E,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {63625, 13119, 0, 0, 0x01,0x0E,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {63661, 13119, 0, 0, 0x01,0x0E,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {63697, 13119, 0, 0, 0x01,0x0E,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {63733, 13119, 0, 0, 0x01,0x0E,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {63769, 13119, 0, 0, 0x01,0x0E,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {63805, 13119, 0, 0, 0x01,0x0E,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {63841, 13119, 0, 0, 0x01,0x0E,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {63877, 13119, 0, 0, 0x01,0x0E,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {63913, 13119, 0, 0, 0x01,0x0E,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {63949, 13119, 0, 0, 0x01,0x0E,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {63985, 13119, 0, 0, 0x01,0x0E,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {64021, 13119, 0, 0, 0x01,0x0E,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {64057, 13119, 0, 0, 0x01,0x0E,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {64093, 13119, 0, 0, 0x01,0x0F,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {64129, 13119, 0, 0, 0x01,0x0F,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {64165, 13119, 0, 0, 0x01,0x0F,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {64201, 13119, 0, 0, 0x01,0x0F,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {64237, 13119, 0, 0, 0x01,0x0F,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {64273, 13119, 0, 0, 0x01,0x0F,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {64309, 13119, 0, 0, 0x01,0x0F,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {64345, 13119, 0, 0, 0x01,0x0F,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {64381, 13119, 0, 0, 0x01,0x0F,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {64417, 13119, 0, 0, 0x01,0x0F,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {64453, 13119, 0, 0, 0x01,0x0F,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {64489, 13119, 0, 0, 0x01,0x0F,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {64525, 13119, 0, 0, 0x01,0x0F,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {64561, 13119, 0, 0, 0x01,0x0F,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {64597, 13119, 0, 0, 0x01,0x0F,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {64633, 13119, 0, 0, 0x01,0x0F,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {64669, 13119, 0, 0, 0x01,0x14,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {64705, 13119, 0, 0, 0x01,0x14,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {64741, 13119, 0, 0, 0x01,0x14,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {64777, 13119, 0, 0, 0x01,0x14,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {64813, 13119, 0, 0, 0x01,0x14,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {64849, 13119, 0, 0, 0x01,0x14,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {64885, 13119, 0, 0, 0x01,0x14,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {64921, 13119, 0, 0, 0x01,0x14,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {64957, 13119, 0, 0, 0x01,0x14,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {64993, 13119, 0, 0, 0x01,0x14,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {65029, 13119, 0, 0, 0x01,0x14,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {65065, 13119, 0, 0, 0x01,0x14,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {65101, 13119, 0, 0, 0x01,0x14,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {65137, 13119, 0, 0, 0x01,0x14,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {65173, 13119, 0, 0, 0x01,0x14,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {65209, 13119, 0, 0, 0x01,0x14,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {65245, 13119, 0, 0, 0x01,0x15,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {65281, 13119, 0, 0, 0x01,0x15,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {65317, 13119, 0, 0, 0x01,0x15,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {65353, 13119, 0, 0, 0x01,0x15,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {65389, 13119, 0, 0, 0x01,0x15,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {65425, 13119, 0, 0, 0x01,0x15,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {65461, 13119, 0, 0, 0x01,0x15,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {65497, 13119, 0, 0, 0x01,0x15,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {65533, 13119, 0, 0, 0x01,0x15,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {65569, 13119, 0, 0, 0x01,0x15,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {65605, 13119, 0, 0, 0x01,0x15,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {65641, 13119, 0, 0, 0x01,0x15,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {65677, 13119, 0, 0, 0x01,0x15,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {65713, 13119, 0, 0, 0x01,0x15,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {65749, 13119, 0, 0, 0x01,0x15,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {65785, 13119, 0, 0, 0x01,0x15,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {65821, 15149, 0, 0, 0x01,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {65857, 15149, 0, 0, 0x01,0x02,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {65893, 15149, 0, 0, 0x01,0x02,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {65929, 15149, 0, 0, 0x01,0x02,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {65965, 15149, 0, 0, 0x01,0x02,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {66001, 15149, 0, 0, 0x01,0x02,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {66037, 15149, 0, 0, 0x01,0x02,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {66073, 15149, 0, 0, 0x01,0x02,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {66109, 15149, 0, 0, 0x01,0x02,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {66145, 15149, 0, 0, 0x01,0x02,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {66181, 15149, 0, 0, 0x01,0x02,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {66217, 15149, 0, 0, 0x01,0x02,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {66253, 15149, 0, 0, 0x01,0x02,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {66289, 15149, 0, 0, 0x01,0x02,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {66325, 15149, 0, 0, 0x01,0x02,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {66361, 15149, 0, 0, 0x01,0x02,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {66397, 15149, 0, 0, 0x01,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {66433, 15149, 0, 0, 0x01,0x03,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {66469, 15149, 0, 0, 0x01,0x03,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {66505, 15149, 0, 0, 0x01,0x03,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {66541, 15149, 0, 0, 0x01,0x03,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {66577, 15149, 0, 0, 0x01,0x03,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {66613, 15149, 0, 0, 0x01,0x03,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {66649, 15149, 0, 0, 0x01,0x03,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {66685, 15149, 0, 0, 0x01,0x03,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {66721, 15149, 0, 0, 0x01,0x03,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {66757, 15149, 0, 0, 0x01,0x03,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {66793, 15149, 0, 0, 0x01,0x03,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {66829, 15149, 0, 0, 0x01,0x03,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {66865, 15149, 0, 0, 0x01,0x03,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {66901, 15149, 0, 0, 0x01,0x03,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {66937, 15149, 0, 0, 0x01,0x03,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {66973, 15149, 0, 0, 0x01,0x08,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {67009, 15149, 0, 0, 0x01,0x08,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {67045, 15149, 0, 0, 0x01,0x08,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {67081, 15149, 0, 0, 0x01,0x08,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {67117, 15149, 0, 0, 0x01,0x08,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {67153, 15149, 0, 0, 0x01,0x08,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {67189, 15149, 0, 0, 0x01,0x08,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {67225, 15149, 0, 0, 0x01,0x08,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {67261, 15149, 0, 0, 0x01,0x08,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {67297, 15149, 0, 0, 0x01,0x08,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {67333, 15149, 0, 0, 0x01,0x08,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {67369, 15149, 0, 0, 0x01,0x08,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {67405, 15149, 0, 0, 0x01,0x08,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {67441, 15149, 0, 0, 0x01,0x08,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {67477, 15149, 0, 0, 0x01,0x08,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {67513, 15149, 0, 0, 0x01,0x08,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {67549, 15149, 0, 0, 0x01,0x09,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {67585, 15149, 0, 0, 0x01,0x09,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {67621, 15149, 0, 0, 0x01,0x09,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {67657, 15149, 0, 0, 0x01,0x09,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {67693, 15149, 0, 0, 0x01,0x09,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {67729, 15149, 0, 0, 0x01,0x09,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {67765, 15149, 0, 0, 0x01,0x09,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {67801, 15149, 0, 0, 0x01,0x09,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {67837, 15149, 0, 0, 0x01,0x09,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {67873, 15149, 0, 0, 0x01,0x09,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {67909, 15149, 0, 0, 0x01,0x09,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {67945, 15149, 0, 0, 0x01,0x09,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {67981, 15149, 0, 0, 0x01,0x09,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {68017, 15149, 0, 0, 0x01,0x09,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {68053, 15149, 0, 0, 0x01,0x09,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {68089, 15149, 0, 0, 0x01,0x09,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {68125, 15149, 0, 0, 0x01,0x0E,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {68161, 15149, 0, 0, 0x01,0x0E,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {68197, 15149, 0, 0, 0x01,0x0E,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {68233, 15149, 0, 0, 0x01,0x0E,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {68269, 15149, 0, 0, 0x01,0x0E,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {68305, 15149, 0, 0, 0x01,0x0E,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {68341, 15149, 0, 0, 0x01,0x0E,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {68377, 15149, 0, 0, 0x01,0x0E,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {68413, 15149, 0, 0, 0x01,0x0E,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {68449, 15149, 0, 0, 0x01,0x0E,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {68485, 15149, 0, 0, 0x01,0x0E,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {68521, 15149, 0, 0, 0x01,0x0E,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {68557, 15149, 0, 0, 0x01,0x0E,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {68593, 15149, 0, 0, 0x01,0x0E,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {68629, 15149, 0, 0, 0x01,0x0E,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {68665, 15149, 0, 0, 0x01,0x0E,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {68701, 15149, 0, 0, 0x01,0x0F,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {68737, 15149, 0, 0, 0x01,0x0F,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {68773, 15149, 0, 0, 0x01,0x0F,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {68809, 15149, 0, 0, 0x01,0x0F,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {68845, 15149, 0, 0, 0x01,0x0F,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {68881, 15149, 0, 0, 0x01,0x0F,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {68917, 15149, 0, 0, 0x01,0x0F,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {68953, 15149, 0, 0, 0x01,0x0F,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {68989, 15149, 0, 0, 0x01,0x0F,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {69025, 15149, 0, 0, 0x01,0x0F,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {69061, 15149, 0, 0, 0x01,0x0F,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {69097, 15149, 0, 0, 0x01,0x0F,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {69133, 15149, 0, 0, 0x01,0x0F,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {69169, 15149, 0, 0, 0x01,0x0F,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {69205, 15149, 0, 0, 0x01,0x0F,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {69241, 15149, 0, 0, 0x01,0x0F,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {69277, 15149, 0, 0, 0x01,0x14,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {69313, 15149, 0, 0, 0x01,0x14,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {69349, 15149, 0, 0, 0x01,0x14,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {69385, 15149, 0, 0, 0x01,0x14,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {69421, 15149, 0, 0, 0x01,0x14,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {69457, 15149, 0, 0, 0x01,0x14,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {69493, 15149, 0, 0, 0x01,0x14,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {69529, 15149, 0, 0, 0x01,0x14,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {69565, 15149, 0, 0, 0x01,0x14,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {69601, 15149, 0, 0, 0x01,0x14,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {69637, 15149, 0, 0, 0x01,0x14,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {69673, 15149, 0, 0, 0x01,0x14,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {69709, 15149, 0, 0, 0x01,0x14,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {69745, 15149, 0, 0, 0x01,0x14,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {69781, 15149, 0, 0, 0x01,0x14,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {69817, 15149, 0, 0, 0x01,0x14,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {69853, 15149, 0, 0, 0x01,0x15,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {69889, 15149, 0, 0, 0x01,0x15,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {69925, 15149, 0, 0, 0x01,0x15,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {69961, 15149, 0, 0, 0x01,0x15,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {69997, 15149, 0, 0, 0x01,0x15,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {70033, 15149, 0, 0, 0x01,0x15,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {70069, 15149, 0, 0, 0x01,0x15,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {70105, 15149, 0, 0, 0x01,0x15,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {70141, 15149, 0, 0, 0x01,0x15,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {70177, 15149, 0, 0, 0x01,0x15,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {70213, 15149, 0, 0, 0x01,0x15,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {70249, 15149, 0, 0, 0x01,0x15,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {70285, 15149, 0, 0, 0x01,0x15,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {70321, 15149, 0, 0, 0x01,0x15,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {70357, 15149, 0, 0, 0x01,0x15,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {70393, 15149, 0, 0, 0x01,0x15,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {70429, 70447, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70452, 70447, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70471, 70447, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70490, 70447, 0, 0, 0x14,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {70505, 70447, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70523, 70447, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70542, 70447, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70558, 70447, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {70575, 70447, 0, 0, 0x15,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {70588, 70447, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70609, 70447, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70631, 70447, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70650, 70447, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {70670, 70447, 0, 0, 0x16,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {70686, 70447, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70707, 70447, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70729, 70447, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70748, 70447, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {70768, 70447, 0, 0, 0x17,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {70784, 70447, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {70817, 70447, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {70834, 70447, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {70852, 70447, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {70870, 70447, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {70887, 70447, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {70905, 70447, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {70923, 70447, 0, 0, 0x0A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {70940, 70447, 0, 0, 0x0A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {70958, 70447, 0, 0, 0x0A,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {70976, 70447, 0, 0, 0x0A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {70990, 70447, 0, 0, 0x0A,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {71005, 70447, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71020, 70447, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71036, 70447, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {71052, 70447, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71067, 70447, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71083, 70447, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {71099, 70447, 0, 0, 0x0A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71114, 70447, 0, 0, 0x0A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71130, 70447, 0, 0, 0x0A,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {71146, 70447, 0, 0, 0x0A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71158, 70447, 0, 0, 0x0A,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {71171, 70447, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71189, 70447, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71208, 70447, 0, 0, 0x02,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {71227, 70447, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71245, 70447, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71264, 70447, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {71283, 70447, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71298, 70447, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71316, 70447, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71335, 70447, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {71354, 70447, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71381, 70447, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71408, 70447, 0, 0, 0x0C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71435, 70447, 0, 0, 0x0C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71462, 70447, 0, 0, 0x0C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71489, 70447, 0, 0, 0x0C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71516, 70447, 0, 0, 0x0C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71543, 70447, 0, 0, 0x0C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {71570, 70447, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71602, 70447, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71634, 70447, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71666, 70447, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71698, 70447, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71706, 70447, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71727, 70447, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71749, 70447, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71771, 70447, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71792, 70447, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {71812, 70447, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {71831, 70447, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {71850, 70447, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {71874, 70447, 0, 0, 0x11,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {71900, 70447, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {71919, 70447, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {71941, 70447, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {71960, 70447, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {71989, 70447, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72017, 70447, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72047, 70447, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72068, 70447, 0, 0, 0x12,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {72089, 70447, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72103, 70447, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72117, 70447, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72131, 70447, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72146, 70447, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72161, 70447, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72175, 70447, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72188, 70447, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72201, 70447, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72214, 70447, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72227, 70447, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72240, 70447, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72253, 70447, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72266, 70447, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72279, 70447, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72292, 70447, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72305, 70447, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72329, 70447, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72353, 70447, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72377, 70447, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72401, 70447, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72426, 70447, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72451, 70447, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72476, 70447, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {72501, 70447, 0, 0, 0x28,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {72522, 70447, 0, 0, 0x28,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {72543, 70447, 0, 0, 0x28,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {72564, 70447, 0, 0, 0x28,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {72585, 70447, 0, 0, 0x28,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {72605, 70447, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72620, 70447, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72636, 70447, 0, 0, 0x27,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {72652, 70447, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72677, 70447, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72702, 70447, 0, 0, 0x0B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {72723, 70447, 0, 0, 0x0B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72745, 70447, 0, 0, 0x0B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {72763, 70447, 0, 0, 0x0B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72784, 70447, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72806, 70447, 0, 0, 0x0B,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {72824, 70447, 0, 0, 0x0B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72845, 70447, 0, 0, 0x0B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72867, 70447, 0, 0, 0x0B,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {72885, 70447, 0, 0, 0x0B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {72903, 70447, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72913, 70447, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72923, 70447, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72933, 70447, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72944, 70447, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72955, 70447, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72965, 72985, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72990, 72985, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73011, 72985, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73026, 72985, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73041, 72985, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73062, 72985, 0, 0, 0x1E4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73076, 72985, 0, 0, 0x1E6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73086, 72985, 0, 0, 0xF9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73096, 72985, 0, 0, 0x1DF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73102, 72985, 0, 0, 0x050,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73115, 72985, 0, 0, 0x051,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73134, 72985, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73140, 73155, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73160, 73155, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73173, 73155, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73193, 73155, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73209, 73155, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73229, 73155, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73250, 73155, 0, 0, 0x40,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73267, 73155, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73287, 73155, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73308, 73155, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {73325, 73155, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73345, 73155, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73366, 73155, 0, 0, 0x40,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {73383, 73155, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73405, 73155, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73428, 73155, 0, 0, 0x41,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73447, 73155, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73469, 73155, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73492, 73155, 0, 0, 0x41,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {73511, 73155, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73533, 73155, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73556, 73155, 0, 0, 0x41,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {73575, 73155, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73599, 73155, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73624, 73155, 0, 0, 0x42,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73645, 73155, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73669, 73155, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73694, 73155, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {73715, 73155, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73739, 73155, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73764, 73155, 0, 0, 0x42,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {73785, 73155, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73806, 73155, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73828, 73155, 0, 0, 0x43,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73846, 73155, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73867, 73155, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73889, 73155, 0, 0, 0x43,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {73907, 73155, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73928, 73155, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73950, 73155, 0, 0, 0x43,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {73968, 73155, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73983, 73155, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73998, 73155, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74013, 73155, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74029, 73155, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74042, 73155, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74055, 73155, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74068, 73155, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74082, 73155, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74096, 73155, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74110, 73155, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74124, 73155, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74138, 73155, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74152, 73155, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74166, 73155, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74185, 73155, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74204, 73155, 0, 0, 0x86,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74222, 73155, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74243, 73155, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74264, 73155, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74278, 73155, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74292, 73155, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74306, 73155, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74320, 73155, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74342, 73155, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74364, 73155, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74386, 73155, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74408, 73155, 0, 0, 0x64,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {74426, 73155, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74445, 73155, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74464, 73155, 0, 0, 0x60,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74482, 73155, 0, 0, 0x68,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74504, 73155, 0, 0, 0x68,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74526, 73155, 0, 0, 0x68,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74548, 73155, 0, 0, 0x68,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74570, 73155, 0, 0, 0x68,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {74588, 73155, 0, 0, 0x66,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74610, 73155, 0, 0, 0x66,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74632, 73155, 0, 0, 0x66,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74654, 73155, 0, 0, 0x66,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74676, 73155, 0, 0, 0x66,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {74694, 73155, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74708, 73155, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74722, 73155, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74742, 73155, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74763, 73155, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74779, 73155, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74799, 73155, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74823, 73155, 0, 0, 0x51,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74843, 73155, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74867, 73155, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74892, 73155, 0, 0, 0x31,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74914, 73155, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74929, 73155, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74958, 73155, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74985, 73155, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75012, 73155, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75039, 73155, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75066, 73155, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75093, 73155, 0, 0, 0x26,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {75120, 73155, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75149, 73155, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75176, 73155, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75205, 73155, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75234, 73155, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75261, 73155, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75288, 73155, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75317, 73155, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75344, 73155, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75371, 73155, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75400, 73155, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75427, 73155, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75461, 73155, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75495, 73155, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75529, 73155, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {75563, 73155, 0, 0, 0x0E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {75593, 73155, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75625, 73155, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75657, 73155, 0, 0, 0x0F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75689, 73155, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {75721, 73155, 0, 0, 0x0F,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {75749, 73155, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75781, 73155, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75813, 73155, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75845, 73155, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {75877, 73155, 0, 0, 0x10,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {75905, 73155, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75938, 73155, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75971, 73155, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {76003, 73155, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76034, 73155, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76065, 73155, 0, 0, 0x06,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {76095, 73155, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76126, 73155, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76157, 73155, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {76187, 73155, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76221, 73155, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76255, 73155, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76289, 73155, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76323, 73155, 0, 0, 0x11,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {76353, 73155, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76385, 73155, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76417, 73155, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76449, 73155, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76481, 73155, 0, 0, 0x12,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {76509, 73155, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76541, 73155, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76573, 73155, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76605, 73155, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76637, 73155, 0, 0, 0x13,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {76665, 73155, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76699, 73155, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76733, 73155, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76767, 73155, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76801, 73155, 0, 0, 0x14,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {76831, 73155, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76863, 73155, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76895, 73155, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76927, 73155, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76959, 73155, 0, 0, 0x15,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {76987, 73155, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77019, 73155, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77051, 73155, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {77083, 73155, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {77115, 73155, 0, 0, 0x16,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {77143, 73155, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77169, 73155, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77193, 73155, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77217, 73155, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {77230, 73155, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77252, 73155, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77275, 73155, 0, 0, 0x6C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {77295, 73155, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77321, 73155, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77345, 73155, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable nehalemEX_arch_events = {
+    NUM_ARCH_EVENTS_NEHALEMEX,
+    nehalemEX_arch_event_strings,
+    nehalemEX_arch_event_options,
+    nehalemEX_arch_event_entries
+};
@@ -0,0 +1,1022 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_NEHALEM 498
+
+static const char nehalem_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "SB_FORWARD_ANY\0"
+    "PMC\0"
+    "LOAD_BLOCK_STD\0"
+    "LOAD_BLOCK_ADDRESS_OFFSET\0"
+    "SB_DRAIN_ANY\0"
+    "MISALIGN_MEM_REF_LOAD\0"
+    "MISALIGN_MEM_REF_STORE\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "STORE_BLOCK_NOT_STA\0"
+    "STORE_BLOCK_STA\0"
+    "STORE_BLOCK_AT_RET\0"
+    "STORE_BLOCK_L1D_BLOCK\0"
+    "STORE_BLOCK_ANY\0"
+    "PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_ANY\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_MISS\0"
+    "DTLB_LOAD_MISSES_PDP_MISS\0"
+    "DTLB_LOAD_MISSES_LARGE_WALK_COMPLETED\0"
+    "MEMORY_DISAMBIGURATION_RESET\0"
+    "MEMORY_DISAMBIGURATION_SUCCESS\0"
+    "MEMORY_DISAMBIGURATION_WATCHDOG\0"
+    "MEMORY_DISAMBIGURATION_WATCH_CYCLES\0"
+    "MEM_INST_RETIRED_LOADS\0"
+    "MEM_INST_RETIRED_STORES\0"
+    "MEM_INST_RETIRED_LATENCY_ABOVE_THRESHOLD\0"
+    "MEM_STORE_RETIRED_DTLB_MISS\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_STALLED_CYCLES\0"
+    "UOPS_ISSUED_FUSED\0"
+    "MEM_UNCORE_RETIRED_OTHER_CORE_L2_HITM\0"
+    "MEM_UNCORE_RETIRED_REMOTE_CACHE_LOCAL_HOME_HIT\0"
+    "MEM_UNCORE_RETIRED_REMOTE_DRAM\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_MMX\0"
+    "FP_COMP_OPS_EXE_SSE_FP\0"
+    "FP_COMP_OPS_EXE_SSE2_INTEGER\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR\0"
+    "FP_COMP_OPS_EXE_SSE_SINGLE_PRECISION\0"
+    "FP_COMP_OPS_EXE_SSE_DOUBLE_PRECISION\0"
+    "SIMD_INT_128_PACKED_MPY\0"
+    "SIMD_INT_128_PACKED_SHIFT\0"
+    "SIMD_INT_128_PACK\0"
+    "SIMD_INT_128_UNPACK\0"
+    "SIMD_INT_128_PACKED_LOGICAL\0"
+    "SIMD_INT_128_PACKED_ARITH\0"
+    "SIMD_INT_128_SHUFFLE_MOVE\0"
+    "LOAD_DISPATCH_RS\0"
+    "LOAD_DISPATCH_RS_DELAYED\0"
+    "LOAD_DISPATCH_MOB\0"
+    "LOAD_DISPATCH_ANY\0"
+    "ARITH_CYCLES_DIV_BUSY\0"
+    "ARITH_NUM_DIV\0"
+    "ARITH_MUL\0"
+    "INST_QUEUE_WRITES\0"
+    "INST_DECODED_DECO\0"
+    "TWO_UPOS_INST_DECODED\0"
+    "HW_INT_RCV\0"
+    "HW_CYCLES_MASKED\0"
+    "HW_CYCLES_PENDING_AND_MASKED\0"
+    "INST_QUEUE_WRITE_CYCLES\0"
+    "LSD_OVERFLOW\0"
+    "L2_RQSTS_LD_HIT\0"
+    "L2_RQSTS_LD_MISS\0"
+    "L2_RQSTS_LOADS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFOS\0"
+    "L2_RQSTS_IFETCH_HIT\0"
+    "L2_RQSTS_IFETCH_MISS\0"
+    "L2_RQSTS_IFETCHES\0"
+    "L2_RQSTS_PREFETCH_HIT\0"
+    "L2_RQSTS_PREFETCH_MISS\0"
+    "L2_RQSTS_PREFETCHES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DATA_RQSTS_DEMAND_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_MESI\0"
+    "L2_DATA_RQSTS_ANY\0"
+    "L2_WRITE_RFO_I_STATE\0"
+    "L2_WRITE_RFO_S_STATE\0"
+    "L2_WRITE_RFO_E_STATE\0"
+    "L2_WRITE_RFO_M_STATE\0"
+    "L2_WRITE_RFO_HIT\0"
+    "L2_WRITE_RFO_MESI\0"
+    "L2_WRITE_LOCK_I_STATE\0"
+    "L2_WRITE_LOCK_S_STATE\0"
+    "L2_WRITE_LOCK_E_STATE\0"
+    "L2_WRITE_LOCK_M_STATE\0"
+    "L2_WRITE_LOCK_HIT\0"
+    "L2_WRITE_LOCK_MESI\0"
+    "L1D_WB_L2_I_STATE\0"
+    "L1D_WB_L2_S_STATE\0"
+    "L1D_WB_L2_E_STATE\0"
+    "L1D_WB_L2_M_STATE\0"
+    "L1D_WB_L2_MESI\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "UOPS_DECODED_DEC0\0"
+    "L1D_CACHE_LD_I_STATE\0"
+    "PMC0|PMC1\0"
+    "L1D_CACHE_LD_S_STATE\0"
+    "L1D_CACHE_LD_E_STATE\0"
+    "L1D_CACHE_LD_M_STATE\0"
+    "L1D_CACHE_LD_MESI\0"
+    "L1D_CACHE_ST_I_STATE\0"
+    "L1D_CACHE_ST_S_STATE\0"
+    "L1D_CACHE_ST_E_STATE\0"
+    "L1D_CACHE_ST_M_STATE\0"
+    "L1D_CACHE_ST_MESI\0"
+    "L1D_CACHE_LOCK_HIT\0"
+    "L1D_CACHE_LOCK_S_STATE\0"
+    "L1D_CACHE_LOCK_E_STATE\0"
+    "L1D_CACHE_LOCK_M_STATE\0"
+    "L1D_ALL_REF_ANY\0"
+    "L1D_ALL_REF_CACHEABLE\0"
+    "L1D_PEND_MISS_LOAD_BUFFERS_FULL\0"
+    "DTLB_MISSES_ANY\0"
+    "DTLB_MISSES_WALK_COMPLETED\0"
+    "DTLB_MISSES_STLB_HIT\0"
+    "DTLB_MISSES_PDE_MISS\0"
+    "DTLB_MISSES_PDP_MISS\0"
+    "DTLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "SSE_MEM_EXEC_NTA\0"
+    "SSE_MEM_EXEC_STREAMING_STORES\0"
+    "LOAD_HIT_PRE\0"
+    "SFENCE_CYCLES\0"
+    "L1D_PREFETCH_REQUESTS\0"
+    "L1D_PREFETCH_MISS\0"
+    "L1D_PREFETCH_TRIGGERS\0"
+    "EPT_EPDE_MISS\0"
+    "EPT_EPDPE_HIT\0"
+    "EPT_EPDPE_MISS\0"
+    "L1D_REPL\0"
+    "L1D_M_REPL\0"
+    "L1D_M_EVICT\0"
+    "L1D_M_SNOOP_EVICT\0"
+    "L1D_CACHE_PREFETCH_LOCK_FB_HIT\0"
+    "L1D_CACHE_LOCK_FB_HIT\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_DATA\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_CODE\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_EVENTS_OUTSTANDING_ANY_READ\0"
+    "CACHE_LOCK_CYCLES_L1D_L2\0"
+    "CACHE_LOCK_CYCLES_L1D\0"
+    "IO_TRANSACTIONS\0"
+    "L1I_HITS\0"
+    "L1I_MISSES\0"
+    "L1I_READS\0"
+    "L1I_CYCLES_STALLED\0"
+    "IFU_IVC_FULL\0"
+    "IFU_IVC_L1I_EVICTION\0"
+    "LARGE_ITLB_HIT\0"
+    "L1I_OPPORTUNISTIC_HITS\0"
+    "ITLB_MISSES_ANY\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_STALL_LCP\0"
+    "ITLB_STALL_MRU\0"
+    "ITLB_STALL_IQ_FULL\0"
+    "ITLB_STALL_REGEN\0"
+    "ITLB_STALL_ANY\0"
+    "BR_INST_EXEC_COND\0"
+    "BR_INST_EXEC_DIRECT\0"
+    "BR_INST_EXEC_INDIRECT_NON_CALL\0"
+    "BR_INST_EXEC_NON_CALLS\0"
+    "BR_INST_EXEC_RETURN_NEAR\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_NEAR_CALLS\0"
+    "BR_INST_EXEC_TAKEN\0"
+    "BR_INST_EXEC_ANY\0"
+    "BR_MISP_EXEC_COND\0"
+    "BR_MISP_EXEC_DIRECT\0"
+    "BR_MISP_EXEC_INDIRECT_NON_CALL\0"
+    "BR_MISP_EXEC_NON_CALLS\0"
+    "BR_MISP_EXEC_RETURN_NEAR\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_NEAR_CALLS\0"
+    "BR_MISP_EXEC_TAKEN\0"
+    "BR_MISP_EXEC_ANY\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LOAD\0"
+    "RESOURCE_STALLS_RS_FULL\0"
+    "RESOURCE_STALLS_STORE\0"
+    "RESOURCE_STALLS_ROB_FULL\0"
+    "RESOURCE_STALLS_FPCW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "MACRO_INSTS_FUSIONS_DECODED\0"
+    "BACLEAR_FORCE_IQ\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES\0"
+    "ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_L1D_WRITEBACK\0"
+    "UOPS_EXECUTED_PORT0\0"
+    "UOPS_EXECUTED_PORT1\0"
+    "UOPS_EXECUTED_PORT2_CORE\0"
+    "UOPS_EXECUTED_PORT3_CORE\0"
+    "UOPS_EXECUTED_PORT4_CORE\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT_NO_PORT5\0"
+    "UOPS_EXECUTED_PORT5\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT\0"
+    "UOPS_EXECUTED_PORT015\0"
+    "UOPS_EXECUTED_PORT015_STALL_CYCLES\0"
+    "UOPS_EXECUTED_PORT234\0"
+    "OFFCORE_REQUESTS_SQ_FULL\0"
+    "SNOOP_RESPONSE_HIT\0"
+    "SNOOP_RESPONSE_HITE\0"
+    "SNOOP_RESPONSE_HITM\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_MMX\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_ACTIVE_CYCLES\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_MACRO_FUSED\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEM_ORDER\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_ALL_RET_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "SSEX_UOPS_RETIRED_PACKED_SINGLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_SINGLE\0"
+    "SSEX_UOPS_RETIRED_PACKED_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_VECTOR_INTEGER\0"
+    "ITLB_MISS_RETIRED\0"
+    "MEM_LOAD_RETIRED_L1D_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_UNSHARED_HIT\0"
+    "MEM_LOAD_RETIRED_OTHER_CORE_L2_HIT_HITM\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "FP_MMX_TRANS_TO_FP\0"
+    "FP_MMX_TRANS_TO_MMX\0"
+    "FP_MMX_TRANS_TO_ANY\0"
+    "MACRO_INSTS_DECODED\0"
+    "UOPS_DECODED_MS\0"
+    "UOPS_DECODED_ESP_FOLDING\0"
+    "UOPS_DECODED_ESP_SYNC\0"
+    "RAT_STALLS_FLAGS\0"
+    "RAT_STALLS_REGISTERS\0"
+    "RAT_STALLS_ROB_READ_PORT\0"
+    "RAT_STALLS_SCOREBOARD\0"
+    "RAT_STALLS_ANY\0"
+    "SEG_RENAME_STALLS\0"
+    "ES_SEG_RENAMES\0"
+    "UOP_UNFUSION\0"
+    "BR_INST_DECODED\0"
+    "BPU_MISSED_CALL_RET\0"
+    "BACLEAR_CLEAR\0"
+    "BACLEAR_BAD_TARGET\0"
+    "BPU_CLEARS_EARLY\0"
+    "BPU_CLEARS_LATE\0"
+    "BPU_CLEARS_ANY\0"
+    "L2_TRANSACTIONS_LOAD\0"
+    "L2_TRANSACTIONS_RFO\0"
+    "L2_TRANSACTIONS_IFETCH\0"
+    "L2_TRANSACTIONS_PREFETCH\0"
+    "L2_TRANSACTIONS_L1D_WB\0"
+    "L2_TRANSACTIONS_FILL\0"
+    "L2_TRANSACTIONS_WB\0"
+    "L2_TRANSACTIONS_ANY\0"
+    "L2_LINES_IN_S_STATE\0"
+    "L2_LINES_IN_E_STATE\0"
+    "L2_LINES_IN_ANY\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PREFETCH_CLEAN\0"
+    "L2_LINES_OUT_PREFETCH_DIRTY\0"
+    "L2_LINES_OUT_ANY\0"
+    "L2_HW_PREFETCH_HIT\0"
+    "L2_HW_PREFETCH_ALLOC\0"
+    "L2_HW_PREFETCH_DATA_TRIGGER\0"
+    "L2_HW_PREFETCH_CODE_TRIGGER\0"
+    "L2_HW_PREFETCH_DCA_TRIGGER\0"
+    "L2_HW_PREFETCH_KICK_START\0"
+    "SQ_MISC_PROMOTION\0"
+    "SQ_MISC_PROMOTION_POST_GO\0"
+    "SQ_MISC_LRU_HINTS\0"
+    "SQ_MISC_FILL_DROPPED\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "SQ_FULL_STALL_CYCLES\0"
+    "FP_ASSIST_ALL\0"
+    "FP_ASSIST_OUTPUT\0"
+    "FP_ASSIST_INPUT\0"
+    "SIMD_INT_64_PACKED_MPY\0"
+    "SIMD_INT_64_PACKED_SHIFT\0"
+    "SIMD_INT_64_PACK\0"
+    "SIMD_INT_64_UNPACK\0"
+    "SIMD_INT_64_PACKED_LOGICAL\0"
+    "SIMD_INT_64_PACKED_ARITH\0"
+    "SIMD_INT_64_SHUFFLE_MOVE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "UNCORE_CLOCK\0"
+    "UPMCFIX\0"
+    "UNC_GQ_CYCLES_FULL_READ_TRACKER\0"
+    "UPMC\0"
+    "UNC_GQ_CYCLES_FULL_WRITE_TRACKER\0"
+    "UNC_GQ_CYCLES_FULL_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_READ_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_WRITE_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_ALLOC_READ_TRACKER\0"
+    "UNC_GQ_ALLOC_RT_L3_MISS\0"
+    "UNC_GQ_ALLOC_RT_TO_L3_RESP\0"
+    "UNC_GQ_ALLOC_RT_TO_RTID_ACQUIRED\0"
+    "UNC_GQ_ALLOC_WT_TO_RTID_ACQUIRED\0"
+    "UNC_GQ_ALLOC_WRITE_TRACKER\0"
+    "UNC_GQ_ALLOC_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_DATA_FROM_QPI\0"
+    "UNC_GQ_DATA_FROM_QMC\0"
+    "UNC_GQ_DATA_FROM_L3\0"
+    "UNC_GQ_DATA_FROM_CORES_02\0"
+    "UNC_GQ_DATA_FROM_CORES_13\0"
+    "UNC_GQ_DATA_TO_QPI_QMC\0"
+    "UNC_GQ_DATA_TO_L3\0"
+    "UNC_GQ_DATA_TO_CORES\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_I_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_S_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_FWD_S_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_FWD_I_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_CONFLICT\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_WB\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_I_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_S_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_FWD_S_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_FWD_I_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_CONFLICT\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_WB\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_HITM\0"
+    "UNC_L3_HITS_READ\0"
+    "UNC_L3_HITS_WRITE\0"
+    "UNC_L3_HITS_PROBE\0"
+    "UNC_L3_HITS_ANY\0"
+    "UNC_L3_MISS_READ\0"
+    "UNC_L3_MISS_WRITE\0"
+    "UNC_L3_MISS_PROBE\0"
+    "UNC_L3_MISS_ANY\0"
+    "UNC_L3_LINES_IN_M_STATE\0"
+    "UNC_L3_LINES_IN_E_STATE\0"
+    "UNC_L3_LINES_IN_S_STATE\0"
+    "UNC_L3_LINES_IN_F_STATE\0"
+    "UNC_L3_LINES_IN_ANY\0"
+    "UNC_L3_LINES_OUT_M_STATE\0"
+    "UNC_L3_LINES_OUT_E_STATE\0"
+    "UNC_L3_LINES_OUT_S_STATE\0"
+    "UNC_L3_LINES_OUT_I_STATE\0"
+    "UNC_L3_LINES_OUT_F_STATE\0"
+    "UNC_L3_LINES_OUT_ANY\0"
+    "UNC_QHL_REQUESTS_IOH_READS\0"
+    "UNC_QHL_REQUESTS_IOH_WRITES\0"
+    "UNC_QHL_REQUESTS_REMOTE_READS\0"
+    "UNC_QHL_REQUESTS_REMOTE_WRITES\0"
+    "UNC_QHL_REQUESTS_LOCAL_READS\0"
+    "UNC_QHL_REQUESTS_LOCAL_WRITES\0"
+    "UNC_QHL_CYCLES_FULL_IOH\0"
+    "UNC_QHL_CYCLES_FULL_REMOTE\0"
+    "UNC_QHL_CYCLES_FULL_LOCAL\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_IOH\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_REMOTE\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_LOCAL\0"
+    "UNC_QHL_OCCUPANCY_IOH\0"
+    "UNC_QHL_OCCUPANCY_REMOTE\0"
+    "UNC_QHL_OCCUPANCY_LOCAL\0"
+    "UNC_QHL_ADDRESS_CONFLICTS_2WAY\0"
+    "UNC_QHL_ADDRESS_CONFLICTS_3WAY\0"
+    "UNC_QHL_CONFLICT_CYCLES_IOH\0"
+    "UNC_QHL_CONFLICT_CYCLES_REMOTE\0"
+    "UNC_QHL_CONFLICT_CYCLES_LOCAL\0"
+    "UNC_QHL_TO_QMC_BYPASS\0"
+    "UNC_QMC_NORMAL_FULL_READ_CH0\0"
+    "UNC_QMC_NORMAL_FULL_READ_CH1\0"
+    "UNC_QMC_NORMAL_FULL_READ_CH2\0"
+    "UNC_QMC_NORMAL_FULL_READ_ANY\0"
+    "UNC_QMC_NORMAL_FULL_WRITE_CH0\0"
+    "UNC_QMC_NORMAL_FULL_WRITE_CH1\0"
+    "UNC_QMC_NORMAL_FULL_WRITE_CH2\0"
+    "UNC_QMC_ISOC_FULL_READ_CH0\0"
+    "UNC_QMC_ISOC_FULL_READ_CH1\0"
+    "UNC_QMC_ISOC_FULL_READ_CH2\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH0\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH1\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH2\0"
+    "UNC_QMC_BUSY_READ_CH0\0"
+    "UNC_QMC_BUSY_READ_CH1\0"
+    "UNC_QMC_BUSY_READ_CH2\0"
+    "UNC_QMC_BUSY_WRITE_CH0\0"
+    "UNC_QMC_BUSY_WRITE_CH1\0"
+    "UNC_QMC_BUSY_WRITE_CH2\0"
+    "UNC_QMC_OCCUPANCY_CH0\0"
+    "UNC_QMC_OCCUPANCY_CH1\0"
+    "UNC_QMC_OCCUPANCY_CH2\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH0\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH1\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH2\0"
+    "UNC_QMC_ISSOC_READS_ANY\0"
+    "UNC_QMC_NORMAL_READS_CH0\0"
+    "UNC_QMC_NORMAL_READS_CH1\0"
+    "UNC_QMC_NORMAL_READS_CH2\0"
+    "UNC_QMC_NORMAL_READS_ANY\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH0\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH1\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH2\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_ANY\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH0\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH1\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH2\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_ANY\0"
+    "UNC_QMC_WRITES_FULL_CH0\0"
+    "UNC_QMC_WRITES_FULL_CH1\0"
+    "UNC_QMC_WRITES_FULL_CH2\0"
+    "UNC_QMC_WRITES_FULL_ANY\0"
+    "UNC_QMC_WRITES_PARTIAL_CH0\0"
+    "UNC_QMC_WRITES_PARTIAL_CH1\0"
+    "UNC_QMC_WRITES_PARTIAL_CH2\0"
+    "UNC_QMC_WRITES_PARTIAL_ANY\0"
+    "UNC_QMC_CANCEL_CH0\0"
+    "UNC_QMC_CANCEL_CH1\0"
+    "UNC_QMC_CANCEL_CH2\0"
+    "UNC_QMC_CANCEL_ANY\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH0\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH1\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH2\0"
+    "UNC_QMC_PRIORITY_UPDATES_ANY\0"
+    "UNC_QHL_FRC_ACK_CNFLTS_LOCAL\0"
+    "UNC_ADDR_OPCODE_MATCH_OR\0"
+    "UNC_ADDR_OPCODE_MATCH_AND\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_HOME_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_SNOOP_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_NDR_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_HOME_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_SNOOP_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_NDR_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_DRS_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCB_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCS_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_DRS_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCB_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCS_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_LINK_1\0"
+    "UNC_QPI_TX_HEADER_BUSY_LINK_0\0"
+    "UNC_QPI_TX_HEADER_BUSY_LINK_1\0"
+    "UNC_QPI_RX_NO_PPT_CREDIT_STALLS_LINK_0\0"
+    "UNC_QPI_RX_NO_PPT_CREDIT_STALLS_LINK_1\0"
+    "UNC_DRAM_OPEN_CH0\0"
+    "UNC_DRAM_OPEN_CH1\0"
+    "UNC_DRAM_OPEN_CH2\0"
+    "UNC_DRAM_PAGE_CLOSE_CH0\0"
+    "UNC_DRAM_PAGE_CLOSE_CH1\0"
+    "UNC_DRAM_PAGE_CLOSE_CH2\0"
+    "UNC_DRAM_PAGE_MISS_CH0\0"
+    "UNC_DRAM_PAGE_MISS_CH1\0"
+    "UNC_DRAM_PAGE_MISS_CH2\0"
+    "UNC_DRAM_READ_CAS_CH0\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH0\0"
+    "UNC_DRAM_READ_CAS_CH1\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH1\0"
+    "UNC_DRAM_READ_CAS_CH2\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH2\0"
+    "UNC_DRAM_WRITE_CAS_CH0\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH0\0"
+    "UNC_DRAM_WRITE_CAS_CH1\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH1\0"
+    "UNC_DRAM_WRITE_CAS_CH2\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH2\0"
+    "UNC_DRAM_REFRESH_CH0\0"
+    "UNC_DRAM_REFRESH_CH1\0"
+    "UNC_DRAM_REFRESH_CH2\0"
+    "UNC_DRAM_PRE_ALL_CH0\0"
+    "UNC_DRAM_PRE_ALL_CH1\0"
+    "UNC_DRAM_PRE_ALL_CH2\0";
+
+static const PerfmonEventOption nehalem_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry nehalem_arch_event_entries[NUM_ARCH_EVENTS_NEHALEM] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 73, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79, 94, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {98, 94, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {113, 94, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 94, 0, 0, 0x04,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {152, 94, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {174, 94, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {197, 94, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 94, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {238, 94, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {254, 94, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {273, 94, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {295, 94, 0, 0, 0x06,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {311, 94, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 94, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {354, 94, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {386, 94, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {412, 94, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {438, 94, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {464, 94, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {502, 94, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {531, 94, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {562, 94, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {594, 94, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {630, 94, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {653, 94, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {677, 94, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {718, 94, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {746, 94, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {762, 94, 0, 0, 0x0E,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {789, 94, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {807, 94, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {845, 94, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {892, 94, 0, 0, 0x0F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {923, 94, 0, 0, 0x0F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {953, 94, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {973, 94, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {993, 94, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1016, 94, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1045, 94, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1075, 94, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1105, 94, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1142, 94, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1179, 94, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1203, 94, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1229, 94, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1247, 94, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1267, 94, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1295, 94, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1321, 94, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1347, 94, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1364, 94, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1389, 94, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1407, 94, 0, 0, 0x13,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1425, 94, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1447, 94, 0, 0, 0x14,0x01,0xC5,0x01,EVENT_OPTION_NONE_MASK}
+, {1461, 94, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1471, 94, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1489, 94, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1507, 94, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1529, 94, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1540, 94, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1557, 94, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1586, 94, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1610, 94, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1623, 94, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1639, 94, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1656, 94, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1671, 94, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1688, 94, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1706, 94, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1720, 94, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1740, 94, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1761, 94, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1779, 94, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1801, 94, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1824, 94, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1844, 94, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1858, 94, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1878, 94, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1907, 94, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1936, 94, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1965, 94, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1994, 94, 0, 0, 0x26,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2020, 94, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2058, 94, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2096, 94, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2134, 94, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2172, 94, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2207, 94, 0, 0, 0x26,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {2225, 94, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2246, 94, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2267, 94, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2288, 94, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2309, 94, 0, 0, 0x27,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2326, 94, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2344, 94, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2366, 94, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2388, 94, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 94, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2432, 94, 0, 0, 0x27,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2450, 94, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2469, 94, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2487, 94, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2505, 94, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2523, 94, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2541, 94, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2556, 94, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2579, 94, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2597, 94, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2625, 94, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2650, 94, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2668, 2689, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2699, 2689, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2720, 2689, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2741, 2689, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2762, 2689, 0, 0, 0x40,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2780, 2689, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2801, 2689, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2822, 2689, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2843, 2689, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2864, 2689, 0, 0, 0x41,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2882, 2689, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2901, 2689, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2924, 2689, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2947, 2689, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2970, 2689, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2986, 2689, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3008, 2689, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3040, 94, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3056, 94, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3083, 94, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3104, 94, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3125, 94, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3146, 94, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3179, 94, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3196, 94, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3226, 94, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3239, 94, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3253, 94, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3275, 94, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3293, 94, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3315, 94, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3329, 94, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3343, 94, 0, 0, 0x4F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3358, 2689, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3367, 2689, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3378, 2689, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3390, 2689, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3408, 94, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3439, 2689, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3461, 94, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3505, 94, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3549, 94, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3587, 94, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3623, 94, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3648, 94, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3670, 94, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3686, 94, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3695, 94, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3706, 94, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3716, 94, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3735, 94, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3748, 94, 0, 0, 0x81,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3769, 94, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3784, 94, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3807, 94, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3823, 94, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3850, 94, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3865, 94, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3880, 94, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3899, 94, 0, 0, 0x87,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3916, 94, 0, 0, 0x87,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3931, 94, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3949, 94, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3969, 94, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4000, 94, 0, 0, 0x88,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4023, 94, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4048, 94, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4078, 94, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4110, 94, 0, 0, 0x88,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {4134, 94, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4153, 94, 0, 0, 0x88,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {4170, 94, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4188, 94, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4208, 94, 0, 0, 0x89,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4239, 94, 0, 0, 0x89,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4262, 94, 0, 0, 0x89,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4287, 94, 0, 0, 0x89,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4317, 94, 0, 0, 0x89,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4349, 94, 0, 0, 0x89,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {4373, 94, 0, 0, 0x89,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4392, 94, 0, 0, 0x89,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {4409, 94, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4429, 94, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4450, 94, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4474, 94, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4496, 94, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4521, 94, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4542, 94, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4564, 94, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4586, 94, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4614, 94, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4631, 94, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4640, 94, 0, 0, 0xA8,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {4656, 94, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4667, 94, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4698, 94, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4718, 94, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4738, 94, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4763, 94, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4788, 94, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4813, 94, 0, 0, 0xB1,0x1F,0x61,0x00,EVENT_OPTION_NONE_MASK}
+, {4855, 94, 0, 0, 0xB1,0x1F,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {4896, 94, 0, 0, 0xB1,0x1F,0xC5,0x01,EVENT_OPTION_NONE_MASK}
+, {4936, 94, 0, 0, 0xB1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4956, 94, 0, 0, 0xB1,0x3F,0x61,0x00,EVENT_OPTION_NONE_MASK}
+, {4989, 94, 0, 0, 0xB1,0x3F,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {5021, 94, 0, 0, 0xB1,0x3F,0xC5,0x01,EVENT_OPTION_NONE_MASK}
+, {5052, 94, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5074, 94, 0, 0, 0xB1,0x40,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {5109, 94, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5131, 94, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5156, 94, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5175, 94, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5195, 94, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5215, 94, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5234, 94, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5251, 94, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5268, 94, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5285, 94, 0, 0, 0xC2,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {5311, 94, 0, 0, 0xC2,0x01,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {5338, 94, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5364, 94, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5389, 94, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5411, 94, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5436, 94, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5455, 94, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5488, 94, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5516, 94, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5542, 94, 0, 0, 0xC4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5571, 94, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5600, 94, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5626, 94, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5658, 94, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5690, 94, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5722, 94, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5754, 94, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5787, 94, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5805, 94, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5830, 94, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5854, 94, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5887, 94, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5927, 94, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5952, 94, 0, 0, 0xCB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5977, 94, 0, 0, 0xCB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6004, 94, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6023, 94, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6043, 94, 0, 0, 0xCC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {6063, 94, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6083, 94, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6099, 94, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6124, 94, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6146, 94, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6163, 94, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6184, 94, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6209, 94, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6231, 94, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6246, 94, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6264, 94, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6279, 94, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6292, 94, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6308, 94, 0, 0, 0xE5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6328, 94, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6342, 94, 0, 0, 0xE6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6361, 94, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6378, 94, 0, 0, 0xE8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6394, 94, 0, 0, 0xE8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {6409, 94, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6430, 94, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6450, 94, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6473, 94, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6498, 94, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6521, 94, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6542, 94, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6561, 94, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6581, 94, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6601, 94, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6621, 94, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {6637, 94, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6663, 94, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6689, 94, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6717, 94, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6745, 94, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6762, 94, 0, 0, 0xF3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6781, 94, 0, 0, 0xF3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6802, 94, 0, 0, 0xF3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6830, 94, 0, 0, 0xF3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6858, 94, 0, 0, 0xF3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6885, 94, 0, 0, 0xF3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6911, 94, 0, 0, 0xF4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6929, 94, 0, 0, 0xF4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6955, 94, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6973, 94, 0, 0, 0xF4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6994, 94, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7013, 94, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7034, 94, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7048, 94, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7065, 94, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7081, 94, 0, 0, 0xFD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7104, 94, 0, 0, 0xFD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7129, 94, 0, 0, 0xFD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7146, 94, 0, 0, 0xFD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7165, 94, 0, 0, 0xFD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7192, 94, 0, 0, 0xFD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7217, 94, 0, 0, 0xFD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7242, 94, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7269, 7282, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7290, 7322, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7327, 7322, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7360, 7322, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7398, 7322, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7435, 7322, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7473, 7322, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7516, 7322, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7542, 7322, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7566, 7322, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7593, 7322, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7626, 7322, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7659, 7322, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7686, 7322, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7718, 7322, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7739, 7322, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7760, 7322, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7780, 7322, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7806, 7322, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7832, 7322, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7855, 7322, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7873, 7322, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7894, 7322, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7929, 7322, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7964, 7322, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8003, 7322, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8042, 7322, 0, 0, 0x06,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8078, 7322, 0, 0, 0x06,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8108, 7322, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8144, 7322, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8180, 7322, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8220, 7322, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8260, 7322, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8297, 7322, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8328, 7322, 0, 0, 0x07,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8361, 7322, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8378, 7322, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8396, 7322, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8414, 7322, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8430, 7322, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8447, 7322, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8465, 7322, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8483, 7322, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8499, 7322, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8523, 7322, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8547, 7322, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8571, 7322, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8595, 7322, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {8615, 7322, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8640, 7322, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8665, 7322, 0, 0, 0x0B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8690, 7322, 0, 0, 0x0B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8715, 7322, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8740, 7322, 0, 0, 0x0B,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8761, 7322, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8788, 7322, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8816, 7322, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8846, 7322, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8877, 7322, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8906, 7322, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8936, 7322, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8960, 7322, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8987, 7322, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9013, 7322, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9042, 7322, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9074, 7322, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9105, 7322, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9127, 7322, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9152, 7322, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9176, 7322, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9207, 7322, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9238, 7322, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9266, 7322, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9297, 7322, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9327, 7322, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9349, 7322, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9378, 7322, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9407, 7322, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9436, 7322, 0, 0, 0x27,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9465, 7322, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9495, 7322, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9525, 7322, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9555, 7322, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9582, 7322, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9609, 7322, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9636, 7322, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9664, 7322, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9692, 7322, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9720, 7322, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9742, 7322, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9764, 7322, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9786, 7322, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9809, 7322, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9832, 7322, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9855, 7322, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9877, 7322, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9899, 7322, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9921, 7322, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9949, 7322, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9977, 7322, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10005, 7322, 0, 0, 0x2B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10029, 7322, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10054, 7322, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10079, 7322, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10104, 7322, 0, 0, 0x2C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10129, 7322, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10161, 7322, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10193, 7322, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10225, 7322, 0, 0, 0x2D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10257, 7322, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10293, 7322, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10329, 7322, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10365, 7322, 0, 0, 0x2E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10401, 7322, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10425, 7322, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10449, 7322, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10473, 7322, 0, 0, 0x2F,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10497, 7322, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10524, 7322, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10551, 7322, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10578, 7322, 0, 0, 0x2F,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {10605, 7322, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10624, 7322, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10643, 7322, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10662, 7322, 0, 0, 0x30,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10681, 7322, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10710, 7322, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10739, 7322, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10768, 7322, 0, 0, 0x31,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10797, 7322, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10826, 7322, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {10851, 7322, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {10877, 7322, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10920, 7322, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10964, 7322, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11006, 7322, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11049, 7322, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11093, 7322, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11135, 7322, 0, 0, 0x40,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11173, 7322, 0, 0, 0x40,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {11211, 7322, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11252, 7322, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11293, 7322, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11334, 7322, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11375, 7322, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11416, 7322, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11457, 7322, 0, 0, 0x40,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11494, 7322, 0, 0, 0x40,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {11531, 7322, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11561, 7322, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11591, 7322, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11630, 7322, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11669, 7322, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11687, 7322, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11705, 7322, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11723, 7322, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11747, 7322, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11771, 7322, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11795, 7322, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11818, 7322, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11841, 7322, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11864, 7322, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11886, 7322, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11916, 7322, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11938, 7322, 0, 0, 0x63,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11968, 7322, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11990, 7322, 0, 0, 0x63,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12020, 7322, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12043, 7322, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12074, 7322, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12097, 7322, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12128, 7322, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12151, 7322, 0, 0, 0x64,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12182, 7322, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12203, 7322, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12224, 7322, 0, 0, 0x65,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12245, 7322, 0, 0, 0x66,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12266, 7322, 0, 0, 0x66,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12287, 7322, 0, 0, 0x66,0x04,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable nehalem_arch_events = {
+    NUM_ARCH_EVENTS_NEHALEM,
+    nehalem_arch_event_strings,
+    nehalem_arch_event_options,
+    nehalem_arch_event_entries
+};
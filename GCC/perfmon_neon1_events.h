@@ -0,0 +1,264 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_NEON1 122
+
+static const char neon1_arch_event_strings[] =
+    "SW_INCR\0"
+    "PMC\0"
+    "L1I_CACHE_REFILL\0"
+    "L1I_TLB_REFILL\0"
+    "L1D_CACHE_REFILL\0"
+    "L1D_CACHE\0"
+    "L1D_TLB_REFILL\0"
+    "INST_RETIRED\0"
+    "EXC_TAKEN\0"
+    "EXC_RETURN\0"
+    "CID_WRITE_RETIRED\0"
+    "BR_MIS_PRED\0"
+    "CPU_CYCLES\0"
+    "BR_PRED\0"
+    "MEM_ACCESS\0"
+    "L1I_CACHE\0"
+    "L1D_CACHE_WB\0"
+    "L2D_CACHE\0"
+    "L2D_CACHE_REFILL\0"
+    "L2D_CACHE_WB\0"
+    "BUS_ACCESS\0"
+    "MEMORY_ERROR\0"
+    "INST_SPEC\0"
+    "TTBR_WRITE_RETIRED\0"
+    "BUS_CYCLES\0"
+    "CHAIN\0"
+    "L2D_CACHE_ALLOCATE\0"
+    "BR_RETIRED\0"
+    "BR_MIS_PRED_RETIRED\0"
+    "STALL_FRONTEND\0"
+    "STALL_BACKEND\0"
+    "L1D_TLB\0"
+    "L1I_TLB\0"
+    "L3D_CACHE_ALLOCATE\0"
+    "L3D_CACHE_REFILL\0"
+    "L3D_CACHE\0"
+    "L3D_CACHE_WB\0"
+    "L2D_TLB_REFILL\0"
+    "L2D_TLB\0"
+    "REMOTE_ACCESS\0"
+    "DTLB_WALK\0"
+    "ITLB_WALK\0"
+    "LL_CACHE_RD\0"
+    "LL_CACHE_MISS_RD\0"
+    "L1D_CACHE_LD\0"
+    "L1D_CACHE_RD\0"
+    "L1D_CACHE_ST\0"
+    "L1D_CACHE_WR\0"
+    "L1D_CACHE_REFILL_LD\0"
+    "L1D_CACHE_REFILL_RD\0"
+    "L1D_CACHE_REFILL_ST\0"
+    "L1D_CACHE_REFILL_WR\0"
+    "L1D_CACHE_REFILL_INNER\0"
+    "L1D_CACHE_REFILL_OUTER\0"
+    "L1D_CACHE_WB_VICTIM\0"
+    "L1D_CACHE_WB_CLEAN\0"
+    "L1D_CACHE_INVAL\0"
+    "L1D_TLB_REFILL_LD\0"
+    "L1D_TLB_REFILL_RD\0"
+    "L1D_TLB_REFILL_ST\0"
+    "L1D_TLB_REFILL_WR\0"
+    "L1D_TLB_RD\0"
+    "L1D_TLB_WR\0"
+    "L2D_CACHE_LD\0"
+    "L2D_CACHE_RD\0"
+    "L2D_CACHE_ST\0"
+    "L2D_CACHE_WR\0"
+    "L2D_CACHE_REFILL_LD\0"
+    "L2D_CACHE_REFILL_RD\0"
+    "L2D_CACHE_REFILL_ST\0"
+    "L2D_CACHE_REFILL_WR\0"
+    "L2D_CACHE_WB_VICTIM\0"
+    "L2D_CACHE_WB_CLEAN\0"
+    "L2D_CACHE_INVAL\0"
+    "L2D_TLB_REFILL_RD\0"
+    "L2D_TLB_REFILL_WR\0"
+    "L2D_TLB_RD\0"
+    "L2D_TLB_WR\0"
+    "BUS_ACCESS_LD\0"
+    "BUS_ACCESS_RD\0"
+    "BUS_ACCESS_ST\0"
+    "BUS_ACCESS_WR\0"
+    "MEM_ACCESS_LD\0"
+    "MEM_ACCESS_RD\0"
+    "MEM_ACCESS_ST\0"
+    "MEM_ACCESS_WR\0"
+    "UNALIGNED_LD_SPEC\0"
+    "UNALIGNED_ST_SPEC\0"
+    "UNALIGNED_LDST_SPEC\0"
+    "LDREX_SPEC\0"
+    "STREX_PASS_SPEC\0"
+    "STREX_FAIL_SPEC\0"
+    "STREX_SPEC\0"
+    "LD_SPEC\0"
+    "ST_SPEC\0"
+    "LDST_SPEC\0"
+    "DP_SPEC\0"
+    "ASE_SPEC\0"
+    "VFP_SPEC\0"
+    "PC_WRITE_SPEC\0"
+    "CRYPTO_SPEC\0"
+    "BR_IMMED_SPEC\0"
+    "BR_RETURN_SPEC\0"
+    "BR_INDIRECT_SPEC\0"
+    "ISB_SPEC\0"
+    "DSB_SPEC\0"
+    "DMB_SPEC\0"
+    "EXC_UNDEF\0"
+    "EXC_SVC\0"
+    "EXC_PABORT\0"
+    "EXC_DABORT\0"
+    "EXC_IRQ\0"
+    "EXC_FIQ\0"
+    "EXC_SMC\0"
+    "EXC_HVC\0"
+    "EXC_TRAP_PABORT\0"
+    "EXC_TRAP_DABORT\0"
+    "EXC_TRAP_OTHER\0"
+    "EXC_TRAP_IRQ\0"
+    "EXC_TRAP_FIQ\0"
+    "RC_LD_SPEC\0"
+    "RC_ST_SPEC\0"
+    "L3_CACHE_RD\0";
+
+static const PerfmonEventOption neon1_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry neon1_arch_event_entries[NUM_ARCH_EVENTS_NEON1] = {
+ {0, 8, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12, 8, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 8, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44, 8, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {61, 8, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 8, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {86, 8, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {99, 8, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {109, 8, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 8, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 8, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {150, 8, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {161, 8, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {169, 8, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {180, 8, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {190, 8, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {203, 8, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {213, 8, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {230, 8, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {243, 8, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {254, 8, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {267, 8, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {277, 8, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {296, 8, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {307, 8, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {313, 8, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {332, 8, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {343, 8, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {363, 8, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {378, 8, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {392, 8, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {400, 8, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {408, 8, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {427, 8, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {444, 8, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {454, 8, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {467, 8, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {482, 8, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 8, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {504, 8, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {514, 8, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {524, 8, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {536, 8, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 8, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {566, 8, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {579, 8, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {592, 8, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {605, 8, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {625, 8, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {645, 8, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {665, 8, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {685, 8, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {708, 8, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {731, 8, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {751, 8, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {770, 8, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {786, 8, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {804, 8, 0, 0, 0x4C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {822, 8, 0, 0, 0x4D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {840, 8, 0, 0, 0x4D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {858, 8, 0, 0, 0x4E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {869, 8, 0, 0, 0x4F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {880, 8, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {893, 8, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {906, 8, 0, 0, 0x51,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {919, 8, 0, 0, 0x51,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {932, 8, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {952, 8, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {972, 8, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {992, 8, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1012, 8, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1032, 8, 0, 0, 0x57,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1051, 8, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1067, 8, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1085, 8, 0, 0, 0x5D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1103, 8, 0, 0, 0x5E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1114, 8, 0, 0, 0x5F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1125, 8, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1139, 8, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1153, 8, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1167, 8, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1181, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1195, 8, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1209, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1223, 8, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1237, 8, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1255, 8, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1273, 8, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1293, 8, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1304, 8, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1320, 8, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1336, 8, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1347, 8, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1355, 8, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1363, 8, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1373, 8, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1381, 8, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1390, 8, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1399, 8, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1413, 8, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1425, 8, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1439, 8, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1454, 8, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1471, 8, 0, 0, 0x7C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1480, 8, 0, 0, 0x7D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1489, 8, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1498, 8, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1508, 8, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 8, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1527, 8, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 8, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1546, 8, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1554, 8, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1562, 8, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1570, 8, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1586, 8, 0, 0, 0x8C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1602, 8, 0, 0, 0x8D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1617, 8, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1630, 8, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1643, 8, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1654, 8, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1665, 8, 0, 0, 0xA0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable neon1_arch_events = {
+    NUM_ARCH_EVENTS_NEON1,
+    neon1_arch_event_strings,
+    neon1_arch_event_options,
+    neon1_arch_event_entries
+};
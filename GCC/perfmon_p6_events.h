@@ -0,0 +1,256 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_P6 118
+
+static const char p6_arch_event_strings[] =
+    "DATA_MEM_REFS\0"
+    "PMC\0"
+    "DCU_LINES_IN\0"
+    "DCU_M_LINES_IN\0"
+    "DCU_M_LINES_OUT\0"
+    "DCU_MISS_OUTSTANDING\0"
+    "IFU_IFETCH\0"
+    "IFU_IFETCH_MISS\0"
+    "ITLB_MISS\0"
+    "IFU_MEM_STALL\0"
+    "ILD_STALL\0"
+    "L2_IFETCH\0"
+    "L2_LD\0"
+    "L2_ST\0"
+    "L2_LINES_IN\0"
+    "L2_LINES_OUT\0"
+    "L2_LINES_INM\0"
+    "L2_LINES_OUTM\0"
+    "L2_RQSTS\0"
+    "L2_ADS\0"
+    "L2_DBUS_BUSY\0"
+    "L2_DBUS_BUSY_RD\0"
+    "BUS_DRDY_CLOCKS_SELF\0"
+    "BUS_DRDY_CLOCKS_ANY\0"
+    "BUS_LOCK_CLOCKS_SELF\0"
+    "BUS_LOCK_CLOCKS_ANY\0"
+    "BUS_REQ_OUTSTANDING_SELF\0"
+    "BUS_TRAN_BRD_SELF\0"
+    "BUS_TRAN_BRD_ANY\0"
+    "BUS_TRAN_RFO_SELF\0"
+    "BUS_TRAN_RFO_ANY\0"
+    "BUS_TRAN_WB_SELF\0"
+    "BUS_TRAN_WB_ANY\0"
+    "BUS_TRAN_IFETCH_SELF\0"
+    "BUS_TRAN_IFETCH_ANY\0"
+    "BUS_TRAN_INVAL_SELF\0"
+    "BUS_TRAN_INVAL_ANY\0"
+    "BUS_TRAN_PWR_SELF\0"
+    "BUS_TRAN_PWR_ANY\0"
+    "BUS_TRANS_P_SELF\0"
+    "BUS_TRANS_P_ANY\0"
+    "BUS_TRANS_IO_SELF\0"
+    "BUS_TRANS_IO_ANY\0"
+    "BUS_TRAN_DEF_SELF\0"
+    "BUS_TRAN_DEF_ANY\0"
+    "BUS_TRAN_BURST_SELF\0"
+    "BUS_TRAN_BURST_ANY\0"
+    "BUS_TRAN_ANY_SELF\0"
+    "BUS_TRAN_ANY_ANY\0"
+    "BUS_TRAN_MEM_SELF\0"
+    "BUS_TRAN_MEM_ANY\0"
+    "BUS_DATA_RCV_SELF\0"
+    "BUS_BNR_DRV_SELF\0"
+    "BUS_HIT_DRV_SELF\0"
+    "BUS_HITM_DRV_SELF\0"
+    "BUS_SNOOP_STALL_SELF\0"
+    "FLOPS\0"
+    "FP_COMP_OPS_EXE\0"
+    "FP_ASSIST\0"
+    "MUL\0"
+    "DIV\0"
+    "CYCLES_DIV_BUSY\0"
+    "LD_BLOCKS\0"
+    "SB_DRAINS\0"
+    "MISALIGN_MEM_REF\0"
+    "EMON_KNI_PREF_DISPATCHED_NTA\0"
+    "EMON_KNI_PREF_DISPATCHED_T1\0"
+    "EMON_KNI_PREF_DISPATCHED_T2\0"
+    "EMON_KNI_PREF_DISPATCHED_WEAK\0"
+    "EMON_KNI_PREF_MISS_NTA\0"
+    "EMON_KNI_PREF_MISS_T1\0"
+    "EMON_KNI_PREF_MISS_T2\0"
+    "EMON_KNI_PREF_MISS_WEAK\0"
+    "INST_RETIRED\0"
+    "UOPS_RETIRED\0"
+    "INST_DECODED\0"
+    "EMON_KNI_INST_RETIRED_ALL\0"
+    "EMON_KNI_INST_RETIRED_SCALAR\0"
+    "EMON_KNI_COMP_INST_RETIRED_ALL\0"
+    "EMON_KNI_COMP_INST_RETIRED_SCALAR\0"
+    "HW_INT_RX\0"
+    "CYCLES_INT_MASKED\0"
+    "CYCLES_INT_PENDING_AND_MASKED\0"
+    "BR_INST_RETIRED\0"
+    "BR_MISS_PRED_RETIRED\0"
+    "BR_TAKEN_RETIRED\0"
+    "BR_MISS_PRED_TAKEN_RET\0"
+    "BR_INST_DECODED\0"
+    "BTB_MISSES\0"
+    "BR_BOGUS\0"
+    "BACLEARS\0"
+    "RESOURCE_STALLS\0"
+    "PARTIAL_RAT_STALL\0"
+    "SEGMENT_REG_LOADS\0"
+    "CPU_CLK_UNHALTED\0"
+    "MMX_INSTR_EXEC\0"
+    "MMX_SAT_INSTR_EXEC\0"
+    "MMX_UOPS_EXEC\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_MUL\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_SHIFT\0"
+    "MMX_INSTR_TYPE_EXEC_PACK\0"
+    "MMX_INSTR_TYPE_EXEC_UNPACK\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_LOGICAL\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_ARITHMETIC\0"
+    "FP_MMX_TRANS_MMX_FP\0"
+    "FP_MMX_TRANS_FP_MMX\0"
+    "MMX_ASSIST\0"
+    "MMX_INSTR_RET\0"
+    "SEG_RENAME_STALLS_ES\0"
+    "SEG_RENAME_STALLS_DS\0"
+    "SEG_RENAME_STALLS_FS\0"
+    "SEG_RENAME_STALLS_GS\0"
+    "SEG_RENAME_STALLS_ALL\0"
+    "SEG_REG_RENAMES_ES\0"
+    "SEG_REG_RENAMES_DS\0"
+    "SEG_REG_RENAMES_FS\0"
+    "SEG_REG_RENAMES_GS\0"
+    "SEG_REG_RENAMES_ALL\0"
+    "RET_SEG_RENAMES\0";
+
+static const PerfmonEventOption p6_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry p6_arch_event_entries[NUM_ARCH_EVENTS_P6] = {
+ {0, 14, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18, 14, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31, 14, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {46, 14, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {62, 14, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {83, 14, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {94, 14, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {110, 14, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 14, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {134, 14, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {144, 14, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {154, 14, 0, 0, 0x29,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {160, 14, 0, 0, 0x2A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 14, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {178, 14, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 14, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {204, 14, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 14, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {227, 14, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {234, 14, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {247, 14, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {263, 14, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {284, 14, 0, 0, 0x62,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {304, 14, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {325, 14, 0, 0, 0x63,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {345, 14, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {370, 14, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {388, 14, 0, 0, 0x65,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {405, 14, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {423, 14, 0, 0, 0x66,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {440, 14, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {457, 14, 0, 0, 0x67,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {473, 14, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {494, 14, 0, 0, 0x68,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {514, 14, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {534, 14, 0, 0, 0x69,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 14, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {571, 14, 0, 0, 0x6A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {588, 14, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {605, 14, 0, 0, 0x6B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {621, 14, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {639, 14, 0, 0, 0x6C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {656, 14, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {674, 14, 0, 0, 0x6D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {691, 14, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {711, 14, 0, 0, 0x6E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {730, 14, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {748, 14, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {765, 14, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {783, 14, 0, 0, 0x6F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {800, 14, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {818, 14, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {835, 14, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {852, 14, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {870, 14, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {891, 14, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {897, 14, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {913, 14, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {923, 14, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {927, 14, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {931, 14, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {947, 14, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {957, 14, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {967, 14, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {984, 14, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1013, 14, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1041, 14, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1069, 14, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1099, 14, 0, 0, 0x4B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1122, 14, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1144, 14, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1166, 14, 0, 0, 0x4B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1190, 14, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1203, 14, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1216, 14, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1229, 14, 0, 0, 0xD8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1255, 14, 0, 0, 0xD8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1284, 14, 0, 0, 0xD9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1315, 14, 0, 0, 0xD9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1349, 14, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1359, 14, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1377, 14, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1407, 14, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1423, 14, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1444, 14, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1461, 14, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1484, 14, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1500, 14, 0, 0, 0xE2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1511, 14, 0, 0, 0xE4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1520, 14, 0, 0, 0xE6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1529, 14, 0, 0, 0xA2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1545, 14, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1563, 14, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1581, 14, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1598, 14, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1613, 14, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1632, 14, 0, 0, 0xB2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1646, 14, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1677, 14, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1710, 14, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1735, 14, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1762, 14, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1797, 14, 0, 0, 0xB3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1835, 14, 0, 0, 0xCC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1855, 14, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1875, 14, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1886, 14, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1900, 14, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1921, 14, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1942, 14, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1963, 14, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1984, 14, 0, 0, 0xD4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2006, 14, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2025, 14, 0, 0, 0xD5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2044, 14, 0, 0, 0xD5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2063, 14, 0, 0, 0xD5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2082, 14, 0, 0, 0xD5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2102, 14, 0, 0, 0xD6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable p6_arch_events = {
+    NUM_ARCH_EVENTS_P6,
+    p6_arch_event_strings,
+    p6_arch_event_options,
+    p6_arch_event_entries
+};
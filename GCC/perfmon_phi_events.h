@@ -0,0 +1,142 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_PHI 61
+
+static const char phi_arch_event_strings[] =
+    "DATA_READ\0"
+    "PMC\0"
+    "DATA_WRITE\0"
+    "DATA_PAGE_WALK\0"
+    "DATA_READ_MISS\0"
+    "DATA_WRITE_MISS\0"
+    "DATA_CACHE_LINES_WRITTEN_BACK\0"
+    "MEMORY_ACCESS_BOTH_PIPES\0"
+    "BANK_CONFLICTS\0"
+    "CODE_READ\0"
+    "CODE_PAGE_WALK\0"
+    "CODE_CACHE_MISS\0"
+    "L1_DATA_PF1\0"
+    "BRANCHES\0"
+    "PIPELINE_FLUSHES\0"
+    "INSTRUCTIONS_EXECUTED\0"
+    "INSTRUCTIONS_EXECUTED_V_PIPE\0"
+    "L1_DATA_PF1_MISS\0"
+    "L1_DATA_PF1_DROP\0"
+    "PIPELINE_AGI_STALLS\0"
+    "L1_DATA_HIT_INFLIGHT_PF1\0"
+    "PIPELINE_SG_AGI_STALLS\0"
+    "DATA_READ_OR_WRITE\0"
+    "DATA_READ_MISS_OR_WRITE_MISS\0"
+    "CPU_CLK_UNHALTED\0"
+    "BRANCHES_MISPREDICTED\0"
+    "MICROCODE_CYCLES\0"
+    "FE_STALLED\0"
+    "EXEC_STAGE_CYCLES\0"
+    "L1_DATA_PF2\0"
+    "L2_DATA_PF1_MISS\0"
+    "LONG_DATA_PAGE_WALK\0"
+    "LONG_CODE_PAGE_WALK\0"
+    "HWP_L2HIT\0"
+    "HWP_L2MISS\0"
+    "L2_READ_HIT_E\0"
+    "L2_READ_HIT_M\0"
+    "L2_READ_HIT_S\0"
+    "L2_READ_MISS\0"
+    "L2_WRITE_HIT\0"
+    "L2_VICTIM_REQ_WITH_DATA\0"
+    "SNP_HITM_BUNIT\0"
+    "SNP_HIT_L2\0"
+    "SNP_HITM_L2\0"
+    "L2_CODE_READ_MISS_CACHE_FILL\0"
+    "L2_DATA_READ_MISS_CACHE_FILL\0"
+    "L2_DATA_WRITE_MISS_CACHE_FILL\0"
+    "L2_CODE_READ_MISS_MEM_FILL\0"
+    "L2_DATA_READ_MISS_MEM_FILL\0"
+    "L2_DATA_WRITE_MISS_MEM_FILL\0"
+    "L2_DATA_PF2\0"
+    "L2_DATA_PF2_DROP\0"
+    "L2_DATA_PF2_MISS\0"
+    "L2_DATA_HIT_INFLIGHT_PF2\0"
+    "VPU_DATA_READ\0"
+    "VPU_DATA_WRITE\0"
+    "VPU_DATA_READ_MISS\0"
+    "VPU_DATA_WRITE_MISS\0"
+    "VPU_STALL_REG\0"
+    "VPU_INSTRUCTIONS_EXECUTED\0"
+    "VPU_INSTRUCTIONS_EXECUTED_V_PIPE\0"
+    "VPU_ELEMENTS_ACTIVE\0";
+
+static const PerfmonEventOption phi_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry phi_arch_event_entries[NUM_ARCH_EVENTS_PHI] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14, 10, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {25, 10, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40, 10, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 10, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {71, 10, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {101, 10, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {126, 10, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {141, 10, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {151, 10, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 10, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {182, 10, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {194, 10, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {203, 10, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {220, 10, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {242, 10, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {271, 10, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {288, 10, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {305, 10, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {325, 10, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {350, 10, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {373, 10, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {392, 10, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {421, 10, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {438, 10, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {460, 10, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {477, 10, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {488, 10, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {506, 10, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {518, 10, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {535, 10, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {555, 10, 0, 0, 0x3B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {575, 10, 0, 0, 0xC3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {585, 10, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {596, 10, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {610, 10, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {624, 10, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {638, 10, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {651, 10, 0, 0, 0xCC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {664, 10, 0, 0, 0xD7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {688, 10, 0, 0, 0xE3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {703, 10, 0, 0, 0xE6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {714, 10, 0, 0, 0xE7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {726, 10, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {755, 10, 0, 0, 0xF1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {784, 10, 0, 0, 0xF2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {814, 10, 0, 0, 0xF5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {841, 10, 0, 0, 0xF6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {868, 10, 0, 0, 0xF7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {896, 10, 0, 0, 0xFC,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {908, 10, 0, 0, 0xFD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {925, 10, 0, 0, 0xFE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {942, 10, 0, 0, 0xFF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {967, 10, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {981, 10, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {996, 10, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1015, 10, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1035, 10, 0, 0, 0x05,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1049, 10, 0, 0, 0x16,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1075, 10, 0, 0, 0x17,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1108, 10, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable phi_arch_events = {
+    NUM_ARCH_EVENTS_PHI,
+    phi_arch_event_strings,
+    phi_arch_event_options,
+    phi_arch_event_entries
+};
@@ -0,0 +1,421 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_PM 199
+
+static const char pm_arch_event_strings[] =
+    "DATA_MEM_REFS\0"
+    "PMC\0"
+    "DCU_LINES_IN\0"
+    "DCU_M_LINES_IN\0"
+    "DCU_M_LINES_OUT\0"
+    "DCU_MISS_OUTSTANDING\0"
+    "EMON_EST_TRANS\0"
+    "BR_INST_EXEC\0"
+    "BR_MISSP_EXEC\0"
+    "BR_BAC_MISSP_EXEC\0"
+    "BR_CND_EXEC\0"
+    "BR_CND_MISSP_EXEC\0"
+    "BR_IND_EXEC\0"
+    "BR_IND_MISSP_EXEC\0"
+    "BR_RET_EXEC\0"
+    "BR_RET_MISSP_EXEC\0"
+    "BR_RET_BAC_MISSP_EXEC\0"
+    "BR_CALL_EXEC\0"
+    "BR_CALL_MISSP_EXEC\0"
+    "BR_IND_CALL_EXEC\0"
+    "IFU_IFETCH\0"
+    "IFU_IFETCH_MISS\0"
+    "ITLB_MISS\0"
+    "IFU_MEM_STALL\0"
+    "ILD_STALL\0"
+    "L2_IFETCH\0"
+    "L2_LD_I_EXCLUDE_PRE\0"
+    "L2_LD_S_EXCLUDE_PRE\0"
+    "L2_LD_E_EXCLUDE_PRE\0"
+    "L2_LD_M_EXCLUDE_PRE\0"
+    "L2_LD_ALL_EXCLUDE_PRE\0"
+    "L2_LD_I_PRE_ONLY\0"
+    "L2_LD_S_PRE_ONLY\0"
+    "L2_LD_E_PRE_ONLY\0"
+    "L2_LD_M_PRE_ONLY\0"
+    "L2_LD_ALL_PRE_ONLY\0"
+    "L2_LD_I_ALL\0"
+    "L2_LD_S_ALL\0"
+    "L2_LD_E_ALL\0"
+    "L2_LD_M_ALL\0"
+    "L2_LD_ALL_ALL\0"
+    "L2_ST\0"
+    "L2_LINES_IN_I_EXCLUDE_PRE\0"
+    "L2_LINES_IN_S_EXCLUDE_PRE\0"
+    "L2_LINES_IN_E_EXCLUDE_PRE\0"
+    "L2_LINES_IN_M_EXCLUDE_PRE\0"
+    "L2_LINES_IN_ALL_EXCLUDE_PRE\0"
+    "L2_LINES_IN_I_PRE_ONLY\0"
+    "L2_LINES_IN_S_PRE_ONLY\0"
+    "L2_LINES_IN_E_PRE_ONLY\0"
+    "L2_LINES_IN_M_PRE_ONLY\0"
+    "L2_LINES_IN_ALL_PRE_ONLY\0"
+    "L2_LINES_IN_I_ALL\0"
+    "L2_LINES_IN_S_ALL\0"
+    "L2_LINES_IN_E_ALL\0"
+    "L2_LINES_IN_M_ALL\0"
+    "L2_LINES_IN_ALL_ALL\0"
+    "L2_LINES_OUT_I_EXCLUDE_PRE\0"
+    "L2_LINES_OUT_S_EXCLUDE_PRE\0"
+    "L2_LINES_OUT_E_EXCLUDE_PRE\0"
+    "L2_LINES_OUT_M_EXCLUDE_PRE\0"
+    "L2_LINES_OUT_ALL_EXCLUDE_PRE\0"
+    "L2_LINES_OUT_I_PRE_ONLY\0"
+    "L2_LINES_OUT_S_PRE_ONLY\0"
+    "L2_LINES_OUT_E_PRE_ONLY\0"
+    "L2_LINES_OUT_M_PRE_ONLY\0"
+    "L2_LINES_OUT_ALL_PRE_ONLY\0"
+    "L2_LINES_OUT_I_ALL\0"
+    "L2_LINES_OUT_S_ALL\0"
+    "L2_LINES_OUT_E_ALL\0"
+    "L2_LINES_OUT_M_ALL\0"
+    "L2_LINES_OUT_ALL_ALL\0"
+    "L2_M_LINES_IN\0"
+    "L2_M_LINES_OUT_I_EXCLUDE_PRE\0"
+    "L2_M_LINES_OUT_S_EXCLUDE_PRE\0"
+    "L2_M_LINES_OUT_E_EXCLUDE_PRE\0"
+    "L2_M_LINES_OUT_M_EXCLUDE_PRE\0"
+    "L2_M_LINES_OUT_ALL_EXCLUDE_PRE\0"
+    "L2_M_LINES_OUT_I_PRE_ONLY\0"
+    "L2_M_LINES_OUT_S_PRE_ONLY\0"
+    "L2_M_LINES_OUT_E_PRE_ONLY\0"
+    "L2_M_LINES_OUT_M_PRE_ONLY\0"
+    "L2_M_LINES_OUT_ALL_PRE_ONLY\0"
+    "L2_M_LINES_OUT_I_ALL\0"
+    "L2_M_LINES_OUT_S_ALL\0"
+    "L2_M_LINES_OUT_E_ALL\0"
+    "L2_M_LINES_OUT_M_ALL\0"
+    "L2_M_LINES_OUT_ALL_ALL\0"
+    "L2_RQSTS\0"
+    "L2_ADS\0"
+    "L2_DBUS_BUSY\0"
+    "L2_DBUS_BUSY_RD\0"
+    "BUS_DRDY_CLOCKS_SELF\0"
+    "BUS_DRDY_CLOCKS_ANY\0"
+    "BUS_LOCK_CLOCKS_SELF\0"
+    "BUS_LOCK_CLOCKS_ANY\0"
+    "BUS_REQ_OUTSTANDING_SELF\0"
+    "BUS_TRAN_BRD_SELF\0"
+    "BUS_TRAN_BRD_ANY\0"
+    "BUS_TRAN_RFO_SELF\0"
+    "BUS_TRAN_RFO_ANY\0"
+    "BUS_TRAN_WB_SELF\0"
+    "BUS_TRAN_WB_ANY\0"
+    "BUS_TRAN_IFETCH_SELF\0"
+    "BUS_TRAN_IFETCH_ANY\0"
+    "BUS_TRAN_INVAL_SELF\0"
+    "BUS_TRAN_INVAL_ANY\0"
+    "BUS_TRAN_PWR_SELF\0"
+    "BUS_TRAN_PWR_ANY\0"
+    "BUS_TRANS_P_SELF\0"
+    "BUS_TRANS_P_ANY\0"
+    "BUS_TRANS_IO_SELF\0"
+    "BUS_TRANS_IO_ANY\0"
+    "BUS_TRAN_DEF_SELF\0"
+    "BUS_TRAN_DEF_ANY\0"
+    "BUS_TRAN_BURST_SELF\0"
+    "BUS_TRAN_BURST_ANY\0"
+    "BUS_TRAN_ANY_SELF\0"
+    "BUS_TRAN_ANY_ANY\0"
+    "BUS_TRAN_MEM_SELF\0"
+    "BUS_TRAN_MEM_ANY\0"
+    "BUS_DATA_RCV_SELF\0"
+    "BUS_BNR_DRV_SELF\0"
+    "BUS_HIT_DRV_SELF\0"
+    "BUS_HITM_DRV_SELF\0"
+    "BUS_SNOOP_STALL_SELF\0"
+    "FLOPS\0"
+    "PMC0\0"
+    "FP_COMP_OPS_EXE\0"
+    "FP_ASSIST\0"
+    "PMC1\0"
+    "MUL\0"
+    "DIV\0"
+    "CYCLES_DIV_BUSY\0"
+    "LD_BLOCKS\0"
+    "SB_DRAINS\0"
+    "MISALIGN_MEM_REF\0"
+    "EMON_KNI_PREF_DISPATCHED_NTA\0"
+    "PMC0|PMC1\0"
+    "EMON_KNI_PREF_DISPATCHED_T1\0"
+    "EMON_KNI_PREF_DISPATCHED_T2\0"
+    "EMON_KNI_PREF_DISPATCHED_WEAK\0"
+    "EMON_KNI_PREF_MISS_NTA\0"
+    "EMON_KNI_PREF_MISS_T1\0"
+    "EMON_KNI_PREF_MISS_T2\0"
+    "EMON_KNI_PREF_MISS_WEAK\0"
+    "INST_RETIRED\0"
+    "UOPS_RETIRED\0"
+    "INST_DECODED\0"
+    "EMON_SSE_SSE2_INST_RETIRED_ALL_SP\0"
+    "EMON_SSE_SSE2_INST_RETIRED_SCALAR_SP\0"
+    "EMON_SSE_SSE2_INST_RETIRED_PACKED_DP\0"
+    "EMON_SSE_SSE2_INST_RETIRED_SCALAR_DP\0"
+    "EMON_SSE_SSE2_COMP_INST_RETIRED_ALL_SP\0"
+    "EMON_SSE_SSE2_COMP_INST_RETIRED_SCALAR_SP\0"
+    "EMON_SSE_SSE2_COMP_INST_RETIRED_PACKED_DP\0"
+    "EMON_SSE_SSE2_COMP_INST_RETIRED_SCALAR_DP\0"
+    "HW_INT_RX\0"
+    "CYCLES_INT_MASKED\0"
+    "CYCLES_INT_PENDING_AND_MASKED\0"
+    "BR_INST_RETIRED\0"
+    "BR_MISS_PRED_RETIRED\0"
+    "BR_TAKEN_RETIRED\0"
+    "BR_MISS_PRED_TAKEN_RET\0"
+    "EMON_SIMD_INSTR_RETIRED\0"
+    "EMON_SYNCH_UOPS\0"
+    "EMON_ESP_UOPS\0"
+    "EMON_FUSED_UOPS_RET\0"
+    "EMON_UNFUSION\0"
+    "EMON_PREF_RQSTS_UP\0"
+    "EMON_PREF_RQSTS_DN\0"
+    "BR_INST_DECODED\0"
+    "BTB_MISSES\0"
+    "BR_BOGUS\0"
+    "BACLEARS\0"
+    "RESOURCE_STALLS\0"
+    "PARTIAL_RAT_STALL\0"
+    "SEGMENT_REG_LOADS\0"
+    "CPU_CLK_UNHALTED\0"
+    "MMX_INSTR_EXEC\0"
+    "MMX_SAT_INSTR_EXEC\0"
+    "MMX_UOPS_EXEC\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_MUL\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_SHIFT\0"
+    "MMX_INSTR_TYPE_EXEC_PACK\0"
+    "MMX_INSTR_TYPE_EXEC_UNPACK\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_LOGICAL\0"
+    "MMX_INSTR_TYPE_EXEC_PACKED_ARITHMETIC\0"
+    "FP_MMX_TRANS_MMX_FP\0"
+    "FP_MMX_TRANS_FP_MMX\0"
+    "MMX_ASSIST\0"
+    "MMX_INSTR_RET\0"
+    "SEG_RENAME_STALLS_ES\0"
+    "SEG_RENAME_STALLS_DS\0"
+    "SEG_RENAME_STALLS_FS\0"
+    "SEG_RENAME_STALLS_GS\0"
+    "SEG_RENAME_STALLS_ALL\0"
+    "SEG_REG_RENAMES_ES\0"
+    "SEG_REG_RENAMES_DS\0"
+    "SEG_REG_RENAMES_FS\0"
+    "SEG_REG_RENAMES_GS\0"
+    "SEG_REG_RENAMES_ALL\0"
+    "RET_SEG_RENAMES\0";
+
+static const PerfmonEventOption pm_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry pm_arch_event_entries[NUM_ARCH_EVENTS_PM] = {
+ {0, 14, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18, 14, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31, 14, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {46, 14, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {62, 14, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {83, 14, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {98, 14, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {111, 14, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {125, 14, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {143, 14, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {155, 14, 0, 0, 0x8C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {173, 14, 0, 0, 0x8D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {185, 14, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {203, 14, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {215, 14, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {233, 14, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {255, 14, 0, 0, 0x92,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {268, 14, 0, 0, 0x93,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {287, 14, 0, 0, 0x94,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {304, 14, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {315, 14, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {331, 14, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {341, 14, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {355, 14, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {365, 14, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {375, 14, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {395, 14, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {415, 14, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {435, 14, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {455, 14, 0, 0, 0x29,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {477, 14, 0, 0, 0x29,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {494, 14, 0, 0, 0x29,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {511, 14, 0, 0, 0x29,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {528, 14, 0, 0, 0x29,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {545, 14, 0, 0, 0x29,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {564, 14, 0, 0, 0x29,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {576, 14, 0, 0, 0x29,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {588, 14, 0, 0, 0x29,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {600, 14, 0, 0, 0x29,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {612, 14, 0, 0, 0x29,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {626, 14, 0, 0, 0x2A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {632, 14, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {658, 14, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {684, 14, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {710, 14, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {736, 14, 0, 0, 0x24,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {764, 14, 0, 0, 0x24,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {787, 14, 0, 0, 0x24,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {810, 14, 0, 0, 0x24,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {833, 14, 0, 0, 0x24,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {856, 14, 0, 0, 0x24,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {881, 14, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {899, 14, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {917, 14, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {935, 14, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {953, 14, 0, 0, 0x24,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {973, 14, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1000, 14, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1027, 14, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1054, 14, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1081, 14, 0, 0, 0x26,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1110, 14, 0, 0, 0x26,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {1134, 14, 0, 0, 0x26,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {1158, 14, 0, 0, 0x26,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {1182, 14, 0, 0, 0x26,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {1206, 14, 0, 0, 0x26,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1232, 14, 0, 0, 0x26,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1251, 14, 0, 0, 0x26,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1270, 14, 0, 0, 0x26,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1289, 14, 0, 0, 0x26,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1308, 14, 0, 0, 0x26,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1329, 14, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1343, 14, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1372, 14, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1401, 14, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1430, 14, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1459, 14, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1490, 14, 0, 0, 0x27,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 14, 0, 0, 0x27,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {1542, 14, 0, 0, 0x27,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {1568, 14, 0, 0, 0x27,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {1594, 14, 0, 0, 0x27,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1622, 14, 0, 0, 0x27,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1643, 14, 0, 0, 0x27,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1664, 14, 0, 0, 0x27,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1685, 14, 0, 0, 0x27,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1706, 14, 0, 0, 0x27,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {1729, 14, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1738, 14, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1745, 14, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1758, 14, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1774, 14, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1795, 14, 0, 0, 0x62,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1815, 14, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1836, 14, 0, 0, 0x63,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1856, 14, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1881, 14, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1899, 14, 0, 0, 0x65,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1916, 14, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1934, 14, 0, 0, 0x66,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1951, 14, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1968, 14, 0, 0, 0x67,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1984, 14, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2005, 14, 0, 0, 0x68,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2025, 14, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2045, 14, 0, 0, 0x69,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2064, 14, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2082, 14, 0, 0, 0x6A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2099, 14, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2116, 14, 0, 0, 0x6B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2132, 14, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2150, 14, 0, 0, 0x6C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2167, 14, 0, 0, 0x6D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2185, 14, 0, 0, 0x6D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2202, 14, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2222, 14, 0, 0, 0x6E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2241, 14, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2259, 14, 0, 0, 0x70,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2276, 14, 0, 0, 0x6F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2294, 14, 0, 0, 0x6F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2311, 14, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2329, 14, 0, 0, 0x61,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2346, 14, 0, 0, 0x7A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2363, 14, 0, 0, 0x7B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2381, 14, 0, 0, 0x7E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2402, 2408, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2413, 2408, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2429, 2439, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2444, 2439, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2448, 2439, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2452, 2408, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2468, 14, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2478, 14, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2488, 14, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2505, 2534, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2544, 2534, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2572, 2534, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2600, 2534, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2630, 2534, 0, 0, 0x4B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2653, 2534, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2675, 2534, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2697, 2534, 0, 0, 0x4B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2721, 14, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2734, 14, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2747, 14, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2760, 2534, 0, 0, 0xD8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2794, 2534, 0, 0, 0xD8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2831, 2534, 0, 0, 0xD8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2868, 2534, 0, 0, 0xD8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2905, 2534, 0, 0, 0xD9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2944, 2534, 0, 0, 0xD9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2986, 2534, 0, 0, 0xD9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3028, 2534, 0, 0, 0xD9,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3070, 14, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3080, 14, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3098, 14, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3128, 14, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3144, 14, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3165, 14, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3182, 14, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3205, 14, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3229, 14, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3245, 14, 0, 0, 0xD7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3259, 14, 0, 0, 0xDA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3279, 14, 0, 0, 0xDB,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3293, 14, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3312, 14, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3331, 14, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3347, 14, 0, 0, 0xE2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3358, 14, 0, 0, 0xE4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3367, 14, 0, 0, 0xE6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3376, 14, 0, 0, 0xA2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3392, 14, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3410, 14, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3428, 14, 0, 0, 0x79,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3445, 14, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3460, 14, 0, 0, 0xB1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3479, 14, 0, 0, 0xB2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3493, 14, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3524, 14, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3557, 14, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3582, 14, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3609, 14, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3644, 14, 0, 0, 0xB3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3682, 14, 0, 0, 0xCC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3702, 14, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3722, 14, 0, 0, 0xCD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3733, 14, 0, 0, 0xCE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3747, 14, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3768, 14, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3789, 14, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3810, 14, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3831, 14, 0, 0, 0xD4,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3853, 14, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3872, 14, 0, 0, 0xD5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3891, 14, 0, 0, 0xD5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3910, 14, 0, 0, 0xD5,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3929, 14, 0, 0, 0xD5,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3949, 14, 0, 0, 0xD6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable pm_arch_events = {
+    NUM_ARCH_EVENTS_PM,
+    pm_arch_event_strings,
+    pm_arch_event_options,
+    pm_arch_event_entries
+};
@@ -0,0 +1,2022 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_POWER8 996
+
+static const char power8_arch_event_strings[] =
+    "PM_1LPAR_CYC\0"
+    "PMC0\0"
+    "PM_1PLUS_PPC_CMPL\0"
+    "PM_1PLUS_PPC_DISP\0"
+    "PMC3\0"
+    "PM_2LPAR_CYC\0"
+    "PMC1\0"
+    "PM_4LPAR_CYC\0"
+    "PM_ALL_CHIP_PUMP_CPRED\0"
+    "PM_ALL_GRP_PUMP_CPRED\0"
+    "PM_ALL_GRP_PUMP_MPRED\0"
+    "PM_ALL_GRP_PUMP_MPRED_RTY\0"
+    "PM_ALL_PUMP_CPRED\0"
+    "PM_ALL_PUMP_MPRED\0"
+    "PM_ALL_SYS_PUMP_CPRED\0"
+    "PMC2\0"
+    "PM_ALL_SYS_PUMP_MPRED\0"
+    "PM_ALL_SYS_PUMP_MPRED_RTY\0"
+    "PM_ANY_THRD_RUN_CYC\0"
+    "PM_BACK_BR_CMPL\0"
+    "PM_BANK_CONFLICT\0"
+    "PMC\0"
+    "PM_BRU_FIN\0"
+    "PM_BR_2PATH\0"
+    "PMC1|PMC3\0"
+    "PM_BR_BC_8\0"
+    "PM_BR_BC_8_CONV\0"
+    "PM_BR_CMPL\0"
+    "PM_BR_MPRED_CCACHE\0"
+    "PM_BR_MPRED_CMPL\0"
+    "PM_BR_MPRED_CR\0"
+    "PM_BR_MPRED_LSTACK\0"
+    "PM_BR_MPRED_TA\0"
+    "PM_BR_MRK_2PATH\0"
+    "PM_BR_PRED_BR0\0"
+    "PM_BR_PRED_BR1\0"
+    "PM_BR_PRED_BR_CMPL\0"
+    "PM_BR_PRED_CCACHE_BR0\0"
+    "PM_BR_PRED_CCACHE_BR1\0"
+    "PM_BR_PRED_CCACHE_CMPL\0"
+    "PM_BR_PRED_CR_BR0\0"
+    "PM_BR_PRED_CR_BR1\0"
+    "PM_BR_PRED_CR_CMPL\0"
+    "PM_BR_PRED_LSTACK_BR0\0"
+    "PM_BR_PRED_LSTACK_BR1\0"
+    "PM_BR_PRED_LSTACK_CMPL\0"
+    "PM_BR_PRED_TA_BR0\0"
+    "PM_BR_PRED_TA_BR1\0"
+    "PM_BR_PRED_TA_CMPL\0"
+    "PM_BR_TAKEN_CMPL\0"
+    "PM_BR_UNCOND_BR0\0"
+    "PM_BR_UNCOND_BR1\0"
+    "PM_BR_UNCOND_CMPL\0"
+    "PM_CASTOUT_ISSUED\0"
+    "PM_CASTOUT_ISSUED_GPR\0"
+    "PM_CHIP_PUMP_CPRED\0"
+    "PM_CLB_HELD\0"
+    "PM_CMPLU_STALL\0"
+    "PM_CMPLU_STALL_ALT\0"
+    "PM_CMPLU_STALL_BRU\0"
+    "PM_CMPLU_STALL_BRU_CRU\0"
+    "PM_CMPLU_STALL_COQ_FULL\0"
+    "PM_CMPLU_STALL_DCACHE_MISS\0"
+    "PM_CMPLU_STALL_DMISS_L21_L31\0"
+    "PM_CMPLU_STALL_DMISS_L2L3\0"
+    "PM_CMPLU_STALL_DMISS_L2L3_CONFLICT\0"
+    "PM_CMPLU_STALL_DMISS_L3MISS\0"
+    "PM_CMPLU_STALL_DMISS_LMEM\0"
+    "PM_CMPLU_STALL_DMISS_REMOTE\0"
+    "PM_CMPLU_STALL_ERAT_MISS\0"
+    "PM_CMPLU_STALL_FLUSH\0"
+    "PM_CMPLU_STALL_FXLONG\0"
+    "PM_CMPLU_STALL_FXU\0"
+    "PM_CMPLU_STALL_HWSYNC\0"
+    "PM_CMPLU_STALL_LOAD_FINISH\0"
+    "PM_CMPLU_STALL_LSU\0"
+    "PM_CMPLU_STALL_LWSYNC\0"
+    "PM_CMPLU_STALL_MEM_ECC_DELAY\0"
+    "PM_CMPLU_STALL_NO_NTF\0"
+    "PM_CMPLU_STALL_NTCG_FLUSH\0"
+    "PM_CMPLU_STALL_OTHER_CMPL\0"
+    "PM_CMPLU_STALL_REJECT\0"
+    "PM_CMPLU_STALL_REJECT_LHS\0"
+    "PM_CMPLU_STALL_REJ_LMQ_FULL\0"
+    "PM_CMPLU_STALL_SCALAR\0"
+    "PM_CMPLU_STALL_SCALAR_LONG\0"
+    "PM_CMPLU_STALL_STORE\0"
+    "PM_CMPLU_STALL_ST_FWD\0"
+    "PM_CMPLU_STALL_THRD\0"
+    "PM_CMPLU_STALL_VECTOR\0"
+    "PM_CMPLU_STALL_VECTOR_LONG\0"
+    "PM_CMPLU_STALL_VSU\0"
+    "PM_CO0_ALLOC\0"
+    "PM_CO0_BUSY\0"
+    "PM_CO0_BUSY_ALT\0"
+    "PM_CO_USAGE\0"
+    "PM_CO_USAGE_ALT\0"
+    "PM_CRU_FIN\0"
+    "PM_CYC\0"
+    "PM_CYC_ALT\0"
+    "PM_DATA_ALL_CHIP_PUMP_CPRED\0"
+    "PM_DATA_ALL_FROM_DL2L3_MOD\0"
+    "PM_DATA_ALL_FROM_DL2L3_SHR\0"
+    "PM_DATA_ALL_FROM_DL4\0"
+    "PM_DATA_ALL_FROM_DMEM\0"
+    "PM_DATA_ALL_FROM_L2\0"
+    "PM_DATA_ALL_FROM_L21_MOD\0"
+    "PM_DATA_ALL_FROM_L21_SHR\0"
+    "PM_DATA_ALL_FROM_L2MISS_MOD\0"
+    "PM_DATA_ALL_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_DATA_ALL_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_DATA_ALL_FROM_L2_MEPF\0"
+    "PM_DATA_ALL_FROM_L2_NO_CONFLICT\0"
+    "PM_DATA_ALL_FROM_L3\0"
+    "PM_DATA_ALL_FROM_L31_ECO_MOD\0"
+    "PM_DATA_ALL_FROM_L31_ECO_SHR\0"
+    "PM_DATA_ALL_FROM_L31_MOD\0"
+    "PM_DATA_ALL_FROM_L31_SHR\0"
+    "PM_DATA_ALL_FROM_L3MISS_MOD\0"
+    "PM_DATA_ALL_FROM_L3_DISP_CONFLICT\0"
+    "PM_DATA_ALL_FROM_L3_MEPF\0"
+    "PM_DATA_ALL_FROM_L3_NO_CONFLICT\0"
+    "PM_DATA_ALL_FROM_LL4\0"
+    "PM_DATA_ALL_FROM_LMEM\0"
+    "PM_DATA_ALL_FROM_MEMORY\0"
+    "PM_DATA_ALL_FROM_OFF_CHIP_CACHE\0"
+    "PM_DATA_ALL_FROM_ON_CHIP_CACHE\0"
+    "PM_DATA_ALL_FROM_RL2L3_MOD\0"
+    "PM_DATA_ALL_FROM_RL2L3_SHR\0"
+    "PM_DATA_ALL_FROM_RL4\0"
+    "PM_DATA_ALL_FROM_RMEM\0"
+    "PM_DATA_ALL_GRP_PUMP_CPRED\0"
+    "PM_DATA_ALL_GRP_PUMP_MPRED\0"
+    "PM_DATA_ALL_GRP_PUMP_MPRED_RTY\0"
+    "PM_DATA_ALL_PUMP_CPRED\0"
+    "PM_DATA_ALL_PUMP_MPRED\0"
+    "PM_DATA_ALL_SYS_PUMP_CPRED\0"
+    "PM_DATA_ALL_SYS_PUMP_MPRED\0"
+    "PM_DATA_ALL_SYS_PUMP_MPRED_RTY\0"
+    "PM_DATA_CHIP_PUMP_CPRED\0"
+    "PM_DATA_FROM_DL2L3_MOD\0"
+    "PM_DATA_FROM_DL2L3_SHR\0"
+    "PM_DATA_FROM_DL4\0"
+    "PM_DATA_FROM_DMEM\0"
+    "PM_DATA_FROM_L2\0"
+    "PM_DATA_FROM_L21_MOD\0"
+    "PM_DATA_FROM_L21_SHR\0"
+    "PM_DATA_FROM_L2MISS\0"
+    "PM_DATA_FROM_L2MISS_MOD\0"
+    "PM_DATA_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_DATA_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_DATA_FROM_L2_MEPF\0"
+    "PM_DATA_FROM_L2_NO_CONFLICT\0"
+    "PM_DATA_FROM_L3\0"
+    "PM_DATA_FROM_L31_ECO_MOD\0"
+    "PM_DATA_FROM_L31_ECO_SHR\0"
+    "PM_DATA_FROM_L31_MOD\0"
+    "PM_DATA_FROM_L31_SHR\0"
+    "PM_DATA_FROM_L3MISS\0"
+    "PM_DATA_FROM_L3MISS_MOD\0"
+    "PM_DATA_FROM_L3_DISP_CONFLICT\0"
+    "PM_DATA_FROM_L3_MEPF\0"
+    "PM_DATA_FROM_L3_NO_CONFLICT\0"
+    "PM_DATA_FROM_LL4\0"
+    "PM_DATA_FROM_LMEM\0"
+    "PM_DATA_FROM_MEM\0"
+    "PM_DATA_FROM_MEMORY\0"
+    "PM_DATA_FROM_OFF_CHIP_CACHE\0"
+    "PM_DATA_FROM_ON_CHIP_CACHE\0"
+    "PM_DATA_FROM_RL2L3_MOD\0"
+    "PM_DATA_FROM_RL2L3_SHR\0"
+    "PM_DATA_FROM_RL4\0"
+    "PM_DATA_FROM_RMEM\0"
+    "PM_DATA_GRP_PUMP_CPRED\0"
+    "PM_DATA_GRP_PUMP_MPRED\0"
+    "PM_DATA_GRP_PUMP_MPRED_RTY\0"
+    "PM_DATA_PUMP_CPRED\0"
+    "PM_DATA_PUMP_MPRED\0"
+    "PM_DATA_SYS_PUMP_CPRED\0"
+    "PM_DATA_SYS_PUMP_MPRED\0"
+    "PM_DATA_SYS_PUMP_MPRED_RTY\0"
+    "PM_DATA_TABLEWALK_CYC\0"
+    "PM_DC_COLLISIONS\0"
+    "PM_DC_PREF_STREAM_ALLOC\0"
+    "PM_DC_PREF_STREAM_CONF\0"
+    "PM_DC_PREF_STREAM_FUZZY_CONF\0"
+    "PM_DC_PREF_STREAM_STRIDED_CONF\0"
+    "PM_DERAT_MISS_16G\0"
+    "PM_DERAT_MISS_16M\0"
+    "PM_DERAT_MISS_4K\0"
+    "PM_DERAT_MISS_64K\0"
+    "PM_DFU\0"
+    "PM_DFU_DCFFIX\0"
+    "PM_DFU_DENBCD\0"
+    "PM_DFU_MC\0"
+    "PM_DISP_CLB_HELD_BAL\0"
+    "PM_DISP_CLB_HELD_RES\0"
+    "PM_DISP_CLB_HELD_SB\0"
+    "PM_DISP_CLB_HELD_SYNC\0"
+    "PM_DISP_CLB_HELD_TLBIE\0"
+    "PM_DISP_HELD\0"
+    "PM_DISP_HELD_IQ_FULL\0"
+    "PM_DISP_HELD_MAP_FULL\0"
+    "PM_DISP_HELD_SRQ_FULL\0"
+    "PM_DISP_HELD_SYNC_HOLD\0"
+    "PM_DISP_HOLD_GCT_FULL\0"
+    "PM_DISP_WT\0"
+    "PM_DPTEG_FROM_DL2L3_MOD\0"
+    "PM_DPTEG_FROM_DL2L3_SHR\0"
+    "PM_DPTEG_FROM_DL4\0"
+    "PM_DPTEG_FROM_DMEM\0"
+    "PM_DPTEG_FROM_L2\0"
+    "PM_DPTEG_FROM_L21_MOD\0"
+    "PM_DPTEG_FROM_L21_SHR\0"
+    "PM_DPTEG_FROM_L2MISS\0"
+    "PM_DPTEG_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_DPTEG_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_DPTEG_FROM_L2_MEPF\0"
+    "PM_DPTEG_FROM_L2_NO_CONFLICT\0"
+    "PM_DPTEG_FROM_L3\0"
+    "PM_DPTEG_FROM_L31_ECO_MOD\0"
+    "PM_DPTEG_FROM_L31_ECO_SHR\0"
+    "PM_DPTEG_FROM_L31_MOD\0"
+    "PM_DPTEG_FROM_L31_SHR\0"
+    "PM_DPTEG_FROM_L3MISS\0"
+    "PM_DPTEG_FROM_L3_DISP_CONFLICT\0"
+    "PM_DPTEG_FROM_L3_MEPF\0"
+    "PM_DPTEG_FROM_L3_NO_CONFLICT\0"
+    "PM_DPTEG_FROM_LL4\0"
+    "PM_DPTEG_FROM_LMEM\0"
+    "PM_DPTEG_FROM_MEMORY\0"
+    "PM_DPTEG_FROM_OFF_CHIP_CACHE\0"
+    "PM_DPTEG_FROM_ON_CHIP_CACHE\0"
+    "PM_DPTEG_FROM_RL2L3_MOD\0"
+    "PM_DPTEG_FROM_RL2L3_SHR\0"
+    "PM_DPTEG_FROM_RL4\0"
+    "PM_DPTEG_FROM_RMEM\0"
+    "PM_DSLB_MISS\0"
+    "PM_DSLB_MISS_ALT\0"
+    "PM_DTLB_MISS\0"
+    "PM_DTLB_MISS_16G\0"
+    "PM_DTLB_MISS_16M\0"
+    "PM_DTLB_MISS_4K\0"
+    "PM_DTLB_MISS_64K\0"
+    "PM_EAT_FORCE_MISPRED\0"
+    "PM_EAT_FULL_CYC\0"
+    "PM_EE_OFF_EXT_INT\0"
+    "PM_EXT_INT\0"
+    "PM_FAV_TBEGIN\0"
+    "PM_FLOP\0"
+    "PM_FLOP_SUM_SCALAR\0"
+    "PM_FLOP_SUM_VEC\0"
+    "PM_FLUSH\0"
+    "PM_FLUSH_BR_MPRED\0"
+    "PM_FLUSH_COMPLETION\0"
+    "PM_FLUSH_DISP\0"
+    "PM_FLUSH_DISP_SB\0"
+    "PM_FLUSH_DISP_SYNC\0"
+    "PM_FLUSH_DISP_TLBIE\0"
+    "PM_FLUSH_LSU\0"
+    "PM_FLUSH_PARTIAL\0"
+    "PM_FPU0_FCONV\0"
+    "PM_FPU0_FEST\0"
+    "PM_FPU0_FRSP\0"
+    "PM_FPU1_FCONV\0"
+    "PM_FPU1_FEST\0"
+    "PM_FPU1_FRSP\0"
+    "PM_FREQ_DOWN\0"
+    "PM_FREQ_UP\0"
+    "PM_FUSION_TOC_GRP0_1\0"
+    "PM_FUSION_TOC_GRP0_2\0"
+    "PM_FUSION_TOC_GRP0_3\0"
+    "PM_FUSION_TOC_GRP1_1\0"
+    "PM_FUSION_VSX_GRP0_1\0"
+    "PM_FUSION_VSX_GRP0_2\0"
+    "PM_FUSION_VSX_GRP0_3\0"
+    "PM_FUSION_VSX_GRP1_1\0"
+    "PM_FXU0_BUSY_FXU1_IDLE\0"
+    "PM_FXU0_FIN\0"
+    "PM_FXU1_BUSY_FXU0_IDLE\0"
+    "PM_FXU1_FIN\0"
+    "PM_FXU_BUSY\0"
+    "PM_FXU_IDLE\0"
+    "PM_GCT_EMPTY_CYC\0"
+    "PM_GCT_MERGE\0"
+    "PM_GCT_NOSLOT_BR_MPRED\0"
+    "PM_GCT_NOSLOT_BR_MPRED_ICMISS\0"
+    "PM_GCT_NOSLOT_CYC\0"
+    "PM_GCT_NOSLOT_DISP_HELD_ISSQ\0"
+    "PM_GCT_NOSLOT_DISP_HELD_MAP\0"
+    "PM_GCT_NOSLOT_DISP_HELD_OTHER\0"
+    "PM_GCT_NOSLOT_DISP_HELD_SRQ\0"
+    "PM_GCT_NOSLOT_IC_L3MISS\0"
+    "PM_GCT_NOSLOT_IC_MISS\0"
+    "PM_GCT_UTIL_11_14_ENTRIES\0"
+    "PM_GCT_UTIL_15_17_ENTRIES\0"
+    "PM_GCT_UTIL_18_ENTRIES\0"
+    "PM_GCT_UTIL_1_2_ENTRIES\0"
+    "PM_GCT_UTIL_3_6_ENTRIES\0"
+    "PM_GCT_UTIL_7_10_ENTRIES\0"
+    "PM_GRP_BR_MPRED_NONSPEC\0"
+    "PM_GRP_CMPL\0"
+    "PM_GRP_DISP\0"
+    "PM_GRP_IC_MISS_NONSPEC\0"
+    "PM_GRP_MRK\0"
+    "PM_GRP_NON_FULL_GROUP\0"
+    "PM_GRP_PUMP_CPRED\0"
+    "PM_GRP_PUMP_MPRED\0"
+    "PM_GRP_PUMP_MPRED_RTY\0"
+    "PM_GRP_TERM_2ND_BRANCH\0"
+    "PM_GRP_TERM_FPU_AFTER_BR\0"
+    "PM_GRP_TERM_NOINST\0"
+    "PM_GRP_TERM_OTHER\0"
+    "PM_GRP_TERM_SLOT_LIMIT\0"
+    "PM_HV_CYC\0"
+    "PM_IBUF_FULL_CYC\0"
+    "PM_IC_DEMAND_CYC\0"
+    "PM_IC_DEMAND_L2_BHT_REDIRECT\0"
+    "PM_IC_DEMAND_L2_BR_REDIRECT\0"
+    "PM_IC_DEMAND_REQ\0"
+    "PM_IC_INVALIDATE\0"
+    "PM_IC_PREF_CANCEL_HIT\0"
+    "PM_IC_PREF_CANCEL_L2\0"
+    "PM_IC_PREF_CANCEL_PAGE\0"
+    "PM_IC_PREF_REQ\0"
+    "PM_IC_PREF_WRITE\0"
+    "PM_IC_RELOAD_PRIVATE\0"
+    "PM_IERAT_RELOAD\0"
+    "PM_IERAT_RELOAD_16M\0"
+    "PM_IERAT_RELOAD_4K\0"
+    "PM_IERAT_RELOAD_64K\0"
+    "PM_IFETCH_THROTTLE\0"
+    "PM_IFU_L2_TOUCH\0"
+    "PM_INST_ALL_CHIP_PUMP_CPRED\0"
+    "PM_INST_ALL_FROM_DL2L3_MOD\0"
+    "PM_INST_ALL_FROM_DL2L3_SHR\0"
+    "PM_INST_ALL_FROM_DL4\0"
+    "PM_INST_ALL_FROM_DMEM\0"
+    "PM_INST_ALL_FROM_L2\0"
+    "PM_INST_ALL_FROM_L21_MOD\0"
+    "PM_INST_ALL_FROM_L21_SHR\0"
+    "PM_INST_ALL_FROM_L2MISS\0"
+    "PM_INST_ALL_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_INST_ALL_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_INST_ALL_FROM_L2_MEPF\0"
+    "PM_INST_ALL_FROM_L2_NO_CONFLICT\0"
+    "PM_INST_ALL_FROM_L3\0"
+    "PM_INST_ALL_FROM_L31_ECO_MOD\0"
+    "PM_INST_ALL_FROM_L31_ECO_SHR\0"
+    "PM_INST_ALL_FROM_L31_MOD\0"
+    "PM_INST_ALL_FROM_L31_SHR\0"
+    "PM_INST_ALL_FROM_L3MISS_MOD\0"
+    "PM_INST_ALL_FROM_L3_DISP_CONFLICT\0"
+    "PM_INST_ALL_FROM_L3_MEPF\0"
+    "PM_INST_ALL_FROM_L3_NO_CONFLICT\0"
+    "PM_INST_ALL_FROM_LL4\0"
+    "PM_INST_ALL_FROM_LMEM\0"
+    "PM_INST_ALL_FROM_MEMORY\0"
+    "PM_INST_ALL_FROM_OFF_CHIP_CACHE\0"
+    "PM_INST_ALL_FROM_ON_CHIP_CACHE\0"
+    "PM_INST_ALL_FROM_RL2L3_MOD\0"
+    "PM_INST_ALL_FROM_RL2L3_SHR\0"
+    "PM_INST_ALL_FROM_RL4\0"
+    "PM_INST_ALL_FROM_RMEM\0"
+    "PM_INST_ALL_GRP_PUMP_CPRED\0"
+    "PM_INST_ALL_GRP_PUMP_MPRED\0"
+    "PM_INST_ALL_GRP_PUMP_MPRED_RTY\0"
+    "PM_INST_ALL_PUMP_CPRED\0"
+    "PM_INST_ALL_PUMP_MPRED\0"
+    "PM_INST_ALL_SYS_PUMP_CPRED\0"
+    "PM_INST_ALL_SYS_PUMP_MPRED\0"
+    "PM_INST_ALL_SYS_PUMP_MPRED_RTY\0"
+    "PM_INST_CHIP_PUMP_CPRED\0"
+    "PM_INST_CMPL\0"
+    "PM_INST_DISP\0"
+    "PMC1|PMC2\0"
+    "PM_INST_FROM_DL2L3_MOD\0"
+    "PM_INST_FROM_DL2L3_SHR\0"
+    "PM_INST_FROM_DL4\0"
+    "PM_INST_FROM_DMEM\0"
+    "PM_INST_FROM_L1\0"
+    "PM_INST_FROM_L2\0"
+    "PM_INST_FROM_L21_MOD\0"
+    "PM_INST_FROM_L21_SHR\0"
+    "PM_INST_FROM_L2MISS\0"
+    "PM_INST_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_INST_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_INST_FROM_L2_MEPF\0"
+    "PM_INST_FROM_L2_NO_CONFLICT\0"
+    "PM_INST_FROM_L3\0"
+    "PM_INST_FROM_L31_ECO_MOD\0"
+    "PM_INST_FROM_L31_ECO_SHR\0"
+    "PM_INST_FROM_L31_MOD\0"
+    "PM_INST_FROM_L31_SHR\0"
+    "PM_INST_FROM_L3MISS\0"
+    "PM_INST_FROM_L3MISS_MOD\0"
+    "PM_INST_FROM_L3_DISP_CONFLICT\0"
+    "PM_INST_FROM_L3_MEPF\0"
+    "PM_INST_FROM_L3_NO_CONFLICT\0"
+    "PM_INST_FROM_LL4\0"
+    "PM_INST_FROM_LMEM\0"
+    "PM_INST_FROM_MEMORY\0"
+    "PM_INST_FROM_OFF_CHIP_CACHE\0"
+    "PM_INST_FROM_ON_CHIP_CACHE\0"
+    "PM_INST_FROM_RL2L3_MOD\0"
+    "PM_INST_FROM_RL2L3_SHR\0"
+    "PM_INST_FROM_RL4\0"
+    "PM_INST_FROM_RMEM\0"
+    "PM_INST_GRP_PUMP_CPRED\0"
+    "PM_INST_GRP_PUMP_MPRED\0"
+    "PM_INST_GRP_PUMP_MPRED_RTY\0"
+    "PM_INST_IMC_MATCH_CMPL\0"
+    "PM_INST_IMC_MATCH_DISP\0"
+    "PM_INST_PUMP_CPRED\0"
+    "PM_INST_PUMP_MPRED\0"
+    "PM_INST_SYS_PUMP_CPRED\0"
+    "PM_INST_SYS_PUMP_MPRED\0"
+    "PM_INST_SYS_PUMP_MPRED_RTY\0"
+    "PM_IOPS_CMPL\0"
+    "PM_IOPS_DISP\0"
+    "PM_IPTEG_FROM_DL2L3_MOD\0"
+    "PM_IPTEG_FROM_DL2L3_SHR\0"
+    "PM_IPTEG_FROM_DL4\0"
+    "PM_IPTEG_FROM_DMEM\0"
+    "PM_IPTEG_FROM_L2\0"
+    "PM_IPTEG_FROM_L21_MOD\0"
+    "PM_IPTEG_FROM_L21_SHR\0"
+    "PM_IPTEG_FROM_L2MISS\0"
+    "PM_IPTEG_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_IPTEG_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_IPTEG_FROM_L2_MEPF\0"
+    "PM_IPTEG_FROM_L2_NO_CONFLICT\0"
+    "PM_IPTEG_FROM_L3\0"
+    "PM_IPTEG_FROM_L31_ECO_MOD\0"
+    "PM_IPTEG_FROM_L31_ECO_SHR\0"
+    "PM_IPTEG_FROM_L31_MOD\0"
+    "PM_IPTEG_FROM_L31_SHR\0"
+    "PM_IPTEG_FROM_L3MISS\0"
+    "PM_IPTEG_FROM_L3_DISP_CONFLICT\0"
+    "PM_IPTEG_FROM_L3_MEPF\0"
+    "PM_IPTEG_FROM_L3_NO_CONFLICT\0"
+    "PM_IPTEG_FROM_LL4\0"
+    "PM_IPTEG_FROM_LMEM\0"
+    "PM_IPTEG_FROM_MEMORY\0"
+    "PM_IPTEG_FROM_OFF_CHIP_CACHE\0"
+    "PM_IPTEG_FROM_ON_CHIP_CACHE\0"
+    "PM_IPTEG_FROM_RL2L3_MOD\0"
+    "PM_IPTEG_FROM_RL2L3_SHR\0"
+    "PM_IPTEG_FROM_RL4\0"
+    "PM_IPTEG_FROM_RMEM\0"
+    "PM_ISIDE_L2MEMACC\0"
+    "PM_ISIDE_L2MEMACC_ALT\0"
+    "PM_ISLB_MISS\0"
+    "PM_ISLB_MISS_ALT\0"
+    "PM_ISU_REF_FX0\0"
+    "PM_ISU_REF_FX1\0"
+    "PM_ISU_REF_FXU\0"
+    "PM_ISU_REF_LS0\0"
+    "PM_ISU_REF_LS1\0"
+    "PM_ISU_REF_LS2\0"
+    "PM_ISU_REF_LS3\0"
+    "PM_ISU_REJECTS_ALL\0"
+    "PM_ISU_REJECT_RES_NA\0"
+    "PM_ISU_REJECT_SAR_BYPASS\0"
+    "PM_ISU_REJECT_SRC_NA\0"
+    "PM_ISU_REJ_VS0\0"
+    "PM_ISU_REJ_VS1\0"
+    "PM_ISU_REJ_VSU\0"
+    "PM_ISYNC\0"
+    "PM_ITLB_MISS\0"
+    "PM_L1MISS_LAT_EXC_1024\0"
+    "PM_L1MISS_LAT_EXC_2048\0"
+    "PM_L1MISS_LAT_EXC_256\0"
+    "PM_L1MISS_LAT_EXC_32\0"
+    "PM_L1PF_L2MEMACC\0"
+    "PM_L1PF_L2MEMACC_ALT\0"
+    "PM_L1_DCACHE_RELOADED_ALL\0"
+    "PM_L1_DCACHE_RELOAD_VALID\0"
+    "PM_L1_DEMAND_WRITE\0"
+    "PM_L1_ICACHE_MISS\0"
+    "PM_L1_ICACHE_RELOADED_ALL\0"
+    "PM_L1_ICACHE_RELOADED_PREF\0"
+    "PM_L2_CHIP_PUMP\0"
+    "PM_L2_CHIP_PUMP_ALT\0"
+    "PM_L2_GROUP_PUMP\0"
+    "PM_L2_GROUP_PUMP_ALT\0"
+    "PM_L2_RTY_ST\0"
+    "PM_L2_RTY_ST_ALT\0"
+    "PM_L2_RTY_LD\0"
+    "PM_L2_RTY_LD_ALT\0"
+    "PM_L2_ST\0"
+    "PM_L2_ST_ALT\0"
+    "PM_L2_ST_DISP\0"
+    "PM_L2_ST_HIT\0"
+    "PM_L2_ST_MISS\0"
+    "PM_L2_ST_MISS_ALT\0"
+    "PM_L2_LD\0"
+    "PM_L2_LD_DISP\0"
+    "PM_L2_LD_HIT\0"
+    "PM_L2_LD_MISS\0"
+    "PM_L2_TM_REQ_ABORT\0"
+    "PM_L2_TM_ST_ABORT_SISTER\0"
+    "PM_L2_SYS_PUMP\0"
+    "PM_L2_SYS_PUMP_ALT\0"
+    "PM_L3_CI_USAGE\0"
+    "PM_L3_CO0_ALLOC\0"
+    "PM_L3_CO0_BUSY\0"
+    "PM_L3_CO_L31\0"
+    "PM_L3_CO_MEM\0"
+    "PM_L3_CO_MEPF\0"
+    "PM_L3_CO_MEPF_ALT\0"
+    "PM_L3_LD_PREF\0"
+    "PM_L3_PF0_ALLOC\0"
+    "PM_L3_PF0_BUSY\0"
+    "PM_L3_PF_MISS_L3\0"
+    "PM_L3_PF_OFF_CHIP_CACHE\0"
+    "PM_L3_PF_OFF_CHIP_MEM\0"
+    "PM_L3_PF_ON_CHIP_CACHE\0"
+    "PM_L3_PF_ON_CHIP_MEM\0"
+    "PM_L3_PF_USAGE\0"
+    "PM_L3_PREF_ALL\0"
+    "PM_L3_RD0_ALLOC\0"
+    "PM_L3_RD0_BUSY\0"
+    "PM_L3_RD_USAGE\0"
+    "PM_L3_SN0_ALLOC\0"
+    "PM_L3_SN0_BUSY\0"
+    "PM_L3_SN_USAGE\0"
+    "PM_L3_ST_PREF\0"
+    "PM_L3_SW_PREF\0"
+    "PM_L3_WI0_ALLOC\0"
+    "PM_LARX_FIN\0"
+    "PM_LD_CMPL\0"
+    "PM_LD_L3MISS_PEND_CYC\0"
+    "PM_LD_MISS_L1\0"
+    "PM_LD_MISS_L1_ALT\0"
+    "PM_LD_REF_L1\0"
+    "PM_LD_REF_L1_LSU0\0"
+    "PM_LD_REF_L1_LSU1\0"
+    "PM_LD_REF_L1_LSU2\0"
+    "PM_LD_REF_L1_LSU3\0"
+    "PM_LINK_STACK_INVALID_PTR\0"
+    "PM_LINK_STACK_WRONG_ADD_PRED\0"
+    "PM_LS0_ERAT_MISS_PREF\0"
+    "PM_LS0_L1_PREF\0"
+    "PM_LS0_L1_SW_PREF\0"
+    "PM_LS1_ERAT_MISS_PREF\0"
+    "PM_LS1_L1_PREF\0"
+    "PM_LS1_L1_SW_PREF\0"
+    "PM_LSU0_FLUSH_LRQ\0"
+    "PM_LSU0_FLUSH_SRQ\0"
+    "PM_LSU0_FLUSH_ULD\0"
+    "PM_LSU0_FLUSH_UST\0"
+    "PM_LSU0_L1_CAM_CANCEL\0"
+    "PM_LSU0_LARX_FIN\0"
+    "PM_LSU0_LMQ_LHR_MERGE\0"
+    "PM_LSU0_NCLD\0"
+    "PM_LSU0_PRIMARY_ERAT_HIT\0"
+    "PM_LSU0_REJECT\0"
+    "PM_LSU0_SRQ_STFWD\0"
+    "PM_LSU0_STORE_REJECT\0"
+    "PM_LSU0_TMA_REQ_L2\0"
+    "PM_LSU0_TM_L1_HIT\0"
+    "PM_LSU0_TM_L1_MISS\0"
+    "PM_LSU1_FLUSH_LRQ\0"
+    "PM_LSU1_FLUSH_SRQ\0"
+    "PM_LSU1_FLUSH_ULD\0"
+    "PM_LSU1_FLUSH_UST\0"
+    "PM_LSU1_L1_CAM_CANCEL\0"
+    "PM_LSU1_LARX_FIN\0"
+    "PM_LSU1_LMQ_LHR_MERGE\0"
+    "PM_LSU1_NCLD\0"
+    "PM_LSU1_PRIMARY_ERAT_HIT\0"
+    "PM_LSU1_REJECT\0"
+    "PM_LSU1_SRQ_STFWD\0"
+    "PM_LSU1_STORE_REJECT\0"
+    "PM_LSU1_TMA_REQ_L2\0"
+    "PM_LSU1_TM_L1_HIT\0"
+    "PM_LSU1_TM_L1_MISS\0"
+    "PM_LSU2_FLUSH_LRQ\0"
+    "PM_LSU2_FLUSH_SRQ\0"
+    "PM_LSU2_FLUSH_ULD\0"
+    "PM_LSU2_L1_CAM_CANCEL\0"
+    "PM_LSU2_LARX_FIN\0"
+    "PM_LSU2_LDF\0"
+    "PM_LSU2_LDX\0"
+    "PM_LSU2_LMQ_LHR_MERGE\0"
+    "PM_LSU2_PRIMARY_ERAT_HIT\0"
+    "PM_LSU2_REJECT\0"
+    "PM_LSU2_SRQ_STFWD\0"
+    "PM_LSU2_TMA_REQ_L2\0"
+    "PM_LSU2_TM_L1_HIT\0"
+    "PM_LSU2_TM_L1_MISS\0"
+    "PM_LSU3_FLUSH_LRQ\0"
+    "PM_LSU3_FLUSH_SRQ\0"
+    "PM_LSU3_FLUSH_ULD\0"
+    "PM_LSU3_L1_CAM_CANCEL\0"
+    "PM_LSU3_LARX_FIN\0"
+    "PM_LSU3_LDF\0"
+    "PM_LSU3_LDX\0"
+    "PM_LSU3_LMQ_LHR_MERGE\0"
+    "PM_LSU3_PRIMARY_ERAT_HIT\0"
+    "PM_LSU3_REJECT\0"
+    "PM_LSU3_SRQ_STFWD\0"
+    "PM_LSU3_TMA_REQ_L2\0"
+    "PM_LSU3_TM_L1_HIT\0"
+    "PM_LSU3_TM_L1_MISS\0"
+    "PM_LSU_DERAT_MISS\0"
+    "PM_LSU_ERAT_MISS_PREF\0"
+    "PM_LSU_FIN\0"
+    "PM_LSU_FLUSH_UST\0"
+    "PM_LSU_FOUR_TABLEWALK_CYC\0"
+    "PM_LSU_FX_FIN\0"
+    "PM_LSU_L1_PREF\0"
+    "PM_LSU_L1_SW_PREF\0"
+    "PM_LSU_LDF\0"
+    "PM_LSU_LDX\0"
+    "PM_LSU_LMQ_FULL_CYC\0"
+    "PM_LSU_LMQ_S0_ALLOC\0"
+    "PM_LSU_LMQ_S0_VALID\0"
+    "PM_LSU_LMQ_SRQ_EMPTY_ALL_CYC\0"
+    "PM_LSU_LMQ_SRQ_EMPTY_CYC\0"
+    "PM_LSU_LRQ_S0_ALLOC\0"
+    "PM_LSU_LRQ_S0_VALID\0"
+    "PM_LSU_LRQ_S43_ALLOC\0"
+    "PM_LSU_LRQ_S43_VALID\0"
+    "PM_LSU_MRK_DERAT_MISS\0"
+    "PM_LSU_NCLD\0"
+    "PM_LSU_NCST\0"
+    "PM_LSU_REJECT\0"
+    "PM_LSU_REJECT_ERAT_MISS\0"
+    "PM_LSU_REJECT_LHS\0"
+    "PM_LSU_REJECT_LMQ_FULL\0"
+    "PM_LSU_SET_MPRED\0"
+    "PM_LSU_SRQ_EMPTY_CYC\0"
+    "PM_LSU_SRQ_FULL_CYC\0"
+    "PM_LSU_SRQ_S0_ALLOC\0"
+    "PM_LSU_SRQ_S0_VALID\0"
+    "PM_LSU_SRQ_S39_ALLOC\0"
+    "PM_LSU_SRQ_S39_VALID\0"
+    "PM_LSU_SRQ_SYNC\0"
+    "PM_LSU_SRQ_SYNC_CYC\0"
+    "PM_LSU_STORE_REJECT\0"
+    "PM_LSU_TWO_TABLEWALK_CYC\0"
+    "PM_LWSYNC\0"
+    "PM_LWSYNC_ALT\0"
+    "PM_LWSYNC_HELD\0"
+    "PM_MEM_CO\0"
+    "PM_MEM_LOC_THRESH_IFU\0"
+    "PM_MEM_LOC_THRESH_LSU_HIGH\0"
+    "PM_MEM_LOC_THRESH_LSU_MED\0"
+    "PM_MEM_PREF\0"
+    "PM_MEM_READ\0"
+    "PM_MEM_RWITM\0"
+    "PM_MRK_BACK_BR_CMPL\0"
+    "PM_MRK_BRU_FIN\0"
+    "PM_MRK_BR_CMPL\0"
+    "PM_MRK_BR_MPRED_CMPL\0"
+    "PM_MRK_BR_TAKEN_CMPL\0"
+    "PM_MRK_CRU_FIN\0"
+    "PM_MRK_DATA_FROM_DL2L3_MOD\0"
+    "PM_MRK_DATA_FROM_DL2L3_MOD_CYC\0"
+    "PM_MRK_DATA_FROM_DL2L3_SHR\0"
+    "PM_MRK_DATA_FROM_DL2L3_SHR_CYC\0"
+    "PM_MRK_DATA_FROM_DL4\0"
+    "PM_MRK_DATA_FROM_DL4_CYC\0"
+    "PM_MRK_DATA_FROM_DMEM\0"
+    "PM_MRK_DATA_FROM_DMEM_CYC\0"
+    "PM_MRK_DATA_FROM_L2\0"
+    "PM_MRK_DATA_FROM_L21_MOD\0"
+    "PM_MRK_DATA_FROM_L21_MOD_CYC\0"
+    "PM_MRK_DATA_FROM_L21_SHR\0"
+    "PM_MRK_DATA_FROM_L21_SHR_CYC\0"
+    "PM_MRK_DATA_FROM_L2MISS\0"
+    "PM_MRK_DATA_FROM_L2MISS_ALT\0"
+    "PM_MRK_DATA_FROM_L2MISS_CYC\0"
+    "PM_MRK_DATA_FROM_L2_CYC\0"
+    "PM_MRK_DATA_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_MRK_DATA_FROM_L2_DISP_CONFLICT_LDHITST_CYC\0"
+    "PM_MRK_DATA_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_MRK_DATA_FROM_L2_DISP_CONFLICT_OTHER_CYC\0"
+    "PM_MRK_DATA_FROM_L2_MEPF\0"
+    "PM_MRK_DATA_FROM_L2_MEPF_CYC\0"
+    "PM_MRK_DATA_FROM_L2_NO_CONFLICT\0"
+    "PM_MRK_DATA_FROM_L2_NO_CONFLICT_CYC\0"
+    "PM_MRK_DATA_FROM_L3\0"
+    "PM_MRK_DATA_FROM_L31_ECO_MOD\0"
+    "PM_MRK_DATA_FROM_L31_ECO_MOD_CYC\0"
+    "PM_MRK_DATA_FROM_L31_ECO_SHR\0"
+    "PM_MRK_DATA_FROM_L31_ECO_SHR_CYC\0"
+    "PM_MRK_DATA_FROM_L31_MOD\0"
+    "PM_MRK_DATA_FROM_L31_MOD_CYC\0"
+    "PM_MRK_DATA_FROM_L31_SHR\0"
+    "PM_MRK_DATA_FROM_L31_SHR_CYC\0"
+    "PM_MRK_DATA_FROM_L3MISS\0"
+    "PM_MRK_DATA_FROM_L3MISS_ALT\0"
+    "PM_MRK_DATA_FROM_L3MISS_CYC\0"
+    "PM_MRK_DATA_FROM_L3_CYC\0"
+    "PM_MRK_DATA_FROM_L3_DISP_CONFLICT\0"
+    "PM_MRK_DATA_FROM_L3_DISP_CONFLICT_CYC\0"
+    "PM_MRK_DATA_FROM_L3_MEPF\0"
+    "PM_MRK_DATA_FROM_L3_MEPF_CYC\0"
+    "PM_MRK_DATA_FROM_L3_NO_CONFLICT\0"
+    "PM_MRK_DATA_FROM_L3_NO_CONFLICT_CYC\0"
+    "PM_MRK_DATA_FROM_LL4\0"
+    "PM_MRK_DATA_FROM_LL4_CYC\0"
+    "PM_MRK_DATA_FROM_LMEM\0"
+    "PM_MRK_DATA_FROM_LMEM_CYC\0"
+    "PM_MRK_DATA_FROM_MEM\0"
+    "PM_MRK_DATA_FROM_MEMORY\0"
+    "PM_MRK_DATA_FROM_MEMORY_CYC\0"
+    "PM_MRK_DATA_FROM_OFF_CHIP_CACHE\0"
+    "PM_MRK_DATA_FROM_OFF_CHIP_CACHE_CYC\0"
+    "PM_MRK_DATA_FROM_ON_CHIP_CACHE\0"
+    "PM_MRK_DATA_FROM_ON_CHIP_CACHE_CYC\0"
+    "PM_MRK_DATA_FROM_RL2L3_MOD\0"
+    "PM_MRK_DATA_FROM_RL2L3_MOD_CYC\0"
+    "PM_MRK_DATA_FROM_RL2L3_SHR\0"
+    "PM_MRK_DATA_FROM_RL2L3_SHR_CYC\0"
+    "PM_MRK_DATA_FROM_RL4\0"
+    "PM_MRK_DATA_FROM_RL4_CYC\0"
+    "PM_MRK_DATA_FROM_RMEM\0"
+    "PM_MRK_DATA_FROM_RMEM_CYC\0"
+    "PM_MRK_DCACHE_RELOAD_INTV\0"
+    "PM_MRK_DERAT_MISS\0"
+    "PM_MRK_DERAT_MISS_16G\0"
+    "PM_MRK_DERAT_MISS_16M\0"
+    "PM_MRK_DERAT_MISS_4K\0"
+    "PM_MRK_DERAT_MISS_64K\0"
+    "PM_MRK_DFU_FIN\0"
+    "PM_MRK_DPTEG_FROM_DL2L3_MOD\0"
+    "PM_MRK_DPTEG_FROM_DL2L3_SHR\0"
+    "PM_MRK_DPTEG_FROM_DL4\0"
+    "PM_MRK_DPTEG_FROM_DMEM\0"
+    "PM_MRK_DPTEG_FROM_L2\0"
+    "PM_MRK_DPTEG_FROM_L21_MOD\0"
+    "PM_MRK_DPTEG_FROM_L21_SHR\0"
+    "PM_MRK_DPTEG_FROM_L2MISS\0"
+    "PM_MRK_DPTEG_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_MRK_DPTEG_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_MRK_DPTEG_FROM_L2_MEPF\0"
+    "PM_MRK_DPTEG_FROM_L2_NO_CONFLICT\0"
+    "PM_MRK_DPTEG_FROM_L3\0"
+    "PM_MRK_DPTEG_FROM_L31_ECO_MOD\0"
+    "PM_MRK_DPTEG_FROM_L31_ECO_SHR\0"
+    "PM_MRK_DPTEG_FROM_L31_MOD\0"
+    "PM_MRK_DPTEG_FROM_L31_SHR\0"
+    "PM_MRK_DPTEG_FROM_L3MISS\0"
+    "PM_MRK_DPTEG_FROM_L3_DISP_CONFLICT\0"
+    "PM_MRK_DPTEG_FROM_L3_MEPF\0"
+    "PM_MRK_DPTEG_FROM_L3_NO_CONFLICT\0"
+    "PM_MRK_DPTEG_FROM_LL4\0"
+    "PM_MRK_DPTEG_FROM_LMEM\0"
+    "PM_MRK_DPTEG_FROM_MEMORY\0"
+    "PM_MRK_DPTEG_FROM_OFF_CHIP_CACHE\0"
+    "PM_MRK_DPTEG_FROM_ON_CHIP_CACHE\0"
+    "PM_MRK_DPTEG_FROM_RL2L3_MOD\0"
+    "PM_MRK_DPTEG_FROM_RL2L3_SHR\0"
+    "PM_MRK_DPTEG_FROM_RL4\0"
+    "PM_MRK_DPTEG_FROM_RMEM\0"
+    "PM_MRK_DTLB_MISS\0"
+    "PM_MRK_DTLB_MISS_16G\0"
+    "PM_MRK_DTLB_MISS_16M\0"
+    "PM_MRK_DTLB_MISS_4K\0"
+    "PM_MRK_DTLB_MISS_64K\0"
+    "PM_MRK_FAB_RSP_BKILL\0"
+    "PM_MRK_FAB_RSP_BKILL_CYC\0"
+    "PM_MRK_FAB_RSP_CLAIM_RTY\0"
+    "PM_MRK_FAB_RSP_DCLAIM\0"
+    "PM_MRK_FAB_RSP_DCLAIM_CYC\0"
+    "PM_MRK_FAB_RSP_MATCH\0"
+    "PM_MRK_FAB_RSP_MATCH_CYC\0"
+    "PM_MRK_FAB_RSP_RD_RTY\0"
+    "PM_MRK_FAB_RSP_RD_T_INTV\0"
+    "PM_MRK_FAB_RSP_RWITM_CYC\0"
+    "PM_MRK_FAB_RSP_RWITM_RTY\0"
+    "PM_MRK_FILT_MATCH\0"
+    "PM_MRK_FIN_STALL_CYC\0"
+    "PM_MRK_FXU_FIN\0"
+    "PM_MRK_GRP_CMPL\0"
+    "PM_MRK_GRP_IC_MISS\0"
+    "PM_MRK_GRP_NTC\0"
+    "PM_MRK_INST_CMPL\0"
+    "PM_MRK_INST_DECODED\0"
+    "PM_MRK_INST_DISP\0"
+    "PM_MRK_INST_FIN\0"
+    "PM_MRK_INST_FROM_L3MISS\0"
+    "PM_MRK_INST_ISSUED\0"
+    "PM_MRK_INST_TIMEO\0"
+    "PM_MRK_L1_ICACHE_MISS\0"
+    "PM_MRK_L1_RELOAD_VALID\0"
+    "PM_MRK_L2_RC_DISP\0"
+    "PM_MRK_L2_RC_DONE\0"
+    "PM_MRK_LARX_FIN\0"
+    "PM_MRK_LD_MISS_EXPOSED\0"
+    "PM_MRK_LD_MISS_EXPOSED_CYC\0"
+    "PM_MRK_LD_MISS_L1\0"
+    "PM_MRK_LD_MISS_L1_CYC\0"
+    "PM_MRK_LSU_FIN\0"
+    "PM_MRK_LSU_FLUSH\0"
+    "PM_MRK_LSU_FLUSH_LRQ\0"
+    "PM_MRK_LSU_FLUSH_SRQ\0"
+    "PM_MRK_LSU_FLUSH_ULD\0"
+    "PM_MRK_LSU_FLUSH_UST\0"
+    "PM_MRK_LSU_REJECT\0"
+    "PM_MRK_LSU_REJECT_ERAT_MISS\0"
+    "PM_MRK_NTF_FIN\0"
+    "PM_MRK_RUN_CYC\0"
+    "PM_MRK_SRC_PREF_TRACK_EFF\0"
+    "PM_MRK_SRC_PREF_TRACK_INEFF\0"
+    "PM_MRK_SRC_PREF_TRACK_MOD\0"
+    "PM_MRK_SRC_PREF_TRACK_MOD_L2\0"
+    "PM_MRK_SRC_PREF_TRACK_MOD_L3\0"
+    "PM_MRK_STALL_CMPLU_CYC\0"
+    "PM_MRK_STCX_FAIL\0"
+    "PM_MRK_ST_CMPL\0"
+    "PM_MRK_ST_CMPL_INT\0"
+    "PM_MRK_ST_DRAIN_TO_L2DISP_CYC\0"
+    "PM_MRK_ST_FWD\0"
+    "PM_MRK_ST_L2DISP_TO_CMPL_CYC\0"
+    "PM_MRK_ST_NEST\0"
+    "PM_MRK_TGT_PREF_TRACK_EFF\0"
+    "PM_MRK_TGT_PREF_TRACK_INEFF\0"
+    "PM_MRK_TGT_PREF_TRACK_MOD\0"
+    "PM_MRK_TGT_PREF_TRACK_MOD_L2\0"
+    "PM_MRK_TGT_PREF_TRACK_MOD_L3\0"
+    "PM_MRK_VSU_FIN\0"
+    "PM_MULT_MRK\0"
+    "PM_NESTED_TEND\0"
+    "PM_NEST_REF_CLK\0"
+    "PM_NON_FAV_TBEGIN\0"
+    "PM_NTCG_ALL_FIN\0"
+    "PM_OUTER_TBEGIN\0"
+    "PM_OUTER_TEND\0"
+    "PM_PMC1_OVERFLOW\0"
+    "PM_PMC2_OVERFLOW\0"
+    "PM_PMC2_REWIND\0"
+    "PM_PMC2_SAVED\0"
+    "PM_PMC3_OVERFLOW\0"
+    "PM_PMC4_OVERFLOW\0"
+    "PM_PMC4_REWIND\0"
+    "PM_PMC4_SAVED\0"
+    "PM_PMC5_OVERFLOW\0"
+    "PM_PMC6_OVERFLOW\0"
+    "PM_PREF_TRACKED\0"
+    "PM_PREF_TRACK_EFF\0"
+    "PM_PREF_TRACK_INEFF\0"
+    "PM_PREF_TRACK_MOD\0"
+    "PM_PREF_TRACK_MOD_L2\0"
+    "PM_PREF_TRACK_MOD_L3\0"
+    "PM_PROBE_NOP_DISP\0"
+    "PM_PTE_PREFETCH\0"
+    "PM_PUMP_CPRED\0"
+    "PM_PUMP_MPRED\0"
+    "PM_RC0_ALLOC\0"
+    "PM_RC0_BUSY\0"
+    "PM_RC_LIFETIME_EXC_1024\0"
+    "PM_RC_LIFETIME_EXC_2048\0"
+    "PM_RC_LIFETIME_EXC_256\0"
+    "PM_RC_LIFETIME_EXC_32\0"
+    "PM_RC_USAGE\0"
+    "PM_REAL_SRQ_FULL\0"
+    "PM_RUN_CYC\0"
+    "PMC5|PMC1\0"
+    "PM_RUN_CYC_SMT2_MODE\0"
+    "PM_RUN_CYC_SMT2_SHRD_MODE\0"
+    "PM_RUN_CYC_SMT2_SPLIT_MODE\0"
+    "PM_RUN_CYC_SMT4_MODE\0"
+    "PM_RUN_CYC_SMT8_MODE\0"
+    "PM_RUN_CYC_ST_MODE\0"
+    "PM_RUN_INST_CMPL\0"
+    "PMC4\0"
+    "PM_RUN_INST_CMPL_ALT\0"
+    "PM_RUN_PURR\0"
+    "PM_RUN_SPURR\0"
+    "PM_SEC_ERAT_HIT\0"
+    "PM_SHL_CREATED\0"
+    "PM_SHL_ST_CONVERT\0"
+    "PM_SHL_ST_DISABLE\0"
+    "PM_SN0_ALLOC\0"
+    "PM_SN0_BUSY\0"
+    "PM_SNOOP_TLBIE\0"
+    "PM_SN_USAGE\0"
+    "PM_STALL_END_GCT_EMPTY\0"
+    "PM_STCX_FAIL\0"
+    "PM_STCX_LSU\0"
+    "PM_ST_CMPL\0"
+    "PM_ST_FIN\0"
+    "PM_ST_FWD\0"
+    "PM_ST_MISS_L1\0"
+    "PM_SUSPENDED\0"
+    "PM_SWAP_CANCEL\0"
+    "PM_SWAP_CANCEL_GPR\0"
+    "PM_SWAP_COMPLETE\0"
+    "PM_SWAP_COMPLETE_GPR\0"
+    "PM_SYNC_MRK_BR_LINK\0"
+    "PM_SYNC_MRK_BR_MPRED\0"
+    "PM_SYNC_MRK_FX_DIVIDE\0"
+    "PM_SYNC_MRK_L2HIT\0"
+    "PM_SYNC_MRK_L2MISS\0"
+    "PM_SYNC_MRK_L3MISS\0"
+    "PM_SYNC_MRK_PROBE_NOP\0"
+    "PM_SYS_PUMP_CPRED\0"
+    "PM_SYS_PUMP_MPRED\0"
+    "PM_SYS_PUMP_MPRED_RTY\0"
+    "PM_TABLEWALK_CYC\0"
+    "PM_TABLEWALK_CYC_PREF\0"
+    "PM_TABORT_TRECLAIM\0"
+    "PM_TB_BIT_TRANS\0"
+    "PM_TEND_PEND_CYC\0"
+    "PM_THRD_ALL_RUN_CYC\0"
+    "PM_THRD_CONC_RUN_INST\0"
+    "PM_THRD_GRP_CMPL_BOTH_CYC\0"
+    "PM_THRD_PRIO_0_1_CYC\0"
+    "PM_THRD_PRIO_2_3_CYC\0"
+    "PM_THRD_PRIO_4_5_CYC\0"
+    "PM_THRD_PRIO_6_7_CYC\0"
+    "PM_THRD_REBAL_CYC\0"
+    "PM_THRESH_EXC_1024\0"
+    "PM_THRESH_EXC_128\0"
+    "PM_THRESH_EXC_2048\0"
+    "PM_THRESH_EXC_256\0"
+    "PM_THRESH_EXC_32\0"
+    "PM_THRESH_EXC_4096\0"
+    "PM_THRESH_EXC_512\0"
+    "PM_THRESH_EXC_64\0"
+    "PM_THRESH_MET\0"
+    "PM_THRESH_NOT_MET\0"
+    "PM_TLBIE_FIN\0"
+    "PM_TLB_MISS\0"
+    "PM_TM_BEGIN_ALL\0"
+    "PM_TM_END_ALL\0"
+    "PM_TM_FAIL_CONF_NON_TM\0"
+    "PM_TM_FAIL_CON_TM\0"
+    "PM_TM_FAIL_DISALLOW\0"
+    "PM_TM_FAIL_FOOTPRINT_OVERFLOW\0"
+    "PM_TM_FAIL_NON_TX_CONFLICT\0"
+    "PM_TM_FAIL_SELF\0"
+    "PM_TM_FAIL_TLBIE\0"
+    "PM_TM_FAIL_TX_CONFLICT\0"
+    "PM_TM_TBEGIN\0"
+    "PM_TM_TRANS_RUN_CYC\0"
+    "PM_TM_TRANS_RUN_INST\0"
+    "PM_TM_TRESUME\0"
+    "PM_TM_TSUSPEND\0"
+    "PM_TM_TX_PASS_RUN_CYC\0"
+    "PM_TM_TX_PASS_RUN_INST\0"
+    "PM_UP_PREF_L3\0"
+    "PM_UP_PREF_POINTER\0"
+    "PM_VSU0_16FLOP\0"
+    "PM_VSU0_1FLOP\0"
+    "PM_VSU0_2FLOP\0"
+    "PM_VSU0_4FLOP\0"
+    "PM_VSU0_8FLOP\0"
+    "PM_VSU0_COMPLEX_ISSUED\0"
+    "PM_VSU0_CY_ISSUED\0"
+    "PM_VSU0_DD_ISSUED\0"
+    "PM_VSU0_DP_2FLOP\0"
+    "PM_VSU0_DP_FMA\0"
+    "PM_VSU0_DP_FSQRT_FDIV\0"
+    "PM_VSU0_DQ_ISSUED\0"
+    "PM_VSU0_EX_ISSUED\0"
+    "PM_VSU0_FIN\0"
+    "PM_VSU0_FMA\0"
+    "PM_VSU0_FPSCR\0"
+    "PM_VSU0_FSQRT_FDIV\0"
+    "PM_VSU0_PERMUTE_ISSUED\0"
+    "PM_VSU0_SCALAR_DP_ISSUED\0"
+    "PM_VSU0_SIMPLE_ISSUED\0"
+    "PM_VSU0_SINGLE\0"
+    "PM_VSU0_SQ\0"
+    "PM_VSU0_STF\0"
+    "PM_VSU0_VECTOR_DP_ISSUED\0"
+    "PM_VSU0_VECTOR_SP_ISSUED\0"
+    "PM_VSU1_16FLOP\0"
+    "PM_VSU1_1FLOP\0"
+    "PM_VSU1_2FLOP\0"
+    "PM_VSU1_4FLOP\0"
+    "PM_VSU1_8FLOP\0"
+    "PM_VSU1_COMPLEX_ISSUED\0"
+    "PM_VSU1_CY_ISSUED\0"
+    "PM_VSU1_DD_ISSUED\0"
+    "PM_VSU1_DP_2FLOP\0"
+    "PM_VSU1_DP_FMA\0"
+    "PM_VSU1_DP_FSQRT_FDIV\0"
+    "PM_VSU1_DQ_ISSUED\0"
+    "PM_VSU1_EX_ISSUED\0"
+    "PM_VSU1_FIN\0"
+    "PM_VSU1_FMA\0"
+    "PM_VSU1_FPSCR\0"
+    "PM_VSU1_FSQRT_FDIV\0"
+    "PM_VSU1_PERMUTE_ISSUED\0"
+    "PM_VSU1_SCALAR_DP_ISSUED\0"
+    "PM_VSU1_SIMPLE_ISSUED\0"
+    "PM_VSU1_SINGLE\0"
+    "PM_VSU1_SQ\0"
+    "PM_VSU1_STF\0"
+    "PM_VSU1_VECTOR_DP_ISSUED\0"
+    "PM_VSU1_VECTOR_SP_ISSUED\0"
+    "PM_L3_L2_CO_HIT\0"
+    "PM_L3_L2_CO_MISS\0"
+    "PM_L2_CASTOUT_MOD\0"
+    "PM_L2_CASTOUT_SHR\0"
+    "PURR_STATE\0"
+    "PURR\0"
+    "SPURR_STATE\0"
+    "SPURR\0"
+    "PM_L3_P0_CO_MEM\0";
+
+static const PerfmonEventOption power8_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry power8_arch_event_entries[NUM_ARCH_EVENTS_POWER8] = {
+ {0, 13, 0, 0, 0x5E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18, 13, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {36, 54, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {59, 72, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77, 54, 0, 0, 0x5E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {90, 13, 0, 0, 0x50,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {113, 72, 0, 0, 0x50,0x00,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {135, 72, 0, 0, 0x52,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {157, 13, 0, 0, 0x52,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {183, 13, 0, 0, 0x54,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {201, 54, 0, 0, 0x52,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {219, 241, 0, 0, 0x50,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {246, 241, 0, 0, 0x52,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {268, 54, 0, 0, 0x50,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {294, 13, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {314, 72, 0, 0, 0x5E,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {330, 347, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {351, 13, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {362, 374, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {384, 347, 0, 0, 0x86,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {395, 347, 0, 0, 0x84,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {411, 54, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {422, 347, 0, 0, 0xAC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {441, 54, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {458, 347, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {473, 347, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {492, 347, 0, 0, 0xBA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {507, 13, 0, 0, 0x38,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {523, 347, 0, 0, 0x9C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {538, 347, 0, 0, 0x9E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 347, 0, 0, 0x9C,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {572, 347, 0, 0, 0xA4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {594, 347, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {616, 347, 0, 0, 0xA4,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {639, 347, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {657, 347, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {675, 347, 0, 0, 0xB0,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {694, 347, 0, 0, 0xA8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {716, 347, 0, 0, 0xAA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {738, 347, 0, 0, 0xA8,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {761, 347, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {779, 347, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {797, 347, 0, 0, 0xB4,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {816, 72, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {833, 347, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {850, 347, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {867, 347, 0, 0, 0xA0,0x04,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {885, 347, 0, 0, 0x94,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {903, 347, 0, 0, 0x96,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {925, 13, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {944, 347, 0, 0, 0x90,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {956, 54, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {971, 13, 0, 0, 0x54,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {990, 54, 0, 0, 0x18,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1009, 72, 0, 0, 0x18,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1032, 241, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1056, 72, 0, 0, 0x12,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1083, 72, 0, 0, 0x18,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1112, 72, 0, 0, 0x16,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1138, 54, 0, 0, 0x16,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1173, 54, 0, 0, 0x1A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1201, 54, 0, 0, 0x18,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1227, 72, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1255, 54, 0, 0, 0x12,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1280, 241, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1301, 54, 0, 0, 0x16,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1323, 72, 0, 0, 0x16,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1342, 241, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1364, 54, 0, 0, 0x14,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1391, 72, 0, 0, 0x10,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1410, 13, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1432, 241, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1461, 72, 0, 0, 0x1C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1483, 72, 0, 0, 0x1E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1509, 241, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1535, 54, 0, 0, 0x10,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1557, 72, 0, 0, 0x1A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1583, 54, 0, 0, 0x14,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1611, 54, 0, 0, 0x10,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1633, 72, 0, 0, 0x10,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1660, 72, 0, 0, 0x14,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1681, 54, 0, 0, 0x1C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1703, 13, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1723, 72, 0, 0, 0x14,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1745, 54, 0, 0, 0x12,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1772, 72, 0, 0, 0x12,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {1791, 13, 0, 0, 0x83,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {1804, 13, 0, 0, 0x82,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {1816, 13, 0, 0, 0x82,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {1832, 241, 0, 0, 0x8A,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {1844, 241, 0, 0, 0x8A,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {1860, 54, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1871, 347, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1878, 13, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1889, 13, 0, 0, 0x50,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {1917, 54, 0, 0, 0x48,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {1944, 241, 0, 0, 0x48,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {1971, 241, 0, 0, 0x4C,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {1992, 54, 0, 0, 0x4C,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2014, 13, 0, 0, 0x42,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2034, 54, 0, 0, 0x46,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2059, 241, 0, 0, 0x46,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2084, 13, 0, 0, 0x4E,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2112, 241, 0, 0, 0x40,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2154, 54, 0, 0, 0x40,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2194, 72, 0, 0, 0x40,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2219, 13, 0, 0, 0x40,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2251, 54, 0, 0, 0x42,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2271, 54, 0, 0, 0x44,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2300, 241, 0, 0, 0x44,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2329, 72, 0, 0, 0x44,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2354, 13, 0, 0, 0x46,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2379, 54, 0, 0, 0x4E,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2407, 241, 0, 0, 0x42,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2441, 72, 0, 0, 0x42,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2466, 13, 0, 0, 0x44,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2498, 13, 0, 0, 0x4C,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2519, 72, 0, 0, 0x48,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2541, 72, 0, 0, 0x4C,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2565, 54, 0, 0, 0x4A,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2597, 13, 0, 0, 0x48,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2628, 72, 0, 0, 0x46,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2655, 13, 0, 0, 0x4A,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2682, 72, 0, 0, 0x4A,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2703, 241, 0, 0, 0x4A,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2725, 72, 0, 0, 0x50,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2752, 72, 0, 0, 0x52,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2779, 13, 0, 0, 0x52,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2810, 13, 0, 0, 0x54,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2833, 54, 0, 0, 0x52,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2856, 241, 0, 0, 0x50,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2883, 241, 0, 0, 0x52,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2910, 54, 0, 0, 0x50,0x0C,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {2941, 13, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {2965, 54, 0, 0, 0x48,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {2988, 241, 0, 0, 0x48,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3011, 241, 0, 0, 0x4C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3028, 54, 0, 0, 0x4C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3046, 13, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3062, 54, 0, 0, 0x46,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3083, 241, 0, 0, 0x46,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3104, 72, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3124, 13, 0, 0, 0x4E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3148, 241, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3186, 54, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3222, 72, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3243, 13, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3271, 54, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3287, 54, 0, 0, 0x44,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3312, 241, 0, 0, 0x44,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3337, 72, 0, 0, 0x44,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3358, 13, 0, 0, 0x46,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3379, 241, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3399, 54, 0, 0, 0x4E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3423, 241, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3453, 72, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3474, 13, 0, 0, 0x44,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3502, 13, 0, 0, 0x4C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3519, 72, 0, 0, 0x48,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3537, 54, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3554, 72, 0, 0, 0x4C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3574, 54, 0, 0, 0x4A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3602, 13, 0, 0, 0x48,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3629, 72, 0, 0, 0x46,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3652, 13, 0, 0, 0x4A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3675, 72, 0, 0, 0x4A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3692, 241, 0, 0, 0x4A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3710, 72, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3733, 72, 0, 0, 0x52,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3756, 13, 0, 0, 0x52,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3783, 13, 0, 0, 0x54,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3802, 54, 0, 0, 0x52,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3821, 241, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3844, 241, 0, 0, 0x52,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3867, 54, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {3894, 241, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3916, 347, 0, 0, 0xBC,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {3933, 13, 0, 0, 0x50,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {3957, 72, 0, 0, 0x50,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {3980, 54, 0, 0, 0x50,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4009, 241, 0, 0, 0x50,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4040, 54, 0, 0, 0x54,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {4058, 241, 0, 0, 0x54,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {4076, 13, 0, 0, 0x56,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {4093, 72, 0, 0, 0x54,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {4111, 347, 0, 0, 0xBA,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {4118, 347, 0, 0, 0xBE,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {4132, 347, 0, 0, 0xBC,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {4146, 347, 0, 0, 0xB8,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {4156, 347, 0, 0, 0x92,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4177, 347, 0, 0, 0x94,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4198, 347, 0, 0, 0xA8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4218, 347, 0, 0, 0x98,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4240, 347, 0, 0, 0x96,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4263, 13, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4276, 72, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4297, 13, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4319, 241, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4341, 54, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4364, 347, 0, 0, 0xA6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4386, 241, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4397, 54, 0, 0, 0x48,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4421, 241, 0, 0, 0x48,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4445, 241, 0, 0, 0x4C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4463, 54, 0, 0, 0x4C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4482, 13, 0, 0, 0x42,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4499, 54, 0, 0, 0x46,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4521, 241, 0, 0, 0x46,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4543, 13, 0, 0, 0x4E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4564, 241, 0, 0, 0x40,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4603, 54, 0, 0, 0x40,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4640, 72, 0, 0, 0x40,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4662, 13, 0, 0, 0x40,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4691, 54, 0, 0, 0x42,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4708, 54, 0, 0, 0x44,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4734, 241, 0, 0, 0x44,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4760, 72, 0, 0, 0x44,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4782, 13, 0, 0, 0x46,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4804, 54, 0, 0, 0x4E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4825, 241, 0, 0, 0x42,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4856, 72, 0, 0, 0x42,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4878, 13, 0, 0, 0x44,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4907, 13, 0, 0, 0x4C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4925, 72, 0, 0, 0x48,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4944, 72, 0, 0, 0x4C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4965, 54, 0, 0, 0x4A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4994, 13, 0, 0, 0x48,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {5022, 72, 0, 0, 0x46,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {5046, 13, 0, 0, 0x4A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {5070, 72, 0, 0, 0x4A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {5088, 241, 0, 0, 0x4A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {5107, 347, 0, 0, 0x94,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {5120, 13, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5137, 241, 0, 0, 0xFC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5150, 13, 0, 0, 0x58,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5167, 54, 0, 0, 0x56,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5184, 72, 0, 0, 0x56,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5200, 241, 0, 0, 0x56,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5217, 347, 0, 0, 0xA8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5238, 347, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5254, 347, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5272, 72, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5283, 347, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5297, 13, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5305, 347, 0, 0, 0xAE,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5324, 347, 0, 0, 0xAC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5340, 54, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5349, 347, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5367, 241, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5387, 347, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5401, 347, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5418, 347, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5437, 347, 0, 0, 0x8A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5457, 347, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5470, 347, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5487, 347, 0, 0, 0xB0,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5501, 347, 0, 0, 0xB8,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5514, 347, 0, 0, 0xB4,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5527, 347, 0, 0, 0xB2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5541, 347, 0, 0, 0xBA,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5554, 347, 0, 0, 0xB6,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {5567, 241, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5580, 54, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5591, 347, 0, 0, 0xB0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5612, 347, 0, 0, 0xAE,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5633, 347, 0, 0, 0xAC,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5654, 347, 0, 0, 0xB2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5675, 347, 0, 0, 0xB8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5696, 347, 0, 0, 0xB6,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5717, 347, 0, 0, 0xB4,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5738, 347, 0, 0, 0xBA,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {5759, 241, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5782, 13, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5794, 54, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5817, 54, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5829, 72, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5841, 13, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5853, 72, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5870, 347, 0, 0, 0xA4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5883, 54, 0, 0, 0x1E,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {5906, 54, 0, 0, 0x1A,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {5936, 13, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5954, 72, 0, 0, 0x1E,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {5983, 54, 0, 0, 0x1C,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {6011, 72, 0, 0, 0x10,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6041, 72, 0, 0, 0x1C,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {6069, 54, 0, 0, 0x10,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6093, 72, 0, 0, 0x1A,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {6115, 347, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6141, 347, 0, 0, 0xA4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6167, 347, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6190, 347, 0, 0, 0x9C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6214, 347, 0, 0, 0x9E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6238, 347, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6263, 13, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6287, 241, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6299, 241, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6311, 13, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6334, 13, 0, 0, 0x30,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {6345, 347, 0, 0, 0x9C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6367, 72, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6385, 72, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6403, 13, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6425, 347, 0, 0, 0xA4,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6448, 347, 0, 0, 0xA6,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6473, 347, 0, 0, 0x9E,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6492, 347, 0, 0, 0xA0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6510, 347, 0, 0, 0xA2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6533, 72, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6543, 347, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6560, 13, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6577, 347, 0, 0, 0x98,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6606, 347, 0, 0, 0x9A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6634, 347, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6651, 347, 0, 0, 0x8A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6668, 347, 0, 0, 0x92,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6690, 347, 0, 0, 0x94,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6711, 347, 0, 0, 0x90,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6734, 347, 0, 0, 0x8A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6749, 347, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6766, 347, 0, 0, 0x96,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6787, 13, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6803, 54, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6823, 72, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6842, 241, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6862, 241, 0, 0, 0x5E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6881, 347, 0, 0, 0x88,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {6897, 13, 0, 0, 0x50,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {6925, 54, 0, 0, 0x48,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {6952, 241, 0, 0, 0x48,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {6979, 241, 0, 0, 0x4C,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7000, 54, 0, 0, 0x4C,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7022, 13, 0, 0, 0x42,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7042, 54, 0, 0, 0x46,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7067, 241, 0, 0, 0x46,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7092, 13, 0, 0, 0x4E,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7116, 241, 0, 0, 0x40,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7158, 54, 0, 0, 0x40,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7198, 72, 0, 0, 0x40,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7223, 13, 0, 0, 0x40,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7255, 54, 0, 0, 0x42,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7275, 54, 0, 0, 0x44,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7304, 241, 0, 0, 0x44,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7333, 72, 0, 0, 0x44,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7358, 13, 0, 0, 0x46,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7383, 54, 0, 0, 0x4E,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7411, 241, 0, 0, 0x42,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7445, 72, 0, 0, 0x42,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7470, 13, 0, 0, 0x44,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7502, 13, 0, 0, 0x4C,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7523, 72, 0, 0, 0x48,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7545, 72, 0, 0, 0x4C,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7569, 54, 0, 0, 0x4A,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7601, 13, 0, 0, 0x48,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7632, 72, 0, 0, 0x46,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7659, 13, 0, 0, 0x4A,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7686, 72, 0, 0, 0x4A,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7707, 241, 0, 0, 0x4A,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7729, 72, 0, 0, 0x50,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7756, 72, 0, 0, 0x52,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7783, 13, 0, 0, 0x52,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7814, 13, 0, 0, 0x54,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7837, 54, 0, 0, 0x52,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7860, 241, 0, 0, 0x50,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7887, 241, 0, 0, 0x52,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7914, 54, 0, 0, 0x50,0x04,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {7945, 13, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7969, 347, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7982, 7995, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8005, 54, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8028, 241, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8051, 241, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8068, 54, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8086, 347, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8102, 13, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8118, 54, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8139, 241, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8160, 13, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8180, 241, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8218, 54, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8254, 72, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8275, 13, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8303, 54, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8319, 54, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8344, 241, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8369, 72, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8390, 13, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8411, 241, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8431, 54, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8455, 241, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8485, 72, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8506, 13, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8534, 13, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8551, 72, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8569, 72, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8589, 54, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8617, 13, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8644, 72, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8667, 13, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8690, 72, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8707, 241, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8725, 72, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8748, 72, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8771, 13, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8798, 13, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8821, 241, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8844, 13, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8863, 54, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8882, 241, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8905, 241, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8928, 54, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8955, 13, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8968, 241, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8981, 54, 0, 0, 0x48,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9005, 241, 0, 0, 0x48,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9029, 241, 0, 0, 0x4C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9047, 54, 0, 0, 0x4C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9066, 13, 0, 0, 0x42,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9083, 54, 0, 0, 0x46,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9105, 241, 0, 0, 0x46,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9127, 13, 0, 0, 0x4E,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9148, 241, 0, 0, 0x40,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9187, 54, 0, 0, 0x40,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9224, 72, 0, 0, 0x40,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9246, 13, 0, 0, 0x40,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9275, 54, 0, 0, 0x42,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9292, 54, 0, 0, 0x44,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9318, 241, 0, 0, 0x44,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9344, 72, 0, 0, 0x44,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9366, 13, 0, 0, 0x46,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9388, 54, 0, 0, 0x4E,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9409, 241, 0, 0, 0x42,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9440, 72, 0, 0, 0x42,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9462, 13, 0, 0, 0x44,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9491, 13, 0, 0, 0x4C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9509, 72, 0, 0, 0x48,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9528, 72, 0, 0, 0x4C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9549, 54, 0, 0, 0x4A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9578, 13, 0, 0, 0x48,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9606, 72, 0, 0, 0x46,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9630, 13, 0, 0, 0x4A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9654, 72, 0, 0, 0x4A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9672, 241, 0, 0, 0x4A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9691, 54, 0, 0, 0x8E,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {9709, 54, 0, 0, 0x8E,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {9731, 347, 0, 0, 0x96,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {9744, 54, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {9761, 347, 0, 0, 0xAC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9776, 347, 0, 0, 0xAE,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9791, 347, 0, 0, 0xAC,0x03,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {9806, 347, 0, 0, 0xB0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9821, 347, 0, 0, 0xB2,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9836, 347, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9851, 347, 0, 0, 0xB6,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9866, 347, 0, 0, 0x9C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9885, 347, 0, 0, 0xA2,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9906, 347, 0, 0, 0x9E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9931, 347, 0, 0, 0xA0,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9952, 347, 0, 0, 0xA8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9967, 347, 0, 0, 0xAA,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {9982, 347, 0, 0, 0xA8,0x03,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {9997, 347, 0, 0, 0xB8,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {10006, 54, 0, 0, 0xFC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10019, 241, 0, 0, 0xEA,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {10042, 54, 0, 0, 0xEC,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {10065, 13, 0, 0, 0xE8,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {10087, 72, 0, 0, 0xE6,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {10108, 72, 0, 0, 0x86,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {10125, 72, 0, 0, 0x86,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {10146, 13, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10172, 241, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10198, 347, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10217, 72, 0, 0, 0xFD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10235, 54, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10261, 241, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10288, 72, 0, 0, 0x84,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10304, 54, 0, 0, 0x8C,0x06,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {10324, 72, 0, 0, 0x86,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10341, 54, 0, 0, 0x8E,0x06,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {10362, 241, 0, 0, 0x8A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10375, 54, 0, 0, 0x8C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10392, 54, 0, 0, 0x8C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10405, 241, 0, 0, 0x8A,0x07,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {10422, 13, 0, 0, 0x80,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10431, 13, 0, 0, 0x82,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10444, 54, 0, 0, 0x8C,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10458, 54, 0, 0, 0x8E,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10471, 13, 0, 0, 0x82,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10485, 72, 0, 0, 0x86,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10503, 13, 0, 0, 0x80,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10512, 241, 0, 0, 0x88,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10526, 241, 0, 0, 0x8A,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10539, 72, 0, 0, 0x84,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10553, 13, 0, 0, 0x5E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {10572, 241, 0, 0, 0x5C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {10597, 241, 0, 0, 0x88,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10612, 241, 0, 0, 0x80,0x07,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {10631, 13, 0, 0, 0x82,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10646, 241, 0, 0, 0x8B,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10662, 241, 0, 0, 0x8A,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10677, 72, 0, 0, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10690, 72, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10703, 13, 0, 0, 0x82,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10717, 241, 0, 0, 0x5E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {10735, 13, 0, 0, 0x52,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {10749, 54, 0, 0, 0x8D,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10765, 54, 0, 0, 0x8C,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10780, 13, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10797, 241, 0, 0, 0x8A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10821, 54, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10843, 241, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10866, 54, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10887, 72, 0, 0, 0x84,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10902, 54, 0, 0, 0x52,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {10917, 54, 0, 0, 0x8F,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10933, 54, 0, 0, 0x8E,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10948, 72, 0, 0, 0x86,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10963, 241, 0, 0, 0x89,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10979, 241, 0, 0, 0x88,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {10994, 13, 0, 0, 0x80,0x09,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11009, 72, 0, 0, 0x52,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11023, 241, 0, 0, 0x52,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11037, 13, 0, 0, 0x81,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11053, 241, 0, 0, 0x58,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11065, 13, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11076, 13, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11098, 241, 0, 0, 0x54,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11112, 54, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11130, 13, 0, 0, 0xEE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11143, 347, 0, 0, 0x80,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11161, 347, 0, 0, 0x82,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11179, 347, 0, 0, 0x94,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11197, 347, 0, 0, 0x96,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11215, 347, 0, 0, 0x9A,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {11241, 347, 0, 0, 0x98,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {11270, 347, 0, 0, 0x80,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11292, 347, 0, 0, 0xB8,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {11307, 347, 0, 0, 0x98,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11325, 347, 0, 0, 0x82,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11347, 347, 0, 0, 0xBA,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {11362, 347, 0, 0, 0x9A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11380, 347, 0, 0, 0xB0,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11398, 347, 0, 0, 0xB8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11416, 347, 0, 0, 0xA4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11434, 347, 0, 0, 0xAC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11452, 347, 0, 0, 0x88,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11474, 13, 0, 0, 0x56,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11491, 347, 0, 0, 0x8C,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {11513, 347, 0, 0, 0x8C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11526, 347, 0, 0, 0x90,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11551, 13, 0, 0, 0x5A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11566, 347, 0, 0, 0x9C,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11584, 347, 0, 0, 0x84,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11605, 347, 0, 0, 0xA8,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11624, 347, 0, 0, 0x98,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11642, 347, 0, 0, 0xA0,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11661, 347, 0, 0, 0xB2,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11679, 347, 0, 0, 0xBA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11697, 347, 0, 0, 0xA6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11715, 347, 0, 0, 0xAE,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11733, 347, 0, 0, 0x8A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11755, 72, 0, 0, 0x56,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11772, 347, 0, 0, 0x8E,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {11794, 347, 0, 0, 0x8E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11807, 347, 0, 0, 0x92,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11832, 72, 0, 0, 0x5A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11847, 347, 0, 0, 0x9E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11865, 347, 0, 0, 0x86,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11886, 347, 0, 0, 0xAA,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11905, 347, 0, 0, 0x9A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11923, 347, 0, 0, 0xA2,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {11942, 347, 0, 0, 0xB4,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11960, 347, 0, 0, 0xBC,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11978, 347, 0, 0, 0xA8,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {11996, 347, 0, 0, 0x8C,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12018, 241, 0, 0, 0x56,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12035, 347, 0, 0, 0x84,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12047, 347, 0, 0, 0x88,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12059, 347, 0, 0, 0x90,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12081, 347, 0, 0, 0x94,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12106, 241, 0, 0, 0x5A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12121, 347, 0, 0, 0xA0,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12139, 347, 0, 0, 0xAC,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12158, 347, 0, 0, 0x9C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12176, 347, 0, 0, 0xA4,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12195, 347, 0, 0, 0xB6,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12213, 347, 0, 0, 0xBE,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12231, 347, 0, 0, 0xAA,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12249, 347, 0, 0, 0x8E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12271, 54, 0, 0, 0x56,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12288, 347, 0, 0, 0x86,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12300, 347, 0, 0, 0x8A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12312, 347, 0, 0, 0x92,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12334, 347, 0, 0, 0x96,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12359, 54, 0, 0, 0x5A,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12374, 347, 0, 0, 0xA2,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12392, 347, 0, 0, 0xAE,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12411, 347, 0, 0, 0x9E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12429, 347, 0, 0, 0xA6,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12448, 72, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12466, 347, 0, 0, 0x80,0x0E,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12488, 241, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12499, 347, 0, 0, 0xAC,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12516, 347, 0, 0, 0xA4,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12542, 13, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12556, 347, 0, 0, 0xB8,0x0D,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12571, 347, 0, 0, 0x98,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12589, 347, 0, 0, 0x84,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12600, 347, 0, 0, 0x88,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12611, 347, 0, 0, 0xA2,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12631, 347, 0, 0, 0xA1,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12651, 347, 0, 0, 0xA0,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12671, 241, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12700, 72, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12725, 347, 0, 0, 0x9F,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12745, 347, 0, 0, 0x9E,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12765, 347, 0, 0, 0x91,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12786, 347, 0, 0, 0x90,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {12807, 241, 0, 0, 0x62,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {12829, 347, 0, 0, 0x8C,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {12841, 347, 0, 0, 0x92,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {12853, 13, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12867, 72, 0, 0, 0x5C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12891, 54, 0, 0, 0x5C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12909, 13, 0, 0, 0x5C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {12932, 347, 0, 0, 0x82,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {12949, 54, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12970, 13, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12990, 347, 0, 0, 0x9D,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13010, 347, 0, 0, 0x9C,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13030, 347, 0, 0, 0x93,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13051, 347, 0, 0, 0x92,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13072, 347, 0, 0, 0x9B,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13088, 347, 0, 0, 0x9A,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13108, 347, 0, 0, 0x84,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13128, 347, 0, 0, 0xA6,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13153, 347, 0, 0, 0x94,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {13163, 347, 0, 0, 0x98,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {13177, 347, 0, 0, 0x9A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13192, 54, 0, 0, 0x58,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13202, 13, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13224, 54, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13251, 13, 0, 0, 0x5E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13277, 72, 0, 0, 0x58,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13289, 13, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13301, 241, 0, 0, 0x5E,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13314, 241, 0, 0, 0x5E,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13334, 72, 0, 0, 0x3A,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13349, 13, 0, 0, 0x6E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13364, 241, 0, 0, 0xE4,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13385, 13, 0, 0, 0xE2,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13406, 241, 0, 0, 0x3A,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13421, 54, 0, 0, 0x48,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13448, 72, 0, 0, 0x28,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13479, 241, 0, 0, 0x48,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13506, 72, 0, 0, 0x28,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13537, 241, 0, 0, 0x4C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13558, 72, 0, 0, 0x2C,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13583, 54, 0, 0, 0x4C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13605, 72, 0, 0, 0x2C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13631, 13, 0, 0, 0x42,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13651, 54, 0, 0, 0x46,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13676, 72, 0, 0, 0x26,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13705, 241, 0, 0, 0x46,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13730, 72, 0, 0, 0x26,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13759, 13, 0, 0, 0x4E,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13783, 54, 0, 0, 0xE8,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13811, 54, 0, 0, 0x2E,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13839, 54, 0, 0, 0x22,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13863, 241, 0, 0, 0x40,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13905, 72, 0, 0, 0x20,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13951, 54, 0, 0, 0x40,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {13991, 72, 0, 0, 0x20,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14035, 72, 0, 0, 0x40,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14060, 54, 0, 0, 0x20,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14089, 13, 0, 0, 0x40,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14121, 54, 0, 0, 0x20,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14157, 54, 0, 0, 0x42,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14177, 54, 0, 0, 0x44,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14206, 72, 0, 0, 0x24,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14239, 241, 0, 0, 0x44,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14268, 72, 0, 0, 0x24,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14301, 72, 0, 0, 0x44,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14326, 54, 0, 0, 0x24,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14355, 13, 0, 0, 0x46,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14380, 54, 0, 0, 0x26,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14409, 72, 0, 0, 0xE4,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14433, 54, 0, 0, 0x4E,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14461, 72, 0, 0, 0x2E,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14489, 72, 0, 0, 0x22,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14513, 241, 0, 0, 0x42,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14547, 72, 0, 0, 0x22,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14585, 72, 0, 0, 0x42,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14610, 54, 0, 0, 0x22,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14639, 13, 0, 0, 0x44,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14671, 54, 0, 0, 0x24,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14707, 13, 0, 0, 0x4C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14728, 54, 0, 0, 0x2C,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14753, 72, 0, 0, 0x48,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14775, 54, 0, 0, 0x28,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14801, 72, 0, 0, 0xE0,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14822, 72, 0, 0, 0x4C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14846, 54, 0, 0, 0x2C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14874, 54, 0, 0, 0x4A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14906, 72, 0, 0, 0x2A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14942, 13, 0, 0, 0x48,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {14973, 54, 0, 0, 0x28,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15008, 72, 0, 0, 0x46,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15035, 54, 0, 0, 0x26,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15066, 13, 0, 0, 0x4A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15093, 54, 0, 0, 0x2A,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15124, 72, 0, 0, 0x4A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15145, 54, 0, 0, 0x2A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15170, 241, 0, 0, 0x4A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15192, 72, 0, 0, 0x2A,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15218, 54, 0, 0, 0x18,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15244, 241, 0, 0, 0xE6,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15262, 54, 0, 0, 0x54,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15284, 241, 0, 0, 0x54,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15306, 13, 0, 0, 0x56,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15327, 72, 0, 0, 0x54,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15349, 72, 0, 0, 0x32,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15364, 54, 0, 0, 0x48,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15392, 241, 0, 0, 0x48,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15420, 241, 0, 0, 0x4C,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15442, 54, 0, 0, 0x4C,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15465, 13, 0, 0, 0x42,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15486, 54, 0, 0, 0x46,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15512, 241, 0, 0, 0x46,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15538, 13, 0, 0, 0x4E,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15563, 241, 0, 0, 0x40,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15606, 54, 0, 0, 0x40,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15647, 72, 0, 0, 0x40,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15673, 13, 0, 0, 0x40,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15706, 54, 0, 0, 0x42,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15727, 54, 0, 0, 0x44,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15757, 241, 0, 0, 0x44,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15787, 72, 0, 0, 0x44,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15813, 13, 0, 0, 0x46,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15839, 54, 0, 0, 0x4E,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15864, 241, 0, 0, 0x42,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15899, 72, 0, 0, 0x42,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15925, 13, 0, 0, 0x44,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15958, 13, 0, 0, 0x4C,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {15980, 72, 0, 0, 0x48,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16003, 72, 0, 0, 0x4C,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16028, 54, 0, 0, 0x4A,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16061, 13, 0, 0, 0x48,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16093, 72, 0, 0, 0x46,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16121, 13, 0, 0, 0x4A,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16149, 72, 0, 0, 0x4A,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16171, 241, 0, 0, 0x4A,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16194, 54, 0, 0, 0xE4,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16211, 13, 0, 0, 0x58,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16232, 54, 0, 0, 0x56,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16253, 72, 0, 0, 0x56,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16273, 241, 0, 0, 0x56,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16294, 54, 0, 0, 0x54,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16315, 72, 0, 0, 0x50,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16340, 241, 0, 0, 0x5E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16365, 241, 0, 0, 0x54,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16387, 72, 0, 0, 0x52,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16413, 241, 0, 0, 0x56,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16434, 54, 0, 0, 0x52,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16459, 54, 0, 0, 0x5E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16481, 13, 0, 0, 0x5E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16506, 54, 0, 0, 0x50,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16531, 72, 0, 0, 0x5E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16556, 72, 0, 0, 0x3C,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16574, 13, 0, 0, 0x3C,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16595, 72, 0, 0, 0x34,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16610, 54, 0, 0, 0x30,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16626, 54, 0, 0, 0x3A,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16645, 241, 0, 0, 0x3C,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16660, 54, 0, 0, 0xE0,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16677, 72, 0, 0, 0x30,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16697, 13, 0, 0, 0xE0,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16714, 241, 0, 0, 0x30,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16730, 54, 0, 0, 0xE6,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16754, 13, 0, 0, 0x32,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16773, 54, 0, 0, 0x34,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16791, 13, 0, 0, 0xE4,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16813, 13, 0, 0, 0xEA,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16836, 72, 0, 0, 0x14,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16854, 241, 0, 0, 0x2A,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16872, 54, 0, 0, 0x16,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16888, 13, 0, 0, 0x3F,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16911, 13, 0, 0, 0x3E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16938, 72, 0, 0, 0xE2,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16956, 54, 0, 0, 0x3E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16978, 54, 0, 0, 0x32,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {16993, 347, 0, 0, 0x80,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17010, 347, 0, 0, 0x88,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17031, 347, 0, 0, 0x8A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17052, 347, 0, 0, 0x84,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17073, 347, 0, 0, 0x86,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17094, 54, 0, 0, 0x64,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17112, 241, 0, 0, 0x64,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17140, 72, 0, 0, 0x12,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17155, 13, 0, 0, 0x5E,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17170, 13, 0, 0, 0x5A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17196, 241, 0, 0, 0x5A,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17224, 54, 0, 0, 0x5C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17250, 13, 0, 0, 0x5C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17279, 241, 0, 0, 0x5C,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17308, 241, 0, 0, 0x3E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17331, 241, 0, 0, 0x58,0x0E,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17348, 13, 0, 0, 0x34,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17363, 241, 0, 0, 0x34,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17382, 241, 0, 0, 0x50,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17412, 241, 0, 0, 0x2C,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17426, 13, 0, 0, 0x50,0x0F,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17455, 72, 0, 0, 0x38,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17470, 13, 0, 0, 0x5A,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17496, 241, 0, 0, 0x5A,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17524, 54, 0, 0, 0x5C,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17550, 13, 0, 0, 0x5C,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17579, 241, 0, 0, 0x5C,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17608, 241, 0, 0, 0x32,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17623, 241, 0, 0, 0x5E,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {17635, 347, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17650, 241, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17666, 347, 0, 0, 0xB6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17684, 72, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17700, 347, 0, 0, 0xAC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17716, 347, 0, 0, 0xAE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17730, 72, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17747, 241, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17764, 241, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17779, 13, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17793, 54, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17810, 13, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17827, 13, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17842, 241, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17856, 13, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17873, 241, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17890, 72, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17906, 13, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17924, 241, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17944, 54, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17962, 13, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17983, 241, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18004, 54, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18022, 347, 0, 0, 0x84,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {18038, 13, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18052, 54, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18066, 13, 0, 0, 0x81,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18079, 13, 0, 0, 0x80,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18091, 241, 0, 0, 0xEA,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {18115, 54, 0, 0, 0xEC,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {18139, 13, 0, 0, 0xE8,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {18162, 72, 0, 0, 0xE6,0x00,0x60,0x01,EVENT_OPTION_NONE_MASK}
+, {18184, 241, 0, 0, 0x88,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18196, 72, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18213, 18224, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18234, 241, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18255, 72, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18281, 13, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18308, 72, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18329, 54, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18350, 13, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18369, 18386, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18391, 54, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18412, 54, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18424, 13, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18437, 347, 0, 0, 0x82,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18453, 347, 0, 0, 0x8C,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {18468, 347, 0, 0, 0x8E,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {18486, 347, 0, 0, 0x90,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {18504, 72, 0, 0, 0x85,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18517, 72, 0, 0, 0x84,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18529, 347, 0, 0, 0xB2,0x0D,0,0,EVENT_OPTION_NONE_MASK}
+, {18544, 54, 0, 0, 0x8C,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {18556, 13, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18579, 13, 0, 0, 0x58,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {18592, 347, 0, 0, 0x90,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {18604, 72, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18615, 72, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18625, 72, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18635, 241, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18649, 347, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18662, 347, 0, 0, 0x90,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18677, 347, 0, 0, 0x92,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18696, 347, 0, 0, 0x8C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18713, 347, 0, 0, 0x8E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {18734, 13, 0, 0, 0x52,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18754, 13, 0, 0, 0x5C,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18775, 13, 0, 0, 0x56,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18797, 13, 0, 0, 0x58,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18815, 13, 0, 0, 0x5A,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18834, 13, 0, 0, 0x54,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18853, 13, 0, 0, 0x50,0x05,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {18875, 241, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18893, 241, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18911, 54, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18933, 13, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18950, 347, 0, 0, 0x86,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {18972, 347, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18991, 241, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19007, 347, 0, 0, 0xBA,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19024, 72, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19044, 241, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19066, 13, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19092, 347, 0, 0, 0xBC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19113, 347, 0, 0, 0xBE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19134, 347, 0, 0, 0x80,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {19155, 347, 0, 0, 0x82,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {19176, 347, 0, 0, 0x98,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19194, 241, 0, 0, 0xEA,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19213, 54, 0, 0, 0xEA,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19231, 54, 0, 0, 0xEC,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19250, 13, 0, 0, 0xE8,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19268, 72, 0, 0, 0xE6,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19285, 13, 0, 0, 0xE6,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19304, 72, 0, 0, 0xE8,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19322, 241, 0, 0, 0xE8,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19339, 13, 0, 0, 0xEC,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19353, 54, 0, 0, 0x6E,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {19371, 241, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19384, 72, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19396, 347, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19412, 347, 0, 0, 0xBA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19426, 347, 0, 0, 0x86,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19449, 347, 0, 0, 0x88,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19467, 347, 0, 0, 0xB2,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19487, 347, 0, 0, 0x84,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19517, 347, 0, 0, 0xB8,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19544, 347, 0, 0, 0x8A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19560, 347, 0, 0, 0xB4,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19577, 347, 0, 0, 0xB6,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19600, 347, 0, 0, 0xBC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19613, 13, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19633, 241, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19654, 347, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {19668, 347, 0, 0, 0xBE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19683, 72, 0, 0, 0x12,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19705, 54, 0, 0, 0x14,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19728, 347, 0, 0, 0x8C,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19742, 347, 0, 0, 0x8E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {19761, 347, 0, 0, 0xA4,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19776, 347, 0, 0, 0x80,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19790, 347, 0, 0, 0x98,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19804, 347, 0, 0, 0x9C,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19818, 347, 0, 0, 0xA0,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19832, 347, 0, 0, 0xA4,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {19855, 347, 0, 0, 0xB4,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {19873, 347, 0, 0, 0xA8,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {19891, 347, 0, 0, 0x8C,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19908, 347, 0, 0, 0x90,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19923, 347, 0, 0, 0x94,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19945, 347, 0, 0, 0xAC,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {19963, 347, 0, 0, 0xB0,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {19981, 347, 0, 0, 0xBC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {19993, 347, 0, 0, 0x84,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20005, 347, 0, 0, 0x98,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20019, 347, 0, 0, 0x88,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20038, 347, 0, 0, 0x90,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20061, 347, 0, 0, 0x88,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20086, 347, 0, 0, 0x94,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20108, 347, 0, 0, 0xA8,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20123, 347, 0, 0, 0x9C,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20134, 347, 0, 0, 0x8C,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20146, 347, 0, 0, 0x80,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20171, 347, 0, 0, 0x84,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20196, 347, 0, 0, 0xA6,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20211, 347, 0, 0, 0x82,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20225, 347, 0, 0, 0x9A,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20239, 347, 0, 0, 0x9E,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20253, 347, 0, 0, 0xA2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20267, 347, 0, 0, 0xA6,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20290, 347, 0, 0, 0xB6,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20308, 347, 0, 0, 0xAA,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20326, 347, 0, 0, 0x8E,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20343, 347, 0, 0, 0x92,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20358, 347, 0, 0, 0x96,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20380, 347, 0, 0, 0xAE,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20398, 347, 0, 0, 0xB2,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20416, 347, 0, 0, 0xBE,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20428, 347, 0, 0, 0x86,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20440, 347, 0, 0, 0x9A,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20454, 347, 0, 0, 0x8A,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20473, 347, 0, 0, 0x92,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20496, 347, 0, 0, 0x8A,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20521, 347, 0, 0, 0x96,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20543, 347, 0, 0, 0xAA,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {20558, 347, 0, 0, 0x9E,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20569, 347, 0, 0, 0x8E,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20581, 347, 0, 0, 0x82,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20606, 347, 0, 0, 0x86,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {20631, 241, 0, 0, 0x88,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {20647, 241, 0, 0, 0x8A,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {20664, 13, 0, 0, 0x80,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {20682, 13, 0, 0, 0x82,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {20700, 20711, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20716, 20728, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20734, 241, 0, 0, 0x88,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable power8_arch_events = {
+    NUM_ARCH_EVENTS_POWER8,
+    power8_arch_event_strings,
+    power8_arch_event_options,
+    power8_arch_event_entries
+};
@@ -0,0 +1,1669 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_POWER9 818
+
+static const char power9_arch_event_strings[] =
+    "PM_RUN_CYC\0"
+    "PMC5\0"
+    "PM_RUN_INST_CMPL\0"
+    "PMC3|PMC4\0"
+    "PM_IC_DEMAND_CYC\0"
+    "PMC0\0"
+    "PM_INST_FROM_L2_NO_CONFLICT\0"
+    "PM_INST_FROM_L2\0"
+    "PM_INST_FROM_L3_NO_CONFLICT\0"
+    "PM_INST_FROM_L31_SHR\0"
+    "PM_INST_FROM_ON_CHIP_CACHE\0"
+    "PM_INST_FROM_RL2L3_SHR\0"
+    "PM_INST_FROM_LL4\0"
+    "PM_INST_FROM_L2MISS\0"
+    "PM_INST_CHIP_PUMP_CPRED\0"
+    "PM_INST_GRP_PUMP_MPRED_RTY\0"
+    "PM_INST_PUMP_CPRED\0"
+    "PM_INST_CMPL_ALT\0"
+    "PM_INST_FROM_L2_MEPF\0"
+    "PMC1\0"
+    "PM_INST_FROM_L3_MEPF\0"
+    "PM_INST_FROM_L31_MOD\0"
+    "PM_INST_FROM_RL2L3_MOD\0"
+    "PM_INST_FROM_LMEM\0"
+    "PM_INST_FROM_RL4\0"
+    "PM_INST_FROM_MEMORY\0"
+    "PM_INST_GRP_PUMP_CPRED\0"
+    "PM_INST_GRP_PUMP_MPRED\0"
+    "PM_INST_DISP\0"
+    "PMC1|PMC2\0"
+    "PM_L1_ICACHE_MISS\0"
+    "PM_INST_CMPL\0"
+    "PMC0|PMC1|PMC2|PMC3\0"
+    "PM_INST_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PMC2\0"
+    "PM_INST_FROM_L3_DISP_CONFLICT\0"
+    "PM_INST_FROM_L31_ECO_SHR\0"
+    "PM_INST_FROM_L21_SHR\0"
+    "PM_INST_FROM_DL2L3_SHR\0"
+    "PM_INST_FROM_RMEM\0"
+    "PM_INST_FROM_DL4\0"
+    "PM_INST_SYS_PUMP_CPRED\0"
+    "PM_INST_SYS_PUMP_MPRED\0"
+    "PM_L1_ICACHE_RELOADED_PREF\0"
+    "PM_THRD_CONC_RUN_INST\0"
+    "PM_INST_FROM_L3MISS\0"
+    "PM_L1_ICACHE_RELOADED_ALL\0"
+    "PMC3\0"
+    "PM_INST_IMC_MATCH_CMPL\0"
+    "PM_INST_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_INST_FROM_L3\0"
+    "PM_INST_FROM_L31_ECO_MOD\0"
+    "PM_INST_FROM_L21_MOD\0"
+    "PM_INST_FROM_DL2L3_MOD\0"
+    "PM_INST_FROM_OFF_CHIP_CACHE\0"
+    "PM_INST_FROM_DMEM\0"
+    "PM_INST_FROM_L3MISS_MOD\0"
+    "PM_INST_SYS_PUMP_MPRED_RTY\0"
+    "PM_INST_PUMP_MPRED\0"
+    "PM_INST_FROM_L1\0"
+    "PM_BANK_CONFLICT\0"
+    "PM_EAT_FULL_CYC\0"
+    "PM_IBUF_FULL_CYC\0"
+    "PM_IC_DEMAND_REQ\0"
+    "PM_IC_PREF_REQ\0"
+    "PM_L1_DEMAND_WRITE\0"
+    "PM_IC_PREF_WRITE\0"
+    "PM_IC_PREF_CANCEL_PAGE\0"
+    "PM_IC_PREF_CANCEL_HIT\0"
+    "PM_IC_PREF_CANCEL_L2\0"
+    "PM_IC_RELOAD_PRIVATE\0"
+    "PM_IC_DEMAND_L2_BHT_REDIRECT\0"
+    "PM_IC_DEMAND_L2_BR_REDIRECT\0"
+    "PM_DECODE_FUSION_LD_ST_DISP\0"
+    "PM_THRD_PRIO_0_1_CYC\0"
+    "PM_THRD_PRIO_2_3_CYC\0"
+    "PM_THRD_PRIO_4_5_CYC\0"
+    "PM_THRD_PRIO_6_7_CYC\0"
+    "PM_IC_INVALIDATE\0"
+    "PM_SHL_CREATED\0"
+    "PM_SHL_ST_DEP_CREATED\0"
+    "PM_IC_MISS_ICBI\0"
+    "PM_LWSYNC\0"
+    "PM_PTESYNC\0"
+    "PM_HWSYNC\0"
+    "PM_FLUSH_LSU\0"
+    "PM_DECODE_HOLD_ICT_FULL\0"
+    "PM_BRU_FIN\0"
+    "PM_BR_2PATH\0"
+    "PMC1|PMC3\0"
+    "PM_TAKEN_BR_MPRED_CMPL\0"
+    "PM_BACK_BR_CMPL\0"
+    "PM_BR_TAKEN_CMPL\0"
+    "PM_BFU_BUSY\0"
+    "PM_BR_CMPL\0"
+    "PM_BR_MPRED_CMPL\0"
+    "PM_BR_PRED\0"
+    "PM_BR_CORECT_PRED_TAKEN_CMPL\0"
+    "PM_BR_UNCOND\0"
+    "PM_BR_PRED_PCACHE\0"
+    "PM_BR_PRED_CCACHE\0"
+    "PM_STOP_FETCH_PENDING_CYC\0"
+    "PM_BR_PRED_LSTACK\0"
+    "PM_BR_MPRED_CCACHE\0"
+    "PM_BR_MPRED_LSTACK\0"
+    "PM_BR_PRED_TAKEN_CR\0"
+    "PM_BR_MPRED_PCACHE\0"
+    "PM_BR_PRED_TA\0"
+    "PM_DECODE_FUSION_CONST_GEN\0"
+    "PM_BR_MPRED_TAKEN_CR\0"
+    "PM_BR_MPRED_TAKEN_TA\0"
+    "PM_LINK_STACK_WRONG_ADD_PRED\0"
+    "PM_LINK_STACK_INVALID_PTR\0"
+    "PM_LINK_STACK_CORRECT\0"
+    "PM_FLUSH_MPRED\0"
+    "PM_EAT_FORCE_MISPRED\0"
+    "PM_BTAC_BAD_RESULT\0"
+    "PM_BTAC_GOOD_RESULT\0"
+    "PM_TAGE_CORRECT_TAKEN_CMPL\0"
+    "PM_TAGE_CORRECT\0"
+    "PM_TAGE_OVERRIDE_WRONG\0"
+    "PM_TAGE_OVERRIDE_WRONG_SPEC\0"
+    "PM_DISP_HELD\0"
+    "PM_STALL_END_ICT_EMPTY\0"
+    "PM_1PLUS_PPC_CMPL\0"
+    "PM_DISP_HELD_ISSQ_FULL\0"
+    "PM_ICT_EMPTY_CYC\0"
+    "PM_NTC_ALL_FIN\0"
+    "PM_NTC_ISSUE_HELD_ARB\0"
+    "PM_IOPS_CMPL\0"
+    "PM_NTC_FIN\0"
+    "PM_DISP_STARVED\0"
+    "PM_FLUSH_COMPLETION\0"
+    "PM_ISQ_0_8_ENTRIES\0"
+    "PM_NTC_ISSUE_HELD_OTHER\0"
+    "PM_DISP_HELD_HB_FULL\0"
+    "PM_ISQ_36_44_ENTRIES\0"
+    "PM_1PLUS_PPC_DISP\0"
+    "PM_FLUSH\0"
+    "PM_DARQ1_10_12_ENTRIES\0"
+    "PM_DARQ1_7_9_ENTRIES\0"
+    "PM_DARQ1_4_6_ENTRIES\0"
+    "PM_DARQ1_0_3_ENTRIES\0"
+    "PM_EE_OFF_EXT_INT\0"
+    "PM_FLUSH_DISP\0"
+    "PM_FLUSH_HB_RESTORE_CYC\0"
+    "PM_ISYNC\0"
+    "PM_FLUSH_DISP_SB\0"
+    "PM_FLUSH_DISP_TLBIE\0"
+    "PM_CLB_HELD\0"
+    "PM_DISP_CLB_HELD_BAL\0"
+    "PM_DISP_CLB_HELD_SB\0"
+    "PM_DISP_CLB_HELD_TLBIE\0"
+    "PM_LSU_FLUSH_NEXT\0"
+    "PM_DISP_HELD_TBEGIN\0"
+    "PM_ISU0_ISS_HOLD_ALL\0"
+    "PM_ISU2_ISS_HOLD_ALL\0"
+    "PM_ISU1_ISS_HOLD_ALL\0"
+    "PM_ISU3_ISS_HOLD_ALL\0"
+    "PM_VECTOR_LD_CMPL\0"
+    "PM_VECTOR_ST_CMPL\0"
+    "PM_FXU_BUSY\0"
+    "PM_FXU_IDLE\0"
+    "PM_VSU_FIN\0"
+    "PM_FXU_1PLUS_BUSY\0"
+    "PM_VSU_DP_FSQRT_FDIV\0"
+    "PM_FXU_FIN\0"
+    "PM_DFU_BUSY\0"
+    "PM_VSU_FSQRT_FDIV\0"
+    "PM_VSU_NON_FLOP_CMPL\0"
+    "PM_1FLOP_CMPL\0"
+    "PM_2FLOP_CMPL\0"
+    "PM_4FLOP_CMPL\0"
+    "PM_8FLOP_CMPL\0"
+    "PM_NON_FMA_FLOP_CMPL\0"
+    "PM_FMA_CMPL\0"
+    "PM_SCALAR_FLOP_CMPL\0"
+    "PM_VECTOR_FLOP_CMPL\0"
+    "PM_NON_MATH_FLOP_CMPL\0"
+    "PM_DP_QP_FLOP_CMPL\0"
+    "PM_IC_MISS_CMPL\0"
+    "PM_SP_FLOP_CMPL\0"
+    "PM_MATH_FLOP_CMPL\0"
+    "PM_FLOP_CMPL\0"
+    "PM_LSU_SRQ_FULL_CYC\0"
+    "PM_L1_DCACHE_RELOADED_ALL\0"
+    "PM_LMQ_MERGE\0"
+    "PM_CHIP_PUMP_CPRED\0"
+    "PM_GRP_PUMP_MPRED_RTY\0"
+    "PM_PUMP_CPRED\0"
+    "PM_MEM_READ\0"
+    "PM_MEM_LOC_THRESH_IFU\0"
+    "PM_MEM_LOC_THRESH_LSU_MED\0"
+    "PM_DARQ0_10_12_ENTRIES\0"
+    "PM_STCX_FAIL\0"
+    "PM_LD_L3MISS_PEND_CYC\0"
+    "PM_NTC_ISSUE_HELD_DARQ_FULL\0"
+    "PM_RUN_CYC_ST_MODE\0"
+    "PM_LD_REF_L1\0"
+    "PM_ST_FIN\0"
+    "PM_ST_FWD\0"
+    "PM_STCX_FIN\0"
+    "PM_LSU_LMQ_SRQ_EMPTY_CYC\0"
+    "PM_LD_MISS_L1_FIN\0"
+    "PM_GRP_PUMP_CPRED\0"
+    "PM_GRP_PUMP_MPRED\0"
+    "PM_MEM_PREF\0"
+    "PM_DARQ0_7_9_ENTRIES\0"
+    "PM_LRQ_REJECT\0"
+    "PM_LSU_REJECT_ERAT_MISS\0"
+    "PM_LMQ_EMPTY_CYC\0"
+    "PM_ST_CMPL\0"
+    "PM_LSU_REJECT_LMQ_FULL\0"
+    "PM_DARQ0_4_6_ENTRIES\0"
+    "PM_SYS_PUMP_CPRED\0"
+    "PM_SYS_PUMP_MPRED\0"
+    "PM_TLBIE_FIN\0"
+    "PM_LARX_FIN\0"
+    "PM_MEM_RWITM\0"
+    "PM_PARTIAL_ST_FIN\0"
+    "PM_LD_MISS_L1\0"
+    "PM_DARQ_STORE_XMIT\0"
+    "PM_LSU_FIN\0"
+    "PM_ST_MISS_L1\0"
+    "PM_L1_DCACHE_RELOAD_VALID\0"
+    "PM_DTLB_MISS\0"
+    "PM_SRQ_EMPTY_CYC\0"
+    "PM_LD_CMPL\0"
+    "PM_DARQ0_0_3_ENTRIES\0"
+    "PM_SYS_PUMP_MPRED_RTY\0"
+    "PM_PUMP_MPRED\0"
+    "PM_MEM_LOC_THRESH_LSU_HIGH\0"
+    "PM_MEM_CO\0"
+    "PM_DARQ_STORE_REJECT\0"
+    "PM_LSU_REJECT_LHS\0"
+    "PM_LS0_LD_VECTOR_FIN\0"
+    "PM_LS1_LD_VECTOR_FIN\0"
+    "PM_LS2_LD_VECTOR_FIN\0"
+    "PM_LS3_LD_VECTOR_FIN\0"
+    "PM_LSU_DTLB_MISS_4K\0"
+    "PM_LSU_DTLB_MISS_64K\0"
+    "PM_LSU_DTLB_MISS_16M_2M\0"
+    "PM_LSU_DTLB_MISS_16G_1G\0"
+    "PM_LSU_STCX\0"
+    "PM_LSU_NCST\0"
+    "PM_LS0_UNALIGNED_LD\0"
+    "PM_LS1_UNALIGNED_LD\0"
+    "PM_LS2_UNALIGNED_LD\0"
+    "PM_LS3_UNALIGNED_LD\0"
+    "PM_LS0_UNALIGNED_ST\0"
+    "PM_LS1_UNALIGNED_ST\0"
+    "PM_LS2_UNALIGNED_ST\0"
+    "PM_LS3_UNALIGNED_ST\0"
+    "PM_LS0_LAUNCH_HELD_PREF\0"
+    "PM_LS1_LAUNCH_HELD_PREF\0"
+    "PM_LSU0_FALSE_LHS\0"
+    "PM_LSU1_FALSE_LHS\0"
+    "PM_LSU2_FALSE_LHS\0"
+    "PM_LSU3_FALSE_LHS\0"
+    "PM_LSU_FLUSH_CI\0"
+    "PM_LSU_FLUSH_ATOMIC\0"
+    "PM_LSU_FLUSH_EMSH\0"
+    "PM_LSU_FLUSH_RELAUNCH_MISS\0"
+    "PM_LSU_FLUSH_UE\0"
+    "PM_LSU_FLUSH_LHS\0"
+    "PM_LSU_FLUSH_WRK_ARND\0"
+    "PM_LSU_FLUSH_LHL_SHL\0"
+    "PM_LSU_FLUSH_SAO\0"
+    "PM_LSU_FLUSH_LARX_STCX\0"
+    "PM_LSU_FLUSH_OTHER\0"
+    "PM_STCX_SUCCESS_CMPL\0"
+    "PM_LSU0_SET_MPRED\0"
+    "PM_LSU1_SET_MPRED\0"
+    "PM_LSU2_SET_MPRED\0"
+    "PM_LSU3_SET_MPRED\0"
+    "PM_LSU0_LDMX_FIN\0"
+    "PM_LSU1_LDMX_FIN\0"
+    "PM_LSU2_LDMX_FIN\0"
+    "PM_LSU3_LDMX_FIN\0"
+    "PM_LS0_DC_COLLISIONS\0"
+    "PM_LS1_DC_COLLISIONS\0"
+    "PM_LS2_DC_COLLISIONS\0"
+    "PM_LS3_DC_COLLISIONS\0"
+    "PM_LSU_FLUSH_ATOMIC_ALT\0"
+    "PM_LSU_FLUSH_EMSH_ALT\0"
+    "PM_LSU_FLUSH_RELAUNCH_MISS_ALT\0"
+    "PM_LSU_FLUSH_UE_ALT\0"
+    "PM_LSU_FLUSH_LHS_ALT\0"
+    "PM_LSU_FLUSH_LHL_SHL_ALT\0"
+    "PM_LSU_FLUSH_SAO_ALT\0"
+    "PM_LSU_FLUSH_LARX_STCX_ALT\0"
+    "PM_SRQ_SYNC_CYC\0"
+    "PM_LSU0_SRQ_S0_VALID_CYC\0"
+    "PM_LSU0_LRQ_S0_VALID_CYC\0"
+    "PM_LSU_LMQ_FULL_CYC\0"
+    "PM_LSU0_LMQ_S0_VALID\0"
+    "PM_LSU0_1_LRQF_FULL_CYC\0"
+    "PM_LSU2_3_LRQF_FULL_CYC\0"
+    "PM_S2Q_FULL\0"
+    "PM_L1_SW_PREF\0"
+    "PM_LS0_ERAT_MISS_PREF\0"
+    "PM_LS1_ERAT_MISS_PREF\0"
+    "PM_LS2_ERAT_MISS_PREF\0"
+    "PM_LS3_ERAT_MISS_PREF\0"
+    "PM_LSU0_ERAT_HIT\0"
+    "PM_LSU1_ERAT_HIT\0"
+    "PM_LSU2_ERAT_HIT\0"
+    "PM_LSU3_ERAT_HIT\0"
+    "PM_LSU0_TM_L1_MISS\0"
+    "PM_LSU1_TM_L1_MISS\0"
+    "PM_LSU2_TM_L1_MISS\0"
+    "PM_LSU3_TM_L1_MISS\0"
+    "PM_LSU_STCX_FAIL\0"
+    "PM_SNOOP_TLBIE\0"
+    "PM_PTE_PREFETCH\0"
+    "PM_LSU0_STORE_REJECT\0"
+    "PM_LSU1_STORE_REJECT\0"
+    "PM_LSU2_STORE_REJECT\0"
+    "PM_LSU3_STORE_REJECT\0"
+    "PM_LSU0_L1_CAM_CANCEL\0"
+    "PM_LSU1_L1_CAM_CANCEL\0"
+    "PM_LSU2_L1_CAM_CANCEL\0"
+    "PM_LSU3_L1_CAM_CANCEL\0"
+    "PM_DATA_STORE\0"
+    "PM_NON_DATA_STORE\0"
+    "PM_DC_PREF_HW_ALLOC\0"
+    "PM_DC_PREF_SW_ALLOC\0"
+    "PM_DC_PREF_CONF\0"
+    "PM_DC_PREF_FUZZY_CONF\0"
+    "PM_DC_PREF_STRIDED_CONF\0"
+    "PM_DC_DEALLOC_NO_CONF\0"
+    "PM_L3_LD_PREF\0"
+    "PM_L3_SW_PREF\0"
+    "PM_DC_PREF_CONS_ALLOC\0"
+    "PM_DC_PREF_XCONS_ALLOC\0"
+    "PM_L1_PREF\0"
+    "PM_DATA_FROM_L2_NO_CONFLICT\0"
+    "PM_DATA_FROM_L2\0"
+    "PM_DATA_FROM_L3_NO_CONFLICT\0"
+    "PM_DATA_FROM_L31_SHR\0"
+    "PM_DATA_FROM_ON_CHIP_CACHE\0"
+    "PM_DATA_FROM_RL2L3_SHR\0"
+    "PM_DATA_FROM_LL4\0"
+    "PM_DATA_FROM_L2MISS_MOD\0"
+    "PM_DATA_CHIP_PUMP_CPRED\0"
+    "PM_DATA_GRP_PUMP_MPRED_RTY\0"
+    "PM_DATA_PUMP_CPRED\0"
+    "PM_DATA_FROM_L2_MEPF\0"
+    "PM_DATA_FROM_L3_MEPF\0"
+    "PM_DATA_FROM_L31_MOD\0"
+    "PM_DATA_FROM_RL2L3_MOD\0"
+    "PM_DATA_FROM_LMEM\0"
+    "PM_DATA_FROM_RL4\0"
+    "PM_DATA_GRP_PUMP_CPRED\0"
+    "PM_DATA_GRP_PUMP_MPRED\0"
+    "PM_DATA_FROM_L2MISS\0"
+    "PM_DATA_TABLEWALK_CYC\0"
+    "PM_DATA_FROM_L2_DISP_CONFLICT_LDHITST\0"
+    "PM_DATA_FROM_L3_DISP_CONFLICT\0"
+    "PM_DATA_FROM_L31_ECO_SHR\0"
+    "PM_DATA_FROM_L21_SHR\0"
+    "PM_DATA_FROM_DL2L3_SHR\0"
+    "PM_DATA_FROM_RMEM\0"
+    "PM_DATA_FROM_DL4\0"
+    "PM_DATA_SYS_PUMP_CPRED\0"
+    "PM_DATA_SYS_PUMP_MPRED\0"
+    "PM_DATA_FROM_L3MISS\0"
+    "PM_DATA_FROM_L2_DISP_CONFLICT_OTHER\0"
+    "PM_DATA_FROM_L3\0"
+    "PM_DATA_FROM_L31_ECO_MOD\0"
+    "PM_DATA_FROM_L21_ECO_MOD\0"
+    "PM_DATA_FROM_DL2L3_MOD\0"
+    "PM_DATA_FROM_OFF_CHIP_CACHE\0"
+    "PM_DATA_FROM_DMEM\0"
+    "PM_DATA_FROM_L3MISS_MOD\0"
+    "PM_DPTEG_FROM_L3MISS\0"
+    "PM_DATA_SYS_PUMP_MPRED_RTY\0"
+    "PM_DATA_PUMP_MPRED\0"
+    "PM_DATA_FROM_MEMORY\0"
+    "PM_L3_CO_MEPF\0"
+    "PM_IPTEG_FROM_L2_NO_CONFLICT\0"
+    "PM_IPTEG_FROM_L2\0"
+    "PM_IPTEG_FROM_L3_NO_CONFLICT\0"
+    "PM_IPTEG_FROM_L31_SHR\0"
+    "PM_IPTEG_FROM_ON_CHIP_CACHE\0"
+    "PM_IPTEG_FROM_RL2L3_SHR\0"
+    "PM_IPTEG_FROM_LL4\0"
+    "PM_IPTEG_FROM_L2MISS\0"
+    "PM_IERAT_RELOAD\0"
+    "PM_IPTEG_FROM_L2_MEPF\0"
+    "PM_IPTEG_FROM_L3_MEPF\0"
+    "PM_IPTEG_FROM_L31_MOD\0"
+    "PM_IPTEG_FROM_RL2L3_MOD\0"
+    "PM_IPTEG_FROM_LMEM\0"
+    "PM_IPTEG_FROM_RL4\0"
+    "PM_IPTEG_FROM_MEMORY\0"
+    "PM_IERAT_RELOAD_4K\0"
+    "PM_IPTEG_FROM_L3_DISP_CONFLICT\0"
+    "PM_IPTEG_FROM_L31_ECO_SHR\0"
+    "PM_IPTEG_FROM_L21_SHR\0"
+    "PM_IPTEG_FROM_DL2L3_SHR\0"
+    "PM_IPTEG_FROM_RMEM\0"
+    "PM_IPTEG_FROM_DL4\0"
+    "PM_IERAT_RELOAD_64K\0"
+    "PM_ISLB_MISS\0"
+    "PM_DERAT_MISS_16G_1G\0"
+    "PM_IPTEG_FROM_L3\0"
+    "PM_IPTEG_FROM_L31_ECO_MOD\0"
+    "PM_IPTEG_FROM_L21_MOD\0"
+    "PM_IPTEG_FROM_DL2L3_MOD\0"
+    "PM_IPTEG_FROM_OFF_CHIP_CACHE\0"
+    "PM_IPTEG_FROM_DMEM\0"
+    "PM_IPTEG_FROM_L3MISS\0"
+    "PM_IERAT_RELOAD_16M\0"
+    "PM_ITLB_MISS\0"
+    "PM_DPTEG_FROM_L2_NO_CONFLICT\0"
+    "PM_DPTEG_FROM_L2\0"
+    "PM_DPTEG_FROM_L3_NO_CONFLICT\0"
+    "PM_DPTEG_FROM_L31_SHR\0"
+    "PM_DPTEG_FROM_ON_CHIP_CACHE\0"
+    "PM_DPTEG_FROM_RL2L3_SHR\0"
+    "PM_DPTEG_FROM_LL4\0"
+    "PM_DPTEG_FROM_L2MISS\0"
+    "PM_DPTEG_FROM_L2_MEPF\0"
+    "PM_DPTEG_FROM_L3_MEPF\0"
+    "PM_DPTEG_FROM_L31_MOD\0"
+    "PM_DPTEG_FROM_RL2L3_MOD\0"
+    "PM_DPTEG_FROM_LMEM\0"
+    "PM_DPTEG_FROM_RL4\0"
+    "PM_DPTEG_FROM_MEMORY\0"
+    "PM_DPTEG_FROM_L3_DISP_CONFLICT\0"
+    "PM_DPTEG_FROM_L31_ECO_SHR\0"
+    "PM_DPTEG_FROM_L21_SHR\0"
+    "PM_DPTEG_FROM_DL2L3_SHR\0"
+    "PM_DPTEG_FROM_RMEM\0"
+    "PM_DPTEG_FROM_DL4\0"
+    "PM_DPTEG_FROM_L3\0"
+    "PM_DPTEG_FROM_L31_ECO_MOD\0"
+    "PM_DPTEG_FROM_L21_MOD\0"
+    "PM_DPTEG_FROM_DL2L3_MOD\0"
+    "PM_DPTEG_FROM_OFF_CHIP_CACHE\0"
+    "PM_DPTEG_FROM_DMEM\0"
+    "PM_DSLB_MISS\0"
+    "PM_TABLEWALK_CYC\0"
+    "PM_DERAT_MISS_4K\0"
+    "PM_TLB_HIT\0"
+    "PM_DERAT_MISS_64K\0"
+    "PM_DTLB_MISS_4K\0"
+    "PM_TLB_MISS\0"
+    "PM_LSU_DERAT_MISS\0"
+    "PM_DERAT_MISS_16M_2M\0"
+    "PM_LS0_PTE_TABLEWALK_CYC\0"
+    "PM_LS1_PTE_TABLEWALK_CYC\0"
+    "PM_TABLEWALK_CYC_PREF\0"
+    "PM_XLATE_HPT_MODE\0"
+    "PM_XLATE_RADIX_MODE\0"
+    "PM_XLATE_MISS\0"
+    "PM_RADIX_PWC_L2_PTE_FROM_L2\0"
+    "PM_RADIX_PWC_L4_PTE_FROM_L2\0"
+    "PM_RADIX_PWC_L3_PDE_FROM_L3\0"
+    "PM_RADIX_PWC_L1_PDE_FROM_L2\0"
+    "PM_RADIX_PWC_L2_PDE_FROM_L2\0"
+    "PM_RADIX_PWC_L3_PDE_FROM_L2\0"
+    "PM_RADIX_PWC_L3_PTE_FROM_L2\0"
+    "PM_RADIX_PWC_L4_PTE_FROM_L3MISS\0"
+    "PM_RADIX_PWC_L1_PDE_FROM_L3\0"
+    "PM_RADIX_PWC_L2_PDE_FROM_L3\0"
+    "PM_RADIX_PWC_L3_PTE_FROM_L3\0"
+    "PM_RADIX_PWC_MISS\0"
+    "PM_RADIX_PWC_L1_PDE_FROM_L3MISS\0"
+    "PM_RADIX_PWC_L2_PTE_FROM_L3\0"
+    "PM_RADIX_PWC_L4_PTE_FROM_L3\0"
+    "PM_RADIX_PWC_L2_PTE_FROM_L3MISS\0"
+    "PM_RADIX_PWC_L3_PTE_FROM_L3MISS\0"
+    "PM_L2_LD\0"
+    "PM_L2_ST\0"
+    "PM_L2_LD_MISS\0"
+    "PM_L2_ST_MISS\0"
+    "PM_L2_INST\0"
+    "PM_L2_INST_MISS\0"
+    "PM_L2_DISP_ALL_L2MISS\0"
+    "PM_ISIDE_MRU_TOUCH\0"
+    "PM_L2_CASTOUT_MOD\0"
+    "PM_L2_CASTOUT_SHR\0"
+    "PM_L2_IC_INV\0"
+    "PM_L2_DC_INV\0"
+    "PM_L2_LD_DISP\0"
+    "PM_L2_LD_HIT\0"
+    "PM_L2_ST_DISP\0"
+    "PM_L2_ST_HIT\0"
+    "PM_L2_RCLD_DISP\0"
+    "PM_L2_RCLD_DISP_FAIL_ADDR\0"
+    "PM_L2_RCLD_DISP_FAIL_OTHER\0"
+    "PM_DSIDE_MRU_TOUCH\0"
+    "PM_L2_RCST_DISP\0"
+    "PM_L2_RCST_DISP_FAIL_ADDR\0"
+    "PM_L2_RCST_DISP_FAIL_OTHER\0"
+    "PM_L2_SN_M_WR_DONE\0"
+    "PM_CO_DISP_FAIL\0"
+    "PM_CO_TM_SC_FOOTPRINT\0"
+    "PM_L2_RC_ST_DONE\0"
+    "PM_L2_SN_SX_I_DONE\0"
+    "PM_L2_SN_M_RD_DONE\0"
+    "PM_L2_LOC_GUESS_CORRECT\0"
+    "PM_L2_LOC_GUESS_WRONG\0"
+    "PM_L2_GRP_GUESS_CORRECT\0"
+    "PM_L2_GRP_GUESS_WRONG\0"
+    "PM_L2_SYS_GUESS_CORRECT\0"
+    "PM_L2_SYS_GUESS_WRONG\0"
+    "PM_L2_CHIP_PUMP\0"
+    "PM_L2_GROUP_PUMP\0"
+    "PM_ISIDE_DISP\0"
+    "PM_ISIDE_DISP_FAIL_ADDR\0"
+    "PM_ISIDE_DISP_FAIL_OTHER\0"
+    "PM_L2_RTY_ST\0"
+    "PM_L2_RTY_LD\0"
+    "PM_L2_SYS_PUMP\0"
+    "PM_RC0_BUSY\0"
+    "PMC0|PMC1\0"
+    "PM_RC_USAGE\0"
+    "PM_CO_USAGE\0"
+    "PM_CO0_BUSY\0"
+    "PMC2|PMC3\0"
+    "PM_SN_USAGE\0"
+    "PM_ST_CAUSED_FAIL\0"
+    "PM_TM_LD_CAUSED_FAIL\0"
+    "PM_TM_LD_CONF\0"
+    "PM_TM_FAV_CAUSED_FAIL\0"
+    "PM_TM_ST_CONF\0"
+    "PM_TM_ST_CAUSED_FAIL\0"
+    "PM_TM_CAP_OVERFLOW\0"
+    "PM_SN0_BUSY\0"
+    "PM_L1PF_L2MEMACC\0"
+    "PM_ISIDE_L2MEMACC\0"
+    "PM_L2_LD_MISS_128B\0"
+    "PM_L2_ST_MISS_128B\0"
+    "PM_L2_LD_MISS_64B\0"
+    "PM_L2_ST_MISS_64B\0"
+    "PM_DSIDE_L2MEMACC\0"
+    "PM_DSIDE_OTHER_64B_L2MEMACC\0"
+    "PM_L2_INST_ALT\0"
+    "PM_L2_RTY_LD_ALT\0"
+    "PM_L2_INST_MISS_ALT\0"
+    "PM_L2_RTY_ST_ALT\0"
+    "PM_L3_PF_MISS_L3\0"
+    "PM_L3_CO_MEM\0"
+    "PM_L3_CO_L31\0"
+    "PM_L3_PF_ON_CHIP_CACHE\0"
+    "PM2\0"
+    "PM_L3_PF_OFF_CHIP_CACHE\0"
+    "PM_L3_PF_ON_CHIP_MEM\0"
+    "PM3\0"
+    "PM_L3_PF_OFF_CHIP_MEM\0"
+    "PM_L3_CI_HIT\0"
+    "PM_L3_CI_MISS\0"
+    "PM_L3_L2_CO_HIT\0"
+    "PM_L3_L2_CO_MISS\0"
+    "PM_L3_LAT_CI_HIT\0"
+    "PM_L3_LAT_CI_MISS\0"
+    "PM_L3_HIT\0"
+    "PM_L3_MISS\0"
+    "PM_L3_LD_HIT\0"
+    "PM_L3_LD_MISS\0"
+    "PM_L3_CO_LCO\0"
+    "PM_L3_CINJ\0"
+    "PM_L3_TRANS_PF\0"
+    "PM_TM_SC_CO\0"
+    "PM_TM_CAM_OVERFLOW\0"
+    "PM_NON_TM_RST_SC\0"
+    "PM_TM_RST_SC\0"
+    "PM_SNP_TM_HIT_M\0"
+    "PM_SNP_TM_HIT_T\0"
+    "PM_RD_FORMING_SC\0"
+    "PM_RD_CLEARING_SC\0"
+    "PM_L3_WI_USAGE\0"
+    "PM_L3_PF_HIT_L3\0"
+    "PM_RD_HIT_PF\0"
+    "PM_L3_CO\0"
+    "PM_SN_INVL\0"
+    "PM_SN_HIT\0"
+    "PM_SN_MISS\0"
+    "PM_L3_P0_LCO_NO_DATA\0"
+    "PM_L3_P1_LCO_NO_DATA\0"
+    "PM_L3_P0_LCO_DATA\0"
+    "PM_L3_P1_LCO_DATA\0"
+    "PM_L3_P0_CO_MEM\0"
+    "PM_L3_P1_CO_MEM\0"
+    "PM_L3_P0_CO_L31\0"
+    "PM_L3_P1_CO_L31\0"
+    "PM_L3_SN_USAGE\0"
+    "PM_L3_CI_USAGE\0"
+    "PM_L3_PF_USAGE\0"
+    "PM_L3_RD_USAGE\0"
+    "PM_L3_SN0_BUSY\0"
+    "PM_L3_CO0_BUSY\0"
+    "PM_L3_P0_PF_RTY\0"
+    "PM_L3_P1_PF_RTY\0"
+    "PM_L3_P2_PF_RTY\0"
+    "PM_L3_P3_PF_RTY\0"
+    "PM_L3_P0_CO_RTY\0"
+    "PM_L3_P1_CO_RTY\0"
+    "PM_L3_P2_CO_RTY\0"
+    "PM_L3_P3_CO_RTY\0"
+    "PM_L3_P0_NODE_PUMP\0"
+    "PM_L3_P1_NODE_PUMP\0"
+    "PM_L3_P0_GRP_PUMP\0"
+    "PM_L3_P1_GRP_PUMP\0"
+    "PM_L3_P0_SYS_PUMP\0"
+    "PM_L3_P1_SYS_PUMP\0"
+    "PM_L3_LOC_GUESS_CORRECT\0"
+    "PM_L3_GRP_GUESS_CORRECT\0"
+    "PM_L3_SYS_GUESS_CORRECT\0"
+    "PM_L3_LOC_GUESS_WRONG\0"
+    "PM_L3_GRP_GUESS_WRONG_LOW\0"
+    "PM_L3_GRP_GUESS_WRONG_HIGH\0"
+    "PM_L3_SYS_GUESS_WRONG\0"
+    "PM_L3_P0_LCO_RTY\0"
+    "PM_L3_P1_LCO_RTY\0"
+    "PM_L3_P2_LCO_RTY\0"
+    "PM_L3_P3_LCO_RTY\0"
+    "PM_L3_PF0_BUSY\0"
+    "PM_L3_RD0_BUSY\0"
+    "PM_L3_WI0_BUSY\0"
+    "PM_CMPLU_STALL_LRQ_OTHER\0"
+    "PM_CMPLU_STALL_THRD\0"
+    "PM_CMPLU_STALL_LARX\0"
+    "PM_CMPLU_STALL_LSU_FIN\0"
+    "PM_CMPLU_STALL_DMISS_L2L3\0"
+    "PM_CMPLU_STALL_DFLONG\0"
+    "PM_CMPLU_STALL_DP\0"
+    "PM_CMPLU_STALL_TEND\0"
+    "PM_CMPLU_STALL_SLB\0"
+    "PM_CMPLU_STALL\0"
+    "PM_CMPLU_STALL_FLUSH_ANY_THREAD\0"
+    "PM_CMPLU_STALL_ANY_SYNC\0"
+    "PM_CMPLU_STALL_NESTED_TBEGIN\0"
+    "PM_ICT_NOSLOT_DISP_HELD_TBEGIN\0"
+    "PM_ICT_NOSLOT_CYC\0"
+    "PM_CMPLU_STALL_LSU\0"
+    "PM_CMPLU_STALL_DCACHE_MISS\0"
+    "PM_CMPLU_STALL_STORE_FINISH\0"
+    "PM_CMPLU_STALL_PASTE\0"
+    "PM_CMPLU_STALL_DMISS_L21_L31\0"
+    "PM_CMPLU_STALL_LHS\0"
+    "PM_CMPLU_STALL_DMISS_REMOTE\0"
+    "PM_CMPLU_STALL_SYNC_PMU_INT\0"
+    "PM_CMPLU_STALL_DFU\0"
+    "PM_CMPLU_STALL_LRQ_FULL\0"
+    "PM_CMPLU_STALL_FXU\0"
+    "PM_CMPLU_STALL_EXEC_UNIT\0"
+    "PM_ICT_NOSLOT_IC_MISS\0"
+    "PM_CMPLU_STALL_STCX\0"
+    "PM_ICT_NOSLOT_DISP_HELD_ISSQ\0"
+    "PM_CMPLU_STALL_VFXLONG\0"
+    "PM_CMPLU_STALL_LSU_FLUSH_NEXT\0"
+    "PM_CMPLU_STALL_TLBIE\0"
+    "PM_CMPLU_STALL_NTC_FLUSH\0"
+    "PM_CMPLU_STALL_EMQ_FULL\0"
+    "PM_CMPLU_STALL_OTHER_CMPL\0"
+    "PM_CMPLU_STALL_PM\0"
+    "PM_CMPLU_STALL_STORE_FIN_ARB\0"
+    "PM_CMPLU_STALL_SRQ_FULL\0"
+    "PM_ICT_NOSLOT_DISP_HELD_HB_FULL\0"
+    "PM_CMPLU_STALL_STORE_DATA\0"
+    "PM_CMPLU_STALL_SPEC_FINISH\0"
+    "PM_CMPLU_STALL_DMISS_LMEM\0"
+    "PM_CMPLU_STALL_EXCEPTION\0"
+    "PM_CMPLU_STALL_NESTED_TEND\0"
+    "PM_CMPLU_STALL_VDPLONG\0"
+    "PM_CMPLU_STALL_VFXU\0"
+    "PM_CMPLU_STALL_LSU_MFSPR\0"
+    "PM_ICT_NOSLOT_BR_MPRED_ICMISS\0"
+    "PM_CMPLU_STALL_DPLONG\0"
+    "PM_ICT_NOSLOT_IC_L3\0"
+    "PM_CMPLU_STALL_STORE_PIPE_ARB\0"
+    "PM_CMPLU_STALL_ERAT_MISS\0"
+    "PM_CMPLU_STALL_LMQ_FULL\0"
+    "PM_CMPLU_STALL_DMISS_L2L3_CONFLICT\0"
+    "PM_CMPLU_STALL_DMISS_L3MISS\0"
+    "PM_CMPLU_STALL_ST_FWD\0"
+    "PM_CMPLU_STALL_CRYPTO\0"
+    "PM_CMPLU_STALL_LOAD_FINISH\0"
+    "PM_CMPLU_STALL_FXLONG\0"
+    "PM_CMPLU_STALL_BRU\0"
+    "PM_CMPLU_STALL_EIEIO\0"
+    "PM_ICT_NOSLOT_DISP_HELD_SYNC\0"
+    "PM_ICT_NOSLOT_BR_MPRED\0"
+    "PM_ICT_NOSLOT_IC_L3MISS\0"
+    "PM_CMPLU_STALL_MTFPSCR\0"
+    "PM_CMPLU_STALL_LSAQ_ARB\0"
+    "PM_CMPLU_STALL_NTC_DISP_FIN\0"
+    "PM_ICT_NOSLOT_DISP_HELD\0"
+    "PM_CMPLU_STALL_VDP\0"
+    "PM_TM_TX_PASS_RUN_INST\0"
+    "PM_TM_PASSED\0"
+    "PM_TM_ABORTS\0"
+    "PM_TM_TRANS_RUN_CYC\0"
+    "PM_TM_TX_PASS_RUN_CYC\0"
+    "PM_TM_OUTER_TBEGIN_DISP\0"
+    "PM_SUSPENDED\0"
+    "PM_RUN_SPURR\0"
+    "PM_RUN_PURR\0"
+    "PM_PMC0_OVERFLOW\0"
+    "PM_PMC0_SAVED\0"
+    "PM_PMC0_REWIND\0"
+    "PM_PMC1_OVERFLOW\0"
+    "PM_PMC1_SAVED\0"
+    "PM_PMC1_REWIND\0"
+    "PM_PMC2_OVERFLOW\0"
+    "PM_PMC2_SAVED\0"
+    "PM_PMC2_REWIND\0"
+    "PM_PMC3_OVERFLOW\0"
+    "PM_PMC3_SAVED\0"
+    "PM_PMC3_REWIND\0"
+    "PM_PMC4_OVERFLOW\0"
+    "PM_PMC5_OVERFLOW\0"
+    "PM_THRESH_EXC_32\0"
+    "PM_THRESH_EXC_64\0"
+    "PM_THRESH_EXC_128\0"
+    "PM_THRESH_EXC_256\0"
+    "PM_THRESH_EXC_512\0"
+    "PM_THRESH_EXC_1024\0"
+    "PM_THRESH_EXC_2048\0"
+    "PM_THRESH_EXC_4096\0"
+    "PM_THRESH_MET\0"
+    "PM_THRESH_NOT_MET\0"
+    "PM_THRESH_ACC\0"
+    "PM_CYC\0"
+    "PM_ANY_THRD_RUN_CYC\0"
+    "PM_THRD_ALL_RUN_CYC\0"
+    "PM_RUN_CYC_SMT4_MODE\0"
+    "PM_HV_CYC\0"
+    "PM_EXT_INT\0"
+    "PM_FREQ_UP\0"
+    "PM_FREQ_DOWN\0"
+    "PM_NEST_REF_CLK\0"
+    "PM_TB_BIT_TRANS\0"
+    "PM_PROBE_NOP_DISP\0"
+    "PM_MBA0_DRAM_CLK_CYC\0"
+    "MBOX0\0"
+    "PM_MBA1_DRAM_CLK_CYC\0"
+    "MBOX1\0"
+    "PM_MBA2_DRAM_CLK_CYC\0"
+    "MBOX2\0"
+    "PM_MBA3_DRAM_CLK_CYC\0"
+    "MBOX3\0"
+    "PM_MBA4_DRAM_CLK_CYC\0"
+    "MBOX4\0"
+    "PM_MBA5_DRAM_CLK_CYC\0"
+    "MBOX5\0"
+    "PM_MBA6_DRAM_CLK_CYC\0"
+    "MBOX6\0"
+    "PM_MBA7_DRAM_CLK_CYC\0"
+    "MBOX7\0"
+    "PM_MBA0_READ_BYTES\0"
+    "PM_MBA1_READ_BYTES\0"
+    "PM_MBA2_READ_BYTES\0"
+    "PM_MBA3_READ_BYTES\0"
+    "PM_MBA4_READ_BYTES\0"
+    "PM_MBA5_READ_BYTES\0"
+    "PM_MBA6_READ_BYTES\0"
+    "PM_MBA7_READ_BYTES\0"
+    "PM_MBA0_WRITE_BYTES\0"
+    "PM_MBA1_WRITE_BYTES\0"
+    "PM_MBA2_WRITE_BYTES\0"
+    "PM_MBA3_WRITE_BYTES\0"
+    "PM_MBA4_WRITE_BYTES\0"
+    "PM_MBA5_WRITE_BYTES\0"
+    "PM_MBA6_WRITE_BYTES\0"
+    "PM_MBA7_WRITE_BYTES\0"
+    "PM_XLINK0_IN_EVEN_CYC\0"
+    "QBOX0\0"
+    "PM_XLINK0_IN_ODD_CYC\0"
+    "PM_XLINK1_OUT_EVEN_CYC\0"
+    "QBOX1\0"
+    "PM_XLINK1_OUT_ODD_CYC\0"
+    "PM_XLINK2_OUT_EVEN_CYC\0"
+    "QBOX2\0"
+    "PM_XLINK2_OUT_ODD_CYC\0"
+    "PM_XLINK0_IN_EVEN_ANY_RCMD\0"
+    "PM_XLINK0_IN_ODD_ANY_RCMD\0"
+    "PM_XLINK1_OUT_EVEN_ANY_RCMD\0"
+    "PM_XLINK1_OUT_ODD_ANY_RCMD\0"
+    "PM_XLINK2_OUT_EVEN_ANY_RCMD\0"
+    "PM_XLINK2_OUT_ODD_ANY_RCMD\0"
+    "PM_XLINK0_IN_EVEN_DATA_COUNT\0"
+    "PM_XLINK0_IN_ODD_DATA_COUNT\0"
+    "PM_XLINK1_OUT_EVEN_DATA_COUNT\0"
+    "PM_XLINK1_OUT_ODD_DATA_COUNT\0"
+    "PM_XLINK2_OUT_EVEN_DATA_COUNT\0"
+    "PM_XLINK2_OUT_ODD_DATA_COUNT\0"
+    "PM_XLINK0_IN_EVEN_TOTAL_UTIL\0"
+    "PM_XLINK0_IN_ODD_TOTAL_UTIL\0"
+    "PM_XLINK1_OUT_EVEN_TOTAL_UTIL\0"
+    "PM_XLINK1_OUT_ODD_TOTAL_UTIL\0"
+    "PM_XLINK2_OUT_EVEN_TOTAL_UTIL\0"
+    "PM_XLINK2_OUT_ODD_TOTAL_UTIL\0"
+    "PM_PB_EVENT_VG_PUMP\0"
+    "SBOX\0"
+    "PM_PB_EVENT_LNS_PUMP\0"
+    "PM_PB_EVENT_GROUP_PUMP\0"
+    "PM_PB_EVENT_RNS_PUMP\0"
+    "PM_PB_EVENT_RTY_VG_PUMP\0"
+    "PM_PB_EVENT_RTY_LNS_PUMP\0"
+    "PM_PB_EVENT_RTY_GROUP_PUMP\0"
+    "PM_PB_EVENT_RTY_RNS_PUMP\0"
+    "PM_PB_CYC\0"
+    "PM_PB_VG_PUMP_P01\0"
+    "PM_PB_LNS_PUMP_P01\0"
+    "PM_PB_GROUP_PUMP_P01\0"
+    "PM_PB_RNS_PUMP_P01\0"
+    "PM_PB_INT_DATA_XFER\0"
+    "PM_PB_EXT_DATA_XFER\0"
+    "PM_PB_NNS_PUMP\0"
+    "PM_PB_RTY_NNS_PUMP_P01\0"
+    "PM_PB_CYC2\0"
+    "PM_MCS01_64B_RD_OR_WR_DISP_PORT01\0"
+    "BBOX0\0"
+    "PM_MCS23_64B_RD_OR_WR_DISP_PORT01\0"
+    "BBOX1\0"
+    "PM_MCS01_64B_RD_DISP_PORT01\0"
+    "PM_MCS23_64B_RD_DISP_PORT01\0"
+    "PM_MCS01_64B_WR_DISP_PORT01\0"
+    "PM_MCS23_64B_WR_DISP_PORT01\0"
+    "PM_MCS01_AMO_OP_DISP_MC23_PORT01\0"
+    "PM_MCS23_AMO_OP_DISP_MC01_PORT01\0"
+    "PM_MCS01_64B_RD_OR_WR_DISP_PORT23\0"
+    "PM_MCS23_64B_RD_OR_WR_DISP_PORT23\0"
+    "PM_MCS01_64B_RD_DISP_PORT23\0"
+    "PM_MCS23_64B_RD_DISP_PORT23\0"
+    "PM_MCS01_64B_WR_DISP_PORT23\0"
+    "PM_MCS23_64B_WR_DISP_PORT23\0";
+
+static const PerfmonEventOption power9_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry power9_arch_event_entries[NUM_ARCH_EVENTS_POWER9] = {
+ {0, 11, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16, 33, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {43, 60, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65, 60, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {93, 60, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {109, 60, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {137, 60, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {158, 60, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {185, 60, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {208, 60, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {225, 60, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {245, 60, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {269, 60, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {296, 60, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {315, 60, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {332, 353, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {358, 353, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {379, 353, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {400, 353, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {423, 353, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {441, 353, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {458, 353, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {478, 353, 0, 0, 0x5C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {501, 353, 0, 0, 0x5E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {524, 537, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {547, 353, 0, 0, 0xFD,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {565, 578, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {598, 636, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {641, 636, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {671, 636, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {696, 636, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {717, 636, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {740, 636, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {758, 636, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {775, 636, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {798, 636, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {821, 636, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {848, 636, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {870, 636, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {890, 916, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {921, 916, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {944, 916, 0, 0, 0x40,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {980, 916, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {996, 916, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1021, 916, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1042, 916, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1065, 916, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 916, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1111, 916, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1135, 916, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1162, 916, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1181, 578, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1197, 578, 0, 0, 0x80,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1214, 578, 0, 0, 0x84,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1230, 578, 0, 0, 0x84,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1247, 578, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1264, 578, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1279, 578, 0, 0, 0x8C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1298, 578, 0, 0, 0x8C,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1315, 578, 0, 0, 0x90,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1338, 578, 0, 0, 0x90,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1360, 578, 0, 0, 0x94,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1381, 578, 0, 0, 0x94,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1402, 578, 0, 0, 0x98,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1431, 578, 0, 0, 0x98,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1459, 578, 0, 0, 0xA8,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1487, 578, 0, 0, 0xBC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1508, 578, 0, 0, 0xBC,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1529, 578, 0, 0, 0x80,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1550, 578, 0, 0, 0x80,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1571, 578, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1588, 578, 0, 0, 0x8C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1603, 578, 0, 0, 0x8C,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1625, 578, 0, 0, 0x94,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1641, 578, 0, 0, 0x94,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1651, 578, 0, 0, 0x9C,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1662, 578, 0, 0, 0xA0,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1672, 578, 0, 0, 0xA4,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1685, 578, 0, 0, 0xA8,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {1709, 60, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1720, 1732, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1742, 353, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1765, 353, 0, 0, 0x5E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1781, 353, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1798, 636, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1810, 916, 0, 0, 0x5E,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {1821, 916, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1838, 578, 0, 0, 0x9C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1849, 578, 0, 0, 0x9C,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1878, 578, 0, 0, 0xA0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1891, 578, 0, 0, 0xA0,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1909, 578, 0, 0, 0xA4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1927, 578, 0, 0, 0xA4,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1953, 578, 0, 0, 0xA8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1971, 578, 0, 0, 0xAC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1990, 578, 0, 0, 0xAC,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2009, 578, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2029, 578, 0, 0, 0xB0,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2048, 578, 0, 0, 0xB4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2062, 578, 0, 0, 0xB4,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2089, 578, 0, 0, 0xB8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2110, 578, 0, 0, 0xB8,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2131, 578, 0, 0, 0x98,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2160, 578, 0, 0, 0x98,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2186, 578, 0, 0, 0xA0,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2208, 578, 0, 0, 0xA4,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2223, 578, 0, 0, 0xA8,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2244, 578, 0, 0, 0xB0,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2263, 578, 0, 0, 0xB0,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2283, 578, 0, 0, 0xB4,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2310, 578, 0, 0, 0xB4,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2326, 578, 0, 0, 0xB8,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2349, 578, 0, 0, 0xB8,0x58,0,0,EVENT_OPTION_NONE_MASK}
+, {2377, 60, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2390, 60, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2413, 60, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2431, 353, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2454, 353, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2471, 353, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2486, 353, 0, 0, 0x16,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2508, 353, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2521, 353, 0, 0, 0x5A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2532, 636, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2548, 636, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2568, 636, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2587, 636, 0, 0, 0x5A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {2611, 636, 0, 0, 0x5C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {2632, 916, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2653, 916, 0, 0, 0xF2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2671, 916, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2680, 353, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2703, 353, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2724, 636, 0, 0, 0x50,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2745, 916, 0, 0, 0x22,0xC1,0,0,EVENT_OPTION_NONE_MASK}
+, {2766, 578, 0, 0, 0x80,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2784, 578, 0, 0, 0x80,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2798, 578, 0, 0, 0x84,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2822, 578, 0, 0, 0x84,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2831, 578, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2848, 578, 0, 0, 0x88,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2868, 578, 0, 0, 0x8C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2880, 578, 0, 0, 0x8C,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2901, 578, 0, 0, 0x90,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2921, 578, 0, 0, 0x90,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2944, 578, 0, 0, 0xB0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2962, 578, 0, 0, 0xB0,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {2982, 578, 0, 0, 0x80,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3003, 578, 0, 0, 0x80,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {3024, 578, 0, 0, 0x84,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3045, 578, 0, 0, 0x84,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {3066, 916, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3084, 916, 0, 0, 0x56,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3102, 353, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3114, 353, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3126, 353, 0, 0, 0x5C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3137, 636, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3155, 636, 0, 0, 0x58,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3176, 916, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3187, 916, 0, 0, 0x4C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3199, 916, 0, 0, 0x4E,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3217, 916, 0, 0, 0x50,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3238, 916, 0, 0, 0x50,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3252, 916, 0, 0, 0x52,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3266, 916, 0, 0, 0x52,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3280, 916, 0, 0, 0x54,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3294, 916, 0, 0, 0x56,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3315, 916, 0, 0, 0x54,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3327, 916, 0, 0, 0x56,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3347, 916, 0, 0, 0x58,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3367, 916, 0, 0, 0x5A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3389, 916, 0, 0, 0x5C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3408, 916, 0, 0, 0x58,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3424, 916, 0, 0, 0x5A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3440, 916, 0, 0, 0x5C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3458, 916, 0, 0, 0x5E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3471, 60, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3491, 60, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3517, 60, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3530, 60, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3549, 60, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3571, 60, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3585, 60, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3597, 60, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3619, 60, 0, 0, 0x5E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {3645, 60, 0, 0, 0x58,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {3668, 60, 0, 0, 0x58,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3681, 60, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3703, 60, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3731, 60, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3750, 60, 0, 0, 0xFC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3763, 353, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3773, 353, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3783, 353, 0, 0, 0x14,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3795, 353, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3820, 353, 0, 0, 0x4E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {3838, 353, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3856, 353, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3874, 353, 0, 0, 0x58,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {3886, 353, 0, 0, 0x50,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3907, 353, 0, 0, 0x5A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3921, 353, 0, 0, 0x5C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3945, 353, 0, 0, 0x5E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {3962, 353, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3973, 636, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3996, 636, 0, 0, 0x4E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4017, 636, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4035, 636, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4053, 636, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4066, 636, 0, 0, 0x58,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4078, 636, 0, 0, 0x5E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4091, 636, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4109, 636, 0, 0, 0x54,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {4123, 636, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4142, 636, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4153, 636, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4167, 636, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4193, 636, 0, 0, 0xFC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4206, 916, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4223, 916, 0, 0, 0x3E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4234, 916, 0, 0, 0x4A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {4255, 916, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4277, 916, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4291, 916, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4318, 916, 0, 0, 0x58,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4328, 916, 0, 0, 0x5E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4349, 916, 0, 0, 0x5C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {4109, 916, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4367, 578, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4388, 578, 0, 0, 0x80,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4409, 578, 0, 0, 0x84,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4430, 578, 0, 0, 0x84,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4451, 578, 0, 0, 0x88,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4471, 578, 0, 0, 0x88,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4492, 578, 0, 0, 0x8C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4516, 578, 0, 0, 0x8C,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4540, 578, 0, 0, 0x90,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4552, 578, 0, 0, 0x90,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4564, 578, 0, 0, 0x94,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4584, 578, 0, 0, 0x94,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4604, 578, 0, 0, 0x98,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4624, 578, 0, 0, 0x98,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4644, 578, 0, 0, 0xB8,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {4664, 578, 0, 0, 0xB8,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {4684, 578, 0, 0, 0xBC,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {4704, 578, 0, 0, 0xBC,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {4724, 578, 0, 0, 0x9C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4748, 578, 0, 0, 0x9C,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4772, 578, 0, 0, 0xA0,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4790, 578, 0, 0, 0xA0,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4808, 578, 0, 0, 0xA4,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4826, 578, 0, 0, 0xA4,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4844, 578, 0, 0, 0xA8,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4860, 578, 0, 0, 0xA8,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4880, 578, 0, 0, 0xAC,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4898, 578, 0, 0, 0xAC,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4925, 578, 0, 0, 0xB0,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4941, 578, 0, 0, 0xB0,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {4958, 578, 0, 0, 0xB4,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4980, 578, 0, 0, 0xB4,0xC9,0,0,EVENT_OPTION_NONE_MASK}
+, {5001, 578, 0, 0, 0xB8,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5018, 578, 0, 0, 0xB8,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5041, 578, 0, 0, 0xBC,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {5060, 578, 0, 0, 0xBC,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5081, 578, 0, 0, 0x80,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5099, 578, 0, 0, 0x80,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5117, 578, 0, 0, 0x84,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5135, 578, 0, 0, 0x84,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5153, 578, 0, 0, 0x88,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5170, 578, 0, 0, 0x88,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5187, 578, 0, 0, 0x8C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5204, 578, 0, 0, 0x8C,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5221, 578, 0, 0, 0x90,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5242, 578, 0, 0, 0x90,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5263, 578, 0, 0, 0x94,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5284, 578, 0, 0, 0x94,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5305, 578, 0, 0, 0x98,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {5329, 578, 0, 0, 0x98,0xD9,0,0,EVENT_OPTION_NONE_MASK}
+, {5351, 578, 0, 0, 0x9C,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {5382, 578, 0, 0, 0x9C,0xD9,0,0,EVENT_OPTION_NONE_MASK}
+, {5402, 578, 0, 0, 0xA0,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {5423, 578, 0, 0, 0xA0,0xD9,0,0,EVENT_OPTION_NONE_MASK}
+, {5448, 578, 0, 0, 0xA4,0xD1,0,0,EVENT_OPTION_NONE_MASK}
+, {5469, 578, 0, 0, 0xA4,0xD9,0,0,EVENT_OPTION_NONE_MASK}
+, {5496, 578, 0, 0, 0xAC,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5512, 578, 0, 0, 0xB4,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5537, 578, 0, 0, 0xB4,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5562, 578, 0, 0, 0xB8,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5582, 578, 0, 0, 0xB8,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5603, 578, 0, 0, 0xBC,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {5627, 578, 0, 0, 0xBC,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {5651, 578, 0, 0, 0x80,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5663, 578, 0, 0, 0x80,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5677, 578, 0, 0, 0x84,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5699, 578, 0, 0, 0x84,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5721, 578, 0, 0, 0x88,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5743, 578, 0, 0, 0x88,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5765, 578, 0, 0, 0x94,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5782, 578, 0, 0, 0x94,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5799, 578, 0, 0, 0x98,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5816, 578, 0, 0, 0x98,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5833, 578, 0, 0, 0x9C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5852, 578, 0, 0, 0x9C,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5871, 578, 0, 0, 0xA0,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {5890, 578, 0, 0, 0xA0,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {5909, 578, 0, 0, 0x80,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {5926, 578, 0, 0, 0x80,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {5941, 578, 0, 0, 0x84,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {5957, 578, 0, 0, 0x88,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {5978, 578, 0, 0, 0x88,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {5999, 578, 0, 0, 0x8C,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6020, 578, 0, 0, 0x8C,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6041, 578, 0, 0, 0x90,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6063, 578, 0, 0, 0x90,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6085, 578, 0, 0, 0x94,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6107, 578, 0, 0, 0x94,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6129, 578, 0, 0, 0xA0,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6143, 578, 0, 0, 0xA0,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6161, 578, 0, 0, 0xA4,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6181, 578, 0, 0, 0xA4,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6201, 578, 0, 0, 0xA8,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6217, 578, 0, 0, 0xA8,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {6239, 578, 0, 0, 0xAC,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6263, 578, 0, 0, 0xAC,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6285, 578, 0, 0, 0xB0,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6299, 578, 0, 0, 0xB0,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6313, 578, 0, 0, 0xB4,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {6335, 578, 0, 0, 0xB4,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {6358, 353, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6369, 60, 0, 0, 0x40,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6397, 60, 0, 0, 0x42,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6413, 60, 0, 0, 0x44,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6441, 60, 0, 0, 0x46,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6462, 60, 0, 0, 0x48,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6489, 60, 0, 0, 0x4A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6512, 60, 0, 0, 0x4C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6529, 60, 0, 0, 0x4E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6553, 60, 0, 0, 0x50,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6577, 60, 0, 0, 0x52,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6604, 60, 0, 0, 0x54,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6623, 353, 0, 0, 0x40,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6644, 353, 0, 0, 0x42,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6665, 353, 0, 0, 0x44,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6686, 353, 0, 0, 0x46,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6709, 353, 0, 0, 0x48,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6727, 353, 0, 0, 0x4A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6744, 353, 0, 0, 0x50,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6767, 353, 0, 0, 0x52,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6790, 353, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6810, 636, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6832, 636, 0, 0, 0x40,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6870, 636, 0, 0, 0x42,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6900, 636, 0, 0, 0x44,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6925, 636, 0, 0, 0x46,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6946, 636, 0, 0, 0x48,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6969, 636, 0, 0, 0x4A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {6987, 636, 0, 0, 0x4C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7004, 636, 0, 0, 0x50,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7027, 636, 0, 0, 0x52,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7050, 636, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7070, 916, 0, 0, 0x40,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7106, 916, 0, 0, 0x42,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7122, 916, 0, 0, 0x44,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7147, 916, 0, 0, 0x46,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7172, 916, 0, 0, 0x48,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7195, 916, 0, 0, 0x4A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7223, 916, 0, 0, 0x4C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7241, 916, 0, 0, 0x4E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7265, 916, 0, 0, 0x4E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7286, 916, 0, 0, 0x50,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7313, 916, 0, 0, 0x52,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7332, 916, 0, 0, 0xFE,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7352, 636, 0, 0, 0x5E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {7366, 60, 0, 0, 0x40,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7395, 60, 0, 0, 0x42,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7412, 60, 0, 0, 0x44,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7441, 60, 0, 0, 0x46,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7463, 60, 0, 0, 0x48,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7491, 60, 0, 0, 0x4A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7515, 60, 0, 0, 0x4C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7533, 60, 0, 0, 0x4E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7554, 60, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7570, 353, 0, 0, 0x40,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7592, 353, 0, 0, 0x42,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7614, 353, 0, 0, 0x44,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7636, 353, 0, 0, 0x46,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7660, 353, 0, 0, 0x48,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7679, 353, 0, 0, 0x4A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7697, 353, 0, 0, 0x4C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7718, 353, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7737, 636, 0, 0, 0x42,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7768, 636, 0, 0, 0x44,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7794, 636, 0, 0, 0x46,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7816, 636, 0, 0, 0x48,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7840, 636, 0, 0, 0x4A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7859, 636, 0, 0, 0x4C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7877, 636, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7897, 916, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7910, 916, 0, 0, 0x54,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {7931, 916, 0, 0, 0x42,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7948, 916, 0, 0, 0x44,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7974, 916, 0, 0, 0x46,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {7996, 916, 0, 0, 0x48,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {8020, 916, 0, 0, 0x4A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {8049, 916, 0, 0, 0x4C,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {8068, 916, 0, 0, 0x4E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {8089, 916, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8109, 916, 0, 0, 0xFC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8122, 60, 0, 0, 0x40,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8151, 60, 0, 0, 0x42,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8168, 60, 0, 0, 0x44,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8197, 60, 0, 0, 0x46,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8219, 60, 0, 0, 0x48,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8247, 60, 0, 0, 0x4A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8271, 60, 0, 0, 0x4C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8289, 60, 0, 0, 0x4E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8310, 353, 0, 0, 0x40,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8332, 353, 0, 0, 0x42,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8354, 353, 0, 0, 0x44,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8376, 353, 0, 0, 0x46,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8400, 353, 0, 0, 0x48,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8419, 353, 0, 0, 0x4A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8437, 353, 0, 0, 0x4C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8458, 636, 0, 0, 0x42,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8489, 636, 0, 0, 0x44,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8515, 636, 0, 0, 0x46,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8537, 636, 0, 0, 0x48,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8561, 636, 0, 0, 0x4A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8580, 636, 0, 0, 0x4C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8598, 916, 0, 0, 0x42,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8615, 916, 0, 0, 0x44,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8641, 916, 0, 0, 0x46,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8663, 916, 0, 0, 0x48,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8687, 916, 0, 0, 0x4A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8716, 916, 0, 0, 0x4C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8735, 60, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8748, 60, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8765, 60, 0, 0, 0x56,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8782, 60, 0, 0, 0x54,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {8793, 353, 0, 0, 0x54,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8811, 353, 0, 0, 0x56,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8827, 353, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8839, 353, 0, 0, 0xF6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8857, 636, 0, 0, 0x54,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {8735, 578, 0, 0, 0xA8,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {7897, 578, 0, 0, 0xA8,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {8878, 578, 0, 0, 0xBC,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {8903, 578, 0, 0, 0xBC,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {8928, 578, 0, 0, 0x84,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {8950, 578, 0, 0, 0x98,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {8968, 578, 0, 0, 0x98,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {8988, 578, 0, 0, 0x9C,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {9002, 60, 0, 0, 0x58,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9030, 60, 0, 0, 0x5A,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9058, 60, 0, 0, 0x5C,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9086, 353, 0, 0, 0x26,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {9114, 353, 0, 0, 0x28,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {9142, 353, 0, 0, 0x2A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {9170, 353, 0, 0, 0x2E,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {9198, 636, 0, 0, 0x54,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9230, 636, 0, 0, 0x58,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9258, 636, 0, 0, 0x5A,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9286, 636, 0, 0, 0x5E,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9314, 916, 0, 0, 0x54,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9332, 916, 0, 0, 0x56,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9364, 916, 0, 0, 0x58,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9392, 916, 0, 0, 0x5A,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9420, 916, 0, 0, 0x5C,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9452, 916, 0, 0, 0x5E,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {9484, 60, 0, 0, 0x80,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9493, 60, 0, 0, 0x80,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9502, 353, 0, 0, 0x80,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9516, 353, 0, 0, 0x80,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9530, 636, 0, 0, 0x80,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9541, 636, 0, 0, 0x80,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9557, 916, 0, 0, 0x80,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9579, 916, 0, 0, 0x80,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9598, 60, 0, 0, 0x82,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9616, 60, 0, 0, 0x82,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9634, 353, 0, 0, 0x82,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9647, 353, 0, 0, 0x82,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9660, 636, 0, 0, 0x82,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9674, 636, 0, 0, 0x82,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9687, 916, 0, 0, 0x82,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9701, 916, 0, 0, 0x82,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9714, 60, 0, 0, 0x84,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9730, 60, 0, 0, 0x84,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9756, 353, 0, 0, 0x84,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9783, 353, 0, 0, 0x84,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9802, 636, 0, 0, 0x84,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9818, 636, 0, 0, 0x84,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9844, 916, 0, 0, 0x84,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9871, 60, 0, 0, 0x86,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9890, 60, 0, 0, 0x86,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9906, 353, 0, 0, 0x86,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9928, 636, 0, 0, 0x86,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9945, 636, 0, 0, 0x86,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9964, 916, 0, 0, 0x86,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9871, 916, 0, 0, 0x86,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9983, 60, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10007, 60, 0, 0, 0x88,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10029, 353, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10053, 353, 0, 0, 0x88,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10075, 636, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10099, 636, 0, 0, 0x88,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10121, 916, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10137, 916, 0, 0, 0x88,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10154, 60, 0, 0, 0x8A,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10168, 353, 0, 0, 0x8A,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10192, 353, 0, 0, 0x8A,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10217, 636, 0, 0, 0x8A,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10230, 636, 0, 0, 0x8A,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10243, 916, 0, 0, 0x8A,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10258, 10270, 0, 0, 0x8C,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10280, 60, 0, 0, 0x8C,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10292, 353, 0, 0, 0x8C,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10304, 10316, 0, 0, 0x8C,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10326, 636, 0, 0, 0x8C,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10338, 60, 0, 0, 0x8E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10356, 60, 0, 0, 0x8E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10377, 353, 0, 0, 0x8E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10391, 353, 0, 0, 0x8E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10413, 636, 0, 0, 0x8E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10427, 636, 0, 0, 0x8E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10448, 916, 0, 0, 0x8E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10467, 10270, 0, 0, 0x90,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10479, 60, 0, 0, 0x90,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10496, 353, 0, 0, 0x90,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10514, 60, 0, 0, 0x92,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10533, 60, 0, 0, 0x92,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10552, 353, 0, 0, 0x92,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10570, 353, 0, 0, 0x92,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10588, 636, 0, 0, 0x92,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10606, 636, 0, 0, 0x92,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9660, 60, 0, 0, 0x9E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9687, 60, 0, 0, 0x9E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {9674, 353, 0, 0, 0x9E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {9701, 353, 0, 0, 0x9E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10634, 636, 0, 0, 0x9E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10649, 636, 0, 0, 0x9E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10666, 916, 0, 0, 0x9E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10686, 916, 0, 0, 0x9E,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10703, 60, 0, 0, 0xA0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7352, 60, 0, 0, 0xA0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10720, 353, 0, 0, 0xA0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10733, 353, 0, 0, 0xA0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10746, 10769, 0, 0, 0xA0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10773, 10769, 0, 0, 0xA0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10797, 10818, 0, 0, 0xA0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10822, 10818, 0, 0, 0xA0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10844, 353, 0, 0, 0xA2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10857, 353, 0, 0, 0xA2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10871, 636, 0, 0, 0xA2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10887, 636, 0, 0, 0xA2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10904, 916, 0, 0, 0xA2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10921, 916, 0, 0, 0xA2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10939, 60, 0, 0, 0xA4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10949, 60, 0, 0, 0xA4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10960, 353, 0, 0, 0xA4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {10973, 353, 0, 0, 0xA4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {10987, 636, 0, 0, 0xA4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11000, 636, 0, 0, 0xA4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11011, 916, 0, 0, 0xA4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11026, 60, 0, 0, 0xA6,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11038, 60, 0, 0, 0xA6,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11057, 353, 0, 0, 0xA6,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11074, 353, 0, 0, 0xA6,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11087, 636, 0, 0, 0xA6,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11103, 636, 0, 0, 0xA6,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11119, 916, 0, 0, 0xA6,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11136, 916, 0, 0, 0xA6,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11154, 60, 0, 0, 0xA8,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11169, 353, 0, 0, 0xA8,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11185, 353, 0, 0, 0xA8,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11198, 636, 0, 0, 0xA8,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11207, 636, 0, 0, 0xA8,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11218, 916, 0, 0, 0xA8,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11228, 916, 0, 0, 0xA8,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11239, 60, 0, 0, 0xAA,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11260, 60, 0, 0, 0xAA,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11281, 353, 0, 0, 0xAA,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11299, 353, 0, 0, 0xAA,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11317, 636, 0, 0, 0xAA,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11333, 636, 0, 0, 0xAA,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11349, 916, 0, 0, 0xAA,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11365, 916, 0, 0, 0xAA,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11381, 60, 0, 0, 0xAC,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11396, 60, 0, 0, 0xAC,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11411, 353, 0, 0, 0xAC,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11426, 353, 0, 0, 0xAC,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11441, 10316, 0, 0, 0xAC,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11456, 10316, 0, 0, 0xAC,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11471, 60, 0, 0, 0xAE,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11487, 60, 0, 0, 0xAE,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11503, 353, 0, 0, 0xAE,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11519, 353, 0, 0, 0xAE,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11535, 636, 0, 0, 0xAE,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11551, 636, 0, 0, 0xAE,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11567, 916, 0, 0, 0xAE,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11583, 916, 0, 0, 0xAE,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11599, 60, 0, 0, 0xB0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11618, 60, 0, 0, 0xB0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11637, 353, 0, 0, 0xB0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11655, 353, 0, 0, 0xB0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11673, 636, 0, 0, 0xB0,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11691, 636, 0, 0, 0xB0,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11709, 60, 0, 0, 0xB2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11733, 60, 0, 0, 0xB2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11757, 353, 0, 0, 0xB2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11781, 353, 0, 0, 0xB2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11803, 636, 0, 0, 0xB2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11829, 636, 0, 0, 0xB2,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11856, 916, 0, 0, 0xB2,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11878, 60, 0, 0, 0xB4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11895, 60, 0, 0, 0xB4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11912, 353, 0, 0, 0xB4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11929, 353, 0, 0, 0xB4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11946, 636, 0, 0, 0xB4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11961, 636, 0, 0, 0xB4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11946, 916, 0, 0, 0xB4,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11961, 916, 0, 0, 0xB4,0x68,0,0,EVENT_OPTION_NONE_MASK}
+, {11976, 10270, 0, 0, 0xB6,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {11991, 60, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12016, 60, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12036, 60, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12056, 60, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12079, 60, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12105, 60, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12127, 60, 0, 0, 0x5C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12145, 60, 0, 0, 0x50,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12165, 60, 0, 0, 0x52,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12184, 60, 0, 0, 0x54,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12199, 60, 0, 0, 0x56,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12231, 60, 0, 0, 0x5A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 60, 0, 0, 0x5C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12284, 60, 0, 0, 0x64,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12315, 60, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12333, 353, 0, 0, 0x10,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12352, 353, 0, 0, 0x12,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12379, 353, 0, 0, 0x14,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12407, 353, 0, 0, 0x16,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12428, 353, 0, 0, 0x18,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12457, 353, 0, 0, 0x1A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12476, 353, 0, 0, 0x1C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12504, 353, 0, 0, 0x1E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {12532, 353, 0, 0, 0x12,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12551, 353, 0, 0, 0x14,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12575, 353, 0, 0, 0x16,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12594, 353, 0, 0, 0x18,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12619, 353, 0, 0, 0x1A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12641, 353, 0, 0, 0x1C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12661, 353, 0, 0, 0x1E,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {12690, 353, 0, 0, 0x18,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12713, 353, 0, 0, 0x1A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12743, 353, 0, 0, 0x1C,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12764, 353, 0, 0, 0x1E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {12789, 636, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12813, 636, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12839, 636, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12857, 636, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12886, 636, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12910, 636, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12942, 636, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12968, 636, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12995, 636, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13021, 636, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13046, 636, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13073, 636, 0, 0, 0x5A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13096, 636, 0, 0, 0x5C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13116, 636, 0, 0, 0x56,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13141, 636, 0, 0, 0x58,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13171, 636, 0, 0, 0x5C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13193, 636, 0, 0, 0x52,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13213, 916, 0, 0, 0x10,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13243, 916, 0, 0, 0x12,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13268, 916, 0, 0, 0x14,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13292, 916, 0, 0, 0x16,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13327, 916, 0, 0, 0x1A,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13355, 916, 0, 0, 0x1C,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13377, 916, 0, 0, 0x1E,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {13399, 916, 0, 0, 0x14,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13426, 916, 0, 0, 0x16,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13448, 916, 0, 0, 0x18,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13467, 916, 0, 0, 0x1A,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13488, 916, 0, 0, 0x1C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13517, 916, 0, 0, 0x1E,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13540, 916, 0, 0, 0x10,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13564, 916, 0, 0, 0x12,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13587, 916, 0, 0, 0x16,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13611, 916, 0, 0, 0x18,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13639, 916, 0, 0, 0x1A,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13663, 916, 0, 0, 0x5C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13682, 916, 0, 0, 0x14,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13705, 353, 0, 0, 0x52,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13718, 636, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13731, 60, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13751, 353, 0, 0, 0x12,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13773, 916, 0, 0, 0x5E,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {13797, 578, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13810, 60, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13823, 916, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13835, 353, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13852, 916, 0, 0, 0x10,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13866, 916, 0, 0, 0x2C,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13881, 636, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13898, 60, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13912, 636, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13927, 916, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13944, 916, 0, 0, 0x12,0xD0,0,0,EVENT_OPTION_NONE_MASK}
+, {13958, 60, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13973, 60, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13990, 636, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14004, 60, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14019, 60, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14036, 636, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14053, 353, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14070, 636, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14087, 916, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14105, 60, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14123, 353, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14141, 636, 0, 0, 0xEA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14160, 916, 0, 0, 0xAC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14179, 60, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14198, 60, 0, 0, 0xEC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14212, 916, 0, 0, 0x6E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14230, 353, 0, 0, 0x54,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {14244, 578, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14244, 60, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {0, 353, 0, 0, 0xF4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14251, 60, 0, 0, 0xFA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14271, 353, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14291, 353, 0, 0, 0x6C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14312, 353, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14322, 353, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14333, 916, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14344, 636, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14357, 636, 0, 0, 0x6E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14373, 636, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14389, 916, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14407, 14428, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14434, 14455, 0, 0, 0x70,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14461, 14482, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14488, 14509, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14515, 14536, 0, 0, 0x68,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14542, 14563, 0, 0, 0x80,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14569, 14590, 0, 0, 0x98,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14596, 14617, 0, 0, 0xB0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14623, 14428, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14642, 14455, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14661, 14482, 0, 0, 0x78,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14680, 14509, 0, 0, 0x90,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14699, 14536, 0, 0, 0x58,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14718, 14563, 0, 0, 0x70,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14737, 14590, 0, 0, 0x88,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14756, 14617, 0, 0, 0xA0,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14775, 14428, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14795, 14455, 0, 0, 0x68,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14815, 14482, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14835, 14509, 0, 0, 0x98,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14855, 14536, 0, 0, 0x60,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14875, 14563, 0, 0, 0x78,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14895, 14590, 0, 0, 0x90,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14915, 14617, 0, 0, 0xA8,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {14935, 14957, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14963, 14957, 0, 0, 0x78,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14984, 15007, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15013, 15007, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15035, 15058, 0, 0, 0x98,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15064, 15058, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15086, 14957, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15113, 14957, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15139, 15007, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15167, 15007, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15194, 15058, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15222, 15058, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15249, 14957, 0, 0, 0x68,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15278, 14957, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15306, 15007, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15336, 15007, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15365, 15058, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15395, 15058, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15424, 14957, 0, 0, 0x70,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15453, 14957, 0, 0, 0x90,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15481, 15007, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15511, 15007, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15540, 15058, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15570, 15058, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15599, 15619, 0, 0, 0x8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15624, 15619, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15645, 15619, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15668, 15619, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15689, 15619, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15713, 15619, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15738, 15619, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15765, 15619, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15790, 15619, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15800, 15619, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15818, 15619, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15837, 15619, 0, 0, 0x98,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15858, 15619, 0, 0, 0xA0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15877, 15619, 0, 0, 0xA8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15897, 15619, 0, 0, 0xB0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15917, 15619, 0, 0, 0xB8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15932, 15619, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15955, 15619, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15966, 16000, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16006, 16040, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16046, 16000, 0, 0, 0xD0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16074, 16040, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16102, 16000, 0, 0, 0xD8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16130, 16040, 0, 0, 0x58,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16158, 16000, 0, 0, 0xE0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16191, 16040, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16224, 16000, 0, 0, 0xE8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16258, 16040, 0, 0, 0x68,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16292, 16000, 0, 0, 0xF0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16320, 16040, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16348, 16000, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16376, 16040, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable power9_arch_events = {
+    NUM_ARCH_EVENTS_POWER9,
+    power9_arch_event_strings,
+    power9_arch_event_options,
+    power9_arch_event_entries
+};
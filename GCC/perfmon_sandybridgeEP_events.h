@@ -0,0 +1,1663 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_SANDYBRIDGEEP 788
+
+static const char sandybridgeEP_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LOAD_BLOCKS_DATA_UNKNOWN\0"
+    "PMC\0"
+    "LOAD_BLOCKS_STORE_FORWARD\0"
+    "LOAD_BLOCKS_NO_SR\0"
+    "LOAD_BLOCKS_ALL_BLOCK\0"
+    "MISALIGN_MEM_REF_LOAD\0"
+    "MISALIGN_MEM_REF_STORE\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "LD_BLOCKS_PARTIAL_ALL_STA_BLOCK\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RAT_STALL_CYCLES\0"
+    "INT_MISC_RAT_STALL_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_DOUBLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_DOUBLE\0"
+    "SIMD_FP_256_PACKED_SINGLE\0"
+    "SIMD_FP_256_PACKED_DOUBLE\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_NUM_DIV\0"
+    "INSTS_WRITTEN_TO_IQ_INSTS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_RFO_HITS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_ANY\0"
+    "L2_RQSTS_CODE_RD_HITS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_CODE_CODE_RD\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_HIT_E\0"
+    "L2_STORE_LOCK_RQSTS_HIT_M\0"
+    "L2_STORE_LOCK_RQSTS_ALL\0"
+    "L1D_WB_RQST_HIT_E\0"
+    "L1D_WB_RQST_HIT_M\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC1\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "HW_PRE_REQ_DL1_MISS\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "PARTIAL_RAT_STALLS_FLAGS_MERGE_UOP\0"
+    "PARTIAL_RAT_STALLS_SLOW_LEA_WINDOW\0"
+    "PARTIAL_RAT_STALLS_MUL_SINGLE_UOP\0"
+    "RESOURCE_STALLS2_ALL_FL_EMPTY\0"
+    "RESOURCE_STALLS2_ALL_PRF_CONTROL\0"
+    "RESOURCE_STALLS2_BOB_FULL\0"
+    "RESOURCE_STALLS2_OOO_RSRC\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ALL_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LB\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "RESOURCE_STALLS_FCSW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_DISPATCH\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "PMC2\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB_FILL_OTHER_CANCEL\0"
+    "DSB_FILL_EXCEED_DSB_LINES\0"
+    "DSB_FILL_ALL_CANCEL\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "AGU_BYPASS_CANCEL_COUNT\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "L1D_BLOCKS_BANK_CONFLICT_CYCLES\0"
+    "L1D_BLOCKS_BANK_CONFLICT_COUNT\0"
+    "INST_RETIRED_ANY_P\0"
+    "PMC0\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "OTHER_ASSISTS_ITLB_MISS_RETIRED\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "BR_MISP_RETIRED_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_TAKEN\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_UOPS_LLC_MISS_RETIRED_REMOTE_DRAM\0"
+    "MEM_LOAD_UOPS_MISC_RETIRED_LLC_MISS\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PREF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PF_CLEAN\0"
+    "L2_LINES_OUT_PF_DIRTY\0"
+    "L2_LINES_OUT_DIRTY_ALL\0"
+    "L2_LINES_OUT_CLEAN_ALL\0"
+    "L2_LINES_OUT_ALL\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_0_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_1_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CBOX_CLOCKTICKS\0"
+    "CBOX\0"
+    "COUNTER0_OCCUPANCY\0"
+    "CBOX0C1|CBOX0C2|CBOX0C3|CBOX1C1|CBOX1C2|CBOX1C3|CBOX2C1|CBOX2C2|CBOX2C3|CBOX3C1|CBOX03C2|CBOX3C3|CBOX4C1|CBOX4C2|CBOX4C3|CBOX5C1|CBOX5C2|CBOX5C3|CBOX6C1|CBOX6C2|CBOX6C3|CBOX7C1|CBOX7C2|CBOX7C3\0"
+    "ISMQ_DRD_MISS_OCC\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX0C1|CBOX1C1|CBOX2C1|CBOX3C1|CBOX4C1|CBOX5C1|CBOX6C1|CBOX7C1\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_DATA_READ_AND_ALL\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_NID\0"
+    "LLC_VICTIMS_M_STATE\0"
+    "LLC_VICTIMS_E_STATE\0"
+    "LLC_VICTIMS_S_STATE\0"
+    "LLC_VICTIMS_MISS\0"
+    "LLC_VICTIMS_ALL_STATES\0"
+    "LLC_VICTIMS_NID\0"
+    "LLC_VICTIMS_NID_MISSES\0"
+    "CBOX_MISC_RSPI_WAS_FSE\0"
+    "CBOX_MISC_WC_ALIASING\0"
+    "CBOX_MISC_STARTED\0"
+    "CBOX_MISC_RFO_HIT_S\0"
+    "RING_AD_USED_UP_EVEN\0"
+    "CBOX0C2|CBOX1C2|CBOX2C2|CBOX3C2|CBOX4C2|CBOX5C2|CBOX6C2|CBOX7C2|CBOX0C3|CBOX1C3|CBOX2C3|CBOX3C3|CBOX4C3|CBOX5C3|CBOX6C3|CBOX7C3\0"
+    "RING_AD_USED_UP_ODD\0"
+    "RING_AD_USED_DOWN_EVEN\0"
+    "RING_AD_USED_DOWN_ODD\0"
+    "RING_AK_USED_UP_EVEN\0"
+    "RING_AK_USED_UP_ODD\0"
+    "RING_AK_USED_DOWN_EVEN\0"
+    "RING_AK_USED_DOWN_ODD\0"
+    "RING_BL_USED_UP_EVEN\0"
+    "RING_BL_USED_UP_ODD\0"
+    "RING_BL_USED_DOWN_EVEN\0"
+    "RING_BL_USED_DOWN_ODD\0"
+    "RING_BOUNCES_AK_CORE\0"
+    "RING_BOUNCES_BL_CORE\0"
+    "RING_BOUNCES_IV_CORE\0"
+    "RING_IV_USED_ANY\0"
+    "RING_SRC_THRTL\0"
+    "RXR_EXT_STARVED_IRQ\0"
+    "RXR_EXT_STARVED_IPQ\0"
+    "RXR_EXT_STARVED_ISMQ\0"
+    "RXR_EXT_STARVED_ISMQ_BIDS\0"
+    "RXR_INSERTS_IRQ\0"
+    "RXR_INSERTS_IRQ_REJECTED\0"
+    "RXR_INSERTS_IPQ\0"
+    "RXR_INSERTS_VFIFO\0"
+    "RXR_IPQ_RETRY_ANY\0"
+    "RXR_IPQ_RETRY_FULL\0"
+    "RXR_IPQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IPQ_RETRY_QPI_CREDITS\0"
+    "RXR_IRQ_RETRY_ANY\0"
+    "RXR_IRQ_RETRY_FULL\0"
+    "RXR_IRQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_IRQ_RETRY_RTID\0"
+    "RXR_IRQ_RETRY_QPI_CREDITS\0"
+    "RXR_ISMQ_RETRY_ANY\0"
+    "RXR_ISMQ_RETRY_FULL\0"
+    "RXR_ISMQ_RETRY_ADDR_CONFLICT\0"
+    "RXR_ISMQ_RETRY_RTID\0"
+    "RXR_ISMQ_RETRY_QPI_CREDITS\0"
+    "RXR_OCCUPANCY_IRQ\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0\0"
+    "RXR_OCCUPANCY_IRQ_REJECTED\0"
+    "RXR_OCCUPANCY_IPQ\0"
+    "RXR_OCCUPANCY_VIFO\0"
+    "TOR_INSERTS_OPCODE\0"
+    "TOR_INSERTS_EVICTION\0"
+    "TOR_INSERTS_WB\0"
+    "TOR_INSERTS_MISS_OPCODE\0"
+    "TOR_INSERTS_MISS_ALL\0"
+    "TOR_INSERTS_NID_OPCODE\0"
+    "TOR_INSERTS_NID_EVICTION\0"
+    "TOR_INSERTS_NID_ALL\0"
+    "TOR_INSERTS_NID_WB\0"
+    "TOR_INSERTS_NID_MISS_OPCODE\0"
+    "TOR_INSERTS_NID_MISS_ALL\0"
+    "TOR_OCCUPANCY_OPCODE\0"
+    "TOR_OCCUPANCY_EVICTION\0"
+    "TOR_OCCUPANCY_ALL\0"
+    "TOR_OCCUPANCY_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_MISS_ALL\0"
+    "TOR_OCCUPANCY_NID_OPCODE\0"
+    "TOR_OCCUPANCY_NID_EVICTION\0"
+    "TOR_OCCUPANCY_NID_ALL\0"
+    "TOR_OCCUPANCY_NID_MISS_OPCODE\0"
+    "TOR_OCCUPANCY_NID_MISS_ALL\0"
+    "TXT_ADS_USED\0"
+    "TXT_INSERTS_AD_CACHE\0"
+    "TXT_INSERTS_AK_CACHE\0"
+    "TXT_INSERTS_BL_CACHE\0"
+    "TXT_INSERTS_IV_CACHE\0"
+    "TXT_INSERTS_AD_CORE\0"
+    "TXT_INSERTS_AK_CORE\0"
+    "TXT_INSERTS_BL_CORE\0"
+    "BBOX_CLOCKTICKS\0"
+    "BBOX\0"
+    "CONFLICT_CYCLES_NO_CONFLICT\0"
+    "CONFLICT_CYCLES_CONFLICT\0"
+    "DIRECT2CORE_COUNT\0"
+    "DIRECT2CORE_CYCLES_DISABLED\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECTORY_LOOKUP_SNP\0"
+    "DIRECTORY_LOOKUP_NO_SNP\0"
+    "DIRECTORY_UPDATE_SET\0"
+    "DIRECTORY_UPDATE_CLEAR\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_AD_QPI1\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI0\0"
+    "IGR_NO_CREDIT_CYCLES_BL_QPI1\0"
+    "IMC_RETRY\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "RPQ_CYCLES_NO_REG_CREDITS_ALL\0"
+    "TAD_REQUESTS_G0_REGION_0\0"
+    "TAD_REQUESTS_G0_REGION_1\0"
+    "TAD_REQUESTS_G0_REGION_2\0"
+    "TAD_REQUESTS_G0_REGION_3\0"
+    "TAD_REQUESTS_G0_REGION_4\0"
+    "TAD_REQUESTS_G0_REGION_5\0"
+    "TAD_REQUESTS_G0_REGION_6\0"
+    "TAD_REQUESTS_G0_REGION_7\0"
+    "TAD_REQUESTS_G1_REGION_8\0"
+    "TAD_REQUESTS_G1_REGION_9\0"
+    "TAD_REQUESTS_G1_REGION_10\0"
+    "TAD_REQUESTS_G1_REGION_11\0"
+    "TRACKER_INSERTS_ALL\0"
+    "TXR_AD_NDR\0"
+    "TXR_AD_SNP\0"
+    "TXR_AD_CYCLES_FULL_SCHED0\0"
+    "TXR_AD_CYCLES_FULL_SCHED1\0"
+    "TXR_AD_CYCLES_FULL_ALL\0"
+    "TXR_AK_CYCLES_FULL_SCHED0\0"
+    "TXR_AK_CYCLES_FULL_SCHED1\0"
+    "TXR_AK_CYCLES_FULL_ALL\0"
+    "TXR_AK_NDR\0"
+    "TXR_BL_DRS_CACHE\0"
+    "TXR_BL_DRS_CORE\0"
+    "TXR_BL_DRS_QPI\0"
+    "TXR_BL_CYCLES_FULL_SCHED0\0"
+    "TXR_BL_CYCLES_FULL_SCHED1\0"
+    "TXR_BL_CYCLES_FULL_ALL\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_NO_REG_CREDITS_CHN3\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX3FIX\0"
+    "ACT_COUNT\0"
+    "MBOX\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_ALL\0"
+    "DRAM_PRE_ALL\0"
+    "DRAM_REFRESH_PANIC\0"
+    "DRAM_REFRESH_HIGH\0"
+    "ECC_CORRECTABLE_ERRORS\0"
+    "MAJOR_MODES_READ\0"
+    "MAJOR_MODES_WRITE\0"
+    "MAJOR_MODES_PARTIAL\0"
+    "MAJOR_MODES_ISOCH\0"
+    "POWER_CHANNEL_DLLOFF\0"
+    "POWER_CHANNEL_PPD\0"
+    "POWER_CKE_CYCLES_RANK0\0"
+    "POWER_CKE_CYCLES_RANK1\0"
+    "POWER_CKE_CYCLES_RANK2\0"
+    "POWER_CKE_CYCLES_RANK3\0"
+    "POWER_CKE_CYCLES_RANK4\0"
+    "POWER_CKE_CYCLES_RANK5\0"
+    "POWER_CKE_CYCLES_RANK6\0"
+    "POWER_CKE_CYCLES_RANK7\0"
+    "POWER_CRITICAL_THROTTLE_CYCLES\0"
+    "POWER_SELF_REFRESH\0"
+    "POWER_THROTTLE_CYCLES_RANK0\0"
+    "POWER_THROTTLE_CYCLES_RANK1\0"
+    "POWER_THROTTLE_CYCLES_RANK2\0"
+    "POWER_THROTTLE_CYCLES_RANK3\0"
+    "POWER_THROTTLE_CYCLES_RANK4\0"
+    "POWER_THROTTLE_CYCLES_RANK5\0"
+    "POWER_THROTTLE_CYCLES_RANK6\0"
+    "POWER_THROTTLE_CYCLES_RANK7\0"
+    "PREEMPTION_RD_PREEMPT_RD\0"
+    "PREEMPTION_RD_PREEMPT_WR\0"
+    "PRE_COUNT_PAGE_MISS\0"
+    "PRE_COUNT_PAGE_CLOSE\0"
+    "RPQ_CYCLES_FULL\0"
+    "RPQ_CYCLES_NE\0"
+    "RPQ_INSERTS\0"
+    "RPQ_OCCUPANCY\0"
+    "WPQ_CYCLES_FULL\0"
+    "WPQ_CYCLES_NE\0"
+    "WPQ_INSERTS\0"
+    "WPQ_OCCUPANCY\0"
+    "WPQ_READ_HIT\0"
+    "WPQ_WRITE_HIT\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE0_TRANSITION_CYCLES\0"
+    "CORE1_TRANSITION_CYCLES\0"
+    "CORE2_TRANSITION_CYCLES\0"
+    "CORE3_TRANSITION_CYCLES\0"
+    "CORE4_TRANSITION_CYCLES\0"
+    "CORE5_TRANSITION_CYCLES\0"
+    "CORE6_TRANSITION_CYCLES\0"
+    "CORE7_TRANSITION_CYCLES\0"
+    "DEMOTIONS_CORE0\0"
+    "DEMOTIONS_CORE1\0"
+    "DEMOTIONS_CORE2\0"
+    "DEMOTIONS_CORE3\0"
+    "DEMOTIONS_CORE4\0"
+    "DEMOTIONS_CORE5\0"
+    "DEMOTIONS_CORE6\0"
+    "DEMOTIONS_CORE7\0"
+    "FREQ_BAND0_CYCLES\0"
+    "FREQ_BAND1_CYCLES\0"
+    "FREQ_BAND2_CYCLES\0"
+    "FREQ_BAND3_CYCLES\0"
+    "FREQ_MAX_CURRENT_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MAX_OS_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_MIN_PERF_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "POWER_STATE_OCCUPANCY_CORES_C0\0"
+    "POWER_STATE_OCCUPANCY_CORES_C3\0"
+    "POWER_STATE_OCCUPANCY_CORES_C6\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VOLT_TRANS_CYCLES_CHANGE\0"
+    "VOLT_TRANS_CYCLES_DECREASE\0"
+    "VOLT_TRANS_CYCLES_INCREASE\0"
+    "VR_HOT_CYCLES\0"
+    "CORES_IN_C3\0"
+    "WBOXFIX0\0"
+    "CORES_IN_C6\0"
+    "WBOXFIX1\0"
+    "SBOX_CLOCKTICKS\0"
+    "SBOX\0"
+    "CTO_COUNT\0"
+    "DIRECT2CORE_SUCCESS\0"
+    "DIRECT2CORE_FAILURE_CREDITS\0"
+    "DIRECT2CORE_FAILURE_RBT\0"
+    "DIRECT2CORE_FAILURE_CREDIRTS_RBT\0"
+    "L1_POWER_CYCLES\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_BYPASSED\0"
+    "RXL_CREDITS_CONSUMED_VN0_DRS\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCB\0"
+    "RXL_CREDITS_CONSUMED_VN0_NCS\0"
+    "RXL_CREDITS_CONSUMED_VN0_HOM\0"
+    "RXL_CREDITS_CONSUMED_VN0_SNP\0"
+    "RXL_CREDITS_CONSUMED_VN0_NDR\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_FLITS_G0_IDLE\0"
+    "RXL_FLITS_G0_DATA\0"
+    "RXL_FLITS_G0_NON_DATA\0"
+    "RXL_FLITS_G1_SNP\0"
+    "RXL_FLITS_G1_HOM_REQ\0"
+    "RXL_FLITS_G1_HOM_NONREQ\0"
+    "RXL_FLITS_G1_HOM\0"
+    "RXL_FLITS_G1_DRS_DATA\0"
+    "RXL_FLITS_G1_DRS_NONDATA\0"
+    "RXL_FLITS_G1_DRS\0"
+    "RXL_FLITS_G2_NDR_AD\0"
+    "RXL_FLITS_G2_NDR_AK\0"
+    "RXL_FLITS_G2_NCB_DATA\0"
+    "RXL_FLITS_G2_NCB_NODATA\0"
+    "RXL_FLITS_G2_NCB\0"
+    "RXL_FLITS_G2_NCS\0"
+    "RXL_INSERTS\0"
+    "RXL_INSERTS_DRS\0"
+    "RXL_INSERTS_HOM\0"
+    "RXL_INSERTS_NCB\0"
+    "RXL_INSERTS_NCS\0"
+    "RXL_INSERTS_NDR\0"
+    "RXL_INSERTS_SNP\0"
+    "RXL_OCCUPANCY\0"
+    "RXL_OCCUPANCY_DRS\0"
+    "RXL_OCCUPANCY_HOM\0"
+    "RXL_OCCUPANCY_NCB\0"
+    "RXL_OCCUPANCY_NCS\0"
+    "RXL_OCCUPANCY_NDR\0"
+    "RXL_OCCUPANCY_SNP\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BYPASSED\0"
+    "TXL_CYCLES_NE\0"
+    "TXL_FLITS_G0_IDLE\0"
+    "TXL_FLITS_G0_DATA\0"
+    "TXL_FLITS_G0_NON_DATA\0"
+    "TXL_FLITS_G1_SNP\0"
+    "TXL_FLITS_G1_HOM_REQ\0"
+    "TXL_FLITS_G1_HOM_NONREQ\0"
+    "TXL_FLITS_G1_HOM\0"
+    "TXL_FLITS_G1_DRS_DATA\0"
+    "TXL_FLITS_G1_DRS_NONDATA\0"
+    "TXL_FLITS_G1_DRS\0"
+    "TXL_FLITS_G2_NDR_AD\0"
+    "TXL_FLITS_G2_NDR_AK\0"
+    "TXL_FLITS_G2_NCB_DATA\0"
+    "TXL_FLITS_G2_NCB_NODATA\0"
+    "TXL_FLITS_G2_NCB\0"
+    "TXL_FLITS_G2_NCS\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY\0"
+    "VNA_CREDIT_RETURNS\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "QPI_RATE\0"
+    "SBOX0FIX|SBOX1FIX\0"
+    "QPI_SLOW_MODE\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "RING_AD_USED_CW_EVEN\0"
+    "PBOX|RBOX\0"
+    "RING_AD_USED_CW_ODD\0"
+    "RING_AD_USED_CCW_EVEN\0"
+    "RING_AD_USED_CCW_ODD\0"
+    "RING_AK_USED_CW_EVEN\0"
+    "RING_AK_USED_CW_ODD\0"
+    "RING_AK_USED_CCW_EVEN\0"
+    "RING_AK_USED_CCW_ODD\0"
+    "RING_BL_USED_CW_EVEN\0"
+    "RING_BL_USED_CW_ODD\0"
+    "RING_BL_USED_CCW_EVEN\0"
+    "RING_BL_USED_CCW_ODD\0"
+    "R2PCIE_RXR_AK_BOUNCES\0"
+    "PBOX0\0"
+    "R2PCIE_RXR_CYCLES_NE_DRS\0"
+    "PBOX0|PBOX1\0"
+    "R2PCIE_RXR_CYCLES_NE_NCB\0"
+    "R2PCIE_RXR_CYCLES_NE_NCS\0"
+    "R2PCIE_TXR_CYCLES_FULL_AD\0"
+    "R2PCIE_TXR_CYCLES_FULL_AK\0"
+    "R2PCIE_TXR_CYCLES_FULL_BL\0"
+    "R2PCIE_TXR_CYCLES_NE_AD\0"
+    "R2PCIE_TXR_CYCLES_NE_AK\0"
+    "R2PCIE_TXR_CYCLES_NE_BL\0"
+    "R2PCIE_TXR_INSERTS\0"
+    "RBOX_CLOCKTICKS\0"
+    "RBOX\0"
+    "IIO_CREDITS_ACQUIRED_DRS\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1\0"
+    "IIO_CREDITS_ACQUIRED_NCB\0"
+    "IIO_CREDITS_ACQUIRED_NCS\0"
+    "IIO_CREDITS_REJECT_DRS\0"
+    "IIO_CREDITS_REJECT_NCB\0"
+    "IIO_CREDITS_REJECT_NCS\0"
+    "IIO_CREDITS_USED_DRS\0"
+    "IIO_CREDITS_USED_NCB\0"
+    "IIO_CREDITS_USED_NCS\0"
+    "RXR_BYPASSED\0"
+    "R3QPI_RXR_CYCLES_NE_HOM\0"
+    "R3QPI_RXR_CYCLES_NE_SNP\0"
+    "R3QPI_RXR_CYCLES_NE_NDR\0"
+    "R3QPI_RXR_CYCLES_NE_DRS\0"
+    "R3QPI_RXR_CYCLES_NE_NCB\0"
+    "R3QPI_RXR_CYCLES_NE_NCS\0"
+    "R3QPI_RXR_INSERTS_HOM\0"
+    "R3QPI_RXR_INSERTS_SNP\0"
+    "R3QPI_RXR_INSERTS_NDR\0"
+    "R3QPI_RXR_INSERTS_DRS\0"
+    "R3QPI_RXR_INSERTS_NCB\0"
+    "R3QPI_RXR_INSERTS_NCS\0"
+    "RXR_OCCUPANCY_HOM\0"
+    "RBOX0C0|RBOX1C0\0"
+    "RXR_OCCUPANCY_SNP\0"
+    "RXR_OCCUPANCY_NDR\0"
+    "RXR_OCCUPANCY_DRS\0"
+    "RXR_OCCUPANCY_NCB\0"
+    "RXR_OCCUPANCY_NCS\0"
+    "R3QPI_TXR_CYCLES_FULL\0"
+    "R3QPI_TXR_CYCLES_NE\0"
+    "TXR_INSERTS_HOM\0"
+    "RBOX0C0|RBOX0C1|RBOX1C0|RBOX1C1|PBOX0\0"
+    "TXR_INSERTS_SNP\0"
+    "TXR_INSERTS_NDR\0"
+    "TXR_INSERTS_DRS\0"
+    "TXR_INSERTS_NCB\0"
+    "TXR_INSERTS_NCS\0"
+    "TXR_NACK\0"
+    "VN0_CREDITS_REJECT_HOM\0"
+    "VN0_CREDITS_REJECT_SNP\0"
+    "VN0_CREDITS_REJECT_NDR\0"
+    "VN0_CREDITS_REJECT_DRS\0"
+    "VN0_CREDITS_REJECT_NCB\0"
+    "VN0_CREDITS_REJECT_NCS\0"
+    "VN0_CREDITS_USED_HOM\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_NDR\0"
+    "VN0_CREDITS_USED_DRS\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VNA_CREDITS_ACQUIRED\0"
+    "VNA_CREDITS_REJECT_HOM\0"
+    "VNA_CREDITS_REJECT_SNP\0"
+    "VNA_CREDITS_REJECT_NDR\0"
+    "VNA_CREDITS_REJECT_DRS\0"
+    "VNA_CREDITS_REJECT_NCB\0"
+    "VNA_CREDITS_REJECT_NCS\0"
+    "VNA_CREDITS_CYCLES_OUT\0"
+    "VNA_CREDITS_CYCLES_USED\0"
+    "EVENT_MSG_VLW_RCVD\0"
+    "UBOX\0"
+    "EVENT_MSG_MSI_RCVD\0"
+    "EVENT_MSG_IPI_RCVD\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "EVENT_MSG_INT_PRIO\0"
+    "LOCK_CYCLES\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0";
+
+static const PerfmonEventOption sandybridgeEP_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x78040}
+, {EVENT_OPTION_MATCH0,0x08FFF}
+, {EVENT_OPTION_MATCH1,0x7FF80}
+, {EVENT_OPTION_STATE,0x1}
+};
+
+static const PerfmonEventEntry sandybridgeEP_arch_event_entries[NUM_ARCH_EVENTS_SANDYBRIDGEEP] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 218, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {222, 218, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {248, 218, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {266, 218, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {288, 218, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 218, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 218, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {354, 218, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {386, 218, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 218, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {449, 218, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {481, 218, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {512, 218, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {537, 218, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {561, 218, 0, 0, 0x0D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {587, 218, 3, 1, 0x0D,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {612, 218, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {628, 218, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {652, 218, 4, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {677, 218, 6, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {702, 218, 8, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {731, 218, 10, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {761, 218, 13, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {791, 218, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {825, 218, 16, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {859, 218, 17, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {893, 218, 18, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {927, 218, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {947, 218, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {984, 218, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1021, 218, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1058, 218, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1095, 218, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1121, 218, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1147, 218, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1168, 218, 1, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1182, 218, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1208, 218, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1240, 218, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1273, 218, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1301, 218, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1319, 218, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1337, 218, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1354, 218, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1376, 218, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1398, 218, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1424, 218, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1440, 218, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1457, 218, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1473, 218, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1487, 218, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1512, 218, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 218, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1564, 218, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1588, 218, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1606, 218, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1624, 218, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1647, 218, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1665, 218, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1693, 218, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1718, 218, 19, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1750, 1772, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1777, 218, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1809, 218, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1842, 218, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1874, 218, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1901, 218, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1920, 218, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1939, 218, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1959, 218, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1975, 218, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1994, 218, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2006, 218, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2028, 218, 0, 0, 0x59,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2063, 218, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2098, 218, 0, 0, 0x59,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2132, 218, 0, 0, 0x5B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {2162, 218, 0, 0, 0x5B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2195, 218, 0, 0, 0x5B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2221, 218, 0, 0, 0x5B,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2247, 218, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2264, 218, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2283, 218, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 218, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2350, 218, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2394, 218, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2434, 218, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2475, 218, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2521, 218, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2559, 218, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2569, 218, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2583, 218, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2596, 218, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2612, 218, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2629, 218, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2641, 218, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2658, 218, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2676, 218, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2689, 218, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2705, 218, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2728, 218, 16, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2751, 218, 17, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2774, 218, 18, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2797, 218, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2812, 218, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2834, 218, 16, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2856, 218, 17, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2878, 218, 18, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2900, 218, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2918, 218, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2943, 218, 16, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2968, 218, 17, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2993, 218, 18, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3018, 218, 1, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3035, 218, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3054, 218, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3080, 218, 16, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3106, 218, 17, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3132, 218, 18, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3158, 218, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3172, 218, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3193, 218, 16, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3214, 218, 17, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3235, 218, 18, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3256, 218, 1, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3272, 218, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3300, 218, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3326, 218, 16, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3352, 218, 17, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3378, 218, 18, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3404, 218, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3433, 218, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3460, 218, 16, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3487, 218, 17, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3514, 218, 18, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3541, 218, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3565, 218, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3587, 218, 16, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3609, 218, 17, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3631, 218, 18, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3653, 218, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3665, 218, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3679, 218, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3695, 218, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3715, 218, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3741, 218, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3768, 218, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3794, 218, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3815, 218, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3829, 218, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3847, 218, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3871, 218, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3899, 218, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3929, 218, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3963, 218, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4008, 218, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4057, 218, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4088, 218, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4123, 218, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4159, 218, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4199, 218, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4237, 218, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4279, 218, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4305, 218, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4329, 218, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4357, 218, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4402, 218, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4451, 218, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4482, 218, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4517, 218, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4553, 218, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4593, 218, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4631, 218, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4673, 218, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4699, 218, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4727, 218, 18, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4775, 218, 17, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4825, 218, 16, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4875, 218, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4925, 218, 4, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4965, 218, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4993, 218, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5021, 218, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5052, 218, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5084, 218, 0, 0, 0xA1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5112, 218, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5143, 218, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5175, 218, 0, 0, 0xA1,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {5203, 218, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5231, 218, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5259, 218, 21, 1, 0xA1,0x83,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5297, 218, 0, 0, 0xA1,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {5329, 218, 0, 0, 0xA1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5360, 218, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5380, 218, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5399, 218, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5418, 218, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5437, 218, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5457, 218, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5478, 218, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5500, 218, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5522, 218, 22, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5555, 218, 22, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5585, 218, 23, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5618, 218, 23, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5648, 218, 24, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5682, 218, 24, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5715, 218, 18, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5743, 5777, 25, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5782, 5777, 25, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5813, 5777, 26, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5847, 5777, 26, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5878, 218, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5902, 218, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5935, 218, 0, 0, 0xAC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5957, 218, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5983, 218, 0, 0, 0xAC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {6003, 218, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6019, 218, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6051, 218, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6083, 218, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6111, 218, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6140, 218, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6161, 218, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6187, 218, 4, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6214, 218, 6, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6241, 218, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6277, 218, 16, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6313, 218, 17, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6349, 218, 18, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6385, 218, 27, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6421, 218, 28, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6457, 218, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6476, 218, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6507, 218, 4, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6539, 218, 6, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6571, 218, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6612, 218, 16, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6653, 218, 17, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6694, 218, 18, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6735, 218, 27, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6776, 218, 28, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6817, 218, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6849, 218, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6873, 218, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6895, 218, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6914, 218, 0, 1, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6946, 218, 1, 2, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {6977, 6996, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7001, 6996, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7024, 218, 0, 0, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7056, 218, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7081, 218, 0, 0, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7106, 218, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7123, 218, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7149, 218, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7174, 218, 4, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7200, 218, 6, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7226, 218, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7248, 218, 21, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7279, 218, 8, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7309, 218, 10, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7340, 218, 13, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7371, 218, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7406, 218, 16, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7441, 218, 17, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7476, 218, 18, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7511, 218, 27, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7546, 218, 28, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7581, 218, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7603, 218, 1, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {7624, 218, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7655, 218, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7674, 218, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7697, 218, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7726, 218, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7754, 218, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7780, 218, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7808, 218, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7834, 218, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7861, 218, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7888, 218, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7917, 218, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7945, 218, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7971, 218, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7997, 218, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8019, 218, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8040, 218, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8060, 218, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8082, 218, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8103, 218, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {8117, 218, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8140, 218, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8167, 218, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8190, 218, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8214, 218, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {8247, 218, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8281, 218, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8309, 218, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8338, 218, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8367, 218, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8397, 218, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8426, 218, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8456, 218, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8485, 218, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8514, 218, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8544, 218, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8573, 218, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8602, 218, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8632, 218, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8661, 218, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8691, 218, 0, 0, 0xD1,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {8717, 218, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8757, 218, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8796, 218, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8836, 218, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8876, 218, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8918, 218, 0, 0, 0xD3,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {8961, 218, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8997, 218, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9021, 218, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9034, 218, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9051, 218, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9069, 218, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9085, 218, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9102, 218, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {9117, 218, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9139, 218, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9153, 218, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9167, 218, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9181, 218, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9197, 218, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9223, 218, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9249, 218, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9271, 218, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9293, 218, 0, 0, 0xF2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {9316, 218, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9339, 218, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {9356, 218, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9375, 218, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9402, 218, 29, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9432, 218, 31, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9463, 218, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9499, 218, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9531, 218, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9567, 218, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9593, 218, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9630, 218, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9663, 218, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9700, 218, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9737, 218, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9770, 218, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9807, 218, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {9849, 218, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {9889, 218, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {9918, 218, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9945, 218, 29, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9975, 218, 31, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10006, 218, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {10042, 218, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {10074, 218, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10110, 218, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {10136, 218, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {10173, 218, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {10206, 218, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {10243, 218, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {10280, 218, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {10313, 218, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {10350, 218, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10392, 218, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10432, 218, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10461, 10477, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10482, 10501, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10694, 10712, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {10840, 10712, 33, 1, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10855, 10712, 33, 1, 0x34,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10876, 10712, 33, 1, 0x34,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10893, 10712, 33, 1, 0x34,0x7,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10922, 10712, 33, 1, 0x34,0x09,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10946, 10712, 33, 1, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_STATE_MASK}
+, {10961, 10712, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10981, 10712, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11001, 10712, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11021, 10712, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11038, 10712, 0, 0, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11061, 10712, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_NID_MASK}
+, {11077, 10712, 0, 0, 0x37,0x41,0,0,EVENT_OPTION_NID_MASK}
+, {11100, 10712, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11123, 10712, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11145, 10712, 0, 0, 0x39,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11163, 10712, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11183, 11204, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11332, 11204, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11352, 11204, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11375, 11204, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11397, 11204, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11418, 11204, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11438, 11204, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11461, 11204, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11483, 11204, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11504, 11204, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11524, 11204, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11547, 11204, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11569, 10712, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11590, 10712, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11611, 10712, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11632, 11204, 0, 0, 0x1E,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {11649, 10712, 0, 0, 0x05,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11664, 10712, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11684, 10712, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11704, 10712, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11725, 10712, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11751, 10712, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11767, 10712, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11792, 10712, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11808, 10712, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11826, 10712, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11844, 10712, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11863, 10712, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11891, 10712, 0, 0, 0x31,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11917, 10712, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11935, 10712, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11954, 10712, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11982, 10712, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12001, 10712, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12027, 10712, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12046, 10712, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12066, 10712, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12095, 10712, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12115, 10712, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12142, 12160, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12224, 12160, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12251, 12160, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12269, 12160, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12288, 10712, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {12307, 10712, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12328, 10712, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12343, 10712, 0, 0, 0x35,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {12367, 10712, 0, 0, 0x35,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {12388, 10712, 0, 0, 0x35,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {12411, 10712, 0, 0, 0x35,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12436, 10712, 0, 0, 0x35,0x48,0,0,EVENT_OPTION_NID_MASK}
+, {12456, 10712, 0, 0, 0x35,0x50,0,0,EVENT_OPTION_NID_MASK}
+, {12475, 10712, 0, 0, 0x35,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {12503, 10712, 0, 0, 0x35,0x4A,0,0,EVENT_OPTION_NONE_MASK}
+, {12528, 12160, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {12549, 12160, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12572, 12160, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12590, 12160, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_OPCODE_MASK}
+, {12616, 12160, 0, 0, 0x36,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {12639, 12160, 0, 0, 0x36,0x41,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {12664, 12160, 0, 0, 0x36,0x44,0,0,EVENT_OPTION_NID_MASK}
+, {12691, 12160, 0, 0, 0x36,0x48,0,0,EVENT_OPTION_NID_MASK}
+, {12713, 12160, 0, 0, 0x36,0x43,0,0,EVENT_OPTION_NID_MASK|EVENT_OPTION_OPCODE_MASK}
+, {12743, 12160, 0, 0, 0x36,0x4A,0,0,EVENT_OPTION_NID_MASK}
+, {12770, 10712, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12783, 10712, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12804, 10712, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12825, 10712, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12846, 10712, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12867, 10712, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12887, 10712, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12907, 10712, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12927, 12943, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12948, 12943, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12976, 12943, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13001, 12943, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13019, 12943, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13047, 12943, 0, 0, 0x13,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13072, 12943, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13093, 12943, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13117, 12943, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13138, 12943, 0, 0, 0x0D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13161, 12943, 0, 0, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13182, 12943, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13211, 12943, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13240, 12943, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13269, 12943, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13298, 12943, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13308, 12943, 0, 0, 0x1A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13324, 12943, 0, 0, 0x1A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13343, 12943, 0, 0, 0x1A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13365, 12943, 0, 0, 0x1A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13390, 12943, 0, 0, 0x1A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13405, 12943, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13420, 12943, 0, 0, 0x01,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {13436, 12943, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13467, 12943, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13498, 12943, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13529, 12943, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13560, 12943, 0, 0, 0x15,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13590, 12943, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13615, 12943, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13640, 12943, 0, 0, 0x1B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13665, 12943, 0, 0, 0x1B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13690, 12943, 0, 0, 0x1B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13715, 12943, 0, 0, 0x1B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13740, 12943, 0, 0, 0x1B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {13765, 12943, 0, 0, 0x1B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13790, 12943, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13815, 12943, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13840, 12943, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13866, 12943, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13892, 12943, 0, 0, 0x06,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13912, 12943, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13923, 12943, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13934, 12943, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13960, 12943, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13986, 12943, 0, 0, 0x2A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14009, 12943, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14035, 12943, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14061, 12943, 0, 0, 0x32,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14084, 12943, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14095, 12943, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14112, 12943, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14128, 12943, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14143, 12943, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14169, 12943, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14195, 12943, 0, 0, 0x36,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14218, 12943, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14249, 12943, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14280, 12943, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14311, 12943, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14342, 14358, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14394, 14404, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14409, 14404, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14426, 14404, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14449, 14404, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14462, 14404, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14479, 14404, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14496, 14404, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14509, 14404, 0, 0, 0x04,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {14523, 14404, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14536, 14404, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14555, 14404, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14573, 14404, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14596, 14404, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14613, 14404, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14631, 14404, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14651, 14404, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14669, 14404, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14690, 14404, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14708, 14404, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14731, 14404, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14754, 14404, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14777, 14404, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14800, 14404, 0, 0, 0x83,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14823, 14404, 0, 0, 0x83,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14846, 14404, 0, 0, 0x83,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14869, 14404, 0, 0, 0x83,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {14892, 14404, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14923, 14404, 0, 0, 0x43,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14942, 14404, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14970, 14404, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14998, 14404, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15026, 14404, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15054, 14404, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15082, 14404, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15110, 14404, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15138, 14404, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15166, 14404, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15191, 14404, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15216, 14404, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15236, 14404, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15257, 14404, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15273, 14404, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15287, 14404, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15299, 14404, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15313, 14404, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15329, 14404, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15343, 14404, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15355, 14404, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15369, 14404, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15382, 14404, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15396, 15412, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15417, 15412, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15441, 15412, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15465, 15412, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15489, 15412, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15513, 15412, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15537, 15412, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15561, 15412, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15585, 15412, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15609, 15412, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15625, 15412, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15641, 15412, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15657, 15412, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15673, 15412, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15689, 15412, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15705, 15412, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15721, 15412, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15737, 15412, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15755, 15412, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15773, 15412, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15791, 15412, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_OCCUPANCY_FILTER_MASK}
+, {15809, 15412, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15833, 15412, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15863, 15412, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15885, 15412, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15904, 15412, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15925, 15412, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15948, 15412, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15966, 15412, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15995, 15412, 0, 0, 0x80,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16026, 15412, 0, 0, 0x80,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16057, 15412, 0, 0, 0x80,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {16088, 15412, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16112, 15412, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16136, 15412, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16160, 15412, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16185, 15412, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16212, 15412, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16239, 15412, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16253, 16265, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16274, 16286, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16295, 16311, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16316, 16311, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16326, 16311, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16346, 16311, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16374, 16311, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16398, 16311, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16431, 16311, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16447, 16311, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16466, 16311, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16484, 16311, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16497, 16311, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16526, 16311, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16555, 16311, 0, 0, 0x1E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16584, 16311, 0, 0, 0x1E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16613, 16311, 0, 0, 0x1E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16642, 16311, 0, 0, 0x1E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16671, 16311, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {16696, 16311, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16714, 16311, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16732, 16311, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16754, 16311, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16771, 16311, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16792, 16311, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16816, 16311, 0, 0, 0x02,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {16833, 16311, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16855, 16311, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16880, 16311, 0, 0, 0x02,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {16897, 16311, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16917, 16311, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16937, 16311, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16959, 16311, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16983, 16311, 0, 0, 0x03,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {17000, 16311, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17017, 16311, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17029, 16311, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17045, 16311, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17061, 16311, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17077, 16311, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17093, 16311, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17109, 16311, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17125, 16311, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17139, 16311, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17157, 16311, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17175, 16311, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17193, 16311, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17211, 16311, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17229, 16311, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17247, 16311, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17266, 16311, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17284, 16311, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17297, 16311, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17311, 16311, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17329, 16311, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17347, 16311, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17369, 16311, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17386, 16311, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17407, 16311, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17431, 16311, 0, 0, 0x00,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {17448, 16311, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17470, 16311, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17495, 16311, 0, 0, 0x00,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {17512, 16311, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17532, 16311, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17552, 16311, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17574, 16311, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17598, 16311, 0, 0, 0x01,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {17615, 16311, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17632, 16311, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17644, 16311, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17658, 16311, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17677, 16311, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17705, 17714, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17732, 17714, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17746, 17762, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {17767, 17788, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17798, 17788, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17818, 17788, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17840, 17788, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17861, 17788, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17882, 17788, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17902, 17788, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17924, 17788, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17945, 17788, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17966, 17788, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17986, 17788, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18008, 17788, 0, 0, 0x09,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11632, 17788, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {18029, 18051, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18057, 18082, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18094, 18082, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18119, 18082, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18144, 18051, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18170, 18051, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18196, 18051, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18222, 18051, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18246, 18051, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18270, 18051, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18294, 18051, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18313, 18329, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18334, 18359, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18391, 18359, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18416, 18359, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18441, 18359, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18464, 18359, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18487, 18359, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18510, 18359, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18531, 18359, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18552, 18359, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18573, 18359, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {18586, 18359, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18610, 18359, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18634, 18359, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18658, 18359, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18682, 18359, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18706, 18359, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18730, 18359, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18752, 18359, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18774, 18359, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18796, 18359, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18818, 18359, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18840, 18359, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18862, 18880, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18896, 18880, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18914, 18880, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18932, 18880, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18950, 18880, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18968, 18880, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18986, 18359, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19008, 18359, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19028, 19044, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19082, 19044, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19098, 19044, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19114, 19044, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19130, 19044, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19146, 19044, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19162, 18359, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19171, 18359, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19194, 18359, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19217, 18359, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19240, 18359, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19263, 18359, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19286, 18359, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19309, 18359, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19330, 18359, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19351, 18359, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19372, 18359, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19393, 18359, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19414, 18359, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19435, 18359, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19456, 18359, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19479, 18359, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19502, 18359, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19525, 18359, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19548, 18359, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19571, 18359, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {19594, 18359, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19617, 18359, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19641, 19660, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19665, 19660, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19684, 19660, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {19703, 19660, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {19727, 19660, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {19746, 19660, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {19758, 19771, 0, 0, 0x0,0x0,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable sandybridgeEP_arch_events = {
+    NUM_ARCH_EVENTS_SANDYBRIDGEEP,
+    sandybridgeEP_arch_event_strings,
+    sandybridgeEP_arch_event_options,
+    sandybridgeEP_arch_event_entries
+};
@@ -0,0 +1,911 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_SANDYBRIDGE 422
+
+static const char sandybridge_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LOAD_BLOCKS_DATA_UNKNOWN\0"
+    "PMC\0"
+    "LOAD_BLOCKS_STORE_FORWARD\0"
+    "LOAD_BLOCKS_NO_SR\0"
+    "LOAD_BLOCKS_ALL_BLOCK\0"
+    "MISALIGN_MEM_REF_LOAD\0"
+    "MISALIGN_MEM_REF_STORE\0"
+    "MISALIGN_MEM_REF_ANY\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "LD_BLOCKS_PARTIAL_ALL_STA_BLOCK\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_DURATION\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RAT_STALL_CYCLES\0"
+    "INT_MISC_RAT_STALL_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_DOUBLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED_SINGLE\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR_DOUBLE\0"
+    "SIMD_FP_256_PACKED_SINGLE\0"
+    "SIMD_FP_256_PACKED_DOUBLE\0"
+    "ARITH_FPU_DIV_ACTIVE\0"
+    "ARITH_NUM_DIV\0"
+    "INSTS_WRITTEN_TO_IQ_INSTS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_RFO_HITS\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFO_ANY\0"
+    "L2_RQSTS_CODE_RD_HITS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_CODE_CODE_RD\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_MISS\0"
+    "L2_STORE_LOCK_RQSTS_HIT_E\0"
+    "L2_STORE_LOCK_RQSTS_HIT_M\0"
+    "L2_STORE_LOCK_RQSTS_ALL\0"
+    "L1D_WB_RQST_HIT_E\0"
+    "L1D_WB_RQST_HIT_M\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "PMC1\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_DURATION\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOAD_HIT_PRE_HW_PF\0"
+    "HW_PRE_REQ_DL1_MISS\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_ALLOCATED_IN_M\0"
+    "L1D_M_EVICT\0"
+    "L1D_ALL_M_REPLACEMENT\0"
+    "PARTIAL_RAT_STALLS_FLAGS_MERGE_UOP\0"
+    "PARTIAL_RAT_STALLS_SLOW_LEA_WINDOW\0"
+    "PARTIAL_RAT_STALLS_MUL_SINGLE_UOP\0"
+    "RESOURCE_STALLS2_ALL_FL_EMPTY\0"
+    "RESOURCE_STALLS2_ALL_PRF_CONTROL\0"
+    "RESOURCE_STALLS2_BOB_FULL\0"
+    "RESOURCE_STALLS2_OOO_RSRC\0"
+    "CPL_CYCLES_RING0\0"
+    "CPL_CYCLES_RING123\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "CACHE_LOCK_CYCLES_SPLIT_LOCK_UC_LOCK_DURATION\0"
+    "CACHE_LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "IDQ_EMPTY\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_DSB_ALL_UOPS\0"
+    "IDQ_MITE_ALL_UOPS\0"
+    "IDQ_ALL_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_DURATION\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_IQ_FULL\0"
+    "BR_INST_EXEC_COND_TAKEN\0"
+    "BR_INST_EXEC_COND_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_JMP_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_INST_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_INST_EXEC_ALL_BRANCHES\0"
+    "BR_MISP_EXEC_COND_TAKEN\0"
+    "BR_MISP_EXEC_COND_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_JMP_NON_CALL_RET_NON_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_TAKEN\0"
+    "BR_MISP_EXEC_RETURN_NEAR_NON_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_TAKEN\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL_NON_TAKEN\0"
+    "BR_MISP_EXEC_ALL_BRANCHES\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_LD\0"
+    "UOPS_DISPATCHED_PORT_PORT_3_STA\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ALL_PORTS\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LB\0"
+    "RESOURCE_STALLS_RS\0"
+    "RESOURCE_STALLS_SB\0"
+    "RESOURCE_STALLS_ROB\0"
+    "RESOURCE_STALLS_FCSW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_DISPATCH\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "PMC2\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "DSB2MITE_SWITCHES_COUNT\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB_FILL_OTHER_CANCEL\0"
+    "DSB_FILL_EXCEED_DSB_LINES\0"
+    "DSB_FILL_ALL_CANCEL\0"
+    "ITLB_ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "AGU_BYPASS_CANCEL_COUNT\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "L1D_BLOCKS_BANK_CONFLICT_CYCLES\0"
+    "L1D_BLOCKS_BANK_CONFLICT_COUNT\0"
+    "INST_RETIRED_ANY_P\0"
+    "PMC0\0"
+    "INST_RETIRED_PREC_DIST\0"
+    "OTHER_ASSISTS_ITLB_MISS_RETIRED\0"
+    "OTHER_ASSISTS_AVX_TO_SSE\0"
+    "OTHER_ASSISTS_SSE_TO_AVX\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MASKMOV\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "BR_MISP_RETIRED_NOT_TAKEN\0"
+    "BR_MISP_RETIRED_TAKEN\0"
+    "FP_ASSIST_X87_OUTPUT\0"
+    "FP_ASSIST_X87_INPUT\0"
+    "FP_ASSIST_SIMD_OUTPUT\0"
+    "FP_ASSIST_SIMD_INPUT\0"
+    "FP_ASSIST_ANY\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "ROB_MISC_EVENT_LBR_INSERTS\0"
+    "MEM_UOPS_RETIRED_LOADS\0"
+    "MEM_UOPS_RETIRED_STORES\0"
+    "MEM_UOPS_RETIRED_LOADS_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_STORES_STLB_MISS\0"
+    "MEM_UOPS_RETIRED_LOADS_LOCK\0"
+    "MEM_UOPS_RETIRED_STORES_LOCK\0"
+    "MEM_UOPS_RETIRED_LOADS_SPLIT\0"
+    "MEM_UOPS_RETIRED_STORES_SPLIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L1_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L2_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_HIT\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_MISS\0"
+    "MEM_LOAD_UOPS_RETIRED_L3_ALL\0"
+    "MEM_LOAD_UOPS_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_UOPS_RETIRED_ALL\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_UOPS_LLC_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_UOPS_MISC_RETIRED_LLC_MISS\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PREF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PF_CLEAN\0"
+    "L2_LINES_OUT_PF_DIRTY\0"
+    "L2_LINES_OUT_DIRTY_ALL\0"
+    "L2_LINES_OUT_CLEAN_ALL\0"
+    "L2_LINES_OUT_ALL\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_SPLIT_LOCK_UC_LOCK_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "CACHE_LOOKUP_M\0"
+    "CBOX\0"
+    "CACHE_LOOKUP_E\0"
+    "CACHE_LOOKUP_S\0"
+    "CACHE_LOOKUP_I\0"
+    "CACHE_LOOKUP_READ_FILTER\0"
+    "CACHE_LOOKUP_WRITE_FILTER\0"
+    "CACHE_LOOKUP_EXTSNP_FILTER\0"
+    "CACHE_LOOKUP_ANY_REQUEST_FILTER\0"
+    "CACHE_LOOKUP_READ_M\0"
+    "CACHE_LOOKUP_WRITE_M\0"
+    "CACHE_LOOKUP_EXTSNP_M\0"
+    "CACHE_LOOKUP_ANY_M\0"
+    "CACHE_LOOKUP_READ_E\0"
+    "CACHE_LOOKUP_WRITE_E\0"
+    "CACHE_LOOKUP_EXTSNP_E\0"
+    "CACHE_LOOKUP_ANY_E\0"
+    "CACHE_LOOKUP_READ_S\0"
+    "CACHE_LOOKUP_WRITE_S\0"
+    "CACHE_LOOKUP_EXTSNP_S\0"
+    "CACHE_LOOKUP_ANY_S\0"
+    "CACHE_LOOKUP_READ_ES\0"
+    "CACHE_LOOKUP_WRITE_ES\0"
+    "CACHE_LOOKUP_EXTSNP_ES\0"
+    "CACHE_LOOKUP_ANY_ES\0"
+    "CACHE_LOOKUP_READ_I\0"
+    "CACHE_LOOKUP_WRITE_I\0"
+    "CACHE_LOOKUP_EXTSNP_I\0"
+    "CACHE_LOOKUP_ANY_I\0"
+    "CACHE_LOOKUP_READ_MESI\0"
+    "CACHE_LOOKUP_WRITE_MESI\0"
+    "CACHE_LOOKUP_EXTSNP_MESI\0"
+    "CACHE_LOOKUP_ANY_MESI\0"
+    "XSNP_RESPONSE_MISS_EXTERNAL\0"
+    "XSNP_RESPONSE_MISS_XCORE\0"
+    "XSNP_RESPONSE_MISS_EVICTION\0"
+    "XSNP_RESPONSE_HIT_EXTERNAL\0"
+    "XSNP_RESPONSE_HIT_XCORE\0"
+    "XSNP_RESPONSE_HIT_EVICTION\0"
+    "XSNP_RESPONSE_HITM_EXTERNAL\0"
+    "XSNP_RESPONSE_HITM_XCORE\0"
+    "XSNP_RESPONSE_HITM_EVICTION\0"
+    "TRK_OCCUPANCY_ALL\0"
+    "UBOX0\0"
+    "TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_WRITES\0"
+    "COH_TRK_OCCUPANCY\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0";
+
+static const PerfmonEventOption sandybridge_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x04}
+, {EVENT_OPTION_THRESHOLD,0x02}
+, {EVENT_OPTION_THRESHOLD,0x06}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x6}
+};
+
+static const PerfmonEventEntry sandybridge_arch_event_entries[NUM_ARCH_EVENTS_SANDYBRIDGE] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 109, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {114, 132, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {138, 160, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {166, 187, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 218, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {222, 218, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {248, 218, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {266, 218, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {288, 218, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 218, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 218, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {354, 218, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {386, 218, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 218, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {449, 218, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {481, 218, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {512, 218, 0, 1, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {537, 218, 1, 2, 0x0D,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {561, 218, 0, 0, 0x0D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {587, 218, 3, 1, 0x0D,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {612, 218, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {628, 218, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {652, 218, 4, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {677, 218, 6, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {702, 218, 8, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {731, 218, 10, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {761, 218, 13, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {791, 218, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {825, 218, 16, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {859, 218, 17, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {893, 218, 18, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {927, 218, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {947, 218, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {984, 218, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1021, 218, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1058, 218, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1095, 218, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1121, 218, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1147, 218, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1168, 218, 1, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1182, 218, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1208, 218, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1240, 218, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1273, 218, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1301, 218, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1319, 218, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1337, 218, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1354, 218, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1376, 218, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1398, 218, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1424, 218, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1440, 218, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1457, 218, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1473, 218, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1487, 218, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1512, 218, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 218, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1564, 218, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1588, 218, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1606, 218, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1624, 218, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {1647, 218, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {1665, 218, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1693, 218, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1718, 218, 19, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1750, 1772, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1777, 218, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1809, 218, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1842, 218, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1874, 218, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1901, 218, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1920, 218, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1939, 218, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1959, 218, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1975, 218, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1994, 218, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2006, 218, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2028, 218, 0, 0, 0x59,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2063, 218, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2098, 218, 0, 0, 0x59,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2132, 218, 0, 0, 0x5B,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {2162, 218, 0, 0, 0x5B,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2195, 218, 0, 0, 0x5B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2221, 218, 0, 0, 0x5B,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2247, 218, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2264, 218, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2283, 218, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 218, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2350, 218, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2394, 218, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2434, 218, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2475, 218, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2521, 218, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2559, 218, 0, 0, 0x79,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2569, 218, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2583, 218, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2596, 218, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2612, 218, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2629, 218, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2641, 218, 0, 0, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {2658, 218, 0, 0, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {2676, 218, 0, 0, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {2689, 218, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2705, 218, 0, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2728, 218, 16, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2751, 218, 17, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2774, 218, 18, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2797, 218, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2812, 218, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2834, 218, 16, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2856, 218, 17, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2878, 218, 18, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2900, 218, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2918, 218, 0, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2943, 218, 16, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2968, 218, 17, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2993, 218, 18, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3018, 218, 1, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3035, 218, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3054, 218, 0, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3080, 218, 16, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3106, 218, 17, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3132, 218, 18, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3158, 218, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3172, 218, 0, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3193, 218, 16, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3214, 218, 17, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3235, 218, 18, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3256, 218, 1, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {3272, 218, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3300, 218, 0, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3326, 218, 16, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3352, 218, 17, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3378, 218, 18, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3404, 218, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3433, 218, 0, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3460, 218, 16, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3487, 218, 17, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3514, 218, 18, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3541, 218, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3565, 218, 0, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3587, 218, 16, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3609, 218, 17, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3631, 218, 18, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3653, 218, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3665, 218, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3679, 218, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3695, 218, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3715, 218, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3741, 218, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3768, 218, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3794, 218, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3815, 218, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3829, 218, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3847, 218, 0, 0, 0x88,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3871, 218, 0, 0, 0x88,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3899, 218, 0, 0, 0x88,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3929, 218, 0, 0, 0x88,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3963, 218, 0, 0, 0x88,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4008, 218, 0, 0, 0x88,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4057, 218, 0, 0, 0x88,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4088, 218, 0, 0, 0x88,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4123, 218, 0, 0, 0x88,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4159, 218, 0, 0, 0x88,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4199, 218, 0, 0, 0x88,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4237, 218, 0, 0, 0x88,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4279, 218, 0, 0, 0x88,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4305, 218, 0, 0, 0x89,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4329, 218, 0, 0, 0x89,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4357, 218, 0, 0, 0x89,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {4402, 218, 0, 0, 0x89,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4451, 218, 0, 0, 0x89,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {4482, 218, 0, 0, 0x89,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4517, 218, 0, 0, 0x89,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {4553, 218, 0, 0, 0x89,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4593, 218, 0, 0, 0x89,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {4631, 218, 0, 0, 0x89,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4673, 218, 0, 0, 0x89,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4699, 218, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4727, 218, 18, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4775, 218, 17, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4825, 218, 16, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4875, 218, 0, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4925, 218, 4, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4965, 218, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4993, 218, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5021, 218, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5052, 218, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5084, 218, 0, 0, 0xA1,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {5112, 218, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5143, 218, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5175, 218, 0, 0, 0xA1,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {5203, 218, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5231, 218, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5259, 218, 21, 1, 0xA1,0x83,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5297, 218, 0, 0, 0xA1,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {5329, 218, 0, 0, 0xA1,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {5360, 218, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5380, 218, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5399, 218, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5418, 218, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5437, 218, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5457, 218, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5478, 218, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5500, 218, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5522, 218, 22, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5555, 218, 22, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5585, 218, 23, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5618, 218, 23, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5648, 218, 24, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5682, 218, 24, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5715, 218, 18, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5743, 5777, 25, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5782, 5777, 25, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5813, 5777, 26, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5847, 5777, 26, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5878, 218, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5902, 218, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5935, 218, 0, 0, 0xAC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5957, 218, 0, 0, 0xAC,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5983, 218, 0, 0, 0xAC,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {6003, 218, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6019, 218, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6051, 218, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6083, 218, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6111, 218, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6140, 218, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6161, 218, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6187, 218, 4, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6214, 218, 6, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6241, 218, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6277, 218, 16, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6313, 218, 17, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6349, 218, 18, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6385, 218, 27, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6421, 218, 28, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6457, 218, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6476, 218, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6507, 218, 4, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6539, 218, 6, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6571, 218, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6612, 218, 16, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6653, 218, 17, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6694, 218, 18, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6735, 218, 27, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6776, 218, 28, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6817, 218, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6849, 218, 0, 0, 0xB6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6873, 218, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6895, 218, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6914, 218, 0, 1, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6946, 218, 1, 2, 0xBF,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {6977, 6996, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7001, 6996, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7024, 218, 0, 0, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7056, 218, 0, 0, 0xC1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7081, 218, 0, 0, 0xC1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7106, 218, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7123, 218, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7149, 218, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7174, 218, 4, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7200, 218, 6, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {7226, 218, 21, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7248, 218, 21, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7279, 218, 8, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7309, 218, 10, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7340, 218, 13, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7371, 218, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7406, 218, 16, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7441, 218, 17, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7476, 218, 18, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7511, 218, 27, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7546, 218, 28, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7581, 218, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7612, 218, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7631, 218, 0, 0, 0xC3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7654, 218, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7683, 218, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7711, 218, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7737, 218, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7765, 218, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7791, 218, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7818, 218, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7845, 218, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7874, 218, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7902, 218, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7928, 218, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7954, 218, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7976, 218, 0, 0, 0xCA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7997, 218, 0, 0, 0xCA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8017, 218, 0, 0, 0xCA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8039, 218, 0, 0, 0xCA,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8060, 218, 0, 0, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK}
+, {8074, 218, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8097, 218, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8124, 218, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {8147, 218, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {8171, 218, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {8204, 218, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8238, 218, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8266, 218, 0, 0, 0xD0,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8295, 218, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8324, 218, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8354, 218, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8383, 218, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8413, 218, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8442, 218, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8471, 218, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8501, 218, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {8530, 218, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8559, 218, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8589, 218, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8618, 218, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8648, 218, 0, 0, 0xD1,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {8674, 218, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8714, 218, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8753, 218, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8793, 218, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8833, 218, 0, 0, 0xD4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8869, 218, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8893, 218, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8906, 218, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8923, 218, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8941, 218, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8957, 218, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8974, 218, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8989, 218, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {9011, 218, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9025, 218, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9039, 218, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9053, 218, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9069, 218, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9095, 218, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9121, 218, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9143, 218, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9165, 218, 0, 0, 0xF2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {9188, 218, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {9211, 218, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {9228, 218, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9247, 218, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9274, 218, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9310, 218, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9342, 218, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9378, 218, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9404, 218, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9441, 218, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9474, 218, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9511, 218, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {9548, 218, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {9581, 218, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {9618, 218, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {9660, 218, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {9700, 218, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {9729, 218, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {9756, 218, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {9792, 218, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {9824, 218, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9860, 218, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {9886, 218, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {9923, 218, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {9956, 218, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {9993, 218, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {10030, 218, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {10063, 218, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {10100, 218, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {10142, 218, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {10182, 218, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {10211, 10226, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10231, 10226, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10246, 10226, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10261, 10226, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10276, 10226, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10301, 10226, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10327, 10226, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10354, 10226, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10386, 10226, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10406, 10226, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10427, 10226, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10449, 10226, 0, 0, 0x34,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10468, 10226, 0, 0, 0x34,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10488, 10226, 0, 0, 0x34,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10509, 10226, 0, 0, 0x34,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {10531, 10226, 0, 0, 0x34,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {10550, 10226, 0, 0, 0x34,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {10570, 10226, 0, 0, 0x34,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {10591, 10226, 0, 0, 0x34,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {10613, 10226, 0, 0, 0x34,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {10632, 10226, 0, 0, 0x34,0x16,0,0,EVENT_OPTION_NONE_MASK}
+, {10653, 10226, 0, 0, 0x34,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {10675, 10226, 0, 0, 0x34,0x46,0,0,EVENT_OPTION_NONE_MASK}
+, {10698, 10226, 0, 0, 0x34,0x86,0,0,EVENT_OPTION_NONE_MASK}
+, {10718, 10226, 0, 0, 0x34,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {10738, 10226, 0, 0, 0x34,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {10759, 10226, 0, 0, 0x34,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {10781, 10226, 0, 0, 0x34,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {10800, 10226, 0, 0, 0x34,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10823, 10226, 0, 0, 0x34,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {10847, 10226, 0, 0, 0x34,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {10872, 10226, 0, 0, 0x34,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {10894, 10226, 0, 0, 0x22,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10922, 10226, 0, 0, 0x22,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10947, 10226, 0, 0, 0x22,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10975, 10226, 0, 0, 0x22,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11002, 10226, 0, 0, 0x22,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11026, 10226, 0, 0, 0x22,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11053, 10226, 0, 0, 0x22,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {11081, 10226, 0, 0, 0x22,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11106, 10226, 0, 0, 0x22,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11134, 11152, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11158, 11175, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11180, 11175, 0, 0, 0x81,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11200, 11152, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11218, 11175, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11239, 11252, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11260, 11272, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11280, 11291, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11299, 11311, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable sandybridge_arch_events = {
+    NUM_ARCH_EVENTS_SANDYBRIDGE,
+    sandybridge_arch_event_strings,
+    sandybridge_arch_event_options,
+    sandybridge_arch_event_entries
+};
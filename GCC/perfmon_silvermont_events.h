@@ -0,0 +1,253 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_SILVERMONT 112
+
+static const char silvermont_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "REHABQ_LD_BLOCK_ST_FORWARD\0"
+    "PMC\0"
+    "REHABQ_LD_BLOCK_STD_NOTREADY\0"
+    "REHABQ_ST_SPLITS\0"
+    "REHABQ_LD_SPLITS\0"
+    "REHABQ_LOCK\0"
+    "REHABQ_STA_FULL\0"
+    "REHABQ_ANY_LD\0"
+    "REHABQ_ANY_ST\0"
+    "MEM_UOPS_RETIRED_L1_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_L2_HIT_LOADS\0"
+    "MEM_UOPS_RETIRED_L2_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_DTLB_MISS_LOADS\0"
+    "MEM_UOPS_RETIRED_UTLB_MISS\0"
+    "MEM_UOPS_RETIRED_HITM\0"
+    "MEM_UOPS_RETIRED_ALL_LOADS\0"
+    "MEM_UOPS_RETIRED_ALL_STORES\0"
+    "PAGE_WALKS_DTLB_COUNT\0"
+    "PAGE_WALKS_DTLB_CYCLES\0"
+    "PAGE_WALKS_ITLB_COUNT\0"
+    "PAGE_WALKS_ITLB_CYCLES\0"
+    "PAGE_WALKS_COUNT\0"
+    "PAGE_WALKS_CYCLES\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_REJECT_XQ_ALL\0"
+    "CORE_REJECT_L2Q_ALL\0"
+    "CPU_CLK_UNHALTED_CORE_P\0"
+    "CPU_CLK_UNHALTED_REF_P\0"
+    "ICACHE_HITS\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_ACCESSES\0"
+    "ICACHE_IFETCH_STALL\0"
+    "NIP_STALL_ICACHE_MISS\0"
+    "INST_RETIRED_ANY_P\0"
+    "UOPS_RETIRED_MS\0"
+    "UOPS_RETIRED_ALL\0"
+    "MACHINE_CLEARS_SMC\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_FP_ASSIST\0"
+    "MACHINE_CLEARS_ALL\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_JCC\0"
+    "BR_INST_RETIRED_TAKEN_JCC\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_INST_RETIRED_NON_RETURN_IND\0"
+    "BR_INST_RETIRED_RETURN\0"
+    "BR_INST_RETIRED_CALL\0"
+    "BR_INST_RETIRED_IND_CALL\0"
+    "BR_INST_RETIRED_REL_CALL\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_JCC\0"
+    "BR_MISP_RETIRED_TAKEN_JCC\0"
+    "BR_MISP_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_NON_RETURN_IND\0"
+    "BR_MISP_RETIRED_RETURN\0"
+    "BR_MISP_RETIRED_CALL\0"
+    "BR_MISP_RETIRED_IND_CALL\0"
+    "BR_MISP_RETIRED_REL_CALL\0"
+    "NO_ALLOC_CYCLES_ROB_FULL\0"
+    "NO_ALLOC_CYCLES_RAT_STALL\0"
+    "NO_ALLOC_CYCLES_ALL\0"
+    "NO_ALLOC_CYCLES_NOT_DELIVERED\0"
+    "RS_FULL_STALL_MEC\0"
+    "RS_FULL_STALL_ALL\0"
+    "CYCLES_DIV_BUSY_ANY\0"
+    "DIV_BUSY_COUNT\0"
+    "BACLEARS_ALL\0"
+    "BACLEARS_RETURN\0"
+    "BACLEARS_COND\0"
+    "MS_DECODED_MS_ENTRY\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_READ_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_WRITE_ANY\0"
+    "OFFCORE_RESPONSE_0_UC_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_SW_PREFETCH_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L1_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PARTIAL_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_ANY_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_READ_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_WRITE_ANY\0"
+    "OFFCORE_RESPONSE_1_UC_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_SW_PREFETCH_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L1_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PARTIAL_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_ANY_ANY\0";
+
+static const PerfmonEventOption silvermont_arch_event_options[] = {
+ {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+};
+
+static const PerfmonEventEntry silvermont_arch_event_entries[NUM_ARCH_EVENTS_SILVERMONT] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 114, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {120, 142, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 169, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {175, 202, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {206, 202, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {235, 202, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {252, 202, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {269, 202, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {281, 202, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {297, 202, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {311, 202, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {325, 202, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {356, 202, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {386, 202, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {417, 202, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {450, 202, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {477, 202, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {499, 202, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {526, 202, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {554, 202, 0, 0, 0x05,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {576, 202, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {599, 202, 0, 0, 0x05,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {621, 202, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {644, 202, 0, 0, 0x05,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {661, 202, 0, 0, 0x05,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {679, 202, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {702, 202, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {730, 202, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {747, 202, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {767, 202, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {791, 202, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {814, 202, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {826, 202, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {840, 202, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {856, 202, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {876, 202, 0, 0, 0xB6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {898, 202, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {917, 202, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {933, 202, 0, 0, 0xC2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {950, 202, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {969, 202, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1000, 202, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1025, 202, 0, 0, 0xC3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1044, 202, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1073, 202, 0, 0, 0xC4,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 202, 0, 0, 0xC4,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1119, 202, 0, 0, 0xC4,0xBF,0,0,EVENT_OPTION_NONE_MASK}
+, {1146, 202, 0, 0, 0xC4,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1177, 202, 0, 0, 0xC4,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1200, 202, 0, 0, 0xC4,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {1221, 202, 0, 0, 0xC4,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1246, 202, 0, 0, 0xC4,0xFD,0,0,EVENT_OPTION_NONE_MASK}
+, {1271, 202, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1300, 202, 0, 0, 0xC5,0x7E,0,0,EVENT_OPTION_NONE_MASK}
+, {1320, 202, 0, 0, 0xC5,0xFE,0,0,EVENT_OPTION_NONE_MASK}
+, {1346, 202, 0, 0, 0xC5,0xBF,0,0,EVENT_OPTION_NONE_MASK}
+, {1373, 202, 0, 0, 0xC5,0xEB,0,0,EVENT_OPTION_NONE_MASK}
+, {1404, 202, 0, 0, 0xC5,0xF7,0,0,EVENT_OPTION_NONE_MASK}
+, {1427, 202, 0, 0, 0xC5,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {1448, 202, 0, 0, 0xC5,0xFB,0,0,EVENT_OPTION_NONE_MASK}
+, {1473, 202, 0, 0, 0xC5,0xFD,0,0,EVENT_OPTION_NONE_MASK}
+, {1498, 202, 0, 0, 0xCA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1523, 202, 0, 0, 0xCA,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1549, 202, 0, 0, 0xCA,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1569, 202, 0, 0, 0xCA,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1599, 202, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1617, 202, 0, 0, 0xCB,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {1635, 202, 0, 0, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1655, 202, 0, 2, 0xCD,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1670, 202, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1683, 202, 0, 0, 0xE6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1699, 202, 0, 0, 0xE6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1713, 202, 0, 0, 0xE7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1733, 202, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {1760, 202, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {1796, 202, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {1828, 202, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {1864, 202, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {1890, 202, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {1927, 202, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {1960, 202, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {1997, 202, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {2033, 202, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {2070, 202, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {2104, 202, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {2137, 202, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {2177, 202, 0, 0, 0xB7,0x01,0x0C,0x10,EVENT_OPTION_NONE_MASK}
+, {2212, 202, 0, 0, 0xB7,0x01,0x0D,0x10,EVENT_OPTION_NONE_MASK}
+, {2249, 202, 0, 0, 0xB7,0x01,0x0E,0x10,EVENT_OPTION_NONE_MASK}
+, {2297, 202, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {2324, 202, 0, 0, 0xB7,0x02,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {2351, 202, 0, 0, 0xB7,0x02,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {2387, 202, 0, 0, 0xB7,0x02,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {2419, 202, 0, 0, 0xB7,0x02,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {2455, 202, 0, 0, 0xB7,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {2481, 202, 0, 0, 0xB7,0x02,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {2518, 202, 0, 0, 0xB7,0x02,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {2551, 202, 0, 0, 0xB7,0x02,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {2588, 202, 0, 0, 0xB7,0x02,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {2624, 202, 0, 0, 0xB7,0x02,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {2661, 202, 0, 0, 0xB7,0x02,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {2695, 202, 0, 0, 0xB7,0x02,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {2728, 202, 0, 0, 0xB7,0x02,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {2768, 202, 0, 0, 0xB7,0x02,0x0C,0x10,EVENT_OPTION_NONE_MASK}
+, {2803, 202, 0, 0, 0xB7,0x02,0x0D,0x10,EVENT_OPTION_NONE_MASK}
+, {2840, 202, 0, 0, 0xB7,0x02,0x0E,0x10,EVENT_OPTION_NONE_MASK}
+, {2888, 202, 0, 0, 0xB7,0x02,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable silvermont_arch_events = {
+    NUM_ARCH_EVENTS_SILVERMONT,
+    silvermont_arch_event_strings,
+    silvermont_arch_event_options,
+    silvermont_arch_event_entries
+};
@@ -0,0 +1,4237 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_SKYLAKEX 2061
+
+static const char skylakeX_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "PMC\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_ALL\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "BACLEARS_ANY\0"
+    "ITLB_FLUSH\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_CLEAR_RESTEER_CYCLES\0"
+    "INT_MISC_CLEAR_RESTEER_COUNT\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_SB\0"
+    "PARTIAL_RAT_STALLS_SCOREBOARD\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_VECTOR_WIDTH_MISMATCH\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "MEMORY_DISAMBIGUATION_HISTORY_RESET\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MEM\0"
+    "HLE_RETIRED_ABORTED_TIMER\0"
+    "HLE_RETIRED_ABORTED_UNFRIENDLY\0"
+    "HLE_RETIRED_ABORTED_MEMTYPE\0"
+    "HLE_RETIRED_ABORTED_EVENTS\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "INST_RETIRED_ANY\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SINGLE\0"
+    "FP_ASSIST_ANY\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_ALL\0"
+    "MEM_LOAD_L3_MISS_RETIRED_LOCAL_DRAM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_HITM\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_FWD\0"
+    "MEM_LOAD_L3_MISS_RETIRED_REMOTE_ALL\0"
+    "MEM_LOAD_MISC_RETIRED_UC\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_4\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_8\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_16\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_32\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_64\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_128\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_256\0"
+    "MEM_TRANS_RETIRED_LOAD_LATENCY_GT_512\0"
+    "FRONTEND_RETIRED_DSB_MISS\0"
+    "FRONTEND_RETIRED_L1I_MISS\0"
+    "FRONTEND_RETIRED_L2_MISS\0"
+    "FRONTEND_RETIRED_ITLB_MISS\0"
+    "FRONTEND_RETIRED_STLB_MISS\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_4\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_X87\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L3_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "EPT_WALK_PENDING\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_COMPLETED_1G\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_M_EVICT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_PENDING_CYCLES_ANY\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MITE_CYCLES_6_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES_5_UOPS\0"
+    "IDQ_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_5_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_6_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES_5_UOPS\0"
+    "IDQ_MS_CYCLES_6_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_5_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_6_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_5_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_6_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_5_UOPS\0"
+    "IDQ_ALL_CYCLES_6_UOPS\0"
+    "ROB_MISC_EVENTS_LBR_INSERTS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "L2_LINES_OUT_USELESS_PREF\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "OTHER_ASSISTS_ANY\0"
+    "FRONTEND_RETIRED_LATENCY_GE_8\0"
+    "FRONTEND_RETIRED_LATENCY_GE_16\0"
+    "FRONTEND_RETIRED_LATENCY_GE_32\0"
+    "FRONTEND_RETIRED_LATENCY_GE_64\0"
+    "FRONTEND_RETIRED_LATENCY_GE_128\0"
+    "FRONTEND_RETIRED_LATENCY_GE_256\0"
+    "FRONTEND_RETIRED_LATENCY_GE_512\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_1\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_3\0"
+    "CORE_POWER_LVL0_TURBO_LICENSE\0"
+    "CORE_POWER_LVL1_TURBO_LICENSE\0"
+    "CORE_POWER_LVL2_TURBO_LICENSE\0"
+    "IDI_MISC_WB_UPGRADE\0"
+    "IDI_MISC_WB_DOWNGRADE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "EVENT_MSG_VLW_RCVD\0"
+    "UBOX\0"
+    "EVENT_MSG_MSI_RCVD\0"
+    "EVENT_MSG_IPI_RCVD\0"
+    "EVENT_MSG_DOORBELL_RCVD\0"
+    "EVENT_MSG_INT_PRIO\0"
+    "LOCK_CYCLES\0"
+    "PHOLD_CYCLES_ASSERT_TO_ACK\0"
+    "RACU_DRNG_RDRAND\0"
+    "RACU_DRNG_RDSEED\0"
+    "RACU_DRNG_PFTCH_BUF_EMPTY\0"
+    "RACU_REQUESTS\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "2LM_NM_SETCONFLICTS_SF\0"
+    "CBOX\0"
+    "2LM_NM_SETCONFLICTS_LLC\0"
+    "2LM_NM_SETCONFLICTS_TOR\0"
+    "2LM_NM_SETCONFLICTS_TOR_REJECT\0"
+    "2LM_NM_SETCONFLICTS_IODC\0"
+    "SF_EVICTION_M\0"
+    "SF_EVICTION_E\0"
+    "SF_EVICTION_S\0"
+    "SF_EVICTION_ANY\0"
+    "BYPASS_CHA_IMC_TAKEN\0"
+    "BYPASS_CHA_IMC_INTERMEDIATE\0"
+    "BYPASS_CHA_IMC_NOT_TAKEN\0"
+    "CBOX_CLOCKTICKS\0"
+    "CORE_PMA_C1_STATE\0"
+    "CORE_PMA_C1_TRANSITION\0"
+    "CORE_PMA_C6_STATE\0"
+    "CORE_PMA_C6_TRANSITION\0"
+    "CORE_PMA_GV\0"
+    "CORE_SNP_EXT_ONE\0"
+    "CORE_SNP_EXT_GTONE\0"
+    "CORE_SNP_EXT_REMOTE\0"
+    "CORE_SNP_CORE_ONE\0"
+    "CORE_SNP_CORE_GTONE\0"
+    "CORE_SNP_CORE_REMOTE\0"
+    "CORE_SNP_EVICT_ONE\0"
+    "CORE_SNP_EVICT_GTONE\0"
+    "CORE_SNP_EVICT_REMOTE\0"
+    "CORE_SNP_ANY_ONE\0"
+    "CORE_SNP_ANY_GTONE\0"
+    "CORE_SNP_ANY_REMOTE\0"
+    "COUNTER0_OCCUPANCY\0"
+    "CBOX0C0|CBOX1C0|CBOX2C0|CBOX3C0|CBOX4C0|CBOX5C0|CBOX6C0|CBOX7C0|CBOX8C0|CBOX9C0|CBOX10C0|CBOX11C0|CBOX12C0|CBOX13C0|CBOX14C0|CBOX15C0|CBOX16C0|CBOX17C0|CBOX18C0|CBOX19C0|CBOX20C0|CBOX21C0|CBOX22C0|CBOX23C0|CBOX24C0|CBOX25C0|CBOX26C0|CBOX27C0\0"
+    "COUNTER0_OCCUPANCY_COUNT\0"
+    "DIR_LOOKUP_SNP\0"
+    "DIR_LOOKUP_NO_SNP\0"
+    "DIR_UPDATE_HA\0"
+    "DIR_UPDATE_TOR\0"
+    "HITME_HIT_EX_RDS\0"
+    "HITME_HIT_SHARED_OWNREQ\0"
+    "HITME_HIT_WBMTOE\0"
+    "HITME_HIT_WBMTOI_OR_S\0"
+    "HITME_LOOKUP_READ\0"
+    "HITME_LOOKUP_WRITE\0"
+    "HITME_MISS_SHARED_RDINVOWN\0"
+    "HITME_MISS_NOTSHARED_RDINVOWN\0"
+    "HITME_MISS_READ_OR_INV\0"
+    "HITME_UPDATE_DEALLOCATE_RSPFWDI_LOC\0"
+    "HITME_UPDATE_RSPFWDI_REM\0"
+    "HITME_UPDATE_SHARED\0"
+    "HITME_UPDATE_RDINVOWN\0"
+    "HITME_UPDATE_DEALLOCATE\0"
+    "IMC_READS_COUNT_NORMAL\0"
+    "IMC_READS_COUNT_PRIORITY\0"
+    "IMC_READS_COUNT_ANY\0"
+    "IMC_WRITES_COUNT_FULL\0"
+    "IMC_WRITES_COUNT_PARTIAL\0"
+    "IMC_WRITES_COUNT_FULL_PRIORITY\0"
+    "IMC_WRITES_COUNT_PARTIAL_PRIORITY\0"
+    "IMC_WRITES_COUNT_FULL_MIG\0"
+    "IMC_WRITES_COUNT_PARTIAL_MIG\0"
+    "IMC_WRITES_COUNT_ANY\0"
+    "IODC_ALLOC_INVITOM\0"
+    "IODC_ALLOC_IODCFULL\0"
+    "IODC_ALLOC_OSBGATED\0"
+    "IODC_DEALLOC_WBMTOE\0"
+    "IODC_DEALLOC_WBMTOI\0"
+    "IODC_DEALLOC_WBPUSHMTOI\0"
+    "IODC_DEALLOC_SNPOUT\0"
+    "IODC_DEALLOC_ALL\0"
+    "LLC_LOOKUP_DATA_READ\0"
+    "LLC_LOOKUP_WRITE\0"
+    "LLC_LOOKUP_REMOTE_SNOOP\0"
+    "LLC_LOOKUP_ANY\0"
+    "LLC_LOOKUP_LOCAL\0"
+    "LLC_LOOKUP_REMOTE\0"
+    "LLC_VICTIMS_M_STATE\0"
+    "LLC_VICTIMS_E_STATE\0"
+    "LLC_VICTIMS_S_STATE\0"
+    "LLC_VICTIMS_F_STATE\0"
+    "LLC_VICTIMS_ANY_STATE\0"
+    "LLC_VICTIMS_LOCAL\0"
+    "LLC_VICTIMS_REMOTE\0"
+    "LLC_VICTIMS_M_LOCAL\0"
+    "LLC_VICTIMS_E_LOCAL\0"
+    "LLC_VICTIMS_S_LOCAL\0"
+    "LLC_VICTIMS_F_LOCAL\0"
+    "LLC_VICTIMS_ANY_LOCAL\0"
+    "LLC_VICTIMS_M_REMOTE\0"
+    "LLC_VICTIMS_E_REMOTE\0"
+    "LLC_VICTIMS_S_REMOTE\0"
+    "LLC_VICTIMS_F_REMOTE\0"
+    "LLC_VICTIMS_ANY_REMOTE\0"
+    "LLC_VICTIMS_M_ANY\0"
+    "LLC_VICTIMS_E_ANY\0"
+    "LLC_VICTIMS_S_ANY\0"
+    "LLC_VICTIMS_F_ANY\0"
+    "LLC_VICTIMS_ANY_ANY\0"
+    "MISC_RSPI_WAS_FSE\0"
+    "MISC_WC_ALIASING\0"
+    "MISC_RFO_HIT_S\0"
+    "MISC_CVZERO_PREFETCH_VICTIM\0"
+    "MISC_CVZERO_PREFETCH_MISS\0"
+    "OSB_EDR\0"
+    "READ_NO_CREDITS_MC0_SMI0\0"
+    "READ_NO_CREDITS_MC1_SMI1\0"
+    "READ_NO_CREDITS_MC_ALL\0"
+    "READ_NO_CREDITS_EDC0_SMI2\0"
+    "READ_NO_CREDITS_EDC1_SMI3\0"
+    "READ_NO_CREDITS_EDC2_SMI4\0"
+    "READ_NO_CREDITS_EDC3_SMI5\0"
+    "READ_NO_CREDITS_EDC_ALL\0"
+    "WRITE_NO_CREDITS_MC0_SMI0\0"
+    "WRITE_NO_CREDITS_MC1_SMI1\0"
+    "WRITE_NO_CREDITS_MC_ALL\0"
+    "WRITE_NO_CREDITS_EDC0_SMI2\0"
+    "WRITE_NO_CREDITS_EDC1_SMI3\0"
+    "WRITE_NO_CREDITS_EDC2_SMI4\0"
+    "WRITE_NO_CREDITS_EDC3_SMI5\0"
+    "WRITE_NO_CREDITS_EDC_ALL\0"
+    "REQUESTS_READS_LOCAL\0"
+    "REQUESTS_READS_REMOTE\0"
+    "REQUESTS_READS\0"
+    "REQUESTS_WRITES_LOCAL\0"
+    "REQUESTS_WRITES_REMOTE\0"
+    "REQUESTS_WRITES\0"
+    "REQUESTS_INVITOE_LOCAL\0"
+    "REQUESTS_INVITOE_REMOTE\0"
+    "REQUESTS_INVITOE\0"
+    "RXC_INSERTS_IRQ\0"
+    "RXC_INSERTS_IRQ_REJ\0"
+    "RXC_INSERTS_IPQ\0"
+    "RXC_INSERTS_PRQ\0"
+    "RXC_INSERTS_PRQ_REJ\0"
+    "RXC_INSERTS_RRQ\0"
+    "RXC_INSERTS_WBQ\0"
+    "RXC_IPQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IPQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IPQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IPQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IPQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IPQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IPQ1_REJECT_ANY0\0"
+    "RXC_IPQ1_REJECT_HA\0"
+    "RXC_IPQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IPQ1_REJECT_SF_VICTIM\0"
+    "RXC_IPQ1_REJECT_VICTIM\0"
+    "RXC_IPQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IPQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IPQ1_REJECT_PA_MATCH\0"
+    "RXC_IRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_IRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_IRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_IRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_IRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_IRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_IRQ1_REJECT_ANY0\0"
+    "RXC_IRQ1_REJECT_HA\0"
+    "RXC_IRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_IRQ1_REJECT_SF_VICTIM\0"
+    "RXC_IRQ1_REJECT_VICTIM\0"
+    "RXC_IRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_IRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_IRQ1_REJECT_PA_MATCH\0"
+    "RXC_ISMQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_ISMQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_WB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_ISMQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_ISMQ0_REJECT_AK_NON_UPI\0"
+    "RXC_ISMQ0_REJECT_IV_NON_UPI\0"
+    "RXC_ISMQ1_REJECT_ANY0\0"
+    "RXC_ISMQ1_REJECT_HA\0"
+    "RXC_ISMQ0_RETRY_AD_REQ_VN0\0"
+    "RXC_ISMQ0_RETRY_AD_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_RSP_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_WB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCB_VN0\0"
+    "RXC_ISMQ0_RETRY_BL_NCS_VN0\0"
+    "RXC_ISMQ0_RETRY_AK_NON_UPI\0"
+    "RXC_ISMQ0_RETRY_IV_NON_UPI\0"
+    "RXC_ISMQ1_RETRY_ANY0\0"
+    "RXC_ISMQ1_RETRY_HA\0"
+    "RXC_OCCUPANCY_IRQ\0"
+    "RXC_OCCUPANCY_IPQ\0"
+    "RXC_OCCUPANCY_RRQ\0"
+    "RXC_OCCUPANCY_WBQ\0"
+    "RXC_OTHER0_RETRY_AD_REQ_VN0\0"
+    "RXC_OTHER0_RETRY_AD_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_RSP_VN0\0"
+    "RXC_OTHER0_RETRY_BL_WB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCB_VN0\0"
+    "RXC_OTHER0_RETRY_BL_NCS_VN0\0"
+    "RXC_OTHER0_RETRY_AK_NON_UPI\0"
+    "RXC_OTHER0_RETRY_IV_NON_UPI\0"
+    "RXC_OTHER1_REJECT_ANY0\0"
+    "RXC_OTHER1_REJECT_HA\0"
+    "RXC_OTHER1_REJECT_LLC_VICTIM\0"
+    "RXC_OTHER1_REJECT_SF_VICTIM\0"
+    "RXC_OTHER1_REJECT_VICTIM\0"
+    "RXC_OTHER1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_OTHER1_REJECT_ALLOW_SNP\0"
+    "RXC_OTHER1_REJECT_PA_MATCH\0"
+    "RXC_PRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_PRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_PRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_PRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_PRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_PRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_PRQ1_REJECT_ANY0\0"
+    "RXC_PRQ1_REJECT_HA\0"
+    "RXC_PRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_PRQ1_REJECT_SF_VICTIM\0"
+    "RXC_PRQ1_REJECT_VICTIM\0"
+    "RXC_PRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_PRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_PRQ1_REJECT_PA_MATCH\0"
+    "RXC_REQ_Q0_RETRY_AD_REQ_VN0\0"
+    "RXC_REQ_Q0_RETRY_AD_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_RSP_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_WB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCB_VN0\0"
+    "RXC_REQ_Q0_RETRY_BL_NCS_VN0\0"
+    "RXC_REQ_Q0_RETRY_AK_NON_UPI\0"
+    "RXC_REQ_Q0_RETRY_IV_NON_UPI\0"
+    "RXC_REQ_Q1_RETRY_ANY0\0"
+    "RXC_REQ_Q1_RETRY_HA\0"
+    "RXC_REQ_Q1_RETRY_LLC_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_SF_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_VICTIM\0"
+    "RXC_REQ_Q1_RETRY_LLC_OR_SF_WAY\0"
+    "RXC_REQ_Q1_RETRY_ALLOW_SNP\0"
+    "RXC_REQ_Q1_RETRY_PA_MATCH\0"
+    "RXC_RRQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_RRQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_RRQ0_REJECT_BL_WB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_RRQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_RRQ0_REJECT_AK_NON_UPI\0"
+    "RXC_RRQ0_REJECT_IV_NON_UPI\0"
+    "RXC_RRQ1_REJECT_ANY0\0"
+    "RXC_RRQ1_REJECT_HA\0"
+    "RXC_RRQ1_REJECT_LLC_VICTIM\0"
+    "RXC_RRQ1_REJECT_SF_VICTIM\0"
+    "RXC_RRQ1_REJECT_VICTIM\0"
+    "RXC_RRQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_RRQ1_REJECT_ALLOW_SNP\0"
+    "RXC_RRQ1_REJECT_PA_MATCH\0"
+    "RXC_WBQ0_REJECT_AD_REQ_VN0\0"
+    "RXC_WBQ0_REJECT_AD_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_RSP_VN0\0"
+    "RXC_WBQ0_REJECT_BL_WB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCB_VN0\0"
+    "RXC_WBQ0_REJECT_BL_NCS_VN0\0"
+    "RXC_WBQ0_REJECT_AK_NON_UPI\0"
+    "RXC_WBQ0_REJECT_IV_NON_UPI\0"
+    "RXC_WBQ1_REJECT_ANY0\0"
+    "RXC_WBQ1_REJECT_HA\0"
+    "RXC_WBQ1_REJECT_LLC_VICTIM\0"
+    "RXC_WBQ1_REJECT_SF_VICTIM\0"
+    "RXC_WBQ1_REJECT_VICTIM\0"
+    "RXC_WBQ1_REJECT_LLC_OR_SF_WAY\0"
+    "RXC_WBQ1_REJECT_ALLOW_SNP\0"
+    "RXC_WBQ1_REJECT_PA_MATCH\0"
+    "SNOOPS_SENT_ALL\0"
+    "SNOOPS_SENT_LOCAL\0"
+    "SNOOPS_SENT_REMOTE\0"
+    "SNOOPS_SENT_BCST_LOCAL\0"
+    "SNOOPS_SENT_BCST_REMOTE\0"
+    "SNOOPS_SENT_DIRECT_LOCAL\0"
+    "SNOOPS_SENT_DIRECT_REMOTE\0"
+    "SNOOPS_RESP_RSPI\0"
+    "SNOOPS_RESP_RSPS\0"
+    "SNOOPS_RESP_RSPIFWD\0"
+    "SNOOPS_RESP_RSPSFWD\0"
+    "SNOOPS_RESP_RSP_WBWB\0"
+    "SNOOPS_RESP_RSP_FWD_WB\0"
+    "SNOOPS_RESP_RSPCNFLCTS\0"
+    "SNOOPS_RESP_RSPFWD\0"
+    "SNOOPS_RESP_LOCAL_RSPI\0"
+    "SNOOPS_RESP_LOCAL_RSPS\0"
+    "SNOOPS_RESP_LOCAL_RSPIFWD\0"
+    "SNOOPS_RESP_LOCAL_RSPSFWD\0"
+    "SNOOPS_RESP_LOCAL_RSP_WBWB\0"
+    "SNOOPS_RESP_LOCAL_RSP_FWD_WB\0"
+    "SNOOPS_RESP_LOCAL_RSPCNFLCTS\0"
+    "SNOOPS_RESP_LOCAL_RSPFWD\0"
+    "TOR_INSERTS_IRQ\0"
+    "TOR_INSERTS_EVICT\0"
+    "TOR_INSERTS_PRQ\0"
+    "TOR_INSERTS_IPQ\0"
+    "TOR_INSERTS_HIT\0"
+    "TOR_INSERTS_IA_HIT\0"
+    "TOR_INSERTS_IO_HIT\0"
+    "TOR_INSERTS_ALL_HIT\0"
+    "TOR_INSERTS_MISS\0"
+    "TOR_INSERTS_IA_MISS\0"
+    "TOR_INSERTS_IO_MISS\0"
+    "TOR_INSERTS_ALL_MISS\0"
+    "TOR_INSERTS_IA\0"
+    "TOR_INSERTS_IO\0"
+    "TOR_INSERTS_ALL_IO_IA\0"
+    "TOR_OCCUPANCY_IRQ\0"
+    "TOR_OCCUPANCY_EVICT\0"
+    "TOR_OCCUPANCY_PRQ\0"
+    "TOR_OCCUPANCY_IPQ\0"
+    "TOR_OCCUPANCY_HIT\0"
+    "TOR_OCCUPANCY_IA_HIT\0"
+    "TOR_OCCUPANCY_IO_HIT\0"
+    "TOR_OCCUPANCY_ALL_HIT\0"
+    "TOR_OCCUPANCY_MISS\0"
+    "TOR_OCCUPANCY_IA_MISS\0"
+    "TOR_OCCUPANCY_IO_MISS\0"
+    "TOR_OCCUPANCY_ALL_MISS\0"
+    "TOR_OCCUPANCY_IA\0"
+    "TOR_OCCUPANCY_IO\0"
+    "WB_PUSH_MTOI_LLC\0"
+    "WB_PUSH_MTOI_MEM\0"
+    "XSNP_RESP_EXT_RSP_HITFSE\0"
+    "XSNP_RESP_EXT_RSPS_FWDFE\0"
+    "XSNP_RESP_EXT_RSPI_FWDFE\0"
+    "XSNP_RESP_EXT_RSPS_FWDM\0"
+    "XSNP_RESP_EXT_RSPI_FWDM\0"
+    "XSNP_RESP_CORE_RSP_HITFSE\0"
+    "XSNP_RESP_CORE_RSPS_FWDFE\0"
+    "XSNP_RESP_CORE_RSPI_FWDFE\0"
+    "XSNP_RESP_CORE_RSPS_FWDM\0"
+    "XSNP_RESP_CORE_RSPI_FWDM\0"
+    "XSNP_RESP_EVICT_RSP_HITFSE\0"
+    "XSNP_RESP_EVICT_RSPS_FWDFE\0"
+    "XSNP_RESP_EVICT_RSPI_FWDFE\0"
+    "XSNP_RESP_EVICT_RSPS_FWDM\0"
+    "XSNP_RESP_EVICT_RSPI_FWDM\0"
+    "XSNP_RESP_ANY_RSP_HITFSE\0"
+    "XSNP_RESP_ANY_RSPS_FWDFE\0"
+    "XSNP_RESP_ANY_RSPI_FWDFE\0"
+    "XSNP_RESP_ANY_RSPS_FWDM\0"
+    "ACT_COUNT_RD\0"
+    "MBOX\0"
+    "ACT_COUNT_WR\0"
+    "ACT_COUNT_BYP\0"
+    "BYP_CMDS_ACT\0"
+    "BYP_CMDS_CAS\0"
+    "BYP_CMDS_PRE\0"
+    "CAS_COUNT_RD_REG\0"
+    "CAS_COUNT_RD_UNDERFILL\0"
+    "CAS_COUNT_RD\0"
+    "CAS_COUNT_WR_WMM\0"
+    "CAS_COUNT_WR_RMM\0"
+    "CAS_COUNT_WR\0"
+    "CAS_COUNT_RD_WMM\0"
+    "CAS_COUNT_RD_RMM\0"
+    "CAS_COUNT_RD_ISOCH\0"
+    "CAS_COUNT_WR_ISOCH\0"
+    "DRAM_CLOCKTICKS\0"
+    "MBOX0FIX|MBOX1FIX|MBOX2FIX|MBOX3FIX|MBOX4FIX|MBOX5FIX\0"
+    "WBOX_CLOCKTICKS\0"
+    "WBOX\0"
+    "CORE_TRANSITION_CYCLES\0"
+    "CTS_EVENT0\0"
+    "CTS_EVENT1\0"
+    "DEMOTIONS\0"
+    "FIVR_PS_PS0_CYCLES\0"
+    "FIVR_PS_PS1_CYCLES\0"
+    "FIVR_PS_PS2_CYCLES\0"
+    "FIVR_PS_PS3_CYCLES\0"
+    "FREQ_MAX_LIMIT_THERMAL_CYCLES\0"
+    "FREQ_MAX_POWER_CYCLES\0"
+    "FREQ_MIN_IO_P_CYCLES\0"
+    "FREQ_TRANS_CYCLES\0"
+    "MCP_PROCHOT_CYCLES\0"
+    "MEMORY_PHASE_SHEDDING_CYCLES\0"
+    "PKG_RESIDENCY_C0_CYCLES\0"
+    "PKG_RESIDENCY_C2E_CYCLES\0"
+    "PKG_RESIDENCY_C3_CYCLES\0"
+    "PKG_RESIDENCY_C6_CYCLES\0"
+    "PMAX_THROTTLED_CYCLES\0"
+    "PROCHOT_EXTERNAL_CYCLES\0"
+    "PROCHOT_INTERNAL_CYCLES\0"
+    "TOTAL_TRANSITION_CYCLES\0"
+    "VR_HOT_CYCLES\0"
+    "CORES_IN_C3\0"
+    "WBOX0FIX\0"
+    "CORES_IN_C6\0"
+    "WBOX1FIX\0"
+    "CORES_IN_P3\0"
+    "WBOX2FIX\0"
+    "CORES_IN_P6\0"
+    "WBOX3FIX\0"
+    "M2M_CLOCKTICKS\0"
+    "M2M\0"
+    "BYPASS_M2M_EGRESS_TAKEN\0"
+    "BYPASS_M2M_EGRESS_NOT_TAKEN\0"
+    "BYPASS_M2M_INGRESS_TAKEN\0"
+    "BYPASS_M2M_INGRESS_NOT_TAKEN\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "DDRT_RPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "DDRT_RPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "DDRT_WPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "DDRT_WPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "DIRECT2CORE_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2CORE_TAKEN\0"
+    "DIRECT2CORE_TXN_OVERRIDE\0"
+    "DIRECT2UPI_NOT_TAKEN_CREDITS\0"
+    "DIRECT2UPI_NOT_TAKEN_DIRSTATE\0"
+    "DIRECT2UPI_TAKEN\0"
+    "DIRECT2UPI_TXN_OVERRIDE\0"
+    "DIRECTORY_HIT_DIRTY_I\0"
+    "DIRECTORY_HIT_DIRTY_S\0"
+    "DIRECTORY_HIT_DIRTY_P\0"
+    "DIRECTORY_HIT_DIRTY_A\0"
+    "DIRECTORY_HIT_CLEAN_I\0"
+    "DIRECTORY_HIT_CLEAN_S\0"
+    "DIRECTORY_HIT_CLEAN_P\0"
+    "DIRECTORY_HIT_CLEAN_A\0"
+    "DIRECTORY_LOOKUP_ANY\0"
+    "DIRECTORY_LOOKUP_STATE_I\0"
+    "DIRECTORY_LOOKUP_STATE_S\0"
+    "DIRECTORY_LOOKUP_STATE_A\0"
+    "DIRECTORY_MISS_DIRTY_I\0"
+    "DIRECTORY_MISS_DIRTY_S\0"
+    "DIRECTORY_MISS_DIRTY_P\0"
+    "DIRECTORY_MISS_DIRTY_A\0"
+    "DIRECTORY_MISS_CLEAN_I\0"
+    "DIRECTORY_MISS_CLEAN_S\0"
+    "DIRECTORY_MISS_CLEAN_P\0"
+    "DIRECTORY_MISS_CLEAN_A\0"
+    "DIRECTORY_UPDATE_ANY\0"
+    "DIRECTORY_UPDATE_I2S\0"
+    "DIRECTORY_UPDATE_I2A\0"
+    "DIRECTORY_UPDATE_S2I\0"
+    "DIRECTORY_UPDATE_S2A\0"
+    "DIRECTORY_UPDATE_A2I\0"
+    "DIRECTORY_UPDATE_A2S\0"
+    "IMC_READS_NORMAL\0"
+    "IMC_READS_ISOCH\0"
+    "IMC_READS_ALL\0"
+    "IMC_READS_TO_DDRT\0"
+    "IMC_READS_FROM_TRANSGRESS\0"
+    "IMC_WRITES_FULL\0"
+    "IMC_WRITES_PARTIAL\0"
+    "IMC_WRITES_FULL_ISOCH\0"
+    "IMC_WRITES_PARTIAL_ISOCH\0"
+    "IMC_WRITES_ALL\0"
+    "IMC_WRITES_TO_DDRT\0"
+    "IMC_WRITES_FROM_TRANSGRESS\0"
+    "IMC_WRITES_NI\0"
+    "PCOMMITS\0"
+    "PCOMMIT_COALESCED\0"
+    "PKT_MATCH_MESH\0"
+    "PKT_MATCH_MC\0"
+    "PREFCAM_CYCLES_FULL\0"
+    "PREFCAM_CYCLES_NE\0"
+    "PREFCAM_DEMAND_PROMOTIONS\0"
+    "PREFCAM_INSERTS\0"
+    "PREFCAM_OCCUPANCY\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "RPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "RPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN0\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN1\0"
+    "RPQ_CYCLES_SPEC_CREDITS_CHN2\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN0\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN1\0"
+    "RPQ_CYCLES_SPEC_NO_CREDITS_CHN2\0"
+    "RXC_AD_CYCLES_FULL\0"
+    "RXC_AD_CYCLES_NE\0"
+    "RXC_AD_INSERTS\0"
+    "RXC_AD_OCCUPANCY\0"
+    "RXC_BL_CYCLES_FULL\0"
+    "RXC_BL_CYCLES_NE\0"
+    "RXC_BL_INSERTS\0"
+    "RXC_BL_OCCUPANCY\0"
+    "SCOREBOARD_AD_RETRY_ACCEPTS\0"
+    "SCOREBOARD_AD_RETRY_REJECTS\0"
+    "SCOREBOARD_BL_RETRY_ACCEPTS\0"
+    "SCOREBOARD_BL_RETRY_REJECTS\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN0\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN1\0"
+    "SCOREBOARD_CYCLES_REG_CREDITS_CHN2\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "SCOREBOARD_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "SCOREBOARD_RD_RETRY_ACCEPTS\0"
+    "SCOREBOARD_RD_RETRY_REJECTS\0"
+    "SCOREBOARD_WR_RETRY_ACCEPTS\0"
+    "SCOREBOARD_WR_RETRY_REJECTS\0"
+    "TAG_HIT_NM_DRD_HIT_CLEAN\0"
+    "TAG_HIT_NM_DRD_HIT_DIRTY\0"
+    "TAG_HIT_NM_UFILL_HIT_CLEAN\0"
+    "TAG_HIT_NM_UFILL_HIT_DIRTY\0"
+    "TGR_AD_CREDITS\0"
+    "TGR_BL_CREDITS\0"
+    "TRACKER_CYCLES_FULL_CHN0\0"
+    "TRACKER_CYCLES_FULL_CHN1\0"
+    "TRACKER_CYCLES_FULL_CHN2\0"
+    "TRACKER_CYCLES_FULL_ALL\0"
+    "TRACKER_CYCLES_NE_CHN0\0"
+    "TRACKER_CYCLES_NE_CHN1\0"
+    "TRACKER_CYCLES_NE_CHN2\0"
+    "TRACKER_CYCLES_NE_ALL\0"
+    "TRACKER_CYCLES_INSERTS_CHN0\0"
+    "TRACKER_CYCLES_INSERTS_CHN1\0"
+    "TRACKER_CYCLES_INSERTS_CHN2\0"
+    "TRACKER_CYCLES_INSERTS_ALL\0"
+    "TRACKER_PENDING_OCCUPANCY\0"
+    "TXC_AD_CREDITS_ACQUIRED\0"
+    "TXC_AD_CREDITS_OCCUPANCY\0"
+    "TXC_AD_CYCLES_FULL\0"
+    "TXC_AD_CYCLES_NE\0"
+    "TXC_AD_INSERTS\0"
+    "TXC_AD_NO_CREDIT_CYCLES\0"
+    "TXC_AD_NO_CREDIT_STALLED\0"
+    "TXC_AD_OCCUPANCY\0"
+    "TXC_AK_NDR\0"
+    "TXC_AK_CRD_CBO\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_AK_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_AK_CREDITS_ACQUIRED_ALL\0"
+    "TXC_AK_CREDITS_OCCUPANCY_CMS0\0"
+    "TXC_AK_CREDITS_OCCUPANCY_CMS1\0"
+    "TXC_AK_CREDITS_OCCUPANCY_ALL\0"
+    "TXC_AK_CYCLES_FULL_CMS0\0"
+    "TXC_AK_CYCLES_FULL_CMS1\0"
+    "TXC_AK_CYCLES_FULL_ALL\0"
+    "TXC_AK_CYCLES_FULL_PCOMMIT\0"
+    "TXC_AK_CYCLES_FULL_RDCRD0\0"
+    "TXC_AK_CYCLES_FULL_WRCRD0\0"
+    "TXC_AK_CYCLES_FULL_WRCMP0\0"
+    "TXC_AK_CYCLES_FULL_RDCRD1\0"
+    "TXC_AK_CYCLES_FULL_WRCRD1\0"
+    "TXC_AK_CYCLES_FULL_WRCMP1\0"
+    "TXC_AK_CYCLES_NE_CMS0\0"
+    "TXC_AK_CYCLES_NE_CMS1\0"
+    "TXC_AK_CYCLES_NE_ALL\0"
+    "TXC_AK_CYCLES_NE_PCOMMIT\0"
+    "TXC_AK_CYCLES_NE_RDCRD\0"
+    "TXC_AK_CYCLES_NE_WRCRD\0"
+    "TXC_AK_CYCLES_NE_WRCMP\0"
+    "TXC_AK_INSERTS_CMS0\0"
+    "TXC_AK_INSERTS_CMS1\0"
+    "TXC_AK_INSERTS_ALL\0"
+    "TXC_AK_INSERTS_WRCRD\0"
+    "TXC_AK_INSERTS_RDCRD\0"
+    "TXC_AK_INSERTS_WRCMP\0"
+    "TXC_AK_INSERTS_PREF_RD_CAM_HIT\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_AK_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_AK_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_AK_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_AK_NO_CREDIT_STALLED_ALL\0"
+    "TXC_AK_OCCUPANCY_CMS0\0"
+    "TXC_AK_OCCUPANCY_CMS1\0"
+    "TXC_AK_OCCUPANCY_ALL\0"
+    "TXC_AK_OCCUPANCY_PCOMMIT\0"
+    "TXC_AK_OCCUPANCY_RDCRD\0"
+    "TXC_AK_OCCUPANCY_WRCRD\0"
+    "TXC_AK_OCCUPANCY_WRCMP\0"
+    "TXC_AK_SIDEBAND_RD\0"
+    "TXC_AK_SIDEBAND_WR\0"
+    "TXC_BL_DRS_CACHE\0"
+    "TXC_BL_DRS_CORE\0"
+    "TXC_BL_DRS_UPI\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS0\0"
+    "TXC_BL_CREDITS_ACQUIRED_CMS1\0"
+    "TXC_BL_CREDITS_ACQUIRED_ALL\0"
+    "TXC_BL_CREDITS_OCCUPANCY_CMS0\0"
+    "TXC_BL_CREDITS_OCCUPANCY_CMS1\0"
+    "TXC_BL_CREDITS_OCCUPANCY_ALL\0"
+    "TXC_BL_CYCLES_FULL_CMS0\0"
+    "TXC_BL_CYCLES_FULL_CMS1\0"
+    "TXC_BL_CYCLES_FULL_ALL\0"
+    "TXC_BL_CYCLES_NE_CMS0\0"
+    "TXC_BL_CYCLES_NE_CMS1\0"
+    "TXC_BL_CYCLES_NE_ALL\0"
+    "TXC_BL_INSERTS_CMS0\0"
+    "TXC_BL_INSERTS_CMS1\0"
+    "TXC_BL_INSERTS_ALL\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS0\0"
+    "TXC_BL_NO_CREDIT_CYCLES_CMS1\0"
+    "TXC_BL_NO_CREDIT_CYCLES_ALL\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS0\0"
+    "TXC_BL_NO_CREDIT_STALLED_CMS1\0"
+    "TXC_BL_NO_CREDIT_STALLED_ALL\0"
+    "TXC_BL_OCCUPANCY_CMS0\0"
+    "TXC_BL_OCCUPANCY_CMS1\0"
+    "TXC_BL_OCCUPANCY_ALL\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN0\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN1\0"
+    "WPQ_CYCLES_REG_CREDITS_CHN2\0"
+    "WPQ_CYCLES_REG_CREDITS_ALL\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN0\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN1\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_CHN2\0"
+    "WPQ_CYCLES_REG_NO_CREDITS_ALL\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN0\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN1\0"
+    "WPQ_CYCLES_SPEC_CREDITS_CHN2\0"
+    "WPQ_CYCLES_SPEC_CREDITS_ALL\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN0\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN1\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_CHN2\0"
+    "WPQ_CYCLES_SPEC_NO_CREDITS_ALL\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH0\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH1\0"
+    "WRITE_TRACKER_CYCLES_FULL_CH2\0"
+    "WRITE_TRACKER_CYCLES_FULL_ALL\0"
+    "WRITE_TRACKER_CYCLES_NE_CH0\0"
+    "WRITE_TRACKER_CYCLES_NE_CH1\0"
+    "WRITE_TRACKER_CYCLES_NE_CH2\0"
+    "WRITE_TRACKER_CYCLES_NE_ALL\0"
+    "WRITE_TRACKER_INSERTS_CH0\0"
+    "WRITE_TRACKER_INSERTS_CH1\0"
+    "WRITE_TRACKER_INSERTS_CH2\0"
+    "WRITE_TRACKER_INSERTS_ALL\0"
+    "WRITE_TRACKER_OCCUPANCY_CH0\0"
+    "WRITE_TRACKER_OCCUPANCY_CH1\0"
+    "WRITE_TRACKER_OCCUPANCY_CH2\0"
+    "WRITE_TRACKER_OCCUPANCY_ALL\0"
+    "SBOX_CLOCKTICKS\0"
+    "SBOX\0"
+    "DIRECT_ATTEMPTS_D2C\0"
+    "DIRECT_ATTEMPTS_D2K\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ0\0"
+    "SBOX|CBOX|PBOX\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AD_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_BL_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ0\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ1\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ2\0"
+    "FLOWQ_NO_VNA_CRD_AK_VNA_EQ3\0"
+    "L1_POWER_CYCLES\0"
+    "M3_BYP_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_BYP_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_BYP_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_BYP_BLOCKED_BGF_CRD\0"
+    "M3_BYP_BLOCKED_GV_BLOCK\0"
+    "M3_CRD_RETURN_BLOCKED\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_LE2\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AD_VNA_BTW_2_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_EQ0\0"
+    "M3_RXQ_BLOCKED_FLOWQ_BL_VNA_BTW_0_THRESH\0"
+    "M3_RXQ_BLOCKED_FLOWQ_AK_VNA_LE3\0"
+    "M3_RXQ_BLOCKED_BGF_CRD\0"
+    "M3_RXQ_BLOCKED_GV_BLOCK\0"
+    "PHY_INIT_CYCLES\0"
+    "POWER_L1_NACK\0"
+    "POWER_L1_REQ\0"
+    "REQ_SLOT2_FROM_M3_VNA\0"
+    "REQ_SLOT2_FROM_M3_VN0\0"
+    "REQ_SLOT2_FROM_M3_VN1\0"
+    "REQ_SLOT2_FROM_M3_ACK\0"
+    "RXL0P_POWER_CYCLES\0"
+    "RXL0P_POWER_TRANSITION_COUNT\0"
+    "RXL0_POWER_CYCLES\0"
+    "RXL_BASIC_HDR_MATCH_REQ\0"
+    "RXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "RXL_BASIC_HDR_MATCH_SNP\0"
+    "RXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "RXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "RXL_BASIC_HDR_MATCH_WB\0"
+    "RXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCB\0"
+    "RXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "RXL_BASIC_HDR_MATCH_NCS\0"
+    "RXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "RXL_BYPASSED_SLOT0\0"
+    "RXL_BYPASSED_SLOT1\0"
+    "RXL_BYPASSED_SLOT2\0"
+    "RXL_CREDITS_CONSUMED_VN0\0"
+    "RXL_CREDITS_CONSUMED_VN1\0"
+    "RXL_CREDITS_CONSUMED_VNA\0"
+    "RXL_FLITS_SLOT0\0"
+    "RXL_FLITS_SLOT1\0"
+    "RXL_FLITS_SLOT2\0"
+    "RXL_FLITS_DATA\0"
+    "RXL_FLITS_ALL_DATA\0"
+    "RXL_FLITS_LLCRD\0"
+    "RXL_FLITS_NULL\0"
+    "RXL_FLITS_LLCTRL\0"
+    "RXL_FLITS_IDLE\0"
+    "RXL_FLITS_PROTHDR\0"
+    "RXL_FLITS_NON_DATA\0"
+    "RXL_INSERTS\0"
+    "RXL_OCCUPANCY_SLOT0\0"
+    "RXL_OCCUPANCY_SLOT1\0"
+    "RXL_OCCUPANCY_SLOT2\0"
+    "RXL_SLOT_BYPASS_S0_RXQ1\0"
+    "RXL_SLOT_BYPASS_S0_RXQ2\0"
+    "RXL_SLOT_BYPASS_S1_RXQ0\0"
+    "RXL_SLOT_BYPASS_S1_RXQ2\0"
+    "RXL_SLOT_BYPASS_S2_RXQ0\0"
+    "RXL_SLOT_BYPASS_S2_RXQ1\0"
+    "TXL0P_CLK_ACTIVE_CFG_CTL\0"
+    "TXL0P_CLK_ACTIVE_RXQ\0"
+    "TXL0P_CLK_ACTIVE_RXQ_BYPASS\0"
+    "TXL0P_CLK_ACTIVE_RXQ_CRED\0"
+    "TXL0P_CLK_ACTIVE_TXQ\0"
+    "TXL0P_CLK_ACTIVE_RETRY\0"
+    "TXL0P_CLK_ACTIVE_DFX\0"
+    "TXL0P_CLK_ACTIVE_SPARE\0"
+    "TXL0P_POWER_CYCLES\0"
+    "TXL0P_POWER_TRANSITION_COUNT\0"
+    "TXL0P_POWER_CYCLES_LL_ENTER\0"
+    "TXL0P_POWER_CYCLES_M3_EXIT\0"
+    "TXL0_POWER_CYCLES\0"
+    "TXL_BASIC_HDR_MATCH_REQ\0"
+    "TXL_BASIC_HDR_MATCH_REQ_OPC\0"
+    "TXL_BASIC_HDR_MATCH_SNP\0"
+    "TXL_BASIC_HDR_MATCH_SNP_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_NODATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA\0"
+    "TXL_BASIC_HDR_MATCH_RSP_DATA_OPC\0"
+    "TXL_BASIC_HDR_MATCH_WB\0"
+    "TXL_BASIC_HDR_MATCH_WB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCB\0"
+    "TXL_BASIC_HDR_MATCH_NCB_OPC\0"
+    "TXL_BASIC_HDR_MATCH_NCS\0"
+    "TXL_BASIC_HDR_MATCH_NCS_OPC\0"
+    "TXL_BYPASSED\0"
+    "TXL_FLITS_SLOT0\0"
+    "TXL_FLITS_SLOT1\0"
+    "TXL_FLITS_SLOT2\0"
+    "TXL_FLITS_DATA\0"
+    "TXL_FLITS_ALL_DATA\0"
+    "TXL_FLITS_LLCRD\0"
+    "TXL_FLITS_NULL\0"
+    "TXL_FLITS_LLCTRL\0"
+    "TXL_FLITS_IDLE\0"
+    "TXL_FLITS_PROTHDR\0"
+    "TXL_FLITS_NON_DATA\0"
+    "TXL_INSERTS\0"
+    "TXL_OCCUPANCY_SLOT0\0"
+    "TXL_OCCUPANCY_SLOT1\0"
+    "TXL_OCCUPANCY_SLOT2\0"
+    "VNA_CREDIT_RETURN_BLOCKED_VN01\0"
+    "VNA_CREDIT_RETURN_OCCUPANCY\0"
+    "PBOX_CLOCKTICKS\0"
+    "PBOX\0"
+    "IIO_CREDITS_ACQUIRED_DRS_0\0"
+    "IIO_CREDITS_ACQUIRED_DRS_1\0"
+    "IIO_CREDITS_ACQUIRED_NCB_0\0"
+    "IIO_CREDITS_ACQUIRED_NCB_1\0"
+    "IIO_CREDITS_ACQUIRED_NCS_0\0"
+    "IIO_CREDITS_ACQUIRED_NCS_1\0"
+    "IIO_CREDITS_REJECT_DRS\0"
+    "IIO_CREDITS_REJECT_NCB\0"
+    "IIO_CREDITS_REJECT_NCS\0"
+    "IIO_CREDITS_USED_DRS_0\0"
+    "IIO_CREDITS_USED_DRS_1\0"
+    "IIO_CREDITS_USED_NCB_0\0"
+    "IIO_CREDITS_USED_NCB_1\0"
+    "IIO_CREDITS_USED_NCS_0\0"
+    "IIO_CREDITS_USED_NCS_1\0"
+    "RXC_CYCLES_NE_CBO_IDI\0"
+    "RXC_CYCLES_NE_CBO_NCB\0"
+    "RXC_CYCLES_NE_CBO_NCS\0"
+    "RXC_CYCLES_NE_QPI_INCS\0"
+    "RXC_CYCLES_NE_IIO_INCB\0"
+    "RXC_CYCLES_NE_IIO_INCS\0"
+    "RXC_CYCLES_NE_ALL\0"
+    "RXC_INSERTS_CBO_IDI\0"
+    "RXC_INSERTS_CBO_NCB\0"
+    "RXC_INSERTS_CBO_NCS\0"
+    "RXC_INSERTS_QPI_INCS\0"
+    "RXC_INSERTS_IIO_INCB\0"
+    "RXC_INSERTS_IIO_INCS\0"
+    "RXC_INSERTS_ALL\0"
+    "RXC_OCCUPANCY_CBO_IDI\0"
+    "PBOX0C0|PBOX1C0|PBOX2C0|PBOX3C0\0"
+    "RXC_OCCUPANCY_CBO_NCB\0"
+    "RXC_OCCUPANCY_CBO_NCS\0"
+    "RXC_OCCUPANCY_QPI_INCS\0"
+    "RXC_OCCUPANCY_IIO_INCB\0"
+    "RXC_OCCUPANCY_IIO_INCS\0"
+    "RXC_OCCUPANCY_ALL\0"
+    "TXC_CREDITS_PRQ_0\0"
+    "PBOX0C0|PBOX1C0|PBOX2C0|PBOX3C0|PBOX0C1|PBOX1C1|PBOX2C1|PBOX3C1\0"
+    "TXC_CREDITS_PRQ_1\0"
+    "TXC_CREDITS_ISOCH_0\0"
+    "TXC_CREDITS_ISOCH_1\0"
+    "TXC_CYCLES_FULL_AD_0\0"
+    "TXC_CYCLES_FULL_AK_0\0"
+    "TXC_CYCLES_FULL_BL_0\0"
+    "TXC_CYCLES_FULL_AD_1\0"
+    "TXC_CYCLES_FULL_AK_1\0"
+    "TXC_CYCLES_FULL_BL_1\0"
+    "TXC_CYCLES_NE_AD_0\0"
+    "TXC_CYCLES_NE_AK_0\0"
+    "TXC_CYCLES_NE_BL_0\0"
+    "TXC_CYCLES_NE_AD_1\0"
+    "TXC_CYCLES_NE_AK_1\0"
+    "TXC_CYCLES_NE_BL_1\0"
+    "TXC_INSERTS_AD_0\0"
+    "TXC_INSERTS_AK_0\0"
+    "TXC_INSERTS_BL_0\0"
+    "TXC_INSERTS_AK_CRD_0\0"
+    "TXC_INSERTS_AD_1\0"
+    "TXC_INSERTS_AK_1\0"
+    "TXC_INSERTS_BL_1\0"
+    "TXC_INSERTS_AK_CRD_1\0"
+    "TXC_OCCUPANCY_AD_0\0"
+    "TXC_OCCUPANCY_AK_0\0"
+    "TXC_OCCUPANCY_BL_0\0"
+    "TXC_OCCUPANCY_AD_1\0"
+    "TXC_OCCUPANCY_AK_1\0"
+    "TXC_OCCUPANCY_BL_1\0"
+    "RBOX_CLOCKTICKS\0"
+    "RBOX\0"
+    "CHA_AD_CREDITS_EMPTY_VNA\0"
+    "CHA_AD_CREDITS_EMPTY_WB\0"
+    "CHA_AD_CREDITS_EMPTY_REQ\0"
+    "CHA_AD_CREDITS_EMPTY_SNP\0"
+    "D2C_SENT\0"
+    "D2U_SENT\0"
+    "M2_BL_CREDITS_EMPTY_IIO0_IIO1_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO2_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO3_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO4_NCB\0"
+    "M2_BL_CREDITS_EMPTY_IIO5_NCB\0"
+    "M2_BL_CREDITS_EMPTY_NCS\0"
+    "M2_BL_CREDITS_EMPTY_NCS_SEL\0"
+    "MULTI_SLOT_RCVD_AD_SLOT0\0"
+    "MULTI_SLOT_RCVD_AD_SLOT1\0"
+    "MULTI_SLOT_RCVD_AD_SLOT2\0"
+    "MULTI_SLOT_RCVD_BL_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT0\0"
+    "MULTI_SLOT_RCVD_AK_SLOT2\0"
+    "RXC_ARB_LOST_VN0_AD_REQ\0"
+    "RXC_ARB_LOST_VN0_AD_SNP\0"
+    "RXC_ARB_LOST_VN0_AD_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_RSP\0"
+    "RXC_ARB_LOST_VN0_BL_WB\0"
+    "RXC_ARB_LOST_VN0_BL_NCB\0"
+    "RXC_ARB_LOST_VN0_BL_NCS\0"
+    "RXC_ARB_LOST_VN1_AD_REQ\0"
+    "RXC_ARB_LOST_VN1_AD_SNP\0"
+    "RXC_ARB_LOST_VN1_AD_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_RSP\0"
+    "RXC_ARB_LOST_VN1_BL_WB\0"
+    "RXC_ARB_LOST_VN1_BL_NCB\0"
+    "RXC_ARB_LOST_VN1_BL_NCS\0"
+    "RXC_ARB_MISC_PAR_BIAS_VN0\0"
+    "RXC_ARB_MISC_PAR_BIAS_VN1\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_AD_VN1\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN0\0"
+    "RXC_ARB_MISC_NO_PROG_BL_VN1\0"
+    "RXC_ARB_MISC_ADBL_PARALLEL_WIN\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_REQ\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_SNP\0"
+    "RXC_ARB_NOAD_REQ_VN0_AD_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_WB\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_NCB\0"
+    "RXC_ARB_NOAD_REQ_VN0_BL_NCS\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_REQ\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_SNP\0"
+    "RXC_ARB_NOAD_REQ_VN1_AD_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_RSP\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_WB\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_NCB\0"
+    "RXC_ARB_NOAD_REQ_VN1_BL_NCS\0"
+    "RXC_ARB_NOCRED_VN0_AD_REQ\0"
+    "RXC_ARB_NOCRED_VN0_AD_SNP\0"
+    "RXC_ARB_NOCRED_VN0_AD_RSP\0"
+    "RXC_ARB_NOCRED_VN0_BL_RSP\0"
+    "RXC_ARB_NOCRED_VN0_BL_WB\0"
+    "RXC_ARB_NOCRED_VN0_BL_NCB\0"
+    "RXC_ARB_NOCRED_VN0_BL_NCS\0"
+    "RXC_ARB_NOCRED_VN1_AD_REQ\0"
+    "RXC_ARB_NOCRED_VN1_AD_SNP\0"
+    "RXC_ARB_NOCRED_VN1_AD_RSP\0"
+    "RXC_ARB_NOCRED_VN1_BL_RSP\0"
+    "RXC_ARB_NOCRED_VN1_BL_WB\0"
+    "RXC_ARB_NOCRED_VN1_BL_NCB\0"
+    "RXC_ARB_NOCRED_VN1_BL_NCS\0"
+    "RXC_BYPASSED_AD_S0_IDLE\0"
+    "RXC_BYPASSED_AD_S0_BL_ARB\0"
+    "RXC_BYPASSED_AD_S1_BL_SLOT\0"
+    "RXC_BYPASSED_AD_S2_BL_SLOT\0"
+    "RXC_COLLISION_VN0_AD_REQ\0"
+    "RXC_COLLISION_VN0_AD_SNP\0"
+    "RXC_COLLISION_VN0_AD_RSP\0"
+    "RXC_COLLISION_VN0_BL_RSP\0"
+    "RXC_COLLISION_VN0_BL_WB\0"
+    "RXC_COLLISION_VN0_BL_NCB\0"
+    "RXC_COLLISION_VN0_BL_NCS\0"
+    "RXC_COLLISION_VN1_AD_REQ\0"
+    "RXC_COLLISION_VN1_AD_SNP\0"
+    "RXC_COLLISION_VN1_AD_RSP\0"
+    "RXC_COLLISION_VN1_BL_RSP\0"
+    "RXC_COLLISION_VN1_BL_WB\0"
+    "RXC_COLLISION_VN1_BL_NCB\0"
+    "RXC_COLLISION_VN1_BL_NCS\0"
+    "RXC_CRD_MISC_ANY_BGF_FIFO\0"
+    "RXC_CRD_MISC_ANY_BGF_PATH\0"
+    "RXC_CRD_MISC_NO_D2K_FOR_ARB\0"
+    "RXC_CRD_OCC_VNA_IN_USE\0"
+    "RXC_CRD_OCC_FLITS_IN_FIFO\0"
+    "RXC_CRD_OCC_FLITS_IN_PATH\0"
+    "RXC_CRD_OCC_TXQ_CRD\0"
+    "RXC_CRD_OCC_D2K_CRD\0"
+    "RXC_CRD_OCC_P1P_TOTAL\0"
+    "RXC_CRD_OCC_P1P_FIFO\0"
+    "RXC_CYCLES_NE_VN0_AD_REQ\0"
+    "RXC_CYCLES_NE_VN0_AD_SNP\0"
+    "RXC_CYCLES_NE_VN0_AD_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_RSP\0"
+    "RXC_CYCLES_NE_VN0_BL_WB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCB\0"
+    "RXC_CYCLES_NE_VN0_BL_NCS\0"
+    "RXC_CYCLES_NE_VN1_AD_REQ\0"
+    "RXC_CYCLES_NE_VN1_AD_SNP\0"
+    "RXC_CYCLES_NE_VN1_AD_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_RSP\0"
+    "RXC_CYCLES_NE_VN1_BL_WB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCB\0"
+    "RXC_CYCLES_NE_VN1_BL_NCS\0"
+    "RXC_FLITS_DATA_NOT_SENT_ALL\0"
+    "RXC_FLITS_DATA_NOT_SENT_NO_BGF\0"
+    "RXC_FLITS_DATA_NOT_SENT_NO_TXQ\0"
+    "RXC_FLITS_GEN_BL_P0_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1_WAIT\0"
+    "RXC_FLITS_GEN_BL_P1P_TO_LIMBO\0"
+    "RXC_FLITS_GEN_BL_P1P_BUSY\0"
+    "RXC_FLITS_GEN_BL_P1P_AT_LIMIT\0"
+    "RXC_FLITS_GEN_BL_P1P_HOLD_P0\0"
+    "RXC_FLITS_GEN_BL_P1P_FIFO_FULL\0"
+    "RXC_FLITS_MISC\0"
+    "RXC_FLITS_SENT_1_MSG\0"
+    "RXC_FLITS_SENT_2_MSGS\0"
+    "RXC_FLITS_SENT_3_MSGS\0"
+    "RXC_FLITS_SENT_1_MSG_VNX\0"
+    "RXC_FLITS_SENT_SLOTS_1\0"
+    "RXC_FLITS_SENT_SLOTS_2\0"
+    "RXC_FLITS_SENT_SLOTS_3\0"
+    "RXC_FLITS_SLOT_BL_ALL\0"
+    "RXC_FLITS_SLOT_BL_NEED_DATA\0"
+    "RXC_FLITS_SLOT_BL_P0_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_WAIT\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_BUT_BUBBLE\0"
+    "RXC_FLITS_SLOT_BL_P1_NOT_REQ_NOT_AVAIL\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_READ\0"
+    "RXC_FLIT_GEN_HDR1_ACCUM_WASTED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_BLOCKED\0"
+    "RXC_FLIT_GEN_HDR1_AHEAD_MSG\0"
+    "RXC_FLIT_GEN_HDR1_PAR\0"
+    "RXC_FLIT_GEN_HDR1_PAR_MSG\0"
+    "RXC_FLIT_GEN_HDR1_PAR_FLIT\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL\0"
+    "RXC_FLIT_GEN_HDR2_RMSTALL_NOMSG\0"
+    "RXC_FLIT_NOT_SENT_ALL\0"
+    "RXC_FLIT_NOT_SENT_NO_BGF_CRD\0"
+    "RXC_FLIT_NOT_SENT_NO_TXQ_CRD\0"
+    "RXC_FLIT_NOT_SENT_NO_BGF_NO_MSG\0"
+    "RXC_FLIT_NOT_SENT_NO_TXQ_NO_MSG\0"
+    "RXC_FLIT_NOT_SENT_ONE_TAKEN\0"
+    "RXC_FLIT_NOT_SENT_TWO_TAKEN\0"
+    "RXC_FLIT_NOT_SENT_THREE_TAKEN\0"
+    "RXC_HELD_VN0\0"
+    "RXC_HELD_VN1\0"
+    "RXC_HELD_PARALLEL_ATTEMPT\0"
+    "RXC_HELD_PARALLEL_SUCCESS\0"
+    "RXC_HELD_PARALLEL_AD_LOST\0"
+    "RXC_HELD_PARALLEL_BL_LOST\0"
+    "RXC_HELD_CANT_SLOT_AD\0"
+    "RXC_HELD_CANT_SLOT_BL\0"
+    "RXC_INSERTS_VN0_AD_REQ\0"
+    "RXC_INSERTS_VN0_AD_SNP\0"
+    "RXC_INSERTS_VN0_AD_RSP\0"
+    "RXC_INSERTS_VN0_BL_RSP\0"
+    "RXC_INSERTS_VN0_BL_WB\0"
+    "RXC_INSERTS_VN0_BL_NCB\0"
+    "RXC_INSERTS_VN0_BL_NCS\0"
+    "RXC_INSERTS_VN1_AD_REQ\0"
+    "RXC_INSERTS_VN1_AD_SNP\0"
+    "RXC_INSERTS_VN1_AD_RSP\0"
+    "RXC_INSERTS_VN1_BL_RSP\0"
+    "RXC_INSERTS_VN1_BL_WB\0"
+    "RXC_INSERTS_VN1_BL_NCB\0"
+    "RXC_INSERTS_VN1_BL_NCS\0"
+    "RXC_OCCUPANCY_VN0_AD_REQ\0"
+    "RXC_OCCUPANCY_VN0_AD_SNP\0"
+    "RXC_OCCUPANCY_VN0_AD_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_RSP\0"
+    "RXC_OCCUPANCY_VN0_BL_WB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCB\0"
+    "RXC_OCCUPANCY_VN0_BL_NCS\0"
+    "RXC_OCCUPANCY_VN1_AD_REQ\0"
+    "RXC_OCCUPANCY_VN1_AD_SNP\0"
+    "RXC_OCCUPANCY_VN1_AD_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_RSP\0"
+    "RXC_OCCUPANCY_VN1_BL_WB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCB\0"
+    "RXC_OCCUPANCY_VN1_BL_NCS\0"
+    "RXC_PACKING_MISS_VN0_AD_REQ\0"
+    "RXC_PACKING_MISS_VN0_AD_SNP\0"
+    "RXC_PACKING_MISS_VN0_AD_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_RSP\0"
+    "RXC_PACKING_MISS_VN0_BL_WB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCB\0"
+    "RXC_PACKING_MISS_VN0_BL_NCS\0"
+    "RXC_PACKING_MISS_VN1_AD_REQ\0"
+    "RXC_PACKING_MISS_VN1_AD_SNP\0"
+    "RXC_PACKING_MISS_VN1_AD_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_RSP\0"
+    "RXC_PACKING_MISS_VN1_BL_WB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCB\0"
+    "RXC_PACKING_MISS_VN1_BL_NCS\0"
+    "RXC_SMI3_PFTCH_ARRIVED\0"
+    "RXC_SMI3_PFTCH_ARB_LOST\0"
+    "RXC_SMI3_PFTCH_SLOTTED\0"
+    "RXC_SMI3_PFTCH_DROP_OLD\0"
+    "RXC_SMI3_PFTCH_DROP_WRAP\0"
+    "RXC_VNA_CRD_USED\0"
+    "RXC_VNA_CRD_CORRECTED\0"
+    "RXC_VNA_CRD_LT1\0"
+    "RXC_VNA_CRD_LT4\0"
+    "RXC_VNA_CRD_LT5\0"
+    "RXC_VNA_CRD_ANY_IN_USE\0"
+    "TXC_AD_ARB_FAIL_VN0_REQ\0"
+    "TXC_AD_ARB_FAIL_VN0_SNP\0"
+    "TXC_AD_ARB_FAIL_VN0_RSP\0"
+    "TXC_AD_ARB_FAIL_VN0_WB\0"
+    "TXC_AD_ARB_FAIL_VN1_REQ\0"
+    "TXC_AD_ARB_FAIL_VN1_SNP\0"
+    "TXC_AD_ARB_FAIL_VN1_RSP\0"
+    "TXC_AD_ARB_FAIL_VN1_WB\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT0\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT1\0"
+    "TXC_AD_FLQ_BYPASS_AD_SLOT2\0"
+    "TXC_AD_FLQ_BYPASS_BL_EARLY_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_AD_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN0_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN0_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN0_WB\0"
+    "TXC_AD_FLQ_INSERTS_VN1_REQ\0"
+    "TXC_AD_FLQ_INSERTS_VN1_SNP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_AD_FLQ_INSERTS_VN1_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_REQ\0"
+    "RBOX0C0|RBOX1C0|RBOX2C0|RBOX3C0\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_REQ\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_SNP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_AD_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_PEER_UPI0\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_PEER_UPI1\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_CHA\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_PEER_UPI0\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_PEER_UPI1\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_CHA\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN0_NON_IDLE\0"
+    "TXC_AD_SNPF_GRP1_VN1_VN1_NON_IDLE\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN0_SNPFP_NONSNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN1_SNPFP_NONSNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN0_SNPFP_VN2SNP\0"
+    "TXC_AD_SNPF_GRP2_VN1_VN1_SNPFP_VN2SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_CRD_AVAIL_VN1_WB\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_NEW_MSG_VN1_WB\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_REQ\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_SNP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_RSP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN0_WB\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_REQ\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_SNP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_RSP\0"
+    "TXC_AD_SPEC_ARB_NO_OTHER_PEND_VN1_WB\0"
+    "TXC_AK_FLQ_INSERTS\0"
+    "TXC_AK_FLQ_OCCUPANCY\0"
+    "TXC_BL_ARB_FAIL_VN0_RSP\0"
+    "TXC_BL_ARB_FAIL_VN0_WB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCB\0"
+    "TXC_BL_ARB_FAIL_VN0_NCS\0"
+    "TXC_BL_ARB_FAIL_VN1_RSP\0"
+    "TXC_BL_ARB_FAIL_VN1_WB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCB\0"
+    "TXC_BL_ARB_FAIL_VN1_NCS\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN0_WB\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_REQ\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_SNP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_RSP\0"
+    "TXC_BL_FLQ_CYCLES_NE_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN0_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN0_RSP\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_NCS\0"
+    "TXC_BL_FLQ_INSERTS_VN1_WB\0"
+    "TXC_BL_FLQ_INSERTS_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN0_NCS\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_RSP\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_WB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCB\0"
+    "TXC_BL_FLQ_OCCUPANCY_VN1_NCS\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_WB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_NCB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN0_NCS\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_WB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_NCB\0"
+    "TXC_BL_SPEC_ARB_NEW_MSG_VN1_NCS\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_RSP\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_WB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_NCB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN0_NCS\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_RSP\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_WB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_NCB\0"
+    "TXC_BL_SPEC_ARB_NO_OTHER_PEND_VN1_NCS\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_REQ\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_SNP\0"
+    "UPI_PEER_AD_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VNA\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN0_WB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_RSP\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_NCS_NCB\0"
+    "UPI_PEER_BL_CREDITS_EMPTY_VN1_WB\0"
+    "UPI_PREFETCH_SPAWN\0"
+    "VN0_CREDITS_USED_REQ\0"
+    "VN0_CREDITS_USED_SNP\0"
+    "VN0_CREDITS_USED_RSP\0"
+    "VN0_CREDITS_USED_WB\0"
+    "VN0_CREDITS_USED_NCB\0"
+    "VN0_CREDITS_USED_NCS\0"
+    "VN1_CREDITS_USED_REQ\0"
+    "VN1_CREDITS_USED_SNP\0"
+    "VN1_CREDITS_USED_RSP\0"
+    "VN1_CREDITS_USED_WB\0"
+    "VN1_CREDITS_USED_NCB\0"
+    "VN1_CREDITS_USED_NCS\0"
+    "VN0_NO_CREDITS_REQ\0"
+    "VN0_NO_CREDITS_SNP\0"
+    "VN0_NO_CREDITS_RSP\0"
+    "VN0_NO_CREDITS_WB\0"
+    "VN0_NO_CREDITS_NCB\0"
+    "VN0_NO_CREDITS_NCS\0"
+    "VN1_NO_CREDITS_REQ\0"
+    "VN1_NO_CREDITS_SNP\0"
+    "VN1_NO_CREDITS_RSP\0"
+    "VN1_NO_CREDITS_WB\0"
+    "VN1_NO_CREDITS_NCB\0"
+    "VN1_NO_CREDITS_NCS\0"
+    "IBOX_CLOCKTICKS\0"
+    "IBOX\0"
+    "COMP_BUF_INSERTS_PORT0\0"
+    "COMP_BUF_INSERTS_PORT1\0"
+    "COMP_BUF_INSERTS_PORT2\0"
+    "COMP_BUF_INSERTS_PORT3\0"
+    "COMP_BUF_OCCUPANCY\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART0\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART1\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART2\0"
+    "DATA_REQ_BY_CPU_MEM_READ_PART3\0"
+    "DATA_REQ_BY_CPU_MEM_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_MEM_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_MEM_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_PEER_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_PEER_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_READ_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_CFG_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_CFG_WRITE_VTD1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART0\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART1\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART2\0"
+    "DATA_REQ_BY_CPU_IO_READ_PART3\0"
+    "DATA_REQ_BY_CPU_IO_READ_VTD0\0"
+    "DATA_REQ_BY_CPU_IO_READ_VTD1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_VTD0\0"
+    "DATA_REQ_BY_CPU_IO_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART0\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART1\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART2\0"
+    "DATA_REQ_OF_CPU_MEM_READ_PART3\0"
+    "DATA_REQ_OF_CPU_MEM_READ_VTD0\0"
+    "DATA_REQ_OF_CPU_MEM_READ_VTD1\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART0\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART1\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART2\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_PART3\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_VTD0\0"
+    "DATA_REQ_OF_CPU_MEM_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_READ_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_READ_VTD0\0"
+    "DATA_REQ_OF_CPU_PEER_READ_VTD1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_VTD0\0"
+    "DATA_REQ_OF_CPU_PEER_WRITE_VTD1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART1\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART2\0"
+    "DATA_REQ_OF_CPU_ATOMIC_PART3\0"
+    "DATA_REQ_OF_CPU_ATOMIC_VTD0\0"
+    "DATA_REQ_OF_CPU_ATOMIC_VTD1\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART0\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART1\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART2\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_PART3\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_VTD0\0"
+    "DATA_REQ_OF_CPU_ATOMICCMP_VTD1\0"
+    "DATA_REQ_OF_CPU_MSG_PART0\0"
+    "DATA_REQ_OF_CPU_MSG_PART1\0"
+    "DATA_REQ_OF_CPU_MSG_PART2\0"
+    "DATA_REQ_OF_CPU_MSG_PART3\0"
+    "DATA_REQ_OF_CPU_MSG_VTD0\0"
+    "DATA_REQ_OF_CPU_MSG_VTD1\0"
+    "LINK_NUM_CORR_ERR\0"
+    "LINK_NUM_RETRIES\0"
+    "MASK_MATCH\0"
+    "MASK_MATCH_AND_BUS0\0"
+    "MASK_MATCH_AND_BUS1\0"
+    "MASK_MATCH_AND_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_AND_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_AND_NOT_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0\0"
+    "MASK_MATCH_OR_BUS1\0"
+    "MASK_MATCH_OR_BUS0_NOT_BUS1\0"
+    "MASK_MATCH_OR_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_BUS1\0"
+    "MASK_MATCH_OR_NOT_BUS0_NOT_BUS1\0"
+    "NOTHING\0"
+    "SYMBOL_TIMES\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART0\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART1\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART2\0"
+    "TXN_REQ_BY_CPU_MEM_READ_PART3\0"
+    "TXN_REQ_BY_CPU_MEM_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_MEM_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_MEM_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_PEER_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_PEER_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_READ_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_CFG_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_CFG_WRITE_VTD1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART0\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART1\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART2\0"
+    "TXN_REQ_BY_CPU_IO_READ_PART3\0"
+    "TXN_REQ_BY_CPU_IO_READ_VTD0\0"
+    "TXN_REQ_BY_CPU_IO_READ_VTD1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART1\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART2\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_PART3\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_VTD0\0"
+    "TXN_REQ_BY_CPU_IO_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART0\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART1\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART2\0"
+    "TXN_REQ_OF_CPU_MEM_READ_PART3\0"
+    "TXN_REQ_OF_CPU_MEM_READ_VTD0\0"
+    "TXN_REQ_OF_CPU_MEM_READ_VTD1\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART0\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART1\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART2\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_PART3\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_VTD0\0"
+    "TXN_REQ_OF_CPU_MEM_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_READ_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_READ_VTD0\0"
+    "TXN_REQ_OF_CPU_PEER_READ_VTD1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART1\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART2\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_PART3\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_VTD0\0"
+    "TXN_REQ_OF_CPU_PEER_WRITE_VTD1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART1\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART2\0"
+    "TXN_REQ_OF_CPU_ATOMIC_PART3\0"
+    "TXN_REQ_OF_CPU_ATOMIC_VTD0\0"
+    "TXN_REQ_OF_CPU_ATOMIC_VTD1\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART0\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART1\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART2\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_PART3\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_VTD0\0"
+    "TXN_REQ_OF_CPU_ATOMICCMP_VTD1\0"
+    "TXN_REQ_OF_CPU_MSG_PART0\0"
+    "TXN_REQ_OF_CPU_MSG_PART1\0"
+    "TXN_REQ_OF_CPU_MSG_PART2\0"
+    "TXN_REQ_OF_CPU_MSG_PART3\0"
+    "TXN_REQ_OF_CPU_MSG_VTD0\0"
+    "TXN_REQ_OF_CPU_MSG_VTD1\0"
+    "VTD_ACCESS_L4_PAGE_HIT\0"
+    "VTD_ACCESS_CTXT_MISS\0"
+    "VTD_ACCESS_L1_MISS\0"
+    "VTD_ACCESS_L2_MISS\0"
+    "VTD_ACCESS_L3_MISS\0"
+    "VTD_ACCESS_TLB_MISS\0"
+    "VTD_ACCESS_TLB_FULL\0"
+    "VTD_ACCESS_TLB1_MISS\0"
+    "VTD_OCCUPANCY\0"
+    "BANDWIDTH_PORT0_IN\0"
+    "IBAND0PI0|IBAND1PI0|IBAND2PI0|IBAND3PI0|IBAND4PI0|IBAND5PI0\0"
+    "BANDWIDTH_PORT1_IN\0"
+    "IBAND0PI1|IBAND1PI1|IBAND2PI1|IBAND3PI1|IBAND4PI1|IBAND5PI1\0"
+    "BANDWIDTH_PORT2_IN\0"
+    "IBAND0PI2|IBAND1PI2|IBAND2PI2|IBAND3PI2|IBAND4PI2|IBAND5PI2\0"
+    "BANDWIDTH_PORT3_IN\0"
+    "IBAND0PI3|IBAND1PI3|IBAND2PI3|IBAND3PI3|IBAND4PI3|IBAND5PI3\0"
+    "BANDWIDTH_PORT0_OUT\0"
+    "IBAND0PO0|IBAND1PO0|IBAND2PO0|IBAND3PO0|IBAND4PO0|IBAND5PO0\0"
+    "BANDWIDTH_PORT1_OUT\0"
+    "IBAND0PO1|IBAND1PO1|IBAND2PO1|IBAND3PO1|IBAND4PO1|IBAND5PO1\0"
+    "BANDWIDTH_PORT2_OUT\0"
+    "IBAND0PO2|IBAND1PO2|IBAND2PO2|IBAND3PO2|IBAND4PO2|IBAND5PO2\0"
+    "BANDWIDTH_PORT3_OUT\0"
+    "IBAND0PO3|IBAND1PO3|IBAND2PO3|IBAND3PO3|IBAND4PO3|IBAND5PO3\0"
+    "IUNIT_CLOCKTICKS\0"
+    "IBOX0CLK|IBOX1CLK|IBOX2CLK|IBOX3CLK|IBOX4CLK|IBOX5CLK\0"
+    "UTLILIZATION_PORT0_IN\0"
+    "IUTIL0PI0|IUTIL1PI0|IUTIL2PI0|IUTIL3PI0|IUTIL4PI0|IUTIL5PI0\0"
+    "UTLILIZATION_PORT1_IN\0"
+    "IUTIL0PI1|IUTIL1PI1|IUTIL2PI1|IUTIL3PI1|IUTIL4PI1|IUTIL5PI1\0"
+    "UTLILIZATION_PORT2_IN\0"
+    "IUTIL0PI2|IUTIL1PI2|IUTIL2PI2|IUTIL3PI2|IUTIL4PI2|IUTIL5PI2\0"
+    "UTLILIZATION_PORT3_IN\0"
+    "IUTIL0PI3|IUTIL1PI3|IUTIL2PI3|IUTIL3PI3|IUTIL4PI3|IUTIL5PI3\0"
+    "UTLILIZATION_PORT0_OUT\0"
+    "IUTIL0PO0|IUTIL1PO0|IUTIL2PO0|IUTIL3PO0|IUTIL4PO0|IUTIL5PO0\0"
+    "UTLILIZATION_PORT1_OUT\0"
+    "IUTIL0PO1|IUTIL1PO1|IUTIL2PO1|IUTIL3PO1|IUTIL4PO1|IUTIL5PO1\0"
+    "UTLILIZATION_PORT2_OUT\0"
+    "IUTIL0PO2|IUTIL1PO2|IUTIL2PO2|IUTIL3PO2|IUTIL4PO2|IUTIL5PO2\0"
+    "UTLILIZATION_PORT3_OUT\0"
+    "IUTIL0PO3|IUTIL1PO3|IUTIL2PO3|IUTIL3PO3|IUTIL4PO3|IUTIL5PO3\0"
+    "IRP_CLOCKTICKS\0"
+    "IRP\0"
+    "CACHE_TOTAL_OCCUPANCY_ANY\0"
+    "CACHE_TOTAL_OCCUPANCY_IV_Q\0"
+    "CACHE_TOTAL_OCCUPANCY_MEM\0"
+    "COHERENT_OPS_PCIRDCUR\0"
+    "COHERENT_OPS_CRD\0"
+    "COHERENT_OPS_DRD\0"
+    "COHERENT_OPS_RFO\0"
+    "COHERENT_OPS_PCITOM\0"
+    "COHERENT_OPS_PCIDCAHINT\0"
+    "COHERENT_OPS_WBMTOI\0"
+    "COHERENT_OPS_CLFLUSH\0"
+    "FAF_FULL\0"
+    "FAF_INSERTS\0"
+    "FAF_OCCUPANCY\0"
+    "FAF_TRANSACTIONS\0"
+    "IRP_ALL_INBOUND_INSERTS\0"
+    "IRP_ALL_OUTBOUND_INSERTS\0"
+    "MISC0_FAST_REQ\0"
+    "MISC0_FAST_REJ\0"
+    "MISC0_FAST_2ND_RD_INSERT\0"
+    "MISC0_FAST_2ND_WR_INSERT\0"
+    "MISC0_FAST_2ND_ATOMIC_INSERT\0"
+    "MISC0_FAST_FAST_XFER\0"
+    "MISC0_FAST_PF_ACK_HINT\0"
+    "MISC0_FAST_UNKNOWN\0"
+    "MISC1_SLOW_I\0"
+    "MISC1_SLOW_S\0"
+    "MISC1_SLOW_E\0"
+    "MISC1_SLOW_M\0"
+    "MISC1_LOST_FWD\0"
+    "MISC1_SEC_RCVD_INVLD\0"
+    "MISC1_SEC_RCVD_VLD\0"
+    "P2P_INSERTS\0"
+    "P2P_OCCUPANCY\0"
+    "P2P_TRANSACTIONS_RD\0"
+    "P2P_TRANSACTIONS_WR\0"
+    "P2P_TRANSACTIONS_MSG\0"
+    "P2P_TRANSACTIONS_CMPL\0"
+    "P2P_TRANSACTIONS_REM\0"
+    "P2P_TRANSACTIONS_REM_AND_TGT_MATCH\0"
+    "P2P_TRANSACTIONS_LOC\0"
+    "P2P_TRANSACTIONS_LOC_AND_TGT_MATCH\0"
+    "SNOOP_RESP_MISS_SNPCODE\0"
+    "SNOOP_RESP_MISS_SNPDATA\0"
+    "SNOOP_RESP_MISS_SNPINV\0"
+    "SNOOP_RESP_MISS_SNPALL\0"
+    "SNOOP_RESP_HIT_I_SNPCODE\0"
+    "SNOOP_RESP_HIT_I_SNPDATA\0"
+    "SNOOP_RESP_HIT_I_SNPINV\0"
+    "SNOOP_RESP_HIT_I_SNPALL\0"
+    "SNOOP_RESP_HIT_ES_SNPCODE\0"
+    "SNOOP_RESP_HIT_ES_SNPDATA\0"
+    "SNOOP_RESP_HIT_ES_SNPINV\0"
+    "SNOOP_RESP_HIT_ES_SNPALL\0"
+    "SNOOP_RESP_HIT_M_SNPCODE\0"
+    "SNOOP_RESP_HIT_M_SNPDATA\0"
+    "SNOOP_RESP_HIT_M_SNPINV\0"
+    "SNOOP_RESP_HIT_M_SNPALL\0"
+    "SNOOP_RESP_HIT_ESM_SNPCODE\0"
+    "SNOOP_RESP_HIT_ESM_SNPDATA\0"
+    "SNOOP_RESP_HIT_ESM_SNPINV\0"
+    "SNOOP_RESP_HIT_ESM_SNPALL\0"
+    "TRANSACTIONS_READS\0"
+    "TRANSACTIONS_WRITES\0"
+    "TRANSACTIONS_RD_PREF\0"
+    "TRANSACTIONS_WR_PREF\0"
+    "TRANSACTIONS_ATOMIC\0"
+    "TRANSACTIONS_OTHER\0"
+    "TRANSACTIONS_ORDERINGQ\0"
+    "TXC_AK_INSERTS\0"
+    "TXC_BL_DRS_CYCLES_FULL\0"
+    "TXC_BL_DRS_INSERTS\0"
+    "TXC_BL_DRS_OCCUPANCY\0"
+    "TXC_BL_NCB_CYCLES_FULL\0"
+    "TXC_BL_NCB_INSERTS\0"
+    "TXC_BL_NCB_OCCUPANCY\0"
+    "TXC_BL_NCS_CYCLES_FULL\0"
+    "TXC_BL_NCS_INSERTS\0"
+    "TXC_BL_NCS_OCCUPANCY\0"
+    "TXR2_AD_STALL_CREDIT_CYCLES\0"
+    "TXR2_BL_STALL_CREDIT_CYCLES\0"
+    "TXS_DATA_INSERTS_NCB\0"
+    "TXS_DATA_INSERTS_NCS\0"
+    "TXS_REQUEST_OCCUPANCY\0"
+    "AG0_AD_CRD_ACQUIRED_TGR0\0"
+    "CBOX|M2M|RBOX|PBOX\0"
+    "AG0_AD_CRD_ACQUIRED_TGR1\0"
+    "AG0_AD_CRD_ACQUIRED_TGR2\0"
+    "AG0_AD_CRD_ACQUIRED_TGR3\0"
+    "AG0_AD_CRD_ACQUIRED_TGR4\0"
+    "AG0_AD_CRD_ACQUIRED_TGR5\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG0_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG1_AD_CRD_ACQUIRED_TGR0\0"
+    "AG1_AD_CRD_ACQUIRED_TGR1\0"
+    "AG1_AD_CRD_ACQUIRED_TGR2\0"
+    "AG1_AD_CRD_ACQUIRED_TGR3\0"
+    "AG1_AD_CRD_ACQUIRED_TGR4\0"
+    "AG1_AD_CRD_ACQUIRED_TGR5\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR0\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR1\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR2\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR3\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR4\0"
+    "AG1_AD_CRD_OCCUPANCY_TGR5\0"
+    "AG0_BL_CRD_ACQUIRED_TGR0\0"
+    "AG0_BL_CRD_ACQUIRED_TGR1\0"
+    "AG0_BL_CRD_ACQUIRED_TGR2\0"
+    "AG0_BL_CRD_ACQUIRED_TGR3\0"
+    "AG0_BL_CRD_ACQUIRED_TGR4\0"
+    "AG0_BL_CRD_ACQUIRED_TGR5\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG0_BL_CRD_OCCUPANCY_TGR5\0"
+    "AG1_BL_CRD_ACQUIRED_TGR0\0"
+    "AG1_BL_CRD_ACQUIRED_TGR1\0"
+    "AG1_BL_CRD_ACQUIRED_TGR2\0"
+    "AG1_BL_CRD_ACQUIRED_TGR3\0"
+    "AG1_BL_CRD_ACQUIRED_TGR4\0"
+    "AG1_BL_CRD_ACQUIRED_TGR5\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR0\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR1\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR2\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR3\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR4\0"
+    "AG1_BL_CRD_OCCUPANCY_TGR5\0"
+    "CMS_CLOCKTICKS\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_UP\0"
+    "EGRESS_ORDERING_IV_SNOOPGO_DN\0"
+    "FAST_ASSERTED_VERT\0"
+    "FAST_ASSERTED_HORZ\0"
+    "HORZ_RING_AD_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AD_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_AK_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_AK_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_BL_IN_USE_LEFT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_LEFT_ODD\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_EVEN\0"
+    "HORZ_RING_BL_IN_USE_RIGHT_ODD\0"
+    "HORZ_RING_IV_IN_USE_LEFT\0"
+    "HORZ_RING_IV_IN_USE_RIGHT\0"
+    "RING_BOUNCES_HORZ_AD\0"
+    "RING_BOUNCES_HORZ_AK\0"
+    "RING_BOUNCES_HORZ_BL\0"
+    "RING_BOUNCES_HORZ_IV\0"
+    "RING_BOUNCES_VERT_AD\0"
+    "RING_BOUNCES_VERT_AK\0"
+    "RING_BOUNCES_VERT_BL\0"
+    "RING_BOUNCES_VERT_IV\0"
+    "RING_SINK_STARVED_HORZ_AD\0"
+    "RING_SINK_STARVED_HORZ_AK\0"
+    "RING_SINK_STARVED_HORZ_BL\0"
+    "RING_SINK_STARVED_HORZ_IV\0"
+    "RING_SINK_STARVED_HORZ_AK_AG1\0"
+    "RING_SINK_STARVED_VERT_AD\0"
+    "RING_SINK_STARVED_VERT_AK\0"
+    "RING_SINK_STARVED_VERT_BL\0"
+    "RING_SINK_STARVED_VERT_IV\0"
+    "RING_SRC_THRTL\0"
+    "RXR_BUSY_STARVED_AD_BNC\0"
+    "RXR_BUSY_STARVED_BL_BNC\0"
+    "RXR_BUSY_STARVED_AD_CRD\0"
+    "RXR_BUSY_STARVED_BL_CRD\0"
+    "RXR_BUSY_STARVED_AD\0"
+    "RXR_BUSY_STARVED_BL\0"
+    "RXR_BYPASS_AD_BNC\0"
+    "RXR_BYPASS_AK_BNC\0"
+    "RXR_BYPASS_BL_BNC\0"
+    "RXR_BYPASS_IV_BNC\0"
+    "RXR_BYPASS_AD_CRD\0"
+    "RXR_BYPASS_BL_CRD\0"
+    "RXR_BYPASS_AD\0"
+    "RXR_BYPASS_BL\0"
+    "RXR_CRD_STARVED_AD_BNC\0"
+    "RXR_CRD_STARVED_AK_BNC\0"
+    "RXR_CRD_STARVED_BL_BNC\0"
+    "RXR_CRD_STARVED_IV_BNC\0"
+    "RXR_CRD_STARVED_AD_CRD\0"
+    "RXR_CRD_STARVED_BL_CRD\0"
+    "RXR_CRD_STARVED_IFV\0"
+    "RXR_CRD_STARVED_AD\0"
+    "RXR_CRD_STARVED_BL\0"
+    "RXR_INSERTS_AD_BNC\0"
+    "RXR_INSERTS_AK_BNC\0"
+    "RXR_INSERTS_BL_BNC\0"
+    "RXR_INSERTS_IV_BNC\0"
+    "RXR_INSERTS_AD_CRD\0"
+    "RXR_INSERTS_BL_CRD\0"
+    "RXR_INSERTS_AD\0"
+    "RXR_INSERTS_BL\0"
+    "RXR_OCCUPANCY_AD_BNC\0"
+    "RXR_OCCUPANCY_AK_BNC\0"
+    "RXR_OCCUPANCY_BL_BNC\0"
+    "RXR_OCCUPANCY_IV_BNC\0"
+    "RXR_OCCUPANCY_AD_CRD\0"
+    "RXR_OCCUPANCY_BL_CRD\0"
+    "RXR_OCCUPANCY_AD\0"
+    "RXR_OCCUPANCY_BL\0"
+    "VERT_RING_AD_IN_USE_UP_EVEN\0"
+    "VERT_RING_AD_IN_USE_UP_ODD\0"
+    "VERT_RING_AD_IN_USE_DN_EVEN\0"
+    "VERT_RING_AD_IN_USE_DN_ODD\0"
+    "VERT_RING_AK_IN_USE_UP_EVEN\0"
+    "VERT_RING_AK_IN_USE_UP_ODD\0"
+    "VERT_RING_AK_IN_USE_DN_EVEN\0"
+    "VERT_RING_AK_IN_USE_DN_ODD\0"
+    "VERT_RING_BL_IN_USE_UP_EVEN\0"
+    "VERT_RING_BL_IN_USE_UP_ODD\0"
+    "VERT_RING_BL_IN_USE_DN_EVEN\0"
+    "VERT_RING_BL_IN_USE_DN_ODD\0"
+    "VERT_RING_IV_IN_USE_UP\0"
+    "VERT_RING_IV_IN_USE_DN\0";
+
+static const PerfmonEventOption skylakeX_arch_event_options[] = {
+ {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,0x01}
+};
+
+static const PerfmonEventEntry skylakeX_arch_event_entries[NUM_ARCH_EVENTS_SKYLAKEX] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 134, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 157, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 185, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 212, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 242, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {246, 242, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {267, 242, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {289, 242, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {310, 242, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {333, 242, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {361, 242, 0, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {393, 242, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {421, 242, 0, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {453, 242, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 242, 1, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {522, 242, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {535, 242, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {546, 242, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {560, 242, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {588, 242, 3, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {636, 242, 4, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {686, 242, 5, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {736, 242, 6, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {786, 242, 7, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {826, 242, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {859, 242, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {884, 242, 9, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {908, 242, 10, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {937, 242, 11, 2, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {965, 242, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {995, 242, 9, 1, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1024, 242, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1044, 242, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1063, 242, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 242, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1109, 242, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1143, 242, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1164, 242, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1188, 242, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1213, 242, 15, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1238, 242, 17, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1267, 242, 19, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1297, 242, 22, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1327, 242, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1361, 242, 5, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1395, 242, 4, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1429, 242, 3, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1463, 242, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1497, 242, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1533, 242, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1547, 242, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1561, 242, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1575, 242, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1589, 242, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1603, 242, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1626, 242, 26, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {1646, 242, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1664, 242, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1683, 242, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1703, 242, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1727, 242, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1753, 242, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1784, 242, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1812, 242, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1839, 242, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1857, 242, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1876, 242, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1896, 242, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1920, 242, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1946, 242, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1977, 242, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2005, 242, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2032, 242, 29, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2053, 242, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2084, 242, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2103, 242, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2126, 242, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2143, 242, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2160, 242, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2182, 242, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2208, 242, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2233, 242, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2259, 242, 15, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2285, 242, 0, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2316, 242, 17, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2346, 242, 19, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2377, 242, 22, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2408, 242, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2443, 242, 5, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2478, 242, 4, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2513, 242, 3, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2548, 242, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2583, 242, 31, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2618, 242, 32, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2653, 242, 33, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2688, 242, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2717, 242, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2745, 242, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2771, 242, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2799, 242, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2825, 242, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2852, 242, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2879, 242, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2908, 242, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2936, 242, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2963, 242, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2999, 242, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3035, 242, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3076, 242, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3117, 242, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3158, 242, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3199, 242, 0, 0, 0xC7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3240, 242, 0, 0, 0xC7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3281, 242, 0, 0, 0xC7,0x55,0,0,EVENT_OPTION_NONE_MASK}
+, {3310, 242, 0, 0, 0xC7,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {3339, 242, 6, 1, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3353, 242, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {3386, 242, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3420, 242, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {3448, 242, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3477, 242, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3507, 242, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3534, 242, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3562, 242, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {3583, 242, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3607, 242, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3631, 242, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3655, 242, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3680, 242, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3705, 242, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3730, 242, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3754, 242, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {3778, 242, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3802, 242, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {3826, 242, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3860, 242, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3893, 242, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3927, 242, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3961, 242, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3994, 242, 0, 0, 0xD3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4030, 242, 0, 0, 0xD3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4067, 242, 0, 0, 0xD3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4103, 242, 0, 0, 0xD3,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {4139, 242, 0, 0, 0xD4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4164, 242, 0, 0, 0xCD,0x01,0x0,0x04,EVENT_OPTION_NONE_MASK}
+, {4200, 242, 0, 0, 0xCD,0x01,0x0,0x08,EVENT_OPTION_NONE_MASK}
+, {4236, 242, 0, 0, 0xCD,0x01,0x0,0x10,EVENT_OPTION_NONE_MASK}
+, {4273, 242, 0, 0, 0xCD,0x01,0x0,0x20,EVENT_OPTION_NONE_MASK}
+, {4310, 242, 0, 0, 0xCD,0x01,0x0,0x40,EVENT_OPTION_NONE_MASK}
+, {4347, 242, 0, 0, 0xCD,0x01,0x0,0x80,EVENT_OPTION_NONE_MASK}
+, {4385, 242, 0, 0, 0xCD,0x01,0x0,0x100,EVENT_OPTION_NONE_MASK}
+, {4423, 242, 0, 0, 0xCD,0x01,0x0,0x200,EVENT_OPTION_NONE_MASK}
+, {4461, 242, 0, 0, 0xC6,0x01,0x00,0x11,EVENT_OPTION_NONE_MASK}
+, {4487, 242, 0, 0, 0xC6,0x01,0x00,0x12,EVENT_OPTION_NONE_MASK}
+, {4513, 242, 0, 0, 0xC6,0x01,0x00,0x13,EVENT_OPTION_NONE_MASK}
+, {4538, 242, 0, 0, 0xC6,0x01,0x00,0x14,EVENT_OPTION_NONE_MASK}
+, {4565, 242, 0, 0, 0xC6,0x01,0x00,0x15,EVENT_OPTION_NONE_MASK}
+, {4592, 242, 0, 0, 0xC6,0x01,0x00,0x400206,EVENT_OPTION_NONE_MASK}
+, {4622, 242, 0, 0, 0xC6,0x01,0x00,0x200206,EVENT_OPTION_NONE_MASK}
+, {4665, 242, 0, 0, 0xC6,0x01,0x00,0x400406,EVENT_OPTION_NONE_MASK}
+, {4695, 242, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4716, 242, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4742, 242, 13, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4769, 242, 15, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4796, 242, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4832, 242, 5, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4868, 242, 4, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4904, 242, 3, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4940, 242, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4976, 242, 31, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5012, 242, 32, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5048, 242, 33, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5084, 242, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5103, 242, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5134, 242, 13, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5166, 242, 15, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5198, 242, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5239, 242, 5, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5280, 242, 4, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5321, 242, 3, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5362, 242, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5403, 242, 31, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5444, 242, 32, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5485, 242, 33, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5526, 242, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5544, 242, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5575, 242, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5601, 242, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5627, 242, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5653, 242, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5679, 242, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5708, 242, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5736, 242, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5764, 242, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5792, 242, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5820, 242, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5848, 242, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5876, 242, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5904, 242, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5932, 242, 0, 0, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK}
+, {5965, 242, 0, 1, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6003, 242, 0, 1, 0xA1,0x9C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {6035, 242, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6063, 242, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6096, 242, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6126, 242, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6156, 242, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6189, 242, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6222, 242, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6252, 242, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6282, 242, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6315, 242, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6348, 242, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6378, 242, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6408, 242, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6442, 242, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6476, 242, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6507, 242, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6538, 242, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6572, 242, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6606, 242, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6623, 242, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6649, 242, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6674, 242, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6695, 242, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6722, 242, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6752, 242, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6785, 242, 0, 0, 0x85,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6815, 242, 6, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6839, 242, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6870, 242, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6900, 242, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6926, 242, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6958, 242, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6993, 242, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7031, 242, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7066, 242, 6, 1, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7095, 242, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7127, 242, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7158, 242, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7185, 242, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {7218, 242, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7254, 242, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7293, 242, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7329, 242, 6, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7359, 242, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7381, 242, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7400, 242, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7416, 242, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7428, 242, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7450, 242, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7472, 242, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7510, 242, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7552, 242, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7593, 242, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7647, 242, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7678, 242, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7700, 242, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7722, 242, 6, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7751, 242, 37, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7784, 242, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7803, 242, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7835, 242, 9, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {7864, 242, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7888, 242, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7904, 242, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7936, 242, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7968, 242, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8000, 242, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8028, 242, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8057, 242, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8097, 242, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8127, 242, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8171, 242, 31, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8220, 242, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8264, 242, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8304, 242, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8345, 242, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8397, 242, 6, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8453, 242, 6, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8502, 242, 6, 1, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8558, 242, 6, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8610, 242, 6, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8674, 242, 31, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8731, 242, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8763, 242, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8787, 242, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8800, 242, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8817, 242, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8833, 242, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8849, 242, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8866, 242, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8881, 242, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8903, 242, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8926, 242, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {8954, 242, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8983, 242, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {9011, 242, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {9039, 242, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {9056, 242, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {9077, 242, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {9093, 242, 0, 0, 0x24,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {9110, 242, 0, 0, 0x24,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {9126, 242, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {9143, 242, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {9161, 242, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {9182, 242, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {9204, 242, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {9229, 242, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {9260, 242, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {9274, 242, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {9294, 242, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9308, 242, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9321, 242, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9337, 242, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9354, 242, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {9366, 242, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9382, 242, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9405, 242, 5, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9428, 242, 4, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9451, 242, 3, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9474, 242, 25, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9497, 242, 31, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9520, 242, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9535, 242, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9557, 242, 5, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9579, 242, 4, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9601, 242, 3, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9623, 242, 25, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9645, 242, 31, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9667, 242, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9685, 242, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9710, 242, 5, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9735, 242, 4, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9760, 242, 3, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9785, 242, 25, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9810, 242, 31, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9835, 242, 39, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9852, 242, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9871, 242, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9897, 242, 5, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9923, 242, 4, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9949, 242, 3, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9975, 242, 25, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10001, 242, 31, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10027, 242, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10041, 242, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10062, 242, 5, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10083, 242, 4, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10104, 242, 3, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10125, 242, 25, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10146, 242, 31, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10167, 242, 39, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {10183, 242, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10211, 242, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10237, 242, 5, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10263, 242, 4, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10289, 242, 3, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10315, 242, 25, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10341, 242, 31, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10367, 242, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10396, 242, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10423, 242, 5, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10450, 242, 4, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10477, 242, 3, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10504, 242, 25, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10531, 242, 31, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10558, 242, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10582, 242, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10604, 242, 5, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10626, 242, 4, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10648, 242, 3, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10670, 242, 25, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10692, 242, 31, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10714, 242, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10742, 242, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10756, 242, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10770, 242, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10784, 242, 0, 0, 0xF1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {10800, 242, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10820, 242, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10844, 242, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10870, 242, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10889, 242, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10910, 242, 41, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10930, 242, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10939, 242, 6, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10957, 242, 5, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10975, 242, 4, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10993, 242, 3, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11011, 242, 43, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {11034, 242, 13, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {11059, 242, 0, 0, 0xC1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {11077, 242, 0, 0, 0xC6,0x01,0x00,0x400806,EVENT_OPTION_NONE_MASK}
+, {11107, 242, 0, 0, 0xC6,0x01,0x00,0x401006,EVENT_OPTION_NONE_MASK}
+, {11138, 242, 0, 0, 0xC6,0x01,0x00,0x402006,EVENT_OPTION_NONE_MASK}
+, {11169, 242, 0, 0, 0xC6,0x01,0x00,0x404006,EVENT_OPTION_NONE_MASK}
+, {11200, 242, 0, 0, 0xC6,0x01,0x00,0x408006,EVENT_OPTION_NONE_MASK}
+, {11232, 242, 0, 0, 0xC6,0x01,0x00,0x410006,EVENT_OPTION_NONE_MASK}
+, {11264, 242, 0, 0, 0xC6,0x01,0x00,0x420006,EVENT_OPTION_NONE_MASK}
+, {11296, 242, 0, 0, 0xC6,0x01,0x00,0x100206,EVENT_OPTION_NONE_MASK}
+, {11339, 242, 0, 0, 0xC6,0x01,0x00,0x300206,EVENT_OPTION_NONE_MASK}
+, {11382, 242, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11412, 242, 0, 0, 0x28,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {11442, 242, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11472, 242, 0, 0, 0xFE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11492, 242, 0, 0, 0xFE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11514, 242, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11541, 242, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {11568, 11587, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11592, 11587, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11611, 11587, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11630, 11587, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11654, 11587, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11673, 11587, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11685, 11587, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11712, 11587, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11729, 11587, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11746, 11587, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11772, 11587, 0, 0, 0x46,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11786, 11799, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11807, 11830, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11835, 11830, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11859, 11830, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11883, 11830, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11914, 11830, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11939, 11830, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11953, 11830, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11967, 11830, 0, 0, 0x3D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11981, 11830, 0, 0, 0x3D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11997, 11830, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12018, 11830, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12046, 11830, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12071, 11830, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12087, 11830, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12105, 11830, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12128, 11830, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12146, 11830, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12169, 11830, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12181, 11830, 0, 0, 0x33,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {12198, 11830, 0, 0, 0x33,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {12217, 11830, 0, 0, 0x33,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {12237, 11830, 0, 0, 0x33,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {12255, 11830, 0, 0, 0x33,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {12275, 11830, 0, 0, 0x33,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {12296, 11830, 0, 0, 0x33,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {12315, 11830, 0, 0, 0x33,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {12336, 11830, 0, 0, 0x33,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {12358, 11830, 0, 0, 0x33,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {12375, 11830, 0, 0, 0x33,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {12394, 11830, 0, 0, 0x33,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {12414, 12433, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {12675, 12433, 43, 1, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {12700, 11830, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12715, 11830, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12733, 11830, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12747, 11830, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12762, 11830, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12779, 11830, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12803, 11830, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12820, 11830, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12842, 11830, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12860, 11830, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12879, 11830, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12906, 11830, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {12936, 11830, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {12959, 11830, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12995, 11830, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13020, 11830, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13040, 11830, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13062, 11830, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13086, 11830, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13109, 11830, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13134, 11830, 0, 0, 0x59,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {13154, 11830, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13176, 11830, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13201, 11830, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13232, 11830, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13266, 11830, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13292, 11830, 0, 0, 0x5B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13321, 11830, 0, 0, 0x5B,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {13342, 11830, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13361, 11830, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13381, 11830, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13401, 11830, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13421, 11830, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13441, 11830, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13465, 11830, 0, 0, 0x63,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13485, 11830, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {13502, 11830, 0, 0, 0x34,0x03,0,0,EVENT_OPTION_STATE_MASK}
+, {13523, 11830, 0, 0, 0x34,0x05,0,0,EVENT_OPTION_STATE_MASK}
+, {13540, 11830, 0, 0, 0x34,0x09,0,0,EVENT_OPTION_STATE_MASK}
+, {13564, 11830, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_STATE_MASK}
+, {13579, 11830, 0, 0, 0x34,0x31,0,0,EVENT_OPTION_STATE_MASK}
+, {13596, 11830, 0, 0, 0x34,0x91,0,0,EVENT_OPTION_STATE_MASK}
+, {13614, 11830, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13634, 11830, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13654, 11830, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13674, 11830, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13694, 11830, 0, 0, 0x37,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {13716, 11830, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {13734, 11830, 0, 0, 0x37,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {13753, 11830, 0, 0, 0x37,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {13773, 11830, 0, 0, 0x37,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {13793, 11830, 0, 0, 0x37,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {13813, 11830, 0, 0, 0x37,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {13833, 11830, 0, 0, 0x37,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {13855, 11830, 0, 0, 0x37,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {13876, 11830, 0, 0, 0x37,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {13897, 11830, 0, 0, 0x37,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {13918, 11830, 0, 0, 0x37,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {13939, 11830, 0, 0, 0x37,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {13962, 11830, 0, 0, 0x37,0xA1,0,0,EVENT_OPTION_NONE_MASK}
+, {13980, 11830, 0, 0, 0x37,0xA2,0,0,EVENT_OPTION_NONE_MASK}
+, {13998, 11830, 0, 0, 0x37,0xA4,0,0,EVENT_OPTION_NONE_MASK}
+, {14016, 11830, 0, 0, 0x37,0xA8,0,0,EVENT_OPTION_NONE_MASK}
+, {14034, 11830, 0, 0, 0x37,0xAF,0,0,EVENT_OPTION_NONE_MASK}
+, {14054, 11830, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14072, 11830, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14089, 11830, 0, 0, 0x39,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14104, 11830, 0, 0, 0x39,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14132, 11830, 0, 0, 0x39,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14158, 11830, 0, 0, 0x55,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14166, 11830, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14191, 11830, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14216, 11830, 0, 0, 0x58,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14239, 11830, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14265, 11830, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14291, 11830, 0, 0, 0x58,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14317, 11830, 0, 0, 0x58,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14343, 11830, 0, 0, 0x58,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {14367, 11830, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14393, 11830, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14419, 11830, 0, 0, 0x5A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14443, 11830, 0, 0, 0x5A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14470, 11830, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14497, 11830, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14524, 11830, 0, 0, 0x5A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14551, 11830, 0, 0, 0x5A,0x3C,0,0,EVENT_OPTION_NONE_MASK}
+, {14576, 11830, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14597, 11830, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14619, 11830, 0, 0, 0x50,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {14634, 11830, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14656, 11830, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14679, 11830, 0, 0, 0x50,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {14695, 11830, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14718, 11830, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14742, 11830, 0, 0, 0x50,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {14759, 11830, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14775, 11830, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14795, 11830, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14811, 11830, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {14827, 11830, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14847, 11830, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {14863, 11830, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {14879, 11830, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {14906, 11830, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {14933, 11830, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {14960, 11830, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {14986, 11830, 0, 0, 0x22,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15013, 11830, 0, 0, 0x22,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15040, 11830, 0, 0, 0x22,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15067, 11830, 0, 0, 0x22,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15094, 11830, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15115, 11830, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15134, 11830, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15161, 11830, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15187, 11830, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15210, 11830, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15240, 11830, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15266, 11830, 0, 0, 0x23,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15291, 11830, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15318, 11830, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15345, 11830, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15372, 11830, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15398, 11830, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15425, 11830, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15452, 11830, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15479, 11830, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15506, 11830, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15527, 11830, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15546, 11830, 0, 0, 0x19,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15573, 11830, 0, 0, 0x19,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15599, 11830, 0, 0, 0x19,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15622, 11830, 0, 0, 0x19,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15652, 11830, 0, 0, 0x19,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15678, 11830, 0, 0, 0x19,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15703, 11830, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15731, 11830, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15759, 11830, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {15787, 11830, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {15814, 11830, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {15842, 11830, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {15870, 11830, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {15898, 11830, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {15926, 11830, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15948, 11830, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {15968, 11830, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {15995, 11830, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16022, 11830, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16049, 11830, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16075, 11830, 0, 0, 0x2C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16102, 11830, 0, 0, 0x2C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16129, 11830, 0, 0, 0x2C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16156, 11830, 0, 0, 0x2C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16183, 11830, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16204, 11830, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16223, 12433, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16241, 12433, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16259, 12433, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16277, 12433, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16295, 11830, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16323, 11830, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16351, 11830, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16379, 11830, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16406, 11830, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16434, 11830, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16462, 11830, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16490, 11830, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16518, 11830, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16541, 11830, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16562, 11830, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16591, 11830, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16619, 11830, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16644, 11830, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16676, 11830, 0, 0, 0x2F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16704, 11830, 0, 0, 0x2F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16731, 11830, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16758, 11830, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16785, 11830, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {16812, 11830, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {16838, 11830, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {16865, 11830, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {16892, 11830, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {16919, 11830, 0, 0, 0x20,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {16946, 11830, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {16967, 11830, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {16986, 11830, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17013, 11830, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17039, 11830, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17062, 11830, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17092, 11830, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17118, 11830, 0, 0, 0x21,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17143, 11830, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17171, 11830, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17199, 11830, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17227, 11830, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17254, 11830, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17282, 11830, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17310, 11830, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17338, 11830, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17366, 11830, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17388, 11830, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17408, 11830, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17436, 11830, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17463, 11830, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17487, 11830, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17518, 11830, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17545, 11830, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17571, 11830, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17598, 11830, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17625, 11830, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17652, 11830, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17678, 11830, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17705, 11830, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17732, 11830, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17759, 11830, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17786, 11830, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {17807, 11830, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {17826, 11830, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {17853, 11830, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {17879, 11830, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {17902, 11830, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {17932, 11830, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {17958, 11830, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {17983, 11830, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18010, 11830, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18037, 11830, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18064, 11830, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18090, 11830, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18117, 11830, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18144, 11830, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18171, 11830, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18198, 11830, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18219, 11830, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18238, 11830, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18265, 11830, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18291, 11830, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18314, 11830, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18344, 11830, 0, 0, 0x29,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18370, 11830, 0, 0, 0x29,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18395, 11830, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18411, 11830, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18429, 11830, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18448, 11830, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18471, 11830, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18495, 11830, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18520, 11830, 0, 0, 0x51,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18546, 11830, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18563, 11830, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18580, 11830, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18600, 11830, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18620, 11830, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18641, 11830, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18664, 11830, 0, 0, 0x5C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18687, 11830, 0, 0, 0x5C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18706, 11830, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {18729, 11830, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {18752, 11830, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {18778, 11830, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {18804, 11830, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {18831, 11830, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {18860, 11830, 0, 0, 0x5D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {18889, 11830, 0, 0, 0x5D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {18914, 11830, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18930, 11830, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18948, 11830, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18964, 11830, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18980, 11830, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {18996, 11830, 0, 0, 0x35,0x11,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19015, 11830, 0, 0, 0x35,0x14,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19034, 11830, 0, 0, 0x35,0x15,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19054, 11830, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19071, 11830, 0, 0, 0x35,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19091, 11830, 0, 0, 0x35,0x24,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19111, 11830, 0, 0, 0x35,0x25,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19132, 11830, 0, 0, 0x35,0x31,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19147, 11830, 0, 0, 0x35,0x34,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19162, 11830, 0, 0, 0x35,0x35,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19184, 12433, 0, 0, 0x36,0x01,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19202, 12433, 0, 0, 0x36,0x02,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19222, 12433, 0, 0, 0x36,0x04,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19240, 12433, 0, 0, 0x36,0x08,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19258, 12433, 0, 0, 0x36,0x10,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19276, 12433, 0, 0, 0x36,0x11,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19297, 12433, 0, 0, 0x36,0x14,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19318, 12433, 0, 0, 0x36,0x17,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19340, 12433, 0, 0, 0x36,0x20,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19359, 12433, 0, 0, 0x36,0x21,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19381, 12433, 0, 0, 0x36,0x24,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19403, 12433, 0, 0, 0x36,0x27,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19426, 12433, 0, 0, 0x36,0x31,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19443, 12433, 0, 0, 0x36,0x34,0,0,EVENT_OPTION_OPCODE_MASK}
+, {19460, 11830, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19477, 11830, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {19494, 11830, 0, 0, 0x32,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {19519, 11830, 0, 0, 0x32,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {19544, 11830, 0, 0, 0x32,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {19569, 11830, 0, 0, 0x32,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {19593, 11830, 0, 0, 0x32,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {19617, 11830, 0, 0, 0x32,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {19643, 11830, 0, 0, 0x32,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {19669, 11830, 0, 0, 0x32,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {19695, 11830, 0, 0, 0x32,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {19720, 11830, 0, 0, 0x32,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {19745, 11830, 0, 0, 0x32,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {19772, 11830, 0, 0, 0x32,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {19799, 11830, 0, 0, 0x32,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {19826, 11830, 0, 0, 0x32,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {19852, 11830, 0, 0, 0x32,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {19878, 11830, 0, 0, 0x32,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {19903, 11830, 0, 0, 0x32,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {19928, 11830, 0, 0, 0x32,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {19953, 11830, 0, 0, 0x32,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {19977, 19990, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {19995, 19990, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20008, 19990, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20022, 19990, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20035, 19990, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20048, 19990, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20061, 19990, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20078, 19990, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20101, 19990, 0, 0, 0x04,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {20114, 19990, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {20131, 19990, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {20148, 19990, 0, 0, 0x04,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {20161, 19990, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {20178, 19990, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {20195, 19990, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {20214, 19990, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {20233, 20249, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20303, 20319, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20324, 20319, 0, 0, 0x60,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20347, 20319, 0, 0, 0x11,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20358, 20319, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20369, 20319, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20379, 20319, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20398, 20319, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20417, 20319, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20436, 20319, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20455, 20319, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20485, 20319, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20507, 20319, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20528, 20319, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20546, 20319, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20565, 20319, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20594, 20319, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20618, 20319, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20643, 20319, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20667, 20319, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20691, 20319, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20713, 20319, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20737, 20319, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20761, 20319, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20785, 20319, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20799, 20811, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20820, 20832, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20841, 20853, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20862, 20874, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20883, 20898, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {20902, 20898, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20926, 20898, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {20954, 20898, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {20979, 20898, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21008, 20898, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21041, 20898, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21074, 20898, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21107, 20898, 44, 2, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21143, 20898, 44, 2, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21179, 20898, 44, 2, 0x4F,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21215, 20898, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21248, 20898, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21281, 20898, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21314, 20898, 44, 2, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21350, 20898, 44, 2, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21386, 20898, 44, 2, 0x51,0x03,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {21422, 20898, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21453, 20898, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21471, 20898, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21496, 20898, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21525, 20898, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21555, 20898, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21572, 20898, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {21596, 20898, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21618, 20898, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21640, 20898, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21662, 20898, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21684, 20898, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21706, 20898, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {21728, 20898, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {21750, 20898, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {21772, 20898, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21793, 20898, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21818, 20898, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21843, 20898, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21868, 20898, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {21891, 20898, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {21914, 20898, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {21937, 20898, 0, 0, 0x2B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {21960, 20898, 0, 0, 0x2B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {21983, 20898, 0, 0, 0x2B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22006, 20898, 0, 0, 0x2B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22029, 20898, 0, 0, 0x2B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22052, 20898, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22073, 20898, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22094, 20898, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22115, 20898, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22136, 20898, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22157, 20898, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22178, 20898, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22199, 20898, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22216, 20898, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22232, 20898, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22246, 20898, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22264, 20898, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22290, 20898, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22306, 20898, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22325, 20898, 0, 0, 0x38,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22347, 20898, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {22372, 20898, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {22387, 20898, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {22406, 20898, 0, 0, 0x38,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {22433, 20898, 0, 0, 0x38,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {22447, 20898, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22456, 20898, 0, 0, 0x66,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22474, 20898, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22489, 20898, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22502, 20898, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22522, 20898, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22540, 20898, 0, 0, 0x56,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22566, 20898, 0, 0, 0x57,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22582, 20898, 0, 0, 0x55,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22600, 20898, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22628, 20898, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22656, 20898, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22684, 20898, 44, 2, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22715, 20898, 44, 2, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22746, 20898, 44, 2, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22777, 20898, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {22806, 20898, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {22835, 20898, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {22864, 20898, 44, 2, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22896, 20898, 44, 2, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22928, 20898, 44, 2, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {22960, 20898, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22979, 20898, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {22996, 20898, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23011, 20898, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23028, 20898, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23047, 20898, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23064, 20898, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23079, 20898, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23096, 20898, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23124, 20898, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23152, 20898, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23180, 20898, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23208, 20898, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23243, 20898, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23278, 20898, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23313, 20898, 44, 2, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23351, 20898, 44, 2, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23389, 20898, 44, 2, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {23427, 20898, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23455, 20898, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23483, 20898, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23511, 20898, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23539, 20898, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23564, 20898, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23589, 20898, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23616, 20898, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {23643, 20898, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23658, 20898, 0, 0, 0x42,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23673, 20898, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23698, 20898, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23723, 20898, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23748, 20898, 0, 0, 0x45,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23772, 20898, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23795, 20898, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23818, 20898, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23841, 20898, 0, 0, 0x46,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23863, 20898, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {23891, 20898, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {23919, 20898, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {23947, 20898, 0, 0, 0x47,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {23974, 20898, 0, 0, 0x48,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24000, 20898, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24024, 20898, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24049, 20898, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24068, 20898, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24085, 20898, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24100, 20898, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24124, 20898, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24149, 20898, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24166, 20898, 0, 0, 0x39,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24177, 20898, 0, 0, 0x39,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24192, 20898, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24221, 20898, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24250, 20898, 0, 0, 0x1D,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24278, 20898, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24308, 20898, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24338, 20898, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24367, 20898, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24391, 20898, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24415, 20898, 0, 0, 0x14,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24438, 20898, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24465, 20898, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24491, 20898, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24517, 20898, 0, 0, 0x14,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24543, 20898, 0, 0, 0x14,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {24569, 20898, 0, 0, 0x14,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {24595, 20898, 0, 0, 0x14,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {24621, 20898, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24643, 20898, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24665, 20898, 0, 0, 0x13,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24686, 20898, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24711, 20898, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24734, 20898, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24757, 20898, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {24780, 20898, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24800, 20898, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24820, 20898, 0, 0, 0x11,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {24839, 20898, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24860, 20898, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {24881, 20898, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {24902, 20898, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {24933, 20898, 0, 0, 0x1F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {24962, 20898, 0, 0, 0x1F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {24991, 20898, 0, 0, 0x1F,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25019, 20898, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25049, 20898, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25079, 20898, 0, 0, 0x20,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25108, 20898, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25130, 20898, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25152, 20898, 0, 0, 0x12,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25173, 20898, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25198, 20898, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {25221, 20898, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {25244, 20898, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {25267, 20898, 0, 0, 0x6B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25286, 20898, 0, 0, 0x6B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25305, 20898, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25322, 20898, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25338, 20898, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {25353, 20898, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25382, 20898, 0, 0, 0x19,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25411, 20898, 0, 0, 0x19,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25439, 20898, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25469, 20898, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25499, 20898, 0, 0, 0x1E,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25528, 20898, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25552, 20898, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25576, 20898, 0, 0, 0x18,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25599, 20898, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25621, 20898, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25643, 20898, 0, 0, 0x17,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25664, 20898, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25684, 20898, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25704, 20898, 0, 0, 0x15,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25723, 20898, 0, 0, 0x1B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25752, 20898, 0, 0, 0x1B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25781, 20898, 0, 0, 0x1B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25809, 20898, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25839, 20898, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25869, 20898, 0, 0, 0x1C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25898, 20898, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25920, 20898, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {25942, 20898, 0, 0, 0x16,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {25963, 20898, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {25991, 20898, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26019, 20898, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26047, 20898, 0, 0, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26074, 20898, 44, 2, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26105, 20898, 44, 2, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26136, 20898, 44, 2, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26167, 20898, 44, 2, 0x4D,0x07,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26197, 20898, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26226, 20898, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26255, 20898, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26284, 20898, 0, 0, 0x4E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26312, 20898, 44, 2, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26344, 20898, 44, 2, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26376, 20898, 44, 2, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26408, 20898, 44, 2, 0x4E,0x07,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {26439, 20898, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26469, 20898, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26499, 20898, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26529, 20898, 0, 0, 0x4A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26559, 20898, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26587, 20898, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26615, 20898, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26643, 20898, 0, 0, 0x4B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26671, 20898, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26697, 20898, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26723, 20898, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26749, 20898, 0, 0, 0x61,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26775, 20898, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26803, 20898, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26831, 20898, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {26859, 20898, 0, 0, 0x60,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {26887, 26903, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {26908, 26903, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26928, 26903, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {26948, 26976, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {26991, 26976, 0, 0, 0x18,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27019, 26976, 0, 0, 0x18,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27047, 26976, 0, 0, 0x18,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27075, 26976, 0, 0, 0x18,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27103, 26976, 0, 0, 0x18,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27131, 26976, 0, 0, 0x18,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27159, 26976, 0, 0, 0x18,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {27187, 26903, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27203, 26903, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27235, 26903, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27267, 26903, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27299, 26903, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27322, 26903, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27346, 26903, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27368, 26903, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27400, 26903, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27441, 26903, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27473, 26903, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27514, 26903, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {27546, 26903, 0, 0, 0x15,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {27569, 26903, 0, 0, 0x15,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {27593, 26903, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27609, 26903, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27623, 26903, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27636, 26903, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {27658, 26903, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {27680, 26903, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {27702, 26903, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {27724, 26903, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27743, 26903, 46, 1, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {27772, 26903, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {27790, 26903, 0, 0, 0x05,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {27814, 26903, 0, 0, 0x05,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {27842, 26903, 0, 0, 0x05,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {27866, 26903, 0, 0, 0x05,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {27894, 26903, 0, 0, 0x05,0x0A,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {27925, 26903, 0, 0, 0x05,0x0A,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {27960, 26903, 0, 0, 0x05,0x0C,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {27989, 26903, 0, 0, 0x05,0x0C,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28022, 26903, 0, 0, 0x05,0x0D,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28045, 26903, 0, 0, 0x05,0x0D,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28072, 26903, 0, 0, 0x05,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28096, 26903, 0, 0, 0x05,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28124, 26903, 0, 0, 0x05,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {28148, 26903, 0, 0, 0x05,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {28176, 26903, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28195, 26903, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28214, 26903, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28233, 26903, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28258, 26903, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28283, 26903, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28308, 26903, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28324, 26903, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28340, 26903, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28356, 26903, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28371, 26903, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {28390, 26903, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28406, 26903, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28421, 26903, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28438, 26903, 0, 0, 0x03,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {28453, 26903, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28471, 26903, 0, 0, 0x03,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {28490, 26903, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28502, 26903, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28522, 26903, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28542, 26903, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28562, 26903, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28586, 26903, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28610, 26903, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28634, 26903, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28658, 26903, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28682, 26903, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28706, 26903, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {28731, 26903, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {28752, 26903, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {28780, 26903, 0, 0, 0x2A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {28806, 26903, 0, 0, 0x2A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {28827, 26903, 0, 0, 0x2A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {28850, 26903, 0, 0, 0x2A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {28871, 26903, 0, 0, 0x2A,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {28894, 26903, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28913, 26903, 46, 1, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {28942, 26903, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28970, 26903, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {28997, 26903, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29015, 26903, 0, 0, 0x04,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29039, 26903, 0, 0, 0x04,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29067, 26903, 0, 0, 0x04,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29091, 26903, 0, 0, 0x04,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29119, 26903, 0, 0, 0x04,0x0A,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29150, 26903, 0, 0, 0x04,0x0A,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29185, 26903, 0, 0, 0x04,0x0C,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29214, 26903, 0, 0, 0x04,0x0C,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29247, 26903, 0, 0, 0x04,0x0D,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29270, 26903, 0, 0, 0x04,0x0D,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29297, 26903, 0, 0, 0x04,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29321, 26903, 0, 0, 0x04,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29349, 26903, 0, 0, 0x04,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {29373, 26903, 0, 0, 0x04,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {29401, 26903, 0, 0, 0x41,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29414, 26903, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29430, 26903, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29446, 26903, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29462, 26903, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29477, 26903, 0, 0, 0x02,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {29496, 26903, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29512, 26903, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29527, 26903, 0, 0, 0x02,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {29544, 26903, 0, 0, 0x02,0x47,0,0,EVENT_OPTION_NONE_MASK}
+, {29559, 26903, 0, 0, 0x02,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {29577, 26903, 0, 0, 0x02,0xB7,0,0,EVENT_OPTION_NONE_MASK}
+, {29596, 26903, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29608, 26903, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29628, 26903, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29648, 26903, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29668, 26903, 0, 0, 0x45,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29699, 26903, 0, 0, 0x44,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29727, 29743, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29748, 29743, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {29775, 29743, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {29802, 29743, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {29829, 29743, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29856, 29743, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29883, 29743, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29910, 29743, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {29933, 29743, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {29956, 29743, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {29979, 29743, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30002, 29743, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30025, 29743, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30048, 29743, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30071, 29743, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30094, 29743, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30117, 29743, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30139, 29743, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30161, 29743, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30183, 29743, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30206, 29743, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30229, 29743, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30252, 29743, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30270, 29743, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30290, 29743, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30310, 29743, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30330, 29743, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30351, 29743, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30372, 29743, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30393, 29743, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30409, 30431, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30463, 30431, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30485, 30431, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30507, 30431, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30530, 30431, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30553, 30431, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {30576, 30431, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {30594, 30612, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30676, 30612, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30694, 30612, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30714, 30612, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30734, 29743, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30755, 29743, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30776, 29743, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30797, 29743, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30818, 29743, 0, 0, 0x25,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30839, 29743, 0, 0, 0x25,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30860, 29743, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30879, 29743, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {30898, 29743, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {30917, 29743, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {30936, 29743, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {30955, 29743, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {30974, 29743, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {30991, 29743, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31008, 29743, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31025, 29743, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31046, 29743, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31063, 29743, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31080, 29743, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31097, 29743, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {31118, 30431, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31137, 30431, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31156, 30431, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31175, 30431, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31194, 30431, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31213, 30431, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31232, 31248, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31253, 31248, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31278, 31248, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31302, 31248, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31327, 31248, 0, 0, 0x22,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31352, 31248, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31361, 31248, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {31370, 31248, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31404, 31248, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31433, 31248, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31462, 31248, 0, 0, 0x23,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31491, 31248, 0, 0, 0x23,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31520, 31248, 0, 0, 0x23,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31544, 31248, 0, 0, 0x23,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31572, 31248, 0, 0, 0x3E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31597, 31248, 0, 0, 0x3E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31622, 31248, 0, 0, 0x3E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31647, 31248, 0, 0, 0x3E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31672, 31248, 0, 0, 0x3E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31697, 31248, 0, 0, 0x3E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31722, 31248, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31746, 31248, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31770, 31248, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31794, 31248, 0, 0, 0x4B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31818, 31248, 0, 0, 0x4B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {31841, 31248, 0, 0, 0x4B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {31865, 31248, 0, 0, 0x4B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {31889, 31248, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {31913, 31248, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {31937, 31248, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {31961, 31248, 0, 0, 0x4C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {31985, 31248, 0, 0, 0x4C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32008, 31248, 0, 0, 0x4C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32032, 31248, 0, 0, 0x4C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32056, 31248, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32082, 31248, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32108, 31248, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32136, 31248, 0, 0, 0x4D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32164, 31248, 0, 0, 0x4D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32192, 31248, 0, 0, 0x4D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32220, 31248, 0, 0, 0x4D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32251, 31248, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32279, 31248, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32307, 31248, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32335, 31248, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32363, 31248, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32390, 31248, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32418, 31248, 0, 0, 0x49,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32446, 31248, 0, 0, 0x4A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32474, 31248, 0, 0, 0x4A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32502, 31248, 0, 0, 0x4A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32530, 31248, 0, 0, 0x4A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32558, 31248, 0, 0, 0x4A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32585, 31248, 0, 0, 0x4A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32613, 31248, 0, 0, 0x4A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32641, 31248, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32667, 31248, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32693, 31248, 0, 0, 0x47,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32719, 31248, 0, 0, 0x47,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32745, 31248, 0, 0, 0x47,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32770, 31248, 0, 0, 0x47,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32796, 31248, 0, 0, 0x47,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {32822, 31248, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {32848, 31248, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {32874, 31248, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {32900, 31248, 0, 0, 0x48,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {32926, 31248, 0, 0, 0x48,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {32951, 31248, 0, 0, 0x48,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {32977, 31248, 0, 0, 0x48,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33003, 31248, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33027, 31248, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33053, 31248, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33080, 31248, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33107, 31248, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33132, 31248, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33157, 31248, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33182, 31248, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33207, 31248, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33231, 31248, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33256, 31248, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33281, 31248, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33306, 31248, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33331, 31248, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33356, 31248, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33381, 31248, 0, 0, 0x51,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33405, 31248, 0, 0, 0x51,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33430, 31248, 0, 0, 0x51,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33455, 31248, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33481, 31248, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33507, 31248, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33535, 31248, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33558, 31248, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33584, 31248, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33610, 31248, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33630, 31248, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33650, 31248, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33672, 31248, 0, 0, 0x61,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33693, 31248, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33718, 31248, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33743, 31248, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33768, 31248, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33793, 31248, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33817, 31248, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {33842, 31248, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {33867, 31248, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {33892, 31248, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {33917, 31248, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {33942, 31248, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {33967, 31248, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {33991, 31248, 0, 0, 0x44,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34016, 31248, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34041, 31248, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34069, 31248, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34100, 31248, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34131, 31248, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34156, 31248, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34181, 31248, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34211, 31248, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34237, 31248, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34267, 31248, 0, 0, 0x59,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34296, 31248, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34327, 31248, 0, 0, 0x5A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {34342, 31248, 0, 0, 0x56,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34363, 31248, 0, 0, 0x56,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34385, 31248, 0, 0, 0x56,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34407, 31248, 0, 0, 0x56,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34432, 31248, 0, 0, 0x56,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34455, 31248, 0, 0, 0x56,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34478, 31248, 0, 0, 0x56,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34501, 31248, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34523, 31248, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34551, 31248, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34577, 31248, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34603, 31248, 0, 0, 0x58,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34632, 31248, 0, 0, 0x58,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34672, 31248, 0, 0, 0x58,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34711, 31248, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34735, 31248, 0, 0, 0x53,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34764, 31248, 0, 0, 0x53,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {34795, 31248, 0, 0, 0x53,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {34827, 31248, 0, 0, 0x53,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {34855, 31248, 0, 0, 0x53,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {34877, 31248, 0, 0, 0x53,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {34903, 31248, 0, 0, 0x53,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {34930, 31248, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {34956, 31248, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {34988, 31248, 0, 0, 0x55,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35010, 31248, 0, 0, 0x55,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35039, 31248, 0, 0, 0x55,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35068, 31248, 0, 0, 0x55,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35100, 31248, 0, 0, 0x55,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35132, 31248, 0, 0, 0x55,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35160, 31248, 0, 0, 0x55,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35188, 31248, 0, 0, 0x55,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35218, 31248, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35231, 31248, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35244, 31248, 0, 0, 0x52,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35270, 31248, 0, 0, 0x52,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35296, 31248, 0, 0, 0x52,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35322, 31248, 0, 0, 0x52,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35348, 31248, 0, 0, 0x52,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35370, 31248, 0, 0, 0x52,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {35392, 31248, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35415, 31248, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35438, 31248, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35461, 31248, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35484, 31248, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35506, 31248, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35529, 31248, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35552, 31248, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35575, 31248, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35598, 31248, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35621, 31248, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35644, 31248, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35666, 31248, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35689, 31248, 0, 0, 0x42,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35712, 31248, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35737, 31248, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35762, 31248, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35787, 31248, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35812, 31248, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {35836, 31248, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {35861, 31248, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {35886, 31248, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {35911, 31248, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {35936, 31248, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {35961, 31248, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {35986, 31248, 0, 0, 0x46,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36010, 31248, 0, 0, 0x46,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36035, 31248, 0, 0, 0x46,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36060, 31248, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36088, 31248, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36116, 31248, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36144, 31248, 0, 0, 0x4E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36172, 31248, 0, 0, 0x4E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36199, 31248, 0, 0, 0x4E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36227, 31248, 0, 0, 0x4E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36255, 31248, 0, 0, 0x4F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36283, 31248, 0, 0, 0x4F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36311, 31248, 0, 0, 0x4F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36339, 31248, 0, 0, 0x4F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36367, 31248, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36394, 31248, 0, 0, 0x4F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36422, 31248, 0, 0, 0x4F,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36450, 31248, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36473, 31248, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36497, 31248, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36520, 31248, 0, 0, 0x62,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36544, 31248, 0, 0, 0x62,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36569, 31248, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36586, 31248, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36608, 31248, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36624, 31248, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36640, 31248, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36656, 31248, 0, 0, 0x5B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36679, 31248, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36703, 31248, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36727, 31248, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36751, 31248, 0, 0, 0x30,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36774, 31248, 0, 0, 0x30,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {36798, 31248, 0, 0, 0x30,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {36822, 31248, 0, 0, 0x30,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {36846, 31248, 0, 0, 0x30,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {36869, 31248, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {36896, 31248, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {36923, 31248, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {36950, 31248, 0, 0, 0x2C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {36981, 31248, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37010, 31248, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37039, 31248, 0, 0, 0x27,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37068, 31248, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37096, 31248, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37125, 31248, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37154, 31248, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37183, 31248, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37211, 31248, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37238, 31248, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37265, 31248, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37292, 31248, 0, 0, 0x2D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37318, 31248, 0, 0, 0x2D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37345, 31248, 0, 0, 0x2D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37372, 31248, 0, 0, 0x2D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37399, 31248, 0, 0, 0x2D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37425, 37454, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37486, 37454, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37515, 37454, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37544, 37454, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37572, 37454, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37601, 37454, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37630, 37454, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37659, 37454, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37687, 37454, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37722, 37454, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {37757, 37454, 0, 0, 0x3C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {37786, 37454, 0, 0, 0x3C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {37821, 37454, 0, 0, 0x3C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {37856, 37454, 0, 0, 0x3C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {37885, 37454, 0, 0, 0x3C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {37919, 37454, 0, 0, 0x3C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {37953, 31248, 0, 0, 0x3D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {37991, 31248, 0, 0, 0x3D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38029, 31248, 0, 0, 0x3D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38067, 31248, 0, 0, 0x3D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38105, 31248, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38139, 31248, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38173, 31248, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38206, 31248, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38240, 31248, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38274, 31248, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38307, 31248, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38339, 31248, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38371, 31248, 0, 0, 0x33,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38402, 31248, 0, 0, 0x33,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38434, 31248, 0, 0, 0x33,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38466, 31248, 0, 0, 0x33,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38497, 31248, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38535, 31248, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38573, 31248, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38611, 31248, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38648, 31248, 0, 0, 0x32,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38686, 31248, 0, 0, 0x32,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38724, 31248, 0, 0, 0x32,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {38762, 31248, 0, 0, 0x32,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {38799, 31248, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38818, 37454, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {38839, 31248, 0, 0, 0x35,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {38863, 31248, 0, 0, 0x35,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {38886, 31248, 0, 0, 0x35,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {38910, 31248, 0, 0, 0x35,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {38934, 31248, 0, 0, 0x35,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {38958, 31248, 0, 0, 0x35,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {38981, 31248, 0, 0, 0x35,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39005, 31248, 0, 0, 0x35,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39029, 31248, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39058, 31248, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39087, 31248, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39116, 31248, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39144, 31248, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39173, 31248, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39202, 31248, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39231, 31248, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39259, 31248, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39286, 31248, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39313, 31248, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39339, 31248, 0, 0, 0x2E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39366, 31248, 0, 0, 0x2E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39393, 31248, 0, 0, 0x2E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39420, 31248, 0, 0, 0x2E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39446, 31248, 0, 0, 0x2E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39473, 37454, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39502, 37454, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39530, 37454, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {39559, 37454, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39588, 37454, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39617, 37454, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39645, 37454, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {39674, 37454, 0, 0, 0x1D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39703, 31248, 0, 0, 0x38,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39734, 31248, 0, 0, 0x38,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39766, 31248, 0, 0, 0x38,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {39798, 31248, 0, 0, 0x38,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {39829, 31248, 0, 0, 0x38,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {39861, 31248, 0, 0, 0x38,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {39893, 31248, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {39931, 31248, 0, 0, 0x37,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {39968, 31248, 0, 0, 0x37,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40006, 31248, 0, 0, 0x37,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40044, 31248, 0, 0, 0x37,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40082, 31248, 0, 0, 0x37,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40119, 31248, 0, 0, 0x37,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40157, 31248, 0, 0, 0x37,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {40195, 31248, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40225, 31248, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40259, 31248, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40293, 31248, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40327, 31248, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40361, 31248, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40395, 31248, 0, 0, 0x20,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40429, 31248, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40459, 31248, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40493, 31248, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40531, 31248, 0, 0, 0x21,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40564, 31248, 0, 0, 0x21,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40598, 31248, 0, 0, 0x21,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40636, 31248, 0, 0, 0x21,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {40669, 31248, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {40688, 31248, 0, 0, 0x5C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40709, 31248, 0, 0, 0x5C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40730, 31248, 0, 0, 0x5C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40751, 31248, 0, 0, 0x5C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40771, 31248, 0, 0, 0x5C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40792, 31248, 0, 0, 0x5C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40813, 31248, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40834, 31248, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40855, 31248, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40876, 31248, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {40896, 31248, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {40917, 31248, 0, 0, 0x5D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {40938, 31248, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {40957, 31248, 0, 0, 0x5E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {40976, 31248, 0, 0, 0x5E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {40995, 31248, 0, 0, 0x5E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41013, 31248, 0, 0, 0x5E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41032, 31248, 0, 0, 0x5E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41051, 31248, 0, 0, 0x5F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {41070, 31248, 0, 0, 0x5F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {41089, 31248, 0, 0, 0x5F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {41108, 31248, 0, 0, 0x5F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {41126, 31248, 0, 0, 0x5F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {41145, 31248, 0, 0, 0x5F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {41164, 41180, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41185, 41180, 0, 0, 0xC2,0x04,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {41208, 41180, 0, 0, 0xC2,0x04,0x07,0x02,EVENT_OPTION_NONE_MASK}
+, {41231, 41180, 0, 0, 0xC2,0x04,0x07,0x04,EVENT_OPTION_NONE_MASK}
+, {41254, 41180, 0, 0, 0xC2,0x04,0x07,0x08,EVENT_OPTION_NONE_MASK}
+, {41277, 41180, 0, 0, 0xD5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {41296, 41180, 0, 0, 0xC0,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41327, 41180, 0, 0, 0xC0,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41358, 41180, 0, 0, 0xC0,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {41389, 41180, 0, 0, 0xC0,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {41420, 41180, 0, 0, 0xC0,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {41450, 41180, 0, 0, 0xC0,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {41480, 41180, 0, 0, 0xC0,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41512, 41180, 0, 0, 0xC0,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41544, 41180, 0, 0, 0xC0,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {41576, 41180, 0, 0, 0xC0,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {41608, 41180, 0, 0, 0xC0,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {41639, 41180, 0, 0, 0xC0,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {41670, 41180, 0, 0, 0xC0,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41702, 41180, 0, 0, 0xC0,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41734, 41180, 0, 0, 0xC0,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {41766, 41180, 0, 0, 0xC0,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {41798, 41180, 0, 0, 0xC0,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {41829, 41180, 0, 0, 0xC0,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {41860, 41180, 0, 0, 0xC0,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {41893, 41180, 0, 0, 0xC0,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {41926, 41180, 0, 0, 0xC0,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {41959, 41180, 0, 0, 0xC0,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {41992, 41180, 0, 0, 0xC0,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42024, 41180, 0, 0, 0xC0,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42056, 41180, 0, 0, 0xC0,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42087, 41180, 0, 0, 0xC0,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42118, 41180, 0, 0, 0xC0,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42149, 41180, 0, 0, 0xC0,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42180, 41180, 0, 0, 0xC0,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42210, 41180, 0, 0, 0xC0,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42240, 41180, 0, 0, 0xC0,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42272, 41180, 0, 0, 0xC0,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42304, 41180, 0, 0, 0xC0,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42336, 41180, 0, 0, 0xC0,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42367, 41180, 0, 0, 0xC0,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42398, 41180, 0, 0, 0xC0,0x80,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42428, 41180, 0, 0, 0xC0,0x80,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42458, 41180, 0, 0, 0xC0,0x80,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42488, 41180, 0, 0, 0xC0,0x80,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42518, 41180, 0, 0, 0xC0,0x80,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42547, 41180, 0, 0, 0xC0,0x80,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42576, 41180, 0, 0, 0xC0,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42607, 41180, 0, 0, 0xC0,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42638, 41180, 0, 0, 0xC0,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42669, 41180, 0, 0, 0xC0,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42699, 41180, 0, 0, 0xC0,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42729, 41180, 0, 0, 0x83,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42760, 41180, 0, 0, 0x83,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42791, 41180, 0, 0, 0x83,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {42822, 41180, 0, 0, 0x83,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {42853, 41180, 0, 0, 0x83,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {42883, 41180, 0, 0, 0x83,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {42913, 41180, 0, 0, 0x83,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {42945, 41180, 0, 0, 0x83,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {42977, 41180, 0, 0, 0x83,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43009, 41180, 0, 0, 0x83,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43041, 41180, 0, 0, 0x83,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43072, 41180, 0, 0, 0x83,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43103, 41180, 0, 0, 0x83,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43135, 41180, 0, 0, 0x83,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43167, 41180, 0, 0, 0x83,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43199, 41180, 0, 0, 0x83,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43231, 41180, 0, 0, 0x83,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43262, 41180, 0, 0, 0x83,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43293, 41180, 0, 0, 0x83,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43326, 41180, 0, 0, 0x83,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43359, 41180, 0, 0, 0x83,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43392, 41180, 0, 0, 0x83,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43425, 41180, 0, 0, 0x83,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43457, 41180, 0, 0, 0x83,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43489, 41180, 0, 0, 0x83,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43518, 41180, 0, 0, 0x83,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43547, 41180, 0, 0, 0x83,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43576, 41180, 0, 0, 0x83,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43605, 41180, 0, 0, 0x83,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43633, 41180, 0, 0, 0x83,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43661, 41180, 0, 0, 0x83,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43693, 41180, 0, 0, 0x83,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43725, 41180, 0, 0, 0x83,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43757, 41180, 0, 0, 0x83,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43789, 41180, 0, 0, 0x83,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43820, 41180, 0, 0, 0x83,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {43851, 41180, 0, 0, 0x83,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {43877, 41180, 0, 0, 0x83,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {43903, 41180, 0, 0, 0x83,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {43929, 41180, 0, 0, 0x83,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {43955, 41180, 0, 0, 0x83,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {43980, 41180, 0, 0, 0x83,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44005, 41180, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44023, 41180, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44040, 41180, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44051, 41180, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44071, 41180, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44091, 41180, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44120, 41180, 0, 0, 0x02,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {44145, 41180, 0, 0, 0x02,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {44174, 41180, 0, 0, 0x02,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {44207, 41180, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {44226, 41180, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {44245, 41180, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {44273, 41180, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {44297, 41180, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {44325, 41180, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {44357, 41180, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44365, 41180, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {44378, 41180, 0, 0, 0xC1,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44408, 41180, 0, 0, 0xC1,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44438, 41180, 0, 0, 0xC1,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44468, 41180, 0, 0, 0xC1,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44498, 41180, 0, 0, 0xC1,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44527, 41180, 0, 0, 0xC1,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44556, 41180, 0, 0, 0xC1,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44587, 41180, 0, 0, 0xC1,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44618, 41180, 0, 0, 0xC1,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44649, 41180, 0, 0, 0xC1,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44680, 41180, 0, 0, 0xC1,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44710, 41180, 0, 0, 0xC1,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44740, 41180, 0, 0, 0xC1,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44771, 41180, 0, 0, 0xC1,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44802, 41180, 0, 0, 0xC1,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {44833, 41180, 0, 0, 0xC1,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {44864, 41180, 0, 0, 0xC1,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {44894, 41180, 0, 0, 0xC1,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {44924, 41180, 0, 0, 0xC1,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {44956, 41180, 0, 0, 0xC1,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {44988, 41180, 0, 0, 0xC1,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45020, 41180, 0, 0, 0xC1,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45052, 41180, 0, 0, 0xC1,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45083, 41180, 0, 0, 0xC1,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45114, 41180, 0, 0, 0xC1,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45144, 41180, 0, 0, 0xC1,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45174, 41180, 0, 0, 0xC1,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45204, 41180, 0, 0, 0xC1,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45234, 41180, 0, 0, 0xC1,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45263, 41180, 0, 0, 0xC1,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45292, 41180, 0, 0, 0xC1,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45323, 41180, 0, 0, 0xC1,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45354, 41180, 0, 0, 0xC1,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45385, 41180, 0, 0, 0xC1,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45415, 41180, 0, 0, 0xC1,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45445, 41180, 0, 0, 0xC1,0x80,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45474, 41180, 0, 0, 0xC1,0x80,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45503, 41180, 0, 0, 0xC1,0x80,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45532, 41180, 0, 0, 0xC1,0x80,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45561, 41180, 0, 0, 0xC1,0x80,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45589, 41180, 0, 0, 0xC1,0x80,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45617, 41180, 0, 0, 0xC1,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45647, 41180, 0, 0, 0xC1,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45677, 41180, 0, 0, 0xC1,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45707, 41180, 0, 0, 0xC1,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45736, 41180, 0, 0, 0xC1,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45765, 41180, 0, 0, 0x84,0x04,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45795, 41180, 0, 0, 0x84,0x04,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {45825, 41180, 0, 0, 0x84,0x04,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {45855, 41180, 0, 0, 0x84,0x04,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {45885, 41180, 0, 0, 0x84,0x04,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {45914, 41180, 0, 0, 0x84,0x04,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {45943, 41180, 0, 0, 0x84,0x01,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {45974, 41180, 0, 0, 0x84,0x01,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46005, 41180, 0, 0, 0x84,0x01,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46036, 41180, 0, 0, 0x84,0x01,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46067, 41180, 0, 0, 0x84,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46097, 41180, 0, 0, 0x84,0x01,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46127, 41180, 0, 0, 0x84,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46158, 41180, 0, 0, 0x84,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46189, 41180, 0, 0, 0x84,0x08,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46220, 41180, 0, 0, 0x84,0x08,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46251, 41180, 0, 0, 0x84,0x08,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46281, 41180, 0, 0, 0x84,0x08,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46311, 41180, 0, 0, 0x84,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46343, 41180, 0, 0, 0x84,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46375, 41180, 0, 0, 0x84,0x02,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46407, 41180, 0, 0, 0x84,0x02,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46439, 41180, 0, 0, 0x84,0x02,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46470, 41180, 0, 0, 0x84,0x02,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46501, 41180, 0, 0, 0x84,0x10,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46529, 41180, 0, 0, 0x84,0x10,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46557, 41180, 0, 0, 0x84,0x10,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46585, 41180, 0, 0, 0x84,0x10,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46613, 41180, 0, 0, 0x84,0x10,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46640, 41180, 0, 0, 0x84,0x10,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46667, 41180, 0, 0, 0x84,0x20,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46698, 41180, 0, 0, 0x84,0x20,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46729, 41180, 0, 0, 0x84,0x20,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46760, 41180, 0, 0, 0x84,0x20,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46791, 41180, 0, 0, 0x84,0x20,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46821, 41180, 0, 0, 0x84,0x20,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46851, 41180, 0, 0, 0x84,0x40,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {46876, 41180, 0, 0, 0x84,0x40,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {46901, 41180, 0, 0, 0x84,0x40,0x03,0x04,EVENT_OPTION_NONE_MASK}
+, {46926, 41180, 0, 0, 0x84,0x40,0x03,0x08,EVENT_OPTION_NONE_MASK}
+, {46951, 41180, 0, 0, 0x84,0x40,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {46975, 41180, 0, 0, 0x84,0x40,0x03,0x20,EVENT_OPTION_NONE_MASK}
+, {46999, 41180, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {47022, 41180, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {47043, 41180, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {47062, 41180, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {47081, 41180, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {47100, 41180, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {47120, 41180, 0, 0, 0x41,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {47140, 41180, 0, 0, 0x41,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {47161, 41180, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47175, 47194, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47254, 47273, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47333, 47352, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47412, 47431, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47491, 47511, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47571, 47591, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47651, 47671, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47731, 47751, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47811, 47828, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47882, 47904, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {47964, 47986, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48046, 48068, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48128, 48150, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48210, 48233, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48293, 48316, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48376, 48399, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48459, 48482, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48542, 48557, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48561, 48557, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48587, 48557, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48614, 48557, 0, 0, 0x0F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48640, 48557, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48662, 48557, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48679, 48557, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48696, 48557, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {48713, 48557, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {48733, 48557, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {48757, 48557, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {48777, 48557, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {48798, 48557, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48807, 48557, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48819, 48557, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48833, 48557, 0, 0, 0x16,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {48850, 48557, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48874, 48557, 0, 0, 0x1E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48899, 48557, 0, 0, 0x1C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {48914, 48557, 0, 0, 0x1C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {48929, 48557, 0, 0, 0x1C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {48954, 48557, 0, 0, 0x1C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {48979, 48557, 0, 0, 0x1C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49008, 48557, 0, 0, 0x1C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49029, 48557, 0, 0, 0x1C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49052, 48557, 0, 0, 0x1C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {49071, 48557, 0, 0, 0x1D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49084, 48557, 0, 0, 0x1D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49097, 48557, 0, 0, 0x1D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49110, 48557, 0, 0, 0x1D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49123, 48557, 0, 0, 0x1D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49138, 48557, 0, 0, 0x1D,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49159, 48557, 0, 0, 0x1D,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49178, 48557, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49190, 48557, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49204, 48557, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49224, 48557, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49244, 48557, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49265, 48557, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49287, 48557, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49308, 48557, 0, 0, 0x13,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {49343, 48557, 0, 0, 0x13,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {49364, 48557, 0, 0, 0x13,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {49399, 48557, 0, 0, 0x12,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {49423, 48557, 0, 0, 0x12,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {49447, 48557, 0, 0, 0x12,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {49470, 48557, 0, 0, 0x12,0x71,0,0,EVENT_OPTION_NONE_MASK}
+, {49493, 48557, 0, 0, 0x12,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {49518, 48557, 0, 0, 0x12,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {49543, 48557, 0, 0, 0x12,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {49567, 48557, 0, 0, 0x12,0x72,0,0,EVENT_OPTION_NONE_MASK}
+, {49591, 48557, 0, 0, 0x12,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {49617, 48557, 0, 0, 0x12,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {49643, 48557, 0, 0, 0x12,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {49668, 48557, 0, 0, 0x12,0x74,0,0,EVENT_OPTION_NONE_MASK}
+, {49693, 48557, 0, 0, 0x12,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {49718, 48557, 0, 0, 0x12,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {49743, 48557, 0, 0, 0x12,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {49767, 48557, 0, 0, 0x12,0x78,0,0,EVENT_OPTION_NONE_MASK}
+, {49791, 48557, 0, 0, 0x12,0x1C,0,0,EVENT_OPTION_NONE_MASK}
+, {49818, 48557, 0, 0, 0x12,0x2C,0,0,EVENT_OPTION_NONE_MASK}
+, {49845, 48557, 0, 0, 0x12,0x4C,0,0,EVENT_OPTION_NONE_MASK}
+, {49871, 48557, 0, 0, 0x12,0x7C,0,0,EVENT_OPTION_NONE_MASK}
+, {49897, 48557, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {49916, 48557, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {49936, 48557, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {49957, 48557, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {49978, 48557, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {49998, 48557, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50017, 48557, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {50040, 48557, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50055, 48557, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50078, 48557, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50097, 48557, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50118, 48557, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50141, 48557, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50160, 48557, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50181, 48557, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50204, 48557, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50223, 48557, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50244, 48557, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50272, 48557, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50300, 48557, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50321, 48557, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50342, 48557, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {50364, 50389, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50408, 50389, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50433, 50389, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50458, 50389, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50483, 50389, 0, 0, 0x80,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50508, 50389, 0, 0, 0x80,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50533, 50389, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50559, 50389, 0, 0, 0x82,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50585, 50389, 0, 0, 0x82,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50611, 50389, 0, 0, 0x82,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50637, 50389, 0, 0, 0x82,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50663, 50389, 0, 0, 0x82,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50689, 50389, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50714, 50389, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50739, 50389, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50764, 50389, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50789, 50389, 0, 0, 0x84,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50814, 50389, 0, 0, 0x84,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50839, 50389, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {50865, 50389, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {50891, 50389, 0, 0, 0x86,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {50917, 50389, 0, 0, 0x86,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {50943, 50389, 0, 0, 0x86,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {50969, 50389, 0, 0, 0x86,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {50995, 50389, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51020, 50389, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51045, 50389, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51070, 50389, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51095, 50389, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51120, 50389, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51145, 50389, 0, 0, 0x8A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51171, 50389, 0, 0, 0x8A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51197, 50389, 0, 0, 0x8A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51223, 50389, 0, 0, 0x8A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51249, 50389, 0, 0, 0x8A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51275, 50389, 0, 0, 0x8A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51301, 50389, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51326, 50389, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51351, 50389, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51376, 50389, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51401, 50389, 0, 0, 0x8C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51426, 50389, 0, 0, 0x8C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51451, 50389, 0, 0, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51477, 50389, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51503, 50389, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51529, 50389, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51555, 50389, 0, 0, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {51581, 50389, 0, 0, 0x8E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {51607, 50389, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {51622, 50389, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51652, 50389, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51682, 50389, 0, 0, 0xA5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51701, 50389, 0, 0, 0xA5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51720, 50389, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51750, 50389, 0, 0, 0xA7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51779, 50389, 0, 0, 0xA7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51810, 50389, 0, 0, 0xA7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51840, 50389, 0, 0, 0xA9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51870, 50389, 0, 0, 0xA9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {51899, 50389, 0, 0, 0xA9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {51930, 50389, 0, 0, 0xA9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {51960, 50389, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {51990, 50389, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52019, 50389, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52050, 50389, 0, 0, 0xAB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52080, 50389, 0, 0, 0xAB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52105, 50389, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52131, 50389, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52152, 50389, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52173, 50389, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52194, 50389, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52215, 50389, 0, 0, 0xA0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52236, 50389, 0, 0, 0xA0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52257, 50389, 0, 0, 0xA0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52278, 50389, 0, 0, 0xA0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52299, 50389, 0, 0, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52325, 50389, 0, 0, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52351, 50389, 0, 0, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52377, 50389, 0, 0, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52403, 50389, 0, 0, 0xA3,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {52433, 50389, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52459, 50389, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52485, 50389, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52511, 50389, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52537, 50389, 0, 0, 0xA4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52552, 50389, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52576, 50389, 0, 0, 0xB4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52600, 50389, 0, 0, 0xB4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52624, 50389, 0, 0, 0xB4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {52648, 50389, 0, 0, 0xB4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {52668, 50389, 0, 0, 0xB4,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {52688, 50389, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52706, 50389, 0, 0, 0xB2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52724, 50389, 0, 0, 0xB2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52742, 50389, 0, 0, 0xB2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52760, 50389, 0, 0, 0xB2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52778, 50389, 0, 0, 0xB2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {52796, 50389, 0, 0, 0xB2,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {52810, 50389, 0, 0, 0xB2,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {52824, 50389, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {52847, 50389, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {52870, 50389, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {52893, 50389, 0, 0, 0xB3,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {52916, 50389, 0, 0, 0xB3,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {52939, 50389, 0, 0, 0xB3,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {52962, 50389, 0, 0, 0xB3,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {52982, 50389, 0, 0, 0xB3,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53001, 50389, 0, 0, 0xB3,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53020, 50389, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53039, 50389, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53058, 50389, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53077, 50389, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53096, 50389, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53115, 50389, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53134, 50389, 0, 0, 0xB1,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53149, 50389, 0, 0, 0xB1,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53164, 50389, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53185, 50389, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53206, 50389, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53227, 50389, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53248, 50389, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {53269, 50389, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {53290, 50389, 0, 0, 0xB0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {53307, 50389, 0, 0, 0xB0,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {53324, 50389, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53352, 50389, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53379, 50389, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53407, 50389, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53434, 50389, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53462, 50389, 0, 0, 0xA8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53489, 50389, 0, 0, 0xA8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53517, 50389, 0, 0, 0xA8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53544, 50389, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53572, 50389, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {53599, 50389, 0, 0, 0xAA,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {53627, 50389, 0, 0, 0xAA,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {53654, 50389, 0, 0, 0xAC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {53677, 50389, 0, 0, 0xAC,0x04,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable skylakeX_arch_events = {
+    NUM_ARCH_EVENTS_SKYLAKEX,
+    skylakeX_arch_event_strings,
+    skylakeX_arch_event_options,
+    skylakeX_arch_event_entries
+};
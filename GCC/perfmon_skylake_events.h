@@ -0,0 +1,970 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_SKYLAKE 444
+
+static const char skylake_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "PMC\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_ALL\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "BACLEARS_ANY\0"
+    "ITLB_FLUSH\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_1_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_2_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_LE_3_UOP_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_RECOVERY_CYCLES_ANY\0"
+    "INT_MISC_RECOVERY_COUNT_ANY\0"
+    "INT_MISC_CLEAR_RESTEER_CYCLES\0"
+    "INT_MISC_CLEAR_RESTEER_COUNT\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_SB\0"
+    "PARTIAL_RAT_STALLS_SCOREBOARD\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_VECTOR_WIDTH_MISMATCH\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CORE_USED_CYCLES\0"
+    "UOPS_ISSUED_CORE_STALL_CYCLES\0"
+    "UOPS_ISSUED_CORE_TOTAL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "TX_EXEC_MISC1\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "TX_EXEC_MISC4\0"
+    "TX_EXEC_MISC5\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "HLE_RETIRED_START\0"
+    "HLE_RETIRED_COMMIT\0"
+    "HLE_RETIRED_ABORTED\0"
+    "HLE_RETIRED_ABORTED_MEM\0"
+    "HLE_RETIRED_ABORTED_TIMER\0"
+    "HLE_RETIRED_ABORTED_UNFRIENDLY\0"
+    "HLE_RETIRED_ABORTED_MEMTYPE\0"
+    "HLE_RETIRED_ABORTED_EVENTS\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "HW_INTERRUPTS_RECEIVED\0"
+    "INST_RETIRED_ANY\0"
+    "UOPS_RETIRED_ALL\0"
+    "UOPS_RETIRED_CORE_ALL\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_USED_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CORE_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_CORE_USED_CYCLES\0"
+    "UOPS_RETIRED_CORE_STALL_CYCLES\0"
+    "UOPS_RETIRED_CORE_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_RETIRED_CYCLES_GE_8_UOPS_EXEC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_NOT_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ASSIST_ANY\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HIT\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_HITM\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "FRONTEND_RETIRED_DSB_MISS\0"
+    "FRONTEND_RETIRED_L1I_MISS\0"
+    "FRONTEND_RETIRED_L2_MISS\0"
+    "FRONTEND_RETIRED_ITLB_MISS\0"
+    "FRONTEND_RETIRED_STLB_MISS\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_2\0"
+    "FRONTEND_RETIRED_LATENCY_GE_4\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_USED_CYCLES\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_USED_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_TOTAL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_5_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_6_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_7_UOPS_EXEC\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_8_UOPS_EXEC\0"
+    "UOPS_EXECUTED_X87\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2\0"
+    "UOPS_DISPATCHED_PORT_PORT_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS\0"
+    "UOPS_DISPATCHED_PORT_ARITH_PORTS_CORE\0"
+    "UOPS_DISPATCHED_PORT_DATA_PORTS\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_CYCLES_NO_EXECUTE\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L2_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L3_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L3_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "CYCLE_ACTIVITY_CYCLES_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_LDM_PENDING\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_PENDING\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_PENDING\0"
+    "EPT_WALK_PENDING\0"
+    "ITLB_MISSES_CAUSES_A_WALK\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_COMPLETED_1G\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "DTLB_LOAD_MISSES_CAUSES_A_WALK\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "L1D_REPLACEMENT\0"
+    "L1D_M_EVICT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY\0"
+    "TX_MEM_ABORT_HLE_STORE_TO_ELIDED_LOCK\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_NOT_EMPTY\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_MISMATCH\0"
+    "TX_MEM_ABORT_HLE_ELISION_BUFFER_UNSUPPORTED_ALIGNMENT\0"
+    "TX_MEM_HLE_ELISION_BUFFER_FULL\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_PENDING_CYCLES_ANY\0"
+    "LOAD_HIT_PRE_SW_PF\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_L3_MISS_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_BUFFER_SQ_FULL\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "LONGEST_LAT_CACHE_MISS\0"
+    "LONGEST_LAT_CACHE_REFERENCE\0"
+    "L2_RQSTS_DEMAND_DATA_RD_MISS\0"
+    "L2_RQSTS_DEMAND_DATA_RD_HIT\0"
+    "L2_RQSTS_ALL_DEMAND_DATA_RD\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "L2_RQSTS_ALL_PF\0"
+    "L2_RQSTS_PF_MISS\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_MISS\0"
+    "L2_RQSTS_ALL_DEMAND_REFERENCES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_MS_DSB_UOPS\0"
+    "IDQ_MS_MITE_UOPS\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MITE_CYCLES\0"
+    "IDQ_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MITE_CYCLES_6_UOPS\0"
+    "IDQ_DSB_CYCLES\0"
+    "IDQ_DSB_CYCLES_1_UOPS\0"
+    "IDQ_DSB_CYCLES_2_UOPS\0"
+    "IDQ_DSB_CYCLES_3_UOPS\0"
+    "IDQ_DSB_CYCLES_4_UOPS\0"
+    "IDQ_DSB_CYCLES_5_UOPS\0"
+    "IDQ_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_CYCLES\0"
+    "IDQ_MS_DSB_CYCLES_1_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_2_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_3_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_4_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_5_UOPS\0"
+    "IDQ_MS_DSB_CYCLES_6_UOPS\0"
+    "IDQ_MS_DSB_OCCUR\0"
+    "IDQ_MS_MITE_CYCLES\0"
+    "IDQ_MS_MITE_CYCLES_1_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_2_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_3_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_4_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_5_UOPS\0"
+    "IDQ_MS_MITE_CYCLES_6_UOPS\0"
+    "IDQ_MS_CYCLES\0"
+    "IDQ_MS_CYCLES_1_UOPS\0"
+    "IDQ_MS_CYCLES_2_UOPS\0"
+    "IDQ_MS_CYCLES_3_UOPS\0"
+    "IDQ_MS_CYCLES_4_UOPS\0"
+    "IDQ_MS_CYCLES_5_UOPS\0"
+    "IDQ_MS_CYCLES_6_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_ALL_DSB_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_1_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_2_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_3_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_4_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_5_UOPS\0"
+    "IDQ_ALL_DSB_CYCLES_6_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_1_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_2_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_3_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_4_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_5_UOPS\0"
+    "IDQ_ALL_MITE_CYCLES_6_UOPS\0"
+    "IDQ_ALL_CYCLES_ANY_UOPS\0"
+    "IDQ_ALL_CYCLES_1_UOPS\0"
+    "IDQ_ALL_CYCLES_2_UOPS\0"
+    "IDQ_ALL_CYCLES_3_UOPS\0"
+    "IDQ_ALL_CYCLES_4_UOPS\0"
+    "IDQ_ALL_CYCLES_5_UOPS\0"
+    "IDQ_ALL_CYCLES_6_UOPS\0"
+    "L2_LINES_IN_I\0"
+    "L2_LINES_IN_S\0"
+    "L2_LINES_IN_E\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "L2_LINES_OUT_USELESS_PREF\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_1\0"
+    "LSD_UOPS_CYCLES_2\0"
+    "LSD_UOPS_CYCLES_3\0"
+    "LSD_UOPS_CYCLES_4\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_INACTIVE\0"
+    "OTHER_ASSISTS_ANY\0"
+    "FRONTEND_RETIRED_LATENCY_GE_8\0"
+    "FRONTEND_RETIRED_LATENCY_GE_16\0"
+    "FRONTEND_RETIRED_LATENCY_GE_32\0"
+    "FRONTEND_RETIRED_LATENCY_GE_64\0"
+    "FRONTEND_RETIRED_LATENCY_GE_128\0"
+    "FRONTEND_RETIRED_LATENCY_GE_256\0"
+    "FRONTEND_RETIRED_LATENCY_GE_512\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_1\0"
+    "FRONTEND_RETIRED_LATENCY_GE_2_BUBBLES_GE_3\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "CACHE_LOOKUP_M\0"
+    "CBOX\0"
+    "CACHE_LOOKUP_E\0"
+    "CACHE_LOOKUP_S\0"
+    "CACHE_LOOKUP_I\0"
+    "CACHE_LOOKUP_READ_FILTER\0"
+    "CACHE_LOOKUP_WRITE_FILTER\0"
+    "CACHE_LOOKUP_EXTSNP_FILTER\0"
+    "CACHE_LOOKUP_ANY_REQUEST_FILTER\0"
+    "CACHE_LOOKUP_READ_M\0"
+    "CACHE_LOOKUP_WRITE_M\0"
+    "CACHE_LOOKUP_EXTSNP_M\0"
+    "CACHE_LOOKUP_ANY_M\0"
+    "CACHE_LOOKUP_READ_E\0"
+    "CACHE_LOOKUP_WRITE_E\0"
+    "CACHE_LOOKUP_EXTSNP_E\0"
+    "CACHE_LOOKUP_ANY_E\0"
+    "CACHE_LOOKUP_READ_S\0"
+    "CACHE_LOOKUP_WRITE_S\0"
+    "CACHE_LOOKUP_EXTSNP_S\0"
+    "CACHE_LOOKUP_ANY_S\0"
+    "CACHE_LOOKUP_READ_ES\0"
+    "CACHE_LOOKUP_WRITE_ES\0"
+    "CACHE_LOOKUP_EXTSNP_ES\0"
+    "CACHE_LOOKUP_ANY_ES\0"
+    "CACHE_LOOKUP_READ_I\0"
+    "CACHE_LOOKUP_WRITE_I\0"
+    "CACHE_LOOKUP_EXTSNP_I\0"
+    "CACHE_LOOKUP_ANY_I\0"
+    "CACHE_LOOKUP_READ_MESI\0"
+    "CACHE_LOOKUP_WRITE_MESI\0"
+    "CACHE_LOOKUP_EXTSNP_MESI\0"
+    "CACHE_LOOKUP_ANY_MESI\0"
+    "XSNP_RESPONSE_MISS_EXTERNAL\0"
+    "XSNP_RESPONSE_MISS_XCORE\0"
+    "XSNP_RESPONSE_MISS_EVICTION\0"
+    "XSNP_RESPONSE_HIT_EXTERNAL\0"
+    "XSNP_RESPONSE_HIT_XCORE\0"
+    "XSNP_RESPONSE_HIT_EVICTION\0"
+    "XSNP_RESPONSE_HITM_EXTERNAL\0"
+    "XSNP_RESPONSE_HITM_XCORE\0"
+    "XSNP_RESPONSE_HITM_EVICTION\0"
+    "TRK_OCCUPANCY_ALL\0"
+    "UBOX0\0"
+    "TRK_REQUESTS_ALL\0"
+    "UBOX\0"
+    "TRK_REQUESTS_WRITES\0"
+    "COH_TRK_OCCUPANCY\0"
+    "COH_TRK_REQUESTS_ALL\0"
+    "UNCORE_CLOCK\0"
+    "UBOXFIX\0"
+    "IO_REQUESTS\0"
+    "MBOX0C0\0"
+    "DRAM_READS\0"
+    "MBOX0C1\0"
+    "DRAM_WRITES\0"
+    "MBOX0C2\0"
+    "PP0_TEMP\0"
+    "MBOX0TMP0\0"
+    "PP1_TEMP\0"
+    "MBOX0TMP1\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "MPERF\0"
+    "APERF\0"
+    "PPERF\0";
+
+static const PerfmonEventOption skylake_arch_event_options[] = {
+ {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x7}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x01}
+};
+
+static const PerfmonEventEntry skylake_arch_event_entries[NUM_ARCH_EVENTS_SKYLAKE] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 139, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {145, 167, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {173, 194, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {200, 224, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {228, 224, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {249, 224, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {271, 224, 0, 0, 0x83,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {292, 224, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {315, 224, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {343, 224, 0, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {375, 224, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {403, 224, 0, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {435, 224, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {472, 224, 1, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {504, 224, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {517, 224, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {528, 224, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {542, 224, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {570, 224, 3, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {618, 224, 4, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {668, 224, 5, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {718, 224, 6, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {768, 224, 7, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {808, 224, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {841, 224, 0, 0, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {866, 224, 9, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {890, 224, 10, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {919, 224, 11, 2, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {947, 224, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {977, 224, 9, 1, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {1006, 224, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1026, 224, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1045, 224, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1075, 224, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1091, 224, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1125, 224, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1146, 224, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1170, 224, 13, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1195, 224, 15, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1220, 224, 17, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1249, 224, 19, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1279, 224, 22, 3, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {1309, 224, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1343, 224, 5, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1377, 224, 4, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1411, 224, 3, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1445, 224, 25, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1479, 224, 0, 0, 0x5D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1493, 224, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1507, 224, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1521, 224, 0, 0, 0x5D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1535, 224, 0, 0, 0x5D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1549, 224, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1572, 224, 26, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {1592, 224, 0, 0, 0xC8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1610, 224, 0, 0, 0xC8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1629, 224, 0, 0, 0xC8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1649, 224, 0, 0, 0xC8,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1673, 224, 0, 0, 0xC8,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1699, 224, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1730, 224, 0, 0, 0xC8,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1758, 224, 0, 0, 0xC8,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1785, 224, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 224, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1822, 224, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1842, 224, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1866, 224, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1892, 224, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1923, 224, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1951, 224, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1978, 224, 29, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {1999, 224, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2030, 224, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2049, 224, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2072, 224, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2089, 224, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2106, 224, 0, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2128, 224, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2154, 224, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2179, 224, 13, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2205, 224, 15, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2231, 224, 0, 1, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2262, 224, 17, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2292, 224, 19, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2323, 224, 22, 3, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2354, 224, 6, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2389, 224, 5, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2424, 224, 4, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2459, 224, 3, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2494, 224, 25, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2529, 224, 31, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2564, 224, 32, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2599, 224, 33, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2634, 224, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2663, 224, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2691, 224, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2717, 224, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2745, 224, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2771, 224, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2798, 224, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2825, 224, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2854, 224, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2882, 224, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2909, 224, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2945, 224, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2981, 224, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3022, 224, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3063, 224, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3104, 224, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3145, 224, 6, 1, 0xCA,0x1E,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3159, 224, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {3192, 224, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3226, 224, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {3254, 224, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {3283, 224, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {3313, 224, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {3340, 224, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {3368, 224, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {3389, 224, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3413, 224, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3437, 224, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3461, 224, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3486, 224, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3511, 224, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3536, 224, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3560, 224, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {3584, 224, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {3608, 224, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {3632, 224, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3666, 224, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3699, 224, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3733, 224, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3767, 224, 0, 0, 0xC6,0x01,0x00,0x11,EVENT_OPTION_NONE_MASK}
+, {3793, 224, 0, 0, 0xC6,0x01,0x00,0x12,EVENT_OPTION_NONE_MASK}
+, {3819, 224, 0, 0, 0xC6,0x01,0x00,0x13,EVENT_OPTION_NONE_MASK}
+, {3844, 224, 0, 0, 0xC6,0x01,0x00,0x14,EVENT_OPTION_NONE_MASK}
+, {3871, 224, 0, 0, 0xC6,0x01,0x00,0x15,EVENT_OPTION_NONE_MASK}
+, {3898, 224, 0, 0, 0xC6,0x01,0x00,0x400206,EVENT_OPTION_NONE_MASK}
+, {3928, 224, 0, 0, 0xC6,0x01,0x00,0x200206,EVENT_OPTION_NONE_MASK}
+, {3971, 224, 0, 0, 0xC6,0x01,0x00,0x400406,EVENT_OPTION_NONE_MASK}
+, {4001, 224, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4022, 224, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4048, 224, 13, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4075, 224, 15, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4102, 224, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4138, 224, 5, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4174, 224, 4, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4210, 224, 3, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4246, 224, 25, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4282, 224, 31, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4318, 224, 32, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4354, 224, 33, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4390, 224, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4409, 224, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4440, 224, 13, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4472, 224, 15, 2, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4504, 224, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4545, 224, 5, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4586, 224, 4, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4627, 224, 3, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4668, 224, 25, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4709, 224, 31, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4750, 224, 32, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4791, 224, 33, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4832, 224, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4850, 224, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4881, 224, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4907, 224, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4933, 224, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4959, 224, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4985, 224, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5014, 224, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5042, 224, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5070, 224, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5098, 224, 0, 0, 0xA1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5126, 224, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5154, 224, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5182, 224, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5210, 224, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5238, 224, 0, 0, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK}
+, {5271, 224, 0, 1, 0xA1,0x63,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5309, 224, 0, 1, 0xA1,0x9C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {5341, 224, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5369, 224, 3, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5402, 224, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5432, 224, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5462, 224, 6, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5495, 224, 25, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5528, 224, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5558, 224, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5588, 224, 5, 1, 0xA3,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5621, 224, 31, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5654, 224, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5684, 224, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5714, 224, 34, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5748, 224, 35, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5782, 224, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5813, 224, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5844, 224, 33, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5878, 224, 36, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5912, 224, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5929, 224, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5955, 224, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5980, 224, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6001, 224, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6028, 224, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6058, 224, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6091, 224, 0, 0, 0x85,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6121, 224, 6, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6145, 224, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6176, 224, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6206, 224, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6232, 224, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6264, 224, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6299, 224, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6337, 224, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6372, 224, 6, 1, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6401, 224, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6433, 224, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6464, 224, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6491, 224, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {6524, 224, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6560, 224, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6599, 224, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6635, 224, 6, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6665, 224, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6687, 224, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6706, 224, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6722, 224, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6734, 224, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6756, 224, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6778, 224, 0, 0, 0x54,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6816, 224, 0, 0, 0x54,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6858, 224, 0, 0, 0x54,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6899, 224, 0, 0, 0x54,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6953, 224, 0, 0, 0x54,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6984, 224, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7006, 224, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7028, 224, 6, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7057, 224, 37, 2, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {7090, 224, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7109, 224, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7141, 224, 9, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {7170, 224, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7194, 224, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7210, 224, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7242, 224, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7274, 224, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7306, 224, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7334, 224, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7363, 224, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7403, 224, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7433, 224, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7477, 224, 31, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7526, 224, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7570, 224, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7610, 224, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 224, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7703, 224, 6, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7759, 224, 6, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7808, 224, 6, 1, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7864, 224, 6, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7916, 224, 6, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {7980, 224, 31, 1, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8037, 224, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8069, 224, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8093, 224, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8106, 224, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8123, 224, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8139, 224, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8155, 224, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8172, 224, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8187, 224, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8209, 224, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8232, 224, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {8260, 224, 0, 0, 0x24,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {8289, 224, 0, 0, 0x24,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {8317, 224, 0, 0, 0x24,0xE1,0,0,EVENT_OPTION_NONE_MASK}
+, {8345, 224, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {8362, 224, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {8383, 224, 0, 0, 0x24,0xF8,0,0,EVENT_OPTION_NONE_MASK}
+, {8399, 224, 0, 0, 0x24,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8416, 224, 0, 0, 0x24,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {8432, 224, 0, 0, 0x24,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {8449, 224, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {8467, 224, 0, 0, 0x24,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {8488, 224, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8510, 224, 0, 0, 0x24,0x27,0,0,EVENT_OPTION_NONE_MASK}
+, {8535, 224, 0, 0, 0x24,0xE7,0,0,EVENT_OPTION_NONE_MASK}
+, {8566, 224, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {8580, 224, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8600, 224, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8614, 224, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8627, 224, 0, 0, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8643, 224, 0, 0, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8660, 224, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {8672, 224, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8688, 224, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8711, 224, 5, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8734, 224, 4, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8757, 224, 3, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8780, 224, 25, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8803, 224, 31, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8826, 224, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8841, 224, 6, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8863, 224, 5, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8885, 224, 4, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8907, 224, 3, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8929, 224, 25, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8951, 224, 31, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8973, 224, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {8991, 224, 6, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9016, 224, 5, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9041, 224, 4, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9066, 224, 3, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9091, 224, 25, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9116, 224, 31, 1, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9141, 224, 39, 2, 0x79,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9158, 224, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9177, 224, 6, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9203, 224, 5, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9229, 224, 4, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9255, 224, 3, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9281, 224, 25, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9307, 224, 31, 1, 0x79,0x20,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9333, 224, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9347, 224, 6, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9368, 224, 5, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9389, 224, 4, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9410, 224, 3, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9431, 224, 25, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9452, 224, 31, 1, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9473, 224, 39, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {9489, 224, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9517, 224, 6, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9543, 224, 5, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9569, 224, 4, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9595, 224, 3, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9621, 224, 25, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9647, 224, 31, 1, 0x79,0x18,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9673, 224, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9702, 224, 6, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9729, 224, 5, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9756, 224, 4, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9783, 224, 3, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9810, 224, 25, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9837, 224, 31, 1, 0x79,0x24,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9864, 224, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9888, 224, 6, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9910, 224, 5, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9932, 224, 4, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9954, 224, 3, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9976, 224, 25, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {9998, 224, 31, 1, 0x79,0x3C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10020, 224, 0, 0, 0xF1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10034, 224, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10048, 224, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10062, 224, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10078, 224, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10098, 224, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10122, 224, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10148, 224, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10169, 224, 41, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10189, 224, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10198, 224, 6, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10216, 224, 5, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10234, 224, 4, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10252, 224, 3, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10270, 224, 43, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {10293, 224, 13, 2, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {10318, 224, 0, 0, 0xC1,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {10336, 224, 0, 0, 0xC6,0x01,0x00,0x400806,EVENT_OPTION_NONE_MASK}
+, {10366, 224, 0, 0, 0xC6,0x01,0x00,0x401006,EVENT_OPTION_NONE_MASK}
+, {10397, 224, 0, 0, 0xC6,0x01,0x00,0x402006,EVENT_OPTION_NONE_MASK}
+, {10428, 224, 0, 0, 0xC6,0x01,0x00,0x404006,EVENT_OPTION_NONE_MASK}
+, {10459, 224, 0, 0, 0xC6,0x01,0x00,0x408006,EVENT_OPTION_NONE_MASK}
+, {10491, 224, 0, 0, 0xC6,0x01,0x00,0x410006,EVENT_OPTION_NONE_MASK}
+, {10523, 224, 0, 0, 0xC6,0x01,0x00,0x420006,EVENT_OPTION_NONE_MASK}
+, {10555, 224, 0, 0, 0xC6,0x01,0x00,0x100206,EVENT_OPTION_NONE_MASK}
+, {10598, 224, 0, 0, 0xC6,0x01,0x00,0x300206,EVENT_OPTION_NONE_MASK}
+, {10641, 224, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10668, 224, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {10695, 10710, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10715, 10710, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10730, 10710, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10745, 10710, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10760, 10710, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10785, 10710, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10811, 10710, 0, 0, 0x34,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {10838, 10710, 0, 0, 0x34,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {10870, 10710, 0, 0, 0x34,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {10890, 10710, 0, 0, 0x34,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {10911, 10710, 0, 0, 0x34,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {10933, 10710, 0, 0, 0x34,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {10952, 10710, 0, 0, 0x34,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {10972, 10710, 0, 0, 0x34,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {10993, 10710, 0, 0, 0x34,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {11015, 10710, 0, 0, 0x34,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {11034, 10710, 0, 0, 0x34,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {11054, 10710, 0, 0, 0x34,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11075, 10710, 0, 0, 0x34,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11097, 10710, 0, 0, 0x34,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11116, 10710, 0, 0, 0x34,0x16,0,0,EVENT_OPTION_NONE_MASK}
+, {11137, 10710, 0, 0, 0x34,0x26,0,0,EVENT_OPTION_NONE_MASK}
+, {11159, 10710, 0, 0, 0x34,0x46,0,0,EVENT_OPTION_NONE_MASK}
+, {11182, 10710, 0, 0, 0x34,0x86,0,0,EVENT_OPTION_NONE_MASK}
+, {11202, 10710, 0, 0, 0x34,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {11222, 10710, 0, 0, 0x34,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {11243, 10710, 0, 0, 0x34,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11265, 10710, 0, 0, 0x34,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11284, 10710, 0, 0, 0x34,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {11307, 10710, 0, 0, 0x34,0x2F,0,0,EVENT_OPTION_NONE_MASK}
+, {11331, 10710, 0, 0, 0x34,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {11356, 10710, 0, 0, 0x34,0x8F,0,0,EVENT_OPTION_NONE_MASK}
+, {11378, 10710, 0, 0, 0x22,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {11406, 10710, 0, 0, 0x22,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {11431, 10710, 0, 0, 0x22,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {11459, 10710, 0, 0, 0x22,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {11486, 10710, 0, 0, 0x22,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {11510, 10710, 0, 0, 0x22,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {11537, 10710, 0, 0, 0x22,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {11565, 10710, 0, 0, 0x22,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {11590, 10710, 0, 0, 0x22,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {11618, 11636, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11642, 11659, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11664, 11659, 0, 0, 0x81,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11684, 11636, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11702, 11659, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11723, 11736, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11744, 11756, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11764, 11775, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11783, 11795, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11803, 11812, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11822, 11831, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11841, 11854, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11859, 11859, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11865, 11865, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {11871, 11871, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable skylake_arch_events = {
+    NUM_ARCH_EVENTS_SKYLAKE,
+    skylake_arch_event_strings,
+    skylake_arch_event_options,
+    skylake_arch_event_entries
+};
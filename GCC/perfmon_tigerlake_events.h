@@ -0,0 +1,566 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_TIGERLAKE 250
+
+static const char tigerlake_arch_event_strings[] =
+    "TEMP_CORE\0"
+    "TMP0\0"
+    "PWR_PKG_ENERGY\0"
+    "PWR0\0"
+    "PWR_PP0_ENERGY\0"
+    "PWR1\0"
+    "PWR_PP1_ENERGY\0"
+    "PWR2\0"
+    "PWR_DRAM_ENERGY\0"
+    "PWR3\0"
+    "PWR_PLATFORM_ENERGY\0"
+    "PWR4\0"
+    "VOLTAGE_CORE\0"
+    "VTG0\0"
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "TOPDOWN_SLOTS\0"
+    "FIXC3\0"
+    "RETIRING\0"
+    "TMA0\0"
+    "BAD_SPECULATION\0"
+    "TMA1\0"
+    "FRONTEND_BOUND\0"
+    "TMA2\0"
+    "BACKEND_BOUND\0"
+    "TMA3\0"
+    "LD_BLOCKS_STORE_FORWARD\0"
+    "PMC\0"
+    "LD_BLOCKS_NO_SR\0"
+    "LD_BLOCKS_PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_WALK_PENDING\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_LOAD_MISSES_WALK_ACTIVE\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_CAUSES_A_WALK\0"
+    "DTLB_STORE_MISSES_WALK_PENDING\0"
+    "DTLB_STORE_MISSES_STLB_HIT\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_4K\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_2M_4M\0"
+    "DTLB_STORE_MISSES_WALK_COMPLETED_1G\0"
+    "DTLB_STORE_MISSES_WALK_ACTIVE\0"
+    "INT_MISC_RECOVERY_CYCLES\0"
+    "INT_MISC_RECOVERY_COUNT\0"
+    "INT_MISC_UOP_DROPPING\0"
+    "INT_MISC_CLEAR_RESTEER_CYCLES\0"
+    "INT_MISC_CLEAR_RESTEER_COUNT\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_VECTOR_WIDTH_MISMATCH\0"
+    "UOPS_ISSUED_SLOW_LEA\0"
+    "UOPS_ISSUED_USED_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "UOPS_ISSUED_CYCLES_GE_1_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_2_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_3_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_4_UOPS_EXEC\0"
+    "UOPS_ISSUED_CYCLES_GE_5_UOPS_EXEC\0"
+    "ARITH_DIVIDER_ACTIVE\0"
+    "ARITH_DIVIDER_COUNT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_CODE_RD_MISS\0"
+    "L2_RQSTS_SWPF_MISS\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_CODE_RD_HIT\0"
+    "L2_RQSTS_SWPF_HIT\0"
+    "L2_RQSTS_PF_HIT\0"
+    "L2_RQSTS_ALL_RFO\0"
+    "L2_RQSTS_ALL_CODE_RD\0"
+    "CORE_POWER_LVL0_TURBO_LICENSE\0"
+    "CORE_POWER_LVL1_TURBO_LICENSE\0"
+    "CORE_POWER_LVL2_TURBO_LICENSE\0"
+    "SW_PREFETCH_ACCESS_NTA\0"
+    "SW_PREFETCH_ACCESS_T0\0"
+    "SW_PREFETCH_ACCESS_T1_T2\0"
+    "SW_PREFETCH_ACCESS_PREFETCHW\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK\0"
+    "CPU_CLOCK_UNHALTED_ONE_THREAD_ACTIVE\0"
+    "CPU_CLOCK_UNHALTED_REF_DISTRIBUTED\0"
+    "L1D_PEND_MISS_PENDING\0"
+    "L1D_PEND_MISS_PENDING_CYCLES\0"
+    "L1D_PEND_MISS_FB_FULL\0"
+    "L1D_PEND_MISS_FB_FULL_PERIODS\0"
+    "L1D_PEND_MISS_L2_STALL\0"
+    "LOAD_HIT_PREFETCH_SWPF\0"
+    "L1D_REPLACEMENT\0"
+    "TX_MEM_ABORT_CONFLICT\0"
+    "TX_MEM_ABORT_CAPACITY_READ\0"
+    "TX_MEM_ABORT_CAPACITY_WRITE\0"
+    "TX_EXEC_MISC2\0"
+    "TX_EXEC_MISC3\0"
+    "RS_EVENTS_EMPTY_CYCLES\0"
+    "RS_EVENTS_EMPTY_END\0"
+    "OFFCORE_REQUESTS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_L3_MISS_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_ALL_REQUESTS\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_DATA_RD_GE_6\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_CODE_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_ALL_DATA_RD\0"
+    "OFFCORE_REQUESTS_OUTSTANDING_CYCLES_WITH_ALL_DATA_RD\0"
+    "LOCK_CYCLES_CACHE_LOCK_DURATION\0"
+    "LOCK_CYCLES_CACHE_LOCK_COUNT\0"
+    "IDQ_MITE_UOPS\0"
+    "IDQ_MITE_CYCLES_OK\0"
+    "IDQ_MITE_CYCLES_ANY\0"
+    "IDQ_DSB_UOPS\0"
+    "IDQ_DSB_CYCLES_OK\0"
+    "IDQ_DSB_CYCLES_ANY\0"
+    "IDQ_MS_UOPS\0"
+    "IDQ_MS_SWITCHES\0"
+    "IDQ_MS_CYCLES_ANY\0"
+    "ICACHE_16B_IFDATA_STALL\0"
+    "ICACHE_64B_IFTAG_HIT\0"
+    "ICACHE_64B_IFTAG_MISS\0"
+    "ICACHE_64B_IFTAG_STALL\0"
+    "ITLB_MISSES_WALK_PENDING\0"
+    "ITLB_MISSES_STLB_HIT\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_COMPLETED_4K\0"
+    "ITLB_MISSES_WALK_COMPLETED_2M_4M\0"
+    "ITLB_MISSES_WALK_ACTIVE\0"
+    "ILD_STALL_LCP\0"
+    "IDQ_UOPS_NOT_DELIVERED_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_0_UOPS_DELIV_CORE\0"
+    "IDQ_UOPS_NOT_DELIVERED_CYCLES_FE_WAS_OK\0"
+    "UOPS_DISPATCHED_PORT_PORT_0\0"
+    "UOPS_DISPATCHED_PORT_PORT_1\0"
+    "UOPS_DISPATCHED_PORT_PORT_2_3\0"
+    "UOPS_DISPATCHED_PORT_PORT_4_9\0"
+    "UOPS_DISPATCHED_PORT_PORT_5\0"
+    "UOPS_DISPATCHED_PORT_PORT_6\0"
+    "UOPS_DISPATCHED_PORT_PORT_7_8\0"
+    "RESOURCE_STALLS_SCOREBOARD\0"
+    "RESOURCE_STALLS_SB\0"
+    "CYCLE_ACTIVITY_CYCLES_L1D_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_L2_MISS\0"
+    "CYCLE_ACTIVITY_CYCLES_MEM_ANY\0"
+    "CYCLE_ACTIVITY_STALLS_TOTAL\0"
+    "CYCLE_ACTIVITY_STALLS_L1D_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L2_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_L3_MISS\0"
+    "CYCLE_ACTIVITY_STALLS_MEM_ANY\0"
+    "TOPDOWN_SLOTS_P\0"
+    "TOPDOWN_BACKEND_BOUND_SLOTS\0"
+    "TOPDOWN_BR_MISPREDICT_SLOTS\0"
+    "EXE_ACTIVITY_1_PORTS_UTIL\0"
+    "EXE_ACTIVITY_2_PORTS_UTIL\0"
+    "EXE_ACTIVITY_3_PORTS_UTIL\0"
+    "EXE_ACTIVITY_4_PORTS_UTIL\0"
+    "EXE_ACTIVITY_BOUND_ON_LOADS\0"
+    "EXE_ACTIVITY_BOUND_ON_STORES\0"
+    "EXE_ACTIVITY_EXE_BOUND_0_PORTS\0"
+    "LSD_UOPS\0"
+    "LSD_UOPS_CYCLES_ACTIVE\0"
+    "LSD_UOPS_CYCLES_OK\0"
+    "DSB2MITE_SWITCHES_PENALTY_CYCLES\0"
+    "DSB2MITE_SWITCHES_PENALTY_COUNT\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_CORE\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_1\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_2\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_3\0"
+    "UOPS_EXECUTED_CORE_CYCLES_GE_4\0"
+    "UOPS_EXECUTED_X87\0"
+    "TLB_FLUSH_DTLB_THREAD\0"
+    "TLB_FLUSH_STLB_ANY\0"
+    "INST_RETIRED_ANY\0"
+    "INST_RETIRED_ANY_P\0"
+    "ASSISTS_PAGE_A_D\0"
+    "ASSISTS_FP\0"
+    "ASSISTS_ANY\0"
+    "UOPS_RETIRED_SLOTS\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "MACHINE_CLEARS_COUNT\0"
+    "MACHINE_CLEARS_MEMORY_ORDERING\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_INST_RETIRED_COND_TAKEN\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_NEAR_RETURN\0"
+    "BR_INST_RETIRED_COND_NTAKEN\0"
+    "BR_INST_RETIRED_COND\0"
+    "BR_INST_RETIRED_NEAR_TAKEN\0"
+    "BR_INST_RETIRED_FAR_BRANCH\0"
+    "BR_INST_RETIRED_INDIRECT\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_COND_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT_CALL\0"
+    "BR_MISP_RETIRED_COND_NTAKEN\0"
+    "BR_MISP_RETIRED_COND\0"
+    "BR_MISP_RETIRED_NEAR_TAKEN\0"
+    "BR_MISP_RETIRED_INDIRECT\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_SCALAR_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_128B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_256B_PACKED_SINGLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_DOUBLE\0"
+    "FP_ARITH_INST_RETIRED_512B_PACKED_SINGLE\0"
+    "RTM_RETIRED_START\0"
+    "RTM_RETIRED_COMMIT\0"
+    "RTM_RETIRED_ABORTED\0"
+    "RTM_RETIRED_ABORTED_MEM\0"
+    "RTM_RETIRED_ABORTED_TIMER\0"
+    "RTM_RETIRED_ABORTED_UNFRIENDLY\0"
+    "RTM_RETIRED_ABORTED_MEMTYPE\0"
+    "RTM_RETIRED_ABORTED_EVENTS\0"
+    "MISC_RETIRED_LBR_INSERTS\0"
+    "MISC_RETIRED_PAUSE_INST\0"
+    "MEM_INST_RETIRED_STLB_MISS_LOADS\0"
+    "MEM_INST_RETIRED_STLB_MISS_STORES\0"
+    "MEM_INST_RETIRED_LOCK_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_LOADS\0"
+    "MEM_INST_RETIRED_SPLIT_STORES\0"
+    "MEM_INST_RETIRED_ALL_LOADS\0"
+    "MEM_INST_RETIRED_ALL_STORES\0"
+    "MEM_INST_RETIRED_ALL\0"
+    "MEM_LOAD_RETIRED_L1_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_HIT\0"
+    "MEM_LOAD_RETIRED_L1_MISS\0"
+    "MEM_LOAD_RETIRED_L2_MISS\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_FB_HIT\0"
+    "MEM_LOAD_RETIRED_L1_ALL\0"
+    "MEM_LOAD_RETIRED_L2_ALL\0"
+    "MEM_LOAD_RETIRED_L3_ALL\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_MISS\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NO_FWD\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_XSNP_FWD\0"
+    "MEM_LOAD_L3_HIT_RETIRED_XSNP_NONE\0"
+    "BACLEARS_ANY\0"
+    "CPU_CLOCK_UNHALTED_DISTRIBUTED\0"
+    "L2_TRANS_DEMAND_DATA_RD\0"
+    "L2_TRANS_RFO\0"
+    "L2_TRANS_CODE_RD\0"
+    "L2_TRANS_ALL_PF\0"
+    "L2_TRANS_L1D_WB\0"
+    "L2_TRANS_L2_FILL\0"
+    "L2_TRANS_L2_WB\0"
+    "L2_TRANS_ALL_REQUESTS\0"
+    "L2_LINES_IN_ALL\0"
+    "L2_LINES_OUT_SILENT\0"
+    "L2_LINES_OUT_NON_SILENT\0"
+    "SQ_MISC\0";
+
+static const PerfmonEventOption tigerlake_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_THRESHOLD,0x3}
+, {EVENT_OPTION_THRESHOLD,0x4}
+, {EVENT_OPTION_THRESHOLD,0x5}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+, {EVENT_OPTION_THRESHOLD,0x6}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_THRESHOLD,0x8}
+, {EVENT_OPTION_THRESHOLD,0x10}
+, {EVENT_OPTION_THRESHOLD,0xC}
+, {EVENT_OPTION_THRESHOLD,0x14}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_THRESHOLD,0x05}
+, {EVENT_OPTION_THRESHOLD,0x01}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0xA}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,0x1}
+};
+
+static const PerfmonEventEntry tigerlake_arch_event_entries[NUM_ARCH_EVENTS_TIGERLAKE] = {
+ {0, 10, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {15, 30, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {35, 50, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 70, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75, 91, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {96, 116, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 134, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {139, 157, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {163, 185, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {191, 212, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {218, 232, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {238, 247, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {252, 268, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {273, 288, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {293, 307, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {312, 336, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {340, 336, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {356, 336, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {388, 336, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {418, 336, 0, 0, 0x08,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {450, 336, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {485, 336, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {523, 336, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {552, 336, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {578, 336, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {610, 336, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {641, 336, 0, 0, 0x49,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {668, 336, 0, 0, 0x49,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {701, 336, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {737, 336, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {776, 336, 0, 0, 0x49,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {812, 336, 0, 1, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {842, 336, 0, 1, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {867, 336, 1, 2, 0x0D,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {891, 336, 0, 0, 0x0D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {913, 336, 0, 0, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {943, 336, 3, 1, 0x0D,0x80,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {972, 336, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {988, 336, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1022, 336, 0, 0, 0x0E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1043, 336, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1067, 336, 4, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {1092, 336, 0, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1126, 336, 6, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1160, 336, 7, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1194, 336, 8, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1228, 336, 9, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1262, 336, 0, 1, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1283, 336, 10, 2, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1303, 336, 0, 0, 0x24,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {1321, 336, 0, 0, 0x24,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {1343, 336, 0, 0, 0x24,0x28,0,0,EVENT_OPTION_NONE_MASK}
+, {1362, 336, 0, 0, 0x24,0x3F,0,0,EVENT_OPTION_NONE_MASK}
+, {1376, 336, 0, 0, 0x24,0xC2,0,0,EVENT_OPTION_NONE_MASK}
+, {1393, 336, 0, 0, 0x24,0xC4,0,0,EVENT_OPTION_NONE_MASK}
+, {1414, 336, 0, 0, 0x24,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {1432, 336, 0, 0, 0x24,0xD8,0,0,EVENT_OPTION_NONE_MASK}
+, {1448, 336, 0, 0, 0x24,0xE2,0,0,EVENT_OPTION_NONE_MASK}
+, {1465, 336, 0, 0, 0x24,0xE4,0,0,EVENT_OPTION_NONE_MASK}
+, {1486, 336, 0, 0, 0x28,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1516, 336, 0, 0, 0x28,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {1546, 336, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1576, 336, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1599, 336, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1621, 336, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1646, 336, 0, 0, 0x32,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1675, 336, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1703, 336, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1731, 336, 0, 0, 0x3C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1768, 336, 0, 0, 0x3C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 336, 0, 0, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1825, 336, 0, 1, 0x48,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1854, 336, 0, 0, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1876, 336, 10, 2, 0x48,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1906, 336, 0, 0, 0x48,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1929, 336, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1952, 336, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1968, 336, 0, 0, 0x54,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1990, 336, 0, 0, 0x54,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2017, 336, 0, 0, 0x54,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2045, 336, 0, 0, 0x5D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2059, 336, 0, 0, 0x5D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2073, 336, 0, 0, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2096, 336, 12, 3, 0x5E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {2116, 336, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2148, 336, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2176, 336, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2205, 336, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2245, 336, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2275, 336, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2319, 336, 0, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2375, 336, 15, 1, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2436, 336, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2480, 336, 0, 1, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2536, 336, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2576, 336, 0, 1, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2628, 336, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2669, 336, 0, 1, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2722, 336, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2754, 336, 3, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {2783, 336, 0, 0, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2797, 336, 9, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2816, 336, 6, 1, 0x79,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2836, 336, 0, 0, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2849, 336, 9, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2867, 336, 0, 1, 0x79,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {2886, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2898, 336, 16, 2, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {2914, 336, 0, 0, 0x79,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {2932, 336, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2956, 336, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2977, 336, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2999, 336, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3022, 336, 0, 0, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3047, 336, 0, 0, 0x85,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3068, 336, 0, 0, 0x85,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {3095, 336, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3125, 336, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3158, 336, 0, 1, 0x85,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3182, 336, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3196, 336, 0, 0, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3224, 336, 9, 1, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3272, 336, 18, 2, 0x9C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {3312, 336, 0, 0, 0xA1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3340, 336, 0, 0, 0xA1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3368, 336, 0, 0, 0xA1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3398, 336, 0, 0, 0xA1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3428, 336, 0, 0, 0xA1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3456, 336, 0, 0, 0xA1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3484, 336, 0, 0, 0xA1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3514, 336, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3541, 336, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3560, 336, 20, 1, 0xA3,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3591, 336, 0, 1, 0xA3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3621, 336, 21, 1, 0xA3,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3651, 336, 8, 1, 0xA3,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3679, 336, 22, 1, 0xA3,0x0C,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3710, 336, 9, 1, 0xA3,0x05,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3740, 336, 15, 1, 0xA3,0x06,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3770, 336, 23, 1, 0xA3,0x14,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {3800, 336, 0, 0, 0xA4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3816, 336, 0, 0, 0xA4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3844, 336, 0, 0, 0xA4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3872, 336, 0, 0, 0xA6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3898, 336, 0, 0, 0xA6,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3924, 336, 0, 0, 0xA6,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3950, 336, 0, 0, 0xA6,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3976, 336, 0, 0, 0xA6,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {4004, 336, 0, 0, 0xA6,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4033, 336, 0, 0, 0xA6,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4064, 336, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4073, 336, 24, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4096, 336, 25, 1, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4115, 336, 0, 0, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4148, 336, 26, 2, 0xAB,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4180, 336, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4201, 336, 4, 2, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4228, 336, 0, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4254, 336, 6, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4280, 336, 7, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4306, 336, 8, 1, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4332, 336, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4351, 336, 0, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4382, 336, 6, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4413, 336, 7, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4444, 336, 8, 1, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {4475, 336, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4493, 336, 0, 0, 0xBD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4515, 336, 0, 0, 0xBD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4534, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4551, 336, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4570, 336, 0, 0, 0xC1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4587, 336, 0, 0, 0xC1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4598, 336, 0, 0, 0xC1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4610, 336, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4629, 336, 4, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4655, 336, 28, 2, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4681, 336, 30, 2, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4702, 336, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4733, 336, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4752, 336, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4781, 336, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4808, 336, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4834, 336, 0, 0, 0xC4,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4862, 336, 0, 0, 0xC4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4890, 336, 0, 0, 0xC4,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {4911, 336, 0, 0, 0xC4,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4938, 336, 0, 0, 0xC4,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4965, 336, 0, 0, 0xC4,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4990, 336, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5019, 336, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5046, 336, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5076, 336, 0, 0, 0xC5,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5104, 336, 0, 0, 0xC5,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5125, 336, 0, 0, 0xC5,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5152, 336, 0, 0, 0xC5,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5177, 336, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5213, 336, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5249, 336, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5290, 336, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5331, 336, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5372, 336, 0, 0, 0xC7,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5413, 336, 0, 0, 0xC7,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5454, 336, 0, 0, 0xC7,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5495, 336, 0, 0, 0xC9,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5513, 336, 0, 0, 0xC9,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5532, 336, 0, 0, 0xC9,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5552, 336, 0, 0, 0xC9,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5576, 336, 0, 0, 0xC9,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5602, 336, 0, 0, 0xC9,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5633, 336, 0, 0, 0xC9,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5661, 336, 0, 0, 0xC9,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5688, 336, 0, 0, 0xCC,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5713, 336, 0, 0, 0xCC,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5737, 336, 0, 0, 0xD0,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {5770, 336, 0, 0, 0xD0,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {5804, 336, 0, 0, 0xD0,0x21,0,0,EVENT_OPTION_NONE_MASK}
+, {5832, 336, 0, 0, 0xD0,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {5861, 336, 0, 0, 0xD0,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {5891, 336, 0, 0, 0xD0,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {5918, 336, 0, 0, 0xD0,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {5946, 336, 0, 0, 0xD0,0x83,0,0,EVENT_OPTION_NONE_MASK}
+, {5967, 336, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5991, 336, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6015, 336, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6039, 336, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6064, 336, 0, 0, 0xD1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6089, 336, 0, 0, 0xD1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6114, 336, 0, 0, 0xD1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6138, 336, 0, 0, 0xD1,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {6162, 336, 0, 0, 0xD1,0x12,0,0,EVENT_OPTION_NONE_MASK}
+, {6186, 336, 0, 0, 0xD1,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {6210, 336, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6244, 336, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6280, 336, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6318, 336, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6352, 336, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6365, 336, 0, 0, 0xEC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6396, 336, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6420, 336, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6433, 336, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6450, 336, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6466, 336, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6482, 336, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6499, 336, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6514, 336, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6536, 336, 0, 0, 0xF1,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {6552, 336, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6572, 336, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6596, 336, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable tigerlake_arch_events = {
+    NUM_ARCH_EVENTS_TIGERLAKE,
+    tigerlake_arch_event_strings,
+    tigerlake_arch_event_options,
+    tigerlake_arch_event_entries
+};
@@ -0,0 +1,5494 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_WESTMEREEX 2722
+
+static const char westmereEX_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LOAD_BLOCK_OVERLAP_STORE\0"
+    "PMC\0"
+    "SB_DRAIN_ANY\0"
+    "MISALIGN_MEMORY_STORE\0"
+    "STORE_BLOCKS_L1D_AT_RET\0"
+    "STORE_BLOCKS_L1D_BLOCK\0"
+    "PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_ANY\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_CYCLES\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_MISS\0"
+    "MEM_INST_RETIRED_LOADS\0"
+    "MEM_INST_RETIRED_STORES\0"
+    "MEM_INST_RETIRED_LATENCY_ABOVE_THRESHOLD\0"
+    "MEM_STORE_RETIRED_DTLB_MISS\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_STALLED_CYCLES\0"
+    "UOPS_ISSUED_FUSED\0"
+    "MEM_UNCORE_RETIRED_LOCAL_HITM\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM_AND_REMOTE_CACHE_HIT\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM\0"
+    "MEM_UNCORE_RETIRED_REMOTE_DRAM\0"
+    "MEM_UNCORE_RETIRED_UNCACHEABLE\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_MMX\0"
+    "FP_COMP_OPS_EXE_SSE_FP\0"
+    "FP_COMP_OPS_EXE_SSE2_INTEGER\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR\0"
+    "FP_COMP_OPS_EXE_SSE_SINGLE_PRECISION\0"
+    "FP_COMP_OPS_EXE_SSE_DOUBLE_PRECISION\0"
+    "SIMD_INT_128_PACKED_MPY\0"
+    "SIMD_INT_128_PACKED_SHIFT\0"
+    "SIMD_INT_128_PACK\0"
+    "SIMD_INT_128_UNPACK\0"
+    "SIMD_INT_128_PACKED_LOGICAL\0"
+    "SIMD_INT_128_PACKED_ARITH\0"
+    "SIMD_INT_128_SHUFFLE_MOVE\0"
+    "LOAD_DISPATCH_RS\0"
+    "LOAD_DISPATCH_RS_DELAYED\0"
+    "LOAD_DISPATCH_MOB\0"
+    "LOAD_DISPATCH_ANY\0"
+    "ARITH_CYCLES_DIV_BUSY\0"
+    "ARITH_NUM_DIV\0"
+    "ARITH_MUL\0"
+    "INST_QUEUE_WRITES\0"
+    "INST_DECODED_DECO\0"
+    "TWO_UPOS_INST_DECODED\0"
+    "INST_QUEUE_WRITE_CYCLES\0"
+    "LSD_OVERFLOW\0"
+    "L2_RQSTS_LD_HIT\0"
+    "L2_RQSTS_LD_MISS\0"
+    "L2_RQSTS_LOADS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFOS\0"
+    "L2_RQSTS_IFETCH_HIT\0"
+    "L2_RQSTS_IFETCH_MISS\0"
+    "L2_RQSTS_IFETCHES\0"
+    "L2_RQSTS_PREFETCH_HIT\0"
+    "L2_RQSTS_PREFETCH_MISS\0"
+    "L2_RQSTS_PREFETCHES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DATA_RQSTS_DEMAND_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_ANY\0"
+    "L2_WRITE_RFO_I_STATE\0"
+    "L2_WRITE_RFO_S_STATE\0"
+    "L2_WRITE_RFO_M_STATE\0"
+    "L2_WRITE_RFO_HIT\0"
+    "L2_WRITE_RFO_MESI\0"
+    "L2_WRITE_LOCK_I_STATE\0"
+    "L2_WRITE_LOCK_S_STATE\0"
+    "L2_WRITE_LOCK_E_STATE\0"
+    "L2_WRITE_LOCK_M_STATE\0"
+    "L2_WRITE_LOCK_HIT\0"
+    "L2_WRITE_LOCK_MESI\0"
+    "L1D_WB_L2_I_STATE\0"
+    "L1D_WB_L2_S_STATE\0"
+    "L1D_WB_L2_E_STATE\0"
+    "L1D_WB_L2_M_STATE\0"
+    "L1D_WB_L2_MESI\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "DTLB_MISSES_ANY\0"
+    "DTLB_MISSES_WALK_COMPLETED\0"
+    "DTLB_MISSES_WALK_CYCLES\0"
+    "DTLB_MISSES_STLB_HIT\0"
+    "DTLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "LOAD_HIT_PRE\0"
+    "L1D_PREFETCH_REQUESTS\0"
+    "L1D_PREFETCH_MISS\0"
+    "L1D_PREFETCH_TRIGGERS\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPL\0"
+    "PMC0|PMC1\0"
+    "L1D_M_REPL\0"
+    "L1D_M_EVICT\0"
+    "L1D_M_SNOOP_EVICT\0"
+    "L1D_CACHE_PREFETCH_LOCK_FB_HIT\0"
+    "L1D_CACHE_LOCK_FB_HIT\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_DATA\0"
+    "PMC0\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_CODE\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_EVENTS_OUTSTANDING_ANY_READ\0"
+    "CACHE_LOCK_CYCLES_L1D_L2\0"
+    "CACHE_LOCK_CYCLES_L1D\0"
+    "IO_TRANSACTIONS\0"
+    "L1I_HITS\0"
+    "L1I_MISSES\0"
+    "L1I_READS\0"
+    "L1I_CYCLES_STALLED\0"
+    "LARGE_ITLB_HIT\0"
+    "ITLB_MISSES_ANY\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_CYCLES\0"
+    "ITLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_MRU\0"
+    "ILD_STALL_IQ_FULL\0"
+    "ILD_STALL_REGEN\0"
+    "ILD_STALL_ANY\0"
+    "BR_INST_EXEC_COND\0"
+    "BR_INST_EXEC_DIRECT\0"
+    "BR_INST_EXEC_INDIRECT_NON_CALL\0"
+    "BR_INST_EXEC_NON_CALLS\0"
+    "BR_INST_EXEC_RETURN_NEAR\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_NEAR_CALLS\0"
+    "BR_INST_EXEC_TAKEN\0"
+    "BR_INST_EXEC_ANY\0"
+    "BR_MISP_EXEC_COND\0"
+    "BR_MISP_EXEC_DIRECT\0"
+    "BR_MISP_EXEC_INDIRECT_NON_CALL\0"
+    "BR_MISP_EXEC_NON_CALLS\0"
+    "BR_MISP_EXEC_RETURN_NEAR\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_NEAR_CALLS\0"
+    "BR_MISP_EXEC_TAKEN\0"
+    "BR_MISP_EXEC_ANY\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LOAD\0"
+    "RESOURCE_STALLS_RS_FULL\0"
+    "RESOURCE_STALLS_STORE\0"
+    "RESOURCE_STALLS_ROB_FULL\0"
+    "RESOURCE_STALLS_FPCW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "MACRO_INSTS_FUSIONS_DECODED\0"
+    "BACLEAR_FORCE_IQ\0"
+    "LSD_UOPS\0"
+    "LSD_CYCLES\0"
+    "ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_READ_DATA\0"
+    "OFFCORE_REQUESTS_DEMAND_READ_CODE\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ANY_READ\0"
+    "OFFCORE_REQUESTS_ANY_RFO\0"
+    "OFFCORE_REQUESTS_L1D_WRITEBACK\0"
+    "OFFCORE_REQUESTS_ANY\0"
+    "UOPS_EXECUTED_PORT0\0"
+    "UOPS_EXECUTED_PORT1\0"
+    "UOPS_EXECUTED_PORT2_CORE\0"
+    "UOPS_EXECUTED_PORT3_CORE\0"
+    "UOPS_EXECUTED_PORT4_CORE\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT_NO_PORT5\0"
+    "UOPS_EXECUTED_PORT5\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT\0"
+    "UOPS_EXECUTED_PORT015\0"
+    "UOPS_EXECUTED_PORT015_STALL_CYCLES\0"
+    "UOPS_EXECUTED_PORT234\0"
+    "OFFCORE_REQUESTS_SQ_FULL\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_DATA\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_DATA_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_INVALIDATE\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_INVALIDATE_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_CODE\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_CODE_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_CODE\0"
+    "SNOOPQ_REQUESTS_DATA\0"
+    "SNOOPQ_REQUESTS_INVALIDATE\0"
+    "SNOOP_RESPONSE_HIT\0"
+    "SNOOP_RESPONSE_HITE\0"
+    "SNOOP_RESPONSE_HITM\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_MMX\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "UOPS_RETIRED_ACTIVE_CYCLES\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_MACRO_FUSED\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEM_ORDER\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "SSEX_UOPS_RETIRED_PACKED_SINGLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_SINGLE\0"
+    "SSEX_UOPS_RETIRED_PACKED_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_VECTOR_INTEGER\0"
+    "ITLB_MISS_RETIRED\0"
+    "MEM_LOAD_RETIRED_L1D_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_UNSHARED_HIT\0"
+    "MEM_LOAD_RETIRED_OTHER_CORE_L2_HIT_HITM\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "FP_MMX_TRANS_TO_FP\0"
+    "FP_MMX_TRANS_TO_MMX\0"
+    "FP_MMX_TRANS_TO_ANY\0"
+    "MACRO_INSTS_DECODED\0"
+    "UOPS_DECODED_STALL_CYCLES\0"
+    "UOPS_DECODED_MS\0"
+    "UOPS_DECODED_ESP_FOLDING\0"
+    "UOPS_DECODED_ESP_SYNC\0"
+    "RAT_STALLS_FLAGS\0"
+    "RAT_STALLS_REGISTERS\0"
+    "RAT_STALLS_ROB_READ_PORT\0"
+    "RAT_STALLS_SCOREBOARD\0"
+    "RAT_STALLS_ANY\0"
+    "SEG_RENAME_STALLS\0"
+    "ES_SEG_RENAMES\0"
+    "UOP_UNFUSION\0"
+    "BR_INST_DECODED\0"
+    "BPU_MISSED_CALL_RET\0"
+    "BACLEAR_CLEAR\0"
+    "BACLEAR_BAD_TARGET\0"
+    "BPU_CLEARS_EARLY\0"
+    "BPU_CLEARS_LATE\0"
+    "THREAD_ACTIVE\0"
+    "L2_TRANSACTIONS_LOAD\0"
+    "L2_TRANSACTIONS_RFO\0"
+    "L2_TRANSACTIONS_IFETCH\0"
+    "L2_TRANSACTIONS_PREFETCH\0"
+    "L2_TRANSACTIONS_L1D_WB\0"
+    "L2_TRANSACTIONS_L1D_FILL\0"
+    "L2_TRANSACTIONS_WB\0"
+    "L2_TRANSACTIONS_ANY\0"
+    "L2_LINES_IN_S_STATE\0"
+    "L2_LINES_IN_E_STATE\0"
+    "L2_LINES_IN_ANY\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PREFETCH_CLEAN\0"
+    "L2_LINES_OUT_PREFETCH_DIRTY\0"
+    "L2_LINES_OUT_ANY\0"
+    "SQ_MISC_LRU_HINTS\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "SQ_FULL_STALL_CYCLES\0"
+    "FP_ASSIST_ALL\0"
+    "FP_ASSIST_OUTPUT\0"
+    "FP_ASSIST_INPUT\0"
+    "SIMD_INT_64_PACKED_MPY\0"
+    "SIMD_INT_64_PACKED_SHIFT\0"
+    "SIMD_INT_64_PACK\0"
+    "SIMD_INT_64_UNPACK\0"
+    "SIMD_INT_64_PACKED_LOGICAL\0"
+    "SIMD_INT_64_PACKED_ARITH\0"
+    "SIMD_INT_64_SHUFFLE_MOVE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_0_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_0_LOCAL_CACHE\0"
+    "OFFCORE_RESPONSE_0_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_0_REMOTE_CACHE\0"
+    "OFFCORE_RESPONSE_0_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_WB_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_0_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_0_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_0_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_0_OTHER_ANY\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_LOCAL_DRAM\0"
+    "OFFCORE_RESPONSE_1_LOCAL_CACHE\0"
+    "OFFCORE_RESPONSE_1_REMOTE_DRAM\0"
+    "OFFCORE_RESPONSE_1_REMOTE_CACHE\0"
+    "OFFCORE_RESPONSE_1_DMND_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_DMND_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_WB_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L2_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_DATA_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_RFO_ANY\0"
+    "OFFCORE_RESPONSE_1_PF_L3_CODE_RD_ANY\0"
+    "OFFCORE_RESPONSE_1_BUS_LOCKS_ANY\0"
+    "OFFCORE_RESPONSE_1_STREAMING_STORES_ANY\0"
+    "OFFCORE_RESPONSE_1_OTHER_ANY\0"
+    "UNCORE_CLOCK\0"
+    "WBOXFIX\0"
+    "C_CYCLES_TURBO_C0\0"
+    "WBOX\0"
+    "C_CYCLES_TURBO_C1\0"
+    "C_CYCLES_TURBO_C2\0"
+    "C_CYCLES_TURBO_C3\0"
+    "C_CYCLES_TURBO_C4\0"
+    "C_CYCLES_TURBO_C5\0"
+    "C_CYCLES_TURBO_C6\0"
+    "C_CYCLES_TURBO_C7\0"
+    "C_CYCLES_TURBO_C_ALL\0"
+    "C_C0_THROTTLE_DIE_C0\0"
+    "C_C0_THROTTLE_DIE_C1\0"
+    "C_C0_THROTTLE_DIE_C2\0"
+    "C_C0_THROTTLE_DIE_C3\0"
+    "C_C0_THROTTLE_DIE_C4\0"
+    "C_C0_THROTTLE_DIE_C5\0"
+    "C_C0_THROTTLE_DIE_C6\0"
+    "C_C0_THROTTLE_DIE_C7\0"
+    "C_C0_THROTTLE_DIE_C_ALL\0"
+    "C_C0_THROTTLE_PROCHOT_C0\0"
+    "C_C0_THROTTLE_PROCHOT_C1\0"
+    "C_C0_THROTTLE_PROCHOT_C2\0"
+    "C_C0_THROTTLE_PROCHOT_C3\0"
+    "C_C0_THROTTLE_PROCHOT_C4\0"
+    "C_C0_THROTTLE_PROCHOT_C5\0"
+    "C_C0_THROTTLE_PROCHOT_C6\0"
+    "C_C0_THROTTLE_PROCHOT_C7\0"
+    "C_C0_THROTTLE_PROCHOT_C_ALL\0"
+    "C_C0_THROTTLE_TMP_C0\0"
+    "C_C0_THROTTLE_TMP_C1\0"
+    "C_C0_THROTTLE_TMP_C2\0"
+    "C_C0_THROTTLE_TMP_C3\0"
+    "C_C0_THROTTLE_TMP_C4\0"
+    "C_C0_THROTTLE_TMP_C5\0"
+    "C_C0_THROTTLE_TMP_C6\0"
+    "C_C0_THROTTLE_TMP_C7\0"
+    "C_C0_THROTTLE_TMP_C_ALL\0"
+    "PROCHOT\0"
+    "RATIO_CHANGE_ABORT_C0\0"
+    "RATIO_CHANGE_ABORT_C1\0"
+    "RATIO_CHANGE_ABORT_C2\0"
+    "RATIO_CHANGE_ABORT_C3\0"
+    "RATIO_CHANGE_ABORT_C4\0"
+    "RATIO_CHANGE_ABORT_C5\0"
+    "RATIO_CHANGE_ABORT_C6\0"
+    "RATIO_CHANGE_ABORT_C7\0"
+    "RATIO_CHANGE_ABORT_C_ALL\0"
+    "TM1_ON_C0\0"
+    "TM1_ON_C1\0"
+    "TM1_ON_C2\0"
+    "TM1_ON_C3\0"
+    "TM1_ON_C4\0"
+    "TM1_ON_C5\0"
+    "TM1_ON_C6\0"
+    "TM1_ON_C7\0"
+    "TM1_ON_C_ALL\0"
+    "BBOX_CMDS_ALL\0"
+    "MBOX\0"
+    "BCMD_SCHEDQ_OCCUPANCY_READS\0"
+    "BCMD_SCHEDQ_OCCUPANCY_WRITES\0"
+    "BCMD_SCHEDQ_OCCUPANCY_MERGE\0"
+    "BCMD_SCHEDQ_OCCUPANCY_V2F\0"
+    "BCMD_SCHEDQ_OCCUPANCY_V2V\0"
+    "BCMD_SCHEDQ_OCCUPANCY_F2V\0"
+    "BCMD_SCHEDQ_OCCUPANCY_F2B\0"
+    "BCMD_SCHEDQ_OCCUPANCY_SPRWR\0"
+    "BCMD_SCHEDQ_OCCUPANCY_ALL\0"
+    "MBOX_CLOCKTICKS\0"
+    "MBOX0C0|MBOX1C0\0"
+    "CYCLES_DSP_FILL_RDQ_FULL\0"
+    "CYCLES_DSP_FILL_WRQ_FULL\0"
+    "CYCLES_DSP_FILL_RDQ_EMPTY\0"
+    "CYCLES_DSP_FILL_WRQ_EMPTY\0"
+    "CYCLES_MFULL\0"
+    "CYCLES_PGT_STATE_CLOSED\0"
+    "CYCLES_PGT_STATE_OPEN\0"
+    "CYCLES_RETRYQ_STARVED\0"
+    "CYCLES_RETRYQ_MFULL\0"
+    "CYCLES_SCHED_MODE_TRADEOFF\0"
+    "CYCLES_SCHED_MODE_RDPRIO\0"
+    "CYCLES_SCHED_MODE_WRPRIO\0"
+    "CYCLES_SCHED_MODE_ADAPTIVE\0"
+    "DRAM_CMD_ALL\0"
+    "DRAM_CMD_ILLEGAL\0"
+    "DRAM_CMD_PREALL\0"
+    "DRAM_CMD_PREALL_TRDOFF\0"
+    "DRAM_CMD_PREALL_RDPRIO\0"
+    "DRAM_CMD_PREALL_WRPRIO\0"
+    "DRAM_CMD_PREALL_ADAPTIVE\0"
+    "DRAM_CMD_RAS\0"
+    "DRAM_CMD_RAS_TRDOFF\0"
+    "DRAM_CMD_RAS_RDPRIO\0"
+    "DRAM_CMD_RAS_WRPRIO\0"
+    "DRAM_CMD_RAS_ADAPTIVE\0"
+    "DRAM_CMD_CAS_RD_OPN\0"
+    "DRAM_CMD_CAS_WR_OPN\0"
+    "DRAM_CMD_CAS_WR_OPN_TRDOFF\0"
+    "DRAM_CMD_CAS_WR_OPN_RDPRIO\0"
+    "DRAM_CMD_CAS_WR_OPN_WRPRIO\0"
+    "DRAM_CMD_CAS_WR_OPN_ADAPTIVE\0"
+    "DRAM_CMD_CAS_RD_CLS\0"
+    "DRAM_CMD_CAS_RD_CLS_TRDOFF\0"
+    "DRAM_CMD_CAS_RD_CLS_RDPRIO\0"
+    "DRAM_CMD_CAS_RD_CLS_WRPRIO\0"
+    "DRAM_CMD_CAS_RD_CLS_ADAPTIVE\0"
+    "DRAM_CMD_CAS_WR_CLS\0"
+    "DRAM_CMD_CAS_WR_CLS_TRDOFF\0"
+    "DRAM_CMD_CAS_WR_CLS_RDPRIO\0"
+    "DRAM_CMD_CAS_WR_CLS_WRPRIO\0"
+    "DRAM_CMD_CAS_WR_CLS_ADAPTIVE\0"
+    "DRAM_CMD_MRS\0"
+    "DRAM_CMD_RFR\0"
+    "DRAM_CMD_ENSR\0"
+    "DRAM_CMD_EXSR\0"
+    "DRAM_CMD_NOP\0"
+    "DRAM_CMD_TRKL\0"
+    "DRAM_CMD_PRE\0"
+    "DRAM_CMD_SYNC\0"
+    "DRAM_CMD_CKE_HI\0"
+    "DRAM_CMD_CKE_LO\0"
+    "DRAM_CMD_SOFT_RST\0"
+    "DRAM_CMD_WR_CFG\0"
+    "DRAM_CMD_RD_CFG\0"
+    "DRAM_CMD_ZQCAL\0"
+    "DRAM_CMD_ALL_TRDOFF\0"
+    "DRAM_CMD_ALL_RDPRIO\0"
+    "DRAM_CMD_ALL_WRPRIO\0"
+    "DRAM_CMD_ALL_ADAPTIVE\0"
+    "DSP_FILL_RDQ_FULL\0"
+    "DSP_FILL_WRQ_FULL\0"
+    "DSP_FILL_RDQ_EMPTY\0"
+    "DSP_FILL_WRQ_EMPTY\0"
+    "DRAM_MISC_RETRIES_ALL\0"
+    "DRAM_MISC_RETRIES_FVID\0"
+    "DRAM_MISC_VALID\0"
+    "DRAM_MISC_NON_NOP_TRKL\0"
+    "DRAM_MISC_ILLEGAL\0"
+    "DRAM_MISC_PREALL\0"
+    "DRAM_MISC_RAS\0"
+    "DRAM_MISC_CAS_RD_OPN\0"
+    "DRAM_MISC_CAS_WR_OPN\0"
+    "DRAM_MISC_CAS_RD_CLS\0"
+    "DRAM_MISC_CAS_WR_CLS\0"
+    "DRAM_MISC_MRS\0"
+    "DRAM_MISC_RFR\0"
+    "DRAM_MISC_ENSR\0"
+    "DRAM_MISC_EXSR\0"
+    "DRAM_MISC_NOP\0"
+    "DRAM_MISC_TRKL\0"
+    "DRAM_MISC_PRE\0"
+    "DRAM_MISC_SYNC\0"
+    "DRAM_MISC_CKE_HI\0"
+    "DRAM_MISC_CKE_LO\0"
+    "DRAM_MISC_SOFT_RST\0"
+    "DRAM_MISC_WR_CFG\0"
+    "DRAM_MISC_RD_CFG\0"
+    "DRAM_MISC_ZQCAL\0"
+    "FRM_TYPE_3CMD\0"
+    "FRM_TYPE_WDAT\0"
+    "FRM_TYPE_SYNC\0"
+    "FRM_TYPE_CHNL\0"
+    "FRM_TYPE_NOP\0"
+    "FRM_TYPE_1CMD\0"
+    "FVC_EV0_SMI_CRC_ERR\0"
+    "FVC_EV0_MEM_ECC_ERR\0"
+    "FVC_EV0_POISON_TXN\0"
+    "FVC_EV0_ALERT_FRAMES\0"
+    "FVC_EV0_FAST_RESET\0"
+    "FVC_EV0_BBOX_CMDS_READS\0"
+    "FVC_EV0_BBOX_CMDS_WRITES\0"
+    "FVC_EV0_BBOX_RSP_ACK\0"
+    "FVC_EV0_BBOX_RSP_RETRY\0"
+    "FVC_EV0_BBOX_RSP_COR\0"
+    "FVC_EV0_BBOX_RSP_UNCOR\0"
+    "FVC_EV0_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV0_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV0_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV0_SMI_NB_TRIG\0"
+    "FVC_EV1_SMI_CRC_ERR\0"
+    "FVC_EV1_MEM_ECC_ERR\0"
+    "FVC_EV1_POISON_TXN\0"
+    "FVC_EV1_ALERT_FRAMES\0"
+    "FVC_EV1_FAST_RESET\0"
+    "FVC_EV1_BBOX_CMDS_READS\0"
+    "FVC_EV1_BBOX_CMDS_WRITES\0"
+    "FVC_EV1_BBOX_RSP_ACK\0"
+    "FVC_EV1_BBOX_RSP_RETRY\0"
+    "FVC_EV1_BBOX_RSP_COR\0"
+    "FVC_EV1_BBOX_RSP_UNCOR\0"
+    "FVC_EV1_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV1_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV1_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV1_SMI_NB_TRIG\0"
+    "FVC_EV2_SMI_CRC_ERR\0"
+    "FVC_EV2_MEM_ECC_ERR\0"
+    "FVC_EV2_POISON_TXN\0"
+    "FVC_EV2_ALERT_FRAMES\0"
+    "FVC_EV2_FAST_RESET\0"
+    "FVC_EV2_BBOX_CMDS_READS\0"
+    "FVC_EV2_BBOX_CMDS_WRITES\0"
+    "FVC_EV2_BBOX_RSP_ACK\0"
+    "FVC_EV2_BBOX_RSP_RETRY\0"
+    "FVC_EV2_BBOX_RSP_COR\0"
+    "FVC_EV2_BBOX_RSP_UNCOR\0"
+    "FVC_EV2_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV2_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV2_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV2_SMI_NB_TRIG\0"
+    "FVC_EV3_SMI_CRC_ERR\0"
+    "FVC_EV3_MEM_ECC_ERR\0"
+    "FVC_EV3_POISON_TXN\0"
+    "FVC_EV3_ALERT_FRAMES\0"
+    "FVC_EV3_FAST_RESET\0"
+    "FVC_EV3_BBOX_CMDS_READS\0"
+    "FVC_EV3_BBOX_CMDS_WRITES\0"
+    "FVC_EV3_BBOX_RSP_ACK\0"
+    "FVC_EV3_BBOX_RSP_RETRY\0"
+    "FVC_EV3_BBOX_RSP_COR\0"
+    "FVC_EV3_BBOX_RSP_UNCOR\0"
+    "FVC_EV3_BBOX_RSP_SPEC_ACK\0"
+    "FVC_EV3_BBOX_RSP_SPR_ACK\0"
+    "FVC_EV3_BBOX_RSP_SPR_UNCORE\0"
+    "FVC_EV3_SMI_NB_TRIG\0"
+    "FVID_RACE\0"
+    "INFLIGHT_CMDS\0"
+    "ISS_SCHED_CHANGES\0"
+    "ISS_SCHED_FRAME_BEAT\0"
+    "MA_PAR_ERR\0"
+    "MULTICAS\0"
+    "PAGE_HIT\0"
+    "PAGE_MISS\0"
+    "PATROL_TXNS\0"
+    "PGT_PAGE_EV_OPN2CLS\0"
+    "PGT_PAGE_EV_CLS2OPN\0"
+    "PGT_PAGE_EV2_AUTO_CLS\0"
+    "PGT_PAGE_EV2_PAGE_EMPTY\0"
+    "REFRESH\0"
+    "REFRESH_CONFLICT\0"
+    "RETRY_MFULL\0"
+    "RETRY_STARVE\0"
+    "SCHED_INFLIGHT_CMDS\0"
+    "THERM_TRP_DN_ALL_GT_MID_RISE\0"
+    "THERM_TRP_DN_ALL_GT_MID_FALL\0"
+    "THERM_TRP_DN_ALL_GT_LO\0"
+    "THERM_TRP_DN_ALL_LT_LO\0"
+    "THERM_TRP_DN_DIMM0_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM1_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM2_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM3_GT_MID_RISE\0"
+    "THERM_TRP_DN_DIMM0_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM1_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM2_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM3_GT_MID_FALL\0"
+    "THERM_TRP_DN_DIMM0_GT_LO\0"
+    "THERM_TRP_DN_DIMM1_GT_LO\0"
+    "THERM_TRP_DN_DIMM2_GT_LO\0"
+    "THERM_TRP_DN_DIMM3_GT_LO\0"
+    "THERM_TRP_DN_DIMM0_LT_LO\0"
+    "THERM_TRP_DN_DIMM1_LT_LO\0"
+    "THERM_TRP_DN_DIMM2_LT_LO\0"
+    "THERM_TRP_DN_DIMM3_LT_LO\0"
+    "THERM_TRP_UP_ALL_GT_MID_RISE\0"
+    "THERM_TRP_UP_ALL_GT_MID_FALL\0"
+    "THERM_TRP_UP_ALL_GT_LO\0"
+    "THERM_TRP_UP_ALL_LT_LO\0"
+    "THERM_TRP_UP_DIMM0_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM1_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM2_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM3_GT_MID_RISE\0"
+    "THERM_TRP_UP_DIMM0_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM1_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM2_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM3_GT_MID_FALL\0"
+    "THERM_TRP_UP_DIMM0_GT_LO\0"
+    "THERM_TRP_UP_DIMM1_GT_LO\0"
+    "THERM_TRP_UP_DIMM2_GT_LO\0"
+    "THERM_TRP_UP_DIMM3_GT_LO\0"
+    "THERM_TRP_UP_DIMM0_LT_LO\0"
+    "THERM_TRP_UP_DIMM1_LT_LO\0"
+    "THERM_TRP_UP_DIMM2_LT_LO\0"
+    "THERM_TRP_UP_DIMM3_LT_LO\0"
+    "TRANS_CMDS\0"
+    "TT_CMD_CONFLICT\0"
+    "ACK_BEFORE_LAST_SNP\0"
+    "BBOX0C3|BBOX1C3\0"
+    "CONFLICTS\0"
+    "COHQ_BYPASS\0"
+    "COHQ_IMT_ALLOC_WAIT\0"
+    "DIRQ_INSERTS\0"
+    "BBOX0C1|BBOX1C1\0"
+    "DIRQ_OCCUPANCY\0"
+    "BBOX0C0|BBOX1C0\0"
+    "DEMAND_FETCH\0"
+    "DRSQ_INSERTS\0"
+    "DRSQ_OCCUPANCY\0"
+    "EARLY_ACK\0"
+    "IMPLICIT_WBS\0"
+    "IMT_FULL\0"
+    "IMT_INSERTS_ALL\0"
+    "IMT_INSERTS_INVITOE\0"
+    "IMT_INSERTS_IOH\0"
+    "IMT_INSERTS_IOH_INVITOE\0"
+    "IMT_INSERTS_IOH_WR\0"
+    "IMT_INSERTS_NON_IOH\0"
+    "IMT_INSERTS_NON_IOH_INVITOE\0"
+    "IMT_INSERTS_NON_IOH_RD\0"
+    "IMT_INSERTS_NON_IOH_WR\0"
+    "IMT_INSERTS_RD\0"
+    "IMT_INSERTS_WR\0"
+    "IMT_NE_CYCLES\0"
+    "BBOX0C2|BBOX1C2\0"
+    "IMT_PREALLOC\0"
+    "IMT_VALID_OCCUPANCY\0"
+    "MSGS_B_TO_S\0"
+    "MSGS_S_TO_B\0"
+    "MSGS_IN_NON_SNP\0"
+    "MSG_IN_MATCH\0"
+    "MSG_ADDR_IN_MATCH\0"
+    "MSG_OPCODE_ADDR_IN_MATCH\0"
+    "MSG_OPCODE_IN_MATCH\0"
+    "MSG_OPCODE_OUT_MATCH\0"
+    "MSG_OUT_MATCH\0"
+    "OPCODE_ADDR_IN_MATCH\0"
+    "OPCODE_IN_MATCH\0"
+    "OPCODE_OUT_MATCH\0"
+    "ADDR_IN_MATCH\0"
+    "RBOX_VNA_UNAVAIL\0"
+    "SBOX_VN0_UNAVAIL\0"
+    "SNPOQ_INSERTS\0"
+    "SNPOQ_OCCUPANCY\0"
+    "TF_ALL\0"
+    "TF_INVITOE\0"
+    "TF_IOH\0"
+    "TF_IOH_INVITOE\0"
+    "TF_IOH_NON_INVITOE_RD\0"
+    "TF_IOH_WR\0"
+    "TF_WR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NCB\0"
+    "RBOX0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT0_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT0_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT1_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT1_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT2_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT2_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT3_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT3_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NCB\0"
+    "RBOX1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT4_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT5_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT5_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT6_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT6_IPERF1_ALL\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NCB\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NCS\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_NDR\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_SNP\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT7_IPERF0_ALL\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NCB\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NCS\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_DRS_VN01\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_NDR\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_SNP\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_HOM_VN0\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_HOM_VN1\0"
+    "ALLOC_TO_ARB_PORT7_IPERF1_ALL\0"
+    "EOT_INSERTS_PORT0_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT0_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT0_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT0_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT0_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT0_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT0_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT0_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT0_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT0_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT0_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT1_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT1_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT1_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT1_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT1_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT1_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT1_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT1_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT1_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT1_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT2_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT2_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT2_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT2_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT2_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT2_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT2_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT2_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT2_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT2_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT3_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT3_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT3_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT3_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT3_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT3_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT3_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT3_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT3_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT3_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT4_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT4_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT4_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT4_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT4_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT4_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT4_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT4_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT4_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT4_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT5_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT5_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT5_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT5_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT5_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT5_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT5_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT5_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT5_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT5_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT6_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT6_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT6_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT6_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT6_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT6_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT6_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT6_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT6_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT6_IPERF1_DRS_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF0_HOM_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF0_HOM_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF0_NDR\0"
+    "EOT_INSERTS_PORT7_IPERF0_DRS_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF0_SNP\0"
+    "EOT_INSERTS_PORT7_IPERF0_NCB\0"
+    "EOT_INSERTS_PORT7_IPERF0_NCS\0"
+    "EOT_INSERTS_PORT7_IPERF0_DRS_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF1_HOM_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF1_HOM_VN1\0"
+    "EOT_INSERTS_PORT7_IPERF1_NDR\0"
+    "EOT_INSERTS_PORT7_IPERF1_DRS_VN0\0"
+    "EOT_INSERTS_PORT7_IPERF1_SNP\0"
+    "EOT_INSERTS_PORT7_IPERF1_NCB\0"
+    "EOT_INSERTS_PORT7_IPERF1_NCS\0"
+    "EOT_INSERTS_PORT7_IPERF1_DRS_VN1\0"
+    "EOT_NE_CYCLES_PORT0_IPERF0\0"
+    "EOT_NE_CYCLES_PORT0_IPERF1\0"
+    "EOT_NE_CYCLES_PORT1_IPERF0\0"
+    "EOT_NE_CYCLES_PORT1_IPERF1\0"
+    "EOT_NE_CYCLES_PORT2_IPERF0\0"
+    "EOT_NE_CYCLES_PORT2_IPERF1\0"
+    "EOT_NE_CYCLES_PORT3_IPERF0\0"
+    "EOT_NE_CYCLES_PORT3_IPERF1\0"
+    "EOT_NE_CYCLES_PORT4_IPERF0\0"
+    "EOT_NE_CYCLES_PORT4_IPERF1\0"
+    "EOT_NE_CYCLES_PORT5_IPERF0\0"
+    "EOT_NE_CYCLES_PORT5_IPERF1\0"
+    "EOT_NE_CYCLES_PORT6_IPERF0\0"
+    "EOT_NE_CYCLES_PORT6_IPERF1\0"
+    "EOT_NE_CYCLES_PORT7_IPERF0\0"
+    "EOT_NE_CYCLES_PORT7_IPERF1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT0_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT0_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT1_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT1_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT2_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT2_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT3_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT3_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT4_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT4_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT5_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT5_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT6_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT6_IPERF1_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NDR\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_SNP\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NCB\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_NCS\0"
+    "EOT_OCCUPANCY_PORT7_IPERF0_DRS_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_HOM_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_HOM_VN1\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NDR\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_DRS_VN0\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_SNP\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NCB\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_NCS\0"
+    "EOT_OCCUPANCY_PORT7_IPERF1_DRS_VN1\0"
+    "FLITS_RECV_ERR_PORT0_IPERF0\0"
+    "FLITS_RECV_ERR_PORT0_IPERF1\0"
+    "FLITS_RECV_ERR_PORT1_IPERF0\0"
+    "FLITS_RECV_ERR_PORT1_IPERF1\0"
+    "FLITS_RECV_ERR_PORT2_IPERF0\0"
+    "FLITS_RECV_ERR_PORT2_IPERF1\0"
+    "FLITS_RECV_ERR_PORT3_IPERF0\0"
+    "FLITS_RECV_ERR_PORT3_IPERF1\0"
+    "FLITS_RECV_ERR_PORT4_IPERF0\0"
+    "FLITS_RECV_ERR_PORT4_IPERF1\0"
+    "FLITS_RECV_ERR_PORT5_IPERF0\0"
+    "FLITS_RECV_ERR_PORT5_IPERF1\0"
+    "FLITS_RECV_ERR_PORT6_IPERF0\0"
+    "FLITS_RECV_ERR_PORT6_IPERF1\0"
+    "FLITS_RECV_ERR_PORT7_IPERF0\0"
+    "FLITS_RECV_ERR_PORT7_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT0_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT0_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT1_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT1_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT2_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT2_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT3_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT3_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT4_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT4_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT5_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT5_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT6_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT6_IPERF1\0"
+    "FLITS_RECV_SPEC_PORT7_IPERF0\0"
+    "FLITS_RECV_SPEC_PORT7_IPERF1\0"
+    "FLITS_SENT_PORT0_IPERF0\0"
+    "FLITS_SENT_PORT0_IPERF1\0"
+    "FLITS_SENT_PORT1_IPERF0\0"
+    "FLITS_SENT_PORT1_IPERF1\0"
+    "FLITS_SENT_PORT2_IPERF0\0"
+    "FLITS_SENT_PORT2_IPERF1\0"
+    "FLITS_SENT_PORT3_IPERF0\0"
+    "FLITS_SENT_PORT3_IPERF1\0"
+    "FLITS_SENT_PORT4_IPERF0\0"
+    "FLITS_SENT_PORT4_IPERF1\0"
+    "FLITS_SENT_PORT5_IPERF0\0"
+    "FLITS_SENT_PORT5_IPERF1\0"
+    "FLITS_SENT_PORT6_IPERF0\0"
+    "FLITS_SENT_PORT6_IPERF1\0"
+    "FLITS_SENT_PORT7_IPERF0\0"
+    "FLITS_SENT_PORT7_IPERF1\0"
+    "GLOBAL_ARB_BID_PORT0_QLX0\0"
+    "GLOBAL_ARB_BID_PORT0_QLX1\0"
+    "GLOBAL_ARB_BID_PORT1_QLX0\0"
+    "GLOBAL_ARB_BID_PORT1_QLX1\0"
+    "GLOBAL_ARB_BID_PORT2_QLX0\0"
+    "GLOBAL_ARB_BID_PORT2_QLX1\0"
+    "GLOBAL_ARB_BID_PORT3_QLX0\0"
+    "GLOBAL_ARB_BID_PORT3_QLX1\0"
+    "GLOBAL_ARB_BID_PORT4_QLX0\0"
+    "GLOBAL_ARB_BID_PORT4_QLX1\0"
+    "GLOBAL_ARB_BID_PORT5_QLX0\0"
+    "GLOBAL_ARB_BID_PORT5_QLX1\0"
+    "GLOBAL_ARB_BID_PORT6_QLX0\0"
+    "GLOBAL_ARB_BID_PORT6_QLX1\0"
+    "GLOBAL_ARB_BID_PORT7_QLX0\0"
+    "GLOBAL_ARB_BID_PORT7_QLX1\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT0_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT1_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT2_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT3_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT4_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT5_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT6_QLX1_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX0_VN1_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN0_NCB\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_HOM\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_SNP\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NDR\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NCS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_DRS\0"
+    "GLOBAL_ARB_BID_FAIL_PORT7_QLX1_VN1_NCB\0"
+    "INQUE_READ_WIN_PORT0_IPERF0\0"
+    "INQUE_READ_WIN_PORT0_IPERF1\0"
+    "INQUE_READ_WIN_PORT1_IPERF0\0"
+    "INQUE_READ_WIN_PORT1_IPERF1\0"
+    "INQUE_READ_WIN_PORT2_IPERF0\0"
+    "INQUE_READ_WIN_PORT2_IPERF1\0"
+    "INQUE_READ_WIN_PORT3_IPERF0\0"
+    "INQUE_READ_WIN_PORT3_IPERF1\0"
+    "INQUE_READ_WIN_PORT4_IPERF0\0"
+    "INQUE_READ_WIN_PORT4_IPERF1\0"
+    "INQUE_READ_WIN_PORT5_IPERF0\0"
+    "INQUE_READ_WIN_PORT5_IPERF1\0"
+    "INQUE_READ_WIN_PORT6_IPERF0\0"
+    "INQUE_READ_WIN_PORT6_IPERF1\0"
+    "INQUE_READ_WIN_PORT7_IPERF0\0"
+    "INQUE_READ_WIN_PORT7_IPERF1\0"
+    "LOCAL_ARB_BID_PORT0_QLX0\0"
+    "LOCAL_ARB_BID_PORT0_QLX1\0"
+    "LOCAL_ARB_BID_PORT1_QLX0\0"
+    "LOCAL_ARB_BID_PORT1_QLX1\0"
+    "LOCAL_ARB_BID_PORT2_QLX0\0"
+    "LOCAL_ARB_BID_PORT2_QLX1\0"
+    "LOCAL_ARB_BID_PORT3_QLX0\0"
+    "LOCAL_ARB_BID_PORT3_QLX1\0"
+    "LOCAL_ARB_BID_PORT4_QLX0\0"
+    "LOCAL_ARB_BID_PORT4_QLX1\0"
+    "LOCAL_ARB_BID_PORT5_QLX0\0"
+    "LOCAL_ARB_BID_PORT5_QLX1\0"
+    "LOCAL_ARB_BID_PORT6_QLX0\0"
+    "LOCAL_ARB_BID_PORT6_QLX1\0"
+    "LOCAL_ARB_BID_PORT7_QLX0\0"
+    "LOCAL_ARB_BID_PORT7_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT0_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT0_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT1_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT1_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT2_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT2_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT3_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT3_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT4_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT4_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT5_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT5_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT6_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT6_QLX1\0"
+    "LOCAL_ARB_BID_FAIL_PORT7_QLX0\0"
+    "LOCAL_ARB_BID_FAIL_PORT7_QLX1\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT0_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT1_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT2_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT3_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT4_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT5_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT6_IPERF1_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF0_ANY_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN0_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VN1_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_VNA_ALL\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NCB\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NCS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_DRS\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_NDR\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_SNP\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_HOM\0"
+    "NEW_PACKETS_RECV_PORT8_IPERF1_ANY_ALL\0"
+    "NULL_IDLE_PORT0_IPERF0\0"
+    "NULL_IDLE_PORT0_IPERF1\0"
+    "NULL_IDLE_PORT1_IPERF0\0"
+    "NULL_IDLE_PORT1_IPERF1\0"
+    "NULL_IDLE_PORT2_IPERF0\0"
+    "NULL_IDLE_PORT2_IPERF1\0"
+    "NULL_IDLE_PORT3_IPERF0\0"
+    "NULL_IDLE_PORT3_IPERF1\0"
+    "NULL_IDLE_PORT4_IPERF0\0"
+    "NULL_IDLE_PORT4_IPERF1\0"
+    "NULL_IDLE_PORT5_IPERF0\0"
+    "NULL_IDLE_PORT5_IPERF1\0"
+    "NULL_IDLE_PORT6_IPERF0\0"
+    "NULL_IDLE_PORT6_IPERF1\0"
+    "NULL_IDLE_PORT7_IPERF0\0"
+    "NULL_IDLE_PORT7_IPERF1\0"
+    "OUTPUTQ_NE_PORT0_IPERF0\0"
+    "OUTPUTQ_NE_PORT0_IPERF1\0"
+    "OUTPUTQ_NE_PORT1_IPERF0\0"
+    "OUTPUTQ_NE_PORT1_IPERF1\0"
+    "OUTPUTQ_NE_PORT2_IPERF0\0"
+    "OUTPUTQ_NE_PORT2_IPERF1\0"
+    "OUTPUTQ_NE_PORT3_IPERF0\0"
+    "OUTPUTQ_NE_PORT3_IPERF1\0"
+    "OUTPUTQ_NE_PORT4_IPERF0\0"
+    "OUTPUTQ_NE_PORT4_IPERF1\0"
+    "OUTPUTQ_NE_PORT5_IPERF0\0"
+    "OUTPUTQ_NE_PORT5_IPERF1\0"
+    "OUTPUTQ_NE_PORT6_IPERF0\0"
+    "OUTPUTQ_NE_PORT6_IPERF1\0"
+    "OUTPUTQ_NE_PORT7_IPERF0\0"
+    "OUTPUTQ_NE_PORT7_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT0_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT0_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT1_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT1_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT2_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT2_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT3_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT3_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT4_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT4_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT5_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT5_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT6_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT6_IPERF1\0"
+    "OUTPUTQ_OVFL_PORT7_IPERF0\0"
+    "OUTPUTQ_OVFL_PORT7_IPERF1\0"
+    "QUE_ARB_BID_PORT0_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT0_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT0_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT0_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT0_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT0_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT0_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT0_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT0_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT0_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT0_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT0_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT1_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT1_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT1_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT1_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT1_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT1_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT1_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT1_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT1_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT1_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT1_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT1_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT2_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT2_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT2_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT2_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT2_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT2_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT2_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT2_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT2_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT2_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT2_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT2_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT3_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT3_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT3_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT3_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT3_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT3_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT3_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT3_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT3_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT3_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT3_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT3_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT4_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT4_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT4_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT4_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT4_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT4_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT4_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT4_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT4_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT4_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT4_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT4_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT5_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT5_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT5_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT5_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT5_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT5_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT5_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT5_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT5_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT5_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT5_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT5_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT6_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT6_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT6_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT6_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT6_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT6_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT6_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT6_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT6_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT6_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT6_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT6_QLX1_NCB\0"
+    "QUE_ARB_BID_PORT7_QLX0_HOM\0"
+    "QUE_ARB_BID_PORT7_QLX0_SNP\0"
+    "QUE_ARB_BID_PORT7_QLX0_NDR\0"
+    "QUE_ARB_BID_PORT7_QLX0_NCS\0"
+    "QUE_ARB_BID_PORT7_QLX0_DRS\0"
+    "QUE_ARB_BID_PORT7_QLX0_NCB\0"
+    "QUE_ARB_BID_PORT7_QLX1_HOM\0"
+    "QUE_ARB_BID_PORT7_QLX1_SNP\0"
+    "QUE_ARB_BID_PORT7_QLX1_NDR\0"
+    "QUE_ARB_BID_PORT7_QLX1_NCS\0"
+    "QUE_ARB_BID_PORT7_QLX1_DRS\0"
+    "QUE_ARB_BID_PORT7_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT0_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT1_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT2_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT3_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT4_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT5_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT6_QLX1_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX0_NCB\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_HOM\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_SNP\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NDR\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NCS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_DRS\0"
+    "QUE_ARB_BID_FAIL_PORT7_QLX1_NCB\0"
+    "RETRYQ_NE_PORT0_IPERF0\0"
+    "RETRYQ_NE_PORT0_IPERF1\0"
+    "RETRYQ_NE_PORT1_IPERF0\0"
+    "RETRYQ_NE_PORT1_IPERF1\0"
+    "RETRYQ_NE_PORT2_IPERF0\0"
+    "RETRYQ_NE_PORT2_IPERF1\0"
+    "RETRYQ_NE_PORT3_IPERF0\0"
+    "RETRYQ_NE_PORT3_IPERF1\0"
+    "RETRYQ_NE_PORT4_IPERF0\0"
+    "RETRYQ_NE_PORT4_IPERF1\0"
+    "RETRYQ_NE_PORT5_IPERF0\0"
+    "RETRYQ_NE_PORT5_IPERF1\0"
+    "RETRYQ_NE_PORT6_IPERF0\0"
+    "RETRYQ_NE_PORT6_IPERF1\0"
+    "RETRYQ_NE_PORT7_IPERF0\0"
+    "RETRYQ_NE_PORT7_IPERF1\0"
+    "RETRYQ_OV_PORT0_IPERF0\0"
+    "RETRYQ_OV_PORT0_IPERF1\0"
+    "RETRYQ_OV_PORT1_IPERF0\0"
+    "RETRYQ_OV_PORT1_IPERF1\0"
+    "RETRYQ_OV_PORT2_IPERF0\0"
+    "RETRYQ_OV_PORT2_IPERF1\0"
+    "RETRYQ_OV_PORT3_IPERF0\0"
+    "RETRYQ_OV_PORT3_IPERF1\0"
+    "RETRYQ_OV_PORT4_IPERF0\0"
+    "RETRYQ_OV_PORT4_IPERF1\0"
+    "RETRYQ_OV_PORT5_IPERF0\0"
+    "RETRYQ_OV_PORT5_IPERF1\0"
+    "RETRYQ_OV_PORT6_IPERF0\0"
+    "RETRYQ_OV_PORT6_IPERF1\0"
+    "RETRYQ_OV_PORT7_IPERF0\0"
+    "RETRYQ_OV_PORT7_IPERF1\0"
+    "STARVING_PORT0_QLX0\0"
+    "STARVING_PORT0_QLX1\0"
+    "STARVING_PORT1_QLX0\0"
+    "STARVING_PORT1_QLX1\0"
+    "STARVING_PORT2_QLX0\0"
+    "STARVING_PORT2_QLX1\0"
+    "STARVING_PORT3_QLX0\0"
+    "STARVING_PORT3_QLX1\0"
+    "STARVING_PORT4_QLX0\0"
+    "STARVING_PORT4_QLX1\0"
+    "STARVING_PORT5_QLX0\0"
+    "STARVING_PORT5_QLX1\0"
+    "STARVING_PORT6_QLX0\0"
+    "STARVING_PORT6_QLX1\0"
+    "STARVING_PORT7_QLX0\0"
+    "STARVING_PORT7_QLX1\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT0_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT1_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT2_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT3_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT4_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT5_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT6_QLX1_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX0_VN1_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN0_VLG\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_HOM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_SNP\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NDR\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NCS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_DRS\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_NCB\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_VSM\0"
+    "TARGET_AVAILABLE_PORT7_QLX1_VN1_VLG\0"
+    "BUF_VALID_LOCAL_INT\0"
+    "UBOX\0"
+    "BUF_VALID_REMOTE_INT\0"
+    "BUF_VALID_LOCK\0"
+    "BUF_VALID_STST\0"
+    "BUF_VALID_SPC_CYCLES\0"
+    "BUF_VALID_DOOR_BELL\0"
+    "BUF_VALID_PM_IN\0"
+    "BUF_VALID_PM_OUT\0"
+    "U2R_REQUESTS\0"
+    "U2R_REQUEST_CYCLES\0"
+    "WOKEN\0"
+    "IPIS_SENT\0"
+    "RECOV\0"
+    "CORRECTED_ERR\0"
+    "UNCORRECTED_ERR\0"
+    "LLC_MISSES_SHARED\0"
+    "CBOX\0"
+    "LLC_MISSES_FORWARD\0"
+    "LLC_MISSES_INVALID\0"
+    "LLC_MISSES_ALL\0"
+    "LLC_HITS_MODIFIED\0"
+    "LLC_HITS_EXCLUSIVE\0"
+    "LLC_HITS_SHARED\0"
+    "LLC_HITS_FORWARD\0"
+    "LLC_HITS_ALL\0"
+    "LLC_S_FILLS_MODIFIED\0"
+    "LLC_S_FILLS_EXCLUSIVE\0"
+    "LLC_S_FILLS_SHARED\0"
+    "LLC_S_FILLS_FORWARD\0"
+    "LLC_S_FILLS_ALL\0"
+    "LLC_VICTIMS_MODIFIED\0"
+    "LLC_VICTIMS_EXCLUSIVE\0"
+    "LLC_VICTIMS_SHARED\0"
+    "LLC_VICTIMS_FORWARD\0"
+    "LLC_VICTIMS_ALL\0"
+    "LLC_VICTIMS_FILL_WITHOUT_VICTIMS\0"
+    "ARB_LOSSES_AD_SB\0"
+    "ARB_LOSSES_AD_NSB\0"
+    "ARB_LOSSES_AD_ALL\0"
+    "ARB_LOSSES_AK_SB\0"
+    "ARB_LOSSES_AK_NSB\0"
+    "ARB_LOSSES_AK_ALL\0"
+    "ARB_LOSSES_BL_SB\0"
+    "ARB_LOSSES_BL_NSB\0"
+    "ARB_LOSSES_BL_ALL\0"
+    "ARB_LOSSES_IV\0"
+    "ARB_LOSSES_ALL\0"
+    "ARB_WINS_AD_SB\0"
+    "ARB_WINS_AD_NSB\0"
+    "ARB_WINS_AD_ALL\0"
+    "ARB_WINS_AK_SB\0"
+    "ARB_WINS_AK_NSB\0"
+    "ARB_WINS_AK_ALL\0"
+    "ARB_WINS_BL_SB\0"
+    "ARB_WINS_BL_NSB\0"
+    "ARB_WINS_BL_ALL\0"
+    "ARB_WINS_IV\0"
+    "ARB_WINS_ALL\0"
+    "ARB_WINS_P2C_NSB\0"
+    "ARB_WINS_P2C_SB\0"
+    "BOUNCE_ASSERT\0"
+    "BOUNCE_DEASSERT\0"
+    "BOUNCES_C2P_AK_SB\0"
+    "BOUNCES_C2P_AK_NSB\0"
+    "BOUNCES_C2P_AK_ALL\0"
+    "BOUNCES_C2P_BL_SB\0"
+    "BOUNCES_C2P_BL_NSB\0"
+    "BOUNCES_C2P_BL_ALL\0"
+    "BOUNCES_C2P_AD_SB\0"
+    "BOUNCES_C2P_AD_NSB\0"
+    "BOUNCES_C2P_AD_ALL\0"
+    "BOUNCES_C2P_IV\0"
+    "EGRESS_BYPASS_WINS_AD_BYP0\0"
+    "EGRESS_BYPASS_WINS_AD_BYP1\0"
+    "EGRESS_BYPASS_WINS_AK_BYP0\0"
+    "EGRESS_BYPASS_WINS_AK_BYP1\0"
+    "EGRESS_BYPASS_WINS_BL_BYP0\0"
+    "EGRESS_BYPASS_WINS_BL_BYP1\0"
+    "EGRESS_BYPASS_WINS_IV_BYP0\0"
+    "EGRESS_BYPASS_WINS_IV_BYP1\0"
+    "INGRESS_BYPASS_WINS_AD_IRQ_BYP0\0"
+    "INGRESS_BYPASS_WINS_AD_IRQ_BYP1\0"
+    "INGRESS_BYPASS_WINS_AD_IPQ_BYP0\0"
+    "INGRESS_BYPASS_WINS_AD_IPQ_BYP1\0"
+    "IDF_NONZERO_NO_BL_CRD\0"
+    "IDF_NONZERO_NO_VLD\0"
+    "IGR_BID_BLOCKED\0"
+    "IGR_OP_SRAM\0"
+    "IGR_OP_UC\0"
+    "MAF_ACK\0"
+    "MAF_NACK1_GO_PENDING\0"
+    "MAF_NACK1_VIC_PENDING\0"
+    "MAF_NACK1_SNP_PENDING\0"
+    "MAF_NACK1_AC_PENDING\0"
+    "MAF_NACK1_IDX_BLOCK\0"
+    "MAF_NACK1_PA_BLOCK\0"
+    "MAF_NACK1_IDLE_QPI\0"
+    "MAF_NACK1_ALL_MAF_NACK1\0"
+    "MAF_NACK1_TOTAL_MAF_NACKS\0"
+    "MAF_NACK2_MAF_FULL\0"
+    "MAF_NACK2_EGRESS_FULL\0"
+    "MAF_NACK2_VIQ_FULL\0"
+    "MAF_NACK2_NO_TRACKER_CREDITS\0"
+    "MAF_NACK2_NO_S_FIFO_CREDITS\0"
+    "MAF_NACK2_NO_S_REQTBL_ENTRIES\0"
+    "MAF_NACK2_WB_PENDING\0"
+    "MAF_NACK2_NACK2_ELSE\0"
+    "OCCUPANCY_IPQ\0"
+    "OCCUPANCY_IRQ\0"
+    "OCCUPANCY_MAF\0"
+    "OCCUPANCY_RSPF\0"
+    "OCCUPANCY_RWRF\0"
+    "OCCUPANCY_VIQ\0"
+    "SINKS_C2P_IV\0"
+    "SINKS_C2P_AK\0"
+    "SINKS_C2P_BL\0"
+    "SINKS_P2C_IV\0"
+    "SINKS_P2C_AK\0"
+    "SINKS_P2C_BL\0"
+    "SINKS_S2C_AD\0"
+    "SINKS_S2C_AK\0"
+    "SINKS_S2C_BL\0"
+    "SINKS_S2P_BL\0"
+    "SNP_HITS_REMOTE_RD_HITM\0"
+    "SNP_HITS_REMOTE_RD_HITE\0"
+    "SNP_HITS_REMOTE_RD_HITS\0"
+    "SNP_HITS_REMOTE_RD_HITF\0"
+    "SNP_HITS_REMOTE_RFO_HITM\0"
+    "SNP_HITS_REMOTE_RFO_HITE\0"
+    "SNP_HITS_REMOTE_RFO_HITS\0"
+    "SNP_HITS_REMOTE_RFO_HITF\0"
+    "SNP_HITS_REMOTE_HITM\0"
+    "SNP_HITS_REMOTE_HITE\0"
+    "SNP_HITS_REMOTE_HITS\0"
+    "SNP_HITS_REMOTE_HITF\0"
+    "SNP_HITS_REMOTE_ANY\0"
+    "SNPS_REMOTE_RD\0"
+    "SNPS_REMOTE_RFO\0"
+    "SNPS_REMOTE_ANY\0"
+    "SPL_ARB_PRI_SW\0"
+    "SPL_CO_SB\0"
+    "SPL_CO_NSB\0"
+    "SPL_DEAD\0"
+    "SPL_EGR_SB\0"
+    "SPL_EGR_NSB\0"
+    "SPL_IN_FULL_IRQ\0"
+    "SPL_NOT_CO\0"
+    "SPOOF_ASSERT\0"
+    "SPOOF_DEASSERT\0"
+    "SPOOF_CRD_EMPTY\0"
+    "STARVED_EGRESS_P2C_AD_SB\0"
+    "STARVED_EGRESS_C2P_AD_SB\0"
+    "STARVED_EGRESS_AD_SB\0"
+    "STARVED_EGRESS_AD_NSB\0"
+    "STARVED_EGRESS_AD\0"
+    "STARVED_EGRESS_AK_SB\0"
+    "STARVED_EGRESS_AK_NSB\0"
+    "STARVED_EGRESS_AK\0"
+    "STARVED_EGRESS_BL_SB\0"
+    "STARVED_EGRESS_BL_NSB\0"
+    "STARVED_EGRESS_BL\0"
+    "STARVED_EGRESS_IV\0"
+    "TRANS_IPQ\0"
+    "TRANS_IRQ\0"
+    "TRANS_MAF\0"
+    "TRANS_RSPF\0"
+    "TRANS_RWRF\0"
+    "TRANS_VIQ\0"
+    "TO_R_PROG_EV\0"
+    "SBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_RBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_BBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_RBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_BBOX\0"
+    "TO_R_B_HOM_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_RBOX\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_BBOX\0"
+    "TO_R_B_HOM_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_SNP_MSGQ_CYCLES_FULL\0"
+    "TO_R_SNP_MSGQ_CYCLES_NE\0"
+    "TO_R_SNP_MSGQ_OCCUPANCY\0"
+    "TO_R_NDR_MSGQ_CYCLES_FULL\0"
+    "TO_R_NDR_MSGQ_CYCLES_NE\0"
+    "TO_R_NDR_MSGQ_OCCUPANCY\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX0_5\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX1_6\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX2_7\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX3_8\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_CBOX4_9\0"
+    "TO_R_DRS_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX0_5\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX1_6\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX2_7\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX3_8\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_CBOX4_9\0"
+    "TO_R_DRS_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX0_5\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX1_6\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX2_7\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX3_8\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_CBOX4_9\0"
+    "TO_R_DRS_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX0_5\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX1_6\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX2_7\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX3_8\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_CBOX4_9\0"
+    "TO_R_NCB_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX0_5\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX1_6\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX2_7\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX3_8\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_CBOX4_9\0"
+    "TO_R_NCB_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX0_5\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX1_6\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX2_7\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX3_8\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_CBOX4_9\0"
+    "TO_R_NCB_MSGQ_OCCUPANCY_ALL\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX0_5\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX1_6\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX2_7\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX3_8\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_CBOX4_9\0"
+    "TO_R_NCS_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX0_5\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX1_6\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX2_7\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX3_8\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_CBOX4_9\0"
+    "TO_R_NCS_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX0_5\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX1_6\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX2_7\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX3_8\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_CBOX4_9\0"
+    "TO_R_NCS_MSGQ_OCCUPANCY_ALL\0"
+    "TO_RING_SNP_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NCB_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NCS_MSGQ_CYCLES_FULL\0"
+    "TO_RING_SNP_MSGQ_CYCLES_NE\0"
+    "TO_RING_NCB_MSGQ_CYCLES_NE\0"
+    "TO_RING_NCS_MSGQ_CYCLES_NE\0"
+    "TO_RING_MSGQ_OCCUPANCY_SNP\0"
+    "TO_RING_MSGQ_OCCUPANCY_NCS\0"
+    "TO_RING_MSGQ_OCCUPANCY_NCB\0"
+    "TO_RING_MSGQ_OCCUPANCY_ALL\0"
+    "TO_RING_NDR_MSGQ_CYCLES_FULL\0"
+    "TO_RING_NDR_MSGQ_CYCLES_NE\0"
+    "TO_RING_NDR_MSGQ_OCCUPANCY\0"
+    "TO_RING_R2S_MSGQ_CYCLES_FULL\0"
+    "TO_RING_R2S_MSGQ_CYCLES_NE\0"
+    "TO_RING_R2S_MSGQ_OCCUPANCY\0"
+    "TO_RING_B2S_MSGQ_CYCLES_FULL\0"
+    "TO_RING_B2S_MSGQ_CYCLES_NE\0"
+    "TO_RING_B2S_MSGQ_OCCUPANCY\0"
+    "HALFLINE_BYPASS\0"
+    "REQ_TBL_OCCUPANCY_LOCAL\0"
+    "REQ_TBL_OCCUPANCY_REMOTE\0"
+    "REQ_TBL_OCCUPANCY_ALL\0"
+    "EGRESS_BYPASS_AD_CW\0"
+    "EGRESS_BYPASS_AD_CCW\0"
+    "EGRESS_BYPASS_AD\0"
+    "EGRESS_BYPASS_AK_CW\0"
+    "EGRESS_BYPASS_AK_CCW\0"
+    "EGRESS_BYPASS_AK\0"
+    "EGRESS_BYPASS_BL_CW\0"
+    "EGRESS_BYPASS_BL_CCW\0"
+    "EGRESS_BYPASS_BL\0"
+    "EGRESS_ARB_WINS_AD_CW\0"
+    "EGRESS_ARB_WINS_AD_CCW\0"
+    "EGRESS_ARB_WINS_AD\0"
+    "EGRESS_ARB_WINS_AK_CW\0"
+    "EGRESS_ARB_WINS_AK_CCW\0"
+    "EGRESS_ARB_WINS_AK\0"
+    "EGRESS_ARB_WINS_BL_CW\0"
+    "EGRESS_ARB_WINS_BL_CCW\0"
+    "EGRESS_ARB_WINS_BL\0"
+    "EGRESS_ARB_LOSSES_AD_CW\0"
+    "EGRESS_ARB_LOSSES_AD_CCW\0"
+    "EGRESS_ARB_LOSSES_AD\0"
+    "EGRESS_ARB_LOSSES_AK_CW\0"
+    "EGRESS_ARB_LOSSES_AK_CCW\0"
+    "EGRESS_ARB_LOSSES_AK\0"
+    "EGRESS_ARB_LOSSES_BL_CW\0"
+    "EGRESS_ARB_LOSSES_BL_CCW\0"
+    "EGRESS_ARB_LOSSES_BL\0"
+    "EGRESS_STARVED_AD_CW\0"
+    "EGRESS_STARVED_AD_CCW\0"
+    "EGRESS_STARVED_AD\0"
+    "EGRESS_STARVED_AK_CW\0"
+    "EGRESS_STARVED_AK_CCW\0"
+    "EGRESS_STARVED_AK\0"
+    "EGRESS_STARVED_BL_CW\0"
+    "EGRESS_STARVED_BL_CCW\0"
+    "EGRESS_STARVED_BL\0"
+    "RBOX_HOM_BYPASS\0"
+    "RBOX_SNP_BYPASS_SNP\0"
+    "RBOX_SNP_BYPASS_BIG_SNP\0"
+    "RBOX_SNP_BYPASS_ALL\0"
+    "S2B_HOM_BYPASS\0"
+    "B2S_DRS_BYPASS\0"
+    "BBOX_HOM_BYPASS\0"
+    "PKTS_SENT_HOM_RBOX\0"
+    "PKTS_SENT_HOM_BBOX\0"
+    "PKTS_SENT_HOM_ALL\0"
+    "PKTS_SENT_SNP\0"
+    "PKTS_RCVD_SNP\0"
+    "PKTS_SENT_NDR\0"
+    "PKTS_RCVD_NDR\0"
+    "PKTS_SENT_DRS_CBOX0_5\0"
+    "PKTS_SENT_DRS_CBOX1_6\0"
+    "PKTS_SENT_DRS_CBOX2_7\0"
+    "PKTS_SENT_DRS_CBOX3_8\0"
+    "PKTS_SENT_DRS_CBOX4_9\0"
+    "PKTS_SENT_DRS_ALL\0"
+    "FLITS_SENT_DRS\0"
+    "PKTS_RCVD_DRS_FROM_R\0"
+    "PKTS_RCVD_DRS_FROM_B\0"
+    "PKTS_SENT_NCS_CBOX0_5\0"
+    "PKTS_SENT_NCS_CBOX1_6\0"
+    "PKTS_SENT_NCS_CBOX2_7\0"
+    "PKTS_SENT_NCS_CBOX3_8\0"
+    "PKTS_SENT_NCS_CBOX4_9\0"
+    "PKTS_SENT_NCS_ALL\0"
+    "FLITS_SENT_NCS\0"
+    "PKTS_RCVD_NCS\0"
+    "PKTS_SENT_NCB_CBOX0_5\0"
+    "PKTS_SENT_NCB_CBOX1_6\0"
+    "PKTS_SENT_NCB_CBOX2_7\0"
+    "PKTS_SENT_NCB_CBOX3_8\0"
+    "PKTS_SENT_NCB_CBOX4_9\0"
+    "PKTS_SENT_NCB_ALL\0"
+    "FLITS_SENT_NCB\0"
+    "PKTS_RCVD_NCB\0"
+    "FLITS_SENT_LOC_NCS\0"
+    "PKTS_RCVD_LOC_NCS\0"
+    "RBOX_CREDIT_RETURNS\0"
+    "BBOX_CREDIT_RETURNS\0"
+    "TO_R_B_REQUESTS_LOCAL\0"
+    "TO_R_B_REQUESTS_REMOTE\0"
+    "TO_R_B_REQUESTS_ALL\0"
+    "RBOX_CREDITS\0"
+    "BBOX_CREDITS\0"
+    "NO_CREDIT_HOM\0"
+    "NO_CREDIT_SNP\0"
+    "NO_CREDIT_DRS\0"
+    "NO_CREDIT_NCS\0"
+    "NO_CREDIT_NCB\0"
+    "NO_CREDIT_NDR\0"
+    "NO_CREDIT_VNA_RBOX\0"
+    "NO_CREDIT_VNA_BBOX\0"
+    "NO_CREDIT_VNA_ALL\0"
+    "NO_CREDIT_AD\0"
+    "NO_CREDIT_AK\0"
+    "NO_CREDIT_BL\0"
+    "NO_CREDIT_IPQ\0"
+    "NO_CREDIT_LOC_NCS\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_CBOX0_5\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_CBOX1_6\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_CBOX2_7\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_CBOX3_8\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_CBOX4_9\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_FULL_ALL\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_CBOX0_5\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_CBOX1_6\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_CBOX2_7\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_CBOX3_8\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_CBOX4_9\0"
+    "TO_R_LOC_NCS_MSGQ_CYCLES_NE_ALL\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_CBOX0_5\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_CBOX1_6\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_CBOX2_7\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_CBOX3_8\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_CBOX4_9\0"
+    "TO_R_LOC_NCS_MSGQ_OCCUPANCY_ALL\0";
+
+static const PerfmonEventOption westmereEX_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_MATCH0,0xFF}
+, {EVENT_OPTION_MATCH1,0x40}
+, {EVENT_OPTION_MATCH0,0xFF}
+, {EVENT_OPTION_MATCH1,0x7}
+, {EVENT_OPTION_MATCH0,0xFF}
+, {EVENT_OPTION_MATCH1,0x20}
+, {EVENT_OPTION_MATCH0,0xFF}
+, {EVENT_OPTION_MATCH1,0x18}
+};
+
+static const PerfmonEventEntry westmereEX_arch_event_entries[NUM_ARCH_EVENTS_WESTMEREEX] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 73, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79, 104, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {108, 104, 0, 0, 0x04,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 104, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {143, 104, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {167, 104, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {190, 104, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {212, 104, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {233, 104, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {265, 104, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {294, 104, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {320, 104, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {346, 104, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {369, 104, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {393, 104, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {434, 104, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 104, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {478, 104, 0, 0, 0x0E,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {505, 104, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {523, 104, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {553, 104, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {604, 104, 0, 0, 0x0F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {634, 104, 0, 0, 0x0F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {665, 104, 0, 0, 0x0F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {696, 104, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {716, 104, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {736, 104, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {759, 104, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {788, 104, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {818, 104, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {848, 104, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {885, 104, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {922, 104, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {946, 104, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {972, 104, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {990, 104, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1010, 104, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1038, 104, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1064, 104, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1090, 104, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1107, 104, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1132, 104, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1150, 104, 0, 0, 0x13,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1168, 104, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1190, 104, 0, 0, 0x14,0x01,0xC5,0x01,EVENT_OPTION_NONE_MASK}
+, {1204, 104, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1214, 104, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1232, 104, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1250, 104, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1272, 104, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1296, 104, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1309, 104, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1325, 104, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1342, 104, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1357, 104, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1374, 104, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1392, 104, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1406, 104, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1426, 104, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1447, 104, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1465, 104, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1487, 104, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1510, 104, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1530, 104, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1544, 104, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1564, 104, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1593, 104, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1622, 104, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1651, 104, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1680, 104, 0, 0, 0x26,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1706, 104, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1744, 104, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1782, 104, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1820, 104, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1858, 104, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1893, 104, 0, 0, 0x26,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1918, 104, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1939, 104, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1960, 104, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1981, 104, 0, 0, 0x27,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {1998, 104, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2016, 104, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2038, 104, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2060, 104, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2082, 104, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2104, 104, 0, 0, 0x27,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2122, 104, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2141, 104, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2159, 104, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2177, 104, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2195, 104, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2213, 104, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2228, 104, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2251, 104, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2269, 104, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2297, 104, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2322, 104, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2338, 104, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2365, 104, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2389, 104, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2410, 104, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2443, 104, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2456, 104, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2478, 104, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2496, 104, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2518, 104, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2534, 2543, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2553, 2543, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2564, 2543, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2576, 2543, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2594, 104, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2625, 104, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2647, 2691, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2696, 2691, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2740, 2691, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2778, 2691, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2814, 2543, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2839, 2543, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2861, 104, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2877, 104, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2886, 104, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2897, 104, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2907, 104, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2926, 104, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2941, 104, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2957, 104, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2984, 104, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3008, 104, 0, 0, 0x85,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3041, 104, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3055, 104, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3069, 104, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3087, 104, 0, 0, 0x87,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3103, 104, 0, 0, 0x87,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3117, 104, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3135, 104, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3155, 104, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3186, 104, 0, 0, 0x88,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3209, 104, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3234, 104, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3264, 104, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3296, 104, 0, 0, 0x88,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3320, 104, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3339, 104, 0, 0, 0x88,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3356, 104, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3374, 104, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3394, 104, 0, 0, 0x89,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3425, 104, 0, 0, 0x89,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3448, 104, 0, 0, 0x89,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3473, 104, 0, 0, 0x89,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3503, 104, 0, 0, 0x89,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3535, 104, 0, 0, 0x89,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3559, 104, 0, 0, 0x89,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3578, 104, 0, 0, 0x89,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3595, 104, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3615, 104, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3636, 104, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3660, 104, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3682, 104, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3707, 104, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3728, 104, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3750, 104, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3772, 104, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3800, 104, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3817, 104, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3826, 104, 0, 0, 0xA8,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {3837, 104, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3848, 104, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3882, 104, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3916, 104, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3944, 104, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3970, 104, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3995, 104, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4026, 104, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4047, 104, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4067, 104, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4087, 104, 0, 0, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4112, 104, 0, 0, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4137, 104, 0, 0, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4162, 104, 0, 2, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4204, 104, 2, 3, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4244, 104, 0, 0, 0xB1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4264, 104, 0, 2, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4297, 104, 2, 3, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4328, 104, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4350, 104, 0, 0, 0xB1,0x40,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {4385, 104, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4407, 104, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4432, 2691, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4465, 2691, 0, 0, 0xB3,0x01,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4508, 2691, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4547, 2691, 0, 0, 0xB3,0x02,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4596, 2691, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4629, 2691, 0, 0, 0xB3,0x04,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4672, 104, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4693, 104, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4714, 104, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {4741, 104, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4760, 104, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4780, 104, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4800, 104, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4819, 104, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4836, 104, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4853, 104, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4870, 104, 0, 0, 0xC2,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {4896, 104, 0, 0, 0xC2,0x01,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4923, 104, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4949, 104, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4974, 104, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4996, 104, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5021, 104, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5040, 104, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5068, 104, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5094, 104, 0, 0, 0xC4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5123, 104, 0, 0, 0xC5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5152, 104, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5180, 104, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5206, 104, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5238, 104, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5270, 104, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5302, 104, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5334, 104, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5367, 104, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5385, 104, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5410, 104, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5434, 104, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5467, 104, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5507, 104, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5532, 104, 0, 0, 0xCB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5557, 104, 0, 0, 0xCB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5584, 104, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5603, 104, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5623, 104, 0, 0, 0xCC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5643, 104, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5663, 104, 0, 0, 0xD1,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {5689, 104, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5705, 104, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5730, 104, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5752, 104, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5769, 104, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5790, 104, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5815, 104, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5837, 104, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {5852, 104, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5870, 104, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5885, 104, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5898, 104, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5914, 104, 0, 0, 0xE5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5934, 104, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5948, 104, 0, 0, 0xE6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5967, 104, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5984, 104, 0, 0, 0xE8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6000, 104, 0, 0, 0xEC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6014, 104, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6035, 104, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6055, 104, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6078, 104, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6103, 104, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6126, 104, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6151, 104, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6170, 104, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6190, 104, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6210, 104, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6230, 104, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {6246, 104, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6272, 104, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6298, 104, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6326, 104, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6354, 104, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6371, 104, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6389, 104, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6408, 104, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6429, 104, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6443, 104, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6460, 104, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6476, 104, 0, 0, 0xFD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6499, 104, 0, 0, 0xFD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6524, 104, 0, 0, 0xFD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6541, 104, 0, 0, 0xFD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6560, 104, 0, 0, 0xFD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6587, 104, 0, 0, 0xFD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6612, 104, 0, 0, 0xFD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6637, 104, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6664, 104, 5, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6694, 104, 7, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6725, 104, 9, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6756, 104, 11, 2, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {6788, 104, 0, 0, 0xB7,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {6824, 104, 0, 0, 0xB7,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {6856, 104, 0, 0, 0xB7,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {6892, 104, 0, 0, 0xB7,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {6918, 104, 0, 0, 0xB7,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {6955, 104, 0, 0, 0xB7,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {6988, 104, 0, 0, 0xB7,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {7025, 104, 0, 0, 0xB7,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {7062, 104, 0, 0, 0xB7,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {7095, 104, 0, 0, 0xB7,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {7132, 104, 0, 0, 0xB7,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {7165, 104, 0, 0, 0xB7,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {7205, 104, 0, 0, 0xB7,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {7234, 104, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7261, 104, 5, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7291, 104, 7, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7322, 104, 9, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7353, 104, 11, 2, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK|EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7385, 104, 0, 0, 0xBB,0x01,0x00,0x10,EVENT_OPTION_NONE_MASK}
+, {7421, 104, 0, 0, 0xBB,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {7453, 104, 0, 0, 0xBB,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {7489, 104, 0, 0, 0xBB,0x01,0x03,0x10,EVENT_OPTION_NONE_MASK}
+, {7515, 104, 0, 0, 0xBB,0x01,0x04,0x10,EVENT_OPTION_NONE_MASK}
+, {7552, 104, 0, 0, 0xBB,0x01,0x05,0x10,EVENT_OPTION_NONE_MASK}
+, {7585, 104, 0, 0, 0xBB,0x01,0x06,0x10,EVENT_OPTION_NONE_MASK}
+, {7622, 104, 0, 0, 0xBB,0x01,0x07,0x10,EVENT_OPTION_NONE_MASK}
+, {7659, 104, 0, 0, 0xBB,0x01,0x08,0x10,EVENT_OPTION_NONE_MASK}
+, {7692, 104, 0, 0, 0xBB,0x01,0x09,0x10,EVENT_OPTION_NONE_MASK}
+, {7729, 104, 0, 0, 0xBB,0x01,0x0A,0x10,EVENT_OPTION_NONE_MASK}
+, {7762, 104, 0, 0, 0xBB,0x01,0x0B,0x10,EVENT_OPTION_NONE_MASK}
+, {7802, 104, 0, 0, 0xBB,0x01,0x0F,0x10,EVENT_OPTION_NONE_MASK}
+, {7831, 7844, 0, 0, 0xFF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7852, 7870, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7875, 7870, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7893, 7870, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7911, 7870, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7929, 7870, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7947, 7870, 0, 0, 0x04,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7965, 7870, 0, 0, 0x04,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7983, 7870, 0, 0, 0x04,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8001, 7870, 0, 0, 0x04,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8022, 7870, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8043, 7870, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8064, 7870, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8085, 7870, 0, 0, 0x01,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8106, 7870, 0, 0, 0x01,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8127, 7870, 0, 0, 0x01,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8148, 7870, 0, 0, 0x01,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8169, 7870, 0, 0, 0x01,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8190, 7870, 0, 0, 0x01,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8214, 7870, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8239, 7870, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8264, 7870, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8289, 7870, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8314, 7870, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8339, 7870, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8364, 7870, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8389, 7870, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8414, 7870, 0, 0, 0x03,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8442, 7870, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8463, 7870, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8484, 7870, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8505, 7870, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8526, 7870, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8547, 7870, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8568, 7870, 0, 0, 0x00,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8589, 7870, 0, 0, 0x00,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8610, 7870, 0, 0, 0x00,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8634, 7870, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8642, 7870, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8664, 7870, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8686, 7870, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8708, 7870, 0, 0, 0x08,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8730, 7870, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8752, 7870, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8774, 7870, 0, 0, 0x08,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8796, 7870, 0, 0, 0x08,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8818, 7870, 0, 0, 0x08,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8843, 7870, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8853, 7870, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8863, 7870, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8873, 7870, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8883, 7870, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8893, 7870, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8903, 7870, 0, 0, 0x07,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8913, 7870, 0, 0, 0x07,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8923, 7870, 0, 0, 0x07,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8936, 8950, 0, 0, 0x1A,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8955, 8950, 0, 0, 0x06,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {8983, 8950, 0, 0, 0x06,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9012, 8950, 0, 0, 0x06,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9040, 8950, 0, 0, 0x06,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9066, 8950, 0, 0, 0x06,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9092, 8950, 0, 0, 0x06,0x05,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9118, 8950, 0, 0, 0x06,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9144, 8950, 0, 0, 0x06,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9172, 8950, 0, 0, 0x06,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9198, 9214, 0, 0, 0x1B,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {9230, 8950, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9255, 8950, 0, 0, 0x00,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9280, 8950, 0, 0, 0x00,0x04,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9306, 8950, 0, 0, 0x00,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9332, 8950, 0, 0, 0x01,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9345, 8950, 0, 0, 0x05,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9369, 8950, 0, 0, 0x05,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9391, 8950, 0, 0, 0x04,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9413, 8950, 0, 0, 0x03,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9433, 8950, 0, 0, 0x01,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9460, 8950, 0, 0, 0x01,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9485, 8950, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9510, 8950, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {9537, 8950, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {9550, 8950, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9567, 8950, 0, 0, 0x0A,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9583, 8950, 0, 0, 0x0A,0x01,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9606, 8950, 0, 0, 0x0A,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {9629, 8950, 0, 0, 0x0A,0x01,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {9652, 8950, 0, 0, 0x0A,0x01,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {9677, 8950, 0, 0, 0x0A,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9690, 8950, 0, 0, 0x0A,0x02,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9710, 8950, 0, 0, 0x0A,0x02,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {9730, 8950, 0, 0, 0x0A,0x02,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {9750, 8950, 0, 0, 0x0A,0x02,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {9772, 8950, 0, 0, 0x0A,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9792, 8950, 0, 0, 0x0A,0x04,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9812, 8950, 0, 0, 0x0A,0x04,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9839, 8950, 0, 0, 0x0A,0x04,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {9866, 8950, 0, 0, 0x0A,0x04,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {9893, 8950, 0, 0, 0x0A,0x04,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {9922, 8950, 0, 0, 0x0A,0x05,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {9942, 8950, 0, 0, 0x0A,0x05,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {9969, 8950, 0, 0, 0x0A,0x05,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {9996, 8950, 0, 0, 0x0A,0x05,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {10023, 8950, 0, 0, 0x0A,0x05,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {10052, 8950, 0, 0, 0x0A,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10072, 8950, 0, 0, 0x0A,0x06,0x02,0x10,EVENT_OPTION_NONE_MASK}
+, {10099, 8950, 0, 0, 0x0A,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {10126, 8950, 0, 0, 0x0A,0x06,0x02,0x12,EVENT_OPTION_NONE_MASK}
+, {10153, 8950, 0, 0, 0x0A,0x06,0x02,0x13,EVENT_OPTION_NONE_MASK}
+, {10182, 8950, 0, 0, 0x0A,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10195, 8950, 0, 0, 0x0A,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10208, 8950, 0, 0, 0x0A,0x0A,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10222, 8950, 0, 0, 0x0A,0x0B,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10236, 8950, 0, 0, 0x0A,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10249, 8950, 0, 0, 0x0A,0x10,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10263, 8950, 0, 0, 0x0A,0x11,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10276, 8950, 0, 0, 0x0A,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10290, 8950, 0, 0, 0x0A,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10306, 8950, 0, 0, 0x0A,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10322, 8950, 0, 0, 0x0A,0x17,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10340, 8950, 0, 0, 0x0A,0x1C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10356, 8950, 0, 0, 0x0A,0x1D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10372, 8950, 0, 0, 0x0A,0x1E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10387, 8950, 0, 0, 0x0A,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {10407, 8950, 0, 0, 0x0A,0x00,0x02,0x01,EVENT_OPTION_NONE_MASK}
+, {10427, 8950, 0, 0, 0x0A,0x00,0x02,0x02,EVENT_OPTION_NONE_MASK}
+, {10447, 8950, 0, 0, 0x0A,0x00,0x02,0x03,EVENT_OPTION_NONE_MASK}
+, {10469, 8950, 0, 0, 0x00,0x01,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {10487, 8950, 0, 0, 0x00,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {10505, 8950, 0, 0, 0x00,0x04,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {10524, 8950, 0, 0, 0x00,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {10543, 8950, 0, 0, 0x0B,0x00,0x04,0x03,EVENT_OPTION_NONE_MASK}
+, {10565, 8950, 0, 0, 0x0B,0x01,0x04,0x03,EVENT_OPTION_NONE_MASK}
+, {10588, 8950, 0, 0, 0x0B,0x01,0x04,0x02,EVENT_OPTION_NONE_MASK}
+, {10604, 8950, 0, 0, 0x0B,0x01,0x04,0x01,EVENT_OPTION_NONE_MASK}
+, {10627, 8950, 0, 0, 0x0B,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10645, 8950, 0, 0, 0x0B,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10662, 8950, 0, 0, 0x0B,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10676, 8950, 0, 0, 0x0B,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10697, 8950, 0, 0, 0x0B,0x04,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10718, 8950, 0, 0, 0x0B,0x05,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10739, 8950, 0, 0, 0x0B,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10760, 8950, 0, 0, 0x0B,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10774, 8950, 0, 0, 0x0B,0x09,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10788, 8950, 0, 0, 0x0B,0x0A,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10803, 8950, 0, 0, 0x0B,0x0B,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10818, 8950, 0, 0, 0x0B,0x0C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10832, 8950, 0, 0, 0x0B,0x10,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10847, 8950, 0, 0, 0x0B,0x11,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10861, 8950, 0, 0, 0x0B,0x12,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10876, 8950, 0, 0, 0x0B,0x14,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10893, 8950, 0, 0, 0x0B,0x15,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10910, 8950, 0, 0, 0x0B,0x17,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10929, 8950, 0, 0, 0x0B,0x1C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10946, 8950, 0, 0, 0x0B,0x1D,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10963, 8950, 0, 0, 0x0B,0x1E,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {10979, 8950, 0, 0, 0x09,0x00,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {10993, 8950, 0, 0, 0x09,0x01,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {11007, 8950, 0, 0, 0x09,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {11021, 8950, 0, 0, 0x09,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {11035, 8950, 0, 0, 0x09,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {11048, 8950, 0, 0, 0x09,0x0C,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {11062, 8950, 0, 0, 0x0D,0x00,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11082, 8950, 0, 0, 0x0D,0x01,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11102, 8950, 0, 0, 0x0D,0x02,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11121, 8950, 0, 0, 0x0D,0x03,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11142, 8950, 0, 0, 0x0D,0x04,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11161, 8950, 0, 0, 0x0D,0x05,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11185, 8950, 0, 0, 0x0D,0x05,0x06,0x01,EVENT_OPTION_NONE_MASK}
+, {11210, 8950, 0, 0, 0x0D,0x06,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11231, 8950, 0, 0, 0x0D,0x06,0x06,0x01,EVENT_OPTION_NONE_MASK}
+, {11254, 8950, 0, 0, 0x0D,0x06,0x06,0x02,EVENT_OPTION_NONE_MASK}
+, {11275, 8950, 0, 0, 0x0D,0x06,0x06,0x03,EVENT_OPTION_NONE_MASK}
+, {11298, 8950, 0, 0, 0x0D,0x06,0x06,0x04,EVENT_OPTION_NONE_MASK}
+, {11324, 8950, 0, 0, 0x0D,0x06,0x06,0x05,EVENT_OPTION_NONE_MASK}
+, {11349, 8950, 0, 0, 0x0D,0x06,0x06,0x07,EVENT_OPTION_NONE_MASK}
+, {11377, 8950, 0, 0, 0x0D,0x07,0x06,0x00,EVENT_OPTION_NONE_MASK}
+, {11397, 8950, 0, 0, 0x0E,0x00,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11417, 8950, 0, 0, 0x0E,0x01,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11437, 8950, 0, 0, 0x0E,0x02,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11456, 8950, 0, 0, 0x0E,0x03,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11477, 8950, 0, 0, 0x0E,0x04,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11496, 8950, 0, 0, 0x0E,0x05,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11520, 8950, 0, 0, 0x0E,0x05,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {11545, 8950, 0, 0, 0x0E,0x06,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11566, 8950, 0, 0, 0x0E,0x06,0x07,0x01,EVENT_OPTION_NONE_MASK}
+, {11589, 8950, 0, 0, 0x0E,0x06,0x07,0x02,EVENT_OPTION_NONE_MASK}
+, {11610, 8950, 0, 0, 0x0E,0x06,0x07,0x03,EVENT_OPTION_NONE_MASK}
+, {11633, 8950, 0, 0, 0x0E,0x06,0x07,0x04,EVENT_OPTION_NONE_MASK}
+, {11659, 8950, 0, 0, 0x0E,0x06,0x07,0x05,EVENT_OPTION_NONE_MASK}
+, {11684, 8950, 0, 0, 0x0E,0x06,0x07,0x07,EVENT_OPTION_NONE_MASK}
+, {11712, 8950, 0, 0, 0x0E,0x07,0x07,0x00,EVENT_OPTION_NONE_MASK}
+, {11732, 8950, 0, 0, 0x0F,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11752, 8950, 0, 0, 0x0F,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11772, 8950, 0, 0, 0x0F,0x02,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11791, 8950, 0, 0, 0x0F,0x03,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11812, 8950, 0, 0, 0x0F,0x04,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11831, 8950, 0, 0, 0x0F,0x05,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11855, 8950, 0, 0, 0x0F,0x05,0x08,0x01,EVENT_OPTION_NONE_MASK}
+, {11880, 8950, 0, 0, 0x0F,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {11901, 8950, 0, 0, 0x0F,0x06,0x08,0x01,EVENT_OPTION_NONE_MASK}
+, {11924, 8950, 0, 0, 0x0F,0x06,0x08,0x02,EVENT_OPTION_NONE_MASK}
+, {11945, 8950, 0, 0, 0x0F,0x06,0x08,0x03,EVENT_OPTION_NONE_MASK}
+, {11968, 8950, 0, 0, 0x0F,0x06,0x08,0x04,EVENT_OPTION_NONE_MASK}
+, {11994, 8950, 0, 0, 0x0F,0x06,0x08,0x05,EVENT_OPTION_NONE_MASK}
+, {12019, 8950, 0, 0, 0x0F,0x06,0x08,0x07,EVENT_OPTION_NONE_MASK}
+, {12047, 8950, 0, 0, 0x0F,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {12067, 8950, 0, 0, 0x10,0x00,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12087, 8950, 0, 0, 0x10,0x01,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12107, 8950, 0, 0, 0x10,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12126, 8950, 0, 0, 0x10,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12147, 8950, 0, 0, 0x10,0x04,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12166, 8950, 0, 0, 0x10,0x05,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12190, 8950, 0, 0, 0x10,0x05,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {12215, 8950, 0, 0, 0x10,0x06,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12236, 8950, 0, 0, 0x10,0x06,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {12259, 8950, 0, 0, 0x10,0x06,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {12280, 8950, 0, 0, 0x10,0x06,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {12303, 8950, 0, 0, 0x10,0x06,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {12329, 8950, 0, 0, 0x10,0x06,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {12354, 8950, 0, 0, 0x10,0x06,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {12382, 8950, 0, 0, 0x10,0x07,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {12402, 8950, 0, 0, 0x18,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12412, 8950, 0, 0, 0x1D,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12426, 8950, 0, 0, 0x08,0x00,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {12444, 8950, 0, 0, 0x08,0x01,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {12465, 8950, 0, 0, 0x0C,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12476, 8950, 0, 0, 0x17,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12485, 8950, 0, 0, 0x14,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12494, 8950, 0, 0, 0x13,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12504, 8950, 0, 0, 0x11,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12516, 8950, 0, 0, 0x16,0x00,0x0B,0x00,EVENT_OPTION_NONE_MASK}
+, {12536, 8950, 0, 0, 0x16,0x01,0x0B,0x00,EVENT_OPTION_NONE_MASK}
+, {12556, 8950, 0, 0, 0x15,0x00,0x0C,0x00,EVENT_OPTION_NONE_MASK}
+, {12578, 8950, 0, 0, 0x15,0x01,0x0C,0x00,EVENT_OPTION_NONE_MASK}
+, {12602, 8950, 0, 0, 0x06,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12610, 8950, 0, 0, 0x07,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12627, 8950, 0, 0, 0x02,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12639, 8950, 0, 0, 0x03,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12652, 8950, 0, 0, 0x1C,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {12672, 8950, 0, 0, 0x05,0x03,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {12701, 8950, 0, 0, 0x05,0x02,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {12730, 8950, 0, 0, 0x05,0x01,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {12753, 8950, 0, 0, 0x05,0x00,0x0D,0x00,EVENT_OPTION_NONE_MASK}
+, {12776, 8950, 0, 0, 0x05,0x03,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {12807, 8950, 0, 0, 0x05,0x03,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {12838, 8950, 0, 0, 0x05,0x03,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {12869, 8950, 0, 0, 0x05,0x03,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {12900, 8950, 0, 0, 0x05,0x02,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {12931, 8950, 0, 0, 0x05,0x02,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {12962, 8950, 0, 0, 0x05,0x02,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {12993, 8950, 0, 0, 0x05,0x02,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {13024, 8950, 0, 0, 0x05,0x01,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {13049, 8950, 0, 0, 0x05,0x01,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {13074, 8950, 0, 0, 0x05,0x01,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {13099, 8950, 0, 0, 0x05,0x01,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {13124, 8950, 0, 0, 0x05,0x00,0x0D,0x01,EVENT_OPTION_NONE_MASK}
+, {13149, 8950, 0, 0, 0x05,0x00,0x0D,0x02,EVENT_OPTION_NONE_MASK}
+, {13174, 8950, 0, 0, 0x05,0x00,0x0D,0x03,EVENT_OPTION_NONE_MASK}
+, {13199, 8950, 0, 0, 0x05,0x00,0x0D,0x04,EVENT_OPTION_NONE_MASK}
+, {13224, 8950, 0, 0, 0x04,0x03,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {13253, 8950, 0, 0, 0x04,0x02,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {13282, 8950, 0, 0, 0x04,0x01,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {13305, 8950, 0, 0, 0x04,0x00,0x0E,0x00,EVENT_OPTION_NONE_MASK}
+, {13328, 8950, 0, 0, 0x04,0x03,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {13359, 8950, 0, 0, 0x04,0x03,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {13390, 8950, 0, 0, 0x04,0x03,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {13421, 8950, 0, 0, 0x04,0x03,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {13452, 8950, 0, 0, 0x04,0x02,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {13483, 8950, 0, 0, 0x04,0x02,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {13514, 8950, 0, 0, 0x04,0x02,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {13545, 8950, 0, 0, 0x04,0x02,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {13576, 8950, 0, 0, 0x04,0x01,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {13601, 8950, 0, 0, 0x04,0x01,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {13626, 8950, 0, 0, 0x04,0x01,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {13651, 8950, 0, 0, 0x04,0x01,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {13676, 8950, 0, 0, 0x04,0x00,0x0E,0x01,EVENT_OPTION_NONE_MASK}
+, {13701, 8950, 0, 0, 0x04,0x00,0x0E,0x02,EVENT_OPTION_NONE_MASK}
+, {13726, 8950, 0, 0, 0x04,0x00,0x0E,0x03,EVENT_OPTION_NONE_MASK}
+, {13751, 8950, 0, 0, 0x04,0x00,0x0E,0x04,EVENT_OPTION_NONE_MASK}
+, {13776, 8950, 0, 0, 0x12,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {13787, 8950, 0, 0, 0x19,0x00,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {13803, 13823, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13839, 13823, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13849, 13823, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13861, 13823, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13881, 13894, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13910, 13925, 0, 0, 0x17,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13941, 13823, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13954, 13894, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13967, 13925, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13982, 13823, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {13992, 13823, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14005, 13823, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14014, 13894, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14030, 13894, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14050, 13894, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14066, 13894, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14090, 13894, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14109, 13894, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14129, 13894, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14157, 13894, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14180, 13894, 0, 0, 0x0E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14203, 13894, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14218, 13894, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14233, 14247, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14263, 13823, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14276, 13925, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14296, 14247, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14308, 14247, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14320, 14247, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14336, 13894, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14349, 13925, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14367, 13925, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14392, 13894, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14412, 13894, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14433, 13894, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14447, 13925, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14468, 13894, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14484, 13894, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14501, 14247, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MASK0_MASK}
+, {14515, 13823, 0, 0, 0x15,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14532, 13823, 0, 0, 0x14,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14549, 13894, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14563, 13925, 0, 0, 0x12,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14579, 13925, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14586, 13925, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14597, 13925, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14604, 13925, 0, 0, 0x0F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14619, 13925, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14641, 13925, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14651, 13925, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {14657, 14687, 0, 0, 0x00,0x00,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14693, 14687, 0, 0, 0x00,0x00,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14723, 14687, 0, 0, 0x00,0x00,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {14758, 14687, 0, 0, 0x00,0x00,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {14788, 14687, 0, 0, 0x00,0x00,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {14818, 14687, 0, 0, 0x00,0x00,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {14852, 14687, 0, 0, 0x00,0x00,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {14886, 14687, 0, 0, 0x00,0x00,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {14916, 14687, 0, 0, 0x00,0x01,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {14946, 14687, 0, 0, 0x00,0x01,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {14976, 14687, 0, 0, 0x00,0x01,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15011, 14687, 0, 0, 0x00,0x01,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15041, 14687, 0, 0, 0x00,0x01,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15071, 14687, 0, 0, 0x00,0x01,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15105, 14687, 0, 0, 0x00,0x01,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15139, 14687, 0, 0, 0x00,0x01,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {15169, 14687, 0, 0, 0x00,0x06,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15199, 14687, 0, 0, 0x00,0x06,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15229, 14687, 0, 0, 0x00,0x06,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15264, 14687, 0, 0, 0x00,0x06,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15294, 14687, 0, 0, 0x00,0x06,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15324, 14687, 0, 0, 0x00,0x06,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15358, 14687, 0, 0, 0x00,0x06,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15392, 14687, 0, 0, 0x00,0x06,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {15422, 14687, 0, 0, 0x00,0x07,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15452, 14687, 0, 0, 0x00,0x07,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15482, 14687, 0, 0, 0x00,0x07,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15517, 14687, 0, 0, 0x00,0x07,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15547, 14687, 0, 0, 0x00,0x07,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15577, 14687, 0, 0, 0x00,0x07,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15611, 14687, 0, 0, 0x00,0x07,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15645, 14687, 0, 0, 0x00,0x07,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {15675, 14687, 0, 0, 0x00,0x0C,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15705, 14687, 0, 0, 0x00,0x0C,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15735, 14687, 0, 0, 0x00,0x0C,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {15770, 14687, 0, 0, 0x00,0x0C,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {15800, 14687, 0, 0, 0x00,0x0C,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {15830, 14687, 0, 0, 0x00,0x0C,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {15864, 14687, 0, 0, 0x00,0x0C,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {15898, 14687, 0, 0, 0x00,0x0C,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {15928, 14687, 0, 0, 0x00,0x0D,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {15958, 14687, 0, 0, 0x00,0x0D,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {15988, 14687, 0, 0, 0x00,0x0D,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16023, 14687, 0, 0, 0x00,0x0D,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16053, 14687, 0, 0, 0x00,0x0D,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16083, 14687, 0, 0, 0x00,0x0D,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16117, 14687, 0, 0, 0x00,0x0D,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16151, 14687, 0, 0, 0x00,0x0D,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {16181, 14687, 0, 0, 0x00,0x12,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16211, 14687, 0, 0, 0x00,0x12,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16241, 14687, 0, 0, 0x00,0x12,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16276, 14687, 0, 0, 0x00,0x12,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16306, 14687, 0, 0, 0x00,0x12,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16336, 14687, 0, 0, 0x00,0x12,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16370, 14687, 0, 0, 0x00,0x12,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16404, 14687, 0, 0, 0x00,0x12,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {16434, 14687, 0, 0, 0x00,0x13,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16464, 14687, 0, 0, 0x00,0x13,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16494, 14687, 0, 0, 0x00,0x13,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16529, 14687, 0, 0, 0x00,0x13,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16559, 14687, 0, 0, 0x00,0x13,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16589, 14687, 0, 0, 0x00,0x13,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16623, 14687, 0, 0, 0x00,0x13,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16657, 14687, 0, 0, 0x00,0x13,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {16687, 16717, 0, 0, 0x00,0x00,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16723, 16717, 0, 0, 0x00,0x00,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {16753, 16717, 0, 0, 0x00,0x00,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {16788, 16717, 0, 0, 0x00,0x00,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {16818, 16717, 0, 0, 0x00,0x00,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {16848, 16717, 0, 0, 0x00,0x00,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {16882, 16717, 0, 0, 0x00,0x00,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {16916, 16717, 0, 0, 0x00,0x00,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {16946, 16717, 0, 0, 0x00,0x01,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {16976, 16717, 0, 0, 0x00,0x01,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {17006, 16717, 0, 0, 0x00,0x01,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {17041, 16717, 0, 0, 0x00,0x01,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {17071, 16717, 0, 0, 0x00,0x01,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {17101, 16717, 0, 0, 0x00,0x01,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {17135, 16717, 0, 0, 0x00,0x01,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {17169, 16717, 0, 0, 0x00,0x01,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {17199, 16717, 0, 0, 0x00,0x06,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {17229, 16717, 0, 0, 0x00,0x06,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {17259, 16717, 0, 0, 0x00,0x06,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {17294, 16717, 0, 0, 0x00,0x06,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {17324, 16717, 0, 0, 0x00,0x06,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {17354, 16717, 0, 0, 0x00,0x06,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {17388, 16717, 0, 0, 0x00,0x06,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {17422, 16717, 0, 0, 0x00,0x06,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {17452, 16717, 0, 0, 0x00,0x07,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {17482, 16717, 0, 0, 0x00,0x07,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {17512, 16717, 0, 0, 0x00,0x07,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {17547, 16717, 0, 0, 0x00,0x07,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {17577, 16717, 0, 0, 0x00,0x07,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {17607, 16717, 0, 0, 0x00,0x07,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {17641, 16717, 0, 0, 0x00,0x07,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {17675, 16717, 0, 0, 0x00,0x07,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {17705, 16717, 0, 0, 0x00,0x0C,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {17735, 16717, 0, 0, 0x00,0x0C,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {17765, 16717, 0, 0, 0x00,0x0C,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {17800, 16717, 0, 0, 0x00,0x0C,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {17830, 16717, 0, 0, 0x00,0x0C,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {17860, 16717, 0, 0, 0x00,0x0C,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {17894, 16717, 0, 0, 0x00,0x0C,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {17928, 16717, 0, 0, 0x00,0x0C,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {17958, 16717, 0, 0, 0x00,0x0D,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {17988, 16717, 0, 0, 0x00,0x0D,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {18018, 16717, 0, 0, 0x00,0x0D,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {18053, 16717, 0, 0, 0x00,0x0D,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {18083, 16717, 0, 0, 0x00,0x0D,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {18113, 16717, 0, 0, 0x00,0x0D,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {18147, 16717, 0, 0, 0x00,0x0D,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {18181, 16717, 0, 0, 0x00,0x0D,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {18211, 16717, 0, 0, 0x00,0x12,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {18241, 16717, 0, 0, 0x00,0x12,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {18271, 16717, 0, 0, 0x00,0x12,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {18306, 16717, 0, 0, 0x00,0x12,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {18336, 16717, 0, 0, 0x00,0x12,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {18366, 16717, 0, 0, 0x00,0x12,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {18400, 16717, 0, 0, 0x00,0x12,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {18434, 16717, 0, 0, 0x00,0x12,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {18464, 16717, 0, 0, 0x00,0x13,0x01,0x09,EVENT_OPTION_NONE_MASK}
+, {18494, 16717, 0, 0, 0x00,0x13,0x02,0x09,EVENT_OPTION_NONE_MASK}
+, {18524, 16717, 0, 0, 0x00,0x13,0x04,0x09,EVENT_OPTION_NONE_MASK}
+, {18559, 16717, 0, 0, 0x00,0x13,0x08,0x09,EVENT_OPTION_NONE_MASK}
+, {18589, 16717, 0, 0, 0x00,0x13,0x10,0x09,EVENT_OPTION_NONE_MASK}
+, {18619, 16717, 0, 0, 0x00,0x13,0x20,0x09,EVENT_OPTION_NONE_MASK}
+, {18653, 16717, 0, 0, 0x00,0x13,0x40,0x09,EVENT_OPTION_NONE_MASK}
+, {18687, 16717, 0, 0, 0x00,0x13,0xFF,0x09,EVENT_OPTION_NONE_MASK}
+, {18717, 14687, 0, 0, 0x00,0x00,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18750, 14687, 0, 0, 0x00,0x00,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {18783, 14687, 0, 0, 0x00,0x00,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {18812, 14687, 0, 0, 0x00,0x00,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {18845, 14687, 0, 0, 0x00,0x00,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {18874, 14687, 0, 0, 0x00,0x00,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {18903, 14687, 0, 0, 0x00,0x00,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {18932, 14687, 0, 0, 0x00,0x00,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {18965, 14687, 0, 0, 0x00,0x01,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {18998, 14687, 0, 0, 0x00,0x01,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19031, 14687, 0, 0, 0x00,0x01,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19060, 14687, 0, 0, 0x00,0x01,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19093, 14687, 0, 0, 0x00,0x01,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19122, 14687, 0, 0, 0x00,0x01,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19151, 14687, 0, 0, 0x00,0x01,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19180, 14687, 0, 0, 0x00,0x01,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19213, 14687, 0, 0, 0x00,0x06,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19246, 14687, 0, 0, 0x00,0x06,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19279, 14687, 0, 0, 0x00,0x06,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19308, 14687, 0, 0, 0x00,0x06,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19341, 14687, 0, 0, 0x00,0x06,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19370, 14687, 0, 0, 0x00,0x06,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19399, 14687, 0, 0, 0x00,0x06,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19428, 14687, 0, 0, 0x00,0x06,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19461, 14687, 0, 0, 0x00,0x07,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19494, 14687, 0, 0, 0x00,0x07,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19527, 14687, 0, 0, 0x00,0x07,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19556, 14687, 0, 0, 0x00,0x07,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19589, 14687, 0, 0, 0x00,0x07,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19618, 14687, 0, 0, 0x00,0x07,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19647, 14687, 0, 0, 0x00,0x07,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19676, 14687, 0, 0, 0x00,0x07,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19709, 14687, 0, 0, 0x00,0x0C,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19742, 14687, 0, 0, 0x00,0x0C,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {19775, 14687, 0, 0, 0x00,0x0C,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {19804, 14687, 0, 0, 0x00,0x0C,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {19837, 14687, 0, 0, 0x00,0x0C,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {19866, 14687, 0, 0, 0x00,0x0C,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {19895, 14687, 0, 0, 0x00,0x0C,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {19924, 14687, 0, 0, 0x00,0x0C,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {19957, 14687, 0, 0, 0x00,0x0D,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {19990, 14687, 0, 0, 0x00,0x0D,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20023, 14687, 0, 0, 0x00,0x0D,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20052, 14687, 0, 0, 0x00,0x0D,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20085, 14687, 0, 0, 0x00,0x0D,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20114, 14687, 0, 0, 0x00,0x0D,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20143, 14687, 0, 0, 0x00,0x0D,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20172, 14687, 0, 0, 0x00,0x0D,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20205, 14687, 0, 0, 0x00,0x12,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20238, 14687, 0, 0, 0x00,0x12,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20271, 14687, 0, 0, 0x00,0x12,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20300, 14687, 0, 0, 0x00,0x12,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20333, 14687, 0, 0, 0x00,0x12,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20362, 14687, 0, 0, 0x00,0x12,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20391, 14687, 0, 0, 0x00,0x12,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20420, 14687, 0, 0, 0x00,0x12,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20453, 14687, 0, 0, 0x00,0x13,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20486, 14687, 0, 0, 0x00,0x13,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20519, 14687, 0, 0, 0x00,0x13,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20548, 14687, 0, 0, 0x00,0x13,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20581, 14687, 0, 0, 0x00,0x13,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20610, 14687, 0, 0, 0x00,0x13,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20639, 14687, 0, 0, 0x00,0x13,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20668, 14687, 0, 0, 0x00,0x13,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20701, 16717, 0, 0, 0x00,0x00,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20734, 16717, 0, 0, 0x00,0x00,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {20767, 16717, 0, 0, 0x00,0x00,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {20796, 16717, 0, 0, 0x00,0x00,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {20829, 16717, 0, 0, 0x00,0x00,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {20858, 16717, 0, 0, 0x00,0x00,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {20887, 16717, 0, 0, 0x00,0x00,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {20916, 16717, 0, 0, 0x00,0x00,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {20949, 16717, 0, 0, 0x00,0x01,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {20982, 16717, 0, 0, 0x00,0x01,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {21015, 16717, 0, 0, 0x00,0x01,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {21044, 16717, 0, 0, 0x00,0x01,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {21077, 16717, 0, 0, 0x00,0x01,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {21106, 16717, 0, 0, 0x00,0x01,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {21135, 16717, 0, 0, 0x00,0x01,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {21164, 16717, 0, 0, 0x00,0x01,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {21197, 16717, 0, 0, 0x00,0x06,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {21230, 16717, 0, 0, 0x00,0x06,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {21263, 16717, 0, 0, 0x00,0x06,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {21292, 16717, 0, 0, 0x00,0x06,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {21325, 16717, 0, 0, 0x00,0x06,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {21354, 16717, 0, 0, 0x00,0x06,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {21383, 16717, 0, 0, 0x00,0x06,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {21412, 16717, 0, 0, 0x00,0x06,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {21445, 16717, 0, 0, 0x00,0x07,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {21478, 16717, 0, 0, 0x00,0x07,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {21511, 16717, 0, 0, 0x00,0x07,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {21540, 16717, 0, 0, 0x00,0x07,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {21573, 16717, 0, 0, 0x00,0x07,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {21602, 16717, 0, 0, 0x00,0x07,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {21631, 16717, 0, 0, 0x00,0x07,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {21660, 16717, 0, 0, 0x00,0x07,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {21693, 16717, 0, 0, 0x00,0x0C,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {21726, 16717, 0, 0, 0x00,0x0C,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {21759, 16717, 0, 0, 0x00,0x0C,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {21788, 16717, 0, 0, 0x00,0x0C,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {21821, 16717, 0, 0, 0x00,0x0C,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {21850, 16717, 0, 0, 0x00,0x0C,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {21879, 16717, 0, 0, 0x00,0x0C,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {21908, 16717, 0, 0, 0x00,0x0C,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {21941, 16717, 0, 0, 0x00,0x0D,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {21974, 16717, 0, 0, 0x00,0x0D,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {22007, 16717, 0, 0, 0x00,0x0D,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {22036, 16717, 0, 0, 0x00,0x0D,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {22069, 16717, 0, 0, 0x00,0x0D,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {22098, 16717, 0, 0, 0x00,0x0D,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {22127, 16717, 0, 0, 0x00,0x0D,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {22156, 16717, 0, 0, 0x00,0x0D,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {22189, 16717, 0, 0, 0x00,0x12,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {22222, 16717, 0, 0, 0x00,0x12,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {22255, 16717, 0, 0, 0x00,0x12,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {22284, 16717, 0, 0, 0x00,0x12,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {22317, 16717, 0, 0, 0x00,0x12,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {22346, 16717, 0, 0, 0x00,0x12,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {22375, 16717, 0, 0, 0x00,0x12,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {22404, 16717, 0, 0, 0x00,0x12,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {22437, 16717, 0, 0, 0x00,0x13,0x11,0x11,EVENT_OPTION_NONE_MASK}
+, {22470, 16717, 0, 0, 0x00,0x13,0x12,0x11,EVENT_OPTION_NONE_MASK}
+, {22503, 16717, 0, 0, 0x00,0x13,0x13,0x11,EVENT_OPTION_NONE_MASK}
+, {22532, 16717, 0, 0, 0x00,0x13,0x14,0x11,EVENT_OPTION_NONE_MASK}
+, {22565, 16717, 0, 0, 0x00,0x13,0x15,0x11,EVENT_OPTION_NONE_MASK}
+, {22594, 16717, 0, 0, 0x00,0x13,0x16,0x11,EVENT_OPTION_NONE_MASK}
+, {22623, 16717, 0, 0, 0x00,0x13,0x17,0x11,EVENT_OPTION_NONE_MASK}
+, {22652, 16717, 0, 0, 0x00,0x13,0x18,0x11,EVENT_OPTION_NONE_MASK}
+, {22685, 14687, 0, 0, 0x00,0x00,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22712, 14687, 0, 0, 0x00,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22739, 14687, 0, 0, 0x00,0x06,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22766, 14687, 0, 0, 0x00,0x07,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22793, 14687, 0, 0, 0x00,0x0C,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22820, 14687, 0, 0, 0x00,0x0D,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22847, 14687, 0, 0, 0x00,0x12,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22874, 14687, 0, 0, 0x00,0x13,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22901, 16717, 0, 0, 0x00,0x00,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22928, 16717, 0, 0, 0x00,0x01,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22955, 16717, 0, 0, 0x00,0x06,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {22982, 16717, 0, 0, 0x00,0x07,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {23009, 16717, 0, 0, 0x00,0x0C,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {23036, 16717, 0, 0, 0x00,0x0D,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {23063, 16717, 0, 0, 0x00,0x12,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {23090, 16717, 0, 0, 0x00,0x13,0x01,0x10,EVENT_OPTION_NONE_MASK}
+, {23117, 14687, 0, 0, 0x00,0x00,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23152, 14687, 0, 0, 0x00,0x00,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23187, 14687, 0, 0, 0x00,0x00,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23218, 14687, 0, 0, 0x00,0x00,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23253, 14687, 0, 0, 0x00,0x00,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23284, 14687, 0, 0, 0x00,0x00,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23315, 14687, 0, 0, 0x00,0x00,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23346, 14687, 0, 0, 0x00,0x00,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23381, 14687, 0, 0, 0x00,0x01,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23416, 14687, 0, 0, 0x00,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23451, 14687, 0, 0, 0x00,0x01,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23482, 14687, 0, 0, 0x00,0x01,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23517, 14687, 0, 0, 0x00,0x01,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23548, 14687, 0, 0, 0x00,0x01,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23579, 14687, 0, 0, 0x00,0x01,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23610, 14687, 0, 0, 0x00,0x01,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23645, 14687, 0, 0, 0x00,0x06,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23680, 14687, 0, 0, 0x00,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23715, 14687, 0, 0, 0x00,0x06,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {23746, 14687, 0, 0, 0x00,0x06,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {23781, 14687, 0, 0, 0x00,0x06,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {23812, 14687, 0, 0, 0x00,0x06,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {23843, 14687, 0, 0, 0x00,0x06,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {23874, 14687, 0, 0, 0x00,0x06,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {23909, 14687, 0, 0, 0x00,0x07,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {23944, 14687, 0, 0, 0x00,0x07,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {23979, 14687, 0, 0, 0x00,0x07,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24010, 14687, 0, 0, 0x00,0x07,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24045, 14687, 0, 0, 0x00,0x07,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24076, 14687, 0, 0, 0x00,0x07,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24107, 14687, 0, 0, 0x00,0x07,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24138, 14687, 0, 0, 0x00,0x07,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24173, 14687, 0, 0, 0x00,0x0C,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24208, 14687, 0, 0, 0x00,0x0C,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24243, 14687, 0, 0, 0x00,0x0C,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24274, 14687, 0, 0, 0x00,0x0C,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24309, 14687, 0, 0, 0x00,0x0C,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24340, 14687, 0, 0, 0x00,0x0C,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24371, 14687, 0, 0, 0x00,0x0C,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24402, 14687, 0, 0, 0x00,0x0C,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24437, 14687, 0, 0, 0x00,0x0D,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24472, 14687, 0, 0, 0x00,0x0D,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24507, 14687, 0, 0, 0x00,0x0D,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24538, 14687, 0, 0, 0x00,0x0D,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24573, 14687, 0, 0, 0x00,0x0D,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24604, 14687, 0, 0, 0x00,0x0D,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24635, 14687, 0, 0, 0x00,0x0D,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24666, 14687, 0, 0, 0x00,0x0D,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24701, 14687, 0, 0, 0x00,0x12,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {24736, 14687, 0, 0, 0x00,0x12,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {24771, 14687, 0, 0, 0x00,0x12,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {24802, 14687, 0, 0, 0x00,0x12,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {24837, 14687, 0, 0, 0x00,0x12,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {24868, 14687, 0, 0, 0x00,0x12,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {24899, 14687, 0, 0, 0x00,0x12,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {24930, 14687, 0, 0, 0x00,0x12,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {24965, 14687, 0, 0, 0x00,0x13,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25000, 14687, 0, 0, 0x00,0x13,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25035, 14687, 0, 0, 0x00,0x13,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25066, 14687, 0, 0, 0x00,0x13,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25101, 14687, 0, 0, 0x00,0x13,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25132, 14687, 0, 0, 0x00,0x13,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25163, 14687, 0, 0, 0x00,0x13,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25194, 14687, 0, 0, 0x00,0x13,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25229, 16717, 0, 0, 0x00,0x00,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25264, 16717, 0, 0, 0x00,0x00,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25299, 16717, 0, 0, 0x00,0x00,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25330, 16717, 0, 0, 0x00,0x00,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25365, 16717, 0, 0, 0x00,0x00,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25396, 16717, 0, 0, 0x00,0x00,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25427, 16717, 0, 0, 0x00,0x00,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25458, 16717, 0, 0, 0x00,0x00,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25493, 16717, 0, 0, 0x00,0x01,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25528, 16717, 0, 0, 0x00,0x01,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25563, 16717, 0, 0, 0x00,0x01,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25594, 16717, 0, 0, 0x00,0x01,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25629, 16717, 0, 0, 0x00,0x01,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25660, 16717, 0, 0, 0x00,0x01,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25691, 16717, 0, 0, 0x00,0x01,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25722, 16717, 0, 0, 0x00,0x01,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {25757, 16717, 0, 0, 0x00,0x06,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {25792, 16717, 0, 0, 0x00,0x06,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {25827, 16717, 0, 0, 0x00,0x06,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {25858, 16717, 0, 0, 0x00,0x06,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {25893, 16717, 0, 0, 0x00,0x06,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {25924, 16717, 0, 0, 0x00,0x06,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {25955, 16717, 0, 0, 0x00,0x06,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {25986, 16717, 0, 0, 0x00,0x06,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {26021, 16717, 0, 0, 0x00,0x07,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {26056, 16717, 0, 0, 0x00,0x07,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {26091, 16717, 0, 0, 0x00,0x07,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {26122, 16717, 0, 0, 0x00,0x07,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {26157, 16717, 0, 0, 0x00,0x07,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {26188, 16717, 0, 0, 0x00,0x07,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {26219, 16717, 0, 0, 0x00,0x07,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {26250, 16717, 0, 0, 0x00,0x07,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {26285, 16717, 0, 0, 0x00,0x0C,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {26320, 16717, 0, 0, 0x00,0x0C,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {26355, 16717, 0, 0, 0x00,0x0C,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {26386, 16717, 0, 0, 0x00,0x0C,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {26421, 16717, 0, 0, 0x00,0x0C,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {26452, 16717, 0, 0, 0x00,0x0C,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {26483, 16717, 0, 0, 0x00,0x0C,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {26514, 16717, 0, 0, 0x00,0x0C,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {26549, 16717, 0, 0, 0x00,0x0D,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {26584, 16717, 0, 0, 0x00,0x0D,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {26619, 16717, 0, 0, 0x00,0x0D,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {26650, 16717, 0, 0, 0x00,0x0D,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {26685, 16717, 0, 0, 0x00,0x0D,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {26716, 16717, 0, 0, 0x00,0x0D,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {26747, 16717, 0, 0, 0x00,0x0D,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {26778, 16717, 0, 0, 0x00,0x0D,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {26813, 16717, 0, 0, 0x00,0x12,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {26848, 16717, 0, 0, 0x00,0x12,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {26883, 16717, 0, 0, 0x00,0x12,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {26914, 16717, 0, 0, 0x00,0x12,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {26949, 16717, 0, 0, 0x00,0x12,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {26980, 16717, 0, 0, 0x00,0x12,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {27011, 16717, 0, 0, 0x00,0x12,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {27042, 16717, 0, 0, 0x00,0x12,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {27077, 16717, 0, 0, 0x00,0x13,0x01,0x11,EVENT_OPTION_NONE_MASK}
+, {27112, 16717, 0, 0, 0x00,0x13,0x02,0x11,EVENT_OPTION_NONE_MASK}
+, {27147, 16717, 0, 0, 0x00,0x13,0x03,0x11,EVENT_OPTION_NONE_MASK}
+, {27178, 16717, 0, 0, 0x00,0x13,0x04,0x11,EVENT_OPTION_NONE_MASK}
+, {27213, 16717, 0, 0, 0x00,0x13,0x05,0x11,EVENT_OPTION_NONE_MASK}
+, {27244, 16717, 0, 0, 0x00,0x13,0x06,0x11,EVENT_OPTION_NONE_MASK}
+, {27275, 16717, 0, 0, 0x00,0x13,0x07,0x11,EVENT_OPTION_NONE_MASK}
+, {27306, 16717, 0, 0, 0x00,0x13,0x08,0x11,EVENT_OPTION_NONE_MASK}
+, {27341, 14687, 0, 0, 0x00,0x00,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27369, 14687, 0, 0, 0x00,0x01,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27397, 14687, 0, 0, 0x00,0x06,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27425, 14687, 0, 0, 0x00,0x07,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27453, 14687, 0, 0, 0x00,0x0C,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27481, 14687, 0, 0, 0x00,0x0D,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27509, 14687, 0, 0, 0x00,0x12,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27537, 14687, 0, 0, 0x00,0x13,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27565, 16717, 0, 0, 0x00,0x00,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27593, 16717, 0, 0, 0x00,0x01,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27621, 16717, 0, 0, 0x00,0x06,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27649, 16717, 0, 0, 0x00,0x07,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27677, 16717, 0, 0, 0x00,0x0C,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27705, 16717, 0, 0, 0x00,0x0D,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27733, 16717, 0, 0, 0x00,0x12,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27761, 16717, 0, 0, 0x00,0x13,0x01,0x18,EVENT_OPTION_NONE_MASK}
+, {27789, 14687, 0, 0, 0x00,0x00,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27818, 14687, 0, 0, 0x00,0x01,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27847, 14687, 0, 0, 0x00,0x06,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27876, 14687, 0, 0, 0x00,0x07,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27905, 14687, 0, 0, 0x00,0x0C,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27934, 14687, 0, 0, 0x00,0x0D,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27963, 14687, 0, 0, 0x00,0x12,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {27992, 14687, 0, 0, 0x00,0x13,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28021, 16717, 0, 0, 0x00,0x00,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28050, 16717, 0, 0, 0x00,0x01,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28079, 16717, 0, 0, 0x00,0x06,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28108, 16717, 0, 0, 0x00,0x07,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28137, 16717, 0, 0, 0x00,0x0C,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28166, 16717, 0, 0, 0x00,0x0D,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28195, 16717, 0, 0, 0x00,0x12,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28224, 16717, 0, 0, 0x00,0x13,0x01,0x19,EVENT_OPTION_NONE_MASK}
+, {28253, 14687, 0, 0, 0x00,0x00,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28277, 14687, 0, 0, 0x00,0x01,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28301, 14687, 0, 0, 0x00,0x06,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28325, 14687, 0, 0, 0x00,0x07,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28349, 14687, 0, 0, 0x00,0x0C,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28373, 14687, 0, 0, 0x00,0x0D,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28397, 14687, 0, 0, 0x00,0x12,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28421, 14687, 0, 0, 0x00,0x13,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28445, 16717, 0, 0, 0x00,0x00,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28469, 16717, 0, 0, 0x00,0x01,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28493, 16717, 0, 0, 0x00,0x06,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28517, 16717, 0, 0, 0x00,0x07,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28541, 16717, 0, 0, 0x00,0x0C,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28565, 16717, 0, 0, 0x00,0x0D,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28589, 16717, 0, 0, 0x00,0x12,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28613, 16717, 0, 0, 0x00,0x13,0x01,0x1F,EVENT_OPTION_NONE_MASK}
+, {28637, 14687, 0, 0, 0x01,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28663, 14687, 0, 0, 0x01,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28689, 14687, 0, 0, 0x01,0x08,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28715, 14687, 0, 0, 0x01,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28741, 14687, 0, 0, 0x01,0x0E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28767, 14687, 0, 0, 0x01,0x0F,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28793, 14687, 0, 0, 0x01,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28819, 14687, 0, 0, 0x01,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28845, 16717, 0, 0, 0x01,0x02,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28871, 16717, 0, 0, 0x01,0x03,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28897, 16717, 0, 0, 0x01,0x08,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28923, 16717, 0, 0, 0x01,0x09,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28949, 16717, 0, 0, 0x01,0x0E,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {28975, 16717, 0, 0, 0x01,0x0F,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {29001, 16717, 0, 0, 0x01,0x14,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {29027, 16717, 0, 0, 0x01,0x15,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {29053, 14687, 0, 0, 0x01,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {29092, 14687, 0, 0, 0x01,0x02,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {29131, 14687, 0, 0, 0x01,0x02,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {29170, 14687, 0, 0, 0x01,0x02,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {29209, 14687, 0, 0, 0x01,0x02,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {29248, 14687, 0, 0, 0x01,0x02,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {29287, 14687, 0, 0, 0x01,0x02,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {29326, 14687, 0, 0, 0x01,0x02,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {29365, 14687, 0, 0, 0x01,0x02,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {29404, 14687, 0, 0, 0x01,0x02,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {29443, 14687, 0, 0, 0x01,0x02,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {29482, 14687, 0, 0, 0x01,0x02,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {29521, 14687, 0, 0, 0x01,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {29560, 14687, 0, 0, 0x01,0x03,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {29599, 14687, 0, 0, 0x01,0x03,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {29638, 14687, 0, 0, 0x01,0x03,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {29677, 14687, 0, 0, 0x01,0x03,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {29716, 14687, 0, 0, 0x01,0x03,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {29755, 14687, 0, 0, 0x01,0x03,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {29794, 14687, 0, 0, 0x01,0x03,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {29833, 14687, 0, 0, 0x01,0x03,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {29872, 14687, 0, 0, 0x01,0x03,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {29911, 14687, 0, 0, 0x01,0x03,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {29950, 14687, 0, 0, 0x01,0x03,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {29989, 14687, 0, 0, 0x01,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {30028, 14687, 0, 0, 0x01,0x08,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {30067, 14687, 0, 0, 0x01,0x08,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {30106, 14687, 0, 0, 0x01,0x08,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {30145, 14687, 0, 0, 0x01,0x08,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {30184, 14687, 0, 0, 0x01,0x08,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {30223, 14687, 0, 0, 0x01,0x08,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {30262, 14687, 0, 0, 0x01,0x08,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {30301, 14687, 0, 0, 0x01,0x08,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {30340, 14687, 0, 0, 0x01,0x08,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {30379, 14687, 0, 0, 0x01,0x08,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {30418, 14687, 0, 0, 0x01,0x08,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {30457, 14687, 0, 0, 0x01,0x09,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {30496, 14687, 0, 0, 0x01,0x09,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {30535, 14687, 0, 0, 0x01,0x09,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {30574, 14687, 0, 0, 0x01,0x09,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {30613, 14687, 0, 0, 0x01,0x09,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {30652, 14687, 0, 0, 0x01,0x09,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {30691, 14687, 0, 0, 0x01,0x09,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {30730, 14687, 0, 0, 0x01,0x09,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {30769, 14687, 0, 0, 0x01,0x09,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {30808, 14687, 0, 0, 0x01,0x09,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {30847, 14687, 0, 0, 0x01,0x09,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {30886, 14687, 0, 0, 0x01,0x09,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {30925, 14687, 0, 0, 0x01,0x0E,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {30964, 14687, 0, 0, 0x01,0x0E,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {31003, 14687, 0, 0, 0x01,0x0E,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {31042, 14687, 0, 0, 0x01,0x0E,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {31081, 14687, 0, 0, 0x01,0x0E,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {31120, 14687, 0, 0, 0x01,0x0E,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {31159, 14687, 0, 0, 0x01,0x0E,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {31198, 14687, 0, 0, 0x01,0x0E,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {31237, 14687, 0, 0, 0x01,0x0E,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {31276, 14687, 0, 0, 0x01,0x0E,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {31315, 14687, 0, 0, 0x01,0x0E,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {31354, 14687, 0, 0, 0x01,0x0E,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {31393, 14687, 0, 0, 0x01,0x0F,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {31432, 14687, 0, 0, 0x01,0x0F,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {31471, 14687, 0, 0, 0x01,0x0F,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {31510, 14687, 0, 0, 0x01,0x0F,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {31549, 14687, 0, 0, 0x01,0x0F,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {31588, 14687, 0, 0, 0x01,0x0F,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {31627, 14687, 0, 0, 0x01,0x0F,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {31666, 14687, 0, 0, 0x01,0x0F,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {31705, 14687, 0, 0, 0x01,0x0F,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {31744, 14687, 0, 0, 0x01,0x0F,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {31783, 14687, 0, 0, 0x01,0x0F,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {31822, 14687, 0, 0, 0x01,0x0F,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {31861, 14687, 0, 0, 0x01,0x14,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {31900, 14687, 0, 0, 0x01,0x14,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {31939, 14687, 0, 0, 0x01,0x14,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {31978, 14687, 0, 0, 0x01,0x14,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {32017, 14687, 0, 0, 0x01,0x14,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {32056, 14687, 0, 0, 0x01,0x14,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {32095, 14687, 0, 0, 0x01,0x14,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {32134, 14687, 0, 0, 0x01,0x14,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {32173, 14687, 0, 0, 0x01,0x14,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {32212, 14687, 0, 0, 0x01,0x14,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {32251, 14687, 0, 0, 0x01,0x14,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {32290, 14687, 0, 0, 0x01,0x14,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {32329, 14687, 0, 0, 0x01,0x15,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {32368, 14687, 0, 0, 0x01,0x15,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {32407, 14687, 0, 0, 0x01,0x15,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {32446, 14687, 0, 0, 0x01,0x15,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {32485, 14687, 0, 0, 0x01,0x15,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {32524, 14687, 0, 0, 0x01,0x15,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {32563, 14687, 0, 0, 0x01,0x15,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {32602, 14687, 0, 0, 0x01,0x15,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {32641, 14687, 0, 0, 0x01,0x15,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {32680, 14687, 0, 0, 0x01,0x15,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {32719, 14687, 0, 0, 0x01,0x15,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {32758, 14687, 0, 0, 0x01,0x15,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {32797, 16717, 0, 0, 0x01,0x02,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {32836, 16717, 0, 0, 0x01,0x02,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {32875, 16717, 0, 0, 0x01,0x02,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {32914, 16717, 0, 0, 0x01,0x02,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {32953, 16717, 0, 0, 0x01,0x02,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {32992, 16717, 0, 0, 0x01,0x02,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {33031, 16717, 0, 0, 0x01,0x02,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {33070, 16717, 0, 0, 0x01,0x02,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {33109, 16717, 0, 0, 0x01,0x02,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {33148, 16717, 0, 0, 0x01,0x02,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {33187, 16717, 0, 0, 0x01,0x02,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {33226, 16717, 0, 0, 0x01,0x02,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {33265, 16717, 0, 0, 0x01,0x03,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {33304, 16717, 0, 0, 0x01,0x03,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {33343, 16717, 0, 0, 0x01,0x03,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {33382, 16717, 0, 0, 0x01,0x03,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {33421, 16717, 0, 0, 0x01,0x03,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {33460, 16717, 0, 0, 0x01,0x03,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {33499, 16717, 0, 0, 0x01,0x03,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {33538, 16717, 0, 0, 0x01,0x03,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {33577, 16717, 0, 0, 0x01,0x03,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {33616, 16717, 0, 0, 0x01,0x03,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {33655, 16717, 0, 0, 0x01,0x03,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {33694, 16717, 0, 0, 0x01,0x03,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {33733, 16717, 0, 0, 0x01,0x08,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {33772, 16717, 0, 0, 0x01,0x08,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {33811, 16717, 0, 0, 0x01,0x08,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {33850, 16717, 0, 0, 0x01,0x08,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {33889, 16717, 0, 0, 0x01,0x08,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {33928, 16717, 0, 0, 0x01,0x08,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {33967, 16717, 0, 0, 0x01,0x08,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {34006, 16717, 0, 0, 0x01,0x08,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {34045, 16717, 0, 0, 0x01,0x08,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {34084, 16717, 0, 0, 0x01,0x08,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {34123, 16717, 0, 0, 0x01,0x08,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {34162, 16717, 0, 0, 0x01,0x08,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {34201, 16717, 0, 0, 0x01,0x09,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {34240, 16717, 0, 0, 0x01,0x09,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {34279, 16717, 0, 0, 0x01,0x09,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {34318, 16717, 0, 0, 0x01,0x09,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {34357, 16717, 0, 0, 0x01,0x09,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {34396, 16717, 0, 0, 0x01,0x09,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {34435, 16717, 0, 0, 0x01,0x09,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {34474, 16717, 0, 0, 0x01,0x09,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {34513, 16717, 0, 0, 0x01,0x09,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {34552, 16717, 0, 0, 0x01,0x09,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {34591, 16717, 0, 0, 0x01,0x09,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {34630, 16717, 0, 0, 0x01,0x09,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {34669, 16717, 0, 0, 0x01,0x0E,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {34708, 16717, 0, 0, 0x01,0x0E,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {34747, 16717, 0, 0, 0x01,0x0E,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {34786, 16717, 0, 0, 0x01,0x0E,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {34825, 16717, 0, 0, 0x01,0x0E,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {34864, 16717, 0, 0, 0x01,0x0E,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {34903, 16717, 0, 0, 0x01,0x0E,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {34942, 16717, 0, 0, 0x01,0x0E,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {34981, 16717, 0, 0, 0x01,0x0E,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {35020, 16717, 0, 0, 0x01,0x0E,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {35059, 16717, 0, 0, 0x01,0x0E,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {35098, 16717, 0, 0, 0x01,0x0E,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {35137, 16717, 0, 0, 0x01,0x0F,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {35176, 16717, 0, 0, 0x01,0x0F,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {35215, 16717, 0, 0, 0x01,0x0F,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {35254, 16717, 0, 0, 0x01,0x0F,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {35293, 16717, 0, 0, 0x01,0x0F,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {35332, 16717, 0, 0, 0x01,0x0F,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {35371, 16717, 0, 0, 0x01,0x0F,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {35410, 16717, 0, 0, 0x01,0x0F,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {35449, 16717, 0, 0, 0x01,0x0F,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {35488, 16717, 0, 0, 0x01,0x0F,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {35527, 16717, 0, 0, 0x01,0x0F,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {35566, 16717, 0, 0, 0x01,0x0F,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {35605, 16717, 0, 0, 0x01,0x14,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {35644, 16717, 0, 0, 0x01,0x14,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {35683, 16717, 0, 0, 0x01,0x14,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {35722, 16717, 0, 0, 0x01,0x14,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {35761, 16717, 0, 0, 0x01,0x14,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {35800, 16717, 0, 0, 0x01,0x14,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {35839, 16717, 0, 0, 0x01,0x14,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {35878, 16717, 0, 0, 0x01,0x14,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {35917, 16717, 0, 0, 0x01,0x14,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {35956, 16717, 0, 0, 0x01,0x14,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {35995, 16717, 0, 0, 0x01,0x14,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {36034, 16717, 0, 0, 0x01,0x14,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {36073, 16717, 0, 0, 0x01,0x15,0x05,0x00,EVENT_OPTION_NONE_MASK}
+, {36112, 16717, 0, 0, 0x01,0x15,0x05,0x01,EVENT_OPTION_NONE_MASK}
+, {36151, 16717, 0, 0, 0x01,0x15,0x05,0x02,EVENT_OPTION_NONE_MASK}
+, {36190, 16717, 0, 0, 0x01,0x15,0x05,0x03,EVENT_OPTION_NONE_MASK}
+, {36229, 16717, 0, 0, 0x01,0x15,0x05,0x04,EVENT_OPTION_NONE_MASK}
+, {36268, 16717, 0, 0, 0x01,0x15,0x05,0x05,EVENT_OPTION_NONE_MASK}
+, {36307, 16717, 0, 0, 0x01,0x15,0x05,0x08,EVENT_OPTION_NONE_MASK}
+, {36346, 16717, 0, 0, 0x01,0x15,0x05,0x09,EVENT_OPTION_NONE_MASK}
+, {36385, 16717, 0, 0, 0x01,0x15,0x05,0x0A,EVENT_OPTION_NONE_MASK}
+, {36424, 16717, 0, 0, 0x01,0x15,0x05,0x0B,EVENT_OPTION_NONE_MASK}
+, {36463, 16717, 0, 0, 0x01,0x15,0x05,0x0C,EVENT_OPTION_NONE_MASK}
+, {36502, 16717, 0, 0, 0x01,0x15,0x05,0x0D,EVENT_OPTION_NONE_MASK}
+, {36541, 14687, 0, 0, 0x00,0x00,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36569, 14687, 0, 0, 0x00,0x01,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36597, 14687, 0, 0, 0x00,0x06,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36625, 14687, 0, 0, 0x00,0x07,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36653, 14687, 0, 0, 0x00,0x0C,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36681, 14687, 0, 0, 0x00,0x0D,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36709, 14687, 0, 0, 0x00,0x12,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36737, 14687, 0, 0, 0x00,0x13,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36765, 16717, 0, 0, 0x00,0x00,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36793, 16717, 0, 0, 0x00,0x01,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36821, 16717, 0, 0, 0x00,0x06,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36849, 16717, 0, 0, 0x00,0x07,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36877, 16717, 0, 0, 0x00,0x0C,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36905, 16717, 0, 0, 0x00,0x0D,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36933, 16717, 0, 0, 0x00,0x12,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36961, 16717, 0, 0, 0x00,0x13,0x01,0x08,EVENT_OPTION_NONE_MASK}
+, {36989, 14687, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37014, 14687, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37039, 14687, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37064, 14687, 0, 0, 0x01,0x09,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37089, 14687, 0, 0, 0x01,0x0E,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37114, 14687, 0, 0, 0x01,0x0F,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37139, 14687, 0, 0, 0x01,0x14,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37164, 14687, 0, 0, 0x01,0x15,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37189, 16717, 0, 0, 0x01,0x02,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37214, 16717, 0, 0, 0x01,0x03,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37239, 16717, 0, 0, 0x01,0x08,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37264, 16717, 0, 0, 0x01,0x09,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37289, 16717, 0, 0, 0x01,0x0E,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37314, 16717, 0, 0, 0x01,0x0F,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37339, 16717, 0, 0, 0x01,0x14,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37364, 16717, 0, 0, 0x01,0x15,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37389, 14687, 0, 0, 0x01,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37419, 14687, 0, 0, 0x01,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37449, 14687, 0, 0, 0x01,0x08,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37479, 14687, 0, 0, 0x01,0x09,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37509, 14687, 0, 0, 0x01,0x0E,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37539, 14687, 0, 0, 0x01,0x0F,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37569, 14687, 0, 0, 0x01,0x14,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37599, 14687, 0, 0, 0x01,0x15,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37629, 16717, 0, 0, 0x01,0x02,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37659, 16717, 0, 0, 0x01,0x03,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37689, 16717, 0, 0, 0x01,0x08,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37719, 16717, 0, 0, 0x01,0x09,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37749, 16717, 0, 0, 0x01,0x0E,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37779, 16717, 0, 0, 0x01,0x0F,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37809, 16717, 0, 0, 0x01,0x14,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37839, 16717, 0, 0, 0x01,0x15,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37869, 14687, 0, 0, 0x00,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {37907, 14687, 0, 0, 0x00,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {37945, 14687, 0, 0, 0x00,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {37983, 14687, 0, 0, 0x00,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {38021, 14687, 0, 0, 0x00,0x00,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {38059, 14687, 0, 0, 0x00,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {38097, 14687, 0, 0, 0x00,0x00,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {38135, 14687, 0, 0, 0x00,0x00,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {38173, 14687, 0, 0, 0x00,0x00,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {38211, 14687, 0, 0, 0x00,0x00,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {38249, 14687, 0, 0, 0x00,0x00,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {38287, 14687, 0, 0, 0x00,0x00,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {38325, 14687, 0, 0, 0x00,0x00,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {38363, 14687, 0, 0, 0x00,0x00,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {38401, 14687, 0, 0, 0x00,0x00,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {38439, 14687, 0, 0, 0x00,0x00,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {38477, 14687, 0, 0, 0x00,0x00,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {38515, 14687, 0, 0, 0x00,0x00,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {38553, 14687, 0, 0, 0x00,0x00,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {38591, 14687, 0, 0, 0x00,0x00,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {38629, 14687, 0, 0, 0x00,0x00,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {38667, 14687, 0, 0, 0x00,0x00,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {38705, 14687, 0, 0, 0x00,0x00,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {38743, 14687, 0, 0, 0x00,0x00,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {38781, 14687, 0, 0, 0x00,0x00,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {38819, 14687, 0, 0, 0x00,0x00,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {38857, 14687, 0, 0, 0x00,0x00,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {38895, 14687, 0, 0, 0x00,0x00,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {38933, 14687, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {38971, 14687, 0, 0, 0x00,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {39009, 14687, 0, 0, 0x00,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {39047, 14687, 0, 0, 0x00,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {39085, 14687, 0, 0, 0x00,0x01,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {39123, 14687, 0, 0, 0x00,0x01,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {39161, 14687, 0, 0, 0x00,0x01,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {39199, 14687, 0, 0, 0x00,0x01,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {39237, 14687, 0, 0, 0x00,0x01,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {39275, 14687, 0, 0, 0x00,0x01,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {39313, 14687, 0, 0, 0x00,0x01,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {39351, 14687, 0, 0, 0x00,0x01,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {39389, 14687, 0, 0, 0x00,0x01,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {39427, 14687, 0, 0, 0x00,0x01,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {39465, 14687, 0, 0, 0x00,0x01,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {39503, 14687, 0, 0, 0x00,0x01,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {39541, 14687, 0, 0, 0x00,0x01,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {39579, 14687, 0, 0, 0x00,0x01,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {39617, 14687, 0, 0, 0x00,0x01,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {39655, 14687, 0, 0, 0x00,0x01,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {39693, 14687, 0, 0, 0x00,0x01,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {39731, 14687, 0, 0, 0x00,0x01,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {39769, 14687, 0, 0, 0x00,0x01,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {39807, 14687, 0, 0, 0x00,0x01,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {39845, 14687, 0, 0, 0x00,0x01,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {39883, 14687, 0, 0, 0x00,0x01,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {39921, 14687, 0, 0, 0x00,0x01,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {39959, 14687, 0, 0, 0x00,0x01,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {39997, 14687, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {40035, 14687, 0, 0, 0x00,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {40073, 14687, 0, 0, 0x00,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {40111, 14687, 0, 0, 0x00,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {40149, 14687, 0, 0, 0x00,0x06,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {40187, 14687, 0, 0, 0x00,0x06,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {40225, 14687, 0, 0, 0x00,0x06,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {40263, 14687, 0, 0, 0x00,0x06,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {40301, 14687, 0, 0, 0x00,0x06,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {40339, 14687, 0, 0, 0x00,0x06,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {40377, 14687, 0, 0, 0x00,0x06,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {40415, 14687, 0, 0, 0x00,0x06,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {40453, 14687, 0, 0, 0x00,0x06,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {40491, 14687, 0, 0, 0x00,0x06,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {40529, 14687, 0, 0, 0x00,0x06,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {40567, 14687, 0, 0, 0x00,0x06,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {40605, 14687, 0, 0, 0x00,0x06,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {40643, 14687, 0, 0, 0x00,0x06,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {40681, 14687, 0, 0, 0x00,0x06,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {40719, 14687, 0, 0, 0x00,0x06,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {40757, 14687, 0, 0, 0x00,0x06,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {40795, 14687, 0, 0, 0x00,0x06,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {40833, 14687, 0, 0, 0x00,0x06,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {40871, 14687, 0, 0, 0x00,0x06,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {40909, 14687, 0, 0, 0x00,0x06,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {40947, 14687, 0, 0, 0x00,0x06,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {40985, 14687, 0, 0, 0x00,0x06,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {41023, 14687, 0, 0, 0x00,0x06,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {41061, 14687, 0, 0, 0x00,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {41099, 14687, 0, 0, 0x00,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {41137, 14687, 0, 0, 0x00,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {41175, 14687, 0, 0, 0x00,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {41213, 14687, 0, 0, 0x00,0x07,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {41251, 14687, 0, 0, 0x00,0x07,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {41289, 14687, 0, 0, 0x00,0x07,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {41327, 14687, 0, 0, 0x00,0x07,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {41365, 14687, 0, 0, 0x00,0x07,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {41403, 14687, 0, 0, 0x00,0x07,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {41441, 14687, 0, 0, 0x00,0x07,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {41479, 14687, 0, 0, 0x00,0x07,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {41517, 14687, 0, 0, 0x00,0x07,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {41555, 14687, 0, 0, 0x00,0x07,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {41593, 14687, 0, 0, 0x00,0x07,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {41631, 14687, 0, 0, 0x00,0x07,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {41669, 14687, 0, 0, 0x00,0x07,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {41707, 14687, 0, 0, 0x00,0x07,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {41745, 14687, 0, 0, 0x00,0x07,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {41783, 14687, 0, 0, 0x00,0x07,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {41821, 14687, 0, 0, 0x00,0x07,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {41859, 14687, 0, 0, 0x00,0x07,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {41897, 14687, 0, 0, 0x00,0x07,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {41935, 14687, 0, 0, 0x00,0x07,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {41973, 14687, 0, 0, 0x00,0x07,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {42011, 14687, 0, 0, 0x00,0x07,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {42049, 14687, 0, 0, 0x00,0x07,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {42087, 14687, 0, 0, 0x00,0x07,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {42125, 14687, 0, 0, 0x00,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {42163, 14687, 0, 0, 0x00,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {42201, 14687, 0, 0, 0x00,0x0C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {42239, 14687, 0, 0, 0x00,0x0C,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {42277, 14687, 0, 0, 0x00,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {42315, 14687, 0, 0, 0x00,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {42353, 14687, 0, 0, 0x00,0x0C,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {42391, 14687, 0, 0, 0x00,0x0C,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {42429, 14687, 0, 0, 0x00,0x0C,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {42467, 14687, 0, 0, 0x00,0x0C,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {42505, 14687, 0, 0, 0x00,0x0C,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {42543, 14687, 0, 0, 0x00,0x0C,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {42581, 14687, 0, 0, 0x00,0x0C,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {42619, 14687, 0, 0, 0x00,0x0C,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {42657, 14687, 0, 0, 0x00,0x0C,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {42695, 14687, 0, 0, 0x00,0x0C,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {42733, 14687, 0, 0, 0x00,0x0C,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {42771, 14687, 0, 0, 0x00,0x0C,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {42809, 14687, 0, 0, 0x00,0x0C,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {42847, 14687, 0, 0, 0x00,0x0C,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {42885, 14687, 0, 0, 0x00,0x0C,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {42923, 14687, 0, 0, 0x00,0x0C,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {42961, 14687, 0, 0, 0x00,0x0C,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {42999, 14687, 0, 0, 0x00,0x0C,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {43037, 14687, 0, 0, 0x00,0x0C,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {43075, 14687, 0, 0, 0x00,0x0C,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {43113, 14687, 0, 0, 0x00,0x0C,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {43151, 14687, 0, 0, 0x00,0x0C,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {43189, 14687, 0, 0, 0x00,0x0D,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {43227, 14687, 0, 0, 0x00,0x0D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {43265, 14687, 0, 0, 0x00,0x0D,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {43303, 14687, 0, 0, 0x00,0x0D,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {43341, 14687, 0, 0, 0x00,0x0D,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {43379, 14687, 0, 0, 0x00,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {43417, 14687, 0, 0, 0x00,0x0D,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {43455, 14687, 0, 0, 0x00,0x0D,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {43493, 14687, 0, 0, 0x00,0x0D,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {43531, 14687, 0, 0, 0x00,0x0D,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {43569, 14687, 0, 0, 0x00,0x0D,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {43607, 14687, 0, 0, 0x00,0x0D,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {43645, 14687, 0, 0, 0x00,0x0D,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {43683, 14687, 0, 0, 0x00,0x0D,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {43721, 14687, 0, 0, 0x00,0x0D,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {43759, 14687, 0, 0, 0x00,0x0D,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {43797, 14687, 0, 0, 0x00,0x0D,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {43835, 14687, 0, 0, 0x00,0x0D,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {43873, 14687, 0, 0, 0x00,0x0D,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {43911, 14687, 0, 0, 0x00,0x0D,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {43949, 14687, 0, 0, 0x00,0x0D,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {43987, 14687, 0, 0, 0x00,0x0D,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {44025, 14687, 0, 0, 0x00,0x0D,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {44063, 14687, 0, 0, 0x00,0x0D,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {44101, 14687, 0, 0, 0x00,0x0D,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {44139, 14687, 0, 0, 0x00,0x0D,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {44177, 14687, 0, 0, 0x00,0x0D,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {44215, 14687, 0, 0, 0x00,0x0D,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {44253, 14687, 0, 0, 0x00,0x12,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {44291, 14687, 0, 0, 0x00,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {44329, 14687, 0, 0, 0x00,0x12,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {44367, 14687, 0, 0, 0x00,0x12,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {44405, 14687, 0, 0, 0x00,0x12,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {44443, 14687, 0, 0, 0x00,0x12,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {44481, 14687, 0, 0, 0x00,0x12,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {44519, 14687, 0, 0, 0x00,0x12,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {44557, 14687, 0, 0, 0x00,0x12,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {44595, 14687, 0, 0, 0x00,0x12,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {44633, 14687, 0, 0, 0x00,0x12,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {44671, 14687, 0, 0, 0x00,0x12,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {44709, 14687, 0, 0, 0x00,0x12,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {44747, 14687, 0, 0, 0x00,0x12,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {44785, 14687, 0, 0, 0x00,0x12,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {44823, 14687, 0, 0, 0x00,0x12,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {44861, 14687, 0, 0, 0x00,0x12,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {44899, 14687, 0, 0, 0x00,0x12,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {44937, 14687, 0, 0, 0x00,0x12,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {44975, 14687, 0, 0, 0x00,0x12,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {45013, 14687, 0, 0, 0x00,0x12,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {45051, 14687, 0, 0, 0x00,0x12,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {45089, 14687, 0, 0, 0x00,0x12,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {45127, 14687, 0, 0, 0x00,0x12,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {45165, 14687, 0, 0, 0x00,0x12,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {45203, 14687, 0, 0, 0x00,0x12,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {45241, 14687, 0, 0, 0x00,0x12,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {45279, 14687, 0, 0, 0x00,0x12,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {45317, 14687, 0, 0, 0x00,0x13,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {45355, 14687, 0, 0, 0x00,0x13,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {45393, 14687, 0, 0, 0x00,0x13,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {45431, 14687, 0, 0, 0x00,0x13,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {45469, 14687, 0, 0, 0x00,0x13,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {45507, 14687, 0, 0, 0x00,0x13,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {45545, 14687, 0, 0, 0x00,0x13,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {45583, 14687, 0, 0, 0x00,0x13,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {45621, 14687, 0, 0, 0x00,0x13,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {45659, 14687, 0, 0, 0x00,0x13,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {45697, 14687, 0, 0, 0x00,0x13,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {45735, 14687, 0, 0, 0x00,0x13,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {45773, 14687, 0, 0, 0x00,0x13,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {45811, 14687, 0, 0, 0x00,0x13,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {45849, 14687, 0, 0, 0x00,0x13,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {45887, 14687, 0, 0, 0x00,0x13,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {45925, 14687, 0, 0, 0x00,0x13,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {45963, 14687, 0, 0, 0x00,0x13,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {46001, 14687, 0, 0, 0x00,0x13,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {46039, 14687, 0, 0, 0x00,0x13,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {46077, 14687, 0, 0, 0x00,0x13,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {46115, 14687, 0, 0, 0x00,0x13,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {46153, 14687, 0, 0, 0x00,0x13,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {46191, 14687, 0, 0, 0x00,0x13,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {46229, 14687, 0, 0, 0x00,0x13,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {46267, 14687, 0, 0, 0x00,0x13,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {46305, 14687, 0, 0, 0x00,0x13,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {46343, 14687, 0, 0, 0x00,0x13,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {46381, 16717, 0, 0, 0x00,0x00,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {46419, 16717, 0, 0, 0x00,0x00,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {46457, 16717, 0, 0, 0x00,0x00,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {46495, 16717, 0, 0, 0x00,0x00,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {46533, 16717, 0, 0, 0x00,0x00,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {46571, 16717, 0, 0, 0x00,0x00,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {46609, 16717, 0, 0, 0x00,0x00,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {46647, 16717, 0, 0, 0x00,0x00,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {46685, 16717, 0, 0, 0x00,0x00,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {46723, 16717, 0, 0, 0x00,0x00,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {46761, 16717, 0, 0, 0x00,0x00,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {46799, 16717, 0, 0, 0x00,0x00,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {46837, 16717, 0, 0, 0x00,0x00,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {46875, 16717, 0, 0, 0x00,0x00,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {46913, 16717, 0, 0, 0x00,0x00,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {46951, 16717, 0, 0, 0x00,0x00,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {46989, 16717, 0, 0, 0x00,0x00,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {47027, 16717, 0, 0, 0x00,0x00,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {47065, 16717, 0, 0, 0x00,0x00,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {47103, 16717, 0, 0, 0x00,0x00,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {47141, 16717, 0, 0, 0x00,0x00,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {47179, 16717, 0, 0, 0x00,0x00,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {47217, 16717, 0, 0, 0x00,0x00,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {47255, 16717, 0, 0, 0x00,0x00,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {47293, 16717, 0, 0, 0x00,0x00,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {47331, 16717, 0, 0, 0x00,0x00,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {47369, 16717, 0, 0, 0x00,0x00,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {47407, 16717, 0, 0, 0x00,0x00,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {47445, 16717, 0, 0, 0x00,0x01,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {47483, 16717, 0, 0, 0x00,0x01,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {47521, 16717, 0, 0, 0x00,0x01,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {47559, 16717, 0, 0, 0x00,0x01,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {47597, 16717, 0, 0, 0x00,0x01,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {47635, 16717, 0, 0, 0x00,0x01,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {47673, 16717, 0, 0, 0x00,0x01,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {47711, 16717, 0, 0, 0x00,0x01,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {47749, 16717, 0, 0, 0x00,0x01,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {47787, 16717, 0, 0, 0x00,0x01,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {47825, 16717, 0, 0, 0x00,0x01,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {47863, 16717, 0, 0, 0x00,0x01,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {47901, 16717, 0, 0, 0x00,0x01,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {47939, 16717, 0, 0, 0x00,0x01,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {47977, 16717, 0, 0, 0x00,0x01,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {48015, 16717, 0, 0, 0x00,0x01,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {48053, 16717, 0, 0, 0x00,0x01,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {48091, 16717, 0, 0, 0x00,0x01,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {48129, 16717, 0, 0, 0x00,0x01,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {48167, 16717, 0, 0, 0x00,0x01,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {48205, 16717, 0, 0, 0x00,0x01,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {48243, 16717, 0, 0, 0x00,0x01,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {48281, 16717, 0, 0, 0x00,0x01,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {48319, 16717, 0, 0, 0x00,0x01,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {48357, 16717, 0, 0, 0x00,0x01,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {48395, 16717, 0, 0, 0x00,0x01,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {48433, 16717, 0, 0, 0x00,0x01,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {48471, 16717, 0, 0, 0x00,0x01,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {48509, 16717, 0, 0, 0x00,0x06,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {48547, 16717, 0, 0, 0x00,0x06,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {48585, 16717, 0, 0, 0x00,0x06,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {48623, 16717, 0, 0, 0x00,0x06,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {48661, 16717, 0, 0, 0x00,0x06,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {48699, 16717, 0, 0, 0x00,0x06,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {48737, 16717, 0, 0, 0x00,0x06,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {48775, 16717, 0, 0, 0x00,0x06,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {48813, 16717, 0, 0, 0x00,0x06,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {48851, 16717, 0, 0, 0x00,0x06,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {48889, 16717, 0, 0, 0x00,0x06,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {48927, 16717, 0, 0, 0x00,0x06,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {48965, 16717, 0, 0, 0x00,0x06,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {49003, 16717, 0, 0, 0x00,0x06,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {49041, 16717, 0, 0, 0x00,0x06,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {49079, 16717, 0, 0, 0x00,0x06,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {49117, 16717, 0, 0, 0x00,0x06,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {49155, 16717, 0, 0, 0x00,0x06,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {49193, 16717, 0, 0, 0x00,0x06,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {49231, 16717, 0, 0, 0x00,0x06,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {49269, 16717, 0, 0, 0x00,0x06,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {49307, 16717, 0, 0, 0x00,0x06,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {49345, 16717, 0, 0, 0x00,0x06,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {49383, 16717, 0, 0, 0x00,0x06,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {49421, 16717, 0, 0, 0x00,0x06,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {49459, 16717, 0, 0, 0x00,0x06,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {49497, 16717, 0, 0, 0x00,0x06,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {49535, 16717, 0, 0, 0x00,0x06,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {49573, 16717, 0, 0, 0x00,0x07,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {49611, 16717, 0, 0, 0x00,0x07,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {49649, 16717, 0, 0, 0x00,0x07,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {49687, 16717, 0, 0, 0x00,0x07,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {49725, 16717, 0, 0, 0x00,0x07,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {49763, 16717, 0, 0, 0x00,0x07,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {49801, 16717, 0, 0, 0x00,0x07,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {49839, 16717, 0, 0, 0x00,0x07,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {49877, 16717, 0, 0, 0x00,0x07,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {49915, 16717, 0, 0, 0x00,0x07,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {49953, 16717, 0, 0, 0x00,0x07,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {49991, 16717, 0, 0, 0x00,0x07,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {50029, 16717, 0, 0, 0x00,0x07,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {50067, 16717, 0, 0, 0x00,0x07,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {50105, 16717, 0, 0, 0x00,0x07,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {50143, 16717, 0, 0, 0x00,0x07,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {50181, 16717, 0, 0, 0x00,0x07,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {50219, 16717, 0, 0, 0x00,0x07,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {50257, 16717, 0, 0, 0x00,0x07,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {50295, 16717, 0, 0, 0x00,0x07,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {50333, 16717, 0, 0, 0x00,0x07,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {50371, 16717, 0, 0, 0x00,0x07,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {50409, 16717, 0, 0, 0x00,0x07,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {50447, 16717, 0, 0, 0x00,0x07,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {50485, 16717, 0, 0, 0x00,0x07,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {50523, 16717, 0, 0, 0x00,0x07,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {50561, 16717, 0, 0, 0x00,0x07,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {50599, 16717, 0, 0, 0x00,0x07,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {50637, 16717, 0, 0, 0x00,0x0C,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {50675, 16717, 0, 0, 0x00,0x0C,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {50713, 16717, 0, 0, 0x00,0x0C,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {50751, 16717, 0, 0, 0x00,0x0C,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {50789, 16717, 0, 0, 0x00,0x0C,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {50827, 16717, 0, 0, 0x00,0x0C,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {50865, 16717, 0, 0, 0x00,0x0C,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {50903, 16717, 0, 0, 0x00,0x0C,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {50941, 16717, 0, 0, 0x00,0x0C,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {50979, 16717, 0, 0, 0x00,0x0C,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {51017, 16717, 0, 0, 0x00,0x0C,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {51055, 16717, 0, 0, 0x00,0x0C,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {51093, 16717, 0, 0, 0x00,0x0C,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {51131, 16717, 0, 0, 0x00,0x0C,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {51169, 16717, 0, 0, 0x00,0x0C,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {51207, 16717, 0, 0, 0x00,0x0C,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {51245, 16717, 0, 0, 0x00,0x0C,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {51283, 16717, 0, 0, 0x00,0x0C,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {51321, 16717, 0, 0, 0x00,0x0C,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {51359, 16717, 0, 0, 0x00,0x0C,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {51397, 16717, 0, 0, 0x00,0x0C,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {51435, 16717, 0, 0, 0x00,0x0C,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {51473, 16717, 0, 0, 0x00,0x0C,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {51511, 16717, 0, 0, 0x00,0x0C,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {51549, 16717, 0, 0, 0x00,0x0C,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {51587, 16717, 0, 0, 0x00,0x0C,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {51625, 16717, 0, 0, 0x00,0x0C,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {51663, 16717, 0, 0, 0x00,0x0C,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {51701, 16717, 0, 0, 0x00,0x0D,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {51739, 16717, 0, 0, 0x00,0x0D,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {51777, 16717, 0, 0, 0x00,0x0D,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {51815, 16717, 0, 0, 0x00,0x0D,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {51853, 16717, 0, 0, 0x00,0x0D,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {51891, 16717, 0, 0, 0x00,0x0D,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {51929, 16717, 0, 0, 0x00,0x0D,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {51967, 16717, 0, 0, 0x00,0x0D,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {52005, 16717, 0, 0, 0x00,0x0D,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {52043, 16717, 0, 0, 0x00,0x0D,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {52081, 16717, 0, 0, 0x00,0x0D,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {52119, 16717, 0, 0, 0x00,0x0D,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {52157, 16717, 0, 0, 0x00,0x0D,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {52195, 16717, 0, 0, 0x00,0x0D,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {52233, 16717, 0, 0, 0x00,0x0D,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {52271, 16717, 0, 0, 0x00,0x0D,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {52309, 16717, 0, 0, 0x00,0x0D,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {52347, 16717, 0, 0, 0x00,0x0D,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {52385, 16717, 0, 0, 0x00,0x0D,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {52423, 16717, 0, 0, 0x00,0x0D,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {52461, 16717, 0, 0, 0x00,0x0D,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {52499, 16717, 0, 0, 0x00,0x0D,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {52537, 16717, 0, 0, 0x00,0x0D,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {52575, 16717, 0, 0, 0x00,0x0D,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {52613, 16717, 0, 0, 0x00,0x0D,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {52651, 16717, 0, 0, 0x00,0x0D,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {52689, 16717, 0, 0, 0x00,0x0D,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {52727, 16717, 0, 0, 0x00,0x0D,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {52765, 16717, 0, 0, 0x00,0x12,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {52803, 16717, 0, 0, 0x00,0x12,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {52841, 16717, 0, 0, 0x00,0x12,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {52879, 16717, 0, 0, 0x00,0x12,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {52917, 16717, 0, 0, 0x00,0x12,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {52955, 16717, 0, 0, 0x00,0x12,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {52993, 16717, 0, 0, 0x00,0x12,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {53031, 16717, 0, 0, 0x00,0x12,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {53069, 16717, 0, 0, 0x00,0x12,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {53107, 16717, 0, 0, 0x00,0x12,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {53145, 16717, 0, 0, 0x00,0x12,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {53183, 16717, 0, 0, 0x00,0x12,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {53221, 16717, 0, 0, 0x00,0x12,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {53259, 16717, 0, 0, 0x00,0x12,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {53297, 16717, 0, 0, 0x00,0x12,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {53335, 16717, 0, 0, 0x00,0x12,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {53373, 16717, 0, 0, 0x00,0x12,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {53411, 16717, 0, 0, 0x00,0x12,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {53449, 16717, 0, 0, 0x00,0x12,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {53487, 16717, 0, 0, 0x00,0x12,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {53525, 16717, 0, 0, 0x00,0x12,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {53563, 16717, 0, 0, 0x00,0x12,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {53601, 16717, 0, 0, 0x00,0x12,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {53639, 16717, 0, 0, 0x00,0x12,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {53677, 16717, 0, 0, 0x00,0x12,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {53715, 16717, 0, 0, 0x00,0x12,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {53753, 16717, 0, 0, 0x00,0x12,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {53791, 16717, 0, 0, 0x00,0x12,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {53829, 16717, 0, 0, 0x00,0x13,0x01,0x00,EVENT_OPTION_NONE_MASK}
+, {53867, 16717, 0, 0, 0x00,0x13,0x02,0x00,EVENT_OPTION_NONE_MASK}
+, {53905, 16717, 0, 0, 0x00,0x13,0x04,0x00,EVENT_OPTION_NONE_MASK}
+, {53943, 16717, 0, 0, 0x00,0x13,0x08,0x00,EVENT_OPTION_NONE_MASK}
+, {53981, 16717, 0, 0, 0x00,0x13,0x10,0x00,EVENT_OPTION_NONE_MASK}
+, {54019, 16717, 0, 0, 0x00,0x13,0x20,0x00,EVENT_OPTION_NONE_MASK}
+, {54057, 16717, 0, 0, 0x00,0x13,0x3F,0x00,EVENT_OPTION_NONE_MASK}
+, {54095, 16717, 0, 0, 0x00,0x13,0x41,0x00,EVENT_OPTION_NONE_MASK}
+, {54133, 16717, 0, 0, 0x00,0x13,0x42,0x00,EVENT_OPTION_NONE_MASK}
+, {54171, 16717, 0, 0, 0x00,0x13,0x44,0x00,EVENT_OPTION_NONE_MASK}
+, {54209, 16717, 0, 0, 0x00,0x13,0x48,0x00,EVENT_OPTION_NONE_MASK}
+, {54247, 16717, 0, 0, 0x00,0x13,0x50,0x00,EVENT_OPTION_NONE_MASK}
+, {54285, 16717, 0, 0, 0x00,0x13,0x60,0x00,EVENT_OPTION_NONE_MASK}
+, {54323, 16717, 0, 0, 0x00,0x13,0x7F,0x00,EVENT_OPTION_NONE_MASK}
+, {54361, 16717, 0, 0, 0x00,0x13,0x81,0x00,EVENT_OPTION_NONE_MASK}
+, {54399, 16717, 0, 0, 0x00,0x13,0x82,0x00,EVENT_OPTION_NONE_MASK}
+, {54437, 16717, 0, 0, 0x00,0x13,0x84,0x00,EVENT_OPTION_NONE_MASK}
+, {54475, 16717, 0, 0, 0x00,0x13,0x88,0x00,EVENT_OPTION_NONE_MASK}
+, {54513, 16717, 0, 0, 0x00,0x13,0x90,0x00,EVENT_OPTION_NONE_MASK}
+, {54551, 16717, 0, 0, 0x00,0x13,0xA0,0x00,EVENT_OPTION_NONE_MASK}
+, {54589, 16717, 0, 0, 0x00,0x13,0xBF,0x00,EVENT_OPTION_NONE_MASK}
+, {54627, 16717, 0, 0, 0x00,0x13,0xC1,0x00,EVENT_OPTION_NONE_MASK}
+, {54665, 16717, 0, 0, 0x00,0x13,0xC2,0x00,EVENT_OPTION_NONE_MASK}
+, {54703, 16717, 0, 0, 0x00,0x13,0xC4,0x00,EVENT_OPTION_NONE_MASK}
+, {54741, 16717, 0, 0, 0x00,0x13,0xC8,0x00,EVENT_OPTION_NONE_MASK}
+, {54779, 16717, 0, 0, 0x00,0x13,0xD0,0x00,EVENT_OPTION_NONE_MASK}
+, {54817, 16717, 0, 0, 0x00,0x13,0xE0,0x00,EVENT_OPTION_NONE_MASK}
+, {54855, 16717, 0, 0, 0x00,0x13,0xFF,0x00,EVENT_OPTION_NONE_MASK}
+, {54893, 14687, 0, 0, 0x00,0x00,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {54916, 14687, 0, 0, 0x00,0x01,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {54939, 14687, 0, 0, 0x00,0x06,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {54962, 14687, 0, 0, 0x00,0x07,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {54985, 14687, 0, 0, 0x00,0x0C,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55008, 14687, 0, 0, 0x00,0x0D,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55031, 14687, 0, 0, 0x00,0x12,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55054, 14687, 0, 0, 0x00,0x13,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55077, 16717, 0, 0, 0x00,0x00,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55100, 16717, 0, 0, 0x00,0x01,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55123, 16717, 0, 0, 0x00,0x06,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55146, 16717, 0, 0, 0x00,0x07,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55169, 16717, 0, 0, 0x00,0x0C,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55192, 16717, 0, 0, 0x00,0x0D,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55215, 16717, 0, 0, 0x00,0x12,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55238, 16717, 0, 0, 0x00,0x13,0x01,0x1E,EVENT_OPTION_NONE_MASK}
+, {55261, 14687, 0, 0, 0x00,0x00,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55285, 14687, 0, 0, 0x00,0x01,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55309, 14687, 0, 0, 0x00,0x06,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55333, 14687, 0, 0, 0x00,0x07,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55357, 14687, 0, 0, 0x00,0x0C,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55381, 14687, 0, 0, 0x00,0x0D,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55405, 14687, 0, 0, 0x00,0x12,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55429, 14687, 0, 0, 0x00,0x13,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55453, 16717, 0, 0, 0x00,0x00,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55477, 16717, 0, 0, 0x00,0x01,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55501, 16717, 0, 0, 0x00,0x06,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55525, 16717, 0, 0, 0x00,0x07,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55549, 16717, 0, 0, 0x00,0x0C,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55573, 16717, 0, 0, 0x00,0x0D,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55597, 16717, 0, 0, 0x00,0x12,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55621, 16717, 0, 0, 0x00,0x13,0x01,0x1A,EVENT_OPTION_NONE_MASK}
+, {55645, 14687, 0, 0, 0x00,0x00,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55671, 14687, 0, 0, 0x00,0x01,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55697, 14687, 0, 0, 0x00,0x06,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55723, 14687, 0, 0, 0x00,0x07,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55749, 14687, 0, 0, 0x00,0x0C,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55775, 14687, 0, 0, 0x00,0x0D,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55801, 14687, 0, 0, 0x00,0x12,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55827, 14687, 0, 0, 0x00,0x13,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55853, 16717, 0, 0, 0x00,0x00,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55879, 16717, 0, 0, 0x00,0x01,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55905, 16717, 0, 0, 0x00,0x06,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55931, 16717, 0, 0, 0x00,0x07,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55957, 16717, 0, 0, 0x00,0x0C,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {55983, 16717, 0, 0, 0x00,0x0D,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {56009, 16717, 0, 0, 0x00,0x12,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {56035, 16717, 0, 0, 0x00,0x13,0x01,0x1B,EVENT_OPTION_NONE_MASK}
+, {56061, 14687, 0, 0, 0x01,0x02,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56088, 14687, 0, 0, 0x01,0x02,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56115, 14687, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56142, 14687, 0, 0, 0x01,0x02,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56169, 14687, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56196, 14687, 0, 0, 0x01,0x02,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56223, 14687, 0, 0, 0x01,0x03,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56250, 14687, 0, 0, 0x01,0x03,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56277, 14687, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56304, 14687, 0, 0, 0x01,0x03,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56331, 14687, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56358, 14687, 0, 0, 0x01,0x03,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56385, 14687, 0, 0, 0x01,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56412, 14687, 0, 0, 0x01,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56439, 14687, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56466, 14687, 0, 0, 0x01,0x08,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56493, 14687, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56520, 14687, 0, 0, 0x01,0x08,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56547, 14687, 0, 0, 0x01,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56574, 14687, 0, 0, 0x01,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56601, 14687, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56628, 14687, 0, 0, 0x01,0x09,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56655, 14687, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56682, 14687, 0, 0, 0x01,0x09,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56709, 14687, 0, 0, 0x01,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56736, 14687, 0, 0, 0x01,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56763, 14687, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56790, 14687, 0, 0, 0x01,0x0E,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56817, 14687, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56844, 14687, 0, 0, 0x01,0x0E,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {56871, 14687, 0, 0, 0x01,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {56898, 14687, 0, 0, 0x01,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {56925, 14687, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {56952, 14687, 0, 0, 0x01,0x0F,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {56979, 14687, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57006, 14687, 0, 0, 0x01,0x0F,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57033, 14687, 0, 0, 0x01,0x14,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57060, 14687, 0, 0, 0x01,0x14,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57087, 14687, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57114, 14687, 0, 0, 0x01,0x14,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57141, 14687, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57168, 14687, 0, 0, 0x01,0x14,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57195, 14687, 0, 0, 0x01,0x15,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57222, 14687, 0, 0, 0x01,0x15,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57249, 14687, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57276, 14687, 0, 0, 0x01,0x15,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57303, 14687, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57330, 14687, 0, 0, 0x01,0x15,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57357, 16717, 0, 0, 0x01,0x02,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57384, 16717, 0, 0, 0x01,0x02,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57411, 16717, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57438, 16717, 0, 0, 0x01,0x02,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57465, 16717, 0, 0, 0x01,0x02,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57492, 16717, 0, 0, 0x01,0x02,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57519, 16717, 0, 0, 0x01,0x03,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57546, 16717, 0, 0, 0x01,0x03,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57573, 16717, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57600, 16717, 0, 0, 0x01,0x03,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57627, 16717, 0, 0, 0x01,0x03,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57654, 16717, 0, 0, 0x01,0x03,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57681, 16717, 0, 0, 0x01,0x08,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57708, 16717, 0, 0, 0x01,0x08,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57735, 16717, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57762, 16717, 0, 0, 0x01,0x08,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57789, 16717, 0, 0, 0x01,0x08,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57816, 16717, 0, 0, 0x01,0x08,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {57843, 16717, 0, 0, 0x01,0x09,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {57870, 16717, 0, 0, 0x01,0x09,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {57897, 16717, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57924, 16717, 0, 0, 0x01,0x09,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {57951, 16717, 0, 0, 0x01,0x09,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {57978, 16717, 0, 0, 0x01,0x09,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {58005, 16717, 0, 0, 0x01,0x0E,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {58032, 16717, 0, 0, 0x01,0x0E,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {58059, 16717, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58086, 16717, 0, 0, 0x01,0x0E,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {58113, 16717, 0, 0, 0x01,0x0E,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58140, 16717, 0, 0, 0x01,0x0E,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {58167, 16717, 0, 0, 0x01,0x0F,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {58194, 16717, 0, 0, 0x01,0x0F,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {58221, 16717, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58248, 16717, 0, 0, 0x01,0x0F,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {58275, 16717, 0, 0, 0x01,0x0F,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58302, 16717, 0, 0, 0x01,0x0F,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {58329, 16717, 0, 0, 0x01,0x14,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {58356, 16717, 0, 0, 0x01,0x14,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {58383, 16717, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58410, 16717, 0, 0, 0x01,0x14,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {58437, 16717, 0, 0, 0x01,0x14,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58464, 16717, 0, 0, 0x01,0x14,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {58491, 16717, 0, 0, 0x01,0x15,0x00,0x00,EVENT_OPTION_NONE_MASK}
+, {58518, 16717, 0, 0, 0x01,0x15,0x00,0x01,EVENT_OPTION_NONE_MASK}
+, {58545, 16717, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58572, 16717, 0, 0, 0x01,0x15,0x00,0x03,EVENT_OPTION_NONE_MASK}
+, {58599, 16717, 0, 0, 0x01,0x15,0x00,0x02,EVENT_OPTION_NONE_MASK}
+, {58626, 16717, 0, 0, 0x01,0x15,0x00,0x05,EVENT_OPTION_NONE_MASK}
+, {58653, 14687, 0, 0, 0x01,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58685, 14687, 0, 0, 0x01,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58717, 14687, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58749, 14687, 0, 0, 0x01,0x02,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58781, 14687, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58813, 14687, 0, 0, 0x01,0x02,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {58845, 14687, 0, 0, 0x01,0x03,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {58877, 14687, 0, 0, 0x01,0x03,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {58909, 14687, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {58941, 14687, 0, 0, 0x01,0x03,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {58973, 14687, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59005, 14687, 0, 0, 0x01,0x03,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59037, 14687, 0, 0, 0x01,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59069, 14687, 0, 0, 0x01,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59101, 14687, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59133, 14687, 0, 0, 0x01,0x08,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59165, 14687, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59197, 14687, 0, 0, 0x01,0x08,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59229, 14687, 0, 0, 0x01,0x09,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59261, 14687, 0, 0, 0x01,0x09,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59293, 14687, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59325, 14687, 0, 0, 0x01,0x09,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59357, 14687, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59389, 14687, 0, 0, 0x01,0x09,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59421, 14687, 0, 0, 0x01,0x0E,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59453, 14687, 0, 0, 0x01,0x0E,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59485, 14687, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59517, 14687, 0, 0, 0x01,0x0E,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59549, 14687, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59581, 14687, 0, 0, 0x01,0x0E,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59613, 14687, 0, 0, 0x01,0x0F,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59645, 14687, 0, 0, 0x01,0x0F,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59677, 14687, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59709, 14687, 0, 0, 0x01,0x0F,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59741, 14687, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59773, 14687, 0, 0, 0x01,0x0F,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59805, 14687, 0, 0, 0x01,0x14,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {59837, 14687, 0, 0, 0x01,0x14,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {59869, 14687, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59901, 14687, 0, 0, 0x01,0x14,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {59933, 14687, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {59965, 14687, 0, 0, 0x01,0x14,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {59997, 14687, 0, 0, 0x01,0x15,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60029, 14687, 0, 0, 0x01,0x15,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60061, 14687, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60093, 14687, 0, 0, 0x01,0x15,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60125, 14687, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60157, 14687, 0, 0, 0x01,0x15,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60189, 16717, 0, 0, 0x01,0x02,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60221, 16717, 0, 0, 0x01,0x02,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60253, 16717, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60285, 16717, 0, 0, 0x01,0x02,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60317, 16717, 0, 0, 0x01,0x02,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60349, 16717, 0, 0, 0x01,0x02,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60381, 16717, 0, 0, 0x01,0x03,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60413, 16717, 0, 0, 0x01,0x03,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60445, 16717, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60477, 16717, 0, 0, 0x01,0x03,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60509, 16717, 0, 0, 0x01,0x03,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60541, 16717, 0, 0, 0x01,0x03,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60573, 16717, 0, 0, 0x01,0x08,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60605, 16717, 0, 0, 0x01,0x08,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60637, 16717, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60669, 16717, 0, 0, 0x01,0x08,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60701, 16717, 0, 0, 0x01,0x08,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60733, 16717, 0, 0, 0x01,0x08,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60765, 16717, 0, 0, 0x01,0x09,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60797, 16717, 0, 0, 0x01,0x09,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {60829, 16717, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60861, 16717, 0, 0, 0x01,0x09,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {60893, 16717, 0, 0, 0x01,0x09,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {60925, 16717, 0, 0, 0x01,0x09,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {60957, 16717, 0, 0, 0x01,0x0E,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {60989, 16717, 0, 0, 0x01,0x0E,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {61021, 16717, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61053, 16717, 0, 0, 0x01,0x0E,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {61085, 16717, 0, 0, 0x01,0x0E,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61117, 16717, 0, 0, 0x01,0x0E,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {61149, 16717, 0, 0, 0x01,0x0F,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {61181, 16717, 0, 0, 0x01,0x0F,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {61213, 16717, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61245, 16717, 0, 0, 0x01,0x0F,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {61277, 16717, 0, 0, 0x01,0x0F,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61309, 16717, 0, 0, 0x01,0x0F,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {61341, 16717, 0, 0, 0x01,0x14,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {61373, 16717, 0, 0, 0x01,0x14,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {61405, 16717, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61437, 16717, 0, 0, 0x01,0x14,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {61469, 16717, 0, 0, 0x01,0x14,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61501, 16717, 0, 0, 0x01,0x14,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {61533, 16717, 0, 0, 0x01,0x15,0x03,0x00,EVENT_OPTION_NONE_MASK}
+, {61565, 16717, 0, 0, 0x01,0x15,0x03,0x01,EVENT_OPTION_NONE_MASK}
+, {61597, 16717, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61629, 16717, 0, 0, 0x01,0x15,0x03,0x03,EVENT_OPTION_NONE_MASK}
+, {61661, 16717, 0, 0, 0x01,0x15,0x03,0x02,EVENT_OPTION_NONE_MASK}
+, {61693, 16717, 0, 0, 0x01,0x15,0x03,0x05,EVENT_OPTION_NONE_MASK}
+, {61725, 14687, 0, 0, 0x00,0x00,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61748, 14687, 0, 0, 0x00,0x01,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61771, 14687, 0, 0, 0x00,0x06,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61794, 14687, 0, 0, 0x00,0x07,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61817, 14687, 0, 0, 0x00,0x0C,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61840, 14687, 0, 0, 0x00,0x0D,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61863, 14687, 0, 0, 0x00,0x12,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61886, 14687, 0, 0, 0x00,0x13,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61909, 16717, 0, 0, 0x00,0x00,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61932, 16717, 0, 0, 0x00,0x01,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61955, 16717, 0, 0, 0x00,0x06,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {61978, 16717, 0, 0, 0x00,0x07,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {62001, 16717, 0, 0, 0x00,0x0C,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {62024, 16717, 0, 0, 0x00,0x0D,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {62047, 16717, 0, 0, 0x00,0x12,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {62070, 16717, 0, 0, 0x00,0x13,0x01,0x1C,EVENT_OPTION_NONE_MASK}
+, {62093, 14687, 0, 0, 0x00,0x00,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62116, 14687, 0, 0, 0x00,0x01,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62139, 14687, 0, 0, 0x00,0x06,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62162, 14687, 0, 0, 0x00,0x07,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62185, 14687, 0, 0, 0x00,0x0C,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62208, 14687, 0, 0, 0x00,0x0D,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62231, 14687, 0, 0, 0x00,0x12,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62254, 14687, 0, 0, 0x00,0x13,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62277, 16717, 0, 0, 0x00,0x00,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62300, 16717, 0, 0, 0x00,0x01,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62323, 16717, 0, 0, 0x00,0x06,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62346, 16717, 0, 0, 0x00,0x07,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62369, 16717, 0, 0, 0x00,0x0C,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62392, 16717, 0, 0, 0x00,0x0D,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62415, 16717, 0, 0, 0x00,0x12,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62438, 16717, 0, 0, 0x00,0x13,0x01,0x1D,EVENT_OPTION_NONE_MASK}
+, {62461, 14687, 0, 0, 0x01,0x02,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62481, 14687, 0, 0, 0x01,0x03,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62501, 14687, 0, 0, 0x01,0x08,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62521, 14687, 0, 0, 0x01,0x09,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62541, 14687, 0, 0, 0x01,0x0E,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62561, 14687, 0, 0, 0x01,0x0F,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62581, 14687, 0, 0, 0x01,0x14,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62601, 14687, 0, 0, 0x01,0x15,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62621, 16717, 0, 0, 0x01,0x02,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62641, 16717, 0, 0, 0x01,0x03,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62661, 16717, 0, 0, 0x01,0x08,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62681, 16717, 0, 0, 0x01,0x09,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62701, 16717, 0, 0, 0x01,0x0E,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62721, 16717, 0, 0, 0x01,0x0F,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62741, 16717, 0, 0, 0x01,0x14,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62761, 16717, 0, 0, 0x01,0x15,0x0A,0x00,EVENT_OPTION_NONE_MASK}
+, {62781, 14687, 0, 0, 0x01,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {62817, 14687, 0, 0, 0x01,0x02,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {62853, 14687, 0, 0, 0x01,0x02,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {62889, 14687, 0, 0, 0x01,0x02,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {62925, 14687, 0, 0, 0x01,0x02,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {62961, 14687, 0, 0, 0x01,0x02,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {62997, 14687, 0, 0, 0x01,0x02,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {63033, 14687, 0, 0, 0x01,0x02,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {63069, 14687, 0, 0, 0x01,0x02,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {63105, 14687, 0, 0, 0x01,0x02,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {63141, 14687, 0, 0, 0x01,0x02,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {63177, 14687, 0, 0, 0x01,0x02,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {63213, 14687, 0, 0, 0x01,0x02,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {63249, 14687, 0, 0, 0x01,0x02,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {63285, 14687, 0, 0, 0x01,0x02,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {63321, 14687, 0, 0, 0x01,0x02,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {63357, 14687, 0, 0, 0x01,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {63393, 14687, 0, 0, 0x01,0x03,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {63429, 14687, 0, 0, 0x01,0x03,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {63465, 14687, 0, 0, 0x01,0x03,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {63501, 14687, 0, 0, 0x01,0x03,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {63537, 14687, 0, 0, 0x01,0x03,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {63573, 14687, 0, 0, 0x01,0x03,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {63609, 14687, 0, 0, 0x01,0x03,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {63645, 14687, 0, 0, 0x01,0x03,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {63681, 14687, 0, 0, 0x01,0x03,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {63717, 14687, 0, 0, 0x01,0x03,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {63753, 14687, 0, 0, 0x01,0x03,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {63789, 14687, 0, 0, 0x01,0x03,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {63825, 14687, 0, 0, 0x01,0x03,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {63861, 14687, 0, 0, 0x01,0x03,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {63897, 14687, 0, 0, 0x01,0x03,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {63933, 14687, 0, 0, 0x01,0x08,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {63969, 14687, 0, 0, 0x01,0x08,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {64005, 14687, 0, 0, 0x01,0x08,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {64041, 14687, 0, 0, 0x01,0x08,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {64077, 14687, 0, 0, 0x01,0x08,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {64113, 14687, 0, 0, 0x01,0x08,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {64149, 14687, 0, 0, 0x01,0x08,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {64185, 14687, 0, 0, 0x01,0x08,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {64221, 14687, 0, 0, 0x01,0x08,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {64257, 14687, 0, 0, 0x01,0x08,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {64293, 14687, 0, 0, 0x01,0x08,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {64329, 14687, 0, 0, 0x01,0x08,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {64365, 14687, 0, 0, 0x01,0x08,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {64401, 14687, 0, 0, 0x01,0x08,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {64437, 14687, 0, 0, 0x01,0x08,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {64473, 14687, 0, 0, 0x01,0x08,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {64509, 14687, 0, 0, 0x01,0x09,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {64545, 14687, 0, 0, 0x01,0x09,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {64581, 14687, 0, 0, 0x01,0x09,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {64617, 14687, 0, 0, 0x01,0x09,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {64653, 14687, 0, 0, 0x01,0x09,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {64689, 14687, 0, 0, 0x01,0x09,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {64725, 14687, 0, 0, 0x01,0x09,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {64761, 14687, 0, 0, 0x01,0x09,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {64797, 14687, 0, 0, 0x01,0x09,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {64833, 14687, 0, 0, 0x01,0x09,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {64869, 14687, 0, 0, 0x01,0x09,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {64905, 14687, 0, 0, 0x01,0x09,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {64941, 14687, 0, 0, 0x01,0x09,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {64977, 14687, 0, 0, 0x01,0x09,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {65013, 14687, 0, 0, 0x01,0x09,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {65049, 14687, 0, 0, 0x01,0x09,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {65085, 14687, 0, 0, 0x01,0x0E,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {65121, 14687, 0, 0, 0x01,0x0E,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {65157, 14687, 0, 0, 0x01,0x0E,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {65193, 14687, 0, 0, 0x01,0x0E,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {65229, 14687, 0, 0, 0x01,0x0E,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {65265, 14687, 0, 0, 0x01,0x0E,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {65301, 14687, 0, 0, 0x01,0x0E,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {65337, 14687, 0, 0, 0x01,0x0E,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {65373, 14687, 0, 0, 0x01,0x0E,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {65409, 14687, 0, 0, 0x01,0x0E,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {65445, 14687, 0, 0, 0x01,0x0E,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {65481, 14687, 0, 0, 0x01,0x0E,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {65517, 14687, 0, 0, 0x01,0x0E,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {65553, 14687, 0, 0, 0x01,0x0E,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {65589, 14687, 0, 0, 0x01,0x0E,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {65625, 14687, 0, 0, 0x01,0x0E,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {65661, 14687, 0, 0, 0x01,0x0F,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {65697, 14687, 0, 0, 0x01,0x0F,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {65733, 14687, 0, 0, 0x01,0x0F,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {65769, 14687, 0, 0, 0x01,0x0F,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {65805, 14687, 0, 0, 0x01,0x0F,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {65841, 14687, 0, 0, 0x01,0x0F,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {65877, 14687, 0, 0, 0x01,0x0F,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {65913, 14687, 0, 0, 0x01,0x0F,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {65949, 14687, 0, 0, 0x01,0x0F,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {65985, 14687, 0, 0, 0x01,0x0F,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {66021, 14687, 0, 0, 0x01,0x0F,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {66057, 14687, 0, 0, 0x01,0x0F,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {66093, 14687, 0, 0, 0x01,0x0F,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {66129, 14687, 0, 0, 0x01,0x0F,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {66165, 14687, 0, 0, 0x01,0x0F,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {66201, 14687, 0, 0, 0x01,0x0F,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {66237, 14687, 0, 0, 0x01,0x14,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {66273, 14687, 0, 0, 0x01,0x14,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {66309, 14687, 0, 0, 0x01,0x14,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {66345, 14687, 0, 0, 0x01,0x14,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {66381, 14687, 0, 0, 0x01,0x14,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {66417, 14687, 0, 0, 0x01,0x14,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {66453, 14687, 0, 0, 0x01,0x14,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {66489, 14687, 0, 0, 0x01,0x14,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {66525, 14687, 0, 0, 0x01,0x14,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {66561, 14687, 0, 0, 0x01,0x14,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {66597, 14687, 0, 0, 0x01,0x14,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {66633, 14687, 0, 0, 0x01,0x14,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {66669, 14687, 0, 0, 0x01,0x14,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {66705, 14687, 0, 0, 0x01,0x14,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {66741, 14687, 0, 0, 0x01,0x14,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {66777, 14687, 0, 0, 0x01,0x14,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {66813, 14687, 0, 0, 0x01,0x15,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {66849, 14687, 0, 0, 0x01,0x15,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {66885, 14687, 0, 0, 0x01,0x15,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {66921, 14687, 0, 0, 0x01,0x15,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {66957, 14687, 0, 0, 0x01,0x15,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {66993, 14687, 0, 0, 0x01,0x15,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {67029, 14687, 0, 0, 0x01,0x15,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {67065, 14687, 0, 0, 0x01,0x15,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {67101, 14687, 0, 0, 0x01,0x15,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {67137, 14687, 0, 0, 0x01,0x15,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {67173, 14687, 0, 0, 0x01,0x15,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {67209, 14687, 0, 0, 0x01,0x15,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {67245, 14687, 0, 0, 0x01,0x15,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {67281, 14687, 0, 0, 0x01,0x15,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {67317, 14687, 0, 0, 0x01,0x15,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {67353, 14687, 0, 0, 0x01,0x15,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {67389, 16717, 0, 0, 0x01,0x02,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {67425, 16717, 0, 0, 0x01,0x02,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {67461, 16717, 0, 0, 0x01,0x02,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {67497, 16717, 0, 0, 0x01,0x02,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {67533, 16717, 0, 0, 0x01,0x02,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {67569, 16717, 0, 0, 0x01,0x02,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {67605, 16717, 0, 0, 0x01,0x02,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {67641, 16717, 0, 0, 0x01,0x02,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {67677, 16717, 0, 0, 0x01,0x02,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {67713, 16717, 0, 0, 0x01,0x02,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {67749, 16717, 0, 0, 0x01,0x02,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {67785, 16717, 0, 0, 0x01,0x02,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {67821, 16717, 0, 0, 0x01,0x02,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {67857, 16717, 0, 0, 0x01,0x02,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {67893, 16717, 0, 0, 0x01,0x02,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {67929, 16717, 0, 0, 0x01,0x02,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {67965, 16717, 0, 0, 0x01,0x03,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {68001, 16717, 0, 0, 0x01,0x03,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {68037, 16717, 0, 0, 0x01,0x03,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {68073, 16717, 0, 0, 0x01,0x03,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {68109, 16717, 0, 0, 0x01,0x03,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {68145, 16717, 0, 0, 0x01,0x03,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {68181, 16717, 0, 0, 0x01,0x03,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {68217, 16717, 0, 0, 0x01,0x03,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {68253, 16717, 0, 0, 0x01,0x03,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {68289, 16717, 0, 0, 0x01,0x03,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {68325, 16717, 0, 0, 0x01,0x03,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {68361, 16717, 0, 0, 0x01,0x03,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {68397, 16717, 0, 0, 0x01,0x03,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {68433, 16717, 0, 0, 0x01,0x03,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {68469, 16717, 0, 0, 0x01,0x03,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {68505, 16717, 0, 0, 0x01,0x03,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {68541, 16717, 0, 0, 0x01,0x08,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {68577, 16717, 0, 0, 0x01,0x08,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {68613, 16717, 0, 0, 0x01,0x08,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {68649, 16717, 0, 0, 0x01,0x08,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {68685, 16717, 0, 0, 0x01,0x08,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {68721, 16717, 0, 0, 0x01,0x08,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {68757, 16717, 0, 0, 0x01,0x08,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {68793, 16717, 0, 0, 0x01,0x08,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {68829, 16717, 0, 0, 0x01,0x08,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {68865, 16717, 0, 0, 0x01,0x08,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {68901, 16717, 0, 0, 0x01,0x08,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {68937, 16717, 0, 0, 0x01,0x08,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {68973, 16717, 0, 0, 0x01,0x08,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {69009, 16717, 0, 0, 0x01,0x08,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {69045, 16717, 0, 0, 0x01,0x08,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {69081, 16717, 0, 0, 0x01,0x08,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {69117, 16717, 0, 0, 0x01,0x09,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {69153, 16717, 0, 0, 0x01,0x09,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {69189, 16717, 0, 0, 0x01,0x09,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {69225, 16717, 0, 0, 0x01,0x09,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {69261, 16717, 0, 0, 0x01,0x09,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {69297, 16717, 0, 0, 0x01,0x09,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {69333, 16717, 0, 0, 0x01,0x09,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {69369, 16717, 0, 0, 0x01,0x09,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {69405, 16717, 0, 0, 0x01,0x09,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {69441, 16717, 0, 0, 0x01,0x09,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {69477, 16717, 0, 0, 0x01,0x09,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {69513, 16717, 0, 0, 0x01,0x09,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {69549, 16717, 0, 0, 0x01,0x09,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {69585, 16717, 0, 0, 0x01,0x09,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {69621, 16717, 0, 0, 0x01,0x09,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {69657, 16717, 0, 0, 0x01,0x09,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {69693, 16717, 0, 0, 0x01,0x0E,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {69729, 16717, 0, 0, 0x01,0x0E,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {69765, 16717, 0, 0, 0x01,0x0E,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {69801, 16717, 0, 0, 0x01,0x0E,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {69837, 16717, 0, 0, 0x01,0x0E,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {69873, 16717, 0, 0, 0x01,0x0E,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {69909, 16717, 0, 0, 0x01,0x0E,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {69945, 16717, 0, 0, 0x01,0x0E,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {69981, 16717, 0, 0, 0x01,0x0E,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {70017, 16717, 0, 0, 0x01,0x0E,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {70053, 16717, 0, 0, 0x01,0x0E,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {70089, 16717, 0, 0, 0x01,0x0E,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {70125, 16717, 0, 0, 0x01,0x0E,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {70161, 16717, 0, 0, 0x01,0x0E,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {70197, 16717, 0, 0, 0x01,0x0E,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {70233, 16717, 0, 0, 0x01,0x0E,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {70269, 16717, 0, 0, 0x01,0x0F,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {70305, 16717, 0, 0, 0x01,0x0F,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {70341, 16717, 0, 0, 0x01,0x0F,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {70377, 16717, 0, 0, 0x01,0x0F,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {70413, 16717, 0, 0, 0x01,0x0F,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {70449, 16717, 0, 0, 0x01,0x0F,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {70485, 16717, 0, 0, 0x01,0x0F,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {70521, 16717, 0, 0, 0x01,0x0F,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {70557, 16717, 0, 0, 0x01,0x0F,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {70593, 16717, 0, 0, 0x01,0x0F,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {70629, 16717, 0, 0, 0x01,0x0F,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {70665, 16717, 0, 0, 0x01,0x0F,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {70701, 16717, 0, 0, 0x01,0x0F,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {70737, 16717, 0, 0, 0x01,0x0F,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {70773, 16717, 0, 0, 0x01,0x0F,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {70809, 16717, 0, 0, 0x01,0x0F,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {70845, 16717, 0, 0, 0x01,0x14,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {70881, 16717, 0, 0, 0x01,0x14,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {70917, 16717, 0, 0, 0x01,0x14,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {70953, 16717, 0, 0, 0x01,0x14,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {70989, 16717, 0, 0, 0x01,0x14,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {71025, 16717, 0, 0, 0x01,0x14,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {71061, 16717, 0, 0, 0x01,0x14,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {71097, 16717, 0, 0, 0x01,0x14,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {71133, 16717, 0, 0, 0x01,0x14,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {71169, 16717, 0, 0, 0x01,0x14,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {71205, 16717, 0, 0, 0x01,0x14,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {71241, 16717, 0, 0, 0x01,0x14,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {71277, 16717, 0, 0, 0x01,0x14,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {71313, 16717, 0, 0, 0x01,0x14,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {71349, 16717, 0, 0, 0x01,0x14,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {71385, 16717, 0, 0, 0x01,0x14,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {71421, 16717, 0, 0, 0x01,0x15,0x09,0x00,EVENT_OPTION_NONE_MASK}
+, {71457, 16717, 0, 0, 0x01,0x15,0x09,0x01,EVENT_OPTION_NONE_MASK}
+, {71493, 16717, 0, 0, 0x01,0x15,0x09,0x02,EVENT_OPTION_NONE_MASK}
+, {71529, 16717, 0, 0, 0x01,0x15,0x09,0x03,EVENT_OPTION_NONE_MASK}
+, {71565, 16717, 0, 0, 0x01,0x15,0x09,0x04,EVENT_OPTION_NONE_MASK}
+, {71601, 16717, 0, 0, 0x01,0x15,0x09,0x05,EVENT_OPTION_NONE_MASK}
+, {71637, 16717, 0, 0, 0x01,0x15,0x09,0x06,EVENT_OPTION_NONE_MASK}
+, {71673, 16717, 0, 0, 0x01,0x15,0x09,0x07,EVENT_OPTION_NONE_MASK}
+, {71709, 16717, 0, 0, 0x01,0x15,0x09,0x08,EVENT_OPTION_NONE_MASK}
+, {71745, 16717, 0, 0, 0x01,0x15,0x09,0x09,EVENT_OPTION_NONE_MASK}
+, {71781, 16717, 0, 0, 0x01,0x15,0x09,0x0A,EVENT_OPTION_NONE_MASK}
+, {71817, 16717, 0, 0, 0x01,0x15,0x09,0x0B,EVENT_OPTION_NONE_MASK}
+, {71853, 16717, 0, 0, 0x01,0x15,0x09,0x0C,EVENT_OPTION_NONE_MASK}
+, {71889, 16717, 0, 0, 0x01,0x15,0x09,0x0D,EVENT_OPTION_NONE_MASK}
+, {71925, 16717, 0, 0, 0x01,0x15,0x09,0x0E,EVENT_OPTION_NONE_MASK}
+, {71961, 16717, 0, 0, 0x01,0x15,0x09,0x0F,EVENT_OPTION_NONE_MASK}
+, {71997, 72017, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72022, 72017, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72043, 72017, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72058, 72017, 0, 0, 0x03,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72073, 72017, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72094, 72017, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72114, 72017, 0, 0, 0x06,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72130, 72017, 0, 0, 0x07,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72147, 72017, 0, 0, 0x050,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72160, 72017, 0, 0, 0x051,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72179, 72017, 0, 0, 0xF8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72185, 72017, 0, 0, 0xF9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72195, 72017, 0, 0, 0x1DF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72201, 72017, 0, 0, 0x1E4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72215, 72017, 0, 0, 0x1E5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72231, 72249, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72254, 72249, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72273, 72249, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72292, 72249, 0, 0, 0x14,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {72307, 72249, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72325, 72249, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72344, 72249, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72360, 72249, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72377, 72249, 0, 0, 0x15,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {72390, 72249, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72411, 72249, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72433, 72249, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72452, 72249, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72472, 72249, 0, 0, 0x16,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {72488, 72249, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72509, 72249, 0, 0, 0x17,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72531, 72249, 0, 0, 0x17,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72550, 72249, 0, 0, 0x17,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72570, 72249, 0, 0, 0x17,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {72586, 72249, 0, 0, 0x17,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72619, 72249, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72636, 72249, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72654, 72249, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {72672, 72249, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72689, 72249, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72707, 72249, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {72725, 72249, 0, 0, 0x0A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72742, 72249, 0, 0, 0x0A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72760, 72249, 0, 0, 0x0A,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {72778, 72249, 0, 0, 0x0A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72792, 72249, 0, 0, 0x0A,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {72807, 72249, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {72822, 72249, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {72838, 72249, 0, 0, 0x0A,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {72854, 72249, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {72869, 72249, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {72885, 72249, 0, 0, 0x0A,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {72901, 72249, 0, 0, 0x0A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {72916, 72249, 0, 0, 0x0A,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {72932, 72249, 0, 0, 0x0A,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {72948, 72249, 0, 0, 0x0A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {72960, 72249, 0, 0, 0x0A,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {72973, 72249, 0, 0, 0x34,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {72990, 72249, 0, 0, 0x33,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73006, 72249, 0, 0, 0x38,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73020, 72249, 0, 0, 0x39,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73036, 72249, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73054, 72249, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73073, 72249, 0, 0, 0x02,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73092, 72249, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73110, 72249, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73129, 72249, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73148, 72249, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73166, 72249, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73185, 72249, 0, 0, 0x01,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {73204, 72249, 0, 0, 0x04,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73219, 72249, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73246, 72249, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73273, 72249, 0, 0, 0x0C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73300, 72249, 0, 0, 0x0C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73327, 72249, 0, 0, 0x0C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73354, 72249, 0, 0, 0x0C,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73381, 72249, 0, 0, 0x0C,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {73408, 72249, 0, 0, 0x0C,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {73435, 72249, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73467, 72249, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73499, 72249, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73531, 72249, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73563, 72249, 0, 0, 0x36,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73585, 72249, 0, 0, 0x37,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73604, 72249, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73620, 72249, 0, 0, 0x31,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73632, 72249, 0, 0, 0x32,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73642, 72249, 0, 0, 0x10,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {73650, 72249, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73671, 72249, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73693, 72249, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73715, 72249, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73736, 72249, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73756, 72249, 0, 0, 0x11,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73775, 72249, 0, 0, 0x11,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {73794, 72249, 0, 0, 0x11,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {73818, 72249, 0, 0, 0x11,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {73844, 72249, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {73863, 72249, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {73885, 72249, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {73904, 72249, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {73933, 72249, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {73961, 72249, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {73991, 72249, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {74012, 72249, 0, 0, 0x12,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {74033, 72249, 0, 0, 0x1A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74047, 72249, 0, 0, 0x18,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74061, 72249, 0, 0, 0x1E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74075, 72249, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74090, 72249, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74105, 72249, 0, 0, 0x1C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74119, 72249, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74132, 72249, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74145, 72249, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74158, 72249, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74171, 72249, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74184, 72249, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74197, 72249, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74210, 72249, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74223, 72249, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74236, 72249, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74249, 72249, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74273, 72249, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74297, 72249, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74321, 72249, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74345, 72249, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {74370, 72249, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {74395, 72249, 0, 0, 0x28,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {74420, 72249, 0, 0, 0x28,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {74445, 72249, 0, 0, 0x28,0x11,0,0,EVENT_OPTION_NONE_MASK}
+, {74466, 72249, 0, 0, 0x28,0x22,0,0,EVENT_OPTION_NONE_MASK}
+, {74487, 72249, 0, 0, 0x28,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {74508, 72249, 0, 0, 0x28,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {74529, 72249, 0, 0, 0x28,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {74549, 72249, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74564, 72249, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74580, 72249, 0, 0, 0x27,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74596, 72249, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74611, 72249, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74621, 72249, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74632, 72249, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74641, 72249, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74652, 72249, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74664, 72249, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74680, 72249, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74691, 72249, 0, 0, 0x3A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74704, 72249, 0, 0, 0x3B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74719, 72249, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74735, 72249, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {74760, 72249, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {74785, 72249, 0, 0, 0x0B,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {74806, 72249, 0, 0, 0x0B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {74828, 72249, 0, 0, 0x0B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {74846, 72249, 0, 0, 0x0B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {74867, 72249, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {74889, 72249, 0, 0, 0x0B,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {74907, 72249, 0, 0, 0x0B,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {74928, 72249, 0, 0, 0x0B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {74950, 72249, 0, 0, 0x0B,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {74968, 72249, 0, 0, 0x0B,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {74986, 72249, 0, 0, 0x1B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {74996, 72249, 0, 0, 0x19,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75006, 72249, 0, 0, 0x1F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75016, 72249, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75027, 72249, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75038, 72249, 0, 0, 0x1D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75048, 75061, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_MASK0_MASK|EVENT_OPTION_MATCH0_MASK}
+, {75066, 75061, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75099, 75061, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75132, 75061, 0, 0, 0x03,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {75164, 75061, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75195, 75061, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75226, 75061, 0, 0, 0x06,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {75256, 75061, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75287, 75061, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75318, 75061, 0, 0, 0x07,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {75348, 75061, 0, 0, 0x08,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75374, 75061, 0, 0, 0x09,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75398, 75061, 0, 0, 0x0A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75422, 75061, 0, 0, 0x0B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75448, 75061, 0, 0, 0x0C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75472, 75061, 0, 0, 0x0D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {75496, 75061, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75530, 75061, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75564, 75061, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75598, 75061, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {75632, 75061, 0, 0, 0x0E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {75666, 75061, 0, 0, 0x0E,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {75696, 75061, 0, 0, 0x0F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75728, 75061, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75760, 75061, 0, 0, 0x0F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75792, 75061, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {75824, 75061, 0, 0, 0x0F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {75856, 75061, 0, 0, 0x0F,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {75884, 75061, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {75916, 75061, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {75948, 75061, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {75980, 75061, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76012, 75061, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {76044, 75061, 0, 0, 0x10,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {76072, 75061, 0, 0, 0x11,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76106, 75061, 0, 0, 0x11,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76140, 75061, 0, 0, 0x11,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76174, 75061, 0, 0, 0x11,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76208, 75061, 0, 0, 0x11,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {76242, 75061, 0, 0, 0x11,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {76272, 75061, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76304, 75061, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76336, 75061, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76368, 75061, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76400, 75061, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {76432, 75061, 0, 0, 0x12,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {76460, 75061, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76492, 75061, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76524, 75061, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76556, 75061, 0, 0, 0x13,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76588, 75061, 0, 0, 0x13,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {76620, 75061, 0, 0, 0x13,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {76648, 75061, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76682, 75061, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76716, 75061, 0, 0, 0x14,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76750, 75061, 0, 0, 0x14,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76784, 75061, 0, 0, 0x14,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {76818, 75061, 0, 0, 0x14,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {76848, 75061, 0, 0, 0x15,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {76880, 75061, 0, 0, 0x15,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {76912, 75061, 0, 0, 0x15,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {76944, 75061, 0, 0, 0x15,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {76976, 75061, 0, 0, 0x15,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {77008, 75061, 0, 0, 0x15,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {77036, 75061, 0, 0, 0x16,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77068, 75061, 0, 0, 0x16,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77100, 75061, 0, 0, 0x16,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {77132, 75061, 0, 0, 0x16,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {77164, 75061, 0, 0, 0x16,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {77196, 75061, 0, 0, 0x16,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {77224, 75061, 0, 0, 0x20,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77253, 75061, 0, 0, 0x21,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77282, 75061, 0, 0, 0x22,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77311, 75061, 0, 0, 0x23,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77338, 75061, 0, 0, 0x24,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77365, 75061, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77392, 75061, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77419, 75061, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77446, 75061, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {77473, 75061, 0, 0, 0x26,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {77500, 75061, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77529, 75061, 0, 0, 0x28,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77556, 75061, 0, 0, 0x29,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77583, 75061, 0, 0, 0x2A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77612, 75061, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77639, 75061, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77666, 75061, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77695, 75061, 0, 0, 0x2E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77722, 75061, 0, 0, 0x2F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77749, 75061, 0, 0, 0x30,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {77765, 75061, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77789, 75061, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77814, 75061, 0, 0, 0x31,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {77836, 75061, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {77856, 75061, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {77877, 75061, 0, 0, 0x40,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {77894, 75061, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {77914, 75061, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {77935, 75061, 0, 0, 0x40,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {77952, 75061, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {77972, 75061, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {77993, 75061, 0, 0, 0x40,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {78010, 75061, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78032, 75061, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78055, 75061, 0, 0, 0x41,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {78074, 75061, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {78096, 75061, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {78119, 75061, 0, 0, 0x41,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {78138, 75061, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {78160, 75061, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {78183, 75061, 0, 0, 0x41,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {78202, 75061, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78226, 75061, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78251, 75061, 0, 0, 0x42,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {78272, 75061, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {78296, 75061, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {78321, 75061, 0, 0, 0x42,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {78342, 75061, 0, 0, 0x42,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {78366, 75061, 0, 0, 0x42,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {78391, 75061, 0, 0, 0x42,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {78412, 75061, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78433, 75061, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78455, 75061, 0, 0, 0x43,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {78473, 75061, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {78494, 75061, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {78516, 75061, 0, 0, 0x43,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {78534, 75061, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {78555, 75061, 0, 0, 0x43,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {78577, 75061, 0, 0, 0x43,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {78595, 75061, 0, 0, 0x50,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78611, 75061, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78631, 75061, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78655, 75061, 0, 0, 0x51,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {78675, 75061, 0, 0, 0x52,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78690, 75061, 0, 0, 0x53,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78705, 75061, 0, 0, 0x54,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78721, 75061, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78740, 75061, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78759, 75061, 0, 0, 0x60,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {78777, 75061, 0, 0, 0x62,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78791, 75061, 0, 0, 0x71,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78805, 75061, 0, 0, 0x63,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78819, 75061, 0, 0, 0x70,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78833, 75061, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {78855, 75061, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {78877, 75061, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {78899, 75061, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {78921, 75061, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {78943, 75061, 0, 0, 0x64,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {78961, 75061, 0, 0, 0x65,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78976, 75061, 0, 0, 0x72,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {78997, 75061, 0, 0, 0x73,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79018, 75061, 0, 0, 0x66,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79040, 75061, 0, 0, 0x66,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {79062, 75061, 0, 0, 0x66,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {79084, 75061, 0, 0, 0x66,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {79106, 75061, 0, 0, 0x66,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {79128, 75061, 0, 0, 0x66,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {79146, 75061, 0, 0, 0x67,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79161, 75061, 0, 0, 0x74,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79175, 75061, 0, 0, 0x68,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79197, 75061, 0, 0, 0x68,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {79219, 75061, 0, 0, 0x68,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {79241, 75061, 0, 0, 0x68,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {79263, 75061, 0, 0, 0x68,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {79285, 75061, 0, 0, 0x68,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {79303, 75061, 0, 0, 0x69,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79318, 75061, 0, 0, 0x75,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79332, 75061, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79351, 75061, 0, 0, 0x8F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79369, 75061, 0, 0, 0x6A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79389, 75061, 0, 0, 0x6B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79409, 75061, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79431, 75061, 0, 0, 0x6C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {79454, 75061, 0, 0, 0x6C,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {79474, 75061, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79487, 75061, 0, 0, 0x77,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79500, 75061, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79514, 75061, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79528, 75061, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79542, 75061, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79556, 75061, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79570, 75061, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79584, 75061, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79603, 75061, 0, 0, 0x86,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {79622, 75061, 0, 0, 0x86,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {79640, 75061, 0, 0, 0x87,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79653, 75061, 0, 0, 0x88,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79666, 75061, 0, 0, 0x89,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79679, 75061, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79693, 75061, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79711, 75061, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79749, 75061, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {79787, 75061, 0, 0, 0x8C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {79825, 75061, 0, 0, 0x8C,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {79863, 75061, 0, 0, 0x8C,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {79901, 75061, 0, 0, 0x8C,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {79935, 75061, 0, 0, 0x8D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {79971, 75061, 0, 0, 0x8D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {80007, 75061, 0, 0, 0x8D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {80043, 75061, 0, 0, 0x8D,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {80079, 75061, 0, 0, 0x8D,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {80115, 75061, 0, 0, 0x8D,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {80147, 75061, 0, 0, 0x8E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {80183, 75061, 0, 0, 0x8E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {80219, 75061, 0, 0, 0x8E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {80255, 75061, 0, 0, 0x8E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {80291, 75061, 0, 0, 0x8E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {80327, 75061, 0, 0, 0x8E,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable westmereEX_arch_events = {
+    NUM_ARCH_EVENTS_WESTMEREEX,
+    westmereEX_arch_event_strings,
+    westmereEX_arch_event_options,
+    westmereEX_arch_event_entries
+};
@@ -0,0 +1,1119 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_WESTMERE 530
+
+static const char westmere_arch_event_strings[] =
+    "INSTR_RETIRED_ANY\0"
+    "FIXC0\0"
+    "CPU_CLK_UNHALTED_CORE\0"
+    "FIXC1\0"
+    "CPU_CLK_UNHALTED_REF\0"
+    "FIXC2\0"
+    "LOAD_BLOCK_OVERLAP_STORE\0"
+    "PMC\0"
+    "SB_DRAIN_ANY\0"
+    "MISALIGN_MEMORY_STORE\0"
+    "STORE_BLOCKS_L1D_AT_RET\0"
+    "STORE_BLOCKS_L1D_BLOCK\0"
+    "PARTIAL_ADDRESS_ALIAS\0"
+    "DTLB_LOAD_MISSES_ANY\0"
+    "DTLB_LOAD_MISSES_WALK_COMPLETED\0"
+    "DTLB_LOAD_MISSES_WALK_CYCLES\0"
+    "DTLB_LOAD_MISSES_STLB_HIT\0"
+    "DTLB_LOAD_MISSES_PDE_MISS\0"
+    "MEM_INST_RETIRED_LOADS\0"
+    "MEM_INST_RETIRED_STORES\0"
+    "MEM_INST_RETIRED_LATENCY_ABOVE_THRESHOLD\0"
+    "MEM_STORE_RETIRED_DTLB_MISS\0"
+    "UOPS_ISSUED_ANY\0"
+    "UOPS_ISSUED_FUSED\0"
+    "UOPS_ISSUED_TOTAL_STALL_CYCLES\0"
+    "UOPS_ISSUED_ACTIVE_CYCLES\0"
+    "UOPS_ISSUED_STALL_CYCLES\0"
+    "MEM_UNCORE_RETIRED_LOCAL_HITM\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM_AND_REMOTE_CACHE_HIT\0"
+    "MEM_UNCORE_RETIRED_LOCAL_DRAM\0"
+    "MEM_UNCORE_RETIRED_REMOTE_DRAM\0"
+    "MEM_UNCORE_RETIRED_UNCACHEABLE\0"
+    "FP_COMP_OPS_EXE_X87\0"
+    "FP_COMP_OPS_EXE_MMX\0"
+    "FP_COMP_OPS_EXE_SSE_FP\0"
+    "FP_COMP_OPS_EXE_SSE2_INTEGER\0"
+    "FP_COMP_OPS_EXE_SSE_FP_PACKED\0"
+    "FP_COMP_OPS_EXE_SSE_FP_SCALAR\0"
+    "FP_COMP_OPS_EXE_SSE_SINGLE_PRECISION\0"
+    "FP_COMP_OPS_EXE_SSE_DOUBLE_PRECISION\0"
+    "SIMD_INT_128_PACKED_MPY\0"
+    "SIMD_INT_128_PACKED_SHIFT\0"
+    "SIMD_INT_128_PACK\0"
+    "SIMD_INT_128_UNPACK\0"
+    "SIMD_INT_128_PACKED_LOGICAL\0"
+    "SIMD_INT_128_PACKED_ARITH\0"
+    "SIMD_INT_128_SHUFFLE_MOVE\0"
+    "LOAD_DISPATCH_RS\0"
+    "LOAD_DISPATCH_RS_DELAYED\0"
+    "LOAD_DISPATCH_MOB\0"
+    "LOAD_DISPATCH_ANY\0"
+    "ARITH_CYCLES_DIV_BUSY\0"
+    "ARITH_NUM_DIV\0"
+    "ARITH_MUL\0"
+    "INST_QUEUE_WRITES\0"
+    "INST_DECODED_DECO\0"
+    "TWO_UPOS_INST_DECODED\0"
+    "INST_QUEUE_WRITE_CYCLES\0"
+    "LSD_OVERFLOW\0"
+    "L2_RQSTS_LD_HIT\0"
+    "L2_RQSTS_LD_MISS\0"
+    "L2_RQSTS_LOADS\0"
+    "L2_RQSTS_RFO_HIT\0"
+    "L2_RQSTS_RFO_MISS\0"
+    "L2_RQSTS_RFOS\0"
+    "L2_RQSTS_IFETCH_HIT\0"
+    "L2_RQSTS_IFETCH_MISS\0"
+    "L2_RQSTS_IFETCHES\0"
+    "L2_RQSTS_PREFETCH_HIT\0"
+    "L2_RQSTS_PREFETCH_MISS\0"
+    "L2_RQSTS_PREFETCHES\0"
+    "L2_RQSTS_MISS\0"
+    "L2_RQSTS_REFERENCES\0"
+    "L2_DATA_RQSTS_DEMAND_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_I_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_S_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_E_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_M_STATE\0"
+    "L2_DATA_RQSTS_DEMAND_PREFETCH_MESI\0"
+    "L2_DATA_RQSTS_DEMAND_ANY\0"
+    "L2_WRITE_RFO_I_STATE\0"
+    "L2_WRITE_RFO_S_STATE\0"
+    "L2_WRITE_RFO_M_STATE\0"
+    "L2_WRITE_RFO_HIT\0"
+    "L2_WRITE_RFO_MESI\0"
+    "L2_WRITE_LOCK_I_STATE\0"
+    "L2_WRITE_LOCK_S_STATE\0"
+    "L2_WRITE_LOCK_E_STATE\0"
+    "L2_WRITE_LOCK_M_STATE\0"
+    "L2_WRITE_LOCK_HIT\0"
+    "L2_WRITE_LOCK_MESI\0"
+    "L1D_WB_L2_I_STATE\0"
+    "L1D_WB_L2_S_STATE\0"
+    "L1D_WB_L2_E_STATE\0"
+    "L1D_WB_L2_M_STATE\0"
+    "L1D_WB_L2_MESI\0"
+    "L3_LAT_CACHE_REFERENCE\0"
+    "L3_LAT_CACHE_MISS\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P\0"
+    "CPU_CLOCK_UNHALTED_THREAD_P_ANY\0"
+    "CPU_CLOCK_UNHALTED_REF_P\0"
+    "CPU_CLOCK_UNHALTED_REF_XCLK_ANY\0"
+    "CPU_CLOCK_UNHALTED_TOTAL_CYCLES\0"
+    "DTLB_MISSES_ANY\0"
+    "DTLB_MISSES_WALK_COMPLETED\0"
+    "DTLB_MISSES_WALK_CYCLES\0"
+    "DTLB_MISSES_STLB_HIT\0"
+    "DTLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "LOAD_HIT_PRE\0"
+    "L1D_PREFETCH_REQUESTS\0"
+    "L1D_PREFETCH_MISS\0"
+    "L1D_PREFETCH_TRIGGERS\0"
+    "EPT_WALK_CYCLES\0"
+    "L1D_REPL\0"
+    "PMC0|PMC1\0"
+    "L1D_M_REPL\0"
+    "L1D_M_EVICT\0"
+    "L1D_M_SNOOP_EVICT\0"
+    "L1D_CACHE_PREFETCH_LOCK_FB_HIT\0"
+    "L1D_CACHE_LOCK_FB_HIT\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_DATA\0"
+    "PMC0\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_READ_CODE\0"
+    "OFFCORE_EVENTS_OUTSTANDING_DEMAND_RFO\0"
+    "OFFCORE_EVENTS_OUTSTANDING_ANY_READ\0"
+    "CACHE_LOCK_CYCLES_L1D_L2\0"
+    "CACHE_LOCK_COUNT_L1D_L2\0"
+    "CACHE_LOCK_CYCLES_L1D\0"
+    "CACHE_LOCK_COUNT_L1D\0"
+    "IO_TRANSACTIONS\0"
+    "L1I_HITS\0"
+    "L1I_MISSES\0"
+    "L1I_READS\0"
+    "L1I_CYCLES_STALLED\0"
+    "LARGE_ITLB_HIT\0"
+    "ITLB_MISSES_ANY\0"
+    "ITLB_MISSES_WALK_COMPLETED\0"
+    "ITLB_MISSES_WALK_CYCLES\0"
+    "ITLB_MISSES_LARGE_WALK_COMPLETED\0"
+    "ILD_STALL_LCP\0"
+    "ILD_STALL_MRU\0"
+    "ILD_STALL_IQ_FULL\0"
+    "ILD_STALL_REGEN\0"
+    "ILD_STALL_ANY\0"
+    "BR_INST_EXEC_COND\0"
+    "BR_INST_EXEC_DIRECT\0"
+    "BR_INST_EXEC_INDIRECT_NON_CALL\0"
+    "BR_INST_EXEC_NON_CALLS\0"
+    "BR_INST_EXEC_RETURN_NEAR\0"
+    "BR_INST_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_INST_EXEC_NEAR_CALLS\0"
+    "BR_INST_EXEC_TAKEN\0"
+    "BR_INST_EXEC_ANY\0"
+    "BR_MISP_EXEC_COND\0"
+    "BR_MISP_EXEC_DIRECT\0"
+    "BR_MISP_EXEC_INDIRECT_NON_CALL\0"
+    "BR_MISP_EXEC_NON_CALLS\0"
+    "BR_MISP_EXEC_RETURN_NEAR\0"
+    "BR_MISP_EXEC_DIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_INDIRECT_NEAR_CALL\0"
+    "BR_MISP_EXEC_NEAR_CALLS\0"
+    "BR_MISP_EXEC_TAKEN\0"
+    "BR_MISP_EXEC_ANY\0"
+    "RESOURCE_STALLS_ANY\0"
+    "RESOURCE_STALLS_LOAD\0"
+    "RESOURCE_STALLS_RS_FULL\0"
+    "RESOURCE_STALLS_STORE\0"
+    "RESOURCE_STALLS_ROB_FULL\0"
+    "RESOURCE_STALLS_FPCW\0"
+    "RESOURCE_STALLS_MXCSR\0"
+    "RESOURCE_STALLS_OTHER\0"
+    "MACRO_INSTS_FUSIONS_DECODED\0"
+    "BACLEAR_FORCE_IQ\0"
+    "LSD_UOPS\0"
+    "LSD_CYCLES\0"
+    "ITLB_FLUSH\0"
+    "OFFCORE_REQUESTS_DEMAND_READ_DATA\0"
+    "OFFCORE_REQUESTS_DEMAND_READ_CODE\0"
+    "OFFCORE_REQUESTS_DEMAND_RFO\0"
+    "OFFCORE_REQUESTS_ANY_READ\0"
+    "OFFCORE_REQUESTS_ANY_RFO\0"
+    "OFFCORE_REQUESTS_L1D_WRITEBACK\0"
+    "OFFCORE_REQUESTS_ANY\0"
+    "UOPS_EXECUTED_PORT0\0"
+    "UOPS_EXECUTED_PORT1\0"
+    "UOPS_EXECUTED_PORT2_CORE\0"
+    "UOPS_EXECUTED_PORT3_CORE\0"
+    "UOPS_EXECUTED_PORT4_CORE\0"
+    "UOPS_EXECUTED_PORT5\0"
+    "UOPS_EXECUTED_PORT015\0"
+    "UOPS_EXECUTED_PORT234\0"
+    "UOPS_EXECUTED_THREAD\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_COUNT\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_CYCLES_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_ACTIVE_COUNT_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_STALL_CYCLES_NO_PORT5\0"
+    "UOPS_EXECUTED_CORE_STALL_COUNT_NO_PORT5\0"
+    "UOPS_EXECUTED_PORT015_STALL_CYCLES\0"
+    "UOPS_EXECUTED_PORT015_STALL_COUNT\0"
+    "OFFCORE_REQUESTS_SQ_FULL\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_DATA\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_DATA_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_INVALIDATE\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_INVALIDATE_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_CODE\0"
+    "SNOOPQ_REQUESTS_OUTSTANDING_CODE_NOT_EMPTY\0"
+    "SNOOPQ_REQUESTS_CODE\0"
+    "SNOOPQ_REQUESTS_DATA\0"
+    "SNOOPQ_REQUESTS_INVALIDATE\0"
+    "SNOOP_RESPONSE_HIT\0"
+    "SNOOP_RESPONSE_HITE\0"
+    "SNOOP_RESPONSE_HITM\0"
+    "INST_RETIRED_ANY_P\0"
+    "INST_RETIRED_X87\0"
+    "INST_RETIRED_MMX\0"
+    "UOPS_RETIRED_ANY\0"
+    "UOPS_RETIRED_RETIRE_SLOTS\0"
+    "UOPS_RETIRED_MACRO_FUSED\0"
+    "UOPS_RETIRED_TOTAL_CYCLES\0"
+    "UOPS_RETIRED_ACTIVE_CYCLES\0"
+    "UOPS_RETIRED_STALL_CYCLES\0"
+    "MACHINE_CLEARS_CYCLES\0"
+    "MACHINE_CLEARS_MEM_ORDER\0"
+    "MACHINE_CLEARS_SMC\0"
+    "BR_INST_RETIRED_CONDITIONAL\0"
+    "BR_INST_RETIRED_NEAR_CALL\0"
+    "BR_INST_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_ALL_BRANCHES\0"
+    "BR_MISP_RETIRED_CONDITIONAL\0"
+    "BR_MISP_RETIRED_NEAR_CALL\0"
+    "SSEX_UOPS_RETIRED_PACKED_SINGLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_SINGLE\0"
+    "SSEX_UOPS_RETIRED_PACKED_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_SCALAR_DOUBLE\0"
+    "SSEX_UOPS_RETIRED_VECTOR_INTEGER\0"
+    "ITLB_MISS_RETIRED\0"
+    "MEM_LOAD_RETIRED_L1D_HIT\0"
+    "MEM_LOAD_RETIRED_L2_HIT\0"
+    "MEM_LOAD_RETIRED_L3_UNSHARED_HIT\0"
+    "MEM_LOAD_RETIRED_OTHER_CORE_L2_HIT_HITM\0"
+    "MEM_LOAD_RETIRED_L3_MISS\0"
+    "MEM_LOAD_RETIRED_HIT_LFB\0"
+    "MEM_LOAD_RETIRED_DTLB_MISS\0"
+    "FP_MMX_TRANS_TO_FP\0"
+    "FP_MMX_TRANS_TO_MMX\0"
+    "FP_MMX_TRANS_TO_ANY\0"
+    "MACRO_INSTS_DECODED\0"
+    "UOPS_DECODED_ANY\0"
+    "UOPS_DECODED_ACTIVE_CYCLES\0"
+    "UOPS_DECODED_ACTIVE_COUNT\0"
+    "UOPS_DECODED_STALL_CYCLES\0"
+    "UOPS_DECODED_STALL_COUNT\0"
+    "UOPS_DECODED_MS\0"
+    "UOPS_DECODED_MS_ACTIVE_CYCLES\0"
+    "UOPS_DECODED_MS_ACTIVE_COUNT\0"
+    "UOPS_DECODED_MS_STALL_CYCLES\0"
+    "UOPS_DECODED_MS_STALL_COUNT\0"
+    "UOPS_DECODED_ESP_FOLDING\0"
+    "UOPS_DECODED_ESP_SYNC\0"
+    "RAT_STALLS_FLAGS\0"
+    "RAT_STALLS_REGISTERS\0"
+    "RAT_STALLS_ROB_READ_PORT\0"
+    "RAT_STALLS_SCOREBOARD\0"
+    "RAT_STALLS_ANY\0"
+    "SEG_RENAME_STALLS\0"
+    "ES_SEG_RENAMES\0"
+    "UOP_UNFUSION\0"
+    "BR_INST_DECODED\0"
+    "BPU_MISSED_CALL_RET\0"
+    "BACLEAR_CLEAR\0"
+    "BACLEAR_BAD_TARGET\0"
+    "BPU_CLEARS_EARLY\0"
+    "BPU_CLEARS_LATE\0"
+    "THREAD_ACTIVE\0"
+    "L2_TRANSACTIONS_LOAD\0"
+    "L2_TRANSACTIONS_RFO\0"
+    "L2_TRANSACTIONS_IFETCH\0"
+    "L2_TRANSACTIONS_PREFETCH\0"
+    "L2_TRANSACTIONS_L1D_WB\0"
+    "L2_TRANSACTIONS_L1D_FILL\0"
+    "L2_TRANSACTIONS_L2_WB\0"
+    "L2_TRANSACTIONS_ANY\0"
+    "L2_LINES_IN_S_STATE\0"
+    "L2_LINES_IN_E_STATE\0"
+    "L2_LINES_IN_ANY\0"
+    "L2_LINES_OUT_DEMAND_CLEAN\0"
+    "L2_LINES_OUT_DEMAND_DIRTY\0"
+    "L2_LINES_OUT_PREFETCH_CLEAN\0"
+    "L2_LINES_OUT_PREFETCH_DIRTY\0"
+    "L2_LINES_OUT_CLEAN_ANY\0"
+    "L2_LINES_OUT_DIRTY_ANY\0"
+    "L2_LINES_OUT_ANY\0"
+    "SQ_MISC_LRU_HINTS\0"
+    "SQ_MISC_SPLIT_LOCK\0"
+    "SQ_FULL_STALL_CYCLES\0"
+    "FP_ASSIST_ALL\0"
+    "FP_ASSIST_OUTPUT\0"
+    "FP_ASSIST_INPUT\0"
+    "SIMD_INT_64_PACKED_MPY\0"
+    "SIMD_INT_64_PACKED_SHIFT\0"
+    "SIMD_INT_64_PACK\0"
+    "SIMD_INT_64_UNPACK\0"
+    "SIMD_INT_64_PACKED_LOGICAL\0"
+    "SIMD_INT_64_PACKED_ARITH\0"
+    "SIMD_INT_64_SHUFFLE_MOVE\0"
+    "OFFCORE_RESPONSE_0_OPTIONS\0"
+    "OFFCORE_RESPONSE_1_OPTIONS\0"
+    "UNCORE_CLOCK\0"
+    "UPMCFIX\0"
+    "UNC_GQ_CYCLES_FULL_READ_TRACKER\0"
+    "UPMC\0"
+    "UNC_GQ_CYCLES_FULL_WRITE_TRACKER\0"
+    "UNC_GQ_CYCLES_FULL_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_READ_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_WRITE_TRACKER\0"
+    "UNC_GQ_CYCLES_NOT_EMPTY_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_OCCUPANCY_READ_TRACKER\0"
+    "UNC_GQ_ALLOC_READ_TRACKER\0"
+    "UNC_GQ_ALLOC_RT_L3_MISS\0"
+    "UNC_GQ_ALLOC_RT_TO_L3_RESP\0"
+    "UNC_GQ_ALLOC_RT_TO_RTID_ACQUIRED\0"
+    "UNC_GQ_ALLOC_WT_TO_RTID_ACQUIRED\0"
+    "UNC_GQ_ALLOC_WRITE_TRACKER\0"
+    "UNC_GQ_ALLOC_PEER_PROBE_TRACKER\0"
+    "UNC_GQ_DATA_FROM_QPI\0"
+    "UNC_GQ_DATA_FROM_QMC\0"
+    "UNC_GQ_DATA_FROM_L3\0"
+    "UNC_GQ_DATA_FROM_CORES_02\0"
+    "UNC_GQ_DATA_FROM_CORES_13\0"
+    "UNC_GQ_DATA_TO_QPI_QMC\0"
+    "UNC_GQ_DATA_TO_L3\0"
+    "UNC_GQ_DATA_TO_CORES\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_I_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_S_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_FWD_S_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_FWD_I_STATE\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_CONFLICT\0"
+    "UNC_SNP_RESP_TO_LOCAL_HOME_WB\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_I_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_S_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_FWD_S_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_FWD_I_STATE\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_CONFLICT\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_WB\0"
+    "UNC_SNP_RESP_TO_REMOTE_HOME_HITM\0"
+    "UNC_L3_HITS_READ\0"
+    "UNC_L3_HITS_WRITE\0"
+    "UNC_L3_HITS_PROBE\0"
+    "UNC_L3_HITS_ANY\0"
+    "UNC_L3_MISS_READ\0"
+    "UNC_L3_MISS_WRITE\0"
+    "UNC_L3_MISS_PROBE\0"
+    "UNC_L3_MISS_ANY\0"
+    "UNC_L3_LINES_IN_M_STATE\0"
+    "UNC_L3_LINES_IN_E_STATE\0"
+    "UNC_L3_LINES_IN_S_STATE\0"
+    "UNC_L3_LINES_IN_F_STATE\0"
+    "UNC_L3_LINES_IN_ANY\0"
+    "UNC_L3_LINES_OUT_M_STATE\0"
+    "UNC_L3_LINES_OUT_E_STATE\0"
+    "UNC_L3_LINES_OUT_S_STATE\0"
+    "UNC_L3_LINES_OUT_I_STATE\0"
+    "UNC_L3_LINES_OUT_F_STATE\0"
+    "UNC_L3_LINES_OUT_ANY\0"
+    "UNC_GQ_SNOOP_GOTO_S\0"
+    "UNC_GQ_SNOOP_GOTO_I\0"
+    "UNC_QHL_REQUESTS_IOH_READS\0"
+    "UNC_QHL_REQUESTS_IOH_WRITES\0"
+    "UNC_QHL_REQUESTS_REMOTE_READS\0"
+    "UNC_QHL_REQUESTS_REMOTE_WRITES\0"
+    "UNC_QHL_REQUESTS_LOCAL_READS\0"
+    "UNC_QHL_REQUESTS_LOCAL_WRITES\0"
+    "UNC_QHL_CYCLES_FULL_IOH\0"
+    "UNC_QHL_CYCLES_FULL_REMOTE\0"
+    "UNC_QHL_CYCLES_FULL_LOCAL\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_IOH\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_REMOTE\0"
+    "UNC_QHL_CYCLES_NOT_EMPTY_LOCAL\0"
+    "UNC_QHL_OCCUPANCY_IOH\0"
+    "UNC_QHL_OCCUPANCY_REMOTE\0"
+    "UNC_QHL_OCCUPANCY_LOCAL\0"
+    "UNC_QHL_ADDRESS_CONFLICTS_2WAY\0"
+    "UNC_QHL_ADDRESS_CONFLICTS_3WAY\0"
+    "UNC_QHL_CONFLICT_CYCLES_IOH\0"
+    "UNC_QHL_CONFLICT_CYCLES_REMOTE\0"
+    "UNC_QHL_CONFLICT_CYCLES_LOCAL\0"
+    "UNC_QHL_TO_QMC_BYPASS\0"
+    "UNC_QMC_ISOC_FULL_READ_CH0\0"
+    "UNC_QMC_ISOC_FULL_READ_CH1\0"
+    "UNC_QMC_ISOC_FULL_READ_CH2\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH0\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH1\0"
+    "UNC_QMC_ISOC_FULL_WRITE_CH2\0"
+    "UNC_QMC_BUSY_READ_CH0\0"
+    "UNC_QMC_BUSY_READ_CH1\0"
+    "UNC_QMC_BUSY_READ_CH2\0"
+    "UNC_QMC_BUSY_WRITE_CH0\0"
+    "UNC_QMC_BUSY_WRITE_CH1\0"
+    "UNC_QMC_BUSY_WRITE_CH2\0"
+    "UNC_QMC_OCCUPANCY_CH0\0"
+    "UNC_QMC_OCCUPANCY_CH1\0"
+    "UNC_QMC_OCCUPANCY_CH2\0"
+    "UNC_QMC_OCCUPANCY_ANY\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH0\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH1\0"
+    "UNC_QMC_ISSOC_OCCUPANCY_CH2\0"
+    "UNC_QMC_ISSOC_READS_ANY\0"
+    "UNC_QMC_NORMAL_READS_CH0\0"
+    "UNC_QMC_NORMAL_READS_CH1\0"
+    "UNC_QMC_NORMAL_READS_CH2\0"
+    "UNC_QMC_NORMAL_READS_ANY\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH0\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH1\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_CH2\0"
+    "UNC_QMC_HIGH_PRIORITY_READS_ANY\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH0\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH1\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_CH2\0"
+    "UNC_QMC_CRITICAL_PRIORITY_READS_ANY\0"
+    "UNC_QMC_WRITES_FULL_CH0\0"
+    "UNC_QMC_WRITES_FULL_CH1\0"
+    "UNC_QMC_WRITES_FULL_CH2\0"
+    "UNC_QMC_WRITES_FULL_ANY\0"
+    "UNC_QMC_WRITES_PARTIAL_CH0\0"
+    "UNC_QMC_WRITES_PARTIAL_CH1\0"
+    "UNC_QMC_WRITES_PARTIAL_CH2\0"
+    "UNC_QMC_WRITES_PARTIAL_ANY\0"
+    "UNC_QMC_CANCEL_CH0\0"
+    "UNC_QMC_CANCEL_CH1\0"
+    "UNC_QMC_CANCEL_CH2\0"
+    "UNC_QMC_CANCEL_ANY\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH0\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH1\0"
+    "UNC_QMC_PRIORITY_UPDATES_CH2\0"
+    "UNC_QMC_PRIORITY_UPDATES_ANY\0"
+    "UNC_IMC_RETRY_CH0\0"
+    "UNC_IMC_RETRY_CH1\0"
+    "UNC_IMC_RETRY_CH2\0"
+    "UNC_IMC_RETRY_ANY\0"
+    "UNC_QHL_FRC_ACK_CNFLTS_IOH\0"
+    "UNC_QHL_FRC_ACK_CNFLTS_REMOTE\0"
+    "UNC_QHL_FRC_ACK_CNFLTS_LOCAL\0"
+    "UNC_QHL_FRC_ACK_CNFLTS_ANY\0"
+    "UNC_QHL_SLEEPS_IOH_ORDER\0"
+    "UNC_QHL_SLEEPS_REMOTE_ORDER\0"
+    "UNC_QHL_SLEEPS_LOCAL_ORDER\0"
+    "UNC_QHL_SLEEPS_IOH_CONFLICT\0"
+    "UNC_QHL_SLEEPS_REMOTE_CONFLICT\0"
+    "UNC_QHL_SLEEPS_LOCAL_CONFLICT\0"
+    "UNC_ADDR_OPCODE_MATCH_AND_IOH\0"
+    "UNC_ADDR_OPCODE_MATCH_AND_REMOTE\0"
+    "UNC_ADDR_OPCODE_MATCH_AND_LOCAL\0"
+    "UNC_ADDR_OPCODE_MATCH_OR_IOH\0"
+    "UNC_ADDR_OPCODE_MATCH_OR_REMOTE\0"
+    "UNC_ADDR_OPCODE_MATCH_OR_LOCAL\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPFWDS_IOH\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPFWDS_REMOTE\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPFWDS_LOCAL\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPIWB_IOH\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPIWB_REMOTE\0"
+    "UNC_ADDR_OPCODE_MATCH_RSPIWB_LOCAL\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_HOME_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_SNOOP_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_NDR_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_HOME_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_SNOOP_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_NDR_LINK_1\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_LINK_0\0"
+    "UNC_QPI_TX_STALLED_SINGLE_FLIT_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_DRS_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCB_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCS_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_DRS_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCB_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_NCS_LINK_1\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_LINK_0\0"
+    "UNC_QPI_TX_STALLED_MULTI_FLIT_LINK_1\0"
+    "UNC_QPI_TX_HEADER_FULL_LINK_0\0"
+    "UNC_QPI_TX_HEADER_BUSY_LINK_0\0"
+    "UNC_QPI_TX_HEADER_FULL_LINK_1\0"
+    "UNC_QPI_TX_HEADER_BUSY_LINK_1\0"
+    "UNC_QPI_RX_NO_PPT_CREDIT_STALLS_LINK_0\0"
+    "UNC_QPI_RX_NO_PPT_CREDIT_STALLS_LINK_1\0"
+    "UNC_DRAM_OPEN_CH0\0"
+    "UNC_DRAM_OPEN_CH1\0"
+    "UNC_DRAM_OPEN_CH2\0"
+    "UNC_DRAM_PAGE_CLOSE_CH0\0"
+    "UNC_DRAM_PAGE_CLOSE_CH1\0"
+    "UNC_DRAM_PAGE_CLOSE_CH2\0"
+    "UNC_DRAM_PAGE_MISS_CH0\0"
+    "UNC_DRAM_PAGE_MISS_CH1\0"
+    "UNC_DRAM_PAGE_MISS_CH2\0"
+    "UNC_DRAM_READ_CAS_CH0\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH0\0"
+    "UNC_DRAM_READ_CAS_CH1\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH1\0"
+    "UNC_DRAM_READ_CAS_CH2\0"
+    "UNC_DRAM_READ_CAS_AUTOPRE_CH2\0"
+    "UNC_DRAM_WRITE_CAS_CH0\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH0\0"
+    "UNC_DRAM_WRITE_CAS_CH1\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH1\0"
+    "UNC_DRAM_WRITE_CAS_CH2\0"
+    "UNC_DRAM_WRITE_CAS_AUTOPRE_CH2\0"
+    "UNC_DRAM_REFRESH_CH0\0"
+    "UNC_DRAM_REFRESH_CH1\0"
+    "UNC_DRAM_REFRESH_CH2\0"
+    "UNC_DRAM_PRE_ALL_CH0\0"
+    "UNC_DRAM_PRE_ALL_CH1\0"
+    "UNC_DRAM_PRE_ALL_CH2\0"
+    "UNC_DRAM_THERMAL_THROTTLED\0"
+    "UNC_THERMAL_THROTTLING_TEMP_CORE_0\0"
+    "UNC_THERMAL_THROTTLING_TEMP_CORE_1\0"
+    "UNC_THERMAL_THROTTLING_TEMP_CORE_2\0"
+    "UNC_THERMAL_THROTTLING_TEMP_CORE_3\0"
+    "UNC_THERMAL_THROTTLED_TEMP_CORE_0\0"
+    "UNC_THERMAL_THROTTLED_TEMP_CORE_1\0"
+    "UNC_THERMAL_THROTTLED_TEMP_CORE_2\0"
+    "UNC_THERMAL_THROTTLED_TEMP_CORE_3\0"
+    "UNC_PROCHOT_ASSERTION\0"
+    "UNC_THERMAL_THROTTLING_PROCHOT_CORE_0\0"
+    "UNC_THERMAL_THROTTLING_PROCHOT_CORE_1\0"
+    "UNC_THERMAL_THROTTLING_PROCHOT_CORE_2\0"
+    "UNC_THERMAL_THROTTLING_PROCHOT_CORE_3\0"
+    "UNC_TURBO_MODE_CORE_0\0"
+    "UNC_TURBO_MODE_CORE_1\0"
+    "UNC_TURBO_MODE_CORE_2\0"
+    "UNC_TURBO_MODE_CORE_3\0"
+    "UNC_CYCLES_UNHALTED_L3_FLL_ENABLE\0"
+    "UNC_CYCLES_UNHALTED_L3_FLL_DISABLE\0";
+
+static const PerfmonEventOption westmere_arch_event_options[] = {
+ {EVENT_OPTION_THRESHOLD,0xF}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x2}
+, {EVENT_OPTION_INVERT,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_ANYTHREAD,1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_INVERT,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_THRESHOLD,0x1}
+, {EVENT_OPTION_EDGE,1}
+, {EVENT_OPTION_INVERT,1}
+};
+
+static const PerfmonEventEntry westmere_arch_event_entries[NUM_ARCH_EVENTS_WESTMERE] = {
+ {0, 18, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {24, 46, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {52, 73, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {79, 104, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {108, 104, 0, 0, 0x04,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {121, 104, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {143, 104, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {167, 104, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {190, 104, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {212, 104, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {233, 104, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {265, 104, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {294, 104, 0, 0, 0x08,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {320, 104, 0, 0, 0x08,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {346, 104, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {369, 104, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {393, 104, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {434, 104, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {462, 104, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {478, 104, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {496, 104, 0, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {527, 104, 2, 1, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {553, 104, 3, 2, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {578, 104, 0, 0, 0x0F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {608, 104, 0, 0, 0x0F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {659, 104, 0, 0, 0x0F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {689, 104, 0, 0, 0x0F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {720, 104, 0, 0, 0x0F,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {751, 104, 0, 0, 0x10,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {771, 104, 0, 0, 0x10,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {791, 104, 0, 0, 0x10,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {814, 104, 0, 0, 0x10,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {843, 104, 0, 0, 0x10,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {873, 104, 0, 0, 0x10,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {903, 104, 0, 0, 0x10,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {940, 104, 0, 0, 0x10,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {977, 104, 0, 0, 0x12,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1001, 104, 0, 0, 0x12,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1027, 104, 0, 0, 0x12,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1045, 104, 0, 0, 0x12,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1065, 104, 0, 0, 0x12,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1093, 104, 0, 0, 0x12,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1119, 104, 0, 0, 0x12,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1145, 104, 0, 0, 0x13,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1162, 104, 0, 0, 0x13,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1187, 104, 0, 0, 0x13,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1205, 104, 0, 0, 0x13,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1223, 104, 0, 0, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1245, 104, 5, 3, 0x14,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {1259, 104, 0, 0, 0x14,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1269, 104, 0, 0, 0x17,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1287, 104, 0, 0, 0x18,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1305, 104, 0, 0, 0x19,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1327, 104, 0, 0, 0x1E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1351, 104, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1364, 104, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1380, 104, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1397, 104, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1412, 104, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1429, 104, 0, 0, 0x24,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1447, 104, 0, 0, 0x24,0x0C,0,0,EVENT_OPTION_NONE_MASK}
+, {1461, 104, 0, 0, 0x24,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1481, 104, 0, 0, 0x24,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1502, 104, 0, 0, 0x24,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {1520, 104, 0, 0, 0x24,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1542, 104, 0, 0, 0x24,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1565, 104, 0, 0, 0x24,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {1585, 104, 0, 0, 0x24,0xAA,0,0,EVENT_OPTION_NONE_MASK}
+, {1599, 104, 0, 0, 0x24,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1619, 104, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1648, 104, 0, 0, 0x26,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1677, 104, 0, 0, 0x26,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1706, 104, 0, 0, 0x26,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1735, 104, 0, 0, 0x26,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1761, 104, 0, 0, 0x26,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1799, 104, 0, 0, 0x26,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1837, 104, 0, 0, 0x26,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1875, 104, 0, 0, 0x26,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1913, 104, 0, 0, 0x26,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1948, 104, 0, 0, 0x26,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1973, 104, 0, 0, 0x27,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1994, 104, 0, 0, 0x27,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2015, 104, 0, 0, 0x27,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2036, 104, 0, 0, 0x27,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {2053, 104, 0, 0, 0x27,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2071, 104, 0, 0, 0x27,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2093, 104, 0, 0, 0x27,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2115, 104, 0, 0, 0x27,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2137, 104, 0, 0, 0x27,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2159, 104, 0, 0, 0x27,0xE0,0,0,EVENT_OPTION_NONE_MASK}
+, {2177, 104, 0, 0, 0x27,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2196, 104, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2214, 104, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2232, 104, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2250, 104, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2268, 104, 0, 0, 0x28,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2283, 104, 0, 0, 0x2E,0x4F,0,0,EVENT_OPTION_NONE_MASK}
+, {2306, 104, 0, 0, 0x2E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2324, 104, 0, 0, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2352, 104, 8, 1, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2384, 104, 0, 0, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2409, 104, 8, 1, 0x3C,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {2441, 104, 9, 2, 0x3C,0x00,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {2473, 104, 0, 0, 0x49,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2489, 104, 0, 0, 0x49,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2516, 104, 0, 0, 0x49,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 104, 0, 0, 0x49,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2561, 104, 0, 0, 0x49,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2594, 104, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2607, 104, 0, 0, 0x4E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2629, 104, 0, 0, 0x4E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2647, 104, 0, 0, 0x4E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2669, 104, 0, 0, 0x4F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2685, 2694, 0, 0, 0x51,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2704, 2694, 0, 0, 0x51,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2715, 2694, 0, 0, 0x51,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2727, 2694, 0, 0, 0x51,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2745, 104, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2776, 104, 0, 0, 0x53,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2798, 2842, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2847, 2842, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2891, 2842, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2929, 2842, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2965, 2694, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2990, 2694, 11, 1, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3014, 2694, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3036, 2694, 11, 1, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_EDGE_MASK}
+, {3057, 104, 0, 0, 0x6C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3073, 104, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3082, 104, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3093, 104, 0, 0, 0x80,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3103, 104, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3122, 104, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3137, 104, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3153, 104, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3180, 104, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3204, 104, 0, 0, 0x85,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3237, 104, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3251, 104, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3265, 104, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3283, 104, 0, 0, 0x87,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3299, 104, 0, 0, 0x87,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3313, 104, 0, 0, 0x88,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3331, 104, 0, 0, 0x88,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3351, 104, 0, 0, 0x88,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3382, 104, 0, 0, 0x88,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3405, 104, 0, 0, 0x88,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3430, 104, 0, 0, 0x88,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3460, 104, 0, 0, 0x88,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3492, 104, 0, 0, 0x88,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3516, 104, 0, 0, 0x88,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3535, 104, 0, 0, 0x88,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3552, 104, 0, 0, 0x89,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3570, 104, 0, 0, 0x89,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3590, 104, 0, 0, 0x89,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3621, 104, 0, 0, 0x89,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3644, 104, 0, 0, 0x89,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3669, 104, 0, 0, 0x89,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3699, 104, 0, 0, 0x89,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3731, 104, 0, 0, 0x89,0x30,0,0,EVENT_OPTION_NONE_MASK}
+, {3755, 104, 0, 0, 0x89,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3774, 104, 0, 0, 0x89,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {3791, 104, 0, 0, 0xA2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3811, 104, 0, 0, 0xA2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3832, 104, 0, 0, 0xA2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3856, 104, 0, 0, 0xA2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3878, 104, 0, 0, 0xA2,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3903, 104, 0, 0, 0xA2,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3924, 104, 0, 0, 0xA2,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3946, 104, 0, 0, 0xA2,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3968, 104, 0, 0, 0xA6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3996, 104, 0, 0, 0xA7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4013, 104, 0, 0, 0xA8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4022, 104, 0, 0, 0xA8,0x01,0xC1,0x01,EVENT_OPTION_NONE_MASK}
+, {4033, 104, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4044, 104, 0, 0, 0xB0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4078, 104, 0, 0, 0xB0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4112, 104, 0, 0, 0xB0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4140, 104, 0, 0, 0xB0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4166, 104, 0, 0, 0xB0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4191, 104, 0, 0, 0xB0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4222, 104, 0, 0, 0xB0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4243, 104, 0, 0, 0xB1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4263, 104, 0, 0, 0xB1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4283, 104, 8, 1, 0xB1,0x04,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4308, 104, 8, 1, 0xB1,0x08,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4333, 104, 8, 1, 0xB1,0x10,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4358, 104, 0, 0, 0xB1,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4378, 104, 0, 0, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4400, 104, 0, 0, 0xB1,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4422, 104, 0, 0, 0xB1,0xC0,0,0,EVENT_OPTION_NONE_MASK}
+, {4443, 104, 12, 2, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4476, 104, 14, 3, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4508, 104, 17, 3, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4540, 104, 20, 4, 0xB1,0x3F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {4571, 104, 12, 2, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK}
+, {4613, 104, 14, 3, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK}
+, {4654, 104, 17, 3, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4695, 104, 24, 4, 0xB1,0x1F,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {4735, 104, 17, 3, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_INVERT_MASK}
+, {4770, 104, 20, 4, 0xB1,0x40,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_ANYTHREAD_MASK|EVENT_OPTION_INVERT_MASK|EVENT_OPTION_EDGE_MASK}
+, {4804, 104, 0, 0, 0xB2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4829, 2842, 0, 0, 0xB3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4862, 2842, 0, 0, 0xB3,0x01,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4905, 2842, 0, 0, 0xB3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4944, 2842, 0, 0, 0xB3,0x02,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {4993, 2842, 0, 0, 0xB3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5026, 2842, 0, 0, 0xB3,0x04,0x41,0x01,EVENT_OPTION_NONE_MASK}
+, {5069, 104, 0, 0, 0xB4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5090, 104, 0, 0, 0xB4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5111, 104, 0, 0, 0xB4,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {5138, 104, 0, 0, 0xB8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5157, 104, 0, 0, 0xB8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5177, 104, 0, 0, 0xB8,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5197, 104, 0, 0, 0xC0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5216, 104, 0, 0, 0xC0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5233, 104, 0, 0, 0xC0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5250, 104, 0, 0, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5267, 104, 0, 0, 0xC2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5293, 104, 0, 0, 0xC2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5318, 104, 0, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5344, 104, 2, 1, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {5371, 104, 3, 2, 0xC2,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {5397, 104, 0, 0, 0xC3,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5419, 104, 0, 0, 0xC3,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5444, 104, 0, 0, 0xC3,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5463, 104, 0, 0, 0xC4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5491, 104, 0, 0, 0xC4,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5517, 104, 0, 0, 0xC4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5546, 104, 0, 0, 0xC5,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5575, 104, 0, 0, 0xC5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5603, 104, 0, 0, 0xC5,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5629, 104, 0, 0, 0xC7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5661, 104, 0, 0, 0xC7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5693, 104, 0, 0, 0xC7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5725, 104, 0, 0, 0xC7,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5757, 104, 0, 0, 0xC7,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5790, 104, 0, 0, 0xC8,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5808, 104, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5833, 104, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5857, 104, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5890, 104, 0, 0, 0xCB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5930, 104, 0, 0, 0xCB,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5955, 104, 0, 0, 0xCB,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5980, 104, 0, 0, 0xCB,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6007, 104, 0, 0, 0xCC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6026, 104, 0, 0, 0xCC,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6046, 104, 0, 0, 0xCC,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {6066, 104, 0, 0, 0xD0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6086, 104, 0, 0, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6103, 104, 2, 1, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6130, 104, 28, 2, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {6156, 104, 3, 2, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6182, 104, 30, 3, 0xD1,0x01,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {6207, 104, 0, 0, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6223, 104, 2, 1, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK}
+, {6253, 104, 28, 2, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK}
+, {6282, 104, 3, 2, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_INVERT_MASK}
+, {6311, 104, 30, 3, 0xD1,0x02,0,0,EVENT_OPTION_NONE_MASK|EVENT_OPTION_THRESHOLD_MASK|EVENT_OPTION_EDGE_MASK|EVENT_OPTION_INVERT_MASK}
+, {6339, 104, 0, 0, 0xD1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6364, 104, 0, 0, 0xD1,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6386, 104, 0, 0, 0xD2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6403, 104, 0, 0, 0xD2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6424, 104, 0, 0, 0xD2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6449, 104, 0, 0, 0xD2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6471, 104, 0, 0, 0xD2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {6486, 104, 0, 0, 0xD4,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6504, 104, 0, 0, 0xD5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6519, 104, 0, 0, 0xDB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6532, 104, 0, 0, 0xE0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6548, 104, 0, 0, 0xE5,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6568, 104, 0, 0, 0xE6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6582, 104, 0, 0, 0xE6,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6601, 104, 0, 0, 0xE8,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6618, 104, 0, 0, 0xE8,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6634, 104, 0, 0, 0xEC,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6648, 104, 0, 0, 0xF0,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6669, 104, 0, 0, 0xF0,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6689, 104, 0, 0, 0xF0,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6712, 104, 0, 0, 0xF0,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6737, 104, 0, 0, 0xF0,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6760, 104, 0, 0, 0xF0,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6785, 104, 0, 0, 0xF0,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6807, 104, 0, 0, 0xF0,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6827, 104, 0, 0, 0xF1,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6847, 104, 0, 0, 0xF1,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6867, 104, 0, 0, 0xF1,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {6883, 104, 0, 0, 0xF2,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6909, 104, 0, 0, 0xF2,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6935, 104, 0, 0, 0xF2,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6963, 104, 0, 0, 0xF2,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6991, 104, 0, 0, 0xF2,0x05,0,0,EVENT_OPTION_NONE_MASK}
+, {7014, 104, 0, 0, 0xF2,0x0A,0,0,EVENT_OPTION_NONE_MASK}
+, {7037, 104, 0, 0, 0xF2,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {7054, 104, 0, 0, 0xF4,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7072, 104, 0, 0, 0xF4,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7091, 104, 0, 0, 0xF6,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7112, 104, 0, 0, 0xF7,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7126, 104, 0, 0, 0xF7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7143, 104, 0, 0, 0xF7,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7159, 104, 0, 0, 0xFD,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7182, 104, 0, 0, 0xFD,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7207, 104, 0, 0, 0xFD,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7224, 104, 0, 0, 0xFD,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7243, 104, 0, 0, 0xFD,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7270, 104, 0, 0, 0xFD,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7295, 104, 0, 0, 0xFD,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7320, 104, 0, 0, 0xB7,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7347, 104, 0, 0, 0xBB,0x01,0xFF,0xFF,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_MATCH1_MASK}
+, {7374, 7387, 0, 0, 0x00,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7395, 7427, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7432, 7427, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7465, 7427, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7503, 7427, 0, 0, 0x01,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7540, 7427, 0, 0, 0x01,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7578, 7427, 0, 0, 0x01,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7621, 7427, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7651, 7427, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7677, 7427, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7701, 7427, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7728, 7427, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7761, 7427, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7794, 7427, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7821, 7427, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7853, 7427, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7874, 7427, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7895, 7427, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7915, 7427, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7941, 7427, 0, 0, 0x04,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7967, 7427, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7990, 7427, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8008, 7427, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8029, 7427, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8064, 7427, 0, 0, 0x06,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8099, 7427, 0, 0, 0x06,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8138, 7427, 0, 0, 0x06,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8177, 7427, 0, 0, 0x06,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8213, 7427, 0, 0, 0x06,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8243, 7427, 0, 0, 0x07,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8279, 7427, 0, 0, 0x07,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8315, 7427, 0, 0, 0x07,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8355, 7427, 0, 0, 0x07,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8395, 7427, 0, 0, 0x07,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8432, 7427, 0, 0, 0x07,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8463, 7427, 0, 0, 0x07,0x24,0,0,EVENT_OPTION_NONE_MASK}
+, {8496, 7427, 0, 0, 0x08,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8513, 7427, 0, 0, 0x08,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8531, 7427, 0, 0, 0x08,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8549, 7427, 0, 0, 0x08,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8565, 7427, 0, 0, 0x09,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8582, 7427, 0, 0, 0x09,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8600, 7427, 0, 0, 0x09,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8618, 7427, 0, 0, 0x09,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {8634, 7427, 0, 0, 0x0A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8658, 7427, 0, 0, 0x0A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8682, 7427, 0, 0, 0x0A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8706, 7427, 0, 0, 0x0A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8730, 7427, 0, 0, 0x0A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {8750, 7427, 0, 0, 0x0B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8775, 7427, 0, 0, 0x0B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8800, 7427, 0, 0, 0x0B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8825, 7427, 0, 0, 0x0B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8850, 7427, 0, 0, 0x0B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8875, 7427, 0, 0, 0x0B,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8896, 7427, 0, 0, 0x0C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8916, 7427, 0, 0, 0x0C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8936, 7427, 0, 0, 0x20,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8963, 7427, 0, 0, 0x20,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8991, 7427, 0, 0, 0x20,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9021, 7427, 0, 0, 0x20,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9052, 7427, 0, 0, 0x20,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9081, 7427, 0, 0, 0x20,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9111, 7427, 0, 0, 0x21,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9135, 7427, 0, 0, 0x21,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9162, 7427, 0, 0, 0x21,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9188, 7427, 0, 0, 0x22,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9217, 7427, 0, 0, 0x22,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9249, 7427, 0, 0, 0x22,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9280, 7427, 0, 0, 0x23,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9302, 7427, 0, 0, 0x23,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9327, 7427, 0, 0, 0x23,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9351, 7427, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9382, 7427, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9413, 7427, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9441, 7427, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9472, 7427, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9502, 7427, 0, 0, 0x26,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9524, 7427, 0, 0, 0x28,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9551, 7427, 0, 0, 0x28,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9578, 7427, 0, 0, 0x28,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9605, 7427, 0, 0, 0x28,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9633, 7427, 0, 0, 0x28,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9661, 7427, 0, 0, 0x28,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9689, 7427, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9711, 7427, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9733, 7427, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9755, 7427, 0, 0, 0x29,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {9778, 7427, 0, 0, 0x29,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {9801, 7427, 0, 0, 0x29,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {9824, 7427, 0, 0, 0x2A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9846, 7427, 0, 0, 0x2A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9868, 7427, 0, 0, 0x2A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9890, 7427, 0, 0, 0x2A,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {9912, 7427, 0, 0, 0x2B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {9940, 7427, 0, 0, 0x2B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {9968, 7427, 0, 0, 0x2B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {9996, 7427, 0, 0, 0x2B,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10020, 7427, 0, 0, 0x2C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10045, 7427, 0, 0, 0x2C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10070, 7427, 0, 0, 0x2C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10095, 7427, 0, 0, 0x2C,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10120, 7427, 0, 0, 0x2D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10152, 7427, 0, 0, 0x2D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10184, 7427, 0, 0, 0x2D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10216, 7427, 0, 0, 0x2D,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10248, 7427, 0, 0, 0x2E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10284, 7427, 0, 0, 0x2E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10320, 7427, 0, 0, 0x2E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10356, 7427, 0, 0, 0x2E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10392, 7427, 0, 0, 0x2F,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10416, 7427, 0, 0, 0x2F,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10440, 7427, 0, 0, 0x2F,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10464, 7427, 0, 0, 0x2F,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10488, 7427, 0, 0, 0x2F,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {10515, 7427, 0, 0, 0x2F,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {10542, 7427, 0, 0, 0x2F,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {10569, 7427, 0, 0, 0x2F,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {10596, 7427, 0, 0, 0x30,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10615, 7427, 0, 0, 0x30,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10634, 7427, 0, 0, 0x30,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10653, 7427, 0, 0, 0x30,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10672, 7427, 0, 0, 0x31,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10701, 7427, 0, 0, 0x31,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10730, 7427, 0, 0, 0x31,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10759, 7427, 0, 0, 0x31,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10788, 7427, 0, 0, 0x32,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10806, 7427, 0, 0, 0x32,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10824, 7427, 0, 0, 0x32,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10842, 7427, 0, 0, 0x32,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10860, 7427, 0, 0, 0x33,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10887, 7427, 0, 0, 0x33,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {10917, 7427, 0, 0, 0x33,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {10946, 7427, 0, 0, 0x33,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {10973, 7427, 0, 0, 0x34,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {10998, 7427, 0, 0, 0x34,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11026, 7427, 0, 0, 0x34,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11053, 7427, 0, 0, 0x34,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11081, 7427, 0, 0, 0x34,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11112, 7427, 0, 0, 0x34,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11142, 7427, 0, 0, 0x35,0x01,0x02,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11172, 7427, 0, 0, 0x35,0x02,0x02,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11205, 7427, 0, 0, 0x35,0x04,0x02,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11237, 7427, 0, 0, 0x35,0x01,0x0C,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11266, 7427, 0, 0, 0x35,0x02,0x0C,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11298, 7427, 0, 0, 0x35,0x04,0x0C,0x0,EVENT_OPTION_MATCH0_MASK|EVENT_OPTION_OPCODE_MASK}
+, {11329, 7427, 0, 0, 0x35,0x01,0x04,0x1A,EVENT_OPTION_NONE_MASK}
+, {11363, 7427, 0, 0, 0x35,0x02,0x04,0x1A,EVENT_OPTION_NONE_MASK}
+, {11400, 7427, 0, 0, 0x35,0x04,0x04,0x1A,EVENT_OPTION_NONE_MASK}
+, {11436, 7427, 0, 0, 0x35,0x01,0x04,0x1D,EVENT_OPTION_NONE_MASK}
+, {11469, 7427, 0, 0, 0x35,0x02,0x04,0x1D,EVENT_OPTION_NONE_MASK}
+, {11505, 7427, 0, 0, 0x35,0x04,0x04,0x1D,EVENT_OPTION_NONE_MASK}
+, {11540, 7427, 0, 0, 0x40,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11583, 7427, 0, 0, 0x40,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11627, 7427, 0, 0, 0x40,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11669, 7427, 0, 0, 0x40,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {11712, 7427, 0, 0, 0x40,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {11756, 7427, 0, 0, 0x40,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {11798, 7427, 0, 0, 0x40,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {11836, 7427, 0, 0, 0x40,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {11874, 7427, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {11915, 7427, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {11956, 7427, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {11997, 7427, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12038, 7427, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12079, 7427, 0, 0, 0x41,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12120, 7427, 0, 0, 0x41,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {12157, 7427, 0, 0, 0x41,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {12194, 7427, 0, 0, 0x42,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12224, 7427, 0, 0, 0x42,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12254, 7427, 0, 0, 0x42,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12284, 7427, 0, 0, 0x42,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12314, 7427, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12353, 7427, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12392, 7427, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12410, 7427, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12428, 7427, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12446, 7427, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12470, 7427, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12494, 7427, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12518, 7427, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12541, 7427, 0, 0, 0x62,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12564, 7427, 0, 0, 0x62,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12587, 7427, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12609, 7427, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12639, 7427, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12661, 7427, 0, 0, 0x63,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12691, 7427, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12713, 7427, 0, 0, 0x63,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12743, 7427, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12766, 7427, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12797, 7427, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12820, 7427, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {12851, 7427, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {12874, 7427, 0, 0, 0x64,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {12905, 7427, 0, 0, 0x65,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12926, 7427, 0, 0, 0x65,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {12947, 7427, 0, 0, 0x65,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {12968, 7427, 0, 0, 0x66,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {12989, 7427, 0, 0, 0x66,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13010, 7427, 0, 0, 0x66,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13031, 7427, 0, 0, 0x67,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13058, 7427, 0, 0, 0x80,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13093, 7427, 0, 0, 0x80,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13128, 7427, 0, 0, 0x80,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13163, 7427, 0, 0, 0x80,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13198, 7427, 0, 0, 0x81,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13232, 7427, 0, 0, 0x81,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13266, 7427, 0, 0, 0x81,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13300, 7427, 0, 0, 0x81,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13334, 7427, 0, 0, 0x82,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13356, 7427, 0, 0, 0x83,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13394, 7427, 0, 0, 0x83,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13432, 7427, 0, 0, 0x83,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13470, 7427, 0, 0, 0x83,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13508, 7427, 0, 0, 0x84,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {13530, 7427, 0, 0, 0x84,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13552, 7427, 0, 0, 0x84,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {13574, 7427, 0, 0, 0x84,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {13596, 7427, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {13630, 7427, 0, 0, 0x86,0x01,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable westmere_arch_events = {
+    NUM_ARCH_EVENTS_WESTMERE,
+    westmere_arch_event_strings,
+    westmere_arch_event_options,
+    westmere_arch_event_entries
+};
@@ -0,0 +1,366 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ZEN2 170
+
+static const char zen2_arch_event_strings[] =
+    "ACTUAL_CPU_CLOCK\0"
+    "FIXC1\0"
+    "APERF\0"
+    "MAX_CPU_CLOCK\0"
+    "FIXC2\0"
+    "MPERF\0"
+    "MERGE\0"
+    "PMC\0"
+    "RETIRED_SSE_AVX_FLOPS_ADD_SUB\0"
+    "RETIRED_SSE_AVX_FLOPS_MULT\0"
+    "RETIRED_SSE_AVX_FLOPS_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_ADD_MULT_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_FMA\0"
+    "RETIRED_SSE_AVX_FLOPS_ALL\0"
+    "RETIRED_SERIALIZING_OPS_SSE_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_SSE_CONTROL\0"
+    "RETIRED_SERIALIZING_OPS_X87_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_X87_CONTROL\0"
+    "FP_DISPATCH_FAULTS_X86_FILL\0"
+    "FP_DISPATCH_FAULTS_XMM_FILL\0"
+    "FP_DISPATCH_FAULTS_YMM_FILL\0"
+    "FP_DISPATCH_FAULTS_YMM_SPILL\0"
+    "RETIRED_LOCK_INSTR\0"
+    "RETIRED_CLFLUSH\0"
+    "RETIRED_CPUID\0"
+    "LS_DISPATCH_LOADS\0"
+    "LS_DISPATCH_STORES\0"
+    "LS_DISPATCH_LOAD_OP_STORES\0"
+    "SMIS_RECEIVED\0"
+    "INTERRUPTS_TAKEN\0"
+    "ST_TO_LD_FWD\0"
+    "ST_COMMIT_CANCELS\0"
+    "DATA_CACHE_ACCESSES\0"
+    "LS_MAB_ALLOC_LOADS\0"
+    "LS_MAB_ALLOC_STORES\0"
+    "LS_MAB_ALLOC_HW_PF\0"
+    "DATA_CACHE_REFILLS_LOCAL_L2\0"
+    "DATA_CACHE_REFILLS_LOCAL_CACHE\0"
+    "DATA_CACHE_REFILLS_LOCAL_DRAM\0"
+    "DATA_CACHE_REFILLS_LOCAL_ALL\0"
+    "DATA_CACHE_REFILLS_REMOTE_CACHE\0"
+    "DATA_CACHE_REFILLS_REMOTE_DRAM\0"
+    "DATA_CACHE_REFILLS_REMOTE_ALL\0"
+    "DATA_CACHE_REFILLS_ALL\0"
+    "L1_DTLB_MISS_4K_L2_HIT\0"
+    "L1_DTLB_MISS_32K_L2_HIT\0"
+    "L1_DTLB_MISS_2M_L2_HIT\0"
+    "L1_DTLB_MISS_1G_L2_HIT\0"
+    "L1_DTLB_MISS_ANY_L2_HIT\0"
+    "L1_DTLB_MISS_4K_L2_MISS\0"
+    "L1_DTLB_MISS_32K_L2_MISS\0"
+    "L1_DTLB_MISS_2M_L2_MISS\0"
+    "L1_DTLB_MISS_1G_L2_MISS\0"
+    "L1_DTLB_MISS_ANY_L2_MISS\0"
+    "TABLEWALKER_ALLOC_DSIDE0\0"
+    "TABLEWALKER_ALLOC_DSIDE1\0"
+    "TABLEWALKER_ALLOC_ISIDE0\0"
+    "TABLEWALKER_ALLOC_ISIDE1\0"
+    "MISALIGNED_LOADS\0"
+    "PREF_INSTR_DISPATCHED\0"
+    "INEFFECTIVE_SW_PREF_DATA_CACHE_HIT\0"
+    "INEFFECTIVE_SW_PREF_MAB_MATCH\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_CACHE\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_CACHE\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_ALL\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "TLB_FLUSHES\0"
+    "ICACHE_FETCHES\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_L2_REFILLS\0"
+    "ICACHE_SYSTEM_REFILLS\0"
+    "L1_ITLB_MISS_L2_ITLB_HIT\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS\0"
+    "STALLED_CYCLES_BACKEND\0"
+    "STALLED_CYCLES_FRONTEND\0"
+    "L1_BTB_CORRECTION\0"
+    "L2_BTB_CORRECTION\0"
+    "ICACHE_LINES_INVALIDATED_FILL\0"
+    "ICACHE_LINES_INVALIDATED_L2_PROBE\0"
+    "DEC_OVERRIDE_BTB\0"
+    "UOPS_DISP_FROM_DEC\0"
+    "UOPS_DISP_FROM_OPCACHE\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES0_ALU_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_INT_REG_FILE_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_LD_QUEUE_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_ST_QUEUE_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_INT_SCHED_MISC_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_TAKEN_BRANCH_BUFFER_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_FP_REG_FILE_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_FP_SCHED_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES1_FP_MISC_UNAVAIL\0"
+    "RETIRED_INSTRUCTIONS\0"
+    "RETIRED_UOPS\0"
+    "RETIRED_BRANCH_INSTR\0"
+    "RETIRED_MISP_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_MISP_BRANCH_INSTR\0"
+    "RETIRED_FAR_CONTROL_TRANSFERS\0"
+    "RETIRED_NEAR_RETURNS\0"
+    "RETIRED_NEAR_RETURNS_MISP\0"
+    "RETIRED_INDIRECT_BRANCHES_MISP\0"
+    "RETIRED_MMX_FP_INSTR_X87\0"
+    "RETIRED_MMX_FP_INSTR_MMX\0"
+    "RETIRED_MMX_FP_INSTR_SSE\0"
+    "RETIRED_MMX_FP_INSTR_ALL\0"
+    "RETIRED_COND_BRANCH_INSTR\0"
+    "DIV_BUSY_CYCLES\0"
+    "DIV_OP_COUNT\0"
+    "TAGGED_IBS_OPS_COUNT\0"
+    "TAGGED_IBS_OPS_COUNT_RETIRED\0"
+    "TAGGED_IBS_OPS_COUNT_ROLLOVER\0"
+    "RETIRED_FUSED_BRANCH_INSTR\0"
+    "REQUESTS_TO_L2_GRP1_GRP2\0"
+    "REQUESTS_TO_L2_GRP1_L2_HW_PREF\0"
+    "REQUESTS_TO_L2_GRP1_PREF_L2\0"
+    "REQUESTS_TO_L2_GRP1_CHANGE_TO_X\0"
+    "REQUESTS_TO_L2_GRP1_CACHEABLE_IC_READ\0"
+    "REQUESTS_TO_L2_GRP1_LS_RD_BLOCK_C_S\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_X\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_L\0"
+    "REQUESTS_TO_L2_GRP1_DATA_CACHE_MISSES\0"
+    "REQUESTS_TO_L2_GRP1_L1_CACHES_MISS\0"
+    "REQUESTS_TO_L2_GRP1_ALL_NO_PF\0"
+    "REQUESTS_TO_L2_GRP1_ALL\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_RESP\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_ORIG\0"
+    "REQUESTS_TO_L2_GRP2_SMC_INVAL\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ\0"
+    "REQUESTS_TO_L2_GRP2_GRP1\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_MISS\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_C\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_CS\0"
+    "L2_PF_HIT_IN_L2\0"
+    "L2_PF_HIT_IN_L3\0"
+    "L2_PF_MISS_IN_L3\0"
+    "L3_ACCESS\0"
+    "CPMC\0"
+    "L3_MISS\0"
+    "L3_CACHE_REQ\0"
+    "L3_MISS_LAT\0"
+    "L3_MISS_REQ\0"
+    "RAPL_CORE_ENERGY\0"
+    "PWR0\0"
+    "RAPL_PKG_ENERGY\0"
+    "PWR1\0"
+    "DRAM_CHANNEL_0\0"
+    "DFC\0"
+    "DRAM_CHANNEL_1\0"
+    "DATA_OUT_TO_REMOTE_0\0"
+    "DATA_OUT_TO_REMOTE_1\0"
+    "DATA_OUT_TO_REMOTE_2\0"
+    "DATA_OUT_TO_REMOTE_3\0"
+    "DATA_OUT_TO_REMOTE_4\0"
+    "DATA_OUT_TO_REMOTE_5\0";
+
+static const PerfmonEventOption zen2_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry zen2_arch_event_entries[NUM_ARCH_EVENTS_ZEN2] = {
+ {0, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 61, 0, 0, 0xFFF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65, 61, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {95, 61, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {122, 61, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 61, 0, 0, 0x03,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {183, 61, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {209, 61, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {235, 61, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {270, 61, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {306, 61, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {341, 61, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {377, 61, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {405, 61, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {433, 61, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {461, 61, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {490, 61, 0, 0, 0x25,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {509, 61, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {525, 61, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {539, 61, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {557, 61, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {576, 61, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {603, 61, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {617, 61, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {634, 61, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {647, 61, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {665, 61, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {685, 61, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {704, 61, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {724, 61, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {743, 61, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {771, 61, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {802, 61, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {832, 61, 0, 0, 0x43,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {861, 61, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {893, 61, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {924, 61, 0, 0, 0x43,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {954, 61, 0, 0, 0x43,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {977, 61, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1000, 61, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1024, 61, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1047, 61, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1070, 61, 0, 0, 0x45,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1094, 61, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1118, 61, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {1143, 61, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1167, 61, 0, 0, 0x45,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1191, 61, 0, 0, 0x45,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1216, 61, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1241, 61, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1266, 61, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1291, 61, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1316, 61, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1333, 61, 0, 0, 0x4B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1355, 61, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1390, 61, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1420, 61, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1453, 61, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1489, 61, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1524, 61, 0, 0, 0x59,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {1558, 61, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1595, 61, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1631, 61, 0, 0, 0x59,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1666, 61, 0, 0, 0x59,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {1694, 61, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1727, 61, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1763, 61, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1798, 61, 0, 0, 0x5A,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {1832, 61, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1869, 61, 0, 0, 0x5A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1905, 61, 0, 0, 0x5A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1940, 61, 0, 0, 0x5A,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {1968, 61, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1988, 61, 0, 0, 0x78,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2000, 61, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2015, 61, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2029, 61, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2047, 61, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2069, 61, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2094, 61, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2120, 61, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2143, 61, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2167, 61, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2185, 61, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2203, 61, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2233, 61, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2267, 61, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2284, 61, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2303, 61, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2326, 61, 0, 0, 0xAF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2372, 61, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2421, 61, 0, 0, 0xAE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2466, 61, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2511, 61, 0, 0, 0xAE,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2562, 61, 0, 0, 0xAE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2618, 61, 0, 0, 0xAE,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2666, 61, 0, 0, 0xAE,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2711, 61, 0, 0, 0xAE,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2757, 61, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2778, 61, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2791, 61, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2812, 61, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2838, 61, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2865, 61, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2897, 61, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2927, 61, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2948, 61, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2974, 61, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3005, 61, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3030, 61, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3055, 61, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3080, 61, 0, 0, 0xCB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {3105, 61, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3131, 61, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3147, 61, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3160, 61, 0, 0, 0x1CF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3181, 61, 0, 0, 0x1CF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3210, 61, 0, 0, 0x1CF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3240, 61, 0, 0, 0x1D0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3267, 61, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3292, 61, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3323, 61, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3351, 61, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3383, 61, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3421, 61, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3457, 61, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3488, 61, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3519, 61, 0, 0, 0x60,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {3557, 61, 0, 0, 0x60,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {3592, 61, 0, 0, 0x60,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {3622, 61, 0, 0, 0x60,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {3646, 61, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3680, 61, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3714, 61, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3744, 61, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3781, 61, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3815, 61, 0, 0, 0x61,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {3843, 61, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3880, 61, 0, 0, 0x61,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3914, 61, 0, 0, 0x61,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {3942, 61, 0, 0, 0x61,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3967, 61, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4006, 61, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4046, 61, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4086, 61, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4126, 61, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4166, 61, 0, 0, 0x64,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4212, 61, 0, 0, 0x64,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4258, 61, 0, 0, 0x64,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4299, 61, 0, 0, 0x70,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {4315, 61, 0, 0, 0x71,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {4331, 61, 0, 0, 0x72,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {4348, 4358, 0, 0, 0x01,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4363, 4358, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4371, 4358, 0, 0, 0x04,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4384, 4358, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4396, 4358, 0, 0, 0x9A,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {4408, 4425, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4430, 4446, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4451, 4466, 0, 0, 0x07,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {4470, 4466, 0, 0, 0x47,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {4485, 4466, 0, 0, 0x187,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4506, 4466, 0, 0, 0x1C7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4527, 4466, 0, 0, 0x207,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4548, 4466, 0, 0, 0x287,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4569, 4466, 0, 0, 0x247,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4590, 4466, 0, 0, 0x2C7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable zen2_arch_events = {
+    NUM_ARCH_EVENTS_ZEN2,
+    zen2_arch_event_strings,
+    zen2_arch_event_options,
+    zen2_arch_event_entries
+};
@@ -0,0 +1,632 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ZEN3 303
+
+static const char zen3_arch_event_strings[] =
+    "ACTUAL_CPU_CLOCK\0"
+    "FIXC1\0"
+    "APERF\0"
+    "MAX_CPU_CLOCK\0"
+    "FIXC2\0"
+    "MPERF\0"
+    "MERGE\0"
+    "PMC\0"
+    "RETIRED_SSE_AVX_FLOPS_ADD_SUB\0"
+    "RETIRED_SSE_AVX_FLOPS_MULT\0"
+    "RETIRED_SSE_AVX_FLOPS_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_ADD_MULT_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_MAC\0"
+    "RETIRED_SSE_AVX_FLOPS_FMA\0"
+    "RETIRED_SSE_AVX_FLOPS_ALL\0"
+    "RETIRED_SERIALIZING_OPS_SSE_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_SSE_CONTROL\0"
+    "RETIRED_SERIALIZING_OPS_X87_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_X87_CONTROL\0"
+    "FP_DISPATCH_FAULTS_X87_FILL\0"
+    "FP_DISPATCH_FAULTS_XMM_FILL\0"
+    "FP_DISPATCH_FAULTS_YMM_FILL\0"
+    "FP_DISPATCH_FAULTS_YMM_SPILL\0"
+    "FP_DISPATCH_FAULTS_SSE_AVX_STALL\0"
+    "BAD_STATUS2_STLI_NO_STATE\0"
+    "BAD_STATUS2_STLI_OTHER\0"
+    "BAD_STATUS2_STLF_NO_DATA\0"
+    "RETIRED_LOCK_INSTR_BUS_LOCK\0"
+    "RETIRED_LOCK_INSTR_NON_SPEC_LOCK\0"
+    "RETIRED_LOCK_INSTR_SPEC_LOCK_LO_SPEC\0"
+    "RETIRED_LOCK_INSTR_SPEC_LOCK_HI_SPEC\0"
+    "RETIRED_CLFLUSH\0"
+    "RETIRED_CPUID\0"
+    "LS_DISPATCH_LOADS\0"
+    "LS_DISPATCH_STORES\0"
+    "LS_DISPATCH_LOAD_OP_STORES\0"
+    "LS_DISPATCH_ALL\0"
+    "SMIS_RECEIVED\0"
+    "INTERRUPTS_TAKEN\0"
+    "TSC_READS\0"
+    "ST_TO_LD_FWD\0"
+    "ST_COMMIT_CANCELS_ST_COMMIT_CANCEL_WCB_FULL\0"
+    "DATA_CACHE_ACCESSES\0"
+    "DATA_CACHE_REFILLS_LOCAL_L2\0"
+    "DATA_CACHE_REFILLS_INT_CACHE\0"
+    "DATA_CACHE_REFILLS_EXT_CACHE_LOCAL\0"
+    "DATA_CACHE_REFILLS_LOCAL_DRAM\0"
+    "DATA_CACHE_REFILLS_LOCAL_ALL\0"
+    "DATA_CACHE_REFILLS_EXT_REMOTE_CACHE\0"
+    "DATA_CACHE_REFILLS_REMOTE_DRAM\0"
+    "DATA_CACHE_REFILLS_REMOTE_ALL\0"
+    "DATA_CACHE_REFILLS_ALL\0"
+    "DATA_CACHE_REFILLS_FROM_MEMORY\0"
+    "DATA_CACHE_REFILLS_FROM_REMOTE_NODE\0"
+    "DATA_CACHE_REFILLS_FROM_SAME_CCX\0"
+    "DATA_CACHE_REFILLS_FROM_EXTERNAL_CCX_CACHE\0"
+    "L1_DC_REFILLS_LOCAL_L2\0"
+    "L1_DC_REFILLS_INT_CACHE\0"
+    "L1_DC_REFILLS_EXT_CACHE_LOCAL\0"
+    "L1_DC_REFILLS_LOCAL_DRAM\0"
+    "L1_DC_REFILLS_LOCAL_ALL\0"
+    "L1_DC_REFILLS_EXT_CACHE_REMOTE\0"
+    "L1_DC_REFILLS_REMOTE_DRAM\0"
+    "L1_DC_REFILLS_REMOTE_ALL\0"
+    "L1_DC_REFILLS_ALL\0"
+    "L1_DC_REFILLS_EXT_CACHE\0"
+    "L1_DC_REFILLS_LOCAL_CACHE_L2_L3\0"
+    "L1_DC_REFILLS_DRAM\0"
+    "L1_DTLB_MISS_4K_L2_HIT\0"
+    "L1_DTLB_MISS_2M_L2_HIT\0"
+    "L1_DTLB_MISS_1G_L2_HIT\0"
+    "L1_DTLB_MISS_ANY_L2_HIT\0"
+    "L1_DTLB_MISS_4K_L2_MISS\0"
+    "L1_DTLB_MISS_2M_L2_MISS\0"
+    "L1_DTLB_MISS_1G_L2_MISS\0"
+    "L1_DTLB_MISS_ANY_L2_MISS\0"
+    "L1_DTLB_MISS_ANY_MISS\0"
+    "PAGE_TABLE_WALKS_WALK_DSIDE\0"
+    "PAGE_TABLE_WALKS_WALK_ISIDE\0"
+    "PAGE_TABLE_WALKS_MAB_ALLOC_DSIDE\0"
+    "PAGE_TABLE_WALKS_MAB_ALLOC_ISIDE\0"
+    "MISALIGNED_LOADS_COUNT_MA_64B\0"
+    "MISALIGNED_LOADS_COUNT_MA_4K\0"
+    "MISALIGNED_LOADS_ANY\0"
+    "PREF_INSTR_DISPATCHED_PREFETCH\0"
+    "PREF_INSTR_DISPATCHED_PREFETCHW\0"
+    "PREF_INSTR_DISPATCHED_PREFETCHNTA\0"
+    "HWPF_ENTRIES_ALLOC_STREAM_ALLOC\0"
+    "HWPF_ENTRIES_ALLOC_STRIDE_ALLOC\0"
+    "HWPF_ENTRIES_ALLOC_REGION_ALLOC\0"
+    "HWPF_ENTRIES_HIT_STREAM_HIT\0"
+    "HWPF_ENTRIES_HIT_STRIDE_HIT\0"
+    "HWPF_ENTRIES_HIT_REGION_HIT\0"
+    "TABLEWALKER_LATENCY_MAB0_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB1_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB2_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB3_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB4_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB5_DSIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB0_ISIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB1_ISIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB2_ISIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB3_ISIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB4_ISIDE_WALKS\0"
+    "TABLEWALKER_LATENCY_MAB5_ISIDE_WALKS\0"
+    "WC_BUFFER_CLOSE_FLUSH_FULL_LINE_64B\0"
+    "WC_BUFFER_CLOSE_FLUSH_NEED_SBEX\0"
+    "WC_BUFFER_CLOSE_FLUSH_WFQ_VIRT_CR_BUS_LOCK\0"
+    "WC_BUFFER_CLOSE_FLUSH_BARRIER\0"
+    "WC_BUFFER_CLOSE_FLUSH_WCB_FULL\0"
+    "WC_BUFFER_CLOSE_FLUSH_TIMER\0"
+    "WC_BUFFER_CLOSE_FLUSH_SMC_HIT\0"
+    "WC_BUFFER_CLOSE_FLUSH_LD_HIT\0"
+    "INEFFECTIVE_SW_PREF_DATA_PIPE_SW_PF_DC_HIT\0"
+    "INEFFECTIVE_SW_PREF_MAB_MCH_CNT\0"
+    "INEFFECTIVE_SW_PREF_ANY\0"
+    "MAB_MATCH\0"
+    "HWPF_MAB_ALLOC_STREAM\0"
+    "HWPF_MAB_ALLOC_L1_STRIDE\0"
+    "HWPF_MAB_ALLOC_REGION\0"
+    "HWPF_MAB_ALLOC_L2_STRIDE\0"
+    "HWPF_MAB_MATCH_STREAM\0"
+    "HWPF_MAB_MATCH_L1_STRIDE\0"
+    "HWPF_MAB_MATCH_REGION\0"
+    "HWPF_MAB_MATCH_L2_STRIDE\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "SWPREF_DATA_CACHE_FILLS_INT_CACHE\0"
+    "SWPREF_DATA_CACHE_FILLS_EXT_CACHE_LOCAL\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_EXT_CACHE_REMOTE\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "HWPREF_DATA_CACHE_FILLS_INT_CACHE\0"
+    "HWPREF_DATA_CACHE_FILLS_EXT_CACHE_LOCAL\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_EXT_CACHE_REMOTE\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_ALL\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_NEAR_CACHE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_FAR_CACHE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_ALL\0"
+    "COUNT_OF_ALLOC_MABS\0"
+    "TABLEWALKER_INIT_LEVEL_HIT_LEAF\0"
+    "TABLEWALKER_INIT_LEVEL_RD_PTE\0"
+    "TABLEWALKER_INIT_LEVEL_RD_PDE\0"
+    "TABLEWALKER_INIT_LEVEL_RD_PDPE\0"
+    "TABLEWALKER_INIT_LEVEL_RD_PML4E\0"
+    "TABLEWALKER_INIT_LEVEL_RD_PML5E\0"
+    "TABLEWALKER_INIT_LEVEL_COUNT_GUEST_HOST\0"
+    "TABLEWALKER_INIT_LEVEL_COUNT_NESTED\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "TLB_FLUSHES\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_VAL_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_RETRY_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_FAULT_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_ADBIT_NEEDED_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SBEX_VAL_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SBEX_FAULT_DSIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_VAL_ISIDE\0"
+    "TABLEWALKER_RETURN_TYPES_RETRY_ISIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_FAULT_ISIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SPEC_ADBIT_NEEDED_ISIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SBEX_VAL_ISIDE\0"
+    "TABLEWALKER_RETURN_TYPES_SBEX_FAULT_ISIDE\0"
+    "ICACHE_FETCHES\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_L2_REFILLS\0"
+    "ICACHE_SYSTEM_REFILLS\0"
+    "L1_ITLB_MISS_L2_ITLB_HIT\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS_IF_4K\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS_IF_2M\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS_IF_1G\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS_COALESCED_4K\0"
+    "L1_ITLB_MISS_L2_ITLB_MISS_ANY\0"
+    "STALLED_CYCLES_BACKEND\0"
+    "STALLED_CYCLES_FRONTEND\0"
+    "L1_BTB_HIT\0"
+    "L2_BTB_HIT\0"
+    "L2_BTB_CORRECT_SPEC\0"
+    "ICACHE_LINES_INVALIDATED_FILL\0"
+    "ICACHE_LINES_INVALIDATED_L2_PROBE\0"
+    "DYNAMIC_INDIRECT_PREDICTIONS\0"
+    "DEC_REDIRECTS\0"
+    "L1_TLB_FETCH_HIT_IF_4K\0"
+    "L1_TLB_FETCH_HIT_IF_2M\0"
+    "L1_TLB_FETCH_HIT_IF_1G\0"
+    "ITLB_RELOADS_ALL\0"
+    "ITLB_RELOADS_ITLB_INVALIDATION\0"
+    "IC_TAG_HIT\0"
+    "IC_TAG_MISS\0"
+    "IC_TAG_ACCESSES\0"
+    "OC_MODE_SWITCH_IC_OC\0"
+    "OC_MODE_SWITCH_OC_IC\0"
+    "UOPS_QUEUE_EMTPY\0"
+    "UOPS_DISP_FROM_DEC\0"
+    "UOPS_DISP_FROM_OPCACHE\0"
+    "TYPE_UOPS_FROM_DECODER_FP\0"
+    "TYPE_UOPS_FROM_DECODER_INT\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_INT_REGFILE\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_LOAD_QUEUE\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_STORE_QUEUE\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_TAKEN_BRANCH\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_FP_REGFILE\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_FP_SCHEDULER\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_1_FP_FLUSH\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_2_INT_SCHEDULER_0_TOKENS\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_2_INT_SCHEDULER_1_TOKENS\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_2_INT_SCHEDULER_2_TOKENS\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_2_INT_SCHEDULER_3_TOKENS\0"
+    "DISPATCH_RESOURCE_STALL_CYCLES_2_RETIRE_TOKEN_STALL\0"
+    "RETIRED_INSTRUCTIONS\0"
+    "RETIRED_UOPS\0"
+    "RETIRED_BRANCH_INSTR\0"
+    "RETIRED_MISP_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_MISP_BRANCH_INSTR\0"
+    "RETIRED_FAR_CONTROL_TRANSFERS\0"
+    "RETIRED_NEAR_RETURNS\0"
+    "RETIRED_NEAR_RETURNS_MISP\0"
+    "RETIRED_INDIRECT_BRANCHES_MISP\0"
+    "RETIRED_MMX_FP_INSTR_X87\0"
+    "RETIRED_MMX_FP_INSTR_MMX\0"
+    "RETIRED_MMX_FP_INSTR_SSE\0"
+    "RETIRED_MMX_FP_INSTR_ALL\0"
+    "RETIRED_INDIRECT_BRANCH_INSTR\0"
+    "RETIRED_COND_BRANCH_INSTR\0"
+    "DIV_BUSY_CYCLES\0"
+    "DIV_OP_COUNT\0"
+    "RETIRED_MISP_BRANCH_INSTR_DIRECTION_MISMATCH\0"
+    "TAGGED_IBS_OPS_COUNT\0"
+    "TAGGED_IBS_OPS_COUNT_RETIRED\0"
+    "TAGGED_IBS_OPS_COUNT_ROLLOVER\0"
+    "RETIRED_FUSED_BRANCH_INSTR\0"
+    "REQUESTS_TO_L2_GRP1_GRP2\0"
+    "REQUESTS_TO_L2_GRP1_L2_HW_PREF\0"
+    "REQUESTS_TO_L2_GRP1_PREF_L2\0"
+    "REQUESTS_TO_L2_GRP1_CHANGE_TO_X\0"
+    "REQUESTS_TO_L2_GRP1_CACHEABLE_IC_READ\0"
+    "REQUESTS_TO_L2_GRP1_LS_RD_BLOCK_C_S\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_X\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_L\0"
+    "REQUESTS_TO_L2_GRP1_DATA_CACHE_MISSES\0"
+    "REQUESTS_TO_L2_GRP1_L1_CACHES_MISS\0"
+    "REQUESTS_TO_L2_GRP1_ALL_NO_PF\0"
+    "REQUESTS_TO_L2_GRP1_ALL\0"
+    "L2_CACHE_ACCESS_AFTER_L1I_MISS\0"
+    "L2_CACHE_ACCESS_AFTER_L1D_MISS\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_RESP\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_ORIG\0"
+    "REQUESTS_TO_L2_GRP2_SMC_INVAL\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_ALL\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_ALL\0"
+    "REQUESTS_TO_L2_GRP2_GRP1\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_MISS\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_C\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_CS\0"
+    "CORE_TO_L2_CACHE_REQUESTS_MISSES\0"
+    "CORE_TO_L2_CACHE_REQUESTS_HITS\0"
+    "L2_CACHE_MISS_AFTER_L1I_MISS\0"
+    "L2_CACHE_HIT_AFTER_L1I_MISS\0"
+    "L2_CACHE_MISS_AFTER_L1D_MISS\0"
+    "L2_CACHE_HIT_AFTER_L1D_MISS\0"
+    "L2_CACHE_MISS_AFTER_L1_MISS\0"
+    "L2_PF_HIT_IN_L2\0"
+    "L2_PF_HIT_IN_L3\0"
+    "L2_PF_HIT_IN_L3_MISS_L2\0"
+    "L2_PF_MISS_IN_L3\0"
+    "L2_PF_MISS_IN_L3_MISS_L2\0"
+    "L3_ACCESS_ALL_TYPES\0"
+    "CPMC\0"
+    "L3_ACCESS_MISS\0"
+    "L3_MISS_LAT\0"
+    "L3_MISS_REQ\0"
+    "RAPL_CORE_ENERGY\0"
+    "PWR0\0"
+    "RAPL_PKG_ENERGY\0"
+    "PWR1\0"
+    "DF_EVENT_REMOTE_1\0"
+    "DFC\0"
+    "DF_EVENT_REMOTE_2\0"
+    "DF_EVENT_REMOTE_3\0"
+    "DF_EVENT_REMOTE_5\0"
+    "DRAM_CHANNEL_0\0"
+    "DRAM_CHANNEL_1\0"
+    "DRAM_CHANNEL_2\0"
+    "DRAM_CHANNEL_3\0"
+    "DRAM_CHANNEL_4\0"
+    "DRAM_CHANNEL_5\0"
+    "DRAM_CHANNEL_6\0"
+    "DRAM_CHANNEL_7\0";
+
+static const PerfmonEventOption zen3_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry zen3_arch_event_entries[NUM_ARCH_EVENTS_ZEN3] = {
+ {0, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 61, 0, 0, 0xFFF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65, 61, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {95, 61, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {122, 61, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {148, 61, 0, 0, 0x03,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {183, 61, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {209, 61, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {235, 61, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {261, 61, 0, 0, 0x05,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {296, 61, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {332, 61, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {367, 61, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {403, 61, 0, 0, 0x0E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {431, 61, 0, 0, 0x0E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {459, 61, 0, 0, 0x0E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {487, 61, 0, 0, 0x0E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {516, 61, 0, 0, 0x0E,0x0E,0,0,EVENT_OPTION_NONE_MASK}
+, {549, 61, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {575, 61, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {598, 61, 0, 0, 0x24,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {623, 61, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {651, 61, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {684, 61, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {721, 61, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {758, 61, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {774, 61, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {788, 61, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {806, 61, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {825, 61, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {852, 61, 0, 0, 0x29,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {868, 61, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {882, 61, 0, 0, 0x2C,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {899, 61, 0, 0, 0x2D,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {909, 61, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {922, 61, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {966, 61, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {986, 61, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1014, 61, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1043, 61, 0, 0, 0x43,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1078, 61, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1108, 61, 0, 0, 0x43,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1137, 61, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1173, 61, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1204, 61, 0, 0, 0x43,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1234, 61, 0, 0, 0x43,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1257, 61, 0, 0, 0x43,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1288, 61, 0, 0, 0x43,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1324, 61, 0, 0, 0x43,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1357, 61, 0, 0, 0x43,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {1400, 61, 0, 0, 0x44,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1423, 61, 0, 0, 0x44,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1447, 61, 0, 0, 0x44,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1477, 61, 0, 0, 0x44,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1502, 61, 0, 0, 0x44,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1526, 61, 0, 0, 0x44,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1557, 61, 0, 0, 0x44,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1583, 61, 0, 0, 0x44,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1608, 61, 0, 0, 0x44,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {1626, 61, 0, 0, 0x44,0x14,0,0,EVENT_OPTION_NONE_MASK}
+, {1650, 61, 0, 0, 0x44,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {1682, 61, 0, 0, 0x44,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {1701, 61, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1724, 61, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1747, 61, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1770, 61, 0, 0, 0x45,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {1794, 61, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1818, 61, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1842, 61, 0, 0, 0x45,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {1866, 61, 0, 0, 0x45,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {1891, 61, 0, 0, 0x45,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1913, 61, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1941, 61, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1969, 61, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2002, 61, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2035, 61, 0, 0, 0x47,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2065, 61, 0, 0, 0x47,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2094, 61, 0, 0, 0x47,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {2115, 61, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2146, 61, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2178, 61, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2212, 61, 0, 0, 0x4C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2244, 61, 0, 0, 0x4C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2276, 61, 0, 0, 0x4C,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2308, 61, 0, 0, 0x4D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2336, 61, 0, 0, 0x4D,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2364, 61, 0, 0, 0x4D,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2392, 61, 0, 0, 0x4E,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {2429, 61, 0, 0, 0x4E,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {2466, 61, 0, 0, 0x4E,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {2503, 61, 0, 0, 0x4E,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {2540, 61, 0, 0, 0x4E,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2577, 61, 0, 0, 0x4E,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {2614, 61, 0, 0, 0x4E,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {2651, 61, 0, 0, 0x4E,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {2688, 61, 0, 0, 0x4E,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {2725, 61, 0, 0, 0x4E,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {2762, 61, 0, 0, 0x4E,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {2799, 61, 0, 0, 0x4E,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {2836, 61, 0, 0, 0x50,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2872, 61, 0, 0, 0x50,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2904, 61, 0, 0, 0x50,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2947, 61, 0, 0, 0x50,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2977, 61, 0, 0, 0x50,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3008, 61, 0, 0, 0x50,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {3036, 61, 0, 0, 0x50,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3066, 61, 0, 0, 0x50,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {3095, 61, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3138, 61, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3170, 61, 0, 0, 0x52,0x03,0,0,EVENT_OPTION_NONE_MASK}
+, {3194, 61, 0, 0, 0x55,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3204, 61, 0, 0, 0x57,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3226, 61, 0, 0, 0x57,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3251, 61, 0, 0, 0x57,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3273, 61, 0, 0, 0x57,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3298, 61, 0, 0, 0x58,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3320, 61, 0, 0, 0x58,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3345, 61, 0, 0, 0x58,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3367, 61, 0, 0, 0x58,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3392, 61, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3425, 61, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3459, 61, 0, 0, 0x59,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3499, 61, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3534, 61, 0, 0, 0x59,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3568, 61, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3609, 61, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3645, 61, 0, 0, 0x59,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3680, 61, 0, 0, 0x59,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {3708, 61, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3741, 61, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3775, 61, 0, 0, 0x5A,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3815, 61, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3850, 61, 0, 0, 0x5A,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3884, 61, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3925, 61, 0, 0, 0x5A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3961, 61, 0, 0, 0x5A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3996, 61, 0, 0, 0x5A,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {4024, 61, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4062, 61, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4103, 61, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4143, 61, 0, 0, 0x5B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4190, 61, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4236, 61, 0, 0, 0x5B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4277, 61, 0, 0, 0x5B,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {4312, 61, 0, 0, 0x5B,0x54,0,0,EVENT_OPTION_NONE_MASK}
+, {4348, 61, 0, 0, 0x5B,0x5F,0,0,EVENT_OPTION_NONE_MASK}
+, {4381, 61, 0, 0, 0x5F,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4401, 61, 0, 0, 0x6E,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4433, 61, 0, 0, 0x6E,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4463, 61, 0, 0, 0x6E,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4493, 61, 0, 0, 0x6E,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4524, 61, 0, 0, 0x6E,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4556, 61, 0, 0, 0x6E,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4588, 61, 0, 0, 0x6E,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4628, 61, 0, 0, 0x6E,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4664, 61, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4684, 61, 0, 0, 0x78,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4696, 61, 0, 0, 0x170,0x41,0,0,EVENT_OPTION_NONE_MASK}
+, {4736, 61, 0, 0, 0x170,0x42,0,0,EVENT_OPTION_NONE_MASK}
+, {4773, 61, 0, 0, 0x170,0x44,0,0,EVENT_OPTION_NONE_MASK}
+, {4815, 61, 0, 0, 0x170,0x48,0,0,EVENT_OPTION_NONE_MASK}
+, {4864, 61, 0, 0, 0x170,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {4904, 61, 0, 0, 0x170,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {4946, 61, 0, 0, 0x170,0x81,0,0,EVENT_OPTION_NONE_MASK}
+, {4986, 61, 0, 0, 0x170,0x82,0,0,EVENT_OPTION_NONE_MASK}
+, {5023, 61, 0, 0, 0x170,0x84,0,0,EVENT_OPTION_NONE_MASK}
+, {5065, 61, 0, 0, 0x170,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {5114, 61, 0, 0, 0x170,0x90,0,0,EVENT_OPTION_NONE_MASK}
+, {5154, 61, 0, 0, 0x170,0xA0,0,0,EVENT_OPTION_NONE_MASK}
+, {5196, 61, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5211, 61, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5225, 61, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5243, 61, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5265, 61, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5290, 61, 0, 0, 0x85,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5322, 61, 0, 0, 0x85,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5354, 61, 0, 0, 0x85,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5386, 61, 0, 0, 0x85,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5425, 61, 0, 0, 0x85,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {5455, 61, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5478, 61, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5502, 61, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5513, 61, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5524, 61, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5544, 61, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5574, 61, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5608, 61, 0, 0, 0x8E,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5637, 61, 0, 0, 0x91,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5651, 61, 0, 0, 0x94,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5674, 61, 0, 0, 0x94,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5697, 61, 0, 0, 0x94,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5720, 61, 0, 0, 0x99,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5737, 61, 0, 0, 0x99,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5768, 61, 0, 0, 0x18E,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {5779, 61, 0, 0, 0x18E,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {5791, 61, 0, 0, 0x18E,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {5807, 61, 0, 0, 0x28A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5828, 61, 0, 0, 0x28A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5849, 61, 0, 0, 0xA9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {5866, 61, 0, 0, 0xAA,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5885, 61, 0, 0, 0xAA,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5908, 61, 0, 0, 0xAB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5934, 61, 0, 0, 0xAB,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5961, 61, 0, 0, 0xAE,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6006, 61, 0, 0, 0xAE,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6050, 61, 0, 0, 0xAE,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6095, 61, 0, 0, 0xAE,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {6141, 61, 0, 0, 0xAE,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6185, 61, 0, 0, 0xAE,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {6231, 61, 0, 0, 0xAE,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6273, 61, 0, 0, 0xAF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6329, 61, 0, 0, 0xAF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6385, 61, 0, 0, 0xAF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6441, 61, 0, 0, 0xAF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {6497, 61, 0, 0, 0xAF,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {6549, 61, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6570, 61, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6583, 61, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6604, 61, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6630, 61, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6657, 61, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6689, 61, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6719, 61, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6740, 61, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6766, 61, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6797, 61, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6822, 61, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6847, 61, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {6872, 61, 0, 0, 0xCB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {6897, 61, 0, 0, 0xCC,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6927, 61, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6953, 61, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6969, 61, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6982, 61, 0, 0, 0x1C7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7027, 61, 0, 0, 0x1CF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7048, 61, 0, 0, 0x1CF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7077, 61, 0, 0, 0x1CF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7107, 61, 0, 0, 0x1D0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {7134, 61, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7159, 61, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7190, 61, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7218, 61, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7250, 61, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7288, 61, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7324, 61, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7355, 61, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7386, 61, 0, 0, 0x60,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {7424, 61, 0, 0, 0x60,0x88,0,0,EVENT_OPTION_NONE_MASK}
+, {7459, 61, 0, 0, 0x60,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {7489, 61, 0, 0, 0x60,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {7513, 61, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7544, 61, 0, 0, 0x60,0xE8,0,0,EVENT_OPTION_NONE_MASK}
+, {7575, 61, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7609, 61, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7643, 61, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {7673, 61, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {7710, 61, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {7744, 61, 0, 0, 0x61,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {7776, 61, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {7813, 61, 0, 0, 0x61,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {7847, 61, 0, 0, 0x61,0x60,0,0,EVENT_OPTION_NONE_MASK}
+, {7879, 61, 0, 0, 0x61,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {7904, 61, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {7943, 61, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {7983, 61, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {8023, 61, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8063, 61, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {8103, 61, 0, 0, 0x64,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {8149, 61, 0, 0, 0x64,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {8195, 61, 0, 0, 0x64,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {8236, 61, 0, 0, 0x64,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8269, 61, 0, 0, 0x64,0xF6,0,0,EVENT_OPTION_NONE_MASK}
+, {8300, 61, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8329, 61, 0, 0, 0x64,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {8357, 61, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {8386, 61, 0, 0, 0x64,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {8414, 61, 0, 0, 0x64,0x09,0,0,EVENT_OPTION_NONE_MASK}
+, {8442, 61, 0, 0, 0x70,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8458, 61, 0, 0, 0x71,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8474, 61, 0, 0, 0x71,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8498, 61, 0, 0, 0x72,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8515, 61, 0, 0, 0x72,0x1F,0,0,EVENT_OPTION_NONE_MASK}
+, {8540, 8560, 0, 0, 0x04,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8565, 8560, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {8580, 8560, 0, 0, 0x90,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8592, 8560, 0, 0, 0x9A,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {8604, 8621, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8626, 8642, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {8647, 8665, 0, 0, 0x7C7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8669, 8665, 0, 0, 0x807,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8687, 8665, 0, 0, 0x847,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8705, 8665, 0, 0, 0x887,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {8723, 8665, 0, 0, 0x07,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8738, 8665, 0, 0, 0x47,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8753, 8665, 0, 0, 0x87,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8768, 8665, 0, 0, 0xC7,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8783, 8665, 0, 0, 0x107,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8798, 8665, 0, 0, 0x147,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8813, 8665, 0, 0, 0x187,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {8828, 8665, 0, 0, 0x1C7,0x38,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable zen3_arch_events = {
+    NUM_ARCH_EVENTS_ZEN3,
+    zen3_arch_event_strings,
+    zen3_arch_event_options,
+    zen3_arch_event_entries
+};
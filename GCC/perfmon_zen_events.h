@@ -0,0 +1,462 @@
+/* DONT TOUCH: GENERATED FILE! */
+
+#define NUM_ARCH_EVENTS_ZEN 218
+
+static const char zen_arch_event_strings[] =
+    "ACTUAL_CPU_CLOCK\0"
+    "FIXC1\0"
+    "APERF\0"
+    "MAX_CPU_CLOCK\0"
+    "FIXC2\0"
+    "MPERF\0"
+    "MERGE\0"
+    "PMC\0"
+    "FPU_PIPE_ASSIGNMENT_UOPS_PIPE_0\0"
+    "FPU_PIPE_ASSIGNMENT_UOPS_PIPE_1\0"
+    "FPU_PIPE_ASSIGNMENT_UOPS_PIPE_2\0"
+    "FPU_PIPE_ASSIGNMENT_UOPS_PIPE_3\0"
+    "FPU_PIPE_ASSIGNMENT_UOPS_PIPE_ALL\0"
+    "FPU_PIPE_ASSIGNMENT_MULTI_PIPE_UOPS_PIPE_0\0"
+    "FPU_PIPE_ASSIGNMENT_MULTI_PIPE_UOPS_PIPE_1\0"
+    "FPU_PIPE_ASSIGNMENT_MULTI_PIPE_UOPS_PIPE_2\0"
+    "FPU_PIPE_ASSIGNMENT_MULTI_PIPE_UOPS_PIPE_3\0"
+    "FPU_PIPE_ASSIGNMENT_MULTI_PIPE_UOPS_PIPE_ALL\0"
+    "FP_SCHEDULER_EMPTY\0"
+    "RETIRED_X87_FLOPS_ADD_SUB\0"
+    "RETIRED_X87_FLOPS_MULT\0"
+    "RETIRED_X87_FLOPS_DIV\0"
+    "RETIRED_X87_FLOPS_ALL\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_ADD_SUB\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_MULT\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_ADD_MULT_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_FMA\0"
+    "RETIRED_SSE_AVX_FLOPS_SINGLE_ALL\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_ADD_SUB\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_MULT\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_ADD_MULT_DIV\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_FMA\0"
+    "RETIRED_SSE_AVX_FLOPS_DOUBLE_ALL\0"
+    "RETIRED_SSE_AVX_FLOPS_ALL\0"
+    "MOVE_ELIMINATION_SSE_MOVES\0"
+    "MOVE_ELIMINATION_SSE_MOVE_ELIMS\0"
+    "SCALAR_OP_OPTIMIZATIONS_POTENTIAL\0"
+    "SCALAR_OP_OPTIMIZATIONS_DONE\0"
+    "RETIRED_SERIALIZING_OPS_SSE_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_SSE_CONTROL\0"
+    "RETIRED_SERIALIZING_OPS_X87_BOTTOM\0"
+    "RETIRED_SERIALIZING_OPS_X87_CONTROL\0"
+    "LS_BAD_STATUS_STLI_NO_STATE\0"
+    "LS_BAD_STATUS_STLI_OTHER\0"
+    "LS_BAD_STATUS_STLF_NO_DATA\0"
+    "LOCKS_BUS_LOCK\0"
+    "LOCKS_NON_SPEC_LOCK\0"
+    "LOCKS_SPEC_LOCK\0"
+    "LOCKS_SPEC_LOCK_MAP_COMMIT\0"
+    "RETIRED_CLFLUSH\0"
+    "RETIRED_CPUID\0"
+    "LS_DISPATCH_LOADS\0"
+    "LS_DISPATCH_STORES\0"
+    "LS_DISPATCH_LOAD_OP_STORES\0"
+    "LS_DISPATCH_ANY\0"
+    "SMIS_RECEIVED\0"
+    "ST_TO_LD_FWD\0"
+    "ST_COMMIT_CANCELS\0"
+    "DATA_CACHE_ACCESSES\0"
+    "MAB_ALLOC_PIPE_DATA\0"
+    "MAB_ALLOC_PIPE_STORE\0"
+    "MAB_ALLOC_PIPE_TLB_LATE\0"
+    "MAB_ALLOC_PIPE_HW_PF\0"
+    "MAB_ALLOC_PIPE_TLB_EARLY\0"
+    "DATA_CACHE_REFILLS_LOCAL_L2\0"
+    "DATA_CACHE_REFILLS_LOCAL_CACHE\0"
+    "DATA_CACHE_REFILLS_LOCAL_DRAM\0"
+    "DATA_CACHE_REFILLS_LOCAL_ALL\0"
+    "DATA_CACHE_REFILLS_REMOTE_CACHE\0"
+    "DATA_CACHE_REFILLS_REMOTE_DRAM\0"
+    "DATA_CACHE_REFILLS_REMOTE_ALL\0"
+    "DATA_CACHE_REFILLS_ALL\0"
+    "L1_DTLB_MISS_4K_L2_HIT\0"
+    "L1_DTLB_MISS_32K_L2_HIT\0"
+    "L1_DTLB_MISS_2M_L2_HIT\0"
+    "L1_DTLB_MISS_1G_L2_HIT\0"
+    "L1_DTLB_MISS_ANY_L2_HIT\0"
+    "L1_DTLB_MISS_4K_L2_MISS\0"
+    "L1_DTLB_MISS_32K_L2_MISS\0"
+    "L1_DTLB_MISS_2M_L2_MISS\0"
+    "L1_DTLB_MISS_1G_L2_MISS\0"
+    "L1_DTLB_MISS_ANY_L2_MISS\0"
+    "TABLEWALKER_ALLOC_DSIDE0\0"
+    "TABLEWALKER_ALLOC_DSIDE1\0"
+    "TABLEWALKER_ALLOC_ISIDE0\0"
+    "TABLEWALKER_ALLOC_ISIDE1\0"
+    "MISALIGNED_LOADS\0"
+    "PREF_INSTR_DISPATCHED_LOAD\0"
+    "PREF_INSTR_DISPATCHED_STORE\0"
+    "PREF_INSTR_DISPATCHED_NTA\0"
+    "INEFFECTIVE_SW_PREF_DATA_CACHE_HIT\0"
+    "INEFFECTIVE_SW_PREF_MAB_MATCH\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_CACHE\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "SWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "SWPREF_DATA_CACHE_FILLS_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_CACHE\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "HWPREF_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "HWPREF_DATA_CACHE_FILLS_ALL\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_L2\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_CACHE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_DRAM\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_LOCAL_ALL\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_CACHE\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_DRAM\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_REMOTE_ALL\0"
+    "TABLEWALKER_DATA_CACHE_FILLS_ALL\0"
+    "CPU_CLOCKS_UNHALTED\0"
+    "ICACHE_FETCHES\0"
+    "ICACHE_MISSES\0"
+    "ICACHE_L2_REFILLS\0"
+    "ICACHE_SYSTEM_REFILLS\0"
+    "L1_ITLB_L2_ITLB_HIT\0"
+    "L1_ITLB_L2_ITLB_MISS\0"
+    "PIPELINE_RESTART_DUE_INSTR_STREAM_PROBE\0"
+    "INSTR_PIPE_STALL_BACK_PRESSURE\0"
+    "INSTR_PIPE_STALL_DQ_EMPTY\0"
+    "INSTR_PIPE_STALL_ANY\0"
+    "L1_BTB_CORRECTION\0"
+    "L2_BTB_CORRECTION\0"
+    "ICACHE_LINES_INVALIDATED_FILL\0"
+    "ICACHE_LINES_INVALIDATED_L2_PROBE\0"
+    "ITLB_RELOADS\0"
+    "OC_MODE_SWITCH_IC_OC\0"
+    "OC_MODE_SWITCH_OC_IC\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALSQ1_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALSQ2_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALSQ3_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALSQ3_0_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALSQ_ANY_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_ALU_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_AGSQ_TOKEN_STALL\0"
+    "DYN_TOKENS_DISP_STALL_CYCLES_RETIRE_TOKEN_STALL\0"
+    "RETIRED_INSTRUCTIONS\0"
+    "RETIRED_UOPS\0"
+    "RETIRED_BRANCH_INSTR\0"
+    "RETIRED_MISP_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_BRANCH_INSTR\0"
+    "RETIRED_TAKEN_MISP_BRANCH_INSTR\0"
+    "RETIRED_FAR_CONTROL_TRANSFERS\0"
+    "RETIRED_BRANCH_RESYNCS\0"
+    "RETIRED_NEAR_RETURNS\0"
+    "RETIRED_NEAR_RETURNS_MISP\0"
+    "RETIRED_INDIRECT_BRANCHES_MISP\0"
+    "RETIRED_MMX_FP_INSTR_X87\0"
+    "RETIRED_MMX_FP_INSTR_MMX\0"
+    "RETIRED_MMX_FP_INSTR_SSE\0"
+    "RETIRED_MMX_FP_INSTR_ALL\0"
+    "RETIRED_COND_BRANCH_INSTR\0"
+    "RETIRED_COND_BRANCH_INSTR_MISP\0"
+    "DIV_BUSY_CYCLES\0"
+    "DIV_OP_COUNT\0"
+    "TAGGED_IBS_OPS_COUNT\0"
+    "TAGGED_IBS_OPS_COUNT_RETIRED\0"
+    "TAGGED_IBS_OPS_IBS_COUNT_ROLLOVER\0"
+    "RETIRED_FUSED_BRANCH_INSTR\0"
+    "REQUESTS_TO_L2_GRP1_OTHER\0"
+    "REQUESTS_TO_L2_GRP1_L2_HW_PREF\0"
+    "REQUESTS_TO_L2_GRP1_PREF_L2\0"
+    "REQUESTS_TO_L2_GRP1_CHANGE_TO_X\0"
+    "REQUESTS_TO_L2_GRP1_CACHEABLE_IC_READ\0"
+    "REQUESTS_TO_L2_GRP1_LS_RD_BLOCK_C_S\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_X\0"
+    "REQUESTS_TO_L2_GRP1_RD_BLOCK_L\0"
+    "REQUESTS_TO_L2_GRP1_ALL\0"
+    "REQUESTS_TO_L2_GRP1_ALL_NO_PF\0"
+    "REQUESTS_TO_L2_GRP1_DATA_CACHE_MISS\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_RESP\0"
+    "REQUESTS_TO_L2_GRP2_BUS_LOCK_ORIG\0"
+    "REQUESTS_TO_L2_GRP2_SMC_INVAL\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED_NC\0"
+    "REQUESTS_TO_L2_GRP2_LS_READ_SIZED\0"
+    "REQUESTS_TO_L2_GRP2_GRP1\0"
+    "REQUESTS_TO_L2_GRP2_IC_READ\0"
+    "L2_LATENCY_CYCLES_WAIT_ON_FILLS\0"
+    "LS_TO_L2_WBC_REQUESTS_CL_ZERO\0"
+    "LS_TO_L2_WBC_REQUESTS_LOCAL_IC_CLEAR\0"
+    "LS_TO_L2_WBC_REQUESTS_ZERO_BYTE_STORE\0"
+    "LS_TO_L2_WBC_REQUESTS_I_LINE_FLUSH\0"
+    "LS_TO_L2_WBC_REQUESTS_CACHELINE_FLUSH\0"
+    "LS_TO_L2_WBC_REQUESTS_WCB_CLOSE\0"
+    "LS_TO_L2_WBC_REQUESTS_WCB_WRITE\0"
+    "LS_TO_L2_WBC_REQUESTS_ALL\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_MISS\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_IC_FILL_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_C\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_S\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_L_HIT_X\0"
+    "CORE_TO_L2_CACHE_REQUESTS_LD_READ_BLK_CS\0"
+    "CYCLES_FILL_PEND_FROM_L2_BUSY\0"
+    "L2_INST_CACHE_MISS\0"
+    "L2_DATA_CACHE_MISS\0"
+    "L1_INST_MISS_L2_HIT\0"
+    "L1_DATA_MISS_L2_HIT\0"
+    "L3_ACCESS\0"
+    "CPMC\0"
+    "L3_MISS\0"
+    "RAPL_CORE_ENERGY\0"
+    "PWR0\0"
+    "RAPL_PKG_ENERGY\0"
+    "PWR1\0"
+    "DRAM_CHANNEL_0\0"
+    "DFC\0"
+    "DRAM_CHANNEL_1\0"
+    "DATA_OUT_TO_REMOTE_0\0"
+    "DATA_OUT_TO_REMOTE_1\0"
+    "DATA_OUT_TO_REMOTE_2\0"
+    "DATA_OUT_TO_REMOTE_3\0"
+    "DATA_OUT_TO_REMOTE_4\0"
+    "DATA_OUT_TO_REMOTE_5\0";
+
+static const PerfmonEventOption zen_arch_event_options[] = {
+ {EVENT_OPTION_NONE, 0x0}
+};
+
+static const PerfmonEventEntry zen_arch_event_entries[NUM_ARCH_EVENTS_ZEN] = {
+ {0, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {23, 17, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {29, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {49, 43, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {55, 61, 0, 0, 0xFFF,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {65, 61, 0, 0, 0x00,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {97, 61, 0, 0, 0x00,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {129, 61, 0, 0, 0x00,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {161, 61, 0, 0, 0x00,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {193, 61, 0, 0, 0x00,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {227, 61, 0, 0, 0x00,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {270, 61, 0, 0, 0x00,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {313, 61, 0, 0, 0x00,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {356, 61, 0, 0, 0x00,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {399, 61, 0, 0, 0x00,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {444, 61, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {463, 61, 0, 0, 0x02,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {489, 61, 0, 0, 0x02,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {512, 61, 0, 0, 0x02,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {534, 61, 0, 0, 0x02,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {556, 61, 0, 0, 0x03,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {593, 61, 0, 0, 0x03,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {627, 61, 0, 0, 0x03,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {660, 61, 0, 0, 0x03,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {702, 61, 0, 0, 0x03,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {735, 61, 0, 0, 0x03,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {768, 61, 0, 0, 0x03,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {805, 61, 0, 0, 0x03,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {839, 61, 0, 0, 0x03,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {872, 61, 0, 0, 0x03,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {914, 61, 0, 0, 0x03,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {947, 61, 0, 0, 0x03,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {980, 61, 0, 0, 0x03,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {1006, 61, 0, 0, 0x04,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1033, 61, 0, 0, 0x04,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1065, 61, 0, 0, 0x04,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1099, 61, 0, 0, 0x04,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1128, 61, 0, 0, 0x05,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1163, 61, 0, 0, 0x05,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1199, 61, 0, 0, 0x05,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1234, 61, 0, 0, 0x05,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1270, 61, 0, 0, 0x24,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1298, 61, 0, 0, 0x24,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1323, 61, 0, 0, 0x24,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1350, 61, 0, 0, 0x25,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1365, 61, 0, 0, 0x25,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1385, 61, 0, 0, 0x25,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1401, 61, 0, 0, 0x25,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1428, 61, 0, 0, 0x26,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1444, 61, 0, 0, 0x27,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1458, 61, 0, 0, 0x29,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1476, 61, 0, 0, 0x29,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1495, 61, 0, 0, 0x29,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1522, 61, 0, 0, 0x29,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {1538, 61, 0, 0, 0x2B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1552, 61, 0, 0, 0x35,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1565, 61, 0, 0, 0x37,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1583, 61, 0, 0, 0x40,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {1603, 61, 0, 0, 0x41,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1623, 61, 0, 0, 0x41,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1644, 61, 0, 0, 0x41,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {1668, 61, 0, 0, 0x41,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1689, 61, 0, 0, 0x41,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1714, 61, 0, 0, 0x43,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1742, 61, 0, 0, 0x43,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1773, 61, 0, 0, 0x43,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {1803, 61, 0, 0, 0x43,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {1832, 61, 0, 0, 0x43,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {1864, 61, 0, 0, 0x43,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {1895, 61, 0, 0, 0x43,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {1925, 61, 0, 0, 0x43,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {1948, 61, 0, 0, 0x45,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {1971, 61, 0, 0, 0x45,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {1995, 61, 0, 0, 0x45,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2018, 61, 0, 0, 0x45,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2041, 61, 0, 0, 0x45,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {2065, 61, 0, 0, 0x45,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2089, 61, 0, 0, 0x45,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {2114, 61, 0, 0, 0x45,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2138, 61, 0, 0, 0x45,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {2162, 61, 0, 0, 0x45,0xF0,0,0,EVENT_OPTION_NONE_MASK}
+, {2187, 61, 0, 0, 0x46,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2212, 61, 0, 0, 0x46,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2237, 61, 0, 0, 0x46,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2262, 61, 0, 0, 0x46,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2287, 61, 0, 0, 0x47,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {2304, 61, 0, 0, 0x4B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2331, 61, 0, 0, 0x4B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2359, 61, 0, 0, 0x4B,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {2385, 61, 0, 0, 0x52,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2420, 61, 0, 0, 0x52,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2450, 61, 0, 0, 0x59,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2483, 61, 0, 0, 0x59,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2519, 61, 0, 0, 0x59,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2554, 61, 0, 0, 0x59,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {2588, 61, 0, 0, 0x59,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2625, 61, 0, 0, 0x59,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2661, 61, 0, 0, 0x59,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2696, 61, 0, 0, 0x59,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {2724, 61, 0, 0, 0x5A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {2757, 61, 0, 0, 0x5A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {2793, 61, 0, 0, 0x5A,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {2828, 61, 0, 0, 0x5A,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {2862, 61, 0, 0, 0x5A,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {2899, 61, 0, 0, 0x5A,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {2935, 61, 0, 0, 0x5A,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {2970, 61, 0, 0, 0x5A,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {2998, 61, 0, 0, 0x5B,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3036, 61, 0, 0, 0x5B,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3077, 61, 0, 0, 0x5B,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3117, 61, 0, 0, 0x5B,0x0B,0,0,EVENT_OPTION_NONE_MASK}
+, {3156, 61, 0, 0, 0x5B,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {3198, 61, 0, 0, 0x5B,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {3239, 61, 0, 0, 0x5B,0x50,0,0,EVENT_OPTION_NONE_MASK}
+, {3279, 61, 0, 0, 0x5B,0x5B,0,0,EVENT_OPTION_NONE_MASK}
+, {3312, 61, 0, 0, 0x76,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3332, 61, 0, 0, 0x80,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3347, 61, 0, 0, 0x81,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3361, 61, 0, 0, 0x82,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3379, 61, 0, 0, 0x83,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3401, 61, 0, 0, 0x84,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3421, 61, 0, 0, 0x85,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3442, 61, 0, 0, 0x86,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3482, 61, 0, 0, 0x87,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3513, 61, 0, 0, 0x87,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3539, 61, 0, 0, 0x87,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3560, 61, 0, 0, 0x8A,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3578, 61, 0, 0, 0x8B,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3596, 61, 0, 0, 0x8C,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3626, 61, 0, 0, 0x8C,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3660, 61, 0, 0, 0x99,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {3673, 61, 0, 0, 0x28A,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3694, 61, 0, 0, 0x28A,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3715, 61, 0, 0, 0xAF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {3762, 61, 0, 0, 0xAF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {3809, 61, 0, 0, 0xAF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {3856, 61, 0, 0, 0xAF,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {3905, 61, 0, 0, 0xAF,0x0F,0,0,EVENT_OPTION_NONE_MASK}
+, {3955, 61, 0, 0, 0xAF,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4000, 61, 0, 0, 0xAF,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4046, 61, 0, 0, 0xAF,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4094, 61, 0, 0, 0xC0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4115, 61, 0, 0, 0xC1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4128, 61, 0, 0, 0xC2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4149, 61, 0, 0, 0xC3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4175, 61, 0, 0, 0xC4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4202, 61, 0, 0, 0xC5,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4234, 61, 0, 0, 0xC6,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4264, 61, 0, 0, 0xC7,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4287, 61, 0, 0, 0xC8,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4308, 61, 0, 0, 0xC9,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4334, 61, 0, 0, 0xCA,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4365, 61, 0, 0, 0xCB,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4390, 61, 0, 0, 0xCB,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4415, 61, 0, 0, 0xCB,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4440, 61, 0, 0, 0xCB,0x07,0,0,EVENT_OPTION_NONE_MASK}
+, {4465, 61, 0, 0, 0xD1,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4491, 61, 0, 0, 0xD2,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4522, 61, 0, 0, 0xD3,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4538, 61, 0, 0, 0xD4,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4551, 61, 0, 0, 0x1CF,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4572, 61, 0, 0, 0x1CF,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4601, 61, 0, 0, 0x1CF,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4635, 61, 0, 0, 0x1D0,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {4662, 61, 0, 0, 0x60,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {4688, 61, 0, 0, 0x60,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {4719, 61, 0, 0, 0x60,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {4747, 61, 0, 0, 0x60,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {4779, 61, 0, 0, 0x60,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {4817, 61, 0, 0, 0x60,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {4853, 61, 0, 0, 0x60,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {4884, 61, 0, 0, 0x60,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {4915, 61, 0, 0, 0x60,0xFF,0,0,EVENT_OPTION_NONE_MASK}
+, {4939, 61, 0, 0, 0x60,0xF9,0,0,EVENT_OPTION_NONE_MASK}
+, {4969, 61, 0, 0, 0x60,0xC8,0,0,EVENT_OPTION_NONE_MASK}
+, {5005, 61, 0, 0, 0x61,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5039, 61, 0, 0, 0x61,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5073, 61, 0, 0, 0x61,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5103, 61, 0, 0, 0x61,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5140, 61, 0, 0, 0x61,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5174, 61, 0, 0, 0x61,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5211, 61, 0, 0, 0x61,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5245, 61, 0, 0, 0x61,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5270, 61, 0, 0, 0x61,0x18,0,0,EVENT_OPTION_NONE_MASK}
+, {5298, 61, 0, 0, 0x62,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5330, 61, 0, 0, 0x63,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5360, 61, 0, 0, 0x63,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5397, 61, 0, 0, 0x63,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5435, 61, 0, 0, 0x63,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5470, 61, 0, 0, 0x63,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5508, 61, 0, 0, 0x63,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5540, 61, 0, 0, 0x63,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5572, 61, 0, 0, 0x63,0x7F,0,0,EVENT_OPTION_NONE_MASK}
+, {5598, 61, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5637, 61, 0, 0, 0x64,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {5677, 61, 0, 0, 0x64,0x04,0,0,EVENT_OPTION_NONE_MASK}
+, {5717, 61, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5757, 61, 0, 0, 0x64,0x10,0,0,EVENT_OPTION_NONE_MASK}
+, {5797, 61, 0, 0, 0x64,0x20,0,0,EVENT_OPTION_NONE_MASK}
+, {5843, 61, 0, 0, 0x64,0x40,0,0,EVENT_OPTION_NONE_MASK}
+, {5889, 61, 0, 0, 0x64,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {5930, 61, 0, 0, 0x6D,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5960, 61, 0, 0, 0x64,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {5979, 61, 0, 0, 0x64,0x08,0,0,EVENT_OPTION_NONE_MASK}
+, {5998, 61, 0, 0, 0x64,0x06,0,0,EVENT_OPTION_NONE_MASK}
+, {6018, 61, 0, 0, 0x64,0x70,0,0,EVENT_OPTION_NONE_MASK}
+, {6038, 6048, 0, 0, 0x01,0x80,0,0,EVENT_OPTION_NONE_MASK}
+, {6053, 6048, 0, 0, 0x06,0x01,0,0,EVENT_OPTION_NONE_MASK}
+, {6061, 6078, 0, 0, 0x01,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6083, 6099, 0, 0, 0x02,0x00,0,0,EVENT_OPTION_NONE_MASK}
+, {6104, 6119, 0, 0, 0x07,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {6123, 6119, 0, 0, 0x47,0x38,0,0,EVENT_OPTION_NONE_MASK}
+, {6138, 6119, 0, 0, 0x187,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6159, 6119, 0, 0, 0x1C7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6180, 6119, 0, 0, 0x207,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6201, 6119, 0, 0, 0x287,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6222, 6119, 0, 0, 0x247,0x02,0,0,EVENT_OPTION_NONE_MASK}
+, {6243, 6119, 0, 0, 0x2C7,0x02,0,0,EVENT_OPTION_NONE_MASK}
+};
+
+static const PerfmonEventTable zen_arch_events = {
+    NUM_ARCH_EVENTS_ZEN,
+    zen_arch_event_strings,
+    zen_arch_event_options,
+    zen_arch_event_entries
+};
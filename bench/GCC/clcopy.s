@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl clcopy
+.type clcopy, @function
+clcopy :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rsi + rax * 8 ]
+movaps xmm1, [rsi + rax * 8 + 64 ]
+movaps xmm2, [rsi + rax * 8 + 128 ]
+movaps xmm3, [rsi + rax * 8 + 192 ]
+movaps [rdx + rax * 8 ], xmm0
+movaps [rdx + rax * 8 + 64 ], xmm1
+movaps [rdx + rax * 8 + 128 ], xmm2
+movaps [rdx + rax * 8 + 192 ], xmm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size clcopy, .-clcopy
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl copy_dp_v128_u4
+.type copy_dp_v128_u4, @function
+copy_dp_v128_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd xmm0, [rsi + rax*8 + 0]
+vmovapd xmm1, [rsi + rax*8 + 16]
+vmovapd xmm2, [rsi + rax*8 + 32]
+vmovapd xmm3, [rsi + rax*8 + 48]
+vmovapd [rdx + rax*8 + 0], xmm0
+vmovapd [rdx + rax*8 + 16], xmm1
+vmovapd [rdx + rax*8 + 32], xmm2
+vmovapd [rdx + rax*8 + 48], xmm3
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size copy_dp_v128_u4, .-copy_dp_v128_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl copy_dp_v512_nt_u4
+.type copy_dp_v512_nt_u4, @function
+copy_dp_v512_nt_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm0, [rsi + rax*8 + 0]
+vmovapd zmm1, [rsi + rax*8 + 64]
+vmovapd zmm2, [rsi + rax*8 + 128]
+vmovapd zmm3, [rsi + rax*8 + 192]
+vmovntpd [rdx + rax*8 + 0], zmm0
+vmovntpd [rdx + rax*8 + 64], zmm1
+vmovntpd [rdx + rax*8 + 128], zmm2
+vmovntpd [rdx + rax*8 + 192], zmm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size copy_dp_v512_nt_u4, .-copy_dp_v512_nt_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl copy_mem
+.type copy_mem, @function
+copy_mem :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movq mm0, [rsi + rax * 8]
+movq mm1, [rsi + rax * 8 + 8]
+movq mm2, [rsi + rax * 8 + 16]
+movq mm3, [rsi + rax * 8 + 24]
+movntq [rdx + rax * 8] , mm0
+movntq [rdx + rax * 8 + 8] , mm1
+movntq [rdx + rax * 8 + 16], mm2
+movntq [rdx + rax * 8 + 24], mm3
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size copy_mem, .-copy_mem
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
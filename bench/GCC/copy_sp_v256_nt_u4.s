@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl copy_sp_v256_nt_u4
+.type copy_sp_v256_nt_u4, @function
+copy_sp_v256_nt_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm0, [rsi + rax*4 + 0]
+vmovaps ymm1, [rsi + rax*4 + 32]
+vmovaps ymm2, [rsi + rax*4 + 64]
+vmovaps ymm3, [rsi + rax*4 + 96]
+vmovntps [rdx + rax*4 + 0], ymm0
+vmovntps [rdx + rax*4 + 32], ymm1
+vmovntps [rdx + rax*4 + 64], ymm2
+vmovntps [rdx + rax*4 + 96], ymm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size copy_sp_v256_nt_u4, .-copy_sp_v256_nt_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
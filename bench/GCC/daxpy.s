@@ -0,0 +1,61 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy
+.type daxpy, @function
+daxpy :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movsd xmm6, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsd xmm0, [rsi + rax*8]
+movsd xmm1, [rsi + rax*8 + 8]
+mulsd xmm0, xmm6
+mulsd xmm1, xmm6
+movsd xmm2, [rsi + rax*8 + 16]
+movsd xmm3, [rsi + rax*8 + 24]
+mulsd xmm2, xmm6
+mulsd xmm3, xmm6
+addsd xmm0, [rdx + rax*8]
+addsd xmm1, [rdx + rax*8 + 8]
+addsd xmm2, [rdx + rax*8 + 16]
+addsd xmm3, [rdx + rax*8 + 24]
+movsd [rdx + rax*8], xmm0
+movsd [rdx + rax*8 + 8], xmm1
+movsd [rdx + rax*8 + 16], xmm2
+movsd [rdx + rax*8 + 24], xmm3
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy, .-daxpy
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,63 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_avx
+.type daxpy_avx, @function
+daxpy_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm7, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmulpd ymm1, ymm7, [rsi + rax*8]
+vaddpd ymm1, ymm1, [rdx + rax*8]
+vmulpd ymm2, ymm7, [rsi + rax*8+32]
+vaddpd ymm2, ymm2, [rdx + rax*8+32]
+vmovaps [rdx + rax*8], ymm1
+vmovaps [rdx + rax*8+32], ymm2
+vmulpd ymm3, ymm7, [rsi + rax*8+64]
+vaddpd ymm3, ymm3, [rdx + rax*8+64]
+vmulpd ymm4, ymm7, [rsi + rax*8+96]
+vaddpd ymm4, ymm4, [rdx + rax*8+96]
+vmovaps [rdx + rax*8+64], ymm3
+vmovaps [rdx + rax*8+96], ymm4
+vmulpd ymm5, ymm7, [rsi + rax*8+128]
+vaddpd ymm5, ymm5, [rdx + rax*8+128]
+vmulpd ymm6, ymm7, [rsi + rax*8+160]
+vaddpd ymm6, ymm6, [rdx + rax*8+160]
+vmovaps [rdx + rax*8+128], ymm5
+vmovaps [rdx + rax*8+160], ymm6
+add rax, 24
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_avx, .-daxpy_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
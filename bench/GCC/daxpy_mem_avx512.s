@@ -0,0 +1,57 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_mem_avx512
+.type daxpy_mem_avx512, @function
+daxpy_mem_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps zmm7, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmulpd zmm1, zmm7, [rsi + rax*8]
+vaddpd zmm1, zmm1, [rdx + rax*8]
+vmulpd zmm2, zmm7, [rsi + rax*8+64]
+vaddpd zmm2, zmm2, [rdx + rax*8+64]
+vmovntps [rdx + rax*8], zmm1
+vmovntps [rdx + rax*8+64], zmm2
+vmulpd zmm3, zmm7, [rsi + rax*8+128]
+vaddpd zmm3, zmm3, [rdx + rax*8+128]
+vmulpd zmm4, zmm7, [rsi + rax*8+192]
+vaddpd zmm4, zmm4, [rdx + rax*8+192]
+vmovntps [rdx + rax*8+128], zmm3
+vmovntps [rdx + rax*8+192], zmm4
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_mem_avx512, .-daxpy_mem_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,57 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_mem_avx_fma
+.type daxpy_mem_avx_fma, @function
+daxpy_mem_avx_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm7, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rsi + rax*8]
+vmovaps ymm2, [rsi + rax*8+32]
+vmovaps ymm3, [rsi + rax*8+64]
+vmovaps ymm4, [rsi + rax*8+96]
+vfmadd213pd ymm1, ymm7, [rdx + rax*8]
+vfmadd213pd ymm2, ymm7, [rdx + rax*8+32]
+vfmadd213pd ymm3, ymm7, [rdx + rax*8+64]
+vfmadd213pd ymm4, ymm7, [rdx + rax*8+96]
+vmovntps [rdx + rax*8], ymm1
+vmovntps [rdx + rax*8+32], ymm2
+vmovntps [rdx + rax*8+64], ymm3
+vmovntps [rdx + rax*8+96], ymm4
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_mem_avx_fma, .-daxpy_mem_avx_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
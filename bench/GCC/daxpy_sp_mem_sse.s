@@ -0,0 +1,53 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_sp_mem_sse
+.type daxpy_sp_mem_sse, @function
+daxpy_sp_mem_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movaps xmm6, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rsi + rax*4]
+mulps xmm0, xmm6
+addps xmm0, [rdx + rax*4]
+movntps [rdx + rax*4], xmm0
+movaps xmm1, [rsi + rax*4+16]
+mulps xmm1, xmm6
+addps xmm1, [rdx + rax*4+16]
+movntps [rdx + rax*4+16], xmm1
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_sp_mem_sse, .-daxpy_sp_mem_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
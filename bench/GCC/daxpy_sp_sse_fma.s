@@ -0,0 +1,57 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_sp_sse_fma
+.type daxpy_sp_sse_fma, @function
+daxpy_sp_sse_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movaps xmm6, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rsi + rax*4]
+movaps xmm1, [rsi + rax*4+32]
+movaps xmm2, [rsi + rax*4+64]
+movaps xmm3, [rsi + rax*4+96]
+vfmadd213ps xmm0, xmm6, [rdx + rax*4]
+vfmadd213ps xmm1, xmm6, [rdx + rax*4+32]
+vfmadd213ps xmm2, xmm6, [rdx + rax*4+64]
+vfmadd213ps xmm3, xmm6, [rdx + rax*4+96]
+movaps [rdx + rax*4], xmm0
+movaps [rdx + rax*4+32], xmm1
+movaps [rdx + rax*4+64], xmm2
+movaps [rdx + rax*4+96], xmm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_sp_sse_fma, .-daxpy_sp_sse_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
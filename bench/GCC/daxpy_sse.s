@@ -0,0 +1,61 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl daxpy_sse
+.type daxpy_sse, @function
+daxpy_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movaps xmm6, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rsi + rax*8]
+movaps xmm1, [rsi + rax*8+16]
+movaps xmm2, [rsi + rax*8+32]
+movaps xmm3, [rsi + rax*8+48]
+mulpd xmm0, xmm6
+addpd xmm0, [rdx + rax*8]
+mulpd xmm1, xmm6
+addpd xmm1, [rdx + rax*8+16]
+mulpd xmm2, xmm6
+addpd xmm2, [rdx + rax*8+32]
+mulpd xmm3, xmm6
+addpd xmm3, [rdx + rax*8+48]
+movaps [rdx + rax*8], xmm0
+movaps [rdx + rax*8+16], xmm1
+movaps [rdx + rax*8+32], xmm2
+movaps [rdx + rax*8+48], xmm3
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size daxpy_sse, .-daxpy_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
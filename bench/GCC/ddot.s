@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl ddot
+.type ddot, @function
+ddot :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorpd xmm0, xmm0
+xorpd xmm5, xmm5
+xorpd xmm6, xmm6
+xorpd xmm7, xmm7
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsd xmm1, [rsi + rax * 8]
+mulsd xmm1, [rdx + rax * 8]
+addsd xmm0, xmm1
+movsd xmm2, [rsi + rax * 8 + 8]
+mulsd xmm2, [rdx + rax * 8 + 8]
+addsd xmm5, xmm2
+movsd xmm3, [rsi + rax * 8 + 16]
+mulsd xmm3, [rdx + rax * 8 + 16]
+addsd xmm6, xmm3
+movsd xmm4, [rsi + rax * 8 + 24]
+mulsd xmm4, [rdx + rax * 8 + 24]
+addsd xmm7, xmm4
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size ddot, .-ddot
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl ddot_avx
+.type ddot_avx, @function
+ddot_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vxorpd ymm0, ymm0, ymm0
+vxorpd ymm5, ymm5, ymm5
+vxorpd ymm6, ymm6, ymm6
+vxorpd ymm7, ymm7, ymm7
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rsi + rax * 8]
+vmulpd ymm1, ymm1, [rdx + rax * 8]
+vaddpd ymm0, ymm0, ymm1
+vmovaps ymm2, [rsi + rax * 8 + 32]
+vmulpd ymm2, ymm2, [rdx + rax * 8 + 32]
+vaddpd ymm5, ymm5, ymm2
+vmovaps ymm3, [rsi + rax * 8 + 64]
+vmulpd ymm3, ymm3, [rdx + rax * 8 + 64]
+vaddpd ymm6, ymm6, ymm3
+vmovaps ymm4, [rsi + rax * 8 + 96]
+vmulpd ymm4, ymm4, [rdx + rax * 8 + 96]
+vaddpd ymm7, ymm7, ymm4
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size ddot_avx, .-ddot_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,56 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl ddot_avx512
+.type ddot_avx512, @function
+ddot_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm1, [rsi + rax * 8]
+vmulpd zmm1, zmm1, [rdx + rax * 8]
+vaddpd zmm0, zmm0, zmm1
+vmovapd zmm2, [rsi + rax * 8 + 64]
+vmulpd zmm2, zmm2, [rdx + rax * 8 + 64]
+vaddpd zmm5, zmm5, zmm2
+vmovapd zmm3, [rsi + rax * 8 + 128]
+vmulpd zmm3, zmm3, [rdx + rax * 8 + 128]
+vaddpd zmm6, zmm6, zmm3
+vmovapd zmm4, [rsi + rax * 8 + 192]
+vmulpd zmm4, zmm4, [rdx + rax * 8 + 192]
+vaddpd zmm7, zmm7, zmm4
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size ddot_avx512, .-ddot_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
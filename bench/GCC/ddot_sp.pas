@@ -0,0 +1,51 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC ddot_sp
+{
+xorps FPR1, FPR1
+xorps FPR6, FPR6
+xorps FPR7, FPR7
+xorps FPR8, FPR8
+
+
+
+LOOP ddot_sp_loop 4 GPR6 {
+movss FPR2, [STR0 + GPR1 * 4]
+mulss FPR2, [STR1 + GPR1 * 4]
+addss FPR1, FPR2
+movss FPR3, [STR0 + GPR1 * 4 + 4]
+mulss FPR3, [STR1 + GPR1 * 4 + 4]
+addss FPR6, FPR3
+movss FPR4, [STR0 + GPR1 * 4 + 8]
+mulss FPR4, [STR1 + GPR1 * 4 + 8]
+addss FPR7, FPR4
+movss FPR5, [STR0 + GPR1 * 4 + 12]
+mulss FPR5, [STR1 + GPR1 * 4 + 12]
+addss FPR8, FPR5
+
+}
+
+}
+
+STOP LOCAL
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl ddot_sp
+.type ddot_sp, @function
+ddot_sp :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorps xmm0, xmm0
+xorps xmm5, xmm5
+xorps xmm6, xmm6
+xorps xmm7, xmm7
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movss xmm1, [rsi + rax * 4]
+mulss xmm1, [rdx + rax * 4]
+addss xmm0, xmm1
+movss xmm2, [rsi + rax * 4 + 4]
+mulss xmm2, [rdx + rax * 4 + 4]
+addss xmm5, xmm2
+movss xmm3, [rsi + rax * 4 + 8]
+mulss xmm3, [rdx + rax * 4 + 8]
+addss xmm6, xmm3
+movss xmm4, [rsi + rax * 4 + 12]
+mulss xmm4, [rdx + rax * 4 + 12]
+addss xmm7, xmm4
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size ddot_sp, .-ddot_sp
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
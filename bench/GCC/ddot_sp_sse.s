@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl ddot_sp_sse
+.type ddot_sp_sse, @function
+ddot_sp_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorps xmm0, xmm0
+xorps xmm3, xmm3
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm1, [rsi + rax * 4]
+mulps xmm1, [rdx + rax * 4]
+addps xmm0, xmm1
+movaps xmm2, [rsi + rax * 4 + 16]
+mulps xmm2, [rdx + rax * 4 + 16]
+addps xmm3, xmm2
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size ddot_sp_sse, .-ddot_sp_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,56 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl divide
+.type divide, @function
+divide :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsd xmm0, [rsi + rax * 8]
+divsd xmm0, xmm0
+movsd [rsi + rax * 8] , xmm0
+movsd xmm1, [rsi + rax * 8 + 8]
+movsd xmm2, [rsi + rax * 8 + 16]
+movsd xmm3, [rsi + rax * 8 + 24]
+divsd xmm1, xmm1
+divsd xmm2, xmm2
+divsd xmm3, xmm3
+movsd [rsi + rax * 8 + 8], xmm1
+movsd [rsi + rax * 8 + 16], xmm2
+movsd [rsi + rax * 8 + 24], xmm3
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size divide, .-divide
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
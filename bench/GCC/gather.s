@@ -0,0 +1,56 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl gather
+.type gather, @function
+gather :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorpd xmm0, xmm0
+movapd xmm1, xmm0
+movapd xmm2, xmm0
+movapd xmm3, xmm0
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsxd rbx, DWORD PTR [rdx + rax * 4]
+movsxd rcx, DWORD PTR [rdx + rax * 4 + 4]
+movsxd r10, DWORD PTR [rdx + rax * 4 + 8]
+movsxd r11, DWORD PTR [rdx + rax * 4 + 12]
+addsd xmm0, [rsi + rbx * 8]
+addsd xmm1, [rsi + rcx * 8]
+addsd xmm2, [rsi + r10 * 8]
+addsd xmm3, [rsi + r11 * 8]
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size gather, .-gather
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,56 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC gather_avx
+{
+vxorpd ymm1, ymm1, ymm1
+vmovapd ymm2, ymm1
+vmovapd ymm3, ymm1
+vmovapd ymm4, ymm1
+vpcmpeqd ymm15, ymm15, ymm15
+
+
+
+LOOP gather_avx_loop 16 GPR6 {
+vmovdqu    xmm5, [STR1 + GPR1 * 4]
+vmovdqu    xmm6, [STR1 + GPR1 * 4 + 16]
+vmovdqu    xmm7, [STR1 + GPR1 * 4 + 32]
+vmovdqu    xmm8, [STR1 + GPR1 * 4 + 48]
+vmovapd    ymm9, ymm15
+vmovapd    ymm10, ymm15
+vmovapd    ymm11, ymm15
+vmovapd    ymm12, ymm15
+vgatherdpd ymm0, [STR0 + xmm5 * 8], ymm9
+vaddpd     ymm1, ymm1, ymm0
+vgatherdpd ymm13, [STR0 + xmm6 * 8], ymm10
+vaddpd     ymm2, ymm2, ymm13
+vgatherdpd ymm14, [STR0 + xmm7 * 8], ymm11
+vaddpd     ymm3, ymm3, ymm14
+vgatherdpd ymm5, [STR0 + xmm8 * 8], ymm12
+vaddpd     ymm4, ymm4, ymm5
+
+}
+
+}
+
+STOP LOCAL
@@ -0,0 +1,65 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl gather_avx
+.type gather_avx, @function
+gather_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vxorpd ymm1, ymm1, ymm1
+vmovapd ymm2, ymm1
+vmovapd ymm3, ymm1
+vmovapd ymm4, ymm1
+vpcmpeqd ymm15, ymm15, ymm15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovdqu xmm5, [rdx + rax * 4]
+vmovdqu xmm6, [rdx + rax * 4 + 16]
+vmovdqu xmm7, [rdx + rax * 4 + 32]
+vmovdqu xmm8, [rdx + rax * 4 + 48]
+vmovapd ymm9, ymm15
+vmovapd ymm10, ymm15
+vmovapd ymm11, ymm15
+vmovapd ymm12, ymm15
+vgatherdpd ymm0, [rsi + xmm5 * 8], ymm9
+vaddpd ymm1, ymm1, ymm0
+vgatherdpd ymm13, [rsi + xmm6 * 8], ymm10
+vaddpd ymm2, ymm2, ymm13
+vgatherdpd ymm14, [rsi + xmm7 * 8], ymm11
+vaddpd ymm3, ymm3, ymm14
+vgatherdpd ymm5, [rsi + xmm8 * 8], ymm12
+vaddpd ymm4, ymm4, ymm5
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size gather_avx, .-gather_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,55 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC gather_avx512
+{
+vpxorq zmm1, zmm1, zmm1
+vmovapd zmm2, zmm1
+vmovapd zmm3, zmm1
+vmovapd zmm4, zmm1
+
+
+
+LOOP gather_avx512_loop 32 GPR6 {
+vmovdqu    ymm5, [STR1 + GPR1 * 4]
+vmovdqu    ymm6, [STR1 + GPR1 * 4 + 32]
+vmovdqu    ymm7, [STR1 + GPR1 * 4 + 64]
+vmovdqu    ymm8, [STR1 + GPR1 * 4 + 96]
+kxnorb     k1, k1, k1
+kxnorb     k2, k2, k2
+kxnorb     k3, k3, k3
+kxnorb     k4, k4, k4
+vgatherdpd zmm9{k1}, [STR0 + ymm5 * 8]
+vgatherdpd zmm10{k2}, [STR0 + ymm6 * 8]
+vgatherdpd zmm11{k3}, [STR0 + ymm7 * 8]
+vgatherdpd zmm12{k4}, [STR0 + ymm8 * 8]
+vaddpd     zmm1, zmm1, zmm9
+vaddpd     zmm2, zmm2, zmm10
+vaddpd     zmm3, zmm3, zmm11
+vaddpd     zmm4, zmm4, zmm12
+
+}
+
+}
+
+STOP LOCAL
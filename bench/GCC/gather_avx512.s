@@ -0,0 +1,64 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl gather_avx512
+.type gather_avx512, @function
+gather_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vpxorq zmm1, zmm1, zmm1
+vmovapd zmm2, zmm1
+vmovapd zmm3, zmm1
+vmovapd zmm4, zmm1
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovdqu ymm5, [rdx + rax * 4]
+vmovdqu ymm6, [rdx + rax * 4 + 32]
+vmovdqu ymm7, [rdx + rax * 4 + 64]
+vmovdqu ymm8, [rdx + rax * 4 + 96]
+kxnorb k1, k1, k1
+kxnorb k2, k2, k2
+kxnorb k3, k3, k3
+kxnorb k4, k4, k4
+vgatherdpd zmm9{k1}, [rsi + ymm5 * 8]
+vgatherdpd zmm10{k2}, [rsi + ymm6 * 8]
+vgatherdpd zmm11{k3}, [rsi + ymm7 * 8]
+vgatherdpd zmm12{k4}, [rsi + ymm8 * 8]
+vaddpd zmm1, zmm1, zmm9
+vaddpd zmm2, zmm2, zmm10
+vaddpd zmm3, zmm3, zmm11
+vaddpd zmm4, zmm4, zmm12
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size gather_avx512, .-gather_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,53 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl latency
+.type latency, @function
+latency :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+mov rbx, [rsi]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+mov rbx, [rbx]
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size latency, .-latency
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,54 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl latency_mlp2
+.type latency_mlp2, @function
+latency_mlp2 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+mov rbx, [rsi]
+mov rcx, [rsi + 8]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rbx, [rbx]
+mov rcx, [rcx]
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size latency_mlp2, .-latency_mlp2
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
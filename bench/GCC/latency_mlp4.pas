@@ -0,0 +1,47 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC latency_mlp4
+{
+mov      GPR2, [STR0]
+mov      GPR3, [STR0 + 8]
+mov      GPR4, [STR0 + 16]
+mov      GPR7, [STR0 + 24]
+
+
+
+LOOP latency_mlp4_loop 8 GPR6 {
+mov      GPR2, [GPR2]
+mov      GPR3, [GPR3]
+mov      GPR4, [GPR4]
+mov      GPR7, [GPR7]
+mov      GPR2, [GPR2]
+mov      GPR3, [GPR3]
+mov      GPR4, [GPR4]
+mov      GPR7, [GPR7]
+
+}
+
+}
+
+STOP LOCAL
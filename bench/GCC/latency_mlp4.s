@@ -0,0 +1,56 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl latency_mlp4
+.type latency_mlp4, @function
+latency_mlp4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+mov rbx, [rsi]
+mov rcx, [rsi + 8]
+mov rdx, [rsi + 16]
+mov r8, [rsi + 24]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rdx, [rdx]
+mov r8, [r8]
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rdx, [rdx]
+mov r8, [r8]
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size latency_mlp4, .-latency_mlp4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl latency_mlp8
+.type latency_mlp8, @function
+latency_mlp8 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+mov rbx, [rsi]
+mov rcx, [rsi + 8]
+mov rdx, [rsi + 16]
+mov r8, [rsi + 24]
+mov r9, [rsi + 32]
+mov r10, [rsi + 40]
+mov r11, [rsi + 48]
+mov r12, [rsi + 56]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+mov rbx, [rbx]
+mov rcx, [rcx]
+mov rdx, [rdx]
+mov r8, [r8]
+mov r9, [r9]
+mov r10, [r10]
+mov r11, [r11]
+mov r12, [r12]
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size latency_mlp8, .-latency_mlp8
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl load
+.type load, @function
+load :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsd xmm0, [rsi + rax * 8]
+movsd xmm1, [rsi + rax * 8 + 8]
+movsd xmm2, [rsi + rax * 8 + 16]
+movsd xmm3, [rsi + rax * 8 + 24]
+movsd xmm4, [rsi + rax * 8 + 32]
+movsd xmm5, [rsi + rax * 8 + 40]
+movsd xmm6, [rsi + rax * 8 + 48]
+movsd xmm7, [rsi + rax * 8 + 56]
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size load, .-load
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
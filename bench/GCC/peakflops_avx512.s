@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_avx512
+.type peakflops_avx512, @function
+peakflops_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovapd zmm0, [rip+SCALAR]
+vmovapd zmm1, [rip+SCALAR]
+vmovapd zmm2, [rip+SCALAR]
+vmovapd zmm3, [rip+SCALAR]
+vmovapd zmm4, [rip+SCALAR]
+vmovapd zmm5, [rip+SCALAR]
+vmovapd zmm6, [rip+SCALAR]
+vmovapd zmm7, [rip+SCALAR]
+vmovapd zmm8, [rip+SCALAR]
+vmovapd zmm9, [rip+SCALAR]
+vmovapd zmm10, [rip+SCALAR]
+vmovapd zmm11, [rip+SCALAR]
+vmovapd zmm12, [rip+SCALAR]
+vmovapd zmm13, [rip+SCALAR]
+vmovapd zmm14, [rip+SCALAR]
+vmovapd zmm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm1, [rsi + rax * 8 ]
+vmulpd zmm0, zmm0, zmm1
+vaddpd zmm2, zmm2, zmm1
+vmulpd zmm3, zmm3, zmm1
+vaddpd zmm4, zmm4, zmm1
+vmulpd zmm5, zmm5, zmm1
+vaddpd zmm6, zmm6, zmm1
+vmulpd zmm7, zmm7, zmm1
+vaddpd zmm8, zmm8, zmm1
+vmulpd zmm9, zmm9, zmm1
+vaddpd zmm10, zmm10, zmm1
+vmulpd zmm11, zmm11, zmm1
+vaddpd zmm12, zmm12, zmm1
+vmulpd zmm13, zmm13, zmm1
+vaddpd zmm14, zmm14, zmm1
+vmulpd zmm15, zmm15, zmm1
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_avx512, .-peakflops_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
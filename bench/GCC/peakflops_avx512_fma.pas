@@ -0,0 +1,68 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC peakflops_avx512_fma
+{
+vmovapd zmm0, [rip+SCALAR]
+vmovapd zmm1, [rip+SCALAR]
+vmovapd zmm2, [rip+SCALAR]
+vmovapd zmm3, [rip+SCALAR]
+vmovapd zmm4, [rip+SCALAR]
+vmovapd zmm5, [rip+SCALAR]
+vmovapd zmm6, [rip+SCALAR]
+vmovapd zmm7, [rip+SCALAR]
+vmovapd zmm8, [rip+SCALAR]
+vmovapd zmm9, [rip+SCALAR]
+vmovapd zmm10, [rip+SCALAR]
+vmovapd zmm11, [rip+SCALAR]
+vmovapd zmm12, [rip+SCALAR]
+vmovapd zmm13, [rip+SCALAR]
+vmovapd zmm14, [rip+SCALAR]
+vmovapd zmm15, [rip+SCALAR]
+.align 32
+
+
+
+LOOP peakflops_avx512_fma_loop 8 GPR6 {
+vmovapd    zmm1, [STR0 + GPR1 * 8 ]
+vfmadd213pd     zmm0, zmm0, zmm1
+vfmadd213pd     zmm2, zmm2, zmm1
+vfmadd213pd     zmm3, zmm3, zmm1
+vfmadd213pd     zmm4, zmm4, zmm1
+vfmadd213pd     zmm5, zmm5, zmm1
+vfmadd213pd     zmm6, zmm6, zmm1
+vfmadd213pd     zmm7, zmm7, zmm1
+vfmadd213pd     zmm8, zmm8, zmm1
+vfmadd213pd     zmm9, zmm9, zmm1
+vfmadd213pd     zmm10, zmm10, zmm1
+vfmadd213pd     zmm11, zmm11, zmm1
+vfmadd213pd     zmm12, zmm12, zmm1
+vfmadd213pd     zmm13, zmm13, zmm1
+vfmadd213pd     zmm14, zmm14, zmm1
+vfmadd213pd     zmm15, zmm15, zmm1
+
+}
+
+}
+
+STOP LOCAL
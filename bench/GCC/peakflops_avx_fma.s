@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_avx_fma
+.type peakflops_avx_fma, @function
+peakflops_avx_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovapd ymm0, [rip+SCALAR]
+vmovapd ymm1, [rip+SCALAR]
+vmovapd ymm2, [rip+SCALAR]
+vmovapd ymm3, [rip+SCALAR]
+vmovapd ymm4, [rip+SCALAR]
+vmovapd ymm5, [rip+SCALAR]
+vmovapd ymm6, [rip+SCALAR]
+vmovapd ymm7, [rip+SCALAR]
+vmovapd ymm8, [rip+SCALAR]
+vmovapd ymm9, [rip+SCALAR]
+vmovapd ymm10, [rip+SCALAR]
+vmovapd ymm11, [rip+SCALAR]
+vmovapd ymm12, [rip+SCALAR]
+vmovapd ymm13, [rip+SCALAR]
+vmovapd ymm14, [rip+SCALAR]
+vmovapd ymm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd ymm1, [rsi + rax * 8 ]
+vfmadd213pd ymm0, ymm0, ymm1
+vfmadd213pd ymm2, ymm2, ymm1
+vfmadd213pd ymm3, ymm3, ymm1
+vfmadd213pd ymm4, ymm4, ymm1
+vfmadd213pd ymm5, ymm5, ymm1
+vfmadd213pd ymm6, ymm6, ymm1
+vfmadd213pd ymm7, ymm7, ymm1
+vfmadd213pd ymm8, ymm8, ymm1
+vfmadd213pd ymm9, ymm9, ymm1
+vfmadd213pd ymm10, ymm10, ymm1
+vfmadd213pd ymm11, ymm11, ymm1
+vfmadd213pd ymm12, ymm12, ymm1
+vfmadd213pd ymm13, ymm13, ymm1
+vfmadd213pd ymm14, ymm14, ymm1
+vfmadd213pd ymm15, ymm15, ymm1
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_avx_fma, .-peakflops_avx_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,69 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC peakflops_sp
+{
+movaps FPR1, [rip+SCALAR]
+movaps FPR2, [rip+SCALAR]
+movaps FPR3, [rip+SCALAR]
+movaps FPR4, [rip+SCALAR]
+movaps FPR5, [rip+SCALAR]
+movaps FPR6, [rip+SCALAR]
+movaps FPR7, [rip+SCALAR]
+movaps FPR8, [rip+SCALAR]
+movaps FPR9, [rip+SCALAR]
+movaps FPR10, [rip+SCALAR]
+movaps FPR11, [rip+SCALAR]
+movaps FPR12, [rip+SCALAR]
+movaps FPR13, [rip+SCALAR]
+movaps FPR14, [rip+SCALAR]
+movaps FPR15, [rip+SCALAR]
+movaps FPR16, [rip+SCALAR]
+.align 32
+
+
+
+LOOP peakflops_sp_loop 1 GPR6 {
+movss    FPR2, [STR0 + GPR1 * 4 ]
+addss     FPR1, FPR2
+addss     FPR3, FPR4
+mulss     FPR5, FPR6
+mulss     FPR7, FPR8
+mulss     FPR9, FPR10
+addss     FPR11, FPR12
+addss     FPR13, FPR14
+mulss     FPR15, FPR16
+addss     FPR1, FPR2
+addss     FPR3, FPR4
+mulss     FPR5, FPR6
+mulss     FPR7, FPR8
+mulss     FPR9, FPR10
+addss     FPR11, FPR12
+addss     FPR13, FPR14
+mulss     FPR15, FPR16
+
+}
+
+}
+
+STOP LOCAL
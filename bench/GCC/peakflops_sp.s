@@ -0,0 +1,78 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_sp
+.type peakflops_sp, @function
+peakflops_sp :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movaps xmm0, [rip+SCALAR]
+movaps xmm1, [rip+SCALAR]
+movaps xmm2, [rip+SCALAR]
+movaps xmm3, [rip+SCALAR]
+movaps xmm4, [rip+SCALAR]
+movaps xmm5, [rip+SCALAR]
+movaps xmm6, [rip+SCALAR]
+movaps xmm7, [rip+SCALAR]
+movaps xmm8, [rip+SCALAR]
+movaps xmm9, [rip+SCALAR]
+movaps xmm10, [rip+SCALAR]
+movaps xmm11, [rip+SCALAR]
+movaps xmm12, [rip+SCALAR]
+movaps xmm13, [rip+SCALAR]
+movaps xmm14, [rip+SCALAR]
+movaps xmm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movss xmm1, [rsi + rax * 4 ]
+addss xmm0, xmm1
+addss xmm2, xmm3
+mulss xmm4, xmm5
+mulss xmm6, xmm7
+mulss xmm8, xmm9
+addss xmm10, xmm11
+addss xmm12, xmm13
+mulss xmm14, xmm15
+addss xmm0, xmm1
+addss xmm2, xmm3
+mulss xmm4, xmm5
+mulss xmm6, xmm7
+mulss xmm8, xmm9
+addss xmm10, xmm11
+addss xmm12, xmm13
+mulss xmm14, xmm15
+add rax, 1
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_sp, .-peakflops_sp
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
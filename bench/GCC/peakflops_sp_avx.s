@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_sp_avx
+.type peakflops_sp_avx, @function
+peakflops_sp_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm0, [rip+SCALAR]
+vmovaps ymm1, [rip+SCALAR]
+vmovaps ymm2, [rip+SCALAR]
+vmovaps ymm3, [rip+SCALAR]
+vmovaps ymm4, [rip+SCALAR]
+vmovaps ymm5, [rip+SCALAR]
+vmovaps ymm6, [rip+SCALAR]
+vmovaps ymm7, [rip+SCALAR]
+vmovaps ymm8, [rip+SCALAR]
+vmovaps ymm9, [rip+SCALAR]
+vmovaps ymm10, [rip+SCALAR]
+vmovaps ymm11, [rip+SCALAR]
+vmovaps ymm12, [rip+SCALAR]
+vmovaps ymm13, [rip+SCALAR]
+vmovaps ymm14, [rip+SCALAR]
+vmovaps ymm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rsi + rax * 4 ]
+vmulps ymm0, ymm0, ymm1
+vaddps ymm2, ymm2, ymm1
+vmulps ymm3, ymm3, ymm1
+vaddps ymm4, ymm4, ymm1
+vmulps ymm5, ymm5, ymm1
+vaddps ymm6, ymm6, ymm1
+vmulps ymm7, ymm7, ymm1
+vaddps ymm8, ymm8, ymm1
+vmulps ymm9, ymm9, ymm1
+vaddps ymm10, ymm10, ymm1
+vmulps ymm11, ymm11, ymm1
+vaddps ymm12, ymm12, ymm1
+vmulps ymm13, ymm13, ymm1
+vaddps ymm14, ymm14, ymm1
+vmulps ymm15, ymm15, ymm1
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_sp_avx, .-peakflops_sp_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
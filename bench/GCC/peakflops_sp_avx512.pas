@@ -0,0 +1,68 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC peakflops_sp_avx512
+{
+vmovaps zmm0, [rip+SCALAR]
+vmovaps zmm1, [rip+SCALAR]
+vmovaps zmm2, [rip+SCALAR]
+vmovaps zmm3, [rip+SCALAR]
+vmovaps zmm4, [rip+SCALAR]
+vmovaps zmm5, [rip+SCALAR]
+vmovaps zmm6, [rip+SCALAR]
+vmovaps zmm7, [rip+SCALAR]
+vmovaps zmm8, [rip+SCALAR]
+vmovaps zmm9, [rip+SCALAR]
+vmovaps zmm10, [rip+SCALAR]
+vmovaps zmm11, [rip+SCALAR]
+vmovaps zmm12, [rip+SCALAR]
+vmovaps zmm13, [rip+SCALAR]
+vmovaps zmm14, [rip+SCALAR]
+vmovaps zmm15, [rip+SCALAR]
+.align 32
+
+
+
+LOOP peakflops_sp_avx512_loop 16 GPR6 {
+vmovaps    zmm1, [STR0 + GPR1 * 4 ]
+vmulps     zmm0, zmm0, zmm1
+vaddps     zmm2, zmm2, zmm1
+vmulps     zmm3, zmm3, zmm1
+vaddps     zmm4, zmm4, zmm1
+vmulps     zmm5, zmm5, zmm1
+vaddps     zmm6, zmm6, zmm1
+vmulps     zmm7, zmm7, zmm1
+vaddps     zmm8, zmm8, zmm1
+vmulps     zmm9, zmm9, zmm1
+vaddps     zmm10, zmm10, zmm1
+vmulps     zmm11, zmm11, zmm1
+vaddps     zmm12, zmm12, zmm1
+vmulps     zmm13, zmm13, zmm1
+vaddps     zmm14, zmm14, zmm1
+vmulps     zmm15, zmm15, zmm1
+
+}
+
+}
+
+STOP LOCAL
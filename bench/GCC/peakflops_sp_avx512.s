@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_sp_avx512
+.type peakflops_sp_avx512, @function
+peakflops_sp_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps zmm0, [rip+SCALAR]
+vmovaps zmm1, [rip+SCALAR]
+vmovaps zmm2, [rip+SCALAR]
+vmovaps zmm3, [rip+SCALAR]
+vmovaps zmm4, [rip+SCALAR]
+vmovaps zmm5, [rip+SCALAR]
+vmovaps zmm6, [rip+SCALAR]
+vmovaps zmm7, [rip+SCALAR]
+vmovaps zmm8, [rip+SCALAR]
+vmovaps zmm9, [rip+SCALAR]
+vmovaps zmm10, [rip+SCALAR]
+vmovaps zmm11, [rip+SCALAR]
+vmovaps zmm12, [rip+SCALAR]
+vmovaps zmm13, [rip+SCALAR]
+vmovaps zmm14, [rip+SCALAR]
+vmovaps zmm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm1, [rsi + rax * 4 ]
+vmulps zmm0, zmm0, zmm1
+vaddps zmm2, zmm2, zmm1
+vmulps zmm3, zmm3, zmm1
+vaddps zmm4, zmm4, zmm1
+vmulps zmm5, zmm5, zmm1
+vaddps zmm6, zmm6, zmm1
+vmulps zmm7, zmm7, zmm1
+vaddps zmm8, zmm8, zmm1
+vmulps zmm9, zmm9, zmm1
+vaddps zmm10, zmm10, zmm1
+vmulps zmm11, zmm11, zmm1
+vaddps zmm12, zmm12, zmm1
+vmulps zmm13, zmm13, zmm1
+vaddps zmm14, zmm14, zmm1
+vmulps zmm15, zmm15, zmm1
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_sp_avx512, .-peakflops_sp_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_sp_avx_fma
+.type peakflops_sp_avx_fma, @function
+peakflops_sp_avx_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm0, [rip+SCALAR]
+vmovaps ymm1, [rip+SCALAR]
+vmovaps ymm2, [rip+SCALAR]
+vmovaps ymm3, [rip+SCALAR]
+vmovaps ymm4, [rip+SCALAR]
+vmovaps ymm5, [rip+SCALAR]
+vmovaps ymm6, [rip+SCALAR]
+vmovaps ymm7, [rip+SCALAR]
+vmovaps ymm8, [rip+SCALAR]
+vmovaps ymm9, [rip+SCALAR]
+vmovaps ymm10, [rip+SCALAR]
+vmovaps ymm11, [rip+SCALAR]
+vmovaps ymm12, [rip+SCALAR]
+vmovaps ymm13, [rip+SCALAR]
+vmovaps ymm14, [rip+SCALAR]
+vmovaps ymm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rsi + rax * 4 ]
+vfmadd213ps ymm0, ymm0, ymm1
+vfmadd213ps ymm2, ymm2, ymm1
+vfmadd213ps ymm3, ymm3, ymm1
+vfmadd213ps ymm4, ymm4, ymm1
+vfmadd213ps ymm5, ymm5, ymm1
+vfmadd213ps ymm6, ymm6, ymm1
+vfmadd213ps ymm7, ymm7, ymm1
+vfmadd213ps ymm8, ymm8, ymm1
+vfmadd213ps ymm9, ymm9, ymm1
+vfmadd213ps ymm10, ymm10, ymm1
+vfmadd213ps ymm11, ymm11, ymm1
+vfmadd213ps ymm12, ymm12, ymm1
+vfmadd213ps ymm13, ymm13, ymm1
+vfmadd213ps ymm14, ymm14, ymm1
+vfmadd213ps ymm15, ymm15, ymm1
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_sp_avx_fma, .-peakflops_sp_avx_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,69 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC peakflops_sp_sse
+{
+movaps xmm0, [rip+SCALAR]
+movaps xmm1, [rip+SCALAR]
+movaps xmm2, [rip+SCALAR]
+movaps xmm3, [rip+SCALAR]
+movaps xmm4, [rip+SCALAR]
+movaps xmm5, [rip+SCALAR]
+movaps xmm6, [rip+SCALAR]
+movaps xmm7, [rip+SCALAR]
+movaps xmm8, [rip+SCALAR]
+movaps xmm9, [rip+SCALAR]
+movaps xmm10, [rip+SCALAR]
+movaps xmm11, [rip+SCALAR]
+movaps xmm12, [rip+SCALAR]
+movaps xmm13, [rip+SCALAR]
+movaps xmm14, [rip+SCALAR]
+movaps xmm15, [rip+SCALAR]
+.align 32
+
+
+
+LOOP peakflops_sp_sse_loop 4 GPR6 {
+movaps    xmm2, [STR0 + GPR1 * 4 ]
+addps     xmm1, xmm2
+mulps     xmm3, xmm4
+addps     xmm5, xmm6
+mulps     xmm7, xmm8
+addps     xmm9, xmm10
+mulps     xmm11, xmm12
+addps     xmm13, xmm14
+mulps     xmm15, xmm0
+addps     xmm1, xmm2
+mulps     xmm3, xmm4
+addps     xmm5, xmm6
+mulps     xmm7, xmm8
+addps     xmm9, xmm10
+mulps     xmm11, xmm12
+addps     xmm13, xmm14
+mulps     xmm15, xmm0
+
+}
+
+}
+
+STOP LOCAL
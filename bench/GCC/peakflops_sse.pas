@@ -0,0 +1,68 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC peakflops_sse
+{
+movapd xmm0, [rip+SCALAR]
+movapd xmm2, [rip+SCALAR]
+movapd xmm3, [rip+SCALAR]
+movapd xmm4, [rip+SCALAR]
+movapd xmm5, [rip+SCALAR]
+movapd xmm6, [rip+SCALAR]
+movapd xmm7, [rip+SCALAR]
+movapd xmm8, [rip+SCALAR]
+movapd xmm9, [rip+SCALAR]
+movapd xmm10, [rip+SCALAR]
+movapd xmm11, [rip+SCALAR]
+movapd xmm12, [rip+SCALAR]
+movapd xmm13, [rip+SCALAR]
+movapd xmm14, [rip+SCALAR]
+movapd xmm15, [rip+SCALAR]
+.align 32
+
+
+
+LOOP peakflops_sse_loop 2 GPR6 {
+movapd    xmm1, [STR0 + GPR1 * 8 ]
+addpd     xmm1, xmm2
+mulpd     xmm3, xmm4
+addpd     xmm5, xmm6
+mulpd     xmm7, xmm8
+addpd     xmm9, xmm10
+mulpd     xmm11, xmm12
+addpd     xmm13, xmm14
+mulpd     xmm15, xmm0
+addpd     xmm1, xmm2
+mulpd     xmm3, xmm4
+addpd     xmm5, xmm6
+mulpd     xmm7, xmm8
+addpd     xmm9, xmm10
+mulpd     xmm11, xmm12
+addpd     xmm13, xmm14
+mulpd     xmm15, xmm0
+
+}
+
+}
+
+STOP LOCAL
@@ -0,0 +1,77 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl peakflops_sse
+.type peakflops_sse, @function
+peakflops_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+movapd xmm0, [rip+SCALAR]
+movapd xmm2, [rip+SCALAR]
+movapd xmm3, [rip+SCALAR]
+movapd xmm4, [rip+SCALAR]
+movapd xmm5, [rip+SCALAR]
+movapd xmm6, [rip+SCALAR]
+movapd xmm7, [rip+SCALAR]
+movapd xmm8, [rip+SCALAR]
+movapd xmm9, [rip+SCALAR]
+movapd xmm10, [rip+SCALAR]
+movapd xmm11, [rip+SCALAR]
+movapd xmm12, [rip+SCALAR]
+movapd xmm13, [rip+SCALAR]
+movapd xmm14, [rip+SCALAR]
+movapd xmm15, [rip+SCALAR]
+.align 32
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movapd xmm1, [rsi + rax * 8 ]
+addpd xmm1, xmm2
+mulpd xmm3, xmm4
+addpd xmm5, xmm6
+mulpd xmm7, xmm8
+addpd xmm9, xmm10
+mulpd xmm11, xmm12
+addpd xmm13, xmm14
+mulpd xmm15, xmm0
+addpd xmm1, xmm2
+mulpd xmm3, xmm4
+addpd xmm5, xmm6
+mulpd xmm7, xmm8
+addpd xmm9, xmm10
+mulpd xmm11, xmm12
+addpd xmm13, xmm14
+mulpd xmm15, xmm0
+add rax, 2
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size peakflops_sse, .-peakflops_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,53 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl scatter
+.type scatter, @function
+scatter :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorpd xmm0, xmm0
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movsxd rbx, DWORD PTR [rdx + rax * 4]
+movsxd rcx, DWORD PTR [rdx + rax * 4 + 4]
+movsxd r10, DWORD PTR [rdx + rax * 4 + 8]
+movsxd r11, DWORD PTR [rdx + rax * 4 + 12]
+movsd [rsi + rbx * 8], xmm0
+movsd [rsi + rcx * 8], xmm0
+movsd [rsi + r10 * 8], xmm0
+movsd [rsi + r11 * 8], xmm0
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size scatter, .-scatter
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
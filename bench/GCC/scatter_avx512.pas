@@ -0,0 +1,48 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC scatter_avx512
+{
+vpxorq zmm1, zmm1, zmm1
+
+
+
+LOOP scatter_avx512_loop 32 GPR6 {
+vmovdqu     ymm5, [STR1 + GPR1 * 4]
+vmovdqu     ymm6, [STR1 + GPR1 * 4 + 32]
+vmovdqu     ymm7, [STR1 + GPR1 * 4 + 64]
+vmovdqu     ymm8, [STR1 + GPR1 * 4 + 96]
+kxnorb      k1, k1, k1
+kxnorb      k2, k2, k2
+kxnorb      k3, k3, k3
+kxnorb      k4, k4, k4
+vscatterdpd [STR0 + ymm5 * 8]{k1}, zmm1
+vscatterdpd [STR0 + ymm6 * 8]{k2}, zmm1
+vscatterdpd [STR0 + ymm7 * 8]{k3}, zmm1
+vscatterdpd [STR0 + ymm8 * 8]{k4}, zmm1
+
+}
+
+}
+
+STOP LOCAL
@@ -0,0 +1,57 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl scatter_avx512
+.type scatter_avx512, @function
+scatter_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vpxorq zmm1, zmm1, zmm1
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovdqu ymm5, [rdx + rax * 4]
+vmovdqu ymm6, [rdx + rax * 4 + 32]
+vmovdqu ymm7, [rdx + rax * 4 + 64]
+vmovdqu ymm8, [rdx + rax * 4 + 96]
+kxnorb k1, k1, k1
+kxnorb k2, k2, k2
+kxnorb k3, k3, k3
+kxnorb k4, k4, k4
+vscatterdpd [rsi + ymm5 * 8]{k1}, zmm1
+vscatterdpd [rsi + ymm6 * 8]{k2}, zmm1
+vscatterdpd [rsi + ymm7 * 8]{k3}, zmm1
+vscatterdpd [rsi + ymm8 * 8]{k4}, zmm1
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size scatter_avx512, .-scatter_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,49 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl store_dp_v512_nt_u4
+.type store_dp_v512_nt_u4, @function
+store_dp_v512_nt_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovupd zmm31, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovntpd [rsi + rax*8 + 0], zmm31
+vmovntpd [rsi + rax*8 + 64], zmm31
+vmovntpd [rsi + rax*8 + 128], zmm31
+vmovntpd [rsi + rax*8 + 192], zmm31
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size store_dp_v512_nt_u4, .-store_dp_v512_nt_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,61 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl stream_avx
+.type stream_avx, @function
+stream_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm5, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rdx + rax*8]
+vmovaps ymm2, [rdx + rax*8+32]
+vmovaps ymm3, [rdx + rax*8+64]
+vmovaps ymm4, [rdx + rax*8+96]
+vmulpd ymm1, ymm1, ymm5
+vaddpd ymm1, ymm1, [rcx + rax*8]
+vmulpd ymm2, ymm2, ymm5
+vaddpd ymm2, ymm2, [rcx + rax*8+32]
+vmulpd ymm3, ymm3, ymm5
+vaddpd ymm3, ymm3, [rcx + rax*8+64]
+vmulpd ymm4, ymm4, ymm5
+vaddpd ymm4, ymm4, [rcx + rax*8+96]
+vmovaps [rsi + rax*8] , ymm1
+vmovaps [rsi + rax*8+32], ymm2
+vmovaps [rsi + rax*8+64], ymm3
+vmovaps [rsi + rax*8+96], ymm4
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size stream_avx, .-stream_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
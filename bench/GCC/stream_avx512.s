@@ -0,0 +1,61 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl stream_avx512
+.type stream_avx512, @function
+stream_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovapd zmm5, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm1, [rdx + rax*8]
+vmovapd zmm2, [rdx + rax*8+64]
+vmovapd zmm3, [rdx + rax*8+128]
+vmovapd zmm4, [rdx + rax*8+192]
+vmulpd zmm1, zmm1, zmm5
+vaddpd zmm1, zmm1, [rcx + rax*8]
+vmulpd zmm2, zmm2, zmm5
+vaddpd zmm2, zmm2, [rcx + rax*8+64]
+vmulpd zmm3, zmm3, zmm5
+vaddpd zmm3, zmm3, [rcx + rax*8+128]
+vmulpd zmm4, zmm4, zmm5
+vaddpd zmm4, zmm4, [rcx + rax*8+192]
+vmovapd [rsi + rax*8] , zmm1
+vmovapd [rsi + rax*8+64], zmm2
+vmovapd [rsi + rax*8+128], zmm3
+vmovapd [rsi + rax*8+192], zmm4
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size stream_avx512, .-stream_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl stream_sp_avx512
+.type stream_sp_avx512, @function
+stream_sp_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm2, [rdx + rax*4]
+vmovaps zmm3, [rdx + rax*4+64]
+vmovaps zmm4, [rdx + rax*4+128]
+vmovaps zmm5, [rdx + rax*4+192]
+vmulps zmm2, zmm2, zmm1
+vaddps zmm2, zmm2, [rcx + rax*4]
+vmulps zmm3, zmm3, zmm1
+vaddps zmm3, zmm3, [rcx + rax*4+64]
+vmulps zmm4, zmm4, zmm1
+vaddps zmm4, zmm4, [rcx + rax*4+128]
+vmulps zmm5, zmm5, zmm1
+vaddps zmm5, zmm5, [rcx + rax*4+192]
+vmovaps [rsi + rax*4], zmm2
+vmovaps [rsi + rax*4+64], zmm3
+vmovaps [rsi + rax*4+128], zmm4
+vmovaps [rsi + rax*4+192], zmm5
+add rax, 64
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size stream_sp_avx512, .-stream_sp_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,57 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl stream_sp_avx_fma
+.type stream_sp_avx_fma, @function
+stream_sp_avx_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vmovaps ymm1, [rip+SCALAR]
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm2, [rdx + rax*4]
+vmovaps ymm3, [rdx + rax*4+32]
+vmovaps ymm4, [rdx + rax*4+64]
+vmovaps ymm5, [rdx + rax*4+96]
+vfmadd213ps ymm2, ymm1, [rcx + rax*4]
+vfmadd213ps ymm3, ymm1, [rcx + rax*4+32]
+vfmadd213ps ymm4, ymm1, [rcx + rax*4+64]
+vfmadd213ps ymm5, ymm1, [rcx + rax*4+96]
+vmovaps [rsi + rax*4], ymm2
+vmovaps [rsi + rax*4+32], ymm3
+vmovaps [rsi + rax*4+64], ymm4
+vmovaps [rsi + rax*4+96], ymm5
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size stream_sp_avx_fma, .-stream_sp_avx_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl sum_sp
+.type sum_sp, @function
+sum_sp :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorps xmm0, xmm0
+xorps xmm1, xmm1
+xorps xmm2, xmm2
+xorps xmm3, xmm3
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+addss xmm0, [rsi + rax * 4]
+addss xmm1, [rsi + rax * 4 + 4]
+addss xmm2, [rsi + rax * 4 + 8]
+addss xmm3, [rsi + rax * 4 + 12]
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size sum_sp, .-sum_sp
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
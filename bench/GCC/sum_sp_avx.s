@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl sum_sp_avx
+.type sum_sp_avx, @function
+sum_sp_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+vxorps ymm1, ymm1, ymm1
+vmovaps ymm2, ymm1
+vmovaps ymm3, ymm1
+vmovaps ymm4, ymm1
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vaddps ymm1, ymm1, [rsi + rax*4]
+vaddps ymm2, ymm2, [rsi + rax*4+32]
+vaddps ymm3, ymm3, [rsi + rax*4+64]
+vaddps ymm4, ymm4, [rsi + rax*4+96]
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size sum_sp_avx, .-sum_sp_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl sum_sp_sse
+.type sum_sp_sse, @function
+sum_sp_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorps xmm0, xmm0
+movaps xmm1, xmm0
+movaps xmm2, xmm0
+movaps xmm3, xmm0
+movaps xmm4, xmm0
+movaps xmm5, xmm0
+movaps xmm6, xmm0
+movaps xmm7, xmm0
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+addps xmm0, [rsi + rax * 4]
+addps xmm1, [rsi + rax * 4 + 16]
+addps xmm2, [rsi + rax * 4 + 32]
+addps xmm3, [rsi + rax * 4 + 48]
+addps xmm4, [rsi + rax * 4 + 64]
+addps xmm5, [rsi + rax * 4 + 80]
+addps xmm6, [rsi + rax * 4 + 96]
+addps xmm7, [rsi + rax * 4 + 112]
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size sum_sp_sse, .-sum_sp_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl sum_sse
+.type sum_sse, @function
+sum_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xorpd xmm0, xmm0
+movapd xmm1, xmm0
+movapd xmm2, xmm0
+movapd xmm3, xmm0
+movapd xmm4, xmm0
+movapd xmm5, xmm0
+movapd xmm6, xmm0
+movapd xmm7, xmm0
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+addpd xmm0, [rsi + rax * 8]
+addpd xmm1, [rsi + rax * 8 + 16]
+addpd xmm2, [rsi + rax * 8 + 32]
+addpd xmm3, [rsi + rax * 8 + 48]
+addpd xmm4, [rsi + rax * 8 + 64]
+addpd xmm5, [rsi + rax * 8 + 80]
+addpd xmm6, [rsi + rax * 8 + 96]
+addpd xmm7, [rsi + rax * 8 + 112]
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size sum_sse, .-sum_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_avx512_fma
+.type triad_avx512_fma, @function
+triad_avx512_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm1, [rdx + rax*8]
+vmovaps zmm2, [rdx + rax*8+64]
+vmovaps zmm3, [rdx + rax*8+128]
+vmovaps zmm4, [rdx + rax*8+192]
+vmovaps zmm5, [rcx + rax*8]
+vmovaps zmm6, [rcx + rax*8+64]
+vmovaps zmm7, [rcx + rax*8+128]
+vmovaps zmm8, [rcx + rax*8+192]
+vfmadd213pd zmm1, zmm5, [r8 + rax*8]
+vfmadd213pd zmm2, zmm6, [r8 + rax*8+64]
+vfmadd213pd zmm3, zmm7, [r8 + rax*8+128]
+vfmadd213pd zmm4, zmm8, [r8 + rax*8+192]
+vmovaps [rsi + rax*8], zmm1
+vmovaps [rsi + rax*8+64], zmm2
+vmovaps [rsi + rax*8+128], zmm3
+vmovaps [rsi + rax*8+192], zmm4
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_avx512_fma, .-triad_avx512_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,51 @@
+#define STR0 ARG2
+#define STR1 ARG3
+#define STR2 ARG4
+#define STR3 ARG5
+#define STR4 ARG6
+
+#define STR5 GPR9
+#define STR6 GPR10
+#define STR7 GPR11
+#define STR8 GPR12
+#define STR9 GPR13
+#define STR10 GPR14
+
+
+DEFINE DOUBLE SCALAR  1.0
+DEFINE SINGLE SSCALAR  1.0
+DEFINE INT ISCALAR  1
+#DEFINE INT OMM  0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+#DEFINE INT IOMM  0,16,32,48,64,80,96,128,144,160,176,192,208,224,240,256
+#DEFINE INT TOMM  0,2,4,6,16,18,20,22,32,34,36,38,48,50,52,54
+
+START LOCAL
+
+FUNC triad_dp_v128_fma_u4
+{
+
+
+
+LOOP triad_dp_v128_fma_u4_loop 8 GPR6 {
+vmovapd    xmm0, [STR1 + GPR1*8 + 0]
+vmovapd    xmm1, [STR1 + GPR1*8 + 16]
+vmovapd    xmm2, [STR1 + GPR1*8 + 32]
+vmovapd    xmm3, [STR1 + GPR1*8 + 48]
+vmovapd    xmm4, [STR2 + GPR1*8 + 0]
+vmovapd    xmm5, [STR2 + GPR1*8 + 16]
+vmovapd    xmm6, [STR2 + GPR1*8 + 32]
+vmovapd    xmm7, [STR2 + GPR1*8 + 48]
+vfmadd213pd xmm0, xmm4, [STR3 + GPR1*8 + 0]
+vfmadd213pd xmm1, xmm5, [STR3 + GPR1*8 + 16]
+vfmadd213pd xmm2, xmm6, [STR3 + GPR1*8 + 32]
+vfmadd213pd xmm3, xmm7, [STR3 + GPR1*8 + 48]
+vmovapd    [STR0 + GPR1*8 + 0], xmm0
+vmovapd    [STR0 + GPR1*8 + 16], xmm1
+vmovapd    [STR0 + GPR1*8 + 32], xmm2
+vmovapd    [STR0 + GPR1*8 + 48], xmm3
+
+}
+
+}
+
+STOP LOCAL
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_dp_v128_fma_u4
+.type triad_dp_v128_fma_u4, @function
+triad_dp_v128_fma_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd xmm0, [rdx + rax*8 + 0]
+vmovapd xmm1, [rdx + rax*8 + 16]
+vmovapd xmm2, [rdx + rax*8 + 32]
+vmovapd xmm3, [rdx + rax*8 + 48]
+vmovapd xmm4, [rcx + rax*8 + 0]
+vmovapd xmm5, [rcx + rax*8 + 16]
+vmovapd xmm6, [rcx + rax*8 + 32]
+vmovapd xmm7, [rcx + rax*8 + 48]
+vfmadd213pd xmm0, xmm4, [r8 + rax*8 + 0]
+vfmadd213pd xmm1, xmm5, [r8 + rax*8 + 16]
+vfmadd213pd xmm2, xmm6, [r8 + rax*8 + 32]
+vfmadd213pd xmm3, xmm7, [r8 + rax*8 + 48]
+vmovapd [rsi + rax*8 + 0], xmm0
+vmovapd [rsi + rax*8 + 16], xmm1
+vmovapd [rsi + rax*8 + 32], xmm2
+vmovapd [rsi + rax*8 + 48], xmm3
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_dp_v128_fma_u4, .-triad_dp_v128_fma_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_dp_v256_fma_u4
+.type triad_dp_v256_fma_u4, @function
+triad_dp_v256_fma_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd ymm0, [rdx + rax*8 + 0]
+vmovapd ymm1, [rdx + rax*8 + 32]
+vmovapd ymm2, [rdx + rax*8 + 64]
+vmovapd ymm3, [rdx + rax*8 + 96]
+vmovapd ymm4, [rcx + rax*8 + 0]
+vmovapd ymm5, [rcx + rax*8 + 32]
+vmovapd ymm6, [rcx + rax*8 + 64]
+vmovapd ymm7, [rcx + rax*8 + 96]
+vfmadd213pd ymm0, ymm4, [r8 + rax*8 + 0]
+vfmadd213pd ymm1, ymm5, [r8 + rax*8 + 32]
+vfmadd213pd ymm2, ymm6, [r8 + rax*8 + 64]
+vfmadd213pd ymm3, ymm7, [r8 + rax*8 + 96]
+vmovapd [rsi + rax*8 + 0], ymm0
+vmovapd [rsi + rax*8 + 32], ymm1
+vmovapd [rsi + rax*8 + 64], ymm2
+vmovapd [rsi + rax*8 + 96], ymm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_dp_v256_fma_u4, .-triad_dp_v256_fma_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
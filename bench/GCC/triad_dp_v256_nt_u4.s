@@ -0,0 +1,64 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_dp_v256_nt_u4
+.type triad_dp_v256_nt_u4, @function
+triad_dp_v256_nt_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd ymm0, [rdx + rax*8 + 0]
+vmovapd ymm1, [rdx + rax*8 + 32]
+vmovapd ymm2, [rdx + rax*8 + 64]
+vmovapd ymm3, [rdx + rax*8 + 96]
+vmovapd ymm4, [rcx + rax*8 + 0]
+vmovapd ymm5, [rcx + rax*8 + 32]
+vmovapd ymm6, [rcx + rax*8 + 64]
+vmovapd ymm7, [rcx + rax*8 + 96]
+vmulpd ymm0, ymm0, ymm4
+vmulpd ymm1, ymm1, ymm5
+vmulpd ymm2, ymm2, ymm6
+vmulpd ymm3, ymm3, ymm7
+vaddpd ymm0, ymm0, [r8 + rax*8 + 0]
+vaddpd ymm1, ymm1, [r8 + rax*8 + 32]
+vaddpd ymm2, ymm2, [r8 + rax*8 + 64]
+vaddpd ymm3, ymm3, [r8 + rax*8 + 96]
+vmovntpd [rsi + rax*8 + 0], ymm0
+vmovntpd [rsi + rax*8 + 32], ymm1
+vmovntpd [rsi + rax*8 + 64], ymm2
+vmovntpd [rsi + rax*8 + 96], ymm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_dp_v256_nt_u4, .-triad_dp_v256_nt_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_dp_v512_fma_u4
+.type triad_dp_v512_fma_u4, @function
+triad_dp_v512_fma_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm0, [rdx + rax*8 + 0]
+vmovapd zmm1, [rdx + rax*8 + 64]
+vmovapd zmm2, [rdx + rax*8 + 128]
+vmovapd zmm3, [rdx + rax*8 + 192]
+vmovapd zmm4, [rcx + rax*8 + 0]
+vmovapd zmm5, [rcx + rax*8 + 64]
+vmovapd zmm6, [rcx + rax*8 + 128]
+vmovapd zmm7, [rcx + rax*8 + 192]
+vfmadd213pd zmm0, zmm4, [r8 + rax*8 + 0]
+vfmadd213pd zmm1, zmm5, [r8 + rax*8 + 64]
+vfmadd213pd zmm2, zmm6, [r8 + rax*8 + 128]
+vfmadd213pd zmm3, zmm7, [r8 + rax*8 + 192]
+vmovapd [rsi + rax*8 + 0], zmm0
+vmovapd [rsi + rax*8 + 64], zmm1
+vmovapd [rsi + rax*8 + 128], zmm2
+vmovapd [rsi + rax*8 + 192], zmm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_dp_v512_fma_u4, .-triad_dp_v512_fma_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_mem_avx512_fma
+.type triad_mem_avx512_fma, @function
+triad_mem_avx512_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm1, [rdx + rax*8]
+vmovaps zmm2, [rcx + rax*8]
+vmovaps zmm3, [rdx + rax*8+64]
+vmovaps zmm4, [rcx + rax*8+64]
+vfmadd213pd zmm1, zmm2, [r8 + rax*8]
+vfmadd213pd zmm3, zmm4, [r8 + rax*8+64]
+vmovntpd [rsi + rax*8], zmm1
+vmovntpd [rsi + rax*8+64], zmm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_mem_avx512_fma, .-triad_mem_avx512_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
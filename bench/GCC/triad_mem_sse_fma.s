@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_mem_sse_fma
+.type triad_mem_sse_fma, @function
+triad_mem_sse_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rdx + rax*8]
+movaps xmm1, [rdx + rax*8+16]
+movaps xmm2, [rdx + rax*8+32]
+movaps xmm3, [rdx + rax*8+48]
+movaps xmm4, [rcx + rax*8]
+movaps xmm5, [rcx + rax*8+16]
+movaps xmm6, [rcx + rax*8+32]
+movaps xmm7, [rcx + rax*8+48]
+vfmadd213pd xmm0, xmm4, [r8 + rax*8]
+vfmadd213pd xmm1, xmm5, [r8 + rax*8+16]
+vfmadd213pd xmm2, xmm6, [r8 + rax*8+32]
+vfmadd213pd xmm3, xmm7, [r8 + rax*8+48]
+movntpd [rsi + rax*8], xmm0
+movntpd [rsi + rax*8+16], xmm1
+movntpd [rsi + rax*8+32], xmm2
+movntpd [rsi + rax*8+48], xmm3
+add rax, 8
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_mem_sse_fma, .-triad_mem_sse_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_mem_sse_fma
+.type triad_sp_mem_sse_fma, @function
+triad_sp_mem_sse_fma :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rdx + rax*4]
+movaps xmm1, [rdx + rax*4+16]
+movaps xmm2, [rdx + rax*4+32]
+movaps xmm3, [rdx + rax*4+48]
+movaps xmm4, [rcx + rax*4]
+movaps xmm5, [rcx + rax*4+16]
+movaps xmm6, [rcx + rax*4+32]
+movaps xmm7, [rcx + rax*4+48]
+vfmadd213ps xmm0, xmm4, [r8 + rax*4]
+vfmadd213ps xmm1, xmm5, [r8 + rax*4+16]
+vfmadd213ps xmm2, xmm6, [r8 + rax*4+32]
+vfmadd213ps xmm3, xmm7, [r8 + rax*4+48]
+movntps [rsi + rax*4], xmm0
+movntps [rsi + rax*4+16], xmm1
+movntps [rsi + rax*4+32], xmm2
+movntps [rsi + rax*4+48], xmm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_mem_sse_fma, .-triad_sp_mem_sse_fma
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_sse
+.type triad_sp_sse, @function
+triad_sp_sse :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movaps xmm0, [rdx + rax*4]
+movaps xmm1, [rdx + rax*4+16]
+movaps xmm2, [rdx + rax*4+32]
+movaps xmm3, [rdx + rax*4+48]
+mulps xmm0, [rcx + rax*4]
+addps xmm0, [r8 + rax*4]
+mulps xmm1, [rcx + rax*4+16]
+addps xmm1, [r8 + rax*4+16]
+mulps xmm2, [rcx + rax*4+32]
+addps xmm2, [r8 + rax*4+32]
+mulps xmm3, [rcx + rax*4+48]
+addps xmm3, [r8 + rax*4+48]
+movaps [rsi + rax*4], xmm0
+movaps [rsi + rax*4+16], xmm1
+movaps [rsi + rax*4+32], xmm2
+movaps [rsi + rax*4+48], xmm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_sse, .-triad_sp_sse
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,64 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_v128_u4
+.type triad_sp_v128_u4, @function
+triad_sp_v128_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps xmm0, [rdx + rax*4 + 0]
+vmovaps xmm1, [rdx + rax*4 + 16]
+vmovaps xmm2, [rdx + rax*4 + 32]
+vmovaps xmm3, [rdx + rax*4 + 48]
+vmovaps xmm4, [rcx + rax*4 + 0]
+vmovaps xmm5, [rcx + rax*4 + 16]
+vmovaps xmm6, [rcx + rax*4 + 32]
+vmovaps xmm7, [rcx + rax*4 + 48]
+vmulps xmm0, xmm0, xmm4
+vmulps xmm1, xmm1, xmm5
+vmulps xmm2, xmm2, xmm6
+vmulps xmm3, xmm3, xmm7
+vaddps xmm0, xmm0, [r8 + rax*4 + 0]
+vaddps xmm1, xmm1, [r8 + rax*4 + 16]
+vaddps xmm2, xmm2, [r8 + rax*4 + 32]
+vaddps xmm3, xmm3, [r8 + rax*4 + 48]
+vmovaps [rsi + rax*4 + 0], xmm0
+vmovaps [rsi + rax*4 + 16], xmm1
+vmovaps [rsi + rax*4 + 32], xmm2
+vmovaps [rsi + rax*4 + 48], xmm3
+add rax, 16
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_v128_u4, .-triad_sp_v128_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
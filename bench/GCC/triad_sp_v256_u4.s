@@ -0,0 +1,64 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_v256_u4
+.type triad_sp_v256_u4, @function
+triad_sp_v256_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm0, [rdx + rax*4 + 0]
+vmovaps ymm1, [rdx + rax*4 + 32]
+vmovaps ymm2, [rdx + rax*4 + 64]
+vmovaps ymm3, [rdx + rax*4 + 96]
+vmovaps ymm4, [rcx + rax*4 + 0]
+vmovaps ymm5, [rcx + rax*4 + 32]
+vmovaps ymm6, [rcx + rax*4 + 64]
+vmovaps ymm7, [rcx + rax*4 + 96]
+vmulps ymm0, ymm0, ymm4
+vmulps ymm1, ymm1, ymm5
+vmulps ymm2, ymm2, ymm6
+vmulps ymm3, ymm3, ymm7
+vaddps ymm0, ymm0, [r8 + rax*4 + 0]
+vaddps ymm1, ymm1, [r8 + rax*4 + 32]
+vaddps ymm2, ymm2, [r8 + rax*4 + 64]
+vaddps ymm3, ymm3, [r8 + rax*4 + 96]
+vmovaps [rsi + rax*4 + 0], ymm0
+vmovaps [rsi + rax*4 + 32], ymm1
+vmovaps [rsi + rax*4 + 64], ymm2
+vmovaps [rsi + rax*4 + 96], ymm3
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_v256_u4, .-triad_sp_v256_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_v512_fma_u4
+.type triad_sp_v512_fma_u4, @function
+triad_sp_v512_fma_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm0, [rdx + rax*4 + 0]
+vmovaps zmm1, [rdx + rax*4 + 64]
+vmovaps zmm2, [rdx + rax*4 + 128]
+vmovaps zmm3, [rdx + rax*4 + 192]
+vmovaps zmm4, [rcx + rax*4 + 0]
+vmovaps zmm5, [rcx + rax*4 + 64]
+vmovaps zmm6, [rcx + rax*4 + 128]
+vmovaps zmm7, [rcx + rax*4 + 192]
+vfmadd213ps zmm0, zmm4, [r8 + rax*4 + 0]
+vfmadd213ps zmm1, zmm5, [r8 + rax*4 + 64]
+vfmadd213ps zmm2, zmm6, [r8 + rax*4 + 128]
+vfmadd213ps zmm3, zmm7, [r8 + rax*4 + 192]
+vmovaps [rsi + rax*4 + 0], zmm0
+vmovaps [rsi + rax*4 + 64], zmm1
+vmovaps [rsi + rax*4 + 128], zmm2
+vmovaps [rsi + rax*4 + 192], zmm3
+add rax, 64
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_v512_fma_u4, .-triad_sp_v512_fma_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
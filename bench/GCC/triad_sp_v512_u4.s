@@ -0,0 +1,64 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl triad_sp_v512_u4
+.type triad_sp_v512_u4, @function
+triad_sp_v512_u4 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps zmm0, [rdx + rax*4 + 0]
+vmovaps zmm1, [rdx + rax*4 + 64]
+vmovaps zmm2, [rdx + rax*4 + 128]
+vmovaps zmm3, [rdx + rax*4 + 192]
+vmovaps zmm4, [rcx + rax*4 + 0]
+vmovaps zmm5, [rcx + rax*4 + 64]
+vmovaps zmm6, [rcx + rax*4 + 128]
+vmovaps zmm7, [rcx + rax*4 + 192]
+vmulps zmm0, zmm0, zmm4
+vmulps zmm1, zmm1, zmm5
+vmulps zmm2, zmm2, zmm6
+vmulps zmm3, zmm3, zmm7
+vaddps zmm0, zmm0, [r8 + rax*4 + 0]
+vaddps zmm1, zmm1, [r8 + rax*4 + 64]
+vaddps zmm2, zmm2, [r8 + rax*4 + 128]
+vaddps zmm3, zmm3, [r8 + rax*4 + 192]
+vmovaps [rsi + rax*4 + 0], zmm0
+vmovaps [rsi + rax*4 + 64], zmm1
+vmovaps [rsi + rax*4 + 128], zmm2
+vmovaps [rsi + rax*4 + 192], zmm3
+add rax, 64
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size triad_sp_v512_u4, .-triad_sp_v512_u4
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl update_sp
+.type update_sp, @function
+update_sp :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+movss xmm0, [rsi + rax * 4]
+movss [rsi + rax * 4] , xmm0
+movss xmm1, [rsi + rax * 4 + 4]
+movss xmm2, [rsi + rax * 4 + 8]
+movss xmm3, [rsi + rax * 4 + 12]
+movss [rsi + rax * 4 + 4], xmm1
+movss [rsi + rax * 4 + 8], xmm2
+movss [rsi + rax * 4 + 12], xmm3
+add rax, 4
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size update_sp, .-update_sp
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
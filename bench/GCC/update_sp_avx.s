@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl update_sp_avx
+.type update_sp_avx, @function
+update_sp_avx :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovaps ymm1, [rsi + rax * 4]
+vmovaps [rsi + rax * 4] , ymm1
+vmovaps ymm2, [rsi + rax * 4 + 32]
+vmovaps ymm3, [rsi + rax * 4 + 64]
+vmovaps ymm4, [rsi + rax * 4 + 96]
+vmovaps [rsi + rax * 4 + 32], ymm2
+vmovaps [rsi + rax * 4 + 64], ymm3
+vmovaps [rsi + rax * 4 + 96], ymm4
+add rax, 32
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size update_sp_avx, .-update_sp_avx
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
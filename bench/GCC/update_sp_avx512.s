@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.data
+.align 64
+SCALAR:
+.double 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+SSCALAR:
+.single 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+.align 64
+ISCALAR:
+.int 1, 1
+.text
+.globl update_sp_avx512
+.type update_sp_avx512, @function
+update_sp_avx512 :
+push rbp
+mov rbp, rsp
+push rbx
+push r12
+push r13
+push r14
+push r15
+xor   rax, rax
+.align 64
+1:
+.align 16
+1:
+vmovapd zmm1, [rsi + rax * 4]
+vmovapd [rsi + rax * 4] , zmm1
+vmovapd zmm2, [rsi + rax * 4 + 64]
+vmovapd zmm3, [rsi + rax * 4 + 128]
+vmovapd zmm4, [rsi + rax * 4 + 192]
+vmovapd [rsi + rax * 4 + 64], zmm2
+vmovapd [rsi + rax * 4 + 128], zmm3
+vmovapd [rsi + rax * 4 + 192], zmm4
+add rax, 64
+cmp rax, rdi
+jl 1b
+pop r15
+pop r14
+pop r13
+pop r12
+pop rbx
+mov  rsp, rbp
+pop rbp
+ret
+.size update_sp_avx512, .-update_sp_avx512
+#if defined(__linux__) && defined(__ELF__)
+.section .note.GNU-stack,"",%progbits
+#endif
+
+
@@ -47,5 +47,24 @@ extern void allocator_allocateVector(void** ptr,
                 int stride,
                 bstring domain,
                 int init_per_thread);
+extern size_t allocator_chainHeader(int chains, int stride);
+extern int allocator_buildChains(void* ptr,
+                uint64_t bytes,
+                int chains,
+                int stride,
+                ChainPolicy policy,
+                uint64_t seed);
+extern DataType allocator_streamType(const TestCase* test, int stream);
+extern int allocator_readIndexFile(const char* filename,
+                int** list,
+                uint64_t* len);
+extern int allocator_buildIndex(int* idx,
+                uint64_t n,
+                uint64_t range,
+                IndexPattern pattern,
+                int param,
+                const int* list,
+                uint64_t listLen,
+                uint64_t seed);
 
 #endif /*ALLOCATOR_H*/
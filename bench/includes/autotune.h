@@ -0,0 +1,48 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  autotune.h
+ *
+ *      Description:  Header file of the auto-tuning module.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#include <stdint.h>
+#include <bstrlib.h>
+#include <bstrlib_helper.h>
+#include <test_types.h>
+
+extern int autotune_run(const_bstring op,
+                DataType type,
+                struct bstrList* workgroups,
+                uint32_t runtime,
+                const char* compilepath,
+                const_bstring profile);
+extern bstring autotune_readProfile(const_bstring profile);
+
+#endif /*AUTOTUNE_H*/
@@ -79,11 +79,30 @@ static RegisterMap StreamPatterns[] = {
     {"", ""},
 };
 
+#define TEMPLATE_MAX_WIDTHS 8
+#define TEMPLATE_MAX_PREFETCH 8
+
+/* Parameter space of a kernel template, the variants are named
+ * <op>_<dp|sp>_v<bits>[_nt][_fma][_pf<dist>]_u<unroll> */
+typedef struct {
+    int hasDouble;
+    int hasSingle;
+    int numWidths;
+    int bits[TEMPLATE_MAX_WIDTHS];
+    int nt;
+    int fma;
+    int numPrefetch;
+    int prefetch[TEMPLATE_MAX_PREFETCH];
+} TemplateInfo;
+
 struct bstrList* dynbench_getall();
 
 int dynbench_test(bstring testname);
 int dynbench_load(bstring testname, TestCase **testcase, char* tmpfolder, char *compilers, char* compileflags);
 int dynbench_close(TestCase* testcase, char* tmpfolder);
 int dynbench_asm(bstring testname, char* tmpfolder, bstring outfile);
+int dynbench_template_info(bstring op, TemplateInfo* info);
+int dynbench_template_valid(bstring testname);
+bstring dynbench_userfolder(void);
 
 #endif
@@ -0,0 +1,79 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  stencil.h
+ *
+ *      Description:  Header file of stencil module.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+#ifndef STENCIL_H
+#define STENCIL_H
+
+#include <stdint.h>
+#include <bstrlib.h>
+#include <test_types.h>
+#include <barrier_types.h>
+
+extern const TestCase* stencil_getTest(const_bstring name);
+extern void stencil_printTests(void);
+extern int stencil_setupGrid(StencilGrid* grid,
+                const TestCase* test,
+                uint64_t elements,
+                uint64_t cacheSize,
+                int autoblock);
+extern int stencil_layerCondition(const TestCase* test,
+                const StencilGrid* grid,
+                int layers,
+                uint64_t cacheSize);
+extern void stencil_partition(const TestCase* test,
+                const StencilGrid* grid,
+                int threadId,
+                int numberOfThreads,
+                uint64_t* first,
+                uint64_t* last);
+extern uint64_t stencil_updates(const TestCase* test,
+                const StencilGrid* grid,
+                uint64_t first,
+                uint64_t last);
+extern void stencil_init(const TestCase* test,
+                const StencilGrid* grid,
+                double* a,
+                double* b,
+                uint64_t first,
+                uint64_t last);
+extern void stencil_sweep(const TestCase* test,
+                const StencilGrid* grid,
+                const double* src,
+                double* dst,
+                uint64_t first,
+                uint64_t last);
+extern void stencil_wavefront(const TestCase* test,
+                const StencilGrid* grid,
+                void** streams,
+                int threadId,
+                int numberOfThreads,
+                BarrierData* barr);
+
+#endif /*STENCIL_H*/
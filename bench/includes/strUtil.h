@@ -52,9 +52,17 @@ typedef struct {
     uint64_t size;
     int init_per_thread;
     Stream* streams;
+    int numberOfStreams;
+    const TestCase* test;
+    bstring kernel;
+    uint64_t iter;
+    uint32_t min_runtime;
+    GroupRole role;
+    StencilGrid grid;
 } Workgroup;
 
+extern int bstr_to_workgroupOptions(Workgroup* group, bstring str);
 extern int bstr_to_workgroup(Workgroup* group, const_bstring str, DataType type, int numberOfStreams);
-extern void workgroups_destroy(Workgroup** groupList, int numberOfGroups, int numberOfStreams);
+extern void workgroups_destroy(Workgroup** groupList, int numberOfGroups);
 
 #endif
@@ -40,6 +40,38 @@ typedef enum {
     DOUBLE,
     INT} DataType;
 
+typedef enum {
+    CHAIN_RANDOM = 0,
+    CHAIN_PAGE,
+    CHAIN_LINEAR} ChainPolicy;
+
+typedef enum {
+    INDEX_CONTIGUOUS = 0,
+    INDEX_STRIDE,
+    INDEX_BLOCKED,
+    INDEX_RANDOM,
+    INDEX_FILE} IndexPattern;
+
+typedef enum {
+    STENCIL_NONE = 0,
+    STENCIL_2D5PT,
+    STENCIL_3D7PT,
+    STENCIL_3D27PT} StencilType;
+
+typedef struct {
+    uint64_t nx;
+    uint64_t ny;
+    uint64_t nz;
+    uint64_t block;
+    int wavefront;
+} StencilGrid;
+
+typedef enum {
+    GROUP_SHARED = 0,
+    GROUP_INDEPENDENT,
+    GROUP_VICTIM,
+    GROUP_LOAD} GroupRole;
+
 typedef enum {
     STREAM_0 = 0,
     STREAM_1 = 1,
@@ -97,6 +129,9 @@ typedef struct {
     int instr_const;
     int instr_loop;
     int uops;
+    int chains;
+    int index_stream;
+    StencilType stencil;
     int loadstores;
     void* dlhandle;
 } TestCase;
@@ -111,6 +146,19 @@ typedef struct {
     int    init_per_thread;
     int* processors;
     void** streams;
+    int chain_stride;
+    ChainPolicy chain_policy;
+    IndexPattern index_pattern;
+    int index_param;
+    const int* index_list;
+    uint64_t index_list_len;
+    StencilGrid grid;
+    GroupRole role;
+    int victims;
+    uint64_t solo_cycles;
+    uint32_t sample_block;
+    uint64_t* samples;
+    uint64_t num_samples;
 } ThreadUserData;
 
 #endif /*TEST_TYPES_H*/
@@ -49,6 +49,8 @@
 #include <strUtil.h>
 #include <allocator.h>
 #include <ptt2asm.h>
+#include <stencil.h>
+#include <autotune.h>
 
 #include <likwid.h>
 #include <likwid-marker.h>
@@ -58,6 +60,7 @@
 
 extern void* runTest(void* arg);
 extern void* getIterSingle(void* arg);
+extern double bench_timestampFrequency(void);
 
 /* #####   MACROS  -  LOCAL TO THIS SOURCE FILE   ######################### */
 
@@ -77,6 +80,28 @@ extern void* getIterSingle(void* arg);
     printf("-w\t\t <thread_domain>:<size>[:<num_threads>[:<chunk size>:<stride>]-<streamId>:<domain_id>[:<offset>]\n"); \
     printf("-W\t\t <thread_domain>:<size>[:<num_threads>[:<chunk size>:<stride>]]\n"); \
     printf("\t\t <size> in kB, MB or GB (mandatory)\n"); \
+    printf("\t\t Per-workgroup options appended to -w/-W: :kernel=<TEST> :iter=<ITERS> :time=<TIME>\n"); \
+    printf("\t\t :role=victim|load. With victim groups, the victims run alone for a baseline and\n"); \
+    printf("\t\t then together with the other groups which run as background load\n"); \
+    printf("-j <BLOCK>\t Record a timestamp after every <BLOCK> iterations and print\n"); \
+    printf("\t\t min/median/p99/max of the block runtimes per thread and for all threads\n"); \
+    printf("-J <FILE>\t Write the raw block runtimes to <FILE> (implies -j 1 if not given)\n"); \
+    printf("-L <STRIDE>[:<POLICY>]\t Node stride in Byte and page-locality policy of the chains\n"); \
+    printf("\t\t for the pointer-chase (latency) benchmarks. Policies: random, page, linear\n"); \
+    printf("\t\t (default: <cacheline size>:random)\n"); \
+    printf("-I <PATTERN>\t Index pattern for the gather/scatter benchmarks: contiguous,\n"); \
+    printf("\t\t stride[:<ELEMS>], block[:<ELEMS>] (random inside blocks), random or\n"); \
+    printf("\t\t file:<FILE> (whitespace separated indices) (default: contiguous)\n"); \
+    printf("-G <NX>x<NY>[x<NZ>] Grid size of the stencil benchmarks, overrides the workgroup size\n"); \
+    printf("\t\t (default: square/cubic grid derived from the workgroup size)\n"); \
+    printf("-B <BLOCK>\t Block size of the stencil benchmarks in x (2D) or y (3D) direction,\n"); \
+    printf("\t\t auto (layer condition in the core-private cache, default) or none\n"); \
+    printf("-T\t\t Wavefront temporal blocking for the stencil benchmarks. Each thread of the\n"); \
+    printf("\t\t workgroup performs one time step, all threads sweep the grid together\n"); \
+    printf("-A <OP>[:sp]\t Auto-tune the template kernel <OP> (e.g. triad) on the workgroups: vector\n"); \
+    printf("\t\t width, unroll factor, store type, FMA and prefetch distance are tuned in turn\n"); \
+    printf("-P <NAME>\t With -A, store the best variant as machine profile <NAME>, otherwise\n"); \
+    printf("\t\t run the kernel of profile <NAME> (in $HOME/.likwid/bench/<arch> or a path)\n"); \
     printf("For dynamically loaded benchmarks\n"); \
     printf("-f <PATH>\t Specify a folder for the temporary files. default: /tmp\n"); \
     printf("-o <FILE>\t Save generated assembly to file\n"); \
@@ -92,6 +117,16 @@ extern void* getIterSingle(void* arg);
     printf("likwid-bench -t copy -w S0:100kB:1\n"); \
     printf("# Run the copy benchmark on one CPU at CPU socket 0 with a vector size of 100MB but place one stream on CPU socket 1\n"); \
     printf("likwid-bench -t copy -w S0:100MB:1-0:S0,1:S1\n"); \
+    printf("# Measure the memory latency with four independent pointer chains per thread\n"); \
+    printf("likwid-bench -t latency_mlp4 -w S0:1GB:1 -L 64:random\n"); \
+    printf("# Gather doubles through a fully random index vector with AVX2\n"); \
+    printf("likwid-bench -t gather_avx -w S0:1GB:1 -I random\n"); \
+    printf("# Run the 3D 7-point Jacobi stencil on a 400x400x400 grid with wavefront temporal blocking\n"); \
+    printf("likwid-bench -t jacobi3d7pt -w S0:1GB:4 -G 400x400x400 -T\n"); \
+    printf("# Find the best triad variant for the socket and store it as profile triad_s0\n"); \
+    printf("likwid-bench -A triad -w S0:1GB -P triad_s0\n"); \
+    printf("# Measure the latency on one core while the other cores of the socket run copy as load\n"); \
+    printf("likwid-bench -w S0:1GB:1:kernel=latency:role=victim -w S0:4GB:7:1:1-0:S0,1:S0:kernel=copy_avx\n"); \
 /*    printf("-c <COMP_LIST>\t Specify a list of compilers that should be searched for. default: gcc,icc,pgcc\n"); \*/
 /*    printf("-f <COMP_FLAGS>\t Specify compiler flags. Use \". default: \"-shared -fPIC\"\n"); \*/
 
@@ -129,6 +164,284 @@ void illhandler(int signum, siginfo_t *info, void *ptr)
 }
 
 
+static TestCase*
+findTestcase(bstring name, char* compilepath, char* compilers, char* compileflags)
+{
+    int i;
+    TestCase* t = NULL;
+
+    for (i=0; i<NUMKERNELS; i++)
+    {
+        if (biseqcstr(name, kernels[i].name))
+        {
+            return (TestCase*)kernels+i;
+        }
+    }
+    t = (TestCase*)stencil_getTest(name);
+    if (t == NULL && dynbench_test(name))
+    {
+        if (dynbench_load(name, &t, compilepath, compilers, compileflags) != 0)
+        {
+            dynbench_close(t, compilepath);
+            t = NULL;
+        }
+    }
+    return t;
+}
+
+static int
+compareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double
+samplePercentile(const double* sorted, uint64_t count, double p)
+{
+    uint64_t idx = (uint64_t)ceil(p * count);
+    return sorted[(idx > 0 ? idx - 1 : 0)];
+}
+
+static void
+printSamples(int numberOfThreads, bstring HLINE, const char* filename)
+{
+    int t;
+    uint64_t b;
+    uint64_t total = 0;
+    uint64_t numAll = 0;
+    double* all = NULL;
+    FILE* fp = NULL;
+    double freq = bench_timestampFrequency();
+
+    for (t = 0; t < numberOfThreads; t++)
+    {
+        if (threads_data[t].data.num_samples > 1)
+            total += threads_data[t].data.num_samples - 1;
+    }
+    if (total == 0 || freq <= 0)
+    {
+        return;
+    }
+    all = (double*) malloc(total * sizeof(double));
+    if (!all)
+    {
+        fprintf(stderr, "Error: Cannot allocate memory for the block runtimes\n");
+        return;
+    }
+    if (filename)
+    {
+        fp = fopen(filename, "w");
+        if (!fp)
+        {
+            fprintf(stderr, "Error: Cannot open file %s: %s\n", filename, strerror(errno));
+        }
+        else
+        {
+            fprintf(fp, "# thread,hwthread,group,block,iterations,cycles,time[us]\n");
+        }
+    }
+
+    printf(bdata(HLINE));
+    printf("Block runtimes in us (%u iterations per block)\n", threads_data[0].data.sample_block);
+    printf("Thread\tHWThread\tBlocks\tMin\t\tMedian\t\tp99\t\tMax\n");
+    for (t = 0; t < numberOfThreads; t++)
+    {
+        ThreadUserData* d = &threads_data[t].data;
+        int cpu = d->processors[threads_data[t].threadId];
+        uint64_t n = 0;
+        uint64_t count = 0;
+        double* v = all + numAll;
+        if (d->num_samples < 2)
+            continue;
+        n = d->num_samples - 1;
+        for (b = 0; b < n; b++)
+        {
+            uint64_t ticks = d->samples[b+1] - d->samples[b];
+            uint64_t iters = d->iter - (b * d->sample_block);
+            iters = (iters < d->sample_block ? iters : d->sample_block);
+            v[b] = 1.0E06 * ((double)ticks / freq);
+            if (fp)
+            {
+                fprintf(fp, "%d,%d,%d,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.3f\n",
+                        t, cpu, threads_data[t].groupId, b, iters, ticks, v[b]);
+            }
+        }
+        /* A partial last block is written to the file but not used in the statistics */
+        count = ((d->iter % d->sample_block) == 0 || n == 1 ? n : n - 1);
+        qsort(v, count, sizeof(double), compareDouble);
+        printf("%d\t%d\t\t%" PRIu64 "\t%e\t%e\t%e\t%e\n", t, cpu, count,
+                v[0], samplePercentile(v, count, 0.5), samplePercentile(v, count, 0.99), v[count-1]);
+        numAll += count;
+    }
+    if (numAll > 0)
+    {
+        qsort(all, numAll, sizeof(double), compareDouble);
+        printf("All\t-\t\t%" PRIu64 "\t%e\t%e\t%e\t%e\n", numAll,
+                all[0], samplePercentile(all, numAll, 0.5), samplePercentile(all, numAll, 0.99), all[numAll-1]);
+    }
+    if (fp)
+    {
+        printf("Block runtimes written to %s\n", filename);
+        fclose(fp);
+    }
+    free(all);
+}
+
+/* Size of the largest data cache that is private to a core */
+static uint64_t
+stencilCacheSize(void)
+{
+    CpuTopology_t topo = get_cpuTopology();
+    uint64_t size = 0;
+    uint32_t i;
+
+    for (i = 0; i < topo->numCacheLevels; i++)
+    {
+        CacheLevel* c = &topo->cacheLevels[i];
+        if (c->type != INSTRUCTIONCACHE && c->threads <= topo->numThreadsPerCore && c->size > size)
+        {
+            size = c->size;
+        }
+    }
+    return size;
+}
+
+/* Report the lattice site updates and whether the layer condition is
+ * fulfilled in each cache level. A single sweep needs three layers of the
+ * source grid in the per-core share of a cache, the wavefront needs the
+ * layers of all time steps in a shared cache. */
+static void
+printStencil(const TestCase* test, const StencilGrid* grid, int numberOfThreads, uint64_t updates, double time, bstring HLINE)
+{
+    CpuTopology_t topo = get_cpuTopology();
+    int lastLevel = 0;
+    uint32_t i;
+
+    printf(bdata(HLINE));
+    if (test->stencil == STENCIL_2D5PT)
+        printf("Grid:\t\t\t%llux%llu\n", LLU_CAST grid->nx, LLU_CAST grid->ny);
+    else
+        printf("Grid:\t\t\t%llux%llux%llu\n", LLU_CAST grid->nx, LLU_CAST grid->ny, LLU_CAST grid->nz);
+    printf("Grid size (Byte):\t%llu\n",
+            LLU_CAST (2 * grid->nx * grid->ny * grid->nz * sizeof(double)));
+    if (grid->block > 0)
+        printf("Blocking:\t\t%llu (%s)\n", LLU_CAST grid->block, (test->stencil == STENCIL_2D5PT ? "x" : "y"));
+    else
+        printf("Blocking:\t\tnone\n");
+    if (grid->wavefront)
+        printf("Temporal blocking:\twavefront, %d time steps per iteration\n", numberOfThreads);
+    else
+        printf("Temporal blocking:\tnone\n");
+    for (i = 0; i < topo->numCacheLevels; i++)
+    {
+        CacheLevel* c = &topo->cacheLevels[i];
+        int shared = (c->threads > topo->numThreadsPerCore);
+        uint64_t cacheSize = c->size;
+        int layers = 3;
+        int lc = 0;
+        if (c->type == INSTRUCTIONCACHE)
+            continue;
+        if (grid->wavefront && shared)
+        {
+            layers = 2 * (2 * numberOfThreads + 1);
+        }
+        else if (shared)
+        {
+            cacheSize = ((uint64_t)c->size * topo->numThreadsPerCore) / c->threads;
+        }
+        lc = stencil_layerCondition(test, grid, layers, cacheSize);
+        printf("Layer condition L%d:\t%s\n", c->level, (lc ? "fulfilled" : "violated"));
+        lastLevel = lc;
+    }
+    printf("Lattice updates:\t%llu\n", LLU_CAST updates);
+    printf("MLUP/s:\t\t\t%.2f\n", 1.0E-06 * ((double)updates / time));
+    /* Load, store and write-allocate per update if the layer condition is
+     * fulfilled in the last level cache, two more layers otherwise */
+    printf("Bytes per LUP (model):\t%d\n", (lastLevel ? 24 : 40));
+}
+
+static void
+printGroupResults(Workgroup* groups, int numberOfWorkgroups, uint64_t cyclesClock, bstring HLINE)
+{
+    int i, j;
+    const char* roles[] = {"-", "independent", "victim", "load"};
+    double clock = (double)(cyclesClock > 0 ? cyclesClock : timer_getCpuClock());
+
+    for (i = 0; i < numberOfWorkgroups; i++)
+    {
+        const TestCase* t = groups[i].test;
+        uint64_t maxCycles = 0;
+        uint64_t soloCycles = 0;
+        uint64_t sumCycles = 0;
+        uint64_t sumSoloCycles = 0;
+        uint64_t elements = 0;
+        uint64_t iterations = 0;
+        double time = 0.0;
+
+        for (j = 0; j < threads_groups[i].numberOfThreads; j++)
+        {
+            ThreadData* td = &threads_data[threads_groups[i].threadIds[j]];
+            if (td->cycles > maxCycles)
+                maxCycles = td->cycles;
+            if (td->data.solo_cycles > soloCycles)
+                soloCycles = td->data.solo_cycles;
+            sumCycles += td->cycles;
+            sumSoloCycles += td->data.solo_cycles;
+            iterations += td->data.iter;
+            elements += td->data.iter * td->data.size;
+        }
+        time = (double)maxCycles / clock;
+
+        printf(bdata(HLINE));
+        printf("Group:\t\t\t%d\n", i);
+        printf("Test:\t\t\t%s\n", t->name);
+        printf("Role:\t\t\t%s\n", roles[groups[i].role]);
+        printf("Threads:\t\t%d\n", groups[i].numberOfThreads);
+        printf("Cycles:\t\t\t%" PRIu64 "\n", maxCycles);
+        printf("Time:\t\t\t%e sec\n", time);
+        printf("Iterations:\t\t%" PRIu64 "\n", iterations);
+        printf("Size (Byte):\t\t%" PRIu64 "\n",
+                (uint64_t)groups[i].size * allocator_dataTypeLength(t->type) * t->streams);
+        if (time > 0)
+        {
+            printf("MFlops/s:\t\t%.2f\n", 1.0E-06 * ((double)(elements * t->flops) / time));
+            printf("MByte/s:\t\t%.2f\n", 1.0E-06 * ((double)(elements * t->bytes) / time));
+        }
+        if (t->chains > 0 && elements > 0)
+        {
+            double chainAccesses = (double)elements / t->chains;
+            printf("Latency (ns):\t\t%.2f\n", 1.0E09 * ((double)sumCycles / clock) / chainAccesses);
+            printf("Latency (cycles):\t%.2f\n", (double)sumCycles / chainAccesses);
+        }
+        if (t->stencil != STENCIL_NONE && time > 0)
+        {
+            printf("MLUP/s:\t\t\t%.2f\n", 1.0E-06 * ((double)elements / time));
+        }
+        if (t->index_stream >= 0 && maxCycles > 0 && time > 0)
+        {
+            printf("Elements per cycle:\t%.3f\n",
+                    (double)elements / groups[i].numberOfThreads / (double)maxCycles);
+            printf("Effective MByte/s:\t%.2f\n",
+                    1.0E-06 * ((double)(elements * allocator_dataTypeLength(t->type)) / time));
+        }
+        if (groups[i].role == GROUP_VICTIM && soloCycles > 0)
+        {
+            double soloTime = (double)soloCycles / clock;
+            printf("Solo time:\t\t%e sec\n", soloTime);
+            printf("Solo MByte/s:\t\t%.2f\n", 1.0E-06 * ((double)(elements * t->bytes) / soloTime));
+            if (t->chains > 0 && elements > 0)
+            {
+                double chainAccesses = (double)elements / t->chains;
+                printf("Solo latency (ns):\t%.2f\n", 1.0E09 * ((double)sumSoloCycles / clock) / chainAccesses);
+            }
+            printf("Slowdown:\t\t%.2f\n", (double)maxCycles / (double)soloCycles);
+            printf("Degradation:\t\t%.1f %%\n", 100.0 * (1.0 - ((double)soloCycles / (double)maxCycles)));
+        }
+    }
+}
+
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
 
 int main(int argc, char** argv)
@@ -149,6 +462,10 @@ int main(int argc, char** argv)
     double cycPerUp = 0.0;
     double cycPerCL = 0.0;
     TestCase* test = NULL;
+    const TestCase* gtest = NULL;
+    int groupsWithKernel = 0;
+    int heterogeneous = 0;
+    int numberOfVictims = 0;
     uint64_t realSize = 0;
     uint64_t realIter = 0;
     uint64_t maxCycles = 0;
@@ -159,6 +476,22 @@ int main(int argc, char** argv)
     Workgroup* currentWorkgroup = NULL;
     Workgroup* groups = NULL;
     uint32_t min_runtime = 1; /* 1s */
+    int chainStride = 0;
+    uint32_t sampleBlock = 0;
+    char* sampleFile = NULL;
+    ChainPolicy chainPolicy = CHAIN_RANDOM;
+    IndexPattern indexPattern = INDEX_CONTIGUOUS;
+    int indexParam = 0;
+    char* indexFile = NULL;
+    int* indexList = NULL;
+    uint64_t indexListLen = 0;
+    StencilGrid stencilGrid;
+    int stencilAutoBlock = 1;
+    uint64_t stencilCache = 0;
+    bstring autotuneOp = NULL;
+    DataType autotuneType = DOUBLE;
+    bstring profileName = NULL;
+    struct bstrList* workgroupArgs = bstrListCreate();
     bstring HLINE = bfromcstr("");
     binsertch(HLINE, 0, 80, '-');
     binsertch(HLINE, 80, 1, '\n');
@@ -174,6 +507,7 @@ int main(int argc, char** argv)
     char compileflags[512] = "-shared -fPIC";
     ownprintf = &printf;
     struct sigaction sig;
+    memset(&stencilGrid, 0, sizeof(StencilGrid));
 
     /* Handling of command line options */
     if (argc ==  1)
@@ -182,7 +516,7 @@ int main(int argc, char** argv)
         exit(EXIT_SUCCESS);
     }
 
-    while ((c = getopt (argc, argv, "W:w:t:s:l:aphvi:f:o:")) != -1) {
+    while ((c = getopt (argc, argv, "W:w:t:s:l:aphvi:f:o:L:j:J:I:G:B:TA:P:")) != -1) {
         switch (c)
         {
             case 'f':
@@ -197,13 +531,35 @@ int main(int argc, char** argv)
                 asmFile = bfromcstr(optarg);
                 saveAsm = 1;
                 break;
+            case 'A':
+                bdestroy(autotuneOp);
+                autotuneOp = bfromcstr(optarg);
+                tmp = bstrrchr(autotuneOp, ':');
+                if (tmp != BSTR_ERR)
+                {
+                    if (strcmp(bdataofs(autotuneOp, tmp+1), "sp") == 0)
+                    {
+                        autotuneType = SINGLE;
+                    }
+                    else if (strcmp(bdataofs(autotuneOp, tmp+1), "dp") != 0)
+                    {
+                        fprintf (stderr, "Error: Unknown precision %s for auto-tuning. Use dp or sp\n", bdataofs(autotuneOp, tmp+1));
+                        return EXIT_FAILURE;
+                    }
+                    btrunc(autotuneOp, tmp);
+                }
+                break;
+            case 'P':
+                bdestroy(profileName);
+                profileName = bfromcstr(optarg);
+                break;
             default:
                 break;
         }
     }
     optind = 0;
 
-    while ((c = getopt (argc, argv, "W:w:t:s:l:aphvi:f:o:")) != -1) {
+    while ((c = getopt (argc, argv, "W:w:t:s:l:aphvi:f:o:L:j:J:I:G:B:TA:P:")) != -1) {
         switch (c)
         {
             case 'h':
@@ -214,6 +570,7 @@ int main(int argc, char** argv)
                 exit (EXIT_SUCCESS);
             case 'a':
                 ownprintf(TESTS"\n");
+                stencil_printTests();
 
                 struct bstrList* l = dynbench_getall();
                 if (l)
@@ -238,6 +595,13 @@ int main(int argc, char** argv)
             case 'w':
             case 'W':
                 numberOfWorkgroups++;
+                if (strstr(optarg, ":kernel=") != NULL)
+                {
+                    groupsWithKernel++;
+                }
+                bstring warg = bformat("-%c %s", c, optarg);
+                bstrListAdd(workgroupArgs, warg);
+                bdestroy(warg);
                 break;
             case 's':
                 min_runtime = atoi(optarg);
@@ -262,6 +626,10 @@ int main(int argc, char** argv)
                         break;
                     }
                 }
+                if (test == NULL)
+                {
+                    test = (TestCase*)stencil_getTest(testcase);
+                }
 
                 if (test == NULL && dynbench_test(testcase))
                 {
@@ -333,6 +701,14 @@ int main(int argc, char** argv)
                     {
                         ownprintf("Loop micro Ops (\u03BCOPs): %d\n",test->uops);
                     }
+                    if (test->chains > 0)
+                    {
+                        ownprintf("Pointer chains per thread: %d\n",test->chains);
+                    }
+                    if (test->index_stream >= 0)
+                    {
+                        ownprintf("Index stream: %d (32 bit integer)\n",test->index_stream);
+                    }
                 }
                 bdestroy(testcase);
                 if (!builtin)
@@ -363,6 +739,10 @@ int main(int argc, char** argv)
                         break;
                     }
                 }
+                if (test == NULL)
+                {
+                    test = (TestCase*)stencil_getTest(testcase);
+                }
 
                 if (test == NULL && dynbench_test(testcase))
                 {
@@ -391,8 +771,135 @@ int main(int argc, char** argv)
                 }
                 bdestroy(testcase);
                 break;
+            case 'j':
+                tmp = atoi(optarg);
+                if (tmp <= 0)
+                {
+                    fprintf (stderr, "Error: Iterations per timestamp must be greater than 0\n");
+                    return EXIT_FAILURE;
+                }
+                sampleBlock = tmp;
+                break;
+            case 'J':
+                sampleFile = optarg;
+                break;
+            case 'L':
+                {
+                    char* policy = NULL;
+                    chainStride = (int)strtol(optarg, &policy, 10);
+                    if (chainStride <= 0 || chainStride % sizeof(void*))
+                    {
+                        fprintf (stderr, "Error: Chain stride must be a positive multiple of %lu Byte\n", sizeof(void*));
+                        return EXIT_FAILURE;
+                    }
+                    if (policy && *policy == ':')
+                    {
+                        policy++;
+                        if (strcmp(policy, "random") == 0)
+                            chainPolicy = CHAIN_RANDOM;
+                        else if (strcmp(policy, "page") == 0)
+                            chainPolicy = CHAIN_PAGE;
+                        else if (strcmp(policy, "linear") == 0)
+                            chainPolicy = CHAIN_LINEAR;
+                        else
+                        {
+                            fprintf (stderr, "Error: Unknown chain policy %s. Use random, page or linear\n", policy);
+                            return EXIT_FAILURE;
+                        }
+                    }
+                    else if (policy && *policy != '\0')
+                    {
+                        fprintf (stderr, "Error: Cannot parse chain layout %s\n", optarg);
+                        return EXIT_FAILURE;
+                    }
+                }
+                break;
+            case 'I':
+                {
+                    char* arg = strchr(optarg, ':');
+                    size_t len = (arg ? (size_t)(arg - optarg) : strlen(optarg));
+                    if (arg)
+                    {
+                        arg++;
+                    }
+                    if (len == strlen("contiguous") && strncmp(optarg, "contiguous", len) == 0 && !arg)
+                    {
+                        indexPattern = INDEX_CONTIGUOUS;
+                    }
+                    else if (len == strlen("random") && strncmp(optarg, "random", len) == 0 && !arg)
+                    {
+                        indexPattern = INDEX_RANDOM;
+                    }
+                    else if (len == strlen("stride") && strncmp(optarg, "stride", len) == 0)
+                    {
+                        indexPattern = INDEX_STRIDE;
+                        indexParam = (arg ? atoi(arg) : 0);
+                    }
+                    else if (len == strlen("block") && strncmp(optarg, "block", len) == 0)
+                    {
+                        indexPattern = INDEX_BLOCKED;
+                        indexParam = (arg ? atoi(arg) : 0);
+                    }
+                    else if (len == strlen("file") && strncmp(optarg, "file", len) == 0 && arg && *arg != '\0')
+                    {
+                        indexPattern = INDEX_FILE;
+                        indexFile = arg;
+                    }
+                    else
+                    {
+                        fprintf (stderr, "Error: Unknown index pattern %s. Use contiguous, stride[:<ELEMS>], block[:<ELEMS>], random or file:<FILE>\n", optarg);
+                        return EXIT_FAILURE;
+                    }
+                    if ((indexPattern == INDEX_STRIDE || indexPattern == INDEX_BLOCKED) && arg && indexParam <= 0)
+                    {
+                        fprintf (stderr, "Error: Index stride or block size must be greater than 0\n");
+                        return EXIT_FAILURE;
+                    }
+                }
+                break;
+            case 'G':
+                {
+                    unsigned long long nx = 0, ny = 0, nz = 0;
+                    int n = sscanf(optarg, "%llux%llux%llu", &nx, &ny, &nz);
+                    if (n < 2 || nx == 0 || ny == 0 || (n == 3 && nz == 0))
+                    {
+                        fprintf (stderr, "Error: Cannot parse grid size %s. Use <NX>x<NY>[x<NZ>]\n", optarg);
+                        return EXIT_FAILURE;
+                    }
+                    stencilGrid.nx = nx;
+                    stencilGrid.ny = ny;
+                    stencilGrid.nz = (n == 3 ? nz : 0);
+                }
+                break;
+            case 'B':
+                if (strcmp(optarg, "auto") == 0)
+                {
+                    stencilAutoBlock = 1;
+                }
+                else if (strcmp(optarg, "none") == 0)
+                {
+                    stencilAutoBlock = 0;
+                    stencilGrid.block = 0;
+                }
+                else
+                {
+                    char* end = NULL;
+                    stencilGrid.block = strtoull(optarg, &end, 10);
+                    if (stencilGrid.block == 0 || (end && *end != '\0'))
+                    {
+                        fprintf (stderr, "Error: Block size must be greater than 0, auto or none\n");
+                        return EXIT_FAILURE;
+                    }
+                    stencilAutoBlock = 0;
+                }
+                break;
+            case 'T':
+                stencilGrid.wavefront = 1;
+                break;
             case 'o':
             case 'f':
+            case 'A':
+            case 'P':
                 break;
             case '?':
                 if (isprint (optopt))
@@ -411,6 +918,49 @@ int main(int argc, char** argv)
         fprintf(stderr, "Error: At least one workgroup (-w) must be set on commandline\n");
         exit (EXIT_FAILURE);
     }
+    if (autotuneOp)
+    {
+        if (test != NULL || groupsWithKernel > 0)
+        {
+            fprintf(stderr, "Error: Auto-tuning (-A) cannot be combined with -t or per-workgroup kernels\n");
+            exit (EXIT_FAILURE);
+        }
+        tmp = autotune_run(autotuneOp, autotuneType, workgroupArgs, min_runtime, compilepath, profileName);
+        bdestroy(autotuneOp);
+        bdestroy(profileName);
+        bstrListDestroy(workgroupArgs);
+        bdestroy(HLINE);
+        bdestroy(asmFile);
+        return (tmp == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    bstrListDestroy(workgroupArgs);
+    if (profileName)
+    {
+        if (test != NULL)
+        {
+            fprintf(stderr, "Error: A profile (-P) cannot be combined with -t\n");
+            exit (EXIT_FAILURE);
+        }
+        bstring kernel = autotune_readProfile(profileName);
+        if (kernel)
+        {
+            if (strlen(compilepath) == 0)
+            {
+                snprintf(compilepath, 512, "%s", defcompilepath);
+            }
+            test = findTestcase(kernel, compilepath, compilers, compileflags);
+            if (test == NULL)
+            {
+                fprintf(stderr, "Error: Unknown test case %s in profile %s\n", bdata(kernel), bdata(profileName));
+            }
+            bdestroy(kernel);
+        }
+        bdestroy(profileName);
+        if (test == NULL)
+        {
+            exit (EXIT_FAILURE);
+        }
+    }
 
     if (topology_init() != EXIT_SUCCESS)
     {
@@ -418,7 +968,7 @@ int main(int argc, char** argv)
         exit(EXIT_FAILURE);
     }
 
-    if ((test == NULL) && (!optPrintDomains))
+    if ((test == NULL) && (!optPrintDomains) && (groupsWithKernel < numberOfWorkgroups))
     {
         fprintf(stderr, "Unknown test case. Please check likwid-bench -a for available tests\n");
         fprintf(stderr, "and select one using the -t commandline option\n");
@@ -453,13 +1003,41 @@ int main(int argc, char** argv)
         exit (EXIT_SUCCESS);
     }
 
+    if (chainStride == 0)
+    {
+        chainStride = (clsize > 0 ? clsize : 64);
+    }
+    /* Default to one cache line of doubles for strided and one page for
+     * blocked indices */
+    if (indexParam == 0 && indexPattern == INDEX_STRIDE)
+    {
+        indexParam = 8;
+    }
+    else if (indexParam == 0 && indexPattern == INDEX_BLOCKED)
+    {
+        indexParam = 512;
+    }
+    if (indexFile && allocator_readIndexFile(indexFile, &indexList, &indexListLen) != 0)
+    {
+        exit(EXIT_FAILURE);
+    }
+    if (stencilAutoBlock)
+    {
+        stencilCache = stencilCacheSize();
+    }
+    if (stencilGrid.wavefront && numberOfWorkgroups > 1)
+    {
+        fprintf(stderr, "Error: Wavefront temporal blocking (-T) requires a single workgroup\n");
+        exit(EXIT_FAILURE);
+    }
+
     allocator_init(numberOfWorkgroups * MAX_STREAMS);
     groups = (Workgroup*) malloc(numberOfWorkgroups*sizeof(Workgroup));
     memset(groups, 0, numberOfWorkgroups*sizeof(Workgroup));
     tmp = 0;
 
     optind = 0;
-    while ((c = getopt (argc, argv, "W:w:t:s:l:i:aphvf:o:")) != -1)
+    while ((c = getopt (argc, argv, "W:w:t:s:l:i:aphvf:o:L:j:J:I:G:B:TA:P:")) != -1)
     {
         switch (c)
         {
@@ -471,26 +1049,71 @@ int main(int argc, char** argv)
                 {
                     currentWorkgroup->init_per_thread = 1;
                 }
-                i = bstr_to_workgroup(currentWorkgroup, groupstr, test->type, test->streams);
+                if (bstr_to_workgroupOptions(currentWorkgroup, groupstr) != 0)
+                {
+                    exit(EXIT_FAILURE);
+                }
+                currentWorkgroup->test = test;
+                if (currentWorkgroup->kernel)
+                {
+                    currentWorkgroup->test = NULL;
+                    for (j = 0; j < tmp; j++)
+                    {
+                        if (groups[j].kernel && bstrcmp(groups[j].kernel, currentWorkgroup->kernel) == BSTR_OK)
+                        {
+                            currentWorkgroup->test = groups[j].test;
+                            break;
+                        }
+                    }
+                    if (currentWorkgroup->test == NULL)
+                    {
+                        if (strlen(compilepath) == 0)
+                        {
+                            snprintf(compilepath, 512, "%s", defcompilepath);
+                        }
+                        currentWorkgroup->test = findTestcase(currentWorkgroup->kernel, compilepath, compilers, compileflags);
+                    }
+                    if (currentWorkgroup->test == NULL)
+                    {
+                        fprintf (stderr, "Error: Unknown test case %s for workgroup %d\n", bdata(currentWorkgroup->kernel), tmp);
+                        return EXIT_FAILURE;
+                    }
+                }
+                gtest = currentWorkgroup->test;
+                i = bstr_to_workgroup(currentWorkgroup, groupstr, gtest->type, gtest->streams);
                 bdestroy(groupstr);
+                if (i == 0 && gtest->stencil != STENCIL_NONE)
+                {
+                    /* The grid replaces the vector length of the workgroup */
+                    currentWorkgroup->grid = stencilGrid;
+                    if (stencil_setupGrid(&currentWorkgroup->grid, gtest, currentWorkgroup->size,
+                                          stencilCache, stencilAutoBlock) != 0)
+                    {
+                        allocator_finalize();
+                        workgroups_destroy(&groups, numberOfWorkgroups);
+                        exit(EXIT_FAILURE);
+                    }
+                    currentWorkgroup->size = currentWorkgroup->grid.nx * currentWorkgroup->grid.ny *
+                                             currentWorkgroup->grid.nz;
+                }
                 size_t newsize = 0;
-                size_t stride = test->stride;
+                size_t stride = gtest->stride;
                 int nrThreads = currentWorkgroup->numberOfThreads;
                 int clsize = 128;
                 size_t orig_size = currentWorkgroup->size;
                 if (i == 0)
                 {
                     int warn_once = 1;
-                    for (i=0; i<  test->streams; i++)
+                    for (i=0; i<  gtest->streams; i++)
                     {
-                        if (currentWorkgroup->streams[i].offset%test->stride)
+                        if (currentWorkgroup->streams[i].offset%gtest->stride)
                         {
                             fprintf (stderr, "Error: Stream %d: offset is not a multiple of stride!\n",i);
                             return EXIT_FAILURE;
                         }
-                        if ((int)(floor(orig_size/currentWorkgroup->numberOfThreads)) % test->stride)
+                        if ((int)(floor(orig_size/currentWorkgroup->numberOfThreads)) % gtest->stride)
                         {
-                            int typesize = allocator_dataTypeLength(test->type);
+                            int typesize = allocator_dataTypeLength(gtest->type);
                             newsize = (((size_t)(floor(orig_size/nrThreads))/stride)*(stride))*nrThreads;
                             if (newsize > 0 && warn_once)
                             {
@@ -499,17 +1122,17 @@ int main(int argc, char** argv)
                             }
                             else if (newsize == 0)
                             {
-                                int given = currentWorkgroup->size*test->streams*typesize;
-                                int each_iter = test->stride*test->bytes;
+                                int given = currentWorkgroup->size*gtest->streams*typesize;
+                                int each_iter = gtest->stride*gtest->bytes;
                                 // For the case that one stream is used for loading and storing
                                 // Cases are daxpy and update
-                                if (test->streams*typesize*test->stride < each_iter)
+                                if (gtest->streams*typesize*gtest->stride < each_iter)
                                 {
-                                    each_iter = test->streams*typesize*test->stride;
+                                    each_iter = gtest->streams*typesize*gtest->stride;
                                 }
-                                fprintf(stderr, "Error: The given vector length of %dB is too small to fit %d threads because each loop iteration of kernel '%s' requires %d Bytes (%d x %dB = %dB). So the minimal selectable size for the kernel is %dB.\n", given, nrThreads, test->name, each_iter, nrThreads, each_iter, each_iter*nrThreads, each_iter*nrThreads);
+                                fprintf(stderr, "Error: The given vector length of %dB is too small to fit %d threads because each loop iteration of kernel '%s' requires %d Bytes (%d x %dB = %dB). So the minimal selectable size for the kernel is %dB.\n", given, nrThreads, gtest->name, each_iter, nrThreads, each_iter, each_iter*nrThreads, each_iter*nrThreads);
                                 allocator_finalize();
-                                workgroups_destroy(&groups, numberOfWorkgroups, test->streams);
+                                workgroups_destroy(&groups, numberOfWorkgroups);
                                 exit(EXIT_FAILURE);
                             }
                         }
@@ -521,8 +1144,8 @@ int main(int argc, char** argv)
                                                     PAGE_ALIGNMENT,
                                                     newsize,
                                                     currentWorkgroup->streams[i].offset,
-                                                    test->type,
-                                                    test->stride,
+                                                    allocator_streamType(gtest, i),
+                                                    gtest->stride,
                                                     currentWorkgroup->streams[i].domain,
                                                     currentWorkgroup->init_per_thread && nrThreads > 1);
                     }
@@ -553,7 +1176,44 @@ int main(int argc, char** argv)
                 break;
         }
     }
-    if (numberOfWorkgroups > 1)
+    for (i=0; i<numberOfWorkgroups; i++)
+    {
+        if (groups[i].role != GROUP_SHARED || groups[i].test != test)
+        {
+            heterogeneous = 1;
+        }
+        if (groups[i].role == GROUP_VICTIM)
+        {
+            numberOfVictims += groups[i].numberOfThreads;
+        }
+    }
+    if (heterogeneous)
+    {
+        /* Workgroups run independently. If there are victim groups, all
+         * other groups become load groups */
+        for (i=0; i<numberOfWorkgroups; i++)
+        {
+            if (groups[i].role == GROUP_LOAD && numberOfVictims == 0)
+            {
+                fprintf(stderr, "Error: Load workgroups require at least one victim workgroup (role=victim)\n");
+                allocator_finalize();
+                workgroups_destroy(&groups, numberOfWorkgroups);
+                exit(EXIT_FAILURE);
+            }
+            if (groups[i].role != GROUP_VICTIM)
+            {
+                groups[i].role = (numberOfVictims > 0 ? GROUP_LOAD : GROUP_INDEPENDENT);
+            }
+            if (groups[i].test->stencil != STENCIL_NONE && groups[i].role != GROUP_INDEPENDENT)
+            {
+                fprintf(stderr, "Error: Stencil benchmarks cannot run in victim or load workgroups\n");
+                allocator_finalize();
+                workgroups_destroy(&groups, numberOfWorkgroups);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+    else if (numberOfWorkgroups > 1)
     {
         int g0_numberOfThreads = groups[0].numberOfThreads;
         int g0_size = groups[0].size;
@@ -582,7 +1242,18 @@ int main(int argc, char** argv)
 
     ownprintf(bdata(HLINE));
     ownprintf("LIKWID MICRO BENCHMARK\n");
-    ownprintf("Test: %s\n",test->name);
+    if (!heterogeneous)
+    {
+        ownprintf("Test: %s\n",test->name);
+    }
+    else
+    {
+        const char* roles[] = {"-", "independent", "victim", "load"};
+        for (i=0; i<numberOfWorkgroups; i++)
+        {
+            ownprintf("Group %d: Test: %s Role: %s\n", i, groups[i].test->name, roles[groups[i].role]);
+        }
+    }
     ownprintf(bdata(HLINE));
     ownprintf("Using %" PRIu64 " work groups\n",numberOfWorkgroups);
     ownprintf("Using %d threads\n",globalNumberOfThreads);
@@ -610,26 +1281,65 @@ int main(int argc, char** argv)
     /* initialize data structures for threads */
     for (i=0; i<numberOfWorkgroups; i++)
     {
+        gtest = groups[i].test;
         myData.iter = iter;
         if (demandIter > 0)
         {
             myData.iter = demandIter;
         }
-        myData.min_runtime = min_runtime;
+        if (groups[i].iter > 0)
+        {
+            myData.iter = groups[i].iter;
+        }
+        myData.min_runtime = (groups[i].min_runtime > 0 ? groups[i].min_runtime : min_runtime);
         myData.size = groups[i].size;
-        myData.test = test;
+        myData.test = gtest;
         myData.cycles = 0;
         myData.numberOfThreads = groups[i].numberOfThreads;
         myData.init_per_thread = groups[i].init_per_thread;
+        myData.chain_stride = chainStride;
+        myData.chain_policy = chainPolicy;
+        myData.index_pattern = indexPattern;
+        myData.index_param = indexParam;
+        myData.index_list = indexList;
+        myData.index_list_len = indexListLen;
+        myData.grid = groups[i].grid;
+        myData.role = groups[i].role;
+        myData.victims = numberOfVictims;
+        myData.solo_cycles = 0;
+        myData.sample_block = (sampleBlock == 0 && sampleFile ? 1 : sampleBlock);
+        myData.samples = NULL;
+        myData.num_samples = 0;
+        if (gtest->chains > 0)
+        {
+            uint64_t chunk = (groups[i].size / groups[i].numberOfThreads) * allocator_dataTypeLength(gtest->type);
+            uint64_t needed = allocator_chainHeader(gtest->chains, chainStride) + ((uint64_t)gtest->chains * chainStride);
+            if (chunk < needed)
+            {
+                fprintf(stderr, "Error: Workgroup %d: Each thread requires at least %llu Byte for %d pointer chains with a stride of %d Byte\n",
+                                i, LLU_CAST needed, gtest->chains, chainStride);
+                allocator_finalize();
+                workgroups_destroy(&groups, numberOfWorkgroups);
+                exit(EXIT_FAILURE);
+            }
+        }
+        if (gtest->index_stream >= (int)gtest->streams)
+        {
+            fprintf(stderr, "Error: Test %s uses stream %d as index stream but has only %d streams\n",
+                            gtest->name, gtest->index_stream, gtest->streams);
+            allocator_finalize();
+            workgroups_destroy(&groups, numberOfWorkgroups);
+            exit(EXIT_FAILURE);
+        }
         myData.processors = (int*) malloc(myData.numberOfThreads * sizeof(int));
-        myData.streams = (void**) malloc(test->streams * sizeof(void*));
+        myData.streams = (void**) malloc(gtest->streams * sizeof(void*));
 
         for (j=0; j<groups[i].numberOfThreads; j++)
         {
             myData.processors[j] = groups[i].processorIds[j];
         }
 
-        for (j=0; j<  test->streams; j++)
+        for (j=0; j<  gtest->streams; j++)
         {
             myData.streams[j] = groups[i].streams[j].ptr;
         }
@@ -640,7 +1350,23 @@ int main(int argc, char** argv)
         free(myData.streams);
     }
 
-    if (demandIter == 0)
+    if (heterogeneous)
+    {
+        /* Each workgroup determines its own iteration count, load groups
+         * run as long as the victim groups */
+        for (i=0; i<numberOfWorkgroups; i++)
+        {
+            uint64_t groupIter = (groups[i].iter > 0 ? groups[i].iter : demandIter);
+            if (groupIter == 0 && groups[i].role != GROUP_LOAD)
+            {
+                int first = threads_groups[i].threadIds[0];
+                getIterSingle((void*) &threads_data[first]);
+                groupIter = threads_data[first].data.iter;
+            }
+            threads_updateIterations(i, groupIter);
+        }
+    }
+    else if (demandIter == 0)
     {
         getIterSingle((void*) &threads_data[0]);
         for (i=0; i<numberOfWorkgroups; i++)
@@ -660,6 +1386,12 @@ int main(int argc, char** argv)
     threads_join();
     timer_stop(&itertime);
 
+    if (heterogeneous)
+    {
+        printGroupResults(groups, numberOfWorkgroups, cyclesClock, HLINE);
+        goto cleanup;
+    }
+
     for (int i=0; i<globalNumberOfThreads; i++)
     {
         realSize += threads_data[i].data.size;
@@ -776,11 +1508,83 @@ int main(int argc, char** argv)
         ownprintf("UOPs:\t\t\t%" PRIu64 "\n",
                 LLU_CAST ((double)realSize/test->stride)*test->uops*threads_data[0].data.iter);
     }
+    if (test->chains > 0)
+    {
+        /* Each kernel call performs one dependent load per element of the
+         * thread chunk, spread round-robin over the independent chains */
+        uint64_t accesses = iters_per_thread * size_per_thread;
+        uint64_t chainAccesses = accesses / test->chains;
+        const char* policies[] = {"random", "page", "linear"};
+        ownprintf(bdata(HLINE));
+        ownprintf("Chains per thread:\t%d\n", test->chains);
+        ownprintf("Chain stride (Byte):\t%d\n", chainStride);
+        ownprintf("Chain policy:\t\t%s\n", policies[chainPolicy]);
+        ownprintf("Nodes per chain:\t%" PRIu64 "\n",
+                ((size_per_thread * datatypesize) - allocator_chainHeader(test->chains, chainStride)) / chainStride / test->chains);
+        ownprintf("Accesses per thread:\t%" PRIu64 "\n", accesses);
+        ownprintf("Latency (ns):\t\t%.2f\n", 1.0E09 * time / (double)chainAccesses);
+        ownprintf("Latency (cycles):\t%.2f\n", (double)maxCycles / (double)chainAccesses);
+        ownprintf("Time per access (ns):\t%.2f\n", 1.0E09 * time / (double)accesses);
+        ownprintf("Cycles per access:\t%.2f\n", (double)maxCycles / (double)accesses);
+    }
+    if (test->index_stream >= 0)
+    {
+        /* Each element of the thread chunk is accessed once per kernel call
+         * through the index stream. The effective bandwidth counts only the
+         * indexed data elements, neither the indices nor the unused parts
+         * of the transferred cache lines */
+        uint64_t elements = iters_per_thread * realSize;
+        const char* patterns[] = {"contiguous", "stride", "block", "random", "file"};
+        ownprintf(bdata(HLINE));
+        ownprintf("Index stream:\t\t%d\n", test->index_stream);
+        if (indexPattern == INDEX_STRIDE || indexPattern == INDEX_BLOCKED)
+        {
+            ownprintf("Index pattern:\t\t%s:%d\n", patterns[indexPattern], indexParam);
+        }
+        else
+        {
+            ownprintf("Index pattern:\t\t%s\n", patterns[indexPattern]);
+        }
+        ownprintf("Indexed elements:\t%" PRIu64 "\n", elements);
+        ownprintf("Elements per cycle:\t%.3f\n",
+                (double)(iters_per_thread * size_per_thread) / (double)maxCycles);
+        ownprintf("Effective MByte/s:\t%.2f\n",
+                1.0E-06 * ((double)(elements * datatypesize) / time));
+    }
 
+    if (test->stencil != STENCIL_NONE)
+    {
+        printStencil(test, &groups[0].grid, threads_groups[0].numberOfThreads, iters_per_thread * realSize, time, HLINE);
+    }
+
+cleanup:
+    if (sampleBlock > 0 || sampleFile)
+    {
+        printSamples(globalNumberOfThreads, HLINE, sampleFile);
+    }
     ownprintf(bdata(HLINE));
-    threads_destroy(numberOfWorkgroups, test->streams);
+    for (i=0; i<globalNumberOfThreads; i++)
+    {
+        free(threads_data[i].data.samples);
+    }
+    threads_destroy(numberOfWorkgroups);
     allocator_finalize();
-    workgroups_destroy(&groups, numberOfWorkgroups, test->streams);
+    for (i=0; i<numberOfWorkgroups; i++)
+    {
+        if (groups[i].test == test)
+            continue;
+        for (j=0; j<i; j++)
+        {
+            if (groups[j].test == groups[i].test)
+                break;
+        }
+        if (j == i && groups[i].test->dlhandle != NULL)
+        {
+            dynbench_close((TestCase*)groups[i].test, compilepath);
+        }
+    }
+    workgroups_destroy(&groups, numberOfWorkgroups);
+    free(indexList);
 
 #ifdef LIKWID_PERFMON
     if (getenv("LIKWID_FILEPATH") != NULL)
@@ -790,7 +1594,7 @@ int main(int argc, char** argv)
     LIKWID_MARKER_CLOSE;
 #endif
 
-    if (test->dlhandle != NULL)
+    if (test != NULL && test->dlhandle != NULL)
     {
         dynbench_close(test, compilepath);
     }
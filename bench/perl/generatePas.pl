@@ -35,6 +35,7 @@ use File::Copy;
 use Cwd 'abs_path';
 use Data::Dumper;
 use Template;
+use ptttemplate;
 
 my @Testcases;
 my $name;
@@ -50,6 +51,12 @@ my $isLoop=0;
 my $skip=0;
 my $multi=0;
 
+my $ListTemplates = 0;
+if (@ARGV > 0 && $ARGV[0] eq '-l')
+{
+    $ListTemplates = 1;
+    shift @ARGV;
+}
 my $BenchRoot = $ARGV[0];
 my $OutputDirectory = $ARGV[1];
 my $TemplateRoot = $ARGV[2];
@@ -104,116 +111,135 @@ my $stream_lookup = {
     STR40 => '[rbp+296]'};
 
 opendir (DIR, "./$BenchRoot") or die "Cannot open bench directory: $!\n";
+my @Kernels;
+my @Variants;
+while (defined(my $file = readdir(DIR))) {
+    print "SCANNING $file\n" if ($DEBUG);
+    if ($file =~ /^([A-Za-z_0-9]+)\.ptt$/) {
+        open FILE, "<$BenchRoot/$file";
+        push(@Kernels, [$1, [<FILE>]]);
+        close FILE;
+    } elsif ($file =~ /^[A-Za-z_0-9]+\.tpl$/) {
+        push(@Variants, ptttemplate::variants("$BenchRoot/$file"));
+    }
+}
+closedir DIR;
+
+if ($ListTemplates) {
+    print join(' ', map {$_->[0]} @Variants)."\n";
+    exit 0;
+}
+push(@Kernels, @Variants);
+
 my $tpl = Template->new({
         INCLUDE_PATH => ["$TemplateRoot"]
     });
 
-while (defined(my $file = readdir(DIR))) {
-    if ($file !~ /^\./) {
-        print "SCANNING $file\n" if ($DEBUG);
-
-        $file =~ /([A-Za-z_0-9]+)\.ptt/;
-        $name = $1;
-        if ($name =~ /^$/) { continue; }
-
-        $isLoop = 0;
-        $skip=0;
-        $multi=0;
-        $prolog='';
-        $loop='';
-        $desc='';
-        $streams=1;
-        my $loads=-1;
-        my $stores=-1;
-        my $branches=-1;
-        my $instr=-1;
-        my $loop_instr=-1;
-        my $uops = -1;
-        open FILE, "<$BenchRoot/$file";
-        while (<FILE>) {
-            my $line = $_;
-
-            if($line =~ /STREAMS[ ]+([0-9]+)/) {
-                $streams = $1;
-                if ($streams > 10) {
-                    $multi = 1;
-                }
-            } elsif ($line =~ /TYPE[ ]+(SINGLE|DOUBLE|INT)/) {
-                $type = $1;
-            } elsif ($line =~ /FLOPS[ ]+([0-9]+)/) {
-                $flops = $1;
-            } elsif ($line =~ /BYTES[ ]+([0-9]+)/) {
-                $bytes = $1;
-            } elsif ($line =~ /LOADS[ ]+([0-9]+)/) {
-                $loads = $1;
-            } elsif ($line =~ /STORES[ ]+([0-9]+)/) {
-                $stores = $1;
-            } elsif ($line =~ /BRANCHES[ ]+([0-9]+)/) {
-                $branches = $1;
-            } elsif ($line =~ /INSTR_CONST[ ]+([0-9]+)/) {
-                $instr = $1;
-            } elsif ($line =~ /INSTR_LOOP[ ]+([0-9]+)/) {
-                $loop_instr = $1;
-            } elsif ($line =~ /UOPS[ ]+([0-9]+)/) {
-                $uops = $1;
-            } elsif ($line =~ /DESC[ ]+([a-zA-z ,.\-_\(\)\+\*\/=]+)/) {
-                $desc = $1;
-            } elsif ($line =~ /INC[ ]+([0-9]+)/) {
-                $increment = $1;
-                $skip = 1;
-            } elsif ($line =~ /LOOP[ ]+([0-9]+)/) {
-                $increment = $1;
-                $isLoop = 1;
-            } else {
-                if ($isLoop) {
-                    if($line =~ /SET[ ]+(STR[0-9]+)[ ]+(GPR[0-9]+)/) {
-                        $loop .= "#define $1  $2\n";
-                        $loop .= "mov $2, $stream_lookup->{$1}\n";
-                    } else {
-                        $loop .= $line;
-                    }
+foreach my $kernel (@Kernels) {
+    $name = $kernel->[0];
+
+    $isLoop = 0;
+    $skip=0;
+    $multi=0;
+    $prolog='';
+    $loop='';
+    $desc='';
+    $streams=1;
+    my $loads=-1;
+    my $stores=-1;
+    my $branches=-1;
+    my $instr=-1;
+    my $loop_instr=-1;
+    my $uops = -1;
+    my $chains = 0;
+    my $index = -1;
+    foreach my $line (@{$kernel->[1]}) {
+
+        if($line =~ /STREAMS[ ]+([0-9]+)/) {
+            $streams = $1;
+            if ($streams > 10) {
+                $multi = 1;
+            }
+        } elsif ($line =~ /TYPE[ ]+(SINGLE|DOUBLE|INT)/) {
+            $type = $1;
+        } elsif ($line =~ /FLOPS[ ]+([0-9]+)/) {
+            $flops = $1;
+        } elsif ($line =~ /BYTES[ ]+([0-9]+)/) {
+            $bytes = $1;
+        } elsif ($line =~ /LOADS[ ]+([0-9]+)/) {
+            $loads = $1;
+        } elsif ($line =~ /STORES[ ]+([0-9]+)/) {
+            $stores = $1;
+        } elsif ($line =~ /BRANCHES[ ]+([0-9]+)/) {
+            $branches = $1;
+        } elsif ($line =~ /INSTR_CONST[ ]+([0-9]+)/) {
+            $instr = $1;
+        } elsif ($line =~ /INSTR_LOOP[ ]+([0-9]+)/) {
+            $loop_instr = $1;
+        } elsif ($line =~ /UOPS[ ]+([0-9]+)/) {
+            $uops = $1;
+        } elsif ($line =~ /CHAINS[ ]+([0-9]+)/) {
+            $chains = $1;
+        } elsif ($line =~ /INDEX[ ]+([0-9]+)/) {
+            $index = $1;
+        } elsif ($line =~ /DESC[ ]+([a-zA-z0-9 ,.\-_\(\)\+\*\/=]+)/) {
+            $desc = $1;
+        } elsif ($line =~ /INC[ ]+([0-9]+)/) {
+            $increment = $1;
+            $skip = 1;
+        } elsif ($line =~ /LOOP[ ]+([0-9]+)/) {
+            $increment = $1;
+            $isLoop = 1;
+        } else {
+            if ($isLoop) {
+                if($line =~ /SET[ ]+(STR[0-9]+)[ ]+(GPR[0-9]+)/) {
+                    $loop .= "#define $1  $2\n";
+                    $loop .= "mov $2, $stream_lookup->{$1}\n";
                 } else {
-                    $prolog .= $line;
+                    $loop .= $line;
                 }
+            } else {
+                $prolog .= $line;
             }
         }
-        close FILE;
+    }
 
-        if (($streams > 5) &&  ($streams < 10)) {
-            my $arg = 7;
-            foreach my $stream ( 5 .. $streams ) {
-                $prolog .= "mov STR$stream, ARG$arg\n";
-                $arg++;
-            }
+    if (($streams > 5) &&  ($streams < 10)) {
+        my $arg = 7;
+        foreach my $stream ( 5 .. $streams ) {
+            $prolog .= "mov STR$stream, ARG$arg\n";
+            $arg++;
         }
+    }
 
-        $streams = 'STREAM_'.$streams;
-        my $Vars;
-        $Vars->{name} = $name;
-        $Vars->{prolog} = $prolog;
-        $Vars->{increment} = $increment;
-        $Vars->{loop} = $loop;
-        $Vars->{skip} = $skip;
-        $Vars->{multi} = $multi;
-        $Vars->{desc} = $desc;
+    $streams = 'STREAM_'.$streams;
+    my $Vars;
+    $Vars->{name} = $name;
+    $Vars->{prolog} = $prolog;
+    $Vars->{increment} = $increment;
+    $Vars->{loop} = $loop;
+    $Vars->{skip} = $skip;
+    $Vars->{multi} = $multi;
+    $Vars->{desc} = $desc;
 
 #print Dumper($Vars);
 
-        $tpl->process('bench.tt', $Vars, "$OutputDirectory/$name.pas");
-        push(@Testcases,{name    => $name,
-                streams => $streams,
-                type    => $type,
-                stride  => $increment,
-                flops   => $flops,
-                bytes   => $bytes,
-                desc    => $desc,
-                loads    => $loads,
-                stores    => $stores,
-                branches    => $branches,
-                instr_const    => $instr,
-                instr_loop    => $loop_instr,
-                uops    => $uops});
-    }
+    $tpl->process('bench.tt', $Vars, "$OutputDirectory/$name.pas");
+    push(@Testcases,{name    => $name,
+            streams => $streams,
+            type    => $type,
+            stride  => $increment,
+            flops   => $flops,
+            bytes   => $bytes,
+            desc    => $desc,
+            loads    => $loads,
+            stores    => $stores,
+            branches    => $branches,
+            instr_const    => $instr,
+            instr_loop    => $loop_instr,
+            uops    => $uops,
+            chains    => $chains,
+            index    => $index});
 }
 #print Dumper(@Testcases);
 my @TestcasesSorted = sort {$a->{name} cmp $b->{name}} @Testcases;
@@ -0,0 +1,210 @@
+#!/usr/bin/env perl
+# =======================================================================================
+#
+#      Filename:  ptttemplate.pm
+#
+#      Description:  Expansion of kernel templates (*.tpl) to ptt kernel variants.
+#
+#      Version:   <VERSION>
+#      Released:  <DATE>
+#
+#      Author:  Thomas Gruber (tr), thomas.roehl@googlemail.com
+#      Project:  likwid
+#
+#      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+#
+#      This program is free software: you can redistribute it and/or modify it under
+#      the terms of the GNU General Public License as published by the Free Software
+#      Foundation, either version 3 of the License, or (at your option) any later
+#      version.
+#
+#      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+#      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+#      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+#
+#      You should have received a copy of the GNU General Public License along with
+#      this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# =======================================================================================
+
+package ptttemplate;
+
+use strict;
+use warnings;
+
+# A template describes one operation for all vector widths of an ISA. Variants
+# are named <op>_<dp|sp>_v<bits>[_nt][_fma][_pf<dist>]_u<unroll>. The
+# placeholders in the code are the same as in src/ptt2asm.c which expands
+# templates on demand:
+#   %T%   type suffix (d or s)            %S%  element size in bytes
+#   %V%   vector register prefix          %O%  byte offset of the unrolled copy
+#   %Rn%  n-th register of unrolled copy  %Cn% n-th constant register
+#   %D%   prefetch distance in bytes
+# Lines prefixed with ?NT, ?!NT, ?FMA, ?!FMA, ?PF or ?!PF are only used for the
+# matching variants. Every line after LOOP is repeated once per unrolled copy.
+# The prefetch variants are only built on demand, e.g. by the auto-tuner.
+
+my %typeinfo = ( DOUBLE => { size => 8, suffix => 'd', short => 'dp', word => 'double-precision' },
+                 SINGLE => { size => 4, suffix => 's', short => 'sp', word => 'single-precision' } );
+
+sub parse
+{
+    my $file = shift;
+    my $tpl = { streams => 1, flops => 0, loads => 0, stores => 0, desc => '',
+                types => [], widths => [], unrolls => [], nt => 0, fma => 0,
+                prolog => [], body => [] };
+    my $isLoop = 0;
+
+    $file =~ /([A-Za-z_0-9]+)\.tpl$/;
+    $tpl->{op} = $1;
+    open my $fh, '<', $file or die "Cannot open template $file: $!\n";
+    while (my $line = <$fh>) {
+        chomp $line;
+        $line =~ s/^\s+|\s+$//g;
+        next if ($line eq '');
+        if ($line =~ /^STREAMS[ ]+([0-9]+)/) {
+            $tpl->{streams} = $1;
+        } elsif ($line =~ /^FLOPS[ ]+([0-9]+)/) {
+            $tpl->{flops} = $1;
+        } elsif ($line =~ /^LOADS[ ]+([0-9]+)/) {
+            $tpl->{loads} = $1;
+        } elsif ($line =~ /^STORES[ ]+([0-9]+)/) {
+            $tpl->{stores} = $1;
+        } elsif ($line =~ /^DESC[ ]+(.+)/) {
+            $tpl->{desc} = $1;
+        } elsif ($line =~ /^TYPES[ ]+(.+)/) {
+            $tpl->{types} = [ grep { exists $typeinfo{$_} } split(/\s+/, $1) ];
+        } elsif ($line =~ /^WIDTH[ ]+([0-9]+)[ ]+([a-z]+)[ ]+([0-9]+)/) {
+            push(@{$tpl->{widths}}, { bits => $1, prefix => $2, regs => $3 });
+        } elsif ($line =~ /^UNROLL[ ]+(.+)/) {
+            $tpl->{unrolls} = [ split(/\s+/, $1) ];
+        } elsif ($line =~ /^PREFETCH[ ]+(.+)/) {
+            $tpl->{prefetch} = [ split(/\s+/, $1) ];
+        } elsif ($line =~ /^NT$/) {
+            $tpl->{nt} = 1;
+        } elsif ($line =~ /^FMA$/) {
+            $tpl->{fma} = 1;
+        } elsif ($line =~ /^LOOP/) {
+            $isLoop = 1;
+        } elsif ($isLoop) {
+            push(@{$tpl->{body}}, $line);
+        } else {
+            push(@{$tpl->{prolog}}, $line);
+        }
+    }
+    close $fh;
+    return $tpl;
+}
+
+sub name
+{
+    my ($tpl, $type, $width, $nt, $fma, $unroll) = @_;
+    my $name = $tpl->{op}.'_'.$typeinfo{$type}->{short}.'_v'.$width->{bits};
+    $name .= '_nt' if ($nt);
+    $name .= '_fma' if ($fma);
+    return $name.'_u'.$unroll;
+}
+
+sub placeholder
+{
+    my ($p, $type, $width, $unroll, $u, $maxreg) = @_;
+
+    if ($p eq 'T') {
+        return $typeinfo{$type}->{suffix};
+    } elsif ($p eq 'S') {
+        return $typeinfo{$type}->{size};
+    } elsif ($p eq 'V') {
+        return $width->{prefix};
+    } elsif ($p eq 'O') {
+        return $u * $width->{bits} / 8;
+    } elsif ($p eq 'D') {
+        return 0;
+    } elsif ($p =~ /^R([0-9]+)/) {
+        $maxreg->{R} = $1 if ($1 > $maxreg->{R});
+        return $width->{prefix}.($1 * $unroll + $u);
+    }
+    $p =~ /^C([0-9]+)/;
+    $maxreg->{C} = $1 if ($1 > $maxreg->{C});
+    return $width->{prefix}.($width->{regs} - 1 - $1);
+}
+
+sub expandline
+{
+    my ($line, $type, $width, $nt, $fma, $unroll, $u, $maxreg) = @_;
+
+    if ($line =~ /^\?(!?)(NT|FMA|PF)[ ]+(.*)/) {
+        my $flag = ($2 eq 'NT' ? $nt : ($2 eq 'FMA' ? $fma : 0));
+        return undef if (($1 eq '!') == ($flag != 0));
+        $line = $3;
+    }
+    $line =~ s/%(T|S|V|O|D|R[0-9]+|C[0-9]+)%/placeholder($1, $type, $width, $unroll, $u, $maxreg)/ge;
+    return $line;
+}
+
+# Returns the lines of the ptt kernel for one variant or undef if the variant
+# needs more vector registers than the width provides.
+sub instantiate
+{
+    my ($tpl, $type, $width, $nt, $fma, $unroll) = @_;
+    my $size = $typeinfo{$type}->{size};
+    my $maxreg = { R => -1, C => -1 };
+    my @prolog;
+    my @body;
+
+    foreach my $line (@{$tpl->{prolog}}) {
+        my $l = expandline($line, $type, $width, $nt, $fma, $unroll, 0, $maxreg);
+        push(@prolog, $l) if (defined $l);
+    }
+    foreach my $line (@{$tpl->{body}}) {
+        foreach my $u (0 .. $unroll-1) {
+            my $l = expandline($line, $type, $width, $nt, $fma, $unroll, $u, $maxreg);
+            push(@body, $l) if (defined $l);
+        }
+    }
+    if (($maxreg->{R}+1)*$unroll + $maxreg->{C}+1 > $width->{regs}) {
+        return undef;
+    }
+
+    my $desc = $tpl->{desc}.', '.$typeinfo{$type}->{word}.', '.$width->{bits}.' bit vectors';
+    $desc .= ', non-temporal stores' if ($nt);
+    $desc .= ', FMA' if ($fma);
+    $desc .= ', unrolled '.$unroll.' times';
+
+    my @lines = ("STREAMS $tpl->{streams}",
+                 "TYPE $type",
+                 "FLOPS $tpl->{flops}",
+                 "BYTES ".(($tpl->{loads}+$tpl->{stores})*$size),
+                 "DESC $desc",
+                 "LOADS $tpl->{loads}",
+                 "STORES $tpl->{stores}");
+    push(@lines, @prolog);
+    push(@lines, "LOOP ".($width->{bits}/(8*$size)*$unroll));
+    push(@lines, @body);
+    return [ map { "$_\n" } @lines ];
+}
+
+# Returns all variants selected by the TYPES, WIDTH, UNROLL, NT and FMA lines
+# of the template as list of [name, lines].
+sub variants
+{
+    my $file = shift;
+    my $tpl = parse($file);
+    my @variants;
+
+    foreach my $type (@{$tpl->{types}}) {
+        foreach my $width (@{$tpl->{widths}}) {
+            foreach my $nt (0 .. $tpl->{nt}) {
+                foreach my $fma (0 .. $tpl->{fma}) {
+                    foreach my $unroll (@{$tpl->{unrolls}}) {
+                        my $lines = instantiate($tpl, $type, $width, $nt, $fma, $unroll);
+                        next unless (defined $lines);
+                        push(@variants, [name($tpl, $type, $width, $nt, $fma, $unroll), $lines]);
+                    }
+                }
+            }
+        }
+    }
+    return @variants;
+}
+
+1;
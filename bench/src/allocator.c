@@ -32,6 +32,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
 
 #include <allocator_types.h>
 #include <allocator.h>
@@ -43,6 +45,33 @@ static int numberOfAllocatedVectors = 0;
 static allocation* allocList;
 static AffinityDomains_t domains = NULL;
 
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE  ############ */
+
+static uint64_t
+chain_random(uint64_t* state)
+{
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+static void
+chain_shuffle(uint64_t* list, uint64_t n, uint64_t* state)
+{
+    uint64_t i, j, tmp;
+
+    for (i = n; i > 1; i--)
+    {
+        j = chain_random(state) % i;
+        tmp = list[i-1];
+        list[i-1] = list[j];
+        list[j] = tmp;
+    }
+}
+
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
 
 void
@@ -210,3 +239,295 @@ allocator_allocateVector(
         }
     }
 }
+
+size_t
+allocator_chainHeader(int chains, int stride)
+{
+    size_t header = chains * sizeof(void*);
+
+    if (stride > 0 && header % stride)
+    {
+        header += stride - (header % stride);
+    }
+    return header;
+}
+
+/* Build 'chains' independent, cyclic pointer-chase chains in the memory
+ * region [ptr, ptr+bytes). The region starts with a header holding the
+ * head pointer of each chain, followed by the chain nodes every 'stride'
+ * bytes. The visiting order of the nodes is determined by the policy:
+ * CHAIN_RANDOM shuffles all nodes, CHAIN_PAGE visits the pages in random
+ * order and shuffles the nodes only inside each page, CHAIN_LINEAR keeps
+ * the nodes in address order. The nodes are split into contiguous parts
+ * of the visiting order, one per chain. */
+int
+allocator_buildChains(
+        void* ptr,
+        uint64_t bytes,
+        int chains,
+        int stride,
+        ChainPolicy policy,
+        uint64_t seed)
+{
+    char* base = (char*) ptr;
+    char* nodeBase = NULL;
+    size_t header = 0;
+    uint64_t nodes = 0;
+    uint64_t* order = NULL;
+    uint64_t state = (seed + 1) * 0x9E3779B97F4A7C15ULL;
+    uint64_t i = 0, c = 0;
+
+    if (chains <= 0 || stride < (int)sizeof(void*) || stride % sizeof(void*))
+    {
+        fprintf(stderr, "Error: Invalid chain layout (%d chains, stride %d Byte). The stride must be a multiple of %lu Byte\n",
+                        chains, stride, sizeof(void*));
+        return -EINVAL;
+    }
+    header = allocator_chainHeader(chains, stride);
+    if (bytes > header)
+    {
+        nodes = (bytes - header) / stride;
+    }
+    if (nodes < (uint64_t)chains)
+    {
+        fprintf(stderr, "Error: Vector chunk of %llu Byte is too small for %d chains with a stride of %d Byte\n",
+                        LLU_CAST bytes, chains, stride);
+        return -EINVAL;
+    }
+    nodeBase = base + header;
+
+    order = (uint64_t*) malloc(nodes * sizeof(uint64_t));
+    if (!order)
+    {
+        fprintf(stderr, "Error: Insufficient memory to build pointer chains\n");
+        return -ENOMEM;
+    }
+    switch (policy)
+    {
+        case CHAIN_RANDOM:
+            for (i = 0; i < nodes; i++)
+            {
+                order[i] = i;
+            }
+            chain_shuffle(order, nodes, &state);
+            break;
+        case CHAIN_PAGE:
+            {
+                long pagesize = sysconf(_SC_PAGESIZE);
+                uint64_t perPage = (pagesize > stride ? pagesize / stride : 1);
+                uint64_t numPages = (nodes + perPage - 1) / perPage;
+                uint64_t k = 0;
+                uint64_t* pages = (uint64_t*) malloc(numPages * sizeof(uint64_t));
+                if (!pages)
+                {
+                    fprintf(stderr, "Error: Insufficient memory to build pointer chains\n");
+                    free(order);
+                    return -ENOMEM;
+                }
+                for (i = 0; i < numPages; i++)
+                {
+                    pages[i] = i;
+                }
+                chain_shuffle(pages, numPages, &state);
+                for (i = 0; i < numPages; i++)
+                {
+                    uint64_t first = k;
+                    uint64_t n;
+                    for (n = pages[i] * perPage; n < nodes && n < (pages[i] + 1) * perPage; n++)
+                    {
+                        order[k++] = n;
+                    }
+                    chain_shuffle(order + first, k - first, &state);
+                }
+                free(pages);
+            }
+            break;
+        case CHAIN_LINEAR:
+        default:
+            for (i = 0; i < nodes; i++)
+            {
+                order[i] = i;
+            }
+            break;
+    }
+
+    for (c = 0; c < (uint64_t)chains; c++)
+    {
+        uint64_t first = (c * nodes) / chains;
+        uint64_t last = ((c + 1) * nodes) / chains;
+        ((void**)base)[c] = nodeBase + order[first] * stride;
+        for (i = first; i < last; i++)
+        {
+            uint64_t next = (i + 1 < last ? order[i + 1] : order[first]);
+            *((void**)(nodeBase + order[i] * stride)) = nodeBase + next * stride;
+        }
+    }
+    free(order);
+    return 0;
+}
+
+/* The index stream of gather/scatter kernels holds 32 bit integers, all
+ * other streams use the data type of the test */
+DataType
+allocator_streamType(const TestCase* test, int stream)
+{
+    if (test->index_stream >= 0 && stream == test->index_stream)
+    {
+        return INT;
+    }
+    return test->type;
+}
+
+/* Read whitespace separated, non-negative indices from a file */
+int
+allocator_readIndexFile(const char* filename, int** list, uint64_t* len)
+{
+    FILE* fp = NULL;
+    int* l = NULL;
+    uint64_t n = 0, size = 0;
+    long long value = 0;
+    int ret = 0;
+
+    fp = fopen(filename, "r");
+    if (!fp)
+    {
+        ret = -errno;
+        fprintf(stderr, "Error: Cannot open index file %s: %s\n", filename, strerror(errno));
+        return ret;
+    }
+    while ((ret = fscanf(fp, "%lld", &value)) == 1)
+    {
+        if (value < 0 || value > INT32_MAX)
+        {
+            fprintf(stderr, "Error: Index %lld in file %s is out of range\n", value, filename);
+            free(l);
+            fclose(fp);
+            return -ERANGE;
+        }
+        if (n == size)
+        {
+            int* tmp = NULL;
+            size = (size > 0 ? 2 * size : 1024);
+            tmp = (int*) realloc(l, size * sizeof(int));
+            if (!tmp)
+            {
+                fprintf(stderr, "Error: Insufficient memory to read index file %s\n", filename);
+                free(l);
+                fclose(fp);
+                return -ENOMEM;
+            }
+            l = tmp;
+        }
+        l[n++] = (int)value;
+    }
+    fclose(fp);
+    if (ret != EOF || n == 0)
+    {
+        fprintf(stderr, "Error: Index file %s contains no or invalid indices\n", filename);
+        free(l);
+        return -EINVAL;
+    }
+    *list = l;
+    *len = n;
+    return 0;
+}
+
+/* Fill the index vector 'idx' with 'n' indices into a vector of 'range'
+ * elements. INDEX_CONTIGUOUS walks the vector in order, INDEX_STRIDE walks
+ * it with a constant stride of 'param' elements and wraps around to the
+ * next start offset so that every element is visited once, INDEX_BLOCKED
+ * shuffles the elements inside blocks of 'param' elements, INDEX_RANDOM
+ * shuffles all elements and INDEX_FILE repeats the indices in 'list'
+ * modulo 'range'. If n exceeds range, the pattern is repeated. */
+int
+allocator_buildIndex(
+        int* idx,
+        uint64_t n,
+        uint64_t range,
+        IndexPattern pattern,
+        int param,
+        const int* list,
+        uint64_t listLen,
+        uint64_t seed)
+{
+    uint64_t* order = NULL;
+    uint64_t state = (seed + 1) * 0x9E3779B97F4A7C15ULL;
+    uint64_t i = 0, k = 0;
+
+    if (range == 0 || range > INT32_MAX)
+    {
+        fprintf(stderr, "Error: Cannot address %llu elements with 32 bit indices\n", LLU_CAST range);
+        return -EINVAL;
+    }
+    if ((pattern == INDEX_STRIDE || pattern == INDEX_BLOCKED) && param <= 0)
+    {
+        fprintf(stderr, "Error: Index stride or block size must be greater than 0\n");
+        return -EINVAL;
+    }
+    if (pattern == INDEX_FILE)
+    {
+        if (!list || listLen == 0)
+        {
+            fprintf(stderr, "Error: No indices given for the file pattern\n");
+            return -EINVAL;
+        }
+        for (i = 0; i < n; i++)
+        {
+            idx[i] = (int)(list[i % listLen] % range);
+        }
+        return 0;
+    }
+
+    order = (uint64_t*) malloc(range * sizeof(uint64_t));
+    if (!order)
+    {
+        fprintf(stderr, "Error: Insufficient memory to build index stream\n");
+        return -ENOMEM;
+    }
+    switch (pattern)
+    {
+        case INDEX_STRIDE:
+            {
+                uint64_t s, j;
+                for (s = 0; s < (uint64_t)param && k < range; s++)
+                {
+                    for (j = s; j < range; j += param)
+                    {
+                        order[k++] = j;
+                    }
+                }
+            }
+            break;
+        case INDEX_BLOCKED:
+            for (i = 0; i < range; i++)
+            {
+                order[i] = i;
+            }
+            for (i = 0; i < range; i += param)
+            {
+                uint64_t len = (range - i < (uint64_t)param ? range - i : (uint64_t)param);
+                chain_shuffle(order + i, len, &state);
+            }
+            break;
+        case INDEX_RANDOM:
+            for (i = 0; i < range; i++)
+            {
+                order[i] = i;
+            }
+            chain_shuffle(order, range, &state);
+            break;
+        case INDEX_CONTIGUOUS:
+        default:
+            for (i = 0; i < range; i++)
+            {
+                order[i] = i;
+            }
+            break;
+    }
+    for (i = 0; i < n; i++)
+    {
+        idx[i] = (int)order[i % range];
+    }
+    free(order);
+    return 0;
+}
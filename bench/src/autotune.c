@@ -0,0 +1,460 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  autotune.c
+ *
+ *      Description:  Auto-tuning of unroll factor, prefetch distance and store type
+ *                    for the template kernels of likwid-bench
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+/* #####   HEADER FILE INCLUDES   ######################################### */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <bstrlib.h>
+#include <bstrlib_helper.h>
+#include <test_types.h>
+#include <ptt2asm.h>
+#include <autotune.h>
+
+/* #####   MACROS  -  LOCAL TO THIS SOURCE FILE   ######################### */
+
+#define MAX_CANDIDATES 128
+#define NUMUNROLLS 5
+
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
+
+typedef struct {
+    int bits;
+    int nt;
+    int fma;
+    int prefetch;
+    int unroll;
+} TuneConfig;
+
+typedef struct {
+    bstring name;
+    TuneConfig config;
+    int valid;
+    double mbytes;
+    double mflops;
+} TuneResult;
+
+static const int unrolls[NUMUNROLLS] = {1, 2, 4, 8, 16};
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
+
+static bstring
+variantName(const_bstring op, DataType type, TuneConfig* config)
+{
+    bstring name = bformat("%s_%s_v%d", bdata(op), (type == DOUBLE ? "dp" : "sp"), config->bits);
+    if (config->nt)
+    {
+        bcatcstr(name, "_nt");
+    }
+    if (config->fma)
+    {
+        bcatcstr(name, "_fma");
+    }
+    if (config->prefetch > 0)
+    {
+        bformata(name, "_pf%d", config->prefetch);
+    }
+    bformata(name, "_u%d", config->unroll);
+    return name;
+}
+
+static double
+lastValue(const_bstring output, const char* key)
+{
+    double value = -1.0;
+    struct bstrList* lines = bsplit(output, '\n');
+    for (int i = 0; i < lines->qty; i++)
+    {
+        if (strncmp(bdata(lines->entry[i]), key, strlen(key)) == 0)
+        {
+            value = atof(bdataofs(lines->entry[i], strlen(key)));
+        }
+    }
+    bstrListDestroy(lines);
+    return value;
+}
+
+/* Each variant runs in a separate likwid-bench process with the workgroups
+ * of the auto-tuning run, so that it gets fresh and first-touched streams
+ * and the compiled kernel is unloaded afterwards. The arguments are passed
+ * directly to execv, no shell interprets the workgroups or paths. */
+static int
+runVariant(const_bstring exe, TuneResult* res, struct bstrList* workgroups,
+           uint32_t runtime, const char* compilepath)
+{
+    char buf[1024];
+    char runtimeStr[32];
+    char (*flags)[3] = NULL;
+    char** argv = NULL;
+    int argc = 0;
+    int pipefd[2];
+    int status = 0;
+    ssize_t ret = 0;
+    pid_t pid;
+    bstring output = NULL;
+
+    argv = malloc((8 + 2 * workgroups->qty) * sizeof(char*));
+    flags = malloc((workgroups->qty + 1) * sizeof(*flags));
+    if (!argv || !flags)
+    {
+        free(argv);
+        free(flags);
+        return -1;
+    }
+    snprintf(runtimeStr, sizeof(runtimeStr), "%u", runtime);
+    argv[argc++] = bdata(exe);
+    argv[argc++] = "-t";
+    argv[argc++] = bdata(res->name);
+    argv[argc++] = "-s";
+    argv[argc++] = runtimeStr;
+    if (compilepath && strlen(compilepath) > 0)
+    {
+        argv[argc++] = "-f";
+        argv[argc++] = (char*)compilepath;
+    }
+    /* The workgroup arguments are stored as "-w <workgroup>" */
+    for (int i = 0; i < workgroups->qty; i++)
+    {
+        snprintf(flags[i], sizeof(flags[i]), "%.2s", bdata(workgroups->entry[i]));
+        argv[argc++] = flags[i];
+        argv[argc++] = bdataofs(workgroups->entry[i], 3);
+    }
+    argv[argc] = NULL;
+
+    if (pipe(pipefd) < 0)
+    {
+        free(argv);
+        free(flags);
+        return -1;
+    }
+    fflush(stdout);
+    pid = fork();
+    if (pid == 0)
+    {
+        dup2(pipefd[1], STDOUT_FILENO);
+        dup2(pipefd[1], STDERR_FILENO);
+        close(pipefd[0]);
+        close(pipefd[1]);
+        execv(argv[0], argv);
+        _exit(127);
+    }
+    close(pipefd[1]);
+    if (pid < 0)
+    {
+        close(pipefd[0]);
+        free(argv);
+        free(flags);
+        return -1;
+    }
+    output = bfromcstr("");
+    while ((ret = read(pipefd[0], buf, sizeof(buf))) != 0)
+    {
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        bcatblk(output, buf, ret);
+    }
+    close(pipefd[0]);
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR);
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+    {
+        res->mbytes = lastValue(output, "MByte/s:");
+        res->mflops = lastValue(output, "MFlops/s:");
+        res->valid = (res->mbytes >= 0);
+    }
+    bdestroy(output);
+    free(argv);
+    free(flags);
+    return res->valid ? 0 : -1;
+}
+
+static TuneResult*
+evaluate(const_bstring exe, const_bstring op, DataType type, TuneConfig* config,
+         TuneResult* results, int* numResults, struct bstrList* workgroups,
+         uint32_t runtime, const char* compilepath)
+{
+    TuneResult* res = NULL;
+    bstring name = variantName(op, type, config);
+
+    for (int i = 0; i < *numResults; i++)
+    {
+        if (bstrcmp(results[i].name, name) == BSTR_OK)
+        {
+            bdestroy(name);
+            return &results[i];
+        }
+    }
+    if (*numResults >= MAX_CANDIDATES || !dynbench_template_valid(name))
+    {
+        bdestroy(name);
+        return NULL;
+    }
+    res = &results[*numResults];
+    (*numResults)++;
+    res->name = name;
+    res->config = *config;
+    res->valid = 0;
+    res->mbytes = 0;
+    res->mflops = 0;
+    if (runVariant(exe, res, workgroups, runtime, compilepath) == 0)
+    {
+        printf("%-40s %14.2f %14.2f\n", bdata(name), res->mbytes, res->mflops);
+    }
+    else
+    {
+        printf("%-40s %14s %14s\n", bdata(name), "failed", "-");
+    }
+    fflush(stdout);
+    return res;
+}
+
+static bstring
+profilePath(const_bstring profile, int create)
+{
+    bstring path = NULL;
+    if (bstrchrp(profile, '/', 0) != BSTR_ERR)
+    {
+        return bstrcpy(profile);
+    }
+    bstring folder = dynbench_userfolder();
+    if (create)
+    {
+        /* Create $HOME/.likwid/bench/<arch> level by level */
+        for (int i = 1; i <= blength(folder); i++)
+        {
+            if (i == blength(folder) || bchar(folder, i) == '/')
+            {
+                bstring sub = bmidstr(folder, 0, i);
+                mkdir(bdata(sub), 0755);
+                bdestroy(sub);
+            }
+        }
+    }
+    path = bformat("%s/%s.profile", bdata(folder), bdata(profile));
+    bdestroy(folder);
+    return path;
+}
+
+static int
+writeProfile(const_bstring profile, const_bstring op, DataType type,
+             struct bstrList* workgroups, TuneResult* best)
+{
+    bstring path = profilePath(profile, 1);
+    FILE* fp = fopen(bdata(path), "w");
+    if (!fp)
+    {
+        int err = errno;
+        fprintf(stderr, "Error: Cannot write profile %s: %s\n", bdata(path), strerror(err));
+        bdestroy(path);
+        return -err;
+    }
+    fprintf(fp, "# likwid-bench auto-tuning profile\n");
+    fprintf(fp, "OPERATION %s\n", bdata(op));
+    fprintf(fp, "TYPE %s\n", (type == DOUBLE ? "DOUBLE" : "SINGLE"));
+    for (int i = 0; i < workgroups->qty; i++)
+    {
+        fprintf(fp, "WORKGROUP %s\n", bdata(workgroups->entry[i]));
+    }
+    fprintf(fp, "KERNEL %s\n", bdata(best->name));
+    fprintf(fp, "MBYTES %.2f\n", best->mbytes);
+    fprintf(fp, "MFLOPS %.2f\n", best->mflops);
+    fclose(fp);
+    printf("Profile written to %s\n", bdata(path));
+    bdestroy(path);
+    return 0;
+}
+
+/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+
+bstring
+autotune_readProfile(const_bstring profile)
+{
+    char buf[1024];
+    bstring kernel = NULL;
+    bstring path = profilePath(profile, 0);
+    FILE* fp = fopen(bdata(path), "r");
+    if (!fp)
+    {
+        fprintf(stderr, "Error: Cannot read profile %s: %s\n", bdata(path), strerror(errno));
+        bdestroy(path);
+        return NULL;
+    }
+    while (fgets(buf, sizeof(buf), fp) != NULL)
+    {
+        if (strncmp(buf, "KERNEL ", 7) == 0)
+        {
+            bdestroy(kernel);
+            kernel = bfromcstr(buf + 7);
+            btrimws(kernel);
+        }
+    }
+    fclose(fp);
+    if (!kernel)
+    {
+        fprintf(stderr, "Error: Profile %s contains no KERNEL line\n", bdata(path));
+    }
+    bdestroy(path);
+    return kernel;
+}
+
+/* Coordinate search: starting with the widest vectors, unroll 4 and temporal
+ * stores, each parameter is varied in turn while the others stay at their
+ * best value so far. */
+int
+autotune_run(const_bstring op, DataType type, struct bstrList* workgroups,
+             uint32_t runtime, const char* compilepath, const_bstring profile)
+{
+    char exepath[1024];
+    TemplateInfo info;
+    TuneResult results[MAX_CANDIDATES];
+    TuneResult* best = NULL;
+    TuneConfig config;
+    int numResults = 0;
+    ssize_t len = 0;
+
+    if (dynbench_template_info((bstring)op, &info) != 0)
+    {
+        return -ENOENT;
+    }
+    if ((type == DOUBLE && !info.hasDouble) || (type == SINGLE && !info.hasSingle) || info.numWidths == 0)
+    {
+        fprintf(stderr, "Error: Template %s provides no %s-precision variants\n",
+                        bdata(op), (type == DOUBLE ? "double" : "single"));
+        return -EINVAL;
+    }
+    len = readlink("/proc/self/exe", exepath, sizeof(exepath)-1);
+    if (len <= 0)
+    {
+        int err = (len < 0 ? errno : ENOENT);
+        fprintf(stderr, "Error: Cannot determine path of likwid-bench\n");
+        return -err;
+    }
+    exepath[len] = '\0';
+    bstring exe = bfromcstr(exepath);
+
+    memset(&config, 0, sizeof(TuneConfig));
+    config.bits = info.bits[info.numWidths-1];
+    config.unroll = 4;
+
+    printf("Auto-tuning %s (%s-precision), %u s per variant\n", bdata(op),
+                (type == DOUBLE ? "double" : "single"), runtime);
+    printf("%-40s %14s %14s\n", "Variant", "MByte/s", "MFlops/s");
+
+    for (int stage = 0; stage < 5; stage++)
+    {
+        int count = 0;
+        int values[TEMPLATE_MAX_WIDTHS + TEMPLATE_MAX_PREFETCH + NUMUNROLLS];
+        TuneResult* stageBest = NULL;
+        switch (stage)
+        {
+            case 0:
+                for (int i = 0; i < info.numWidths; i++)
+                    values[count++] = info.bits[i];
+                break;
+            case 1:
+                for (int i = 0; i < NUMUNROLLS; i++)
+                    values[count++] = unrolls[i];
+                break;
+            case 2:
+                values[count++] = 0;
+                if (info.nt)
+                    values[count++] = 1;
+                break;
+            case 3:
+                values[count++] = 0;
+                if (info.fma)
+                    values[count++] = 1;
+                break;
+            case 4:
+                values[count++] = 0;
+                for (int i = 0; i < info.numPrefetch; i++)
+                    values[count++] = info.prefetch[i];
+                break;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            TuneConfig c = config;
+            TuneResult* res = NULL;
+            switch (stage)
+            {
+                case 0: c.bits = values[i]; break;
+                case 1: c.unroll = values[i]; break;
+                case 2: c.nt = values[i]; break;
+                case 3: c.fma = values[i]; break;
+                case 4: c.prefetch = values[i]; break;
+            }
+            res = evaluate(exe, op, type, &c, results, &numResults, workgroups, runtime, compilepath);
+            if (res && res->valid && (!stageBest || res->mbytes > stageBest->mbytes))
+            {
+                stageBest = res;
+            }
+        }
+        if (stageBest)
+        {
+            config = stageBest->config;
+            best = stageBest;
+        }
+    }
+    bdestroy(exe);
+
+    if (!best)
+    {
+        fprintf(stderr, "Error: No variant of %s could be run\n", bdata(op));
+        for (int i = 0; i < numResults; i++)
+            bdestroy(results[i].name);
+        return -EPERM;
+    }
+    printf("--------------------------------------------------------------------------------\n");
+    printf("Best variant:\t\t%s\n", bdata(best->name));
+    printf("Variants tested:\t%d\n", numResults);
+    printf("MByte/s:\t\t%.2f\n", best->mbytes);
+    printf("MFlops/s:\t\t%.2f\n", best->mflops);
+    int err = 0;
+    if (profile && blength(profile) > 0)
+    {
+        err = writeProfile(profile, op, type, workgroups, best);
+    }
+    for (int i = 0; i < numResults; i++)
+    {
+        bdestroy(results[i].name);
+    }
+    return err;
+}
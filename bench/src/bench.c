@@ -42,6 +42,7 @@
 #include <allocator.h>
 #include <threads.h>
 #include <barrier.h>
+#include <stencil.h>
 //#include <likwid.h>
 #include <likwid-marker.h>
 
@@ -49,14 +50,40 @@
 
 #define BARRIER   barrier_synchronize(&barr)
 
+/* Upper limit of the timestamps per thread (8 MByte), the block size is
+ * raised if the iterations would need more */
+#define MAX_SAMPLES (1UL<<20)
+
+/* Take a timestamp after every block of iterations. The loop counter is
+ * only compared inside the block, the timestamps are written into the
+ * preallocated buffer of the thread. */
+#define SAMPLE_LOOP(func) \
+    myData->samples[0] = bench_timestamp(); \
+    for (i=0, j=1; i<myData->iter; j++) \
+    { \
+        for (k=0; k<myData->sample_block && i<myData->iter; k++, i++) \
+        { \
+            func; \
+        } \
+        myData->samples[j] = bench_timestamp(); \
+    } \
+    myData->num_samples = j;
+
 #define EXECUTE(func)   \
     LIKWID_MARKER_REGISTER("bench");  \
     BARRIER; \
     LIKWID_MARKER_START("bench");  \
     timer_start(&time); \
-    for (i=0; i<myData->iter; i++) \
-    {   \
-        func; \
+    if (myData->samples) \
+    { \
+        SAMPLE_LOOP(func); \
+    } \
+    else \
+    { \
+        for (i=0; i<myData->iter; i++) \
+        {   \
+            func; \
+        } \
     } \
     BARRIER; \
     timer_stop(&time); \
@@ -65,399 +92,601 @@
     BARRIER
 
 
-/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
 
-void*
-runTest(void* arg)
-{
-    int threadId;
-    size_t offset;
-    size_t size;
-    size_t vecsize;
-    size_t i;
-    size_t j = 0;
-    BarrierData barr;
-    ThreadData* data;
-    ThreadUserData* myData;
-    TimerData time;
-    FuncPrototype func;
+static volatile int victimsDone = 0;
 
-    data = (ThreadData*) arg;
-    myData = &(data->data);
-    func = myData->test->kernel;
-    threadId = data->threadId;
-    barrier_registerThread(&barr, 0, data->globalThreadId);
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE  ############ */
 
-    /* Prepare ptrs for thread */
-    vecsize = myData->size / data->numberOfThreads;
-    size = myData->size / data->numberOfThreads;
-
-    size -= (size % myData->test->stride);
-    myData->size = size;
-    offset = data->threadId * size;
-    //printf("Orig size %lu Size %lu\n", myData->size / data->numberOfThreads, size);
-    if (size != vecsize && data->threadId == 0)
-        printf("Sanitizing vector length to a multiple of the loop stride from %d elements (%d bytes) to %d elements (%d bytes)\n", vecsize, vecsize*myData->test->bytes, size, size*myData->test->bytes);
-
-    /* pin the thread */
-    likwid_pinThread(myData->processors[threadId]);
-    printf("Group: %d Thread %d Global Thread %d running on hwthread %d - Vector length %llu Offset %zd\n",
-            data->groupId,
-            threadId,
-            data->globalThreadId,
-            affinity_threadGetProcessorId(),
-            LLU_CAST size,
-            offset);
-    BARRIER;
+/* Non-serializing timestamp for the per-iteration timing. It is cheaper
+ * than timer_stop() which waits for all previous instructions. */
+static inline uint64_t
+bench_timestamp(void)
+{
+#if defined(__x86_64) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    return (((uint64_t)hi) << 32) | lo;
+#elif defined(__ARM_ARCH_8A)
+    uint64_t val;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r" (val));
+    return val;
+#elif defined(_ARCH_PPC)
+    uint64_t val;
+    __asm__ volatile("mftb %0" : "=r" (val));
+    return val;
+#else
+    TimerData t;
+    timer_stop(&t);
+    return t.stop.int64;
+#endif
+}
 
-    switch ( myData->test->type )
+static void
+initSamples(ThreadUserData* myData)
+{
+    myData->samples = NULL;
+    myData->num_samples = 0;
+    if (myData->sample_block == 0 || myData->role == GROUP_LOAD)
+        return;
+    if (myData->iter / myData->sample_block > MAX_SAMPLES)
     {
-        case SINGLE:
-            {
-                float* sptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    sptr = (float*) myData->streams[i];
-                    sptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            sptr[j] = 1.0;
-                        }
-                    }
-                    myData->streams[i] = (float*) sptr;
-                }
-            }
-            break;
-        case INT:
-            {
-                int* sptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    sptr = (int*) myData->streams[i];
-                    sptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            sptr[j] = 1;
-                        }
-                    }
-                    myData->streams[i] = (int*) sptr;
-                }
-            }
-            break;
-        case DOUBLE:
-            {
-                double* dptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    dptr = (double*) myData->streams[i];
-                    dptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            dptr[j] = 1.0;
-                        }
-                    }
-                    myData->streams[i] = (double*) dptr;
-                }
-            }
-            break;
+        myData->sample_block = (myData->iter + MAX_SAMPLES - 1) / MAX_SAMPLES;
     }
+    size_t count = (myData->iter / myData->sample_block) + 2;
+    myData->samples = (uint64_t*) malloc(count * sizeof(uint64_t));
+    if (!myData->samples)
+    {
+        fprintf(stderr, "Error: Cannot allocate buffer for %lu timestamps, use a larger block size with -j\n", count);
+        exit(EXIT_FAILURE);
+    }
+    /* Touch the buffer before the measurement */
+    memset(myData->samples, 0, count * sizeof(uint64_t));
+}
 
-    BARRIER;
-
-    /* Up to 10 streams the following registers are used for Array ptr:
-     * Size rdi
-     * in Registers: rsi  rdx  rcx  r8  r9
-     * passed on stack, then: r10  r11  r12  r13  r14  r15
-     * If more than 10 streams are used first 5 streams are in register, above 5 a macro must be used to
-     * load them from stack
-     * */
-
-    switch ( myData->test->streams ) {
+/* Up to 10 streams the following registers are used for Array ptr:
+ * Size rdi
+ * in Registers: rsi  rdx  rcx  r8  r9
+ * passed on stack, then: r10  r11  r12  r13  r14  r15
+ * If more than 10 streams are used first 5 streams are in register, above 5 a macro must be used to
+ * load them from stack
+ * */
+static void
+callKernel(FuncPrototype func, size_t size, void** s, Pattern streams)
+{
+    switch (streams)
+    {
         case STREAM_1:
-            EXECUTE(func(size,myData->streams[0]));
+            func(size,s[0]);
             break;
         case STREAM_2:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1]));
+            func(size,s[0],s[1]);
             break;
         case STREAM_3:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2]));
+            func(size,s[0],s[1],s[2]);
             break;
         case STREAM_4:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3]));
+            func(size,s[0],s[1],s[2],s[3]);
             break;
         case STREAM_5:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4]));
+            func(size,s[0],s[1],s[2],s[3],s[4]);
             break;
         case STREAM_6:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5]);
             break;
         case STREAM_7:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6]);
             break;
         case STREAM_8:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7]);
             break;
         case STREAM_9:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8]);
             break;
         case STREAM_10:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9]);
             break;
         case STREAM_11:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10]);
             break;
         case STREAM_12:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11]);
             break;
         case STREAM_13:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12]);
             break;
         case STREAM_14:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13]);
             break;
         case STREAM_15:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14]);
             break;
         case STREAM_16:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15]);
             break;
         case STREAM_17:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16]);
             break;
         case STREAM_18:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17]);
             break;
         case STREAM_19:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18]);
             break;
         case STREAM_20:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19]);
             break;
         case STREAM_21:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20]);
             break;
         case STREAM_22:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21]);
             break;
         case STREAM_23:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22]);
             break;
         case STREAM_24:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23]);
             break;
         case STREAM_25:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24]);
             break;
         case STREAM_26:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25]);
             break;
         case STREAM_27:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26]);
             break;
         case STREAM_28:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27]);
             break;
         case STREAM_29:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28]);
             break;
         case STREAM_30:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29]);
             break;
         case STREAM_31:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30]);
             break;
         case STREAM_32:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31]);
             break;
         case STREAM_33:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32]);
             break;
         case STREAM_34:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32],s[33]);
             break;
         case STREAM_35:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32],s[33],s[34]);
             break;
         case STREAM_36:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32],s[33],s[34],s[35]);
             break;
         case STREAM_37:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35],
-                        myData->streams[36]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32],s[33],s[34],s[35],s[36]);
             break;
         case STREAM_38:
-            EXECUTE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35],
-                        myData->streams[36],myData->streams[37]));
+            func(size,s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7],
+                s[8],s[9],s[10],s[11],s[12],s[13],s[14],s[15],
+                s[16],s[17],s[18],s[19],s[20],s[21],s[22],s[23],
+                s[24],s[25],s[26],s[27],s[28],s[29],s[30],s[31],
+                s[32],s[33],s[34],s[35],s[36],s[37]);
             break;
         default:
             break;
     }
+}
+
+/* Workgroups with their own kernel or iteration count stop their timer
+ * before the closing barrier. With victim groups, the victims first run
+ * alone to get a baseline, then together with the load groups which
+ * repeat their kernel until all victim threads are done. */
+static void
+runGroup(ThreadData* data, BarrierData* barr, size_t size)
+{
+    ThreadUserData* myData = &(data->data);
+    FuncPrototype func = myData->test->kernel;
+    Pattern streams = myData->test->streams;
+    TimerData time;
+    uint64_t i;
+
+    if (myData->victims > 0)
+    {
+        barrier_synchronize(barr);
+        if (myData->role == GROUP_VICTIM)
+        {
+            timer_start(&time);
+            for (i = 0; i < myData->iter; i++)
+            {
+                callKernel(func, size, myData->streams, streams);
+            }
+            timer_stop(&time);
+            myData->solo_cycles = timer_printCycles(&time);
+        }
+        barrier_synchronize(barr);
+    }
+
+    LIKWID_MARKER_REGISTER("bench");
+    barrier_synchronize(barr);
+    LIKWID_MARKER_START("bench");
+    timer_start(&time);
+    if (myData->role == GROUP_LOAD)
+    {
+        for (i = 0; victimsDone < myData->victims; i++)
+        {
+            callKernel(func, size, myData->streams, streams);
+        }
+        myData->iter = i;
+    }
+    else if (myData->samples)
+    {
+        uint64_t j, k;
+        SAMPLE_LOOP(callKernel(func, size, myData->streams, streams));
+        if (myData->role == GROUP_VICTIM)
+        {
+            __sync_add_and_fetch(&victimsDone, 1);
+        }
+    }
+    else
+    {
+        for (i = 0; i < myData->iter; i++)
+        {
+            callKernel(func, size, myData->streams, streams);
+        }
+        if (myData->role == GROUP_VICTIM)
+        {
+            __sync_add_and_fetch(&victimsDone, 1);
+        }
+    }
+    timer_stop(&time);
+    LIKWID_MARKER_STOP("bench");
+    data->cycles = timer_printCycles(&time);
+    barrier_synchronize(barr);
+}
+
+static void
+callStencil(ThreadData* data, BarrierData* barr, uint64_t first, uint64_t last)
+{
+    ThreadUserData* myData = &(data->data);
+
+    if (myData->grid.wavefront)
+    {
+        stencil_wavefront(myData->test, &myData->grid, myData->streams,
+                          data->threadId, data->numberOfThreads, barr);
+    }
+    else
+    {
+        stencil_sweep(myData->test, &myData->grid, myData->streams[0],
+                      myData->streams[1], first, last);
+    }
+}
+
+/* Stencils work on the whole grid instead of a contiguous chunk per
+ * thread. Each thread updates its part of the outermost dimension or,
+ * with wavefront temporal blocking, one time step of the whole grid. */
+static void
+runStencil(ThreadData* data, BarrierData* barr)
+{
+    ThreadUserData* myData = &(data->data);
+    TimerData time;
+    uint64_t first = 0, last = 0;
+    uint64_t i;
+
+    stencil_partition(myData->test, &myData->grid, data->threadId,
+                      data->numberOfThreads, &first, &last);
+    likwid_pinThread(myData->processors[data->threadId]);
+    barrier_synchronize(barr);
+    if (myData->init_per_thread)
+    {
+        stencil_init(myData->test, &myData->grid, myData->streams[0],
+                     myData->streams[1], first, last);
+    }
+    if (myData->grid.wavefront)
+    {
+        uint64_t all_first, all_last;
+        stencil_partition(myData->test, &myData->grid, 0, 1, &all_first, &all_last);
+        myData->size = stencil_updates(myData->test, &myData->grid, all_first, all_last);
+        printf("Group: %d Thread %d Global Thread %d running on hwthread %d - Wavefront time step %d\n",
+                data->groupId,
+                data->threadId,
+                data->globalThreadId,
+                affinity_threadGetProcessorId(),
+                data->threadId);
+    }
+    else
+    {
+        myData->size = stencil_updates(myData->test, &myData->grid, first, last);
+        printf("Group: %d Thread %d Global Thread %d running on hwthread %d - Layers %llu-%llu\n",
+                data->groupId,
+                data->threadId,
+                data->globalThreadId,
+                affinity_threadGetProcessorId(),
+                LLU_CAST first,
+                LLU_CAST (last - 1));
+    }
+    initSamples(myData);
+    barrier_synchronize(barr);
+
+    LIKWID_MARKER_REGISTER("bench");
+    barrier_synchronize(barr);
+    LIKWID_MARKER_START("bench");
+    timer_start(&time);
+    if (myData->samples)
+    {
+        uint64_t j, k;
+        SAMPLE_LOOP(callStencil(data, barr, first, last));
+    }
+    else
+    {
+        for (i = 0; i < myData->iter; i++)
+        {
+            callStencil(data, barr, first, last);
+        }
+    }
+    /* Independent workgroups stop their timer without waiting for the
+     * other workgroups, like in runGroup() */
+    if (myData->role == GROUP_SHARED)
+    {
+        barrier_synchronize(barr);
+    }
+    timer_stop(&time);
+    LIKWID_MARKER_STOP("bench");
+    data->cycles = timer_printCycles(&time);
+    barrier_synchronize(barr);
+}
+
+static void
+initStreams(ThreadData* data, size_t offset, size_t vecsize)
+{
+    ThreadUserData* myData = &(data->data);
+    size_t i, j;
+
+    for (i=0; i <  myData->test->streams; i++)
+    {
+        switch ( allocator_streamType(myData->test, i) )
+        {
+            case SINGLE:
+                {
+                    float* sptr = (float*) myData->streams[i];
+                    sptr +=  offset;
+                    if (myData->init_per_thread)
+                    {
+                        for (j = 0; j < vecsize; j++)
+                        {
+                            sptr[j] = 1.0;
+                        }
+                    }
+                    myData->streams[i] = (float*) sptr;
+                }
+                break;
+            case INT:
+                {
+                    int* sptr = (int*) myData->streams[i];
+                    sptr +=  offset;
+                    if (myData->init_per_thread)
+                    {
+                        for (j = 0; j < vecsize; j++)
+                        {
+                            sptr[j] = 1;
+                        }
+                    }
+                    myData->streams[i] = (int*) sptr;
+                }
+                break;
+            case DOUBLE:
+                {
+                    double* dptr = (double*) myData->streams[i];
+                    dptr +=  offset;
+                    if (myData->init_per_thread)
+                    {
+                        for (j = 0; j < vecsize; j++)
+                        {
+                            dptr[j] = 1.0;
+                        }
+                    }
+                    myData->streams[i] = (double*) dptr;
+                }
+                break;
+        }
+    }
+}
+
+static void
+initIndex(ThreadData* data, size_t size)
+{
+    ThreadUserData* myData = &(data->data);
+
+    if (myData->test->index_stream < 0)
+        return;
+    /* Indices are relative to the thread chunk of the data streams */
+    if (allocator_buildIndex(myData->streams[myData->test->index_stream],
+                             size,
+                             size,
+                             myData->index_pattern,
+                             myData->index_param,
+                             myData->index_list,
+                             myData->index_list_len,
+                             data->globalThreadId) < 0)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void
+initChains(ThreadData* data, size_t size)
+{
+    ThreadUserData* myData = &(data->data);
+
+    if (myData->test->chains <= 0)
+        return;
+    /* Pointer-chase kernels get their own chains in each thread chunk */
+    if (allocator_buildChains(myData->streams[0],
+                              size * allocator_dataTypeLength(myData->test->type),
+                              myData->test->chains,
+                              myData->chain_stride,
+                              myData->chain_policy,
+                              data->globalThreadId) < 0)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+
+/* Frequency of the timestamps taken by bench_timestamp() */
+double
+bench_timestampFrequency(void)
+{
+#if defined(__x86_64) || defined(__i386__)
+    return (double) timer_getCycleClock();
+#else
+    TimerData t;
+    uint64_t start = bench_timestamp();
+    timer_start(&t);
+    do {
+        timer_stop(&t);
+    } while (timer_print(&t) < 0.05);
+    return (double)(bench_timestamp() - start) / timer_print(&t);
+#endif
+}
+
+void*
+runTest(void* arg)
+{
+    int threadId;
+    size_t offset;
+    size_t size;
+    size_t vecsize;
+    size_t i;
+    size_t j = 0;
+    size_t k = 0;
+    BarrierData barr;
+    ThreadData* data;
+    ThreadUserData* myData;
+    TimerData time;
+    FuncPrototype func;
+
+    data = (ThreadData*) arg;
+    myData = &(data->data);
+    func = myData->test->kernel;
+    threadId = data->threadId;
+    barrier_registerThread(&barr, 0, data->globalThreadId);
+
+    if (myData->test->stencil != STENCIL_NONE)
+    {
+        runStencil(data, &barr);
+        free(barr.index);
+        pthread_exit(NULL);
+    }
+
+    /* Prepare ptrs for thread */
+    vecsize = myData->size / data->numberOfThreads;
+    size = myData->size / data->numberOfThreads;
+
+    size -= (size % myData->test->stride);
+    myData->size = size;
+    offset = data->threadId * size;
+    //printf("Orig size %lu Size %lu\n", myData->size / data->numberOfThreads, size);
+    if (size != vecsize && data->threadId == 0)
+        printf("Sanitizing vector length to a multiple of the loop stride from %d elements (%d bytes) to %d elements (%d bytes)\n", vecsize, vecsize*myData->test->bytes, size, size*myData->test->bytes);
+
+    /* pin the thread */
+    likwid_pinThread(myData->processors[threadId]);
+    printf("Group: %d Thread %d Global Thread %d running on hwthread %d - Vector length %llu Offset %zd\n",
+            data->groupId,
+            threadId,
+            data->globalThreadId,
+            affinity_threadGetProcessorId(),
+            LLU_CAST size,
+            offset);
+    BARRIER;
+
+    initStreams(data, offset, vecsize);
+
+    initChains(data, size);
+    initIndex(data, size);
+    initSamples(myData);
+
+    BARRIER;
+
+    if (myData->role != GROUP_SHARED)
+    {
+        runGroup(data, &barr, size);
+        free(barr.index);
+        pthread_exit(NULL);
+    }
+
+    EXECUTE(callKernel(func, size, myData->streams, myData->test->streams));
     free(barr.index);
     pthread_exit(NULL);
 }
@@ -478,6 +707,33 @@ runTest(void* arg)
             break; \
     } \
 
+/* Iteration count of a stencil sweep, a wavefront thread sweeps the whole
+ * grid in each iteration */
+static void*
+getIterStencil(ThreadData* data)
+{
+    ThreadUserData* myData = &(data->data);
+    TimerData time;
+    uint64_t first = 0, last = 0;
+    size_t i;
+    size_t iterations = 0;
+
+    if (myData->grid.wavefront)
+    {
+        stencil_partition(myData->test, &myData->grid, 0, 1, &first, &last);
+    }
+    else
+    {
+        stencil_partition(myData->test, &myData->grid, data->threadId,
+                          data->numberOfThreads, &first, &last);
+    }
+    likwid_pinThread(myData->processors[data->threadId]);
+    MEASURE(stencil_sweep(myData->test, &myData->grid, myData->streams[0],
+                          myData->streams[1], first, last));
+    data->data.iter = iterations;
+    return NULL;
+}
+
 void*
 getIterSingle(void* arg)
 {
@@ -496,6 +752,11 @@ getIterSingle(void* arg)
     func = myData->test->kernel;
     threadId = data->threadId;
 
+    if (myData->test->stencil != STENCIL_NONE)
+    {
+        return getIterStencil(data);
+    }
+
     //size = myData->size - (myData->size % myData->test->stride);
     vecsize = myData->size / data->numberOfThreads;
     size = myData->size / data->numberOfThreads;
@@ -509,344 +770,12 @@ getIterSingle(void* arg)
     printf("Automatic iteration count detection:");
 #endif
 
-    switch ( myData->test->type )
-    {
-        case SINGLE:
-            {
-                float* sptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    sptr = (float*) myData->streams[i];
-                    sptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            sptr[j] = 1.0;
-                        }
-                    }
-                    myData->streams[i] = (float*) sptr;
-                }
-            }
-            break;
-        case INT:
-            {
-                int* sptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    sptr = (int*) myData->streams[i];
-                    sptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            sptr[j] = 1;
-                        }
-                    }
-                    myData->streams[i] = (int*) sptr;
-                }
-            }
-            break;
-        case DOUBLE:
-            {
-                double* dptr;
-                for (i=0; i <  myData->test->streams; i++)
-                {
-                    dptr = (double*) myData->streams[i];
-                    dptr +=  offset;
-                    if (myData->init_per_thread)
-                    {
-                        for (j = 0; j < vecsize; j++)
-                        {
-                            dptr[j] = 1.0;
-                        }
-                    }
-                    myData->streams[i] = (double*) dptr;
-                }
-            }
-            break;
-    }
+    initStreams(data, offset, vecsize);
 
-    switch ( myData->test->streams ) {
-        case STREAM_1:
-            MEASURE(func(size,myData->streams[0]));
-            break;
-        case STREAM_2:
-            MEASURE(func(size,myData->streams[0],myData->streams[1]));
-            break;
-        case STREAM_3:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2]));
-            break;
-        case STREAM_4:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3]));
-            break;
-        case STREAM_5:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4]));
-            break;
-        case STREAM_6:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5]));
-            break;
-        case STREAM_7:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6]));
-            break;
-        case STREAM_8:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7]));
-            break;
-        case STREAM_9:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8]));
-            break;
-        case STREAM_10:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9]));
-            break;
-        case STREAM_11:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10]));
-            break;
-        case STREAM_12:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11]));
-            break;
-        case STREAM_13:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12]));
-            break;
-        case STREAM_14:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13]));
-            break;
-        case STREAM_15:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14]));
-            break;
-        case STREAM_16:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15]));
-            break;
-        case STREAM_17:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16]));
-            break;
-        case STREAM_18:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17]));
-            break;
-        case STREAM_19:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18]));
-            break;
-        case STREAM_20:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19]));
-            break;
-        case STREAM_21:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20]));
-            break;
-        case STREAM_22:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21]));
-            break;
-        case STREAM_23:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22]));
-            break;
-        case STREAM_24:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23]));
-            break;
-        case STREAM_25:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24]));
-            break;
-        case STREAM_26:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25]));
-            break;
-        case STREAM_27:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26]));
-            break;
-        case STREAM_28:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27]));
-            break;
-        case STREAM_29:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28]));
-            break;
-        case STREAM_30:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29]));
-            break;
-        case STREAM_31:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30]));
-            break;
-        case STREAM_32:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31]));
-            break;
-        case STREAM_33:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32]));
-            break;
-        case STREAM_34:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33]));
-            break;
-        case STREAM_35:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34]));
-            break;
-        case STREAM_36:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35]));
-            break;
-        case STREAM_37:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35],
-                        myData->streams[36]));
-            break;
-        case STREAM_38:
-            MEASURE(func(size,myData->streams[0],myData->streams[1],myData->streams[2],myData->streams[3],
-                        myData->streams[4],myData->streams[5],myData->streams[6],myData->streams[7],
-                        myData->streams[8],myData->streams[9],myData->streams[10],myData->streams[11],
-                        myData->streams[12],myData->streams[13],myData->streams[14],myData->streams[15],
-                        myData->streams[16],myData->streams[17],myData->streams[18],myData->streams[19],
-                        myData->streams[20],myData->streams[21],myData->streams[22],myData->streams[23],
-                        myData->streams[24],myData->streams[25],myData->streams[26],myData->streams[27],
-                        myData->streams[28],myData->streams[29],myData->streams[30],myData->streams[31],
-                        myData->streams[32],myData->streams[33],myData->streams[34],myData->streams[35],
-                        myData->streams[36],myData->streams[37]));
-            break;
-        default:
-            break;
-    }
+    initChains(data, size);
+    initIndex(data, size);
+
+    MEASURE(callKernel(func, size, myData->streams, myData->test->streams));
     data->data.iter = iterations;
 #ifdef DEBUG_LIKWID
     printf(" %d iterations per thread\n", iterations);
@@ -32,6 +32,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <limits.h>
 #include <libgen.h>
 #include <dirent.h>
 #include <dlfcn.h>
@@ -46,6 +47,9 @@
 
 #include <ptt2asm.h>
 
+#define STRINGIFY(x) #x
+#define TOSTRING(x) STRINGIFY(x)
+
 #ifdef __x86_64
 #include <isa_x86-64.h>
 #endif
@@ -152,9 +156,8 @@ static int write_asm(bstring filename, struct bstrList* code)
     (variable) = ownatoi(bdata(tmp)); \
     bdestroy(tmp); \
 
-static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
+static struct bstrList* analyse_ptt_lines(struct bstrList* ptt, TestCase** testcase)
 {
-    struct bstrList* ptt = NULL;
     TestCase* test = NULL;
     struct bstrList* code = NULL;
     bstring bBYTES = bformat("BYTES");
@@ -172,11 +175,11 @@ static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
     bstring bINSTLOOP = bformat("INSTR_LOOP");
     bstring bUOPS = bformat("UOPS");
     bstring bBRANCHES = bformat("BRANCHES");
+    bstring bCHAINS = bformat("CHAINS");
+    bstring bINDEX = bformat("INDEX");
     bstring bLOOP = bformat("LOOP");
     int (*ownatoi)(const char*) = &atoi;
 
-    ptt = read_ptt(pttfile);
-
     if (ptt && ptt->qty > 0)
     {
         test = malloc(sizeof(TestCase));
@@ -189,6 +192,9 @@ static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
             test->instr_const = -1;
             test->instr_loop = -1;
             test->uops = -1;
+            test->chains = 0;
+            test->index_stream = -1;
+            test->stencil = STENCIL_NONE;
             code = bstrListCreate();
             for (int i = 0; i < ptt->qty; i++)
             {
@@ -232,6 +238,14 @@ static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
                 {
                     ANALYSE_PTT_GET_INT(ptt->entry[i], bBRANCHES, test->branches);
                 }
+                else if (bstrncmp(ptt->entry[i], bCHAINS, blength(bCHAINS)) == BSTR_OK)
+                {
+                    ANALYSE_PTT_GET_INT(ptt->entry[i], bCHAINS, test->chains);
+                }
+                else if (bstrncmp(ptt->entry[i], bINDEX, blength(bINDEX)) == BSTR_OK)
+                {
+                    ANALYSE_PTT_GET_INT(ptt->entry[i], bINDEX, test->index_stream);
+                }
                 else if (bstrncmp(ptt->entry[i], bLOOP, blength(bLOOP)) == BSTR_OK)
                 {
                     ANALYSE_PTT_GET_INT(ptt->entry[i], bLOOP, test->stride);
@@ -284,7 +298,6 @@ static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
             }
             *testcase = test;
         }
-        bstrListDestroy(ptt);
     }
 
     bdestroy(bBYTES);
@@ -302,10 +315,24 @@ static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
     bdestroy(bINSTLOOP);
     bdestroy(bUOPS);
     bdestroy(bBRANCHES);
+    bdestroy(bCHAINS);
+    bdestroy(bINDEX);
     bdestroy(bLOOP);
     return code;
 }
 
+static struct bstrList* analyse_ptt(bstring pttfile, TestCase** testcase)
+{
+    struct bstrList* code = NULL;
+    struct bstrList* ptt = read_ptt(pttfile);
+    if (ptt)
+    {
+        code = analyse_ptt_lines(ptt, testcase);
+        bstrListDestroy(ptt);
+    }
+    return code;
+}
+
 static int set_testname(char *pttfile, TestCase* testcase)
 {
     if ((!testcase)||(!pttfile))
@@ -444,6 +471,528 @@ static int prepare_code(struct bstrList* code)
     return 0;
 }
 
+/* Kernel templates (*.tpl) describe one operation for all vector widths of an
+ * ISA. The format and the variant names
+ * <op>_<dp|sp>_v<bits>[_nt][_fma][_pf<dist>]_u<n> are the same as for the
+ * build-time expansion in perl/ptttemplate.pm. */
+
+#define TEMPLATE_MAX_UNROLLS 16
+
+typedef struct {
+    int streams;
+    int flops;
+    int loads;
+    int stores;
+    bstring desc;
+    int hasDouble;
+    int hasSingle;
+    int numWidths;
+    int bits[TEMPLATE_MAX_WIDTHS];
+    bstring prefix[TEMPLATE_MAX_WIDTHS];
+    int regs[TEMPLATE_MAX_WIDTHS];
+    int numUnrolls;
+    int unrolls[TEMPLATE_MAX_UNROLLS];
+    int numPrefetch;
+    int prefetch[TEMPLATE_MAX_PREFETCH];
+    int nt;
+    int fma;
+    struct bstrList* prolog;
+    struct bstrList* body;
+} PttTemplate;
+
+typedef struct {
+    DataType type;
+    int width;
+    int nt;
+    int fma;
+    int prefetch;
+    int unroll;
+} PttVariant;
+
+static void destroy_template(PttTemplate* tpl)
+{
+    bdestroy(tpl->desc);
+    for (int i = 0; i < tpl->numWidths; i++)
+    {
+        bdestroy(tpl->prefix[i]);
+    }
+    bstrListDestroy(tpl->prolog);
+    bstrListDestroy(tpl->body);
+    memset(tpl, 0, sizeof(PttTemplate));
+}
+
+static int read_intlist(char* ptr, int* list, int max)
+{
+    int count = 0;
+    char* end = NULL;
+    while (count < max)
+    {
+        int v = (int)strtol(ptr, &end, 10);
+        if (end == ptr)
+        {
+            break;
+        }
+        list[count++] = v;
+        ptr = end;
+    }
+    return count;
+}
+
+static int read_template(bstring tplfile, PttTemplate* tpl)
+{
+    int isLoop = 0;
+    struct bstrList* lines = read_ptt(tplfile);
+    if (!lines)
+    {
+        return -ENOENT;
+    }
+    memset(tpl, 0, sizeof(PttTemplate));
+    tpl->streams = 1;
+    tpl->desc = bfromcstr("");
+    tpl->prolog = bstrListCreate();
+    tpl->body = bstrListCreate();
+    for (int i = 0; i < lines->qty; i++)
+    {
+        char* l = bdata(lines->entry[i]);
+        if (blength(lines->entry[i]) == 0)
+        {
+            continue;
+        }
+        if (strncmp(l, "STREAMS ", 8) == 0)
+        {
+            tpl->streams = atoi(l+8);
+        }
+        else if (strncmp(l, "FLOPS ", 6) == 0)
+        {
+            tpl->flops = atoi(l+6);
+        }
+        else if (strncmp(l, "LOADS ", 6) == 0)
+        {
+            tpl->loads = atoi(l+6);
+        }
+        else if (strncmp(l, "STORES ", 7) == 0)
+        {
+            tpl->stores = atoi(l+7);
+        }
+        else if (strncmp(l, "DESC ", 5) == 0)
+        {
+            bassigncstr(tpl->desc, l+5);
+            btrimws(tpl->desc);
+        }
+        else if (strncmp(l, "TYPES ", 6) == 0)
+        {
+            tpl->hasDouble = (strstr(l, "DOUBLE") != NULL);
+            tpl->hasSingle = (strstr(l, "SINGLE") != NULL);
+        }
+        else if (strncmp(l, "WIDTH ", 6) == 0 && tpl->numWidths < TEMPLATE_MAX_WIDTHS)
+        {
+            char prefix[20];
+            int w = tpl->numWidths;
+            if (sscanf(l+6, "%d %19s %d", &tpl->bits[w], prefix, &tpl->regs[w]) == 3)
+            {
+                tpl->prefix[w] = bfromcstr(prefix);
+                tpl->numWidths++;
+            }
+        }
+        else if (strncmp(l, "UNROLL ", 7) == 0)
+        {
+            tpl->numUnrolls = read_intlist(l+7, tpl->unrolls, TEMPLATE_MAX_UNROLLS);
+        }
+        else if (strncmp(l, "PREFETCH ", 9) == 0)
+        {
+            tpl->numPrefetch = read_intlist(l+9, tpl->prefetch, TEMPLATE_MAX_PREFETCH);
+        }
+        else if (strcmp(l, "NT") == 0)
+        {
+            tpl->nt = 1;
+        }
+        else if (strcmp(l, "FMA") == 0)
+        {
+            tpl->fma = 1;
+        }
+        else if (strncmp(l, "LOOP", 4) == 0)
+        {
+            isLoop = 1;
+        }
+        else
+        {
+            bstrListAdd((isLoop ? tpl->body : tpl->prolog), lines->entry[i]);
+        }
+    }
+    bstrListDestroy(lines);
+    return 0;
+}
+
+static bstring template_name(bstring op, PttTemplate* tpl, PttVariant* var)
+{
+    bstring name = bformat("%s_%s_v%d", bdata(op), (var->type == DOUBLE ? "dp" : "sp"), tpl->bits[var->width]);
+    if (var->nt)
+    {
+        bcatcstr(name, "_nt");
+    }
+    if (var->fma)
+    {
+        bcatcstr(name, "_fma");
+    }
+    if (var->prefetch > 0)
+    {
+        bformata(name, "_pf%d", var->prefetch);
+    }
+    bformata(name, "_u%d", var->unroll);
+    return name;
+}
+
+/* Splits <op>_<dp|sp>_v<bits>[_nt][_fma][_pf<dist>]_u<n> from the back because the
+ * operation itself may contain underscores. */
+static int parse_template_name(bstring testname, bstring op, int* bits, PttVariant* var)
+{
+    int err = -EINVAL;
+    struct bstrList* parts = bsplit(testname, '_');
+    int last = parts->qty - 1;
+
+    memset(var, 0, sizeof(PttVariant));
+    if (last >= 3 && bdata(parts->entry[last])[0] == 'u')
+    {
+        var->unroll = atoi(bdata(parts->entry[last])+1);
+        last--;
+        if (strncmp(bdata(parts->entry[last]), "pf", 2) == 0)
+        {
+            var->prefetch = atoi(bdata(parts->entry[last])+2);
+            last--;
+        }
+        if (biseqcstr(parts->entry[last], "fma"))
+        {
+            var->fma = 1;
+            last--;
+        }
+        if (biseqcstr(parts->entry[last], "nt"))
+        {
+            var->nt = 1;
+            last--;
+        }
+        if (last >= 2 && bdata(parts->entry[last])[0] == 'v')
+        {
+            *bits = atoi(bdata(parts->entry[last])+1);
+            last--;
+            if (biseqcstr(parts->entry[last], "dp") || biseqcstr(parts->entry[last], "sp"))
+            {
+                var->type = (biseqcstr(parts->entry[last], "dp") ? DOUBLE : SINGLE);
+                last--;
+                bassign(op, parts->entry[0]);
+                for (int i = 1; i <= last; i++)
+                {
+                    bconchar(op, '_');
+                    bconcat(op, parts->entry[i]);
+                }
+                if (var->unroll > 0 && *bits > 0)
+                {
+                    err = 0;
+                }
+            }
+        }
+    }
+    bstrListDestroy(parts);
+    return err;
+}
+
+/* The installed templates are preferred, a template in $HOME or the current
+ * directory cannot replace them */
+static bstring find_template(bstring op)
+{
+    char pwd[PATH_MAX];
+    char* home = getenv("HOME");
+    bstring path = NULL;
+
+    path = bformat("%s/share/likwid/bench/%s/%s.tpl", TOSTRING(INSTALL_PREFIX), ARCHNAME, bdata(op));
+    if (!access(bdata(path), R_OK))
+    {
+        return path;
+    }
+    bdestroy(path);
+    if (home)
+    {
+        path = bformat("%s/.likwid/bench/%s/%s.tpl", home, ARCHNAME, bdata(op));
+        if (!access(bdata(path), R_OK))
+        {
+            return path;
+        }
+        bdestroy(path);
+    }
+    if (getcwd(pwd, PATH_MAX) != NULL)
+    {
+        path = bformat("%s/%s.tpl", pwd, bdata(op));
+        if (!access(bdata(path), R_OK))
+        {
+            return path;
+        }
+        bdestroy(path);
+    }
+    return NULL;
+}
+
+static bstring expand_template_line(bstring line, PttTemplate* tpl, PttVariant* var, int u, int* maxR, int* maxC)
+{
+    char* l = bdata(line);
+    int w = var->width;
+    int size = (var->type == DOUBLE ? 8 : 4);
+    bstring out = NULL;
+
+    if (l[0] == '?')
+    {
+        int neg = (l[1] == '!');
+        char* flag = l + 1 + neg;
+        int set = 0;
+        if (strncmp(flag, "NT ", 3) == 0)
+        {
+            set = var->nt;
+        }
+        else if (strncmp(flag, "FMA ", 4) == 0)
+        {
+            set = var->fma;
+        }
+        else if (strncmp(flag, "PF ", 3) == 0)
+        {
+            /* Prefetch only with the copies that start a new cache line of
+             * the loop body. Bodies shorter than a cache line prefetch once
+             * per iteration. */
+            int bytes = tpl->bits[w] / 8;
+            set = (var->prefetch > 0 &&
+                   (u == 0 || (u * bytes) / 64 != ((u - 1) * bytes) / 64));
+        }
+        if (neg == set)
+        {
+            return NULL;
+        }
+        l = strchr(flag, ' ') + 1;
+    }
+    out = bfromcstr("");
+    while (*l != '\0')
+    {
+        char* end = (*l == '%' ? strchr(l+1, '%') : NULL);
+        if (end)
+        {
+            int n = atoi(l+2);
+            if (end == l+2 && l[1] == 'T')
+            {
+                bconchar(out, (var->type == DOUBLE ? 'd' : 's'));
+            }
+            else if (end == l+2 && l[1] == 'S')
+            {
+                bformata(out, "%d", size);
+            }
+            else if (end == l+2 && l[1] == 'V')
+            {
+                bconcat(out, tpl->prefix[w]);
+            }
+            else if (end == l+2 && l[1] == 'O')
+            {
+                bformata(out, "%d", u * tpl->bits[w] / 8);
+            }
+            else if (end == l+2 && l[1] == 'D')
+            {
+                bformata(out, "%d", var->prefetch);
+            }
+            else if (l[1] == 'R' && end > l+2)
+            {
+                *maxR = (n > *maxR ? n : *maxR);
+                bformata(out, "%s%d", bdata(tpl->prefix[w]), n * var->unroll + u);
+            }
+            else if (l[1] == 'C' && end > l+2)
+            {
+                *maxC = (n > *maxC ? n : *maxC);
+                bformata(out, "%s%d", bdata(tpl->prefix[w]), tpl->regs[w] - 1 - n);
+            }
+            else
+            {
+                bcatblk(out, l, end - l);
+                l = end;
+                continue;
+            }
+            l = end + 1;
+            continue;
+        }
+        bconchar(out, *l);
+        l++;
+    }
+    return out;
+}
+
+/* Returns the ptt lines of one template variant like read_ptt() does for
+ * a ptt file */
+static struct bstrList* instantiate_template(PttTemplate* tpl, PttVariant* var, int quiet)
+{
+    int maxR = -1;
+    int maxC = -1;
+    int w = var->width;
+    int size = (var->type == DOUBLE ? 8 : 4);
+    struct bstrList* prolog = bstrListCreate();
+    struct bstrList* body = bstrListCreate();
+    struct bstrList* out = NULL;
+
+    for (int i = 0; i < tpl->prolog->qty; i++)
+    {
+        bstring l = expand_template_line(tpl->prolog->entry[i], tpl, var, 0, &maxR, &maxC);
+        if (l)
+        {
+            bstrListAdd(prolog, l);
+            bdestroy(l);
+        }
+    }
+    for (int i = 0; i < tpl->body->qty; i++)
+    {
+        for (int u = 0; u < var->unroll; u++)
+        {
+            bstring l = expand_template_line(tpl->body->entry[i], tpl, var, u, &maxR, &maxC);
+            if (l)
+            {
+                bstrListAdd(body, l);
+                bdestroy(l);
+            }
+        }
+    }
+    if ((maxR+1) * var->unroll + maxC + 1 > tpl->regs[w])
+    {
+        if (!quiet)
+        {
+            fprintf(stderr, "Template variant needs %d vector registers but only %d are available\n",
+                            (maxR+1) * var->unroll + maxC + 1, tpl->regs[w]);
+        }
+        bstrListDestroy(prolog);
+        bstrListDestroy(body);
+        return NULL;
+    }
+
+    out = bstrListCreate();
+    bstring tmp = bformat("STREAMS %d", tpl->streams);
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "TYPE %s", (var->type == DOUBLE ? "DOUBLE" : "SINGLE"));
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "FLOPS %d", tpl->flops);
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "BYTES %d", (tpl->loads + tpl->stores) * size);
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "DESC %s, %s, %d bit vectors%s%s", bdata(tpl->desc),
+                       (var->type == DOUBLE ? "double-precision" : "single-precision"), tpl->bits[w],
+                       (var->nt ? ", non-temporal stores" : ""), (var->fma ? ", FMA" : ""));
+    if (var->prefetch > 0)
+    {
+        bformata(tmp, ", prefetch distance %d Byte", var->prefetch);
+    }
+    bformata(tmp, ", unrolled %d times", var->unroll);
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "LOADS %d", tpl->loads);
+    bstrListAdd(out, tmp);
+    bassignformat(tmp, "STORES %d", tpl->stores);
+    bstrListAdd(out, tmp);
+    for (int i = 0; i < prolog->qty; i++)
+    {
+        bstrListAdd(out, prolog->entry[i]);
+    }
+    bassignformat(tmp, "LOOP %d", tpl->bits[w] / (8 * size) * var->unroll);
+    bstrListAdd(out, tmp);
+    for (int i = 0; i < body->qty; i++)
+    {
+        bstrListAdd(out, body->entry[i]);
+    }
+    bdestroy(tmp);
+    bstrListDestroy(prolog);
+    bstrListDestroy(body);
+    return out;
+}
+
+/* Looks up the template of a variant name and checks that the template
+ * provides the requested type, width, flags and prefetch distance. Any
+ * unroll factor is allowed as long as the vector registers suffice. */
+static struct bstrList* template_variant(bstring testname, int quiet)
+{
+    PttTemplate tpl;
+    PttVariant var;
+    int bits = 0;
+    int validPrefetch = 0;
+    struct bstrList* lines = NULL;
+    bstring op = bfromcstr("");
+
+    if (parse_template_name(testname, op, &bits, &var) == 0)
+    {
+        bstring tplfile = find_template(op);
+        if (tplfile && read_template(tplfile, &tpl) == 0)
+        {
+            var.width = -1;
+            for (int i = 0; i < tpl.numWidths; i++)
+            {
+                if (tpl.bits[i] == bits)
+                {
+                    var.width = i;
+                }
+            }
+            for (int i = 0; i < tpl.numPrefetch && var.prefetch > 0; i++)
+            {
+                if (tpl.prefetch[i] == var.prefetch)
+                {
+                    validPrefetch = 1;
+                }
+            }
+            if (var.width < 0 || (var.type == DOUBLE && !tpl.hasDouble) || (var.type == SINGLE && !tpl.hasSingle) ||
+                (var.nt && !tpl.nt) || (var.fma && !tpl.fma) || (var.prefetch > 0 && !validPrefetch))
+            {
+                if (!quiet)
+                {
+                    fprintf(stderr, "Template %s provides no variant %s\n", bdata(tplfile), bdata(testname));
+                }
+            }
+            else
+            {
+                lines = instantiate_template(&tpl, &var, quiet);
+            }
+            destroy_template(&tpl);
+        }
+        bdestroy(tplfile);
+    }
+    bdestroy(op);
+    return lines;
+}
+
+/* Adds the default variants (UNROLL line) of a template to the list */
+static int template_getall(bstring tplfile, bstring op, struct bstrList* benchmarks)
+{
+    int count = 0;
+    PttTemplate tpl;
+    PttVariant var;
+
+    if (read_template(tplfile, &tpl) != 0)
+    {
+        return 0;
+    }
+    for (int t = 0; t < 2; t++)
+    {
+        var.type = (t == 0 ? DOUBLE : SINGLE);
+        if ((var.type == DOUBLE && !tpl.hasDouble) || (var.type == SINGLE && !tpl.hasSingle))
+        {
+            continue;
+        }
+        for (var.width = 0; var.width < tpl.numWidths; var.width++)
+        {
+            for (var.nt = 0; var.nt <= tpl.nt; var.nt++)
+            {
+                for (var.fma = 0; var.fma <= tpl.fma; var.fma++)
+                {
+                    for (int u = 0; u < tpl.numUnrolls; u++)
+                    {
+                        var.prefetch = 0;
+                        var.unroll = tpl.unrolls[u];
+                        bstring name = template_name(op, &tpl, &var);
+                        bstrListAdd(benchmarks, name);
+                        bdestroy(name);
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+    destroy_template(&tpl);
+    return count;
+}
+
 static int dynbench_getall_folder(char *path, struct bstrList** benchmarks)
 {
     int files = 0;
@@ -467,6 +1016,15 @@ static int dynbench_getall_folder(char *path, struct bstrList** benchmarks)
                     bstrListAdd(*benchmarks, dname);
                     bdestroy(dname);
                 }
+                else if ( (strncmp(&(ep->d_name[strlen(ep->d_name)-4]), ".tpl", 4) == 0))
+                {
+                    bstring dname = bfromcstr(ep->d_name);
+                    bstring tplfile = bformat("%s/%s", path, ep->d_name);
+                    btrunc(dname, blength(dname)-4);
+                    files += template_getall(tplfile, dname, *benchmarks);
+                    bdestroy(tplfile);
+                    bdestroy(dname);
+                }
             }
             closedir(dp);
         }
@@ -622,6 +1180,15 @@ int dynbench_test(bstring testname)
         exist = 1;
     }
     bdestroy(path);
+    if (!exist)
+    {
+        struct bstrList* lines = template_variant(testname, 0);
+        if (lines)
+        {
+            exist = 1;
+            bstrListDestroy(lines);
+        }
+    }
     return exist;
 }
 
@@ -643,20 +1210,29 @@ int dynbench_load(bstring testname, TestCase **testcase, char* tmpfolder, char *
         return err;
     }
 
+    struct bstrList* code = NULL;
     bstring pttfile = bformat("%s/%s.ptt", pwd, bdata(testname));
     if (access(bdata(pttfile), R_OK))
     {
         bdestroy(pttfile);
         pttfile = bformat("%s/.likwid/bench/%s/%s.ptt", home, ARCHNAME, bdata(testname));
-        if (access(bdata(pttfile), R_OK))
+    }
+    if (access(bdata(pttfile), R_OK))
+    {
+        struct bstrList* lines = template_variant(testname, 0);
+        if (!lines)
         {
-            fprintf(stderr, "Cannot open ptt file %s.ptt in CWD or %s/.likwid/bench/%s\n", bdata(testname), home, ARCHNAME);
+            fprintf(stderr, "Cannot open ptt file %s.ptt or a template for it in CWD or %s/.likwid/bench/%s\n", bdata(testname), home, ARCHNAME);
             bdestroy(pttfile);
             return err;
         }
+        code = analyse_ptt_lines(lines, &test);
+        bstrListDestroy(lines);
+    }
+    else
+    {
+        code = analyse_ptt(pttfile, &test);
     }
-
-    struct bstrList* code = analyse_ptt(pttfile, &test);
     if (code && test)
     {
         test->dlhandle = NULL;
@@ -842,3 +1418,54 @@ int dynbench_asm(bstring testname, char* tmpfolder, bstring outfile)
         }
     }
 }
+
+int dynbench_template_info(bstring op, TemplateInfo* info)
+{
+    PttTemplate tpl;
+    bstring tplfile = find_template(op);
+    if (!tplfile)
+    {
+        fprintf(stderr, "Cannot find template %s.tpl in CWD, %s/.likwid/bench/%s or %s/share/likwid/bench/%s\n",
+                        bdata(op), getenv("HOME"), ARCHNAME, TOSTRING(INSTALL_PREFIX), ARCHNAME);
+        return -ENOENT;
+    }
+    if (read_template(tplfile, &tpl) != 0)
+    {
+        bdestroy(tplfile);
+        return -EPERM;
+    }
+    memset(info, 0, sizeof(TemplateInfo));
+    info->hasDouble = tpl.hasDouble;
+    info->hasSingle = tpl.hasSingle;
+    info->numWidths = tpl.numWidths;
+    for (int i = 0; i < tpl.numWidths; i++)
+    {
+        info->bits[i] = tpl.bits[i];
+    }
+    info->nt = tpl.nt;
+    info->fma = tpl.fma;
+    info->numPrefetch = tpl.numPrefetch;
+    for (int i = 0; i < tpl.numPrefetch; i++)
+    {
+        info->prefetch[i] = tpl.prefetch[i];
+    }
+    destroy_template(&tpl);
+    bdestroy(tplfile);
+    return 0;
+}
+
+int dynbench_template_valid(bstring testname)
+{
+    struct bstrList* lines = template_variant(testname, 1);
+    if (lines)
+    {
+        bstrListDestroy(lines);
+        return 1;
+    }
+    return 0;
+}
+
+bstring dynbench_userfolder(void)
+{
+    return bformat("%s/.likwid/bench/%s", getenv("HOME"), ARCHNAME);
+}
@@ -0,0 +1,419 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  stencil.c
+ *
+ *      Description:  Jacobi stencil kernels of likwid-bench with spatial blocking
+ *                    and wavefront temporal blocking.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+/* #####   HEADER FILE INCLUDES   ######################################### */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <math.h>
+
+#include <allocator.h>
+#include <barrier.h>
+#include <stencil.h>
+
+/* #####   MACROS  -  LOCAL TO THIS SOURCE FILE   ######################### */
+
+#define NUMSTENCILS 3
+#define ROW3(r, x) ((r)[(x)-1] + (r)[(x)] + (r)[(x)+1])
+
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
+
+/* The stencils are implemented in C because they need the grid geometry.
+ * Each element of a workgroup vector is one lattice site, so the flops and
+ * bytes are given per lattice site update (LUP). The bytes assume that the
+ * layer condition is fulfilled (load, store and write-allocate) */
+static const TestCase stencils[NUMSTENCILS] = {
+    {"jacobi2d5pt", STREAM_2, DOUBLE, 1, NULL, 4, 24,
+     "Double-precision 2D five-point Jacobi stencil, grid size with -G",
+     4, 1, -1, -1, -1, -1, 0, -1, STENCIL_2D5PT},
+    {"jacobi3d7pt", STREAM_2, DOUBLE, 1, NULL, 6, 24,
+     "Double-precision 3D seven-point Jacobi stencil, grid size with -G",
+     6, 1, -1, -1, -1, -1, 0, -1, STENCIL_3D7PT},
+    {"jacobi3d27pt", STREAM_2, DOUBLE, 1, NULL, 27, 24,
+     "Double-precision 3D twenty-seven-point box stencil, grid size with -G",
+     27, 1, -1, -1, -1, -1, 0, -1, STENCIL_3D27PT},
+};
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE  ############ */
+
+/* The outermost dimension is split between the threads and traversed by
+ * the wavefront, a layer is one row (2D) or one plane (3D) */
+static uint64_t
+stencil_outer(const TestCase* test, const StencilGrid* grid)
+{
+    return (test->stencil == STENCIL_2D5PT ? grid->ny : grid->nz);
+}
+
+static uint64_t
+stencil_layer(const TestCase* test, const StencilGrid* grid)
+{
+    return (test->stencil == STENCIL_2D5PT ? grid->nx : grid->nx * grid->ny);
+}
+
+/* The 2D stencil is blocked in x, the 3D stencils in y */
+static uint64_t
+stencil_blocked(const TestCase* test, const StencilGrid* grid)
+{
+    return (test->stencil == STENCIL_2D5PT ? grid->nx : grid->ny);
+}
+
+static void
+jacobi2d5pt(const StencilGrid* grid,
+            const double* restrict src,
+            double* restrict dst,
+            uint64_t first,
+            uint64_t last)
+{
+    const uint64_t nx = grid->nx;
+    const uint64_t bx = (grid->block > 0 ? grid->block : nx - 2);
+    uint64_t xb, x, y;
+
+    for (xb = 1; xb < nx - 1; xb += bx)
+    {
+        uint64_t xe = (xb + bx < nx - 1 ? xb + bx : nx - 1);
+        for (y = first; y < last; y++)
+        {
+            const double* c = src + y * nx;
+            double* d = dst + y * nx;
+            for (x = xb; x < xe; x++)
+            {
+                d[x] = 0.25 * (c[x-1] + c[x+1] + c[x-nx] + c[x+nx]);
+            }
+        }
+    }
+}
+
+static void
+jacobi3d7pt(const StencilGrid* grid,
+            const double* restrict src,
+            double* restrict dst,
+            uint64_t first,
+            uint64_t last)
+{
+    const uint64_t nx = grid->nx;
+    const uint64_t ny = grid->ny;
+    const uint64_t plane = nx * ny;
+    const uint64_t by = (grid->block > 0 ? grid->block : ny - 2);
+    const double w = 1.0 / 6.0;
+    uint64_t yb, x, y, z;
+
+    for (yb = 1; yb < ny - 1; yb += by)
+    {
+        uint64_t ye = (yb + by < ny - 1 ? yb + by : ny - 1);
+        for (z = first; z < last; z++)
+        {
+            for (y = yb; y < ye; y++)
+            {
+                const double* c = src + z * plane + y * nx;
+                double* d = dst + z * plane + y * nx;
+                for (x = 1; x < nx - 1; x++)
+                {
+                    d[x] = w * (c[x-1] + c[x+1] + c[x-nx] + c[x+nx] + c[x-plane] + c[x+plane]);
+                }
+            }
+        }
+    }
+}
+
+static void
+jacobi3d27pt(const StencilGrid* grid,
+             const double* restrict src,
+             double* restrict dst,
+             uint64_t first,
+             uint64_t last)
+{
+    const uint64_t nx = grid->nx;
+    const uint64_t ny = grid->ny;
+    const uint64_t plane = nx * ny;
+    const uint64_t by = (grid->block > 0 ? grid->block : ny - 2);
+    const double w = 1.0 / 27.0;
+    uint64_t yb, x, y, z;
+
+    for (yb = 1; yb < ny - 1; yb += by)
+    {
+        uint64_t ye = (yb + by < ny - 1 ? yb + by : ny - 1);
+        for (z = first; z < last; z++)
+        {
+            for (y = yb; y < ye; y++)
+            {
+                const double* c = src + z * plane + y * nx;
+                const double* r0 = c - plane - nx;
+                const double* r1 = c - plane;
+                const double* r2 = c - plane + nx;
+                const double* r3 = c - nx;
+                const double* r5 = c + nx;
+                const double* r6 = c + plane - nx;
+                const double* r7 = c + plane;
+                const double* r8 = c + plane + nx;
+                double* d = dst + z * plane + y * nx;
+                for (x = 1; x < nx - 1; x++)
+                {
+                    d[x] = w * (ROW3(r0, x) + ROW3(r1, x) + ROW3(r2, x) +
+                                ROW3(r3, x) + ROW3(c, x)  + ROW3(r5, x) +
+                                ROW3(r6, x) + ROW3(r7, x) + ROW3(r8, x));
+                }
+            }
+        }
+    }
+}
+
+/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+
+const TestCase*
+stencil_getTest(const_bstring name)
+{
+    int i;
+
+    for (i = 0; i < NUMSTENCILS; i++)
+    {
+        if (biseqcstr(name, stencils[i].name))
+        {
+            return &stencils[i];
+        }
+    }
+    return NULL;
+}
+
+void
+stencil_printTests(void)
+{
+    int i;
+
+    for (i = 0; i < NUMSTENCILS; i++)
+    {
+        printf("%s - %s\n", stencils[i].name, stencils[i].desc);
+    }
+}
+
+/* Check whether the layers of the source grid that are needed at the same
+ * time fit into half of a cache of 'cacheSize' bytes. 'layers' is three for
+ * a single sweep, the wavefront needs more layers in the shared cache. */
+int
+stencil_layerCondition(const TestCase* test,
+                       const StencilGrid* grid,
+                       int layers,
+                       uint64_t cacheSize)
+{
+    uint64_t layer = stencil_layer(test, grid);
+
+    if (grid->block > 0)
+    {
+        layer = (test->stencil == STENCIL_2D5PT ? grid->block : grid->nx * grid->block);
+    }
+    return ((uint64_t)layers * layer * sizeof(double) <= cacheSize / 2);
+}
+
+/* Determine the grid dimensions from the number of elements per stream if
+ * no dimensions are given and select the block size of the blocked
+ * dimension. With 'autoblock', the block size is the largest one that
+ * fulfills the layer condition in a cache of 'cacheSize' bytes. */
+int
+stencil_setupGrid(StencilGrid* grid,
+                  const TestCase* test,
+                  uint64_t elements,
+                  uint64_t cacheSize,
+                  int autoblock)
+{
+    uint64_t n = 0;
+    uint64_t blocked = 0;
+
+    if (grid->nx == 0)
+    {
+        if (test->stencil == STENCIL_2D5PT)
+        {
+            n = (uint64_t) sqrt((double)elements);
+            grid->nx = n;
+            grid->ny = n;
+            grid->nz = 1;
+        }
+        else
+        {
+            n = (uint64_t) cbrt((double)elements);
+            while ((n+1)*(n+1)*(n+1) <= elements)
+                n++;
+            while (n > 0 && n*n*n > elements)
+                n--;
+            grid->nx = n;
+            grid->ny = n;
+            grid->nz = n;
+        }
+    }
+    else if (test->stencil == STENCIL_2D5PT)
+    {
+        if (grid->nz > 1)
+        {
+            fprintf(stderr, "Error: Stencil %s requires a 2D grid\n", test->name);
+            return -EINVAL;
+        }
+        grid->nz = 1;
+    }
+    else if (grid->nz == 0)
+    {
+        fprintf(stderr, "Error: Stencil %s requires a 3D grid\n", test->name);
+        return -EINVAL;
+    }
+    if (grid->nx < 3 || grid->ny < 3 || (test->stencil != STENCIL_2D5PT && grid->nz < 3))
+    {
+        fprintf(stderr, "Error: Grid %llux%llux%llu of stencil %s is too small, each dimension needs at least 3 points\n",
+                        LLU_CAST grid->nx, LLU_CAST grid->ny, LLU_CAST grid->nz, test->name);
+        return -EINVAL;
+    }
+
+    blocked = stencil_blocked(test, grid) - 2;
+    if (grid->wavefront)
+    {
+        /* The wavefront walks through complete layers */
+        grid->block = 0;
+    }
+    else if (autoblock)
+    {
+        uint64_t rest = (test->stencil == STENCIL_2D5PT ? 1 : grid->nx);
+        grid->block = cacheSize / 2 / (3 * sizeof(double) * rest);
+        if (grid->block == 0)
+            grid->block = 1;
+    }
+    if (grid->block >= blocked)
+    {
+        grid->block = 0;
+    }
+    return 0;
+}
+
+/* Split the inner layers of the outermost dimension between the threads */
+void
+stencil_partition(const TestCase* test,
+                  const StencilGrid* grid,
+                  int threadId,
+                  int numberOfThreads,
+                  uint64_t* first,
+                  uint64_t* last)
+{
+    uint64_t inner = stencil_outer(test, grid) - 2;
+
+    *first = 1 + (threadId * inner) / numberOfThreads;
+    *last = 1 + ((threadId + 1) * inner) / numberOfThreads;
+}
+
+uint64_t
+stencil_updates(const TestCase* test,
+                const StencilGrid* grid,
+                uint64_t first,
+                uint64_t last)
+{
+    uint64_t perLayer = grid->nx - 2;
+
+    if (test->stencil != STENCIL_2D5PT)
+    {
+        perLayer *= grid->ny - 2;
+    }
+    return (last - first) * perLayer;
+}
+
+/* Initialize the layers [first, last) of both grids and the boundary layer
+ * next to them so that each thread touches its own part first */
+void
+stencil_init(const TestCase* test,
+             const StencilGrid* grid,
+             double* a,
+             double* b,
+             uint64_t first,
+             uint64_t last)
+{
+    uint64_t layer = stencil_layer(test, grid);
+    uint64_t i;
+
+    if (first == 1)
+        first = 0;
+    if (last == stencil_outer(test, grid) - 1)
+        last++;
+    for (i = first * layer; i < last * layer; i++)
+    {
+        a[i] = 1.0;
+        b[i] = 1.0;
+    }
+}
+
+/* Update the layers [first, last) of 'dst' from 'src' */
+void
+stencil_sweep(const TestCase* test,
+              const StencilGrid* grid,
+              const double* src,
+              double* dst,
+              uint64_t first,
+              uint64_t last)
+{
+    switch (test->stencil)
+    {
+        case STENCIL_2D5PT:
+            jacobi2d5pt(grid, src, dst, first, last);
+            break;
+        case STENCIL_3D7PT:
+            jacobi3d7pt(grid, src, dst, first, last);
+            break;
+        case STENCIL_3D27PT:
+            jacobi3d27pt(grid, src, dst, first, last);
+            break;
+        default:
+            break;
+    }
+}
+
+/* Pipelined wavefront: thread t performs time step t of the group on the
+ * whole grid. It runs two layers behind thread t-1 so that all source
+ * layers of time step t-1 are complete and none of them is overwritten
+ * before thread t used it. Time step t reads grid t%2 and writes the other
+ * one. The threads synchronize after each layer. */
+void
+stencil_wavefront(const TestCase* test,
+                  const StencilGrid* grid,
+                  void** streams,
+                  int threadId,
+                  int numberOfThreads,
+                  BarrierData* barr)
+{
+    const double* src = (const double*) streams[threadId % 2];
+    double* dst = (double*) streams[(threadId + 1) % 2];
+    int64_t inner = (int64_t)stencil_outer(test, grid) - 2;
+    int64_t steps = inner + 2 * (numberOfThreads - 1);
+    int64_t s, k;
+
+    for (s = 0; s < steps; s++)
+    {
+        k = s - 2 * threadId;
+        if (k >= 0 && k < inner)
+        {
+            stencil_sweep(test, grid, src, dst, 1 + k, 2 + k);
+        }
+        barrier_synchronize(barr);
+    }
+}
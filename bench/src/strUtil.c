@@ -287,6 +287,70 @@ parse_streams(Workgroup* group, const_bstring str, int numberOfStreams)
     return 0;
 }
 
+/* Strip the trailing per-workgroup options (:kernel=<test>, :iter=<n>,
+ * :time=<s>, :role=victim|load) from the workgroup string */
+int
+bstr_to_workgroupOptions(Workgroup* group, bstring str)
+{
+    int pos = 0;
+
+    while ((pos = bstrrchr(str, ':')) != BSTR_ERR)
+    {
+        int valid = 0;
+        bstring opt = bmidstr(str, pos+1, blength(str)-pos-1);
+        int eq = bstrchr(opt, '=');
+        if (eq == BSTR_ERR)
+        {
+            bdestroy(opt);
+            break;
+        }
+        bstring key = bmidstr(opt, 0, eq);
+        bstring value = bmidstr(opt, eq+1, blength(opt)-eq-1);
+        if (biseqcstr(key, "kernel") && blength(value) > 0)
+        {
+            bdestroy(group->kernel);
+            group->kernel = bstrcpy(value);
+            valid = 1;
+        }
+        else if (biseqcstr(key, "iter") && str2int(bdata(value)) > 0)
+        {
+            group->iter = str2int(bdata(value));
+            valid = 1;
+        }
+        else if (biseqcstr(key, "time") && str2int(bdata(value)) > 0)
+        {
+            group->min_runtime = str2int(bdata(value));
+            valid = 1;
+        }
+        else if (biseqcstr(key, "role") && biseqcstr(value, "victim"))
+        {
+            group->role = GROUP_VICTIM;
+            valid = 1;
+        }
+        else if (biseqcstr(key, "role") && biseqcstr(value, "load"))
+        {
+            group->role = GROUP_LOAD;
+            valid = 1;
+        }
+        bdestroy(key);
+        bdestroy(value);
+        if (!valid)
+        {
+            fprintf(stderr, "Error: Invalid workgroup option %s\n", bdata(opt));
+            bdestroy(opt);
+            return -EINVAL;
+        }
+        bdestroy(opt);
+        btrunc(str, pos);
+    }
+    if (group->role == GROUP_SHARED &&
+        (group->kernel || group->iter > 0 || group->min_runtime > 0))
+    {
+        group->role = GROUP_INDEPENDENT;
+    }
+    return 0;
+}
+
 int
 bstr_to_workgroup(Workgroup* group, const_bstring str, DataType type, int numberOfStreams)
 {
@@ -339,11 +403,12 @@ bstr_to_workgroup(Workgroup* group, const_bstring str, DataType type, int number
     }
     bstrListDestroy(tokens);
     group->size /= numberOfStreams;
+    group->numberOfStreams = numberOfStreams;
     return 0;
 }
 
 void
-workgroups_destroy(Workgroup** groupList, int numberOfGroups, int numberOfStreams)
+workgroups_destroy(Workgroup** groupList, int numberOfGroups)
 {
     int i = 0, j = 0;
     if (groupList == NULL)
@@ -354,11 +419,15 @@ workgroups_destroy(Workgroup** groupList, int numberOfGroups, int numberOfStream
     for (i = 0; i < numberOfGroups; i++)
     {
         free(list[i].processorIds);
-        for (j = 0; j < numberOfStreams; j++)
+        for (j = 0; j < list[i].numberOfStreams && list[i].streams; j++)
         {
             bdestroy(list[i].streams[j].domain);
         }
         free(list[i].streams);
+        if (list[i].kernel)
+        {
+            bdestroy(list[i].kernel);
+        }
     }
     free(list);
 }
@@ -264,7 +264,7 @@ threads_join(void)
 }
 
 void
-threads_destroy(int numberOfGroups, int numberOfStreams)
+threads_destroy(int numberOfGroups)
 {
     int i = 0, j = 0;
     pthread_attr_destroy(&attr);
@@ -0,0 +1,17 @@
+STREAMS 2
+FLOPS 0
+DESC Vector copy A(i) = B(i)
+LOADS 1
+STORES 1
+TYPES DOUBLE SINGLE
+WIDTH 128 xmm 16
+WIDTH 256 ymm 16
+WIDTH 512 zmm 32
+UNROLL 4
+PREFETCH 256 512 1024 2048
+NT
+LOOP
+?PF prefetcht0   [STR0 + GPR1*%S% + %O% + %D%]
+vmovap%T%    %R0%, [STR0 + GPR1*%S% + %O%]
+?NT vmovntp%T%   [STR1 + GPR1*%S% + %O%], %R0%
+?!NT vmovap%T%    [STR1 + GPR1*%S% + %O%], %R0%
@@ -0,0 +1,14 @@
+STREAMS 1
+FLOPS 0
+DESC Vector load
+LOADS 1
+STORES 0
+TYPES DOUBLE SINGLE
+WIDTH 128 xmm 16
+WIDTH 256 ymm 16
+WIDTH 512 zmm 32
+UNROLL 4
+PREFETCH 256 512 1024 2048
+LOOP
+?PF prefetcht0   [STR0 + GPR1*%S% + %O% + %D%]
+vmovap%T%    %R0%, [STR0 + GPR1*%S% + %O%]
@@ -0,0 +1,15 @@
+STREAMS 1
+FLOPS 0
+DESC Vector store
+LOADS 0
+STORES 1
+TYPES DOUBLE SINGLE
+WIDTH 128 xmm 16
+WIDTH 256 ymm 16
+WIDTH 512 zmm 32
+UNROLL 4
+NT
+vmovup%T%    %C0%, [rip+SCALAR]
+LOOP
+?NT vmovntp%T%   [STR0 + GPR1*%S% + %O%], %C0%
+?!NT vmovap%T%    [STR0 + GPR1*%S% + %O%], %C0%
@@ -0,0 +1,24 @@
+STREAMS 4
+FLOPS 2
+DESC Vector triad A(i) = B(i) * C(i) + D(i)
+LOADS 3
+STORES 1
+TYPES DOUBLE SINGLE
+WIDTH 128 xmm 16
+WIDTH 256 ymm 16
+WIDTH 512 zmm 32
+UNROLL 4
+PREFETCH 256 512 1024 2048
+NT
+FMA
+LOOP
+?PF prefetcht0   [STR1 + GPR1*%S% + %O% + %D%]
+?PF prefetcht0   [STR2 + GPR1*%S% + %O% + %D%]
+?PF prefetcht0   [STR3 + GPR1*%S% + %O% + %D%]
+vmovap%T%    %R0%, [STR1 + GPR1*%S% + %O%]
+vmovap%T%    %R1%, [STR2 + GPR1*%S% + %O%]
+?FMA vfmadd213p%T% %R0%, %R1%, [STR3 + GPR1*%S% + %O%]
+?!FMA vmulp%T%     %R0%, %R0%, %R1%
+?!FMA vaddp%T%     %R0%, %R0%, [STR3 + GPR1*%S% + %O%]
+?NT vmovntp%T%   [STR0 + GPR1*%S% + %O%], %R0%
+?!NT vmovap%T%    [STR0 + GPR1*%S% + %O%], %R0%
@@ -143,6 +143,11 @@ LIKWIDLOCKPATH = /var/run/likwid.lock
 # LIKWID library.
 LIKWIDSOCKETBASE = /tmp/likwid  # -%d will be added automatically to the socket name
 
+# The shared node daemon of root (likwid-accessD -n -s) creates its socket in
+# this directory. The daemon creates it owned by root and not writable for
+# other users, so nobody else can place a socket there.
+LIKWIDSHAREDSOCKETDIR = /var/run/likwid
+
 # The pinning library is put in LD_PRELOAD when using LIKIWD for thread/process
 # pinning. The library overloads the pthread_create function to pin threads
 # directly after their creation
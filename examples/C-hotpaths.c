@@ -0,0 +1,127 @@
+/*
+ * ==========================================================================
+ *
+ *      Filename:  C-hotpaths.c
+ *
+ *      Description:  Timing of the perfmon hot paths (setup, read, group
+ *                    switch, MarkerAPI start/stop) with the simulated
+ *                    register backend. Runs without root and without
+ *                    MSR or PCI devices.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it
+ *      under the terms of the GNU General Public License as published by the
+ *      Free Software Foundation, either version 3 of the License, or (at your
+ *      option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful, but
+ *      WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *      General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along
+ *      with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * ==========================================================================
+ *
+ *      Usage:
+ *
+ *      make C-hotpaths && make C-hotpaths-run
+ *
+ *      The environment variables LIKWID_SIM (trace file or "synthetic"),
+ *      LIKWID_SIM_LATENCY (direct, daemon, perf or <read ns>[:<write ns>])
+ *      and LIKWID_TOPOLOGY_FILE (topology of the simulated machine, see
+ *      likwid-genTopoCfg) are passed through. Without a topology file, the
+ *      current machine is simulated which has to be supported by LIKWID.
+ *      The synthetic registers never count, only the timing is meaningful.
+ *      Use a trace with S lines to get non-zero counts.
+ *
+ * ==========================================================================
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <likwid.h>
+
+#define NUM_ITER 10000
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1E-9 * ts.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+    int i;
+    double start;
+    int iter = (argc > 1 ? atoi(argv[1]) : NUM_ITER);
+
+    if (iter <= 0)
+        iter = NUM_ITER;
+    if (!getenv("LIKWID_SIM"))
+        setenv("LIKWID_SIM", "synthetic", 1);
+    /* Two custom groups available on all Intel architectures since Core 2 */
+    if (!getenv("LIKWID_EVENTS"))
+        setenv("LIKWID_EVENTS", "INSTR_RETIRED_ANY:FIXC0,CPU_CLK_UNHALTED_CORE:FIXC1|"
+                                "INSTR_RETIRED_ANY:FIXC0,CPU_CLK_UNHALTED_REF:FIXC2", 1);
+    setenv("LIKWID_THREADS", "0", 1);
+    setenv("LIKWID_FILEPATH", "/tmp/likwid_hotpaths.out", 1);
+    setenv("LIKWID_MODE", "2", 1);
+    setenv("LIKWID_FORCE", "1", 1);
+
+    printf("Simulation: %s, latency: %s\n", getenv("LIKWID_SIM"),
+           getenv("LIKWID_SIM_LATENCY") ? getenv("LIKWID_SIM_LATENCY") : "none");
+
+    /* The clock calibration takes one second, keep it out of the setup time */
+    timer_init();
+
+    /* Initialization, event parsing, setup and start of the first group */
+    start = now();
+    likwid_markerInit();
+    printf("%-20s %12.2f us\n", "Setup", (now() - start) * 1E6);
+    if (perfmon_getNumberOfGroups() <= 0)
+    {
+        fprintf(stderr, "No event set could be added\n");
+        return 1;
+    }
+    likwid_markerRegisterRegion("hot");
+
+    start = now();
+    for (i = 0; i < iter; i++)
+    {
+        likwid_markerStartRegion("hot");
+        likwid_markerStopRegion("hot");
+    }
+    printf("%-20s %12.2f us/call\n", "Marker start/stop", (now() - start) * 1E6 / iter);
+
+    start = now();
+    for (i = 0; i < iter; i++)
+    {
+        perfmon_readCounters();
+    }
+    printf("%-20s %12.2f us/call\n", "Read", (now() - start) * 1E6 / iter);
+
+    if (perfmon_getNumberOfGroups() > 1)
+    {
+        start = now();
+        for (i = 0; i < iter; i++)
+        {
+            likwid_markerNextGroup();
+        }
+        printf("%-20s %12.2f us/call\n", "Switch", (now() - start) * 1E6 / iter);
+    }
+
+    likwid_markerClose();
+    return 0;
+}
@@ -12,6 +12,7 @@ DEFINES   += -DVERSION=$(VERSION)         \
              -DGROUPPATH=$(LIKWIDGROUPPATH) \
              -DLIKWIDLOCK=$(LIKWIDLOCKPATH) \
              -DLIKWIDSOCKETBASE=$(LIKWIDSOCKETBASE) \
+             -DLIKWIDSHAREDSOCKETDIR=$(LIKWIDSHAREDSOCKETDIR) \
              -DGITCOMMIT=$(GITCOMMIT) \
              -D_GNU_SOURCE
 
@@ -326,6 +327,8 @@ else
 	APPDAEMON_TARGET =
 endif
 
+MONITOR_TARGET = likwid-monitord
+
 ifeq ($(strip $(HAS_MEMPOLICY)),1)
 DEFINES += -DHAS_MEMPOLICY
 else
@@ -20,7 +20,6 @@ local header = [[
 #define NUM_ARCH_EVENTS_%s %d
 
 
-static PerfmonEvent  %s_arch_events[NUM_ARCH_EVENTS_%s] = {
 ]]
 -----------------------
 
@@ -71,13 +70,36 @@ function copy_event(event)
     return e
 end
 
+local strings = {}
+local string_offsets = {}
+local string_length = 0
+local options = {}
+local option_offsets = {}
+
+function string_offset(str)
+    if not string_offsets[str] then
+        string_offsets[str] = string_length
+        table.insert(strings, str)
+        string_length = string_length + str:len() + 1
+    end
+    return string_offsets[str]
+end
+
+function option_offset(opts)
+    if #opts == 0 then
+        return 0
+    end
+    local key = table.concat(opts, ",")
+    if not option_offsets[key] then
+        option_offsets[key] = #options
+        for _, o in pairs(opts) do
+            table.insert(options, o)
+        end
+    end
+    return option_offsets[key]
+end
+
 function format_event(event)
-    s = string.format("%q, %q, %s,%s,%s,%s,", event.name,
-                                                event.limit,
-                                                event.eventId,
-                                                event.umask,
-                                                event.cfg or "0",
-                                                event.cmask or "0")
     local tmp = {}
     if event.defopts then
         for optkey, optval in event.defopts:gmatch(defoption_match) do
@@ -88,11 +110,16 @@ function format_event(event)
             end
             table.insert(tmp, string.format("{%s, %s}", optkey, optval))
         end
-        event.defopts = "{"..table.concat(tmp, ", ") .. "}"
-    else
-        event.defopts = "{}"
     end
-    s = s .. string.format("%d,%s,%s", #tmp, event.opts, event.defopts)
+    s = string.format("%d, %d, %d, %d, %s,%s,%s,%s,%s", string_offset(event.name),
+                                                string_offset(event.limit),
+                                                option_offset(tmp),
+                                                #tmp,
+                                                event.eventId,
+                                                event.umask,
+                                                event.cfg or "0",
+                                                event.cmask or "0",
+                                                event.opts)
     return "{" .. s .. "},"
 end
 
@@ -154,13 +181,43 @@ if valid_event(event) then
     table.insert(output, event)
 end
 
+local entries = {}
+for _, e in pairs(output) do
+    table.insert(entries, format_event(e))
+end
+
 f = io.open(outputfile, "w")
 if f then
-    f:write(string.format(header, arch:upper(), #output, arch, arch:upper()))
-    for _, e in pairs(output) do
-        s = format_event(e)
+    f:write(string.format(header, arch:upper(), #output))
+    f:write(string.format("static const char %s_arch_event_strings[] =\n", arch))
+    if #strings == 0 then
+        f:write("    \"\"")
+    end
+    for i, str in pairs(strings) do
+        f:write(string.format("    \"%s\\0\"", str))
+        if i < #strings then
+            f:write("\n")
+        end
+    end
+    f:write(";\n\n")
+    f:write(string.format("static const PerfmonEventOption %s_arch_event_options[] = {\n", arch))
+    if #options == 0 then
+        f:write("  {EVENT_OPTION_NONE, 0x0},\n")
+    end
+    for _, o in pairs(options) do
+        f:write("  "..o..",\n")
+    end
+    f:write("};\n\n")
+    f:write(string.format("static const PerfmonEventEntry %s_arch_event_entries[NUM_ARCH_EVENTS_%s] = {\n", arch, arch:upper()))
+    for _, s in pairs(entries) do
         f:write("  "..s.."\n")
     end
+    f:write("};\n\n")
+    f:write(string.format("static const PerfmonEventTable %s_arch_events = {\n", arch))
+    f:write(string.format("    NUM_ARCH_EVENTS_%s,\n", arch:upper()))
+    f:write(string.format("    %s_arch_event_strings,\n", arch))
+    f:write(string.format("    %s_arch_event_options,\n", arch))
+    f:write(string.format("    %s_arch_event_entries\n", arch))
     f:write("};\n")
 else
     print(string.format("ERROR: The output path %s not writable", outputfile))
@@ -47,8 +47,7 @@ while (<INFILE>) {
         $umask = $2;
         $cfg   = $3;
         $cmask = $4;
-        my $defaultopts = "{";
-        my $nropts = 0;
+        my @defaultopts = ();
         if ($key ne $optkey or $optkey eq "")
         {
             $opts = "EVENT_OPTION_NONE_MASK";
@@ -59,37 +58,26 @@ while (<INFILE>) {
             foreach my $opt (@optlist)
             {
                 my @tmplist = split("=", $opt);
-                $defaultopts = $defaultopts."{".$tmplist[0].",".$tmplist[1]."},";
+                push(@defaultopts, "{".$tmplist[0].",".$tmplist[1]."}");
                 $opts = $opts."|".$tmplist[0]."_MASK";
-                $nropts++;
             }
         }
-        if (length($defaultopts) > 1)
-        {
-            substr($defaultopts,length($defaultopts)-1,1) = '}';
-        }
-        else
-        {
-            $defaultopts = $defaultopts."}";
-        }
         push(@events,{name=>$key,
                 limit=>$limit,
                 eventId=>$eventId,
                 cfg=>$cfg,
                 cmask=>$cmask,
                 mask=>$umask,
-                nropts=>$nropts,
                 opts=>$opts,
-                defopts=>$defaultopts});
+                defopts=>[@defaultopts]});
         $num_events++;
     } elsif (/UMASK_([A-Z0-9_]*)[ ]*(0x[A-F0-9]+)/) {
         $key = $1;
         $umask = $2;
-        my $defaultopts = "{";
-        my $nropts = 0;
+        my @defaultopts = ();
         if ($key ne $optkey or $optkey eq "")
         {
-            $opts = "EVENT_OPTION_NONE_MASK"
+            $opts = "EVENT_OPTION_NONE_MASK";
         }
         if ($key =~ m/$defoptkey[A-Z0-9_]*/)
         {
@@ -97,28 +85,18 @@ while (<INFILE>) {
             foreach my $opt (@optlist)
             {
                 my @tmplist = split("=", $opt);
-                $defaultopts = $defaultopts."{".$tmplist[0].",".$tmplist[1]."},";
+                push(@defaultopts, "{".$tmplist[0].",".$tmplist[1]."}");
                 $opts = $opts."|".$tmplist[0]."_MASK";
-                $nropts++;
             }
         }
-        if (length($defaultopts) > 1)
-        {
-            substr($defaultopts,length($defaultopts)-1,1) = '}';
-        }
-        else
-        {
-            $defaultopts = $defaultopts."}";
-        }
         push(@events,{name=>$key,
                 limit=>$limit,
                 eventId=>$eventId,
                 cfg=>0x00,
                 cmask=>0x00,
                 mask=>$umask,
-                nropts=>$nropts,
                 opts=>$opts,
-                defopts=>$defaultopts});
+                defopts=>[@defaultopts]});
         $num_events++;
     }
     elsif (/DEFAULT_OPTIONS_([A-Z0-9_]*)[ ]*([xA-Z0-9_=,]*)/) {
@@ -135,19 +113,85 @@ my $ucArch = uc($arch);
 my $delim;
 $delim = "";
 
+# All names and limits are stored once in a string pool and the default
+# options once in an option pool. The event table only holds offsets into
+# these pools, so it needs no relocations and can be placed in read-only
+# memory. perfmon_init_maps() materializes the PerfmonEvent list only for
+# the architecture of the current system.
+my @strings = ();
+my %string_offsets = ();
+my $string_length = 0;
+my @options = ();
+my %option_offsets = ();
+
+sub string_offset {
+    my $str = shift;
+    if (! exists $string_offsets{$str}) {
+        $string_offsets{$str} = $string_length;
+        push(@strings, $str);
+        $string_length += length($str) + 1;
+    }
+    return $string_offsets{$str};
+}
+
+sub option_offset {
+    my @opts = @_;
+    my $okey = join(",", @opts);
+    if (scalar(@opts) == 0) {
+        return 0;
+    }
+    if (! exists $option_offsets{$okey}) {
+        $option_offsets{$okey} = scalar(@options);
+        push(@options, @opts);
+    }
+    return $option_offsets{$okey};
+}
+
+foreach my $event (@events) {
+    $event->{nameoff} = string_offset($event->{name});
+    $event->{limitoff} = string_offset($event->{limit});
+    $event->{optoff} = option_offset(@{$event->{defopts}});
+    $event->{nropts} = scalar(@{$event->{defopts}});
+}
 
 open OUTFILE,">$OUT_filename";
 print OUTFILE "/* DONT TOUCH: GENERATED FILE! */\n\n";
 print OUTFILE "#define NUM_ARCH_EVENTS_$ucArch $num_events\n\n";
-print OUTFILE "static PerfmonEvent  ".$arch."_arch_events[NUM_ARCH_EVENTS_$ucArch] = {\n";
 
+print OUTFILE "static const char ".$arch."_arch_event_strings[] =\n";
+if (scalar(@strings) == 0) {
+    print OUTFILE "    \"\";\n\n";
+}
+for (my $i = 0; $i < scalar(@strings); $i++) {
+    my $end = ($i == scalar(@strings)-1 ? ";" : "");
+    print OUTFILE "    \"$strings[$i]\\0\"$end\n";
+}
+print OUTFILE "\n";
+
+print OUTFILE "static const PerfmonEventOption ".$arch."_arch_event_options[] = {\n";
+if (scalar(@options) == 0) {
+    print OUTFILE " {EVENT_OPTION_NONE, 0x0}\n";
+}
+foreach my $opt (@options) {
+    print OUTFILE "$delim $opt\n";
+    $delim = ',';
+}
+print OUTFILE "};\n\n";
+
+$delim = "";
+print OUTFILE "static const PerfmonEventEntry ".$arch."_arch_event_entries[NUM_ARCH_EVENTS_$ucArch] = {\n";
 foreach my $event (@events) {
     print OUTFILE <<END;
-$delim {\"$event->{name}\", \"$event->{limit}\", $event->{eventId},$event->{mask},$event->{cfg},$event->{cmask},$event->{nropts},$event->{opts},$event->{defopts}}
+$delim {$event->{nameoff}, $event->{limitoff}, $event->{optoff}, $event->{nropts}, $event->{eventId},$event->{mask},$event->{cfg},$event->{cmask},$event->{opts}}
 END
     $delim = ',';
 }
+print OUTFILE "};\n\n";
 
-print  OUTFILE "};\n";
+print OUTFILE "static const PerfmonEventTable ".$arch."_arch_events = {\n";
+print OUTFILE "    NUM_ARCH_EVENTS_$ucArch,\n";
+print OUTFILE "    ".$arch."_arch_event_strings,\n";
+print OUTFILE "    ".$arch."_arch_event_options,\n";
+print OUTFILE "    ".$arch."_arch_event_entries\n";
+print OUTFILE "};\n";
 close OUTFILE;
-
@@ -51,6 +51,9 @@
 #include <dirent.h>
 #include <sys/mman.h>
 #include <fnmatch.h>
+#include <poll.h>
+#include <pwd.h>
+#include <grp.h>
 
 #include <types.h>
 #include <registers.h>
@@ -152,6 +155,11 @@ static int getBusFromSocket(const uint32_t socket, PciDevice* pcidev, int pathle
 static int sockfd = -1;
 static int connfd = -1; /* temporary in to make it compile */
 static char* filepath;
+static int nodeMode = 0;
+static int nodeExclusive = 0;
+static int nodeShared = 0;
+static int nodeGroupSet = 0;
+static gid_t nodeGroup = 0;
 static const char* ident = "accessD";
 static AllowedPrototype allowed = NULL;
 static AllowedPciPrototype allowedPci = NULL;
@@ -2536,6 +2544,10 @@ stop_daemon(void)
     if (sockfd != -1)
     {
         CHECK_ERROR(close(sockfd), socket close sockfd failed);
+        if (nodeMode)
+        {
+            unlink(filepath);
+        }
     }
 
     free(filepath);
@@ -2616,11 +2628,867 @@ daemonize(int* parentPid)
     }
 }
 
+static void
+open_devices(uint32_t model)
+{
+    int ret;
+    char* msr_file_name = (char*) malloc(MAX_PATH_LENGTH * sizeof(char));
+
+    /* Open MSR device files for less overhead.
+     * NOTICE: This assumes consecutive processor Ids! */
+    for ( uint32_t i=0; i < avail_cpus; i++ )
+    {
+        snprintf(msr_file_name, MAX_PATH_LENGTH-1, "/dev/cpu/%d/msr", i);
+        FD_MSR[i] = open(msr_file_name, O_RDWR);
+
+        if ( FD_MSR[i] < 0 )
+        {
+            syslog(LOG_ERR, "Failed to open device file %s: %s, trying /dev/msr%d", msr_file_name, strerror(errno), i);
+            sprintf(msr_file_name,"/dev/msr%d",i);
+            FD_MSR[i] = open(msr_file_name, O_RDWR);
+            if ( FD_MSR[i] < 0 )
+            {
+                syslog(LOG_ERR, "Failed to open device file %s: %s.", msr_file_name, strerror(errno));
+            }
+        }
+    }
+
+    free(msr_file_name);
+    if (isClientMem)
+    {
+        ret = clientmem_init();
+        if (ret)
+        {
+            syslog(LOG_ERR, "Failed to initialize Intel desktop memory support");
+        }
+    }
+    if (isPCIUncore)
+    {
+        int cntr = 0;
+        int socket_count = 0;
+        if (model == SANDYBRIDGE_EP)
+        {
+            //testDevice = 0x80863c44;
+            pci_devices_daemon = sandybridgeEP_pci_devices;
+        }
+        else if (model == IVYBRIDGE_EP)
+        {
+            //testDevice = 0x80860e36;
+            pci_devices_daemon = ivybridgeEP_pci_devices;
+        }
+        else if (model == HASWELL_EP)
+        {
+            //testDevice = 0x80862f30;
+            pci_devices_daemon = haswellEP_pci_devices;
+        }
+        else if (model == BROADWELL_D)
+        {
+            //testDevice = 0x80862f30;
+            pci_devices_daemon = broadwelld_pci_devices;
+        }
+        else if (model == BROADWELL_E)
+        {
+            //testDevice = 0x80862f30;
+            pci_devices_daemon = broadwellEP_pci_devices;
+        }
+        else if (model == SKYLAKEX)
+        {
+            //testDevice = 0x80862f30;
+            pci_devices_daemon = skylakeX_pci_devices;
+        }
+        else if (model == ICELAKEX1 || model == ICELAKEX2)
+        {
+            pci_devices_daemon = icelakeX_pci_devices;
+        }
+        else if ((model == XEON_PHI_KNL) ||
+                 (model == XEON_PHI_KML))
+        {
+            pci_devices_daemon = knl_pci_devices;
+        }
+        else
+        {
+            //testDevice = 0;
+            syslog(LOG_NOTICE, "PCI Uncore not supported on this system");
+            return;
+        }
+        if (!pci_devices_daemon)
+        {
+            syslog(LOG_NOTICE, "PCI Uncore not supported on this system");
+            return;
+        }
+        if (isServerMem)
+        {
+            ret = servermem_init();
+            if (ret < 0)
+            {
+                syslog(LOG_ERR, "Failed to initialize Intel server memory support");
+            }
+        }
+
+        for (int j=0; j<avail_sockets; j++)
+        {
+            for (int i=0; i<MAX_NUM_PCI_DEVICES; i++)
+            {
+                FD_PCI[j][i] = -2;
+            }
+        }
+
+        for (int i=1; i<MAX_NUM_PCI_DEVICES; i++)
+        {
+            if (pci_devices_daemon && pci_devices_daemon[i].path && strlen(pci_devices_daemon[i].path) > 0)
+            {
+                int socket_id = getBusFromSocket(0, &(pci_devices_daemon[i]), 0, NULL);
+                if (socket_id == 0)
+                {
+                    for (int j=0; j<avail_sockets; j++)
+                    {
+                        FD_PCI[j][i] = 0;
+                    }
+                    pci_devices_daemon[i].online = 1;
+                }
+#ifdef DEBUG_LIKWID
+                else
+                {
+                    syslog(LOG_ERR, "Device %s not found, excluded it from device list\n",pci_devices_daemon[i].name);
+                }
+#endif
+            }
+        }
+    }
+}
+
+static void
+process_request(AccessDataRecord* dRecord)
+{
+    if (dRecord->type == DAEMON_READ)
+    {
+        if (dRecord->device == MSR_DEV)
+        {
+            msr_read(dRecord);
+        }
+        else if (isClientMem)
+        {
+            clientmem_read(dRecord);
+        }
+        else
+        {
+            if (dRecord->device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord->device <= MMIO_IMC_DEVICE_3_CH_1)
+            {
+                servermem_read(dRecord);
+            }
+            else if (dRecord->device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord->device <= MMIO_IMC_DEVICE_3_FREERUN)
+            {
+                servermem_freerun_read(dRecord);
+            }
+            else if (pci_devices_daemon != NULL)
+            {
+                pci_read(dRecord);
+            }
+        }
+    }
+    else if (dRecord->type == DAEMON_WRITE)
+    {
+        if (dRecord->device == MSR_DEV)
+        {
+            msr_write(dRecord);
+            dRecord->data = 0x0ULL;
+        }
+        else
+        {
+            if (dRecord->device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord->device <= MMIO_IMC_DEVICE_3_CH_1)
+            {
+                servermem_write(dRecord);
+                dRecord->data = 0x0ULL;
+            }
+            else if (dRecord->device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord->device <= MMIO_IMC_DEVICE_3_FREERUN)
+            {
+                servermem_freerun_write(dRecord);
+                dRecord->data = 0x0ULL;
+            }
+            else if (pci_devices_daemon != NULL)
+            {
+                pci_write(dRecord);
+                dRecord->data = 0x0ULL;
+            }
+        }
+    }
+    else if (dRecord->type == DAEMON_CHECK)
+    {
+        if (dRecord->device == MSR_DEV)
+        {
+            msr_check(dRecord);
+        }
+        else if (isClientMem)
+        {
+            clientmem_check(dRecord);
+        }
+        else
+        {
+            if (dRecord->device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord->device <= MMIO_IMC_DEVICE_3_CH_1)
+            {
+                servermem_check(dRecord);
+            }
+            else if (dRecord->device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord->device <= MMIO_IMC_DEVICE_3_FREERUN)
+            {
+                servermem_freerun_check(dRecord);
+            }
+            else if (pci_devices_daemon != NULL)
+            {
+                pci_check(dRecord);
+            }
+            
+        }
+    }
+    else
+    {
+        syslog(LOG_ERR, "unknown daemon access type  %d", dRecord->type);
+        dRecord->errorcode = ERR_UNKNOWN;
+    }
+}
+
+/* #####   NODE DAEMON MODE   ################## */
+
+/* With -n the daemon serves all processes of the calling user on this node
+ * through a single socket. Each connection is a session. The first write of a
+ * session to a register saves the current register content and makes the
+ * session the owner of the register. When a session disconnects without
+ * sending DAEMON_EXIT (e.g. the client crashed), the saved contents of all
+ * registers it still owns are restored. With -x the daemon additionally
+ * rejects writes to registers owned by another session.
+ *
+ * One session may declare itself the system session (DAEMON_SYSTEM), e.g. the
+ * node monitor. Sessions connecting while a system session exists are shared
+ * sessions: they never change the hardware. A write of a shared session only
+ * records the difference between the current register content and the
+ * written value, a read returns the register content minus that difference.
+ * Counters written to zero therefore count from zero and configuration
+ * registers read back what the session wrote, so an unmodified client gets
+ * region deltas of the counters programmed by the system session. Each write
+ * of the system session increments a generation number, clients compare it to
+ * detect reprogramming during a measurement. With -s the daemon is started by
+ * root for all users (socket LIKWIDSHAREDSOCKETDIR/node-shared), sessions of other
+ * users are always shared and -G restricts the access to a group. */
+
+#define NODE_MAX_SESSIONS 1024
+#define NODE_IDLE_TIMEOUT 300
+#define NODE_OWNER_EMPTY 0
+#define NODE_OWNER_DELETED -1
+
+typedef struct {
+    uint32_t device;
+    uint32_t cpu;
+    uint32_t reg;
+} RegisterKey;
+
+typedef struct {
+    RegisterKey key;
+    uint64_t saved;
+    int restore;
+    int owner; /* session index + 1 */
+} RegisterOwner;
+
+typedef struct {
+    RegisterKey key;
+    uint64_t offset;
+    int used;
+} SharedRegister;
+
+typedef struct {
+    int fd;
+    pid_t pid;
+    uid_t uid;
+    AccessSessionType role;
+    int numRegs;
+    int maxRegs;
+    RegisterKey* regs;
+    uint32_t sharedSize;
+    uint32_t sharedUsed;
+    SharedRegister* shared;
+} NodeSession;
+
+static NodeSession* nodeSessions = NULL;
+static int nodeActiveSessions = 0;
+static int nodeSystem = -1;
+static uint64_t nodeGeneration = 0;
+static RegisterOwner* ownerTable = NULL;
+static uint32_t ownerTableSize = 0;
+static uint32_t ownerTableUsed = 0;
+
+static RegisterKey
+owner_key(AccessDataRecord* dRecord)
+{
+    RegisterKey key = { .device = (uint32_t)dRecord->device,
+                        .cpu = dRecord->cpu,
+                        .reg = dRecord->reg };
+    return key;
+}
+
+static int
+owner_key_equal(RegisterKey a, RegisterKey b)
+{
+    return a.device == b.device && a.cpu == b.cpu && a.reg == b.reg;
+}
+
+static uint32_t
+owner_hash(RegisterKey key)
+{
+    uint64_t h = ((uint64_t)key.cpu << 32) | (uint64_t)key.reg;
+    h ^= (uint64_t)key.device * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (uint32_t)h;
+}
+
+static RegisterOwner*
+owner_find(RegisterKey key)
+{
+    if (ownerTableSize == 0)
+        return NULL;
+    uint32_t mask = ownerTableSize - 1;
+    uint32_t idx = owner_hash(key) & mask;
+    for (uint32_t i = 0; i < ownerTableSize; i++)
+    {
+        RegisterOwner* o = &ownerTable[(idx + i) & mask];
+        if (o->owner == NODE_OWNER_EMPTY)
+            return NULL;
+        if (o->owner != NODE_OWNER_DELETED && owner_key_equal(o->key, key))
+            return o;
+    }
+    return NULL;
+}
+
+static int
+owner_resize(uint32_t size)
+{
+    RegisterOwner* old = ownerTable;
+    uint32_t oldsize = ownerTableSize;
+    ownerTable = calloc(size, sizeof(RegisterOwner));
+    if (!ownerTable)
+    {
+        ownerTable = old;
+        return -ENOMEM;
+    }
+    ownerTableSize = size;
+    ownerTableUsed = 0;
+    for (uint32_t i = 0; i < oldsize; i++)
+    {
+        if (old[i].owner > 0)
+        {
+            uint32_t idx = owner_hash(old[i].key) & (size - 1);
+            while (ownerTable[idx].owner != NODE_OWNER_EMPTY)
+                idx = (idx + 1) & (size - 1);
+            ownerTable[idx] = old[i];
+            ownerTableUsed++;
+        }
+    }
+    free(old);
+    return 0;
+}
+
+static RegisterOwner*
+owner_insert(RegisterKey key)
+{
+    if (2 * (ownerTableUsed + 1) > ownerTableSize)
+    {
+        if (owner_resize(ownerTableSize ? 2 * ownerTableSize : 1024) < 0)
+            return NULL;
+    }
+    uint32_t mask = ownerTableSize - 1;
+    uint32_t idx = owner_hash(key) & mask;
+    while (ownerTable[idx].owner > 0)
+        idx = (idx + 1) & mask;
+    if (ownerTable[idx].owner == NODE_OWNER_EMPTY)
+        ownerTableUsed++;
+    ownerTable[idx].key = key;
+    return &ownerTable[idx];
+}
+
+static int
+session_add_reg(NodeSession* session, RegisterKey key)
+{
+    if (session->numRegs == session->maxRegs)
+    {
+        int newmax = (session->maxRegs ? 2 * session->maxRegs : 64);
+        RegisterKey* tmp = realloc(session->regs, newmax * sizeof(RegisterKey));
+        if (!tmp)
+            return -ENOMEM;
+        session->regs = tmp;
+        session->maxRegs = newmax;
+    }
+    session->regs[session->numRegs++] = key;
+    return 0;
+}
+
+static void
+node_write(int sid, AccessDataRecord* dRecord)
+{
+    RegisterKey key = owner_key(dRecord);
+    RegisterOwner* o = owner_find(key);
+
+    if (o && o->owner != sid + 1)
+    {
+        if ((nodeExclusive && sid != nodeSystem) || o->owner == nodeSystem + 1)
+        {
+            syslog(LOG_ERR, "Register 0x%x of device %d on %u is owned by process %d",
+                   dRecord->reg, dRecord->device, dRecord->cpu,
+                   nodeSessions[o->owner-1].pid);
+            dRecord->errorcode = ERR_DAEMONBUSY;
+            dRecord->data = 0x0ULL;
+            return;
+        }
+        /* Hand over the register, the saved content stays the one before
+         * the first session touched it */
+        if (session_add_reg(&nodeSessions[sid], key) == 0)
+            o->owner = sid + 1;
+    }
+    else if (!o)
+    {
+        AccessDataRecord saved = *dRecord;
+        saved.type = DAEMON_READ;
+        saved.data = 0x0ULL;
+        process_request(&saved);
+        o = owner_insert(key);
+        if (o)
+        {
+            o->saved = saved.data;
+            o->restore = (saved.errorcode == ERR_NOERROR);
+            o->owner = sid + 1;
+            if (session_add_reg(&nodeSessions[sid], key) < 0)
+            {
+                o->owner = NODE_OWNER_DELETED;
+            }
+        }
+    }
+    process_request(dRecord);
+    if (sid == nodeSystem && dRecord->errorcode == ERR_NOERROR)
+        nodeGeneration++;
+}
+
+static SharedRegister*
+shared_find(NodeSession* session, RegisterKey key, int create)
+{
+    if (create && 2 * (session->sharedUsed + 1) > session->sharedSize)
+    {
+        uint32_t size = (session->sharedSize ? 2 * session->sharedSize : 256);
+        SharedRegister* tmp = calloc(size, sizeof(SharedRegister));
+        if (!tmp)
+            return NULL;
+        for (uint32_t i = 0; i < session->sharedSize; i++)
+        {
+            if (session->shared[i].used)
+            {
+                uint32_t idx = owner_hash(session->shared[i].key) & (size - 1);
+                while (tmp[idx].used)
+                    idx = (idx + 1) & (size - 1);
+                tmp[idx] = session->shared[i];
+            }
+        }
+        free(session->shared);
+        session->shared = tmp;
+        session->sharedSize = size;
+    }
+    if (session->sharedSize == 0)
+        return NULL;
+    uint32_t mask = session->sharedSize - 1;
+    uint32_t idx = owner_hash(key) & mask;
+    while (session->shared[idx].used)
+    {
+        if (owner_key_equal(session->shared[idx].key, key))
+            return &session->shared[idx];
+        idx = (idx + 1) & mask;
+    }
+    if (!create)
+        return NULL;
+    session->shared[idx].used = 1;
+    session->shared[idx].key = key;
+    session->sharedUsed++;
+    return &session->shared[idx];
+}
+
+static void
+node_shared_write(int sid, AccessDataRecord* dRecord)
+{
+    AccessDataRecord current = *dRecord;
+    SharedRegister* r = NULL;
+
+    current.type = DAEMON_READ;
+    current.data = 0x0ULL;
+    process_request(&current);
+    if (current.errorcode != ERR_NOERROR)
+    {
+        dRecord->errorcode = current.errorcode;
+        return;
+    }
+    r = shared_find(&nodeSessions[sid], owner_key(dRecord), 1);
+    if (!r)
+    {
+        dRecord->errorcode = ERR_UNKNOWN;
+        return;
+    }
+    r->offset = current.data - dRecord->data;
+    dRecord->errorcode = ERR_NOERROR;
+}
+
+static void
+node_shared_read(int sid, AccessDataRecord* dRecord)
+{
+    process_request(dRecord);
+    if (dRecord->errorcode == ERR_NOERROR)
+    {
+        SharedRegister* r = shared_find(&nodeSessions[sid], owner_key(dRecord), 0);
+        if (r)
+            dRecord->data -= r->offset;
+    }
+}
+
+static void
+node_claim_system(int sid, AccessDataRecord* dRecord)
+{
+    NodeSession* session = &nodeSessions[sid];
+    dRecord->data = 0x0ULL;
+    if (session->uid != 0 && session->uid != getuid())
+    {
+        syslog(LOG_ERR, "Process %d is not allowed to start a system session", session->pid);
+        dRecord->errorcode = ERR_RESTREG;
+        return;
+    }
+    if (nodeSystem >= 0 && nodeSystem != sid)
+    {
+        syslog(LOG_ERR, "Process %d requests a system session but process %d has it",
+               session->pid, nodeSessions[nodeSystem].pid);
+        dRecord->errorcode = ERR_DAEMONBUSY;
+        return;
+    }
+    if (nodeSystem != sid)
+    {
+        syslog(LOG_INFO, "Process %d started the system session", session->pid);
+        nodeSystem = sid;
+        session->role = SESSION_SYSTEM;
+        nodeGeneration++;
+        free(session->shared);
+        session->shared = NULL;
+        session->sharedSize = 0;
+        session->sharedUsed = 0;
+    }
+    dRecord->errorcode = ERR_NOERROR;
+}
+
+static void
+node_close_session(int sid, int restore)
+{
+    NodeSession* session = &nodeSessions[sid];
+    if (sid == nodeSystem)
+    {
+        syslog(LOG_INFO, "Process %d stopped the system session", session->pid);
+        nodeSystem = -1;
+        nodeGeneration++;
+    }
+    for (int i = 0; i < session->numRegs; i++)
+    {
+        RegisterOwner* o = owner_find(session->regs[i]);
+        if (!o || o->owner != sid + 1)
+            continue;
+        if (restore && o->restore)
+        {
+            AccessDataRecord rec;
+            memset(&rec, 0, sizeof(AccessDataRecord));
+            rec.device = (PciDeviceIndex)o->key.device;
+            rec.cpu = o->key.cpu;
+            rec.reg = o->key.reg;
+            rec.data = o->saved;
+            rec.type = DAEMON_WRITE;
+            process_request(&rec);
+        }
+        o->owner = NODE_OWNER_DELETED;
+    }
+    if (restore && session->numRegs > 0)
+    {
+        syslog(LOG_NOTICE, "Client %d disconnected without exit, restored its registers", session->pid);
+    }
+    close(session->fd);
+    free(session->regs);
+    free(session->shared);
+    memset(session, 0, sizeof(NodeSession));
+    session->fd = -1;
+    nodeActiveSessions--;
+}
+
+/* Users of a shared daemon (-s), optionally only members of the group given
+ * with -G */
+static int
+node_allowed(uid_t uid)
+{
+    struct passwd* pw = NULL;
+    gid_t* groups = NULL;
+    int ngroups = 64;
+    int allowed = 0;
+
+    if (!nodeShared)
+        return 0;
+    if (!nodeGroupSet)
+        return 1;
+    pw = getpwuid(uid);
+    if (!pw)
+        return 0;
+    groups = malloc(ngroups * sizeof(gid_t));
+    if (groups && getgrouplist(pw->pw_name, pw->pw_gid, groups, &ngroups) < 0)
+    {
+        gid_t* tmp = realloc(groups, ngroups * sizeof(gid_t));
+        if (!tmp || getgrouplist(pw->pw_name, pw->pw_gid, tmp, &ngroups) < 0)
+            ngroups = 0;
+        groups = (tmp ? tmp : groups);
+    }
+    for (int i = 0; groups && i < ngroups; i++)
+    {
+        if (groups[i] == nodeGroup)
+        {
+            allowed = 1;
+            break;
+        }
+    }
+    free(groups);
+    return allowed;
+}
+
+static void
+node_accept(void)
+{
+    int fd = accept(sockfd, NULL, NULL);
+    struct ucred cred;
+    socklen_t credlen = sizeof(struct ucred);
+    struct timeval tv = { .tv_sec = 1, .tv_usec = 0 };
+
+    if (fd < 0)
+        return;
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &credlen) < 0 ||
+        (cred.uid != getuid() && cred.uid != 0 && !node_allowed(cred.uid)))
+    {
+        syslog(LOG_ERR, "Rejecting client of foreign user");
+        close(fd);
+        return;
+    }
+    /* A client sending a partial record must not block the other sessions */
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(struct timeval));
+    for (int i = 0; i < NODE_MAX_SESSIONS; i++)
+    {
+        if (nodeSessions[i].fd < 0)
+        {
+            nodeSessions[i].fd = fd;
+            nodeSessions[i].pid = cred.pid;
+            nodeSessions[i].uid = cred.uid;
+            nodeSessions[i].role = SESSION_OWNER;
+            if (nodeSystem >= 0 || (nodeShared && cred.uid != getuid() && cred.uid != 0))
+                nodeSessions[i].role = SESSION_SHARED;
+            nodeActiveSessions++;
+            return;
+        }
+    }
+    syslog(LOG_ERR, "Too many clients, rejecting process %d", cred.pid);
+    close(fd);
+}
+
+/* Records come from clients of other users in shared mode (-s), check the
+ * indices before they are used for the FD_MSR and FD_PCI lookups */
+static int
+node_valid(AccessDataRecord* dRecord)
+{
+    switch (dRecord->type)
+    {
+        case DAEMON_READ:
+        case DAEMON_WRITE:
+        case DAEMON_CHECK:
+        case DAEMON_READ_SYSTEM:
+            break;
+        default:
+            return 1;
+    }
+    if ((uint32_t)dRecord->device >= MAX_NUM_PCI_DEVICES)
+        return 0;
+    if (dRecord->device == MSR_DEV)
+        return dRecord->cpu < (uint32_t)avail_cpus;
+    return dRecord->cpu < (uint32_t)avail_sockets;
+}
+
+static void
+node_serve(int sid)
+{
+    AccessDataRecord dRecord;
+    ssize_t ret = recv(nodeSessions[sid].fd, &dRecord, sizeof(AccessDataRecord), MSG_WAITALL);
+    if (ret != sizeof(AccessDataRecord))
+    {
+        node_close_session(sid, 1);
+        return;
+    }
+    if (dRecord.type == DAEMON_EXIT)
+    {
+        node_close_session(sid, 0);
+        return;
+    }
+    if (!node_valid(&dRecord))
+    {
+        syslog(LOG_ERR, "Process %d sent invalid record for device %d on %u",
+               nodeSessions[sid].pid, dRecord.device, dRecord.cpu);
+        dRecord.data = 0x0ULL;
+        dRecord.errorcode = ERR_NODEV;
+        goto reply;
+    }
+    switch (dRecord.type)
+    {
+        case DAEMON_WRITE:
+            if (nodeSessions[sid].role == SESSION_SHARED)
+                node_shared_write(sid, &dRecord);
+            else
+                node_write(sid, &dRecord);
+            break;
+        case DAEMON_READ:
+            if (nodeSessions[sid].role == SESSION_SHARED)
+                node_shared_read(sid, &dRecord);
+            else
+                process_request(&dRecord);
+            break;
+        case DAEMON_READ_SYSTEM:
+            dRecord.type = DAEMON_READ;
+            process_request(&dRecord);
+            dRecord.type = DAEMON_READ_SYSTEM;
+            break;
+        case DAEMON_SYSTEM:
+            node_claim_system(sid, &dRecord);
+            break;
+        case DAEMON_SESSION:
+            dRecord.data = (uint64_t)nodeSessions[sid].role;
+            dRecord.errorcode = ERR_NOERROR;
+            break;
+        case DAEMON_GENERATION:
+            dRecord.data = nodeGeneration;
+            dRecord.errorcode = ERR_NOERROR;
+            break;
+        default:
+            process_request(&dRecord);
+            break;
+    }
+reply:
+    if (send(nodeSessions[sid].fd, &dRecord, sizeof(AccessDataRecord), MSG_NOSIGNAL) != sizeof(AccessDataRecord))
+    {
+        node_close_session(sid, 1);
+    }
+}
+
+static int
+node_bind(struct sockaddr_un* addr)
+{
+    if (bind(sockfd, (SA*) addr, sizeof(struct sockaddr_un)) == 0)
+        return 0;
+    if (errno != EADDRINUSE)
+        return -errno;
+    /* Check whether the socket file belongs to a running node daemon */
+    int testfd = socket(AF_LOCAL, SOCK_STREAM, 0);
+    if (testfd >= 0 && connect(testfd, (SA*) addr, sizeof(struct sockaddr_un)) == 0)
+    {
+        close(testfd);
+        return -EADDRINUSE;
+    }
+    if (testfd >= 0)
+        close(testfd);
+    unlink(addr->sun_path);
+    if (bind(sockfd, (SA*) addr, sizeof(struct sockaddr_un)) == 0)
+        return 0;
+    return -errno;
+}
+
+/* The shared socket lives in a directory only root can write to. Otherwise
+ * any user could bind the name first and answer the requests of all others. */
+static int
+node_sharedDir(void)
+{
+    struct stat st;
+    const char* dir = TOSTRING(LIKWIDSHAREDSOCKETDIR);
+
+    if (mkdir(dir, S_IRWXU|S_IRGRP|S_IXGRP|S_IROTH|S_IXOTH) < 0 && errno != EEXIST)
+    {
+        syslog(LOG_ERR, "Cannot create socket directory %s: %s", dir, strerror(errno));
+        return -errno;
+    }
+    if (lstat(dir, &st) < 0)
+    {
+        syslog(LOG_ERR, "Cannot stat socket directory %s: %s", dir, strerror(errno));
+        return -errno;
+    }
+    if (!S_ISDIR(st.st_mode) || st.st_uid != 0 || (st.st_mode & (S_IWGRP|S_IWOTH)))
+    {
+        syslog(LOG_ERR, "Socket directory %s must be a directory owned and only writable by root", dir);
+        return -EPERM;
+    }
+    return 0;
+}
+
+static void
+node_loop(void)
+{
+    struct pollfd* fds = malloc((NODE_MAX_SESSIONS + 1) * sizeof(struct pollfd));
+    int* fdsession = malloc((NODE_MAX_SESSIONS + 1) * sizeof(int));
+    nodeSessions = malloc(NODE_MAX_SESSIONS * sizeof(NodeSession));
+    if (!fds || !fdsession || !nodeSessions)
+    {
+        syslog(LOG_ERR, "Failed to allocate session space");
+        stop_daemon();
+    }
+    memset(nodeSessions, 0, NODE_MAX_SESSIONS * sizeof(NodeSession));
+    for (int i = 0; i < NODE_MAX_SESSIONS; i++)
+    {
+        nodeSessions[i].fd = -1;
+    }
+
+    while (1)
+    {
+        int nfds = 1;
+        fds[0].fd = sockfd;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        for (int i = 0; i < NODE_MAX_SESSIONS && nfds <= nodeActiveSessions; i++)
+        {
+            if (nodeSessions[i].fd >= 0)
+            {
+                fds[nfds].fd = nodeSessions[i].fd;
+                fds[nfds].events = POLLIN;
+                fds[nfds].revents = 0;
+                fdsession[nfds] = i;
+                nfds++;
+            }
+        }
+        int ret = poll(fds, nfds, (nodeActiveSessions == 0 ? NODE_IDLE_TIMEOUT * 1000 : -1));
+        if (ret == 0)
+        {
+            syslog(LOG_INFO, "No clients for %d seconds, exiting", NODE_IDLE_TIMEOUT);
+            stop_daemon();
+        }
+        else if (ret < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            syslog(LOG_ERR, "poll() failed: %s", strerror(errno));
+            stop_daemon();
+        }
+        for (int i = 1; i < nfds; i++)
+        {
+            if (fds[i].revents & (POLLIN|POLLHUP|POLLERR))
+            {
+                node_serve(fdsession[i]);
+            }
+        }
+        if (fds[0].revents & POLLIN)
+        {
+            node_accept();
+        }
+    }
+}
+
 /* #####  MAIN FUNCTION DEFINITION   ################## */
 
-int main(void)
+int main(int argc, char* argv[])
 {
     int ret;
+    int c;
     pid_t pid = getpid();
     struct sockaddr_un  addr1;
     socklen_t socklen;
@@ -2636,6 +3504,41 @@ int main(void)
 
     openlog(ident, 0, LOG_USER);
 
+    while ((c = getopt(argc, argv, "nxsG:")) != -1)
+    {
+        switch (c)
+        {
+            case 'n':
+                nodeMode = 1;
+                break;
+            case 'x':
+                nodeExclusive = 1;
+                break;
+            case 's':
+                nodeShared = 1;
+                break;
+            case 'G':
+                {
+                    struct group* grp = getgrnam(optarg);
+                    if (!grp)
+                    {
+                        syslog(LOG_ERR, "Unknown group %s", optarg);
+                        exit(EXIT_FAILURE);
+                    }
+                    nodeGroup = grp->gr_gid;
+                    nodeGroupSet = 1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (nodeShared && (!nodeMode || getuid() != 0))
+    {
+        syslog(LOG_ERR, "A shared node daemon (-s) requires -n and must be started by root");
+        exit(EXIT_FAILURE);
+    }
     if (!lock_check())
     {
         syslog(LOG_ERR,"Access to performance counters is locked.\n");
@@ -2648,7 +3551,7 @@ int main(void)
     }
 
     stat("/run/systemd/system", &stats);
-    if (!S_ISDIR(stats.st_mode)) {
+    if (nodeMode || !S_ISDIR(stats.st_mode)) {
         daemonize(&pid);
     }
 #ifdef DEBUG_LIKWID
@@ -2807,7 +3710,22 @@ int main(void)
 
     /* setup filename for socket */
     filepath = (char*) calloc(sizeof(addr1.sun_path), 1);
-    snprintf(filepath, sizeof(addr1.sun_path), TOSTRING(LIKWIDSOCKETBASE) "-%d", pid);
+    if (nodeShared)
+    {
+        if (node_sharedDir() < 0)
+        {
+            exit(EXIT_FAILURE);
+        }
+        snprintf(filepath, sizeof(addr1.sun_path), TOSTRING(LIKWIDSHAREDSOCKETDIR) "/node-shared");
+    }
+    else if (nodeMode)
+    {
+        snprintf(filepath, sizeof(addr1.sun_path), TOSTRING(LIKWIDSOCKETBASE) "-node-%d", getuid());
+    }
+    else
+    {
+        snprintf(filepath, sizeof(addr1.sun_path), TOSTRING(LIKWIDSOCKETBASE) "-%d", pid);
+    }
 
     /* get a socket */
     LOG_AND_EXIT_IF_ERROR(sockfd = socket(AF_LOCAL, SOCK_STREAM, 0), socket failed);
@@ -2822,6 +3740,48 @@ int main(void)
     oldumask = umask(077);
     CHECK_ERROR(setfsuid(getuid()), setfsuid failed);
 
+    if (nodeMode)
+    {
+        ret = node_bind(&addr1);
+        if (ret == -EADDRINUSE)
+        {
+            syslog(LOG_INFO, "Node daemon already running at %s", filepath);
+            close(sockfd);
+            exit(EXIT_SUCCESS);
+        }
+        else if (ret < 0)
+        {
+            syslog(LOG_ERR, "bind failed: %s", strerror(-ret));
+            exit(EXIT_FAILURE);
+        }
+        LOG_AND_EXIT_IF_ERROR(listen(sockfd, 128), listen failed);
+        if (nodeShared && nodeGroupSet)
+        {
+            LOG_AND_EXIT_IF_ERROR(chown(filepath, -1, nodeGroup), chown failed);
+            LOG_AND_EXIT_IF_ERROR(chmod(filepath, S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP), chmod failed);
+        }
+        else if (nodeShared)
+        {
+            LOG_AND_EXIT_IF_ERROR(chmod(filepath, S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH), chmod failed);
+        }
+        else
+        {
+            LOG_AND_EXIT_IF_ERROR(chmod(filepath, S_IRUSR|S_IWUSR), chmod failed);
+        }
+        (void) umask(oldumask);
+        CHECK_ERROR(setfsuid(geteuid()), setfsuid failed);
+        signal(SIGPIPE, SIG_IGN);
+        {
+            struct sigaction sia;
+            sia.sa_handler = Signal_Handler;
+            sigemptyset(&sia.sa_mask);
+            sia.sa_flags = 0;
+            sigaction(SIGTERM, &sia, NULL);
+        }
+        open_devices(model);
+        node_loop();
+    }
+
     /* bind and listen on socket */
     LOG_AND_EXIT_IF_ERROR(bind(sockfd, (SA*) &addr1, sizeof(addr1)), bind failed);
     LOG_AND_EXIT_IF_ERROR(listen(sockfd, 1), listen failed);
@@ -2863,132 +3823,8 @@ int main(void)
     (void) umask(oldumask);
     CHECK_ERROR(setfsuid(geteuid()), setfsuid failed);
 
-    {
-        char* msr_file_name = (char*) malloc(MAX_PATH_LENGTH * sizeof(char));
-
-        /* Open MSR device files for less overhead.
-         * NOTICE: This assumes consecutive processor Ids! */
-        for ( uint32_t i=0; i < avail_cpus; i++ )
-        {
-            snprintf(msr_file_name, MAX_PATH_LENGTH-1, "/dev/cpu/%d/msr", i);
-            FD_MSR[i] = open(msr_file_name, O_RDWR);
-
-            if ( FD_MSR[i] < 0 )
-            {
-                syslog(LOG_ERR, "Failed to open device file %s: %s, trying /dev/msr%d", msr_file_name, strerror(errno), i);
-                sprintf(msr_file_name,"/dev/msr%d",i);
-                FD_MSR[i] = open(msr_file_name, O_RDWR);
-                if ( FD_MSR[i] < 0 )
-                {
-                    syslog(LOG_ERR, "Failed to open device file %s: %s.", msr_file_name, strerror(errno));
-                }
-            }
-        }
-
-        free(msr_file_name);
-        if (isClientMem)
-        {
-            ret = clientmem_init();
-            if (ret)
-            {
-                syslog(LOG_ERR, "Failed to initialize Intel desktop memory support");
-            }
-        }
-        if (isPCIUncore)
-        {
-            int cntr = 0;
-            int socket_count = 0;
-            if (model == SANDYBRIDGE_EP)
-            {
-                //testDevice = 0x80863c44;
-                pci_devices_daemon = sandybridgeEP_pci_devices;
-            }
-            else if (model == IVYBRIDGE_EP)
-            {
-                //testDevice = 0x80860e36;
-                pci_devices_daemon = ivybridgeEP_pci_devices;
-            }
-            else if (model == HASWELL_EP)
-            {
-                //testDevice = 0x80862f30;
-                pci_devices_daemon = haswellEP_pci_devices;
-            }
-            else if (model == BROADWELL_D)
-            {
-                //testDevice = 0x80862f30;
-                pci_devices_daemon = broadwelld_pci_devices;
-            }
-            else if (model == BROADWELL_E)
-            {
-                //testDevice = 0x80862f30;
-                pci_devices_daemon = broadwellEP_pci_devices;
-            }
-            else if (model == SKYLAKEX)
-            {
-                //testDevice = 0x80862f30;
-                pci_devices_daemon = skylakeX_pci_devices;
-            }
-            else if (model == ICELAKEX1 || model == ICELAKEX2)
-            {
-                pci_devices_daemon = icelakeX_pci_devices;
-            }
-            else if ((model == XEON_PHI_KNL) ||
-                     (model == XEON_PHI_KML))
-            {
-                pci_devices_daemon = knl_pci_devices;
-            }
-            else
-            {
-                //testDevice = 0;
-                syslog(LOG_NOTICE, "PCI Uncore not supported on this system");
-                goto LOOP;
-            }
-            if (!pci_devices_daemon)
-            {
-                syslog(LOG_NOTICE, "PCI Uncore not supported on this system");
-                goto LOOP;
-            }
-            if (isServerMem)
-            {
-                ret = servermem_init();
-                if (ret < 0)
-                {
-                    syslog(LOG_ERR, "Failed to initialize Intel server memory support");
-                }
-            }
-
-            for (int j=0; j<avail_sockets; j++)
-            {
-                for (int i=0; i<MAX_NUM_PCI_DEVICES; i++)
-                {
-                    FD_PCI[j][i] = -2;
-                }
-            }
+    open_devices(model);
 
-            for (int i=1; i<MAX_NUM_PCI_DEVICES; i++)
-            {
-                if (pci_devices_daemon && pci_devices_daemon[i].path && strlen(pci_devices_daemon[i].path) > 0)
-                {
-                    int socket_id = getBusFromSocket(0, &(pci_devices_daemon[i]), 0, NULL);
-                    if (socket_id == 0)
-                    {
-                        for (int j=0; j<avail_sockets; j++)
-                        {
-                            FD_PCI[j][i] = 0;
-                        }
-                        pci_devices_daemon[i].online = 1;
-                    }
-#ifdef DEBUG_LIKWID
-                    else
-                    {
-                        syslog(LOG_ERR, "Device %s not found, excluded it from device list\n",pci_devices_daemon[i].name);
-                    }
-#endif
-                }
-            }
-        }
-    }
-LOOP:
     while (1)
     {
         ret = read(connfd, (void*) &dRecord, sizeof(AccessDataRecord));
@@ -3009,94 +3845,11 @@ LOOP:
         }
 
 
-        if (dRecord.type == DAEMON_READ)
-        {
-            if (dRecord.device == MSR_DEV)
-            {
-                msr_read(&dRecord);
-            }
-            else if (isClientMem)
-            {
-                clientmem_read(&dRecord);
-            }
-            else
-            {
-                if (dRecord.device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord.device <= MMIO_IMC_DEVICE_3_CH_1)
-                {
-                    servermem_read(&dRecord);
-                }
-                else if (dRecord.device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord.device <= MMIO_IMC_DEVICE_3_FREERUN)
-                {
-                    servermem_freerun_read(&dRecord);
-                }
-                else if (pci_devices_daemon != NULL)
-                {
-                    pci_read(&dRecord);
-                }
-            }
-        }
-        else if (dRecord.type == DAEMON_WRITE)
-        {
-            if (dRecord.device == MSR_DEV)
-            {
-                msr_write(&dRecord);
-                dRecord.data = 0x0ULL;
-            }
-            else
-            {
-                if (dRecord.device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord.device <= MMIO_IMC_DEVICE_3_CH_1)
-                {
-                    servermem_write(&dRecord);
-                    dRecord.data = 0x0ULL;
-                }
-                else if (dRecord.device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord.device <= MMIO_IMC_DEVICE_3_FREERUN)
-                {
-                    servermem_freerun_write(&dRecord);
-                    dRecord.data = 0x0ULL;
-                }
-                else if (pci_devices_daemon != NULL)
-                {
-                    pci_write(&dRecord);
-                    dRecord.data = 0x0ULL;
-                }
-            }
-        }
-        else if (dRecord.type == DAEMON_CHECK)
-        {
-            if (dRecord.device == MSR_DEV)
-            {
-                msr_check(&dRecord);
-            }
-            else if (isClientMem)
-            {
-                clientmem_check(&dRecord);
-            }
-            else
-            {
-                if (dRecord.device >= MMIO_IMC_DEVICE_0_CH_0 && dRecord.device <= MMIO_IMC_DEVICE_3_CH_1)
-                {
-                    servermem_check(&dRecord);
-                }
-                else if (dRecord.device >= MMIO_IMC_DEVICE_0_FREERUN && dRecord.device <= MMIO_IMC_DEVICE_3_FREERUN)
-                {
-                    servermem_freerun_check(&dRecord);
-                }
-                else if (pci_devices_daemon != NULL)
-                {
-                    pci_check(&dRecord);
-                }
-                
-            }
-        }
-        else if (dRecord.type == DAEMON_EXIT)
+        if (dRecord.type == DAEMON_EXIT)
         {
             stop_daemon();
         }
-        else
-        {
-            syslog(LOG_ERR, "unknown daemon access type  %d", dRecord.type);
-            dRecord.errorcode = ERR_UNKNOWN;
-        }
+        process_request(&dRecord);
 
         LOG_AND_EXIT_IF_ERROR(write(connfd, (void*) &dRecord, sizeof(AccessDataRecord)), write failed);
     }
@@ -0,0 +1,1199 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  monitorDaemon.c
+ *
+ *      Description:  Node monitoring daemon serving aggregated metrics in the
+ *                    Prometheus text format.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+/* #####   HEADER FILE INCLUDES   ######################################### */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <signal.h>
+#include <syslog.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <math.h>
+#include <time.h>
+#include <ctype.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <likwid.h>
+#include <monitor_types.h>
+
+/* #####   MACROS  -  LOCAL TO THIS SOURCE FILE   ######################### */
+
+#define MONITOR_MAX_GROUPS 32
+#define MONITOR_MAX_CLIENTS 32
+#define MONITOR_REQUEST_LENGTH 2048
+#define MONITOR_CLIENT_TIMEOUT 5.0
+#define MONITOR_DEFAULT_PORT 9110
+#define MONITOR_DEFAULT_SHM "/likwid-monitord"
+#define MONITOR_DEFAULT_INTERVAL 1.0
+
+#define HTTP_HEADER "HTTP/1.0 %s\r\nContent-Type: %s\r\nContent-Length: %lu\r\nConnection: close\r\n\r\n"
+#define PROM_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+/* #####   TYPE DEFINITIONS   ########################################### */
+
+typedef struct {
+    char* data;
+    size_t len;
+    size_t size;
+} MonitorBuffer;
+
+typedef struct {
+    int fd;
+    char request[MONITOR_REQUEST_LENGTH];
+    int reqlen;
+    char* response;
+    size_t resplen;
+    size_t respoff;
+    double since;
+} MonitorClient;
+
+typedef struct {
+    char* name;
+    char* help;
+} MonitorFamily;
+
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
+
+static char* ident = "likwid-monitord";
+static volatile sig_atomic_t run = 1;
+
+static int numGroups = 0;
+static int groupIds[MONITOR_MAX_GROUPS];
+static int activeGroup = 0;
+static int withEvents = 0;
+static int force = 0;
+
+static MonitorShmHeader* shm = NULL;
+static char* shmName = MONITOR_DEFAULT_SHM;
+
+/* Prometheus metric family of each value, families are shared between groups */
+static int* valueFamily = NULL;
+static MonitorFamily* families = NULL;
+static int numFamilies = 0;
+
+static MonitorBuffer page = {NULL, 0, 0};
+static MonitorClient clients[MONITOR_MAX_CLIENTS];
+
+static const char* statNames[MONITOR_NUM_STATS] = {"sum", "min", "max", "avg"};
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
+
+static void
+usage(void)
+{
+    printf("%s -- Version %d.%d.%d\n\n", ident, VERSION, RELEASE, MINORVERSION);
+    printf("Node monitoring daemon. Measures the given performance groups in rotation\n");
+    printf("and serves the per-socket and per-node aggregates in Prometheus text format.\n\n");
+    printf("Options:\n");
+    printf("-h\t\t Help message\n");
+    printf("-g <group>\t Performance group or custom event set, can be given multiple times\n");
+    printf("-c <cpus>\t Hardware threads to measure, default all\n");
+    printf("-t <time>\t Length of a measurement window, e.g. 1s or 500ms, default 1s\n");
+    printf("-p <port>\t Serve on 127.0.0.1:<port>, default %d\n", MONITOR_DEFAULT_PORT);
+    printf("-u <path>\t Serve on the UNIX socket <path> instead of TCP\n");
+    printf("-m <name>\t Name of the shared memory segment, default %s\n", MONITOR_DEFAULT_SHM);
+    printf("-M <0|1>\t Access mode, 0 for direct access, 1 for the access daemon\n");
+    printf("-e\t\t Export the raw event counts in addition to the metrics\n");
+    printf("-s\t\t Register as system session of the node access daemon, jobs\n");
+    printf("\t\t using the Marker API read the counters of the monitor\n");
+    printf("-d\t\t Detach and run in the background\n");
+    printf("-f\t\t Replace the shared memory segment and UNIX socket of a running instance\n");
+    printf("\n");
+    printf("Example:\n");
+    printf("%s -g MEM -g FLOPS_DP -g ENERGY -t 2s\n", ident);
+    printf("curl http://127.0.0.1:%d/metrics\n", MONITOR_DEFAULT_PORT);
+}
+
+static void
+stop_handler(int sig)
+{
+    run = 0;
+}
+
+static double
+monitor_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1E-9;
+}
+
+static double
+monitor_parseTime(const char* str)
+{
+    char* end = NULL;
+    double t = strtod(str, &end);
+    if (end == str || t <= 0)
+    {
+        return -1;
+    }
+    if (strcmp(end, "ms") == 0)
+    {
+        return t * 1E-3;
+    }
+    if (strcmp(end, "us") == 0)
+    {
+        return t * 1E-6;
+    }
+    if (*end == '\0' || strcmp(end, "s") == 0)
+    {
+        return t;
+    }
+    return -1;
+}
+
+static int
+buffer_printf(MonitorBuffer* buf, const char* fmt, ...)
+{
+    va_list ap;
+    int len = 0;
+    for (;;)
+    {
+        size_t avail = buf->size - buf->len;
+        va_start(ap, fmt);
+        len = vsnprintf(buf->data ? buf->data + buf->len : NULL, avail, fmt, ap);
+        va_end(ap);
+        if (len < 0)
+        {
+            return len;
+        }
+        if ((size_t)len < avail)
+        {
+            buf->len += len;
+            return len;
+        }
+        size_t size = (buf->size ? buf->size * 2 : 65536);
+        while (size - buf->len <= (size_t)len)
+            size *= 2;
+        char* tmp = realloc(buf->data, size);
+        if (!tmp)
+        {
+            return -ENOMEM;
+        }
+        buf->data = tmp;
+        buf->size = size;
+    }
+}
+
+/* Escape a label value or help text for the Prometheus text format. */
+static void
+buffer_escape(MonitorBuffer* buf, const char* str, int quotes)
+{
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '\\')
+            buffer_printf(buf, "\\\\");
+        else if (*str == '\n')
+            buffer_printf(buf, "\\n");
+        else if (*str == '"' && quotes)
+            buffer_printf(buf, "\\\"");
+        else
+            buffer_printf(buf, "%c", *str);
+    }
+}
+
+static void
+buffer_value(MonitorBuffer* buf, double value)
+{
+    if (isnan(value))
+        buffer_printf(buf, "NaN\n");
+    else if (isinf(value))
+        buffer_printf(buf, "%sInf\n", (value < 0 ? "-" : "+"));
+    else
+        buffer_printf(buf, "%.17g\n", value);
+}
+
+/* Turn "Memory bandwidth [MBytes/s]" into likwid_memory_bandwidth_mbytes_s */
+static char*
+monitor_familyName(const char* prefix, const char* name)
+{
+    size_t plen = strlen(prefix);
+    char* out = malloc(plen + strlen(name) + 1);
+    int underscore = 1;
+    size_t len = plen;
+    if (!out)
+    {
+        return NULL;
+    }
+    strcpy(out, prefix);
+    for (; *name != '\0'; name++)
+    {
+        if (isalnum((unsigned char)*name))
+        {
+            out[len++] = tolower((unsigned char)*name);
+            underscore = 0;
+        }
+        else if (!underscore)
+        {
+            out[len++] = '_';
+            underscore = 1;
+        }
+    }
+    while (len > plen && out[len-1] == '_')
+        len--;
+    out[len] = '\0';
+    return out;
+}
+
+static MonitorShmGroup*
+shm_group(int g)
+{
+    return &((MonitorShmGroup*)((char*)shm + shm->groupOffset))[g];
+}
+
+static MonitorShmValue*
+shm_value(int g, int v)
+{
+    return &((MonitorShmValue*)((char*)shm + shm->valueOffset))[g * shm->maxValues + v];
+}
+
+static char*
+shm_domain(int d)
+{
+    return (char*)shm + shm->domainOffset + d * MONITOR_DOMAIN_LENGTH;
+}
+
+static double*
+shm_data(int g, int v, int d)
+{
+    double* data = (double*)((char*)shm + shm->dataOffset);
+    return &data[((g * shm->maxValues + v) * shm->numDomains + d) * MONITOR_NUM_STATS];
+}
+
+static int
+monitor_numValues(int g)
+{
+    int metrics = perfmon_getNumberOfMetrics(groupIds[g]);
+    if (metrics <= 0)
+    {
+        return perfmon_getNumberOfEvents(groupIds[g]);
+    }
+    return metrics + (withEvents ? perfmon_getNumberOfEvents(groupIds[g]) : 0);
+}
+
+static int
+monitor_addFamily(const char* name, const char* help)
+{
+    for (int f = 0; f < numFamilies; f++)
+    {
+        if (strcmp(families[f].name, name) == 0)
+        {
+            return f;
+        }
+    }
+    families[numFamilies].name = strdup(name);
+    families[numFamilies].help = strdup(help);
+    return numFamilies++;
+}
+
+/* Create the shared memory segment and fill in everything that does not
+ * change between windows: groups, value names, domains. */
+static int
+monitor_createShm(char** socketNames, int numSockets)
+{
+    int maxValues = 0;
+    int numDomains = numSockets + 1;
+    size_t off = 0;
+    int fd = -1;
+
+    for (int g = 0; g < numGroups; g++)
+    {
+        int n = monitor_numValues(g);
+        if (n > maxValues)
+            maxValues = n;
+    }
+    off = (sizeof(MonitorShmHeader) + 7) & ~7UL;
+    size_t groupOffset = off;
+    off += numGroups * sizeof(MonitorShmGroup);
+    off = (off + 7) & ~7UL;
+    size_t valueOffset = off;
+    off += numGroups * maxValues * sizeof(MonitorShmValue);
+    off = (off + 7) & ~7UL;
+    size_t domainOffset = off;
+    off += numDomains * MONITOR_DOMAIN_LENGTH;
+    off = (off + 7) & ~7UL;
+    size_t dataOffset = off;
+    off += (size_t)numGroups * maxValues * numDomains * MONITOR_NUM_STATS * sizeof(double);
+
+    if (force)
+    {
+        shm_unlink(shmName);
+    }
+    fd = shm_open(shmName, O_RDWR|O_CREAT|O_EXCL, 0644);
+    if (fd < 0)
+    {
+        int err = errno;
+        if (err == EEXIST)
+        {
+            syslog(LOG_ERR, "Shared memory segment %s exists, another instance running? Use -f to replace it\n", shmName);
+        }
+        else
+        {
+            syslog(LOG_ERR, "Cannot create shared memory segment %s: %s\n", shmName, strerror(err));
+        }
+        return -err;
+    }
+    if (ftruncate(fd, off) < 0)
+    {
+        syslog(LOG_ERR, "Cannot resize shared memory segment %s: %s\n", shmName, strerror(errno));
+        close(fd);
+        shm_unlink(shmName);
+        return -errno;
+    }
+    shm = mmap(NULL, off, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm == MAP_FAILED)
+    {
+        syslog(LOG_ERR, "Cannot map shared memory segment %s: %s\n", shmName, strerror(errno));
+        shm = NULL;
+        shm_unlink(shmName);
+        return -ENOMEM;
+    }
+    memset(shm, 0, off);
+    shm->version = MONITOR_SHM_VERSION;
+    shm->size = off;
+    shm->numGroups = numGroups;
+    shm->numDomains = numDomains;
+    shm->maxValues = maxValues;
+    shm->groupOffset = groupOffset;
+    shm->valueOffset = valueOffset;
+    shm->domainOffset = domainOffset;
+    shm->dataOffset = dataOffset;
+
+    valueFamily = malloc(numGroups * maxValues * sizeof(int));
+    families = calloc(numGroups * maxValues, sizeof(MonitorFamily));
+    if (!valueFamily || !families)
+    {
+        return -ENOMEM;
+    }
+    snprintf(shm_domain(0), MONITOR_DOMAIN_LENGTH, "N");
+    for (int s = 0; s < numSockets; s++)
+    {
+        snprintf(shm_domain(s+1), MONITOR_DOMAIN_LENGTH, "%s", socketNames[s]);
+    }
+    for (int g = 0; g < numGroups; g++)
+    {
+        MonitorShmGroup* grp = shm_group(g);
+        int metrics = perfmon_getNumberOfMetrics(groupIds[g]);
+        int events = perfmon_getNumberOfEvents(groupIds[g]);
+        int v = 0;
+        snprintf(grp->name, MONITOR_NAME_LENGTH, "%s", perfmon_getGroupName(groupIds[g]));
+        grp->numValues = monitor_numValues(g);
+        for (int m = 0; m < metrics; m++, v++)
+        {
+            MonitorShmValue* val = shm_value(g, v);
+            char* name = perfmon_getMetricName(groupIds[g], m);
+            char* fam = monitor_familyName("likwid_", name);
+            snprintf(val->name, MONITOR_NAME_LENGTH, "%s", name);
+            val->type = MONITOR_VALUE_METRIC;
+            valueFamily[g * maxValues + v] = monitor_addFamily(fam, name);
+            free(fam);
+        }
+        if (metrics > 0 && !withEvents)
+        {
+            continue;
+        }
+        for (int e = 0; e < events; e++, v++)
+        {
+            MonitorShmValue* val = shm_value(g, v);
+            char* name = perfmon_getEventName(groupIds[g], e);
+            char* fam = monitor_familyName("likwid_event_", name);
+            char help[MONITOR_NAME_LENGTH + 32];
+            snprintf(val->name, MONITOR_NAME_LENGTH, "%s", name);
+            snprintf(val->counter, MONITOR_DOMAIN_LENGTH, "%s", perfmon_getCounterName(groupIds[g], e));
+            val->type = MONITOR_VALUE_EVENT;
+            snprintf(help, sizeof(help), "Count of event %s in the last window", name);
+            valueFamily[g * maxValues + v] = monitor_addFamily(fam, help);
+            free(fam);
+        }
+    }
+    memcpy(shm->magic, MONITOR_SHM_MAGIC, sizeof(shm->magic));
+    return 0;
+}
+
+static void
+monitor_destroyShm(void)
+{
+    if (shm)
+    {
+        munmap(shm, shm->size);
+        shm_unlink(shmName);
+        shm = NULL;
+    }
+    for (int f = 0; f < numFamilies; f++)
+    {
+        free(families[f].name);
+        free(families[f].help);
+    }
+    free(families);
+    free(valueFamily);
+    families = NULL;
+    valueFamily = NULL;
+    numFamilies = 0;
+}
+
+/* Copy the node (domain 0) or socket (domains 1..) statistics of a
+ * reduction into the shared memory segment. */
+static void
+monitor_storeReduction(int g, int first, PerfmonReduction* r, int domainOffset)
+{
+    for (int d = 0; d < r->numDomains && d + domainOffset < shm->numDomains; d++)
+    {
+        for (int v = 0; v < r->numValues; v++)
+        {
+            double* dst = shm_data(g, first + v, d + domainOffset);
+            double* src = &r->stats[(d * r->numValues + v) * NUM_PERFMON_STATS];
+            memcpy(dst, src, MONITOR_NUM_STATS * sizeof(double));
+        }
+    }
+}
+
+/* perfmon_reduce() only takes the socket lock owners into account for
+ * uncore values, so min and avg are not diluted by the zeros of the other
+ * threads. */
+static int
+monitor_publish(int g, double timestamp)
+{
+    static const PerfmonReduceSource sources[2] = {PERFMON_REDUCE_LASTMETRIC, PERFMON_REDUCE_LASTRESULT};
+    static const PerfmonDomainLevel levels[2] = {PERFMON_LEVEL_NODE, PERFMON_LEVEL_SOCKET};
+    PerfmonReduction* red[2][2] = {{NULL, NULL}, {NULL, NULL}};
+    int metrics = perfmon_getNumberOfMetrics(groupIds[g]);
+    int events = (metrics <= 0 || withEvents);
+    int ret = 0;
+
+    for (int s = 0; s < 2 && ret == 0; s++)
+    {
+        if ((s == 0 && metrics <= 0) || (s == 1 && !events))
+        {
+            continue;
+        }
+        for (int l = 0; l < 2 && ret == 0; l++)
+        {
+            ret = perfmon_reduce(groupIds[g], sources[s], levels[l], &red[s][l]);
+        }
+    }
+    if (ret == 0)
+    {
+        MonitorShmGroup* grp = shm_group(g);
+        __sync_fetch_and_add(&shm->seq, 1);
+        __sync_synchronize();
+        for (int s = 0; s < 2; s++)
+        {
+            int first = (s == 0 ? 0 : (metrics > 0 ? metrics : 0));
+            for (int l = 0; l < 2; l++)
+            {
+                if (red[s][l])
+                {
+                    monitor_storeReduction(g, first, red[s][l], (l == 0 ? 0 : 1));
+                }
+            }
+        }
+        grp->windows++;
+        grp->timestamp = timestamp;
+        grp->duration = perfmon_getLastTimeOfGroup(groupIds[g]);
+        grp->numThreads = perfmon_getNumberOfThreads();
+        shm->activeGroup = activeGroup;
+        __sync_synchronize();
+        __sync_fetch_and_add(&shm->seq, 1);
+    }
+    else
+    {
+        syslog(LOG_ERR, "Cannot reduce results of group %s: %s\n", perfmon_getGroupName(groupIds[g]), strerror(-ret));
+    }
+    for (int s = 0; s < 2; s++)
+    {
+        for (int l = 0; l < 2; l++)
+        {
+            perfmon_freeReduction(red[s][l]);
+        }
+    }
+    return ret;
+}
+
+/* Render the page once per window, scrapes only copy it. */
+static void
+monitor_render(void)
+{
+    page.len = 0;
+    buffer_printf(&page, "# HELP likwid_monitor_interval_seconds Length of a measurement window\n");
+    buffer_printf(&page, "# TYPE likwid_monitor_interval_seconds gauge\n");
+    buffer_printf(&page, "likwid_monitor_interval_seconds ");
+    buffer_value(&page, shm->interval);
+    buffer_printf(&page, "# HELP likwid_monitor_windows_total Number of measured windows of a group\n");
+    buffer_printf(&page, "# TYPE likwid_monitor_windows_total counter\n");
+    for (int g = 0; g < numGroups; g++)
+    {
+        buffer_printf(&page, "likwid_monitor_windows_total{group=\"");
+        buffer_escape(&page, shm_group(g)->name, 1);
+        buffer_printf(&page, "\"} %lu\n", shm_group(g)->windows);
+    }
+    buffer_printf(&page, "# HELP likwid_monitor_window_seconds Measured time of the last window of a group\n");
+    buffer_printf(&page, "# TYPE likwid_monitor_window_seconds gauge\n");
+    for (int g = 0; g < numGroups; g++)
+    {
+        if (shm_group(g)->windows == 0)
+            continue;
+        buffer_printf(&page, "likwid_monitor_window_seconds{group=\"");
+        buffer_escape(&page, shm_group(g)->name, 1);
+        buffer_printf(&page, "\"} ");
+        buffer_value(&page, shm_group(g)->duration);
+    }
+    buffer_printf(&page, "# HELP likwid_monitor_window_timestamp_seconds End of the last window of a group\n");
+    buffer_printf(&page, "# TYPE likwid_monitor_window_timestamp_seconds gauge\n");
+    for (int g = 0; g < numGroups; g++)
+    {
+        if (shm_group(g)->windows == 0)
+            continue;
+        buffer_printf(&page, "likwid_monitor_window_timestamp_seconds{group=\"");
+        buffer_escape(&page, shm_group(g)->name, 1);
+        buffer_printf(&page, "\"} %.3f\n", shm_group(g)->timestamp);
+    }
+    for (int f = 0; f < numFamilies; f++)
+    {
+        buffer_printf(&page, "# HELP %s ", families[f].name);
+        buffer_escape(&page, families[f].help, 0);
+        buffer_printf(&page, "\n# TYPE %s gauge\n", families[f].name);
+        for (int g = 0; g < numGroups; g++)
+        {
+            MonitorShmGroup* grp = shm_group(g);
+            if (grp->windows == 0)
+                continue;
+            for (int v = 0; v < grp->numValues; v++)
+            {
+                MonitorShmValue* val = shm_value(g, v);
+                if (valueFamily[g * shm->maxValues + v] != f)
+                    continue;
+                for (int d = 0; d < shm->numDomains; d++)
+                {
+                    double* data = shm_data(g, v, d);
+                    for (int s = 0; s < MONITOR_NUM_STATS; s++)
+                    {
+                        buffer_printf(&page, "%s{group=\"", families[f].name);
+                        buffer_escape(&page, grp->name, 1);
+                        if (val->type == MONITOR_VALUE_EVENT)
+                        {
+                            buffer_printf(&page, "\",counter=\"%s", val->counter);
+                        }
+                        buffer_printf(&page, "\",domain=\"%s\",stat=\"%s\"} ", shm_domain(d), statNames[s]);
+                        buffer_value(&page, data[s]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* End the current window: stop or read the active group, publish its
+ * results and start the next group of the rotation. */
+static int
+monitor_measure(void)
+{
+    int ret = 0;
+    int g = activeGroup;
+    if (numGroups > 1)
+    {
+        activeGroup = (activeGroup + 1) % numGroups;
+        ret = perfmon_switchActiveGroup(groupIds[activeGroup]);
+    }
+    else
+    {
+        ret = perfmon_readCounters();
+    }
+    if (ret < 0)
+    {
+        syslog(LOG_ERR, "Cannot measure group %s: %d\n", perfmon_getGroupName(groupIds[g]), ret);
+        return ret;
+    }
+    ret = monitor_publish(g, monitor_now());
+    if (ret == 0)
+    {
+        monitor_render();
+    }
+    return ret;
+}
+
+/* Remove a stale socket file of a previous instance. Other files are never
+ * removed, a socket in use only with -f. */
+static int
+monitor_claimSocket(struct sockaddr_un* addr)
+{
+    struct stat st;
+    int fd = -1;
+    int live = 0;
+    if (lstat(addr->sun_path, &st) < 0)
+    {
+        return (errno == ENOENT ? 0 : -errno);
+    }
+    if (!S_ISSOCK(st.st_mode))
+    {
+        syslog(LOG_ERR, "%s exists and is no socket\n", addr->sun_path);
+        return -EEXIST;
+    }
+    if (!force)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        live = (fd >= 0 && connect(fd, (struct sockaddr*)addr, sizeof(struct sockaddr_un)) == 0);
+        if (fd >= 0)
+            close(fd);
+        if (live)
+        {
+            syslog(LOG_ERR, "Socket %s is in use, another instance running? Use -f to replace it\n", addr->sun_path);
+            return -EADDRINUSE;
+        }
+    }
+    if (unlink(addr->sun_path) < 0)
+    {
+        return -errno;
+    }
+    return 0;
+}
+
+static int
+monitor_listen(const char* path, int port)
+{
+    int fd = -1;
+    int on = 1;
+    if (path)
+    {
+        struct sockaddr_un addr;
+        if (strlen(path) >= sizeof(addr.sun_path))
+        {
+            syslog(LOG_ERR, "Socket path %s too long\n", path);
+            return -ENAMETOOLONG;
+        }
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, path);
+        if (monitor_claimSocket(&addr) < 0)
+        {
+            return -EADDRINUSE;
+        }
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+    else
+    {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd >= 0)
+        {
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+    if (fd < 0 || listen(fd, MONITOR_MAX_CLIENTS) < 0)
+    {
+        int err = errno;
+        if (path)
+            syslog(LOG_ERR, "Cannot listen on %s: %s\n", path, strerror(err));
+        else
+            syslog(LOG_ERR, "Cannot listen on 127.0.0.1:%d: %s\n", port, strerror(err));
+        if (fd >= 0)
+            close(fd);
+        return -err;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+static void
+client_close(MonitorClient* c)
+{
+    close(c->fd);
+    free(c->response);
+    memset(c, 0, sizeof(MonitorClient));
+    c->fd = -1;
+}
+
+static void
+client_respond(MonitorClient* c, const char* status, const char* type, const char* body, size_t len)
+{
+    char header[256];
+    int hlen = snprintf(header, sizeof(header), HTTP_HEADER, status, type, (unsigned long)len);
+    c->response = malloc(hlen + len);
+    if (!c->response)
+    {
+        client_close(c);
+        return;
+    }
+    memcpy(c->response, header, hlen);
+    memcpy(c->response + hlen, body, len);
+    c->resplen = hlen + len;
+    c->respoff = 0;
+}
+
+static void
+client_read(MonitorClient* c)
+{
+    int ret = recv(c->fd, c->request + c->reqlen, MONITOR_REQUEST_LENGTH - 1 - c->reqlen, 0);
+    if (ret <= 0)
+    {
+        if (ret == 0 || (errno != EAGAIN && errno != EINTR))
+            client_close(c);
+        return;
+    }
+    c->reqlen += ret;
+    c->request[c->reqlen] = '\0';
+    if (!strstr(c->request, "\r\n\r\n") && !strstr(c->request, "\n\n"))
+    {
+        if (c->reqlen >= MONITOR_REQUEST_LENGTH - 1)
+        {
+            const char msg[] = "Request too large\n";
+            client_respond(c, "413 Request Entity Too Large", "text/plain", msg, sizeof(msg)-1);
+        }
+        return;
+    }
+    if (strncmp(c->request, "GET ", 4) != 0)
+    {
+        const char msg[] = "Only GET is supported\n";
+        client_respond(c, "405 Method Not Allowed", "text/plain", msg, sizeof(msg)-1);
+    }
+    else if (strncmp(c->request + 4, "/metrics ", 9) == 0 || strncmp(c->request + 4, "/ ", 2) == 0)
+    {
+        client_respond(c, "200 OK", PROM_CONTENT_TYPE, page.data ? page.data : "", page.len);
+    }
+    else
+    {
+        const char msg[] = "Not found, metrics are served at /metrics\n";
+        client_respond(c, "404 Not Found", "text/plain", msg, sizeof(msg)-1);
+    }
+}
+
+static void
+client_write(MonitorClient* c)
+{
+    int ret = send(c->fd, c->response + c->respoff, c->resplen - c->respoff, MSG_NOSIGNAL);
+    if (ret < 0)
+    {
+        if (errno != EAGAIN && errno != EINTR)
+            client_close(c);
+        return;
+    }
+    c->respoff += ret;
+    if (c->respoff == c->resplen)
+    {
+        client_close(c);
+    }
+}
+
+static void
+monitor_accept(int lfd)
+{
+    int fd = accept(lfd, NULL, NULL);
+    if (fd < 0)
+    {
+        return;
+    }
+    for (int i = 0; i < MONITOR_MAX_CLIENTS; i++)
+    {
+        if (clients[i].fd < 0)
+        {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            clients[i].fd = fd;
+            clients[i].since = monitor_now();
+            return;
+        }
+    }
+    close(fd);
+}
+
+/* Serve clients until the current window ends. */
+static void
+monitor_serve(int lfd, double until)
+{
+    struct pollfd fds[MONITOR_MAX_CLIENTS + 1];
+    int map[MONITOR_MAX_CLIENTS + 1];
+    double now = monitor_now();
+    while (run && now < until)
+    {
+        int n = 0;
+        fds[n].fd = lfd;
+        fds[n].events = POLLIN;
+        fds[n].revents = 0;
+        map[n++] = -1;
+        for (int i = 0; i < MONITOR_MAX_CLIENTS; i++)
+        {
+            if (clients[i].fd < 0)
+                continue;
+            if (now - clients[i].since > MONITOR_CLIENT_TIMEOUT)
+            {
+                client_close(&clients[i]);
+                continue;
+            }
+            fds[n].fd = clients[i].fd;
+            fds[n].events = (clients[i].response ? POLLOUT : POLLIN);
+            fds[n].revents = 0;
+            map[n++] = i;
+        }
+        int timeout = (int)ceil((until - now) * 1000);
+        if (poll(fds, n, timeout) > 0)
+        {
+            for (int i = 1; i < n; i++)
+            {
+                MonitorClient* c = &clients[map[i]];
+                if (fds[i].revents & (POLLERR|POLLNVAL))
+                    client_close(c);
+                else if ((fds[i].revents & POLLOUT) && c->response)
+                    client_write(c);
+                else if (fds[i].revents & (POLLIN|POLLHUP))
+                    client_read(c);
+            }
+            if (fds[0].revents & POLLIN)
+            {
+                monitor_accept(lfd);
+            }
+        }
+        now = monitor_now();
+    }
+}
+
+static int
+monitor_detach(void)
+{
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        return -errno;
+    }
+    if (pid > 0)
+    {
+        exit(EXIT_SUCCESS);
+    }
+    if (setsid() < 0)
+    {
+        return -errno;
+    }
+    if (chdir("/") < 0)
+    {
+        return -errno;
+    }
+    int fd = open("/dev/null", O_RDWR);
+    if (fd >= 0)
+    {
+        dup2(fd, STDIN_FILENO);
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        if (fd > STDERR_FILENO)
+            close(fd);
+    }
+    return 0;
+}
+
+/* #####   MAIN   ######################################################### */
+
+int main(int argc, char* argv[])
+{
+    int c = 0;
+    int ret = 0;
+    int port = MONITOR_DEFAULT_PORT;
+    int detach = 0;
+    int systemSession = 0;
+    int accessMode = -2;
+    int numCPUs = 0;
+    int* cpus = NULL;
+    int lfd = -1;
+    char* cpustr = NULL;
+    char* socketPath = NULL;
+    char* groups[MONITOR_MAX_GROUPS];
+    double interval = MONITOR_DEFAULT_INTERVAL;
+    PerfmonReduction* sockets = NULL;
+    CpuTopology_t cputopo = NULL;
+
+    while ((c = getopt(argc, argv, "hg:c:t:p:u:m:M:esdf")) != -1)
+    {
+        switch (c)
+        {
+            case 'h':
+                usage();
+                return EXIT_SUCCESS;
+            case 'g':
+                if (numGroups == MONITOR_MAX_GROUPS)
+                {
+                    fprintf(stderr, "At most %d groups are supported\n", MONITOR_MAX_GROUPS);
+                    return EXIT_FAILURE;
+                }
+                groups[numGroups++] = optarg;
+                break;
+            case 'c':
+                cpustr = optarg;
+                break;
+            case 't':
+                interval = monitor_parseTime(optarg);
+                if (interval <= 0)
+                {
+                    fprintf(stderr, "Invalid window length %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'p':
+                port = atoi(optarg);
+                if (port <= 0 || port > 65535)
+                {
+                    fprintf(stderr, "Invalid port %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'u':
+                socketPath = optarg;
+                break;
+            case 'm':
+                shmName = optarg;
+                break;
+            case 'M':
+                accessMode = atoi(optarg);
+                if (accessMode != ACCESSMODE_DIRECT && accessMode != ACCESSMODE_DAEMON)
+                {
+                    fprintf(stderr, "Invalid access mode %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'e':
+                withEvents = 1;
+                break;
+            case 's':
+                systemSession = 1;
+                break;
+            case 'd':
+                detach = 1;
+                break;
+            case 'f':
+                force = 1;
+                break;
+            default:
+                usage();
+                return EXIT_FAILURE;
+        }
+    }
+    if (numGroups == 0)
+    {
+        fprintf(stderr, "No group given, use -g <group>\n");
+        return EXIT_FAILURE;
+    }
+    if (systemSession && accessMode == ACCESSMODE_DIRECT)
+    {
+        fprintf(stderr, "A system session (-s) requires the access daemon\n");
+        return EXIT_FAILURE;
+    }
+    if (shmName[0] != '/' || strchr(shmName + 1, '/'))
+    {
+        fprintf(stderr, "Shared memory name must start with / and contain no other /\n");
+        return EXIT_FAILURE;
+    }
+    openlog(ident, (detach ? 0 : LOG_PERROR), LOG_USER);
+    for (int i = 0; i < MONITOR_MAX_CLIENTS; i++)
+    {
+        clients[i].fd = -1;
+    }
+
+    if (topology_init() < 0)
+    {
+        syslog(LOG_ERR, "Failed to initialize topology module\n");
+        return EXIT_FAILURE;
+    }
+    numa_init();
+    affinity_init();
+    cputopo = get_cpuTopology();
+    cpus = malloc(cputopo->numHWThreads * sizeof(int));
+    if (!cpus)
+    {
+        ret = -ENOMEM;
+        goto monitor_exit;
+    }
+    if (cpustr)
+    {
+        numCPUs = cpustr_to_cpulist(cpustr, cpus, cputopo->numHWThreads);
+        if (numCPUs <= 0)
+        {
+            syslog(LOG_ERR, "Invalid CPU selection %s\n", cpustr);
+            ret = -EINVAL;
+            goto monitor_exit;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < cputopo->numHWThreads; i++)
+        {
+            if (cputopo->threadPool[i].inCpuSet)
+            {
+                cpus[numCPUs++] = cputopo->threadPool[i].apicId;
+            }
+        }
+    }
+    if (systemSession)
+    {
+        accessMode = ACCESSMODE_DAEMON;
+        setenv("LIKWID_SYSTEM_SESSION", "1", 1);
+    }
+    if (accessMode != -2)
+    {
+        HPMmode(accessMode);
+    }
+    ret = perfmon_init(numCPUs, cpus);
+    if (ret < 0)
+    {
+        syslog(LOG_ERR, "Failed to initialize perfmon module: %d\n", ret);
+        goto monitor_topo_exit;
+    }
+    for (int g = 0; g < numGroups; g++)
+    {
+        groupIds[g] = perfmon_addEventSet(groups[g]);
+        if (groupIds[g] < 0)
+        {
+            syslog(LOG_ERR, "Failed to add group %s\n", groups[g]);
+            ret = groupIds[g];
+            goto monitor_perfmon_exit;
+        }
+    }
+    ret = perfmon_reduce(groupIds[0], PERFMON_REDUCE_LASTRESULT, PERFMON_LEVEL_SOCKET, &sockets);
+    if (ret < 0)
+    {
+        syslog(LOG_ERR, "Failed to determine the socket domains\n");
+        goto monitor_perfmon_exit;
+    }
+    ret = monitor_createShm(sockets->domainNames, sockets->numDomains);
+    perfmon_freeReduction(sockets);
+    if (ret < 0)
+    {
+        goto monitor_perfmon_exit;
+    }
+    shm->interval = interval;
+    monitor_render();
+
+    lfd = monitor_listen(socketPath, port);
+    if (lfd < 0)
+    {
+        ret = lfd;
+        goto monitor_shm_exit;
+    }
+    if (detach)
+    {
+        ret = monitor_detach();
+        if (ret < 0)
+        {
+            syslog(LOG_ERR, "Failed to detach: %s\n", strerror(-ret));
+            goto monitor_socket_exit;
+        }
+    }
+    signal(SIGINT, stop_handler);
+    signal(SIGTERM, stop_handler);
+    signal(SIGPIPE, SIG_IGN);
+
+    /* The counters are programmed once here. Afterwards, a single group is
+     * only read at the end of each window and multiple groups are rotated
+     * with perfmon_switchActiveGroup which replays the recorded programs. */
+    ret = perfmon_setupCounters(groupIds[activeGroup]);
+    if (ret < 0)
+    {
+        syslog(LOG_ERR, "Failed to setup group %s\n", groups[activeGroup]);
+        goto monitor_socket_exit;
+    }
+    ret = perfmon_startCounters();
+    if (ret < 0)
+    {
+        syslog(LOG_ERR, "Failed to start counters for group %s\n", groups[activeGroup]);
+        goto monitor_socket_exit;
+    }
+    if (socketPath)
+        syslog(LOG_INFO, "Monitoring %d hardware threads with %d group(s), window %g s, serving %s\n",
+                numCPUs, numGroups, interval, socketPath);
+    else
+        syslog(LOG_INFO, "Monitoring %d hardware threads with %d group(s), window %g s, serving 127.0.0.1:%d\n",
+                numCPUs, numGroups, interval, port);
+
+    double next = monitor_now() + interval;
+    while (run)
+    {
+        monitor_serve(lfd, next);
+        if (!run)
+            break;
+        if (monitor_measure() < 0)
+        {
+            ret = -EIO;
+            break;
+        }
+        double now = monitor_now();
+        next += interval;
+        if (next <= now)
+        {
+            next = now + interval;
+        }
+    }
+    perfmon_stopCounters();
+monitor_socket_exit:
+    for (int i = 0; i < MONITOR_MAX_CLIENTS; i++)
+    {
+        if (clients[i].fd >= 0)
+            client_close(&clients[i]);
+    }
+    close(lfd);
+    if (socketPath)
+    {
+        unlink(socketPath);
+    }
+monitor_shm_exit:
+    monitor_destroyShm();
+monitor_perfmon_exit:
+    perfmon_finalize();
+monitor_topo_exit:
+    affinity_finalize();
+    numa_finalize();
+    topology_finalize();
+monitor_exit:
+    free(cpus);
+    free(page.data);
+    closelog();
+    return (ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -664,6 +664,86 @@ static int freq_write(FreqDataRecord *rec)
 }
 
 
+static int read_full(int fd, void* buf, size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        int ret = read(fd, ((char*)buf) + done, len - done);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0)
+        {
+            return -1;
+        }
+        done += ret;
+    }
+    return 0;
+}
+
+static int freq_batch(FreqBatchRecord *batch)
+{
+    FreqDataRecord rec;
+    int failed = 0;
+
+    if (batch->numCpus > LIKWID_FREQUENCY_MAX_BATCH_CPUS)
+        batch->numCpus = LIKWID_FREQUENCY_MAX_BATCH_CPUS;
+    if (batch->numEntries > LIKWID_FREQUENCY_MAX_BATCH_ENTRIES)
+        batch->numEntries = LIKWID_FREQUENCY_MAX_BATCH_ENTRIES;
+    memset(batch->errorcodes, FREQ_ERR_NONE, sizeof(batch->errorcodes));
+
+    for (int i = 0; i < batch->numCpus; i++)
+    {
+        int cpu = batch->cpus[i];
+        int retry = 0;
+        if (cpu < 0 || cpu >= avail_cpus)
+        {
+            for (int j = 0; j < batch->numEntries; j++)
+                batch->errorcodes[i][j] = FREQ_ERR_NOFILE;
+            failed++;
+            continue;
+        }
+        /* Entries are applied in the given order. Writes that fail are
+         * retried once after the remaining entries of the CPU, so that e.g.
+         * raising the minimum above the current maximum succeeds if the
+         * maximum is raised in the same batch. */
+        for (int j = 0; j < batch->numEntries; j++)
+        {
+            memset(&rec, 0, sizeof(FreqDataRecord));
+            rec.cpu = cpu;
+            rec.type = FREQ_WRITE;
+            rec.loc = batch->entries[j].loc;
+            rec.datalen = batch->entries[j].datalen;
+            memcpy(rec.data, batch->entries[j].data, LIKWID_FREQUENCY_MAX_DATA_LENGTH);
+            freq_write(&rec);
+            batch->errorcodes[i][j] = rec.errorcode;
+            if (rec.errorcode != FREQ_ERR_NONE)
+                retry = 1;
+        }
+        if (retry)
+        {
+            for (int j = 0; j < batch->numEntries; j++)
+            {
+                if (batch->errorcodes[i][j] == FREQ_ERR_NONE)
+                    continue;
+                memset(&rec, 0, sizeof(FreqDataRecord));
+                rec.cpu = cpu;
+                rec.type = FREQ_WRITE;
+                rec.loc = batch->entries[j].loc;
+                rec.datalen = batch->entries[j].datalen;
+                memcpy(rec.data, batch->entries[j].data, LIKWID_FREQUENCY_MAX_DATA_LENGTH);
+                freq_write(&rec);
+                batch->errorcodes[i][j] = rec.errorcode;
+                if (rec.errorcode != FREQ_ERR_NONE)
+                    failed++;
+            }
+        }
+    }
+    return -failed;
+}
+
 /* #####  MAIN FUNCTION DEFINITION   ################## */
 
 int main(void)
@@ -671,6 +751,7 @@ int main(void)
     int ret;
     pid_t pid;
     FreqDataRecord dRecord;
+    FreqBatchRecord bRecord;
     struct sockaddr_un  addr1;
     socklen_t socklen;
     mode_t oldumask;
@@ -799,6 +880,17 @@ LOOP:
         {
             freq_write(&dRecord);
         }
+        else if (dRecord.type == FREQ_BATCH)
+        {
+            if (read_full(connfd, (void*) &bRecord, sizeof(FreqBatchRecord)) < 0)
+            {
+                syslog(LOG_ERR, "ERROR - [%s:%d] incomplete batch record", __FILE__, __LINE__);
+                stop_daemon();
+            }
+            freq_batch(&bRecord);
+            LOG_AND_EXIT_IF_ERROR(write(connfd, (void*) &bRecord, sizeof(FreqBatchRecord)), write failed);
+            continue;
+        }
         else if (dRecord.type == FREQ_EXIT)
         {
             stop_daemon();
@@ -52,6 +52,7 @@
 #include <access.h>
 #include <access_client.h>
 #include <access_x86.h>
+#include <access_sim.h>
 
 
 /* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
@@ -64,12 +65,118 @@ static int (*access_init) (int cpu_id) = NULL;
 static void (*access_finalize) (int cpu_id) = NULL;
 static int (*access_check) (PciDeviceIndex dev, int cpu_id) = NULL;
 
+/* Last value written to each register, kept per CPU in a small open
+ * addressing table. Used to skip unchanged configuration registers when
+ * replaying register programs. */
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+    int valid;
+} HPMShadowEntry;
+
+typedef struct {
+    uint32_t size;
+    uint32_t used;
+    HPMShadowEntry* entries;
+} HPMShadow;
+
+#define HPM_SHADOW_INITSIZE 256
+
+static HPMShadow* shadowTables = NULL;
+static HPMProgram** recordPrograms = NULL;
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
+
+static inline uint64_t
+shadow_key(PciDeviceIndex dev, uint32_t reg)
+{
+    return ((((uint64_t)dev) << 32) | reg) + 1;
+}
+
+static HPMShadowEntry*
+shadow_find(int cpu_id, uint64_t key, int create)
+{
+    HPMShadow* t = NULL;
+    uint32_t i = 0, idx = 0;
+    if (!shadowTables)
+    {
+        return NULL;
+    }
+    t = &shadowTables[cpu_id];
+    if (create && (t->used + 1) * 2 > t->size)
+    {
+        uint32_t newsize = (t->size ? t->size * 2 : HPM_SHADOW_INITSIZE);
+        HPMShadowEntry* newentries = calloc(newsize, sizeof(HPMShadowEntry));
+        if (!newentries)
+        {
+            return NULL;
+        }
+        for (i = 0; i < t->size; i++)
+        {
+            if (t->entries[i].key)
+            {
+                idx = (uint32_t)((t->entries[i].key * 0x9E3779B97F4A7C15ULL) >> 32) & (newsize - 1);
+                while (newentries[idx].key)
+                    idx = (idx + 1) & (newsize - 1);
+                newentries[idx] = t->entries[i];
+            }
+        }
+        free(t->entries);
+        t->entries = newentries;
+        t->size = newsize;
+    }
+    if (t->size == 0)
+    {
+        return NULL;
+    }
+    idx = (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & (t->size - 1);
+    while (t->entries[idx].key)
+    {
+        if (t->entries[idx].key == key)
+        {
+            return &t->entries[idx];
+        }
+        idx = (idx + 1) & (t->size - 1);
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    t->entries[idx].key = key;
+    t->entries[idx].valid = 0;
+    t->used++;
+    return &t->entries[idx];
+}
+
+static int
+program_append(HPMProgram* prog, PciDeviceIndex dev, uint32_t reg, uint64_t data)
+{
+    if (prog->numWrites == prog->maxWrites)
+    {
+        int newmax = (prog->maxWrites ? prog->maxWrites * 2 : 32);
+        HPMRegWrite* tmp = realloc(prog->writes, newmax * sizeof(HPMRegWrite));
+        if (!tmp)
+        {
+            return -ENOMEM;
+        }
+        prog->writes = tmp;
+        prog->maxWrites = newmax;
+    }
+    prog->writes[prog->numWrites].dev = dev;
+    prog->writes[prog->numWrites].reg = reg;
+    prog->writes[prog->numWrites].data = data;
+    prog->writes[prog->numWrites].config = 0;
+    prog->numWrites++;
+    return 0;
+}
+
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
 
 void
 HPMmode(int mode)
 {
-    if ((mode == ACCESSMODE_DIRECT) || (mode == ACCESSMODE_DAEMON) || (mode == ACCESSMODE_PERF))
+    if ((mode == ACCESSMODE_DIRECT) || (mode == ACCESSMODE_DAEMON) ||
+        (mode == ACCESSMODE_PERF) || (mode == ACCESSMODE_SIM))
     {
         config.daemonMode = mode;
     }
@@ -86,6 +193,24 @@ HPMinit(void)
         memset(registeredCpuList, 0, cpuid_topology.numHWThreads* sizeof(int));
         registeredCpus = 0;
     }
+    if (shadowTables == NULL)
+    {
+        shadowTables = calloc(cpuid_topology.numHWThreads, sizeof(HPMShadow));
+        recordPrograms = calloc(cpuid_topology.numHWThreads, sizeof(HPMProgram*));
+    }
+    if (getenv("LIKWID_SIM") != NULL)
+    {
+        config.daemonMode = ACCESSMODE_SIM;
+    }
+    if (access_init == NULL && config.daemonMode == ACCESSMODE_SIM)
+    {
+        DEBUG_PLAIN_PRINT(DEBUGLEV_DEVELOP, Adjusting functions for simulated registers);
+        access_init = &access_sim_init;
+        access_read = &access_sim_read;
+        access_write = &access_sim_write;
+        access_finalize = &access_sim_finalize;
+        access_check = &access_sim_check;
+    }
     if (access_init == NULL)
     {
 #if defined(__x86_64__) || defined(__i386__)
@@ -112,6 +237,14 @@ HPMinit(void)
             access_check = &access_x86_check;
         }
 #endif
+        /* Write a register trace of the real backend for the simulation */
+        if ((access_read != NULL) && (getenv("LIKWID_SIM_RECORD") != NULL) &&
+            (access_sim_recordInit(getenv("LIKWID_SIM_RECORD"), access_read, access_write, access_check) == 0))
+        {
+            access_read = &access_sim_recordRead;
+            access_write = &access_sim_recordWrite;
+            access_check = &access_sim_recordCheck;
+        }
     }
 
     return 0;
@@ -177,6 +310,22 @@ HPMfinalize()
         registeredCpuList = NULL;
         registeredCpus = 0;
     }
+    if (shadowTables)
+    {
+        for (int i = 0; i < cpuid_topology.numHWThreads; i++)
+        {
+            free(shadowTables[i].entries);
+        }
+        free(shadowTables);
+        shadowTables = NULL;
+    }
+    if (recordPrograms)
+    {
+        free(recordPrograms);
+        recordPrograms = NULL;
+    }
+    if (access_read == &access_sim_recordRead)
+        access_sim_recordFinalize();
     if (access_init != NULL)
         access_init = NULL;
     if (access_finalize != NULL)
@@ -231,6 +380,19 @@ HPMwrite(int cpu_id, PciDeviceIndex dev, uint32_t reg, uint64_t data)
         return -ENODEV;
     }
     err = access_write(dev, cpu_id, reg, data);
+    if (shadowTables)
+    {
+        HPMShadowEntry* e = shadow_find(cpu_id, shadow_key(dev, reg), 1);
+        if (e)
+        {
+            e->value = data;
+            e->valid = (err == 0);
+        }
+    }
+    if (err == 0 && recordPrograms && recordPrograms[cpu_id])
+    {
+        program_append(recordPrograms[cpu_id], dev, reg, data);
+    }
     return err;
 }
 
@@ -243,3 +405,119 @@ HPMcheck(PciDeviceIndex dev, int cpu_id)
     }
     return access_check(dev, cpu_id);
 }
+
+int
+HPMrecordProgram(int cpu_id, HPMProgram* prog)
+{
+    if ((cpu_id < 0) || (cpu_id >= cpuid_topology.numHWThreads) || (!recordPrograms))
+    {
+        return -ERANGE;
+    }
+    if (prog)
+    {
+        prog->numWrites = 0;
+    }
+    recordPrograms[cpu_id] = prog;
+    return 0;
+}
+
+int
+HPMapplyProgram(int cpu_id, HPMProgram* prog, int skipUnchanged)
+{
+    int i = 0;
+    int err = 0;
+    int written = 0;
+    if ((cpu_id < 0) || (cpu_id >= cpuid_topology.numHWThreads))
+    {
+        return -ERANGE;
+    }
+    if (!prog)
+    {
+        return -EINVAL;
+    }
+    for (i = 0; i < prog->numWrites; i++)
+    {
+        HPMRegWrite* w = &prog->writes[i];
+        if (skipUnchanged && w->config)
+        {
+            HPMShadowEntry* e = shadow_find(cpu_id, shadow_key(w->dev, w->reg), 0);
+            if (e && e->valid && e->value == w->data)
+            {
+                continue;
+            }
+        }
+        err = HPMwrite(cpu_id, w->dev, w->reg, w->data);
+        if (err < 0)
+        {
+            return err;
+        }
+        written++;
+    }
+    DEBUG_PRINT(DEBUGLEV_DEVELOP, Register program on CPU %d: %d of %d writes issued,
+                cpu_id, written, prog->numWrites);
+    return written;
+}
+
+void
+HPMfreeProgram(HPMProgram* prog)
+{
+    if (prog)
+    {
+        free(prog->writes);
+        prog->writes = NULL;
+        prog->numWrites = 0;
+        prog->maxWrites = 0;
+    }
+}
+
+/* Shared sessions of the node access daemon do not program the hardware, they
+ * see the counters of the system session. The other access modes always own
+ * the registers they write. */
+int
+HPMshared(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (config.daemonMode == ACCESSMODE_DAEMON && registeredCpus > 0)
+    {
+        return (access_client_session() == SESSION_SHARED);
+    }
+#endif
+    return 0;
+}
+
+int
+HPMreadSystem(int cpu_id, PciDeviceIndex dev, uint32_t reg, uint64_t* data)
+{
+    if ((dev >= MAX_NUM_PCI_DEVICES) || (data == NULL))
+    {
+        return -EFAULT;
+    }
+    if ((cpu_id < 0) || (cpu_id >= cpuid_topology.numHWThreads))
+    {
+        return -ERANGE;
+    }
+    if (registeredCpuList[cpu_id] == 0)
+    {
+        return -ENODEV;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    if (config.daemonMode == ACCESSMODE_DAEMON)
+    {
+        return access_client_readSystem(dev, cpu_id, reg, data);
+    }
+#endif
+    return access_read(dev, cpu_id, reg, data);
+}
+
+int
+HPMgeneration(uint64_t* generation)
+{
+    *generation = 0x0ULL;
+#if defined(__x86_64__) || defined(__i386__)
+    if (config.daemonMode == ACCESSMODE_DAEMON && registeredCpus > 0)
+    {
+        return access_client_generation(generation);
+    }
+#endif
+    return 0;
+}
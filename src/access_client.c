@@ -70,6 +70,11 @@ static pid_t *daemon_pids = NULL;
 static int *daemon_pinned = NULL;
 static pthread_mutex_t globalLock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t *cpuLocks = NULL;
+static int nodeSocket = -1;
+static int nodeChecked = 0;
+static int nodeUsers = 0;
+static int *nodeCpus = NULL;
+static AccessSessionType nodeRole = SESSION_OWNER;
 
 /* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
 void __attribute__((destructor (104))) close_access_client(void);
@@ -232,11 +237,245 @@ access_client_startDaemon(int cpu_id)
     return socket_fd;
 }
 
+/* A node daemon (likwid-accessD -n) serves all processes of a user on the
+ * node through one socket. If it is running, all requests of this process are
+ * sent over a single connection instead of starting a daemon per CPU. A
+ * shared node daemon (likwid-accessD -n -s) serves all users and is preferred
+ * if present. The socket names are predictable, so the peer must be root or,
+ * for the node daemon of the user, the user itself. */
+static int
+access_client_connectNode(int shared)
+{
+    struct sockaddr_un address;
+    struct ucred cred;
+    socklen_t credlen = sizeof(struct ucred);
+    int socket_fd = socket(AF_LOCAL, SOCK_STREAM, 0);
+    if (socket_fd < 0)
+    {
+        return -errno;
+    }
+    memset(&address, 0, sizeof(struct sockaddr_un));
+    address.sun_family = AF_LOCAL;
+    if (shared)
+    {
+        snprintf(address.sun_path, sizeof(address.sun_path), TOSTRING(LIKWIDSHAREDSOCKETDIR) "/node-shared");
+    }
+    else
+    {
+        snprintf(address.sun_path, sizeof(address.sun_path), TOSTRING(LIKWIDSOCKETBASE) "-node-%d", getuid());
+    }
+    if (connect(socket_fd, (struct sockaddr *) &address, sizeof(struct sockaddr_un)) != 0)
+    {
+        close(socket_fd);
+        return -ENOENT;
+    }
+    if (getsockopt(socket_fd, SOL_SOCKET, SO_PEERCRED, &cred, &credlen) < 0 ||
+        (cred.uid != 0 && (shared || cred.uid != getuid())))
+    {
+        ERROR_PRINT(Ignoring node daemon socket %s of foreign user, address.sun_path);
+        close(socket_fd);
+        return -EPERM;
+    }
+    DEBUG_PRINT(DEBUGLEV_INFO, Connected to node daemon at %s, address.sun_path);
+    return socket_fd;
+}
+
+static int
+access_client_startNodeDaemon(int shared)
+{
+    int socket_fd = -1;
+    int timeout = 1000;
+    int status = 0;
+    char *safeexeprog = TOSTRING(ACCESSDAEMON);
+    char exeprog[1024];
+    char *newargv[] = { exeprog, "-n", (shared ? "-s" : NULL), NULL };
+    char *newenv[] = { NULL };
+    pid_t pid;
+
+    if (config.daemonPath != NULL)
+    {
+        strcpy(exeprog, config.daemonPath);
+    }
+    else
+    {
+        strcpy(exeprog, safeexeprog);
+    }
+    if (access(exeprog, X_OK))
+    {
+        ERROR_PRINT(Failed to find the daemon '%s'\n, exeprog);
+        return -ENOENT;
+    }
+    DEBUG_PRINT(DEBUGLEV_INFO, Starting node daemon %s, exeprog);
+    pid = fork();
+    if (pid == 0)
+    {
+        execve(exeprog, newargv, newenv);
+        ERROR_PRINT(Failed to execute the daemon '%s'\n, exeprog);
+        exit(EXIT_FAILURE);
+    }
+    else if (pid < 0)
+    {
+        ERROR_PRINT(Failed to fork node access daemon);
+        return pid;
+    }
+    /* The daemon detaches itself, so this returns quickly */
+    waitpid(pid, &status, 0);
+    socket_fd = access_client_connectNode(shared);
+    while (socket_fd < 0 && socket_fd != -EPERM && timeout > 0)
+    {
+        usleep(2500);
+        socket_fd = access_client_connectNode(shared);
+        timeout--;
+    }
+    return socket_fd;
+}
+
+/* Sends a request without CPU affinity over the node socket, the caller holds
+ * globalLock */
+static int
+access_client_nodeRequest(AccessType type, AccessDataRecord* record)
+{
+    record->type = type;
+    record->errorcode = ERR_OPENFAIL;
+    CHECK_ERROR(write(nodeSocket, record, sizeof(AccessDataRecord)), socket write failed);
+    CHECK_ERROR(read(nodeSocket, record, sizeof(AccessDataRecord)), socket read failed);
+    return access_client_errno(record->errorcode);
+}
+
+/* With LIKWID_SYSTEM_SESSION set, the process becomes the system session of
+ * the node daemon. Otherwise it gets the role the daemon assigns, a shared
+ * session if a system session already exists. */
+static int
+access_client_initSession(void)
+{
+    int ret = 0;
+    AccessDataRecord record;
+
+    memset(&record, 0, sizeof(AccessDataRecord));
+    nodeRole = SESSION_OWNER;
+    if (getenv("LIKWID_SYSTEM_SESSION") != NULL)
+    {
+        ret = access_client_nodeRequest(DAEMON_SYSTEM, &record);
+        if (ret < 0)
+        {
+            ERROR_PRINT(Cannot start system session: %s, access_client_strerror(record.errorcode));
+            return ret;
+        }
+    }
+    memset(&record, 0, sizeof(AccessDataRecord));
+    if (access_client_nodeRequest(DAEMON_SESSION, &record) == 0)
+    {
+        nodeRole = (AccessSessionType)record.data;
+    }
+    if (nodeRole == SESSION_SHARED)
+    {
+        DEBUG_PLAIN_PRINT(DEBUGLEV_INFO, Using counters of the system session of the node daemon);
+    }
+    return 0;
+}
+
+static int
+access_client_initNode(int cpu_id)
+{
+    int ret = 0;
+    pthread_mutex_lock(&globalLock);
+    if (!nodeChecked)
+    {
+        int system = (getenv("LIKWID_SYSTEM_SESSION") != NULL);
+        nodeChecked = 1;
+        nodeSocket = access_client_connectNode(1);
+        if (nodeSocket < 0)
+        {
+            nodeSocket = access_client_connectNode(0);
+        }
+        if (nodeSocket < 0 && (system || getenv("LIKWID_NODE_DAEMON") != NULL))
+        {
+            nodeSocket = access_client_startNodeDaemon(system && getuid() == 0);
+            if (nodeSocket < 0)
+            {
+                DEBUG_PRINT(DEBUGLEV_INFO, Cannot start node daemon. Falling back to daemon per CPU);
+            }
+        }
+        if (nodeSocket >= 0)
+        {
+            ret = access_client_initSession();
+            if (ret < 0)
+            {
+                close(nodeSocket);
+                nodeSocket = -1;
+            }
+        }
+        else if (system)
+        {
+            ERROR_PLAIN_PRINT(System sessions require the node access daemon);
+            ret = -ENOENT;
+        }
+    }
+    if (nodeSocket >= 0 && !nodeCpus[cpu_id])
+    {
+        nodeCpus[cpu_id] = 1;
+        nodeUsers++;
+    }
+    pthread_mutex_unlock(&globalLock);
+    if (ret < 0)
+    {
+        return ret;
+    }
+    return (nodeSocket >= 0 ? 0 : -ENOENT);
+}
+
+/* Selects the socket and the lock for requests to cpu_id and starts and pins
+ * a daemon for the CPU if required */
+static void
+access_client_getSocket(const int cpu_id, int* socket, pthread_mutex_t** lockptr)
+{
+    *socket = globalSocket;
+    *lockptr = &globalLock;
+    if (nodeSocket >= 0)
+    {
+        *socket = nodeSocket;
+        return;
+    }
+    if (cpuSockets[cpu_id] < 0 && gettid() != masterPid)
+    {
+        pthread_mutex_lock(&cpuLocks[cpu_id]);
+        cpuSockets[cpu_id] = access_client_startDaemon(cpu_id);
+        cpuSockets_open++;
+        if (!daemon_pinned[cpu_id])
+        {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(cpu_id, &cpuset);
+            DEBUG_PRINT(DEBUGLEV_INFO, Pinning daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
+            sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
+            daemon_pinned[cpu_id] = 1;
+        }
+        pthread_mutex_unlock(&cpuLocks[cpu_id]);
+    }
+    else if (cpuSockets[cpu_id] > 0 && gettid() == masterPid &&
+             cpuSockets_open > 1 && !daemon_pinned[cpu_id])
+    {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu_id, &cpuset);
+        DEBUG_PRINT(DEBUGLEV_INFO, Pinning master daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
+        sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
+        daemon_pinned[cpu_id] = 1;
+    }
+
+    if ((cpuSockets[cpu_id] >= 0) && (cpuSockets[cpu_id] != globalSocket))
+    {
+        *socket = cpuSockets[cpu_id];
+        *lockptr = &cpuLocks[cpu_id];
+    }
+}
+
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
 
 int
 access_client_init(int cpu_id)
 {
+    int ret = 0;
     topology_init();
     numa_init();
     affinity_init();
@@ -260,9 +499,19 @@ access_client_init(int cpu_id)
             pthread_mutex_init(&cpuLocks[i], NULL);
         }
     }
+    if (!nodeCpus)
+    {
+        nodeCpus = malloc(cpuid_topology.numHWThreads * sizeof(int));
+        memset(nodeCpus, 0, cpuid_topology.numHWThreads * sizeof(int));
+    }
 #if defined(__x86_64__) || defined(__i386__)
     access_x86_rdpmc_init(cpu_id);
 #endif
+    ret = access_client_initNode(cpu_id);
+    if (ret != -ENOENT)
+    {
+        return ret;
+    }
     if (masterPid != 0 && gettid() == masterPid)
     {
         return 0;
@@ -303,43 +552,12 @@ access_client_read(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t
     record.device = MSR_DEV;
     record.errorcode = ERR_OPENFAIL;
 
-    if (cpuSockets_open == 0)
+    if (cpuSockets_open == 0 && nodeSocket < 0)
     {
         return -ENOENT;
     }
 
-    if (cpuSockets[cpu_id] < 0 && gettid() != masterPid)
-    {
-        pthread_mutex_lock(&cpuLocks[cpu_id]);
-        cpuSockets[cpu_id] = access_client_startDaemon(cpu_id);
-        cpuSockets_open++;
-        if (!daemon_pinned[cpu_id])
-        {
-            cpu_set_t cpuset;
-            CPU_ZERO(&cpuset);
-            CPU_SET(cpu_id, &cpuset);
-            DEBUG_PRINT(DEBUGLEV_INFO, Pinning daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
-            sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
-            daemon_pinned[cpu_id] = 1;
-        }
-        pthread_mutex_unlock(&cpuLocks[cpu_id]);
-    }
-    else if (cpuSockets[cpu_id] > 0 && gettid() == masterPid &&
-             cpuSockets_open > 1 && !daemon_pinned[cpu_id])
-    {
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        CPU_SET(cpu_id, &cpuset);
-        DEBUG_PRINT(DEBUGLEV_INFO, Pinning master daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
-        sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
-        daemon_pinned[cpu_id] = 1;
-    }
-
-    if ((cpuSockets[cpu_id] >= 0) && (cpuSockets[cpu_id] != globalSocket))
-    {
-        socket = cpuSockets[cpu_id];
-        lockptr = &cpuLocks[cpu_id];
-    }
+    access_client_getSocket(cpu_id, &socket, &lockptr);
 
     if (dev != MSR_DEV)
     {
@@ -400,43 +618,12 @@ access_client_write(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t
     pthread_mutex_t* lockptr = &globalLock;
     record.errorcode = ERR_OPENFAIL;
 
-    if (cpuSockets_open == 0)
+    if (cpuSockets_open == 0 && nodeSocket < 0)
     {
         return -ENOENT;
     }
 
-    if (cpuSockets[cpu_id] < 0 && gettid() != masterPid)
-    {
-        pthread_mutex_lock(&cpuLocks[cpu_id]);
-        cpuSockets[cpu_id] = access_client_startDaemon(cpu_id);
-        cpuSockets_open++;
-        if (!daemon_pinned[cpu_id])
-        {
-            cpu_set_t cpuset;
-            CPU_ZERO(&cpuset);
-            CPU_SET(cpu_id, &cpuset);
-            DEBUG_PRINT(DEBUGLEV_INFO, Pinning daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
-            sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
-            daemon_pinned[cpu_id] = 1;
-        }
-        pthread_mutex_unlock(&cpuLocks[cpu_id]);
-    }
-    else if (cpuSockets[cpu_id] > 0 && gettid() == masterPid &&
-             cpuSockets_open > 1 && !daemon_pinned[cpu_id])
-    {
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        CPU_SET(cpu_id, &cpuset);
-        DEBUG_PRINT(DEBUGLEV_INFO, Pinning master daemon %d to CPU %d, daemon_pids[cpu_id], cpu_id);
-        sched_setaffinity(daemon_pids[cpu_id], sizeof(cpu_set_t), &cpuset);
-        daemon_pinned[cpu_id] = 1;
-    }
-
-    if ((cpuSockets[cpu_id] >= 0) && (cpuSockets[cpu_id] != socket))
-    {
-        socket = cpuSockets[cpu_id];
-        lockptr = &cpuLocks[cpu_id];
-    }
+    access_client_getSocket(cpu_id, &socket, &lockptr);
 
     if (dev != MSR_DEV)
     {
@@ -480,6 +667,30 @@ void
 access_client_finalize(int cpu_id)
 {
     AccessDataRecord record;
+    if (nodeSocket >= 0)
+    {
+        pthread_mutex_lock(&globalLock);
+        if (nodeCpus[cpu_id])
+        {
+            nodeCpus[cpu_id] = 0;
+            nodeUsers--;
+        }
+        if (nodeUsers == 0)
+        {
+            memset(&record, 0, sizeof(AccessDataRecord));
+            record.type = DAEMON_EXIT;
+            CHECK_ERROR(write(nodeSocket, &record, sizeof(AccessDataRecord)),socket write failed);
+            CHECK_ERROR(close(nodeSocket),socket close failed);
+            nodeSocket = -1;
+            nodeChecked = 0;
+            nodeRole = SESSION_OWNER;
+        }
+        pthread_mutex_unlock(&globalLock);
+#if defined(__x86_64__) || defined(__i386__)
+        access_x86_rdpmc_finalize(cpu_id);
+#endif
+        return;
+    }
     if (cpuSockets && cpuSockets[cpu_id] > 0)
     {
         memset(&record, 0, sizeof(AccessDataRecord));
@@ -528,12 +739,16 @@ access_client_check(PciDeviceIndex dev, int cpu_id)
     {
         record.cpu = affinity_thread2socket_lookup[cpu_id];
     }
-    if ((cpuSockets[cpu_id] > 0) && (cpuSockets[cpu_id] != globalSocket))
+    if (nodeSocket >= 0)
+    {
+        socket = nodeSocket;
+    }
+    else if ((cpuSockets[cpu_id] > 0) && (cpuSockets[cpu_id] != globalSocket))
     {
         socket = cpuSockets[cpu_id];
         lockptr = &cpuLocks[cpu_id];
     }
-    if ((cpuSockets[cpu_id] > 0) || ((cpuSockets_open == 1) && (globalSocket > 0)))
+    if ((nodeSocket >= 0) || (cpuSockets[cpu_id] > 0) || ((cpuSockets_open == 1) && (globalSocket > 0)))
     {
         pthread_mutex_lock(lockptr);
         CHECK_ERROR(write(socket, &record, sizeof(AccessDataRecord)), socket write failed);
@@ -551,8 +766,71 @@ access_client_check(PciDeviceIndex dev, int cpu_id)
     return 0;
 }
 
+int
+access_client_session(void)
+{
+    return (nodeSocket >= 0 ? nodeRole : SESSION_OWNER);
+}
+
+int
+access_client_readSystem(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data)
+{
+    int ret = 0;
+    AccessDataRecord record;
+    if (nodeSocket < 0)
+    {
+        return access_client_read(dev, cpu_id, reg, data);
+    }
+    memset(&record, 0, sizeof(AccessDataRecord));
+    record.cpu = cpu_id;
+    record.device = dev;
+    record.reg = reg;
+    if (dev != MSR_DEV)
+    {
+        record.cpu = affinity_thread2socket_lookup[cpu_id];
+    }
+    pthread_mutex_lock(&globalLock);
+    ret = access_client_nodeRequest(DAEMON_READ_SYSTEM, &record);
+    pthread_mutex_unlock(&globalLock);
+    *data = (ret == 0 ? record.data : 0x0ULL);
+    return ret;
+}
+
+int
+access_client_generation(uint64_t *generation)
+{
+    int ret = 0;
+    AccessDataRecord record;
+    *generation = 0x0ULL;
+    if (nodeSocket < 0)
+    {
+        return 0;
+    }
+    memset(&record, 0, sizeof(AccessDataRecord));
+    pthread_mutex_lock(&globalLock);
+    ret = access_client_nodeRequest(DAEMON_GENERATION, &record);
+    pthread_mutex_unlock(&globalLock);
+    if (ret == 0)
+    {
+        *generation = record.data;
+    }
+    return ret;
+}
+
 void __attribute__((destructor (104))) close_access_client(void)
 {
+    if (nodeSocket >= 0)
+    {
+        close(nodeSocket);
+        nodeSocket = -1;
+    }
+    if (nodeCpus)
+    {
+        free(nodeCpus);
+        nodeCpus = NULL;
+        nodeUsers = 0;
+        nodeChecked = 0;
+    }
     if (cpuSockets)
     {
         for (int i = 0; i < cpuid_topology.numHWThreads; i++)
@@ -0,0 +1,672 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  access_sim.c
+ *
+ *      Description:  Simulated register backend of the access module. Serves the
+ *                    registers from a recorded or synthetic trace without hardware
+ *                    access and records traces of the real backends.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+/* #####   HEADER FILE INCLUDES   ######################################### */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <types.h>
+#include <error.h>
+#include <topology.h>
+#include <access_sim.h>
+
+/* The simulated registers are kept per unit: MSRs per hardware thread, all
+ * other devices per socket like the uncore units they represent. A register
+ * returns the last written value. Registers of the trace can instead replay
+ * recorded read results or count up by a fixed increment on every read.
+ *
+ * Trace format (LIKWID_SIM=<file>), one entry per line, # starts a comment.
+ * <unit> is the hardware thread for device 0 (MSR_DEV) and the socket for
+ * the other devices, * applies an entry to all units:
+ *
+ *   I <unit> <dev> <reg> <value>   initial register content
+ *   R <unit> <dev> <reg> <value>   recorded read result, replayed in order
+ *   S <unit> <dev> <reg> <inc>     counter, advances by <inc> on every read
+ *   W <unit> <dev> <reg> <value>   recorded write, ignored on replay
+ *   A <dev>                        device is absent
+ *
+ * After the last recorded read of a register, it advances by the difference
+ * of its last two recorded values. Without a trace (LIKWID_SIM=synthetic) or
+ * without an S or R entry, a counter register keeps the value last written
+ * to it, so all counts are zero. LIKWID_SIM_RECORD=<file> writes R, W and A
+ * entries of the real backend in this format.
+ *
+ * LIKWID_SIM_LATENCY adds a busy wait to every access to model the costs of
+ * the real access paths: direct, daemon, perf or <read ns>[:<write ns>]. */
+
+/* #####   TYPE DEFINITIONS   ########### */
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+    uint64_t inc;
+    uint64_t* replay;
+    uint32_t numReplay;
+    uint32_t maxReplay;
+    uint32_t pos;
+} SimRegister;
+
+typedef struct {
+    uint32_t size;
+    uint32_t used;
+    SimRegister* regs;
+} SimUnit;
+
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
+
+#define SIM_ALLUNITS (-1)
+#define SIM_INITSIZE 256
+
+static int sim_initialized = 0;
+static int sim_users = 0;
+static int sim_numCpus = 0;
+static int sim_numSockets = 0;
+static int* sim_cpuSocket = NULL;
+static SimUnit* sim_units = NULL;
+static SimUnit sim_template = { 0, 0, NULL };
+static int sim_absent[MAX_NUM_PCI_DEVICES];
+static uint64_t sim_readLatency = 0;
+static uint64_t sim_writeLatency = 0;
+static pthread_mutex_t sim_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static FILE* record_file = NULL;
+static AccessReadFunc record_read = NULL;
+static AccessWriteFunc record_write = NULL;
+static AccessCheckFunc record_check = NULL;
+static int record_absent[MAX_NUM_PCI_DEVICES];
+static pthread_mutex_t record_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
+
+static inline uint64_t
+sim_key(PciDeviceIndex dev, uint32_t reg)
+{
+    return ((((uint64_t)dev) << 32) | reg) + 1;
+}
+
+static inline uint32_t
+sim_hash(uint64_t key, uint32_t size)
+{
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & (size - 1);
+}
+
+static SimRegister*
+sim_find(SimUnit* unit, uint64_t key, int create)
+{
+    uint32_t idx = 0;
+    if (create && (unit->used + 1) * 2 > unit->size)
+    {
+        uint32_t newsize = (unit->size ? unit->size * 2 : SIM_INITSIZE);
+        SimRegister* newregs = calloc(newsize, sizeof(SimRegister));
+        if (!newregs)
+        {
+            return NULL;
+        }
+        for (uint32_t i = 0; i < unit->size; i++)
+        {
+            if (unit->regs[i].key)
+            {
+                idx = sim_hash(unit->regs[i].key, newsize);
+                while (newregs[idx].key)
+                    idx = (idx + 1) & (newsize - 1);
+                newregs[idx] = unit->regs[i];
+            }
+        }
+        free(unit->regs);
+        unit->regs = newregs;
+        unit->size = newsize;
+    }
+    if (unit->size == 0)
+    {
+        return NULL;
+    }
+    idx = sim_hash(key, unit->size);
+    while (unit->regs[idx].key)
+    {
+        if (unit->regs[idx].key == key)
+        {
+            return &unit->regs[idx];
+        }
+        idx = (idx + 1) & (unit->size - 1);
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    memset(&unit->regs[idx], 0, sizeof(SimRegister));
+    unit->regs[idx].key = key;
+    unit->used++;
+    return &unit->regs[idx];
+}
+
+static void
+sim_freeUnit(SimUnit* unit)
+{
+    for (uint32_t i = 0; i < unit->size; i++)
+    {
+        free(unit->regs[i].replay);
+    }
+    free(unit->regs);
+    memset(unit, 0, sizeof(SimUnit));
+}
+
+static int
+sim_unitIndex(PciDeviceIndex dev, int cpu_id)
+{
+    if (dev == MSR_DEV)
+    {
+        return cpu_id;
+    }
+    return sim_numCpus + sim_cpuSocket[cpu_id];
+}
+
+/* Returns the register of the unit, registers of the trace given for all
+ * units are copied on the first access */
+static SimRegister*
+sim_register(PciDeviceIndex dev, int cpu_id, uint32_t reg)
+{
+    uint64_t key = sim_key(dev, reg);
+    SimUnit* unit = &sim_units[sim_unitIndex(dev, cpu_id)];
+    SimRegister* r = sim_find(unit, key, 0);
+    if (!r)
+    {
+        SimRegister* t = sim_find(&sim_template, key, 0);
+        r = sim_find(unit, key, 1);
+        if (r && t)
+        {
+            *r = *t;
+            if (t->numReplay > 0)
+            {
+                r->replay = malloc(t->numReplay * sizeof(uint64_t));
+                if (r->replay)
+                    memcpy(r->replay, t->replay, t->numReplay * sizeof(uint64_t));
+                else
+                    r->numReplay = 0;
+                r->maxReplay = r->numReplay;
+            }
+        }
+    }
+    return r;
+}
+
+static int
+sim_addReplay(SimRegister* r, uint64_t value)
+{
+    if (r->numReplay == r->maxReplay)
+    {
+        uint32_t newmax = (r->maxReplay ? r->maxReplay * 2 : 16);
+        uint64_t* tmp = realloc(r->replay, newmax * sizeof(uint64_t));
+        if (!tmp)
+        {
+            return -ENOMEM;
+        }
+        r->replay = tmp;
+        r->maxReplay = newmax;
+    }
+    r->replay[r->numReplay++] = value;
+    if (r->numReplay >= 2)
+    {
+        r->inc = value - r->replay[r->numReplay-2];
+    }
+    return 0;
+}
+
+static int
+sim_readTrace(const char* filename)
+{
+    char line[512];
+    int lineno = 0;
+    FILE* fp = fopen(filename, "r");
+    if (!fp)
+    {
+        ERROR_PRINT(Cannot open register trace %s, filename);
+        return -errno;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        char op = '\0';
+        char unitstr[32];
+        char valuestr[32];
+        char* end = NULL;
+        unsigned int dev = 0;
+        unsigned long long reg = 0, value = 0;
+        int unit = SIM_ALLUNITS;
+        SimUnit* u = &sim_template;
+        SimRegister* r = NULL;
+        lineno++;
+        if (sscanf(line, " %c", &op) != 1 || op == '#')
+        {
+            continue;
+        }
+        if (op == 'A')
+        {
+            if (sscanf(line, " A %u", &dev) == 1 && dev < MAX_NUM_PCI_DEVICES)
+            {
+                sim_absent[dev] = 1;
+            }
+            continue;
+        }
+        if (sscanf(line, " %c %31s %u %llx %31s", &op, unitstr, &dev, &reg, valuestr) != 5 ||
+            dev >= MAX_NUM_PCI_DEVICES)
+        {
+            DEBUG_PRINT(DEBUGLEV_INFO, Skipping invalid line %d of register trace %s, lineno, filename);
+            continue;
+        }
+        value = strtoull(valuestr, &end, 0);
+        if (end == valuestr)
+        {
+            DEBUG_PRINT(DEBUGLEV_INFO, Skipping invalid line %d of register trace %s, lineno, filename);
+            continue;
+        }
+        if (op == 'W')
+        {
+            continue;
+        }
+        if (strcmp(unitstr, "*") != 0)
+        {
+            unit = atoi(unitstr);
+            if ((unit < 0) || (dev == MSR_DEV && unit >= sim_numCpus) ||
+                (dev != MSR_DEV && unit >= sim_numSockets))
+            {
+                DEBUG_PRINT(DEBUGLEV_INFO, Skipping line %d of register trace %s: no unit %d,
+                            lineno, filename, unit);
+                continue;
+            }
+            u = &sim_units[(dev == MSR_DEV ? unit : sim_numCpus + unit)];
+        }
+        r = sim_find(u, sim_key(dev, (uint32_t)reg), 1);
+        if (!r)
+        {
+            fclose(fp);
+            return -ENOMEM;
+        }
+        switch (op)
+        {
+            case 'I':
+                r->value = value;
+                break;
+            case 'R':
+                sim_addReplay(r, value);
+                break;
+            case 'S':
+                r->inc = value;
+                break;
+            default:
+                DEBUG_PRINT(DEBUGLEV_INFO, Unknown entry %c in line %d of register trace %s, op, lineno, filename);
+                break;
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+static int
+sim_parseLatency(const char* latency)
+{
+    char* end = NULL;
+    if (strcmp(latency, "direct") == 0)
+    {
+        /* pread/pwrite on /dev/cpu/<id>/msr */
+        sim_readLatency = 1200;
+        sim_writeLatency = 1500;
+    }
+    else if (strcmp(latency, "daemon") == 0)
+    {
+        /* UNIX socket round trip to likwid-accessD plus the device access */
+        sim_readLatency = 7000;
+        sim_writeLatency = 7500;
+    }
+    else if (strcmp(latency, "perf") == 0)
+    {
+        /* read() on a perf_event file descriptor */
+        sim_readLatency = 800;
+        sim_writeLatency = 800;
+    }
+    else
+    {
+        sim_readLatency = strtoull(latency, &end, 10);
+        sim_writeLatency = sim_readLatency;
+        if (end && *end == ':')
+        {
+            sim_writeLatency = strtoull(end + 1, &end, 10);
+        }
+        if (!end || *end != '\0')
+        {
+            ERROR_PRINT(Invalid access latency %s (direct|daemon|perf|<read ns>[:<write ns>]), latency);
+            sim_readLatency = 0;
+            sim_writeLatency = 0;
+            return -EINVAL;
+        }
+    }
+    return 0;
+}
+
+static inline void
+sim_delay(uint64_t ns)
+{
+    struct timespec ts;
+    uint64_t start = 0, now = 0;
+    if (ns == 0)
+    {
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    start = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        now = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    } while (now - start < ns);
+}
+
+static int
+sim_setup(void)
+{
+    int ret = 0;
+    int maxSocket = 0;
+    char* trace = getenv("LIKWID_SIM");
+    char* latency = getenv("LIKWID_SIM_LATENCY");
+
+    topology_init();
+    sim_numCpus = cpuid_topology.numHWThreads;
+    sim_cpuSocket = calloc(sim_numCpus, sizeof(int));
+    if (!sim_cpuSocket)
+    {
+        return -ENOMEM;
+    }
+    for (int i = 0; i < (int)cpuid_topology.numHWThreads; i++)
+    {
+        HWThread* t = &cpuid_topology.threadPool[i];
+        if ((int)t->apicId < sim_numCpus)
+        {
+            sim_cpuSocket[t->apicId] = t->packageId;
+        }
+        if ((int)t->packageId > maxSocket)
+        {
+            maxSocket = t->packageId;
+        }
+    }
+    sim_numSockets = maxSocket + 1;
+    sim_units = calloc(sim_numCpus + sim_numSockets, sizeof(SimUnit));
+    if (!sim_units)
+    {
+        free(sim_cpuSocket);
+        sim_cpuSocket = NULL;
+        return -ENOMEM;
+    }
+    memset(sim_absent, 0, sizeof(sim_absent));
+    if (trace && strlen(trace) > 0 && strcmp(trace, "synthetic") != 0)
+    {
+        ret = sim_readTrace(trace);
+        if (ret < 0)
+        {
+            for (int i = 0; i < sim_numCpus + sim_numSockets; i++)
+            {
+                sim_freeUnit(&sim_units[i]);
+            }
+            sim_freeUnit(&sim_template);
+            free(sim_units);
+            sim_units = NULL;
+            free(sim_cpuSocket);
+            sim_cpuSocket = NULL;
+            return ret;
+        }
+        DEBUG_PRINT(DEBUGLEV_INFO, Simulating registers from trace %s, trace);
+    }
+    else
+    {
+        DEBUG_PLAIN_PRINT(DEBUGLEV_INFO, Simulating registers without trace);
+    }
+    if (latency)
+    {
+        sim_parseLatency(latency);
+    }
+    sim_initialized = 1;
+    return 0;
+}
+
+/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+
+int
+access_sim_init(int cpu_id)
+{
+    int ret = 0;
+    pthread_mutex_lock(&sim_lock);
+    if (!sim_initialized)
+    {
+        ret = sim_setup();
+    }
+    if (ret == 0 && (cpu_id < 0 || cpu_id >= sim_numCpus))
+    {
+        ret = -ERANGE;
+    }
+    if (ret == 0)
+    {
+        sim_users++;
+    }
+    pthread_mutex_unlock(&sim_lock);
+    return ret;
+}
+
+int
+access_sim_read(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data)
+{
+    SimRegister* r = NULL;
+    sim_delay(sim_readLatency);
+    if (sim_absent[dev])
+    {
+        *data = 0x0ULL;
+        return -ENODEV;
+    }
+    r = sim_register(dev, cpu_id, reg);
+    if (!r)
+    {
+        *data = 0x0ULL;
+        return -ENOMEM;
+    }
+    if (r->pos < r->numReplay)
+    {
+        r->value = r->replay[r->pos++];
+    }
+    else
+    {
+        r->value += r->inc;
+    }
+    *data = r->value;
+    return 0;
+}
+
+int
+access_sim_write(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data)
+{
+    SimRegister* r = NULL;
+    sim_delay(sim_writeLatency);
+    if (sim_absent[dev])
+    {
+        return -ENODEV;
+    }
+    r = sim_register(dev, cpu_id, reg);
+    if (!r)
+    {
+        return -ENOMEM;
+    }
+    /* Counters advance from the written value, so a read returns it plus
+     * one increment like a running counter */
+    r->value = data;
+    return 0;
+}
+
+void
+access_sim_finalize(int cpu_id)
+{
+    pthread_mutex_lock(&sim_lock);
+    if (sim_users > 0)
+    {
+        sim_users--;
+    }
+    if (sim_users == 0 && sim_initialized)
+    {
+        for (int i = 0; i < sim_numCpus + sim_numSockets; i++)
+        {
+            sim_freeUnit(&sim_units[i]);
+        }
+        sim_freeUnit(&sim_template);
+        free(sim_units);
+        sim_units = NULL;
+        free(sim_cpuSocket);
+        sim_cpuSocket = NULL;
+        sim_readLatency = 0;
+        sim_writeLatency = 0;
+        sim_initialized = 0;
+    }
+    pthread_mutex_unlock(&sim_lock);
+}
+
+int
+access_sim_check(PciDeviceIndex dev, int cpu_id)
+{
+    if ((!sim_initialized) || (cpu_id < 0) || (cpu_id >= sim_numCpus))
+    {
+        return 0;
+    }
+    return !sim_absent[dev];
+}
+
+/* Recording wraps the functions of the real backend and writes every access
+ * in the trace format */
+int
+access_sim_recordInit(const char* filename, AccessReadFunc readFunc, AccessWriteFunc writeFunc, AccessCheckFunc checkFunc)
+{
+    pthread_mutex_lock(&record_lock);
+    if (!record_file)
+    {
+        record_file = fopen(filename, "w");
+        if (!record_file)
+        {
+            pthread_mutex_unlock(&record_lock);
+            ERROR_PRINT(Cannot open register trace %s for writing, filename);
+            return -errno;
+        }
+        fprintf(record_file, "# LIKWID register trace\n# <op> <unit> <dev> <reg> <value>\n");
+    }
+    topology_init();
+    if (!sim_cpuSocket)
+    {
+        sim_numCpus = cpuid_topology.numHWThreads;
+        sim_cpuSocket = calloc(sim_numCpus, sizeof(int));
+        for (int i = 0; sim_cpuSocket && i < (int)cpuid_topology.numHWThreads; i++)
+        {
+            if ((int)cpuid_topology.threadPool[i].apicId < sim_numCpus)
+                sim_cpuSocket[cpuid_topology.threadPool[i].apicId] = cpuid_topology.threadPool[i].packageId;
+        }
+    }
+    record_read = readFunc;
+    record_write = writeFunc;
+    record_check = checkFunc;
+    memset(record_absent, 0, sizeof(record_absent));
+    pthread_mutex_unlock(&record_lock);
+    return 0;
+}
+
+int
+access_sim_recordRead(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data)
+{
+    int ret = record_read(dev, cpu_id, reg, data);
+    if (ret == 0 && record_file)
+    {
+        pthread_mutex_lock(&record_lock);
+        fprintf(record_file, "R %d %d 0x%X 0x%llX\n",
+                (dev == MSR_DEV || !sim_cpuSocket ? cpu_id : sim_cpuSocket[cpu_id]),
+                (int)dev, reg, LLU_CAST *data);
+        pthread_mutex_unlock(&record_lock);
+    }
+    return ret;
+}
+
+int
+access_sim_recordWrite(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data)
+{
+    int ret = record_write(dev, cpu_id, reg, data);
+    if (ret == 0 && record_file)
+    {
+        pthread_mutex_lock(&record_lock);
+        fprintf(record_file, "W %d %d 0x%X 0x%llX\n",
+                (dev == MSR_DEV || !sim_cpuSocket ? cpu_id : sim_cpuSocket[cpu_id]),
+                (int)dev, reg, LLU_CAST data);
+        pthread_mutex_unlock(&record_lock);
+    }
+    return ret;
+}
+
+/* Devices missing on the recorded machine are written once, so the setup
+ * takes the same paths when replaying the trace */
+int
+access_sim_recordCheck(PciDeviceIndex dev, int cpu_id)
+{
+    int ret = record_check(dev, cpu_id);
+    if (!ret && record_file)
+    {
+        pthread_mutex_lock(&record_lock);
+        if (!record_absent[dev])
+        {
+            fprintf(record_file, "A %d\n", (int)dev);
+            record_absent[dev] = 1;
+        }
+        pthread_mutex_unlock(&record_lock);
+    }
+    return ret;
+}
+
+void
+access_sim_recordFinalize(void)
+{
+    pthread_mutex_lock(&record_lock);
+    if (record_file)
+    {
+        fclose(record_file);
+        record_file = NULL;
+    }
+    record_read = NULL;
+    record_write = NULL;
+    record_check = NULL;
+    if (!sim_initialized && sim_cpuSocket)
+    {
+        free(sim_cpuSocket);
+        sim_cpuSocket = NULL;
+    }
+    pthread_mutex_unlock(&record_lock);
+}
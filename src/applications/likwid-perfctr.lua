@@ -84,6 +84,7 @@ local function usage(config)
     io.stdout:write("-E <string>\t\t List available events and corresponding counters that match <string>\n")
     io.stdout:write("-i, --info\t\t Print CPU info\n")
     io.stdout:write("-T <time>\t\t Switch eventsets with given frequency\n")
+    io.stdout:write("--weights <list>\t Comma-separated share of time per eventset when switching with -T\n")
     io.stdout:write("-f, --force\t\t Force overwrite of registers if they are in use\n")
     io.stdout:write("Modes:\n")
     io.stdout:write("-S <time>\t\t Stethoscope mode with duration in s, ms or us, e.g 20ms\n")
@@ -92,7 +93,12 @@ local function usage(config)
     io.stdout:write("\t\t\t <groupID> <nrEvents> <nrThreads> <Timestamp> <Event1_Thread1> <Event1_Thread2> ... <EventN_ThreadN>\n")
     io.stdout:write("\t\t\t or\n")
     io.stdout:write("\t\t\t <groupID> <nrEvents> <nrThreads> <Timestamp> <Metric1_Thread1> <Metric1_Thread2> ... <MetricN_ThreadN>\n")
+    io.stdout:write("--aggregate <level>[:<stat>]\t Aggregate timeline values per topology domain instead of per HWThread\n")
+    io.stdout:write("\t\t\t Levels: thread, core, llc, numa, socket, node. Stats: sum (default), min, max, avg\n")
+    io.stdout:write("\t\t\t The <nrThreads> field contains the number of domains\n")
     io.stdout:write("-m, --marker\t\t Use Marker API inside code\n")
+    io.stdout:write("--histogram <list>\t Record histograms of the region call durations and of the deltas\n")
+    io.stdout:write("\t\t\t of the given counters (comma-separated, e.g. time or PMC0,FIXC0)\n")
     io.stdout:write("Output options:\n")
     io.stdout:write("-o, --output <file>\t Store output to file. (Optional: Apply text filter according to filename suffix)\n")
     io.stdout:write("-O\t\t\t Output easily parseable CSV instead of fancy tables\n")
@@ -147,6 +153,10 @@ overflow_interval = 2.E06
 output = ""
 use_csv = false
 print_stats = false
+mpx_weights = {}
+timeline_level = nil
+histogram_counters = nil
+timeline_stat = "sum"
 execString = nil
 outfile = nil
 outfile_orig = nil
@@ -214,7 +224,7 @@ if #arg == 0 then
     perfctr_exit(0)
 end
 
-for opt,arg in likwid.getopt(arg, {"a", "c:", "C:", "e", "E:", "g:", "h", "H", "i", "m", "M:", "o:", "O", "P", "s:", "S:", "t:", "v", "V:", "T:", "G:", "W:", "f", "group:", "help", "info", "version", "verbose:", "output:", "skip:", "marker", "force", "stats", "execpid", "perfflags:", "perfpid:", "Z", "gpugroup:", "outprefix:"}) do
+for opt,arg in likwid.getopt(arg, {"a", "c:", "C:", "e", "E:", "g:", "h", "H", "i", "m", "M:", "o:", "O", "P", "s:", "S:", "t:", "v", "V:", "T:", "G:", "W:", "f", "group:", "help", "info", "version", "verbose:", "output:", "skip:", "marker", "force", "stats", "execpid", "perfflags:", "perfpid:", "Z", "gpugroup:", "outprefix:", "weights:", "aggregate:", "histogram:"}) do
     if (type(arg) == "string") then
         local s,e = arg:find("-");
         if s == 1 then
@@ -355,6 +365,35 @@ for opt,arg in likwid.getopt(arg, {"a", "c:", "C:", "e", "E:", "g:", "h", "H", "
         use_csv = true
     elseif (opt == "stats") then
         print_stats = true
+    elseif (opt == "histogram") then
+        histogram_counters = arg
+    elseif (opt == "aggregate") then
+        local levels = {thread = "hwthread", hwthread = "hwthread", core = "core",
+                        llc = "llc", l3 = "llc", numa = "numa", socket = "socket",
+                        node = "node"}
+        local level, stat = arg:match("^([^:]+):?(%a*)$")
+        if level == nil or levels[level:lower()] == nil then
+            print_stderr("Invalid aggregation level "..arg..", valid levels are thread, core, llc, numa, socket and node")
+            perfctr_exit(1)
+        end
+        timeline_level = levels[level:lower()]
+        if stat ~= nil and stat:len() > 0 then
+            stat = stat:lower()
+            if stat ~= "sum" and stat ~= "min" and stat ~= "max" and stat ~= "avg" then
+                print_stderr("Invalid aggregation statistic "..stat..", valid are sum, min, max and avg")
+                perfctr_exit(1)
+            end
+            timeline_stat = stat
+        end
+    elseif (opt == "weights") then
+        for w in arg:gmatch("[^,]+") do
+            local weight = tonumber(w)
+            if weight == nil or weight <= 0 then
+                print_stderr("Invalid weight "..w..", weights must be positive numbers")
+                perfctr_exit(1)
+            end
+            table.insert(mpx_weights, weight)
+        end
 ---------------------------
     elseif gpusSupported and (opt == "G") then
         if arg ~= nil then
@@ -727,6 +766,16 @@ elseif use_timeline == true and use_stethoscope == true then
     perfctr_exit(0)
 end
 
+if timeline_level ~= nil and use_timeline == false then
+    print_stderr("Option --aggregate is only supported in Timeline mode")
+    perfctr_exit(1)
+end
+
+if histogram_counters ~= nil and use_marker == false then
+    print_stderr("Option --histogram is only supported with the Marker API")
+    perfctr_exit(1)
+end
+
 if use_stethoscope == false and use_timeline == false and use_marker == false then
     use_wrapper = true
 end
@@ -817,6 +866,9 @@ if use_marker == true then
     likwid.setenv("LIKWID_EVENTS", str)
     likwid.setenv("LIKWID_THREADS", table.concat(cpulist,","))
     likwid.setenv("LIKWID_FORCE", "-1")
+    if histogram_counters ~= nil then
+        likwid.setenv("LIKWID_HISTOGRAM", histogram_counters)
+    end
     likwid.setenv("KMP_INIT_AT_FORK", "FALSE")
     if gpusSupported and #gpulist > 0 and #gpu_event_string_list > 0 then
         likwid.setenv("LIKWID_GPUS", table.concat(gpulist,","))
@@ -947,6 +999,12 @@ if #group_ids == 0 and not (#gpu_event_string_list > 0 and use_marker) then
     perfctr_exit(1)
 end
 
+for i, weight in pairs(mpx_weights) do
+    if group_ids[i] ~= nil then
+        likwid.setGroupWeight(group_ids[i], weight)
+    end
+end
+
 if #event_string_list > 0 then
     activeGroup = group_ids[1]
     ret = likwid.setupCounters(activeGroup)
@@ -983,22 +1041,38 @@ if #event_string_list > 0 then
             word_delim = timeline_delim
         end
         local clist = {}
-        for i, cpu in pairs(cpulist) do
-            table.insert(clist, tostring(cpu))
+        if timeline_level ~= nil then
+            local red = likwid.reduce(group_ids[1], "lastresults", timeline_level)
+            if red == nil then
+                print_stderr("Cannot aggregate the HWThreads at level "..timeline_level)
+                perfctr_exit(1)
+            end
+            for i, name in pairs(red["names"]) do
+                table.insert(clist, name)
+            end
+            print(outprefix.."# Domains ("..timeline_level..", "..timeline_stat..")"..word_delim..table.concat(clist, delim))
+        else
+            for i, cpu in pairs(cpulist) do
+                table.insert(clist, tostring(cpu))
+            end
+            print(outprefix.."# HWThreads"..word_delim..table.concat(clist, delim))
+        end
+        local count_label = "CpuCount"
+        if timeline_level ~= nil then
+            count_label = "DomainCount"
         end
-        print(outprefix.."# HWThreads"..word_delim..table.concat(clist, delim))
         for i, gid in pairs(group_ids) do
             local strlist = {"GID"}
             if likwid.getNumberOfMetrics(gid) == 0 then
                 table.insert(strlist, "EventCount")
-                table.insert(strlist, "CpuCount")
+                table.insert(strlist, count_label)
                 table.insert(strlist, "Total runtime [s]")
                 for e=1,likwid.getNumberOfEvents(gid) do
                     table.insert(strlist, likwid.getNameOfEvent(gid, e))
                 end
             else
                 table.insert(strlist, "MetricsCount")
-                table.insert(strlist, "CpuCount")
+                table.insert(strlist, count_label)
                 table.insert(strlist, "Total runtime [s]")
                 for m=1,likwid.getNumberOfMetrics(gid) do
                     table.insert(strlist, likwid.getNameOfMetric(gid, m))
@@ -1063,19 +1137,51 @@ if use_wrapper or use_timeline then
             likwid.readCounters()
 
             local time = likwid.getClock(start, stop)
-            if likwid.getNumberOfMetrics(activeGroup) == 0 then
-                results = likwid.getLastResults(nan2value)
-            else
-                results = likwid.getLastMetrics(nan2value)
-            end
             local outList = {}
             table.insert(outList, tostring(math.tointeger(activeGroup)))
-            table.insert(outList, tostring(#results[activeGroup]))
-            table.insert(outList, tostring(#cpulist))
-            table.insert(outList, tostring(time))
-            for i,l1 in pairs(results[activeGroup]) do
-                for j, value in pairs(l1) do
-                    table.insert(outList, tostring(value))
+            local red = nil
+            if timeline_level ~= nil then
+                local source = "lastresults"
+                if likwid.getNumberOfMetrics(activeGroup) > 0 then
+                    source = "lastmetrics"
+                end
+                red = likwid.reduce(activeGroup, source, timeline_level)
+                if red == nil or red[timeline_stat] == nil then
+                    -- The header announces domains, switching to the
+                    -- per-HWThread layout would break the output format
+                    print_stderr("Cannot aggregate the HWThreads at level "..timeline_level)
+                    likwid.stopCounters()
+                    if #execList > 0 then
+                        likwid.killProgram(pid)
+                    end
+                    perfctr_exit(1)
+                end
+            end
+            if red ~= nil then
+                table.insert(outList, tostring(#red[timeline_stat]))
+                table.insert(outList, tostring(#red["names"]))
+                table.insert(outList, tostring(time))
+                for i,l1 in pairs(red[timeline_stat]) do
+                    for j, value in pairs(l1) do
+                        if value ~= value then
+                            value = nan2value
+                        end
+                        table.insert(outList, tostring(value))
+                    end
+                end
+            else
+                if likwid.getNumberOfMetrics(activeGroup) == 0 then
+                    results = likwid.getLastResults(nan2value)
+                else
+                    results = likwid.getLastMetrics(nan2value)
+                end
+                table.insert(outList, tostring(#results[activeGroup]))
+                table.insert(outList, tostring(#cpulist))
+                table.insert(outList, tostring(time))
+                for i,l1 in pairs(results[activeGroup]) do
+                    for j, value in pairs(l1) do
+                        table.insert(outList, tostring(value))
+                    end
                 end
             end
             if not outfile then
@@ -1094,7 +1200,7 @@ if use_wrapper or use_timeline then
             twork = likwid.getClock(xstart, xstop)
         end
         if #group_ids > 1 then
-            likwid.switchGroup(activeGroup + 1)
+            likwid.switchGroup(likwid.getNextGroup())
             activeGroup = likwid.getIdOfActiveGroup()
             if groupTime[activeGroup] == nil then
                 groupTime[activeGroup] = 0
@@ -1167,9 +1273,12 @@ if use_marker == true then
         end
     end
 elseif use_timeline == false then
-    results = likwid.getResults(nan2value)
-    metrics = likwid.getMetrics(nan2value)
-    likwid.printOutput(results, metrics, cpulist, nil, print_stats)
+    local reductions = nil
+    results, metrics, reductions = likwid.getReducedResults(nan2value)
+    likwid.printOutput(results, metrics, cpulist, nil, print_stats, reductions)
+    if #group_ids > 1 and not use_stethoscope then
+        likwid.printScaledOutput(cpulist)
+    end
 end
 
 if outfile and not use_timeline then
@@ -82,6 +82,10 @@ local function usage()
     print_stdout("-S, --sweep\t\t Sweep memory and LLC of involved NUMA nodes")
     print_stdout("-c/-C <list>\t\t Comma separated processor IDs or expression")
     print_stdout("-s, --skip <hex>\t Bitmask with threads to skip")
+    print_stdout("-P, --policy <policy>\t Thread placement policy: roundrobin (default), leastloaded,")
+    print_stdout("\t\t\t scatter[:S|:M] or compact[:S|:M]. All but roundrobin reuse the")
+    print_stdout("\t\t\t hwthreads of exited threads and place threads on the least loaded hwthread.")
+    print_stdout("-l, --log <file>\t Write the placement of all created and exited threads to <file>")
     print_stdout("-p\t\t\t Print available domains with mapping on physical IDs")
     print_stdout("\t\t\t If used together with -c option outputs the list of physical processor IDs.")
     print_stdout("-d <string>\t\t Delimiter used for using -p to output physical processor list, default is comma.")
@@ -106,6 +110,8 @@ membind_policy = false
 print_domains = false
 cpu_list = {}
 skip_mask = nil
+pin_policy = nil
+pin_log = nil
 affinity = nil
 num_threads = 0
 cpustr = nil
@@ -117,7 +123,7 @@ if (#arg == 0) then
     os.exit(0)
 end
 
-for opt,arg in likwid.getopt(arg, {"c:", "C:", "d:", "h", "i", "m", "p", "q", "s:", "S", "t:", "v", "V:", "verbose:", "help", "version", "skip","sweep", "quiet"}) do
+for opt,arg in likwid.getopt(arg, {"c:", "C:", "d:", "h", "i", "l:", "m", "p", "P:", "q", "s:", "S", "t:", "v", "V:", "verbose:", "help", "version", "skip","sweep", "quiet", "policy:", "log:"}) do
     if opt == "h" or opt == "help" then
         usage()
         close_and_exit(0)
@@ -146,6 +152,15 @@ for opt,arg in likwid.getopt(arg, {"c:", "C:", "d:", "h", "i", "m", "p", "q", "s
             close_and_exit(1)
         end
         skip_mask = arg
+    elseif opt == "P" or opt == "policy" then
+        local p = arg:match("^(%a+)")
+        if p ~= "roundrobin" and p ~= "leastloaded" and p ~= "scatter" and p ~= "compact" then
+            print_stderr("Unknown placement policy "..arg)
+            close_and_exit(1)
+        end
+        pin_policy = arg
+    elseif opt == "l" or opt == "log" then
+        pin_log = arg
     elseif opt == "q" or opt == "quiet" then
         likwid.setenv("LIKWID_SILENT","true")
         quiet = 1
@@ -268,6 +283,12 @@ end
 if skip_mask then
     likwid.setenv("LIKWID_SKIP", skip_mask)
 end
+if pin_policy then
+    likwid.setenv("LIKWID_PIN_POLICY", pin_policy)
+end
+if pin_log then
+    likwid.setenv("LIKWID_PIN_LOG", pin_log)
+end
 
 if num_threads > 1 then
     local pinString = tostring(math.tointeger(cpu_list[2]))
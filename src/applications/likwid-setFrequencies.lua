@@ -517,15 +517,6 @@ if driver ~= "intel_pstate" then
     end
 end
 
-min_first = false
-max_first = false
-if min_freq and tonumber(min_freq)/1E6 > tonumber(likwid.getCpuClockMax(cpulist[i]))/1E6 then
-    max_first = true
-end
-if max_freq and tonumber(max_freq)/1E6 < tonumber(likwid.getCpuClockMin(cpulist[i]))/1E6 then
-    min_first = true
-end
-
 if set_turbo then
     for i=1,#cpulist do
         if verbosity == 3 then
@@ -536,28 +527,13 @@ if set_turbo then
 end
 
 
-if max_first and max_freq then
-    for i=1,#cpulist do
-        local f = likwid.setCpuClockMax(cpulist[i], max_freq)
-    end
-    if min_freq then
-        for i=1,#cpulist do
-            local f = likwid.setCpuClockMin(cpulist[i], min_freq)
-        end
-    end
-elseif min_first and min_freq then
-    for i=1,#cpulist do
-        local f = likwid.setCpuClockMin(cpulist[i], min_freq)
-    end
-    if max_freq then
-        for i=1,#cpulist do
-            local f = likwid.setCpuClockMax(cpulist[i], max_freq)
-        end
+if min_freq or max_freq then
+    if verbosity == 3 then
+        print_stdout(string.format("DEBUG: Set min./max. frequency for %d CPUs", #cpulist))
     end
-elseif min_freq and max_freq then
-    for i=1,#cpulist do
-        local f = likwid.setCpuClockMin(cpulist[i], min_freq)
-        local f = likwid.setCpuClockMax(cpulist[i], max_freq)
+    local err = likwid.setCpuClocks(#cpulist, cpulist, min_freq, max_freq)
+    if err ~= 0 then
+        print_stderr(string.format("ERROR: Setting of min./max. frequency failed with error %d", err))
     end
 end
 
@@ -636,14 +612,25 @@ if governor then
     end
     local cur_freqs = {}
     if valid_gov then
-        for i=1,#cpulist do
-            if verbosity == 3 then
-                print_stdout(string.format("DEBUG: Set governor for CPU %d to %s", cpulist[i], governor))
+        if verbosity == 3 then
+            print_stdout(string.format("DEBUG: Set governor for %d CPUs to %s", #cpulist, governor))
+        end
+        local f = likwid.setCpuClocks(#cpulist, cpulist, nil, nil, governor)
+        if do_reset then
+            -- CPUs sharing the same min./max. frequency are reset in one batch
+            local resets = {}
+            local order = {}
+            for i=1,#cpulist do
+                local key = string.format("%d:%d", cur_min[i], cur_max[i])
+                if not resets[key] then
+                    resets[key] = {min = cur_min[i], max = cur_max[i], cpus = {}}
+                    table.insert(order, key)
+                end
+                table.insert(resets[key]["cpus"], cpulist[i])
             end
-            local f = likwid.setGovernor(cpulist[i], governor)
-            if do_reset then
-                likwid.setCpuClockMin(cpulist[i], cur_min[i])
-                likwid.setCpuClockMax(cpulist[i], cur_max[i])
+            for _, key in pairs(order) do
+                local r = resets[key]
+                likwid.setCpuClocks(#r["cpus"], r["cpus"], r["min"], r["max"])
             end
         end
     else
@@ -68,6 +68,12 @@ likwid.getMetric = likwid_getMetric
 likwid.getLastMetric = likwid_getLastMetric
 likwid.getNumberOfGroups = likwid_getNumberOfGroups
 likwid.getRuntimeOfGroup = likwid_getRuntimeOfGroup
+likwid.setGroupWeight = likwid_setGroupWeight
+likwid.getNextGroup = likwid_getNextGroup
+likwid.getNumberOfSlices = likwid_getNumberOfSlices
+likwid.getEnabledTime = likwid_getEnabledTime
+likwid.getScaledResult = likwid_getScaledResult
+likwid.reduce = likwid_reduce
 likwid.getLastTimeOfGroup = likwid_getLastTimeOfGroup
 likwid.getIdOfActiveGroup = likwid_getIdOfActiveGroup
 likwid.getNumberOfEvents = likwid_getNumberOfEvents
@@ -142,6 +148,10 @@ likwid.getCpuFeatures = likwid_cpuFeaturesGet
 likwid.enableCpuFeatures = likwid_cpuFeaturesEnable
 likwid.disableCpuFeatures = likwid_cpuFeaturesDisable
 likwid.readMarkerFile = likwid_readMarkerFile
+likwid.readResultFiles = likwid_readResultFiles
+likwid.getResultFileRegions = likwid_getResultFileRegions
+likwid.aggregateResultFiles = likwid_aggregateResultFiles
+likwid.destroyResultFiles = likwid_destroyResultFiles
 likwid.destroyMarkerFile = likwid_destroyMarkerFile
 likwid.markerNumRegions = likwid_markerNumRegions
 likwid.markerRegionGroup = likwid_markerRegionGroup
@@ -153,6 +163,10 @@ likwid.markerRegionTime = likwid_markerRegionTime
 likwid.markerRegionCount = likwid_markerRegionCount
 likwid.markerRegionResult = likwid_markerRegionResult
 likwid.markerRegionMetric = likwid_markerRegionMetric
+likwid.markerRegionHistograms = likwid_markerRegionHistograms
+likwid.markerRegionHistogramEvent = likwid_markerRegionHistogramEvent
+likwid.markerRegionHistogramCount = likwid_markerRegionHistogramCount
+likwid.markerRegionPercentile = likwid_markerRegionPercentile
 likwid.initFreq = likwid_initFreq
 likwid.getCpuClockBase = likwid_getCpuClockBase
 likwid.getCpuClockCurrent = likwid_getCpuClockCurrent
@@ -164,6 +178,7 @@ likwid.getConfCpuClockMax = likwid_getConfCpuClockMax
 likwid.setCpuClockMax = likwid_setCpuClockMax
 likwid.getGovernor = likwid_getGovernor
 likwid.setGovernor = likwid_setGovernor
+likwid.setCpuClocks = likwid_setCpuClocks
 likwid.finalizeFreq = likwid_finalizeFreq
 likwid.setTurbo = likwid_setTurbo
 likwid.getTurbo = likwid_getTurbo
@@ -810,7 +825,57 @@ end
 
 likwid.tableToMinMaxAvgSum = tableMinMaxAvgSum
 
-local function printOutput(results, metrics, cpulist, region, stats)
+local function reductionToMinMaxAvgSum(red, cpulist, headcols, prefix)
+    if red == nil or #red["threadDomain"] ~= #cpulist then
+        return nil
+    end
+    local outputtable = {}
+    for _, col in pairs(headcols) do
+        table.insert(outputtable, col)
+    end
+    for _, stat in pairs({"sum", "min", "max", "avg"}) do
+        local col = {stat:sub(1,1):upper()..stat:sub(2)}
+        if prefix ~= nil then
+            table.insert(col, likwid.num2str(prefix[stat]))
+        end
+        for v=1,#red[stat] do
+            table.insert(col, likwid.num2str(red[stat][v][1]))
+        end
+        table.insert(outputtable, col)
+    end
+    return outputtable
+end
+
+local function regionHistogramTables(groupId, region, cpulist)
+    local tabs = {}
+    local percentiles = {50, 90, 99, 100}
+    for h=1, likwid.markerRegionHistograms(region) do
+        local event = likwid.markerRegionHistogramEvent(region, h)
+        local title = "Call duration [s]"
+        if event > 0 then
+            title = likwid.getNameOfEvent(groupId, event).." per call"
+        end
+        local tab = {{title, "count", "p50", "p90", "p99", "max"}}
+        local threads = {}
+        for c, cpu in pairs(cpulist) do
+            table.insert(threads, {"HWThread "..tostring(cpu), c})
+        end
+        if #cpulist > 1 then
+            table.insert(threads, {"All", 0})
+        end
+        for _, t in pairs(threads) do
+            local col = {t[1], tostring(likwid.markerRegionHistogramCount(region, h, t[2]))}
+            for _, p in pairs(percentiles) do
+                table.insert(col, likwid.num2str(likwid.markerRegionPercentile(region, h, t[2], p)))
+            end
+            table.insert(tab, col)
+        end
+        table.insert(tabs, tab)
+    end
+    return tabs
+end
+
+local function printOutput(results, metrics, cpulist, region, stats, reductions)
     local maxLineFields = 0
     local cpuinfo = likwid_getCpuInfo()
     local clock = likwid.getCpuClock()
@@ -827,6 +892,7 @@ local function printOutput(results, metrics, cpulist, region, stats)
         local firsttab_combined = {}
         local secondtab = {}
         local secondtab_combined = {}
+        local histtabs = {}
         local runtime = likwid.getRuntimeOfGroup(g)
         local groupName = likwid.getNameOfGroup(g)
         if region ~= nil then
@@ -838,6 +904,7 @@ local function printOutput(results, metrics, cpulist, region, stats)
                 table.insert(tmpList, tostring(likwid.markerRegionCount(region, c)))
                 table.insert(infotab, tmpList)
             end
+            histtabs = regionHistogramTables(g, region, cur_cpulist)
         end
         firsttab[1] = {"Event"}
         firsttab_combined[1] = {"Event"}
@@ -871,7 +938,28 @@ local function printOutput(results, metrics, cpulist, region, stats)
             table.insert(firsttab, tmpList)
         end
         if #cpulist > 1 or stats == true then
-            firsttab_combined = tableMinMaxAvgSum(firsttab, 2, 1)
+            if region == nil then
+                local prefix = nil
+                local headcols = {{firsttab[1][1]}, {}}
+                for j=2,#firsttab[1] do
+                    table.insert(headcols[1], firsttab[1][j].." STAT")
+                end
+                for j=1,#firsttab[2] do
+                    table.insert(headcols[2], firsttab[2][j])
+                end
+                if likwid.getNumberOfMetrics(g) == 0 then
+                    prefix = {sum = runtime * #cur_cpulist, min = runtime,
+                              max = runtime, avg = runtime}
+                end
+                if reductions ~= nil and reductions[g] ~= nil then
+                    firsttab_combined = reductionToMinMaxAvgSum(reductions[g]["results"], cur_cpulist, headcols, prefix)
+                else
+                    firsttab_combined = nil
+                end
+            end
+            if region ~= nil or firsttab_combined == nil then
+                firsttab_combined = tableMinMaxAvgSum(firsttab, 2, 1)
+            end
         end
         if likwid.getNumberOfMetrics(g) > 0 then
             secondtab[1] = {"Metric"}
@@ -889,7 +977,14 @@ local function printOutput(results, metrics, cpulist, region, stats)
                 table.insert(secondtab, tmpList)
             end
             if #cpulist > 1 or stats == true  then
-                secondtab_combined = tableMinMaxAvgSum(secondtab, 1, 1)
+                if region == nil and reductions ~= nil and reductions[g] ~= nil then
+                    secondtab_combined = reductionToMinMaxAvgSum(reductions[g]["metrics"], cur_cpulist, {secondtab_combined[1]}, nil)
+                else
+                    secondtab_combined = nil
+                end
+                if region ~= nil or secondtab_combined == nil then
+                    secondtab_combined = tableMinMaxAvgSum(secondtab, 1, 1)
+                end
             end
         end
         maxLineFields = math.max(#firsttab, #firsttab_combined,
@@ -907,6 +1002,10 @@ local function printOutput(results, metrics, cpulist, region, stats)
             if #infotab > 0 then
                 likwid.printcsv(infotab, maxLineFields)
             end
+            for h, histtab in pairs(histtabs) do
+                print(string.format("TABLE,Region %s,Group %d Histogram %d,%s,%d%s",regionName,g,h,groupName,#histtab[1]-1,string.rep(",",maxLineFields-5)))
+                likwid.printcsv(histtab, maxLineFields)
+            end
             likwid.printcsv(firsttab, maxLineFields)
         else
             if outfile ~= nil then
@@ -924,6 +1023,9 @@ local function printOutput(results, metrics, cpulist, region, stats)
             if #infotab > 0 then
                 likwid.printtable(infotab)
             end
+            for _, histtab in pairs(histtabs) do
+                likwid.printtable(histtab)
+            end
             likwid.printtable(firsttab)
         end
         if #cur_cpulist > 1 or stats == true then
@@ -967,6 +1069,57 @@ end
 
 likwid.printOutput = printOutput
 
+local function printScaledOutput(cpulist)
+    local nr_groups = likwid_getNumberOfGroups()
+    local total = 0
+    for g=1, nr_groups do
+        total = total + likwid.getRuntimeOfGroup(g)
+    end
+    for g=1, nr_groups do
+        local tab = {}
+        local groupName = likwid.getNameOfGroup(g)
+        local nr_events = likwid_getNumberOfEvents(g)
+        tab[1] = {"Event"}
+        tab[2] = {"Counter"}
+        tab[3] = {"Enabled [s]"}
+        for e=1, nr_events do
+            table.insert(tab[1], likwid.getNameOfEvent(g, e))
+            table.insert(tab[2], likwid.getNameOfCounter(g, e))
+            table.insert(tab[3], likwid.num2str(likwid.getRuntimeOfGroup(g)))
+        end
+        for c, cpu in pairs(cpulist) do
+            local values = {"HWThread "..tostring(cpu)}
+            local errors = {"Error HWThread "..tostring(cpu)}
+            for e=1, nr_events do
+                local value, err = likwid_getScaledResult(g, e, c)
+                if value ~= value then
+                    table.insert(values, "-")
+                else
+                    table.insert(values, likwid.num2str(value))
+                end
+                if err ~= err then
+                    table.insert(errors, "-")
+                else
+                    table.insert(errors, likwid.num2str(err))
+                end
+            end
+            table.insert(tab, values)
+            table.insert(tab, errors)
+        end
+        if use_csv then
+            print(string.format("TABLE,Group %d Scaled,%s,%d,%d slices,%f s%s",g,groupName,#tab[1]-1,
+                                likwid_getNumberOfSlices(g), total, string.rep(",",#tab-6)))
+            likwid.printcsv(tab, #tab)
+        else
+            print(string.format("Group %d: %s, scaled to %.6f s from %.6f s in %d slices", g, groupName,
+                                total, likwid.getRuntimeOfGroup(g), likwid_getNumberOfSlices(g)))
+            likwid.printtable(tab)
+        end
+    end
+end
+
+likwid.printScaledOutput = printScaledOutput
+
 
 
 local function getResults(nan2value)
@@ -1044,6 +1197,53 @@ end
 
 likwid.getMetrics = getMetrics
 
+-- Results and metrics of all groups like getResults() and getMetrics() plus
+-- the node reductions for printOutput(). Each value is only evaluated once, by
+-- the reduction in the library.
+local function getReducedResults(nan2value)
+    local results = {}
+    local metrics = {}
+    local reductions = {}
+    local nr_groups = likwid_getNumberOfGroups()
+    local nr_threads = likwid_getNumberOfThreads()
+    if not nan2value then
+        nan2value = '-'
+    end
+    for i=1,nr_groups do
+        reductions[i] = {}
+        for _, source in pairs({"results", "metrics"}) do
+            local out = (source == "results" and results or metrics)
+            local nr_values = (source == "results" and likwid_getNumberOfEvents(i) or likwid_getNumberOfMetrics(i))
+            local red = nil
+            if nr_values > 0 then
+                red = likwid_reduce(i, source, "node")
+            end
+            reductions[i][source] = red
+            out[i] = {}
+            for j=1,nr_values do
+                out[i][j] = {}
+                for k=1, nr_threads do
+                    local value = nil
+                    if red ~= nil then
+                        value = red["values"][j][k]
+                    elseif source == "results" then
+                        value = likwid_getResult(i,j,k)
+                    else
+                        value = likwid_getMetric(i,j,k)
+                    end
+                    if value ~= value then
+                        value = nan2value
+                    end
+                    out[i][j][k] = value
+                end
+            end
+        end
+    end
+    return results, metrics, reductions
+end
+
+likwid.getReducedResults = getReducedResults
+
 local function getLastMetrics(nan2value)
     local results = {}
     local nr_groups = likwid_getNumberOfGroups()
@@ -63,6 +63,7 @@
 
 void (*freq_init_f)() = NULL;
 int (*freq_send)(FreqDataRecordType type, FreqDataRecordLocation loc, int cpu, int len, char* data) = NULL;
+int (*freq_send_batch)(int num_cpus, const int* cpus, int num_entries, FreqBatchEntry* entries, int* status) = NULL;
 void (*freq_finalize_f)() = NULL;
 static int freq_initialized = 0;
 static int own_hpm = 0;
@@ -525,6 +526,39 @@ static int freq_send_direct(FreqDataRecordType type, FreqDataRecordLocation loc,
     return 0;
 }
 
+static int freq_send_batch_direct(int num_cpus, const int* cpus, int num_entries, FreqBatchEntry* entries, int* status)
+{
+    int err = 0;
+    int failed[LIKWID_FREQUENCY_MAX_BATCH_ENTRIES];
+    for (int i = 0; i < num_cpus; i++)
+    {
+        int retry = 0;
+        status[i] = 0;
+        for (int j = 0; j < num_entries; j++)
+        {
+            failed[j] = freq_send_direct(FREQ_WRITE, entries[j].loc, cpus[i], entries[j].datalen, entries[j].data);
+            if (failed[j] < 0)
+                retry = 1;
+        }
+        if (retry)
+        {
+            for (int j = 0; j < num_entries; j++)
+            {
+                if (failed[j] == 0)
+                    continue;
+                failed[j] = freq_send_direct(FREQ_WRITE, entries[j].loc, cpus[i], entries[j].datalen, entries[j].data);
+                if (failed[j] < 0 && status[i] == 0)
+                {
+                    status[i] = failed[j];
+                    if (err == 0)
+                        err = failed[j];
+                }
+            }
+        }
+    }
+    return err;
+}
+
 static void freq_finalize_direct()
 {
     //printf("Calling %s\n", __func__);
@@ -548,6 +582,24 @@ static void freq_init_client()
     return;
 }
 
+static int freq_errorcode_to_errno(FreqDataRecordError errorcode)
+{
+    switch(errorcode)
+    {
+        case FREQ_ERR_NONE:
+            return 0;
+        case FREQ_ERR_NOFILE:
+            return -ENOENT;
+        case FREQ_ERR_NOPERM:
+            return -EACCES;
+        case FREQ_ERR_UNKNOWN:
+            return -EBADF;
+        default:
+            break;
+    }
+    return -1;
+}
+
 static int freq_send_client(FreqDataRecordType type, FreqDataRecordLocation loc, int cpu, int len, char* data)
 {
     //printf("Calling %s\n", __func__);
@@ -564,26 +616,85 @@ static int freq_send_client(FreqDataRecordType type, FreqDataRecordLocation loc,
         DEBUG_PRINT(DEBUGLEV_DEVELOP, DAEMON CMD %s CPU %d LOC %d, (type == FREQ_WRITE ? "WRITE" : "READ"), cpu, loc);
         CHECK_ERROR(write(fsocket, &record, sizeof(FreqDataRecord)),socket write failed);
         CHECK_ERROR(read(fsocket, &record, sizeof(FreqDataRecord)), socket read failed);
-        if (record.errorcode != FREQ_ERR_NONE)
+        return freq_errorcode_to_errno(record.errorcode);
+    }
+    return 0;
+}
+
+static int freq_read_full(int fd, void* buf, size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        int ret = read(fd, ((char*)buf) + done, len - done);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0)
+        {
+            return -1;
+        }
+        done += ret;
+    }
+    return 0;
+}
+
+static int freq_send_batch_client(int num_cpus, const int* cpus, int num_entries, FreqBatchEntry* entries, int* status)
+{
+    int err = 0;
+    FreqDataRecord record;
+    FreqBatchRecord batch;
+    if (fsocket < 0)
+    {
+        return -EBADF;
+    }
+    memset(&record, 0, sizeof(FreqDataRecord));
+    record.type = FREQ_BATCH;
+    record.datalen = sizeof(FreqBatchRecord);
+    memset(&batch, 0, sizeof(FreqBatchRecord));
+    batch.numEntries = num_entries;
+    memcpy(batch.entries, entries, num_entries * sizeof(FreqBatchEntry));
+
+    for (int off = 0; off < num_cpus; off += LIKWID_FREQUENCY_MAX_BATCH_CPUS)
+    {
+        int count = num_cpus - off;
+        if (count > LIKWID_FREQUENCY_MAX_BATCH_CPUS)
+            count = LIKWID_FREQUENCY_MAX_BATCH_CPUS;
+        batch.numCpus = count;
+        for (int i = 0; i < count; i++)
+        {
+            batch.cpus[i] = cpus[off+i];
+        }
+        DEBUG_PRINT(DEBUGLEV_DEVELOP, DAEMON CMD BATCH CPUS %d ENTRIES %d, count, num_entries);
+        if (write(fsocket, &record, sizeof(FreqDataRecord)) < 0 ||
+            write(fsocket, &batch, sizeof(FreqBatchRecord)) < 0)
         {
-            switch(record.errorcode)
+            ERROR_PRINT(Socket write failed for batch record);
+            return -errno;
+        }
+        if (freq_read_full(fsocket, &batch, sizeof(FreqBatchRecord)) < 0)
+        {
+            ERROR_PRINT(Socket read failed for batch record);
+            return -EIO;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            status[off+i] = 0;
+            for (int j = 0; j < num_entries; j++)
             {
-                case FREQ_ERR_NOFILE:
-                    return -ENOENT;
-                    break;
-                case FREQ_ERR_NOPERM:
-                    return -EACCES;
-                    break;
-                case FREQ_ERR_UNKNOWN:
-                    return -EBADF;
-                    break;
-                default:
+                int e = freq_errorcode_to_errno(batch.errorcodes[i][j]);
+                if (e < 0)
+                {
+                    status[off+i] = e;
+                    if (err == 0)
+                        err = e;
                     break;
+                }
             }
-            return -1;
         }
     }
-    return 0;
+    return err;
 }
 
 static void freq_finalize_client()
@@ -944,6 +1055,7 @@ _freqInit(void)
             DEBUG_PLAIN_PRINT(DEBUGLEV_DEVELOP, Adjusting functions for daemon mode);
             freq_init_f = freq_init_client;
             freq_send = freq_send_client;
+            freq_send_batch = freq_send_batch_client;
             freq_finalize_f = freq_finalize_client;
         }
         else if (config.daemonMode == ACCESSMODE_DIRECT)
@@ -951,6 +1063,7 @@ _freqInit(void)
             DEBUG_PLAIN_PRINT(DEBUGLEV_DEVELOP, Adjusting functions for direct mode);
             freq_init_f = freq_init_direct;
             freq_send = freq_send_direct;
+            freq_send_batch = freq_send_batch_direct;
             freq_finalize_f = freq_finalize_direct;
         }
         else if (config.daemonMode == ACCESSMODE_PERF)
@@ -995,6 +1108,7 @@ void _freqFinalize(void)
     freq_initialized = 0;
     freq_finalize_f = NULL;
     freq_send = NULL;
+    freq_send_batch = NULL;
     freq_init_f = NULL;
     if (own_hpm)
         HPMfinalize();
@@ -1091,6 +1205,68 @@ int freq_setGovernor(const int cpu_id, const char* gov)
     return -EINVAL;
 }
 
+int freq_setCpuClocks(const int num_cpus, const int* cpus, const uint64_t min_freq, const uint64_t max_freq, const char* gov, int* status)
+{
+    int ret = 0;
+    int num_entries = 0;
+    int* tmp_status = status;
+    FreqBatchEntry entries[LIKWID_FREQUENCY_MAX_BATCH_ENTRIES];
+    if (num_cpus <= 0 || !cpus)
+    {
+        return -EINVAL;
+    }
+    if (!freq_initialized)
+    {
+        _freqInit();
+    }
+    if (!freq_send_batch)
+    {
+        return -ENODEV;
+    }
+    memset(entries, 0, sizeof(entries));
+    if (gov)
+    {
+        entries[num_entries].loc = FREQ_LOC_GOV;
+        ret = snprintf(entries[num_entries].data, LIKWID_FREQUENCY_MAX_DATA_LENGTH-1, "%s", gov);
+        if (ret <= 0)
+        {
+            return -EINVAL;
+        }
+        entries[num_entries].datalen = LIKWID_FREQUENCY_MAX_DATA_LENGTH;
+        num_entries++;
+    }
+    if (min_freq > 0)
+    {
+        entries[num_entries].loc = FREQ_LOC_MIN;
+        entries[num_entries].datalen = snprintf(entries[num_entries].data, LIKWID_FREQUENCY_MAX_DATA_LENGTH-1, "%lu", min_freq);
+        num_entries++;
+    }
+    if (max_freq > 0)
+    {
+        entries[num_entries].loc = FREQ_LOC_MAX;
+        entries[num_entries].datalen = snprintf(entries[num_entries].data, LIKWID_FREQUENCY_MAX_DATA_LENGTH-1, "%lu", max_freq);
+        num_entries++;
+    }
+    if (num_entries == 0)
+    {
+        return 0;
+    }
+    if (!tmp_status)
+    {
+        tmp_status = malloc(num_cpus * sizeof(int));
+        if (!tmp_status)
+        {
+            return -ENOMEM;
+        }
+    }
+    ret = freq_send_batch(num_cpus, cpus, num_entries, entries, tmp_status);
+    if (tmp_status != status)
+    {
+        free(tmp_status);
+    }
+    return ret;
+}
+
 uint64_t freq_getCpuClockBase(const int cpu_id)
 {
     uint64_t f = getBaseFreq(cpu_id);
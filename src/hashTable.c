@@ -124,6 +124,8 @@ hashTable_get(bstring label, LikwidThreadResults** resEntry)
         (*resEntry)->count = 0;
         (*resEntry)->index = resPtr->hashIndex++;
         (*resEntry)->state = MARKER_STATE_NEW;
+        (*resEntry)->numHistograms = 0;
+        (*resEntry)->histograms = NULL;
         for (int i=0; i< NUM_PMC; i++)
         {
             (*resEntry)->PMcounters[i] = 0.0;
@@ -195,6 +197,8 @@ hashTable_finalize(int* numThreads, int* numRegions, LikwidResults** results)
                         numberOfThreads * sizeof(int));
                 break;
             }
+            (*results)[i].numHistograms = 0;
+            (*results)[i].histograms = NULL;
             (*results)[i].counters = (double**) malloc(numberOfThreads * sizeof(double*));
             if (!(*results)[i].counters)
             {
@@ -269,6 +273,21 @@ hashTable_finalize(int* numThreads, int* numRegions, LikwidResults** results)
                 {
                     (*results)[*regionId].counters[threadId][j] = threadResult->PMcounters[j];
                 }
+                /* The histograms are handed over to the results */
+                if (threadResult->histograms != NULL)
+                {
+                    if ((*results)[*regionId].histograms == NULL)
+                    {
+                        (*results)[*regionId].histograms = calloc(numberOfThreads, sizeof(LikwidHistogram*));
+                    }
+                    if ((*results)[*regionId].histograms != NULL)
+                    {
+                        (*results)[*regionId].numHistograms = threadResult->numHistograms;
+                        (*results)[*regionId].histograms[threadId] = threadResult->histograms;
+                        threadResult->histograms = NULL;
+                        threadResult->numHistograms = 0;
+                    }
+                }
             }
 
             threadId++;
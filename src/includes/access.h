@@ -30,6 +30,19 @@
 #ifndef ACCESS_H
 #define ACCESS_H
 
+typedef struct {
+    PciDeviceIndex dev;
+    uint32_t reg;
+    uint64_t data;
+    int config; /* plain configuration register, may be skipped if unchanged */
+} HPMRegWrite;
+
+typedef struct {
+    int numWrites;
+    int maxWrites;
+    HPMRegWrite* writes;
+} HPMProgram;
+
 void HPMmode(int mode);
 int HPMinit(void);
 int HPMinitialized(void);
@@ -38,5 +51,11 @@ void HPMfinalize();
 int HPMread(int cpu_id, PciDeviceIndex dev, uint32_t reg, uint64_t* data);
 int HPMwrite(int cpu_id, PciDeviceIndex dev, uint32_t reg, uint64_t data);
 int HPMcheck(PciDeviceIndex dev, int cpu_id);
+int HPMrecordProgram(int cpu_id, HPMProgram* prog);
+int HPMapplyProgram(int cpu_id, HPMProgram* prog, int skipUnchanged);
+void HPMfreeProgram(HPMProgram* prog);
+int HPMshared(void);
+int HPMreadSystem(int cpu_id, PciDeviceIndex dev, uint32_t reg, uint64_t* data);
+int HPMgeneration(uint64_t* generation);
 
 #endif /* ACCESS_H */
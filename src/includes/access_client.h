@@ -35,5 +35,8 @@ int access_client_read(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint6
 int access_client_write(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data);
 void access_client_finalize(int cpu_id);
 int access_client_check(PciDeviceIndex dev, int cpu_id);
+int access_client_session(void);
+int access_client_readSystem(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data);
+int access_client_generation(uint64_t *generation);
 
 #endif /* ACCESS_CLIENT_H */
@@ -37,9 +37,19 @@ typedef enum {
     DAEMON_READ = 0,
     DAEMON_WRITE,
     DAEMON_CHECK,
-    DAEMON_EXIT
+    DAEMON_EXIT,
+    DAEMON_SYSTEM,      /* node daemon: make the session the system session */
+    DAEMON_SESSION,     /* node daemon: role of the session (AccessSessionType) */
+    DAEMON_READ_SYSTEM, /* node daemon: read register as programmed by the system session */
+    DAEMON_GENERATION   /* node daemon: number of register writes of the system session */
 } AccessType;
 
+typedef enum {
+    SESSION_OWNER = 0,  /* programs the registers it writes */
+    SESSION_SYSTEM,     /* the node-wide measurement, e.g. likwid-monitord */
+    SESSION_SHARED      /* read-only view on the registers of the system session */
+} AccessSessionType;
+
 typedef enum {
     ERR_NOERROR = 0,  /* no error */
     ERR_UNKNOWN,      /* unknown command */
@@ -0,0 +1,51 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  access_sim.h
+ *
+ *      Description:  Header file for the simulated register backend of the access module.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+#ifndef ACCESS_SIM_H
+#define ACCESS_SIM_H
+
+#include <types.h>
+
+typedef int (*AccessReadFunc)(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data);
+typedef int (*AccessWriteFunc)(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data);
+typedef int (*AccessCheckFunc)(PciDeviceIndex dev, int cpu_id);
+
+int access_sim_init(int cpu_id);
+int access_sim_read(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data);
+int access_sim_write(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data);
+void access_sim_finalize(int cpu_id);
+int access_sim_check(PciDeviceIndex dev, int cpu_id);
+
+int access_sim_recordInit(const char* filename, AccessReadFunc readFunc, AccessWriteFunc writeFunc, AccessCheckFunc checkFunc);
+int access_sim_recordRead(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t *data);
+int access_sim_recordWrite(PciDeviceIndex dev, const int cpu_id, uint32_t reg, uint64_t data);
+int access_sim_recordCheck(PciDeviceIndex dev, int cpu_id);
+void access_sim_recordFinalize(void);
+
+#endif /* ACCESS_SIM_H */
@@ -32,11 +32,14 @@
 #define LIKWID_FREQUENCY_CLIENT_H
 
 #define LIKWID_FREQUENCY_MAX_DATA_LENGTH   200
+#define LIKWID_FREQUENCY_MAX_BATCH_CPUS    64
+#define LIKWID_FREQUENCY_MAX_BATCH_ENTRIES 4
 
 typedef enum {
     FREQ_READ = 0,
     FREQ_WRITE,
-    FREQ_EXIT
+    FREQ_EXIT,
+    FREQ_BATCH
 } FreqDataRecordType;
 
 
@@ -68,4 +71,22 @@ typedef struct {
     char data[LIKWID_FREQUENCY_MAX_DATA_LENGTH];
 } FreqDataRecord;
 
+/* A batch is announced by a FreqDataRecord with type FREQ_BATCH and is
+ * followed by one FreqBatchRecord. The daemon applies all entries to all
+ * listed CPUs and sends the FreqBatchRecord back with the per-CPU and
+ * per-entry error codes filled in. */
+typedef struct {
+    FreqDataRecordLocation loc;
+    int datalen;
+    char data[LIKWID_FREQUENCY_MAX_DATA_LENGTH];
+} FreqBatchEntry;
+
+typedef struct {
+    uint32_t numCpus;
+    uint32_t numEntries;
+    uint32_t cpus[LIKWID_FREQUENCY_MAX_BATCH_CPUS];
+    FreqBatchEntry entries[LIKWID_FREQUENCY_MAX_BATCH_ENTRIES];
+    uint8_t errorcodes[LIKWID_FREQUENCY_MAX_BATCH_CPUS][LIKWID_FREQUENCY_MAX_BATCH_ENTRIES];
+} FreqBatchRecord;
+
 #endif /* LIKWID_FREQUENCY_CLIENT_H */
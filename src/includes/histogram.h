@@ -0,0 +1,132 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  histogram.h
+ *
+ *      Description:  Header File histogram Module.
+ *                    Log-scaled histograms for the Marker API region durations
+ *                    and counter deltas
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <string.h>
+#include <math.h>
+#include <types.h>
+
+static inline void
+histogram_reset(LikwidHistogram* hist, int event)
+{
+    memset(hist, 0, sizeof(LikwidHistogram));
+    hist->event = event;
+}
+
+static inline int
+histogram_bucket(double value)
+{
+    int exp = 0;
+    double mant = 0;
+    int bucket = 0;
+    if (!(value >= 1.0))
+    {
+        return 0;
+    }
+    /* value = mant * 2^exp with mant in [0.5, 1) and exp >= 1 */
+    mant = frexp(value, &exp);
+    bucket = (exp - 1) * LIKWID_HIST_SUB_BUCKETS + (int)((mant - 0.5) * 2 * LIKWID_HIST_SUB_BUCKETS);
+    return (bucket < LIKWID_HIST_BUCKETS ? bucket : LIKWID_HIST_BUCKETS - 1);
+}
+
+/* Highest value that falls into the bucket */
+static inline double
+histogram_bucketValue(int bucket)
+{
+    int exp = bucket / LIKWID_HIST_SUB_BUCKETS;
+    int sub = bucket % LIKWID_HIST_SUB_BUCKETS;
+    return ldexp(1.0 + (double)(sub + 1) / LIKWID_HIST_SUB_BUCKETS, exp);
+}
+
+static inline void
+histogram_add(LikwidHistogram* hist, double value)
+{
+    if (isnan(value))
+    {
+        return;
+    }
+    hist->buckets[histogram_bucket(value)]++;
+    hist->count++;
+    if (value > hist->max)
+    {
+        hist->max = value;
+    }
+}
+
+static inline void
+histogram_merge(LikwidHistogram* dst, const LikwidHistogram* src)
+{
+    for (int i = 0; i < LIKWID_HIST_BUCKETS; i++)
+    {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    if (src->max > dst->max)
+    {
+        dst->max = src->max;
+    }
+}
+
+/* Percentile p in [0,100], the upper bound of the bucket is returned but never
+ * more than the recorded maximum. */
+static inline double
+histogram_percentile(const LikwidHistogram* hist, double p)
+{
+    uint64_t target = 0;
+    uint64_t sum = 0;
+    if (hist->count == 0)
+    {
+        return NAN;
+    }
+    if (p >= 100.0)
+    {
+        return hist->max;
+    }
+    target = (uint64_t)ceil((p / 100.0) * hist->count);
+    if (target == 0)
+    {
+        target = 1;
+    }
+    for (int i = 0; i < LIKWID_HIST_BUCKETS; i++)
+    {
+        sum += hist->buckets[i];
+        if (sum >= target)
+        {
+            double v = histogram_bucketValue(i);
+            return (v < hist->max ? v : hist->max);
+        }
+    }
+    return hist->max;
+}
+
+#endif /* HISTOGRAM_H */
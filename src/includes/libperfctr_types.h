@@ -39,6 +39,20 @@ typedef enum LikwidThreadStates {
     MARKER_STATE_STOP
 } LikwidThreadStates;
 
+/* Log-scaled histogram with fixed buckets. Each power of two is split into
+ * LIKWID_HIST_SUB_BUCKETS linear buckets, values below 1 go into bucket 0. */
+#define LIKWID_HIST_SUB_BUCKETS 16
+#define LIKWID_HIST_BUCKETS (64 * LIKWID_HIST_SUB_BUCKETS)
+/* Region duration plus up to four counter deltas */
+#define LIKWID_HIST_MAX 5
+
+typedef struct {
+    int event; /* -1 for the region duration in ns, otherwise the event index */
+    double max;
+    uint64_t count;
+    uint32_t buckets[LIKWID_HIST_BUCKETS];
+} LikwidHistogram;
+
 typedef struct LikwidThreadResults{
     bstring  label;
     uint32_t index;
@@ -51,6 +65,9 @@ typedef struct LikwidThreadResults{
     int StartOverflows[NUM_PMC];
     double PMcounters[NUM_PMC];
     LikwidThreadStates state;
+    uint64_t generation;
+    int numHistograms;
+    LikwidHistogram* histograms;
 } LikwidThreadResults;
 
 typedef struct {
@@ -81,6 +98,8 @@ typedef struct {
     uint32_t*  count;
     int* cpulist;
     double** counters;
+    int numHistograms;
+    LikwidHistogram** histograms;
 } LikwidResults;
 
 #endif /*LIBPERFCTR_H*/
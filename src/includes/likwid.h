@@ -193,13 +193,14 @@ higher priviledges.
 typedef enum {
     ACCESSMODE_PERF = -1, /*!< \brief Access performance monitoring through perf_event kernel interface */
     ACCESSMODE_DIRECT = 0, /*!< \brief Access performance monitoring registers directly */
-    ACCESSMODE_DAEMON = 1 /*!< \brief Use the access daemon to access the registers */
+    ACCESSMODE_DAEMON = 1, /*!< \brief Use the access daemon to access the registers */
+    ACCESSMODE_SIM = 2 /*!< \brief Simulate the registers from a trace, no hardware access (see LIKWID_SIM) */
 } AccessMode;
 
 /*! \brief Set access mode
 
-Sets the mode how the MSR and PCI registers should be accessed. 0 for direct access (propably root priviledges required) and 1 for accesses through the access daemon. It must be called before HPMinit()
-@param [in] mode (0=direct, 1=daemon)
+Sets the mode how the MSR and PCI registers should be accessed. 0 for direct access (propably root priviledges required), 1 for accesses through the access daemon and 2 for simulated registers. It must be called before HPMinit()
+@param [in] mode (0=direct, 1=daemon, 2=simulated)
 */
 extern void HPMmode(int mode) __attribute__ ((visibility ("default") ));
 /*! \brief Initialize access module
@@ -672,6 +673,55 @@ extern int gpustr_to_gpulist(const char* gpustr, int* gpulist, int length)  __at
  *  @{
  */
 
+/*! \brief Statistics of a reduction over hardware threads */
+typedef enum {
+    PERFMON_STAT_SUM = 0, /*!< \brief Sum of all values */
+    PERFMON_STAT_MIN, /*!< \brief Minimal value */
+    PERFMON_STAT_MAX, /*!< \brief Maximal value */
+    PERFMON_STAT_AVG, /*!< \brief Average value */
+    NUM_PERFMON_STATS
+} PerfmonStat;
+
+/*! \brief Topology level used to group hardware threads in a reduction */
+typedef enum {
+    PERFMON_LEVEL_HWTHREAD = 0, /*!< \brief Each hardware thread is its own domain */
+    PERFMON_LEVEL_CORE, /*!< \brief Hardware threads of a physical core */
+    PERFMON_LEVEL_LLC, /*!< \brief Last level cache domains (affinity domains C*) */
+    PERFMON_LEVEL_NUMA, /*!< \brief NUMA domains (affinity domains M*) */
+    PERFMON_LEVEL_SOCKET, /*!< \brief CPU sockets (affinity domains S*) */
+    PERFMON_LEVEL_NODE, /*!< \brief All measured hardware threads */
+    NUM_PERFMON_LEVELS
+} PerfmonDomainLevel;
+
+/*! \brief Values a reduction is calculated from */
+typedef enum {
+    PERFMON_REDUCE_RESULT = 0, /*!< \brief Results of the events, see perfmon_getResult() */
+    PERFMON_REDUCE_LASTRESULT, /*!< \brief Results of the last measurement, see perfmon_getLastResult() */
+    PERFMON_REDUCE_METRIC, /*!< \brief Derived metrics, see perfmon_getMetric() */
+    PERFMON_REDUCE_LASTMETRIC, /*!< \brief Derived metrics of the last measurement, see perfmon_getLastMetric() */
+    NUM_PERFMON_REDUCE_SOURCES
+} PerfmonReduceSource;
+
+/*! \brief Reduction of the events or metrics of a group over topology domains
+
+The statistics are stored as \a stats[(d*numValues+v)*NUM_PERFMON_STATS+s] for
+domain \a d, event or metric \a v and statistic \a s. NAN values are skipped,
+domains without valid values have NAN statistics. The values of the threads
+the statistics were calculated from are stored as \a values[t*numValues+v],
+so printers do not need to evaluate them again.
+*/
+typedef struct {
+    PerfmonDomainLevel level; /*!< \brief Topology level of the domains */
+    int numDomains; /*!< \brief Number of domains with measured hardware threads */
+    char** domainNames; /*!< \brief Name of each domain */
+    int* numThreads; /*!< \brief Number of measured hardware threads in each domain */
+    int numThreadsTotal; /*!< \brief Number of measured hardware threads */
+    int* threadDomain; /*!< \brief Domain index of each thread or -1 */
+    int numValues; /*!< \brief Number of events or metrics */
+    double* stats; /*!< \brief Statistics, numDomains x numValues x NUM_PERFMON_STATS */
+    double* values; /*!< \brief Value of each thread, numThreadsTotal x numValues */
+} PerfmonReduction;
+
 /*! \brief Get all groups
 
 Checks the configured performance group path for the current architecture and
@@ -932,6 +982,77 @@ extern int perfmon_getNumberOfMetrics(int groupId) __attribute__ ((visibility ("
 */
 extern double perfmon_getLastTimeOfGroup(int groupId) __attribute__ ((visibility ("default") ));
 
+/*! \brief Set the share of measurement time of a group when multiplexing
+
+The weight is used by perfmon_getNextGroup(). All groups start with weight 1.
+@param [in] groupId ID of group
+@param [in] weight Positive weight of the group
+@return 0 or -EINVAL
+*/
+extern int perfmon_setGroupWeight(int groupId, double weight) __attribute__ ((visibility ("default") ));
+/*! \brief Get the next group to measure when multiplexing event groups
+
+If all groups have the same weight, the groups are rotated round-robin. Otherwise
+the group with the smallest measurement time relative to its weight is returned.
+The result can be passed to perfmon_switchActiveGroup().
+@return ID of the next group or negative error number
+*/
+extern int perfmon_getNextGroup(void) __attribute__ ((visibility ("default") ));
+/*! \brief Get the number of time slices a group was measured
+
+Every read or stop of the counters ends a time slice of the group.
+@param [in] groupId ID of group
+@return Number of time slices or negative error number
+*/
+extern int perfmon_getNumberOfSlices(int groupId) __attribute__ ((visibility ("default") ));
+/*! \brief Get the time the event was counting
+
+@param [in] groupId ID of the group that should be read
+@param [in] eventId ID of the event that should be read
+@param [in] threadId ID of the thread/cpu that should be read
+@return Enabled time in seconds
+*/
+extern double perfmon_getEnabledTime(int groupId, int eventId, int threadId) __attribute__ ((visibility ("default") ));
+/*! \brief Get the result of an event scaled to the total measurement time
+
+When multiplexing groups, each group only counts a fraction of the time. The count
+is extrapolated to the sum of the measurement times of all groups.
+@param [in] groupId ID of the group that should be read
+@param [in] eventId ID of the event that should be read
+@param [in] threadId ID of the thread/cpu that should be read
+@return The scaled counter result
+*/
+extern double perfmon_getScaledResult(int groupId, int eventId, int threadId) __attribute__ ((visibility ("default") ));
+/*! \brief Get the error estimate of the scaled result
+
+Standard error of the scaled result derived from the variance of the rates in the
+single time slices. At least two slices are required.
+@param [in] groupId ID of the group that should be read
+@param [in] eventId ID of the event that should be read
+@param [in] threadId ID of the thread/cpu that should be read
+@return Absolute error of the scaled result or NAN
+*/
+extern double perfmon_getScaledResultError(int groupId, int eventId, int threadId) __attribute__ ((visibility ("default") ));
+/*! \brief Reduce the events or metrics of a group over topology domains
+
+Calculates sum, minimum, maximum and average of all events or metrics of a group
+for each domain of the given topology level in one pass over the measured
+hardware threads. Above the hardware thread level, uncore counters and metrics
+using them only take the threads into account that measured the socket.
+The result must be freed with perfmon_freeReduction().
+@param [in] groupId ID of the group that should be reduced
+@param [in] source Values to reduce (results or metrics, full or last measurement)
+@param [in] level Topology level of the domains
+@param [out] reduction Pointer to store the reduction
+@return 0 or negative error number
+*/
+extern int perfmon_reduce(int groupId, PerfmonReduceSource source, PerfmonDomainLevel level, PerfmonReduction** reduction) __attribute__ ((visibility ("default") ));
+/*! \brief Free a reduction returned by perfmon_reduce()
+
+@param [in] reduction Reduction to free
+*/
+extern void perfmon_freeReduction(PerfmonReduction* reduction) __attribute__ ((visibility ("default") ));
+
 /*! \brief Read the output file of the Marker API
 @param [in] filename Filename with Marker API results
 @return 0 or negative error number
@@ -1004,7 +1125,124 @@ extern double perfmon_getResultOfRegionThread(int region, int event, int thread)
 @return Metric result of a region for a thread
 */
 extern double perfmon_getMetricOfRegionThread(int region, int metricId, int threadId) __attribute__ ((visibility ("default") ));
+/*! \brief Get the number of histograms of a region
 
+Histograms are recorded if the application was run with LIKWID_HISTOGRAM set
+(likwid-perfctr -m --histogram). The first histogram holds the durations of the
+single region calls, the other ones the counter deltas of selected events.
+@param [in] region ID of region
+@return Number of histograms or negative error number
+*/
+extern int perfmon_getHistogramsOfRegion(int region) __attribute__ ((visibility ("default") ));
+/*! \brief Get the event of a histogram of a region
+@param [in] region ID of region
+@param [in] hist ID of histogram
+@return -1 for the region duration, otherwise the ID of the event
+*/
+extern int perfmon_getHistogramEventOfRegion(int region, int hist) __attribute__ ((visibility ("default") ));
+/*! \brief Get a percentile of a histogram of a region
+
+The values are exact up to the resolution of the log-scaled buckets (1/16 of a
+power of two), the 100% percentile is the exact maximum.
+@param [in] region ID of region
+@param [in] hist ID of histogram
+@param [in] thread ID of thread or -1 for all threads of the region
+@param [in] percentile Percentile between 0 and 100
+@return Region duration in seconds or counter delta
+*/
+extern double perfmon_getHistogramPercentileOfRegionThread(int region, int hist, int thread, double percentile) __attribute__ ((visibility ("default") ));
+/*! \brief Get the number of values in a histogram of a region
+@param [in] region ID of region
+@param [in] hist ID of histogram
+@param [in] thread ID of thread or -1 for all threads of the region
+@return Number of recorded region calls or negative error number
+*/
+extern int perfmon_getHistogramCountOfRegionThread(int region, int hist, int thread) __attribute__ ((visibility ("default") ));
+
+/** @}*/
+
+/*
+################################################################################
+# Result file aggregation related functions
+################################################################################
+*/
+
+/** \addtogroup ResultFiles Aggregation of likwid-perfctr result files
+ *  @{
+ */
+/*! \brief Statistics calculated over all hardware threads of all result files */
+typedef enum {
+    RESULTSTAT_SUM = 0, /*!< \brief Sum of all values */
+    RESULTSTAT_MIN, /*!< \brief Minimal value */
+    RESULTSTAT_MAX, /*!< \brief Maximal value */
+    RESULTSTAT_AVG, /*!< \brief Average value */
+    RESULTSTAT_P25, /*!< \brief 25% percentile */
+    RESULTSTAT_P50, /*!< \brief 50% percentile (median) */
+    RESULTSTAT_P75, /*!< \brief 75% percentile */
+    NUM_RESULTSTATS
+} ResultFileStat;
+
+/*! \brief Aggregated values of one group (and region) over all result files
+
+The value arrays are stored row-wise, e.g. the value of counter \a c for column
+\a i is \a counters[c*numColumns+i]. Missing values are NAN.
+*/
+typedef struct {
+    int numColumns; /*!< \brief Number of hardware threads over all result files */
+    char** labels; /*!< \brief Label host:rank:hwthread for each column */
+    int numCounters; /*!< \brief Number of counters */
+    double* counters; /*!< \brief Counter values, numCounters x numColumns */
+    double* time; /*!< \brief Runtime for each column */
+    double* calls; /*!< \brief Region call count for each column or NULL without Marker API */
+    int numMetrics; /*!< \brief Number of metrics */
+    double* metrics; /*!< \brief Metric values, numMetrics x numColumns */
+    double* counterStats; /*!< \brief Statistics of the counters, numCounters x NUM_RESULTSTATS */
+    double timeStats[NUM_RESULTSTATS]; /*!< \brief Statistics of the runtime */
+    double callStats[NUM_RESULTSTATS]; /*!< \brief Statistics of the call counts */
+    double* metricStats; /*!< \brief Statistics of the metrics, numMetrics x NUM_RESULTSTATS */
+} ResultFileTable;
+
+/*! \brief Read CSV result files of likwid-perfctr
+
+Reads the files written with likwid-perfctr -O, e.g. one per MPI rank. The files are
+parsed in parallel by \a numThreads threads. Previously read files are released.
+@param [in] numFiles Number of files
+@param [in] files List of filenames
+@param [in] ranks Rank of each file (or NULL to use the list index)
+@param [in] hosts Hostname of each file (or NULL)
+@param [in] numThreads Number of parser threads
+@return Number of successfully parsed files or negative error number
+*/
+extern int resultfiles_read(int numFiles, char** files, int* ranks, char** hosts, int numThreads) __attribute__ ((visibility ("default") ));
+/*! \brief Get the Marker API regions found in the result files
+
+@param [out] regions List of region names, free only the list itself
+@return Number of regions
+*/
+extern int resultfiles_getRegions(char*** regions) __attribute__ ((visibility ("default") ));
+/*! \brief Aggregate a group over all result files
+
+Collects the values of the given counters for all hardware threads of all files
+ordered by rank, evaluates the metric formulas for each of them and calculates
+sum, min, max, average and percentiles of each counter and metric.
+@param [in] region Marker API region name or NULL
+@param [in] groupId Group ID as printed in the result files (starting at 1)
+@param [in] numCounters Number of counters
+@param [in] counters List of counter names
+@param [in] numMetrics Number of metrics
+@param [in] formulas List of metric formulas
+@param [out] table Aggregated table, free with resultfiles_freeTable()
+@return 0 or negative error number
+*/
+extern int resultfiles_aggregate(const char* region, int groupId, int numCounters, char** counters, int numMetrics, char** formulas, ResultFileTable** table) __attribute__ ((visibility ("default") ));
+/*! \brief Free an aggregated table
+
+@param [in] table Table returned by resultfiles_aggregate()
+*/
+extern void resultfiles_freeTable(ResultFileTable* table) __attribute__ ((visibility ("default") ));
+/*! \brief Release all read result files
+*/
+extern void resultfiles_destroy(void) __attribute__ ((visibility ("default") ));
 /** @}*/
 
 /*
@@ -1549,13 +1787,15 @@ extern int thermal_tread(int socket_fd, int cpuId, uint32_t *data) __attribute__
  */
 /*! \brief Sweeping the memory of a NUMA node
 
-Sweeps (zeros) the memory of NUMA node with ID \a domainId
+Sweeps (zeros) the memory of NUMA node with ID \a domainId. One thread per
+physical core of the NUMA node touches and evicts a part of the memory.
 @param [in] domainId NUMA node ID
 */
 extern void memsweep_domain(int domainId) __attribute__ ((visibility ("default") ));
 /*! \brief Sweeping the memory of all NUMA nodes covered by CPU list
 
-Sweeps (zeros) the memory of all NUMA nodes containing the CPUs in \a processorList
+Sweeps (zeros) the memory of all NUMA nodes containing the CPUs in \a processorList.
+All NUMA nodes are swept at the same time.
 @param [in] processorList List of CPU IDs
 @param [in] numberOfProcessors Number of CPUs in list
 */
@@ -1745,6 +1985,20 @@ Set the frequency governor of a hardware thread.
 @return 1 or 0 in case of errors
 */
 extern int freq_setGovernor(const int cpu_id, const char* gov) __attribute__ ((visibility ("default") ));
+/*! \brief Set governor, minimal and maximal clock frequency for a list of hardware threads
+
+Set governor, minimal and maximal clock frequency for a list of hardware threads. In
+daemon mode, the updates are transferred in batches and applied by the daemon in
+one pass instead of one round trip per hardware thread and setting.
+@param [in] num_cpus Number of hardware threads in cpus
+@param [in] cpus List of CPU IDs
+@param [in] min_freq Minimal frequency in kHz (0 to leave unchanged)
+@param [in] max_freq Maximal frequency in kHz (0 to leave unchanged)
+@param [in] gov Governor (NULL to leave unchanged)
+@param [out] status Error code per hardware thread (0 or -errno), may be NULL
+@return 0 or the first error code (-errno)
+*/
+extern int freq_setCpuClocks(const int num_cpus, const int* cpus, const uint64_t min_freq, const uint64_t max_freq, const char* gov, int* status) __attribute__ ((visibility ("default") ));
 /*! \brief Get the available frequencies of a hardware thread
 
 Get the available frequencies of a hardware thread. The returned string must be freed by the caller.
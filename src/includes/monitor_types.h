@@ -0,0 +1,92 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  monitor_types.h
+ *
+ *      Description:  Types file for the shared memory segment of the node monitor.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+#ifndef MONITOR_TYPES_H
+#define MONITOR_TYPES_H
+
+#include <stdint.h>
+
+#define MONITOR_SHM_MAGIC "LWMONSHM"
+#define MONITOR_SHM_VERSION 1
+#define MONITOR_NAME_LENGTH 64
+#define MONITOR_DOMAIN_LENGTH 16
+/* Statistics per value and domain: sum, min, max, avg (see PerfmonStat) */
+#define MONITOR_NUM_STATS 4
+
+/* Layout of the shared memory segment written by likwid-monitord:
+ *
+ *   MonitorShmHeader
+ *   MonitorShmGroup    groups[numGroups]          at groupOffset
+ *   MonitorShmValue    values[numGroups][maxValues] at valueOffset
+ *   char               domains[numDomains][MONITOR_DOMAIN_LENGTH] at domainOffset
+ *   double             data[numGroups][maxValues][numDomains][MONITOR_NUM_STATS]
+ *                                                 at dataOffset
+ *
+ * Domain 0 is the whole node, the following domains are the sockets. The
+ * segment is updated after every measurement window. Readers copy what they
+ * need and retry if seq was odd or changed meanwhile (sequence lock).
+ */
+
+typedef enum {
+    MONITOR_VALUE_METRIC = 0,
+    MONITOR_VALUE_EVENT
+} MonitorValueType;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t size;
+    volatile uint64_t seq;
+    int32_t numGroups;
+    int32_t numDomains;
+    int32_t maxValues;
+    int32_t activeGroup;
+    double interval;
+    uint32_t groupOffset;
+    uint32_t valueOffset;
+    uint32_t domainOffset;
+    uint32_t dataOffset;
+} MonitorShmHeader;
+
+typedef struct {
+    char name[MONITOR_NAME_LENGTH];
+    int32_t numValues;
+    int32_t numThreads;
+    uint64_t windows;
+    double timestamp;
+    double duration;
+} MonitorShmGroup;
+
+typedef struct {
+    char name[MONITOR_NAME_LENGTH];
+    char counter[MONITOR_DOMAIN_LENGTH];
+    int32_t type;
+} MonitorShmValue;
+
+#endif /*MONITOR_TYPES_H*/
@@ -192,6 +192,35 @@ typedef struct {
     PerfmonEventOption options[NUM_EVENT_OPTIONS]; /*!< \brief List of options */
 } PerfmonEvent;
 
+/*! \brief Compact description of an event in the generated event tables
+
+The name and the limit are offsets into the string pool and the default options
+are an offset into the option pool of a PerfmonEventTable. The entries contain
+no pointers, so the tables need no relocations when the library is loaded.
+*/
+typedef struct {
+    uint32_t        name; /*!< \brief Offset of the event name in the string pool */
+    uint32_t        limit; /*!< \brief Offset of the valid counters in the string pool */
+    uint32_t        options; /*!< \brief Offset of the first default option in the option pool */
+    uint32_t        numberOfOptions; /*!< \brief Number of default options */
+    uint64_t        eventId; /*!< \brief ID of the event */
+    uint64_t        umask; /*!< \brief Most events need to specify a mask to limit counting */
+    uint64_t        cfgBits; /*!< \brief Misc configuration bits */
+    uint64_t        cmask; /*!< \brief Misc mask bits */
+    uint64_t        optionMask; /*!< \brief Bitmask for fast check of set options */
+} PerfmonEventEntry;
+
+/*! \brief Generated event table of an architecture
+
+The PerfmonEvent list used at runtime is created from this table by perfmon_init_maps()
+*/
+typedef struct {
+    int                         numEvents; /*!< \brief Number of events */
+    const char*                 strings; /*!< \brief String pool with names and limits */
+    const PerfmonEventOption*   options; /*!< \brief Pool of default options */
+    const PerfmonEventEntry*    events; /*!< \brief List of events */
+} PerfmonEventTable;
+
 /*! \brief Structure describing performance monitoring counter data
 
 Each event holds one of these structures for each thread to store the counter
@@ -214,6 +243,21 @@ typedef struct {
 #endif
 } PerfmonCounter;
 
+/*! \brief Structure holding the per-slice statistics of an event
+
+When event groups are multiplexed, every interval between start and stop of a
+group is one time slice. The statistics are used to scale the counts to the
+whole measurement time and to estimate the error of the scaled value.
+\extends PerfmonEventSetEntry
+*/
+typedef struct {
+    int         slices; /*!< \brief Number of time slices */
+    double      time; /*!< \brief Enabled time of the event in seconds */
+    double      count; /*!< \brief Sum of counts over all slices */
+    double      rate2; /*!< \brief Time weighted sum of squared rates (sum of count^2/time) */
+    double      pending; /*!< \brief Count of the currently running slice */
+} PerfmonSliceStats;
+
 
 /*! \brief Structure specifying an performance monitoring event
 
@@ -225,6 +269,7 @@ typedef struct {
     RegisterIndex       index; /*!< \brief Index of the counter register in the counter map */
     RegisterType        type; /*!< \brief Type of the counter register and event */
     PerfmonCounter*     threadCounter; /*!< \brief List of counter data for each thread, list length is \a numberOfThreads in PerfmonGroupSet */
+    PerfmonSliceStats*  sliceStats; /*!< \brief List of time slice statistics for each thread, list length is \a numberOfThreads in PerfmonGroupSet */
 } PerfmonEventSetEntry;
 
 /*! \brief Structure specifying an performance monitoring event group
@@ -243,6 +288,10 @@ typedef struct {
     uint64_t              regTypeMask3; /*!< \brief Bitmask3 for easy checks which types are included in the eventSet */
     uint64_t              regTypeMask4; /*!< \brief Bitmask4 for easy checks which types are included in the eventSet */
     GroupState            state; /*!< \brief Current state of the event group (configured, started, none) */
+    int                   numSlices; /*!< \brief Number of time slices the group was measured */
+    double                sliceTime; /*!< \brief Time of the currently running slice */
+    double                weight; /*!< \brief Share of the measurement time when multiplexing groups */
+    uint64_t              generation; /*!< \brief Generation of the system session's register setup when the group was started (shared sessions only) */
     GroupInfo             group; /*!< \brief Structure holding the performance group information */
 } PerfmonEventSet;
 
@@ -55,6 +55,7 @@
 #include <perfmon.h>
 #include <bstrlib.h>
 #include <voltage.h>
+#include <histogram.h>
 
 /* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
 
@@ -69,6 +70,17 @@ static int registered_cpus = 0;
 static pthread_mutex_t globalLock = PTHREAD_MUTEX_INITIALIZER;
 static int use_locks = 0;
 static pthread_mutex_t threadLocks[MAX_NUM_THREADS] = { [ 0 ... (MAX_NUM_THREADS-1)] = PTHREAD_MUTEX_INITIALIZER};
+/* Histograms of region durations and counter deltas, enabled with LIKWID_HISTOGRAM.
+ * histEvents lists the event indices of each group with LIKWID_HIST_MAX slots per
+ * group, slot 0 is always the region duration (-1). */
+static int use_histograms = 0;
+static int* histEvents = NULL;
+static int* histCount = NULL;
+/* In a shared session of the node access daemon the counters belong to the
+ * system session. Region calls during which it reprogrammed the counters are
+ * not added to the counter results. */
+static int use_shared = 0;
+static uint64_t sharedDropped = 0;
 
 
 /* #####   MACROS  -  LOCAL TO THIS SOURCE FILE   ######################### */
@@ -146,6 +158,107 @@ calculateMarkerResult(RegisterIndex index, uint64_t start, uint64_t stop, int ov
     return result;
 }
 
+static void
+histogramInit(const char* histStr)
+{
+    struct bstrList* tokens = NULL;
+    bstring bHistStr = NULL;
+    histEvents = malloc(numberOfGroups * LIKWID_HIST_MAX * sizeof(int));
+    histCount = malloc(numberOfGroups * sizeof(int));
+    if (!histEvents || !histCount)
+    {
+        free(histEvents);
+        free(histCount);
+        histEvents = NULL;
+        histCount = NULL;
+        return;
+    }
+    bHistStr = bfromcstr(histStr);
+    tokens = bsplit(bHistStr, ',');
+    for (int g = 0; g < numberOfGroups; g++)
+    {
+        histEvents[g * LIKWID_HIST_MAX] = -1;
+        histCount[g] = 1;
+        for (int e = 0; e < perfmon_getNumberOfEvents(groups[g]); e++)
+        {
+            char* ctr = perfmon_getCounterName(groups[g], e);
+            for (int t = 0; ctr && t < tokens->qty; t++)
+            {
+                if (strcmp(ctr, bdata(tokens->entry[t])) == 0 && histCount[g] < LIKWID_HIST_MAX)
+                {
+                    histEvents[g * LIKWID_HIST_MAX + histCount[g]] = e;
+                    histCount[g]++;
+                }
+            }
+        }
+    }
+    bstrListDestroy(tokens);
+    bdestroy(bHistStr);
+    use_histograms = 1;
+}
+
+/* Writes the non-empty buckets of the histograms as lines
+ * H <regionId> <cpu> <event> <max> <numBuckets> <bucket> <count> ...
+ * Long histograms are split over multiple lines which are summed up when reading. */
+static void
+writeHistograms(FILE* file, int regionId, int cpu, int numHistograms, LikwidHistogram* hists)
+{
+    for (int k = 0; k < numHistograms; k++)
+    {
+        LikwidHistogram* h = &hists[k];
+        int b = 0;
+        if (h->count == 0)
+        {
+            continue;
+        }
+        while (b < LIKWID_HIST_BUCKETS)
+        {
+            int n = 0;
+            int first = b;
+            for (int i = b; i < LIKWID_HIST_BUCKETS && n < 64; i++)
+            {
+                if (h->buckets[i] > 0)
+                {
+                    n++;
+                }
+                b = i + 1;
+            }
+            if (n == 0)
+            {
+                break;
+            }
+            fprintf(file, "H %d %d %d %e %d", regionId, cpu, h->event, h->max, n);
+            for (int i = first; i < b; i++)
+            {
+                if (h->buckets[i] > 0)
+                {
+                    fprintf(file, " %d %u", i, h->buckets[i]);
+                }
+            }
+            fprintf(file, "\n");
+        }
+    }
+}
+
+/* Allocates the histograms of a region when it is registered or started the
+ * first time, so the stop of a region only updates buckets. */
+static void
+histogramAlloc(LikwidThreadResults* results, int groupId)
+{
+    int n = histCount[groupId];
+    results->histograms = malloc(n * sizeof(LikwidHistogram));
+    if (!results->histograms)
+    {
+        results->numHistograms = 0;
+        return;
+    }
+    for (int k = 0; k < n; k++)
+    {
+        histogram_reset(&results->histograms[k], histEvents[groupId * LIKWID_HIST_MAX + k]);
+    }
+    results->numHistograms = n;
+}
+
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
 
 void
@@ -165,6 +278,7 @@ likwid_markerInit(void)
     char* perfpid = getenv("LIKWID_PERF_EXECPID");
     char* debugStr = getenv("LIKWID_DEBUG");
     char* pinStr = getenv("LIKWID_PIN");
+    char* histStr = getenv("LIKWID_HISTOGRAM");
     char execpid[20];
     /* Dirty hack to avoid nonnull warnings */
     int (*ownatoi)(const char*);
@@ -268,6 +382,10 @@ likwid_markerInit(void)
     }
     bstrListDestroy(eventStrings);
     bdestroy(bEventStr);
+    if (histStr != NULL)
+    {
+        histogramInit(histStr);
+    }
 
     for (i=0; i<num_cpus; i++)
     {
@@ -289,6 +407,7 @@ likwid_markerInit(void)
 
     perfmon_setupCounters(groupSet->activeGroup);
     perfmon_startCounters();
+    use_shared = HPMshared();
 }
 
 void
@@ -372,6 +491,12 @@ likwid_markerClose(void)
     {
         return;
     }
+    if (sharedDropped > 0)
+    {
+        fprintf(stderr, "WARN: The system session reprogrammed the counters during %llu region calls, their counts are not included\n",
+                LLU_CAST sharedDropped);
+        sharedDropped = 0;
+    }
     hashTable_finalize(&numberOfThreads, &numberOfRegions, &results);
     if ((numberOfThreads == 0)||(numberOfRegions == 0))
     {
@@ -460,6 +585,11 @@ likwid_markerClose(void)
                 fprintf(file,"%s\n", bdata(l));
                 DEBUG_PRINT(DEBUGLEV_DEVELOP, %s, bdata(l));
                 bdestroy(l);
+                if (results[i].histograms && results[i].histograms[j])
+                {
+                    writeHistograms(file, newRegionID, results[i].cpulist[j],
+                                    results[i].numHistograms, results[i].histograms[j]);
+                }
             }
             newRegionID++;
         }
@@ -484,6 +614,14 @@ likwid_markerClose(void)
         {
             free(results[i].counters[j]);
         }
+        if (results[i].histograms)
+        {
+            for (int j=0;j<numberOfThreads; j++)
+            {
+                free(results[i].histograms[j]);
+            }
+            free(results[i].histograms);
+        }
         free(results[i].time);
         bdestroy(results[i].tag);
         free(results[i].count);
@@ -494,6 +632,12 @@ likwid_markerClose(void)
     {
         free(results);
     }
+    free(histEvents);
+    free(histCount);
+    histEvents = NULL;
+    histCount = NULL;
+    use_histograms = 0;
+    use_shared = 0;
     perfmon_finalize();
     HPMfinalize();
     likwid_init = 0;
@@ -516,6 +660,10 @@ likwid_markerRegisterRegion(const char* regionTag)
     bcatcstr(tag, groupSuffix);
     int cpu_id = hashTable_get(tag, &results);
     bdestroy(tag);
+    if (use_histograms && results->histograms == NULL)
+    {
+        histogramAlloc(results, groupSet->activeGroup);
+    }
 
 #ifndef LIKWID_USE_PERFEVENT
     // Add CPU to access layer if ACCESSMODE is direct or accessdaemon
@@ -552,6 +700,14 @@ likwid_markerStartRegion(const char* regionTag)
     {
         fprintf(stderr, "WARN: Region %s was already started\n", regionTag);
     }
+    if (use_histograms && results->histograms == NULL)
+    {
+        histogramAlloc(results, groupSet->activeGroup);
+    }
+    if (use_shared)
+    {
+        HPMgeneration(&results->generation);
+    }
     perfmon_readCountersCpu(cpu_id);
     results->cpuID = cpu_id;
     for(int i=0;i<groupSet->groups[groupSet->activeGroup].numberOfEvents;i++)
@@ -621,11 +777,31 @@ likwid_markerStopRegion(const char* regionTag)
     }
     results->groupID = groupSet->activeGroup;
     results->startTime.stop.int64 = timestamp.stop.int64;
-    results->time += timer_print(&(results->startTime));
+    double duration = timer_print(&(results->startTime));
+    results->time += duration;
     results->count++;
+    if (results->numHistograms > 0)
+    {
+        histogram_add(&results->histograms[0], duration * 1E9);
+    }
     bdestroy(tag);
 
     perfmon_readCountersCpu(cpu_id);
+    if (use_shared)
+    {
+        uint64_t generation = 0x0ULL;
+        HPMgeneration(&generation);
+        if (generation != results->generation)
+        {
+            __sync_fetch_and_add(&sharedDropped, 1);
+            results->state = MARKER_STATE_STOP;
+            if (use_locks == 1)
+            {
+                pthread_mutex_unlock(&threadLocks[myCPU]);
+            }
+            return 0;
+        }
+    }
 
     for(int i=0;i<groupSet->groups[groupSet->activeGroup].numberOfEvents;i++)
     {
@@ -637,6 +813,13 @@ likwid_markerStopRegion(const char* regionTag)
                                             results->StartOverflows[i]);
             DEBUG_PRINT(DEBUGLEV_DEVELOP, STOP [%s] READ EVENT [%d=%d] EVENT %d VALUE %llu DIFF %f, regionTag, thread_id, cpu_id, i,
                             LLU_CAST groupSet->groups[groupSet->activeGroup].events[i].threadCounter[thread_id].counterData, result);
+            for (int k = 1; k < results->numHistograms; k++)
+            {
+                if (results->histograms[k].event == i)
+                {
+                    histogram_add(&results->histograms[k], result);
+                }
+            }
             if ((counter_map[groupSet->groups[groupSet->activeGroup].events[i].index].type != THERMAL) &&
                 (counter_map[groupSet->groups[groupSet->activeGroup].events[i].index].type != VOLTAGE) &&
                 (counter_map[groupSet->groups[groupSet->activeGroup].events[i].index].type != MBOX0TMP))
@@ -742,6 +925,10 @@ likwid_markerResetRegion(const char* regionTag)
     results->count = 0;
     results->time = 0;
     timer_reset(&results->startTime);
+    for (int k = 0; k < results->numHistograms; k++)
+    {
+        histogram_reset(&results->histograms[k], results->histograms[k].event);
+    }
     return 0;
 }
 
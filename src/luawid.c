@@ -519,6 +519,156 @@ lua_likwid_getRuntimeOfGroup(lua_State* L)
     return 1;
 }
 
+static int
+lua_likwid_setGroupWeight(lua_State* L)
+{
+    int ret = 0;
+    int groupId;
+    double weight;
+    if (perfmon_isInitialized == 0)
+    {
+        return 0;
+    }
+    groupId = lua_tonumber(L,1);
+    weight = lua_tonumber(L,2);
+    ret = perfmon_setGroupWeight(groupId-1, weight);
+    lua_pushinteger(L, ret);
+    return 1;
+}
+
+static int
+lua_likwid_getNextGroup(lua_State* L)
+{
+    int ret = 0;
+    if (perfmon_isInitialized == 0)
+    {
+        return 0;
+    }
+    ret = perfmon_getNextGroup();
+    if (ret >= 0)
+    {
+        ret++;
+    }
+    lua_pushinteger(L, ret);
+    return 1;
+}
+
+static int
+lua_likwid_getNumberOfSlices(lua_State* L)
+{
+    int groupId;
+    if (perfmon_isInitialized == 0)
+    {
+        return 0;
+    }
+    groupId = lua_tonumber(L,1);
+    lua_pushinteger(L, perfmon_getNumberOfSlices(groupId-1));
+    return 1;
+}
+
+static int
+lua_likwid_getEnabledTime(lua_State* L)
+{
+    int groupId, eventId, threadId;
+    groupId = lua_tonumber(L,1);
+    eventId = lua_tonumber(L,2);
+    threadId = lua_tonumber(L,3);
+    lua_pushnumber(L, perfmon_getEnabledTime(groupId-1, eventId-1, threadId-1));
+    return 1;
+}
+
+static int
+lua_likwid_getScaledResult(lua_State* L)
+{
+    int groupId, eventId, threadId;
+    groupId = lua_tonumber(L,1);
+    eventId = lua_tonumber(L,2);
+    threadId = lua_tonumber(L,3);
+    lua_pushnumber(L, perfmon_getScaledResult(groupId-1, eventId-1, threadId-1));
+    lua_pushnumber(L, perfmon_getScaledResultError(groupId-1, eventId-1, threadId-1));
+    return 2;
+}
+
+static int
+lua_likwid_reduce(lua_State* L)
+{
+    static const char* sources[] = {"results", "lastresults", "metrics", "lastmetrics", NULL};
+    static const char* levels[] = {"hwthread", "core", "llc", "numa", "socket", "node", NULL};
+    static const char* stats[] = {"sum", "min", "max", "avg"};
+    int i = 0, d = 0, v = 0;
+    int groupId = 0;
+    int source = 0, level = 0;
+    PerfmonReduction* r = NULL;
+    if (perfmon_isInitialized == 0)
+    {
+        return 0;
+    }
+    groupId = lua_tonumber(L,1);
+    source = luaL_checkoption(L, 2, "results", sources);
+    level = luaL_checkoption(L, 3, "hwthread", levels);
+    if (perfmon_reduce(groupId-1, source, level, &r) < 0)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+    lua_newtable(L);
+    lua_pushstring(L, "names");
+    lua_newtable(L);
+    for (d = 0; d < r->numDomains; d++)
+    {
+        lua_pushstring(L, r->domainNames[d]);
+        lua_rawseti(L, -2, d+1);
+    }
+    lua_settable(L, -3);
+    lua_pushstring(L, "threads");
+    lua_newtable(L);
+    for (d = 0; d < r->numDomains; d++)
+    {
+        lua_pushinteger(L, r->numThreads[d]);
+        lua_rawseti(L, -2, d+1);
+    }
+    lua_settable(L, -3);
+    lua_pushstring(L, "threadDomain");
+    lua_newtable(L);
+    for (i = 0; i < r->numThreadsTotal; i++)
+    {
+        lua_pushinteger(L, r->threadDomain[i] + 1);
+        lua_rawseti(L, -2, i+1);
+    }
+    lua_settable(L, -3);
+    for (i = 0; i < NUM_PERFMON_STATS; i++)
+    {
+        lua_pushstring(L, stats[i]);
+        lua_newtable(L);
+        for (v = 0; v < r->numValues; v++)
+        {
+            lua_newtable(L);
+            for (d = 0; d < r->numDomains; d++)
+            {
+                lua_pushnumber(L, r->stats[(d * r->numValues + v) * NUM_PERFMON_STATS + i]);
+                lua_rawseti(L, -2, d+1);
+            }
+            lua_rawseti(L, -2, v+1);
+        }
+        lua_settable(L, -3);
+    }
+    lua_pushstring(L, "values");
+    lua_newtable(L);
+    for (v = 0; v < r->numValues; v++)
+    {
+        lua_newtable(L);
+        for (i = 0; i < r->numThreadsTotal; i++)
+        {
+            lua_pushnumber(L, r->values[i * r->numValues + v]);
+            lua_rawseti(L, -2, i+1);
+        }
+        lua_rawseti(L, -2, v+1);
+    }
+    lua_settable(L, -3);
+    perfmon_freeReduction(r);
+    return 1;
+}
+
 static int
 lua_likwid_getNumberOfEvents(lua_State* L)
 {
@@ -2506,6 +2656,186 @@ lua_likwid_markerFile_read(lua_State* L)
     return 1;
 }
 
+static int
+lua_likwid_tableLength(lua_State* L, int idx)
+{
+#if LUA_VERSION_NUM == 501
+    return (int)lua_objlen(L, idx);
+#else
+    return (int)lua_rawlen(L, idx);
+#endif
+}
+
+static char**
+lua_likwid_stringList(lua_State* L, int idx, int* count)
+{
+    int i = 0;
+    int n = lua_likwid_tableLength(L, idx);
+    char** list = malloc((n + 1) * sizeof(char*));
+    if (!list)
+    {
+        *count = 0;
+        return NULL;
+    }
+    for (i = 1; i <= n; i++)
+    {
+        lua_rawgeti(L, idx, i);
+        list[i-1] = (char*)lua_tostring(L, -1);
+        lua_pop(L, 1);
+    }
+    list[n] = NULL;
+    *count = n;
+    return list;
+}
+
+static void
+lua_likwid_pushDoubleList(lua_State* L, const double* values, int n)
+{
+    int i = 0;
+    lua_newtable(L);
+    for (i = 0; i < n; i++)
+    {
+        lua_pushnumber(L, values[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+}
+
+static void
+lua_likwid_pushDoubleMatrix(lua_State* L, const double* values, int rows, int cols)
+{
+    int i = 0;
+    lua_newtable(L);
+    for (i = 0; i < rows; i++)
+    {
+        lua_likwid_pushDoubleList(L, &values[i * cols], cols);
+        lua_rawseti(L, -2, i+1);
+    }
+}
+
+static int
+lua_likwid_readResultFiles(lua_State* L)
+{
+    int i = 0;
+    int n = 0, nhosts = 0;
+    int ret = 0;
+    int* ranks = NULL;
+    char** files = NULL;
+    char** hosts = NULL;
+    int nthreads = luaL_optinteger(L, 4, 1);
+    luaL_checktype(L, 1, LUA_TTABLE);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    files = lua_likwid_stringList(L, 1, &n);
+    hosts = lua_likwid_stringList(L, 3, &nhosts);
+    ranks = malloc((n + 1) * sizeof(int));
+    if (!files || !hosts || !ranks || nhosts < n)
+    {
+        free(files);
+        free(hosts);
+        free(ranks);
+        lua_pushinteger(L, -ENOMEM);
+        return 1;
+    }
+    for (i = 1; i <= n; i++)
+    {
+        lua_rawgeti(L, 2, i);
+        ranks[i-1] = (int)lua_tointeger(L, -1);
+        lua_pop(L, 1);
+    }
+    ret = resultfiles_read(n, files, ranks, hosts, nthreads);
+    free(files);
+    free(hosts);
+    free(ranks);
+    lua_pushinteger(L, ret);
+    return 1;
+}
+
+static int
+lua_likwid_getResultFileRegions(lua_State* L)
+{
+    int i = 0;
+    char** regions = NULL;
+    int n = resultfiles_getRegions(&regions);
+    lua_newtable(L);
+    for (i = 0; i < n; i++)
+    {
+        lua_pushstring(L, regions[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+    free(regions);
+    return 1;
+}
+
+static int
+lua_likwid_aggregateResultFiles(lua_State* L)
+{
+    int i = 0;
+    int ret = 0;
+    int ncounters = 0, nmetrics = 0;
+    char** counters = NULL;
+    char** formulas = NULL;
+    ResultFileTable* t = NULL;
+    const char* region = (lua_isnoneornil(L, 1) ? NULL : luaL_checkstring(L, 1));
+    int group = luaL_checkinteger(L, 2);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    luaL_checktype(L, 4, LUA_TTABLE);
+    counters = lua_likwid_stringList(L, 3, &ncounters);
+    formulas = lua_likwid_stringList(L, 4, &nmetrics);
+    ret = resultfiles_aggregate(region, group, ncounters, counters, nmetrics, formulas, &t);
+    free(counters);
+    free(formulas);
+    if (ret < 0 || !t)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+    lua_newtable(L);
+    lua_pushstring(L, "labels");
+    lua_newtable(L);
+    for (i = 0; i < t->numColumns; i++)
+    {
+        lua_pushstring(L, t->labels[i]);
+        lua_rawseti(L, -2, i+1);
+    }
+    lua_settable(L, -3);
+    lua_pushstring(L, "counters");
+    lua_likwid_pushDoubleMatrix(L, t->counters, t->numCounters, t->numColumns);
+    lua_settable(L, -3);
+    lua_pushstring(L, "time");
+    lua_likwid_pushDoubleList(L, t->time, t->numColumns);
+    lua_settable(L, -3);
+    if (t->calls)
+    {
+        lua_pushstring(L, "calls");
+        lua_likwid_pushDoubleList(L, t->calls, t->numColumns);
+        lua_settable(L, -3);
+        lua_pushstring(L, "callStats");
+        lua_likwid_pushDoubleList(L, t->callStats, NUM_RESULTSTATS);
+        lua_settable(L, -3);
+    }
+    lua_pushstring(L, "metrics");
+    lua_likwid_pushDoubleMatrix(L, t->metrics, t->numMetrics, t->numColumns);
+    lua_settable(L, -3);
+    lua_pushstring(L, "counterStats");
+    lua_likwid_pushDoubleMatrix(L, t->counterStats, t->numCounters, NUM_RESULTSTATS);
+    lua_settable(L, -3);
+    lua_pushstring(L, "timeStats");
+    lua_likwid_pushDoubleList(L, t->timeStats, NUM_RESULTSTATS);
+    lua_settable(L, -3);
+    lua_pushstring(L, "metricStats");
+    lua_likwid_pushDoubleMatrix(L, t->metricStats, t->numMetrics, NUM_RESULTSTATS);
+    lua_settable(L, -3);
+    resultfiles_freeTable(t);
+    return 1;
+}
+
+static int
+lua_likwid_destroyResultFiles(lua_State* L)
+{
+    resultfiles_destroy();
+    return 0;
+}
+
 static int
 lua_likwid_markerFile_destroy(lua_State* L)
 {
@@ -2612,6 +2942,44 @@ lua_likwid_markerRegionCount(lua_State* L)
     return 1;
 }
 
+static int
+lua_likwid_markerRegionHistograms(lua_State* L)
+{
+    int region = lua_tointeger(L,-1);
+    lua_pushinteger(L, perfmon_getHistogramsOfRegion(region-1));
+    return 1;
+}
+
+static int
+lua_likwid_markerRegionHistogramEvent(lua_State* L)
+{
+    int region = lua_tointeger(L,-2);
+    int hist = lua_tointeger(L,-1);
+    lua_pushinteger(L, perfmon_getHistogramEventOfRegion(region-1, hist-1)+1);
+    return 1;
+}
+
+static int
+lua_likwid_markerRegionHistogramCount(lua_State* L)
+{
+    int region = lua_tointeger(L,-3);
+    int hist = lua_tointeger(L,-2);
+    int thread = lua_tointeger(L,-1);
+    lua_pushinteger(L, perfmon_getHistogramCountOfRegionThread(region-1, hist-1, thread-1));
+    return 1;
+}
+
+static int
+lua_likwid_markerRegionPercentile(lua_State* L)
+{
+    int region = lua_tointeger(L,-4);
+    int hist = lua_tointeger(L,-3);
+    int thread = lua_tointeger(L,-2);
+    double percentile = lua_tonumber(L,-1);
+    lua_pushnumber(L, perfmon_getHistogramPercentileOfRegionThread(region-1, hist-1, thread-1, percentile));
+    return 1;
+}
+
 static int
 lua_likwid_markerRegionResult(lua_State* L)
 {
@@ -2753,6 +3121,40 @@ lua_likwid_setGovernor(lua_State* L)
     return 1;
 }
 
+static int
+lua_likwid_setCpuClocks(lua_State* L)
+{
+    int ret;
+    uint64_t min_freq = 0;
+    uint64_t max_freq = 0;
+    const char* gov = NULL;
+    int nrThreads = luaL_checknumber(L,1);
+    luaL_argcheck(L, nrThreads > 0, 1, "CPU count must be greater than 0");
+    int cpus[nrThreads];
+    if (!lua_istable(L, 2)) {
+      lua_pushstring(L,"No table given as second argument");
+      lua_error(L);
+    }
+    if (!lua_isnoneornil(L, 3))
+        min_freq = lua_tointeger(L, 3);
+    if (!lua_isnoneornil(L, 4))
+        max_freq = lua_tointeger(L, 4);
+    if (!lua_isnoneornil(L, 5))
+        gov = (const char*)luaL_checkstring(L, 5);
+    for (ret = 1; ret<=nrThreads; ret++)
+    {
+        lua_rawgeti(L,2,ret);
+#if LUA_VERSION_NUM == 501
+        cpus[ret-1] = ((lua_Integer)lua_tointeger(L,-1));
+#else
+        cpus[ret-1] = ((lua_Unsigned)lua_tointegerx(L,-1, NULL));
+#endif
+        lua_pop(L,1);
+    }
+    lua_pushnumber(L, freq_setCpuClocks(nrThreads, cpus, min_freq, max_freq, gov, NULL));
+    return 1;
+}
+
 static int
 lua_likwid_getAvailFreq(lua_State* L)
 {
@@ -3567,6 +3969,12 @@ luaopen_liblikwid(lua_State* L){
     lua_register(L, "likwid_getLastMetric",lua_likwid_getLastMetric);
     lua_register(L, "likwid_getNumberOfGroups",lua_likwid_getNumberOfGroups);
     lua_register(L, "likwid_getRuntimeOfGroup", lua_likwid_getRuntimeOfGroup);
+    lua_register(L, "likwid_setGroupWeight", lua_likwid_setGroupWeight);
+    lua_register(L, "likwid_getNextGroup", lua_likwid_getNextGroup);
+    lua_register(L, "likwid_getNumberOfSlices", lua_likwid_getNumberOfSlices);
+    lua_register(L, "likwid_getEnabledTime", lua_likwid_getEnabledTime);
+    lua_register(L, "likwid_getScaledResult", lua_likwid_getScaledResult);
+    lua_register(L, "likwid_reduce", lua_likwid_reduce);
     lua_register(L, "likwid_getIdOfActiveGroup",lua_likwid_getIdOfActiveGroup);
     lua_register(L, "likwid_getNumberOfEvents",lua_likwid_getNumberOfEvents);
     lua_register(L, "likwid_getNumberOfMetrics",lua_likwid_getNumberOfMetrics);
@@ -3652,6 +4060,10 @@ luaopen_liblikwid(lua_State* L){
     lua_register(L, "likwid_cpuFeaturesDisable", lua_likwid_cpuFeatures_disable);
     // Marker API related functions
     lua_register(L, "likwid_readMarkerFile", lua_likwid_markerFile_read);
+    lua_register(L, "likwid_readResultFiles", lua_likwid_readResultFiles);
+    lua_register(L, "likwid_getResultFileRegions", lua_likwid_getResultFileRegions);
+    lua_register(L, "likwid_aggregateResultFiles", lua_likwid_aggregateResultFiles);
+    lua_register(L, "likwid_destroyResultFiles", lua_likwid_destroyResultFiles);
     lua_register(L, "likwid_destroyMarkerFile", lua_likwid_markerFile_destroy);
     lua_register(L, "likwid_markerNumRegions", lua_likwid_markerNumRegions);
     lua_register(L, "likwid_markerRegionGroup", lua_likwid_markerRegionGroup);
@@ -3663,6 +4075,10 @@ luaopen_liblikwid(lua_State* L){
     lua_register(L, "likwid_markerRegionCount", lua_likwid_markerRegionCount);
     lua_register(L, "likwid_markerRegionResult", lua_likwid_markerRegionResult);
     lua_register(L, "likwid_markerRegionMetric", lua_likwid_markerRegionMetric);
+    lua_register(L, "likwid_markerRegionHistograms", lua_likwid_markerRegionHistograms);
+    lua_register(L, "likwid_markerRegionHistogramEvent", lua_likwid_markerRegionHistogramEvent);
+    lua_register(L, "likwid_markerRegionHistogramCount", lua_likwid_markerRegionHistogramCount);
+    lua_register(L, "likwid_markerRegionPercentile", lua_likwid_markerRegionPercentile);
     // CPU frequency functions
     lua_register(L, "likwid_initFreq", lua_likwid_initFreq);
     lua_register(L, "likwid_finalizeFreq", lua_likwid_finalizeFreq);
@@ -3676,6 +4092,7 @@ luaopen_liblikwid(lua_State* L){
     lua_register(L, "likwid_setCpuClockMax", lua_likwid_setCpuClockMax);
     lua_register(L, "likwid_getGovernor", lua_likwid_getGovernor);
     lua_register(L, "likwid_setGovernor", lua_likwid_setGovernor);
+    lua_register(L, "likwid_setCpuClocks", lua_likwid_setCpuClocks);
     lua_register(L, "likwid_getAvailFreq", lua_likwid_getAvailFreq);
     lua_register(L, "likwid_getAvailGovs", lua_likwid_getAvailGovs);
     lua_register(L, "likwid_setTurbo", lua_likwid_setTurbo);
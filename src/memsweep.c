@@ -33,7 +33,12 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <sched.h>
+#include <pthread.h>
 #include <sys/mman.h>
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 #include <error.h>
 #include <types.h>
@@ -50,6 +55,32 @@ extern void _loadData(uint32_t size, void* ptr);
 
 static uint64_t  memoryFraction = 80ULL;
 
+/* #####   TYPE DEFINITIONS   ########### */
+
+/* Counts the slices that are not yet allocated. The caches are cleaned
+ * after all slices are touched. */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int remaining;
+} SweepSync;
+
+/* Each worker touches, evicts and releases one slice of a domain's memory */
+typedef struct {
+    char* ptr;
+    size_t size;
+    uint32_t cleanSize;
+    int cpu;
+    SweepSync* sync;
+} SweepSlice;
+
+typedef struct {
+    int domainId;
+    char* ptr;
+    size_t size;
+    int numWorkers;
+} SweepDomain;
+
 /* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
 
 static void*
@@ -59,9 +90,10 @@ allocateOnNode(size_t size, int domainId)
 
     ptr = mmap(0, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, 0, 0);
 
-    if (ptr == (char *)-1)
+    if (ptr == MAP_FAILED)
     {
-        ERROR;
+        ERROR_PRINT(Cannot allocate %lu bytes for domain %d, size, domainId);
+        return NULL;
     }
 
     numa_membind(ptr, size, domainId);
@@ -69,15 +101,23 @@ allocateOnNode(size_t size, int domainId)
     return ptr;
 }
 
+/* Touch one word per page with non-temporal stores, so the pages get
+ * allocated without pulling them into the caches */
 static void
-initMemory(size_t size, char* ptr, int domainId)
+initMemory(size_t size, char* ptr)
 {
-    affinity_pinProcess(numa_info.nodes[domainId].processors[0]);
-
+#if defined(__x86_64__)
+    for (size_t i=0; i < size; i += PAGE_ALIGNMENT)
+    {
+        _mm_stream_si32((int*)&ptr[i], (int)0xEFEFEFEF);
+    }
+    _mm_sfence();
+#else
     for (size_t i=0; i < size; i += PAGE_ALIGNMENT)
     {
         ptr[i] = (char) 0xEF;
     }
+#endif
 }
 
 static int
@@ -97,16 +137,250 @@ findProcessor(uint32_t nodeId, uint32_t coreId)
 
 /* evict all dirty cachelines from last level cache */
 static void
-cleanupCache(char* ptr)
+cleanupCache(char* ptr, uint32_t cachesize)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (cachesize > 0)
+    {
+        _loadData(cachesize,ptr);
+    }
+#endif
+}
+
+static uint32_t
+llcCleanSize(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (cpuid_topology.numCacheLevels > 0)
+    {
+        return 2 * cpuid_topology.cacheLevels[cpuid_topology.numCacheLevels-1].size;
+    }
+#endif
+    return 0;
+}
+
+/* One hardware thread per physical core of the NUMA domain */
+static int
+getDomainWorkers(int domainId, int* cpus)
+{
+    int count = 0;
+    int* cores = malloc(numa_info.nodes[domainId].numberOfProcessors * 2 * sizeof(int));
+    if (!cores)
+    {
+        cpus[0] = numa_info.nodes[domainId].processors[0];
+        return 1;
+    }
+    for (uint32_t i = 0; i < numa_info.nodes[domainId].numberOfProcessors; i++)
+    {
+        int cpu = numa_info.nodes[domainId].processors[i];
+        int package = -1, core = -1, found = 0;
+        for (uint32_t j = 0; j < cpuid_topology.numHWThreads; j++)
+        {
+            if (cpuid_topology.threadPool[j].apicId == cpu)
+            {
+                if (!cpuid_topology.threadPool[j].inCpuSet)
+                {
+                    package = -2;
+                    break;
+                }
+                package = cpuid_topology.threadPool[j].packageId;
+                core = cpuid_topology.threadPool[j].coreId;
+                break;
+            }
+        }
+        if (package == -2)
+            continue;
+        for (int k = 0; k < count && package >= 0; k++)
+        {
+            if (cores[2*k] == package && cores[2*k+1] == core)
+            {
+                found = 1;
+                break;
+            }
+        }
+        if (!found)
+        {
+            cores[2*count] = package;
+            cores[2*count+1] = core;
+            cpus[count++] = cpu;
+        }
+    }
+    free(cores);
+    if (count == 0)
+    {
+        cpus[count++] = numa_info.nodes[domainId].processors[0];
+    }
+    return count;
+}
+
+static void
+sweepSyncDone(SweepSync* sync, int count)
+{
+    pthread_mutex_lock(&sync->lock);
+    sync->remaining -= count;
+    if (sync->remaining <= 0)
+    {
+        pthread_cond_broadcast(&sync->cond);
+    }
+    else
+    {
+        while (sync->remaining > 0)
+        {
+            pthread_cond_wait(&sync->cond, &sync->lock);
+        }
+    }
+    pthread_mutex_unlock(&sync->lock);
+}
+
+static void*
+sweepWorker(void* arg)
+{
+    SweepSlice* slice = (SweepSlice*) arg;
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(slice->cpu, &cpuset);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+
+    initMemory(slice->size, slice->ptr);
+    sweepSyncDone(slice->sync, 1);
+    cleanupCache(slice->ptr, slice->cleanSize);
+    madvise(slice->ptr, slice->size, MADV_DONTNEED);
+    return NULL;
+}
+
+static void
+sweepDomains(const int* domainIds, int numDomains)
 {
+    int totalWorkers = 0;
+    int started = 0;
+    uint32_t cachesize = llcCleanSize();
+    SweepSync sync;
+    SweepDomain* domains = NULL;
+    SweepSlice* slices = NULL;
+    pthread_t* threads = NULL;
+    int* cpus = NULL;
+
+    if (numDomains <= 0)
+        return;
+    domains = malloc(numDomains * sizeof(SweepDomain));
+    cpus = malloc(cpuid_topology.numHWThreads * sizeof(int));
+    if (!domains || !cpus)
+    {
+        ERROR_PLAIN_PRINT(Cannot allocate memory for sweeping);
+        free(domains);
+        free(cpus);
+        return;
+    }
+    for (int d = 0; d < numDomains; d++)
+    {
+        int domainId = domainIds[d];
+        domains[d].domainId = domainId;
+        domains[d].size = numa_info.nodes[domainId].totalMemory * 1024ULL * memoryFraction / 100ULL;
+        domains[d].size -= domains[d].size % PAGE_ALIGNMENT;
+        domains[d].numWorkers = getDomainWorkers(domainId, cpus);
+        if (getenv("LIKWID_SILENT") == NULL)
+        {
+            printf("Sweeping domain %d: Using %g MB of %g MB with %d threads\n",
+                    domainId,
+                    domains[d].size / (1024.0 * 1024.0),
+                    numa_info.nodes[domainId].totalMemory/ 1024.0,
+                    domains[d].numWorkers);
+        }
+        domains[d].ptr = (char*) allocateOnNode(domains[d].size, domainId);
+        if (!domains[d].ptr)
+        {
+            domains[d].numWorkers = 0;
+        }
+        totalWorkers += domains[d].numWorkers;
+    }
 #if defined(__x86_64__) || defined(__i386__)
-    uint32_t cachesize = 2 * cpuid_topology.cacheLevels[cpuid_topology.numCacheLevels-1].size;
-    if (getenv("LIKWID_SILENT") == NULL)
+    if (getenv("LIKWID_SILENT") == NULL && cachesize > 0)
         printf("Cleaning LLC with %g MB\n", (double)cachesize/(1024.0 * 1024.0));
-    _loadData(cachesize,ptr);
 #else
     ERROR_PLAIN_PRINT(Cleanup cache is currently only available on X86 systems.);
 #endif
+    if (totalWorkers == 0)
+    {
+        free(domains);
+        free(cpus);
+        return;
+    }
+
+    slices = malloc(totalWorkers * sizeof(SweepSlice));
+    threads = malloc(totalWorkers * sizeof(pthread_t));
+    if (!slices || !threads)
+    {
+        ERROR_PLAIN_PRINT(Cannot allocate memory for sweeping);
+        totalWorkers = 0;
+    }
+    for (int d = 0, w = 0; d < numDomains && totalWorkers > 0; d++)
+    {
+        if (domains[d].numWorkers == 0)
+            continue;
+        int nw = getDomainWorkers(domains[d].domainId, cpus);
+        size_t pages = domains[d].size / PAGE_ALIGNMENT;
+        size_t offset = 0;
+        for (int i = 0; i < nw; i++, w++)
+        {
+            size_t npages = pages / nw + ((size_t)i < pages % nw ? 1 : 0);
+            slices[w].ptr = domains[d].ptr + offset;
+            slices[w].size = npages * PAGE_ALIGNMENT;
+            slices[w].cpu = cpus[i];
+            slices[w].sync = &sync;
+            slices[w].cleanSize = cachesize / nw;
+            slices[w].cleanSize -= slices[w].cleanSize % 256;
+            if (slices[w].cleanSize > slices[w].size)
+            {
+                slices[w].cleanSize = slices[w].size - slices[w].size % 256;
+            }
+            offset += slices[w].size;
+        }
+    }
+    if (totalWorkers > 0)
+    {
+        pthread_mutex_init(&sync.lock, NULL);
+        pthread_cond_init(&sync.cond, NULL);
+        sync.remaining = totalWorkers;
+        for (started = 0; started < totalWorkers; started++)
+        {
+            if (pthread_create(&threads[started], NULL, sweepWorker, &slices[started]) != 0)
+            {
+                break;
+            }
+        }
+        if (started < totalWorkers)
+        {
+            /* Sweep the slices without thread here */
+            ERROR_PRINT(Cannot start all sweep threads. Started %d of %d, started, totalWorkers);
+            for (int i = started; i < totalWorkers; i++)
+            {
+                initMemory(slices[i].size, slices[i].ptr);
+            }
+            sweepSyncDone(&sync, totalWorkers - started);
+            for (int i = started; i < totalWorkers; i++)
+            {
+                cleanupCache(slices[i].ptr, slices[i].cleanSize);
+                madvise(slices[i].ptr, slices[i].size, MADV_DONTNEED);
+            }
+        }
+        for (int i = 0; i < started; i++)
+        {
+            pthread_join(threads[i], NULL);
+        }
+        pthread_cond_destroy(&sync.cond);
+        pthread_mutex_destroy(&sync.lock);
+    }
+    for (int d = 0; d < numDomains; d++)
+    {
+        if (domains[d].ptr)
+        {
+            munmap(domains[d].ptr, domains[d].size);
+        }
+    }
+    free(slices);
+    free(threads);
+    free(domains);
+    free(cpus);
 }
 
 /* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
@@ -120,43 +394,45 @@ memsweep_setMemoryFraction(uint64_t fraction)
 void
 memsweep_node(void)
 {
+    int* domains = malloc(numa_info.numberOfNodes * sizeof(int));
+    if (!domains)
+    {
+        return;
+    }
     for ( uint32_t i=0; i < numa_info.numberOfNodes; i++)
     {
-        memsweep_domain(i);
+        domains[i] = i;
     }
+    sweepDomains(domains, numa_info.numberOfNodes);
+    free(domains);
 }
 
 void
 memsweep_domain(int domainId)
 {
-    char* ptr = NULL;
-    size_t size = numa_info.nodes[domainId].totalMemory * 1024ULL * memoryFraction / 100ULL;
-    if (getenv("LIKWID_SILENT") == NULL)
-    {
-        printf("Sweeping domain %d: Using %g MB of %g MB\n",
-                domainId,
-                size / (1024.0 * 1024.0),
-                numa_info.nodes[domainId].totalMemory/ 1024.0);
-    }
-    ptr = (char*) allocateOnNode(size, domainId);
-    initMemory(size, ptr, domainId);
-    cleanupCache(ptr);
-    munmap(ptr, size);
+    sweepDomains(&domainId, 1);
 }
 
 void
 memsweep_threadGroup(const int* processorList, int numberOfProcessors)
 {
+    int numDomains = 0;
+    int* domains = malloc(numa_info.numberOfNodes * sizeof(int));
+    if (!domains)
+    {
+        return;
+    }
     for (uint32_t i=0; i<numa_info.numberOfNodes; i++)
     {
         for (int j=0; j<numberOfProcessors; j++)
         {
             if (findProcessor(i,processorList[j]))
             {
-                memsweep_domain(i);
+                domains[numDomains++] = i;
                 break;
             }
         }
     }
+    sweepDomains(domains, numDomains);
+    free(domains);
 }
-
@@ -41,6 +41,7 @@
 #include <unistd.h>
 #include <dirent.h>
 #include <pthread.h>
+#include <time.h>
 
 #include <error.h>
 #include <perfgroup.h>
@@ -48,12 +49,40 @@
 #include <likwid.h>
 
 #include <calculator.h>
+#include <ghash.h>
 #include <bstrlib.h>
 #include <bstrlib_helper.h>
 
 
 
-static int totalgroups = 0;
+/* Parsed group files are kept in a catalogue per group directory and
+ * architecture. The catalogue is rebuilt when the modification time of the
+ * system or user group directory changes. If LIKWID_GROUP_CACHE points to a
+ * directory, the catalogue is also stored there and reused by later
+ * processes. */
+#define GROUP_CACHE_MAGIC "LIKWID_GROUP_CACHE_1"
+
+typedef struct {
+    GroupInfo ginfo;
+    int require_noht;
+} GroupCatalogEntry;
+
+typedef struct GroupCatalog {
+    char* grouppath;
+    char* architecture;
+    char* homepath;
+    time_t mtime;
+    time_t home_mtime;
+    int numGroups;
+    GroupCatalogEntry* groups;
+    GHashTable* index;
+    struct GroupCatalog* next;
+} GroupCatalog;
+
+static GroupCatalog* catalogs = NULL;
+static pthread_mutex_t catalog_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int read_group_file(const char* filename, const char* groupname, GroupInfo* ginfo, int* require_noht);
 
 /* #####   FUNCTION DEFINITIONS  -  INTERNAL FUNCTIONS   ################## */
 
@@ -89,23 +118,19 @@ void
 perfgroup_returnGroups(int groups, char** groupnames, char** groupshort, char** grouplong)
 {
     int i;
-    int freegroups = (totalgroups < groups ? groups : totalgroups);
-    for (i = 0; i <freegroups; i++)
+    for (i = 0; i < groups; i++)
     {
         free(groupnames[i]);
         groupnames[i] = NULL;
-        if (i < groups)
+        if (groupshort[i] != NULL)
         {
-            if (groupshort[i] != NULL)
-            {
-                free(groupshort[i]);
-                groupshort[i] = NULL;
-            }
-            if (grouplong[i] != NULL)
-            {
-                free(grouplong[i]);
-                grouplong[i] = NULL;
-            }
+            free(groupshort[i]);
+            groupshort[i] = NULL;
+        }
+        if (grouplong[i] != NULL)
+        {
+            free(grouplong[i]);
+            grouplong[i] = NULL;
         }
     }
     if (groupnames != NULL)
@@ -126,464 +151,578 @@ perfgroup_returnGroups(int groups, char** groupnames, char** groupshort, char**
 }
 
 
-int
-perfgroup_getGroups(
-        const char* grouppath,
-        const char* architecture,
-        char*** groupnames,
-        char*** groupshort,
-        char*** grouplong)
+static char*
+copy_string(const char* str)
 {
-    int i = 0, j = 0, s = 0;
-    int fsize = 0, hsize = 0;
-    DIR *dp = NULL;
-    FILE* fp = NULL;
-    char buf[256] = { [0 ... 255] = '\0' };
-    struct dirent *ep = NULL;
-    *groupnames = NULL;
-    *groupshort = NULL;
-    *grouplong = NULL;
-    int search_home = 0;
-    bstring SHORT = bformat("SHORT");
-    bstring LONG = bformat("LONG");
-    bstring REQUIRE = bformat("REQUIRE_NOHT");
-    char* Home = getenv("HOME");
+    char* out = NULL;
+    if (str)
+    {
+        out = malloc((strlen(str)+1) * sizeof(char));
+        if (out)
+        {
+            strcpy(out, str);
+        }
+    }
+    return out;
+}
 
-    int read_long = 0;
-    if ((grouppath == NULL)||(architecture == NULL)||(groupnames == NULL)||(Home == NULL))
-        return -EINVAL;
+static char**
+copy_string_list(char** list, int count)
+{
+    char** out = NULL;
+    if (count <= 0 || !list)
+        return NULL;
+    out = malloc(count * sizeof(char*));
+    if (out)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            out[i] = copy_string(list[i]);
+        }
+    }
+    return out;
+}
 
-    char* fullpath = malloc((strlen(grouppath)+strlen(architecture)+50) * sizeof(char));
-    if (fullpath == NULL)
+static int
+copy_group(const GroupInfo* src, GroupInfo* dst)
+{
+    dst->groupname = copy_string(src->groupname);
+    dst->shortinfo = copy_string(src->shortinfo);
+    dst->longinfo = copy_string(src->longinfo);
+    dst->nevents = src->nevents;
+    dst->counters = copy_string_list(src->counters, src->nevents);
+    dst->events = copy_string_list(src->events, src->nevents);
+    dst->nmetrics = src->nmetrics;
+    dst->metricnames = copy_string_list(src->metricnames, src->nmetrics);
+    dst->metricformulas = copy_string_list(src->metricformulas, src->nmetrics);
+    if ((src->groupname && !dst->groupname) ||
+        (src->nevents > 0 && (!dst->counters || !dst->events)) ||
+        (src->nmetrics > 0 && (!dst->metricnames || !dst->metricformulas)))
     {
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
+        perfgroup_returnGroup(dst);
         return -ENOMEM;
     }
-    char* homepath = malloc((strlen(Home)+strlen(architecture)+50) * sizeof(char));
-    if (homepath == NULL)
+    return 0;
+}
+
+/* The listing shows the short info with collapsed whitespace */
+static char*
+listing_shortinfo(const char* shortinfo)
+{
+    char* out = NULL;
+    if (!shortinfo)
+        return NULL;
+    bstring b = bfromcstr(shortinfo);
+    btrimws(b);
+    struct bstrList* words = bsplit(b, ' ');
+    bstring joined = bfromcstr("");
+    for (int i = 0; i < words->qty; i++)
     {
-        free(fullpath);
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
-        return -ENOMEM;
+        btrimws(words->entry[i]);
+        if (blength(words->entry[i]) == 0)
+            continue;
+        if (blength(joined) > 0)
+            bconchar(joined, ' ');
+        bconcat(joined, words->entry[i]);
     }
-    fsize = sprintf(fullpath, "%s/%s", grouppath, architecture);
-    if (isdir(fullpath))
+    out = copy_string(bdata(joined));
+    bdestroy(joined);
+    bstrListDestroy(words);
+    bdestroy(b);
+    return out;
+}
+
+static time_t
+dir_mtime(const char* dirname)
+{
+    struct stat st;
+    if (stat(dirname, &st) != 0 || !S_ISDIR(st.st_mode))
+        return 0;
+    return st.st_mtime;
+}
+
+static void
+catalog_destroy(GroupCatalog* cat)
+{
+    if (!cat)
+        return;
+    for (int i = 0; i < cat->numGroups; i++)
     {
-        dp = opendir(fullpath);
-        if (dp == NULL)
-        {
-            printf("Cannot open directory %s\n", fullpath);
-            free(fullpath);
-            free(homepath);
-            bdestroy(SHORT);
-            bdestroy(LONG);
-            bdestroy(REQUIRE);
-            return -EACCES;
-        }
+        perfgroup_returnGroup(&cat->groups[i].ginfo);
     }
-    else
+    free(cat->groups);
+    if (cat->index)
+        g_hash_table_destroy(cat->index);
+    free(cat->grouppath);
+    free(cat->architecture);
+    free(cat->homepath);
+    free(cat);
+}
+
+static GroupCatalogEntry*
+catalog_add(GroupCatalog* cat)
+{
+    GroupCatalogEntry* tmp = realloc(cat->groups, (cat->numGroups+1) * sizeof(GroupCatalogEntry));
+    if (!tmp)
+        return NULL;
+    cat->groups = tmp;
+    memset(&cat->groups[cat->numGroups], 0, sizeof(GroupCatalogEntry));
+    return &cat->groups[cat->numGroups++];
+}
+
+static int
+catalog_scan_dir(GroupCatalog* cat, const char* dirname)
+{
+    DIR *dp = NULL;
+    struct dirent *ep = NULL;
+    dp = opendir(dirname);
+    if (dp == NULL)
     {
-        printf("Cannot access directory %s\n", fullpath);
-        free(fullpath);
-        free(homepath);
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
         return -EACCES;
     }
-    i = 0;
-    s = 0;
     while ((ep = readdir(dp)))
     {
-        if (strncmp(&(ep->d_name[strlen(ep->d_name)-4]), ".txt", 4) == 0)
+        int len = strlen(ep->d_name);
+        if (len <= 4 || strncmp(&(ep->d_name[len-4]), ".txt", 4) != 0)
+            continue;
+        bstring fname = bformat("%s/%s", dirname, ep->d_name);
+        bstring gname = bformat("%.*s", len-4, ep->d_name);
+        if (!access(bdata(fname), R_OK))
         {
-            totalgroups++;
-            if (strlen(ep->d_name)-4 > s)
-                s = strlen(ep->d_name)-4;
+            GroupCatalogEntry* e = catalog_add(cat);
+            if (!e)
+            {
+                bdestroy(fname);
+                bdestroy(gname);
+                closedir(dp);
+                return -ENOMEM;
+            }
+            if (read_group_file(bdata(fname), bdata(gname), &e->ginfo, &e->require_noht) != 0)
+            {
+                cat->numGroups--;
+            }
         }
+        bdestroy(fname);
+        bdestroy(gname);
     }
     closedir(dp);
-    hsize = sprintf(homepath, "%s/.likwid/groups/%s", Home, architecture);
-    if (isdir(homepath))
+    return 0;
+}
+
+static void
+write_cache_string(FILE* fp, const char* str)
+{
+    uint32_t len = (str ? strlen(str) : UINT32_MAX);
+    fwrite(&len, sizeof(uint32_t), 1, fp);
+    if (str)
+        fwrite(str, sizeof(char), len, fp);
+}
+
+static char*
+read_cache_string(FILE* fp, int* err)
+{
+    uint32_t len = 0;
+    char* str = NULL;
+    if (fread(&len, sizeof(uint32_t), 1, fp) != 1)
+    {
+        *err = -EIO;
+        return NULL;
+    }
+    if (len == UINT32_MAX)
+        return NULL;
+    str = malloc((len+1) * sizeof(char));
+    if (!str)
+    {
+        *err = -ENOMEM;
+        return NULL;
+    }
+    if (len > 0 && fread(str, sizeof(char), len, fp) != len)
+    {
+        free(str);
+        *err = -EIO;
+        return NULL;
+    }
+    str[len] = '\0';
+    return str;
+}
+
+static char**
+read_cache_string_list(FILE* fp, int count, int* err)
+{
+    char** list = NULL;
+    if (count <= 0)
+        return NULL;
+    list = malloc(count * sizeof(char*));
+    if (!list)
+    {
+        *err = -ENOMEM;
+        return NULL;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        list[i] = read_cache_string(fp, err);
+    }
+    return list;
+}
+
+static bstring
+cache_filename(const char* architecture)
+{
+    char* cachedir = getenv("LIKWID_GROUP_CACHE");
+    if (!cachedir || strlen(cachedir) == 0 || !isdir(cachedir))
+        return NULL;
+    return bformat("%s/groups-%s.cache", cachedir, architecture);
+}
+
+static int
+catalog_store(GroupCatalog* cat)
+{
+    bstring fname = cache_filename(cat->architecture);
+    if (!fname)
+        return 0;
+    bstring tmpname = bformat("%s.%d", bdata(fname), getpid());
+    FILE* fp = fopen(bdata(tmpname), "w");
+    if (!fp)
+    {
+        DEBUG_PRINT(DEBUGLEV_DEVELOP, Cannot write group cache %s, bdata(tmpname));
+        bdestroy(tmpname);
+        bdestroy(fname);
+        return -EACCES;
+    }
+    write_cache_string(fp, GROUP_CACHE_MAGIC);
+    write_cache_string(fp, cat->grouppath);
+    write_cache_string(fp, cat->homepath);
+    fwrite(&cat->mtime, sizeof(time_t), 1, fp);
+    fwrite(&cat->home_mtime, sizeof(time_t), 1, fp);
+    fwrite(&cat->numGroups, sizeof(int), 1, fp);
+    for (int i = 0; i < cat->numGroups; i++)
     {
-        search_home = 1;
-        dp = opendir(homepath);
-        if (dp == NULL)
+        GroupInfo* g = &cat->groups[i].ginfo;
+        fwrite(&cat->groups[i].require_noht, sizeof(int), 1, fp);
+        write_cache_string(fp, g->groupname);
+        write_cache_string(fp, g->shortinfo);
+        write_cache_string(fp, g->longinfo);
+        fwrite(&g->nevents, sizeof(int), 1, fp);
+        for (int j = 0; j < g->nevents; j++)
         {
-            search_home = 0;
+            write_cache_string(fp, g->counters[j]);
+            write_cache_string(fp, g->events[j]);
         }
-        if (search_home)
+        fwrite(&g->nmetrics, sizeof(int), 1, fp);
+        for (int j = 0; j < g->nmetrics; j++)
         {
-            while ((ep = readdir(dp)))
-            {
-                if (strncmp(&(ep->d_name[strlen(ep->d_name)-4]), ".txt", 4) == 0)
-                {
-                    totalgroups++;
-                    if (strlen(ep->d_name)-4 > s)
-                        s = strlen(ep->d_name)-4;
-                }
-            }
-            closedir(dp);
+            write_cache_string(fp, g->metricnames[j]);
+            write_cache_string(fp, g->metricformulas[j]);
         }
     }
-    *groupnames = malloc(totalgroups * sizeof(char**));
-    if (*groupnames == NULL)
+    if (ferror(fp) || fclose(fp) != 0)
     {
-        free(fullpath);
-        free(homepath);
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
-        return -ENOMEM;
+        unlink(bdata(tmpname));
+        bdestroy(tmpname);
+        bdestroy(fname);
+        return -EIO;
     }
-    memset(*groupnames, 0, totalgroups * sizeof(char**));
-    *groupshort = malloc(totalgroups * sizeof(char**));
-    if (*groupshort == NULL)
+    if (rename(bdata(tmpname), bdata(fname)) != 0)
     {
-        free(*groupnames);
-        *groupnames = NULL;
-        free(fullpath);
-        free(homepath);
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
-        return -ENOMEM;
+        unlink(bdata(tmpname));
     }
-    memset(*groupshort, 0, totalgroups * sizeof(char**));
-    *grouplong = malloc(totalgroups * sizeof(char**));
-    if (*grouplong == NULL)
+    bdestroy(tmpname);
+    bdestroy(fname);
+    return 0;
+}
+
+static int
+catalog_load(GroupCatalog* cat)
+{
+    int err = 0;
+    int count = 0;
+    time_t mtime = 0, home_mtime = 0;
+    char *magic = NULL, *gpath = NULL, *hpath = NULL;
+    bstring fname = cache_filename(cat->architecture);
+    if (!fname)
+        return -ENOENT;
+    FILE* fp = fopen(bdata(fname), "r");
+    bdestroy(fname);
+    if (!fp)
+        return -ENOENT;
+    magic = read_cache_string(fp, &err);
+    gpath = read_cache_string(fp, &err);
+    hpath = read_cache_string(fp, &err);
+    if (fread(&mtime, sizeof(time_t), 1, fp) != 1 ||
+        fread(&home_mtime, sizeof(time_t), 1, fp) != 1 ||
+        fread(&count, sizeof(int), 1, fp) != 1)
     {
-        free(*groupnames);
-        *groupnames = NULL;
-        free(*groupshort);
-        *groupshort = NULL;
-        free(fullpath);
-        free(homepath);
-        bdestroy(SHORT);
-        bdestroy(LONG);
-        bdestroy(REQUIRE);
-        return -ENOMEM;
+        err = -EIO;
     }
-    memset(*grouplong, 0, totalgroups * sizeof(char**));
-    for (j=0; j < totalgroups; j++)
+    if (err || !magic || !gpath || !hpath ||
+        strcmp(magic, GROUP_CACHE_MAGIC) != 0 ||
+        strcmp(gpath, cat->grouppath) != 0 ||
+        strcmp(hpath, cat->homepath) != 0 ||
+        mtime != cat->mtime || home_mtime != cat->home_mtime || count < 0)
     {
-        (*groupnames)[j] = malloc((s+1) * sizeof(char));
-        if ((*groupnames)[j] == NULL)
+        err = (err ? err : -ESTALE);
+        goto cleanup;
+    }
+    for (int i = 0; i < count && !err; i++)
+    {
+        GroupCatalogEntry* e = catalog_add(cat);
+        if (!e)
         {
-            for (s=0; s<j; s++)
+            err = -ENOMEM;
+            break;
+        }
+        GroupInfo* g = &e->ginfo;
+        if (fread(&e->require_noht, sizeof(int), 1, fp) != 1)
+        {
+            err = -EIO;
+            break;
+        }
+        g->groupname = read_cache_string(fp, &err);
+        g->shortinfo = read_cache_string(fp, &err);
+        g->longinfo = read_cache_string(fp, &err);
+        if (fread(&g->nevents, sizeof(int), 1, fp) != 1 || g->nevents < 0)
+        {
+            g->nevents = 0;
+            err = -EIO;
+            break;
+        }
+        if (g->nevents > 0)
+        {
+            g->counters = malloc(g->nevents * sizeof(char*));
+            g->events = malloc(g->nevents * sizeof(char*));
+            if (!g->counters || !g->events)
             {
-                free((*groupnames)[s]);
+                free(g->counters);
+                free(g->events);
+                g->counters = g->events = NULL;
+                g->nevents = 0;
+                err = -ENOMEM;
+                break;
+            }
+            for (int j = 0; j < g->nevents; j++)
+            {
+                g->counters[j] = read_cache_string(fp, &err);
+                g->events[j] = read_cache_string(fp, &err);
             }
-            free(*groupnames);
-            *groupnames = NULL;
-            free(*groupshort);
-            *groupshort = NULL;
-            free(*grouplong);
-            *grouplong = NULL;
-            free(fullpath);
-            free(homepath);
-            bdestroy(SHORT);
-            bdestroy(LONG);
-            bdestroy(REQUIRE);
-            return -ENOMEM;
         }
-    }
-    dp = opendir(fullpath);
-    i = 0;
-    int skip_group = 0;
-
-    while ((ep = readdir(dp)))
-    {
-        if (strncmp(&(ep->d_name[strlen(ep->d_name)-4]), ".txt", 4) == 0)
+        if (fread(&g->nmetrics, sizeof(int), 1, fp) != 1 || g->nmetrics < 0)
+        {
+            g->nmetrics = 0;
+            err = -EIO;
+            break;
+        }
+        if (g->nmetrics > 0)
         {
-            read_long = 0;
-            bstring long_info = bfromcstr("");
-            sprintf(&(fullpath[fsize]), "/%s", ep->d_name);
-            if (!access(fullpath, R_OK))
+            g->metricnames = malloc(g->nmetrics * sizeof(char*));
+            g->metricformulas = malloc(g->nmetrics * sizeof(char*));
+            if (!g->metricnames || !g->metricformulas)
             {
-                (*grouplong)[i] = NULL;
-                s = sprintf((*groupnames)[i], "%.*s", (int)(strlen(ep->d_name)-4), ep->d_name);
-                (*groupnames)[i][s] = '\0';
-                fp = fopen(fullpath,"r");
-
-                while (fgets (buf, sizeof(buf), fp)) {
-                    bstring bbuf = bfromcstr(buf);
-                    btrimws(bbuf);
-                    if ((blength(bbuf) == 0) || (buf[0] == '#'))
-                    {
-                        bdestroy(bbuf);
-                        continue;
-                    }
-                    if (bstrncmp(bbuf, SHORT, 5) == 0)
-                    {
-                        struct bstrList * linelist = bsplit(bbuf, ' ');
-                        bstring sinfo;
-                        if (linelist->qty == 1)
-                        {
-                            fprintf(stderr,"Cannot read SHORT section in groupfile %s",fullpath);
-                            bdestroy(bbuf);
-                            bstrListDestroy(linelist);
-                            continue;
-                        }
-                        s = 1;
-                        for (j=s;j<linelist->qty; j++)
-                        {
-                            btrimws(linelist->entry[j]);
-                            if (blength(linelist->entry[j]) == 0)
-                                s += 1;
-                            else
-                                break;
-                        }
-                        btrimws(linelist->entry[s]);
-                        sinfo = bformat("%s", bdata(linelist->entry[s]));
-                        for (j=s+1;j<linelist->qty; j++)
-                        {
-                            btrimws(linelist->entry[j]);
-                            bstring tmp = bformat(" %s", bdata(linelist->entry[j]));
-                            bconcat(sinfo, tmp);
-                            bdestroy(tmp);
-                        }
-
-                        (*groupshort)[i] = malloc((blength(sinfo)+1) * sizeof(char));
-                        if ((*groupshort)[i] == NULL)
-                        {
-                            bdestroy(SHORT);
-                            bdestroy(LONG);
-                            bdestroy(bbuf);
-                            bdestroy(sinfo);
-                            bdestroy(REQUIRE);
-                            free(homepath);
-                            free(fullpath);
-                            bdestroy(long_info);
-                            bstrListDestroy(linelist);
-                            perfgroup_returnGroups(i, *groupnames, *groupshort, *grouplong);
-                            return -ENOMEM;
-                        }
-                        s = sprintf((*groupshort)[i], "%s", bdata(sinfo));
-                        (*groupshort)[i][s] = '\0';
-                        bstrListDestroy(linelist);
-                        bdestroy(sinfo);
-                    }
-                    else if (bstrncmp(bbuf, REQUIRE, blength(REQUIRE)) == 0)
-                    {
-                        if (cpuid_topology.numThreadsPerCore > 1)
-                        {
-                            skip_group = 1;
-                        }
-                    }
-                    else if (bstrncmp(bbuf, LONG, 4) == 0)
-                    {
-                        read_long = 1;
-                    }
-                    else if ((read_long == 1) && (bstrncmp(bbuf, LONG, 4) != 0))
-                    {
-                        bstring tmp = bfromcstr(buf);
-                        bconcat(long_info, tmp);
-                        bdestroy(tmp);
-                    }
-                    bdestroy(bbuf);
-                }
-                if (read_long)
-                {
-
-                    (*grouplong)[i] = malloc((blength(long_info) + 1) * sizeof(char) );
-                    if ((*grouplong)[i] != NULL)
-                    {
-                        j = sprintf((*grouplong)[i], "%s", bdata(long_info));
-                        (*grouplong)[i][j] = '\0';
-                    }
-                }
-                fclose(fp);
-                if (skip_group)
-                {
-                    if ((*grouplong)[i] != NULL)
-                    {
-                        free((*grouplong)[i]);
-                        (*grouplong)[i] = NULL;
-                    }
-                    if ((*groupshort)[i] != NULL)
-                    {
-                        free((*groupshort)[i]);
-                        (*groupshort)[i] = NULL;
-                    }
-                    (*groupnames)[i][0] = '\0';
-                    bdestroy(long_info);
-                    goto skip_cur_def_group;
-                }
-                i++;
+                free(g->metricnames);
+                free(g->metricformulas);
+                g->metricnames = g->metricformulas = NULL;
+                g->nmetrics = 0;
+                err = -ENOMEM;
+                break;
+            }
+            for (int j = 0; j < g->nmetrics; j++)
+            {
+                g->metricnames[j] = read_cache_string(fp, &err);
+                g->metricformulas[j] = read_cache_string(fp, &err);
             }
-            bdestroy(long_info);
         }
-skip_cur_def_group:
-        skip_group = 0;
+        if (!g->groupname)
+            err = -EIO;
     }
-    closedir(dp);
-    if (!search_home)
+    if (err)
+    {
+        for (int i = 0; i < cat->numGroups; i++)
+            perfgroup_returnGroup(&cat->groups[i].ginfo);
+        free(cat->groups);
+        cat->groups = NULL;
+        cat->numGroups = 0;
+    }
+cleanup:
+    free(magic);
+    free(gpath);
+    free(hpath);
+    fclose(fp);
+    return err;
+}
+
+/* Returns the catalogue for grouppath/architecture, the caller has to hold catalog_lock */
+static GroupCatalog*
+catalog_get(const char* grouppath, const char* architecture, int* err)
+{
+    char* Home = getenv("HOME");
+    GroupCatalog* cat = NULL;
+    GroupCatalog** prev = &catalogs;
+    bstring fullpath = bformat("%s/%s", grouppath, architecture);
+    bstring homepath = bformat("%s/.likwid/groups/%s", Home, architecture);
+    time_t mtime = dir_mtime(bdata(fullpath));
+    time_t home_mtime = dir_mtime(bdata(homepath));
+
+    *err = 0;
+    for (cat = catalogs; cat != NULL; prev = &cat->next, cat = cat->next)
     {
-        if (i==0)
-            perfgroup_returnGroups(totalgroups, *groupnames, *groupshort, *grouplong);
-        /*else if (i < totalgroups)
+        if (strcmp(cat->grouppath, grouppath) == 0 &&
+            strcmp(cat->architecture, architecture) == 0 &&
+            strcmp(cat->homepath, bdata(homepath)) == 0)
         {
-            for (s=i;s<totalgroups;s++)
-            {
-                (*grouplong)[i] = NULL;
-                (*groupshort)[i] = NULL;
-            }
-        }*/
-        free(homepath);
-        free(fullpath);
-        bdestroy(SHORT);
-        bdestroy(REQUIRE);
-        bdestroy(LONG);
-        return i;
+            break;
+        }
+    }
+    if (cat && cat->mtime == mtime && cat->home_mtime == home_mtime)
+    {
+        bdestroy(fullpath);
+        bdestroy(homepath);
+        return cat;
+    }
+    if (cat)
+    {
+        DEBUG_PRINT(DEBUGLEV_DEVELOP, Group directories for %s changed. Rereading groups, architecture);
+        *prev = cat->next;
+        catalog_destroy(cat);
+    }
+    if (mtime == 0)
+    {
+        printf("Cannot access directory %s\n", bdata(fullpath));
+        bdestroy(fullpath);
+        bdestroy(homepath);
+        *err = -EACCES;
+        return NULL;
+    }
+
+    cat = malloc(sizeof(GroupCatalog));
+    if (!cat)
+    {
+        bdestroy(fullpath);
+        bdestroy(homepath);
+        *err = -ENOMEM;
+        return NULL;
+    }
+    memset(cat, 0, sizeof(GroupCatalog));
+    cat->grouppath = copy_string(grouppath);
+    cat->architecture = copy_string(architecture);
+    cat->homepath = copy_string(bdata(homepath));
+    cat->mtime = mtime;
+    cat->home_mtime = home_mtime;
+    if (!cat->grouppath || !cat->architecture || !cat->homepath)
+    {
+        catalog_destroy(cat);
+        bdestroy(fullpath);
+        bdestroy(homepath);
+        *err = -ENOMEM;
+        return NULL;
+    }
+
+    if (catalog_load(cat) == 0)
+    {
+        DEBUG_PRINT(DEBUGLEV_DEVELOP, Read %d groups for %s from group cache, cat->numGroups, architecture);
     }
     else
     {
-        dp = opendir(homepath);
-        while ((ep = readdir(dp)))
+        *err = catalog_scan_dir(cat, bdata(fullpath));
+        if (*err == 0 && home_mtime != 0)
         {
-            if (strncmp(&(ep->d_name[strlen(ep->d_name)-4]), ".txt", 4) == 0)
-            {
-                read_long = 0;
-                bstring long_info = bfromcstr("");;
-                sprintf(&(homepath[hsize]), "/%s", ep->d_name);
-                if (!access(homepath, R_OK))
-                {
-                    (*grouplong)[i] = NULL;
-                    s = sprintf((*groupnames)[i], "%.*s", (int)(strlen(ep->d_name)-4), ep->d_name);
-                    (*groupnames)[i][s] = '\0';
-                    fp = fopen(homepath,"r");
-                    while (fgets (buf, sizeof(buf), fp)) {
-                        bstring bbuf = bfromcstr(buf);
-                        btrimws(bbuf);
-                        if ((blength(bbuf) == 0) || (buf[0] == '#'))
-                        {
-                            bdestroy(bbuf);
-                            continue;
-                        }
-                        if (bstrncmp(bbuf, SHORT, 5) == 0)
-                        {
-                            struct bstrList * linelist = bsplit(bbuf, ' ');
-                            bstring sinfo;
-                            if (linelist->qty == 1)
-                            {
-                                fprintf(stderr,"Cannot read SHORT section in groupfile %s",fullpath);
-                                bdestroy(bbuf);
-                                bstrListDestroy(linelist);
-                                continue;
-                            }
-                            s = 1;
-                            for (j=s;j<linelist->qty; j++)
-                            {
-                                btrimws(linelist->entry[j]);
-                                if (blength(linelist->entry[j]) == 0)
-                                    s += 1;
-                                else
-                                    break;
-                            }
-                            btrimws(linelist->entry[s]);
-                            sinfo = bformat("%s", bdata(linelist->entry[s]));
-                            for (j=s+1;j<linelist->qty; j++)
-                            {
-                                btrimws(linelist->entry[j]);
-                                bstring tmp = bformat(" %s", bdata(linelist->entry[j]));
-                                bconcat(sinfo, tmp);
-                                bdestroy(tmp);
-                            }
-                            (*groupshort)[i] = malloc((blength(sinfo)+1) * sizeof(char));
-                            if ((*groupshort)[i] == NULL)
-                            {
-                                bdestroy(SHORT);
-                                bdestroy(LONG);
-                                bdestroy(REQUIRE);
-                                bdestroy(bbuf);
-                                bdestroy(sinfo);
-                                free(homepath);
-                                free(fullpath);
-                                bstrListDestroy(linelist);
-                                bdestroy(long_info);
-                                perfgroup_returnGroups(i, *groupnames, *groupshort, *grouplong);
-                                return -ENOMEM;
-                            }
-                            s = sprintf((*groupshort)[i], "%s", bdata(sinfo));
-                            (*groupshort)[i][s] = '\0';
-                            bstrListDestroy(linelist);
-                            bdestroy(sinfo);
-                        }
-                        else if (bstrncmp(bbuf, REQUIRE, blength(REQUIRE)) == 0)
-                        {
-                            if (cpuid_topology.numThreadsPerCore > 1)
-                            {
-                                skip_group = 1;
-                            }
-                        }
-                        else if (bstrncmp(bbuf, LONG, 4) == 0)
-                        {
-                            read_long = 1;
-                        }
-                        else if ((read_long == 1) && (bstrncmp(bbuf, LONG, 4) != 0))
-                        {
-                            bstring tmp = bfromcstr(buf);
-                            bconcat(long_info, tmp);
-                            bdestroy(tmp);
-                        }
-                        bdestroy(bbuf);
-                    }
-                    if (read_long)
-                    {
-                        (*grouplong)[i] = malloc((blength(long_info) + 1) * sizeof(char) );
-                        if ((*grouplong)[i] != NULL)
-                        {
-                            j = sprintf((*grouplong)[i], "%s", bdata(long_info));
-                            (*grouplong)[i][j] = '\0';
-                        }
-                    }
-                    fclose(fp);
-                    if (skip_group)
-                    {
-                        if ((*groupshort)[i])
-                        {
-                            free((*groupshort)[i]);
-                            (*groupshort)[i] = NULL;
-                        }
-                        if ((*grouplong)[i])
-                        {
-                            free((*grouplong)[i]);
-                            (*grouplong)[i] = NULL;
-                        }
-                        bdestroy(long_info);
-                        goto skip_cur_home_group;
-                    }
-                    i++;
-                }
-                bdestroy(long_info);
-            }
-skip_cur_home_group:
-        skip_group = 0;
+            *err = catalog_scan_dir(cat, bdata(homepath));
+            if (*err == -EACCES)
+                *err = 0;
         }
-        closedir(dp);
+        if (*err)
+        {
+            if (*err == -EACCES)
+                printf("Cannot open directory %s\n", bdata(fullpath));
+            catalog_destroy(cat);
+            bdestroy(fullpath);
+            bdestroy(homepath);
+            return NULL;
+        }
+        catalog_store(cat);
+    }
+    bdestroy(fullpath);
+    bdestroy(homepath);
+
+    /* Groups in the system directory take precedence over the user's groups */
+    cat->index = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, NULL);
+    for (int i = 0; cat->index && i < cat->numGroups; i++)
+    {
+        char* name = cat->groups[i].ginfo.groupname;
+        if (!g_hash_table_lookup(cat->index, name))
+            g_hash_table_insert(cat->index, name, (gpointer)(uintptr_t)(i+1));
+    }
+    cat->next = catalogs;
+    catalogs = cat;
+    return cat;
+}
+
+int
+perfgroup_getGroups(
+        const char* grouppath,
+        const char* architecture,
+        char*** groupnames,
+        char*** groupshort,
+        char*** grouplong)
+{
+    int i = 0, j = 0;
+    int err = 0;
+    GroupCatalog* cat = NULL;
+    char* Home = getenv("HOME");
+    if ((grouppath == NULL)||(architecture == NULL)||(groupnames == NULL)||(Home == NULL))
+        return -EINVAL;
+    *groupnames = NULL;
+    *groupshort = NULL;
+    *grouplong = NULL;
+
+    pthread_mutex_lock(&catalog_lock);
+    cat = catalog_get(grouppath, architecture, &err);
+    if (!cat)
+    {
+        pthread_mutex_unlock(&catalog_lock);
+        return err;
+    }
+    if (cat->numGroups == 0)
+    {
+        pthread_mutex_unlock(&catalog_lock);
+        return 0;
     }
-    if (i==0)
-        perfgroup_returnGroups(totalgroups, *groupnames, *groupshort, *grouplong);
-/*    else if (i < totalgroups)
+    *groupnames = malloc(cat->numGroups * sizeof(char*));
+    *groupshort = malloc(cat->numGroups * sizeof(char*));
+    *grouplong = malloc(cat->numGroups * sizeof(char*));
+    if (*groupnames == NULL || *groupshort == NULL || *grouplong == NULL)
     {
-        for (s=i;s<totalgroups;s++)
+        pthread_mutex_unlock(&catalog_lock);
+        free(*groupnames);
+        free(*groupshort);
+        free(*grouplong);
+        *groupnames = NULL;
+        *groupshort = NULL;
+        *grouplong = NULL;
+        return -ENOMEM;
+    }
+    for (j = 0; j < cat->numGroups; j++)
+    {
+        GroupCatalogEntry* e = &cat->groups[j];
+        if (e->require_noht && cpuid_topology.numThreadsPerCore > 1)
+            continue;
+        (*groupnames)[i] = copy_string(e->ginfo.groupname);
+        (*groupshort)[i] = listing_shortinfo(e->ginfo.shortinfo);
+        (*grouplong)[i] = copy_string(e->ginfo.longinfo);
+        if ((*groupnames)[i] == NULL)
         {
-            printf("Setting NULL for group %d\n", s);
-            (*groupnames)[i] = NULL;
-            (*grouplong)[i] = NULL;
-            (*groupshort)[i] = NULL;
+            pthread_mutex_unlock(&catalog_lock);
+            perfgroup_returnGroups(i, *groupnames, *groupshort, *grouplong);
+            return -ENOMEM;
         }
-    }*/
-    bdestroy(SHORT);
-    bdestroy(LONG);
-    bdestroy(REQUIRE);
-    free(fullpath);
-    free(homepath);
+        i++;
+    }
+    pthread_mutex_unlock(&catalog_lock);
+    if (i == 0)
+    {
+        perfgroup_returnGroups(0, *groupnames, *groupshort, *grouplong);
+        *groupnames = NULL;
+        *groupshort = NULL;
+        *grouplong = NULL;
+    }
     return i;
 }
 
@@ -831,44 +970,17 @@ cleanup:
     return err;
 }
 
-int
-perfgroup_readGroup(
-        const char* grouppath,
-        const char* architecture,
-        const char* groupname,
-        GroupInfo* ginfo)
+static int
+read_group_file(const char* filename, const char* groupname, GroupInfo* ginfo, int* require_noht)
 {
     FILE* fp;
     int i, s, e, err = 0;
     char buf[1024];
     GroupFileSections sec = GROUP_NONE;
     bstring REQUIRE = bformat("REQUIRE_NOHT");
-    char* Home = getenv("HOME");
-    if ((grouppath == NULL)||(architecture == NULL)||(groupname == NULL)||(ginfo == NULL)||(Home == NULL))
-        return -EINVAL;
 
-    bstring fullpath = bformat("%s/%s/%s.txt", grouppath,architecture, groupname);
-    bstring homepath = bformat("%s/.likwid/groups/%s/%s.txt", Home,architecture, groupname);
-
-    if (access(bdata(fullpath), R_OK))
-    {
-        DEBUG_PRINT(DEBUGLEV_INFO, Cannot read group file %s. Trying %s, bdata(fullpath), bdata(homepath));
-        if (access(bdata(homepath), R_OK))
-        {
-            ERROR_PRINT(Cannot read group file %s.txt. Searched in %s and %s, groupname, bdata(fullpath), bdata(homepath));
-            bdestroy(REQUIRE);
-            bdestroy(fullpath);
-            bdestroy(homepath);
-            return -EACCES;
-        }
-        else
-        {
-            bdestroy(fullpath);
-            fullpath = bstrcpy(homepath);
-        }
-    }
-
-    DEBUG_PRINT(DEBUGLEV_INFO, Reading group %s from %s, groupname, bdata(fullpath));
+    DEBUG_PRINT(DEBUGLEV_INFO, Reading group %s from %s, groupname, filename);
+    *require_noht = 0;
 
     ginfo->shortinfo = NULL;
     ginfo->nevents = 0;
@@ -888,12 +1000,12 @@ perfgroup_readGroup(
     i = sprintf(ginfo->groupname, "%s", groupname);
     ginfo->groupname[i] = '\0';
 
-    fp = fopen(bdata(fullpath), "r");
+    fp = fopen(filename, "r");
     if (fp == NULL)
     {
         free(ginfo->groupname);
-        bdestroy(fullpath);
-        bdestroy(homepath);
+        ginfo->groupname = NULL;
+        bdestroy(REQUIRE);
         return -EACCES;
     }
     struct bstrList * linelist;
@@ -916,11 +1028,7 @@ perfgroup_readGroup(
         }
         else if (strncmp(bdata(REQUIRE), buf, blength(REQUIRE)) == 0)
         {
-            if (cpuid_topology.numThreadsPerCore > 1)
-            {
-                err = -ENODEV;
-                goto cleanup;
-            }
+            *require_noht = 1;
             continue;
         }
         else if (strncmp(groupFileSectionNames[GROUP_EVENTSET], buf, strlen(groupFileSectionNames[GROUP_EVENTSET])) == 0)
@@ -1157,13 +1265,9 @@ perfgroup_readGroup(
     //bstrListDestroy(linelist);
     fclose(fp);
     bdestroy(REQUIRE);
-    bdestroy(homepath);
-    bdestroy(fullpath);
     return 0;
 cleanup:
     bdestroy(REQUIRE);
-    bdestroy(homepath);
-    bdestroy(fullpath);
     if (ginfo->groupname)
         free(ginfo->groupname);
     if (ginfo->shortinfo)
@@ -1202,6 +1306,42 @@ cleanup:
     return err;
 }
 
+int
+perfgroup_readGroup(
+        const char* grouppath,
+        const char* architecture,
+        const char* groupname,
+        GroupInfo* ginfo)
+{
+    int err = 0;
+    int idx = 0;
+    GroupCatalog* cat = NULL;
+    char* Home = getenv("HOME");
+    if ((grouppath == NULL)||(architecture == NULL)||(groupname == NULL)||(ginfo == NULL)||(Home == NULL))
+        return -EINVAL;
+
+    pthread_mutex_lock(&catalog_lock);
+    cat = catalog_get(grouppath, architecture, &err);
+    if (cat && cat->index)
+    {
+        idx = (int)(uintptr_t)g_hash_table_lookup(cat->index, groupname);
+    }
+    if (idx == 0)
+    {
+        pthread_mutex_unlock(&catalog_lock);
+        ERROR_PRINT(Cannot read group file %s.txt. Searched in %s/%s and %s/.likwid/groups/%s, groupname, grouppath, architecture, Home, architecture);
+        return -EACCES;
+    }
+    if (cat->groups[idx-1].require_noht && cpuid_topology.numThreadsPerCore > 1)
+    {
+        pthread_mutex_unlock(&catalog_lock);
+        return -ENODEV;
+    }
+    err = copy_group(&cat->groups[idx-1].ginfo, ginfo);
+    pthread_mutex_unlock(&catalog_lock);
+    return err;
+}
+
 int
 perfgroup_new(GroupInfo* ginfo)
 {
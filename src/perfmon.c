@@ -33,10 +33,14 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
+#include <ctype.h>
 #include <math.h>
 #include <float.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <sys/types.h>
 
 #include <types.h>
@@ -49,6 +53,8 @@
 #include <topology.h>
 #include <access.h>
 #include <perfgroup.h>
+#include <ghash.h>
+#include <histogram.h>
 #if !defined(__ARM_ARCH_7A__) && !defined(__ARM_ARCH_8A)
 #include <cpuid.h>
 #endif
@@ -110,6 +116,28 @@ int perfmon_verbosity = DEBUGLEV_ONLY_ERROR;
 int maps_checked = 0;
 uint64_t **currentConfig = NULL;
 static int added_generic_event = 0;
+static const PerfmonEventTable* eventTable = NULL;
+static GHashTable* eventIndex = NULL;
+static GHashTable* counterIndex = NULL;
+
+/* Register program of a group for one thread. It is recorded the first time
+ * a group is set up through perfmon_switchActiveGroup and replayed on later
+ * switches instead of running the architecture setup function again. */
+typedef struct {
+    int valid;
+    HPMProgram prog;
+    uint64_t* config; /* currentConfig row after the setup */
+    int* init; /* init flags of the group's events after the setup */
+} GroupProgram;
+
+/* Serializes the group timer and the time slice accounting of concurrent
+ * per-thread reads */
+static pthread_mutex_t sliceLock = PTHREAD_MUTEX_INITIALIZER;
+
+static GroupProgram** groupPrograms = NULL;
+static int numGroupPrograms = 0;
+
+static void __perfmon_freePrograms(void);
 
 PerfmonGroupSet* groupSet = NULL;
 LikwidResults* markerResults = NULL;
@@ -174,11 +202,93 @@ char* default_translate_types[NUM_UNITS] = {
 
 /* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
 
+/* The lookup tables map the event names and counter keys to their position
+ * in eventHash and counter_map. The position is stored incremented by one
+ * because a NULL value marks a missing entry. */
+static GHashTable*
+buildMapIndex(void* table, size_t stride, size_t keyoffset, int count)
+{
+    GHashTable* index = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, NULL);
+    if (!index)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        char* key = *(char**)(((char*)table) + i * stride + keyoffset);
+        if (key && !g_hash_table_lookup(index, key))
+        {
+            g_hash_table_insert(index, key, (gpointer)(uintptr_t)(i+1));
+        }
+    }
+    return index;
+}
+
+static int
+lookupMapIndex(GHashTable* index, bstring key)
+{
+    gpointer value = NULL;
+    if (index && key && bdata(key))
+    {
+        value = g_hash_table_lookup(index, bdata(key));
+    }
+    return ((int)(uintptr_t)value) - 1;
+}
+
+static void
+destroyMapIndex(GHashTable** index)
+{
+    if (*index)
+    {
+        g_hash_table_destroy(*index);
+        *index = NULL;
+    }
+}
+
+static PerfmonEvent*
+materializeEventTable(const PerfmonEventTable* table, int extra)
+{
+    PerfmonEvent* events = malloc((table->numEvents+extra)*sizeof(PerfmonEvent));
+    if (!events)
+    {
+        return NULL;
+    }
+    memset(events, '\0', (table->numEvents+extra)*sizeof(PerfmonEvent));
+    for (int i = 0; i < table->numEvents; i++)
+    {
+        const PerfmonEventEntry* e = &table->events[i];
+        events[i].name = table->strings + e->name;
+        events[i].limit = (char*)(table->strings + e->limit);
+        events[i].eventId = e->eventId;
+        events[i].umask = e->umask;
+        events[i].cfgBits = e->cfgBits;
+        events[i].cmask = e->cmask;
+        events[i].numberOfOptions = e->numberOfOptions;
+        events[i].optionMask = e->optionMask;
+        for (int j = 0; j < e->numberOfOptions && j < NUM_EVENT_OPTIONS; j++)
+        {
+            events[i].options[j] = table->options[e->options + j];
+        }
+    }
+    return events;
+}
+
 static int
 getIndexAndType (bstring reg, RegisterIndex* index, RegisterType* type)
 {
     int ret = FALSE;
 
+    if (counterIndex)
+    {
+        int i = lookupMapIndex(counterIndex, reg);
+        if (i >= 0)
+        {
+            *index = counter_map[i].index;
+            *type = counter_map[i].type;
+            ret = TRUE;
+        }
+        return ret;
+    }
     for (int i=0; i< perfmon_numCounters; i++)
     {
         if (biseqcstr(reg, counter_map[i].key))
@@ -292,6 +402,11 @@ checkAccess(bstring reg, RegisterIndex index, RegisterType oldtype, int force)
 /*                    currentConfig[cpu_id][index] = 0x0ULL;*/
 /*                }*/
             }
+            else if (HPMshared())
+            {
+                DEBUG_PRINT(DEBUGLEV_DETAIL, Counter %s is programmed by the system session (0x%llx),
+                                             counter_map[index].key, LLU_CAST tmp);
+            }
             else if ((force == 0) && ((type != FIXED)&&(type != THERMAL)&&(type != VOLTAGE)&&(type != POWER)&&(type != WBOX0FIX)&&(type != MBOX0TMP)))
             {
                 fprintf(stderr, "ERROR: The selected register %s is in use.\n", counter_map[index].key);
@@ -348,6 +463,16 @@ static int
 getEvent(bstring event_str, bstring counter_str, PerfmonEvent* event)
 {
     int ret = FALSE;
+    if (eventIndex)
+    {
+        int i = lookupMapIndex(eventIndex, event_str);
+        if (i >= 0)
+        {
+            *event = eventHash[i];
+            ret = TRUE;
+        }
+        return ret;
+    }
     for (int i=0; i< perfmon_numArchEvents; i++)
     {
         if (biseqcstr(event_str, eventHash[i].name))
@@ -822,6 +947,9 @@ perfmon_check_counter_map(int cpu_id)
         }
 #endif
     }
+    /* Many events share the same limit string, so the result of the counter
+     * check is cached per distinct limit */
+    GHashTable* limitCache = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, NULL);
     for (int i=0; i<perfmon_numArchEvents; i++)
     {
         int found = 0;
@@ -829,30 +957,43 @@ perfmon_check_counter_map(int cpu_id)
         {
             continue;
         }
-        bstring estr = bfromcstr(eventHash[i].name);
-        for (int j=0;j<perfmon_numCounters; j++)
+        gpointer cached = (limitCache ? g_hash_table_lookup(limitCache, eventHash[i].limit) : NULL);
+        if (cached)
         {
-            if (counter_map[j].type == NOTYPE)
+            found = GPOINTER_TO_UINT(cached) - 1;
+        }
+        else
+        {
+            for (int j=0;j<perfmon_numCounters; j++)
             {
-                continue;
+                if (counter_map[j].type == NOTYPE)
+                {
+                    continue;
+                }
+                bstring cstr = bfromcstr(counter_map[j].key);
+                if (checkCounter(cstr, eventHash[i].limit))
+                {
+                    found = 1;
+                    bdestroy(cstr);
+                    break;
+                }
+                bdestroy(cstr);
             }
-            PerfmonEvent event;
-            bstring cstr = bfromcstr(counter_map[j].key);
-            if (getEvent(estr, cstr, &event) && checkCounter(cstr, eventHash[i].limit))
+            if (limitCache)
             {
-                found = 1;
-                bdestroy(cstr);
-                break;
+                g_hash_table_insert(limitCache, eventHash[i].limit, (gpointer)(uintptr_t)(found+1));
             }
-            bdestroy(cstr);
         }
-        bdestroy(estr);
         if (!found)
         {
             DEBUG_PRINT(DEBUGLEV_DEVELOP, Cannot respect limit %s. Removing event %s, eventHash[i].limit, eventHash[i].name);
             eventHash[i].limit = "";
         }
     }
+    if (limitCache)
+    {
+        g_hash_table_destroy(limitCache);
+    }
     maps_checked = 1;
     if (own_hpm)
         HPMfinalize();
@@ -871,7 +1012,7 @@ perfmon_init_maps(void)
             {
                 case PENTIUM_M_BANIAS:
                 case PENTIUM_M_DOTHAN:
-                    eventHash = pm_arch_events;
+                    eventTable = &pm_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEvents_pm;
                     counter_map = pm_counter_map;
                     box_map = pm_box_map;
@@ -883,7 +1024,7 @@ perfmon_init_maps(void)
                 case ATOM_32:
                 case ATOM_22:
                 case ATOM:
-                    eventHash = atom_arch_events;
+                    eventTable = &atom_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsAtom;
                     counter_map = core2_counter_map;
                     perfmon_numCounters = perfmon_numCountersCore2;
@@ -897,7 +1038,7 @@ perfmon_init_maps(void)
                 case ATOM_SILVERMONT_Z2:
                 case ATOM_SILVERMONT_F:
                 case ATOM_SILVERMONT_AIR:
-                    eventHash = silvermont_arch_events;
+                    eventTable = &silvermont_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsSilvermont;
                     counter_map = silvermont_counter_map;
                     box_map = silvermont_box_map;
@@ -910,7 +1051,7 @@ perfmon_init_maps(void)
                 case ATOM_DENVERTON:
                 case ATOM_GOLDMONT_PLUS:
                 case ATOM_TREMONT:
-                    eventHash = goldmont_arch_events;
+                    eventTable = &goldmont_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsGoldmont;
                     counter_map = goldmont_counter_map;
                     box_map = goldmont_box_map;
@@ -926,7 +1067,7 @@ perfmon_init_maps(void)
                 case XEON_MP:
                 case CORE2_65:
                 case CORE2_45:
-                    eventHash = core2_arch_events;
+                    eventTable = &core2_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsCore2;
                     counter_map = core2_counter_map;
                     perfmon_numCounters = perfmon_numCountersCore2;
@@ -935,7 +1076,7 @@ perfmon_init_maps(void)
                     break;
 
                 case NEHALEM_EX:
-                    eventHash = nehalemEX_arch_events;
+                    eventTable = &nehalemEX_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsNehalemEX;
                     counter_map = nehalemEX_counter_map;
                     perfmon_numCounters = perfmon_numCountersNehalemEX;
@@ -944,7 +1085,7 @@ perfmon_init_maps(void)
                     break;
 
                 case WESTMERE_EX:
-                    eventHash = westmereEX_arch_events;
+                    eventTable = &westmereEX_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsWestmereEX;
                     counter_map = westmereEX_counter_map;
                     perfmon_numCounters = perfmon_numCountersWestmereEX;
@@ -955,7 +1096,7 @@ perfmon_init_maps(void)
                 case NEHALEM_BLOOMFIELD:
                 case NEHALEM_LYNNFIELD:
                 case NEHALEM_LYNNFIELD_M:
-                    eventHash = nehalem_arch_events;
+                    eventTable = &nehalem_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsNehalem;
                     counter_map = nehalem_counter_map;
                     perfmon_numCounters = perfmon_numCountersNehalem;
@@ -965,7 +1106,7 @@ perfmon_init_maps(void)
 
                 case NEHALEM_WESTMERE_M:
                 case NEHALEM_WESTMERE:
-                    eventHash = westmere_arch_events;
+                    eventTable = &westmere_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsWestmere;
                     counter_map = nehalem_counter_map;
                     perfmon_numCounters = perfmon_numCountersNehalem;
@@ -977,7 +1118,7 @@ perfmon_init_maps(void)
                     pci_devices = ivybridgeEP_pci_devices;
                     translate_types = ivybridgeEP_translate_types;
                     box_map = ivybridgeEP_box_map;
-                    eventHash = ivybridgeEP_arch_events;
+                    eventTable = &ivybridgeEP_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsIvybridgeEP;
                     counter_map = ivybridgeEP_counter_map;
                     perfmon_numCounters = perfmon_numCountersIvybridgeEP;
@@ -986,7 +1127,7 @@ perfmon_init_maps(void)
                     break;
                 case IVYBRIDGE:
                     translate_types = default_translate_types;
-                    eventHash = ivybridge_arch_events;
+                    eventTable = &ivybridge_arch_events;
                     box_map = ivybridge_box_map;
                     perfmon_numArchEvents = perfmon_numArchEventsIvybridge;
                     counter_map = ivybridge_counter_map;
@@ -996,7 +1137,7 @@ perfmon_init_maps(void)
                     break;
 
                 case HASWELL_EP:
-                    eventHash = haswellEP_arch_events;
+                    eventTable = &haswellEP_arch_events;
                     translate_types = haswellEP_translate_types;
                     perfmon_numArchEvents = perfmon_numArchEventsHaswellEP;
                     counter_map = haswellEP_counter_map;
@@ -1009,7 +1150,7 @@ perfmon_init_maps(void)
                 case HASWELL:
                 case HASWELL_M1:
                 case HASWELL_M2:
-                    eventHash = haswell_arch_events;
+                    eventTable = &haswell_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsHaswell;
                     counter_map = haswell_counter_map;
                     perfmon_numCounters = perfmon_numCountersHaswell;
@@ -1022,7 +1163,7 @@ perfmon_init_maps(void)
                     pci_devices = sandybridgeEP_pci_devices;
                     translate_types = sandybridgeEP_translate_types;
                     box_map = sandybridgeEP_box_map;
-                    eventHash = sandybridgeEP_arch_events;
+                    eventTable = &sandybridgeEP_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsSandybridgeEP;
                     counter_map = sandybridgeEP_counter_map;
                     perfmon_numCounters = perfmon_numCountersSandybridgeEP;
@@ -1031,7 +1172,7 @@ perfmon_init_maps(void)
                     break;
                 case SANDYBRIDGE:
                     box_map = sandybridge_box_map;
-                    eventHash = sandybridge_arch_events;
+                    eventTable = &sandybridge_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsSandybridge;
                     counter_map = sandybridge_counter_map;
                     perfmon_numCounters = perfmon_numCountersSandybridge;
@@ -1042,7 +1183,7 @@ perfmon_init_maps(void)
                 case BROADWELL:
                 case BROADWELL_E3:
                     box_map = broadwell_box_map;
-                    eventHash = broadwell_arch_events;
+                    eventTable = &broadwell_arch_events;
                     counter_map = broadwell_counter_map;
                     perfmon_numArchEvents = perfmon_numArchEventsBroadwell;
                     perfmon_numCounters = perfmon_numCountersBroadwell;
@@ -1053,7 +1194,7 @@ perfmon_init_maps(void)
                     pci_devices = broadwelld_pci_devices;
                     translate_types = broadwellEP_translate_types;
                     box_map = broadwelld_box_map;
-                    eventHash = broadwelld_arch_events;
+                    eventTable = &broadwelld_arch_events;
                     counter_map = broadwelld_counter_map;
                     perfmon_numArchEvents = perfmon_numArchEventsBroadwellD;
                     perfmon_numCounters = perfmon_numCountersBroadwellD;
@@ -1063,7 +1204,7 @@ perfmon_init_maps(void)
                 case BROADWELL_E:
                     pci_devices = broadwellEP_pci_devices;
                     box_map = broadwellEP_box_map;
-                    eventHash = broadwellEP_arch_events;
+                    eventTable = &broadwellEP_arch_events;
                     translate_types = broadwellEP_translate_types;
                     counter_map = broadwellEP_counter_map;
                     perfmon_numArchEvents = perfmon_numArchEventsBroadwellEP;
@@ -1080,7 +1221,7 @@ perfmon_init_maps(void)
                 case COMETLAKE1:
                 case COMETLAKE2:
                     box_map = skylake_box_map;
-                    eventHash = skylake_arch_events;
+                    eventTable = &skylake_arch_events;
                     counter_map = skylake_counter_map;
                     perfmon_numArchEvents = perfmon_numArchEventsSkylake;
                     perfmon_numCounters = perfmon_numCountersSkylake;
@@ -1091,7 +1232,7 @@ perfmon_init_maps(void)
                     if (cpuid_info.stepping >= 0 && cpuid_info.stepping < 5)
                     {
                         box_map = skylakeX_box_map;
-                        eventHash = skylakeX_arch_events;
+                        eventTable = &skylakeX_arch_events;
                         counter_map = skylakeX_counter_map;
                         perfmon_numArchEvents = perfmon_numArchEventsSkylakeX;
                         perfmon_numCounters = perfmon_numCountersSkylakeX;
@@ -1102,7 +1243,7 @@ perfmon_init_maps(void)
                     else
                     {
                         box_map = skylakeX_box_map;
-                        eventHash = cascadelakeX_arch_events;
+                        eventTable = &cascadelakeX_arch_events;
                         counter_map = skylakeX_counter_map;
                         perfmon_numArchEvents = perfmon_numArchEventsCascadelakeX;
                         perfmon_numCounters = perfmon_numCountersSkylakeX;
@@ -1115,7 +1256,7 @@ perfmon_init_maps(void)
                 case XEON_PHI_KNL:
                 case XEON_PHI_KML:
                     pci_devices = knl_pci_devices;
-                    eventHash = knl_arch_events;
+                    eventTable = &knl_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsKNL;
                     counter_map = knl_counter_map;
                     box_map = knl_box_map;
@@ -1126,7 +1267,7 @@ perfmon_init_maps(void)
                 case TIGERLAKE1:
                 case TIGERLAKE2:
                     box_map = tigerlake_box_map;
-                    eventHash = tigerlake_arch_events;
+                    eventTable = &tigerlake_arch_events;
                     counter_map = tigerlake_counter_map;
                     perfmon_numArchEvents = perfmon_numArchEventsTigerlake;
                     perfmon_numCounters = perfmon_numCountersTigerlake;
@@ -1135,7 +1276,7 @@ perfmon_init_maps(void)
                 case ICELAKE2:
                 case ROCKETLAKE:
                     pci_devices = icelake_pci_devices;
-                    eventHash = icelake_arch_events;
+                    eventTable = &icelake_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsIcelake;
                     counter_map = icelake_counter_map;
                     box_map = icelake_box_map;
@@ -1146,7 +1287,7 @@ perfmon_init_maps(void)
                 case ICELAKEX1:
                 case ICELAKEX2:
                     pci_devices = icelakeX_pci_devices;
-                    eventHash = icelakeX_arch_events;
+                    eventTable = &icelakeX_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsIcelakeX;
                     counter_map = icelakeX_counter_map;
                     box_map = icelakeX_box_map;
@@ -1165,7 +1306,7 @@ perfmon_init_maps(void)
             switch ( cpuid_info.model )
             {
                 case XEON_PHI:
-                    eventHash = phi_arch_events;
+                    eventTable = &phi_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsPhi;
                     counter_map = phi_counter_map;
                     box_map = phi_box_map;
@@ -1180,7 +1321,7 @@ perfmon_init_maps(void)
             break;
 
         case K8_FAMILY:
-            eventHash = k8_arch_events;
+            eventTable = &k8_arch_events;
             perfmon_numArchEvents = perfmon_numArchEventsK8;
             counter_map = k10_counter_map;
             box_map = k10_box_map;
@@ -1189,7 +1330,7 @@ perfmon_init_maps(void)
             break;
 
         case K10_FAMILY:
-            eventHash = k10_arch_events;
+            eventTable = &k10_arch_events;
             perfmon_numArchEvents = perfmon_numArchEventsK10;
             counter_map = k10_counter_map;
             box_map = k10_box_map;
@@ -1198,7 +1339,7 @@ perfmon_init_maps(void)
             break;
 
         case K15_FAMILY:
-            eventHash = interlagos_arch_events;
+            eventTable = &interlagos_arch_events;
             perfmon_numArchEvents = perfmon_numArchEventsInterlagos;
             counter_map = interlagos_counter_map;
             box_map = interlagos_box_map;
@@ -1207,7 +1348,7 @@ perfmon_init_maps(void)
             break;
 
         case K16_FAMILY:
-            eventHash = kabini_arch_events;
+            eventTable = &kabini_arch_events;
             perfmon_numArchEvents = perfmon_numArchEventsKabini;
             counter_map = kabini_counter_map;
             box_map = kabini_box_map;
@@ -1221,7 +1362,7 @@ perfmon_init_maps(void)
                 case ZEN_RYZEN:
                 case ZENPLUS_RYZEN:
                 case ZENPLUS_RYZEN2:
-                    eventHash = zen_arch_events;
+                    eventTable = &zen_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsZen;
                     counter_map = zen_counter_map;
                     box_map = zen_box_map;
@@ -1231,7 +1372,7 @@ perfmon_init_maps(void)
                 case ZEN2_RYZEN:
                 case ZEN2_RYZEN2:
                 case ZEN2_RYZEN3:
-                    eventHash = zen2_arch_events;
+                    eventTable = &zen2_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsZen2;
                     counter_map = zen2_counter_map;
                     box_map = zen2_box_map;
@@ -1248,7 +1389,7 @@ perfmon_init_maps(void)
                 case ZEN3_RYZEN:
                 case ZEN3_RYZEN2:
                 case ZEN3_RYZEN3:
-                    eventHash = zen3_arch_events;
+                    eventTable = &zen3_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsZen3;
                     counter_map = zen3_counter_map;
                     box_map = zen3_box_map;
@@ -1264,7 +1405,7 @@ perfmon_init_maps(void)
             switch ( cpuid_info.model )
             {
                 case POWER8:
-                    eventHash = power8_arch_events;
+                    eventTable = &power8_arch_events;
                     counter_map = power8_counter_map;
                     box_map = power8_box_map;
                     translate_types = power8_translate_types;
@@ -1272,7 +1413,7 @@ perfmon_init_maps(void)
                     perfmon_numCounters = NUM_COUNTERS_POWER8;
                     break;
                 case POWER9:
-                    eventHash = power9_arch_events;
+                    eventTable = &power9_arch_events;
                     counter_map = power9_counter_map;
                     box_map = power9_box_map;
                     translate_types = power9_translate_types;
@@ -1288,7 +1429,7 @@ perfmon_init_maps(void)
             {
                 case ARMV7L:
                 case ARM7L:
-                    eventHash = a15_arch_events;
+                    eventTable = &a15_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsA15;
                     counter_map = a15_counter_map;
                     box_map = a15_box_map;
@@ -1297,7 +1438,7 @@ perfmon_init_maps(void)
                     break;
                 case ARM_CORTEX_A35:
                 case ARM_CORTEX_A53:
-                    eventHash = a57_arch_events;
+                    eventTable = &a57_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsA57;
                     counter_map = a57_counter_map;
                     box_map = a57_box_map;
@@ -1307,7 +1448,7 @@ perfmon_init_maps(void)
                 case ARM_CORTEX_A57:
                 case ARM_CORTEX_A72:
                 case ARM_CORTEX_A73:
-                    eventHash = a57_arch_events;
+                    eventTable = &a57_arch_events;
                     perfmon_numArchEvents = perfmon_numArchEventsA57;
                     counter_map = a57_counter_map;
                     box_map = a57_box_map;
@@ -1333,7 +1474,7 @@ perfmon_init_maps(void)
                         case ARM_CORTEX_A57:
                         case ARM_CORTEX_A72:
                         case ARM_CORTEX_A73:
-                            eventHash = a57_arch_events;
+                            eventTable = &a57_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsA57;
                             counter_map = a57_counter_map;
                             box_map = a57_box_map;
@@ -1346,7 +1487,7 @@ perfmon_init_maps(void)
                             break;
                         case ARM_CORTEX_A35:
                         case ARM_CORTEX_A53:
-                            eventHash = a57_arch_events;
+                            eventTable = &a57_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsA57;
                             counter_map = a57_counter_map;
                             box_map = a57_box_map;
@@ -1354,7 +1495,7 @@ perfmon_init_maps(void)
                             translate_types = a53_translate_types;
                             break;
                         case ARM_NEOVERSE_N1:
-                            eventHash = neon1_arch_events;
+                            eventTable = &neon1_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsNeoN1;
                             counter_map = neon1_counter_map;
                             box_map = neon1_box_map;
@@ -1370,7 +1511,7 @@ perfmon_init_maps(void)
                     switch (cpuid_info.part)
                     {
                         case CAV_THUNDERX2T99:
-                            eventHash = cavtx2_arch_events;
+                            eventTable = &cavtx2_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsCavTx2;
                             counter_map = cav_tx2_counter_map;
                             box_map = cav_tx2_box_map;
@@ -1386,7 +1527,7 @@ perfmon_init_maps(void)
                     switch (cpuid_info.part)
                     {
                         case CAV_THUNDERX2T99P1:
-                            eventHash = cavtx2_arch_events;
+                            eventTable = &cavtx2_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsCavTx2;
                             counter_map = cav_tx2_counter_map;
                             box_map = cav_tx2_box_map;
@@ -1402,7 +1543,7 @@ perfmon_init_maps(void)
                     switch (cpuid_info.part)
                     {
                         case FUJITSU_A64FX:
-                            eventHash = a64fx_arch_events;
+                            eventTable = &a64fx_arch_events;
                             perfmon_numArchEvents = perfmon_numArchEventsA64FX;
                             counter_map = a64fx_counter_map;
                             box_map = a64fx_box_map;
@@ -1424,15 +1565,22 @@ perfmon_init_maps(void)
             ERROR_PLAIN_PRINT(Unsupported Processor);
             break;
     }
-    if (eventHash)
+    destroyMapIndex(&counterIndex);
+    if (counter_map)
+    {
+        counterIndex = buildMapIndex(counter_map, sizeof(RegisterMap), offsetof(RegisterMap, key), perfmon_numCounters);
+    }
+    if (eventTable)
     {
         int cpu_id = sched_getcpu();
         HPMaddThread(cpu_id);
-        PerfmonEvent* tmp = malloc((perfmon_numArchEvents+10)*sizeof(PerfmonEvent));
-        if (tmp)
+        PerfmonEvent* tmp = materializeEventTable(eventTable, 10);
+        if (!tmp)
+        {
+            ERROR_PLAIN_PRINT(Cannot allocate event list);
+        }
+        else
         {
-            memcpy(tmp, eventHash, perfmon_numArchEvents*sizeof(PerfmonEvent));
-            memset(tmp + perfmon_numArchEvents, '\0', 10*sizeof(PerfmonEvent));
             eventHash = tmp;
             eventHash[perfmon_numArchEvents].name = "GENERIC_EVENT";
             struct tagbstring bsep = bsStatic ("|");
@@ -1454,23 +1602,14 @@ perfmon_init_maps(void)
                     }
                     if (!found)
                     {
-                        for (int k = 0; k < perfmon_numCounters; k++)
-                        {
-                            bstring bkey = bfromcstr(counter_map[k].key);
-                            if (bstrcmp(xlist->entry[j], bkey) == BSTR_OK)
-                            {
+                        int k = lookupMapIndex(counterIndex, xlist->entry[j]);
 #ifndef LIKWID_USE_PERFEVENT
-                                if (HPMcheck(counter_map[k].device, cpu_id))
+                        if (k >= 0 && HPMcheck(counter_map[k].device, cpu_id))
 #else
-                                if (translate_types[counter_map[k].type] && (!access(translate_types[counter_map[k].type], R_OK)))
+                        if (k >= 0 && translate_types[counter_map[k].type] && (!access(translate_types[counter_map[k].type], R_OK)))
 #endif
-                                {
-                                    bstrListAdd(outlist, xlist->entry[j]);
-                                    bdestroy(bkey);
-                                    break;
-                                }
-                            }
-                            bdestroy(bkey);
+                        {
+                            bstrListAdd(outlist, xlist->entry[j]);
                         }
                     }
                 }
@@ -1497,6 +1636,11 @@ perfmon_init_maps(void)
             added_generic_event = 1;
         }
     }
+    destroyMapIndex(&eventIndex);
+    if (eventHash)
+    {
+        eventIndex = buildMapIndex(eventHash, sizeof(PerfmonEvent), offsetof(PerfmonEvent, name), perfmon_numArchEvents);
+    }
 
     return;
 }
@@ -2046,6 +2190,7 @@ perfmon_finalize(void)
     {
         return;
     }
+    __perfmon_freePrograms();
     for(group=0;group < groupSet->numberOfActiveGroups; group++)
     {
         for (thread=0;thread< groupSet->numberOfThreads; thread++)
@@ -2056,6 +2201,8 @@ perfmon_finalize(void)
         {
             if (groupSet->groups[group].events[event].threadCounter)
                 free(groupSet->groups[group].events[event].threadCounter);
+            if (groupSet->groups[group].events[event].sliceStats)
+                free(groupSet->groups[group].events[event].sliceStats);
         }
         if (groupSet->groups[group].events != NULL)
             free(groupSet->groups[group].events);
@@ -2108,6 +2255,8 @@ perfmon_finalize(void)
             free(eventHash);
             eventHash = NULL;
         }
+        destroyMapIndex(&eventIndex);
+        destroyMapIndex(&counterIndex);
         added_generic_event = 0;
     }
     perfmon_initialized = 0;
@@ -2168,6 +2317,9 @@ perfmon_addEventSet(const char* eventCString)
         groupSet->groups[0].rdtscTime = 0;
         groupSet->groups[0].runTime = 0;
         groupSet->groups[0].numberOfEvents = 0;
+        groupSet->groups[0].numSlices = 0;
+        groupSet->groups[0].sliceTime = 0;
+        groupSet->groups[0].weight = 1.0;
     }
 
     if ((groupSet->numberOfActiveGroups > 0) && (groupSet->numberOfActiveGroups == groupSet->numberOfGroups))
@@ -2182,6 +2334,9 @@ perfmon_addEventSet(const char* eventCString)
         groupSet->groups[groupSet->numberOfActiveGroups].rdtscTime = 0;
         groupSet->groups[groupSet->numberOfActiveGroups].runTime = 0;
         groupSet->groups[groupSet->numberOfActiveGroups].numberOfEvents = 0;
+        groupSet->groups[groupSet->numberOfActiveGroups].numSlices = 0;
+        groupSet->groups[groupSet->numberOfActiveGroups].sliceTime = 0;
+        groupSet->groups[groupSet->numberOfActiveGroups].weight = 1.0;
         DEBUG_PLAIN_PRINT(DEBUGLEV_INFO, Allocating new group structure for group.);
     }
     DEBUG_PRINT(DEBUGLEV_INFO, Currently %d groups of %d active,
@@ -2342,6 +2497,8 @@ perfmon_addEventSet(const char* eventCString)
 past_checks:
             event->threadCounter = (PerfmonCounter*) malloc(
                 groupSet->numberOfThreads * sizeof(PerfmonCounter));
+            event->sliceStats = (PerfmonSliceStats*) calloc(
+                groupSet->numberOfThreads, sizeof(PerfmonSliceStats));
 
             if (event->threadCounter == NULL)
             {
@@ -2484,6 +2641,61 @@ perfmon_setupCounters(int groupId)
     return 0;
 }
 
+/* In a shared session of the node access daemon the registers are programmed
+ * by the system session, the writes of this process are only applied to its
+ * view. The counters count the configured events only if the configuration of
+ * this process matches the one of the system session. */
+static int
+__perfmon_checkSystemConfig(int groupId)
+{
+    int i = 0, j = 0;
+    int err = 0;
+    PerfmonEventSet* eventSet = &groupSet->groups[groupId];
+    for (i = 0; i < groupSet->numberOfThreads; i++)
+    {
+        int cpu_id = groupSet->threads[i].processorId;
+        for (j = 0; j < eventSet->numberOfEvents; j++)
+        {
+            PerfmonEventSetEntry* event = &eventSet->events[j];
+            RegisterIndex index = event->index;
+            uint64_t own = 0x0ULL, system = 0x0ULL;
+            if ((event->type == NOTYPE) || (counter_map[index].configRegister == 0x0))
+            {
+                continue;
+            }
+            if ((HPMread(cpu_id, counter_map[index].device, counter_map[index].configRegister, &own) != 0) ||
+                (HPMreadSystem(cpu_id, counter_map[index].device, counter_map[index].configRegister, &system) != 0))
+            {
+                continue;
+            }
+            /* The fixed counters share one configuration register, the system
+             * session may use more of them */
+            if (((event->type == FIXED) && ((own & ~system) != 0x0ULL)) ||
+                ((event->type != FIXED) && (own != system)))
+            {
+                ERROR_PRINT(Event %s on CPU %d is not part of the configuration of the system session (0x%llx vs. 0x%llx),
+                            event->event.name, cpu_id, LLU_CAST own, LLU_CAST system);
+                err = -EBUSY;
+            }
+        }
+    }
+    return err;
+}
+
+/* Compares the generation of the system session's register setup with the one
+ * at the start of the group. A change means the counters were reprogrammed
+ * while the group was running. */
+static void
+__perfmon_checkGeneration(int groupId)
+{
+    uint64_t generation = 0x0ULL;
+    if (HPMgeneration(&generation) == 0 && generation != groupSet->groups[groupId].generation)
+    {
+        fprintf(stderr, "WARN: The system session reprogrammed the counters, results of group %d are invalid\n", groupId);
+        groupSet->groups[groupId].generation = generation;
+    }
+}
+
 int
 __perfmon_startCounters(int groupId)
 {
@@ -2508,6 +2720,15 @@ __perfmon_startCounters(int groupId)
             return -groupSet->threads[i].thread_id-1;
         }
     }
+    if (HPMshared())
+    {
+        ret = __perfmon_checkSystemConfig(groupId);
+        if (ret < 0)
+        {
+            return ret;
+        }
+        HPMgeneration(&groupSet->groups[groupId].generation);
+    }
     groupSet->groups[groupId].state = STATE_START;
     timer_start(&groupSet->groups[groupId].timer);
     return 0;
@@ -2556,13 +2777,84 @@ int perfmon_startGroupCounters(int groupId)
     return __perfmon_startCounters(groupId);
 }
 
+/* Add the interval since the last read or start of a group to its running
+ * time slice. A slice ends when the group is stopped, reads in between only
+ * accumulate. Used for the scaled multiplexing estimates. With threadId >= 0
+ * only the counts of this thread were read (MarkerAPI), the interval still
+ * belongs to the slice of the group. Must be called with sliceLock held. */
+static void
+__perfmon_recordSlice(int groupId, int threadId, int close)
+{
+    int i = 0, j = 0;
+    PerfmonEventSet* eventSet = &groupSet->groups[groupId];
+    double t = 0;
+    eventSet->sliceTime += eventSet->rdtscTime;
+    t = eventSet->sliceTime;
+    for (i = 0; i < eventSet->numberOfEvents; i++)
+    {
+        if (eventSet->events[i].type == NOTYPE || !eventSet->events[i].sliceStats)
+        {
+            continue;
+        }
+        for (j = 0; j < groupSet->numberOfThreads; j++)
+        {
+            if (threadId >= 0 && j != threadId)
+            {
+                continue;
+            }
+            PerfmonSliceStats* s = &eventSet->events[i].sliceStats[j];
+            s->pending += eventSet->events[i].threadCounter[j].lastResult;
+            if (close && t > 0)
+            {
+                s->slices++;
+                s->time += t;
+                s->count += s->pending;
+                s->rate2 += (s->pending * s->pending) / t;
+            }
+            if (close)
+            {
+                s->pending = 0;
+            }
+        }
+    }
+    if (close)
+    {
+        if (t > 0)
+        {
+            eventSet->numSlices++;
+        }
+        eventSet->sliceTime = 0;
+    }
+}
+
+static void
+__perfmon_finishStopCounters(int groupId)
+{
+    int i = 0, j = 0;
+    double result = 0.0;
+    for (i=0; i<perfmon_getNumberOfEvents(groupId); i++)
+    {
+        for (j=0; j<perfmon_getNumberOfThreads(); j++)
+        {
+            result = (double)calculateResult(groupId, i, j);
+            groupSet->groups[groupId].events[i].threadCounter[j].lastResult = result;
+            groupSet->groups[groupId].events[i].threadCounter[j].fullResult += result;
+        }
+    }
+    groupSet->groups[groupId].state = STATE_SETUP;
+    pthread_mutex_lock(&sliceLock);
+    groupSet->groups[groupId].rdtscTime =
+                timer_print(&groupSet->groups[groupId].timer);
+    groupSet->groups[groupId].runTime += groupSet->groups[groupId].rdtscTime;
+    __perfmon_recordSlice(groupId, -1, 1);
+    pthread_mutex_unlock(&sliceLock);
+}
+
 int
 __perfmon_stopCounters(int groupId)
 {
     int i = 0;
-    int j = 0;
     int ret = 0;
-    double result = 0.0;
 
     if (!lock_check())
     {
@@ -2580,20 +2872,12 @@ __perfmon_stopCounters(int groupId)
             return -groupSet->threads[i].thread_id-1;
         }
     }
-
-    for (i=0; i<perfmon_getNumberOfEvents(groupId); i++)
+    if (HPMshared())
     {
-        for (j=0; j<perfmon_getNumberOfThreads(); j++)
-        {
-            result = (double)calculateResult(groupId, i, j);
-            groupSet->groups[groupId].events[i].threadCounter[j].lastResult = result;
-            groupSet->groups[groupId].events[i].threadCounter[j].fullResult += result;
-        }
+        __perfmon_checkGeneration(groupId);
     }
-    groupSet->groups[groupId].state = STATE_SETUP;
-    groupSet->groups[groupId].rdtscTime =
-                timer_print(&groupSet->groups[groupId].timer);
-    groupSet->groups[groupId].runTime += groupSet->groups[groupId].rdtscTime;
+
+    __perfmon_finishStopCounters(groupId);
     return 0;
 }
 
@@ -2668,16 +2952,18 @@ __perfmon_readCounters(int groupId, int threadId)
     {
         return -EINVAL;
     }
-    timer_stop(&groupSet->groups[groupId].timer);
-    groupSet->groups[groupId].rdtscTime = timer_print(&groupSet->groups[groupId].timer);
-    groupSet->groups[groupId].runTime += groupSet->groups[groupId].rdtscTime;
     if (threadId == -1)
     {
+        pthread_mutex_lock(&sliceLock);
+        timer_stop(&groupSet->groups[groupId].timer);
+        groupSet->groups[groupId].rdtscTime = timer_print(&groupSet->groups[groupId].timer);
+        groupSet->groups[groupId].runTime += groupSet->groups[groupId].rdtscTime;
         for (threadId = 0; threadId<groupSet->numberOfThreads; threadId++)
         {
             ret = perfmon_readCountersThread(threadId, &groupSet->groups[groupId]);
             if (ret)
             {
+                pthread_mutex_unlock(&sliceLock);
                 return -threadId-1;
             }
             for (j=0; j < groupSet->groups[groupId].numberOfEvents; j++)
@@ -2692,6 +2978,13 @@ __perfmon_readCounters(int groupId, int threadId)
                 }
             }
         }
+        if (HPMshared())
+        {
+            __perfmon_checkGeneration(groupId);
+        }
+        __perfmon_recordSlice(groupId, -1, 0);
+        timer_start(&groupSet->groups[groupId].timer);
+        pthread_mutex_unlock(&sliceLock);
     }
     else if ((threadId >= 0) && (threadId < groupSet->numberOfThreads))
     {
@@ -2708,8 +3001,16 @@ __perfmon_readCounters(int groupId, int threadId)
             groupSet->groups[groupId].events[j].threadCounter[threadId].startData =
                 groupSet->groups[groupId].events[j].threadCounter[threadId].counterData;
         }
-}
-    timer_start(&groupSet->groups[groupId].timer);
+        /* The MarkerAPI reads the threads concurrently, the group timer and
+         * the slice time are shared by all of them */
+        pthread_mutex_lock(&sliceLock);
+        timer_stop(&groupSet->groups[groupId].timer);
+        groupSet->groups[groupId].rdtscTime = timer_print(&groupSet->groups[groupId].timer);
+        groupSet->groups[groupId].runTime += groupSet->groups[groupId].rdtscTime;
+        __perfmon_recordSlice(groupId, threadId, 0);
+        timer_start(&groupSet->groups[groupId].timer);
+        pthread_mutex_unlock(&sliceLock);
+    }
     return 0;
 }
 
@@ -2790,6 +3091,16 @@ perfmon_isUncoreCounter(char* counter)
     return 1;
 }
 
+/* Counters that report a state (temperature, voltage, link speed) instead
+ * of an event count. Their last value is reported and never scaled. */
+static inline int
+perfmon_isGaugeType(RegisterType type)
+{
+    return ((type == THERMAL) || (type == VOLTAGE) || (type == MBOX0TMP) ||
+            (type == QBOX0FIX) || (type == QBOX1FIX) || (type == QBOX2FIX) ||
+            (type == SBOX0FIX) || (type == SBOX1FIX) || (type == SBOX2FIX));
+}
+
 double
 perfmon_getResult(int groupId, int eventId, int threadId)
 {
@@ -2824,15 +3135,7 @@ perfmon_getResult(int groupId, int eventId, int threadId)
         return NAN;
 
     if ((groupSet->groups[groupId].events[eventId].threadCounter[threadId].fullResult == 0) ||
-        (groupSet->groups[groupId].events[eventId].type == THERMAL) ||
-        (groupSet->groups[groupId].events[eventId].type == VOLTAGE) ||
-        (groupSet->groups[groupId].events[eventId].type == MBOX0TMP) ||
-        (groupSet->groups[groupId].events[eventId].type == QBOX0FIX) ||
-        (groupSet->groups[groupId].events[eventId].type == QBOX1FIX) ||
-        (groupSet->groups[groupId].events[eventId].type == QBOX2FIX) ||
-        (groupSet->groups[groupId].events[eventId].type == SBOX0FIX) ||
-        (groupSet->groups[groupId].events[eventId].type == SBOX1FIX) ||
-        (groupSet->groups[groupId].events[eventId].type == SBOX2FIX))
+        perfmon_isGaugeType(groupSet->groups[groupId].events[eventId].type))
     {
         return groupSet->groups[groupId].events[eventId].threadCounter[threadId].lastResult;
     }
@@ -3110,101 +3413,1000 @@ __perfmon_switchActiveGroupThread(int thread_id, int new_group)
     return 0;
 }
 
-int
-perfmon_switchActiveGroup(int new_group)
+static void
+__perfmon_freePrograms(void)
 {
-    int i = 0;
-    int ret = 0;
-    for(i=0;i<groupSet->numberOfThreads;i++)
+    int g = 0, t = 0;
+    if (!groupPrograms)
     {
-        ret = __perfmon_switchActiveGroupThread(groupSet->threads[i].thread_id, new_group);
-        if (ret != 0)
+        return;
+    }
+    for (g = 0; g < numGroupPrograms; g++)
+    {
+        for (t = 0; t < groupSet->numberOfThreads; t++)
         {
-            return ret;
+            HPMfreeProgram(&groupPrograms[g][t].prog);
+            free(groupPrograms[g][t].config);
+            free(groupPrograms[g][t].init);
         }
+        free(groupPrograms[g]);
     }
-    return 0;
+    free(groupPrograms);
+    groupPrograms = NULL;
+    numGroupPrograms = 0;
 }
 
-int
-perfmon_getNumberOfGroups(void)
+static GroupProgram*
+__perfmon_getProgram(int groupId, int thread_id)
 {
-    if (perfmon_initialized != 1)
+    if (groupId >= numGroupPrograms)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        int g = 0;
+        GroupProgram** tmp = realloc(groupPrograms, groupSet->numberOfGroups * sizeof(GroupProgram*));
+        if (!tmp)
+        {
+            return NULL;
+        }
+        groupPrograms = tmp;
+        for (g = numGroupPrograms; g < groupSet->numberOfGroups; g++)
+        {
+            groupPrograms[g] = calloc(groupSet->numberOfThreads, sizeof(GroupProgram));
+            if (!groupPrograms[g])
+            {
+                numGroupPrograms = g;
+                return NULL;
+            }
+        }
+        numGroupPrograms = groupSet->numberOfGroups;
     }
-    return groupSet->numberOfActiveGroups;
+    return &groupPrograms[groupId][thread_id];
 }
 
-int
-perfmon_getIdOfActiveGroup(void)
+/* Mark the writes to event selection and filter registers. Rewriting them
+ * with the value they already hold has no effect, so they can be skipped.
+ * Control, status and counter registers are always replayed. */
+static void
+__perfmon_classifyProgram(HPMProgram* prog)
 {
-    if (perfmon_initialized != 1)
+    int i = 0, j = 0;
+    for (i = 0; i < prog->numWrites; i++)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        HPMRegWrite* w = &prog->writes[i];
+        for (j = 0; j < perfmon_numCounters && !w->config; j++)
+        {
+            if (counter_map[j].device == w->dev &&
+                counter_map[j].configRegister == w->reg)
+            {
+                w->config = 1;
+            }
+            else if (box_map && box_map[counter_map[j].type].device == w->dev &&
+                     ((box_map[counter_map[j].type].filterRegister1 != 0 &&
+                       box_map[counter_map[j].type].filterRegister1 == w->reg) ||
+                      (box_map[counter_map[j].type].filterRegister2 != 0 &&
+                       box_map[counter_map[j].type].filterRegister2 == w->reg)))
+            {
+                w->config = 1;
+            }
+        }
     }
-    return groupSet->activeGroup;
 }
 
-int
-perfmon_getNumberOfThreads(void)
+/* Run the architecture setup of a group for one thread and record the
+ * register writes it issues. The currentConfig row is cleared before so the
+ * recorded program contains the complete configuration. */
+static int
+__perfmon_compileProgram(int groupId, int thread)
 {
-    if (perfmon_initialized != 1)
+    int ret = 0, i = 0;
+    int cpu_id = groupSet->threads[thread].processorId;
+    PerfmonEventSet* eventSet = &groupSet->groups[groupId];
+    GroupProgram* gp = __perfmon_getProgram(groupId, thread);
+    if (!gp)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        return -ENOMEM;
     }
-    return groupSet->numberOfThreads;
-}
-
-int
-perfmon_getNumberOfEvents(int groupId)
-{
-    if (perfmon_initialized != 1)
+    gp->valid = 0;
+    memset(currentConfig[cpu_id], 0, NUM_PMC * sizeof(uint64_t));
+    if (HPMrecordProgram(cpu_id, &gp->prog) < 0)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        return __perfmon_setupCountersThread(groupSet->threads[thread].thread_id, groupId);
     }
-    if (groupId < 0)
+    ret = __perfmon_setupCountersThread(groupSet->threads[thread].thread_id, groupId);
+    HPMrecordProgram(cpu_id, NULL);
+    if (ret < 0)
     {
-        groupId = groupSet->activeGroup;
+        return ret;
     }
-    return groupSet->groups[groupId].numberOfEvents;
-}
-
-double
-perfmon_getTimeOfGroup(int groupId)
-{
-    if (perfmon_initialized != 1)
+    if (!gp->config)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        gp->config = malloc(NUM_PMC * sizeof(uint64_t));
     }
-    if (groupId < 0)
+    if (!gp->init)
     {
-        groupId = groupSet->activeGroup;
+        gp->init = malloc(eventSet->numberOfEvents * sizeof(int));
     }
-    return groupSet->groups[groupId].runTime;
-}
-
-double
-perfmon_getLastTimeOfGroup(int groupId)
-{
-    if (perfmon_initialized != 1)
+    if (!gp->config || !gp->init)
     {
-        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
-        return -EINVAL;
+        return 0;
     }
-    if (groupId < 0)
+    memcpy(gp->config, currentConfig[cpu_id], NUM_PMC * sizeof(uint64_t));
+    for (i = 0; i < eventSet->numberOfEvents; i++)
     {
-        groupId = groupSet->activeGroup;
+        gp->init[i] = eventSet->events[i].threadCounter[thread].init;
     }
-    return groupSet->groups[groupId].rdtscTime;
+    __perfmon_classifyProgram(&gp->prog);
+    gp->valid = 1;
+    DEBUG_PRINT(DEBUGLEV_DEVELOP, Recorded register program for group %d on CPU %d with %d writes,
+                groupId, cpu_id, gp->prog.numWrites);
+    return 0;
 }
 
-uint64_t
+static int
+__perfmon_programsReady(int groupId)
+{
+    int t = 0;
+    if (groupId >= numGroupPrograms)
+    {
+        return 0;
+    }
+    for (t = 0; t < groupSet->numberOfThreads; t++)
+    {
+        if (!groupPrograms[groupId][t].valid)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+typedef struct {
+    int thread;
+    int oldGroup;
+    int newGroup;
+    int stop;
+    int skip;
+    int ret;
+} SwitchTask;
+
+/* Stop the old group, replay the program of the new group and start it on
+ * one hardware thread. All tasks run in the calling thread, helper threads
+ * would get an own access daemon connection per switch in daemon mode. */
+static void
+__perfmon_switchThreadTask(SwitchTask* task)
+{
+    int i = 0;
+    int thread_id = groupSet->threads[task->thread].thread_id;
+    int cpu_id = groupSet->threads[task->thread].processorId;
+    PerfmonEventSet* eventSet = &groupSet->groups[task->newGroup];
+    GroupProgram* gp = &groupPrograms[task->newGroup][task->thread];
+
+    if (task->stop)
+    {
+        task->ret = perfmon_stopCountersThread(thread_id, &groupSet->groups[task->oldGroup]);
+        if (task->ret)
+        {
+            task->ret = -thread_id-1;
+            return;
+        }
+    }
+    task->ret = HPMapplyProgram(cpu_id, &gp->prog, task->skip);
+    if (task->ret < 0)
+    {
+        return;
+    }
+    memcpy(currentConfig[cpu_id], gp->config, NUM_PMC * sizeof(uint64_t));
+    for (i = 0; i < eventSet->numberOfEvents; i++)
+    {
+        eventSet->events[i].threadCounter[task->thread].init = gp->init[i];
+        eventSet->events[i].threadCounter[task->thread].overflows = 0;
+    }
+    task->ret = perfmon_startCountersThread(thread_id, eventSet);
+    if (task->ret)
+    {
+        task->ret = -thread_id-1;
+    }
+}
+
+static int
+__perfmon_switchWithPrograms(int new_group)
+{
+    int i = 0;
+    int ret = 0;
+    int oldGroup = groupSet->activeGroup;
+    int nthreads = groupSet->numberOfThreads;
+    int stop = (groupSet->groups[oldGroup].state == STATE_START);
+    int skip = (getenv("LIKWID_FORCE_SETUP") == NULL);
+    SwitchTask task;
+
+    if (stop)
+    {
+        timer_stop(&groupSet->groups[oldGroup].timer);
+    }
+    task.oldGroup = oldGroup;
+    task.newGroup = new_group;
+    task.stop = stop;
+    task.skip = skip;
+    for (i = 0; i < nthreads; i++)
+    {
+        task.thread = i;
+        task.ret = 0;
+        __perfmon_switchThreadTask(&task);
+        if (task.ret < 0)
+        {
+            ret = task.ret;
+            break;
+        }
+    }
+    if (stop)
+    {
+        __perfmon_finishStopCounters(oldGroup);
+    }
+    if (ret < 0)
+    {
+        return ret;
+    }
+    groupSet->activeGroup = new_group;
+    groupSet->groups[new_group].state = STATE_START;
+    timer_start(&groupSet->groups[new_group].timer);
+    return 0;
+}
+
+int
+perfmon_switchActiveGroup(int new_group)
+{
+    int i = 0;
+    int ret = 0;
+    int oldGroup = 0;
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (unlikely(groupSet == NULL))
+    {
+        return -EINVAL;
+    }
+    if (new_group < 0 || new_group >= groupSet->numberOfGroups)
+    {
+        return -EINVAL;
+    }
+    oldGroup = groupSet->activeGroup;
+    if (new_group == oldGroup)
+    {
+        return 0;
+    }
+#ifndef LIKWID_USE_PERFEVENT
+    if (oldGroup >= 0 && lock_check())
+    {
+        if (__perfmon_programsReady(new_group))
+        {
+            return __perfmon_switchWithPrograms(new_group);
+        }
+        /* First switch to this group: stop the old group and run the full
+         * setup once while recording the register program. */
+        if (groupSet->groups[oldGroup].state == STATE_START)
+        {
+            ret = __perfmon_stopCounters(oldGroup);
+            if (ret != 0)
+            {
+                return ret;
+            }
+        }
+        else if (groupSet->groups[oldGroup].state == STATE_SETUP)
+        {
+            for (i = 0; i < groupSet->groups[oldGroup].numberOfEvents; i++)
+            {
+                int t = 0;
+                for (t = 0; t < groupSet->numberOfThreads; t++)
+                    groupSet->groups[oldGroup].events[i].threadCounter[t].init = FALSE;
+            }
+        }
+        for (i = 0; i < groupSet->numberOfThreads; i++)
+        {
+            ret = __perfmon_compileProgram(new_group, i);
+            if (ret != 0)
+            {
+                return ret;
+            }
+        }
+        groupSet->groups[new_group].state = STATE_SETUP;
+        return __perfmon_startCounters(new_group);
+    }
+#endif
+    for(i=0;i<groupSet->numberOfThreads;i++)
+    {
+        ret = __perfmon_switchActiveGroupThread(groupSet->threads[i].thread_id, new_group);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+    return 0;
+}
+
+int
+perfmon_getNumberOfGroups(void)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    return groupSet->numberOfActiveGroups;
+}
+
+int
+perfmon_getIdOfActiveGroup(void)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    return groupSet->activeGroup;
+}
+
+int
+perfmon_getNumberOfThreads(void)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    return groupSet->numberOfThreads;
+}
+
+int
+perfmon_getNumberOfEvents(int groupId)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    return groupSet->groups[groupId].numberOfEvents;
+}
+
+double
+perfmon_getTimeOfGroup(int groupId)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    return groupSet->groups[groupId].runTime;
+}
+
+double
+perfmon_getLastTimeOfGroup(int groupId)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    return groupSet->groups[groupId].rdtscTime;
+}
+
+int
+perfmon_setGroupWeight(int groupId, double weight)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (unlikely(groupSet == NULL))
+    {
+        return -EINVAL;
+    }
+    if ((groupId < 0) || (groupId >= groupSet->numberOfActiveGroups) || (weight <= 0))
+    {
+        return -EINVAL;
+    }
+    groupSet->groups[groupId].weight = weight;
+    return 0;
+}
+
+int
+perfmon_getNextGroup(void)
+{
+    int i = 0;
+    int next = -1;
+    int weighted = 0;
+    int active = 0;
+    int n = 0;
+    double share = 0, minshare = 0;
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (unlikely(groupSet == NULL) || groupSet->numberOfActiveGroups == 0)
+    {
+        return -EINVAL;
+    }
+    n = groupSet->numberOfActiveGroups;
+    active = (groupSet->activeGroup >= 0 ? groupSet->activeGroup : 0);
+    if (n == 1)
+    {
+        return 0;
+    }
+    for (i = 1; i < n; i++)
+    {
+        if (groupSet->groups[i].weight != groupSet->groups[0].weight)
+        {
+            weighted = 1;
+            break;
+        }
+    }
+    if (!weighted)
+    {
+        return (active + 1) % n;
+    }
+    /* Weighted: pick the group that received the smallest share of the
+     * measurement time relative to its weight. Candidates are checked in
+     * round-robin order starting after the active group, so ties rotate. */
+    for (i = 1; i <= n; i++)
+    {
+        int g = (active + i) % n;
+        if (g == active)
+        {
+            continue;
+        }
+        share = groupSet->groups[g].runTime / groupSet->groups[g].weight;
+        if (next < 0 || share < minshare)
+        {
+            next = g;
+            minshare = share;
+        }
+    }
+    share = groupSet->groups[active].runTime / groupSet->groups[active].weight;
+    if (share < minshare)
+    {
+        next = active;
+    }
+    return next;
+}
+
+int
+perfmon_getNumberOfSlices(int groupId)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (unlikely(groupSet == NULL))
+    {
+        return -EINVAL;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    if (groupId < 0 || groupId >= groupSet->numberOfActiveGroups)
+    {
+        return -EINVAL;
+    }
+    return groupSet->groups[groupId].numSlices;
+}
+
+static PerfmonSliceStats*
+__perfmon_getSliceStats(int groupId, int eventId, int threadId)
+{
+    if (unlikely(groupSet == NULL) || perfmon_initialized != 1)
+    {
+        return NULL;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    if (groupId < 0 || groupId >= groupSet->numberOfActiveGroups)
+    {
+        return NULL;
+    }
+    if (eventId < 0 || eventId >= groupSet->groups[groupId].numberOfEvents ||
+        threadId < 0 || threadId >= groupSet->numberOfThreads)
+    {
+        return NULL;
+    }
+    if (groupSet->groups[groupId].events[eventId].type == NOTYPE ||
+        !groupSet->groups[groupId].events[eventId].sliceStats)
+    {
+        return NULL;
+    }
+    return &groupSet->groups[groupId].events[eventId].sliceStats[threadId];
+}
+
+static double
+__perfmon_getTotalTime(void)
+{
+    int i = 0;
+    double total = 0;
+    for (i = 0; i < groupSet->numberOfActiveGroups; i++)
+    {
+        total += groupSet->groups[i].runTime;
+    }
+    return total;
+}
+
+double
+perfmon_getEnabledTime(int groupId, int eventId, int threadId)
+{
+    PerfmonSliceStats* s = __perfmon_getSliceStats(groupId, eventId, threadId);
+    if (!s)
+    {
+        return NAN;
+    }
+    return s->time;
+}
+
+double
+perfmon_getScaledResult(int groupId, int eventId, int threadId)
+{
+    PerfmonSliceStats* s = __perfmon_getSliceStats(groupId, eventId, threadId);
+    if (!s)
+    {
+        return NAN;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    if (s->time <= 0 || perfmon_isGaugeType(groupSet->groups[groupId].events[eventId].type))
+    {
+        return perfmon_getResult(groupId, eventId, threadId);
+    }
+    return (s->count / s->time) * __perfmon_getTotalTime();
+}
+
+double
+perfmon_getScaledResultError(int groupId, int eventId, int threadId)
+{
+    double rate = 0, var = 0;
+    PerfmonSliceStats* s = __perfmon_getSliceStats(groupId, eventId, threadId);
+    if (!s || s->slices < 2 || s->time <= 0)
+    {
+        return NAN;
+    }
+    if (groupId < 0)
+    {
+        groupId = groupSet->activeGroup;
+    }
+    if (perfmon_isGaugeType(groupSet->groups[groupId].events[eventId].type))
+    {
+        return NAN;
+    }
+    /* Time weighted variance of the per-slice rates, the error is the
+     * standard error of the mean rate extrapolated to the total time. */
+    rate = s->count / s->time;
+    var = (s->rate2 / s->time) - (rate * rate);
+    if (var < 0)
+    {
+        var = 0;
+    }
+    return sqrt(var / (s->slices - 1)) * __perfmon_getTotalTime();
+}
+
+static int
+__perfmon_affinityDomainOf(AffinityDomains_t doms, char prefix, int cpu)
+{
+    int idx = 0;
+    for (int i = 0; i < doms->numberOfAffinityDomains; i++)
+    {
+        AffinityDomain* d = &doms->domains[i];
+        if (bchar(d->tag, 0) != prefix)
+        {
+            continue;
+        }
+        for (int j = 0; j < d->numberOfProcessors; j++)
+        {
+            if (d->processorList[j] == cpu)
+            {
+                return idx;
+            }
+        }
+        idx++;
+    }
+    return -1;
+}
+
+static char*
+__perfmon_affinityDomainName(AffinityDomains_t doms, char prefix, int idx)
+{
+    for (int i = 0; i < doms->numberOfAffinityDomains; i++)
+    {
+        if (bchar(doms->domains[i].tag, 0) == prefix)
+        {
+            if (idx == 0)
+            {
+                return strdup(bdata(doms->domains[i].tag));
+            }
+            idx--;
+        }
+    }
+    return NULL;
+}
+
+/* Assigns each thread of the group set to a domain of the given level. The
+ * domains are numbered densely in topology order, only domains with measured
+ * threads are kept. */
+static int
+__perfmon_mapDomains(PerfmonDomainLevel level, PerfmonReduction* r)
+{
+    int numThreads = groupSet->numberOfThreads;
+    int* raw = malloc(numThreads * sizeof(int));
+    int maxRaw = 0;
+    int* compact = NULL;
+    char prefix = 0;
+    AffinityDomains_t doms = NULL;
+    if (!raw)
+    {
+        return -ENOMEM;
+    }
+    switch (level)
+    {
+        case PERFMON_LEVEL_LLC:
+            prefix = 'C';
+            break;
+        case PERFMON_LEVEL_NUMA:
+            prefix = 'M';
+            break;
+        case PERFMON_LEVEL_SOCKET:
+            prefix = 'S';
+            break;
+        default:
+            break;
+    }
+    if (prefix)
+    {
+        affinity_init();
+        doms = get_affinityDomains();
+        if (!doms)
+        {
+            free(raw);
+            return -EFAULT;
+        }
+    }
+    for (int t = 0; t < numThreads; t++)
+    {
+        int cpu = groupSet->threads[t].processorId;
+        switch (level)
+        {
+            case PERFMON_LEVEL_HWTHREAD:
+                raw[t] = t;
+                break;
+            case PERFMON_LEVEL_CORE:
+                raw[t] = -1;
+                for (int i = 0; i < t; i++)
+                {
+                    int o = groupSet->threads[i].processorId;
+                    if (cpuid_topology.threadPool[o].packageId == cpuid_topology.threadPool[cpu].packageId &&
+                        cpuid_topology.threadPool[o].coreId == cpuid_topology.threadPool[cpu].coreId)
+                    {
+                        raw[t] = raw[i];
+                        break;
+                    }
+                }
+                if (raw[t] < 0)
+                {
+                    raw[t] = maxRaw;
+                }
+                break;
+            case PERFMON_LEVEL_NODE:
+                raw[t] = 0;
+                break;
+            default:
+                raw[t] = __perfmon_affinityDomainOf(doms, prefix, cpu);
+                break;
+        }
+        if (raw[t] >= maxRaw)
+        {
+            maxRaw = raw[t] + 1;
+        }
+    }
+    compact = malloc(maxRaw * sizeof(int));
+    if (!compact)
+    {
+        free(raw);
+        return -ENOMEM;
+    }
+    for (int i = 0; i < maxRaw; i++)
+    {
+        compact[i] = -1;
+    }
+    for (int t = 0; t < numThreads; t++)
+    {
+        if (raw[t] >= 0)
+        {
+            compact[raw[t]] = 0;
+        }
+    }
+    r->numDomains = 0;
+    for (int i = 0; i < maxRaw; i++)
+    {
+        if (compact[i] == 0)
+        {
+            compact[i] = r->numDomains++;
+        }
+    }
+    r->domainNames = calloc(r->numDomains, sizeof(char*));
+    r->numThreads = calloc(r->numDomains, sizeof(int));
+    r->threadDomain = malloc(numThreads * sizeof(int));
+    if (!r->domainNames || !r->numThreads || !r->threadDomain)
+    {
+        free(raw);
+        free(compact);
+        return -ENOMEM;
+    }
+    r->numThreadsTotal = numThreads;
+    for (int t = 0; t < numThreads; t++)
+    {
+        int cpu = groupSet->threads[t].processorId;
+        int d = (raw[t] >= 0 ? compact[raw[t]] : -1);
+        r->threadDomain[t] = d;
+        if (d < 0)
+        {
+            continue;
+        }
+        r->numThreads[d]++;
+        if (r->domainNames[d])
+        {
+            continue;
+        }
+        char name[64];
+        switch (level)
+        {
+            case PERFMON_LEVEL_HWTHREAD:
+                snprintf(name, sizeof(name), "HWThread %d", cpu);
+                r->domainNames[d] = strdup(name);
+                break;
+            case PERFMON_LEVEL_CORE:
+                snprintf(name, sizeof(name), "Core %d:%d",
+                         cpuid_topology.threadPool[cpu].packageId,
+                         cpuid_topology.threadPool[cpu].coreId);
+                r->domainNames[d] = strdup(name);
+                break;
+            case PERFMON_LEVEL_NODE:
+                r->domainNames[d] = strdup("N");
+                break;
+            default:
+                r->domainNames[d] = __perfmon_affinityDomainName(doms, prefix, raw[t]);
+                break;
+        }
+    }
+    free(raw);
+    free(compact);
+    return 0;
+}
+
+void
+perfmon_freeReduction(PerfmonReduction* reduction)
+{
+    if (!reduction)
+    {
+        return;
+    }
+    if (reduction->domainNames)
+    {
+        for (int i = 0; i < reduction->numDomains; i++)
+        {
+            free(reduction->domainNames[i]);
+        }
+        free(reduction->domainNames);
+    }
+    free(reduction->numThreads);
+    free(reduction->threadDomain);
+    free(reduction->stats);
+    free(reduction->values);
+    free(reduction);
+}
+
+/* Uncore counters are only read by the thread holding the socket (or die)
+ * lock, the other threads of the socket report zero. */
+static int
+__perfmon_isSocketOwner(int threadId)
+{
+    int cpu = groupSet->threads[threadId].processorId;
+    int sock_cpu = socket_lock[affinity_thread2socket_lookup[cpu]];
+    if (cpuid_info.isIntel && cpuid_info.model == SKYLAKEX && cpuid_topology.numDies != cpuid_topology.numSockets)
+    {
+        sock_cpu = die_lock[affinity_thread2die_lookup[cpu]];
+    }
+    return (cpu == sock_cpu);
+}
+
+static int
+__perfmon_formulaUsesCounter(const char* formula, const char* counter)
+{
+    size_t len = strlen(counter);
+    const char* ptr = formula;
+    while ((ptr = strstr(ptr, counter)) != NULL)
+    {
+        if ((ptr == formula || !(isalnum(ptr[-1]) || ptr[-1] == '_')) &&
+            !(isalnum(ptr[len]) || ptr[len] == '_'))
+        {
+            return 1;
+        }
+        ptr += len;
+    }
+    return 0;
+}
+
+/* A value is socket scope if it is an uncore counter or a metric using one */
+static int
+__perfmon_isSocketValue(int groupId, PerfmonReduceSource source, int valueId)
+{
+    PerfmonEventSet* eventSet = &groupSet->groups[groupId];
+    if (source == PERFMON_REDUCE_RESULT || source == PERFMON_REDUCE_LASTRESULT)
+    {
+        return (eventSet->events[valueId].type != NOTYPE &&
+                perfmon_isUncoreCounter(eventSet->group.counters[valueId]));
+    }
+    for (int e = 0; e < eventSet->numberOfEvents; e++)
+    {
+        if (eventSet->events[e].type != NOTYPE &&
+            perfmon_isUncoreCounter(eventSet->group.counters[e]) &&
+            __perfmon_formulaUsesCounter(eventSet->group.metricformulas[valueId], eventSet->group.counters[e]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int
+perfmon_reduce(int groupId, PerfmonReduceSource source, PerfmonDomainLevel level, PerfmonReduction** reduction)
+{
+    int err = 0;
+    PerfmonReduction* r = NULL;
+    if (!reduction || level < 0 || level >= NUM_PERFMON_LEVELS ||
+        source < 0 || source >= NUM_PERFMON_REDUCE_SOURCES)
+    {
+        return -EINVAL;
+    }
+    if (unlikely(groupSet == NULL) || perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if ((groupId < 0) && (groupSet->activeGroup >= 0))
+    {
+        groupId = groupSet->activeGroup;
+    }
+    if (groupId < 0 || groupId >= groupSet->numberOfGroups)
+    {
+        return -EINVAL;
+    }
+    r = calloc(1, sizeof(PerfmonReduction));
+    if (!r)
+    {
+        return -ENOMEM;
+    }
+    r->level = level;
+    if (source == PERFMON_REDUCE_METRIC || source == PERFMON_REDUCE_LASTMETRIC)
+    {
+        r->numValues = perfmon_getNumberOfMetrics(groupId);
+    }
+    else
+    {
+        r->numValues = groupSet->groups[groupId].numberOfEvents;
+    }
+    err = __perfmon_mapDomains(level, r);
+    if (err < 0)
+    {
+        perfmon_freeReduction(r);
+        return err;
+    }
+    r->stats = malloc(r->numDomains * r->numValues * NUM_PERFMON_STATS * sizeof(double));
+    r->values = malloc(r->numThreadsTotal * r->numValues * sizeof(double));
+    int* counts = calloc(r->numDomains * r->numValues, sizeof(int));
+    int* socketValue = calloc(r->numValues, sizeof(int));
+    if (!r->stats || !r->values || !counts || !socketValue)
+    {
+        free(counts);
+        free(socketValue);
+        perfmon_freeReduction(r);
+        return -ENOMEM;
+    }
+    /* Above the hardware thread level, socket scope values are only taken
+     * from the threads that measured them. Otherwise the zeros of the other
+     * threads would distort minimum and average. */
+    if (level != PERFMON_LEVEL_HWTHREAD)
+    {
+        for (int v = 0; v < r->numValues; v++)
+        {
+            socketValue[v] = __perfmon_isSocketValue(groupId, source, v);
+        }
+    }
+    for (int i = 0; i < r->numDomains * r->numValues; i++)
+    {
+        double* st = &r->stats[i * NUM_PERFMON_STATS];
+        st[PERFMON_STAT_SUM] = 0;
+        st[PERFMON_STAT_MIN] = DBL_MAX;
+        st[PERFMON_STAT_MAX] = -DBL_MAX;
+        st[PERFMON_STAT_AVG] = NAN;
+    }
+    for (int i = 0; i < r->numThreadsTotal * r->numValues; i++)
+    {
+        r->values[i] = NAN;
+    }
+    for (int t = 0; t < r->numThreadsTotal; t++)
+    {
+        int d = r->threadDomain[t];
+        int owner = 0;
+        if (d < 0)
+        {
+            continue;
+        }
+        owner = __perfmon_isSocketOwner(t);
+        for (int v = 0; v < r->numValues; v++)
+        {
+            double x = NAN;
+            switch (source)
+            {
+                case PERFMON_REDUCE_RESULT:
+                    x = perfmon_getResult(groupId, v, t);
+                    break;
+                case PERFMON_REDUCE_LASTRESULT:
+                    x = perfmon_getLastResult(groupId, v, t);
+                    break;
+                case PERFMON_REDUCE_METRIC:
+                    x = perfmon_getMetric(groupId, v, t);
+                    break;
+                case PERFMON_REDUCE_LASTMETRIC:
+                    x = perfmon_getLastMetric(groupId, v, t);
+                    break;
+                default:
+                    break;
+            }
+            r->values[t * r->numValues + v] = x;
+            if (isnan(x) || (socketValue[v] && !owner))
+            {
+                continue;
+            }
+            double* st = &r->stats[(d * r->numValues + v) * NUM_PERFMON_STATS];
+            st[PERFMON_STAT_SUM] += x;
+            st[PERFMON_STAT_MIN] = MIN(st[PERFMON_STAT_MIN], x);
+            st[PERFMON_STAT_MAX] = MAX(st[PERFMON_STAT_MAX], x);
+            counts[d * r->numValues + v]++;
+        }
+    }
+    for (int i = 0; i < r->numDomains * r->numValues; i++)
+    {
+        double* st = &r->stats[i * NUM_PERFMON_STATS];
+        if (counts[i] == 0)
+        {
+            st[PERFMON_STAT_SUM] = NAN;
+            st[PERFMON_STAT_MIN] = NAN;
+            st[PERFMON_STAT_MAX] = NAN;
+            continue;
+        }
+        st[PERFMON_STAT_AVG] = st[PERFMON_STAT_SUM] / counts[i];
+    }
+    free(counts);
+    free(socketValue);
+    *reduction = r;
+    return 0;
+}
+
+uint64_t
 perfmon_getMaxCounterValue(RegisterType type)
 {
     int width = 48;
@@ -3725,6 +4927,112 @@ perfmon_getMetricOfRegionThread(int region, int metricId, int threadId)
     return result;
 }
 
+static LikwidHistogram*
+__perfmon_regionHistogram(int region, int thread, int event, int create)
+{
+    LikwidResults* r = &markerResults[region];
+    if (r->histograms == NULL)
+    {
+        if (!create)
+        {
+            return NULL;
+        }
+        r->histograms = calloc(r->threadCount, sizeof(LikwidHistogram*));
+        if (r->histograms == NULL)
+        {
+            return NULL;
+        }
+    }
+    if (r->histograms[thread] == NULL)
+    {
+        if (!create)
+        {
+            return NULL;
+        }
+        r->histograms[thread] = malloc(LIKWID_HIST_MAX * sizeof(LikwidHistogram));
+        if (r->histograms[thread] == NULL)
+        {
+            return NULL;
+        }
+        for (int k = 0; k < LIKWID_HIST_MAX; k++)
+        {
+            histogram_reset(&r->histograms[thread][k], -2);
+        }
+    }
+    /* The histograms of all threads of a region use the same slots */
+    for (int k = 0; k < r->numHistograms; k++)
+    {
+        for (int t = 0; t < r->threadCount; t++)
+        {
+            if (r->histograms[t] != NULL && r->histograms[t][k].event == event)
+            {
+                r->histograms[thread][k].event = event;
+                return &r->histograms[thread][k];
+            }
+        }
+    }
+    if (!create || r->numHistograms >= LIKWID_HIST_MAX)
+    {
+        return NULL;
+    }
+    r->histograms[thread][r->numHistograms].event = event;
+    return &r->histograms[thread][r->numHistograms++];
+}
+
+/* Parses H <regionId> <cpu> <event> <max> <numBuckets> <bucket> <count> ... */
+static void
+__perfmon_readHistogramLine(char* buf, int regions, int* regionCPUs)
+{
+    int regionid = -1, cpu = -1, event = 0, n = 0, off = 0;
+    int thread = -1;
+    double max = 0;
+    char* ptr = NULL;
+    LikwidHistogram* h = NULL;
+    if (sscanf(buf, "H %d %d %d %lf %d%n", &regionid, &cpu, &event, &max, &n, &off) != 5 ||
+        regionid < 0 || regionid >= regions)
+    {
+        fprintf(stderr, "Line %s not a valid histogram line\n", buf);
+        return;
+    }
+    for (int i = 0; i < regionCPUs[regionid]; i++)
+    {
+        if (markerResults[regionid].cpulist[i] == cpu)
+        {
+            thread = i;
+            break;
+        }
+    }
+    if (thread < 0)
+    {
+        return;
+    }
+    h = __perfmon_regionHistogram(regionid, thread, event, 1);
+    if (h == NULL)
+    {
+        return;
+    }
+    if (max > h->max)
+    {
+        h->max = max;
+    }
+    ptr = buf + off;
+    for (int i = 0; i < n; i++)
+    {
+        int bucket = 0, len = 0;
+        unsigned int count = 0;
+        if (sscanf(ptr, " %d %u%n", &bucket, &count, &len) != 2)
+        {
+            break;
+        }
+        ptr += len;
+        if (bucket >= 0 && bucket < LIKWID_HIST_BUCKETS)
+        {
+            h->buckets[bucket] += count;
+            h->count += count;
+        }
+    }
+}
+
 int
 perfmon_readMarkerFile(const char* filename)
 {
@@ -3784,6 +5092,8 @@ perfmon_readMarkerFile(const char* filename)
     {
         regionCPUs[i] = 0;
         markerResults[i].threadCount = cpus;
+        markerResults[i].numHistograms = 0;
+        markerResults[i].histograms = NULL;
         markerResults[i].time = (double*) malloc(cpus * sizeof(double));
         if (!markerResults[i].time)
         {
@@ -3841,7 +5151,11 @@ perfmon_readMarkerFile(const char* filename)
     }
     while (fgets(buf, sizeof(buf), fp))
     {
-        if (strchr(buf,':'))
+        if (buf[0] == 'H')
+        {
+            __perfmon_readHistogramLine(buf, regions, regionCPUs);
+        }
+        else if (strchr(buf,':'))
         {
             int regionid = 0, groupid = -1;
             char regiontag[100];
@@ -3914,6 +5228,98 @@ perfmon_readMarkerFile(const char* filename)
     return nr_regions;
 }
 
+int
+perfmon_getHistogramsOfRegion(int region)
+{
+    if (perfmon_initialized != 1)
+    {
+        ERROR_PLAIN_PRINT(Perfmon module not properly initialized);
+        return -EINVAL;
+    }
+    if (region < 0 || region >= markerRegions || markerResults == NULL)
+    {
+        return -EINVAL;
+    }
+    return markerResults[region].numHistograms;
+}
+
+int
+perfmon_getHistogramEventOfRegion(int region, int hist)
+{
+    if (perfmon_getHistogramsOfRegion(region) <= hist || hist < 0)
+    {
+        return -EINVAL;
+    }
+    for (int t = 0; t < markerResults[region].threadCount; t++)
+    {
+        if (markerResults[region].histograms[t] != NULL)
+        {
+            return markerResults[region].histograms[t][hist].event;
+        }
+    }
+    return -EINVAL;
+}
+
+static LikwidHistogram*
+__perfmon_getRegionHistogram(int region, int hist, int thread, LikwidHistogram* merged)
+{
+    int event = perfmon_getHistogramEventOfRegion(region, hist);
+    if (event < -1)
+    {
+        return NULL;
+    }
+    if (thread < 0)
+    {
+        histogram_reset(merged, event);
+        for (int t = 0; t < markerResults[region].threadCount; t++)
+        {
+            if (markerResults[region].histograms[t] != NULL)
+            {
+                histogram_merge(merged, &markerResults[region].histograms[t][hist]);
+            }
+        }
+        return merged;
+    }
+    if (thread < markerResults[region].threadCount &&
+        markerResults[region].histograms[thread] != NULL)
+    {
+        return &markerResults[region].histograms[thread][hist];
+    }
+    return NULL;
+}
+
+double
+perfmon_getHistogramPercentileOfRegionThread(int region, int hist, int thread, double percentile)
+{
+    LikwidHistogram merged;
+    LikwidHistogram* h = NULL;
+    double value = NAN;
+    if (percentile < 0 || percentile > 100)
+    {
+        return NAN;
+    }
+    h = __perfmon_getRegionHistogram(region, hist, thread, &merged);
+    if (h == NULL)
+    {
+        return NAN;
+    }
+    value = histogram_percentile(h, percentile);
+    /* Region durations are recorded in ns */
+    return (h->event == -1 ? value * 1E-9 : value);
+}
+
+int
+perfmon_getHistogramCountOfRegionThread(int region, int hist, int thread)
+{
+    LikwidHistogram merged;
+    LikwidHistogram* h = __perfmon_getRegionHistogram(region, hist, thread, &merged);
+    if (h == NULL)
+    {
+        return -EINVAL;
+    }
+    return (int)h->count;
+}
+
 void
 perfmon_destroyMarkerResults()
 {
@@ -3928,7 +5334,12 @@ perfmon_destroyMarkerResults()
             for (j = 0; j < markerResults[i].threadCount; j++)
             {
                 free(markerResults[i].counters[j]);
+                if (markerResults[i].histograms)
+                {
+                    free(markerResults[i].histograms[j]);
+                }
             }
+            free(markerResults[i].histograms);
             free(markerResults[i].counters);
             bdestroy(markerResults[i].tag);
         }
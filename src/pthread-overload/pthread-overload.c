@@ -36,11 +36,15 @@
 #include <sched.h>
 #include <bits/pthreadtypes.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <dirent.h>
 #include <unistd.h>
 #include <string.h>
-#include <unistd.h>
+#include <elf.h>
+#include <link.h>
 #include <sys/syscall.h>
 #include <pthread.h>
 
@@ -78,11 +82,475 @@ static char * sosearchpaths[] = {
     } while(0)
 #endif
 
+typedef int (*pthread_create_func)(pthread_t *, const pthread_attr_t *, void* (*start_routine)(void *), void *);
+
+/* Placement policies selected with LIKWID_PIN_POLICY. All policies except
+ * roundrobin track the live threads per hwthread, put new threads on the
+ * least loaded entry of the pin list and free the entry when a thread exits.
+ * scatter and compact reorder the pin list over the sockets (suffix :S) or
+ * NUMA domains (suffix :M) before. */
+typedef enum {
+    PIN_ROUNDROBIN = 0,
+    PIN_LEASTLOADED,
+    PIN_SCATTER,
+    PIN_COMPACT
+} PinPolicy;
+
+typedef struct {
+    void* (*start_routine)(void *);
+    void* arg;
+    int slot; /* -1 until the creating thread published the slot */
+} PinnedStart;
+
+/* Address ranges of the functions with 'monitor' in their name of one
+ * loaded object. Used to detect shepherd threads (e.g. of the Intel OpenMP
+ * runtime) which should not consume a CPU of the pin list. */
+typedef struct SymbolCache {
+    char* fname;
+    uintptr_t base;
+    int nranges;
+    uintptr_t* start;
+    uintptr_t* end;
+    struct SymbolCache* next;
+} SymbolCache;
+
 static int *pin_ids = NULL;
 static int ncpus = 0;
 static uint64_t skipMask = 0x0;
 static int silent = 0;
-static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static long online_cpus = 0;
+static pthread_create_func real_pthread_create = NULL;
+static void* pthread_handle = NULL;
+static pthread_once_t first_call = PTHREAD_ONCE_INIT;
+static int ncalled = 0;
+static uint64_t npinned = 0;
+static SymbolCache* symbolCache = NULL;
+static pthread_mutex_t symbolLock = PTHREAD_MUTEX_INITIALIZER;
+static PinPolicy policy = PIN_ROUNDROBIN;
+static int *slot_order = NULL;
+static int *slot_load = NULL;
+static pthread_mutex_t placementLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t slotKey;
+static int track_threads = 0;
+static FILE* placementLog = NULL;
+
+static pthread_create_func
+get_real_pthread_create(void)
+{
+    pthread_create_func func = real_pthread_create;
+    if (func)
+    {
+        return func;
+    }
+    func = (pthread_create_func)dlsym(RTLD_NEXT, "pthread_create");
+    if (!func)
+    {
+        for (int i = 0; sosearchpaths[i] != NULL; i++)
+        {
+            void* handle = dlopen(sosearchpaths[i], RTLD_LAZY);
+            if (handle)
+            {
+                func = (pthread_create_func)dlsym(handle, "pthread_create");
+                if (func && __sync_bool_compare_and_swap(&pthread_handle, NULL, handle))
+                {
+                    break;
+                }
+                dlclose(handle);
+                if (func)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    if (!func)
+    {
+        color_print("%s\n", dlerror());
+        return NULL;
+    }
+    __sync_bool_compare_and_swap(&real_pthread_create, NULL, func);
+    return real_pthread_create;
+}
+
+/* Read the symbol table of an ELF file once and remember the address ranges
+ * of all 'monitor' functions relative to the load address */
+static SymbolCache*
+read_symbols(const char* fname, uintptr_t base)
+{
+    int fd = -1;
+    struct stat st;
+    unsigned char* map = MAP_FAILED;
+    SymbolCache* cache = malloc(sizeof(SymbolCache));
+    if (!cache)
+    {
+        return NULL;
+    }
+    memset(cache, 0, sizeof(SymbolCache));
+    cache->fname = strdup(fname);
+    cache->base = base;
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(ElfW(Ehdr)))
+    {
+        goto done;
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        goto done;
+    }
+    ElfW(Ehdr)* ehdr = (ElfW(Ehdr)*)map;
+    if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 ||
+        ehdr->e_shoff == 0 ||
+        ehdr->e_shoff + ehdr->e_shnum * sizeof(ElfW(Shdr)) > (size_t)st.st_size)
+    {
+        goto done;
+    }
+    /* Executables which are not position independent use absolute addresses */
+    if (ehdr->e_type == ET_EXEC)
+    {
+        cache->base = 0;
+    }
+    ElfW(Shdr)* shdr = (ElfW(Shdr)*)(map + ehdr->e_shoff);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (shdr[i].sh_type != SHT_SYMTAB && shdr[i].sh_type != SHT_DYNSYM)
+            continue;
+        if (shdr[i].sh_link >= ehdr->e_shnum ||
+            shdr[i].sh_offset + shdr[i].sh_size > (size_t)st.st_size ||
+            shdr[shdr[i].sh_link].sh_offset + shdr[shdr[i].sh_link].sh_size > (size_t)st.st_size)
+            continue;
+        ElfW(Sym)* syms = (ElfW(Sym)*)(map + shdr[i].sh_offset);
+        const char* strtab = (const char*)(map + shdr[shdr[i].sh_link].sh_offset);
+        size_t strsize = shdr[shdr[i].sh_link].sh_size;
+        size_t nsyms = shdr[i].sh_size / sizeof(ElfW(Sym));
+        for (size_t j = 0; j < nsyms; j++)
+        {
+            if (ELF64_ST_TYPE(syms[j].st_info) != STT_FUNC || syms[j].st_value == 0 ||
+                syms[j].st_name >= strsize)
+                continue;
+            if (strnlen(&strtab[syms[j].st_name], strsize - syms[j].st_name) == strsize - syms[j].st_name)
+                continue;
+            if (strstr(&strtab[syms[j].st_name], "monitor") == NULL)
+                continue;
+            uintptr_t* tmpstart = realloc(cache->start, (cache->nranges+1) * sizeof(uintptr_t));
+            if (!tmpstart)
+                goto done;
+            cache->start = tmpstart;
+            uintptr_t* tmpend = realloc(cache->end, (cache->nranges+1) * sizeof(uintptr_t));
+            if (!tmpend)
+                goto done;
+            cache->end = tmpend;
+            cache->start[cache->nranges] = syms[j].st_value;
+            cache->end[cache->nranges] = syms[j].st_value + (syms[j].st_size > 0 ? syms[j].st_size : 1);
+            cache->nranges++;
+        }
+    }
+done:
+    if (map != MAP_FAILED)
+    {
+        munmap(map, st.st_size);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    return cache;
+}
+
+static int
+is_shepherd(void* (*start_routine)(void *))
+{
+    Dl_info info;
+    SymbolCache* cache = NULL;
+    int shepherd = 0;
+    if (dladdr(start_routine, &info) == 0 || info.dli_fname == NULL)
+    {
+        return 0;
+    }
+    /* dladdr returns the nearest exported symbol, which is only the start
+     * routine itself if the address matches exactly. Static functions are
+     * looked up in the symbol table of the object. */
+    if (info.dli_sname != NULL && info.dli_saddr == (void*)start_routine)
+    {
+        return (strstr(info.dli_sname, "monitor") != NULL);
+    }
+    pthread_mutex_lock(&symbolLock);
+    for (cache = symbolCache; cache != NULL; cache = cache->next)
+    {
+        if (strcmp(cache->fname, info.dli_fname) == 0)
+            break;
+    }
+    if (!cache)
+    {
+        cache = read_symbols(info.dli_fname, (uintptr_t)info.dli_fbase);
+        if (cache)
+        {
+            cache->next = symbolCache;
+            symbolCache = cache;
+        }
+        else
+        {
+            fprintf(stderr, "Problems reading symbols for shepard thread detection\n");
+        }
+    }
+    if (cache)
+    {
+        uintptr_t addr = (uintptr_t)start_routine - cache->base;
+        for (int i = 0; i < cache->nranges; i++)
+        {
+            if (addr >= cache->start[i] && addr < cache->end[i])
+            {
+                shepherd = 1;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&symbolLock);
+    return shepherd;
+}
+
+static int
+get_cpu_domain(int cpu, char type)
+{
+    char path[256];
+    int domain = 0;
+    if (type == 'M')
+    {
+        DIR* dp = NULL;
+        struct dirent* ep = NULL;
+        snprintf(path, 255, "/sys/devices/system/cpu/cpu%d", cpu);
+        dp = opendir(path);
+        if (!dp)
+        {
+            return 0;
+        }
+        while ((ep = readdir(dp)))
+        {
+            if (strncmp(ep->d_name, "node", 4) == 0 && ep->d_name[4] >= '0' && ep->d_name[4] <= '9')
+            {
+                domain = atoi(&ep->d_name[4]);
+                break;
+            }
+        }
+        closedir(dp);
+    }
+    else
+    {
+        FILE* fp = NULL;
+        snprintf(path, 255, "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        fp = fopen(path, "r");
+        if (fp)
+        {
+            if (fscanf(fp, "%d", &domain) != 1)
+            {
+                domain = 0;
+            }
+            fclose(fp);
+        }
+    }
+    return domain;
+}
+
+/* Order the pin list entries by domain. compact keeps the entries of a
+ * domain together, scatter takes one entry of each domain in turn. */
+static void
+order_slots(PinPolicy pol, char domtype)
+{
+    int* domains = malloc(ncpus * sizeof(int));
+    int* used = malloc(ncpus * sizeof(int));
+    int n = 0;
+    if (!domains || !used)
+    {
+        free(domains);
+        free(used);
+        return;
+    }
+    for (int i = 0; i < ncpus; i++)
+    {
+        domains[i] = get_cpu_domain(pin_ids[i], domtype);
+        used[i] = 0;
+    }
+    if (pol == PIN_COMPACT)
+    {
+        for (int i = 0; i < ncpus; i++)
+        {
+            if (used[i])
+                continue;
+            for (int j = i; j < ncpus; j++)
+            {
+                if (!used[j] && domains[j] == domains[i])
+                {
+                    slot_order[n++] = j;
+                    used[j] = 1;
+                }
+            }
+        }
+    }
+    else
+    {
+        while (n < ncpus)
+        {
+            int* taken = calloc(ncpus, sizeof(int));
+            for (int i = 0; i < ncpus; i++)
+            {
+                int dup = 0;
+                if (used[i])
+                    continue;
+                for (int j = 0; j < i && taken; j++)
+                {
+                    if (taken[j] && domains[j] == domains[i])
+                    {
+                        dup = 1;
+                        break;
+                    }
+                }
+                if (!dup)
+                {
+                    slot_order[n++] = i;
+                    used[i] = 1;
+                    if (taken)
+                        taken[i] = 1;
+                }
+            }
+            free(taken);
+        }
+    }
+    free(domains);
+    free(used);
+}
+
+static void
+placement_log(const char* event, pthread_t thread, int cpu)
+{
+    if (placementLog)
+    {
+        pthread_mutex_lock(&placementLock);
+        fprintf(placementLog, "%s,%lu,%d\n", event, (unsigned long)thread, cpu);
+        fflush(placementLog);
+        pthread_mutex_unlock(&placementLock);
+    }
+}
+
+static void
+release_slot(void* value)
+{
+    int slot = (int)(uintptr_t)value - 1;
+    if (slot < 0 || slot >= ncpus)
+    {
+        return;
+    }
+    if (policy != PIN_ROUNDROBIN)
+    {
+        pthread_mutex_lock(&placementLock);
+        slot_load[slot]--;
+        pthread_mutex_unlock(&placementLock);
+    }
+    placement_log("exit", pthread_self(), pin_ids[slot]);
+}
+
+static void*
+pinned_start(void* arg)
+{
+    PinnedStart* p = (PinnedStart*)arg;
+    /* The slot is taken only after the real pthread_create succeeded */
+    while (__atomic_load_n(&p->slot, __ATOMIC_ACQUIRE) < 0)
+    {
+        sched_yield();
+    }
+    PinnedStart start = *p;
+    free(arg);
+    pthread_setspecific(slotKey, (void*)(uintptr_t)(start.slot + 1));
+    return start.start_routine(start.arg);
+}
+
+static int
+acquire_slot(int* wrapped)
+{
+    int slot = 0;
+    *wrapped = 0;
+    if (policy == PIN_ROUNDROBIN)
+    {
+        uint64_t n = __sync_fetch_and_add(&npinned, 1);
+        *wrapped = (n == (uint64_t)(ncpus-1));
+        return (int)(n % ncpus);
+    }
+    pthread_mutex_lock(&placementLock);
+    slot = slot_order[0];
+    for (int i = 1; i < ncpus; i++)
+    {
+        if (slot_load[slot_order[i]] < slot_load[slot])
+        {
+            slot = slot_order[i];
+        }
+    }
+    slot_load[slot]++;
+    pthread_mutex_unlock(&placementLock);
+    return slot;
+}
+
+static void
+init_policy(void)
+{
+    char* str = getenv("LIKWID_PIN_POLICY");
+    char domtype = 'S';
+    if (str != NULL && ncpus > 0)
+    {
+        char* colon = strchr(str, ':');
+        if (colon && (colon[1] == 'M' || colon[1] == 'S'))
+        {
+            domtype = colon[1];
+        }
+        if (strncmp(str, "leastloaded", 11) == 0)
+            policy = PIN_LEASTLOADED;
+        else if (strncmp(str, "scatter", 7) == 0)
+            policy = PIN_SCATTER;
+        else if (strncmp(str, "compact", 7) == 0)
+            policy = PIN_COMPACT;
+        else if (strncmp(str, "roundrobin", 10) != 0)
+            fprintf(stderr, "[pthread wrapper] Unknown pin policy %s, using roundrobin\n", str);
+    }
+    if (policy != PIN_ROUNDROBIN)
+    {
+        slot_order = malloc(ncpus * sizeof(int));
+        slot_load = malloc(ncpus * sizeof(int));
+        if (!slot_order || !slot_load)
+        {
+            free(slot_order);
+            free(slot_load);
+            slot_order = NULL;
+            slot_load = NULL;
+            policy = PIN_ROUNDROBIN;
+        }
+        else
+        {
+            for (int i = 0; i < ncpus; i++)
+            {
+                slot_order[i] = i;
+                slot_load[i] = 0;
+            }
+            /* The main thread runs on the last entry */
+            slot_load[ncpus-1] = 1;
+            if (policy == PIN_SCATTER || policy == PIN_COMPACT)
+            {
+                order_slots(policy, domtype);
+            }
+        }
+    }
+    str = getenv("LIKWID_PIN_LOG");
+    if (str != NULL && strlen(str) > 0)
+    {
+        placementLog = fopen(str, "w");
+        if (!placementLog)
+        {
+            fprintf(stderr, "[pthread wrapper] Cannot open placement log %s\n", str);
+        }
+    }
+    if ((policy != PIN_ROUNDROBIN || placementLog) && pthread_key_create(&slotKey, release_slot) == 0)
+    {
+        track_threads = 1;
+    }
+}
 
 void __attribute__((constructor (103))) init_pthread_overload(void)
 {
@@ -92,6 +560,8 @@ void __attribute__((constructor (103))) init_pthread_overload(void)
     int i = 0, ret = 0;
     static long avail_cpus = 0;
     avail_cpus = sysconf(_SC_NPROCESSORS_CONF);
+    online_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    get_real_pthread_create();
     pin_ids = malloc(avail_cpus * sizeof(int));
     memset(pin_ids, 0, avail_cpus * sizeof(int));
     str = getenv("LIKWID_PIN");
@@ -135,209 +605,185 @@ void __attribute__((constructor (103))) init_pthread_overload(void)
     {
         silent = 1;
     }
+    init_policy();
 }
 
-int __attribute__ ((visibility ("default") ))
-pthread_create(pthread_t* thread,
-        const pthread_attr_t* attr,
-        void* (*start_routine)(void *),
-        void * arg)
+/* On first call: pin the main thread and print the pin list */
+static void
+pthread_overload_first_call(void)
 {
-    void *handle;
-    char *error;
-    int (*rptc) (pthread_t *, const pthread_attr_t *, void* (*start_routine)(void *), void *);
-    int ret;
-    static int reallpthrindex = 0;
-    static int npinned = 0;
-    static int ncalled = 0;
-    static int overflow = 0;
-    static int overflowed = 0;
-    static long online_cpus = 0;
-    static int shepard = 0;
-    online_cpus = sysconf(_SC_NPROCESSORS_ONLN);
-    pthread_mutex_lock(&mutex);
+    if (pin_ids == NULL)
+    {
+        return;
+    }
+    if (!silent)
+    {
+        color_print("[pthread wrapper] \n");
+    }
 
-    /* On first entry: Get Evironment Variable and initialize pin_ids */
-    if (ncalled == 0 && pin_ids != NULL)
+    if (getenv("LIKWID_PIN") != NULL && ncpus > 0)
     {
-        char* str = NULL;
         cpu_set_t cpuset;
-
+        CPU_ZERO(&cpuset);
+        CPU_SET(pin_ids[ncpus-1], &cpuset);
+        sched_setaffinity(getpid(), sizeof(cpu_set_t), &cpuset);
+        placement_log("main", pthread_self(), pin_ids[ncpus-1]);
         if (!silent)
         {
-            color_print("[pthread wrapper] \n");
+            color_print("[pthread wrapper] MAIN -> %d\n",pin_ids[ncpus-1]);
         }
+    }
+    else
+    {
+        color_print("[pthread wrapper] ERROR: Environment Variabel LIKWID_PIN not set!\n");
+    }
 
-        str = getenv("LIKWID_PIN");
-        if (str != NULL)
-        {
-            CPU_ZERO(&cpuset);
-            CPU_SET(pin_ids[ncpus-1], &cpuset);
-            ret = sched_setaffinity(getpid(), sizeof(cpu_set_t), &cpuset);
-            if (!silent)
-            {
-                color_print("[pthread wrapper] MAIN -> %d\n",pin_ids[ncpus-1]);
-            }
-            //ncpus--; /* last ID is the first (the process was pinned to) */
-        }
-        else
-        {
-            color_print("[pthread wrapper] ERROR: Environment Variabel LIKWID_PIN not set!\n");
-        }
+    if (!silent)
+    {
+        color_print("[pthread wrapper] PIN_MASK: ");
 
-        if (!silent)
+        for (int i=0;i<ncpus-1;i++)
         {
-            color_print("[pthread wrapper] PIN_MASK: ");
-
-            for (int i=0;i<ncpus-1;i++)
-            {
-                color_print("%d->%d  ",i,pin_ids[i]);
-            }
-            color_print("\n[pthread wrapper] SKIP MASK: 0x%llX\n",LLU_CAST skipMask);
+            color_print("%d->%d  ",i,pin_ids[i]);
         }
+        color_print("\n[pthread wrapper] SKIP MASK: 0x%llX\n",LLU_CAST skipMask);
+    }
+    fflush(stdout);
+}
 
-        overflow = ncpus-1;
+int __attribute__ ((visibility ("default") ))
+pthread_create(pthread_t* thread,
+        const pthread_attr_t* attr,
+        void* (*start_routine)(void *),
+        void * arg)
+{
+    int ret;
+    int callid;
+    int shepherd = 0;
+    int skip = 0;
+    int slot = -1;
+    int wrapped = 0;
+    pthread_create_func rptc = get_real_pthread_create();
+    if (!rptc)
+    {
+        return -2;
     }
-    Dl_info info;
-    if (dladdr(start_routine, &info) > 0)
-    {
-        FILE* fpipe;
-        char cmd[512];
-        char buff[512];
-        char file[256];
-        unsigned int ptr = ((void*)start_routine) - info.dli_fbase;
-
-        buff[0] = '\0';
-        snprintf(file, 255, "/tmp/likwidpin.%d", gettid());
-        snprintf(cmd, 511, "rm -f %s; nm %s 2>/dev/null | grep %x > %s",
-                 file, info.dli_fname, ptr, file);
-        ret = system(cmd);
-        if (!access(file, R_OK))
+
+    pthread_once(&first_call, pthread_overload_first_call);
+    callid = __sync_fetch_and_add(&ncalled, 1);
+    shepherd = is_shepherd(start_routine);
+    skip = (shepherd || ((callid<64) && (skipMask&(1ULL<<(callid)))));
+
+    if (!skip && pin_ids != NULL && ncpus > 0 && track_threads)
+    {
+        PinnedStart* start = malloc(sizeof(PinnedStart));
+        if (start)
         {
-            fpipe = fopen(file, "r");
-            if (!fpipe)
+            start->start_routine = start_routine;
+            start->arg = arg;
+            start->slot = -1;
+            ret = rptc(thread, attr, pinned_start, start);
+            if (ret != 0)
             {
-                fprintf(stderr, "Problems reading symbols for shepard thread detection\n");
+                free(start);
             }
             else
             {
-                char* t = fgets(buff, 512, fpipe);
-                char* tmp = strstr(buff, "monitor");
-                if (tmp != NULL)
-                {
-                    shepard = 1;
-                    skipMask |= 1ULL<<(ncalled);
-                }
-                fclose(fpipe);
-                snprintf(cmd, 511, "rm -f %s 2>/dev/null", file);
-                ret = system(cmd);
+                slot = acquire_slot(&wrapped);
+                __atomic_store_n(&start->slot, slot, __ATOMIC_RELEASE);
             }
         }
         else
         {
-            fprintf(stderr, "Problems reading symbols for shepard thread detection\n");
+            ret = rptc(thread, attr, start_routine, arg);
         }
     }
-
-    /* Handle dll related stuff */
-    do
+    else
     {
-        handle = dlopen(sosearchpaths[reallpthrindex], RTLD_LAZY);
-        if (handle)
-        {
-            break;
-        }
-        if (sosearchpaths[reallpthrindex] != NULL)
-        {
-            reallpthrindex++;
-        }
+        ret = rptc(thread, attr, start_routine, arg);
     }
-
-    while (sosearchpaths[reallpthrindex] != NULL);
-
-    if (!handle)
+    if (ret == 0 && slot < 0 && !skip && pin_ids != NULL && ncpus > 0)
     {
-        color_print("%s\n", dlerror());
-        pthread_mutex_unlock(&mutex);
-        return -1;
-    }
-
-    dlerror();    /* Clear any existing error */
-    rptc = dlsym(handle, "pthread_create");
-
-    if ((error = dlerror()) != NULL)
-    {
-        color_print("%s\n", error);
-        pthread_mutex_unlock(&mutex);
-        return -2;
+        slot = acquire_slot(&wrapped);
     }
 
-    ret = (*rptc)(thread, attr, start_routine, arg);
-
     /* After thread creation pin the thread */
-    if (ret == 0)
+    if (ret == 0 && pin_ids != NULL && ncpus > 0)
     {
         cpu_set_t cpuset;
 
-        if ((ncalled<64) && (skipMask&(1ULL<<(ncalled))))
+        if (skip)
         {
+            placement_log("skip", *thread, -1);
             CPU_ZERO(&cpuset);
             for (int i=0; i<online_cpus; i++)
                 CPU_SET(i, &cpuset);
             pthread_setaffinity_np(*thread, sizeof(cpu_set_t), &cpuset);
             if (!silent)
             {
-                if (shepard)
+                if (shepherd)
                     color_print("\tthreadid %lu -> SKIP SHEPHERD\n", *thread);
                 else
                     color_print("\tthreadid %lu -> SKIP \n", *thread);
-                shepard = 0;
             }
         }
         else
         {
+            /* The last entry of the list is used by the main thread, so it
+             * is the first one shared when more threads are created */
+            int cpu = pin_ids[slot];
             CPU_ZERO(&cpuset);
-            CPU_SET(pin_ids[npinned%ncpus], &cpuset);
+            CPU_SET(cpu, &cpuset);
             pthread_setaffinity_np(*thread, sizeof(cpu_set_t), &cpuset);
-            if ((npinned == overflow) && (!overflowed))
-            {
-                if (!silent)
-                {
-                    color_print("Roundrobin placement triggered\n\tthreadid %lu -> hwthread %d - OK", *thread, pin_ids[npinned%ncpus]);
-                }
-                overflowed = 1;
-                npinned = (npinned+1)%ncpus;
-            }
-            else
+            placement_log("create", *thread, cpu);
+            if (!silent)
             {
-                if (!silent)
+                if (wrapped)
                 {
-                    color_print("\tthreadid %lu -> hwthread %d - OK", *thread, pin_ids[npinned%ncpus]);
+                    color_print("Roundrobin placement triggered\n\tthreadid %lu -> hwthread %d - OK\n", *thread, cpu);
                 }
-                npinned++;
-                if ((npinned >= ncpus) && (overflowed))
+                else
                 {
-                    npinned = 0;
+                    color_print("\tthreadid %lu -> hwthread %d - OK\n", *thread, cpu);
                 }
             }
-
-            if (!silent)
-            {
-                color_print("\n");
-            }
+        }
+        if (!silent)
+        {
+            fflush(stdout);
         }
     }
 
-    fflush(stdout);
-    ncalled++;
-    dlclose(handle);
-    pthread_mutex_unlock(&mutex);
-
     return ret;
 }
 
 void __attribute__((destructor (103))) close_pthread_overload(void)
 {
+    SymbolCache* cache = symbolCache;
+    while (cache)
+    {
+        SymbolCache* next = cache->next;
+        free(cache->fname);
+        free(cache->start);
+        free(cache->end);
+        free(cache);
+        cache = next;
+    }
+    symbolCache = NULL;
+    if (placementLog)
+    {
+        fclose(placementLog);
+        placementLog = NULL;
+    }
+    free(slot_order);
+    slot_order = NULL;
+    free(slot_load);
+    slot_load = NULL;
+    if (pthread_handle)
+    {
+        dlclose(pthread_handle);
+        pthread_handle = NULL;
+    }
     free(pin_ids);
+    pin_ids = NULL;
 }
-
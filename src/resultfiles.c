@@ -0,0 +1,941 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  resultfiles.c
+ *
+ *      Description:  Parallel reader and aggregator for likwid-perfctr CSV result files
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2016 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+
+/* #####   HEADER FILE INCLUDES   ######################################### */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include <error.h>
+#include <likwid.h>
+#include <perfgroup.h>
+
+/* #####   TYPE DEFINITIONS   ########### */
+
+typedef struct {
+    char* name;
+    double* values;
+} ResultFileCounter;
+
+/* One raw table of a result file, identified by region (NULL without
+ * Marker API) and group ID as printed by likwid-perfctr */
+typedef struct {
+    char* region;
+    int group;
+    int numCpus;
+    int* cpus;
+    double* time;
+    double* calls;
+    int numCounters;
+    int maxCounters;
+    ResultFileCounter* counters;
+} ResultFileRawTable;
+
+typedef struct {
+    int rank;
+    char* host;
+    char* filename;
+    double clock;
+    int error;
+    int numTables;
+    int maxTables;
+    ResultFileRawTable* tables;
+} ResultFile;
+
+typedef enum {
+    RF_NONE = 0,
+    RF_RAW_INFO,
+    RF_RAW_ROWS,
+    RF_METRIC_ROWS,
+} ResultFileParseState;
+
+typedef struct {
+    int next;
+    pthread_mutex_t lock;
+} ResultFileQueue;
+
+typedef struct {
+    ResultFileTable* table;
+    char** counters;
+    char** formulas;
+    double* clocks;
+    char* uses; /* numMetrics x (numCounters + 1), the last entry is the time */
+    int next;
+    pthread_mutex_t lock;
+} ResultFileMetricJob;
+
+/* #####   VARIABLES  -  LOCAL TO THIS SOURCE FILE   ###################### */
+
+static ResultFile* resultFiles = NULL;
+static int numResultFiles = 0;
+static int resultFileThreads = 1;
+
+#define RESULTFILES_CHUNK 64
+
+/* #####   FUNCTION DEFINITIONS  -  LOCAL TO THIS SOURCE FILE   ########### */
+
+static double
+rf_value(const char* field)
+{
+    char* end = NULL;
+    double v = 0;
+    if (!field || field[0] == '\0')
+    {
+        return NAN;
+    }
+    v = strtod(field, &end);
+    if (end == field)
+    {
+        return NAN;
+    }
+    return v;
+}
+
+static int
+rf_split(char* line, char*** fields, int* maxFields)
+{
+    int n = 0;
+    char* p = line;
+    while (1)
+    {
+        if (n == *maxFields)
+        {
+            int newmax = (*maxFields ? *maxFields * 2 : 64);
+            char** tmp = realloc(*fields, newmax * sizeof(char*));
+            if (!tmp)
+            {
+                return n;
+            }
+            *fields = tmp;
+            *maxFields = newmax;
+        }
+        (*fields)[n++] = p;
+        p = strchr(p, ',');
+        if (!p)
+        {
+            break;
+        }
+        *p = '\0';
+        p++;
+    }
+    /* drop the empty padding fields at the end of the line */
+    while (n > 1 && (*fields)[n-1][0] == '\0')
+    {
+        n--;
+    }
+    return n;
+}
+
+static int
+rf_same_region(const char* a, const char* b)
+{
+    if (!a || !b)
+    {
+        return (a == b);
+    }
+    return (strcmp(a, b) == 0);
+}
+
+static ResultFileRawTable*
+rf_get_table(ResultFile* file, const char* region, int group, int create)
+{
+    int i = 0;
+    ResultFileRawTable* t = NULL;
+    for (i = 0; i < file->numTables; i++)
+    {
+        if (file->tables[i].group == group && rf_same_region(file->tables[i].region, region))
+        {
+            return &file->tables[i];
+        }
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    if (file->numTables == file->maxTables)
+    {
+        int newmax = (file->maxTables ? file->maxTables * 2 : 4);
+        ResultFileRawTable* tmp = realloc(file->tables, newmax * sizeof(ResultFileRawTable));
+        if (!tmp)
+        {
+            return NULL;
+        }
+        file->tables = tmp;
+        file->maxTables = newmax;
+    }
+    t = &file->tables[file->numTables++];
+    memset(t, 0, sizeof(ResultFileRawTable));
+    t->region = (region ? strdup(region) : NULL);
+    t->group = group;
+    return t;
+}
+
+static void
+rf_set_cpus(ResultFileRawTable* t, char** fields, int first, int n)
+{
+    int i = 0;
+    if (t->cpus || n <= first)
+    {
+        return;
+    }
+    t->cpus = malloc((n - first) * sizeof(int));
+    if (!t->cpus)
+    {
+        return;
+    }
+    for (i = first; i < n; i++)
+    {
+        int cpu = -1;
+        if (sscanf(fields[i], "HWThread %d", &cpu) != 1)
+        {
+            break;
+        }
+        t->cpus[t->numCpus++] = cpu;
+    }
+}
+
+static double*
+rf_values(ResultFileRawTable* t, char** fields, int first, int n)
+{
+    int i = 0;
+    double* values = NULL;
+    if (t->numCpus == 0)
+    {
+        return NULL;
+    }
+    values = malloc(t->numCpus * sizeof(double));
+    if (!values)
+    {
+        return NULL;
+    }
+    for (i = 0; i < t->numCpus; i++)
+    {
+        values[i] = (first + i < n ? rf_value(fields[first + i]) : NAN);
+    }
+    return values;
+}
+
+static void
+rf_add_counter(ResultFileRawTable* t, const char* name, char** fields, int n)
+{
+    ResultFileCounter* c = NULL;
+    if (t->numCounters == t->maxCounters)
+    {
+        int newmax = (t->maxCounters ? t->maxCounters * 2 : 16);
+        ResultFileCounter* tmp = realloc(t->counters, newmax * sizeof(ResultFileCounter));
+        if (!tmp)
+        {
+            return;
+        }
+        t->counters = tmp;
+        t->maxCounters = newmax;
+    }
+    c = &t->counters[t->numCounters];
+    c->values = rf_values(t, fields, 2, n);
+    if (!c->values)
+    {
+        return;
+    }
+    c->name = strdup(name);
+    t->numCounters++;
+}
+
+/* Parse the tables of a likwid-perfctr CSV file (-O output). Only the raw
+ * tables are kept, the statistics tables are recomputed over all files. The
+ * runtime is also taken from the metric table since groups with metrics do
+ * not print it in the raw table. */
+static int
+rf_parse_file(ResultFile* file)
+{
+    FILE* fp = NULL;
+    long size = 0;
+    char* buf = NULL;
+    char* line = NULL;
+    char* next = NULL;
+    char** fields = NULL;
+    int maxFields = 0;
+    ResultFileParseState state = RF_NONE;
+    ResultFileRawTable* cur = NULL;
+
+    fp = fopen(file->filename, "r");
+    if (!fp)
+    {
+        ERROR_PRINT(Cannot open result file %s, file->filename);
+        return -errno;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size <= 0)
+    {
+        ERROR_PRINT(Result file %s is empty, file->filename);
+        fclose(fp);
+        return -ENODATA;
+    }
+    buf = malloc(size + 1);
+    if (!buf)
+    {
+        fclose(fp);
+        return -ENOMEM;
+    }
+    size = fread(buf, 1, size, fp);
+    buf[size] = '\0';
+    fclose(fp);
+
+    for (line = buf; line && *line != '\0'; line = next)
+    {
+        int n = 0;
+        next = strchr(line, '\n');
+        if (next)
+        {
+            *next = '\0';
+            next++;
+        }
+        if (line[0] == '\0' || line[0] == '-')
+        {
+            continue;
+        }
+        n = rf_split(line, &fields, &maxFields);
+        if (strncmp(fields[0], "CPU clock:", 10) == 0 && n > 1)
+        {
+            file->clock = rf_value(fields[1]) * 1.E09;
+        }
+        else if (strcmp(fields[0], "TABLE") == 0 && n > 1)
+        {
+            char* region = NULL;
+            char kind[64];
+            int idx = 1;
+            int group = 0;
+            state = RF_NONE;
+            cur = NULL;
+            if (strncmp(fields[1], "Region ", 7) == 0)
+            {
+                region = fields[1] + 7;
+                idx = 2;
+            }
+            if (idx >= n || sscanf(fields[idx], "Group %d %63[^\n]", &group, kind) != 2)
+            {
+                continue;
+            }
+            if (strcmp(kind, "Raw") == 0)
+            {
+                cur = rf_get_table(file, region, group, 1);
+                state = (cur ? RF_RAW_INFO : RF_NONE);
+            }
+            else if (strcmp(kind, "Metric") == 0)
+            {
+                cur = rf_get_table(file, region, group, 0);
+                state = (cur ? RF_METRIC_ROWS : RF_NONE);
+            }
+        }
+        else if (state == RF_RAW_INFO)
+        {
+            if (strcmp(fields[0], "Region Info") == 0)
+            {
+                rf_set_cpus(cur, fields, 1, n);
+            }
+            else if (strncmp(fields[0], "RDTSC Runtime", 13) == 0 && !cur->time)
+            {
+                cur->time = rf_values(cur, fields, 1, n);
+            }
+            else if (strcmp(fields[0], "call count") == 0 && !cur->calls)
+            {
+                cur->calls = rf_values(cur, fields, 1, n);
+            }
+            else if (strcmp(fields[0], "Event") == 0)
+            {
+                rf_set_cpus(cur, fields, 2, n);
+                state = RF_RAW_ROWS;
+            }
+        }
+        else if (state == RF_RAW_ROWS && n > 1)
+        {
+            if (strcmp(fields[1], "TSC") == 0)
+            {
+                if (!cur->time)
+                {
+                    cur->time = rf_values(cur, fields, 2, n);
+                }
+            }
+            else
+            {
+                rf_add_counter(cur, fields[1], fields, n);
+            }
+        }
+        else if (state == RF_METRIC_ROWS && n > 1)
+        {
+            if (strncmp(fields[0], "Runtime (RDTSC)", 15) == 0 && !cur->time)
+            {
+                cur->time = rf_values(cur, fields, 1, n);
+            }
+        }
+    }
+    free(fields);
+    free(buf);
+    return 0;
+}
+
+static void
+rf_free_file(ResultFile* file)
+{
+    int i = 0, j = 0;
+    for (i = 0; i < file->numTables; i++)
+    {
+        ResultFileRawTable* t = &file->tables[i];
+        for (j = 0; j < t->numCounters; j++)
+        {
+            free(t->counters[j].name);
+            free(t->counters[j].values);
+        }
+        free(t->counters);
+        free(t->region);
+        free(t->cpus);
+        free(t->time);
+        free(t->calls);
+    }
+    free(file->tables);
+    free(file->host);
+    free(file->filename);
+    memset(file, 0, sizeof(ResultFile));
+}
+
+static void*
+rf_parse_worker(void* arg)
+{
+    ResultFileQueue* queue = (ResultFileQueue*)arg;
+    while (1)
+    {
+        int i = 0, j = 0;
+        pthread_mutex_lock(&queue->lock);
+        i = queue->next;
+        queue->next += RESULTFILES_CHUNK;
+        pthread_mutex_unlock(&queue->lock);
+        if (i >= numResultFiles)
+        {
+            break;
+        }
+        for (j = i; j < i + RESULTFILES_CHUNK && j < numResultFiles; j++)
+        {
+            resultFiles[j].error = rf_parse_file(&resultFiles[j]);
+        }
+    }
+    return NULL;
+}
+
+static int
+rf_cmp_rank(const void* a, const void* b)
+{
+    const ResultFile* fa = (const ResultFile*)a;
+    const ResultFile* fb = (const ResultFile*)b;
+    return (fa->rank > fb->rank) - (fa->rank < fb->rank);
+}
+
+static int
+rf_cmp_double(const void* a, const void* b)
+{
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static double
+rf_percentile(double* sorted, int n, int k)
+{
+    double pos = (k / 100.0) * n;
+    int idx = (int)floor(pos);
+    if (pos - idx >= 0.5)
+    {
+        idx++;
+    }
+    if (idx < 1)
+    {
+        idx = 1;
+    }
+    return sorted[idx - 1];
+}
+
+/* Sum, min, max and average in one pass over the values, the valid values
+ * are collected in tmp and sorted for the percentiles. */
+static void
+rf_stats(const double* values, int n, double* tmp, double* stats)
+{
+    int i = 0;
+    int count = 0;
+    double sum = 0;
+    double min = INFINITY;
+    double max = -INFINITY;
+    for (i = 0; i < n; i++)
+    {
+        double v = values[i];
+        if (isnan(v))
+        {
+            continue;
+        }
+        sum += v;
+        min = (v < min ? v : min);
+        max = (v > max ? v : max);
+        tmp[count++] = v;
+    }
+    if (count == 0)
+    {
+        for (i = 0; i < NUM_RESULTSTATS; i++)
+        {
+            stats[i] = NAN;
+        }
+        return;
+    }
+    qsort(tmp, count, sizeof(double), rf_cmp_double);
+    stats[RESULTSTAT_SUM] = sum;
+    stats[RESULTSTAT_MIN] = min;
+    stats[RESULTSTAT_MAX] = max;
+    stats[RESULTSTAT_AVG] = sum / count;
+    stats[RESULTSTAT_P25] = rf_percentile(tmp, count, 25);
+    stats[RESULTSTAT_P50] = rf_percentile(tmp, count, 50);
+    stats[RESULTSTAT_P75] = rf_percentile(tmp, count, 75);
+}
+
+/* Mark the counters each metric formula references. The names are matched
+ * longest first like calc_metric replaces them, so PMC1 is not found in
+ * PMC10. */
+static char*
+rf_metric_uses(int numMetrics, char** formulas, int numCounters, char** counters)
+{
+    int m = 0, c = 0;
+    int minlen = 4, maxlen = 4; /* "time" */
+    char* uses = calloc((size_t)numMetrics * (numCounters + 1), sizeof(char));
+    if (!uses)
+    {
+        return NULL;
+    }
+    for (c = 0; c < numCounters; c++)
+    {
+        int len = strlen(counters[c]);
+        minlen = (len < minlen ? len : minlen);
+        maxlen = (len > maxlen ? len : maxlen);
+    }
+    for (m = 0; m < numMetrics; m++)
+    {
+        char* f = strdup(formulas[m]);
+        int len = 0;
+        if (!f)
+        {
+            continue;
+        }
+        for (len = maxlen; len >= minlen && len > 0; len--)
+        {
+            for (c = 0; c <= numCounters; c++)
+            {
+                char* name = (c < numCounters ? counters[c] : "time");
+                char* p = NULL;
+                if ((int)strlen(name) != len)
+                {
+                    continue;
+                }
+                while ((p = strstr(f, name)) != NULL)
+                {
+                    uses[m * (numCounters + 1) + c] = 1;
+                    memset(p, '#', len);
+                }
+            }
+        }
+        free(f);
+    }
+    return uses;
+}
+
+static void*
+rf_metric_worker(void* arg)
+{
+    ResultFileMetricJob* job = (ResultFileMetricJob*)arg;
+    ResultFileTable* t = job->table;
+    while (1)
+    {
+        int first = 0, col = 0;
+        pthread_mutex_lock(&job->lock);
+        first = job->next;
+        job->next += RESULTFILES_CHUNK;
+        pthread_mutex_unlock(&job->lock);
+        if (first >= t->numColumns)
+        {
+            break;
+        }
+        for (col = first; col < first + RESULTFILES_CHUNK && col < t->numColumns; col++)
+        {
+            int c = 0, m = 0;
+            CounterList clist;
+            init_clist(&clist);
+            for (c = 0; c < t->numCounters; c++)
+            {
+                add_to_clist(&clist, job->counters[c], t->counters[c * t->numColumns + col]);
+            }
+            add_to_clist(&clist, "time", t->time[col]);
+            add_to_clist(&clist, "inverseClock", (job->clocks[col] > 0 ? 1.0/job->clocks[col] : 0));
+            add_to_clist(&clist, "true", 1);
+            add_to_clist(&clist, "false", 0);
+            for (m = 0; m < t->numMetrics; m++)
+            {
+                double result = 0;
+                int missing = 0;
+                /* calc_metric evaluates nan as 0, a metric of a missing
+                 * counter is missing as well */
+                for (c = 0; job->uses && c <= t->numCounters && !missing; c++)
+                {
+                    if (job->uses[m * (t->numCounters + 1) + c])
+                    {
+                        missing = isnan(c < t->numCounters ? t->counters[c * t->numColumns + col] : t->time[col]);
+                    }
+                }
+                if (missing || calc_metric(job->formulas[m], &clist, &result) < 0)
+                {
+                    result = NAN;
+                }
+                t->metrics[m * t->numColumns + col] = result;
+            }
+            destroy_clist(&clist);
+        }
+    }
+    return NULL;
+}
+
+/* #####   FUNCTION DEFINITIONS  -  EXPORTED FUNCTIONS   ################## */
+
+int
+resultfiles_read(int numFiles, char** files, int* ranks, char** hosts, int numThreads)
+{
+    int i = 0;
+    int ok = 0;
+    pthread_t* threads = NULL;
+    int* started = NULL;
+    ResultFileQueue queue;
+
+    if (numFiles <= 0 || !files)
+    {
+        return -EINVAL;
+    }
+    resultfiles_destroy();
+    resultFiles = calloc(numFiles, sizeof(ResultFile));
+    if (!resultFiles)
+    {
+        return -ENOMEM;
+    }
+    numResultFiles = numFiles;
+    for (i = 0; i < numFiles; i++)
+    {
+        resultFiles[i].filename = strdup(files[i]);
+        resultFiles[i].rank = (ranks ? ranks[i] : i);
+        resultFiles[i].host = strdup((hosts && hosts[i]) ? hosts[i] : "");
+    }
+    if (numThreads < 1)
+    {
+        numThreads = 1;
+    }
+    if (numThreads > (numFiles + RESULTFILES_CHUNK - 1) / RESULTFILES_CHUNK)
+    {
+        numThreads = (numFiles + RESULTFILES_CHUNK - 1) / RESULTFILES_CHUNK;
+    }
+    resultFileThreads = numThreads;
+
+    queue.next = 0;
+    pthread_mutex_init(&queue.lock, NULL);
+    threads = malloc(numThreads * sizeof(pthread_t));
+    started = calloc(numThreads, sizeof(int));
+    for (i = 1; threads && started && i < numThreads; i++)
+    {
+        started[i] = (pthread_create(&threads[i], NULL, rf_parse_worker, &queue) == 0);
+    }
+    rf_parse_worker(&queue);
+    for (i = 1; threads && started && i < numThreads; i++)
+    {
+        if (started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }
+    }
+    free(threads);
+    free(started);
+    pthread_mutex_destroy(&queue.lock);
+
+    qsort(resultFiles, numResultFiles, sizeof(ResultFile), rf_cmp_rank);
+    for (i = 0; i < numResultFiles; i++)
+    {
+        if (resultFiles[i].error == 0)
+        {
+            ok++;
+        }
+    }
+    DEBUG_PRINT(DEBUGLEV_DEVELOP, Parsed %d of %d result files with %d threads, ok, numFiles, numThreads);
+    return ok;
+}
+
+int
+resultfiles_getRegions(char*** regions)
+{
+    int i = 0, j = 0, k = 0;
+    int n = 0;
+    char** list = NULL;
+    if (!regions)
+    {
+        return -EINVAL;
+    }
+    *regions = NULL;
+    for (i = 0; i < numResultFiles; i++)
+    {
+        for (j = 0; j < resultFiles[i].numTables; j++)
+        {
+            char* r = resultFiles[i].tables[j].region;
+            int found = 0;
+            if (!r)
+            {
+                continue;
+            }
+            for (k = 0; k < n; k++)
+            {
+                if (strcmp(list[k], r) == 0)
+                {
+                    found = 1;
+                    break;
+                }
+            }
+            if (!found)
+            {
+                char** tmp = realloc(list, (n + 1) * sizeof(char*));
+                if (!tmp)
+                {
+                    break;
+                }
+                list = tmp;
+                list[n++] = r;
+            }
+        }
+    }
+    *regions = list;
+    return n;
+}
+
+int
+resultfiles_aggregate(const char* region, int groupId, int numCounters, char** counters,
+                      int numMetrics, char** formulas, ResultFileTable** table)
+{
+    int i = 0, j = 0, c = 0;
+    int col = 0;
+    int hasCalls = 0;
+    double* tmp = NULL;
+    double* clocks = NULL;
+    ResultFileTable* t = NULL;
+
+    if (!table || numCounters < 0 || numMetrics < 0)
+    {
+        return -EINVAL;
+    }
+    *table = NULL;
+    t = calloc(1, sizeof(ResultFileTable));
+    if (!t)
+    {
+        return -ENOMEM;
+    }
+    for (i = 0; i < numResultFiles; i++)
+    {
+        ResultFileRawTable* raw = rf_get_table(&resultFiles[i], region, groupId, 0);
+        if (raw)
+        {
+            t->numColumns += raw->numCpus;
+            hasCalls |= (raw->calls != NULL);
+        }
+    }
+    t->numCounters = numCounters;
+    t->numMetrics = numMetrics;
+    if (t->numColumns == 0)
+    {
+        *table = t;
+        return 0;
+    }
+    t->labels = calloc(t->numColumns, sizeof(char*));
+    t->counters = malloc(((size_t)numCounters + 1) * t->numColumns * sizeof(double));
+    t->time = malloc(t->numColumns * sizeof(double));
+    t->calls = (hasCalls ? malloc(t->numColumns * sizeof(double)) : NULL);
+    t->metrics = malloc(((size_t)numMetrics + 1) * t->numColumns * sizeof(double));
+    t->counterStats = malloc(((size_t)numCounters + 1) * NUM_RESULTSTATS * sizeof(double));
+    t->metricStats = malloc(((size_t)numMetrics + 1) * NUM_RESULTSTATS * sizeof(double));
+    tmp = malloc(t->numColumns * sizeof(double));
+    clocks = malloc(t->numColumns * sizeof(double));
+    if (!t->labels || !t->counters || !t->time || (hasCalls && !t->calls) || !t->metrics ||
+        !t->counterStats || !t->metricStats || !tmp || !clocks)
+    {
+        free(tmp);
+        free(clocks);
+        resultfiles_freeTable(t);
+        return -ENOMEM;
+    }
+
+    /* Columns are ordered by rank and by hardware thread as in the file */
+    for (i = 0; i < numResultFiles; i++)
+    {
+        ResultFile* f = &resultFiles[i];
+        ResultFileRawTable* raw = rf_get_table(f, region, groupId, 0);
+        int* map = NULL;
+        if (!raw)
+        {
+            continue;
+        }
+        map = malloc((numCounters + 1) * sizeof(int));
+        if (!map)
+        {
+            free(tmp);
+            free(clocks);
+            resultfiles_freeTable(t);
+            return -ENOMEM;
+        }
+        for (c = 0; c < numCounters; c++)
+        {
+            map[c] = -1;
+            for (j = 0; j < raw->numCounters; j++)
+            {
+                if (strcmp(raw->counters[j].name, counters[c]) == 0)
+                {
+                    map[c] = j;
+                    break;
+                }
+            }
+        }
+        for (j = 0; j < raw->numCpus; j++, col++)
+        {
+            char label[512];
+            snprintf(label, sizeof(label), "%s:%d:%d", f->host, f->rank, raw->cpus[j]);
+            t->labels[col] = strdup(label);
+            t->time[col] = (raw->time ? raw->time[j] : NAN);
+            if (t->calls)
+            {
+                t->calls[col] = (raw->calls ? raw->calls[j] : NAN);
+            }
+            clocks[col] = f->clock;
+            /* A counter missing in the file of a rank is not measured there,
+             * it must not add zeros to the statistics */
+            for (c = 0; c < numCounters; c++)
+            {
+                t->counters[c * t->numColumns + col] = (map[c] >= 0 ? raw->counters[map[c]].values[j] : NAN);
+            }
+        }
+        free(map);
+    }
+
+    for (c = 0; c < numCounters; c++)
+    {
+        rf_stats(&t->counters[c * t->numColumns], t->numColumns, tmp, &t->counterStats[c * NUM_RESULTSTATS]);
+    }
+    rf_stats(t->time, t->numColumns, tmp, t->timeStats);
+    if (t->calls)
+    {
+        rf_stats(t->calls, t->numColumns, tmp, t->callStats);
+    }
+
+    if (numMetrics > 0)
+    {
+        int nthreads = resultFileThreads;
+        pthread_t* threads = malloc(nthreads * sizeof(pthread_t));
+        int* started = calloc(nthreads, sizeof(int));
+        ResultFileMetricJob job;
+        job.table = t;
+        job.counters = counters;
+        job.formulas = formulas;
+        job.clocks = clocks;
+        job.uses = rf_metric_uses(numMetrics, formulas, numCounters, counters);
+        job.next = 0;
+        pthread_mutex_init(&job.lock, NULL);
+        for (i = 1; threads && started && i < nthreads; i++)
+        {
+            started[i] = (pthread_create(&threads[i], NULL, rf_metric_worker, &job) == 0);
+        }
+        rf_metric_worker(&job);
+        for (i = 1; threads && started && i < nthreads; i++)
+        {
+            if (started[i])
+            {
+                pthread_join(threads[i], NULL);
+            }
+        }
+        free(threads);
+        free(started);
+        free(job.uses);
+        pthread_mutex_destroy(&job.lock);
+        for (i = 0; i < numMetrics; i++)
+        {
+            rf_stats(&t->metrics[i * t->numColumns], t->numColumns, tmp, &t->metricStats[i * NUM_RESULTSTATS]);
+        }
+    }
+    free(tmp);
+    free(clocks);
+    *table = t;
+    return 0;
+}
+
+void
+resultfiles_freeTable(ResultFileTable* table)
+{
+    int i = 0;
+    if (!table)
+    {
+        return;
+    }
+    if (table->labels)
+    {
+        for (i = 0; i < table->numColumns; i++)
+        {
+            free(table->labels[i]);
+        }
+        free(table->labels);
+    }
+    free(table->counters);
+    free(table->time);
+    free(table->calls);
+    free(table->metrics);
+    free(table->counterStats);
+    free(table->metricStats);
+    free(table);
+}
+
+void
+resultfiles_destroy(void)
+{
+    int i = 0;
+    if (resultFiles)
+    {
+        for (i = 0; i < numResultFiles; i++)
+        {
+            rf_free_file(&resultFiles[i]);
+        }
+        free(resultFiles);
+        resultFiles = NULL;
+    }
+    numResultFiles = 0;
+    resultFileThreads = 1;
+}
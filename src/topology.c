@@ -1322,6 +1322,7 @@ topology_init(void)
 {
     int ret = 0;
     cpu_set_t cpuSet;
+    char* topofile = NULL;
     struct topology_functions funcs = topology_funcs;
     if (topology_initialized)
     {
@@ -1334,7 +1335,13 @@ topology_init(void)
         return EXIT_FAILURE;
     }
 
-    if ((config.topologyCfgFileName == NULL) || access(config.topologyCfgFileName, R_OK))
+    /* A topology file of another machine, e.g. for simulated registers */
+    topofile = getenv("LIKWID_TOPOLOGY_FILE");
+    if (topofile == NULL)
+    {
+        topofile = config.topologyCfgFileName;
+    }
+    if ((topofile == NULL) || access(topofile, R_OK))
     {
 standard_init:
         CPU_ZERO(&cpuSet);
@@ -1478,8 +1485,8 @@ standard_init:
                 }
             }
         }
-        DEBUG_PRINT(DEBUGLEV_INFO, Reading topology information from %s, config.topologyCfgFileName);
-        ret = readTopologyFile(config.topologyCfgFileName, cpuSet);
+        DEBUG_PRINT(DEBUGLEV_INFO, Reading topology information from %s, topofile);
+        ret = readTopologyFile(topofile, cpuSet);
         if (ret < 0)
             goto standard_init;
         cpuid_topology.activeHWThreads = 0;
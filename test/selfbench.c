@@ -0,0 +1,393 @@
+/*
+ * =======================================================================================
+ *
+ *      Filename:  selfbench.c
+ *
+ *      Description:  Measures the overhead of the LIKWID measurement stack itself:
+ *                    Marker API calls, counter reads per access mode, metric
+ *                    evaluation and group switches.
+ *
+ *      Version:   <VERSION>
+ *      Released:  <DATE>
+ *
+ *      Author:   Thomas Gruber (tr), thomas.roehl@googlemail.com
+ *      Project:  likwid
+ *
+ *      Copyright (C) 2015 RRZE, University Erlangen-Nuremberg
+ *
+ *      This program is free software: you can redistribute it and/or modify it under
+ *      the terms of the GNU General Public License as published by the Free Software
+ *      Foundation, either version 3 of the License, or (at your option) any later
+ *      version.
+ *
+ *      This program is distributed in the hope that it will be useful, but WITHOUT ANY
+ *      WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *      PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *      You should have received a copy of the GNU General Public License along with
+ *      this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =======================================================================================
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <likwid.h>
+
+#define MAX_EVENTSETS 16
+#define MAX_MODES 3
+
+static char* eventsets_intel[] = {
+    "INSTR_RETIRED_ANY:FIXC0",
+    "INSTR_RETIRED_ANY:FIXC0,CPU_CLK_UNHALTED_CORE:FIXC1",
+    "INSTR_RETIRED_ANY:FIXC0,CPU_CLK_UNHALTED_CORE:FIXC1,CPU_CLK_UNHALTED_REF:FIXC2",
+    NULL
+};
+static char* eventsets_amd[] = {
+    "RETIRED_INSTRUCTIONS:PMC0",
+    "RETIRED_INSTRUCTIONS:PMC0,RETIRED_BRANCH_INSTR:PMC1",
+    "RETIRED_INSTRUCTIONS:PMC0,RETIRED_BRANCH_INSTR:PMC1,RETIRED_MISP_BRANCH_INSTR:PMC2",
+    NULL
+};
+
+static int reps = 1000;
+static double* samples = NULL;
+
+static void
+usage(const char* exe)
+{
+    printf("Usage: %s [-c <cpulist>] [-e <eventset>]... [-g <group>] [-M <modes>] [-r <reps>]\n", exe);
+    printf("-c <cpulist>\t HWThreads to measure, e.g. 0-3 or 0,2 (default: all)\n");
+    printf("-e <eventset>\t Event set to measure, can be given multiple times to sweep\n");
+    printf("\t\t event set sizes (default: 1 to 3 architectural events)\n");
+    printf("-g <group>\t Performance group for the metric evaluation (default: CLOCK)\n");
+    printf("-M <modes>\t Comma-separated access modes: 0 (direct), 1 (accessdaemon)\n");
+    printf("\t\t (default: configured mode, perf_event builds always use perf_event)\n");
+    printf("-r <reps>\t Samples per measurement (default: 1000)\n");
+    printf("\nOutput is CSV with latencies per call in microseconds.\n");
+}
+
+static const char*
+mode_name(int mode)
+{
+    switch (mode)
+    {
+        case ACCESSMODE_PERF:
+            return "perf_event";
+        case ACCESSMODE_DIRECT:
+            return "direct";
+        case ACCESSMODE_DAEMON:
+            return "accessdaemon";
+    }
+    return "unknown";
+}
+
+static int
+count_events(const char* eventset)
+{
+    int count = 1;
+    for (const char* c = eventset; *c != '\0'; c++)
+    {
+        if (*c == ',')
+            count++;
+    }
+    return count;
+}
+
+static int
+compare_double(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double
+percentile(const double* sorted, int n, double p)
+{
+    int idx = (int)ceil(p / 100.0 * n) - 1;
+    if (idx < 0)
+        idx = 0;
+    if (idx >= n)
+        idx = n - 1;
+    return sorted[idx];
+}
+
+/* Prints one result line, the samples are in seconds */
+static void
+report(const char* bench, int mode, int threads, int events, double* values, int n)
+{
+    double sum = 0;
+    if (n <= 0)
+        return;
+    qsort(values, n, sizeof(double), compare_double);
+    for (int i = 0; i < n; i++)
+        sum += values[i];
+    printf("%s,%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", bench, mode_name(mode),
+           threads, events, n, values[0] * 1E6, percentile(values, n, 50) * 1E6,
+           percentile(values, n, 90) * 1E6, percentile(values, n, 99) * 1E6,
+           values[n-1] * 1E6, (sum / n) * 1E6);
+    fflush(stdout);
+}
+
+#define MEASURE(values, n, stmt) \
+    for (int _r = 0; _r < (n); _r++) \
+    { \
+        TimerData _t; \
+        timer_start(&_t); \
+        stmt; \
+        timer_stop(&_t); \
+        (values)[_r] = timer_print(&_t); \
+    }
+
+/* The Marker API holds its own perfmon state and reads its configuration from
+ * the environment, so it is measured in a child process. */
+static void
+bench_marker(int mode, int cpu, const char* eventset)
+{
+    char cpustr[20];
+    char modestr[20];
+    char filepath[256];
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        fprintf(stderr, "Cannot fork for Marker API benchmark\n");
+        return;
+    }
+    if (pid > 0)
+    {
+        waitpid(pid, NULL, 0);
+        return;
+    }
+    snprintf(cpustr, sizeof(cpustr), "%d", cpu);
+    snprintf(modestr, sizeof(modestr), "%d", mode);
+    snprintf(filepath, sizeof(filepath), "/tmp/likwid-selfbench-%d.txt", (int)getpid());
+    setenv("LIKWID_MODE", modestr, 1);
+    setenv("LIKWID_EVENTS", eventset, 1);
+    setenv("LIKWID_THREADS", cpustr, 1);
+    setenv("LIKWID_FILEPATH", filepath, 1);
+    setenv("LIKWID_PIN", cpustr, 1);
+    likwid_markerInit();
+    likwid_markerThreadInit();
+    if (likwid_markerRegisterRegion("selfbench") < 0)
+    {
+        fprintf(stderr, "Cannot measure event set %s with the Marker API in mode %s\n", eventset, mode_name(mode));
+        exit(1);
+    }
+    double* stops = malloc(reps * sizeof(double));
+    if (stops)
+    {
+        for (int r = 0; r < reps; r++)
+        {
+            TimerData t;
+            timer_start(&t);
+            likwid_markerStartRegion("selfbench");
+            timer_stop(&t);
+            samples[r] = timer_print(&t);
+            timer_start(&t);
+            likwid_markerStopRegion("selfbench");
+            timer_stop(&t);
+            stops[r] = timer_print(&t);
+        }
+        report("markerStartRegion", mode, 1, count_events(eventset), samples, reps);
+        report("markerStopRegion", mode, 1, count_events(eventset), stops, reps);
+        free(stops);
+    }
+    likwid_markerClose();
+    unlink(filepath);
+    exit(0);
+}
+
+/* Counter reads and group switches for one access mode, thread count and event set */
+static void
+bench_perfmon(int mode, int nthreads, const int* cpus, const char* eventset)
+{
+    int gid, gid2;
+    int events = count_events(eventset);
+#ifndef LIKWID_USE_PERFEVENT
+    HPMmode(mode);
+#endif
+    if (perfmon_init(nthreads, cpus) < 0)
+    {
+        fprintf(stderr, "Cannot initialize perfmon in mode %s\n", mode_name(mode));
+        return;
+    }
+    gid = perfmon_addEventSet(eventset);
+    gid2 = perfmon_addEventSet(eventset);
+    if (gid < 0 || gid2 < 0 || perfmon_setupCounters(gid) < 0 || perfmon_startCounters() < 0)
+    {
+        fprintf(stderr, "Cannot measure event set %s in mode %s\n", eventset, mode_name(mode));
+        perfmon_finalize();
+        return;
+    }
+    MEASURE(samples, reps, perfmon_readCounters());
+    report("readCounters", mode, nthreads, events, samples, reps);
+    if (nthreads == 1)
+    {
+        MEASURE(samples, reps, perfmon_readCountersCpu(cpus[0]));
+        report("readCountersCpu", mode, 1, events, samples, reps);
+    }
+    /* Switch between two groups with the same event set */
+    MEASURE(samples, reps, perfmon_switchActiveGroup(_r % 2 == 0 ? gid2 : gid));
+    report("switchActiveGroup", mode, nthreads, events, samples, reps);
+    perfmon_stopCounters();
+    perfmon_finalize();
+}
+
+static void
+bench_metrics(int mode, int nthreads, const int* cpus, const char* group)
+{
+    int gid, nmetrics;
+    volatile double sink = 0;
+#ifndef LIKWID_USE_PERFEVENT
+    HPMmode(mode);
+#endif
+    if (perfmon_init(nthreads, cpus) < 0)
+    {
+        return;
+    }
+    gid = perfmon_addEventSet(group);
+    if (gid < 0 || perfmon_setupCounters(gid) < 0 || perfmon_startCounters() < 0)
+    {
+        fprintf(stderr, "Cannot measure group %s in mode %s\n", group, mode_name(mode));
+        perfmon_finalize();
+        return;
+    }
+    perfmon_readCounters();
+    nmetrics = perfmon_getNumberOfMetrics(gid);
+    if (nmetrics > 0)
+    {
+        MEASURE(samples, reps, sink += perfmon_getMetric(gid, _r % nmetrics, _r % nthreads));
+        report("getMetric", mode, nthreads, perfmon_getNumberOfEvents(gid), samples, reps);
+    }
+    perfmon_stopCounters();
+    perfmon_finalize();
+}
+
+int
+main(int argc, char* argv[])
+{
+    int c = 0;
+    int ncpus = 0;
+    int* cpus = NULL;
+    char* cpustr = NULL;
+    char* group = "CLOCK";
+    char* eventsets[MAX_EVENTSETS];
+    int nsets = 0;
+    int modes[MAX_MODES];
+    int nmodes = 0;
+
+    while ((c = getopt(argc, argv, "c:e:g:M:r:h")) != -1)
+    {
+        switch (c)
+        {
+            case 'c':
+                cpustr = optarg;
+                break;
+            case 'e':
+                if (nsets < MAX_EVENTSETS)
+                    eventsets[nsets++] = optarg;
+                break;
+            case 'g':
+                group = optarg;
+                break;
+            case 'M':
+                for (char* t = strtok(optarg, ","); t && nmodes < MAX_MODES; t = strtok(NULL, ","))
+                    modes[nmodes++] = atoi(t);
+                break;
+            case 'r':
+                reps = atoi(optarg);
+                break;
+            case 'h':
+                usage(argv[0]);
+                return 0;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (reps <= 0)
+    {
+        fprintf(stderr, "Number of samples must be positive\n");
+        return 1;
+    }
+    if (topology_init() < 0)
+    {
+        fprintf(stderr, "Cannot initialize topology\n");
+        return 1;
+    }
+    CpuInfo_t cpuinfo = get_cpuInfo();
+    CpuTopology_t topo = get_cpuTopology();
+    cpus = malloc(topo->numHWThreads * sizeof(int));
+    samples = malloc(reps * sizeof(double));
+    if (!cpus || !samples)
+    {
+        return 1;
+    }
+    if (cpustr)
+    {
+        ncpus = cpustr_to_cpulist(cpustr, cpus, topo->numHWThreads);
+    }
+    else
+    {
+        for (int i = 0; i < topo->numHWThreads; i++)
+        {
+            if (topo->threadPool[i].inCpuSet)
+                cpus[ncpus++] = topo->threadPool[i].apicId;
+        }
+    }
+    if (ncpus <= 0)
+    {
+        fprintf(stderr, "Invalid CPU list\n");
+        return 1;
+    }
+    if (nsets == 0)
+    {
+        char** defaults = (cpuinfo->isIntel ? eventsets_intel : eventsets_amd);
+        for (int i = 0; defaults[i] != NULL; i++)
+            eventsets[nsets++] = defaults[i];
+    }
+#ifdef LIKWID_USE_PERFEVENT
+    modes[0] = ACCESSMODE_PERF;
+    nmodes = 1;
+#else
+    if (nmodes == 0)
+    {
+        init_configuration();
+        Configuration_t config = get_configuration();
+        modes[nmodes++] = (config ? config->daemonMode : ACCESSMODE_DAEMON);
+    }
+#endif
+    timer_init();
+
+    printf("benchmark,mode,threads,events,samples,min [us],p50 [us],p90 [us],p99 [us],max [us],avg [us]\n");
+    MEASURE(samples, reps, );
+    report("timerOverhead", modes[0], 1, 0, samples, reps);
+    for (int m = 0; m < nmodes; m++)
+    {
+        for (int s = 0; s < nsets; s++)
+        {
+            bench_marker(modes[m], cpus[0], eventsets[s]);
+        }
+        for (int n = 1; ; n = (n * 2 < ncpus ? n * 2 : ncpus))
+        {
+            for (int s = 0; s < nsets; s++)
+            {
+                bench_perfmon(modes[m], n, cpus, eventsets[s]);
+            }
+            bench_metrics(modes[m], n, cpus, group);
+            if (n == ncpus)
+                break;
+        }
+    }
+    free(samples);
+    free(cpus);
+    timer_finalize();
+    topology_finalize();
+    return 0;
+}